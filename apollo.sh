@@ -91,6 +91,14 @@ function check_esd_files() {
   fi
 }
 
+function check_nvjpeg_files() {
+  if [ -f /usr/local/cuda/include/nvjpeg.h ]; then
+      USE_NVJPEG=true
+  else
+      USE_NVJPEG=false
+  fi
+}
+
 function generate_build_targets() {
   COMMON_TARGETS="//cyber/... union //modules/common/kv_db/... union //modules/dreamview/..."
   case $BUILD_FILTER in
@@ -119,6 +127,9 @@ function generate_build_targets() {
   if ! $USE_ESD_CAN; then
      BUILD_TARGETS=$(echo $BUILD_TARGETS |tr ' ' '\n' | grep -v "esd")
   fi
+  if ! $USE_NVJPEG; then
+     BUILD_TARGETS=$(echo $BUILD_TARGETS |tr ' ' '\n' | grep -v "nvjpeg")
+  fi
   #skip msf for non x86_64 platforms
   if [ ${MACHINE_ARCH} != "x86_64" ]; then
      BUILD_TARGETS=$(echo $BUILD_TARGETS |tr ' ' '\n' | grep -v "msf")
@@ -691,8 +702,10 @@ function main() {
   check_machine_arch
   apollo_check_system_config
   check_esd_files
+  check_nvjpeg_files
 
   DEFINES="--define ARCH=${MACHINE_ARCH} --define CAN_CARD=${CAN_CARD} --cxxopt=-DUSE_ESD_CAN=${USE_ESD_CAN}"
+  DEFINES="${DEFINES} --define USE_NVJPEG=${USE_NVJPEG} --cxxopt=-DUSE_NVJPEG=${USE_NVJPEG}"
 
   if [ ${MACHINE_ARCH} == "x86_64" ]; then
     DEFINES="${DEFINES} --copt=-mavx2"
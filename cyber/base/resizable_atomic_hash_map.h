@@ -0,0 +1,290 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_RESIZABLE_ATOMIC_HASH_MAP_H_
+#define CYBER_BASE_RESIZABLE_ATOMIC_HASH_MAP_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+/**
+ * @brief A lock-free hash map with the API of AtomicHashMap whose bucket
+ * count doubles as it fills, a split-ordered list after Shalev and Shavit.
+ *
+ * All entries are in one lock-free list sorted by their bit reversed hash,
+ * and a bucket is a marker entry in that list, so doubling the bucket count
+ * never moves an entry: a new bucket is lazily inserted between the entries
+ * of its parent bucket when first used. Like AtomicHashMap entries are never
+ * removed, and the value replaced by a Set() is kept alive because readers
+ * may still hold it.
+ *
+ * @tparam K Type of key, must be integral
+ * @tparam V Type of value
+ * @tparam InitialSize Initial number of buckets, a power of two
+ */
+template <typename K, typename V, std::size_t InitialSize = 128,
+          typename std::enable_if<std::is_integral<K>::value &&
+                                      InitialSize != 0 &&
+                                      (InitialSize & (InitialSize - 1)) == 0,
+                                  int>::type = 0>
+class ResizableAtomicHashMap {
+ public:
+  ResizableAtomicHashMap() {
+    for (auto &segment : segments_) {
+      segment.store(nullptr, std::memory_order_relaxed);
+    }
+    Entry *head = new Entry(0);
+    GetSlot(0)->store(head, std::memory_order_release);
+  }
+  ResizableAtomicHashMap(const ResizableAtomicHashMap &other) = delete;
+  ResizableAtomicHashMap &operator=(const ResizableAtomicHashMap &other) =
+      delete;
+
+  ~ResizableAtomicHashMap() {
+    Entry *entry = GetSlot(0)->load(std::memory_order_acquire);
+    while (entry != nullptr) {
+      Entry *next = entry->next.load(std::memory_order_acquire);
+      delete entry;
+      entry = next;
+    }
+    for (auto &segment : segments_) {
+      delete[] segment.load(std::memory_order_acquire);
+    }
+  }
+
+  bool Has(K key) {
+    Entry *entry = nullptr;
+    return Find(key, &entry);
+  }
+
+  bool Get(K key, V **value) {
+    Entry *entry = nullptr;
+    if (!Find(key, &entry)) {
+      return false;
+    }
+    *value = entry->value_ptr.load(std::memory_order_acquire);
+    return true;
+  }
+
+  bool Get(K key, V *value) {
+    V *val = nullptr;
+    bool res = Get(key, &val);
+    if (res) {
+      *value = *val;
+    }
+    return res;
+  }
+
+  void Set(K key) { Insert(key, new V()); }
+
+  void Set(K key, const V &value) { Insert(key, new V(value)); }
+
+  void Set(K key, V &&value) { Insert(key, new V(std::forward<V>(value))); }
+
+  /**
+   * @brief the current number of buckets
+   */
+  uint64_t BucketCount() const {
+    return bucket_count_.load(std::memory_order_acquire);
+  }
+
+ private:
+  // a segment k > 0 holds the buckets [InitialSize << (k - 1),
+  // InitialSize << k), segment 0 the first InitialSize ones.
+  static constexpr int kMaxSegments = 48;
+  static constexpr uint64_t kMaxLoadFactor = 2;
+
+  struct Entry {
+    // a bucket marker
+    explicit Entry(uint64_t order_key) : order_key(order_key) {}
+    Entry(uint64_t order_key, K key, V *value)
+        : order_key(order_key), key(key) {
+      value_ptr.store(value, std::memory_order_relaxed);
+    }
+    ~Entry() { delete value_ptr.load(std::memory_order_acquire); }
+
+    // the bit reversed hash, odd for the entries and even for the markers
+    const uint64_t order_key;
+    const K key = 0;
+    std::atomic<V *> value_ptr = {nullptr};
+    std::atomic<Entry *> next = {nullptr};
+  };
+
+  using Slot = std::atomic<Entry *>;
+
+  static uint64_t Reverse(uint64_t x) {
+    x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+    x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+    x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);
+    x = ((x >> 16) & 0x0000FFFF0000FFFFULL) |
+        ((x & 0x0000FFFF0000FFFFULL) << 16);
+    return (x >> 32) | (x << 32);
+  }
+
+  static uint64_t Hash(K key) { return static_cast<uint64_t>(key); }
+
+  static uint64_t EntryOrderKey(uint64_t hash) { return Reverse(hash) | 1; }
+
+  static uint64_t MarkerOrderKey(uint64_t bucket) { return Reverse(bucket); }
+
+  static int HighestBit(uint64_t x) { return 63 - __builtin_clzll(x); }
+
+  // the slot of a bucket, allocating its segment when needed
+  Slot *GetSlot(uint64_t bucket) {
+    int segment = 0;
+    uint64_t offset = bucket;
+    uint64_t size = InitialSize;
+    if (bucket >= InitialSize) {
+      const int bit = HighestBit(bucket);
+      segment = bit - HighestBit(InitialSize) + 1;
+      offset = bucket - (uint64_t(1) << bit);
+      size = uint64_t(1) << bit;
+    }
+    Slot *slots = segments_[segment].load(std::memory_order_acquire);
+    if (slots == nullptr) {
+      Slot *new_slots = new Slot[size];
+      for (uint64_t i = 0; i < size; ++i) {
+        new_slots[i].store(nullptr, std::memory_order_relaxed);
+      }
+      if (segments_[segment].compare_exchange_strong(
+              slots, new_slots, std::memory_order_acq_rel,
+              std::memory_order_acquire)) {
+        slots = new_slots;
+      } else {
+        delete[] new_slots;
+      }
+    }
+    return &slots[offset];
+  }
+
+  // the marker of a bucket, inserted after the one of its parent bucket,
+  // the bucket without its highest bit, when the bucket is first used
+  Entry *GetBucket(uint64_t bucket) {
+    Slot *slot = GetSlot(bucket);
+    Entry *marker = slot->load(std::memory_order_acquire);
+    if (marker != nullptr) {
+      return marker;
+    }
+    const uint64_t parent = bucket & ~(uint64_t(1) << HighestBit(bucket));
+    Entry *new_marker = new Entry(MarkerOrderKey(bucket));
+    Entry *existing = nullptr;
+    marker = InsertEntry(GetBucket(parent), new_marker, &existing)
+                 ? new_marker
+                 : existing;
+    if (marker != new_marker) {
+      delete new_marker;
+    }
+    slot->store(marker, std::memory_order_release);
+    return marker;
+  }
+
+  Entry *GetBucketOf(uint64_t hash) {
+    const uint64_t mask = bucket_count_.load(std::memory_order_acquire) - 1;
+    return GetBucket(hash & mask);
+  }
+
+  // prev is the last entry ordered before order_key and key, target the
+  // first one not before them, returns whether target is equal to them
+  static bool Search(Entry *start, uint64_t order_key, K key, Entry **prev_ptr,
+                     Entry **target_ptr) {
+    Entry *prev = start;
+    Entry *target = start->next.load(std::memory_order_acquire);
+    while (target != nullptr &&
+           (target->order_key < order_key ||
+            (target->order_key == order_key && target->key < key))) {
+      prev = target;
+      target = target->next.load(std::memory_order_acquire);
+    }
+    *prev_ptr = prev;
+    *target_ptr = target;
+    return target != nullptr && target->order_key == order_key &&
+           target->key == key;
+  }
+
+  // links entry into the list after start unless an equal one is there
+  static bool InsertEntry(Entry *start, Entry *entry, Entry **existing) {
+    Entry *prev = nullptr;
+    Entry *target = nullptr;
+    while (true) {
+      if (Search(start, entry->order_key, entry->key, &prev, &target)) {
+        *existing = target;
+        return false;
+      }
+      entry->next.store(target, std::memory_order_relaxed);
+      if (prev->next.compare_exchange_strong(target, entry,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_relaxed)) {
+        return true;
+      }
+      // another entry has been inserted, retry
+    }
+  }
+
+  bool Find(K key, Entry **entry) {
+    const uint64_t hash = Hash(key);
+    Entry *prev = nullptr;
+    return Search(GetBucketOf(hash), EntryOrderKey(hash), key, &prev, entry);
+  }
+
+  void Insert(K key, V *value) {
+    const uint64_t hash = Hash(key);
+    const uint64_t order_key = EntryOrderKey(hash);
+    Entry *start = GetBucketOf(hash);
+    Entry *prev = nullptr;
+    Entry *target = nullptr;
+    if (Search(start, order_key, key, &prev, &target)) {
+      // key exists, update value
+      target->value_ptr.store(value, std::memory_order_release);
+      return;
+    }
+
+    Entry *new_entry = new Entry(order_key, key, value);
+    Entry *existing = nullptr;
+    if (!InsertEntry(start, new_entry, &existing)) {
+      // inserted by another thread meanwhile
+      new_entry->value_ptr.store(nullptr, std::memory_order_relaxed);
+      delete new_entry;
+      existing->value_ptr.store(value, std::memory_order_release);
+      return;
+    }
+
+    const uint64_t size = size_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    uint64_t bucket_count = bucket_count_.load(std::memory_order_acquire);
+    if (size > bucket_count * kMaxLoadFactor &&
+        bucket_count < (uint64_t(InitialSize) << (kMaxSegments - 1))) {
+      bucket_count_.compare_exchange_strong(bucket_count, bucket_count * 2,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_relaxed);
+    }
+  }
+
+  std::atomic<Slot *> segments_[kMaxSegments];
+  std::atomic<uint64_t> bucket_count_ = {InitialSize};
+  std::atomic<uint64_t> size_ = {0};
+};
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_RESIZABLE_ATOMIC_HASH_MAP_H_
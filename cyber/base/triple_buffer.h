@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_TRIPLE_BUFFER_H_
+#define CYBER_BASE_TRIPLE_BUFFER_H_
+
+#include <stdint.h>
+#include <atomic>
+
+#include "cyber/base/macros.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+/**
+ * @brief Hands the latest value of one producer to one consumer without
+ * locks. The producer fills back() and publishes it, the consumer takes
+ * the latest published value with Update() and reads it in front(). Neither
+ * ever waits for the other and values published in between are dropped.
+ */
+template <typename T>
+class TripleBuffer {
+ public:
+  TripleBuffer() {}
+  TripleBuffer& operator=(const TripleBuffer& other) = delete;
+  TripleBuffer(const TripleBuffer& other) = delete;
+
+  T* back() { return &buffers_[back_]; }
+
+  void Publish() {
+    back_ = middle_.exchange(back_ | kFresh, std::memory_order_acq_rel) &
+            kIndexMask;
+  }
+
+  /**
+   * @return true if a value was published since the last Update(), then it
+   * is front()
+   */
+  bool Update() {
+    if ((middle_.load(std::memory_order_relaxed) & kFresh) == 0) {
+      return false;
+    }
+    front_ = middle_.exchange(front_, std::memory_order_acq_rel) & kIndexMask;
+    has_value_ = true;
+    return true;
+  }
+
+  const T& front() const { return buffers_[front_]; }
+
+  /**
+   * @return whether front() holds a published value at all
+   */
+  bool has_value() const { return has_value_; }
+
+ private:
+  static constexpr uint8_t kIndexMask = 0x3;
+  static constexpr uint8_t kFresh = 0x4;
+
+  T buffers_[3];
+  alignas(CACHELINE_SIZE) std::atomic<uint8_t> middle_ = {1};
+  alignas(CACHELINE_SIZE) uint8_t back_ = 0;
+  alignas(CACHELINE_SIZE) uint8_t front_ = 2;
+  bool has_value_ = false;
+};
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_TRIPLE_BUFFER_H_
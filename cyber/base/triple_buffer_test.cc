@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/triple_buffer.h"
+
+#include <array>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+TEST(TripleBufferTest, Latest) {
+  TripleBuffer<int> buffer;
+  EXPECT_FALSE(buffer.Update());
+  EXPECT_FALSE(buffer.has_value());
+
+  *buffer.back() = 1;
+  buffer.Publish();
+  *buffer.back() = 2;
+  buffer.Publish();
+  EXPECT_TRUE(buffer.Update());
+  EXPECT_TRUE(buffer.has_value());
+  EXPECT_EQ(2, buffer.front());
+
+  // the front stays until something new is published
+  EXPECT_FALSE(buffer.Update());
+  EXPECT_EQ(2, buffer.front());
+  *buffer.back() = 3;
+  buffer.Publish();
+  EXPECT_EQ(2, buffer.front());
+  EXPECT_TRUE(buffer.Update());
+  EXPECT_EQ(3, buffer.front());
+}
+
+TEST(TripleBufferTest, Concurrency) {
+  // every value is consistent and the values read never go back
+  TripleBuffer<std::array<int, 64>> buffer;
+  std::thread producer([&]() {
+    for (int i = 1; i <= 100000; ++i) {
+      buffer.back()->fill(i);
+      buffer.Publish();
+    }
+  });
+
+  int last = 0;
+  while (last < 100000) {
+    if (!buffer.Update()) {
+      continue;
+    }
+    const auto& value = buffer.front();
+    for (const int v : value) {
+      ASSERT_EQ(value[0], v);
+    }
+    ASSERT_GT(value[0], last);
+    last = value[0];
+  }
+  producer.join();
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,167 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+// Throughput of AtomicHashMap against ResizableAtomicHashMap under
+// contention.
+//
+// Every case fills a map with a number of keys and then runs N threads,
+// each doing lookups of random keys with one update in every ten
+// operations. Channel and croutine ids are hashes, so are the keys.
+//
+//   atomic_hash_map_benchmark -k 256,4096,65536 -t 1,4,16 -n 1000000
+
+#include <getopt.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cyber/base/atomic_hash_map.h"
+#include "cyber/base/resizable_atomic_hash_map.h"
+
+using apollo::cyber::base::AtomicHashMap;
+using apollo::cyber::base::ResizableAtomicHashMap;
+
+namespace {
+
+std::vector<uint64_t> ParseList(const std::string& arg) {
+  std::vector<uint64_t> values;
+  std::stringstream ss(arg);
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    values.push_back(std::stoull(item));
+  }
+  return values;
+}
+
+std::vector<uint64_t> MakeKeys(const uint64_t num_keys) {
+  std::mt19937_64 engine(num_keys);
+  std::vector<uint64_t> keys(num_keys);
+  for (auto& key : keys) {
+    key = engine();
+  }
+  return keys;
+}
+
+// million operations per second of all threads
+template <typename Map>
+double Run(const std::vector<uint64_t>& keys, const uint64_t num_threads,
+           const uint64_t num_ops) {
+  Map map;
+  for (const uint64_t key : keys) {
+    map.Set(key, key);
+  }
+
+  std::atomic<bool> ready = {false};
+  std::atomic<uint64_t> found = {0};
+  std::vector<std::thread> threads;
+  for (uint64_t t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      std::mt19937_64 engine(t);
+      std::uniform_int_distribution<size_t> pick(0, keys.size() - 1);
+      uint64_t hits = 0;
+      uint64_t value = 0;
+      while (!ready.load()) {
+      }
+      for (uint64_t i = 0; i < num_ops; ++i) {
+        const uint64_t key = keys[pick(engine)];
+        if (i % 10 == 0) {
+          map.Set(key, i);
+        } else if (map.Get(key, &value)) {
+          ++hits;
+        }
+      }
+      found += hits;
+    });
+  }
+  const auto start = std::chrono::steady_clock::now();
+  ready = true;
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const double seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+  if (found.load() != num_threads * (num_ops - (num_ops + 9) / 10)) {
+    std::cerr << "lost keys" << std::endl;
+  }
+  return static_cast<double>(num_threads * num_ops) / seconds / 1e6;
+}
+
+void Usage(const char* name) {
+  std::cout << "Usage: " << name << " [OPTION]...\n"
+            << "    -k, --keys=N,...: numbers of keys, default 256,4096,65536\n"
+            << "    -t, --threads=N,...: numbers of threads, default 1,4,16\n"
+            << "    -n, --ops=N: operations per thread, default 1000000\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::vector<uint64_t> num_keys = {256, 4096, 65536};
+  std::vector<uint64_t> num_threads = {1, 4, 16};
+  uint64_t num_ops = 1000000;
+
+  static const struct option long_opts[] = {
+      {"keys", required_argument, nullptr, 'k'},
+      {"threads", required_argument, nullptr, 't'},
+      {"ops", required_argument, nullptr, 'n'},
+      {"help", no_argument, nullptr, 'h'},
+      {nullptr, no_argument, nullptr, 0}};
+  int opt = 0;
+  while ((opt = getopt_long(argc, argv, "k:t:n:h", long_opts, nullptr)) !=
+         -1) {
+    switch (opt) {
+      case 'k':
+        num_keys = ParseList(optarg);
+        break;
+      case 't':
+        num_threads = ParseList(optarg);
+        break;
+      case 'n':
+        num_ops = std::stoull(optarg);
+        break;
+      default:
+        Usage(argv[0]);
+        return opt == 'h' ? 0 : 1;
+    }
+  }
+
+  std::cout << std::setw(8) << "keys" << std::setw(9) << "threads"
+            << std::setw(16) << "fixed Mops/s" << std::setw(20)
+            << "resizable Mops/s" << std::endl;
+  for (const uint64_t keys : num_keys) {
+    const auto key_values = MakeKeys(keys);
+    for (const uint64_t threads : num_threads) {
+      const double fixed =
+          Run<AtomicHashMap<uint64_t, uint64_t>>(key_values, threads, num_ops);
+      const double resizable = Run<ResizableAtomicHashMap<uint64_t, uint64_t>>(
+          key_values, threads, num_ops);
+      std::cout << std::setw(8) << keys << std::setw(9) << threads
+                << std::fixed << std::setprecision(2) << std::setw(16) << fixed
+                << std::setw(20) << resizable << std::endl;
+    }
+  }
+  return 0;
+}
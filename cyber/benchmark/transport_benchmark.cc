@@ -0,0 +1,343 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+// Latency, throughput and cpu cost of the transport modes.
+//
+// Every case pairs one transmitter with N receivers in this process, sends
+// a fixed number of RawMessage payloads carrying their send time and
+// collects the delivery latency seen by each receiver.
+//
+//   transport_benchmark -m intra,shm -s 1024,1048576 -r 1,4 -n 2000
+
+#include <getopt.h>
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cyber/common/global_data.h"
+#include "cyber/common/util.h"
+#include "cyber/init.h"
+#include "cyber/message/raw_message.h"
+#include "cyber/transport/common/identity.h"
+#include "cyber/transport/transport.h"
+
+using apollo::cyber::common::GlobalData;
+using apollo::cyber::message::RawMessage;
+using apollo::cyber::proto::OptionalMode;
+using apollo::cyber::proto::RoleAttributes;
+using apollo::cyber::transport::Identity;
+using apollo::cyber::transport::MessageInfo;
+using apollo::cyber::transport::Receiver;
+using apollo::cyber::transport::Transmitter;
+using apollo::cyber::transport::Transport;
+
+namespace {
+
+struct Options {
+  std::vector<OptionalMode> modes = {OptionalMode::INTRA, OptionalMode::SHM,
+                                     OptionalMode::RTPS, OptionalMode::HYBRID};
+  std::vector<uint64_t> sizes = {1024,       16 * 1024,       256 * 1024,
+                                 1024 * 1024, 4 * 1024 * 1024, 10 * 1024 * 1024};
+  std::vector<uint64_t> readers = {1, 4, 16};
+  uint64_t messages = 1000;
+  uint64_t interval_us = 1000;
+  uint64_t timeout_ms = 5000;
+};
+
+struct Result {
+  uint64_t sent = 0;
+  uint64_t received = 0;
+  uint64_t p50_us = 0;
+  uint64_t p99_us = 0;
+  uint64_t p999_us = 0;
+  double seconds = 0.0;
+  double cpu_us_per_msg = 0.0;
+};
+
+uint64_t NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+uint64_t CpuUs() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000ULL +
+         usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+const char* ModeName(OptionalMode mode) {
+  switch (mode) {
+    case OptionalMode::INTRA:
+      return "INTRA";
+    case OptionalMode::SHM:
+      return "SHM";
+    case OptionalMode::RTPS:
+      return "RTPS";
+    default:
+      return "HYBRID";
+  }
+}
+
+uint64_t Percentile(const std::vector<uint64_t>& sorted, double percentile) {
+  if (sorted.empty()) {
+    return 0;
+  }
+  size_t index = static_cast<size_t>(sorted.size() * percentile / 100.0);
+  return sorted[std::min(index, sorted.size() - 1)];
+}
+
+RoleAttributes MakeAttr(const std::string& channel) {
+  RoleAttributes attr;
+  attr.set_channel_name(channel);
+  attr.set_channel_id(apollo::cyber::common::Hash(channel));
+  attr.set_host_name(GlobalData::Instance()->HostName());
+  attr.set_host_ip(GlobalData::Instance()->HostIp());
+  attr.set_process_id(GlobalData::Instance()->ProcessId());
+  Identity id;
+  attr.set_id(id.HashValue());
+  return attr;
+}
+
+Result RunCase(OptionalMode mode, uint64_t size, uint64_t reader_num,
+               const Options& options) {
+  static int case_index = 0;
+  const std::string channel =
+      "/apollo/cyber/benchmark/transport_" + std::to_string(case_index++);
+  auto transport = Transport::Instance();
+
+  std::mutex latency_mutex;
+  std::vector<uint64_t> latencies;
+  latencies.reserve(options.messages * reader_num);
+  std::atomic<uint64_t> received(0);
+
+  auto listener = [&](const std::shared_ptr<RawMessage>& msg,
+                      const MessageInfo&, const RoleAttributes&) {
+    uint64_t now = NowNs();
+    uint64_t send_time = 0;
+    if (msg->message.size() >= sizeof(send_time)) {
+      std::memcpy(&send_time, msg->message.data(), sizeof(send_time));
+    }
+    std::lock_guard<std::mutex> lock(latency_mutex);
+    latencies.push_back((now - send_time) / 1000);
+    received.fetch_add(1);
+  };
+
+  auto writer_attr = MakeAttr(channel);
+  auto transmitter = transport->CreateTransmitter<RawMessage>(writer_attr, mode);
+  std::vector<std::shared_ptr<Receiver<RawMessage>>> receivers;
+  for (uint64_t i = 0; i < reader_num; ++i) {
+    auto reader_attr = MakeAttr(channel);
+    auto receiver =
+        transport->CreateReceiver<RawMessage>(reader_attr, listener, mode);
+    if (mode == OptionalMode::HYBRID) {
+      // no topology in here, pair the two ends by hand
+      transmitter->Enable(reader_attr);
+      receiver->Enable(writer_attr);
+    }
+    receivers.emplace_back(receiver);
+  }
+  // let RTPS discovery settle before measuring
+  std::this_thread::sleep_for(std::chrono::milliseconds(
+      mode == OptionalMode::RTPS || mode == OptionalMode::HYBRID ? 500 : 50));
+
+  std::string payload(std::max<uint64_t>(size, sizeof(uint64_t)), 'x');
+  Result result;
+  uint64_t cpu_begin = CpuUs();
+  uint64_t begin = NowNs();
+  for (uint64_t i = 0; i < options.messages; ++i) {
+    uint64_t send_time = NowNs();
+    std::memcpy(&payload[0], &send_time, sizeof(send_time));
+    auto msg = std::make_shared<RawMessage>(payload);
+    if (transmitter->Transmit(msg)) {
+      ++result.sent;
+    }
+    if (options.interval_us > 0) {
+      std::this_thread::sleep_for(
+          std::chrono::microseconds(options.interval_us));
+    }
+  }
+
+  uint64_t expected = result.sent * reader_num;
+  uint64_t deadline = NowNs() + options.timeout_ms * 1000000ULL;
+  while (received.load() < expected && NowNs() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  result.seconds = static_cast<double>(NowNs() - begin) / 1e9;
+  uint64_t cpu_us = CpuUs() - cpu_begin;
+
+  for (auto& receiver : receivers) {
+    receiver->Disable();
+  }
+  transmitter->Disable();
+
+  std::lock_guard<std::mutex> lock(latency_mutex);
+  std::sort(latencies.begin(), latencies.end());
+  result.received = latencies.size();
+  result.p50_us = Percentile(latencies, 50.0);
+  result.p99_us = Percentile(latencies, 99.0);
+  result.p999_us = Percentile(latencies, 99.9);
+  if (result.received > 0) {
+    result.cpu_us_per_msg =
+        static_cast<double>(cpu_us) / static_cast<double>(result.received);
+  }
+  return result;
+}
+
+template <typename T, typename F>
+bool ParseList(const std::string& arg, F parse, std::vector<T>* out) {
+  out->clear();
+  std::stringstream ss(arg);
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    T value;
+    if (!parse(item, &value)) {
+      std::cout << "invalid list item: " << item << std::endl;
+      return false;
+    }
+    out->push_back(value);
+  }
+  return !out->empty();
+}
+
+bool ParseMode(const std::string& item, OptionalMode* mode) {
+  if (item == "intra") {
+    *mode = OptionalMode::INTRA;
+  } else if (item == "shm") {
+    *mode = OptionalMode::SHM;
+  } else if (item == "rtps") {
+    *mode = OptionalMode::RTPS;
+  } else if (item == "hybrid") {
+    *mode = OptionalMode::HYBRID;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool ParseUint(const std::string& item, uint64_t* value) {
+  try {
+    *value = std::stoull(item);
+  } catch (...) {
+    return false;
+  }
+  return true;
+}
+
+void DisplayUsage(const char* binary) {
+  std::cout << "usage: " << binary << " [options]\n"
+            << "\t-m, --modes <intra,shm,rtps,hybrid>\ttransports to run\n"
+            << "\t-s, --sizes <bytes,...>\t\t\tpayload sizes\n"
+            << "\t-r, --readers <n,...>\t\t\treceivers per transmitter\n"
+            << "\t-n, --messages <n>\t\t\tmessages per case\n"
+            << "\t-i, --interval <us>\t\t\tsend interval\n"
+            << "\t-t, --timeout <ms>\t\t\twait for late messages\n"
+            << "\t-h, --help\t\t\t\tshow help message" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  static const struct option long_opts[] = {
+      {"modes", required_argument, nullptr, 'm'},
+      {"sizes", required_argument, nullptr, 's'},
+      {"readers", required_argument, nullptr, 'r'},
+      {"messages", required_argument, nullptr, 'n'},
+      {"interval", required_argument, nullptr, 'i'},
+      {"timeout", required_argument, nullptr, 't'},
+      {"help", no_argument, nullptr, 'h'},
+      {nullptr, 0, nullptr, 0}};
+  int opt = 0;
+  bool ok = true;
+  while (ok && (opt = getopt_long(argc, argv, "m:s:r:n:i:t:h", long_opts,
+                                  nullptr)) != -1) {
+    switch (opt) {
+      case 'm':
+        ok = ParseList(optarg, ParseMode, &options.modes);
+        break;
+      case 's':
+        ok = ParseList(optarg, ParseUint, &options.sizes);
+        break;
+      case 'r':
+        ok = ParseList(optarg, ParseUint, &options.readers);
+        break;
+      case 'n':
+        ok = ParseUint(optarg, &options.messages);
+        break;
+      case 'i':
+        ok = ParseUint(optarg, &options.interval_us);
+        break;
+      case 't':
+        ok = ParseUint(optarg, &options.timeout_ms);
+        break;
+      default:
+        DisplayUsage(argv[0]);
+        return opt == 'h' ? 0 : -1;
+    }
+  }
+  if (!ok) {
+    DisplayUsage(argv[0]);
+    return -1;
+  }
+
+  apollo::cyber::Init(argv[0]);
+  std::cout << std::left << std::setw(8) << "mode" << std::setw(10) << "bytes"
+            << std::setw(8) << "readers" << std::setw(10) << "received"
+            << std::setw(10) << "p50(us)" << std::setw(10) << "p99(us)"
+            << std::setw(10) << "p999(us)" << std::setw(12) << "msg/s"
+            << std::setw(10) << "MB/s"
+            << "cpu(us/msg)" << std::endl;
+  for (auto mode : options.modes) {
+    for (auto size : options.sizes) {
+      for (auto reader_num : options.readers) {
+        auto result = RunCase(mode, size, reader_num, options);
+        double msg_per_sec = result.seconds > 0
+                                 ? static_cast<double>(result.received) /
+                                       result.seconds
+                                 : 0.0;
+        std::cout << std::left << std::setw(8) << ModeName(mode)
+                  << std::setw(10) << size << std::setw(8) << reader_num
+                  << std::setw(10)
+                  << (std::to_string(result.received) + "/" +
+                      std::to_string(result.sent * reader_num))
+                  << std::setw(10) << result.p50_us << std::setw(10)
+                  << result.p99_us << std::setw(10) << result.p999_us
+                  << std::setw(12) << std::fixed << std::setprecision(0)
+                  << msg_per_sec << std::setw(10) << std::setprecision(1)
+                  << msg_per_sec * static_cast<double>(size) / 1e6
+                  << std::setprecision(2) << result.cpu_us_per_msg
+                  << std::endl;
+      }
+    }
+  }
+  Transport::Instance()->Shutdown();
+  apollo::cyber::Clear();
+  return 0;
+}
@@ -18,7 +18,10 @@
 #define CYBER_BLOCKER_BLOCKER_H_
 
 #include <stddef.h>
+#include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -60,6 +63,15 @@ struct BlockerAttr {
   std::string channel_name;
 };
 
+/**
+ * @class Blocker
+ * @brief Keeps the latest published messages of a channel, newest first,
+ * and a snapshot of them taken by Observe.
+ *
+ * Observe only brings the messages published since the previous snapshot
+ * into it, and does nothing when the published queue did not change, so
+ * its cost does not grow with the capacity.
+ */
 template <typename T>
 class Blocker : public BlockerBase {
   friend class BlockerManager;
@@ -108,6 +120,13 @@ class Blocker : public BlockerBase {
   MessageQueue observed_msg_queue_;
   MessageQueue published_msg_queue_;
   mutable std::mutex msg_mutex_;
+  // bumped by every change of published_msg_queue_
+  uint64_t published_version_ = 0;
+  uint64_t observed_version_ = 0;
+  // messages pushed to published_msg_queue_ since the last Observe
+  size_t num_unobserved_ = 0;
+  // observed_msg_queue_ is no longer a snapshot of published_msg_queue_
+  bool observed_stale_ = false;
 
   CallbackMap published_callbacks_;
   mutable std::mutex cb_mutex_;
@@ -142,6 +161,9 @@ void Blocker<T>::Reset() {
     std::lock_guard<std::mutex> lock(msg_mutex_);
     observed_msg_queue_.clear();
     published_msg_queue_.clear();
+    observed_version_ = published_version_;
+    num_unobserved_ = 0;
+    observed_stale_ = false;
   }
   {
     std::lock_guard<std::mutex> lock(cb_mutex_);
@@ -153,18 +175,37 @@ template <typename T>
 void Blocker<T>::ClearObserved() {
   std::lock_guard<std::mutex> lock(msg_mutex_);
   observed_msg_queue_.clear();
+  observed_stale_ = true;
 }
 
 template <typename T>
 void Blocker<T>::ClearPublished() {
   std::lock_guard<std::mutex> lock(msg_mutex_);
   published_msg_queue_.clear();
+  ++published_version_;
 }
 
 template <typename T>
 void Blocker<T>::Observe() {
   std::lock_guard<std::mutex> lock(msg_mutex_);
-  observed_msg_queue_ = published_msg_queue_;
+  if (observed_stale_) {
+    observed_msg_queue_ = published_msg_queue_;
+  } else if (observed_version_ != published_version_) {
+    // the published queue is the unobserved messages followed by the head
+    // of the previous snapshot, since it only grows at the front and is
+    // trimmed or cleared at the back
+    size_t num_new = std::min(num_unobserved_, published_msg_queue_.size());
+    auto new_end = published_msg_queue_.begin();
+    std::advance(new_end, num_new);
+    observed_msg_queue_.insert(observed_msg_queue_.begin(),
+                               published_msg_queue_.begin(), new_end);
+    while (observed_msg_queue_.size() > published_msg_queue_.size()) {
+      observed_msg_queue_.pop_back();
+    }
+  }
+  observed_version_ = published_version_;
+  num_unobserved_ = 0;
+  observed_stale_ = false;
 }
 
 template <typename T>
@@ -253,6 +294,7 @@ void Blocker<T>::set_capacity(size_t capacity) {
   attr_.capacity = capacity;
   while (published_msg_queue_.size() > capacity) {
     published_msg_queue_.pop_back();
+    ++published_version_;
   }
 }
 
@@ -268,6 +310,8 @@ void Blocker<T>::Enqueue(const MessagePtr& msg) {
   }
   std::lock_guard<std::mutex> lock(msg_mutex_);
   published_msg_queue_.push_front(msg);
+  ++published_version_;
+  ++num_unobserved_;
   while (published_msg_queue_.size() > attr_.capacity) {
     published_msg_queue_.pop_back();
   }
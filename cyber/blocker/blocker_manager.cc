@@ -37,6 +37,7 @@ void BlockerManager::Reset() {
     item.second->Reset();
   }
   blockers_.clear();
+  ++generation_;
 }
 
 }  // namespace blocker
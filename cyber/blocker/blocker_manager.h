@@ -17,6 +17,8 @@
 #ifndef CYBER_BLOCKER_BLOCKER_MANAGER_H_
 #define CYBER_BLOCKER_BLOCKER_MANAGER_H_
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -67,6 +69,9 @@ class BlockerManager {
   void Observe();
   void Reset();
 
+  // bumped by Reset, which drops every blocker
+  uint64_t generation() const { return generation_.load(); }
+
  private:
   BlockerManager();
   BlockerManager(const BlockerManager&) = delete;
@@ -74,6 +79,30 @@ class BlockerManager {
 
   BlockerMap blockers_;
   std::mutex blocker_mutex_;
+  std::atomic<uint64_t> generation_ = {0};
+};
+
+/**
+ * @class BlockerHandle
+ * @brief The blocker of a channel resolved once, so that writers and
+ * readers skip the lookup by channel name on every message. It is resolved
+ * again, and created if needed, after BlockerManager::Reset.
+ */
+template <typename T>
+class BlockerHandle {
+ public:
+  explicit BlockerHandle(const BlockerAttr& attr) : attr_(attr) {}
+
+  /**
+   * @return nullptr if the channel's blocker holds another message type.
+   */
+  std::shared_ptr<Blocker<T>> Get() const;
+
+ private:
+  BlockerAttr attr_;
+  mutable std::mutex mutex_;
+  mutable std::shared_ptr<Blocker<T>> blocker_;
+  mutable uint64_t generation_ = 0;
 };
 
 template <typename T>
@@ -150,6 +179,18 @@ std::shared_ptr<Blocker<T>> BlockerManager::GetOrCreateBlocker(
   return blocker;
 }
 
+template <typename T>
+std::shared_ptr<Blocker<T>> BlockerHandle<T>::Get() const {
+  const auto& manager = BlockerManager::Instance();
+  uint64_t generation = manager->generation();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (blocker_ == nullptr || generation_ != generation) {
+    blocker_ = manager->GetOrCreateBlocker<T>(attr_);
+    generation_ = generation;
+  }
+  return blocker_;
+}
+
 }  // namespace blocker
 }  // namespace cyber
 }  // namespace apollo
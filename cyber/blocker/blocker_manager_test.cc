@@ -25,6 +25,29 @@ namespace blocker {
 
 using apollo::cyber::proto::UnitTest;
 
+TEST(BlockerManagerTest, handle) {
+  BlockerHandle<UnitTest> handle(BlockerAttr(5, "handle_channel"));
+  auto blocker = handle.Get();
+  ASSERT_NE(blocker, nullptr);
+  EXPECT_EQ(blocker->capacity(), 5);
+  EXPECT_EQ(handle.Get(), blocker);
+  EXPECT_EQ(
+      BlockerManager::Instance()->GetBlocker<UnitTest>("handle_channel"),
+      blocker);
+
+  // a reset drops every blocker, the handle resolves a new one
+  BlockerManager::Instance()->Reset();
+  auto new_blocker = handle.Get();
+  ASSERT_NE(new_blocker, nullptr);
+  EXPECT_NE(new_blocker, blocker);
+  EXPECT_EQ(
+      BlockerManager::Instance()->GetBlocker<UnitTest>("handle_channel"),
+      new_blocker);
+
+  BlockerHandle<proto::Chatter> wrong_type(BlockerAttr("handle_channel"));
+  EXPECT_EQ(wrong_type.Get(), nullptr);
+}
+
 }  // namespace blocker
 }  // namespace cyber
 }  // namespace apollo
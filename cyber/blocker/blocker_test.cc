@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 #include <memory>
+#include <string>
 
 #include "cyber/proto/unit_test.pb.h"
 
@@ -105,6 +106,62 @@ TEST(BlockerTest, subscribe) {
   EXPECT_FALSE(res);
 }
 
+TEST(BlockerTest, observe_incrementally) {
+  Blocker<UnitTest> blocker(BlockerAttr(3, "channel"));
+  auto publish = [&blocker](const std::string& name) {
+    auto msg = std::make_shared<UnitTest>();
+    msg->set_case_name(name);
+    blocker.Publish(msg);
+  };
+  auto observed = [&blocker]() {
+    std::string names;
+    for (auto it = blocker.ObservedBegin(); it != blocker.ObservedEnd(); ++it) {
+      names += (*it)->case_name();
+    }
+    return names;
+  };
+
+  publish("a");
+  publish("b");
+  blocker.Observe();
+  EXPECT_EQ(observed(), "ba");
+  auto kept = blocker.ObservedBegin();
+
+  // new messages push the oldest out of both queues
+  publish("c");
+  publish("d");
+  blocker.Observe();
+  EXPECT_EQ(observed(), "dcb");
+  // the snapshot is updated in place, kept messages are not copied
+  EXPECT_EQ((*kept)->case_name(), "b");
+  EXPECT_EQ(*kept, blocker.GetOldestObservedPtr());
+
+  // more new messages than the capacity
+  publish("e");
+  publish("f");
+  publish("g");
+  publish("h");
+  blocker.Observe();
+  EXPECT_EQ(observed(), "hgf");
+
+  blocker.set_capacity(2);
+  blocker.Observe();
+  EXPECT_EQ(observed(), "hg");
+
+  blocker.ClearObserved();
+  blocker.Observe();
+  EXPECT_EQ(observed(), "hg");
+
+  blocker.ClearPublished();
+  publish("i");
+  blocker.Observe();
+  EXPECT_EQ(observed(), "i");
+
+  blocker.ClearPublished();
+  blocker.Observe();
+  EXPECT_TRUE(blocker.IsObservedEmpty());
+}
+
 }  // namespace blocker
 }  // namespace cyber
 }  // namespace apollo
@@ -61,12 +61,16 @@ class IntraReader : public apollo::cyber::Reader<MessageT> {
   void OnMessage(const MessagePtr& msg_ptr);
 
   Callback msg_callback_;
+  BlockerHandle<MessageT> blocker_handle_;
 };
 
 template <typename MessageT>
 IntraReader<MessageT>::IntraReader(const proto::RoleAttributes& attr,
                                    const Callback& callback)
-    : Reader<MessageT>(attr), msg_callback_(callback) {}
+    : Reader<MessageT>(attr),
+      msg_callback_(callback),
+      blocker_handle_(BlockerAttr(attr.qos_profile().depth(),
+                                  attr.channel_name())) {}
 
 template <typename MessageT>
 IntraReader<MessageT>::~IntraReader() {
@@ -78,10 +82,14 @@ bool IntraReader<MessageT>::Init() {
   if (this->init_.exchange(true)) {
     return true;
   }
-  return BlockerManager::Instance()->Subscribe<MessageT>(
-      this->role_attr_.channel_name(), this->role_attr_.qos_profile().depth(),
-      this->role_attr_.node_name(), std::bind(&IntraReader<MessageT>::OnMessage,
-                                              this, std::placeholders::_1));
+  auto blocker = blocker_handle_.Get();
+  if (blocker == nullptr) {
+    return false;
+  }
+  return blocker->Subscribe(
+      this->role_attr_.node_name(),
+      std::bind(&IntraReader<MessageT>::OnMessage, this,
+                std::placeholders::_1));
 }
 
 template <typename MessageT>
@@ -89,14 +97,15 @@ void IntraReader<MessageT>::Shutdown() {
   if (!this->init_.exchange(false)) {
     return;
   }
-  BlockerManager::Instance()->Unsubscribe<MessageT>(
-      this->role_attr_.channel_name(), this->role_attr_.node_name());
+  auto blocker = blocker_handle_.Get();
+  if (blocker != nullptr) {
+    blocker->Unsubscribe(this->role_attr_.node_name());
+  }
 }
 
 template <typename MessageT>
 void IntraReader<MessageT>::ClearData() {
-  auto blocker = BlockerManager::Instance()->GetBlocker<MessageT>(
-      this->role_attr_.channel_name());
+  auto blocker = blocker_handle_.Get();
   if (blocker != nullptr) {
     blocker->ClearObserved();
     blocker->ClearPublished();
@@ -105,8 +114,7 @@ void IntraReader<MessageT>::ClearData() {
 
 template <typename MessageT>
 void IntraReader<MessageT>::Observe() {
-  auto blocker = BlockerManager::Instance()->GetBlocker<MessageT>(
-      this->role_attr_.channel_name());
+  auto blocker = blocker_handle_.Get();
   if (blocker != nullptr) {
     blocker->Observe();
   }
@@ -114,8 +122,7 @@ void IntraReader<MessageT>::Observe() {
 
 template <typename MessageT>
 bool IntraReader<MessageT>::Empty() const {
-  auto blocker = BlockerManager::Instance()->GetBlocker<MessageT>(
-      this->role_attr_.channel_name());
+  auto blocker = blocker_handle_.Get();
   if (blocker != nullptr) {
     return blocker->IsObservedEmpty();
   }
@@ -124,8 +131,7 @@ bool IntraReader<MessageT>::Empty() const {
 
 template <typename MessageT>
 bool IntraReader<MessageT>::HasReceived() const {
-  auto blocker = BlockerManager::Instance()->GetBlocker<MessageT>(
-      this->role_attr_.channel_name());
+  auto blocker = blocker_handle_.Get();
   if (blocker != nullptr) {
     return !blocker->IsPublishedEmpty();
   }
@@ -134,14 +140,15 @@ bool IntraReader<MessageT>::HasReceived() const {
 
 template <typename MessageT>
 void IntraReader<MessageT>::Enqueue(const std::shared_ptr<MessageT>& msg) {
-  BlockerManager::Instance()->Publish<MessageT>(this->role_attr_.channel_name(),
-                                                msg);
+  auto blocker = blocker_handle_.Get();
+  if (blocker != nullptr) {
+    blocker->Publish(msg);
+  }
 }
 
 template <typename MessageT>
 void IntraReader<MessageT>::SetHistoryDepth(const uint32_t& depth) {
-  auto blocker = BlockerManager::Instance()->GetBlocker<MessageT>(
-      this->role_attr_.channel_name());
+  auto blocker = blocker_handle_.Get();
   if (blocker != nullptr) {
     blocker->set_capacity(depth);
   }
@@ -149,8 +156,7 @@ void IntraReader<MessageT>::SetHistoryDepth(const uint32_t& depth) {
 
 template <typename MessageT>
 uint32_t IntraReader<MessageT>::GetHistoryDepth() const {
-  auto blocker = BlockerManager::Instance()->GetBlocker<MessageT>(
-      this->role_attr_.channel_name());
+  auto blocker = blocker_handle_.Get();
   if (blocker != nullptr) {
     return static_cast<uint32_t>(blocker->capacity());
   }
@@ -159,8 +165,7 @@ uint32_t IntraReader<MessageT>::GetHistoryDepth() const {
 
 template <typename MessageT>
 std::shared_ptr<MessageT> IntraReader<MessageT>::GetLatestObserved() const {
-  auto blocker = BlockerManager::Instance()->GetBlocker<MessageT>(
-      this->role_attr_.channel_name());
+  auto blocker = blocker_handle_.Get();
   if (blocker != nullptr) {
     return blocker->GetLatestObservedPtr();
   }
@@ -169,8 +174,7 @@ std::shared_ptr<MessageT> IntraReader<MessageT>::GetLatestObserved() const {
 
 template <typename MessageT>
 std::shared_ptr<MessageT> IntraReader<MessageT>::GetOldestObserved() const {
-  auto blocker = BlockerManager::Instance()->GetBlocker<MessageT>(
-      this->role_attr_.channel_name());
+  auto blocker = blocker_handle_.Get();
   if (blocker != nullptr) {
     return blocker->GetOldestObservedPtr();
   }
@@ -179,18 +183,16 @@ std::shared_ptr<MessageT> IntraReader<MessageT>::GetOldestObserved() const {
 
 template <typename MessageT>
 auto IntraReader<MessageT>::Begin() const -> Iterator {
-  auto blocker = BlockerManager::Instance()->GetBlocker<MessageT>(
-      this->role_attr_.channel_name());
+  auto blocker = blocker_handle_.Get();
   ACHECK(blocker != nullptr);
   return blocker->ObservedBegin();
 }
 
 template <typename MessageT>
 auto IntraReader<MessageT>::End() const -> Iterator {
-  auto blocker = BlockerManager::Instance()->GetBlocker<MessageT>(
-      this->role_attr_.channel_name());
+  auto blocker = blocker_handle_.Get();
   ACHECK(blocker != nullptr);
-  return blocker->ObservedBegin();
+  return blocker->ObservedEnd();
 }
 
 template <typename MessageT>
@@ -30,7 +30,6 @@ template <typename MessageT>
 class IntraWriter : public apollo::cyber::Writer<MessageT> {
  public:
   using MessagePtr = std::shared_ptr<MessageT>;
-  using BlockerManagerPtr = std::shared_ptr<BlockerManager>;
 
   explicit IntraWriter(const proto::RoleAttributes& attr);
   virtual ~IntraWriter();
@@ -42,12 +41,13 @@ class IntraWriter : public apollo::cyber::Writer<MessageT> {
   bool Write(const MessagePtr& msg_ptr) override;
 
  private:
-  BlockerManagerPtr blocker_manager_;
+  BlockerHandle<MessageT> blocker_handle_;
 };
 
 template <typename MessageT>
 IntraWriter<MessageT>::IntraWriter(const proto::RoleAttributes& attr)
-    : Writer<MessageT>(attr) {}
+    : Writer<MessageT>(attr),
+      blocker_handle_(BlockerAttr(attr.channel_name())) {}
 
 template <typename MessageT>
 IntraWriter<MessageT>::~IntraWriter() {
@@ -59,9 +59,7 @@ bool IntraWriter<MessageT>::Init() {
   {
     std::lock_guard<std::mutex> g(this->lock_);
     if (this->init_) { return true; }
-    blocker_manager_ = BlockerManager::Instance();
-    blocker_manager_->GetOrCreateBlocker<MessageT>(
-        BlockerAttr(this->role_attr_.channel_name()));
+    blocker_handle_.Get();
     this->init_ = true;
   }
   return true;
@@ -74,7 +72,6 @@ void IntraWriter<MessageT>::Shutdown() {
     if (!this->init_) { return; }
     this->init_ = false;
   }
-  blocker_manager_ = nullptr;
 }
 
 template <typename MessageT>
@@ -82,8 +79,12 @@ bool IntraWriter<MessageT>::Write(const MessageT& msg) {
   if (!WriterBase::IsInit()) {
     return false;
   }
-  return blocker_manager_->Publish<MessageT>(this->role_attr_.channel_name(),
-                                             msg);
+  auto blocker = blocker_handle_.Get();
+  if (blocker == nullptr) {
+    return false;
+  }
+  blocker->Publish(msg);
+  return true;
 }
 
 template <typename MessageT>
@@ -91,8 +92,12 @@ bool IntraWriter<MessageT>::Write(const MessagePtr& msg_ptr) {
   if (!WriterBase::IsInit()) {
     return false;
   }
-  return blocker_manager_->Publish<MessageT>(this->role_attr_.channel_name(),
-                                             msg_ptr);
+  auto blocker = blocker_handle_.Get();
+  if (blocker == nullptr) {
+    return false;
+  }
+  blocker->Publish(msg_ptr);
+  return true;
 }
 
 }  // namespace blocker
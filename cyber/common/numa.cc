@@ -0,0 +1,179 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/common/numa.h"
+
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace common {
+
+namespace {
+
+constexpr char kSysNodeDir[] = "/sys/devices/system/node";
+// nodes are numbered densely in practice, this only bounds the probing
+constexpr int kMaxNodeNum = 64;
+
+bool ReadFirstLine(const std::string& path, std::string* line) {
+  std::ifstream fin(path);
+  return fin.is_open() && std::getline(fin, *line);
+}
+
+}  // namespace
+
+bool ParseCpuList(const std::string& str, std::vector<int>* cpus) {
+  std::vector<int> result;
+  std::stringstream ss(str);
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    if (item.empty()) {
+      continue;
+    }
+    int first = 0;
+    int last = 0;
+    char dash = 0;
+    std::stringstream item_ss(item);
+    if (!(item_ss >> first)) {
+      return false;
+    }
+    last = first;
+    if (item_ss >> dash) {
+      if (dash != '-' || !(item_ss >> last) || last < first) {
+        return false;
+      }
+    }
+    for (int cpu = first; cpu <= last; ++cpu) {
+      result.push_back(cpu);
+    }
+  }
+  cpus->swap(result);
+  return true;
+}
+
+NumaTopology::NumaTopology() {
+  if (!Load(kSysNodeDir)) {
+    LoadSingleNode();
+  }
+  ADEBUG << "numa node num: " << node_num();
+}
+
+bool NumaTopology::Load(const std::string& node_dir) {
+  std::vector<std::vector<int>> node_cpus;
+  for (int node = 0; node < kMaxNodeNum; ++node) {
+    std::string line;
+    if (!ReadFirstLine(node_dir + "/node" + std::to_string(node) + "/cpulist",
+                       &line)) {
+      break;
+    }
+    std::vector<int> cpus;
+    if (!ParseCpuList(line, &cpus)) {
+      AWARN << "bad cpulist of numa node " << node << ": " << line;
+      return false;
+    }
+    node_cpus.push_back(cpus);
+  }
+  if (node_cpus.empty()) {
+    return false;
+  }
+
+  node_cpus_.swap(node_cpus);
+  cpu_nodes_.clear();
+  for (int node = 0; node < node_num(); ++node) {
+    for (int cpu : node_cpus_[node]) {
+      if (cpu >= static_cast<int>(cpu_nodes_.size())) {
+        cpu_nodes_.resize(cpu + 1, -1);
+      }
+      cpu_nodes_[cpu] = node;
+    }
+  }
+  return true;
+}
+
+void NumaTopology::LoadSingleNode() {
+  long cpu_num = sysconf(_SC_NPROCESSORS_ONLN);
+  node_cpus_.assign(1, std::vector<int>());
+  cpu_nodes_.assign(cpu_num > 0 ? cpu_num : 0, 0);
+  for (long cpu = 0; cpu < cpu_num; ++cpu) {
+    node_cpus_[0].push_back(static_cast<int>(cpu));
+  }
+}
+
+const std::vector<int>& NumaTopology::NodeCpus(int node) const {
+  static const std::vector<int> kEmpty;
+  if (node < 0 || node >= node_num()) {
+    return kEmpty;
+  }
+  return node_cpus_[node];
+}
+
+int NumaTopology::NodeOfCpu(int cpu) const {
+  if (cpu < 0 || cpu >= static_cast<int>(cpu_nodes_.size())) {
+    return -1;
+  }
+  return cpu_nodes_[cpu];
+}
+
+int NumaTopology::CurrentNode() const {
+  if (!is_numa()) {
+    return node_num() == 1 ? 0 : -1;
+  }
+  return NodeOfCpu(sched_getcpu());
+}
+
+bool PreferNumaNode(void* addr, std::size_t len, int node) {
+  constexpr int kBitsPerWord = 8 * sizeof(unsigned long);  // NOLINT
+  if (node < 0 || node >= kMaxNodeNum) {
+    return false;
+  }
+  unsigned long mask[kMaxNodeNum / kBitsPerWord] = {0};  // NOLINT
+  mask[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+  // mbind wants a page aligned start
+  auto page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  auto start = reinterpret_cast<uintptr_t>(addr) & ~(page - 1);
+  len += reinterpret_cast<uintptr_t>(addr) - start;
+  if (syscall(SYS_mbind, start, len, MPOL_PREFERRED, mask, kMaxNodeNum + 1,
+              0) != 0) {
+    ADEBUG << "mbind to node " << node << " failed: " << strerror(errno);
+    return false;
+  }
+  return true;
+}
+
+int NumaNodeOfAddress(const void* addr) {
+  int node = -1;
+  if (syscall(SYS_get_mempolicy, &node, nullptr, 0, addr,
+              MPOL_F_NODE | MPOL_F_ADDR) != 0) {
+    return -1;
+  }
+  return node;
+}
+
+}  // namespace common
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#ifndef CYBER_COMMON_NUMA_H_
+#define CYBER_COMMON_NUMA_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "cyber/common/macros.h"
+
+namespace apollo {
+namespace cyber {
+namespace common {
+
+/**
+ * @brief Parses a kernel cpu list such as "0-3,8,10-11".
+ * @return false, leaving cpus untouched, if the list is malformed.
+ */
+bool ParseCpuList(const std::string& str, std::vector<int>* cpus);
+
+/**
+ * @class NumaTopology
+ * @brief Maps cpus to NUMA nodes, as exposed under /sys/devices/system/node.
+ *
+ * A host without that directory, e.g. a single node kernel built without
+ * CONFIG_NUMA, is reported as one node owning every online cpu.
+ */
+class NumaTopology {
+ public:
+  /**
+   * @brief Reloads the topology from a sysfs node directory.
+   * @return false if no node could be read.
+   */
+  bool Load(const std::string& node_dir);
+
+  int node_num() const { return static_cast<int>(node_cpus_.size()); }
+  bool is_numa() const { return node_cpus_.size() > 1; }
+
+  /**
+   * @return the cpus of the node, empty for an unknown node.
+   */
+  const std::vector<int>& NodeCpus(int node) const;
+
+  /**
+   * @return the node of the cpu, -1 if unknown.
+   */
+  int NodeOfCpu(int cpu) const;
+
+  /**
+   * @return the node of the cpu the calling thread runs on, -1 if unknown.
+   */
+  int CurrentNode() const;
+
+ private:
+  void LoadSingleNode();
+
+  std::vector<std::vector<int>> node_cpus_;
+  std::vector<int> cpu_nodes_;
+
+  DECLARE_SINGLETON(NumaTopology)
+};
+
+/**
+ * @brief Asks the kernel to place the pages of [addr, addr + len) on the
+ * node, falling back to other nodes when it is full. Only pages faulted in
+ * afterwards are affected, so call it before the memory is first touched.
+ */
+bool PreferNumaNode(void* addr, std::size_t len, int node);
+
+/**
+ * @return the node holding the page at addr, -1 if unknown.
+ */
+int NumaNodeOfAddress(const void* addr);
+
+}  // namespace common
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_COMMON_NUMA_H_
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/common/numa.h"
+
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace apollo {
+namespace cyber {
+namespace common {
+
+namespace {
+
+void WriteCpuList(const std::string& dir, int node, const std::string& list) {
+  std::string node_dir = dir + "/node" + std::to_string(node);
+  mkdir(node_dir.c_str(), 0755);
+  std::ofstream(node_dir + "/cpulist") << list << std::endl;
+}
+
+}  // namespace
+
+TEST(NumaTest, ParseCpuList) {
+  std::vector<int> cpus;
+  EXPECT_TRUE(ParseCpuList("0-3,8,10-11", &cpus));
+  EXPECT_EQ(std::vector<int>({0, 1, 2, 3, 8, 10, 11}), cpus);
+  EXPECT_TRUE(ParseCpuList("", &cpus));
+  EXPECT_TRUE(cpus.empty());
+
+  cpus = {5};
+  EXPECT_FALSE(ParseCpuList("3-1", &cpus));
+  EXPECT_FALSE(ParseCpuList("a", &cpus));
+  EXPECT_FALSE(ParseCpuList("1:2", &cpus));
+  EXPECT_EQ(std::vector<int>({5}), cpus);
+}
+
+TEST(NumaTest, Load) {
+  char dir[] = "/tmp/numa_test_XXXXXX";
+  ASSERT_NE(nullptr, mkdtemp(dir));
+  WriteCpuList(dir, 0, "0-1,4-5");
+  WriteCpuList(dir, 1, "2-3,6-7");
+
+  auto topology = NumaTopology::Instance();
+  EXPECT_FALSE(topology->Load(std::string(dir) + "/missing"));
+  ASSERT_TRUE(topology->Load(dir));
+  EXPECT_EQ(2, topology->node_num());
+  EXPECT_TRUE(topology->is_numa());
+  EXPECT_EQ(std::vector<int>({2, 3, 6, 7}), topology->NodeCpus(1));
+  EXPECT_TRUE(topology->NodeCpus(2).empty());
+  EXPECT_EQ(0, topology->NodeOfCpu(5));
+  EXPECT_EQ(1, topology->NodeOfCpu(6));
+  EXPECT_EQ(-1, topology->NodeOfCpu(8));
+  EXPECT_EQ(-1, topology->NodeOfCpu(-1));
+
+  WriteCpuList(dir, 2, "x");
+  EXPECT_FALSE(topology->Load(dir));
+  // a failed load keeps the previous topology
+  EXPECT_EQ(2, topology->node_num());
+
+  topology->Load("/sys/devices/system/node");
+}
+
+TEST(NumaTest, PreferNumaNode) {
+  auto topology = NumaTopology::Instance();
+  ASSERT_GT(topology->node_num(), 0);
+  int node = topology->node_num() - 1;
+
+  const size_t len = 4 * sysconf(_SC_PAGESIZE);
+  void* addr = mmap(nullptr, len, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  ASSERT_NE(MAP_FAILED, addr);
+  EXPECT_FALSE(PreferNumaNode(addr, len, -1));
+  if (PreferNumaNode(static_cast<char*>(addr) + 1, len - 1, node)) {
+    static_cast<char*>(addr)[0] = 1;
+    EXPECT_EQ(node, NumaNodeOfAddress(addr));
+  }
+  munmap(addr, len);
+}
+
+}  // namespace common
+}  // namespace cyber
+}  // namespace apollo
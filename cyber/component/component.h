@@ -181,6 +181,11 @@ bool Component<M0, NullType, NullType, NullType>::Initialize(
   auto dv = std::make_shared<data::DataVisitor<M0>>(conf);
   croutine::RoutineFactory factory =
       croutine::CreateRoutineFactory<M0>(func, dv);
+  factory.stack_size = config.stack_size() * 1024;
+  if (config.deadline_ms() > 0) {
+    factory.deadline =
+        croutine::CreateDeadlineFunc<M0>(dv, config.deadline_ms());
+  }
   auto sched = scheduler::Instance();
   return sched->CreateTask(factory, node_->Name());
 }
@@ -278,6 +283,11 @@ bool Component<M0, M1, NullType, NullType>::Initialize(
   auto dv = std::make_shared<data::DataVisitor<M0, M1>>(config_list);
   croutine::RoutineFactory factory =
       croutine::CreateRoutineFactory<M0, M1>(func, dv);
+  factory.stack_size = config.stack_size() * 1024;
+  if (config.deadline_ms() > 0) {
+    factory.deadline =
+        croutine::CreateDeadlineFunc<M0>(dv, config.deadline_ms());
+  }
   return sched->CreateTask(factory, node_->Name());
 }
 
@@ -388,6 +398,11 @@ bool Component<M0, M1, M2, NullType>::Initialize(
   auto dv = std::make_shared<data::DataVisitor<M0, M1, M2>>(config_list);
   croutine::RoutineFactory factory =
       croutine::CreateRoutineFactory<M0, M1, M2>(func, dv);
+  factory.stack_size = config.stack_size() * 1024;
+  if (config.deadline_ms() > 0) {
+    factory.deadline =
+        croutine::CreateDeadlineFunc<M0>(dv, config.deadline_ms());
+  }
   return sched->CreateTask(factory, node_->Name());
 }
 
@@ -511,6 +526,11 @@ bool Component<M0, M1, M2, M3>::Initialize(const ComponentConfig& config) {
   auto dv = std::make_shared<data::DataVisitor<M0, M1, M2, M3>>(config_list);
   croutine::RoutineFactory factory =
       croutine::CreateRoutineFactory<M0, M1, M2, M3>(func, dv);
+  factory.stack_size = config.stack_size() * 1024;
+  if (config.deadline_ms() > 0) {
+    factory.deadline =
+        croutine::CreateDeadlineFunc<M0>(dv, config.deadline_ms());
+  }
   return sched->CreateTask(factory, node_->Name());
 }
 
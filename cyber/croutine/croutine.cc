@@ -18,7 +18,6 @@
 
 #include <utility>
 
-#include "cyber/base/concurrent_object_pool.h"
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/croutine/detail/routine_context.h"
@@ -35,8 +34,9 @@ thread_local CRoutine *CRoutine::current_routine_ = nullptr;
 thread_local char *CRoutine::main_stack_ = nullptr;
 
 namespace {
-std::shared_ptr<base::CCObjectPool<RoutineContext>> context_pool = nullptr;
+std::shared_ptr<ContextPool> context_pool = nullptr;
 std::once_flag pool_init_flag;
+size_t default_stack_size = STACK_SIZE;
 
 void CRoutineEntry(void *arg) {
   CRoutine *r = static_cast<CRoutine *>(arg);
@@ -45,26 +45,30 @@ void CRoutineEntry(void *arg) {
 }
 }
 
-CRoutine::CRoutine(const std::function<void()> &func) : func_(func) {
+CRoutine::CRoutine(const std::function<void()> &func, size_t stack_size)
+    : func_(func) {
   std::call_once(pool_init_flag, [&]() {
     auto routine_num = 100;
     auto &global_conf = common::GlobalData::Instance()->Config();
-    if (global_conf.has_scheduler_conf() &&
-        global_conf.scheduler_conf().has_routine_num()) {
-      routine_num = global_conf.scheduler_conf().routine_num();
+    if (global_conf.has_scheduler_conf()) {
+      auto &sched_conf = global_conf.scheduler_conf();
+      if (sched_conf.has_routine_num()) {
+        routine_num = sched_conf.routine_num();
+      }
+      if (sched_conf.has_routine_stack_size()) {
+        default_stack_size = sched_conf.routine_stack_size() * 1024;
+      }
     }
-    context_pool.reset(new base::CCObjectPool<RoutineContext>(routine_num));
+    context_pool.reset(new ContextPool(routine_num));
   });
 
-  context_ = context_pool->GetObject();
-  if (context_ == nullptr) {
-    AWARN << "Maximum routine context number exceeded! Please check "
-             "[routine_num] in config file.";
-    context_.reset(new RoutineContext());
-  }
+  context_ = context_pool->GetContext(stack_size == 0 ? default_stack_size
+                                                      : stack_size);
 
   MakeContext(CRoutineEntry, this, context_.get());
   state_ = RoutineState::READY;
+  ready_time_ns_.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count());
   updated_.test_and_set(std::memory_order_release);
 }
 
@@ -88,6 +92,17 @@ RoutineState CRoutine::Resume() {
   PerfEventCache::Instance()->AddSchedEvent(
       SchedPerf::SWAP_OUT, id_, processor_id_, static_cast<int>(state_));
   current_routine_ = nullptr;
+
+  stats_.yields.store(stats_.yields.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+  if (state_ == RoutineState::READY) {
+    // plain Yield(), the croutine is runnable again right away
+    ready_time_ns_.store(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count(),
+        std::memory_order_relaxed);
+  }
   return state_;
 }
 
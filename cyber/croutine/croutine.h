@@ -27,6 +27,7 @@
 
 #include "cyber/common/log.h"
 #include "cyber/croutine/detail/routine_context.h"
+#include "cyber/croutine/routine_stats.h"
 
 namespace apollo {
 namespace cyber {
@@ -39,7 +40,8 @@ enum class RoutineState { READY, FINISHED, SLEEP, IO_WAIT, DATA_WAIT };
 
 class CRoutine {
  public:
-  explicit CRoutine(const RoutineFunc &func);
+  // stack_size in bytes, 0 uses the scheduler's routine_stack_size
+  explicit CRoutine(const RoutineFunc &func, size_t stack_size = 0);
   virtual ~CRoutine();
 
   // static interfaces
@@ -87,6 +89,25 @@ class CRoutine {
   void set_priority(uint32_t priority);
 
   std::chrono::steady_clock::time_point wake_time() const;
+  // when the croutine last became ready to run
+  std::chrono::steady_clock::time_point ready_time() const;
+
+  // Absolute deadline in nanoseconds inherited from the message being
+  // handled, 0 if none. Deadline aware croutines are scheduled earliest
+  // deadline first within their priority band.
+  uint64_t deadline() const {
+    return deadline_ns_.load(std::memory_order_relaxed);
+  }
+  void set_deadline(uint64_t deadline_ns) {
+    deadline_ns_.store(deadline_ns, std::memory_order_relaxed);
+  }
+  bool deadline_aware() const { return deadline_aware_; }
+  void set_deadline_aware(bool deadline_aware) {
+    deadline_aware_ = deadline_aware;
+  }
+
+  RoutineStats *mutable_stats() { return &stats_; }
+  const RoutineStats &stats() const { return stats_; }
 
   void set_group_name(const std::string& group_name) {
     group_name_ = group_name;
@@ -112,6 +133,12 @@ class CRoutine {
   std::atomic_flag lock_ = ATOMIC_FLAG_INIT;
   std::atomic_flag updated_ = ATOMIC_FLAG_INIT;
 
+  // steady clock nanoseconds, set by notifying threads
+  std::atomic<int64_t> ready_time_ns_ = {0};
+  std::atomic<uint64_t> deadline_ns_ = {0};
+  bool deadline_aware_ = false;
+  RoutineStats stats_;
+
   bool force_stop_ = false;
 
   int processor_id_ = -1;
@@ -152,6 +179,11 @@ inline std::chrono::steady_clock::time_point CRoutine::wake_time() const {
   return wake_time_;
 }
 
+inline std::chrono::steady_clock::time_point CRoutine::ready_time() const {
+  return std::chrono::steady_clock::time_point(
+      std::chrono::nanoseconds(ready_time_ns_.load(std::memory_order_relaxed)));
+}
+
 inline void CRoutine::Wake() { state_ = RoutineState::READY; }
 
 inline void CRoutine::HangUp() { CRoutine::Yield(RoutineState::DATA_WAIT); }
@@ -180,6 +212,10 @@ inline RoutineState CRoutine::UpdateState() {
   if (state_ == RoutineState::SLEEP &&
       std::chrono::steady_clock::now() > wake_time_) {
     state_ = RoutineState::READY;
+    ready_time_ns_.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             wake_time_.time_since_epoch())
+                             .count(),
+                         std::memory_order_relaxed);
     return state_;
   }
 
@@ -205,6 +241,10 @@ inline void CRoutine::Release() {
 }
 
 inline void CRoutine::SetUpdateFlag() {
+  ready_time_ns_.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now().time_since_epoch())
+                           .count(),
+                       std::memory_order_relaxed);
   updated_.clear(std::memory_order_release);
 }
 
@@ -46,6 +46,56 @@ TEST(Croutine, croutinetest) {
   EXPECT_EQ(cr->state(), RoutineState::IO_WAIT);
   cr->Stop();
   EXPECT_EQ(cr->Resume(), RoutineState::FINISHED);
+  EXPECT_EQ(cr->stats().yields.load(), 1);
+}
+
+TEST(Croutine, context_pool) {
+  auto pool = std::make_shared<ContextPool>(1);
+  EXPECT_EQ(ContextPool::AlignedStackSize(0), STACK_SIZE);
+  EXPECT_EQ(ContextPool::AlignedStackSize(1), MIN_STACK_SIZE);
+
+  auto context = pool->GetContext(64 * 1024);
+  ASSERT_NE(context->stack, nullptr);
+  EXPECT_EQ(context->stack_size, 64 * 1024);
+  // only the top of the stack is ever touched
+  context->stack[context->stack_size - 1] = 1;
+  auto stack = context->stack;
+  context.reset();
+  EXPECT_EQ(pool->idle_size(), 1);
+
+  auto reused = pool->GetContext(64 * 1024);
+  EXPECT_EQ(reused->stack, stack);
+  auto other = pool->GetContext(128 * 1024);
+  EXPECT_NE(other->stack, stack);
+  EXPECT_EQ(pool->idle_size(), 0);
+  reused.reset();
+  other.reset();
+  EXPECT_EQ(pool->idle_size(), 2);
+
+  auto small = std::make_shared<CRoutine>(function, 32 * 1024);
+  EXPECT_EQ(small->GetContext()->stack_size, 32 * 1024);
+}
+
+TEST(Croutine, stack_guard_page) {
+  auto pool = std::make_shared<ContextPool>(1);
+  auto context = pool->GetContext(MIN_STACK_SIZE);
+  EXPECT_DEATH(context->stack[-1] = 1, "");
+}
+
+TEST(Croutine, latency_histogram) {
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.Percentile(50.0), 0);
+  for (int i = 0; i < 98; ++i) {
+    histogram.Add(3);
+  }
+  histogram.Add(1000);
+  histogram.Add(5000);
+  EXPECT_EQ(histogram.count(), 100);
+  EXPECT_EQ(histogram.sum_us(), 98 * 3 + 1000 + 5000);
+  EXPECT_EQ(histogram.max_us(), 5000);
+  EXPECT_EQ(histogram.bucket(2), 98);
+  EXPECT_EQ(histogram.Percentile(50.0), 4);
+  EXPECT_EQ(histogram.Percentile(99.0), 8192);
 }
 
 }  // namespace croutine
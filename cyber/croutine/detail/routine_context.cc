@@ -16,10 +16,110 @@
 
 #include "cyber/croutine/detail/routine_context.h"
 
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+
 namespace apollo {
 namespace cyber {
 namespace croutine {
 
+namespace {
+size_t PageSize() {
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return page_size;
+}
+}  // namespace
+
+RoutineContext::RoutineContext(size_t size)
+    : stack_size(ContextPool::AlignedStackSize(size)) {
+  region_size_ = stack_size + PageSize();
+  void *region = mmap(nullptr, region_size_, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (region == MAP_FAILED) {
+    AERROR << "mmap croutine stack of " << stack_size
+           << " bytes failed, errno: " << errno;
+    region_ = nullptr;
+    region_size_ = 0;
+    stack = static_cast<char*>(std::malloc(stack_size));
+    return;
+  }
+  region_ = static_cast<char*>(region);
+  if (mprotect(region_, PageSize(), PROT_NONE) != 0) {
+    AWARN << "protect croutine stack guard page failed, errno: " << errno;
+  }
+  stack = region_ + PageSize();
+}
+
+RoutineContext::~RoutineContext() {
+  if (region_ != nullptr) {
+    munmap(region_, region_size_);
+  } else {
+    std::free(stack);
+  }
+}
+
+ContextPool::~ContextPool() {
+  for (auto& bucket : idle_) {
+    for (auto context : bucket.second) {
+      delete context;
+    }
+  }
+}
+
+size_t ContextPool::AlignedStackSize(size_t stack_size) {
+  if (stack_size == 0) {
+    stack_size = STACK_SIZE;
+  }
+  if (stack_size < MIN_STACK_SIZE) {
+    stack_size = MIN_STACK_SIZE;
+  }
+  auto page_size = PageSize();
+  return (stack_size + page_size - 1) / page_size * page_size;
+}
+
+std::shared_ptr<RoutineContext> ContextPool::GetContext(size_t stack_size) {
+  stack_size = AlignedStackSize(stack_size);
+  RoutineContext *context = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& bucket = idle_[stack_size];
+    if (!bucket.empty()) {
+      context = bucket.back();
+      bucket.pop_back();
+    }
+  }
+  if (context == nullptr) {
+    context = new RoutineContext(stack_size);
+  }
+  auto self = shared_from_this();
+  return std::shared_ptr<RoutineContext>(
+      context, [self](RoutineContext *ctx) { self->Release(ctx); });
+}
+
+size_t ContextPool::idle_size() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t size = 0;
+  for (auto& bucket : idle_) {
+    size += bucket.second.size();
+  }
+  return size;
+}
+
+void ContextPool::Release(RoutineContext *context) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& bucket = idle_[context->stack_size];
+    if (bucket.size() < capacity_) {
+      context->sp = nullptr;
+      bucket.push_back(context);
+      return;
+    }
+  }
+  delete context;
+}
+
 //  The stack layout looks as follows:
 //
 //              +------------------+
@@ -38,9 +138,10 @@ namespace croutine {
 // ctx->sp  =>  |        RBP       |
 //              +------------------+
 void MakeContext(const func &f1, const void *arg, RoutineContext *ctx) {
-  ctx->sp = ctx->stack + STACK_SIZE - 2 * sizeof(void *) - REGISTERS_SIZE;
+  ctx->sp =
+      ctx->stack + ctx->stack_size - 2 * sizeof(void *) - REGISTERS_SIZE;
   std::memset(ctx->sp, 0, REGISTERS_SIZE);
-  char *sp = ctx->stack + STACK_SIZE - 2 * sizeof(void *);
+  char *sp = ctx->stack + ctx->stack_size - 2 * sizeof(void *);
   *reinterpret_cast<void **>(sp) = reinterpret_cast<void *>(f1);
   sp -= sizeof(void *);
   *reinterpret_cast<void **>(sp) = const_cast<void *>(arg);
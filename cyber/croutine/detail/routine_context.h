@@ -20,6 +20,10 @@
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "cyber/common/log.h"
 
@@ -32,12 +36,58 @@ namespace cyber {
 namespace croutine {
 
 constexpr size_t STACK_SIZE = 2 * 1024 * 1024;
+constexpr size_t MIN_STACK_SIZE = 16 * 1024;
 constexpr size_t REGISTERS_SIZE = 56;
 
 typedef void (*func)(void*);
+
+/**
+ * @brief A croutine stack mapped with a PROT_NONE guard page below it.
+ *
+ * The mapping is lazily backed, so only the pages a croutine actually touches
+ * count towards RSS, and an overflow faults on the guard page instead of
+ * silently corrupting a neighbouring stack.
+ */
 struct RoutineContext {
-  char stack[STACK_SIZE];
+  explicit RoutineContext(size_t size = STACK_SIZE);
+  ~RoutineContext();
+
+  char* stack = nullptr;
+  size_t stack_size = 0;
   char* sp = nullptr;
+
+ private:
+  RoutineContext(const RoutineContext&) = delete;
+  RoutineContext& operator=(const RoutineContext&) = delete;
+
+  char* region_ = nullptr;
+  size_t region_size_ = 0;
+};
+
+/**
+ * @class ContextPool
+ * @brief Keeps released croutine stacks for reuse, bucketed by stack size.
+ *
+ * At most `capacity` idle stacks are kept per size, the rest are unmapped.
+ */
+class ContextPool : public std::enable_shared_from_this<ContextPool> {
+ public:
+  explicit ContextPool(size_t capacity) : capacity_(capacity) {}
+  ~ContextPool();
+
+  // the size is rounded up to whole pages, and 0 means STACK_SIZE
+  std::shared_ptr<RoutineContext> GetContext(size_t stack_size);
+
+  size_t idle_size();
+
+  static size_t AlignedStackSize(size_t stack_size);
+
+ private:
+  void Release(RoutineContext* context);
+
+  size_t capacity_;
+  std::mutex mutex_;
+  std::unordered_map<size_t, std::vector<RoutineContext*>> idle_;
 };
 
 void MakeContext(const func& f1, const void* arg, RoutineContext* ctx);
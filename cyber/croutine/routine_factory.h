@@ -25,6 +25,8 @@
 #include "cyber/croutine/croutine.h"
 #include "cyber/data/data_visitor.h"
 #include "cyber/event/perf_event_cache.h"
+#include "cyber/message/message_traits.h"
+#include "cyber/time/time.h"
 
 namespace apollo {
 namespace cyber {
@@ -34,8 +36,13 @@ class RoutineFactory {
  public:
   using VoidFunc = std::function<void()>;
   using CreateRoutineFunc = std::function<VoidFunc()>;
+  using DeadlineFunc = std::function<uint64_t()>;
   // We can use routine_func directly.
   CreateRoutineFunc create_routine;
+  // croutine stack size in bytes, 0 uses the scheduler default
+  size_t stack_size = 0;
+  // evaluated whenever new data arrives, see CreateDeadlineFunc
+  DeadlineFunc deadline = nullptr;
   inline std::shared_ptr<data::DataVisitorBase> GetDataVisitor() const {
     return data_visitor_;
   }
@@ -141,6 +148,29 @@ RoutineFactory CreateRoutineFactory(
   return factory;
 }
 
+/**
+ * @brief Deadline of the newest message the visitor holds: its header
+ * timestamp, or its arrival time if it has no header, plus the budget.
+ * Nanoseconds of cyber::Time, the clock header timestamps are taken from.
+ */
+template <typename M0, typename DataVisitorT>
+RoutineFactory::DeadlineFunc CreateDeadlineFunc(
+    const std::shared_ptr<DataVisitorT>& dv, uint64_t budget_ms) {
+  const uint64_t budget_ns = budget_ms * 1000000;
+  // the visitor keeps this function through its notify callback
+  std::weak_ptr<DataVisitorT> weak_dv = dv;
+  return [weak_dv, budget_ns]() -> uint64_t {
+    std::shared_ptr<M0> msg;
+    double timestamp_sec = 0.0;
+    auto dv = weak_dv.lock();
+    if (dv != nullptr && dv->Latest(msg) && message::GetHeaderTimestamp(*msg, &timestamp_sec) &&
+        timestamp_sec > 0.0) {
+      return static_cast<uint64_t>(timestamp_sec * 1e9) + budget_ns;
+    }
+    return Time::Now().ToNanosecond() + budget_ns;
+  };
+}
+
 template <typename Function>
 RoutineFactory CreateRoutineFactory(Function&& f) {
   RoutineFactory factory;
@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#ifndef CYBER_CROUTINE_ROUTINE_STATS_H_
+#define CYBER_CROUTINE_ROUTINE_STATS_H_
+
+#include <atomic>
+#include <cstdint>
+
+namespace apollo {
+namespace cyber {
+namespace croutine {
+
+/**
+ * @class LatencyHistogram
+ * @brief Log2 bucketed histogram of durations in microseconds.
+ *
+ * Meant to be written by one thread at a time (the processor running the
+ * croutine) and read concurrently by anybody: the writer uses plain relaxed
+ * load/store pairs, so recording costs no locked instruction.
+ */
+class LatencyHistogram {
+ public:
+  // bucket i counts durations in [2^(i-1), 2^i) us, the last one is open
+  static constexpr int kBucketNum = 24;
+
+  void Add(uint64_t us) {
+    int index = 0;
+    uint64_t bound = 1;
+    while (index < kBucketNum - 1 && us >= bound) {
+      bound <<= 1;
+      ++index;
+    }
+    Increase(&buckets_[index], 1);
+    Increase(&count_, 1);
+    Increase(&sum_us_, us);
+    if (us > max_us_.load(std::memory_order_relaxed)) {
+      max_us_.store(us, std::memory_order_relaxed);
+    }
+  }
+
+  uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+  uint64_t sum_us() const { return sum_us_.load(std::memory_order_relaxed); }
+  uint64_t max_us() const { return max_us_.load(std::memory_order_relaxed); }
+  uint64_t bucket(int index) const {
+    return buckets_[index].load(std::memory_order_relaxed);
+  }
+
+  // Upper bound of the bucket holding the given percentile (0 - 100).
+  uint64_t Percentile(double percentile) const {
+    uint64_t total = count();
+    if (total == 0) {
+      return 0;
+    }
+    uint64_t target = static_cast<uint64_t>(total * percentile / 100.0);
+    uint64_t seen = 0;
+    for (int i = 0; i < kBucketNum; ++i) {
+      seen += bucket(i);
+      if (seen > target) {
+        return i == kBucketNum - 1 ? max_us() : (1ULL << i);
+      }
+    }
+    return max_us();
+  }
+
+ private:
+  static void Increase(std::atomic<uint64_t>* counter, uint64_t delta) {
+    counter->store(counter->load(std::memory_order_relaxed) + delta,
+                   std::memory_order_relaxed);
+  }
+
+  std::atomic<uint64_t> buckets_[kBucketNum] = {};
+  std::atomic<uint64_t> count_ = {0};
+  std::atomic<uint64_t> sum_us_ = {0};
+  std::atomic<uint64_t> max_us_ = {0};
+};
+
+struct RoutineStats {
+  // from the moment a croutine became ready until a processor resumed it
+  LatencyHistogram wait_latency;
+  // time spent between resume and the next yield
+  LatencyHistogram run_time;
+  std::atomic<uint64_t> yields = {0};
+};
+
+}  // namespace croutine
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_CROUTINE_ROUTINE_STATS_H_
@@ -17,6 +17,8 @@
 #ifndef CYBER_DATA_CACHE_BUFFER_H_
 #define CYBER_DATA_CACHE_BUFFER_H_
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -80,6 +82,105 @@ class CacheBuffer {
   mutable std::mutex mutex_;
 };
 
+/**
+ * @brief Ring of shared pointers that readers access without any lock.
+ *
+ * Writers are serialized by a spin flag, which only matters when several
+ * transports dispatch the same channel at once. Every slot remembers the
+ * index it holds: readers load `index, value, index` and retry once the slot
+ * was recycled under them, so Fetch/Latest never wait for Fill. The value
+ * itself is read and published with the atomic shared_ptr free functions.
+ *
+ * operator[], at, Front and Back still hand out references for the old
+ * callers, those are not safe against a concurrent Fill; use Read instead.
+ */
+template <typename T>
+class CacheBuffer<std::shared_ptr<T>> {
+ public:
+  using value_type = std::shared_ptr<T>;
+  using size_type = std::size_t;
+
+  explicit CacheBuffer(uint32_t size) {
+    capacity_ = size + 1;
+    slots_.reset(new Slot[capacity_]);
+  }
+
+  CacheBuffer(const CacheBuffer& rhs) {
+    head_.store(rhs.head_.load());
+    tail_.store(rhs.tail_.load());
+    capacity_ = rhs.capacity_;
+    slots_.reset(new Slot[capacity_]);
+    for (uint64_t i = 0; i < capacity_; ++i) {
+      slots_[i].index.store(rhs.slots_[i].index.load());
+      slots_[i].value = std::atomic_load(&rhs.slots_[i].value);
+    }
+  }
+
+  value_type& operator[](const uint64_t& pos) {
+    return slots_[GetIndex(pos)].value;
+  }
+  const value_type& at(const uint64_t& pos) const {
+    return slots_[GetIndex(pos)].value;
+  }
+
+  uint64_t Head() const { return head_.load(std::memory_order_acquire) + 1; }
+  uint64_t Tail() const { return tail_.load(std::memory_order_acquire); }
+  uint64_t Size() const { return Tail() - (Head() - 1); }
+
+  const value_type& Front() const { return at(Head()); }
+  const value_type& Back() const { return at(Tail()); }
+
+  bool Empty() const { return Tail() == 0; }
+  bool Full() const { return capacity_ - 1 == Size(); }
+
+  /**
+   * @brief Copy out the message at `pos`; false if the slot does not hold
+   * it (not written yet or already recycled).
+   */
+  bool Read(uint64_t pos, value_type* value) const {
+    const Slot& slot = slots_[GetIndex(pos)];
+    if (slot.index.load() != pos) {
+      return false;
+    }
+    *value = std::atomic_load(&slot.value);
+    return slot.index.load() == pos;
+  }
+
+  void Fill(const value_type& value) {
+    while (write_flag_.test_and_set(std::memory_order_acquire)) {
+    }
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    Slot& slot = slots_[GetIndex(tail + 1)];
+    slot.index.store(0);
+    std::atomic_store(&slot.value, value);
+    slot.index.store(tail + 1);
+    if (capacity_ - 1 == tail - head) {
+      head_.store(head + 1, std::memory_order_release);
+    }
+    tail_.store(tail + 1, std::memory_order_release);
+    write_flag_.clear(std::memory_order_release);
+  }
+
+  std::mutex& Mutex() { return mutex_; }
+
+ private:
+  struct Slot {
+    std::atomic<uint64_t> index = {0};
+    value_type value;
+  };
+
+  CacheBuffer& operator=(const CacheBuffer& other) = delete;
+  uint64_t GetIndex(const uint64_t& pos) const { return pos % capacity_; }
+
+  std::atomic<uint64_t> head_ = {0};
+  std::atomic<uint64_t> tail_ = {0};
+  uint64_t capacity_ = 0;
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic_flag write_flag_ = ATOMIC_FLAG_INIT;
+  mutable std::mutex mutex_;
+};
+
 }  // namespace data
 }  // namespace cyber
 }  // namespace apollo
@@ -17,9 +17,12 @@
 #include "cyber/data/cache_buffer.h"
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <utility>
+#include <vector>
 
 
 namespace apollo {
@@ -53,6 +56,51 @@ TEST(CacheBufferTest, cache_buffer_test) {
   EXPECT_TRUE(buffer1.Full());
 }
 
+TEST(CacheBufferTest, shared_ptr_cache_buffer_test) {
+  CacheBuffer<std::shared_ptr<int>> buffer(4);
+  std::shared_ptr<int> value;
+  EXPECT_TRUE(buffer.Empty());
+  EXPECT_FALSE(buffer.Read(1, &value));
+  for (int i = 1; i <= 6; i++) {
+    buffer.Fill(std::make_shared<int>(i));
+  }
+  EXPECT_TRUE(buffer.Full());
+  EXPECT_EQ(4, buffer.Size());
+  EXPECT_EQ(3, buffer.Head());
+  EXPECT_EQ(6, buffer.Tail());
+  EXPECT_FALSE(buffer.Read(1, &value));
+  EXPECT_TRUE(buffer.Read(3, &value));
+  EXPECT_EQ(3, *value);
+  EXPECT_TRUE(buffer.Read(6, &value));
+  EXPECT_EQ(6, *value);
+  EXPECT_FALSE(buffer.Read(7, &value));
+}
+
+TEST(CacheBufferTest, concurrent_read_test) {
+  CacheBuffer<std::shared_ptr<uint64_t>> buffer(8);
+  const uint64_t kFillNum = 100000;
+  std::atomic<bool> mismatch(false);
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back([&]() {
+      std::shared_ptr<uint64_t> value;
+      while (buffer.Tail() < kFillNum) {
+        uint64_t tail = buffer.Tail();
+        if (tail > 0 && buffer.Read(tail, &value) && *value != tail) {
+          mismatch = true;
+        }
+      }
+    });
+  }
+  for (uint64_t i = 1; i <= kFillNum; ++i) {
+    buffer.Fill(std::make_shared<uint64_t>(i));
+  }
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_FALSE(mismatch.load());
+}
+
 }  // namespace data
 }  // namespace cyber
 }  // namespace apollo
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "cyber/common/global_data.h"
@@ -57,52 +58,67 @@ class ChannelBuffer {
 template <typename T>
 bool ChannelBuffer<T>::Fetch(uint64_t* index,
                              std::shared_ptr<T>& m) {  // NOLINT
-  std::lock_guard<std::mutex> lock(buffer_->Mutex());
-  if (buffer_->Empty()) {
-    return false;
+  while (true) {
+    if (buffer_->Empty()) {
+      return false;
+    }
+    auto tail = buffer_->Tail();
+    if (*index == 0 || *index > tail + 1) {
+      *index = tail;
+    } else if (*index == tail + 1) {
+      return false;
+    } else if (*index < buffer_->Head()) {
+      auto interval = tail - *index;
+      AWARN << "channel[" << GlobalData::GetChannelById(channel_id_) << "] "
+            << "read buffer overflow, drop_message[" << interval
+            << "] pre_index[" << *index << "] current_index[" << tail
+            << "] ";
+      *index = tail;
+    }
+    if (buffer_->Read(*index, &m)) {
+      return true;
+    }
+    // recycled by the writer while we were reading, look again
   }
-
-  if (*index == 0) {
-    *index = buffer_->Tail();
-  } else if (*index == buffer_->Tail() + 1) {
-    return false;
-  } else if (*index < buffer_->Head()) {
-    auto interval = buffer_->Tail() - *index;
-    AWARN << "channel[" << GlobalData::GetChannelById(channel_id_) << "] "
-          << "read buffer overflow, drop_message[" << interval << "] pre_index["
-          << *index << "] current_index[" << buffer_->Tail() << "] ";
-    *index = buffer_->Tail();
-  }
-  m = buffer_->at(*index);
-  return true;
 }
 
 template <typename T>
 bool ChannelBuffer<T>::Latest(std::shared_ptr<T>& m) {  // NOLINT
-  std::lock_guard<std::mutex> lock(buffer_->Mutex());
-  if (buffer_->Empty()) {
-    return false;
+  while (true) {
+    if (buffer_->Empty()) {
+      return false;
+    }
+    if (buffer_->Read(buffer_->Tail(), &m)) {
+      return true;
+    }
   }
-
-  m = buffer_->Back();
-  return true;
 }
 
 template <typename T>
 bool ChannelBuffer<T>::FetchMulti(uint64_t fetch_size,
                                   std::vector<std::shared_ptr<T>>* vec) {
-  std::lock_guard<std::mutex> lock(buffer_->Mutex());
-  if (buffer_->Empty()) {
-    return false;
-  }
-
-  auto num = std::min(buffer_->Size(), fetch_size);
-  vec->reserve(num);
-  for (auto index = buffer_->Tail() - num + 1; index <= buffer_->Tail();
-       ++index) {
-    vec->emplace_back(buffer_->at(index));
+  const auto origin_size = vec->size();
+  while (true) {
+    if (buffer_->Empty()) {
+      return false;
+    }
+    auto tail = buffer_->Tail();
+    auto num = std::min(tail - buffer_->Head() + 1, fetch_size);
+    vec->resize(origin_size);
+    vec->reserve(origin_size + num);
+    bool recycled = false;
+    for (auto index = tail - num + 1; index <= tail; ++index) {
+      std::shared_ptr<T> m;
+      if (!buffer_->Read(index, &m)) {
+        recycled = true;
+        break;
+      }
+      vec->emplace_back(std::move(m));
+    }
+    if (!recycled) {
+      return true;
+    }
   }
-  return true;
 }
 
 }  // namespace data
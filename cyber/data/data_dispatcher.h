@@ -21,6 +21,7 @@
 #include <mutex>
 #include <vector>
 
+#include "cyber/base/resizable_atomic_hash_map.h"
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
 #include "cyber/data/channel_buffer.h"
@@ -32,7 +33,7 @@ namespace cyber {
 namespace data {
 
 using apollo::cyber::Time;
-using apollo::cyber::base::AtomicHashMap;
+using apollo::cyber::base::ResizableAtomicHashMap;
 
 template <typename T>
 class DataDispatcher {
@@ -48,7 +49,7 @@ class DataDispatcher {
  private:
   DataNotifier* notifier_ = DataNotifier::Instance();
   std::mutex buffers_map_mutex_;
-  AtomicHashMap<uint64_t, BufferVector> buffers_map_;
+  ResizableAtomicHashMap<uint64_t, BufferVector> buffers_map_;
 
   DECLARE_SINGLETON(DataDispatcher)
 };
@@ -79,7 +80,7 @@ bool DataDispatcher<T>::Dispatch(const uint64_t channel_id,
   if (buffers_map_.Get(channel_id, &buffers)) {
     for (auto& buffer_wptr : *buffers) {
       if (auto buffer = buffer_wptr.lock()) {
-        std::lock_guard<std::mutex> lock(buffer->Mutex());
+        // readers never block on the buffer, see CacheBuffer<shared_ptr>
         buffer->Fill(msg);
       }
     }
@@ -21,6 +21,7 @@
 #include <mutex>
 #include <vector>
 
+#include "cyber/base/resizable_atomic_hash_map.h"
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
 #include "cyber/data/cache_buffer.h"
@@ -32,7 +33,7 @@ namespace cyber {
 namespace data {
 
 using apollo::cyber::Time;
-using apollo::cyber::base::AtomicHashMap;
+using apollo::cyber::base::ResizableAtomicHashMap;
 using apollo::cyber::event::PerfEventCache;
 
 struct Notifier {
@@ -51,7 +52,7 @@ class DataNotifier {
 
  private:
   std::mutex notifies_map_mutex_;
-  AtomicHashMap<uint64_t, NotifyVector> notifies_map_;
+  ResizableAtomicHashMap<uint64_t, NotifyVector> notifies_map_;
 
   DECLARE_SINGLETON(DataNotifier)
 };
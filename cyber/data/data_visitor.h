@@ -81,6 +81,11 @@ class DataVisitor : public DataVisitorBase {
     return false;
   }
 
+  // newest message of the triggering channel, without consuming it
+  bool Latest(std::shared_ptr<M0>& m0) {  // NOLINT
+    return buffer_m0_.Latest(m0);
+  }
+
  private:
   fusion::DataFusion<M0, M1, M2, M3>* data_fusion_ = nullptr;
   ChannelBuffer<M0> buffer_m0_;
@@ -123,6 +128,11 @@ class DataVisitor<M0, M1, M2, NullType> : public DataVisitorBase {
     return false;
   }
 
+  // newest message of the triggering channel, without consuming it
+  bool Latest(std::shared_ptr<M0>& m0) {  // NOLINT
+    return buffer_m0_.Latest(m0);
+  }
+
  private:
   fusion::DataFusion<M0, M1, M2>* data_fusion_ = nullptr;
   ChannelBuffer<M0> buffer_m0_;
@@ -159,6 +169,11 @@ class DataVisitor<M0, M1, NullType, NullType> : public DataVisitorBase {
     return false;
   }
 
+  // newest message of the triggering channel, without consuming it
+  bool Latest(std::shared_ptr<M0>& m0) {  // NOLINT
+    return buffer_m0_.Latest(m0);
+  }
+
  private:
   fusion::DataFusion<M0, M1>* data_fusion_ = nullptr;
   ChannelBuffer<M0> buffer_m0_;
@@ -188,6 +203,11 @@ class DataVisitor<M0, NullType, NullType, NullType> : public DataVisitorBase {
     return false;
   }
 
+  // newest message of the triggering channel, without consuming it
+  bool Latest(std::shared_ptr<M0>& m0) {  // NOLINT
+    return buffer_.Latest(m0);
+  }
+
  private:
   ChannelBuffer<M0> buffer_;
 };
@@ -0,0 +1,200 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/event/channel_tracer.h"
+
+#include <string>
+
+#include "cyber/common/environment.h"
+#include "cyber/common/global_data.h"
+#include "cyber/time/time.h"
+
+namespace apollo {
+namespace cyber {
+namespace event {
+
+using common::GetEnv;
+
+namespace {
+
+// dispatched messages remembered per channel until their callback runs
+constexpr int kPendingNum = 64;
+
+void FillHistogram(const LatencyHistogram& histogram,
+                   proto::HistogramStats* stats) {
+  stats->set_count(histogram.count());
+  stats->set_sum_us(histogram.sum_us());
+  stats->set_max_us(histogram.max_us());
+  stats->set_p50_us(histogram.Percentile(50));
+  stats->set_p99_us(histogram.Percentile(99));
+}
+
+uint64_t ElapsedUs(uint64_t from_ns, uint64_t to_ns) {
+  return to_ns > from_ns ? (to_ns - from_ns) / 1000 : 0;
+}
+
+}  // namespace
+
+struct ChannelTracer::ChannelStats {
+  struct Pending {
+    const void* msg = nullptr;
+    uint64_t dispatch_time = 0;
+    TraceContext trace;
+  };
+
+  std::string channel_name;
+  std::atomic<uint64_t> messages = {0};
+  LatencyHistogram transport_latency;
+  LatencyHistogram queue_latency;
+  LatencyHistogram callback_time;
+  LatencyHistogram pipeline_latency;
+
+  // several receivers and readers of one channel may record concurrently
+  std::mutex mutex;
+  Pending pending[kPendingNum];
+  int next_pending = 0;
+};
+
+ChannelTracer::ChannelTracer() {
+  auto channel_trace = GetEnv("cyber_channel_trace");
+  if (channel_trace != "" && std::stoi(channel_trace)) {
+    enabled_ = true;
+  }
+}
+
+ChannelTracer::TraceContext* ChannelTracer::CurrentTrace() {
+  static thread_local TraceContext trace;
+  return &trace;
+}
+
+void ChannelTracer::RegisterChannel(uint64_t channel_id,
+                                    const std::string& channel_name) {
+  if (!enabled_) {
+    return;
+  }
+  GetChannel(channel_id)->channel_name = channel_name;
+}
+
+ChannelTracer::ChannelStats* ChannelTracer::GetChannel(uint64_t channel_id) {
+  std::lock_guard<std::mutex> lock(channels_mutex_);
+  auto& stats = channels_[channel_id];
+  if (stats == nullptr) {
+    stats.reset(new ChannelStats());
+  }
+  return stats.get();
+}
+
+void ChannelTracer::OnTransmit(MessageInfo* msg_info) {
+  if (!enabled_) {
+    return;
+  }
+  uint64_t now = Time::Now().ToNanosecond();
+  msg_info->set_send_time(now);
+  auto current = CurrentTrace();
+  if (current->trace_id != 0) {
+    msg_info->set_trace_id(current->trace_id);
+    msg_info->set_trace_start_time(current->start_time);
+  } else {
+    // a message written outside of any callback starts a new chain
+    msg_info->set_trace_id(msg_info->sender_id().HashValue() ^
+                           msg_info->seq_num());
+    msg_info->set_trace_start_time(now);
+  }
+}
+
+void ChannelTracer::OnDispatch(uint64_t channel_id, const void* msg,
+                               const MessageInfo& msg_info) {
+  if (!enabled_ || msg_info.trace_id() == 0) {
+    return;
+  }
+  uint64_t now = Time::Now().ToNanosecond();
+  auto stats = GetChannel(channel_id);
+  std::lock_guard<std::mutex> lock(stats->mutex);
+  stats->messages.fetch_add(1, std::memory_order_relaxed);
+  stats->transport_latency.Add(ElapsedUs(msg_info.send_time(), now));
+  auto& pending = stats->pending[stats->next_pending];
+  stats->next_pending = (stats->next_pending + 1) % kPendingNum;
+  pending.msg = msg;
+  pending.dispatch_time = now;
+  pending.trace.trace_id = msg_info.trace_id();
+  pending.trace.start_time = msg_info.trace_start_time();
+}
+
+ChannelTracer::CallbackScope::CallbackScope(uint64_t channel_id,
+                                            const void* msg)
+    : stats_(nullptr), start_time_(0) {
+  auto tracer = ChannelTracer::Instance();
+  if (!tracer->enabled()) {
+    return;
+  }
+  start_time_ = Time::Now().ToNanosecond();
+  auto stats = tracer->GetChannel(channel_id);
+  {
+    std::lock_guard<std::mutex> lock(stats->mutex);
+    for (auto& pending : stats->pending) {
+      if (pending.msg == msg && pending.trace.trace_id != 0) {
+        stats->queue_latency.Add(
+            ElapsedUs(pending.dispatch_time, start_time_));
+        trace_ = pending.trace;
+        stats_ = stats;
+        break;
+      }
+    }
+  }
+  if (stats_ == nullptr) {
+    return;
+  }
+  auto current = CurrentTrace();
+  saved_ = *current;
+  *current = trace_;
+}
+
+ChannelTracer::CallbackScope::~CallbackScope() {
+  if (stats_ == nullptr) {
+    return;
+  }
+  *CurrentTrace() = saved_;
+  uint64_t now = Time::Now().ToNanosecond();
+  std::lock_guard<std::mutex> lock(stats_->mutex);
+  stats_->callback_time.Add(ElapsedUs(start_time_, now));
+  stats_->pipeline_latency.Add(ElapsedUs(trace_.start_time, now));
+}
+
+void ChannelTracer::GetStats(proto::ChannelTraceStats* stats) {
+  stats->set_process_group(common::GlobalData::Instance()->ProcessGroup());
+  std::lock_guard<std::mutex> lock(channels_mutex_);
+  for (auto& item : channels_) {
+    auto& channel = *item.second;
+    std::lock_guard<std::mutex> channel_lock(channel.mutex);
+    if (channel.messages.load() == 0) {
+      continue;
+    }
+    auto latency = stats->add_channels();
+    latency->set_channel_name(channel.channel_name);
+    latency->set_messages(channel.messages.load());
+    FillHistogram(channel.transport_latency,
+                  latency->mutable_transport_latency());
+    FillHistogram(channel.queue_latency, latency->mutable_queue_latency());
+    FillHistogram(channel.callback_time, latency->mutable_callback_time());
+    FillHistogram(channel.pipeline_latency,
+                  latency->mutable_pipeline_latency());
+  }
+}
+
+}  // namespace event
+}  // namespace cyber
+}  // namespace apollo
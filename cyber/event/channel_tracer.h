@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#ifndef CYBER_EVENT_CHANNEL_TRACER_H_
+#define CYBER_EVENT_CHANNEL_TRACER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "cyber/common/macros.h"
+#include "cyber/croutine/routine_stats.h"
+#include "cyber/proto/channel_trace.pb.h"
+#include "cyber/transport/message/message_info.h"
+
+namespace apollo {
+namespace cyber {
+namespace event {
+
+using croutine::LatencyHistogram;
+using transport::MessageInfo;
+
+/**
+ * @class ChannelTracer
+ * @brief Per-channel latency histograms of the writer to reader path.
+ *
+ * Enabled with the cyber_channel_trace environment variable. Writers stamp
+ * the send time and a causality id into MessageInfo; a reader callback makes
+ * its message's trace current on the thread, so whatever the callback writes
+ * continues the same trace and downstream readers see the latency of the
+ * whole pipeline.
+ */
+class ChannelTracer {
+  struct ChannelStats;
+
+ public:
+  struct TraceContext {
+    uint64_t trace_id = 0;
+    uint64_t start_time = 0;
+  };
+
+  /**
+   * @brief Makes the trace of one dispatched message current for the
+   * lifetime of a reader callback and records its queue and run time.
+   */
+  class CallbackScope {
+   public:
+    CallbackScope(uint64_t channel_id, const void* msg);
+    ~CallbackScope();
+
+   private:
+    ChannelStats* stats_;
+    TraceContext saved_;
+    TraceContext trace_;
+    uint64_t start_time_;
+    DISALLOW_COPY_AND_ASSIGN(CallbackScope);
+  };
+
+  bool enabled() const { return enabled_; }
+
+  void RegisterChannel(uint64_t channel_id, const std::string& channel_name);
+
+  // Stamps the send time, continuing the thread's current trace if any.
+  void OnTransmit(MessageInfo* msg_info);
+  void OnDispatch(uint64_t channel_id, const void* msg,
+                  const MessageInfo& msg_info);
+
+  void GetStats(proto::ChannelTraceStats* stats);
+
+ private:
+  ChannelStats* GetChannel(uint64_t channel_id);
+
+  static TraceContext* CurrentTrace();
+
+  bool enabled_ = false;
+
+  std::mutex channels_mutex_;
+  std::unordered_map<uint64_t, std::unique_ptr<ChannelStats>> channels_;
+
+  DECLARE_SINGLETON(ChannelTracer)
+};
+
+}  // namespace event
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_EVENT_CHANNEL_TRACER_H_
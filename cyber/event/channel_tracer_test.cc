@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/event/channel_tracer.h"
+
+#include <stdlib.h>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace event {
+
+using transport::Identity;
+
+class ChannelTracerTest : public ::testing::Test {
+ protected:
+  static void SetUpTestCase() { setenv("cyber_channel_trace", "1", 1); }
+};
+
+TEST_F(ChannelTracerTest, pipeline) {
+  auto tracer = ChannelTracer::Instance();
+  ASSERT_TRUE(tracer->enabled());
+  tracer->RegisterChannel(1, "/trace/first");
+  tracer->RegisterChannel(2, "/trace/second");
+
+  // a message written outside of any callback opens a trace
+  Identity sender;
+  MessageInfo first(sender, 1);
+  tracer->OnTransmit(&first);
+  EXPECT_NE(0, first.trace_id());
+  EXPECT_EQ(first.send_time(), first.trace_start_time());
+
+  int first_msg = 0;
+  int second_msg = 0;
+  MessageInfo second(sender, 2);
+  tracer->OnDispatch(1, &first_msg, first);
+  {
+    ChannelTracer::CallbackScope scope(1, &first_msg);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    // written from the callback, so it continues the same trace
+    tracer->OnTransmit(&second);
+  }
+  EXPECT_EQ(first.trace_id(), second.trace_id());
+  EXPECT_EQ(first.trace_start_time(), second.trace_start_time());
+  EXPECT_GT(second.send_time(), first.send_time());
+
+  tracer->OnDispatch(2, &second_msg, second);
+  { ChannelTracer::CallbackScope scope(2, &second_msg); }
+
+  // outside of callbacks a new trace is started again
+  MessageInfo third(sender, 3);
+  tracer->OnTransmit(&third);
+  EXPECT_NE(first.trace_id(), third.trace_id());
+
+  proto::ChannelTraceStats stats;
+  tracer->GetStats(&stats);
+  ASSERT_EQ(2, stats.channels_size());
+  for (auto& channel : stats.channels()) {
+    EXPECT_EQ(1, channel.messages());
+    EXPECT_EQ(1, channel.callback_time().count());
+    if (channel.channel_name() == "/trace/first") {
+      EXPECT_GE(channel.callback_time().max_us(), 2000);
+    } else {
+      EXPECT_EQ("/trace/second", channel.channel_name());
+      EXPECT_GE(channel.pipeline_latency().max_us(), 2000);
+    }
+  }
+}
+
+TEST_F(ChannelTracerTest, untraced_message) {
+  auto tracer = ChannelTracer::Instance();
+  int msg = 0;
+  MessageInfo info;
+  tracer->OnDispatch(3, &msg, info);
+  ChannelTracer::CallbackScope scope(3, &msg);
+  proto::ChannelTraceStats stats;
+  tracer->GetStats(&stats);
+  for (auto& channel : stats.channels()) {
+    EXPECT_NE(0, channel.messages());
+  }
+}
+
+}  // namespace event
+}  // namespace cyber
+}  // namespace apollo
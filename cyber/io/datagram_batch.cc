@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/io/datagram_batch.h"
+
+#include <cstring>
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+DatagramBatch::DatagramBatch(size_t capacity, size_t buffer_size)
+    : buffer_size_(buffer_size),
+      buffers_(capacity * buffer_size),
+      iovecs_(capacity),
+      addrs_(capacity),
+      headers_(capacity) {
+  for (size_t i = 0; i < capacity; ++i) {
+    iovecs_[i].iov_base = &buffers_[i * buffer_size_];
+    iovecs_[i].iov_len = buffer_size_;
+    std::memset(&headers_[i], 0, sizeof(headers_[i]));
+    headers_[i].msg_hdr.msg_iov = &iovecs_[i];
+    headers_[i].msg_hdr.msg_iovlen = 1;
+    headers_[i].msg_hdr.msg_name = &addrs_[i];
+  }
+}
+
+bool DatagramBatch::Add(const void* buf, size_t len,
+                        const struct sockaddr* dest_addr, socklen_t addrlen) {
+  if (full() || len > buffer_size_ || addrlen > sizeof(addrs_[size_])) {
+    return false;
+  }
+  std::memcpy(&buffers_[size_ * buffer_size_], buf, len);
+  iovecs_[size_].iov_len = len;
+  auto& header = headers_[size_].msg_hdr;
+  if (dest_addr != nullptr) {
+    std::memcpy(&addrs_[size_], dest_addr, addrlen);
+    header.msg_name = &addrs_[size_];
+    header.msg_namelen = addrlen;
+  } else {
+    header.msg_name = nullptr;
+    header.msg_namelen = 0;
+  }
+  headers_[size_].msg_len = static_cast<unsigned int>(len);
+  ++size_;
+  return true;
+}
+
+struct mmsghdr* DatagramBatch::PrepareReceive(unsigned int* vlen) {
+  for (size_t i = size_; i < capacity(); ++i) {
+    iovecs_[i].iov_len = buffer_size_;
+    auto& header = headers_[i].msg_hdr;
+    header.msg_name = &addrs_[i];
+    header.msg_namelen = sizeof(addrs_[i]);
+    header.msg_flags = 0;
+    headers_[i].msg_len = 0;
+  }
+  *vlen = static_cast<unsigned int>(capacity() - size_);
+  return headers_.data() + size_;
+}
+
+struct mmsghdr* DatagramBatch::PrepareSend(size_t first, unsigned int* vlen) {
+  *vlen = first < size_ ? static_cast<unsigned int>(size_ - first) : 0;
+  return headers_.data() + first;
+}
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
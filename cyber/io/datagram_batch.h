@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_IO_DATAGRAM_BATCH_H_
+#define CYBER_IO_DATAGRAM_BATCH_H_
+
+#include <sys/socket.h>
+#include <sys/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+/**
+ * @class DatagramBatch
+ *
+ * @brief Datagrams moved by one recvmmsg or sendmmsg call. The buffers, the
+ * iovecs and the addresses of every slot are allocated once and reused by
+ * each batch, so receiving or sending allocates nothing.
+ */
+class DatagramBatch {
+ public:
+  /**
+   * @param capacity the number of datagrams of a batch
+   * @param buffer_size the size of the buffer of each datagram
+   */
+  DatagramBatch(size_t capacity, size_t buffer_size);
+
+  DatagramBatch(const DatagramBatch&) = delete;
+  DatagramBatch& operator=(const DatagramBatch&) = delete;
+
+  size_t capacity() const { return headers_.size(); }
+  size_t buffer_size() const { return buffer_size_; }
+
+  // the number of datagrams received or added
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  bool full() const { return size_ == capacity(); }
+
+  const uint8_t* data(size_t i) const {
+    return &buffers_[i * buffer_size_];
+  }
+  size_t length(size_t i) const { return headers_[i].msg_len; }
+  const struct sockaddr* addr(size_t i) const {
+    return reinterpret_cast<const struct sockaddr*>(&addrs_[i]);
+  }
+  socklen_t addrlen(size_t i) const {
+    return headers_[i].msg_hdr.msg_namelen;
+  }
+  // set when the datagram was larger than the buffer
+  bool truncated(size_t i) const {
+    return (headers_[i].msg_hdr.msg_flags & MSG_TRUNC) != 0;
+  }
+
+  /**
+   * @brief queues a datagram to send, copied into the next buffer.
+   * @return false if the batch is full or the datagram is too large
+   */
+  bool Add(const void* buf, size_t len, const struct sockaddr* dest_addr,
+           socklen_t addrlen);
+
+  void Clear() { size_ = 0; }
+
+  /**
+   * @brief the headers of the free slots, for a receive.
+   */
+  struct mmsghdr* PrepareReceive(unsigned int* vlen);
+
+  /**
+   * @brief the headers of the datagrams not sent yet, from the first one.
+   */
+  struct mmsghdr* PrepareSend(size_t first, unsigned int* vlen);
+
+  void CommitReceive(size_t count) { size_ += count; }
+
+ private:
+  size_t buffer_size_;
+  size_t size_ = 0;
+  std::vector<uint8_t> buffers_;
+  std::vector<struct iovec> iovecs_;
+  std::vector<struct sockaddr_storage> addrs_;
+  std::vector<struct mmsghdr> headers_;
+};
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_IO_DATAGRAM_BATCH_H_
@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/io/datagram_batch.h"
+
+#include <arpa/inet.h>
+#include <gtest/gtest.h>
+#include <netinet/in.h>
+#include <unistd.h>
+#include <string>
+
+namespace apollo {
+namespace cyber {
+namespace io {
+
+TEST(DatagramBatchTest, add) {
+  DatagramBatch batch(2, 8);
+  EXPECT_EQ(batch.capacity(), 2);
+  EXPECT_TRUE(batch.empty());
+
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  EXPECT_FALSE(batch.Add("too large", 9, nullptr, 0));
+  EXPECT_TRUE(batch.Add("first", 5, (struct sockaddr*)&addr, sizeof(addr)));
+  EXPECT_TRUE(batch.Add("second", 6, nullptr, 0));
+  EXPECT_FALSE(batch.Add("third", 5, nullptr, 0));
+  EXPECT_TRUE(batch.full());
+  EXPECT_EQ(batch.length(0), 5);
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(batch.data(1)),
+                        batch.length(1)),
+            "second");
+
+  unsigned int vlen = 0;
+  batch.PrepareSend(1, &vlen);
+  EXPECT_EQ(vlen, 1);
+  batch.Clear();
+  batch.PrepareReceive(&vlen);
+  EXPECT_EQ(vlen, 2);
+}
+
+TEST(DatagramBatchTest, send_and_receive) {
+  int receiver = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+  int sender = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+  ASSERT_GE(receiver, 0);
+  ASSERT_GE(sender, 0);
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t addrlen = sizeof(addr);
+  ASSERT_EQ(bind(receiver, (struct sockaddr*)&addr, addrlen), 0);
+  ASSERT_EQ(getsockname(receiver, (struct sockaddr*)&addr, &addrlen), 0);
+
+  DatagramBatch out(4, 16);
+  for (int i = 0; i < 3; ++i) {
+    const std::string msg = "datagram " + std::to_string(i);
+    EXPECT_TRUE(
+        out.Add(msg.data(), msg.size(), (struct sockaddr*)&addr, addrlen));
+  }
+  unsigned int vlen = 0;
+  struct mmsghdr* msgvec = out.PrepareSend(0, &vlen);
+  EXPECT_EQ(sendmmsg(sender, msgvec, vlen, 0), 3);
+
+  // the received datagrams are appended to the batch
+  DatagramBatch in(4, 8);
+  EXPECT_TRUE(in.Add("local", 5, nullptr, 0));
+  msgvec = in.PrepareReceive(&vlen);
+  EXPECT_EQ(vlen, 3);
+  int nmsgs = recvmmsg(receiver, msgvec, vlen, 0, nullptr);
+  ASSERT_EQ(nmsgs, 3);
+  in.CommitReceive(nmsgs);
+  EXPECT_TRUE(in.full());
+  for (size_t i = 1; i < in.size(); ++i) {
+    EXPECT_EQ(in.length(i), 8);
+    EXPECT_TRUE(in.truncated(i));
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(in.data(i)), 8),
+              "datagram");
+    EXPECT_EQ(in.addr(i)->sa_family, AF_INET);
+  }
+
+  in.Clear();
+  msgvec = in.PrepareReceive(&vlen);
+  EXPECT_EQ(recvmmsg(receiver, msgvec, vlen, 0, nullptr), -1);
+  EXPECT_EQ(errno, EAGAIN);
+
+  close(sender);
+  close(receiver);
+}
+
+}  // namespace io
+}  // namespace cyber
+}  // namespace apollo
@@ -19,8 +19,6 @@
 #include <stdlib.h>
 #include <sys/socket.h>
 #include <iostream>
-#include <string>
-#include <vector>
 
 #include "cyber/cyber.h"
 #include "cyber/init.h"
@@ -30,24 +28,26 @@
 #include "cyber/time/time.h"
 
 using apollo::cyber::Time;
+using apollo::cyber::io::DatagramBatch;
 using apollo::cyber::io::Session;
 
+// echoes the datagrams received in a batch with one sendmmsg
 void Echo(const std::shared_ptr<Session>& session) {
-  struct sockaddr_in client_addr;
-  std::vector<char> recv_buffer(2049);
-  int nbytes = 0;
-  socklen_t sock_len = static_cast<socklen_t>(sizeof(client_addr));
+  const size_t kBatchSize = 32;
+  DatagramBatch requests(kBatchSize, 2049);
+  DatagramBatch replies(kBatchSize, 2049);
 
   while (true) {
-    nbytes = static_cast<int>(
-        session->RecvFrom(recv_buffer.data(), recv_buffer.size(), 0,
-                          (struct sockaddr*)&client_addr, &sock_len));
-    if (nbytes < 0) {
+    requests.Clear();
+    if (session->RecvBatch(&requests) < 0) {
       std::cout << "recv from client failed." << std::endl;
       continue;
     }
-    session->SendTo(recv_buffer.data(), nbytes, 0,
-                    (const struct sockaddr*)&client_addr, sock_len);
+    for (size_t i = 0; i < requests.size(); ++i) {
+      replies.Add(requests.data(i), requests.length(i), requests.addr(i),
+                  requests.addrlen(i));
+    }
+    session->SendBatch(&replies);
   }
 }
 
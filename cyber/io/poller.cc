@@ -110,6 +110,8 @@ bool Poller::Unregister(const PollRequest& req) {
 }
 
 bool Poller::Init() {
+  events_.resize(kPollSize);
+  responses_.reserve(kPollSize);
   epoll_fd_ = epoll_create(kPollSize);
   if (epoll_fd_ < 0) {
     AERROR << "epoll create failed, " << strerror(errno);
@@ -183,9 +185,11 @@ void Poller::Clear() {
 }
 
 void Poller::Poll(int timeout_ms) {
-  epoll_event evt[kPollSize];
   auto before_time_ns = Time::Now().ToNanosecond();
-  int ready_num = epoll_wait(epoll_fd_, evt, kPollSize, timeout_ms);
+  int ready_num = epoll_wait(epoll_fd_, events_.data(), kPollSize, timeout_ms);
+  if (ready_num < 0 && errno != EINTR) {
+    AERROR << "epoll wait failed, " << strerror(errno);
+  }
   auto after_time_ns = Time::Now().ToNanosecond();
   int interval_ms =
       static_cast<int>((after_time_ns - before_time_ns) / 1000000);
@@ -193,9 +197,19 @@ void Poller::Poll(int timeout_ms) {
     interval_ms = 1;
   }
 
-  std::unordered_map<int, PollResponse> responses;
+  responses_.clear();
   {
     ReadLockGuard<AtomicRWLock> lck(poll_data_lock_);
+    // the ready requests first, so that none also times out in this poll
+    for (int i = 0; i < ready_num; ++i) {
+      int fd = events_[i].data.fd;
+      auto search = requests_.find(fd);
+      if (search != requests_.end()) {
+        search->second->timeout_ms = -1;
+      }
+      responses_.emplace_back(fd, PollResponse(events_[i].events));
+    }
+
     for (auto& item : requests_) {
       auto& request = item.second;
       if (ctrl_params_.count(request->fd) != 0) {
@@ -210,35 +224,20 @@ void Poller::Poll(int timeout_ms) {
       }
 
       if (request->timeout_ms == 0) {
-        responses[item.first] = PollResponse();
+        responses_.emplace_back(item.first, PollResponse());
         request->timeout_ms = -1;
       }
     }
   }
 
-  if (ready_num > 0) {
-    for (int i = 0; i < ready_num; ++i) {
-      int fd = evt[i].data.fd;
-      uint32_t events = evt[i].events;
-      responses[fd] = PollResponse(events);
-    }
-  }
-
-  for (auto& item : responses) {
-    int fd = item.first;
-    auto& response = item.second;
-
+  if (!responses_.empty()) {
     ReadLockGuard<AtomicRWLock> lck(poll_data_lock_);
-    auto search = requests_.find(fd);
-    if (search != requests_.end()) {
-      search->second->timeout_ms = -1;
-      search->second->callback(response);
-    }
-  }
-
-  if (ready_num < 0) {
-    if (errno != EINTR) {
-      AERROR << "epoll wait failed, " << strerror(errno);
+    for (auto& item : responses_) {
+      auto search = requests_.find(item.first);
+      if (search != requests_.end()) {
+        search->second->timeout_ms = -1;
+        search->second->callback(item.second);
+      }
     }
   }
 }
@@ -23,6 +23,7 @@
 #include <mutex>
 #include <thread>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "cyber/base/atomic_rw_lock.h"
@@ -66,7 +67,12 @@ class Poller {
   CtrlParamMap ctrl_params_;
   base::AtomicRWLock poll_data_lock_;
 
-  const int kPollSize = 32;
+  // reused by every poll, only touched by the poll thread
+  std::vector<epoll_event> events_;
+  std::vector<std::pair<int, PollResponse>> responses_;
+
+  // the events handled per wakeup
+  const int kPollSize = 256;
   const int kPollTimeoutMs = 100;
 
   DECLARE_SINGLETON(Poller)
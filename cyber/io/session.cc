@@ -179,6 +179,84 @@ ssize_t Session::SendTo(const void *buf, size_t len, int flags,
   return nbytes;
 }
 
+int Session::RecvMmsg(struct mmsghdr *msgvec, unsigned int vlen, int flags,
+                      int timeout_ms) {
+  ACHECK(msgvec != nullptr);
+  ACHECK(fd_ != -1);
+
+  int nmsgs = recvmmsg(fd_, msgvec, vlen, flags, nullptr);
+  if (timeout_ms == 0) {
+    return nmsgs;
+  }
+
+  while (nmsgs == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+    if (poll_handler_->Block(timeout_ms, true)) {
+      nmsgs = recvmmsg(fd_, msgvec, vlen, flags, nullptr);
+    }
+    if (timeout_ms > 0) {
+      break;
+    }
+  }
+  return nmsgs;
+}
+
+int Session::SendMmsg(struct mmsghdr *msgvec, unsigned int vlen, int flags,
+                      int timeout_ms) {
+  ACHECK(msgvec != nullptr);
+  ACHECK(fd_ != -1);
+
+  int nmsgs = sendmmsg(fd_, msgvec, vlen, flags);
+  if (timeout_ms == 0) {
+    return nmsgs;
+  }
+
+  while ((nmsgs == -1) && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+    if (poll_handler_->Block(timeout_ms, false)) {
+      nmsgs = sendmmsg(fd_, msgvec, vlen, flags);
+    }
+    if (timeout_ms > 0) {
+      break;
+    }
+  }
+  return nmsgs;
+}
+
+int Session::RecvBatch(DatagramBatch *batch, int timeout_ms) {
+  ACHECK(batch != nullptr);
+
+  unsigned int vlen = 0;
+  struct mmsghdr *msgvec = batch->PrepareReceive(&vlen);
+  if (vlen == 0) {
+    return 0;
+  }
+  int nmsgs = RecvMmsg(msgvec, vlen, 0, timeout_ms);
+  if (nmsgs > 0) {
+    batch->CommitReceive(nmsgs);
+  }
+  return nmsgs;
+}
+
+int Session::SendBatch(DatagramBatch *batch, int timeout_ms) {
+  ACHECK(batch != nullptr);
+
+  size_t sent = 0;
+  while (sent < batch->size()) {
+    unsigned int vlen = 0;
+    struct mmsghdr *msgvec = batch->PrepareSend(sent, &vlen);
+    int nmsgs = SendMmsg(msgvec, vlen, 0, timeout_ms);
+    if (nmsgs <= 0) {
+      if (sent == 0) {
+        batch->Clear();
+        return nmsgs;
+      }
+      break;
+    }
+    sent += nmsgs;
+  }
+  batch->Clear();
+  return static_cast<int>(sent);
+}
+
 ssize_t Session::Read(void *buf, size_t count, int timeout_ms) {
   ACHECK(buf != nullptr);
   ACHECK(fd_ != -1);
@@ -23,6 +23,7 @@
 #include <unistd.h>
 #include <memory>
 
+#include "cyber/io/datagram_batch.h"
 #include "cyber/io/poll_handler.h"
 
 namespace apollo {
@@ -57,6 +58,19 @@ class Session {
                  const struct sockaddr *dest_addr, socklen_t addrlen,
                  int timeout_ms = -1);
 
+  // recvmmsg and sendmmsg, return the number of messages or -1
+  int RecvMmsg(struct mmsghdr *msgvec, unsigned int vlen, int flags,
+               int timeout_ms = -1);
+  int SendMmsg(struct mmsghdr *msgvec, unsigned int vlen, int flags,
+               int timeout_ms = -1);
+
+  // receives all the datagrams queued on the socket, up to the free slots
+  // of batch, once there is one. Returns the number received or -1.
+  int RecvBatch(DatagramBatch *batch, int timeout_ms = -1);
+  // sends every datagram of batch and clears it, returns the number sent,
+  // fewer when the timeout expired, or -1.
+  int SendBatch(DatagramBatch *batch, int timeout_ms = -1);
+
   ssize_t Read(void *buf, size_t count, int timeout_ms = -1);
   ssize_t Write(const void *buf, size_t count, int timeout_ms = -1);
 
@@ -17,6 +17,8 @@
 #include "cyber/logger/async_logger.h"
 
 #include <stdlib.h>
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -31,13 +33,68 @@ namespace logger {
 
 static std::unordered_map<std::string, LogFileObject*> moduleLoggerMap;
 
+namespace {
+
+std::atomic<uint64_t> logger_id_counter = {0};
+
+constexpr uint64_t kMinRingBytes = 64 * 1024;
+
+int32_t LevelOf(char c) {
+  switch (c) {
+    case 'F':
+      return 3;
+    case 'E':
+      return 2;
+    case 'W':
+      return 1;
+    case 'I':
+      return 0;
+    default:
+      return -1;
+  }
+}
+
+}  // namespace
+
+bool AsyncLogger::Ring::Push(bool force_flush, time_t timestamp,
+                             const char* message, int message_len) {
+  const uint64_t need = sizeof(MsgHeader) + message_len;
+  const uint64_t pos = tail.load(std::memory_order_relaxed);
+  if (need > capacity - (pos - head.load(std::memory_order_acquire))) {
+    return false;
+  }
+  MsgHeader header;
+  header.ts = timestamp;
+  header.len = message_len;
+  header.force_flush = force_flush;
+  CopyIn(pos, reinterpret_cast<const char*>(&header), sizeof(header));
+  CopyIn(pos + sizeof(header), message, message_len);
+  tail.store(pos + need, std::memory_order_release);
+  return true;
+}
+
+void AsyncLogger::Ring::CopyIn(uint64_t pos, const char* src, uint64_t len) {
+  const uint64_t offset = pos & (capacity - 1);
+  const uint64_t first = std::min(len, capacity - offset);
+  memcpy(buf.get() + offset, src, first);
+  memcpy(buf.get(), src + first, len - first);
+}
+
+void AsyncLogger::Ring::CopyOut(uint64_t pos, char* dst,
+                                uint64_t len) const {
+  const uint64_t offset = pos & (capacity - 1);
+  const uint64_t first = std::min(len, capacity - offset);
+  memcpy(dst, buf.get() + offset, first);
+  memcpy(dst + first, buf.get(), len - first);
+}
+
 AsyncLogger::AsyncLogger(google::base::Logger* wrapped, int max_buffer_bytes)
-    : max_buffer_bytes_(max_buffer_bytes),
-      wrapped_(wrapped),
-      active_buf_(new Buffer()),
-      flushing_buf_(new Buffer()) {
-  if (max_buffer_bytes_ <= 0) {
-    max_buffer_bytes_ = 2 * 1024 * 1024;
+    : id_(++logger_id_counter), ring_bytes_(kMinRingBytes), wrapped_(wrapped) {
+  if (max_buffer_bytes <= 0) {
+    max_buffer_bytes = 2 * 1024 * 1024;
+  }
+  while (ring_bytes_ * 2 <= static_cast<uint64_t>(max_buffer_bytes) / 8) {
+    ring_bytes_ *= 2;
   }
 }
 
@@ -50,7 +107,7 @@ AsyncLogger::~AsyncLogger() {
 }
 
 void AsyncLogger::Start() {
-  CHECK_EQ(state_, INITTED);
+  CHECK_EQ(state_.load(), INITTED);
   state_ = RUNNING;
   thread_ = std::thread(&AsyncLogger::RunThread, this);
   // std::cout << "Async Logger Start!" << std::endl;
@@ -59,59 +116,68 @@ void AsyncLogger::Start() {
 void AsyncLogger::Stop() {
   {
     std::unique_lock<std::mutex> lock(mutex_);
-    CHECK_EQ(state_, RUNNING);
+    CHECK_EQ(state_.load(), RUNNING);
     state_ = STOPPED;
     wake_flusher_cv_.notify_one();
   }
   thread_.join();
-  CHECK(active_buf_->messages.empty());
-  CHECK(flushing_buf_->messages.empty());
+  // pick up whatever raced with the last drain of the logger thread
+  DrainRings();
+  for (auto& module_logger : moduleLoggerMap) {
+    module_logger.second->Flush();
+  }
   // std::cout << "Async Logger Stop!" << std::endl;
 }
 
-void AsyncLogger::Write(bool force_flush, time_t timestamp, const char* message,
-                        int message_len) {
-  // drop message when acitve buffer full
-  if (unlikely(BufferFull(*active_buf_))) {
-    return;
+AsyncLogger::Ring* AsyncLogger::LocalRing() {
+  struct ThreadRings {
+    std::vector<std::pair<uint64_t, std::shared_ptr<Ring>>> rings;
+    ~ThreadRings() {
+      for (auto& item : rings) {
+        item.second->retired = true;
+      }
+    }
+  };
+  static thread_local ThreadRings local;
+  for (auto& item : local.rings) {
+    if (item.first == id_) {
+      return item.second.get();
+    }
   }
+  auto ring = std::make_shared<Ring>(ring_bytes_);
   {
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (state_ != RUNNING) {
-      // std::cout << "Async Logger not running!" << std::endl;
-      return;
-    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    rings_.emplace_back(ring);
+  }
+  local.rings.emplace_back(id_, ring);
+  return ring.get();
+}
 
-    switch (message[0]) {
-      case 'F': {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), 3),
-                         force_flush);
-        break;
-      }
-      case 'E': {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), 2),
-                         force_flush);
-        break;
-      }
-      case 'W': {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), 1),
-                         force_flush);
-        break;
-      }
-      case 'I': {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), 0),
-                         force_flush);
-        break;
-      }
-      default: {
-        active_buf_->add(Msg(timestamp, std::string(message, message_len), -1),
-                         force_flush);
-      }
-    }
+void AsyncLogger::WakeFlusher() {
+  if (!pending_.exchange(true)) {
+    std::lock_guard<std::mutex> lock(mutex_);
     wake_flusher_cv_.notify_one();
   }
 }
 
+void AsyncLogger::Write(bool force_flush, time_t timestamp, const char* message,
+                        int message_len) {
+  if (unlikely(state_.load(std::memory_order_relaxed) != RUNNING)) {
+    // std::cout << "Async Logger not running!" << std::endl;
+    return;
+  }
+  // drop message when the thread's ring is full
+  if (unlikely(
+          !LocalRing()->Push(force_flush, timestamp, message, message_len))) {
+    drop_count_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  if (force_flush) {
+    flush_requested_ = true;
+  }
+  WakeFlusher();
+}
+
 void AsyncLogger::Flush() {
   std::unique_lock<std::mutex> lock(mutex_);
   if (state_ != RUNNING) {
@@ -120,10 +186,11 @@ void AsyncLogger::Flush() {
   }
 
   // Wake up the writer thread at least twice.
-  // This ensures both buffers were completely flushed.
+  // This ensures every ring drained before the call was written out.
   uint64_t orig_flush_count = flush_count_;
   while (flush_count_ < (orig_flush_count + 2) && state_ == RUNNING) {
-    active_buf_->flush = true;
+    flush_requested_ = true;
+    pending_ = true;
     wake_flusher_cv_.notify_one();
     flush_complete_cv_.wait(lock);
   }
@@ -131,56 +198,96 @@ void AsyncLogger::Flush() {
 
 uint32_t AsyncLogger::LogSize() { return wrapped_->LogSize(); }
 
+void AsyncLogger::WriteToFile(time_t ts, std::string* message,
+                              int32_t level) {
+  std::string module_name;
+  FindModuleName(message, &module_name);
+
+  LogFileObject* fileobject = nullptr;
+  if (moduleLoggerMap.find(module_name) != moduleLoggerMap.end()) {
+    fileobject = moduleLoggerMap[module_name];
+  } else {
+    fileobject = new LogFileObject(google::INFO, module_name.c_str());
+    fileobject->SetSymlinkBasename(module_name.c_str());
+    moduleLoggerMap[module_name] = fileobject;
+  }
+  if (fileobject) {
+    const bool should_flush = level > 0;
+    fileobject->Write(should_flush, ts, message->data(),
+                      static_cast<int>(message->size()));
+  }
+}
+
+bool AsyncLogger::DrainRings() {
+  std::vector<std::shared_ptr<Ring>> rings;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rings = rings_;
+  }
+
+  bool flush = false;
+  std::string message;
+  for (auto& ring : rings) {
+    uint64_t pos = ring->head.load(std::memory_order_relaxed);
+    const uint64_t tail = ring->tail.load(std::memory_order_acquire);
+    while (pos != tail) {
+      MsgHeader header;
+      ring->CopyOut(pos, reinterpret_cast<char*>(&header), sizeof(header));
+      message.resize(header.len);
+      ring->CopyOut(pos + sizeof(header), &message[0], header.len);
+      pos += sizeof(header) + header.len;
+      flush |= header.force_flush;
+      WriteToFile(header.ts, &message,
+                  header.len > 0 ? LevelOf(message[0]) : -1);
+    }
+    ring->head.store(pos, std::memory_order_release);
+  }
+
+  // free the rings of exited threads once nothing is left in them
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto itr = rings_.begin(); itr != rings_.end();) {
+    auto& ring = *itr;
+    if (ring->retired && ring->head.load() == ring->tail.load()) {
+      itr = rings_.erase(itr);
+    } else {
+      ++itr;
+    }
+  }
+  return flush;
+}
+
 void AsyncLogger::RunThread() {
   std::unique_lock<std::mutex> lock(mutex_);
-  while (state_ == RUNNING || active_buf_->needs_flush_or_write()) {
-    while (!active_buf_->needs_flush_or_write() && state_ == RUNNING) {
+  while (true) {
+    bool timeout_flush = false;
+    while (!pending_ && state_ == RUNNING) {
       if (wake_flusher_cv_.wait_for(lock, std::chrono::seconds(2)) ==
           std::cv_status::timeout) {
-        active_buf_->flush = true;
+        timeout_flush = true;
+        break;
       }
     }
-
-    active_buf_.swap(flushing_buf_);
+    const bool stopping = state_ != RUNNING;
+    pending_ = false;
     lock.unlock();
 
-    for (auto& msg : flushing_buf_->messages) {
-      std::string module_name;
-      FindModuleName(&msg.message, &module_name);
-
-      LogFileObject* fileobject = nullptr;
-      if (moduleLoggerMap.find(module_name) != moduleLoggerMap.end()) {
-        fileobject = moduleLoggerMap[module_name];
-      } else {
-        fileobject = new LogFileObject(google::INFO, module_name.c_str());
-        fileobject->SetSymlinkBasename(module_name.c_str());
-        moduleLoggerMap[module_name] = fileobject;
-      }
-      if (fileobject) {
-        const bool should_flush = msg.level > 0;
-        fileobject->Write(should_flush, msg.ts, msg.message.data(),
-                          static_cast<int>(msg.message.size()));
-      }
-    }
-
-    if (flushing_buf_->flush) {
+    bool flush = DrainRings();
+    flush |= flush_requested_.exchange(false);
+    if (flush || timeout_flush || stopping) {
       for (auto& module_logger : moduleLoggerMap) {
         module_logger.second->Flush();
       }
     }
-    flushing_buf_->clear();
 
     lock.lock();
     flush_count_++;
     flush_complete_cv_.notify_all();
+    if (stopping) {
+      break;
+    }
   }
 }
 
-bool AsyncLogger::BufferFull(const Buffer& buf) const {
-  // We evenly divide our total buffer space into two buffers.
-  return buf.size > (max_buffer_bytes_ / 2);
-}
-
 }  // namespace logger
 }  // namespace cyber
 }  // namespace apollo
@@ -38,33 +38,30 @@ namespace logger {
 
 // Wrapper for a glog Logger which asynchronously writes log messages.
 // This class starts a new thread responsible for forwarding the messages
-// to the logger, and performs double buffering. Writers append to the
-// current buffer and then wake up the logger thread. The logger swaps in
-// a new buffer and writes any accumulated messages to the wrapped
-// Logger.
+// to the logger. Every application thread appends to its own lock-free
+// single-producer ring, so logging threads never contend with each other or
+// with the IO thread. The logger thread drains all rings and writes any
+// accumulated messages to the per-module log files.
 //
-// This double-buffering design dramatically improves performance, especially
-// for logging messages which require flushing the underlying file (i.e WARNING
-// and above for default). The flush can take a couple of milliseconds, and in
-// some cases can even block for hundreds of milliseconds or more. With the
-// double-buffered approach, threads can proceed with useful work while the IO
-// thread blocks.
+// glog hands us fully formatted lines, so the writer only copies the line and
+// a small header into its ring. Level decoding, module name extraction and the
+// file lookup are all deferred to the logger thread.
 //
 // The semantics provided by this wrapper are slightly weaker than the default
 // glog semantics. By default, glog will immediately (synchronously) flush
-// WARNING
-// and above to the underlying file, whereas here we are deferring that flush to
-// a separate thread. This means that a crash just after a 'LOG_WARN' would
+// WARNING and above to the underlying file, whereas here we are deferring that
+// flush to a separate thread. This means that a crash just after a 'LOG_WARN'
 // may be missing the message in the logs, but the perf benefit is probably
 // worth it. We do take care that a glog FATAL message flushes all buffered log
-// messages before exiting.
+// messages before exiting. Messages keep their order within a thread; lines of
+// different threads may interleave in drain order.
 //
-// NOTE: the logger limits the total amount of buffer space, so if the
-// underlying
-// log blocks for too long, eventually the threads generating the log messages
-// will block as well. This prevents runaway memory usage.
+// NOTE: each thread's ring is bounded, so if the underlying log blocks for too
+// long, messages from a thread whose ring is full are dropped rather than
+// blocking the thread. This prevents runaway memory usage.
 class AsyncLogger : public google::base::Logger {
  public:
+  // Each logging thread gets a ring of an eighth of 'max_buffer_bytes'.
   explicit AsyncLogger(google::base::Logger* wrapped, int max_buffer_bytes);
 
   ~AsyncLogger();
@@ -105,60 +102,46 @@ class AsyncLogger : public google::base::Logger {
   const std::thread* LogThread() const { return &thread_; }
 
  private:
-  // A buffered message.
-  //
-  // TODO(todd): using std::string for buffered messages is convenient but not
-  // as efficient as it could be. It's better to make the buffers just be
-  // Arenas and allocate both the message data and Msg struct from them, forming
-  // a linked list.
-  struct Msg {
+  // Header written in front of every message in a ring.
+  struct MsgHeader {
     time_t ts;
-    std::string message;
-    int32_t level;
-
-    Msg(time_t ts, std::string&& message, int32_t level)
-        : ts(ts), message(std::move(message)), level(level) {}
+    int32_t len;
+    bool force_flush;
   };
 
-  // A buffer of messages waiting to be flushed.
-  struct Buffer {
-    std::vector<Msg> messages;
-
-    // Estimate of the size of 'messages'.
-    std::atomic<int> size = {0};
-
-    // Whether this buffer needs an explicit flush of the
-    // underlying logger.
-    bool flush = false;
-
-    Buffer() {}
-
-    inline void clear() {
-      messages.clear();
-      size = 0;
-      flush = false;
-    }
-
-    inline void add(Msg&& msg, bool force_flush) {
-      size += static_cast<int>(sizeof(msg))
-              + static_cast<int>(msg.message.size());
-      messages.emplace_back(std::move(msg));
-      flush |= force_flush;
-    }
-
-    inline bool needs_flush_or_write() const {
-      return flush || !messages.empty();
-    }
-
-   private:
-    DISALLOW_COPY_AND_ASSIGN(Buffer);
+  // A single-producer single-consumer byte ring. Only the owning thread
+  // advances 'tail', only the logger thread advances 'head'.
+  struct Ring {
+    explicit Ring(uint64_t capacity)
+        : capacity(capacity), buf(new char[capacity]) {}
+
+    bool Push(bool force_flush, time_t timestamp, const char* message,
+              int message_len);
+    void CopyIn(uint64_t pos, const char* src, uint64_t len);
+    void CopyOut(uint64_t pos, char* dst, uint64_t len) const;
+
+    const uint64_t capacity;
+    std::unique_ptr<char[]> buf;
+    alignas(64) std::atomic<uint64_t> head = {0};
+    alignas(64) std::atomic<uint64_t> tail = {0};
+    // set when the owning thread exits, the ring is freed once drained.
+    std::atomic<bool> retired = {false};
+
+    DISALLOW_COPY_AND_ASSIGN(Ring);
   };
 
-  bool BufferFull(const Buffer& buf) const;
+  // Returns the calling thread's ring, registering one on first use.
+  Ring* LocalRing();
+  void WakeFlusher();
+  // Drains every ring to the log files, returns true if a flush was asked for.
+  bool DrainRings();
+  void WriteToFile(time_t ts, std::string* message, int32_t level);
   void RunThread();
 
-  // The maximum number of bytes used by the entire class.
-  int max_buffer_bytes_;
+  const uint64_t id_;
+
+  // Capacity of each thread's ring, a power of two.
+  uint64_t ring_bytes_;
 
   google::base::Logger* const wrapped_;
   std::thread thread_;
@@ -169,33 +152,30 @@ class AsyncLogger : public google::base::Logger {
 
   // Count of how many times the writer thread has dropped the log messages.
   // 64 bits should be enough to never worry about overflow.
-  uint64_t drop_count_ = 0;
+  std::atomic<uint64_t> drop_count_ = {0};
 
-  // Protects buffers as well as 'state_'.
+  // Protects 'rings_', 'flush_count_' and the sleeping flusher. Writers only
+  // take it to register a ring or to wake up an idle flusher.
   std::mutex mutex_;
 
   // Signaled by app threads to wake up the flusher, either for new
   // data or because 'state_' changed.
   std::condition_variable wake_flusher_cv_;
 
-  // Signaled by the flusher thread when the flusher has swapped in
-  // a free buffer to write to.
-  // std::condition_variable free_buffer_cv_;
-
   // Signaled by the flusher thread when it has completed flushing
   // the current buffer.
   std::condition_variable flush_complete_cv_;
 
-  // The buffer to which application threads append new log messages.
-  std::unique_ptr<Buffer> active_buf_;
+  // Set by writers when the flusher has work, cleared by the flusher before
+  // each drain so a wakeup costs one lock per drain rather than per message.
+  std::atomic<bool> pending_ = {false};
+  std::atomic<bool> flush_requested_ = {false};
 
-  // The buffer currently being flushed by the logger thread, cleared
-  // after a successful flush.
-  std::unique_ptr<Buffer> flushing_buf_;
+  std::vector<std::shared_ptr<Ring>> rings_;
 
   // Trigger for the logger thread to stop.
   enum State { INITTED, RUNNING, STOPPED };
-  State state_ = INITTED;
+  std::atomic<State> state_ = {INITTED};
 
   DISALLOW_COPY_AND_ASSIGN(AsyncLogger);
 };
@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/logger/async_logger.h"
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace apollo {
+namespace cyber {
+namespace logger {
+
+TEST(AsyncLoggerTest, write_from_threads) {
+  AsyncLogger logger(google::base::GetLogger(google::INFO), 1024 * 1024);
+  logger.Start();
+  time_t timep;
+  time(&timep);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&logger, timep, i]() {
+      for (int j = 0; j < 1000; ++j) {
+        std::string message = "I [AsyncLoggerTest] thread " +
+                              std::to_string(i) + " message " +
+                              std::to_string(j) + "\n";
+        logger.Write(j % 100 == 0, timep, message.c_str(),
+                     static_cast<int>(message.size()));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  logger.Flush();
+  EXPECT_NE(nullptr, logger.LogThread());
+  logger.Stop();
+}
+
+TEST(AsyncLoggerTest, drop_oversized) {
+  AsyncLogger logger(google::base::GetLogger(google::INFO), 0);
+  logger.Start();
+  time_t timep;
+  time(&timep);
+  std::string message(4 * 1024 * 1024, 'I');
+  logger.Write(false, timep, message.c_str(),
+               static_cast<int>(message.size()));
+  message = "I [AsyncLoggerTest] after oversized message\n";
+  logger.Write(false, timep, message.c_str(),
+               static_cast<int>(message.size()));
+  logger.Flush();
+  logger.Stop();
+}
+
+}  // namespace logger
+}  // namespace cyber
+}  // namespace apollo
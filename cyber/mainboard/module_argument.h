@@ -17,6 +17,7 @@
 #ifndef CYBER_MAINBOARD_MODULE_ARGUMENT_H_
 #define CYBER_MAINBOARD_MODULE_ARGUMENT_H_
 
+#include <cstdint>
 #include <list>
 #include <string>
 
@@ -44,12 +45,14 @@ class ModuleArgument {
   inline std::list<std::string> GetDAGConfList() const {
     return dag_conf_list_;
   }
+  inline uint32_t GetInitThreads() const { return init_threads_; }
 
  private:
   std::list<std::string> dag_conf_list_;
   std::string binary_name_;
   std::string process_group_;
   std::string sched_name_;
+  uint32_t init_threads_ = 0;
 };
 
 }  // namespace mainboard
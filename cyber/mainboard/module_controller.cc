@@ -16,30 +16,113 @@
 
 #include "cyber/mainboard/module_controller.h"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 
+#include "cyber/base/thread_pool.h"
 #include "cyber/common/environment.h"
 #include "cyber/common/file.h"
+#include "cyber/common/global_data.h"
 #include "cyber/component/component_base.h"
+#include "cyber/event/channel_tracer.h"
+#include "cyber/scheduler/scheduler_factory.h"
+#include "cyber/service/service_stats.h"
 
 namespace apollo {
 namespace cyber {
 namespace mainboard {
 
+namespace {
+const char kSchedulerStatsPrefix[] = "/apollo/cyber/scheduler_stats/";
+const uint32_t kSchedulerStatsPeriodMs = 1000;
+const char kChannelTracePrefix[] = "/apollo/cyber/channel_trace/";
+const char kServiceStatsPrefix[] = "/apollo/cyber/service_stats/";
+const size_t kNumSlowestReported = 5;
+}  // namespace
+
 ModuleController::ModuleController(const ModuleArgument& args) { args_ = args; }
 
 ModuleController::~ModuleController() {}
 
-bool ModuleController::Init() { return LoadAll(); }
+bool ModuleController::Init() { return LoadAll() && InitSchedulerStats(); }
 
 void ModuleController::Clear() {
+  if (stats_timer_ != nullptr) {
+    stats_timer_->Stop();
+    stats_timer_.reset();
+  }
+  stats_writer_.reset();
+  trace_writer_.reset();
+  service_stats_writer_.reset();
+  stats_service_.reset();
+  stats_node_.reset();
   for (auto& component : component_list_) {
     component->Shutdown();
   }
   component_list_.clear();  // keep alive
+  pending_components_.clear();
   class_loader_manager_.UnloadAllLibrary();
 }
 
+bool ModuleController::InitSchedulerStats() {
+  const std::string& process_group =
+      common::GlobalData::Instance()->ProcessGroup();
+  const std::string name = kSchedulerStatsPrefix + process_group;
+  stats_node_ = CreateNode("scheduler_stats_" + process_group);
+  if (stats_node_ == nullptr) {
+    AERROR << "Failed to create scheduler stats node.";
+    return false;
+  }
+
+  stats_service_ =
+      stats_node_->CreateService<SchedulerStatsRequest, SchedulerStats>(
+          name, [](const std::shared_ptr<SchedulerStatsRequest>& request,
+                   std::shared_ptr<SchedulerStats>& response) {
+            scheduler::Instance()->GetStats(*request, response.get());
+          });
+  stats_writer_ = stats_node_->CreateWriter<SchedulerStats>(name);
+  service_stats_writer_ = stats_node_->CreateWriter<ServiceStats>(
+      kServiceStatsPrefix + process_group);
+  if (stats_service_ == nullptr || stats_writer_ == nullptr ||
+      service_stats_writer_ == nullptr) {
+    AERROR << "Failed to expose scheduler stats on " << name;
+    return false;
+  }
+  if (event::ChannelTracer::Instance()->enabled()) {
+    trace_writer_ = stats_node_->CreateWriter<ChannelTraceStats>(
+        kChannelTracePrefix + process_group);
+    if (trace_writer_ == nullptr) {
+      AERROR << "Failed to expose channel trace of " << process_group;
+      return false;
+    }
+  }
+
+  stats_timer_.reset(new Timer(
+      kSchedulerStatsPeriodMs,
+      [this]() {
+        SchedulerStatsRequest request;
+        auto stats = std::make_shared<SchedulerStats>();
+        scheduler::Instance()->GetStats(request, stats.get());
+        stats_writer_->Write(stats);
+        auto service_stats = std::make_shared<ServiceStats>();
+        service::ServiceStats::Instance()->GetStats(service_stats.get());
+        service_stats_writer_->Write(service_stats);
+        if (trace_writer_ != nullptr) {
+          auto trace = std::make_shared<ChannelTraceStats>();
+          event::ChannelTracer::Instance()->GetStats(trace.get());
+          trace_writer_->Write(trace);
+        }
+      },
+      false));
+  stats_timer_->Start();
+  return true;
+}
+
 bool ModuleController::LoadAll() {
   const std::string work_root = common::WorkRoot();
   const std::string current_path = common::GetCurrentPath();
@@ -66,6 +149,136 @@ bool ModuleController::LoadAll() {
       return false;
     }
   }
+  return InitializeComponents();
+}
+
+bool ModuleController::InitializeComponents() {
+  const size_t num_components = pending_components_.size();
+  std::unordered_map<std::string, size_t> index_by_name;
+  for (size_t i = 0; i < num_components; ++i) {
+    index_by_name[pending_components_[i].name] = i;
+  }
+  std::vector<size_t> num_waiting(num_components, 0);
+  std::vector<std::vector<size_t>> dependents(num_components);
+  for (size_t i = 0; i < num_components; ++i) {
+    for (const auto& name : pending_components_[i].depends_on) {
+      auto iter = index_by_name.find(name);
+      if (iter == index_by_name.end()) {
+        AERROR << "Component " << pending_components_[i].name
+               << " depends on unknown component " << name;
+        return false;
+      }
+      ++num_waiting[i];
+      dependents[iter->second].push_back(i);
+    }
+  }
+
+  // the components are started in dag order as soon as their dependencies
+  // are initialized, the finished ones are handed back to this thread.
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<std::pair<size_t, bool>> finished;
+  std::vector<double> init_time_ms(num_components, 0.0);
+  std::vector<bool> initialized(num_components, false);
+  std::deque<size_t> ready;
+  for (size_t i = 0; i < num_components; ++i) {
+    if (num_waiting[i] == 0) {
+      ready.push_back(i);
+    }
+  }
+
+  const auto start_time = std::chrono::steady_clock::now();
+  const size_t num_threads = std::max<size_t>(
+      1, std::min<size_t>(args_.GetInitThreads(), num_components));
+  size_t num_running = 0;
+  size_t num_done = 0;
+  bool success = true;
+  {
+    base::ThreadPool pool(num_threads);
+    while (num_done < num_components) {
+      while (success && !ready.empty() && num_running < num_threads) {
+        const size_t index = ready.front();
+        ready.pop_front();
+        ++num_running;
+        pool.Enqueue([this, index, &mutex, &cv, &finished, &init_time_ms]() {
+          const auto begin = std::chrono::steady_clock::now();
+          const bool ok = pending_components_[index].initialize();
+          init_time_ms[index] = std::chrono::duration<double, std::milli>(
+                                    std::chrono::steady_clock::now() - begin)
+                                    .count();
+          std::lock_guard<std::mutex> lock(mutex);
+          finished.emplace_back(index, ok);
+          cv.notify_one();
+        });
+      }
+      if (num_running == 0) {
+        break;
+      }
+
+      std::unique_lock<std::mutex> lock(mutex);
+      cv.wait(lock, [&finished]() { return !finished.empty(); });
+      while (!finished.empty()) {
+        const size_t index = finished.front().first;
+        const bool ok = finished.front().second;
+        finished.pop_front();
+        --num_running;
+        ++num_done;
+        const auto& name = pending_components_[index].name;
+        if (!ok) {
+          AERROR << "Failed to initialize component " << name;
+          success = false;
+          continue;
+        }
+        initialized[index] = true;
+        AINFO << "Initialized component " << name << " in "
+              << init_time_ms[index] << " ms";
+        for (const size_t dependent : dependents[index]) {
+          if (--num_waiting[dependent] == 0) {
+            ready.push_back(dependent);
+          }
+        }
+      }
+    }
+  }
+
+  for (size_t i = 0; i < num_components; ++i) {
+    if (initialized[i]) {
+      component_list_.emplace_back(pending_components_[i].component);
+    }
+  }
+  if (success && num_done < num_components) {
+    for (size_t i = 0; i < num_components; ++i) {
+      if (num_waiting[i] > 0) {
+        AERROR << "Component " << pending_components_[i].name
+               << " is in a dependency cycle";
+      }
+    }
+    success = false;
+  }
+  if (!success) {
+    pending_components_.clear();
+    return false;
+  }
+
+  // the slowest components are the ones to look at to cut the start up time
+  std::vector<size_t> order(num_components);
+  for (size_t i = 0; i < num_components; ++i) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&init_time_ms](size_t a, size_t b) {
+    return init_time_ms[a] > init_time_ms[b];
+  });
+  const double total_ms = std::chrono::duration<double, std::milli>(
+                              std::chrono::steady_clock::now() - start_time)
+                              .count();
+  AINFO << "Initialized " << num_components << " components on "
+        << num_threads << " threads in " << total_ms << " ms";
+  for (size_t i = 0; i < std::min<size_t>(kNumSlowestReported, num_components);
+       ++i) {
+    AINFO << "  " << pending_components_[order[i]].name << ": "
+          << init_time_ms[order[i]] << " ms";
+  }
+  pending_components_.clear();
   return true;
 }
 
@@ -96,10 +309,16 @@ bool ModuleController::LoadModule(const DagConfig& dag_config) {
         return false;
       }
 
-      if (!base->Initialize(component.config())) {
-        return false;
-      }
-      component_list_.emplace_back(std::move(base));
+      const auto& config = component.config();
+      PendingComponent pending;
+      pending.name = config.name();
+      pending.component = base;
+      pending.initialize = [base, config]() {
+        return base->Initialize(config);
+      };
+      pending.depends_on.assign(config.depends_on().begin(),
+                                config.depends_on().end());
+      pending_components_.emplace_back(std::move(pending));
     }
 
     for (auto& component : module_config.timer_components()) {
@@ -110,10 +329,16 @@ bool ModuleController::LoadModule(const DagConfig& dag_config) {
         return false;
       }
 
-      if (!base->Initialize(component.config())) {
-        return false;
-      }
-      component_list_.emplace_back(std::move(base));
+      const auto& config = component.config();
+      PendingComponent pending;
+      pending.name = config.name();
+      pending.component = base;
+      pending.initialize = [base, config]() {
+        return base->Initialize(config);
+      };
+      pending.depends_on.assign(config.depends_on().begin(),
+                                config.depends_on().end());
+      pending_components_.emplace_back(std::move(pending));
     }
   }
   return true;
@@ -16,20 +16,30 @@
 #ifndef CYBER_MAINBOARD_MODULE_CONTROLLER_H_
 #define CYBER_MAINBOARD_MODULE_CONTROLLER_H_
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "cyber/class_loader/class_loader_manager.h"
 #include "cyber/component/component.h"
+#include "cyber/cyber.h"
 #include "cyber/mainboard/module_argument.h"
+#include "cyber/proto/channel_trace.pb.h"
 #include "cyber/proto/dag_conf.pb.h"
+#include "cyber/proto/scheduler_stats.pb.h"
+#include "cyber/proto/service_stats.pb.h"
+#include "cyber/timer/timer.h"
 
 namespace apollo {
 namespace cyber {
 namespace mainboard {
 
+using apollo::cyber::proto::ChannelTraceStats;
 using apollo::cyber::proto::DagConfig;
+using apollo::cyber::proto::SchedulerStats;
+using apollo::cyber::proto::SchedulerStatsRequest;
+using apollo::cyber::proto::ServiceStats;
 
 class ModuleController {
  public:
@@ -43,10 +53,33 @@ class ModuleController {
  private:
   bool LoadModule(const std::string& path);
   bool LoadModule(const DagConfig& dag_config);
+  bool InitSchedulerStats();
+  bool InitializeComponents();
+
+  // a component created from its library but not initialized yet
+  struct PendingComponent {
+    std::string name;
+    std::shared_ptr<ComponentBase> component;
+    std::function<bool()> initialize;
+    std::vector<std::string> depends_on;
+  };
+
+  // served on demand and also written periodically, so cyber_monitor can
+  // show the scheduling histograms of this process like any other channel.
+  std::shared_ptr<Node> stats_node_;
+  std::shared_ptr<Service<SchedulerStatsRequest, SchedulerStats>>
+      stats_service_;
+  std::shared_ptr<Writer<SchedulerStats>> stats_writer_;
+  // per-channel latency histograms, only written with cyber_channel_trace=1
+  std::shared_ptr<Writer<ChannelTraceStats>> trace_writer_;
+  // request to response latency of the services this process calls
+  std::shared_ptr<Writer<ServiceStats>> service_stats_writer_;
+  std::unique_ptr<Timer> stats_timer_;
 
   ModuleArgument args_;
   class_loader::ClassLoaderManager class_loader_manager_;
   std::vector<std::shared_ptr<ComponentBase>> component_list_;
+  std::vector<PendingComponent> pending_components_;
 };
 
 }  // namespace mainboard
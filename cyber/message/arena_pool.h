@@ -0,0 +1,150 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#ifndef CYBER_MESSAGE_ARENA_POOL_H_
+#define CYBER_MESSAGE_ARENA_POOL_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "google/protobuf/arena.h"
+#include "google/protobuf/message.h"
+
+namespace apollo {
+namespace cyber {
+namespace message {
+
+/**
+ * @class ArenaPool
+ * @brief A bounded free list of protobuf arenas used to decode messages.
+ *
+ * `CreateMessage` hands out a message constructed in a recycled arena. The
+ * returned shared_ptr owns the arena: when the last copy drops, the arena is
+ * reset and goes back to the pool, so a steady stream of messages reuses the
+ * same blocks instead of paying one malloc per sub-message and string.
+ *
+ * Types that are not arena constructable (non-protobuf types, or protos built
+ * without `cc_enable_arenas`) fall back to a plain heap allocation.
+ */
+class ArenaPool : public std::enable_shared_from_this<ArenaPool> {
+ public:
+  static constexpr size_t kDefaultCapacity = 16;
+  static constexpr size_t kDefaultInitialBlockSize = 64 * 1024;
+
+  static std::shared_ptr<ArenaPool> Create(
+      size_t capacity = kDefaultCapacity,
+      size_t initial_block_size = kDefaultInitialBlockSize) {
+    return std::shared_ptr<ArenaPool>(
+        new ArenaPool(capacity, initial_block_size));
+  }
+
+  template <typename T>
+  typename std::enable_if<
+      google::protobuf::Arena::is_arena_constructable<T>::value,
+      std::shared_ptr<T>>::type
+  CreateMessage() {
+    auto pool = shared_from_this();
+    Entry* entry = Acquire();
+    T* msg = google::protobuf::Arena::CreateMessage<T>(entry->arena.get());
+    return std::shared_ptr<T>(msg,
+                              [pool, entry](T*) { pool->Release(entry); });
+  }
+
+  template <typename T>
+  typename std::enable_if<
+      !google::protobuf::Arena::is_arena_constructable<T>::value,
+      std::shared_ptr<T>>::type
+  CreateMessage() {
+    return std::make_shared<T>();
+  }
+
+  size_t idle_size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return idle_.size();
+  }
+
+  ~ArenaPool() {
+    for (auto entry : idle_) {
+      delete entry;
+    }
+  }
+
+ private:
+  // The initial block is owned by the pool rather than the arena, so
+  // `Arena::Reset` keeps it and a recycled arena decodes a typical message
+  // without touching the allocator at all.
+  struct Entry {
+    explicit Entry(size_t block_size) : block(new char[block_size]) {
+      google::protobuf::ArenaOptions options;
+      options.initial_block = block.get();
+      options.initial_block_size = block_size;
+      arena.reset(new google::protobuf::Arena(options));
+    }
+
+    std::unique_ptr<char[]> block;
+    // declared after `block` so the arena is torn down first.
+    std::unique_ptr<google::protobuf::Arena> arena;
+  };
+
+  ArenaPool(size_t capacity, size_t initial_block_size)
+      : capacity_(capacity), initial_block_size_(initial_block_size) {
+    idle_.reserve(capacity_);
+  }
+
+  ArenaPool(const ArenaPool&) = delete;
+  ArenaPool& operator=(const ArenaPool&) = delete;
+
+  Entry* Acquire() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!idle_.empty()) {
+        auto entry = idle_.back();
+        idle_.pop_back();
+        return entry;
+      }
+    }
+    return new Entry(initial_block_size_);
+  }
+
+  void Release(Entry* entry) {
+    entry->arena->Reset();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (idle_.size() < capacity_) {
+        idle_.push_back(entry);
+        return;
+      }
+    }
+    delete entry;
+  }
+
+  size_t capacity_;
+  size_t initial_block_size_;
+  std::vector<Entry*> idle_;
+  std::mutex mutex_;
+};
+
+using ArenaPoolPtr = std::shared_ptr<ArenaPool>;
+
+}  // namespace message
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_MESSAGE_ARENA_POOL_H_
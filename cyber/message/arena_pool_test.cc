@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/message/arena_pool.h"
+
+#include <gtest/gtest.h>
+#include <string>
+
+#include "cyber/message/raw_message.h"
+#include "cyber/proto/unit_test.pb.h"
+
+namespace apollo {
+namespace cyber {
+namespace message {
+
+TEST(ArenaPoolTest, create_message) {
+  auto pool = ArenaPool::Create(2);
+  EXPECT_EQ(pool->idle_size(), 0);
+
+  auto msg = pool->CreateMessage<proto::Chatter>();
+  ASSERT_NE(msg, nullptr);
+  EXPECT_NE(msg->GetArena(), nullptr);
+
+  proto::Chatter src;
+  src.set_seq(7);
+  src.set_content(std::string(1024, 'x'));
+  std::string data;
+  ASSERT_TRUE(src.SerializeToString(&data));
+  ASSERT_TRUE(msg->ParseFromString(data));
+  EXPECT_EQ(msg->seq(), 7);
+  EXPECT_EQ(msg->content().size(), 1024);
+
+  auto copy = msg;
+  msg.reset();
+  EXPECT_EQ(pool->idle_size(), 0);
+  copy.reset();
+  EXPECT_EQ(pool->idle_size(), 1);
+}
+
+TEST(ArenaPoolTest, recycle) {
+  auto pool = ArenaPool::Create(2);
+  auto first = pool->CreateMessage<proto::Chatter>();
+  auto arena = first->GetArena();
+  first.reset();
+
+  auto second = pool->CreateMessage<proto::Chatter>();
+  EXPECT_EQ(second->GetArena(), arena);
+  EXPECT_FALSE(second->has_seq());
+}
+
+TEST(ArenaPoolTest, capacity) {
+  auto pool = ArenaPool::Create(1);
+  auto a = pool->CreateMessage<proto::Chatter>();
+  auto b = pool->CreateMessage<proto::Chatter>();
+  auto c = pool->CreateMessage<proto::Chatter>();
+  a.reset();
+  b.reset();
+  c.reset();
+  EXPECT_EQ(pool->idle_size(), 1);
+}
+
+TEST(ArenaPoolTest, outlive_pool) {
+  auto pool = ArenaPool::Create();
+  auto msg = pool->CreateMessage<proto::Chatter>();
+  pool.reset();
+  msg->set_seq(1);
+  EXPECT_EQ(msg->seq(), 1);
+}
+
+TEST(ArenaPoolTest, not_arena_constructable) {
+  auto pool = ArenaPool::Create();
+  auto msg = pool->CreateMessage<RawMessage>();
+  ASSERT_NE(msg, nullptr);
+  msg.reset();
+  EXPECT_EQ(pool->idle_size(), 0);
+}
+
+}  // namespace message
+}  // namespace cyber
+}  // namespace apollo
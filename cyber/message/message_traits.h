@@ -18,6 +18,7 @@
 #define CYBER_MESSAGE_MESSAGE_TRAITS_H_
 
 #include <string>
+#include <type_traits>
 
 #include "cyber/base/macros.h"
 #include "cyber/common/log.h"
@@ -32,6 +33,7 @@ namespace cyber {
 namespace message {
 
 DEFINE_TYPE_TRAIT(HasByteSize, ByteSize)
+DEFINE_TYPE_TRAIT(HasGetCachedSize, GetCachedSize)
 DEFINE_TYPE_TRAIT(HasType, TypeName)
 DEFINE_TYPE_TRAIT(HasSetType, SetTypeName)
 DEFINE_TYPE_TRAIT(HasDescriptor, GetDescriptorString)
@@ -52,6 +54,20 @@ class HasSerializer {
 template <typename T>
 constexpr bool HasSerializer<T>::value;
 
+// A message can be loaned from the transport, i.e. constructed in place
+// inside a shared memory block and read there by same-host readers, only if
+// its in-memory representation is its wire format.
+template <typename T>
+class IsLoanable {
+ public:
+  static constexpr bool value = std::is_trivially_copyable<T>::value &&
+                                std::is_standard_layout<T>::value &&
+                                !HasSerializer<T>::value;
+};
+
+template <typename T>
+constexpr bool IsLoanable<T>::value;
+
 template <typename T,
           typename std::enable_if<HasType<T>::value &&
                                       std::is_member_function_pointer<
@@ -131,6 +147,20 @@ typename std::enable_if<!HasByteSize<T>::value, int>::type ByteSize(
   return -1;
 }
 
+// The size computed by the last serialization of a protobuf message, 0 if it
+// was never serialized. Unlike ByteSize it does not walk the message.
+template <typename T>
+typename std::enable_if<HasGetCachedSize<T>::value, int>::type CachedByteSize(
+    const T& message) {
+  return message.GetCachedSize();
+}
+
+template <typename T>
+typename std::enable_if<!HasGetCachedSize<T>::value, int>::type
+CachedByteSize(const T& message) {
+  return ByteSize(message);
+}
+
 template <typename T>
 int FullByteSize(const T& message) {
   int content_size = ByteSize(message);
@@ -250,6 +280,14 @@ template <typename MessageT,
               int>::type = 0>
 void GetDescriptorString(const MessageT& message, std::string* desc_str) {}
 
+template <typename MessageT,
+          typename std::enable_if<
+              !std::is_base_of<google::protobuf::Message, MessageT>::value,
+              int>::type = 0>
+bool GetHeaderTimestamp(const MessageT& message, double* timestamp_sec) {
+  return false;
+}
+
 }  // namespace message
 }  // namespace cyber
 }  // namespace apollo
@@ -279,15 +279,23 @@ TEST(MessageTraitsTest, message_type) {
 
 TEST(MessageTraitsTest, descriptor) {
   const std::string pb_desc =
-      "\n\xFA\x1\n\x1B"
+      "\xA\xFD\x2\xA\x1B"
       "cyber/proto/unit_test.proto\x12\x12"
-      "apollo.cyber.proto\"1\n\bUnitTest\x12\x12\n\nclass_name\x18\x1 "
-      "\x1(\t\x12\x11\n\tcase_name\x18\x2 "
-      "\x1(\t\"S\n\aChatter\x12\x11\n\ttimestamp\x18\x1 "
-      "\x1(\x4\x12\x17\n\xFlidar_timestamp\x18\x2 \x1(\x4\x12\v\n\x3seq\x18\x3 "
-      "\x1(\x4\x12\xF\n\acontent\x18\x4 \x1(\f\"?\n\x10"
-      "ChatterBenchmark\x12\r\n\x5stamp\x18\x1 \x1(\x4\x12\v\n\x3seq\x18\x2 "
-      "\x1(\x4\x12\xF\n\acontent\x18\x3 \x1(\t";
+      "apollo.cyber.proto\"1\xA\x8UnitTest\x12\x12\xA\xA"
+      "class_name\x18\x1 \x1(\x9\x12\x11\xA\x9"
+      "case_name\x18\x2 \x1(\x9\"S\xA\x7"
+      "Chatter\x12\x11\xA\x9timestamp\x18\x1 \x1(\x4\x12\x17\xA\xFlid"
+      "ar_timestamp\x18\x2 \x1(\x4\x12\xB\xA\x3seq\x18\x3 \x1(\x4\x12"
+      "\xF\xA\x7"
+      "content\x18\x4 \x1(\xC\"?\xA\x10"
+      "ChatterBenchmark\x12\xD\xA\x5stamp\x18\x1 \x1(\x4\x12\xB\xA\x3"
+      "seq\x18\x2 \x1(\x4\x12\xF\xA\x7"
+      "content\x18\x3 \x1(\x9\"&\xA\xDStampedHeader\x12\x15\xA\xDtime"
+      "stamp_sec\x18\x1 \x1(\x1\"T\xA\xEStampedChatter\x12"
+      "1\xA\x6header\x18\x1 \x1(\xB"
+      "2!.apollo.cyber.proto.StampedHeader\x12\xF\xA\x7"
+      "content\x18\x2 \x1(\xC"
+      "B\x3\xF8\x1\x1";
   std::string desc;
   GetDescriptorString<proto::UnitTest>("apollo.cyber.proto.UnitTest", &desc);
   EXPECT_EQ(pb_desc, desc);
@@ -305,6 +313,22 @@ TEST(MessageTraitsTest, descriptor) {
   EXPECT_EQ("message", desc);
 }
 
+TEST(MessageTraitsTest, header_timestamp) {
+  double timestamp_sec = 0.0;
+  proto::StampedChatter stamped;
+  EXPECT_FALSE(GetHeaderTimestamp(stamped, &timestamp_sec));
+  stamped.mutable_header()->set_timestamp_sec(1.5);
+  EXPECT_TRUE(GetHeaderTimestamp(stamped, &timestamp_sec));
+  EXPECT_DOUBLE_EQ(1.5, timestamp_sec);
+
+  proto::Chatter chatter;
+  chatter.set_timestamp(1);
+  EXPECT_FALSE(GetHeaderTimestamp(chatter, &timestamp_sec));
+
+  Message message;
+  EXPECT_FALSE(GetHeaderTimestamp(message, &timestamp_sec));
+}
+
 }  // namespace message
 }  // namespace cyber
 }  // namespace apollo
@@ -16,13 +16,27 @@
 
 #include "cyber/message/protobuf_factory.h"
 #include "cyber/common/log.h"
+#include "cyber/common/util.h"
 
 namespace apollo {
 namespace cyber {
 namespace message {
 
+using base::AtomicRWLock;
+using base::ReadLockGuard;
+using base::WriteLockGuard;
 using google::protobuf::MessageFactory;
 
+google::protobuf::Message* MessageTypeInfo::Parse(
+    const std::string& content) const {
+  auto message = prototype->New();
+  if (!message->ParseFromString(content)) {
+    delete message;
+    return nullptr;
+  }
+  return message;
+}
+
 ProtobufFactory::ProtobufFactory() {
   pool_.reset(new DescriptorPool());
   factory_.reset(new DynamicMessageFactory(pool_.get()));
@@ -140,60 +154,102 @@ void ProtobufFactory::GetPythonDesc(const std::string& type,
 
 void ProtobufFactory::GetDescriptorString(const std::string& type,
                                           std::string* desc_str) {
-  auto desc = DescriptorPool::generated_pool()->FindMessageTypeByName(type);
-  if (desc != nullptr) {
-    return GetDescriptorString(desc, desc_str);
-  }
-
-  desc = pool_->FindMessageTypeByName(type);
-  if (desc == nullptr) {
+  auto info = GetMessageTypeInfo(type);
+  if (info == nullptr) {
     return;
   }
-  return GetDescriptorString(desc, desc_str);
+  *desc_str = info->desc_str;
 }
 
 // Internal method
 google::protobuf::Message* ProtobufFactory::GenerateMessageByType(
     const std::string& type) const {
-  google::protobuf::Message* message = GetMessageByGeneratedType(type);
-  if (message != nullptr) {
-    return message;
+  auto info = GetMessageTypeInfo(type);
+  if (info == nullptr) {
+    AERROR << "cannot find [" << type << "] prototype";
+    return nullptr;
   }
+  return info->New();
+}
 
-  const google::protobuf::Descriptor* descriptor =
-      pool_->FindMessageTypeByName(type);
-  if (descriptor == nullptr) {
-    AERROR << "cannot find [" << type << "] descriptor";
-    return nullptr;
+const MessageTypeInfo* ProtobufFactory::GetMessageTypeInfo(
+    const std::string& type) const {
+  {
+    ReadLockGuard<AtomicRWLock> lg(type_lock_);
+    auto it = type_infos_.find(type);
+    if (it != type_infos_.end()) {
+      return it->second.get();
+    }
   }
+  return BuildMessageTypeInfo(type);
+}
 
-  const google::protobuf::Message* prototype =
-      factory_->GetPrototype(descriptor);
+// Internal method
+const MessageTypeInfo* ProtobufFactory::BuildMessageTypeInfo(
+    const std::string& type) const {
+  // generated types win over dynamically registered ones of the same name.
+  const Descriptor* descriptor =
+      DescriptorPool::generated_pool()->FindMessageTypeByName(type);
+  const google::protobuf::Message* prototype = nullptr;
+  if (descriptor != nullptr) {
+    prototype = MessageFactory::generated_factory()->GetPrototype(descriptor);
+  } else {
+    descriptor = pool_->FindMessageTypeByName(type);
+    if (descriptor == nullptr) {
+      return nullptr;
+    }
+    prototype = factory_->GetPrototype(descriptor);
+  }
   if (prototype == nullptr) {
-    AERROR << "cannot find [" << type << "] prototype";
     return nullptr;
   }
 
-  return prototype->New();
+  std::unique_ptr<MessageTypeInfo> info(new MessageTypeInfo());
+  info->type_id = common::Hash(type);
+  info->type = type;
+  info->descriptor = descriptor;
+  info->prototype = prototype;
+  GetDescriptorString(descriptor, &info->desc_str);
+
+  WriteLockGuard<AtomicRWLock> lg(type_lock_);
+  auto& slot = type_infos_[type];
+  if (slot == nullptr) {
+    slot = std::move(info);
+  }
+  return slot.get();
 }
 
-google::protobuf::Message* ProtobufFactory::GetMessageByGeneratedType(
-    const std::string& type) const {
-  auto descriptor =
-      DescriptorPool::generated_pool()->FindMessageTypeByName(type);
-  if (descriptor == nullptr) {
-    // LOG_WARN << "cannot find [" << type << "] descriptor";
-    return nullptr;
+const MessageTypeInfo* ProtobufFactory::RegisterChannelType(
+    uint64_t channel_id, const std::string& type,
+    const std::string& proto_desc) {
+  {
+    ReadLockGuard<AtomicRWLock> lg(type_lock_);
+    auto it = channel_types_.find(channel_id);
+    if (it != channel_types_.end() && it->second->type == type) {
+      return it->second;
+    }
   }
 
-  auto prototype =
-      MessageFactory::generated_factory()->GetPrototype(descriptor);
-  if (prototype == nullptr) {
-    // AERROR << "cannot find [" << type << "] prototype";
-    return nullptr;
+  auto info = GetMessageTypeInfo(type);
+  if (info == nullptr) {
+    RegisterMessage(proto_desc);
+    info = GetMessageTypeInfo(type);
+    if (info == nullptr) {
+      AERROR << "cannot register [" << type << "] for channel " << channel_id;
+      return nullptr;
+    }
   }
 
-  return prototype->New();
+  WriteLockGuard<AtomicRWLock> lg(type_lock_);
+  channel_types_[channel_id] = info;
+  return info;
+}
+
+const MessageTypeInfo* ProtobufFactory::GetChannelType(
+    uint64_t channel_id) const {
+  ReadLockGuard<AtomicRWLock> lg(type_lock_);
+  auto it = channel_types_.find(channel_id);
+  return it == channel_types_.end() ? nullptr : it->second;
 }
 
 const Descriptor* ProtobufFactory::FindMessageTypeByName(
@@ -21,7 +21,9 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
+#include "cyber/base/atomic_rw_lock.h"
 #include "cyber/common/macros.h"
 #include "cyber/proto/proto_desc.pb.h"
 #include "google/protobuf/compiler/parser.h"
@@ -52,6 +54,21 @@ class ErrorCollector : public google::protobuf::DescriptorPool::ErrorCollector {
                   ErrorLocation location, const std::string& message) override;
 };
 
+// Everything needed to build and parse one message type without going back to
+// the descriptor pool. Entries are interned by the factory and live as long as
+// the process, so callers may keep the pointer.
+struct MessageTypeInfo {
+  uint64_t type_id = 0;
+  std::string type;
+  const Descriptor* descriptor = nullptr;
+  const google::protobuf::Message* prototype = nullptr;
+  std::string desc_str;
+
+  google::protobuf::Message* New() const { return prototype->New(); }
+  // Returns nullptr if content is not a valid serialization of the type.
+  google::protobuf::Message* Parse(const std::string& content) const;
+};
+
 class ProtobufFactory {
  public:
   ~ProtobufFactory();
@@ -94,14 +111,30 @@ class ProtobufFactory {
 
   void GetPythonDesc(const std::string& type, std::string* desc_str);
 
+  // Interned lookup by type name. Returns nullptr if the type is unknown;
+  // misses are not cached so a later RegisterMessage is still picked up.
+  const MessageTypeInfo* GetMessageTypeInfo(const std::string& type) const;
+
+  // Bind a channel to its type, registering proto_desc the first time the
+  // channel is seen. Replaying many records of the same channels only pays
+  // for the descriptor parse once.
+  const MessageTypeInfo* RegisterChannelType(uint64_t channel_id,
+                                             const std::string& type,
+                                             const std::string& proto_desc);
+  const MessageTypeInfo* GetChannelType(uint64_t channel_id) const;
+
  private:
   bool RegisterMessage(const ProtoDesc& proto_desc);
-  google::protobuf::Message* GetMessageByGeneratedType(
-      const std::string& type) const;
   static bool GetProtoDesc(const FileDescriptor* file_desc,
                            ProtoDesc* proto_desc);
 
+  const MessageTypeInfo* BuildMessageTypeInfo(const std::string& type) const;
+
   std::mutex register_mutex_;
+  mutable base::AtomicRWLock type_lock_;
+  mutable std::unordered_map<std::string, std::unique_ptr<MessageTypeInfo>>
+      type_infos_;
+  std::unordered_map<uint64_t, const MessageTypeInfo*> channel_types_;
   std::unique_ptr<DescriptorPool> pool_ = nullptr;
   std::unique_ptr<DynamicMessageFactory> factory_ = nullptr;
 
@@ -17,6 +17,7 @@
 #include "cyber/message/protobuf_factory.h"
 
 #include <gtest/gtest.h>
+#include <memory>
 #include <string>
 
 #include "cyber/proto/unit_test.pb.h"
@@ -76,6 +77,71 @@ TEST(ProtobufFactory, register_and_generate) {
   EXPECT_NE(nullptr, desc_ptr);
 }
 
+TEST(ProtobufFactory, type_info) {
+  auto factory = ProtobufFactory::Instance();
+  EXPECT_EQ(nullptr, factory->GetMessageTypeInfo("test.not.found"));
+
+  auto info = factory->GetMessageTypeInfo("apollo.cyber.proto.UnitTest");
+  ASSERT_NE(nullptr, info);
+  EXPECT_EQ(info, factory->GetMessageTypeInfo("apollo.cyber.proto.UnitTest"));
+  EXPECT_EQ(proto::UnitTest::descriptor(), info->descriptor);
+
+  std::string desc_str;
+  ProtobufFactory::GetDescriptorString(proto::UnitTest::descriptor(),
+                                       &desc_str);
+  EXPECT_EQ(desc_str, info->desc_str);
+
+  proto::UnitTest ut;
+  ut.set_class_name("type_info");
+  std::string content;
+  ut.SerializeToString(&content);
+  std::unique_ptr<google::protobuf::Message> parsed(info->Parse(content));
+  ASSERT_NE(nullptr, parsed);
+  EXPECT_EQ(ut.DebugString(), parsed->DebugString());
+}
+
+TEST(ProtobufFactory, channel_type) {
+  auto factory = ProtobufFactory::Instance();
+
+  FileDescriptorProto file_desc_proto;
+  file_desc_proto.set_name("channel_type_test.proto");
+  file_desc_proto.set_package("apollo.cyber.test");
+  auto msg = file_desc_proto.add_message_type();
+  msg->set_name("Dynamic");
+  auto field = msg->add_field();
+  field->set_name("value");
+  field->set_number(1);
+  field->set_type(google::protobuf::FieldDescriptorProto::TYPE_INT32);
+  field->set_label(google::protobuf::FieldDescriptorProto::LABEL_OPTIONAL);
+  ProtoDesc proto_desc;
+  file_desc_proto.SerializeToString(proto_desc.mutable_desc());
+  std::string proto_desc_str;
+  proto_desc.SerializeToString(&proto_desc_str);
+
+  const uint64_t channel_id = 42;
+  EXPECT_EQ(nullptr, factory->GetChannelType(channel_id));
+  EXPECT_EQ(nullptr,
+            factory->RegisterChannelType(channel_id, "test.not.found", ""));
+
+  auto info = factory->RegisterChannelType(
+      channel_id, "apollo.cyber.test.Dynamic", proto_desc_str);
+  ASSERT_NE(nullptr, info);
+  EXPECT_EQ(info, factory->GetChannelType(channel_id));
+  // a second record of the same channel does not need the descriptors again.
+  EXPECT_EQ(info, factory->RegisterChannelType(
+                      channel_id, "apollo.cyber.test.Dynamic", ""));
+  EXPECT_EQ(nullptr, factory->GetChannelType(channel_id + 1));
+
+  std::unique_ptr<google::protobuf::Message> message(info->New());
+  auto value = info->descriptor->FindFieldByName("value");
+  message->GetReflection()->SetInt32(message.get(), value, 7);
+  std::string content;
+  message->SerializeToString(&content);
+  std::unique_ptr<google::protobuf::Message> parsed(info->Parse(content));
+  ASSERT_NE(nullptr, parsed);
+  EXPECT_EQ(7, parsed->GetReflection()->GetInt32(*parsed, value));
+}
+
 }  // namespace message
 }  // namespace cyber
 }  // namespace apollo
@@ -69,6 +69,35 @@ bool RegisterMessage(const MessageT& message) {
   return ProtobufFactory::Instance()->RegisterMessage(message);
 }
 
+// Reads the conventional `header.timestamp_sec` field through reflection, so
+// cyber does not depend on the header proto of the modules.
+template <typename MessageT,
+          typename std::enable_if<
+              std::is_base_of<google::protobuf::Message, MessageT>::value,
+              int>::type = 0>
+bool GetHeaderTimestamp(const MessageT& message, double* timestamp_sec) {
+  using google::protobuf::FieldDescriptor;
+  static const FieldDescriptor* header_field =
+      MessageT::descriptor()->FindFieldByName("header");
+  static const FieldDescriptor* timestamp_field =
+      header_field != nullptr &&
+              header_field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+              !header_field->is_repeated()
+          ? header_field->message_type()->FindFieldByName("timestamp_sec")
+          : nullptr;
+  if (timestamp_field == nullptr || timestamp_field->is_repeated() ||
+      timestamp_field->cpp_type() != FieldDescriptor::CPPTYPE_DOUBLE) {
+    return false;
+  }
+  auto reflection = message.GetReflection();
+  if (!reflection->HasField(message, header_field)) {
+    return false;
+  }
+  const auto& header = reflection->GetMessage(message, header_field);
+  *timestamp_sec = header.GetReflection()->GetDouble(header, timestamp_field);
+  return true;
+}
+
 }  // namespace message
 }  // namespace cyber
 }  // namespace apollo
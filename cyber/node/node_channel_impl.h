@@ -43,15 +43,23 @@ struct ReaderConfig {
     qos_profile.set_durability(proto::QosDurabilityPolicy::DURABILITY_VOLATILE);
 
     pending_queue_size = DEFAULT_PENDING_QUEUE_SIZE;
+    arena_parse = false;
   }
   ReaderConfig(const ReaderConfig& other)
       : channel_name(other.channel_name),
         qos_profile(other.qos_profile),
-        pending_queue_size(other.pending_queue_size) {}
+        pending_queue_size(other.pending_queue_size),
+        arena_parse(other.arena_parse) {}
 
   std::string channel_name;
   proto::QosProfile qos_profile;
   uint32_t pending_queue_size;
+  /**
+   * @brief Decode received messages into recycled protobuf arenas instead of
+   * the heap. Channel readers in one process share a receiver, so the first
+   * reader created on a channel decides.
+   */
+  bool arena_parse;
 };
 
 class NodeChannelImpl {
@@ -170,6 +178,7 @@ auto NodeChannelImpl::CreateReader(const ReaderConfig& config,
   proto::RoleAttributes role_attr;
   role_attr.set_channel_name(config.channel_name);
   role_attr.mutable_qos_profile()->CopyFrom(config.qos_profile);
+  role_attr.set_arena_parse(config.arena_parse);
   return this->template CreateReader<MessageT>(role_attr, reader_func,
                                                config.pending_queue_size);
 }
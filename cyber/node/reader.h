@@ -30,6 +30,7 @@
 #include "cyber/common/global_data.h"
 #include "cyber/croutine/routine_factory.h"
 #include "cyber/data/data_visitor.h"
+#include "cyber/event/channel_tracer.h"
 #include "cyber/node/reader_base.h"
 #include "cyber/proto/topology_change.pb.h"
 #include "cyber/scheduler/scheduler_factory.h"
@@ -143,6 +144,15 @@ bool Reader<MessageT>::Init() {
   } else {
     func = [this](const std::shared_ptr<MessageT>& msg) { this->Enqueue(msg); };
   }
+  auto tracer = event::ChannelTracer::Instance();
+  if (tracer->enabled()) {
+    uint64_t channel_id = role_attr_.channel_id();
+    tracer->RegisterChannel(channel_id, role_attr_.channel_name());
+    func = [channel_id, func](const std::shared_ptr<MessageT>& msg) {
+      event::ChannelTracer::CallbackScope scope(channel_id, msg.get());
+      func(msg);
+    };
+  }
   auto sched = scheduler::Instance();
   croutine_name_ = role_attr_.node_name() + "_" + role_attr_.channel_name();
   auto dv = std::make_shared<data::DataVisitor<MessageT>>(
@@ -25,6 +25,7 @@
 
 #include "cyber/common/macros.h"
 #include "cyber/common/util.h"
+#include "cyber/event/channel_tracer.h"
 #include "cyber/event/perf_event_cache.h"
 #include "cyber/transport/transport.h"
 
@@ -109,6 +110,8 @@ auto ReceiverManager<MessageT>::GetReceiver(
               PerfEventCache::Instance()->AddTransportEvent(
                   TransPerf::TRANS_TO, reader_attr.channel_id(),
                   msg_info.seq_num());
+              event::ChannelTracer::Instance()->OnDispatch(
+                  reader_attr.channel_id(), msg.get(), msg_info);
               data::DataDispatcher<MessageT>::Instance()->Dispatch(
                   reader_attr.channel_id(), msg);
               PerfEventCache::Instance()->AddTransportEvent(
@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "cyber/common/log.h"
@@ -46,6 +47,14 @@ class Writer : public WriterBase {
   virtual bool Write(const MessageT& msg);
   virtual bool Write(const std::shared_ptr<MessageT>& msg_ptr);
 
+  /**
+   * @brief Borrow a message constructed directly in shared memory. Only
+   * trivially copyable message types can be loaned; the returned loan is
+   * invalid when the channel has no shm transport.
+   */
+  transport::LoanedMessage<MessageT> Loan();
+  bool Write(transport::LoanedMessage<MessageT>&& loaned);
+
   bool HasReader() override;
   void GetReaders(std::vector<proto::RoleAttributes>* readers) override;
 
@@ -112,6 +121,23 @@ bool Writer<MessageT>::Write(const std::shared_ptr<MessageT>& msg_ptr) {
   return transmitter_->Transmit(msg_ptr);
 }
 
+template <typename MessageT>
+transport::LoanedMessage<MessageT> Writer<MessageT>::Loan() {
+  static_assert(message::IsLoanable<MessageT>::value,
+                "only trivially copyable messages can be loaned");
+  transport::LoanedMessage<MessageT> loaned;
+  RETURN_VAL_IF(!WriterBase::IsInit(), loaned);
+  transmitter_->Loan(&loaned);
+  return loaned;
+}
+
+template <typename MessageT>
+bool Writer<MessageT>::Write(transport::LoanedMessage<MessageT>&& loaned) {
+  RETURN_VAL_IF(!WriterBase::IsInit(), false);
+  transport::LoanedMessage<MessageT> published(std::move(loaned));
+  return transmitter_->Transmit(&published);
+}
+
 template <typename MessageT>
 void Writer<MessageT>::JoinTheTopology() {
   // add listener
@@ -15,6 +15,7 @@
  *****************************************************************************/
 
 #include "cyber/parameter/parameter_client.h"
+#include "cyber/base/rw_lock_guard.h"
 #include "cyber/node/node.h"
 #include "cyber/parameter/parameter_service_names.h"
 
@@ -23,7 +24,7 @@ namespace cyber {
 
 ParameterClient::ParameterClient(const std::shared_ptr<Node>& node,
                                  const std::string& service_node_name)
-    : node_(node) {
+    : node_(node), service_node_name_(service_node_name) {
   get_parameter_client_ = node_->CreateClient<ParamName, Param>(
       FixParameterServiceName(service_node_name, GET_PARAMETER_SERVICE_NAME));
 
@@ -32,10 +33,111 @@ ParameterClient::ParameterClient(const std::shared_ptr<Node>& node,
 
   list_parameters_client_ = node_->CreateClient<NodeName, Params>(
       FixParameterServiceName(service_node_name, LIST_PARAMETERS_SERVICE_NAME));
+
+  get_parameters_client_ = node_->CreateClient<ParamNames, Params>(
+      FixParameterServiceName(service_node_name, GET_PARAMETERS_SERVICE_NAME));
+}
+
+ParameterClient::~ParameterClient() {
+  // the node keeps its readers, stop the callbacks into this client
+  std::lock_guard<std::mutex> lock(subscribe_mutex_);
+  if (parameter_events_reader_ != nullptr) {
+    parameter_events_reader_->Shutdown();
+  }
+}
+
+bool ParameterClient::EnableCache() {
+  if (cache_enabled_) {
+    return true;
+  }
+  if (!Subscribe()) {
+    return false;
+  }
+  auto request = std::make_shared<NodeName>();
+  request->set_value(node_->Name());
+  auto response = list_parameters_client_->SendRequest(request);
+  if (response == nullptr) {
+    AERROR << "Call " << list_parameters_client_->ServiceName() << " failed";
+    return false;
+  }
+  for (auto& param : response->param()) {
+    UpdateCache(param, false);
+  }
+  cache_enabled_ = true;
+  return true;
+}
+
+bool ParameterClient::AddChangeCallback(const ChangeCallback& callback) {
+  if (!Subscribe()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(subscribe_mutex_);
+  change_callbacks_.emplace_back(callback);
+  return true;
+}
+
+bool ParameterClient::Subscribe() {
+  std::lock_guard<std::mutex> lock(subscribe_mutex_);
+  if (parameter_events_reader_ != nullptr) {
+    return true;
+  }
+  auto channel_name = FixParameterServiceName(service_node_name_,
+                                              PARAMETER_EVENTS_CHANNEL_NAME);
+  parameter_events_reader_ = node_->CreateReader<Params>(
+      channel_name, [this](const std::shared_ptr<Params>& params) {
+        OnParameterEvents(params);
+      });
+  if (parameter_events_reader_ == nullptr) {
+    AERROR << "Failed to read the parameter events on " << channel_name;
+    return false;
+  }
+  return true;
+}
+
+void ParameterClient::OnParameterEvents(const std::shared_ptr<Params>& params) {
+  for (auto& param : params->param()) {
+    UpdateCache(param, true);
+  }
+  std::vector<ChangeCallback> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(subscribe_mutex_);
+    callbacks = change_callbacks_;
+  }
+  for (auto& param : params->param()) {
+    Parameter parameter;
+    parameter.FromProtoParam(param);
+    for (auto& callback : callbacks) {
+      callback(parameter);
+    }
+  }
+}
+
+void ParameterClient::UpdateCache(const Param& param, bool overwrite) {
+  base::WriteLockGuard<base::AtomicRWLock> lock(cache_lock_);
+  if (overwrite) {
+    cache_[param.name()] = param;
+  } else {
+    // a change received meanwhile is newer than a fetched value
+    cache_.emplace(param.name(), param);
+  }
+}
+
+bool ParameterClient::GetCachedParameter(const std::string& param_name,
+                                         Parameter* parameter) {
+  base::ReadLockGuard<base::AtomicRWLock> lock(cache_lock_);
+  auto ite = cache_.find(param_name);
+  if (ite == cache_.end()) {
+    return false;
+  }
+  parameter->FromProtoParam(ite->second);
+  return true;
 }
 
 bool ParameterClient::GetParameter(const std::string& param_name,
                                    Parameter* parameter) {
+  if (cache_enabled_ && GetCachedParameter(param_name, parameter)) {
+    return true;
+  }
   auto request = std::make_shared<ParamName>();
   request->set_value(param_name);
   auto response = get_parameter_client_->SendRequest(request);
@@ -47,10 +149,43 @@ bool ParameterClient::GetParameter(const std::string& param_name,
     AWARN << "Parameter " << param_name << " not exists yet.";
     return false;
   }
+  if (cache_enabled_) {
+    UpdateCache(*response, false);
+  }
   parameter->FromProtoParam(*response);
   return true;
 }
 
+bool ParameterClient::GetParameters(const std::vector<std::string>& param_names,
+                                    std::vector<Parameter>* parameters) {
+  auto request = std::make_shared<ParamNames>();
+  for (auto& param_name : param_names) {
+    Parameter parameter;
+    if (cache_enabled_ && GetCachedParameter(param_name, &parameter)) {
+      parameters->emplace_back(parameter);
+    } else {
+      request->add_value(param_name);
+    }
+  }
+  if (request->value_size() == 0) {
+    return true;
+  }
+  auto response = get_parameters_client_->SendRequest(request);
+  if (response == nullptr) {
+    AERROR << "Call " << get_parameters_client_->ServiceName() << " failed";
+    return false;
+  }
+  for (auto& param : response->param()) {
+    if (cache_enabled_) {
+      UpdateCache(param, false);
+    }
+    Parameter parameter;
+    parameter.FromProtoParam(param);
+    parameters->emplace_back(parameter);
+  }
+  return true;
+}
+
 bool ParameterClient::SetParameter(const Parameter& parameter) {
   auto request = std::make_shared<Param>(parameter.ToProtoParam());
   auto response = set_parameter_client_->SendRequest(request);
@@ -58,6 +193,9 @@ bool ParameterClient::SetParameter(const Parameter& parameter) {
     AERROR << "Call " << set_parameter_client_->ServiceName() << " failed";
     return false;
   }
+  if (response->value() && cache_enabled_) {
+    UpdateCache(*request, true);
+  }
   return response->value();
 }
 
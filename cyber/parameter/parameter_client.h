@@ -17,10 +17,16 @@
 #ifndef CYBER_PARAMETER_PARAMETER_CLIENT_H_
 #define CYBER_PARAMETER_PARAMETER_CLIENT_H_
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "cyber/base/atomic_rw_lock.h"
+#include "cyber/node/reader.h"
 #include "cyber/parameter/parameter.h"
 #include "cyber/proto/parameter.pb.h"
 #include "cyber/service/client.h"
@@ -35,11 +41,14 @@ class ParameterClient {
   using Param = apollo::cyber::proto::Param;
   using NodeName = apollo::cyber::proto::NodeName;
   using ParamName = apollo::cyber::proto::ParamName;
+  using ParamNames = apollo::cyber::proto::ParamNames;
   using BoolResult = apollo::cyber::proto::BoolResult;
   using Params = apollo::cyber::proto::Params;
   using GetParameterClient = Client<ParamName, Param>;
   using SetParameterClient = Client<Param, BoolResult>;
   using ListParametersClient = Client<NodeName, Params>;
+  using GetParametersClient = Client<ParamNames, Params>;
+  using ChangeCallback = std::function<void(const Parameter&)>;
   /**
    * @brief Construct a new ParameterClient object
    *
@@ -49,6 +58,32 @@ class ParameterClient {
   ParameterClient(const std::shared_ptr<Node>& node,
                   const std::string& service_node_name);
 
+  ~ParameterClient();
+
+  /**
+   * @brief Keep a local copy of the parameters of the service node
+   *
+   * All the parameters are fetched at once, then the changes written by
+   * the server are followed. GetParameter and GetParameters are answered
+   * from the copy afterwards and only ask the server for the parameters
+   * not known yet.
+   *
+   * @return true
+   * @return false call service fail or timeout
+   */
+  bool EnableCache();
+
+  /**
+   * @brief Register a callback run on every change of a parameter of the
+   * service node, in the reader of its parameter events
+   *
+   * @param callback the function called with the new value
+   * @return true
+   * @return false the reader of the parameter events can not be created,
+   *               a node reads the events of a server only once
+   */
+  bool AddChangeCallback(const ChangeCallback& callback);
+
   /**
    * @brief Get the Parameter object
    *
@@ -59,6 +94,17 @@ class ParameterClient {
    */
   bool GetParameter(const std::string& param_name, Parameter* parameter);
 
+  /**
+   * @brief Get several Parameter objects in a single call
+   *
+   * @param param_names names of the parameters
+   * @param parameters pointer of vector to store the existing ones
+   * @return true
+   * @return false call service fail or timeout
+   */
+  bool GetParameters(const std::vector<std::string>& param_names,
+                     std::vector<Parameter>* parameters);
+
   /**
    * @brief Set the Parameter object
    *
@@ -80,10 +126,26 @@ class ParameterClient {
   bool ListParameters(std::vector<Parameter>* parameters);
 
  private:
+  bool Subscribe();
+  void OnParameterEvents(const std::shared_ptr<Params>& params);
+  void UpdateCache(const Param& param, bool overwrite);
+  bool GetCachedParameter(const std::string& param_name,
+                          Parameter* parameter);
+
   std::shared_ptr<Node> node_;
+  std::string service_node_name_;
   std::shared_ptr<GetParameterClient> get_parameter_client_;
   std::shared_ptr<SetParameterClient> set_parameter_client_;
   std::shared_ptr<ListParametersClient> list_parameters_client_;
+  std::shared_ptr<GetParametersClient> get_parameters_client_;
+
+  std::mutex subscribe_mutex_;
+  std::shared_ptr<Reader<Params>> parameter_events_reader_;
+  std::vector<ChangeCallback> change_callbacks_;
+
+  std::atomic<bool> cache_enabled_ = {false};
+  base::AtomicRWLock cache_lock_;
+  std::unordered_map<std::string, Param> cache_;
 };
 
 }  // namespace cyber
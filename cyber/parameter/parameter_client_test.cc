@@ -17,7 +17,9 @@
 #include "cyber/parameter/parameter_client.h"
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "cyber/cyber.h"
@@ -88,6 +90,43 @@ TEST_F(ParameterClientTest, list_parameter) {
   EXPECT_FALSE(pc_->ListParameters(&parameters));
 }
 
+TEST_F(ParameterClientTest, get_parameters) {
+  ps_->SetParameter(Parameter("int", 1));
+  ps_->SetParameter(Parameter("string", "test"));
+  std::vector<Parameter> parameters;
+  EXPECT_TRUE(pc_->GetParameters({"int", "double", "string"}, &parameters));
+  EXPECT_EQ(2, parameters.size());
+
+  ps_.reset();
+  EXPECT_FALSE(pc_->GetParameters({"int"}, &parameters));
+}
+
+TEST_F(ParameterClientTest, cached_parameter) {
+  ps_->SetParameter(Parameter("int", 1));
+  std::atomic<int> changes = {0};
+  EXPECT_TRUE(pc_->AddChangeCallback([&changes](const Parameter& parameter) {
+    if (parameter.Name() == "int") {
+      ++changes;
+    }
+  }));
+  EXPECT_TRUE(pc_->EnableCache());
+  usleep(100000);
+
+  ps_->SetParameter(Parameter("int", 2));
+  usleep(100000);
+  EXPECT_EQ(1, changes);
+
+  // answered from the cache once the server is gone
+  ps_.reset();
+  Parameter parameter;
+  EXPECT_TRUE(pc_->GetParameter("int", &parameter));
+  EXPECT_EQ(2, parameter.AsInt64());
+  std::vector<Parameter> parameters;
+  EXPECT_TRUE(pc_->GetParameters({"int"}, &parameters));
+  EXPECT_EQ(1, parameters.size());
+  EXPECT_FALSE(pc_->GetParameter("double", &parameter));
+}
+
 }  // namespace cyber
 }  // namespace apollo
 
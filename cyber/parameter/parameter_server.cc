@@ -40,8 +40,11 @@ ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
       FixParameterServiceName(name, SET_PARAMETER_SERVICE_NAME),
       [this](const std::shared_ptr<Param>& request,
              std::shared_ptr<BoolResult>& response) {
-        std::lock_guard<std::mutex> lock(param_map_mutex_);
-        param_map_[request->name()] = *request;
+        {
+          std::lock_guard<std::mutex> lock(param_map_mutex_);
+          param_map_[request->name()] = *request;
+        }
+        PublishChange(*request);
         response->set_value(true);
       });
 
@@ -55,11 +58,40 @@ ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
           param->CopyFrom(item.second);
         }
       });
+
+  get_parameters_service_ = node_->CreateService<ParamNames, Params>(
+      FixParameterServiceName(name, GET_PARAMETERS_SERVICE_NAME),
+      [this](const std::shared_ptr<ParamNames>& request,
+             std::shared_ptr<Params>& response) {
+        std::lock_guard<std::mutex> lock(param_map_mutex_);
+        for (auto& param_name : request->value()) {
+          auto ite = param_map_.find(param_name);
+          if (ite != param_map_.end()) {
+            response->add_param()->CopyFrom(ite->second);
+          }
+        }
+      });
+
+  parameter_events_writer_ = node_->CreateWriter<Params>(
+      FixParameterServiceName(name, PARAMETER_EVENTS_CHANNEL_NAME));
 }
 
 void ParameterServer::SetParameter(const Parameter& parameter) {
-  std::lock_guard<std::mutex> lock(param_map_mutex_);
-  param_map_[parameter.Name()] = parameter.ToProtoParam();
+  Param param = parameter.ToProtoParam();
+  {
+    std::lock_guard<std::mutex> lock(param_map_mutex_);
+    param_map_[parameter.Name()] = param;
+  }
+  PublishChange(param);
+}
+
+void ParameterServer::PublishChange(const Param& param) {
+  if (parameter_events_writer_ == nullptr) {
+    return;
+  }
+  auto params = std::make_shared<Params>();
+  params->add_param()->CopyFrom(param);
+  parameter_events_writer_->Write(params);
 }
 
 bool ParameterServer::GetParameter(const std::string& parameter_name,
@@ -22,6 +22,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "cyber/node/writer.h"
 #include "cyber/parameter/parameter.h"
 #include "cyber/proto/parameter.pb.h"
 #include "cyber/service/service.h"
@@ -36,12 +37,16 @@ class ParameterServer {
   using Param = apollo::cyber::proto::Param;
   using NodeName = apollo::cyber::proto::NodeName;
   using ParamName = apollo::cyber::proto::ParamName;
+  using ParamNames = apollo::cyber::proto::ParamNames;
   using BoolResult = apollo::cyber::proto::BoolResult;
   using Params = apollo::cyber::proto::Params;
   /**
    * @brief Construct a new ParameterServer object
    *
    * @param node shared_ptr of the node handler
+   *
+   * Besides the services, every changed parameter is written to the
+   * parameter_events channel of the node, so clients can cache them.
    */
   explicit ParameterServer(const std::shared_ptr<Node>& node);
 
@@ -70,10 +75,14 @@ class ParameterServer {
   void ListParameters(std::vector<Parameter>* parameters);
 
  private:
+  void PublishChange(const Param& param);
+
   std::shared_ptr<Node> node_;
   std::shared_ptr<Service<ParamName, Param>> get_parameter_service_;
   std::shared_ptr<Service<Param, BoolResult>> set_parameter_service_;
   std::shared_ptr<Service<NodeName, Params>> list_parameters_service_;
+  std::shared_ptr<Service<ParamNames, Params>> get_parameters_service_;
+  std::shared_ptr<Writer<Params>> parameter_events_writer_;
 
   std::mutex param_map_mutex_;
   std::unordered_map<std::string, Param> param_map_;
@@ -15,6 +15,7 @@
  *****************************************************************************/
 
 #include <Python.h>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -163,6 +164,73 @@ PyObject *cyber_PyReader_read(PyObject *self, PyObject *args) {
   return PyString_FromStringAndSize(reader_ret.c_str(), reader_ret.size());
 }
 
+static void cyber_delete_PyMessage(PyObject *capsule) {
+  delete reinterpret_cast<
+      std::shared_ptr<const apollo::cyber::message::PyMessageWrap> *>(
+      PyCapsule_GetPointer(capsule, "apollo_cyber_pymessage"));
+}
+
+// Returns a read-only memoryview over the received message, or None when no
+// message is cached. The view owns a reference to the message, which is freed
+// once the view and every slice taken from it are gone.
+PyObject *cyber_PyReader_read_buffer(PyObject *self, PyObject *args) {
+  PyObject *pyobj_reader = nullptr;
+  PyObject *pyobj_iswait = nullptr;
+
+  if (!PyArg_ParseTuple(args, const_cast<char *>("OO:PyReader_read_buffer"),
+                        &pyobj_reader, &pyobj_iswait)) {
+    AINFO << "cyber_PyReader_read_buffer:PyArg_ParseTuple failed!";
+    Py_RETURN_NONE;
+  }
+  apollo::cyber::PyReader *reader = PyObjectToPtr<apollo::cyber::PyReader *>(
+      pyobj_reader, "apollo_cyber_pyreader");
+  if (nullptr == reader) {
+    AINFO << "cyber_PyReader_read_buffer:PyReader ptr is null!";
+    Py_RETURN_NONE;
+  }
+
+  int r = PyObject_IsTrue(pyobj_iswait);
+  if (r == -1) {
+    AINFO << "cyber_PyReader_read_buffer:pyobj_iswait is error!";
+    Py_RETURN_NONE;
+  }
+
+  std::shared_ptr<const apollo::cyber::message::PyMessageWrap> message;
+  // waiting must not hold the GIL, the reader callback needs it to notify.
+  Py_BEGIN_ALLOW_THREADS
+  message = reader->read_message(r == 1);
+  Py_END_ALLOW_THREADS
+  if (message == nullptr) {
+    Py_RETURN_NONE;
+  }
+
+  const std::string &data = message->data();
+  auto holder =
+      new std::shared_ptr<const apollo::cyber::message::PyMessageWrap>(
+          std::move(message));
+  PyObject *owner =
+      PyCapsule_New(holder, "apollo_cyber_pymessage", cyber_delete_PyMessage);
+  if (owner == nullptr) {
+    delete holder;
+    return nullptr;
+  }
+
+  Py_buffer view;
+  if (PyBuffer_FillInfo(&view, owner, const_cast<char *>(data.data()),
+                        static_cast<Py_ssize_t>(data.size()), 1,
+                        PyBUF_CONTIG_RO) != 0) {
+    Py_DECREF(owner);
+    return nullptr;
+  }
+  // the view took its own reference to owner.
+  Py_DECREF(owner);
+  PyObject *pyobj_view = PyMemoryView_FromBuffer(&view);
+  if (pyobj_view == nullptr) {
+    PyBuffer_Release(&view);
+  }
+  return pyobj_view;
+}
+
 PyObject *cyber_PyReader_register_func(PyObject *self, PyObject *args) {
   PyObject *pyobj_regist_fun = 0;
   PyObject *pyobj_reader = 0;
@@ -611,6 +679,7 @@ static PyMethodDef _cyber_node_methods[] = {
     {"delete_PyReader", cyber_delete_PyReader, METH_VARARGS, ""},
     {"PyReader_register_func", cyber_PyReader_register_func, METH_VARARGS, ""},
     {"PyReader_read", cyber_PyReader_read, METH_VARARGS, ""},
+    {"PyReader_read_buffer", cyber_PyReader_read_buffer, METH_VARARGS, ""},
 
     // PyClient fun
     {"new_PyClient", cyber_new_PyClient, METH_VARARGS, ""},
@@ -107,6 +107,50 @@ class Reader(object):
         self.data_type = data_type
 
 
+class MessageBuffer(object):
+    """
+    Received message mapped without copying.
+
+    data is a read-only memoryview over the buffer cyber received. The
+    buffer stays valid until release() is called, or the MessageBuffer
+    leaves a with block. Views sliced from data keep the buffer alive on
+    their own, so drop them too if the memory should go back right away.
+    """
+
+    def __init__(self, view):
+        self._view = view
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.release()
+
+    def __len__(self):
+        return len(self.data)
+
+    @property
+    def data(self):
+        """
+        memoryview of the serialized message
+        """
+        if self._view is None:
+            raise ValueError("operation on a released message buffer")
+        return self._view
+
+    def tobytes(self):
+        """
+        copy the serialized message out of the buffer
+        """
+        return self.data.tobytes()
+
+    def release(self):
+        """
+        give the buffer back to cyber
+        """
+        self._view = None
+
+
 class Client(object):
     """
     Class for cyber service client wrapper.
@@ -186,6 +230,14 @@ class Node(object):
         reader callback
         """
         sub = self.subs[name]
+        if sub[5]:
+            view = _CYBER_NODE.PyReader_read_buffer(sub[0], False)
+            if view is not None:
+                if sub[2] is None:
+                    sub[1](MessageBuffer(view))
+                else:
+                    sub[1](MessageBuffer(view), sub[2])
+            return 0
         msg_str = _CYBER_NODE.PyReader_read(sub[0], False)
         if len(msg_str) > 0:
             proto = sub[3]()
@@ -209,6 +261,26 @@ class Node(object):
                    i.e. fn(data, args)
         @args any: additional arguments to pass to the callback
         """
+        return self._create_reader(name, data_type, callback, args, False)
+
+    def create_buffer_reader(self, name, data_type, callback, args=None):
+        """
+        create a topic reader that hands out received messages as
+        MessageBuffer instead of parsed protos, skipping the copies into
+        python strings. Meant for large messages such as point clouds and
+        images.
+        @param self
+        @param name str: topic name
+        @param data_type proto: message class of the topic
+        @callback fn: function to call (fn(buffer)) when data is
+                   received, with the same args convention as
+                   create_reader. The callback owns the buffer and
+                   should release() it once done.
+        @args any: additional arguments to pass to the callback
+        """
+        return self._create_reader(name, data_type, callback, args, True)
+
+    def _create_reader(self, name, data_type, callback, args, zero_copy):
         self.mutex.acquire()
         if name in self.subs.keys():
             self.mutex.release()
@@ -221,7 +293,7 @@ class Node(object):
         if reader is None:
             return None
         self.list_reader.append(reader)
-        sub = (reader, callback, args, data_type, False)
+        sub = (reader, callback, args, data_type, False, zero_copy)
 
         self.mutex.acquire()
         self.subs[name] = sub
@@ -249,6 +321,14 @@ class Node(object):
         """
         self.mutex.acquire()
         for _, item in self.subs.items():
+            if item[5]:
+                view = _CYBER_NODE.PyReader_read_buffer(item[0], False)
+                if view is not None:
+                    if item[2] is None:
+                        item[1](MessageBuffer(view))
+                    else:
+                        item[1](MessageBuffer(view), item[2])
+                continue
             msg_str = _CYBER_NODE.PyReader_read(item[0], False)
             if len(msg_str) > 0:
                 if item[4]:
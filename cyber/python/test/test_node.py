@@ -72,5 +72,25 @@ class TestNode(unittest.TestCase):
         self.assertEqual(SimpleMessage.DESCRIPTOR.full_name,
                 "apollo.common.util.test.SimpleMessage")
 
+    def test_buffer_reader(self):
+        """
+        unit test of zero copy reader.
+        """
+        self.assertTrue(cyber.ok())
+        test_node = cyber.Node("buffer_listener")
+        reader = test_node.create_buffer_reader("channel/chatter",
+                SimpleMessage, callback)
+        self.assertEqual(reader.name, "channel/chatter")
+        self.assertEqual(reader.data_type, SimpleMessage)
+
+        msg = SimpleMessage()
+        msg.text = "talker:send Alex!"
+        buf = cyber.MessageBuffer(memoryview(msg.SerializeToString()))
+        with buf:
+            parsed = SimpleMessage()
+            parsed.ParseFromString(buf.tobytes())
+            self.assertEqual(parsed.text, msg.text)
+        self.assertRaises(ValueError, lambda: buf.data)
+
 if __name__ == '__main__':
     unittest.main()
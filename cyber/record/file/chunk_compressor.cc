@@ -0,0 +1,179 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/record/file/chunk_compressor.h"
+
+#include <bzlib.h>
+#include <lz4.h>
+#include <zstd.h>
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+using proto::CompressType;
+
+namespace {
+
+const size_t kSizePrefix = sizeof(uint64_t);
+const int kZstdLevel = 3;
+const int kBz2BlockSize = 9;
+
+void PutSize(uint64_t size, char* dst) {
+  for (size_t i = 0; i < kSizePrefix; ++i) {
+    dst[i] = static_cast<char>((size >> (8 * i)) & 0xFF);
+  }
+}
+
+uint64_t GetSize(const char* src) {
+  uint64_t size = 0;
+  for (size_t i = 0; i < kSizePrefix; ++i) {
+    size |= static_cast<uint64_t>(static_cast<unsigned char>(src[i]))
+            << (8 * i);
+  }
+  return size;
+}
+
+}  // namespace
+
+bool CompressChunk(CompressType type, const std::string& raw,
+                   std::string* compressed) {
+  if (raw.size() > INT_MAX) {
+    AERROR << "Chunk is too large to compress, size: " << raw.size();
+    return false;
+  }
+  size_t bound = 0;
+  switch (type) {
+    case CompressType::COMPRESS_BZ2:
+      bound = raw.size() + raw.size() / 100 + 600;
+      break;
+    case CompressType::COMPRESS_LZ4:
+      bound = LZ4_compressBound(static_cast<int>(raw.size()));
+      break;
+    case CompressType::COMPRESS_ZSTD:
+      bound = ZSTD_compressBound(raw.size());
+      break;
+    default:
+      AERROR << "Unsupported compress type: " << type;
+      return false;
+  }
+
+  compressed->resize(kSizePrefix + bound);
+  char* dst = &(*compressed)[kSizePrefix];
+  PutSize(raw.size(), &(*compressed)[0]);
+  size_t size = 0;
+  switch (type) {
+    case CompressType::COMPRESS_BZ2: {
+      unsigned int dst_len = static_cast<unsigned int>(bound);
+      int ret = BZ2_bzBuffToBuffCompress(
+          dst, &dst_len, const_cast<char*>(raw.data()),
+          static_cast<unsigned int>(raw.size()), kBz2BlockSize, 0, 0);
+      if (ret != BZ_OK) {
+        AERROR << "bz2 compress failed, ret: " << ret;
+        return false;
+      }
+      size = dst_len;
+      break;
+    }
+    case CompressType::COMPRESS_LZ4: {
+      int ret = LZ4_compress_default(raw.data(), dst,
+                                     static_cast<int>(raw.size()),
+                                     static_cast<int>(bound));
+      if (ret <= 0) {
+        AERROR << "lz4 compress failed, ret: " << ret;
+        return false;
+      }
+      size = static_cast<size_t>(ret);
+      break;
+    }
+    default: {
+      size_t ret = ZSTD_compress(dst, bound, raw.data(), raw.size(), kZstdLevel);
+      if (ZSTD_isError(ret)) {
+        AERROR << "zstd compress failed: " << ZSTD_getErrorName(ret);
+        return false;
+      }
+      size = ret;
+      break;
+    }
+  }
+  compressed->resize(kSizePrefix + size);
+  return true;
+}
+
+bool DecompressChunk(CompressType type, const char* data, size_t size,
+                     std::string* raw) {
+  if (size < kSizePrefix) {
+    AERROR << "Compressed chunk is truncated, size: " << size;
+    return false;
+  }
+  uint64_t raw_size = GetSize(data);
+  if (raw_size > INT_MAX) {
+    AERROR << "Invalid uncompressed chunk size: " << raw_size;
+    return false;
+  }
+  raw->resize(raw_size);
+  if (raw_size == 0) {
+    return true;
+  }
+  const char* src = data + kSizePrefix;
+  size_t src_size = size - kSizePrefix;
+  char* dst = &(*raw)[0];
+  switch (type) {
+    case CompressType::COMPRESS_BZ2: {
+      unsigned int dst_len = static_cast<unsigned int>(raw_size);
+      int ret = BZ2_bzBuffToBuffDecompress(dst, &dst_len,
+                                           const_cast<char*>(src),
+                                           static_cast<unsigned int>(src_size),
+                                           0, 0);
+      if (ret != BZ_OK || dst_len != raw_size) {
+        AERROR << "bz2 decompress failed, ret: " << ret;
+        return false;
+      }
+      return true;
+    }
+    case CompressType::COMPRESS_LZ4: {
+      int ret = LZ4_decompress_safe(src, dst, static_cast<int>(src_size),
+                                    static_cast<int>(raw_size));
+      if (ret < 0 || static_cast<uint64_t>(ret) != raw_size) {
+        AERROR << "lz4 decompress failed, ret: " << ret;
+        return false;
+      }
+      return true;
+    }
+    case CompressType::COMPRESS_ZSTD: {
+      size_t ret = ZSTD_decompress(dst, raw_size, src, src_size);
+      if (ZSTD_isError(ret) || ret != raw_size) {
+        AERROR << "zstd decompress failed, ret: " << ret;
+        return false;
+      }
+      return true;
+    }
+    default:
+      AERROR << "Unsupported compress type: " << type;
+      return false;
+  }
+}
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
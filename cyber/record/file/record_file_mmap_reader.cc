@@ -0,0 +1,273 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/record/file/record_file_mmap_reader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "cyber/common/file.h"
+#include "cyber/record/file/chunk_compressor.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+namespace {
+const uint64_t kFirstSectionPosition = sizeof(struct Section) + HEADER_LENGTH;
+}  // namespace
+
+RecordFileMmapReader::RecordFileMmapReader() : data_(nullptr), size_(0) {
+  fd_ = -1;
+}
+
+RecordFileMmapReader::~RecordFileMmapReader() { Close(); }
+
+bool RecordFileMmapReader::Open(const std::string& path) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  path_ = path;
+  if (!::apollo::cyber::common::PathExists(path_)) {
+    AERROR << "File not exist, file: " << path_;
+    return false;
+  }
+  fd_ = open(path_.data(), O_RDONLY);
+  if (fd_ < 0) {
+    AERROR << "Open file failed, file: " << path_ << ", fd: " << fd_
+           << ", errno: " << errno;
+    return false;
+  }
+  struct stat file_stat;
+  if (fstat(fd_, &file_stat) != 0) {
+    AERROR << "Stat file failed, file: " << path_ << ", errno: " << errno;
+    return false;
+  }
+  size_ = static_cast<uint64_t>(file_stat.st_size);
+  if (size_ < kFirstSectionPosition) {
+    AERROR << "File is too small to be a record file, file: " << path_;
+    return false;
+  }
+  void* addr = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd_, 0);
+  if (addr == MAP_FAILED) {
+    AERROR << "Map file failed, file: " << path_ << ", errno: " << errno;
+    return false;
+  }
+  data_ = static_cast<const char*>(addr);
+
+  if (!ReadHeader()) {
+    AERROR << "Read header section fail, file: " << path_;
+    return false;
+  }
+  if (!ReadIndex() && !ScanIndex()) {
+    AERROR << "Build index fail, file: " << path_;
+    return false;
+  }
+  BuildChunkIndex();
+  return true;
+}
+
+void RecordFileMmapReader::Close() {
+  if (data_ != nullptr) {
+    munmap(const_cast<char*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+  }
+  if (fd_ >= 0) {
+    close(fd_);
+    fd_ = -1;
+  }
+  chunks_.clear();
+}
+
+size_t RecordFileMmapReader::FindChunk(uint64_t time) const {
+  // max_end_time is monotonic, so the first chunk reaching `time` is the
+  // earliest one that can hold a message at or after it.
+  auto it =
+      std::lower_bound(chunks_.begin(), chunks_.end(), time,
+                       [](const ChunkIndexEntry& entry, uint64_t t) {
+                         return entry.max_end_time < t;
+                       });
+  return static_cast<size_t>(it - chunks_.begin());
+}
+
+bool RecordFileMmapReader::ReadChunk(size_t chunk_index,
+                                     ChunkBody* body) const {
+  if (chunk_index >= chunks_.size()) {
+    return false;
+  }
+  Section section;
+  uint64_t position = chunks_[chunk_index].body_position;
+  if (!ReadSection(position, &section)) {
+    return false;
+  }
+  if (section.type != SectionType::SECTION_CHUNK_BODY) {
+    AERROR << "Check section type failed"
+           << ", expect: " << SectionType::SECTION_CHUNK_BODY
+           << ", actual: " << section.type;
+    return false;
+  }
+  position += sizeof(struct Section);
+  if (header_.compress() == CompressType::COMPRESS_NONE) {
+    return ReadSection<ChunkBody>(position, section.size, body);
+  }
+  if (section.size > size_ - position) {
+    AERROR << "Section out of file range, file: " << path_
+           << ", position: " << position << ", size: " << section.size;
+    return false;
+  }
+  std::string raw;
+  if (!DecompressChunk(header_.compress(), data_ + position, section.size,
+                       &raw)) {
+    AERROR << "Decompress chunk fail, file: " << path_;
+    return false;
+  }
+  if (!body->ParseFromString(raw)) {
+    AERROR << "Parse chunk body failed, position: " << position;
+    return false;
+  }
+  return true;
+}
+
+bool RecordFileMmapReader::ReadHeader() {
+  Section section;
+  if (!ReadSection(0, &section)) {
+    return false;
+  }
+  if (section.type != SectionType::SECTION_HEADER) {
+    AERROR << "Check section type failed"
+           << ", expect: " << SectionType::SECTION_HEADER
+           << ", actual: " << section.type;
+    return false;
+  }
+  return ReadSection<Header>(sizeof(struct Section), section.size, &header_);
+}
+
+bool RecordFileMmapReader::ReadIndex() {
+  if (!header_.is_complete()) {
+    AWARN << "Record file is not complete, scan it for an index, file: "
+          << path_;
+    return false;
+  }
+  Section section;
+  if (!ReadSection(header_.index_position(), &section)) {
+    return false;
+  }
+  if (section.type != SectionType::SECTION_INDEX) {
+    AERROR << "Check section type failed"
+           << ", expect: " << SectionType::SECTION_INDEX
+           << ", actual: " << section.type;
+    return false;
+  }
+  return ReadSection<Index>(header_.index_position() + sizeof(struct Section),
+                            section.size, &index_);
+}
+
+bool RecordFileMmapReader::ScanIndex() {
+  // rebuild the index the writer would have written, walking section headers
+  // only; chunk bodies are skipped by size.
+  index_.Clear();
+  uint64_t position = kFirstSectionPosition;
+  Section section;
+  while (position + sizeof(struct Section) <= size_) {
+    if (!ReadSection(position, &section)) {
+      return false;
+    }
+    uint64_t body = position + sizeof(struct Section);
+    if (section.size > size_ - body) {
+      AWARN << "Truncated section at " << position << ", file: " << path_;
+      break;
+    }
+    uint64_t next = body + section.size;
+    if (section.type == SectionType::SECTION_CHANNEL) {
+      Channel channel;
+      if (!ReadSection<Channel>(body, section.size, &channel)) {
+        return false;
+      }
+      auto single_index = index_.add_indexes();
+      single_index->set_type(SectionType::SECTION_CHANNEL);
+      single_index->set_position(next);
+      auto channel_cache = single_index->mutable_channel_cache();
+      channel_cache->set_name(channel.name());
+      channel_cache->set_message_type(channel.message_type());
+      channel_cache->set_proto_desc(channel.proto_desc());
+    } else if (section.type == SectionType::SECTION_CHUNK_HEADER) {
+      ChunkHeader chunk_header;
+      if (!ReadSection<ChunkHeader>(body, section.size, &chunk_header)) {
+        return false;
+      }
+      auto single_index = index_.add_indexes();
+      single_index->set_type(SectionType::SECTION_CHUNK_HEADER);
+      single_index->set_position(next);
+      auto cache = single_index->mutable_chunk_header_cache();
+      cache->set_begin_time(chunk_header.begin_time());
+      cache->set_end_time(chunk_header.end_time());
+      cache->set_message_number(chunk_header.message_number());
+      cache->set_raw_size(chunk_header.raw_size());
+    } else if (section.type == SectionType::SECTION_INDEX) {
+      break;
+    } else if (section.type != SectionType::SECTION_CHUNK_BODY) {
+      AERROR << "Invalid section, type: " << section.type
+             << ", size: " << section.size;
+      return false;
+    }
+    position = next;
+  }
+  return true;
+}
+
+void RecordFileMmapReader::BuildChunkIndex() {
+  chunks_.clear();
+  uint64_t max_end_time = 0;
+  for (const auto& single_index : index_.indexes()) {
+    if (single_index.type() != SectionType::SECTION_CHUNK_HEADER ||
+        !single_index.has_chunk_header_cache()) {
+      continue;
+    }
+    // the writer records the position right after the chunk header, which
+    // is where its body section starts.
+    const auto& cache = single_index.chunk_header_cache();
+    ChunkIndexEntry entry;
+    entry.begin_time = cache.begin_time();
+    entry.end_time = cache.end_time();
+    entry.message_number = cache.message_number();
+    entry.body_position = single_index.position();
+    entry.channel_indexes.assign(cache.channel_indexes().begin(),
+                                 cache.channel_indexes().end());
+    max_end_time = std::max(max_end_time, entry.end_time);
+    entry.max_end_time = max_end_time;
+    chunks_.emplace_back(entry);
+  }
+}
+
+bool RecordFileMmapReader::ReadSection(uint64_t position,
+                                       Section* section) const {
+  if (position > size_ || sizeof(struct Section) > size_ - position) {
+    AERROR << "Section out of file range, file: " << path_
+           << ", position: " << position;
+    return false;
+  }
+  std::memcpy(section, data_ + position, sizeof(struct Section));
+  return true;
+}
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
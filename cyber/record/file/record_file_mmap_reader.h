@@ -0,0 +1,117 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#ifndef CYBER_RECORD_FILE_RECORD_FILE_MMAP_READER_H_
+#define CYBER_RECORD_FILE_RECORD_FILE_MMAP_READER_H_
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "cyber/common/log.h"
+#include "cyber/record/file/record_file_base.h"
+#include "cyber/record/file/section.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+/**
+ * @brief Where a chunk lives in the file and which time range it covers.
+ */
+struct ChunkIndexEntry {
+  uint64_t begin_time = 0;
+  uint64_t end_time = 0;
+  uint64_t message_number = 0;
+  // offset of the chunk body section
+  uint64_t body_position = 0;
+  // max end_time of this chunk and all earlier ones, used to seek
+  uint64_t max_end_time = 0;
+  // positions among the channel entries of the index of the channels with
+  // messages in the chunk, empty when the writer did not record them
+  std::vector<uint32_t> channel_indexes;
+};
+
+/**
+ * @class RecordFileMmapReader
+ * @brief Random access record file reader backed by a read-only mapping.
+ *
+ * The index section is loaded when the file is opened and turned into a
+ * time ordered table of chunks, so a reader can jump to any timestamp
+ * without touching the chunks before it. Chunk bodies are parsed straight
+ * out of the mapping only when asked for.
+ */
+class RecordFileMmapReader : public RecordFileBase {
+ public:
+  RecordFileMmapReader();
+  virtual ~RecordFileMmapReader();
+  bool Open(const std::string& path) override;
+  void Close() override;
+
+  const std::vector<ChunkIndexEntry>& chunks() const { return chunks_; }
+
+  /**
+   * @brief Index of the first chunk that may hold a message at or after
+   * `time`, `chunks().size()` if there is none.
+   */
+  size_t FindChunk(uint64_t time) const;
+  bool ReadChunk(size_t chunk_index, ChunkBody* body) const;
+
+ private:
+  bool ReadHeader();
+  bool ReadIndex();
+  bool ScanIndex();
+  void BuildChunkIndex();
+
+  bool ReadSection(uint64_t position, Section* section) const;
+  template <typename T>
+  bool ReadSection(uint64_t position, uint64_t size, T* message) const;
+
+  const char* data_;
+  uint64_t size_;
+  std::vector<ChunkIndexEntry> chunks_;
+};
+
+template <typename T>
+bool RecordFileMmapReader::ReadSection(uint64_t position, uint64_t size,
+                                       T* message) const {
+  if (size > INT_MAX) {
+    AERROR << "Size is larger than " << INT_MAX;
+    return false;
+  } else if (size == 0) {
+    AERROR << "Size is zero.";
+    return false;
+  }
+  if (position > size_ || size > size_ - position) {
+    AERROR << "Section out of file range, file: " << path_
+           << ", position: " << position << ", size: " << size;
+    return false;
+  }
+  if (!message->ParseFromArray(data_ + position, static_cast<int>(size))) {
+    AERROR << "Parse section message failed, position: " << position;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_RECORD_FILE_RECORD_FILE_MMAP_READER_H_
@@ -16,7 +16,10 @@
 
 #include "cyber/record/file/record_file_reader.h"
 
+#include <google/protobuf/wire_format_lite.h>
+
 #include "cyber/common/file.h"
+#include "cyber/record/file/chunk_compressor.h"
 
 namespace apollo {
 namespace cyber {
@@ -130,6 +133,95 @@ bool RecordFileReader::ReadSection(Section* section) {
   return true;
 }
 
+bool RecordFileReader::ReadRawSection(uint64_t size, std::string* payload) {
+  payload->resize(size);
+  uint64_t offset = 0;
+  while (offset < size) {
+    ssize_t count = read(fd_, &(*payload)[offset], size - offset);
+    if (count < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      AERROR << "Read fd failed, fd_: " << fd_ << ", errno: " << errno;
+      return false;
+    } else if (count == 0) {
+      end_of_file_ = true;
+      AERROR << "Section is truncated, file: " << path_;
+      return false;
+    }
+    offset += count;
+  }
+  return true;
+}
+
+bool RecordFileReader::CountChunkMessages(
+    const std::string& payload,
+    std::unordered_map<std::string, uint64_t>* message_numbers) {
+  std::string raw;
+  const std::string* body = &payload;
+  if (header_.compress() != CompressType::COMPRESS_NONE) {
+    if (!DecompressChunk(header_.compress(), payload.data(), payload.size(),
+                         &raw)) {
+      AERROR << "Decompress section fail, file: " << path_;
+      return false;
+    }
+    body = &raw;
+  }
+
+  // ChunkBody is `repeated SingleMessage messages = 1` and the channel name
+  // is field 1 of SingleMessage, the contents are skipped
+  CodedInputStream input(reinterpret_cast<const uint8_t*>(body->data()),
+                         static_cast<int>(body->size()));
+  std::string channel_name;
+  uint32_t tag = 0;
+  while ((tag = input.ReadTag()) != 0) {
+    uint32_t length = 0;
+    if (tag != ((1 << 3) | 2) || !input.ReadVarint32(&length)) {
+      return false;
+    }
+    CodedInputStream::Limit limit = input.PushLimit(length);
+    channel_name.clear();
+    uint32_t field_tag = 0;
+    while ((field_tag = input.ReadTag()) != 0) {
+      if (field_tag == ((1 << 3) | 2)) {
+        uint32_t name_length = 0;
+        if (!input.ReadVarint32(&name_length) ||
+            !input.ReadString(&channel_name, name_length)) {
+          return false;
+        }
+      } else if (!google::protobuf::internal::WireFormatLite::SkipField(
+                     &input, field_tag)) {
+        return false;
+      }
+    }
+    if (!input.ConsumedEntireMessage()) {
+      return false;
+    }
+    input.PopLimit(limit);
+    ++(*message_numbers)[channel_name];
+  }
+  return input.ConsumedEntireMessage();
+}
+
+bool RecordFileReader::ReadCompressedSection(
+    uint64_t size, google::protobuf::Message* message) {
+  std::string compressed;
+  if (!ReadRawSection(size, &compressed)) {
+    return false;
+  }
+  std::string raw;
+  if (!DecompressChunk(header_.compress(), compressed.data(), compressed.size(),
+                       &raw)) {
+    AERROR << "Decompress section fail, file: " << path_;
+    return false;
+  }
+  if (!message->ParseFromString(raw)) {
+    AERROR << "Parse section message failed.";
+    return false;
+  }
+  return true;
+}
+
 bool RecordFileReader::SkipSection(uint64_t size) {
   uint64_t c = CurrentPosition();
   if (!SetPosition(c + size)) {
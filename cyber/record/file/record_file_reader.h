@@ -24,6 +24,7 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 
@@ -54,8 +55,23 @@ class RecordFileReader : public RecordFileBase {
   bool ReadIndex();
   bool EndOfFile() { return end_of_file_; }
 
+  /**
+   * @brief Read the payload of a section as stored, a chunk body is left
+   * compressed.
+   */
+  bool ReadRawSection(uint64_t size, std::string* payload);
+
+  /**
+   * @brief Count the messages of each channel in a chunk body payload as
+   * read by ReadRawSection, without copying their contents.
+   */
+  bool CountChunkMessages(
+      const std::string& payload,
+      std::unordered_map<std::string, uint64_t>* message_numbers);
+
  private:
   bool ReadHeader();
+  bool ReadCompressedSection(uint64_t size, google::protobuf::Message* message);
   bool end_of_file_;
 };
 
@@ -68,6 +84,10 @@ bool RecordFileReader::ReadSection(uint64_t size, T* message) {
     AERROR << "Size is zero.";
     return false;
   }
+  if (std::is_same<T, ChunkBody>::value &&
+      header_.compress() != CompressType::COMPRESS_NONE) {
+    return ReadCompressedSection(size, message);
+  }
   FileInputStream raw_input(fd_, static_cast<int>(size));
   CodedInputStream coded_input(&raw_input);
   CodedInputStream::Limit limit = coded_input.PushLimit(static_cast<int>(size));
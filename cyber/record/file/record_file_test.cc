@@ -18,8 +18,11 @@
 #include <unistd.h>
 #include <atomic>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "cyber/record/file/record_file_base.h"
+#include "cyber/record/file/record_file_mmap_reader.h"
 #include "cyber/record/file/record_file_reader.h"
 #include "cyber/record/file/record_file_writer.h"
 #include "cyber/record/header_builder.h"
@@ -212,6 +215,126 @@ TEST(RecordFileTest, TestOneChunkFile) {
   ASSERT_EQ(3, rfw->GetHeader().message_number());
 }
 
+TEST(RecordFileTest, TestCompressedChunks) {
+  const uint64_t kMessageNum = 100;
+  for (auto compress :
+       {CompressType::COMPRESS_BZ2, CompressType::COMPRESS_LZ4,
+        CompressType::COMPRESS_ZSTD}) {
+    RecordFileWriter* rfw = new RecordFileWriter();
+    ASSERT_TRUE(rfw->Open(TEST_FILE));
+
+    // a chunk every few messages, so several are compressed concurrently
+    Header header = HeaderBuilder::GetHeaderWithChunkParams(0, 40);
+    header.set_segment_interval(0);
+    header.set_segment_raw_size(0);
+    header.set_compress(compress);
+    ASSERT_TRUE(rfw->WriteHeader(header));
+
+    Channel chan1;
+    chan1.set_name(CHAN_1);
+    chan1.set_message_type(MSG_TYPE);
+    ASSERT_TRUE(rfw->WriteChannel(chan1));
+
+    for (uint64_t i = 0; i < kMessageNum; ++i) {
+      SingleMessage msg;
+      msg.set_channel_name(CHAN_1);
+      msg.set_content(std::to_string(i) + STR_10B);
+      msg.set_time((i + 1) * 1e6);
+      ASSERT_TRUE(rfw->WriteMessage(msg));
+    }
+    rfw->Close();
+    ASSERT_EQ(kMessageNum, rfw->GetHeader().message_number());
+    ASSERT_LT(1, rfw->GetHeader().chunk_number());
+    delete rfw;
+
+    RecordFileMmapReader reader;
+    ASSERT_TRUE(reader.Open(TEST_FILE));
+    ASSERT_EQ(compress, reader.GetHeader().compress());
+    uint64_t i = 0;
+    for (size_t c = 0; c < reader.chunks().size(); ++c) {
+      ChunkBody body;
+      ASSERT_TRUE(reader.ReadChunk(c, &body));
+      for (const auto& msg : body.messages()) {
+        ASSERT_EQ(std::to_string(i) + STR_10B, msg.content());
+        ASSERT_EQ((i + 1) * 1e6, msg.time());
+        ++i;
+      }
+    }
+    ASSERT_EQ(kMessageNum, i);
+  }
+}
+
+TEST(RecordFileTest, TestCopyEncodedChunks) {
+  const char COPY_FILE[] = "test_copy.record";
+  const uint64_t kMessageNum = 100;
+  for (auto compress :
+       {CompressType::COMPRESS_NONE, CompressType::COMPRESS_LZ4}) {
+    Header header = HeaderBuilder::GetHeaderWithChunkParams(0, 40);
+    header.set_segment_interval(0);
+    header.set_segment_raw_size(0);
+    header.set_compress(compress);
+    {
+      RecordFileWriter writer;
+      ASSERT_TRUE(writer.Open(TEST_FILE));
+      ASSERT_TRUE(writer.WriteHeader(header));
+      for (uint64_t i = 0; i < kMessageNum; ++i) {
+        SingleMessage msg;
+        msg.set_channel_name(i % 4 == 0 ? CHAN_1 : CHAN_2);
+        msg.set_content(std::to_string(i) + STR_10B);
+        msg.set_time((i + 1) * 1e6);
+        ASSERT_TRUE(writer.WriteMessage(msg));
+      }
+    }
+
+    // copy every chunk body as it is, then add one message
+    RecordFileReader reader;
+    ASSERT_TRUE(reader.Open(TEST_FILE));
+    RecordFileWriter writer;
+    ASSERT_TRUE(writer.Open(COPY_FILE));
+    ASSERT_TRUE(writer.WriteHeader(header));
+    ChunkHeader chunk_header;
+    std::string body;
+    std::unordered_map<std::string, uint64_t> message_numbers;
+    Section section;
+    while (reader.ReadSection(&section) &&
+           section.type != SectionType::SECTION_INDEX) {
+      if (section.type == SectionType::SECTION_CHUNK_HEADER) {
+        ASSERT_TRUE(reader.ReadSection(section.size, &chunk_header));
+      } else if (section.type == SectionType::SECTION_CHUNK_BODY) {
+        message_numbers.clear();
+        ASSERT_TRUE(reader.ReadRawSection(section.size, &body));
+        ASSERT_TRUE(reader.CountChunkMessages(body, &message_numbers));
+        ASSERT_TRUE(writer.WriteEncodedChunk(chunk_header, std::move(body),
+                                             message_numbers));
+      } else {
+        ASSERT_TRUE(reader.SkipSection(section.size));
+      }
+    }
+    SingleMessage last;
+    last.set_channel_name(CHAN_1);
+    last.set_content(STR_10B);
+    last.set_time((kMessageNum + 1) * 1e6);
+    ASSERT_TRUE(writer.WriteMessage(last));
+    writer.Close();
+    ASSERT_EQ(kMessageNum / 4 + 1, writer.GetMessageNumber(CHAN_1));
+    ASSERT_EQ(kMessageNum * 3 / 4, writer.GetMessageNumber(CHAN_2));
+    ASSERT_EQ(kMessageNum + 1, writer.GetHeader().message_number());
+
+    RecordFileMmapReader copy;
+    ASSERT_TRUE(copy.Open(COPY_FILE));
+    uint64_t i = 0;
+    for (size_t c = 0; c < copy.chunks().size(); ++c) {
+      ChunkBody chunk_body;
+      ASSERT_TRUE(copy.ReadChunk(c, &chunk_body));
+      for (const auto& msg : chunk_body.messages()) {
+        ASSERT_EQ((i + 1) * 1e6, msg.time());
+        ++i;
+      }
+    }
+    ASSERT_EQ(kMessageNum + 1, i);
+  }
+}
+
 }  // namespace record
 }  // namespace cyber
 }  // namespace apollo
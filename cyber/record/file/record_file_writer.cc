@@ -18,13 +18,23 @@
 
 #include <fcntl.h>
 
+#include <algorithm>
+
 #include "cyber/common/file.h"
+#include "cyber/record/file/chunk_compressor.h"
 #include "cyber/time/time.h"
 
 namespace apollo {
 namespace cyber {
 namespace record {
 
+namespace {
+const unsigned int kMaxCompressThreadNum = 4;
+// chunks allowed in flight before WriteMessage starts waiting, a full chunk
+// is up to chunk_raw_size so this also bounds the memory held.
+const size_t kMaxPendingChunks = 8;
+}  // namespace
+
 RecordFileWriter::RecordFileWriter() {}
 
 RecordFileWriter::~RecordFileWriter() { Close(); }
@@ -43,8 +53,12 @@ bool RecordFileWriter::Open(const std::string& path) {
     return false;
   }
   chunk_active_.reset(new Chunk());
-  chunk_flush_.reset(new Chunk());
   is_writing_ = true;
+  unsigned int thread_num = std::max(
+      1u, std::min(kMaxCompressThreadNum, std::thread::hardware_concurrency()));
+  for (unsigned int i = 0; i < thread_num; ++i) {
+    compress_threads_.emplace_back([this]() { this->Compress(); });
+  }
   flush_thread_ = std::make_shared<std::thread>([this]() { this->Flush(); });
   if (flush_thread_ == nullptr) {
     AERROR << "Init flush thread error.";
@@ -55,25 +69,24 @@ bool RecordFileWriter::Open(const std::string& path) {
 
 void RecordFileWriter::Close() {
   if (is_writing_) {
-    // wait for the flush operation that may exist now
-    while (!chunk_flush_->empty()) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    if (!chunk_active_->empty()) {
+      SubmitChunk();
     }
 
-    // last swap
+    // workers and the flush thread drain every submitted chunk before they
+    // leave.
     {
       std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-      chunk_flush_.swap(chunk_active_);
-      flush_cv_.notify_one();
+      is_writing_ = false;
     }
-
-    // wait for the last flush opertation
-    while (!chunk_flush_->empty()) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    }
-
-    is_writing_ = false;
+    compress_cv_.notify_all();
     flush_cv_.notify_all();
+    for (auto& thread : compress_threads_) {
+      if (thread.joinable()) {
+        thread.join();
+      }
+    }
+    compress_threads_.clear();
     if (flush_thread_ && flush_thread_->joinable()) {
       flush_thread_->join();
       flush_thread_ = nullptr;
@@ -133,6 +146,8 @@ bool RecordFileWriter::WriteChannel(const Channel& channel) {
     AERROR << "Write section fail";
     return false;
   }
+  channel_indexes_[channel.name()] =
+      static_cast<uint32_t>(header_.channel_number());
   header_.set_channel_number(header_.channel_number() + 1);
   SingleIndex* single_index = index_.add_indexes();
   single_index->set_type(SectionType::SECTION_CHANNEL);
@@ -146,8 +161,9 @@ bool RecordFileWriter::WriteChannel(const Channel& channel) {
   return true;
 }
 
-bool RecordFileWriter::WriteChunk(const ChunkHeader& chunk_header,
-                                  const ChunkBody& chunk_body) {
+bool RecordFileWriter::WriteChunk(
+    const ChunkHeader& chunk_header, const std::string& body,
+    const std::unordered_set<std::string>& channels) {
   std::lock_guard<std::mutex> lock(mutex_);
   if (!WriteSection<ChunkHeader>(chunk_header)) {
     AERROR << "Write chunk header fail";
@@ -161,8 +177,17 @@ bool RecordFileWriter::WriteChunk(const ChunkHeader& chunk_header,
   chunk_header_cache->set_end_time(chunk_header.end_time());
   chunk_header_cache->set_message_number(chunk_header.message_number());
   chunk_header_cache->set_raw_size(chunk_header.raw_size());
+  for (const auto& channel : channels) {
+    auto search = channel_indexes_.find(channel);
+    if (search == channel_indexes_.end()) {
+      // a message of an unregistered channel, the list would lie
+      chunk_header_cache->clear_channel_indexes();
+      break;
+    }
+    chunk_header_cache->add_channel_indexes(search->second);
+  }
   single_index->set_allocated_chunk_header_cache(chunk_header_cache);
-  if (!WriteSection<ChunkBody>(chunk_body)) {
+  if (!WriteRawSection(SectionType::SECTION_CHUNK_BODY, body)) {
     AERROR << "Write chunk body fail";
     return false;
   }
@@ -177,7 +202,7 @@ bool RecordFileWriter::WriteChunk(const ChunkHeader& chunk_header,
   single_index->set_type(SectionType::SECTION_CHUNK_BODY);
   single_index->set_position(CurrentPosition());
   ChunkBodyCache* chunk_body_cache = new ChunkBodyCache();
-  chunk_body_cache->set_message_number(chunk_body.messages_size());
+  chunk_body_cache->set_message_number(chunk_header.message_number());
   single_index->set_allocated_chunk_body_cache(chunk_body_cache);
   return true;
 }
@@ -204,31 +229,149 @@ bool RecordFileWriter::WriteMessage(const SingleMessage& message) {
   if (!need_flush) {
     return true;
   }
+  SubmitChunk();
+  return true;
+}
+
+bool RecordFileWriter::WriteRawSection(SectionType type,
+                                       const std::string& payload) {
+  Section section = {type, static_cast<uint64_t>(payload.size())};
+  ssize_t count = write(fd_, &section, sizeof(section));
+  if (count != sizeof(section)) {
+    AERROR << "Write fd failed, fd: " << fd_
+           << ", expect count: " << sizeof(section)
+           << ", actual count: " << count << ", errno: " << errno;
+    return false;
+  }
+  size_t written = 0;
+  while (written < payload.size()) {
+    count = write(fd_, payload.data() + written, payload.size() - written);
+    if (count < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      AERROR << "Write fd failed, fd: " << fd_ << ", errno: " << errno;
+      return false;
+    }
+    written += count;
+  }
+  header_.set_size(CurrentPosition());
+  return true;
+}
+
+bool RecordFileWriter::WriteEncodedChunk(
+    const ChunkHeader& chunk_header, std::string body,
+    const std::unordered_map<std::string, uint64_t>& message_numbers) {
+  if (!chunk_active_->empty()) {
+    SubmitChunk();
+  }
+  for (const auto& message_number : message_numbers) {
+    channel_message_number_map_[message_number.first] +=
+        message_number.second;
+  }
+  auto task = std::make_shared<ChunkTask>();
+  task->chunk.reset(new Chunk());
+  task->chunk->header_ = chunk_header;
+  for (const auto& message_number : message_numbers) {
+    task->chunk->channels_.insert(message_number.first);
+  }
+  task->body = std::move(body);
+  task->ok = true;
+  task->done = true;
+  Enqueue(task);
+  return true;
+}
+
+void RecordFileWriter::SubmitChunk() {
+  auto task = std::make_shared<ChunkTask>();
+  task->chunk = std::move(chunk_active_);
+  chunk_active_.reset(new Chunk());
+  Enqueue(task);
+}
+
+void RecordFileWriter::Enqueue(const std::shared_ptr<ChunkTask>& task) {
   {
+    // block the recorder rather than drop data when the disk or the
+    // compressors fall behind.
     std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-    chunk_flush_.swap(chunk_active_);
+    submit_cv_.wait(flush_lock, [this] {
+      return flush_tasks_.size() < kMaxPendingChunks || !is_writing_;
+    });
+    flush_tasks_.push_back(task);
+    if (!task->done) {
+      compress_tasks_.push_back(task);
+    }
+  }
+  compress_cv_.notify_one();
+  flush_cv_.notify_one();
+}
+
+void RecordFileWriter::Compress() {
+  while (true) {
+    std::shared_ptr<ChunkTask> task;
+    {
+      std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+      compress_cv_.wait(flush_lock, [this] {
+        return !compress_tasks_.empty() || !is_writing_;
+      });
+      if (compress_tasks_.empty()) {
+        break;
+      }
+      task = compress_tasks_.front();
+      compress_tasks_.pop_front();
+    }
+
+    CompressType compress_type;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      compress_type = header_.compress();
+    }
+    bool ok = false;
+    if (compress_type == CompressType::COMPRESS_NONE) {
+      ok = task->chunk->body_.SerializeToString(&task->body);
+    } else {
+      std::string raw;
+      ok = task->chunk->body_.SerializeToString(&raw) &&
+           CompressChunk(compress_type, raw, &task->body);
+    }
+    task->chunk->body_.Clear();
+
+    {
+      std::lock_guard<std::mutex> flush_lock(flush_mutex_);
+      task->ok = ok;
+      task->done = true;
+    }
     flush_cv_.notify_one();
   }
-  return true;
 }
 
 void RecordFileWriter::Flush() {
-  while (is_writing_) {
-    std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-    flush_cv_.wait(flush_lock,
-                   [this] { return !chunk_flush_->empty() || !is_writing_; });
-    if (!is_writing_) {
-      break;
+  while (true) {
+    std::shared_ptr<ChunkTask> task;
+    {
+      std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+      flush_cv_.wait(flush_lock, [this] {
+        return (!flush_tasks_.empty() && flush_tasks_.front()->done) ||
+               (flush_tasks_.empty() && !is_writing_);
+      });
+      if (flush_tasks_.empty()) {
+        break;
+      }
+      task = flush_tasks_.front();
+      flush_tasks_.pop_front();
     }
-    if (chunk_flush_->empty()) {
+    submit_cv_.notify_one();
+
+    if (!task->ok) {
+      AERROR << "Encode chunk fail, drop " << task->chunk->header_.message_number()
+             << " messages.";
       continue;
     }
-    if (!WriteChunk(chunk_flush_->header_, chunk_flush_->body_)) {
+    if (!WriteChunk(task->chunk->header_, task->body,
+                    task->chunk->channels_)) {
       AERROR << "Write chunk fail.";
     }
-    chunk_flush_->clear();
   }
-  return;
 }
 
 uint64_t RecordFileWriter::GetMessageNumber(
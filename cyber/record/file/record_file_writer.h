@@ -20,14 +20,18 @@
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/text_format.h>
+#include <unistd.h>
 #include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <memory>
 #include <string>
 #include <thread>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "cyber/common/log.h"
 #include "cyber/record/file/record_file_base.h"
@@ -50,6 +54,7 @@ struct Chunk {
     header_.set_end_time(0);
     header_.set_message_number(0);
     header_.set_raw_size(0);
+    channels_.clear();
   }
 
   inline void add(const SingleMessage& message) {
@@ -67,6 +72,7 @@ struct Chunk {
     }
     header_.set_message_number(header_.message_number() + 1);
     header_.set_raw_size(header_.raw_size() + message.content().size());
+    channels_.insert(message.channel_name());
   }
 
   inline bool empty() { return header_.message_number() == 0; }
@@ -74,6 +80,18 @@ struct Chunk {
   std::mutex mutex_;
   ChunkHeader header_;
   ChunkBody body_;
+  std::unordered_set<std::string> channels_;
+};
+
+/**
+ * @brief A full chunk on its way to the file: serialized and compressed by
+ * any worker, then written strictly in submission order.
+ */
+struct ChunkTask {
+  std::unique_ptr<Chunk> chunk;
+  std::string body;
+  bool done = false;
+  bool ok = false;
 };
 
 class RecordFileWriter : public RecordFileBase {
@@ -85,20 +103,42 @@ class RecordFileWriter : public RecordFileBase {
   bool WriteHeader(const Header& header);
   bool WriteChannel(const Channel& channel);
   bool WriteMessage(const SingleMessage& message);
+  /**
+   * @brief Write a chunk body already encoded with the compress type of the
+   * header, e.g. copied from another record, after the messages written
+   * before it.
+   * @param message_numbers the messages of each channel in the chunk
+   */
+  bool WriteEncodedChunk(
+      const ChunkHeader& chunk_header, std::string body,
+      const std::unordered_map<std::string, uint64_t>& message_numbers);
   uint64_t GetMessageNumber(const std::string& channel_name) const;
  private:
-  bool WriteChunk(const ChunkHeader& chunk_header, const ChunkBody& chunk_body);
+  bool WriteChunk(const ChunkHeader& chunk_header, const std::string& body,
+                  const std::unordered_set<std::string>& channels);
   template <typename T>
   bool WriteSection(const T& message);
+  bool WriteRawSection(SectionType type, const std::string& payload);
   bool WriteIndex();
+  void SubmitChunk();
+  void Enqueue(const std::shared_ptr<ChunkTask>& task);
+  void Compress();
   void Flush();
   bool is_writing_ = false;
   std::unique_ptr<Chunk> chunk_active_ = nullptr;
-  std::unique_ptr<Chunk> chunk_flush_ = nullptr;
+  // every submitted chunk in file order; compress_tasks_ holds the ones no
+  // worker has picked up yet
+  std::deque<std::shared_ptr<ChunkTask>> flush_tasks_;
+  std::deque<std::shared_ptr<ChunkTask>> compress_tasks_;
+  std::vector<std::thread> compress_threads_;
   std::shared_ptr<std::thread> flush_thread_ = nullptr;
   std::mutex flush_mutex_;
+  std::condition_variable compress_cv_;
   std::condition_variable flush_cv_;
+  std::condition_variable submit_cv_;
   std::unordered_map<std::string, uint64_t> channel_message_number_map_;
+  // position of each channel among the channel entries of index_
+  std::unordered_map<std::string, uint32_t> channel_indexes_;
 };
 
 template <typename T>
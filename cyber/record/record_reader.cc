@@ -18,6 +18,8 @@
 
 #include <utility>
 
+#include "cyber/common/util.h"
+
 namespace apollo {
 namespace cyber {
 namespace record {
@@ -27,40 +29,70 @@ using proto::SectionType;
 RecordReader::~RecordReader() {}
 
 RecordReader::RecordReader(const std::string& file) {
-  file_reader_.reset(new RecordFileReader());
+  file_reader_.reset(new RecordFileMmapReader());
   if (!file_reader_->Open(file)) {
     AERROR << "Open record file failed, file: " << file;
     return;
   }
   is_valid_ = true;
   header_ = file_reader_->GetHeader();
-  if (file_reader_->ReadIndex()) {
-    index_ = file_reader_->GetIndex();
-    const int kIndexSize = index_.indexes_size();
-    for (int i = 0; i < kIndexSize; ++i) {
-      auto single_idx = index_.mutable_indexes(i);
-      if (single_idx->type() != SectionType::SECTION_CHANNEL) {
-        continue;
-      }
-      if (!single_idx->has_channel_cache()) {
-        AERROR << "single channel index does not have channel_cache.";
-        continue;
-      }
-      auto channel_cache = single_idx->mutable_channel_cache();
-      channel_info_.insert(
-          std::make_pair(channel_cache->name(), *channel_cache));
+  index_ = file_reader_->GetIndex();
+  const int kIndexSize = index_.indexes_size();
+  for (int i = 0; i < kIndexSize; ++i) {
+    auto single_idx = index_.mutable_indexes(i);
+    if (single_idx->type() != SectionType::SECTION_CHANNEL) {
+      continue;
     }
+    channel_names_.push_back(single_idx->channel_cache().name());
+    if (!single_idx->has_channel_cache()) {
+      AERROR << "single channel index does not have channel_cache.";
+      continue;
+    }
+    auto channel_cache = single_idx->mutable_channel_cache();
+    channel_info_.insert(std::make_pair(channel_cache->name(), *channel_cache));
   }
-  file_reader_->Reset();
 }
 
 void RecordReader::Reset() {
-  file_reader_->Reset();
-  reach_end_ = false;
+  next_chunk_ = 0;
   message_index_ = 0;
   chunk_ = ChunkBody();
 }
 
+void RecordReader::Seek(uint64_t time) {
+  Reset();
+  if (file_reader_ != nullptr) {
+    next_chunk_ = file_reader_->FindChunk(time);
+  }
+}
+
+void RecordReader::SetChannelFilter(const std::set<std::string>& channels) {
+  channel_filter_ = channels;
+  channel_index_filter_.assign(channel_names_.size(), false);
+  for (size_t i = 0; i < channel_names_.size(); ++i) {
+    channel_index_filter_[i] = channel_filter_.count(channel_names_[i]) > 0;
+  }
+}
+
+bool RecordReader::ChunkMatchesFilter(size_t chunk_index) const {
+  const auto& chunks = file_reader_->chunks();
+  if (channel_filter_.empty() || chunk_index >= chunks.size()) {
+    return true;
+  }
+  const auto& channel_indexes = chunks[chunk_index].channel_indexes;
+  if (channel_indexes.empty()) {
+    return true;
+  }
+  for (auto index : channel_indexes) {
+    // an out of range index means a broken list, so do not skip on it
+    if (index >= channel_index_filter_.size() ||
+        channel_index_filter_[index]) {
+      return true;
+    }
+  }
+  return false;
+}
+
 std::set<std::string> RecordReader::GetChannelList() const {
   std::set<std::string> channel_list;
   for (auto& item : channel_info_) {
@@ -89,6 +121,10 @@ bool RecordReader::ReadMessage(RecordMessage* message, uint64_t begin_time,
     if (time < begin_time) {
       continue;
     }
+    if (!channel_filter_.empty() &&
+        channel_filter_.count(next_message.channel_name()) == 0) {
+      continue;
+    }
 
     message->channel_name = next_message.channel_name();
     message->content = next_message.content();
@@ -106,62 +142,36 @@ bool RecordReader::ReadMessage(RecordMessage* message, uint64_t begin_time,
   return false;
 }
 
+const std::vector<ChunkIndexEntry>& RecordReader::GetChunkIndex() const {
+  return file_reader_->chunks();
+}
+
+bool RecordReader::ReadChunk(size_t chunk_index,
+                             proto::ChunkBody* chunk) const {
+  if (!is_valid_) {
+    return false;
+  }
+  return file_reader_->ReadChunk(chunk_index, chunk);
+}
+
 bool RecordReader::ReadNextChunk(uint64_t begin_time, uint64_t end_time) {
-  bool skip_next_chunk_body = false;
-  while (!reach_end_) {
-    Section section;
-    if (!file_reader_->ReadSection(&section)) {
-      AERROR << "Read section failed, file: " << file_reader_->GetPath();
+  const auto& chunks = file_reader_->chunks();
+  while (next_chunk_ < chunks.size()) {
+    const auto& entry = chunks[next_chunk_];
+    if (entry.begin_time > end_time) {
       return false;
     }
-    switch (section.type) {
-      case SectionType::SECTION_INDEX: {
-        file_reader_->SkipSection(section.size);
-        reach_end_ = true;
-        break;
-      }
-      case SectionType::SECTION_CHANNEL: {
-        ADEBUG << "Read channel section of size: " << section.size;
-        Channel channel;
-        if (!file_reader_->ReadSection<Channel>(section.size, &channel)) {
-          AERROR << "Failed to read channel section.";
-          return false;
-        }
-        break;
-      }
-      case SectionType::SECTION_CHUNK_HEADER: {
-        ADEBUG << "Read chunk header section of size: " << section.size;
-        ChunkHeader header;
-        if (!file_reader_->ReadSection<ChunkHeader>(section.size, &header)) {
-          AERROR << "Failed to read chunk header section.";
-          return false;
-        }
-        if (header.end_time() < begin_time) {
-          skip_next_chunk_body = true;
-        }
-        if (header.begin_time() > end_time) {
-          return false;
-        }
-        break;
-      }
-      case SectionType::SECTION_CHUNK_BODY: {
-        if (skip_next_chunk_body) {
-          file_reader_->SkipSection(section.size);
-          skip_next_chunk_body = false;
-          break;
-        }
-        if (!file_reader_->ReadSection<ChunkBody>(section.size, &chunk_)) {
-          AERROR << "Failed to read chunk body section.";
-          return false;
-        }
-        return true;
-      }
-      default: {
-        AERROR << "Invalid section, type: " << section.type
-               << ", size: " << section.size;
-        return false;
-      }
+    ++next_chunk_;
+    if (entry.end_time < begin_time ||
+        !ChunkMatchesFilter(next_chunk_ - 1)) {
+      continue;
     }
+    if (!file_reader_->ReadChunk(next_chunk_ - 1, &chunk_)) {
+      AERROR << "Failed to read chunk body section, file: "
+             << file_reader_->GetPath();
+      return false;
+    }
+    return true;
   }
   return false;
 }
@@ -183,6 +193,17 @@ const std::string& RecordReader::GetMessageType(
   return search->second.message_type();
 }
 
+const message::MessageTypeInfo* RecordReader::GetMessageTypeInfo(
+    const std::string& channel_name) const {
+  auto search = channel_info_.find(channel_name);
+  if (search == channel_info_.end()) {
+    return nullptr;
+  }
+  return message::ProtobufFactory::Instance()->RegisterChannelType(
+      common::Hash(channel_name), search->second.message_type(),
+      search->second.proto_desc());
+}
+
 const std::string& RecordReader::GetProtoDesc(
     const std::string& channel_name) const {
   auto search = channel_info_.find(channel_name);
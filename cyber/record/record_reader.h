@@ -21,9 +21,11 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "cyber/message/protobuf_factory.h"
 #include "cyber/proto/record.pb.h"
-#include "cyber/record/file/record_file_reader.h"
+#include "cyber/record/file/record_file_mmap_reader.h"
 #include "cyber/record/record_base.h"
 #include "cyber/record/record_message.h"
 
@@ -33,7 +35,7 @@ namespace record {
 
 class RecordReader : public RecordBase {
  public:
-  using FileReaderPtr = std::unique_ptr<RecordFileReader>;
+  using FileReaderPtr = std::unique_ptr<RecordFileMmapReader>;
   using ChannelInfoMap = std::unordered_map<std::string, proto::ChannelCache>;
 
   explicit RecordReader(const std::string& file);
@@ -45,6 +47,32 @@ class RecordReader : public RecordBase {
                    uint64_t end_time = UINT64_MAX);
   void Reset();
 
+  /**
+   * @brief Only read messages of these channels, all of them if empty.
+   * Chunks the index shows to hold none of the channels are skipped without
+   * being decoded; records written before the chunk channel lists existed
+   * still decode every chunk.
+   */
+  void SetChannelFilter(const std::set<std::string>& channels);
+
+  /**
+   * @brief Whether the chunk may hold a message of the channel filter.
+   */
+  bool ChunkMatchesFilter(size_t chunk_index) const;
+
+  /**
+   * @brief Jump to the first chunk that may hold messages at or after `time`
+   * without decoding any chunk before it.
+   */
+  void Seek(uint64_t time);
+
+  /**
+   * @brief Direct access to the chunk index. ReadChunk only reads from the
+   * file mapping, so several threads may decode chunks of one reader at once.
+   */
+  const std::vector<ChunkIndexEntry>& GetChunkIndex() const;
+  bool ReadChunk(size_t chunk_index, proto::ChunkBody* chunk) const;
+
   uint64_t GetMessageNumber(const std::string& channel_name) const override;
 
   const std::string& GetMessageType(
@@ -55,6 +83,15 @@ class RecordReader : public RecordBase {
 
   std::set<std::string> GetChannelList() const;
 
+  /**
+   * @brief Interned type of a channel, keyed by channel id in the
+   * ProtobufFactory. The first call registers the recorded descriptors;
+   * later calls, from this or any other reader, skip the descriptor parse.
+   * Returns nullptr for unknown channels or unusable descriptors.
+   */
+  const message::MessageTypeInfo* GetMessageTypeInfo(
+      const std::string& channel_name) const;
+
   const proto::Header& header() const { return header_; }
   const ChannelInfoMap& channel_info() const { return channel_info_; }
 
@@ -62,11 +99,16 @@ class RecordReader : public RecordBase {
   bool ReadNextChunk(uint64_t begin_time, uint64_t end_time);
 
   bool is_valid_ = false;
-  bool reach_end_ = false;
+  size_t next_chunk_ = 0;
   proto::ChunkBody chunk_;
   proto::Index index_;
   int message_index_ = 0;
   ChannelInfoMap channel_info_;
+  // channel names in the order of the channel entries of the index
+  std::vector<std::string> channel_names_;
+  std::set<std::string> channel_filter_;
+  // indexed like channel_names_, whether the channel passes the filter
+  std::vector<bool> channel_index_filter_;
   FileReaderPtr file_reader_;
 };
 
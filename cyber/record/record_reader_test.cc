@@ -18,8 +18,12 @@
 #include "cyber/record/record_writer.h"
 
 #include <gtest/gtest.h>
+#include <set>
 #include <string>
 
+#include "cyber/record/file/record_file_writer.h"
+#include "cyber/record/header_builder.h"
+
 namespace apollo {
 namespace cyber {
 namespace record {
@@ -90,6 +94,62 @@ TEST(RecordTest, TestSingleRecordFile) {
   ASSERT_FALSE(reader.ReadMessage(&message, 0, MESSAGE_NUM - 2));
 }
 
+TEST(RecordTest, TestChannelFilter) {
+  // chunks of 4 messages: [1, 4] [5, 8] [9, 12]
+  RecordFileWriter writer;
+  ASSERT_TRUE(writer.Open(TEST_FILE));
+  proto::Header header = HeaderBuilder::GetHeaderWithChunkParams(2, 0);
+  header.set_segment_interval(0);
+  header.set_segment_raw_size(0);
+  ASSERT_TRUE(writer.WriteHeader(header));
+  for (auto name : {CHANNEL_NAME_1, CHANNEL_NAME_2}) {
+    proto::Channel channel;
+    channel.set_name(name);
+    channel.set_message_type(MESSAGE_TYPE_1);
+    ASSERT_TRUE(writer.WriteChannel(channel));
+  }
+  for (uint64_t time = 1; time <= 12; ++time) {
+    proto::SingleMessage message;
+    message.set_time(time);
+    message.set_content(std::to_string(time));
+    if (time == 6) {
+      message.set_channel_name(CHANNEL_NAME_1);
+    } else if (time == 10) {
+      // never written as a channel, its chunk can't be skipped
+      message.set_channel_name("/test/unregistered");
+    } else {
+      message.set_channel_name(CHANNEL_NAME_2);
+    }
+    ASSERT_TRUE(writer.WriteMessage(message));
+  }
+  writer.Close();
+
+  RecordReader reader(TEST_FILE);
+  ASSERT_EQ(3, reader.GetChunkIndex().size());
+  EXPECT_TRUE(reader.ChunkMatchesFilter(0));
+
+  reader.SetChannelFilter({CHANNEL_NAME_1});
+  EXPECT_FALSE(reader.ChunkMatchesFilter(0));
+  EXPECT_TRUE(reader.ChunkMatchesFilter(1));
+  EXPECT_TRUE(reader.ChunkMatchesFilter(2));
+
+  RecordMessage message;
+  ASSERT_TRUE(reader.ReadMessage(&message));
+  EXPECT_EQ(CHANNEL_NAME_1, message.channel_name);
+  EXPECT_EQ(6, message.time);
+  EXPECT_FALSE(reader.ReadMessage(&message));
+
+  reader.SetChannelFilter({CHANNEL_NAME_2});
+  EXPECT_TRUE(reader.ChunkMatchesFilter(0));
+  reader.SetChannelFilter({});
+  reader.Reset();
+  uint64_t message_num = 0;
+  while (reader.ReadMessage(&message)) {
+    ++message_num;
+  }
+  EXPECT_EQ(12, message_num);
+}
+
 }  // namespace record
 }  // namespace cyber
 }  // namespace apollo
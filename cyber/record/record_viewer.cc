@@ -30,6 +30,7 @@ RecordViewer::RecordViewer(const RecordReaderPtr& reader, uint64_t begin_time,
                            const std::set<std::string>& channels)
     : begin_time_(begin_time), end_time_(end_time), channels_(channels) {
   readers_.emplace_back(reader);
+  SetChannelFilter();
   UpdateTime();
 }
 
@@ -41,6 +42,7 @@ RecordViewer::RecordViewer(const std::vector<RecordReaderPtr>& readers,
       channels_(channels),
       readers_(readers) {
   Sort();
+  SetChannelFilter();
   UpdateTime();
 }
 
@@ -102,14 +104,28 @@ void RecordViewer::Sort() {
             });
 }
 
-void RecordViewer::Reset() {
+void RecordViewer::Reset() { Seek(begin_time_); }
+
+void RecordViewer::Seek(uint64_t time) {
+  if (time < begin_time_) {
+    time = begin_time_;
+  }
   for (auto& reader : readers_) {
-    reader->Reset();
+    reader->Seek(time);
   }
-  curr_begin_time_ = begin_time_;
+  curr_begin_time_ = time;
   msg_buffer_.clear();
 }
 
+void RecordViewer::SetChannelFilter() {
+  if (channels_.empty()) {
+    return;
+  }
+  for (auto& reader : readers_) {
+    reader->SetChannelFilter(channels_);
+  }
+}
+
 void RecordViewer::UpdateTime() {
   uint64_t min_begin_time = UINT64_MAX;
   uint64_t max_end_time = 0;
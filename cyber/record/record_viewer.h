@@ -37,6 +37,8 @@ class RecordViewer {
  public:
   using RecordReaderPtr = std::shared_ptr<RecordReader>;
 
+  // A non-empty channel set also becomes the channel filter of the
+  // readers, so chunks without those channels are never decoded.
   RecordViewer(const RecordReaderPtr& reader, uint64_t begin_time = 0,
                uint64_t end_time = UINT64_MAX,
                const std::set<std::string>& channels = std::set<std::string>());
@@ -50,6 +52,12 @@ class RecordViewer {
   uint64_t end_time() const;
   std::set<std::string> GetChannelList() const;
 
+  /**
+   * @brief Continue `Update` from the first message at or after `time`.
+   * Readers jump there through their chunk index.
+   */
+  void Seek(uint64_t time);
+
   class Iterator {
    public:
     using iterator_category = std::input_iterator_tag;
@@ -83,6 +91,7 @@ class RecordViewer {
 
   void Sort();
   void Reset();
+  void SetChannelFilter();
   void UpdateTime();
   bool FillBuffer();
 
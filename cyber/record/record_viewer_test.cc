@@ -156,6 +156,32 @@ TEST(RecordTest, filter_test) {
   EXPECT_EQ(CheckCount(viewer_7), msg_num);
 }
 
+TEST(RecordTest, seek_test) {
+  uint64_t msg_num = 200;
+  uint64_t begin_time = 100000000;
+  uint64_t step_time = 100000000;  // 100ms
+  ConstructRecord(msg_num, begin_time, step_time);
+
+  auto reader = std::make_shared<RecordReader>(TEST_FILE);
+  RecordViewer viewer(reader);
+  EXPECT_TRUE(viewer.IsValid());
+
+  RecordMessage msg;
+  viewer.Seek(begin_time + 150 * step_time);
+  uint64_t i = 150;
+  while (viewer.Update(&msg)) {
+    EXPECT_EQ(begin_time + step_time * i, msg.time);
+    EXPECT_EQ(std::to_string(i), msg.content);
+    i++;
+  }
+  EXPECT_EQ(msg_num, i);
+
+  // seeking backwards replays from there
+  viewer.Seek(begin_time + 20 * step_time);
+  ASSERT_TRUE(viewer.Update(&msg));
+  EXPECT_EQ(begin_time + 20 * step_time, msg.time);
+}
+
 TEST(RecordTest, mult_iterator_test) {
   uint64_t msg_num = 200;
   uint64_t begin_time = 100000000;
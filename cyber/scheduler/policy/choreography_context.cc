@@ -40,21 +40,58 @@ std::shared_ptr<CRoutine> ChoreographyContext::NextRoutine() {
   }
 
   ReadLockGuard<AtomicRWLock> lock(rq_lk_);
-  for (auto it = cr_queue_.begin(); it != cr_queue_.end();) {
+  // without deadline aware croutines the first ready one is taken, else the
+  // band of the first ready croutine is scanned for the earliest deadline
+  const bool edf = deadline_aware_num_ > 0;
+  std::shared_ptr<CRoutine> first = nullptr;
+  std::shared_ptr<CRoutine> earliest = nullptr;
+  uint32_t band = 0;
+  for (auto it = cr_queue_.begin(); it != cr_queue_.end(); ++it) {
+    if ((first != nullptr || earliest != nullptr) && it->first != band) {
+      break;
+    }
     auto cr = it->second;
     // FIXME: Remove Acquire() and Release() if there is no race condtion.
     if (!cr->Acquire()) {
       continue;
     }
 
-    if (cr->UpdateState() == RoutineState::READY) {
-      PerfEventCache::Instance()->AddSchedEvent(SchedPerf::NEXT_RT, cr->id(),
-                                                cr->processor_id());
-      return cr;
+    if (cr->UpdateState() != RoutineState::READY) {
+      cr->Release();
+      continue;
+    }
+    if (!edf) {
+      first = cr;
+      break;
     }
 
-    cr->Release();
-    ++it;
+    band = it->first;
+    if (!cr->deadline_aware()) {
+      if (first == nullptr) {
+        first = cr;
+      } else {
+        cr->Release();
+      }
+    } else if (earliest == nullptr || EarlierDeadline(*cr, *earliest)) {
+      if (earliest != nullptr) {
+        earliest->Release();
+      }
+      earliest = cr;
+    } else {
+      cr->Release();
+    }
+  }
+
+  if (earliest != nullptr) {
+    if (first != nullptr) {
+      first->Release();
+    }
+    first = earliest;
+  }
+  if (first != nullptr) {
+    PerfEventCache::Instance()->AddSchedEvent(SchedPerf::NEXT_RT, first->id(),
+                                              first->processor_id());
+    return first;
   }
 
   notified_.clear();
@@ -66,6 +103,9 @@ bool ChoreographyContext::Enqueue(const std::shared_ptr<CRoutine>& cr) {
                                             cr->processor_id());
   WriteLockGuard<AtomicRWLock> lock(rq_lk_);
   cr_queue_.emplace(cr->priority(), cr);
+  if (cr->deadline_aware()) {
+    ++deadline_aware_num_;
+  }
   return true;
 }
 
@@ -87,6 +127,9 @@ void ChoreographyContext::RemoveCRoutine(uint64_t crid) {
     auto cr = it->second;
     if (cr->id() == crid) {
       cr->Stop();
+      if (cr->deadline_aware()) {
+        --deadline_aware_num_;
+      }
       it = cr_queue_.erase(it);
       cr->Release();
       return;
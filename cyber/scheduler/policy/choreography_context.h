@@ -51,6 +51,8 @@ class ChoreographyContext : public ProcessorContext {
   AtomicRWLock rq_lk_;
   std::multimap<uint32_t, std::shared_ptr<CRoutine>, std::greater<uint32_t>>
       cr_queue_;
+  // guarded by rq_lk_
+  uint32_t deadline_aware_num_ = 0;
 };
 
 }  // namespace scheduler
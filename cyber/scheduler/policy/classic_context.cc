@@ -35,6 +35,8 @@ static constexpr auto MIN_SLEEP_INTERVAL = std::chrono::milliseconds(1);
 
 GRP_WQ_MUTEX ClassicContext::mtx_wq_;
 GRP_WQ_CV ClassicContext::cv_wq_;
+GRP_WQ_IDLE ClassicContext::idle_wq_;
+WS_GROUP_CTX ClassicContext::ws_group_ctxs_;
 RQ_LOCK_GROUP ClassicContext::rq_locks_;
 CR_GROUP ClassicContext::cr_group_;
 
@@ -46,11 +48,34 @@ ClassicContext::ClassicContext(const std::string& group_name) {
   InitGroup(group_name);
 }
 
+ClassicContext::ClassicContext(const std::string& group_name,
+                               uint32_t processor_index,
+                               uint32_t processor_num) {
+  InitGroup(LocalQueueName(group_name, processor_index));
+  auto& ctxs = ws_group_ctxs_[group_name];
+  if (ctxs.size() < processor_num) {
+    ctxs.resize(processor_num, nullptr);
+  }
+  ctxs[processor_index] = this;
+  for (uint32_t i = 1; i < processor_num; ++i) {
+    auto sibling =
+        LocalQueueName(group_name, (processor_index + i) % processor_num);
+    steal_rqs_.emplace_back(&cr_group_[sibling]);
+    steal_lqs_.emplace_back(&rq_locks_[sibling]);
+  }
+}
+
 void ClassicContext::InitGroup(const std::string& group_name) {
   multi_pri_rq_ = &cr_group_[group_name];
   lq_ = &rq_locks_[group_name];
   mtx_wrapper_ = &mtx_wq_[group_name];
   cw_ = &cv_wq_[group_name];
+  idle_ = &idle_wq_[group_name];
+}
+
+std::string ClassicContext::LocalQueueName(const std::string& group_name,
+                                           uint32_t processor_index) {
+  return group_name + "/" + std::to_string(processor_index);
 }
 
 std::shared_ptr<CRoutine> ClassicContext::NextRoutine() {
@@ -58,17 +83,49 @@ std::shared_ptr<CRoutine> ClassicContext::NextRoutine() {
     return nullptr;
   }
 
+  auto cr = NextRoutine(multi_pri_rq_, lq_);
+  if (cr != nullptr) {
+    return cr;
+  }
+
+  for (size_t i = 0; i < steal_rqs_.size(); ++i) {
+    cr = NextRoutine(steal_rqs_[i], steal_lqs_[i]);
+    if (cr != nullptr) {
+      return cr;
+    }
+  }
+  return nullptr;
+}
+
+std::shared_ptr<CRoutine> ClassicContext::NextRoutine(MULTI_PRIO_QUEUE* rq,
+                                                      LOCK_QUEUE* lq) {
   for (int i = MAX_PRIO - 1; i >= 0; --i) {
-    ReadLockGuard<AtomicRWLock> lk(lq_->at(i));
-    for (auto& cr : multi_pri_rq_->at(i)) {
+    ReadLockGuard<AtomicRWLock> lk(lq->at(i));
+    // deadline aware croutines lead their band, see DispatchTask
+    std::shared_ptr<CRoutine> earliest = nullptr;
+    for (auto& cr : rq->at(i)) {
+      if (earliest != nullptr && !cr->deadline_aware()) {
+        break;
+      }
       if (!cr->Acquire()) {
         continue;
       }
 
       if (cr->UpdateState() == RoutineState::READY) {
-        PerfEventCache::Instance()->AddSchedEvent(SchedPerf::NEXT_RT, cr->id(),
-                                                  cr->processor_id());
-        return cr;
+        if (!cr->deadline_aware()) {
+          PerfEventCache::Instance()->AddSchedEvent(
+              SchedPerf::NEXT_RT, cr->id(), cr->processor_id());
+          return cr;
+        }
+        if (earliest == nullptr || EarlierDeadline(*cr, *earliest)) {
+          if (earliest != nullptr) {
+            earliest->Release();
+          }
+          earliest = cr;
+        } else {
+          cr->Release();
+        }
+        continue;
       }
 
       if (unlikely(cr->state() == RoutineState::SLEEP)) {
@@ -80,6 +137,11 @@ std::shared_ptr<CRoutine> ClassicContext::NextRoutine() {
 
       cr->Release();
     }
+    if (earliest != nullptr) {
+      PerfEventCache::Instance()->AddSchedEvent(
+          SchedPerf::NEXT_RT, earliest->id(), earliest->processor_id());
+      return earliest;
+    }
   }
 
   return nullptr;
@@ -91,6 +153,7 @@ void ClassicContext::Wait() {
     return;
   }
 
+  idle_->store(true);
   if (unlikely(need_sleep_)) {
     auto duration = wake_time_ - std::chrono::steady_clock::now();
     cw_->Cv().wait_for(lk, duration);
@@ -98,6 +161,7 @@ void ClassicContext::Wait() {
   } else {
     cw_->Cv().wait(lk);
   }
+  idle_->store(false);
 }
 
 void ClassicContext::Shutdown() {
@@ -114,6 +178,23 @@ void ClassicContext::Notify(const std::string& group_name) {
   cv_wq_[group_name].Cv().notify_one();
 }
 
+void ClassicContext::Notify(const std::string& group_name,
+                            uint32_t processor_index) {
+  auto& ctxs = ws_group_ctxs_[group_name];
+  auto processor_num = ctxs.size();
+  for (size_t i = 0; i < processor_num; ++i) {
+    auto ctx = ctxs[(processor_index + i) % processor_num];
+    if (ctx != nullptr && ctx->idle_->load()) {
+      ctx->cw_->Cv().notify_one();
+      return;
+    }
+  }
+  // everybody is busy, the owner picks it up on its next scan
+  if (processor_index < processor_num && ctxs[processor_index] != nullptr) {
+    ctxs[processor_index]->cw_->Cv().notify_one();
+  }
+}
+
 }  // namespace scheduler
 }  // namespace cyber
 }  // namespace apollo
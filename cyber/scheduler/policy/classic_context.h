@@ -18,6 +18,7 @@
 #define CYBER_SCHEDULER_POLICY_CLASSIC_CONTEXT_H_
 
 #include <array>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -47,26 +48,46 @@ using RQ_LOCK_GROUP = std::unordered_map<std::string, LOCK_QUEUE>;
 
 using GRP_WQ_MUTEX = std::unordered_map<std::string, MutexWrapper>;
 using GRP_WQ_CV = std::unordered_map<std::string, CvWrapper>;
+using GRP_WQ_IDLE = std::unordered_map<std::string, std::atomic<bool>>;
+
+class ClassicContext;
+using WS_GROUP_CTX =
+    std::unordered_map<std::string, std::vector<ClassicContext*>>;
 
 class ClassicContext : public ProcessorContext {
  public:
   ClassicContext();
   explicit ClassicContext(const std::string& group_name);
+  // Work-stealing mode: the processor owns the run queue of its index in
+  // the group, and scans its siblings' queues when its own has nothing
+  // ready.
+  ClassicContext(const std::string& group_name, uint32_t processor_index,
+                 uint32_t processor_num);
 
   std::shared_ptr<CRoutine> NextRoutine() override;
   void Wait() override;
   void Shutdown() override;
 
   static void Notify(const std::string& group_name);
+  // Wake the processor owning the croutine, or an idle sibling if the
+  // owner is busy.
+  static void Notify(const std::string& group_name, uint32_t processor_index);
+
+  // Name of the run queue owned by a processor of a work-stealing group.
+  static std::string LocalQueueName(const std::string& group_name,
+                                    uint32_t processor_index);
 
   alignas(CACHELINE_SIZE) static RQ_LOCK_GROUP rq_locks_;
   alignas(CACHELINE_SIZE) static CR_GROUP cr_group_;
 
   alignas(CACHELINE_SIZE) static GRP_WQ_MUTEX mtx_wq_;
   alignas(CACHELINE_SIZE) static GRP_WQ_CV cv_wq_;
+  alignas(CACHELINE_SIZE) static GRP_WQ_IDLE idle_wq_;
+  alignas(CACHELINE_SIZE) static WS_GROUP_CTX ws_group_ctxs_;
 
  private:
   void InitGroup(const std::string& group_name);
+  std::shared_ptr<CRoutine> NextRoutine(MULTI_PRIO_QUEUE* rq, LOCK_QUEUE* lq);
 
   std::chrono::steady_clock::time_point wake_time_;
   bool need_sleep_ = false;
@@ -75,6 +96,11 @@ class ClassicContext : public ProcessorContext {
   LOCK_QUEUE *lq_ = nullptr;
   MutexWrapper *mtx_wrapper_ = nullptr;
   CvWrapper *cw_ = nullptr;
+  std::atomic<bool> *idle_ = nullptr;
+
+  // sibling run queues to steal from, empty if not in work-stealing mode
+  std::vector<MULTI_PRIO_QUEUE*> steal_rqs_;
+  std::vector<LOCK_QUEUE*> steal_lqs_;
 };
 
 }  // namespace scheduler
@@ -62,6 +62,9 @@ SchedulerChoreography::SchedulerChoreography() {
         cfg.scheduler_conf().choreography_conf().choreography_processor_prio();
     ParseCpuset(cfg.scheduler_conf().choreography_conf().choreography_cpuset(),
                 &choreography_cpuset_);
+    ParseNumaNode(
+        cfg.scheduler_conf().choreography_conf().choreography_numa_node(),
+        &choreography_cpuset_, &choreography_affinity_);
 
     task_pool_size_ =
         cfg.scheduler_conf().choreography_conf().pool_processor_num();
@@ -72,6 +75,8 @@ SchedulerChoreography::SchedulerChoreography() {
         cfg.scheduler_conf().choreography_conf().pool_processor_prio();
     ParseCpuset(cfg.scheduler_conf().choreography_conf().pool_cpuset(),
                 &pool_cpuset_);
+    ParseNumaNode(cfg.scheduler_conf().choreography_conf().pool_numa_node(),
+                  &pool_cpuset_, &pool_affinity_);
 
     for (auto& thr : cfg.scheduler_conf().choreography_conf().threads()) {
       inner_thr_confs_[thr.name()] = thr;
@@ -288,6 +293,7 @@ bool SchedulerChoreography::NotifyProcessor(uint64_t crid) {
 
 void SchedulerChoreography::SetInnerThreadAttr(const std::string& name,
                                                std::thread* thr) {
+  Scheduler::SetInnerThreadAttr(name, thr);
   if (thr != nullptr && inner_thr_confs_.find(name) != inner_thr_confs_.end()) {
     auto th_conf = inner_thr_confs_[name];
     auto cpuset = th_conf.cpuset();
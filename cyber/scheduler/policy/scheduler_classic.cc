@@ -84,14 +84,24 @@ void SchedulerClassic::CreateProcessor() {
       task_pool_size_ = proc_num;
     }
 
-    auto& affinity = group.affinity();
+    auto affinity = group.affinity();
     auto& processor_policy = group.processor_policy();
     auto processor_prio = group.processor_prio();
     std::vector<int> cpuset;
     ParseCpuset(group.cpuset(), &cpuset);
+    ParseNumaNode(group.numa_node(), &cpuset, &affinity);
+
+    if (group.work_stealing() && proc_num > 0) {
+      ws_groups_[group_name] = proc_num;
+    }
 
     for (uint32_t i = 0; i < proc_num; i++) {
-      auto ctx = std::make_shared<ClassicContext>(group_name);
+      std::shared_ptr<ClassicContext> ctx = nullptr;
+      if (group.work_stealing()) {
+        ctx = std::make_shared<ClassicContext>(group_name, i, proc_num);
+      } else {
+        ctx = std::make_shared<ClassicContext>(group_name);
+      }
       pctxs_.emplace_back(ctx);
 
       auto proc = std::make_shared<Processor>();
@@ -142,20 +152,45 @@ bool SchedulerClassic::DispatchTask(const std::shared_ptr<CRoutine>& cr) {
     cr->set_priority(MAX_PRIO - 1);
   }
 
+  // Spread croutines of work-stealing groups over the processors.
+  auto ws_group = ws_groups_.find(cr->group_name());
+  if (ws_group != ws_groups_.end()) {
+    cr->set_processor_id(next_home_.fetch_add(1) % ws_group->second);
+  }
+
   // Enqueue task.
+  auto rq_name = RunQueueName(cr);
   {
     WriteLockGuard<AtomicRWLock> lk(
-        ClassicContext::rq_locks_[cr->group_name()].at(cr->priority()));
-    ClassicContext::cr_group_[cr->group_name()].at(cr->priority())
-        .emplace_back(cr);
+        ClassicContext::rq_locks_[rq_name].at(cr->priority()));
+    auto& queue = ClassicContext::cr_group_[rq_name].at(cr->priority());
+    // deadline aware croutines go first so a band without any keeps the
+    // plain first ready pick
+    if (cr->deadline_aware()) {
+      queue.insert(queue.begin(), cr);
+    } else {
+      queue.emplace_back(cr);
+    }
   }
 
   PerfEventCache::Instance()->AddSchedEvent(SchedPerf::RT_CREATE, cr->id(),
                                             cr->processor_id());
-  ClassicContext::Notify(cr->group_name());
+  if (ws_group != ws_groups_.end()) {
+    ClassicContext::Notify(cr->group_name(), cr->processor_id());
+  } else {
+    ClassicContext::Notify(cr->group_name());
+  }
   return true;
 }
 
+std::string SchedulerClassic::RunQueueName(
+    const std::shared_ptr<CRoutine>& cr) {
+  if (ws_groups_.find(cr->group_name()) == ws_groups_.end()) {
+    return cr->group_name();
+  }
+  return ClassicContext::LocalQueueName(cr->group_name(), cr->processor_id());
+}
+
 bool SchedulerClassic::NotifyProcessor(uint64_t crid) {
   if (unlikely(stop_)) {
     return true;
@@ -169,7 +204,12 @@ bool SchedulerClassic::NotifyProcessor(uint64_t crid) {
         cr->SetUpdateFlag();
       }
 
-      ClassicContext::Notify(cr->group_name());
+      if (cr->processor_id() >= 0 &&
+          ws_groups_.find(cr->group_name()) != ws_groups_.end()) {
+        ClassicContext::Notify(cr->group_name(), cr->processor_id());
+      } else {
+        ClassicContext::Notify(cr->group_name());
+      }
       return true;
     }
   }
@@ -208,7 +248,7 @@ bool SchedulerClassic::RemoveCRoutine(uint64_t crid) {
     if (id_cr_.find(crid) != id_cr_.end()) {
       cr = id_cr_[crid];
       prio = cr->priority();
-      group_name = cr->group_name();
+      group_name = RunQueueName(cr);
       id_cr_[crid]->Stop();
       id_cr_.erase(crid);
     } else {
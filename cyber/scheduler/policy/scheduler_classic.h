@@ -17,6 +17,7 @@
 #ifndef CYBER_SCHEDULER_POLICY_SCHEDULER_CLASSIC_H_
 #define CYBER_SCHEDULER_POLICY_SCHEDULER_CLASSIC_H_
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -46,8 +47,13 @@ class SchedulerClassic : public Scheduler {
 
   void CreateProcessor();
   bool NotifyProcessor(uint64_t crid) override;
+  // run queue a croutine lives in, per processor in work-stealing groups
+  std::string RunQueueName(const std::shared_ptr<CRoutine>& cr);
 
   std::unordered_map<std::string, ClassicTask> cr_confs_;
+  // work-stealing group name -> processor num
+  std::unordered_map<std::string, uint32_t> ws_groups_;
+  std::atomic<uint32_t> next_home_ = {0};
 
   ClassicConf classic_conf_;
 };
@@ -16,10 +16,14 @@
 
 #include "cyber/scheduler/processor.h"
 
+#include <pthread.h>
 #include <sched.h>
 #include <sys/resource.h>
 #include <sys/syscall.h>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <string>
 
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
@@ -78,12 +82,31 @@ void Processor::SetSchedPolicy(std::string spolicy, int sched_priority) {
 
 void Processor::Run() {
   tid_.store(static_cast<int>(syscall(SYS_gettid)));
+  // the croutine threads share a name so that their CPU time can be told
+  // apart from the other threads of the process
+  static std::atomic<int> num_processors(0);
+  const std::string name = "processor_" + std::to_string(num_processors++);
+  pthread_setname_np(pthread_self(), name.c_str());
 
   while (likely(running_.load())) {
     if (likely(context_ != nullptr)) {
       auto croutine = context_->NextRoutine();
       if (croutine) {
+        auto start = std::chrono::steady_clock::now();
+        auto wait_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                           start - croutine->ready_time())
+                           .count();
         croutine->Resume();
+        auto run_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+        // a croutine woken up ahead of its wake time has no wait latency
+        wait_us = std::max<int64_t>(wait_us, 0);
+        auto stats = croutine->mutable_stats();
+        stats->wait_latency.Add(wait_us);
+        stats->run_time.Add(run_us);
+        wait_latency_.Add(wait_us);
+        run_time_.Add(run_us);
         croutine->Release();
       } else {
         context_->Wait();
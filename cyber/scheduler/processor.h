@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "cyber/croutine/croutine.h"
+#include "cyber/croutine/routine_stats.h"
 #include "cyber/proto/scheduler_conf.pb.h"
 
 namespace apollo {
@@ -47,6 +48,13 @@ class Processor {
   void SetAffinity(const std::vector<int>&, const std::string&, int);
   void SetSchedPolicy(std::string spolicy, int sched_priority);
 
+  pid_t tid() const { return tid_.load(); }
+  // only written by the processor thread
+  const croutine::LatencyHistogram& wait_latency() const {
+    return wait_latency_;
+  }
+  const croutine::LatencyHistogram& run_time() const { return run_time_; }
+
  private:
   std::shared_ptr<ProcessorContext> context_;
 
@@ -57,6 +65,9 @@ class Processor {
 
   std::atomic<pid_t> tid_{-1};
   std::atomic<bool> running_{false};
+
+  croutine::LatencyHistogram wait_latency_;
+  croutine::LatencyHistogram run_time_;
 };
 
 }  // namespace scheduler
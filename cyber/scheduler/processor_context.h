@@ -32,6 +32,18 @@ using croutine::CRoutine;
 
 class Processor;
 
+// Earliest deadline first order of deadline aware croutines, a croutine that
+// has not inherited a deadline yet goes last.
+inline bool EarlierDeadline(const CRoutine& lhs, const CRoutine& rhs) {
+  auto lhs_deadline = lhs.deadline() == 0
+                          ? std::numeric_limits<uint64_t>::max()
+                          : lhs.deadline();
+  auto rhs_deadline = rhs.deadline() == 0
+                          ? std::numeric_limits<uint64_t>::max()
+                          : rhs.deadline();
+  return lhs_deadline < rhs_deadline;
+}
+
 class ProcessorContext {
  public:
   virtual void Shutdown();
@@ -21,6 +21,7 @@
 #include "cyber/common/environment.h"
 #include "cyber/common/file.h"
 #include "cyber/common/global_data.h"
+#include "cyber/common/numa.h"
 #include "cyber/common/util.h"
 #include "cyber/data/data_visitor.h"
 #include "cyber/event/perf_event_cache.h"
@@ -32,15 +33,38 @@ namespace cyber {
 namespace scheduler {
 
 using apollo::cyber::common::GlobalData;
+using apollo::cyber::common::NumaTopology;
+using apollo::cyber::croutine::LatencyHistogram;
+
+namespace {
+
+void FillHistogram(const LatencyHistogram& histogram, bool with_buckets,
+                   proto::HistogramStats* stats) {
+  stats->set_count(histogram.count());
+  stats->set_sum_us(histogram.sum_us());
+  stats->set_max_us(histogram.max_us());
+  stats->set_p50_us(histogram.Percentile(50.0));
+  stats->set_p99_us(histogram.Percentile(99.0));
+  if (with_buckets) {
+    for (int i = 0; i < LatencyHistogram::kBucketNum; ++i) {
+      stats->add_buckets(histogram.bucket(i));
+    }
+  }
+}
+
+}  // namespace
 
 bool Scheduler::CreateTask(const RoutineFactory& factory,
                            const std::string& name) {
-  return CreateTask(factory.create_routine(), name, factory.GetDataVisitor());
+  return CreateTask(factory.create_routine(), name, factory.GetDataVisitor(),
+                    factory.stack_size, factory.deadline);
 }
 
 bool Scheduler::CreateTask(std::function<void()>&& func,
                            const std::string& name,
-                           std::shared_ptr<DataVisitorBase> visitor) {
+                           std::shared_ptr<DataVisitorBase> visitor,
+                           size_t stack_size,
+                           RoutineFactory::DeadlineFunc deadline) {
   if (unlikely(stop_.load())) {
     ADEBUG << "scheduler is stoped, cannot create task!";
     return false;
@@ -48,15 +72,28 @@ bool Scheduler::CreateTask(std::function<void()>&& func,
 
   auto task_id = GlobalData::RegisterTaskName(name);
 
-  auto cr = std::make_shared<CRoutine>(func);
+  auto cr = std::make_shared<CRoutine>(func, stack_size);
   cr->set_id(task_id);
   cr->set_name(name);
+  cr->set_deadline_aware(visitor != nullptr && deadline != nullptr);
 
   if (!DispatchTask(cr)) {
     return false;
   }
 
-  if (visitor != nullptr) {
+  if (visitor != nullptr && cr->deadline_aware()) {
+    // the visitor lives in the croutine function, don't hold the croutine
+    std::weak_ptr<CRoutine> weak_cr = cr;
+    visitor->RegisterNotifyCallback([this, task_id, weak_cr, deadline]() {
+      if (unlikely(stop_.load())) {
+        return;
+      }
+      if (auto cr = weak_cr.lock()) {
+        cr->set_deadline(deadline());
+      }
+      this->NotifyProcessor(task_id);
+    });
+  } else if (visitor != nullptr) {
     visitor->RegisterNotifyCallback([this, task_id, name]() {
       if (unlikely(stop_.load())) {
         return;
@@ -74,6 +111,38 @@ bool Scheduler::NotifyTask(uint64_t crid) {
   return NotifyProcessor(crid);
 }
 
+void Scheduler::GetStats(const proto::SchedulerStatsRequest& request,
+                         proto::SchedulerStats* stats) {
+  RETURN_IF_NULL(stats);
+  stats->set_process_group(GlobalData::Instance()->ProcessGroup());
+
+  bool with_buckets = request.with_buckets();
+  for (uint32_t i = 0; i < processors_.size(); ++i) {
+    auto& processor = processors_[i];
+    auto processor_stats = stats->add_processors();
+    processor_stats->set_index(i);
+    processor_stats->set_tid(processor->tid());
+    FillHistogram(processor->wait_latency(), with_buckets,
+                  processor_stats->mutable_wait_latency());
+    FillHistogram(processor->run_time(), with_buckets,
+                  processor_stats->mutable_run_time());
+  }
+
+  ReadLockGuard<AtomicRWLock> lk(id_cr_lock_);
+  for (auto& item : id_cr_) {
+    auto& cr = item.second;
+    auto routine_stats = stats->add_routines();
+    routine_stats->set_name(cr->name());
+    routine_stats->set_id(cr->id());
+    routine_stats->set_processor_id(cr->processor_id());
+    routine_stats->set_yields(cr->stats().yields.load());
+    FillHistogram(cr->stats().wait_latency, with_buckets,
+                  routine_stats->mutable_wait_latency());
+    FillHistogram(cr->stats().run_time, with_buckets,
+                  routine_stats->mutable_run_time());
+  }
+}
+
 void Scheduler::ParseCpuset(const std::string& str, std::vector<int>* cpuset) {
   std::vector<std::string> lines;
   std::stringstream ss(str);
@@ -106,6 +175,22 @@ void Scheduler::ParseCpuset(const std::string& str, std::vector<int>* cpuset) {
   }
 }
 
+void Scheduler::ParseNumaNode(int node, std::vector<int>* cpuset,
+                              std::string* affinity) {
+  if (node < 0 || !cpuset->empty()) {
+    return;
+  }
+  const auto& cpus = NumaTopology::Instance()->NodeCpus(node);
+  if (cpus.empty()) {
+    AWARN << "unknown numa node " << node << ", processors are not pinned.";
+    return;
+  }
+  cpuset->assign(cpus.begin(), cpus.end());
+  if (affinity->empty()) {
+    *affinity = "range";
+  }
+}
+
 void Scheduler::Shutdown() {
   if (unlikely(stop_.exchange(true))) {
     return;
@@ -17,6 +17,7 @@
 #ifndef CYBER_SCHEDULER_SCHEDULER_H_
 #define CYBER_SCHEDULER_SCHEDULER_H_
 
+#include <pthread.h>
 #include <unistd.h>
 #include <atomic>
 #include <map>
@@ -28,12 +29,13 @@
 #include <vector>
 
 #include "cyber/base/atomic_rw_lock.h"
-#include "cyber/base/atomic_hash_map.h"
+#include "cyber/base/resizable_atomic_hash_map.h"
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
 #include "cyber/common/types.h"
 #include "cyber/croutine/croutine.h"
 #include "cyber/croutine/routine_factory.h"
+#include "cyber/proto/scheduler_stats.pb.h"
 #include "cyber/scheduler/common/mutex_wrapper.h"
 
 namespace apollo {
@@ -42,7 +44,7 @@ namespace scheduler {
 
 using apollo::cyber::base::AtomicRWLock;
 using apollo::cyber::base::ReadLockGuard;
-using apollo::cyber::base::AtomicHashMap;
+using apollo::cyber::base::ResizableAtomicHashMap;
 using apollo::cyber::croutine::CRoutine;
 using apollo::cyber::croutine::RoutineFactory;
 using apollo::cyber::data::DataVisitorBase;
@@ -57,15 +59,27 @@ class Scheduler {
 
   bool CreateTask(const RoutineFactory& factory, const std::string& name);
   bool CreateTask(std::function<void()>&& func, const std::string& name,
-                  std::shared_ptr<DataVisitorBase> visitor = nullptr);
+                  std::shared_ptr<DataVisitorBase> visitor = nullptr,
+                  size_t stack_size = 0,
+                  RoutineFactory::DeadlineFunc deadline = nullptr);
   bool NotifyTask(uint64_t crid);
 
   void Shutdown();
   uint32_t TaskPoolSize() { return task_pool_size_; }
 
+  // Snapshot of the per-processor and per-croutine scheduling histograms.
+  void GetStats(const proto::SchedulerStatsRequest& request,
+                proto::SchedulerStats* stats);
+
   virtual bool RemoveTask(const std::string& name) = 0;
+  // Names an inner thread of cyber so that its CPU time shows apart in
+  // /proc; a policy may also apply the thread's configured attributes.
   virtual void SetInnerThreadAttr(const std::string& name,
-                                  std::thread* thr) {}
+                                  std::thread* thr) {
+    if (thr != nullptr) {
+      pthread_setname_np(thr->native_handle(), name.c_str());
+    }
+  }
 
   virtual bool DispatchTask(const std::shared_ptr<CRoutine>&) = 0;
   virtual bool NotifyProcessor(uint64_t crid) = 0;
@@ -74,9 +88,13 @@ class Scheduler {
  protected:
   Scheduler() : stop_(false) {}
   void ParseCpuset(const std::string&, std::vector<int>*);
+  // Fills an empty cpuset with the cpus of a NUMA node and defaults the
+  // affinity to "range". Does nothing for a negative node.
+  void ParseNumaNode(int node, std::vector<int>* cpuset,
+                     std::string* affinity);
 
   AtomicRWLock id_cr_lock_;
-  AtomicHashMap<uint64_t, MutexWrapper*> id_map_mutex_;
+  ResizableAtomicHashMap<uint64_t, MutexWrapper*> id_map_mutex_;
   std::mutex cr_wl_mtx_;
 
   std::unordered_map<uint64_t, std::shared_ptr<CRoutine>> id_cr_;
@@ -45,6 +45,41 @@ TEST(SchedulerPolicyTest, choreo) {
   ctx->Shutdown();
 }
 
+TEST(SchedulerPolicyTest, choreo_deadline) {
+  auto ctx = std::make_shared<ChoreographyContext>();
+  auto create = [&ctx](const std::string& name, uint32_t prio,
+                       uint64_t deadline) {
+    auto cr = std::make_shared<CRoutine>(func);
+    cr->set_id(GlobalData::RegisterTaskName(name));
+    cr->set_priority(prio);
+    if (deadline > 0) {
+      cr->set_deadline_aware(true);
+      cr->set_deadline(deadline);
+    }
+    EXPECT_TRUE(ctx->Enqueue(cr));
+    return cr;
+  };
+  auto plain = create("choreo_plain", 0, 0);
+  auto late = create("choreo_late", 0, 200);
+  auto early = create("choreo_early", 0, 100);
+
+  // earliest deadline first within the band, before croutines without one
+  auto cr = ctx->NextRoutine();
+  EXPECT_EQ(early, cr);
+  cr->Release();
+  early->set_deadline(300);
+  cr = ctx->NextRoutine();
+  EXPECT_EQ(late, cr);
+  cr->Release();
+
+  // a higher band still wins
+  auto urgent = create("choreo_urgent", 1, 0);
+  cr = ctx->NextRoutine();
+  EXPECT_EQ(urgent, cr);
+  cr->Release();
+  ctx->Shutdown();
+}
+
 TEST(SchedulerPolicyTest, classic) {
   auto processor = std::make_shared<Processor>();
   auto ctx = std::make_shared<ClassicContext>();
@@ -73,6 +108,32 @@ TEST(SchedulerPolicyTest, classic) {
   processor->Stop();
 }
 
+TEST(SchedulerPolicyTest, classic_work_stealing) {
+  auto ctx0 = std::make_shared<ClassicContext>("ws_grp", 0, 2);
+  auto ctx1 = std::make_shared<ClassicContext>("ws_grp", 1, 2);
+
+  std::shared_ptr<CRoutine> cr = std::make_shared<CRoutine>(func);
+  cr->set_id(GlobalData::RegisterTaskName("ws_task"));
+  cr->set_processor_id(1);
+  auto& rq = ClassicContext::cr_group_[ClassicContext::LocalQueueName(
+      "ws_grp", 1)];
+  rq.at(0).emplace_back(cr);
+
+  // processor 0 has nothing of its own and steals from processor 1
+  auto next = ctx0->NextRoutine();
+  EXPECT_EQ(next, cr);
+  // a routine is never handed out twice
+  EXPECT_EQ(ctx1->NextRoutine(), nullptr);
+  next->Release();
+  EXPECT_EQ(ctx1->NextRoutine(), cr);
+  cr->Release();
+
+  rq.at(0).clear();
+  ctx0->Shutdown();
+  ctx1->Shutdown();
+  EXPECT_EQ(ctx0->NextRoutine(), nullptr);
+}
+
 TEST(SchedulerPolicyTest, sched_classic) {
   // read example_sched_classic.conf
   GlobalData::Instance()->SetProcessGroup("example_sched_classic");
@@ -17,6 +17,7 @@
 #ifndef CYBER_SERVICE_CLIENT_H_
 #define CYBER_SERVICE_CLIENT_H_
 
+#include <chrono>
 #include <future>
 #include <map>
 #include <memory>
@@ -31,6 +32,8 @@
 
 #include "cyber/node/node_channel_impl.h"
 #include "cyber/service/client_base.h"
+#include "cyber/service/local_service_registry.h"
+#include "cyber/service/service_stats.h"
 
 namespace apollo {
 namespace cyber {
@@ -50,7 +53,9 @@ class Client : public ClientBase {
         node_name_(node_name),
         request_channel_(service_name + SRV_CHANNEL_REQ_SUFFIX),
         response_channel_(service_name + SRV_CHANNEL_RES_SUFFIX),
-        sequence_number_(0) {}
+        sequence_number_(0),
+        latency_(service::ServiceStats::Instance()->GetService(service_name)) {
+  }
 
   Client() = delete;
 
@@ -80,6 +85,15 @@ class Client : public ClientBase {
   }
 
  private:
+  using LocalEndpoint = service::LocalServiceEndpoint<Request, Response>;
+
+  static uint64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  std::shared_ptr<LocalEndpoint> FindLocalEndpoint();
   void HandleResponse(const std::shared_ptr<Response>& response,
                       const transport::MessageInfo& request_info);
   bool IsInit(void) const { return response_receiver_ != nullptr; }
@@ -90,8 +104,9 @@ class Client : public ClientBase {
                      const transport::MessageInfo&)>
       response_callback_;
 
-  std::unordered_map<uint64_t,
-                     std::tuple<SharedPromise, CallbackType, SharedFuture>>
+  // promise, callback, future and send time of a request
+  std::unordered_map<uint64_t, std::tuple<SharedPromise, CallbackType,
+                                          SharedFuture, uint64_t>>
       pending_requests_;
   std::mutex pending_requests_mutex_;
 
@@ -102,6 +117,11 @@ class Client : public ClientBase {
 
   transport::Identity writer_id_;
   uint64_t sequence_number_;
+
+  // the service if it lives in this process, requests then skip the
+  // transport and are neither serialized nor copied
+  std::weak_ptr<LocalEndpoint> local_endpoint_;
+  service::ServiceLatency* latency_;
 };
 
 template <typename Request, typename Response>
@@ -194,20 +214,46 @@ typename Client<Request, Response>::SharedFuture
 Client<Request, Response>::AsyncSendRequest(SharedRequest request,
                                             CallbackType&& cb) {
   if (IsInit()) {
+    SharedPromise call_promise = std::make_shared<Promise>();
+    SharedFuture f(call_promise->get_future());
+    const uint64_t send_time = NowNs();
+    auto endpoint = FindLocalEndpoint();
+    if (endpoint != nullptr) {
+      auto latency = latency_;
+      auto on_response = [call_promise, cb, f, send_time,
+                          latency](const SharedResponse& response) {
+        latency->Add(true, (NowNs() - send_time) / 1000);
+        call_promise->set_value(response);
+        cb(f);
+      };
+      if (endpoint->Call(request, on_response)) {
+        return f;
+      }
+    }
     std::lock_guard<std::mutex> lock(pending_requests_mutex_);
     sequence_number_++;
     transport::MessageInfo info(writer_id_, sequence_number_, writer_id_);
     request_transmitter_->Transmit(request, info);
-    SharedPromise call_promise = std::make_shared<Promise>();
-    SharedFuture f(call_promise->get_future());
-    pending_requests_[info.seq_num()] =
-        std::make_tuple(call_promise, std::forward<CallbackType>(cb), f);
+    pending_requests_[info.seq_num()] = std::make_tuple(
+        call_promise, std::forward<CallbackType>(cb), f, send_time);
     return f;
   } else {
     return std::shared_future<std::shared_ptr<Response>>();
   }
 }
 
+template <typename Request, typename Response>
+std::shared_ptr<typename Client<Request, Response>::LocalEndpoint>
+Client<Request, Response>::FindLocalEndpoint() {
+  auto endpoint = local_endpoint_.lock();
+  if (endpoint == nullptr) {
+    endpoint = service::LocalServiceRegistry::Instance()
+                   ->Find<Request, Response>(service_name_);
+    local_endpoint_ = endpoint;
+  }
+  return endpoint;
+}
+
 template <typename Request, typename Response>
 bool Client<Request, Response>::ServiceIsReady() const {
   return true;
@@ -230,6 +276,7 @@ void Client<Request, Response>::HandleResponse(
   auto call_promise = std::get<0>(tuple);
   auto callback = std::get<1>(tuple);
   auto future = std::get<2>(tuple);
+  latency_->Add(false, (NowNs() - std::get<3>(tuple)) / 1000);
   this->pending_requests_.erase(sequence_number);
   call_promise->set_value(response);
   callback(future);
@@ -0,0 +1,138 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#ifndef CYBER_SERVICE_LOCAL_SERVICE_REGISTRY_H_
+#define CYBER_SERVICE_LOCAL_SERVICE_REGISTRY_H_
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+
+#include "cyber/common/macros.h"
+
+namespace apollo {
+namespace cyber {
+namespace service {
+
+/**
+ * @class LocalServiceEndpoint
+ * @brief Entry point of a service for clients of the same process.
+ *
+ * Requests and responses are handed over as shared pointers, so nothing is
+ * serialized or copied. Once closed, calls fail and the client falls back
+ * to the transport.
+ */
+template <typename Request, typename Response>
+class LocalServiceEndpoint {
+ public:
+  using ResponseCallback =
+      std::function<void(const std::shared_ptr<Response>&)>;
+  using Handler = std::function<void(const std::shared_ptr<Request>&,
+                                     const ResponseCallback&)>;
+
+  explicit LocalServiceEndpoint(Handler handler)
+      : handler_(std::move(handler)) {}
+
+  bool Call(const std::shared_ptr<Request>& request,
+            const ResponseCallback& callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!handler_) {
+      return false;
+    }
+    handler_(request, callback);
+    return true;
+  }
+
+  // After Close returns no handler call is running or will start.
+  void Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    handler_ = nullptr;
+  }
+
+ private:
+  std::mutex mutex_;
+  Handler handler_;
+};
+
+/**
+ * @class LocalServiceRegistry
+ * @brief The services of this process by name, checked against the
+ * request and response types the clients expect.
+ */
+class LocalServiceRegistry {
+ public:
+  template <typename Request, typename Response>
+  using EndpointPtr = std::shared_ptr<LocalServiceEndpoint<Request, Response>>;
+
+  template <typename Request, typename Response>
+  bool Register(const std::string& service_name,
+                const EndpointPtr<Request, Response>& endpoint) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return endpoints_
+        .emplace(service_name, Entry{TypeOf<Request, Response>(), endpoint})
+        .second;
+  }
+
+  // Only removes the endpoint if it is still the registered one.
+  void Unregister(const std::string& service_name, const void* endpoint) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = endpoints_.find(service_name);
+    if (it != endpoints_.end() && it->second.endpoint.get() == endpoint) {
+      endpoints_.erase(it);
+    }
+  }
+
+  template <typename Request, typename Response>
+  EndpointPtr<Request, Response> Find(const std::string& service_name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = endpoints_.find(service_name);
+    if (it == endpoints_.end() ||
+        it->second.type != TypeOf<Request, Response>()) {
+      return nullptr;
+    }
+    return std::static_pointer_cast<LocalServiceEndpoint<Request, Response>>(
+        it->second.endpoint);
+  }
+
+ private:
+  struct Entry {
+    std::type_index type;
+    std::shared_ptr<void> endpoint;
+  };
+
+  template <typename Request, typename Response>
+  static std::type_index TypeOf() {
+    return std::type_index(typeid(LocalServiceEndpoint<Request, Response>));
+  }
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, Entry> endpoints_;
+
+  DECLARE_SINGLETON(LocalServiceRegistry)
+};
+
+inline LocalServiceRegistry::LocalServiceRegistry() {}
+
+}  // namespace service
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_SERVICE_LOCAL_SERVICE_REGISTRY_H_
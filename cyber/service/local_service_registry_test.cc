@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/service/local_service_registry.h"
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace service {
+
+using Endpoint = LocalServiceEndpoint<std::string, int>;
+
+std::shared_ptr<Endpoint> MakeLengthEndpoint() {
+  return std::make_shared<Endpoint>(
+      [](const std::shared_ptr<std::string>& request,
+         const Endpoint::ResponseCallback& callback) {
+        callback(std::make_shared<int>(static_cast<int>(request->size())));
+      });
+}
+
+TEST(LocalServiceRegistryTest, call_registered_endpoint) {
+  auto registry = LocalServiceRegistry::Instance();
+  auto endpoint = MakeLengthEndpoint();
+  EXPECT_TRUE(registry->Register("/local/length", endpoint));
+  EXPECT_FALSE(registry->Register("/local/length", MakeLengthEndpoint()));
+
+  auto found = registry->Find<std::string, int>("/local/length");
+  ASSERT_EQ(endpoint, found);
+  auto request = std::make_shared<std::string>("hello");
+  int length = 0;
+  EXPECT_TRUE(found->Call(request, [&length](const std::shared_ptr<int>& r) {
+    length = *r;
+  }));
+  EXPECT_EQ(5, length);
+
+  // types other than the registered ones never match
+  EXPECT_EQ(nullptr, (registry->Find<std::string, double>("/local/length")));
+  EXPECT_EQ(nullptr, (registry->Find<std::string, int>("/local/unknown")));
+
+  // only the registered endpoint unregisters its name
+  auto other = MakeLengthEndpoint();
+  registry->Unregister("/local/length", other.get());
+  EXPECT_NE(nullptr, (registry->Find<std::string, int>("/local/length")));
+  registry->Unregister("/local/length", endpoint.get());
+  EXPECT_EQ(nullptr, (registry->Find<std::string, int>("/local/length")));
+}
+
+TEST(LocalServiceRegistryTest, closed_endpoint) {
+  auto endpoint = MakeLengthEndpoint();
+  endpoint->Close();
+  bool called = false;
+  EXPECT_FALSE(endpoint->Call(std::make_shared<std::string>("x"),
+                              [&called](const std::shared_ptr<int>&) {
+                                called = true;
+                              }));
+  EXPECT_FALSE(called);
+}
+
+}  // namespace service
+}  // namespace cyber
+}  // namespace apollo
@@ -25,6 +25,7 @@
 #include "cyber/common/types.h"
 #include "cyber/node/node_channel_impl.h"
 #include "cyber/scheduler/scheduler.h"
+#include "cyber/service/local_service_registry.h"
 #include "cyber/service/service_base.h"
 
 namespace apollo {
@@ -52,19 +53,19 @@ class Service : public ServiceBase {
         response_channel_(service_name + SRV_CHANNEL_RES_SUFFIX) {}
 
   Service() = delete;
-  ~Service() {
-    inited_ = false;
-    condition_.notify_all();
-    if (thread_.joinable()) {
-      thread_.join();
-    }
-  }
+  ~Service() { destroy(); }
   bool Init();
   void destroy();
 
  private:
+  using LocalEndpoint = service::LocalServiceEndpoint<Request, Response>;
+
   void HandleRequest(const std::shared_ptr<Request>& request,
                      const transport::MessageInfo& message_info);
+  void HandleLocalRequest(
+      const std::shared_ptr<Request>& request,
+      const typename LocalEndpoint::ResponseCallback& callback);
+  void CloseLocalEndpoint();
 
   void SendResponse(const transport::MessageInfo& message_info,
                     const std::shared_ptr<Response>& response);
@@ -81,6 +82,8 @@ class Service : public ServiceBase {
   std::string request_channel_;
   std::string response_channel_;
   std::mutex service_handle_request_mutex_;
+  // serves the clients of this process without the transport
+  std::shared_ptr<LocalEndpoint> local_endpoint_;
 
   volatile bool inited_;
   void Enqueue(std::function<void()>&& task);
@@ -93,6 +96,7 @@ class Service : public ServiceBase {
 
 template <typename Request, typename Response>
 void Service<Request, Response>::destroy() {
+  CloseLocalEndpoint();
   inited_ = false;
   condition_.notify_all();
   if (thread_.joinable()) {
@@ -171,9 +175,35 @@ bool Service<Request, Response>::Init() {
     response_transmitter_.reset();
     return false;
   }
+
+  local_endpoint_ = std::make_shared<LocalEndpoint>(
+      [this](const std::shared_ptr<Request>& request,
+             const typename LocalEndpoint::ResponseCallback& callback) {
+        Enqueue([this, request, callback]() {
+          this->HandleLocalRequest(request, callback);
+        });
+      });
+  if (!service::LocalServiceRegistry::Instance()->Register(
+          service_name_, local_endpoint_)) {
+    AWARN << "Service " << service_name_
+          << " is already served in this process, serving it over the "
+             "transport only.";
+    local_endpoint_.reset();
+  }
   return true;
 }
 
+template <typename Request, typename Response>
+void Service<Request, Response>::CloseLocalEndpoint() {
+  if (local_endpoint_ == nullptr) {
+    return;
+  }
+  local_endpoint_->Close();
+  service::LocalServiceRegistry::Instance()->Unregister(service_name_,
+                                                        local_endpoint_.get());
+  local_endpoint_.reset();
+}
+
 template <typename Request, typename Response>
 void Service<Request, Response>::HandleRequest(
     const std::shared_ptr<Request>& request,
@@ -191,6 +221,20 @@ void Service<Request, Response>::HandleRequest(
   SendResponse(msg_info, response);
 }
 
+template <typename Request, typename Response>
+void Service<Request, Response>::HandleLocalRequest(
+    const std::shared_ptr<Request>& request,
+    const typename LocalEndpoint::ResponseCallback& callback) {
+  if (!IsInit()) {
+    return;
+  }
+  ADEBUG << "handling local request:" << request_channel_;
+  std::lock_guard<std::mutex> lk(service_handle_request_mutex_);
+  auto response = std::make_shared<Response>();
+  service_callback_(request, response);
+  callback(response);
+}
+
 template <typename Request, typename Response>
 void Service<Request, Response>::SendResponse(
     const transport::MessageInfo& message_info,
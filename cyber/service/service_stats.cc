@@ -0,0 +1,64 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/service/service_stats.h"
+
+#include "cyber/common/global_data.h"
+
+namespace apollo {
+namespace cyber {
+namespace service {
+
+namespace {
+
+void FillHistogram(const LatencyHistogram& histogram,
+                   proto::HistogramStats* stats) {
+  stats->set_count(histogram.count());
+  stats->set_sum_us(histogram.sum_us());
+  stats->set_max_us(histogram.max_us());
+  stats->set_p50_us(histogram.Percentile(50));
+  stats->set_p99_us(histogram.Percentile(99));
+}
+
+}  // namespace
+
+ServiceStats::ServiceStats() {}
+
+ServiceLatency* ServiceStats::GetService(const std::string& service_name) {
+  std::lock_guard<std::mutex> lock(services_mutex_);
+  auto& latency = services_[service_name];
+  if (latency == nullptr) {
+    latency.reset(new ServiceLatency(service_name));
+  }
+  return latency.get();
+}
+
+void ServiceStats::GetStats(proto::ServiceStats* stats) {
+  stats->set_process_group(common::GlobalData::Instance()->ProcessGroup());
+  std::lock_guard<std::mutex> lock(services_mutex_);
+  for (auto& item : services_) {
+    const ServiceLatency& service = *item.second;
+    auto latency = stats->add_services();
+    latency->set_service_name(service.service_name());
+    FillHistogram(service.intra_latency(), latency->mutable_intra_latency());
+    FillHistogram(service.rtps_latency(), latency->mutable_rtps_latency());
+  }
+}
+
+}  // namespace service
+}  // namespace cyber
+}  // namespace apollo
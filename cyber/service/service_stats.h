@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#ifndef CYBER_SERVICE_SERVICE_STATS_H_
+#define CYBER_SERVICE_SERVICE_STATS_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "cyber/common/macros.h"
+#include "cyber/croutine/routine_stats.h"
+#include "cyber/proto/service_stats.pb.h"
+
+namespace apollo {
+namespace cyber {
+namespace service {
+
+using croutine::LatencyHistogram;
+
+/**
+ * @class ServiceLatency
+ * @brief Request to response latency of the clients of one service,
+ * split by the path the request took.
+ */
+class ServiceLatency {
+ public:
+  explicit ServiceLatency(const std::string& service_name)
+      : service_name_(service_name) {}
+
+  // Safe to call from any thread, responses arrive on several.
+  void Add(bool intra_process, uint64_t latency_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    (intra_process ? intra_latency_ : rtps_latency_).Add(latency_us);
+  }
+
+  const std::string& service_name() const { return service_name_; }
+  const LatencyHistogram& intra_latency() const { return intra_latency_; }
+  const LatencyHistogram& rtps_latency() const { return rtps_latency_; }
+
+ private:
+  std::string service_name_;
+  std::mutex mutex_;
+  LatencyHistogram intra_latency_;
+  LatencyHistogram rtps_latency_;
+};
+
+class ServiceStats {
+ public:
+  // The returned latency lives as long as the process.
+  ServiceLatency* GetService(const std::string& service_name);
+
+  void GetStats(proto::ServiceStats* stats);
+
+ private:
+  std::mutex services_mutex_;
+  std::unordered_map<std::string, std::unique_ptr<ServiceLatency>> services_;
+
+  DECLARE_SINGLETON(ServiceStats)
+};
+
+}  // namespace service
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_SERVICE_SERVICE_STATS_H_
@@ -0,0 +1,359 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/service_discovery/communication/host_registry.h"
+
+#include <signal.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+#include "cyber/common/log.h"
+#include "cyber/common/util.h"
+#include "cyber/time/time.h"
+
+namespace apollo {
+namespace cyber {
+namespace service_discovery {
+
+using proto::ChangeMsg;
+using proto::OperateType;
+
+namespace {
+constexpr uint32_t kMagic = 0x43544f50;  // "CTOP"
+constexpr uint32_t kSlotFree = 0;
+constexpr uint32_t kSlotBusy = 1;
+constexpr uint32_t kSlotLive = 2;
+constexpr uint64_t kReclaimIntervalNs = 1000 * 1000 * 1000;
+constexpr auto kPollInterval = std::chrono::milliseconds(5);
+}  // namespace
+
+struct HostRegistry::Header {
+  std::atomic<uint32_t> magic;
+  uint32_t slot_num;
+  uint32_t max_msg_size;
+  std::atomic<uint64_t> generation;
+};
+
+// version is a seqlock: it is odd while the slot is being rewritten.
+struct HostRegistry::Slot {
+  std::atomic<uint32_t> state;
+  std::atomic<uint32_t> version;
+  std::atomic<int32_t> owner;
+  uint32_t msg_size;
+  char msg[kMaxMsgSize];
+};
+
+HostRegistry::HostRegistry(key_t key)
+    : key_(key == 0 ? DefaultKey() : key), process_id_(getpid()) {}
+
+HostRegistry::~HostRegistry() { Shutdown(); }
+
+key_t HostRegistry::DefaultKey() {
+  std::string domain_id("80");
+  const char* val = ::getenv("CYBER_DOMAIN_ID");
+  if (val != nullptr) {
+    domain_id = val;
+  }
+  return static_cast<key_t>(
+      common::Hash("/apollo/cyber/host_registry/" + domain_id));
+}
+
+bool HostRegistry::Init() {
+  if (header_ != nullptr) {
+    return true;
+  }
+
+  size_t size = sizeof(Header) + kSlotNum * sizeof(Slot);
+  bool created = true;
+  int shmid = shmget(key_, size, 0644 | IPC_CREAT | IPC_EXCL);
+  if (shmid == -1 && errno == EEXIST) {
+    created = false;
+    shmid = shmget(key_, size, 0644);
+  }
+  if (shmid == -1) {
+    AWARN << "get host registry shm failed: " << strerror(errno);
+    return false;
+  }
+
+  void* addr = shmat(shmid, nullptr, 0);
+  if (addr == reinterpret_cast<void*>(-1)) {
+    AWARN << "attach host registry shm failed: " << strerror(errno);
+    return false;
+  }
+
+  auto header = static_cast<Header*>(addr);
+  if (created) {
+    // a new segment is zero filled, so every slot already reads as free
+    header->slot_num = kSlotNum;
+    header->max_msg_size = kMaxMsgSize;
+    header->generation.store(1);
+    header->magic.store(kMagic, std::memory_order_release);
+  } else {
+    for (int i = 0; i < 100; ++i) {
+      if (header->magic.load(std::memory_order_acquire) == kMagic) {
+        break;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (header->magic.load(std::memory_order_acquire) != kMagic ||
+        header->slot_num != kSlotNum || header->max_msg_size != kMaxMsgSize) {
+      AWARN << "incompatible host registry shm, key: " << key_;
+      shmdt(addr);
+      return false;
+    }
+  }
+  header_ = header;
+  return true;
+}
+
+void HostRegistry::Start() {
+  if (!IsActive() || running_.exchange(true)) {
+    return;
+  }
+  thread_ = std::thread(&HostRegistry::ThreadFunc, this);
+}
+
+void HostRegistry::Shutdown() {
+  if (running_.exchange(false) && thread_.joinable()) {
+    thread_.join();
+  }
+  if (header_ == nullptr) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(own_slots_mutex_);
+    for (auto& item : own_slots_) {
+      Free(item.second);
+    }
+    own_slots_.clear();
+  }
+  shmdt(header_);
+  header_ = nullptr;
+}
+
+void HostRegistry::AddListener(proto::ChangeType change_type,
+                               const ChangeFunc& func) {
+  std::lock_guard<std::mutex> lock(listeners_mutex_);
+  listeners_[change_type].push_back(func);
+}
+
+bool HostRegistry::Publish(const ChangeMsg& msg) {
+  if (!IsActive()) {
+    return false;
+  }
+
+  auto key = RoleKey(msg);
+  std::lock_guard<std::mutex> lock(own_slots_mutex_);
+  auto it = own_slots_.find(key);
+  if (msg.operate_type() == OperateType::OPT_LEAVE) {
+    if (it == own_slots_.end()) {
+      return false;
+    }
+    Free(it->second);
+    own_slots_.erase(it);
+    return true;
+  }
+
+  std::string data;
+  if (!msg.SerializeToString(&data) || data.size() > kMaxMsgSize) {
+    ADEBUG << "change msg of " << data.size() << " bytes skips host registry.";
+    if (it != own_slots_.end()) {
+      Free(it->second);
+      own_slots_.erase(it);
+    }
+    return false;
+  }
+
+  if (it != own_slots_.end()) {
+    return Store(it->second, data);
+  }
+  for (uint32_t i = 0; i < kSlotNum; ++i) {
+    uint32_t expected = kSlotFree;
+    if (slot(i)->state.compare_exchange_strong(expected, kSlotBusy)) {
+      own_slots_[key] = i;
+      return Store(i, data);
+    }
+  }
+  AWARN << "host registry is full.";
+  return false;
+}
+
+int HostRegistry::Poll() {
+  if (!IsActive()) {
+    return 0;
+  }
+
+  auto now = Time::MonoTime().ToNanosecond();
+  if (now - last_reclaim_time_ >= kReclaimIntervalNs) {
+    last_reclaim_time_ = now;
+    ReclaimDeadSlots();
+  }
+
+  uint64_t generation = header_->generation.load(std::memory_order_acquire);
+  if (generation == seen_generation_) {
+    return 0;
+  }
+
+  int changes = 0;
+  bool complete = true;
+  for (uint32_t i = 0; i < kSlotNum; ++i) {
+    auto s = slot(i);
+    auto view = views_.find(i);
+    if (s->state.load(std::memory_order_acquire) != kSlotLive) {
+      if (view != views_.end()) {
+        Report(view->second.msg, OperateType::OPT_LEAVE);
+        views_.erase(view);
+        ++changes;
+      }
+      continue;
+    }
+    if (view != views_.end() &&
+        view->second.version ==
+            s->version.load(std::memory_order_acquire)) {
+      continue;
+    }
+
+    View fresh;
+    if (!Read(i, &fresh.version, &fresh.msg)) {
+      // caught it mid write, the writer bumps the generation again
+      complete = false;
+      continue;
+    }
+    if (view != views_.end() &&
+        RoleKey(view->second.msg) != RoleKey(fresh.msg)) {
+      Report(view->second.msg, OperateType::OPT_LEAVE);
+      ++changes;
+    }
+    Report(fresh.msg, OperateType::OPT_JOIN);
+    views_[i] = fresh;
+    ++changes;
+  }
+  if (complete) {
+    seen_generation_ = generation;
+  }
+  return changes;
+}
+
+std::string HostRegistry::RoleKey(const ChangeMsg& msg) {
+  auto& attr = msg.role_attr();
+  return std::to_string(msg.change_type()) + '/' +
+         std::to_string(msg.role_type()) + '/' + attr.host_name() + '/' +
+         std::to_string(attr.process_id()) + '/' +
+         std::to_string(attr.node_id()) + '/' +
+         std::to_string(attr.channel_id()) + '/' +
+         std::to_string(attr.service_id()) + '/' + std::to_string(attr.id());
+}
+
+HostRegistry::Slot* HostRegistry::slot(uint32_t index) const {
+  return reinterpret_cast<Slot*>(reinterpret_cast<char*>(header_) +
+                                 sizeof(Header)) +
+         index;
+}
+
+bool HostRegistry::Store(uint32_t index, const std::string& data) {
+  auto s = slot(index);
+  s->owner.store(process_id_);
+  s->version.fetch_add(1, std::memory_order_acq_rel);
+  std::memcpy(s->msg, data.data(), data.size());
+  s->msg_size = static_cast<uint32_t>(data.size());
+  s->version.fetch_add(1, std::memory_order_release);
+  s->state.store(kSlotLive, std::memory_order_release);
+  header_->generation.fetch_add(1, std::memory_order_release);
+  return true;
+}
+
+void HostRegistry::Free(uint32_t index) {
+  auto s = slot(index);
+  s->state.store(kSlotFree, std::memory_order_release);
+  s->version.fetch_add(2, std::memory_order_release);
+  header_->generation.fetch_add(1, std::memory_order_release);
+}
+
+bool HostRegistry::Read(uint32_t index, uint32_t* version,
+                        ChangeMsg* msg) const {
+  auto s = slot(index);
+  uint32_t begin = s->version.load(std::memory_order_acquire);
+  if ((begin & 1) != 0 ||
+      s->state.load(std::memory_order_acquire) != kSlotLive) {
+    return false;
+  }
+  uint32_t size = s->msg_size;
+  if (size > kMaxMsgSize) {
+    return false;
+  }
+  std::string data(s->msg, size);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (s->version.load(std::memory_order_relaxed) != begin) {
+    return false;
+  }
+  *version = begin;
+  return msg->ParseFromString(data);
+}
+
+void HostRegistry::ReclaimDeadSlots() {
+  for (uint32_t i = 0; i < kSlotNum; ++i) {
+    auto s = slot(i);
+    if (s->state.load(std::memory_order_acquire) != kSlotLive) {
+      continue;
+    }
+    pid_t owner = s->owner.load();
+    if (owner == process_id_ || kill(owner, 0) == 0 || errno != ESRCH) {
+      continue;
+    }
+    uint32_t live = kSlotLive;
+    if (s->state.compare_exchange_strong(live, kSlotBusy)) {
+      ADEBUG << "reclaim host registry slot " << i << " of dead process "
+             << owner;
+      Free(i);
+    }
+  }
+}
+
+void HostRegistry::Report(const ChangeMsg& msg,
+                          proto::OperateType operate_type) {
+  ChangeMsg change(msg);
+  change.set_operate_type(operate_type);
+  std::vector<ChangeFunc> funcs;
+  {
+    std::lock_guard<std::mutex> lock(listeners_mutex_);
+    auto it = listeners_.find(change.change_type());
+    if (it == listeners_.end()) {
+      return;
+    }
+    funcs = it->second;
+  }
+  for (auto& func : funcs) {
+    func(change);
+  }
+}
+
+void HostRegistry::ThreadFunc() {
+  while (running_.load()) {
+    Poll();
+    std::this_thread::sleep_for(kPollInterval);
+  }
+}
+
+}  // namespace service_discovery
+}  // namespace cyber
+}  // namespace apollo
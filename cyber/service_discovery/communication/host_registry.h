@@ -0,0 +1,124 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#ifndef CYBER_SERVICE_DISCOVERY_COMMUNICATION_HOST_REGISTRY_H_
+#define CYBER_SERVICE_DISCOVERY_COMMUNICATION_HOST_REGISTRY_H_
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "cyber/proto/topology_change.pb.h"
+
+namespace apollo {
+namespace cyber {
+namespace service_discovery {
+
+/**
+ * @class HostRegistry
+ * @brief Topology of every cyber process on this host, kept in shared memory.
+ *
+ * Each process writes the roles it joins into slots of one SysV segment and
+ * frees them when it leaves. A poller diffs the slot table against what it
+ * has already seen and reports joins and leaves to the listeners, so a new
+ * process learns the whole local topology in one scan instead of waiting for
+ * RTPS discovery. Slots of processes that died without leaving are reclaimed.
+ */
+class HostRegistry {
+ public:
+  using ChangeFunc = std::function<void(const proto::ChangeMsg&)>;
+
+  static constexpr uint32_t kSlotNum = 1024;
+  static constexpr uint32_t kMaxMsgSize = 64 * 1024 - 16;
+
+  // key 0 derives the segment key from CYBER_DOMAIN_ID
+  explicit HostRegistry(key_t key = 0);
+  virtual ~HostRegistry();
+
+  // attaches to, or creates, the segment
+  bool Init();
+  // starts reporting changes, listeners should be added before
+  void Start();
+  // frees the slots of this process and detaches
+  void Shutdown();
+
+  bool IsActive() const { return header_ != nullptr; }
+
+  void AddListener(proto::ChangeType change_type, const ChangeFunc& func);
+
+  /**
+   * @brief Record a join or leave of a role of this process.
+   *
+   * @return false if the change is not in the registry, e.g. the message is
+   * too large or the table is full, so peers have to learn it some other way
+   */
+  bool Publish(const proto::ChangeMsg& msg);
+
+  // one poll, exposed for tests; returns the number of reported changes
+  int Poll();
+
+ private:
+  struct Header;
+  struct Slot;
+  struct View {
+    uint32_t version;
+    proto::ChangeMsg msg;
+  };
+
+  static key_t DefaultKey();
+  static std::string RoleKey(const proto::ChangeMsg& msg);
+
+  Slot* slot(uint32_t index) const;
+  bool Store(uint32_t index, const std::string& data);
+  void Free(uint32_t index);
+  bool Read(uint32_t index, uint32_t* version, proto::ChangeMsg* msg) const;
+  void ReclaimDeadSlots();
+  void Report(const proto::ChangeMsg& msg, proto::OperateType operate_type);
+  void ThreadFunc();
+
+  key_t key_;
+  Header* header_ = nullptr;
+  pid_t process_id_;
+
+  // slots written by this process, key: RoleKey
+  std::unordered_map<std::string, uint32_t> own_slots_;
+  std::mutex own_slots_mutex_;
+
+  // what the poller has reported so far, key: slot index
+  std::unordered_map<uint32_t, View> views_;
+  uint64_t seen_generation_ = 0;
+  uint64_t last_reclaim_time_ = 0;
+
+  std::unordered_map<int, std::vector<ChangeFunc>> listeners_;
+  std::mutex listeners_mutex_;
+
+  std::atomic<bool> running_ = {false};
+  std::thread thread_;
+};
+
+}  // namespace service_discovery
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_SERVICE_DISCOVERY_COMMUNICATION_HOST_REGISTRY_H_
@@ -0,0 +1,137 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/service_discovery/communication/host_registry.h"
+
+#include <gtest/gtest.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <string>
+#include <vector>
+
+namespace apollo {
+namespace cyber {
+namespace service_discovery {
+
+using proto::ChangeMsg;
+using proto::ChangeType;
+using proto::OperateType;
+using proto::RoleType;
+
+namespace {
+constexpr key_t kTestKey = 0x43545354;
+
+ChangeMsg ChannelChange(const std::string& channel, uint64_t id,
+                        OperateType operate_type) {
+  ChangeMsg msg;
+  msg.set_change_type(ChangeType::CHANGE_CHANNEL);
+  msg.set_operate_type(operate_type);
+  msg.set_role_type(RoleType::ROLE_WRITER);
+  auto attr = msg.mutable_role_attr();
+  attr->set_host_name("host");
+  attr->set_process_id(1);
+  attr->set_channel_name(channel);
+  attr->set_id(id);
+  return msg;
+}
+}  // namespace
+
+class HostRegistryTest : public ::testing::Test {
+ protected:
+  void SetUp() override { RemoveSegment(); }
+  void TearDown() override { RemoveSegment(); }
+
+  void RemoveSegment() {
+    int shmid = shmget(kTestKey, 0, 0644);
+    if (shmid != -1) {
+      shmctl(shmid, IPC_RMID, nullptr);
+    }
+  }
+};
+
+TEST_F(HostRegistryTest, join_and_leave) {
+  HostRegistry writer(kTestKey);
+  HostRegistry reader(kTestKey);
+  ASSERT_TRUE(writer.Init());
+  ASSERT_TRUE(reader.Init());
+
+  std::vector<ChangeMsg> changes;
+  reader.AddListener(ChangeType::CHANGE_CHANNEL,
+                     [&changes](const ChangeMsg& msg) {
+                       changes.push_back(msg);
+                     });
+  EXPECT_EQ(reader.Poll(), 0);
+
+  EXPECT_TRUE(writer.Publish(ChannelChange("a", 1, OperateType::OPT_JOIN)));
+  EXPECT_TRUE(writer.Publish(ChannelChange("b", 2, OperateType::OPT_JOIN)));
+  EXPECT_EQ(reader.Poll(), 2);
+  ASSERT_EQ(changes.size(), 2);
+  EXPECT_EQ(changes[0].operate_type(), OperateType::OPT_JOIN);
+  EXPECT_EQ(changes[0].role_attr().channel_name(), "a");
+  EXPECT_EQ(reader.Poll(), 0);
+
+  // joining again rewrites the slot in place
+  EXPECT_TRUE(writer.Publish(ChannelChange("a", 1, OperateType::OPT_JOIN)));
+  EXPECT_EQ(reader.Poll(), 1);
+  EXPECT_EQ(changes.back().operate_type(), OperateType::OPT_JOIN);
+
+  EXPECT_TRUE(writer.Publish(ChannelChange("a", 1, OperateType::OPT_LEAVE)));
+  EXPECT_FALSE(writer.Publish(ChannelChange("a", 1, OperateType::OPT_LEAVE)));
+  EXPECT_EQ(reader.Poll(), 1);
+  EXPECT_EQ(changes.back().operate_type(), OperateType::OPT_LEAVE);
+  EXPECT_EQ(changes.back().role_attr().channel_name(), "a");
+
+  writer.Shutdown();
+  EXPECT_EQ(reader.Poll(), 1);
+  EXPECT_EQ(changes.back().operate_type(), OperateType::OPT_LEAVE);
+  EXPECT_EQ(changes.back().role_attr().channel_name(), "b");
+}
+
+TEST_F(HostRegistryTest, late_joiner) {
+  HostRegistry writer(kTestKey);
+  ASSERT_TRUE(writer.Init());
+  for (uint64_t i = 0; i < 10; ++i) {
+    EXPECT_TRUE(writer.Publish(
+        ChannelChange("c" + std::to_string(i), i, OperateType::OPT_JOIN)));
+  }
+
+  HostRegistry reader(kTestKey);
+  ASSERT_TRUE(reader.Init());
+  int joins = 0;
+  reader.AddListener(ChangeType::CHANGE_CHANNEL,
+                     [&joins](const ChangeMsg& msg) {
+                       if (msg.operate_type() == OperateType::OPT_JOIN) {
+                         ++joins;
+                       }
+                     });
+  EXPECT_EQ(reader.Poll(), 10);
+  EXPECT_EQ(joins, 10);
+}
+
+TEST_F(HostRegistryTest, oversized) {
+  HostRegistry writer(kTestKey);
+  ASSERT_TRUE(writer.Init());
+  auto msg = ChannelChange("big", 1, OperateType::OPT_JOIN);
+  msg.mutable_role_attr()->set_proto_desc(
+      std::string(HostRegistry::kMaxMsgSize, 'x'));
+  EXPECT_FALSE(writer.Publish(msg));
+  EXPECT_FALSE(writer.Publish(ChannelChange("big", 1, OperateType::OPT_LEAVE)));
+}
+
+}  // namespace service_discovery
+}  // namespace cyber
+}  // namespace apollo
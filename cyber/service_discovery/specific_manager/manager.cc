@@ -125,6 +125,15 @@ bool Manager::Leave(const RoleAttributes& attr, RoleType role) {
   return true;
 }
 
+void Manager::SetHostRegistry(const std::shared_ptr<HostRegistry>& registry) {
+  host_registry_ = registry;
+  if (host_registry_ != nullptr) {
+    host_registry_->AddListener(
+        change_type_,
+        std::bind(&Manager::OnHostChange, this, std::placeholders::_1));
+  }
+}
+
 Manager::ChangeConnection Manager::AddChangeListener(const ChangeFunc& func) {
   return signal_.Connect(func);
 }
@@ -190,6 +199,23 @@ void Manager::OnRemoteChange(const std::string& msg_str) {
 
   ChangeMsg msg;
   RETURN_IF(!message::ParseFromString(msg_str, &msg));
+  if (IsFromSameProcess(msg)) {
+    return;
+  }
+  if (msg.host_registered() && msg.role_attr().host_name() == host_name_ &&
+      host_registry_ != nullptr && host_registry_->IsActive()) {
+    return;
+  }
+  RETURN_IF(!Check(msg.role_attr()));
+  Dispose(msg);
+}
+
+void Manager::OnHostChange(const ChangeMsg& msg) {
+  if (is_shutdown_.load()) {
+    ADEBUG << "the manager has been shut down.";
+    return;
+  }
+
   if (IsFromSameProcess(msg)) {
     return;
   }
@@ -198,13 +224,18 @@ void Manager::OnRemoteChange(const std::string& msg_str) {
 }
 
 bool Manager::Publish(const ChangeMsg& msg) {
+  bool host_registered =
+      host_registry_ != nullptr && host_registry_->Publish(msg);
+
   if (!is_discovery_started_.load()) {
     ADEBUG << "discovery is not started.";
     return true;
   }
 
+  ChangeMsg remote_msg(msg);
+  remote_msg.set_host_registered(host_registered);
   apollo::cyber::transport::UnderlayMessage m;
-  RETURN_VAL_IF(!message::SerializeToString(msg, &m.data()), false);
+  RETURN_VAL_IF(!message::SerializeToString(remote_msg, &m.data()), false);
   if (publisher_ != nullptr) {
     return publisher_->write(reinterpret_cast<void*>(&m));
   }
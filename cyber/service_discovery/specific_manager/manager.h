@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
 
@@ -31,6 +32,7 @@
 
 #include "cyber/base/signal.h"
 #include "cyber/proto/topology_change.pb.h"
+#include "cyber/service_discovery/communication/host_registry.h"
 #include "cyber/service_discovery/communication/subscriber_listener.h"
 
 namespace apollo {
@@ -64,6 +66,10 @@ class Manager {
             bool need_publish = true);
   bool Leave(const RoleAttributes& attr, RoleType role);
 
+  // learn and announce same-host changes through the registry, RTPS
+  // samples that are already in it are then dropped
+  void SetHostRegistry(const std::shared_ptr<HostRegistry>& registry);
+
   ChangeConnection AddChangeListener(const ChangeFunc& func);
   void RemoveChangeListener(const ChangeConnection& conn);
 
@@ -84,6 +90,7 @@ class Manager {
   void Notify(const ChangeMsg& msg);
   bool Publish(const ChangeMsg& msg);
   void OnRemoteChange(const std::string& msg_str);
+  void OnHostChange(const ChangeMsg& msg);
   bool IsFromSameProcess(const ChangeMsg& msg);
 
   std::atomic<bool> is_shutdown_;
@@ -96,6 +103,7 @@ class Manager {
   eprosima::fastrtps::Publisher* publisher_;
   eprosima::fastrtps::Subscriber* subscriber_;
   SubscriberListener* listener_;
+  std::shared_ptr<HostRegistry> host_registry_;
 
   ChangeSignal signal_;
 };
@@ -29,6 +29,7 @@ TopologyManager::TopologyManager()
       node_manager_(nullptr),
       channel_manager_(nullptr),
       service_manager_(nullptr),
+      host_registry_(nullptr),
       participant_(nullptr),
       participant_listener_(nullptr) {
   Init();
@@ -43,6 +44,9 @@ void TopologyManager::Shutdown() {
     return;
   }
 
+  if (host_registry_ != nullptr) {
+    host_registry_->Shutdown();
+  }
   node_manager_->Shutdown();
   channel_manager_->Shutdown();
   service_manager_->Shutdown();
@@ -73,6 +77,12 @@ bool TopologyManager::Init() {
   channel_manager_ = std::make_shared<ChannelManager>();
   service_manager_ = std::make_shared<ServiceManager>();
 
+  if (CreateHostRegistry()) {
+    node_manager_->SetHostRegistry(host_registry_);
+    channel_manager_->SetHostRegistry(host_registry_);
+    service_manager_->SetHostRegistry(host_registry_);
+  }
+
   CreateParticipant();
 
   bool result =
@@ -85,10 +95,14 @@ bool TopologyManager::Init() {
     node_manager_ = nullptr;
     channel_manager_ = nullptr;
     service_manager_ = nullptr;
+    host_registry_ = nullptr;
     init_.exchange(false);
     return false;
   }
 
+  if (host_registry_ != nullptr) {
+    host_registry_->Start();
+  }
   return true;
 }
 
@@ -104,6 +118,20 @@ bool TopologyManager::InitServiceManager() {
   return service_manager_->StartDiscovery(participant_->fastrtps_participant());
 }
 
+bool TopologyManager::CreateHostRegistry() {
+  auto& global_conf = common::GlobalData::Instance()->Config();
+  if (!global_conf.transport_conf().host_registry()) {
+    return false;
+  }
+  host_registry_ = std::make_shared<HostRegistry>();
+  if (!host_registry_->Init()) {
+    AWARN << "host registry is unavailable, use rtps discovery only.";
+    host_registry_ = nullptr;
+    return false;
+  }
+  return true;
+}
+
 bool TopologyManager::CreateParticipant() {
   std::string participant_name =
       common::GlobalData::Instance()->HostName() + '+' +
@@ -26,6 +26,7 @@
 
 #include "cyber/base/signal.h"
 #include "cyber/common/macros.h"
+#include "cyber/service_discovery/communication/host_registry.h"
 #include "cyber/service_discovery/communication/participant_listener.h"
 #include "cyber/service_discovery/specific_manager/channel_manager.h"
 #include "cyber/service_discovery/specific_manager/node_manager.h"
@@ -72,6 +73,7 @@ class TopologyManager {
   bool InitChannelManager();
   bool InitServiceManager();
 
+  bool CreateHostRegistry();
   bool CreateParticipant();
   void OnParticipantChange(const PartInfo& info);
   bool Convert(const PartInfo& info, ChangeMsg* change_msg);
@@ -82,6 +84,7 @@ class TopologyManager {
   NodeManagerPtr node_manager_;
   ChannelManagerPtr channel_manager_;
   ServiceManagerPtr service_manager_;
+  std::shared_ptr<HostRegistry> host_registry_;
   transport::ParticipantPtr participant_;
   ParticipantListener* participant_listener_;
   ChangeSignal change_signal_;
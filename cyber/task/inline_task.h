@@ -0,0 +1,155 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TASK_INLINE_TASK_H_
+#define CYBER_TASK_INLINE_TASK_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace apollo {
+namespace cyber {
+
+/**
+ * @brief A move only void() callable stored inside the object when it fits
+ * in kInlineSize bytes, which covers the lambdas and bound member functions
+ * of the task groups, and on the heap otherwise.
+ */
+class InlineTask {
+ public:
+  static constexpr size_t kInlineSize = 64;
+
+  InlineTask() = default;
+
+  template <typename F, typename = typename std::enable_if<!std::is_same<
+                            typename std::decay<F>::type, InlineTask>::value>::
+                            type>
+  InlineTask(F&& func) {  // NOLINT
+    using Functor = typename std::decay<F>::type;
+    Construct<Functor>(
+        std::forward<F>(func),
+        std::integral_constant<
+            bool, sizeof(Functor) <= kInlineSize &&
+                      alignof(Functor) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible<Functor>::value>());
+  }
+
+  InlineTask(InlineTask&& other) noexcept { MoveFrom(&other); }
+
+  InlineTask& operator=(InlineTask&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(&other);
+    }
+    return *this;
+  }
+
+  InlineTask(const InlineTask&) = delete;
+  InlineTask& operator=(const InlineTask&) = delete;
+
+  ~InlineTask() { Reset(); }
+
+  explicit operator bool() const { return ops_ != nullptr; }
+
+  void operator()() { ops_->invoke(&storage_); }
+
+  void Reset() {
+    if (ops_ != nullptr) {
+      ops_->destroy(&storage_);
+      ops_ = nullptr;
+    }
+  }
+
+ private:
+  using Storage =
+      typename std::aligned_storage<kInlineSize, alignof(std::max_align_t)>::
+          type;
+
+  struct Ops {
+    void (*invoke)(Storage* storage);
+    // moves the callable of from into the uninitialized to and destroys it
+    void (*relocate)(Storage* from, Storage* to);
+    void (*destroy)(Storage* storage);
+  };
+
+  template <typename Functor>
+  struct InlineOps {
+    static Functor* Get(Storage* storage) {
+      return reinterpret_cast<Functor*>(storage);
+    }
+    static void Invoke(Storage* storage) { (*Get(storage))(); }
+    static void Relocate(Storage* from, Storage* to) {
+      new (to) Functor(std::move(*Get(from)));
+      Get(from)->~Functor();
+    }
+    static void Destroy(Storage* storage) { Get(storage)->~Functor(); }
+    static const Ops kOps;
+  };
+
+  template <typename Functor>
+  struct HeapOps {
+    static Functor*& Get(Storage* storage) {
+      return *reinterpret_cast<Functor**>(storage);
+    }
+    static void Invoke(Storage* storage) { (*Get(storage))(); }
+    static void Relocate(Storage* from, Storage* to) {
+      *reinterpret_cast<Functor**>(to) = Get(from);
+    }
+    static void Destroy(Storage* storage) { delete Get(storage); }
+    static const Ops kOps;
+  };
+
+  template <typename Functor, typename F>
+  void Construct(F&& func, std::true_type /* inline */) {
+    new (&storage_) Functor(std::forward<F>(func));
+    ops_ = &InlineOps<Functor>::kOps;
+  }
+
+  template <typename Functor, typename F>
+  void Construct(F&& func, std::false_type /* inline */) {
+    *reinterpret_cast<Functor**>(&storage_) =
+        new Functor(std::forward<F>(func));
+    ops_ = &HeapOps<Functor>::kOps;
+  }
+
+  void MoveFrom(InlineTask* other) {
+    ops_ = other->ops_;
+    if (ops_ != nullptr) {
+      ops_->relocate(&other->storage_, &storage_);
+      other->ops_ = nullptr;
+    }
+  }
+
+  Storage storage_;
+  const Ops* ops_ = nullptr;
+};
+
+template <typename Functor>
+const InlineTask::Ops InlineTask::InlineOps<Functor>::kOps = {
+    &InlineOps<Functor>::Invoke, &InlineOps<Functor>::Relocate,
+    &InlineOps<Functor>::Destroy};
+
+template <typename Functor>
+const InlineTask::Ops InlineTask::HeapOps<Functor>::kOps = {
+    &HeapOps<Functor>::Invoke, &HeapOps<Functor>::Relocate,
+    &HeapOps<Functor>::Destroy};
+
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TASK_INLINE_TASK_H_
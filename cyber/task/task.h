@@ -20,6 +20,7 @@
 #include <future>
 #include <utility>
 
+#include "cyber/task/task_group.h"
 #include "cyber/task/task_manager.h"
 
 namespace apollo {
@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/task/task_group.h"
+
+#include "cyber/task/task_manager.h"
+
+namespace apollo {
+namespace cyber {
+
+size_t NumTaskWorkers() { return TaskManager::Instance()->NumWorkers(); }
+
+TaskGroup::TaskGroup() : state_(std::make_shared<State>()) {}
+
+size_t TaskGroup::MaxHelpers() {
+  if (!has_max_helpers_) {
+    max_helpers_ = NumTaskWorkers();
+    has_max_helpers_ = true;
+  }
+  return max_helpers_;
+}
+
+void TaskGroup::State::RunTasks(std::unique_lock<std::mutex>* lock) {
+  while (next < tasks.size()) {
+    InlineTask task = std::move(tasks[next++]);
+    lock->unlock();
+    task();
+    task.Reset();
+    lock->lock();
+    if (--num_pending == 0) {
+      done.notify_all();
+    }
+  }
+}
+
+void TaskGroup::PostHelper() {
+  // the helper holds the state, it may be dequeued after the group is gone
+  std::shared_ptr<State> state = state_;
+  const bool posted = TaskManager::Instance()->Post([state]() {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->RunTasks(&lock);
+    --state->num_helpers;
+  });
+  if (!posted) {
+    // the tasks left are run by Wait()
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    --state_->num_helpers;
+  }
+}
+
+void TaskGroup::Wait() {
+  std::unique_lock<std::mutex> lock(state_->mutex);
+  state_->RunTasks(&lock);
+  state_->done.wait(lock, [this]() { return state_->num_pending == 0; });
+  state_->tasks.clear();
+  state_->next = 0;
+}
+
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,143 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TASK_TASK_GROUP_H_
+#define CYBER_TASK_TASK_GROUP_H_
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "cyber/task/inline_task.h"
+
+namespace apollo {
+namespace cyber {
+
+/**
+ * @class TaskGroup
+ *
+ * @brief Runs a batch of tasks on the task workers of the TaskManager and
+ * waits for all of them, without a future or a heap allocation per task.
+ * The tasks are stored in the group and claimed in spawn order by at most
+ * one helper per worker and by the thread calling Wait(), which runs tasks
+ * itself instead of blocking while some are unclaimed. A group is owned by
+ * one thread and may be reused after Wait() returns, keeping its storage.
+ */
+class TaskGroup {
+ public:
+  TaskGroup();
+  ~TaskGroup() { Wait(); }
+
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+
+  template <typename F>
+  void Spawn(F&& func) {
+    const size_t max_helpers = MaxHelpers();
+    bool post = false;
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      state_->tasks.emplace_back(std::forward<F>(func));
+      ++state_->num_pending;
+      const size_t num_unclaimed = state_->tasks.size() - state_->next;
+      if (state_->num_helpers < max_helpers &&
+          state_->num_helpers < num_unclaimed) {
+        ++state_->num_helpers;
+        post = true;
+      }
+    }
+    if (post) {
+      PostHelper();
+    }
+  }
+
+  /**
+   * @brief runs the unclaimed tasks and returns once every spawned task is
+   *   done.
+   */
+  void Wait();
+
+ private:
+  struct State {
+    std::mutex mutex;
+    std::condition_variable done;
+    std::vector<InlineTask> tasks;
+    size_t next = 0;
+    size_t num_pending = 0;
+    size_t num_helpers = 0;
+
+    // runs the unclaimed tasks, called and returning with the lock held
+    void RunTasks(std::unique_lock<std::mutex>* lock);
+  };
+
+  void PostHelper();
+
+  // looked up on the first spawn, so an unused group needs no task manager
+  size_t MaxHelpers();
+
+  std::shared_ptr<State> state_;
+  bool has_max_helpers_ = false;
+  size_t max_helpers_ = 0;
+};
+
+/**
+ * @brief the number of task workers of the TaskManager
+ */
+size_t NumTaskWorkers();
+
+/**
+ * @brief Calls func(i) for every i in [begin, end) on the task workers and
+ * the calling thread, in chunks of grain_size consecutive indices. A zero
+ * grain_size splits the range into a few chunks per worker.
+ */
+template <typename F>
+void ParallelFor(const size_t begin, const size_t end, size_t grain_size,
+                 const F& func) {
+  if (begin >= end) {
+    return;
+  }
+  const size_t count = end - begin;
+  if (grain_size == 0) {
+    const size_t num_chunks = 4 * (NumTaskWorkers() + 1);
+    grain_size = (count + num_chunks - 1) / num_chunks;
+  }
+  if (grain_size >= count) {
+    for (size_t i = begin; i < end; ++i) {
+      func(i);
+    }
+    return;
+  }
+
+  TaskGroup group;
+  for (size_t first = begin; first < end; first += grain_size) {
+    const size_t last = std::min(first + grain_size, end);
+    group.Spawn([&func, first, last]() {
+      for (size_t i = first; i < last; ++i) {
+        func(i);
+      }
+    });
+  }
+  group.Wait();
+}
+
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TASK_TASK_GROUP_H_
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/task/task_group.h"
+
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "cyber/init.h"
+#include "cyber/task/inline_task.h"
+
+namespace apollo {
+namespace cyber {
+
+TEST(InlineTaskTest, inline_and_heap) {
+  int calls = 0;
+  InlineTask small([&calls]() { ++calls; });
+  small();
+  InlineTask moved(std::move(small));
+  EXPECT_FALSE(small);
+  moved();
+  EXPECT_EQ(calls, 2);
+
+  // larger than the inline storage, it is kept on the heap
+  std::vector<int> values(100, 1);
+  std::array<double, 16> padding = {};
+  auto counter = std::make_shared<int>(0);
+  InlineTask large([values, padding, counter]() { *counter += values[0]; });
+  EXPECT_EQ(counter.use_count(), 2);
+  InlineTask other;
+  other = std::move(large);
+  other();
+  EXPECT_EQ(*counter, 1);
+  other.Reset();
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(TaskGroupTest, wait_all) {
+  std::vector<int> results(1000, 0);
+  TaskGroup group;
+  for (int round = 0; round < 3; ++round) {
+    for (size_t i = 0; i < results.size(); ++i) {
+      group.Spawn([&results, i]() { ++results[i]; });
+    }
+    group.Wait();
+    for (const int result : results) {
+      EXPECT_EQ(result, round + 1);
+    }
+  }
+}
+
+TEST(TaskGroupTest, nested_spawn) {
+  std::atomic<int> count = {0};
+  TaskGroup group;
+  for (int i = 0; i < 10; ++i) {
+    group.Spawn([&group, &count]() {
+      ++count;
+      group.Spawn([&count]() { ++count; });
+    });
+  }
+  group.Wait();
+  EXPECT_EQ(count.load(), 20);
+}
+
+TEST(TaskGroupTest, parallel_for) {
+  std::vector<size_t> squares(1001, 0);
+  ParallelFor(0, squares.size(), 0,
+              [&squares](const size_t i) { squares[i] = i * i; });
+  for (size_t i = 0; i < squares.size(); ++i) {
+    EXPECT_EQ(squares[i], i * i);
+  }
+
+  std::atomic<size_t> sum = {0};
+  ParallelFor(10, 20, 3, [&sum](const size_t i) { sum += i; });
+  EXPECT_EQ(sum.load(), 145);
+  ParallelFor(5, 5, 1, [&sum](const size_t i) { sum += i; });
+  EXPECT_EQ(sum.load(), 145);
+}
+
+}  // namespace cyber
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  apollo::cyber::Init(argv[0]);
+  return RUN_ALL_TESTS();
+}
@@ -18,6 +18,7 @@
 #define CYBER_TASK_TASK_MANAGER_H_
 
 #include <atomic>
+#include <functional>
 #include <future>
 #include <memory>
 #include <string>
@@ -53,6 +54,23 @@ class TaskManager {
     return res;
   }
 
+  /**
+   * @brief Runs func on a task worker without a future to report to.
+   * @return false if the manager is shut down or its queue is full, func is
+   *   dropped then.
+   */
+  bool Post(const std::function<void()>& func) {
+    if (stop_.load() || !task_queue_->Enqueue(func)) {
+      return false;
+    }
+    for (auto& task : tasks_) {
+      scheduler::Instance()->NotifyTask(task);
+    }
+    return true;
+  }
+
+  size_t NumWorkers() const { return tasks_.size(); }
+
  private:
   uint32_t num_threads_ = 0;
   uint32_t task_queue_size_ = 1000;
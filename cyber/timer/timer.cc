@@ -55,6 +55,13 @@ void Timer::Stop() {
   }
 }
 
+std::shared_ptr<TimerStats> Timer::GetStats() const {
+  if (!started_.load()) {
+    return nullptr;
+  }
+  return tm_->GetStats(timer_id_);
+}
+
 Timer::~Timer() {
   if (timer_id_ != 0) {
     tm_->Remove(timer_id_);
@@ -73,6 +73,13 @@ class Timer {
    */
   void Stop();
 
+  /**
+   * @brief Get the lateness statistics of the timer
+   *
+   * @return nullptr if the timer is not running
+   */
+  std::shared_ptr<TimerStats> GetStats() const;
+
  private:
   TimerOption timer_opt_;
   TimerManager* tm_ = nullptr;
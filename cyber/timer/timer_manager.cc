@@ -16,6 +16,13 @@
 
 #include "cyber/timer/timer_manager.h"
 
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <cerrno>
+
+#include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/scheduler/scheduler_factory.h"
 #include "cyber/time/duration.h"
@@ -25,9 +32,23 @@ namespace apollo {
 namespace cyber {
 
 TimerManager::TimerManager()
-    : timing_wheel_(Duration(0.01)),
-      time_gran_(Duration(0.01)),
-      running_(false) {}  // default time gran = 1ms
+    : timing_wheel_(TickDuration()),
+      time_gran_(TickDuration()),
+      running_(false) {
+  auto& global_conf = common::GlobalData::Instance()->Config();
+  if (global_conf.has_timer_conf()) {
+    high_resolution_ = global_conf.timer_conf().high_resolution();
+  }
+}
+
+Duration TimerManager::TickDuration() {
+  auto& global_conf = common::GlobalData::Instance()->Config();
+  proto::TimerConf timer_conf;
+  if (global_conf.has_timer_conf()) {
+    timer_conf.CopyFrom(global_conf.timer_conf());
+  }
+  return Duration(static_cast<int64_t>(timer_conf.tick_us()) * 1000);
+}
 
 TimerManager::~TimerManager() {
   if (running_) {
@@ -68,9 +89,16 @@ void TimerManager::Remove(uint64_t timer_id) {
   timing_wheel_.StopTimer(timer_id);
 }
 
+std::shared_ptr<TimerStats> TimerManager::GetStats(uint64_t timer_id) {
+  return timing_wheel_.GetStats(timer_id);
+}
+
 bool TimerManager::IsRunning() { return running_; }
 
 void TimerManager::ThreadFuncImpl() {
+  if (high_resolution_ && RunOnTimerfd()) {
+    return;
+  }
   Rate rate(time_gran_);
   while (running_) {
     timing_wheel_.Step();
@@ -78,5 +106,52 @@ void TimerManager::ThreadFuncImpl() {
   }
 }
 
+// Ticks come from a timerfd armed at absolute CLOCK_MONOTONIC times, so
+// neither a slow Step() nor a late wakeup shifts the phase of later ticks,
+// and ticks missed while the thread was descheduled are caught up at once.
+bool TimerManager::RunOnTimerfd() {
+  int fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+  if (fd < 0) {
+    AWARN << "timerfd_create failed, errno: " << errno
+          << ", fall back to sleeping between ticks.";
+    return false;
+  }
+
+  uint64_t tick_ns = timing_wheel_.tick_duration();
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  uint64_t first_ns =
+      static_cast<uint64_t>(now.tv_sec) * 1000000000UL + now.tv_nsec + tick_ns;
+  struct itimerspec spec;
+  spec.it_value.tv_sec = first_ns / 1000000000UL;
+  spec.it_value.tv_nsec = first_ns % 1000000000UL;
+  spec.it_interval.tv_sec = tick_ns / 1000000000UL;
+  spec.it_interval.tv_nsec = tick_ns % 1000000000UL;
+  if (timerfd_settime(fd, TFD_TIMER_ABSTIME, &spec, nullptr) != 0) {
+    AWARN << "timerfd_settime failed, errno: " << errno
+          << ", fall back to sleeping between ticks.";
+    close(fd);
+    return false;
+  }
+
+  timing_wheel_.Step();
+  while (running_) {
+    uint64_t expirations = 0;
+    ssize_t nbytes = read(fd, &expirations, sizeof(expirations));
+    if (nbytes != sizeof(expirations)) {
+      if (nbytes < 0 && errno == EINTR) {
+        continue;
+      }
+      AERROR << "read timerfd failed, errno: " << errno;
+      break;
+    }
+    for (uint64_t i = 0; i < expirations && running_; ++i) {
+      timing_wheel_.Step();
+    }
+  }
+  close(fd);
+  return true;
+}
+
 }  // namespace cyber
 }  // namespace apollo
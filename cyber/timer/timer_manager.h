@@ -27,6 +27,7 @@
 
 #include "cyber/common/macros.h"
 #include "cyber/time/duration.h"
+#include "cyber/timer/timer_task.h"
 #include "cyber/timer/timing_wheel.h"
 
 namespace apollo {
@@ -40,14 +41,19 @@ class TimerManager {
   bool IsRunning();
   uint64_t Add(uint64_t interval, std::function<void()> handler, bool oneshot);
   void Remove(uint64_t timer_id);
+  std::shared_ptr<TimerStats> GetStats(uint64_t timer_id);
 
  private:
+  static Duration TickDuration();
+
   TimingWheel timing_wheel_;
   Duration time_gran_;
+  bool high_resolution_ = true;
   bool running_ = false;
   mutable std::mutex running_mutex_;
   std::thread scheduler_thread_;
   void ThreadFuncImpl();
+  bool RunOnTimerfd();
 
   DECLARE_SINGLETON(TimerManager)
 };
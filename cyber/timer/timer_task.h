@@ -18,6 +18,8 @@
 #define CYBER_TIMER_TIMER_TASK_H_
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <iostream>
 #include <list>
 #include <map>
@@ -29,12 +31,19 @@
 #include <vector>
 
 #include "cyber/base/bounded_queue.h"
+#include "cyber/croutine/routine_stats.h"
 
 namespace apollo {
 namespace cyber {
 
 using CallHandler = std::function<void()>;
 
+struct TimerStats {
+  // how long after its deadline each callback started running
+  croutine::LatencyHistogram lateness;
+  std::atomic<uint64_t> fired = {0};
+};
+
 class TimerTask {
  public:
   TimerTask(uint64_t id, uint64_t it, uint64_t ivl, CallHandler h, bool ons)
@@ -49,12 +58,17 @@ class TimerTask {
 
  public:
   uint64_t init_time_ = 0;
+  // absolute monotonic time of the next fire, in nanoseconds
   uint64_t deadline_ = 0;
+  // wheel tick the next fire is due on
+  uint64_t deadline_tick_ = 0;
   uint64_t interval_ = 0;
   CallHandler handler_;
-  uint64_t rest_rounds_ = 0;
   bool oneshot_ = true;
   uint64_t fire_count_ = 0;
+  std::shared_ptr<TimerStats> stats_ = std::make_shared<TimerStats>();
+  // keeps a slow callback from overlapping its own next run
+  std::mutex handler_mutex_;
 
  public:
   uint64_t Id() { return tid_; }
@@ -18,6 +18,7 @@
 #define CYBER_TIMER_TIMING_SLOT_H_
 
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <list>
 #include <map>
@@ -46,16 +47,16 @@ struct HandlePackage {
 class TimingSlot {
  private:
   //  no needs for multi-thread
-  std::unordered_map<uint64_t, std::shared_ptr<TimerTask>> tasks_;
+  std::vector<std::shared_ptr<TimerTask>> tasks_;
 
  public:
   TimingSlot() = default;
   void AddTask(const std::shared_ptr<TimerTask>& task);
-  void RemoveTask(uint64_t id) { tasks_.erase(id); }
 
-  void EnumTaskList(uint64_t deadline, bool async,
-                    BoundedQueue<HandlePackage>* hander_queue,
-                    BoundedQueue<std::shared_ptr<TimerTask>>* rep_list);
+  bool Empty() const { return tasks_.empty(); }
+
+  // hands every task to the caller and leaves the slot empty
+  void TakeTasks(std::vector<std::shared_ptr<TimerTask>>* tasks);
 };  // TimeSlot end
 
 }  // namespace cyber
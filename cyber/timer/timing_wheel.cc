@@ -14,11 +14,11 @@
  * limitations under the License.
  *****************************************************************************/
 
+
 #include "cyber/timer/timing_wheel.h"
 
 #include <algorithm>
 
-#include "cyber/base/for_each.h"
 #include "cyber/common/log.h"
 #include "cyber/task/task.h"
 #include "cyber/time/time.h"
@@ -27,66 +27,47 @@
 namespace apollo {
 namespace cyber {
 
-TimingWheel::TimingWheel() {
-  if (!add_queue_.Init(BOUNDED_QUEUE_SIZE)) {
-    AERROR << "Add queue init failed.";
-    throw std::runtime_error("Add queue init failed.");
-  }
-  if (!repeat_queue_.Init(BOUNDED_QUEUE_SIZE)) {
-    AERROR << "Repeated task queue init failed.";
-    throw std::runtime_error("Repeated queue init failed.");
-  }
-  if (!handler_queue_.Init(BOUNDED_QUEUE_SIZE)) {
-    AERROR << "Handler queue init failed.";
-    throw std::runtime_error("Handler queue init failed.");
-  }
-}
+TimingWheel::TimingWheel() { Init(); }
 
 TimingWheel::TimingWheel(const Duration& tick_duration) {
   tick_duration_ = tick_duration.ToNanosecond();
-  resolution_ = tick_duration_ / 1000000UL;
+  if (tick_duration_ == 0) {
+    AWARN << "Zero tick duration, fall back to 1ms.";
+    tick_duration_ = 1000 * 1000;
+  }
+  Init();
+}
+
+void TimingWheel::Init() {
   if (!add_queue_.Init(BOUNDED_QUEUE_SIZE)) {
     AERROR << "Add queue init failed.";
     throw std::runtime_error("Add queue init failed.");
   }
-  if (!repeat_queue_.Init(BOUNDED_QUEUE_SIZE)) {
-    AERROR << "Repeated task queue init failed.";
-    throw std::runtime_error("Repeated queue init failed.");
-  }
-  if (!handler_queue_.Init(BOUNDED_QUEUE_SIZE)) {
-    AERROR << "Handler queue init failed.";
-    throw std::runtime_error("Handler queue init failed.");
-  }
 }
 
 uint64_t TimingWheel::StartTimer(uint64_t interval, CallHandler handler,
                                  bool oneshot) {
-  if (id_counter_ > UINT64_MAX) {
-    AERROR << "Timer ID pool is full.";
-    return -1;
-  } else if (interval > TIMER_TASK_MAX_INTERVAL) {
-    AERROR << "The interval of timer task MUST less than or equal "
-           << TIMER_TASK_MAX_INTERVAL << "ms.";
-    return -1;
-  } else if (interval < resolution_) {
+  uint64_t interval_ns = interval * 1000 * 1000;
+  if (interval_ns < tick_duration_) {
     AERROR << "The interval of timer task MUST larger than or equal "
-           << resolution_ << "ms.";
+           << tick_duration_ / 1000 << "us.";
     return -1;
   }
-  auto now = Time::Now().ToNanosecond();
-  auto task = std::make_shared<TimerTask>(
-      ++id_counter_, now, interval,
-      [handler](void) {
-        static std::mutex task_mutex;
-        std::lock_guard<std::mutex> lock(task_mutex);
-        handler();
-      },
-      oneshot);
+  auto id = ++id_counter_;
+  auto now = Time::MonoTime().ToNanosecond();
+  auto task = std::make_shared<TimerTask>(id, now, interval, handler, oneshot);
+  {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    stats_[id] = task->stats_;
+  }
   if (add_queue_.Enqueue(task)) {
-    ADEBUG << "start timer id: " << id_counter_;
-    return id_counter_;
+    ADEBUG << "start timer id: " << id;
+    return id;
   } else {
-    --id_counter_;
+    {
+      std::lock_guard<std::mutex> lock(stats_mutex_);
+      stats_.erase(id);
+    }
     AERROR << "add queue is full, Enqueue failed!";
     return -1;
   }
@@ -94,26 +75,20 @@ uint64_t TimingWheel::StartTimer(uint64_t interval, CallHandler handler,
 
 void TimingWheel::Step() {
   if (start_time_ == 0) {
-    start_time_ = Time::Now().ToNanosecond();
+    start_time_ = Time::MonoTime().ToNanosecond();
   }
-  uint64_t deadline = tick_duration_ * (tick_ + 1);
-  uint64_t idx = tick_ & mask_;
-  RemoveCancelledTasks(idx);
+  RemoveCancelledTasks();
   FillAddSlot();
-  time_slots_[idx].EnumTaskList(deadline, true, &handler_queue_,
-                                &repeat_queue_);
+  Cascade();
+  ExpireSlot();
 
   // timing wheel tick one time
   tick_++;
 
-  FillRepeatSlot();
-
-  while (!handler_queue_.Empty()) {
-    HandlePackage hp;
-    if (handler_queue_.Dequeue(&hp)) {
-      cyber::Async(hp.handle);
-    }
+  for (auto& task : repeated_) {
+    FillSlot(task);
   }
+  repeated_.clear();
 }
 
 void TimingWheel::StopTimer(uint64_t timer_id) {
@@ -121,21 +96,33 @@ void TimingWheel::StopTimer(uint64_t timer_id) {
     std::lock_guard<std::mutex> lg(cancelled_mutex_);
     cancelled_list_.push_back(timer_id);
   }
+  {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    stats_.erase(timer_id);
+  }
 }
 
-void TimingWheel::RemoveCancelledTasks(uint64_t slot_index) {
-  if (slot_index >= TIMING_WHEEL_SIZE) {
-    return;
+std::shared_ptr<TimerStats> TimingWheel::GetStats(uint64_t timer_id) {
+  std::lock_guard<std::mutex> lock(stats_mutex_);
+  auto it = stats_.find(timer_id);
+  if (it == stats_.end()) {
+    return nullptr;
   }
-  {
-    std::lock_guard<std::mutex> lg(cancelled_mutex_);
-    for (auto id : cancelled_list_) {
-      FOR_EACH(i, 0, TIMING_WHEEL_SIZE) {
-        time_slots_[i].RemoveTask(id);
-      }
+  return it->second;
+}
+
+void TimingWheel::RemoveCancelledTasks() {
+  std::lock_guard<std::mutex> lg(cancelled_mutex_);
+  for (auto id : cancelled_list_) {
+    auto it = tasks_.find(id);
+    if (it == tasks_.end()) {
+      continue;
     }
-    cancelled_list_.clear();
+    // the task is dropped lazily when its slot comes up
+    it->second->Cancel();
+    tasks_.erase(it);
   }
+  cancelled_list_.clear();
 }
 
 void TimingWheel::FillAddSlot() {
@@ -144,37 +131,95 @@ void TimingWheel::FillAddSlot() {
     if (!add_queue_.Dequeue(&task)) {
       return;
     }
+    tasks_[task->Id()] = task;
     FillSlot(task);
   }
 }
 
-void TimingWheel::FillRepeatSlot() {
-  std::shared_ptr<TimerTask> task;
-  while (!repeat_queue_.Empty()) {
-    if (!repeat_queue_.Dequeue(&task)) {
+void TimingWheel::FillSlot(const std::shared_ptr<TimerTask>& task) {
+  task->deadline_ = task->init_time_ +
+                    (task->fire_count_ + 1) * task->interval_ * 1000 * 1000;
+  uint64_t offset =
+      task->deadline_ > start_time_ ? task->deadline_ - start_time_ : 0;
+  // the first tick at or after the deadline
+  task->deadline_tick_ = (offset + tick_duration_ - 1) / tick_duration_;
+
+  uint64_t ticks = std::max(task->deadline_tick_, tick_);
+  uint64_t delta = ticks - tick_;
+  int level = 0;
+  while (level < TIMING_WHEEL_LEVELS - 1 &&
+         delta >= (1ULL << (TIMING_WHEEL_BITS * (level + 1)))) {
+    ++level;
+  }
+  uint64_t span = 1ULL << (TIMING_WHEEL_BITS * (level + 1));
+  if (delta >= span) {
+    // beyond the top level, park it in the last slot that level can reach
+    // and let cascading place it again later
+    ticks = tick_ + span - 1;
+  }
+  uint64_t idx = (ticks >> (TIMING_WHEEL_BITS * level)) & mask_;
+  time_slots_[level][idx].AddTask(task);
+
+  ADEBUG << "task id " << task->Id() << " insert to level " << level
+         << " index " << idx;
+}
+
+void TimingWheel::Cascade() {
+  for (int level = 1; level < TIMING_WHEEL_LEVELS; ++level) {
+    uint64_t low_bits = (1ULL << (TIMING_WHEEL_BITS * level)) - 1;
+    if ((tick_ & low_bits) != 0) {
       return;
     }
-    FillSlot(task);
+    uint64_t idx = (tick_ >> (TIMING_WHEEL_BITS * level)) & mask_;
+    time_slots_[level][idx].TakeTasks(&expired_);
+    for (auto& task : expired_) {
+      if (!task->IsCanceled()) {
+        FillSlot(task);
+      }
+    }
+    expired_.clear();
   }
 }
 
-void TimingWheel::FillSlot(const std::shared_ptr<TimerTask>& task) {
-  task->deadline_ = task->init_time_ +
-                    (task->fire_count_ + 1) * (task->interval_) * 1000 * 1000 -
-                    start_time_;
+void TimingWheel::ExpireSlot() {
+  time_slots_[0][tick_ & mask_].TakeTasks(&expired_);
+  for (auto& task : expired_) {
+    if (task->IsCanceled()) {
+      continue;
+    }
+    if (task->deadline_tick_ > tick_) {
+      FillSlot(task);
+      continue;
+    }
 
-  // Calculate how many tickes have been run since the time wheel start
-  uint64_t t = task->deadline_ / tick_duration_;  // perTick = 1ms
-  if (t < tick_) {
-    task->rest_rounds_ = 0;
-  } else {
-    task->rest_rounds_ = (t - tick_) / TIMING_WHEEL_SIZE;
+    auto deadline = task->deadline_;
+    cyber::Async([task, deadline]() {
+      auto now = Time::MonoTime().ToNanosecond();
+      task->stats_->lateness.Add(now > deadline ? (now - deadline) / 1000 : 0);
+      task->stats_->fired.fetch_add(1, std::memory_order_relaxed);
+      std::lock_guard<std::mutex> lock(task->handler_mutex_);
+      task->handler_();
+    });
+
+    if (task->oneshot_) {
+      tasks_.erase(task->Id());
+      std::lock_guard<std::mutex> lock(stats_mutex_);
+      stats_.erase(task->Id());
+    } else {
+      task->fire_count_++;
+      // after a stall, skip the periods that already passed instead of
+      // firing them back to back
+      uint64_t interval_ns = task->interval_ * 1000 * 1000;
+      uint64_t wheel_now = start_time_ + tick_ * tick_duration_;
+      if (wheel_now > task->init_time_) {
+        uint64_t passed = (wheel_now - task->init_time_) / interval_ns;
+        task->fire_count_ = std::max(task->fire_count_, passed);
+      }
+      repeated_.push_back(task);
+    }
   }
-  uint64_t ticks = std::max(t, tick_);  // right now
-  uint64_t idx = ticks & mask_;
-  time_slots_[idx].AddTask(task);
-
-  ADEBUG << "task id " << task->Id() << " insert to index " << idx;
+  expired_.clear();
 }
+
 }  // namespace cyber
 }  // namespace apollo
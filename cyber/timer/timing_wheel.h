@@ -18,6 +18,7 @@
 #define CYBER_TIMER_TIMING_WHEEL_H_
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <list>
@@ -39,13 +40,26 @@ namespace cyber {
 using apollo::cyber::base::BoundedQueue;
 using CallHandler = std::function<void()>;
 
-static const int TIMING_WHEEL_SIZE = 128;
+static const int TIMING_WHEEL_BITS = 6;
+static const int TIMING_WHEEL_SIZE = 1 << TIMING_WHEEL_BITS;
+static const int TIMING_WHEEL_LEVELS = 4;
 static const int THREAD_POOL_SIZE = 4;
 static const uint64_t BOUNDED_QUEUE_SIZE = 200;
-static const int TIMER_TASK_MAX_INTERVAL = 1000;
 
 class TimerTask;
+struct TimerStats;
 
+/**
+ * @class TimingWheel
+ * @brief A hierarchical timing wheel driven by `Step()`, one tick per call.
+ *
+ * Level 0 holds tasks due within TIMING_WHEEL_SIZE ticks, and each further
+ * level covers TIMING_WHEEL_SIZE times the span of the one below. Whenever a
+ * lower level wraps, the matching slot of the next level is cascaded down.
+ * Task deadlines are absolute (init time + n * interval), so periodic timers
+ * never accumulate drift, and a task fires on the first tick at or after its
+ * deadline, never before.
+ */
 class TimingWheel {
  public:
   TimingWheel();
@@ -56,35 +70,47 @@ class TimingWheel {
 
   void StopTimer(uint64_t timer_id);
 
+  // nullptr once the timer is stopped or a oneshot timer has fired
+  std::shared_ptr<TimerStats> GetStats(uint64_t timer_id);
+
   void Step();
 
+  uint64_t tick_duration() const { return tick_duration_; }
+
  private:
+  void Init();
   void FillAddSlot();
-  void FillRepeatSlot();
   void FillSlot(const std::shared_ptr<TimerTask>& task);
+  void Cascade();
+  void ExpireSlot();
 
-  void RemoveCancelledTasks(uint64_t slot_index);
+  void RemoveCancelledTasks();
 
-  uint64_t id_counter_ = 0;
+  std::atomic<uint64_t> id_counter_ = {0};
 
   uint64_t tick_ = 0;
 
   uint64_t start_time_ = 0;
 
-  TimingSlot time_slots_[TIMING_WHEEL_SIZE];
+  TimingSlot time_slots_[TIMING_WHEEL_LEVELS][TIMING_WHEEL_SIZE];
 
   uint64_t mask_ = TIMING_WHEEL_SIZE - 1;
 
   uint64_t tick_duration_ = 10 * 1000 * 1000;  // 10ms
-  uint64_t resolution_ = 10;                   // 10ms
+
+  // live tasks, owned by the stepping thread
+  std::unordered_map<uint64_t, std::shared_ptr<TimerTask>> tasks_;
+  std::vector<std::shared_ptr<TimerTask>> expired_;
+  std::vector<std::shared_ptr<TimerTask>> repeated_;
+
+  std::unordered_map<uint64_t, std::shared_ptr<TimerStats>> stats_;
+  std::mutex stats_mutex_;
 
   // we need implement a lock-free high performance concurrent queue.
   // Now, just a blocking-queue just for works.
   std::list<uint64_t> cancelled_list_;
   std::mutex cancelled_mutex_;
   BoundedQueue<std::shared_ptr<TimerTask>> add_queue_;
-  BoundedQueue<std::shared_ptr<TimerTask>> repeat_queue_;
-  BoundedQueue<HandlePackage> handler_queue_;
 };
 
 }  // namespace cyber
@@ -24,6 +24,7 @@
 #include "cyber/common/log.h"
 #include "cyber/cyber.h"
 #include "cyber/init.h"
+#include "cyber/timer/timer_task.h"
 
 namespace apollo {
 namespace cyber {
@@ -71,6 +72,56 @@ TEST(TimingWheelTest, Period) {
   }
 }
 
+TEST(TimingWheelTest, Cascade) {
+  // 10ms ticks, so one second sits in level 1 and a minute in level 2
+  TimingWheel tw;
+  std::shared_ptr<TestHandler> th(new TestHandler());
+  std::function<void(void)> f = std::bind(&TestHandler::increment, th.get());
+  tw.Step();
+  tw.StartTimer(1000, f, true);
+  tw.StartTimer(60 * 1000, f, true);
+  for (int i = 0; i < 100; i++) {
+    tw.Step();
+  }
+  usleep(20 * 1000);
+  ASSERT_EQ(0, th->count());
+  for (int i = 0; i < 5; i++) {
+    tw.Step();
+  }
+  usleep(20 * 1000);
+  ASSERT_EQ(1, th->count());
+  for (int i = 0; i < 6000; i++) {
+    tw.Step();
+  }
+  usleep(20 * 1000);
+  ASSERT_EQ(2, th->count());
+}
+
+TEST(TimingWheelTest, Stats) {
+  TimingWheel tw(Duration(static_cast<int64_t>(1000 * 1000)));
+  std::shared_ptr<TestHandler> th(new TestHandler());
+  std::function<void(void)> f = std::bind(&TestHandler::increment, th.get());
+  tw.Step();
+  auto id = tw.StartTimer(1, f, false);
+  auto stats = tw.GetStats(id);
+  ASSERT_NE(nullptr, stats);
+  for (int i = 0; i < 10; i++) {
+    tw.Step();
+    usleep(1000);
+  }
+  usleep(10 * 1000);
+  ASSERT_GT(stats->fired.load(), 0);
+  ASSERT_EQ(stats->fired.load(), stats->lateness.count());
+  tw.StopTimer(id);
+  ASSERT_EQ(nullptr, tw.GetStats(id));
+  uint64_t count = th->count();
+  for (int i = 0; i < 10; i++) {
+    tw.Step();
+  }
+  usleep(10 * 1000);
+  ASSERT_EQ(count, th->count());
+}
+
 }  // namespace cyber
 }  // namespace apollo
 
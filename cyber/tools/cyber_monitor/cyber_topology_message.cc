@@ -18,9 +18,11 @@
 #include "./general_channel_message.h"
 #include "./screen.h"
 
+#include "cyber/common/global_data.h"
 #include "cyber/message/message_traits.h"
 #include "cyber/proto/role_attributes.pb.h"
 #include "cyber/proto/topology_change.pb.h"
+#include "cyber/transport/shm/channel_stats_table.h"
 
 #include <ncurses.h>
 #include <iomanip>
@@ -55,14 +57,22 @@ bool CyberTopologyMessage::isFromHere(const std::string& nodeName) {
 }
 
 RenderableMessage* CyberTopologyMessage::Child(int lineNo) const {
-  RenderableMessage* ret = nullptr;
   auto iter = findChild(lineNo);
-  if (iter != all_channels_map_.cend() &&
-      !GeneralChannelMessage::isErrorCode(iter->second) &&
-      iter->second->is_enabled()) {
-    ret = iter->second;
+  if (iter == all_channels_map_.cend() ||
+      GeneralChannelMessage::isErrorCode(iter->second)) {
+    return nullptr;
   }
-  return ret;
+  GeneralChannelMessage* child = iter->second;
+  if (!child->is_enabled()) {
+    // only the viewed channel is subscribed and decoded, it is closed again
+    // when the topology is rendered
+    if (GeneralChannelMessage::isErrorCode(child->OpenChannel(iter->first))) {
+      return nullptr;
+    }
+    child->add_reader(child->NodeName());
+    viewed_channel_ = child;
+  }
+  return child;
 }
 
 std::map<std::string, GeneralChannelMessage*>::const_iterator CyberTopologyMessage::findChild(int lineNo) const{
@@ -141,13 +151,11 @@ void CyberTopologyMessage::AddReaderWriter(
     std::ostringstream outStr;
     outStr << "MonitorReader" << pid_ << '-' << index++;
 
-    channelMsg = new GeneralChannelMessage(outStr.str(), this);
+    // not subscribed until viewed, the list shows the transport statistics
+    channelMsg = new GeneralChannelMessage(outStr.str(), channelName, this);
 
     if(channelMsg != nullptr){
-      if (!GeneralChannelMessage::isErrorCode(channelMsg->OpenChannel(channelName))) {
-        channelMsg->set_message_type(msgTypeName);
-        channelMsg->add_reader(channelMsg->NodeName());
-      }
+      channelMsg->set_message_type(msgTypeName);
     } else {
       channelMsg = GeneralChannelMessage::castErrorCode2Ptr(GeneralChannelMessage::ErrorCode::NewSubClassFailed);
     }
@@ -182,12 +190,18 @@ void CyberTopologyMessage::ChangeState(const Screen* s, int key) {
       second_column_ = SecondColumnType::MessageType;
       break;
 
+    case 'p':
+    case 'P':
+      second_column_ = SecondColumnType::WriterStats;
+      break;
+
     case ' ': {
       auto iter = findChild(*line_no());
       if (!GeneralChannelMessage::isErrorCode(iter->second)) {
         GeneralChannelMessage* child = iter->second;
         if(child->is_enabled()){
           child->CloseChannel();
+          child->del_reader(child->NodeName());
         } else {
           GeneralChannelMessage* ret = child->OpenChannel(iter->first);
           if(GeneralChannelMessage::isErrorCode(ret)){
@@ -205,6 +219,11 @@ void CyberTopologyMessage::ChangeState(const Screen* s, int key) {
 }
 
 void CyberTopologyMessage::Render(const Screen* s, int key) {
+  if (viewed_channel_ != nullptr) {
+    viewed_channel_->CloseChannel();
+    viewed_channel_->del_reader(viewed_channel_->NodeName());
+    viewed_channel_ = nullptr;
+  }
   page_item_count_ = s->Height() - 1;
   pages_ = static_cast<int>(all_channels_map_.size()) / page_item_count_ + 1;
   ChangeState(s, key);
@@ -220,6 +239,10 @@ void CyberTopologyMessage::Render(const Screen* s, int key) {
       s->AddStr(col1_width_ + SecondColumnOffset, 0, Screen::WHITE_BLACK,
                 "FrameRatio");
       break;
+    case SecondColumnType::WriterStats:
+      s->AddStr(col1_width_ + SecondColumnOffset, 0, Screen::WHITE_BLACK,
+                "Rate(Hz)  LastSize(B)  Failed");
+      break;
   }
 
   auto iter = all_channels_map_.cbegin();
@@ -264,6 +287,24 @@ void CyberTopologyMessage::Render(const Screen* s, int key) {
           s->AddStr(col1_width_ + SecondColumnOffset, line,
                     outStr.str().c_str());
         } break;
+        case SecondColumnType::WriterStats: {
+          // read from the writers' shared memory statistics, so the channel
+          // need not be enabled
+          apollo::cyber::transport::ChannelStats stats;
+          outStr.str("");
+          if (apollo::cyber::transport::ChannelStatsTable::Instance()->GetStats(
+                  apollo::cyber::common::GlobalData::RegisterChannel(
+                      iter->first),
+                  &stats)) {
+            outStr << std::fixed << std::setprecision(FrameRatio_Precision)
+                   << std::setw(8) << stats.rate() << "  " << std::setw(11)
+                   << stats.last_size << "  " << stats.num_failed;
+          } else {
+            outStr << "not written on this host";
+          }
+          s->AddStr(col1_width_ + SecondColumnOffset, line,
+                    outStr.str().c_str());
+        } break;
       }
     } else {
       GeneralChannelMessage::ErrorCode errcode =
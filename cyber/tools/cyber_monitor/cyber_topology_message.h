@@ -54,13 +54,19 @@ class CyberTopologyMessage : public RenderableMessage {
 
   std::map<std::string, GeneralChannelMessage*>::const_iterator findChild(int index) const;
 
-  enum class SecondColumnType { MessageType, MessageFrameRatio };
+  enum class SecondColumnType {
+    MessageType,
+    MessageFrameRatio,
+    WriterStats
+  };
   SecondColumnType second_column_;
   
   int pid_;
   int col1_width_; 
   const std::string& specified_channel_;
   std::map<std::string, GeneralChannelMessage*> all_channels_map_;
+  // the channel subscribed only while it is viewed
+  mutable GeneralChannelMessage* viewed_channel_ = nullptr;
 };
 
 #endif  // TOOLS_CVT_MONITOR_CYBER_TOPOLOGY_MESSAGE_H_
@@ -18,6 +18,8 @@
 #include "./general_message.h"
 #include "./screen.h"
 
+#include "cyber/common/global_data.h"
+
 #include <iomanip>
 #include <sstream>
 #include <string>
@@ -27,6 +29,28 @@ namespace {
 constexpr int ReaderWriterOffset = 4;
 }  // namespace
 
+GeneralChannelMessage::GeneralChannelMessage(const std::string& nodeName,
+                                             const std::string& channelName,
+                                             RenderableMessage* parent)
+    : GeneralMessageBase(parent),
+      current_state_(State::ShowDebugString),
+      has_message_come_(false),
+      message_type_(),
+      frame_counter_(0),
+      channel_node_(nullptr),
+      node_name_(nodeName),
+      channel_name_(channelName),
+      channel_id_(
+          apollo::cyber::common::GlobalData::RegisterChannel(channelName)),
+      readers_(),
+      writers_(),
+      channel_message_(nullptr),
+      channel_reader_(nullptr),
+      inner_lock_(),
+      raw_msg_class_(nullptr),
+      parsed_message_(nullptr),
+      parsed_ok_(false) {}
+
 const char* GeneralChannelMessage::errCode2Str(
     GeneralChannelMessage::ErrorCode errCode) {
   const char* ret;
@@ -78,26 +102,56 @@ bool GeneralChannelMessage::isErrorCode(void* ptr) {
   return false;
 }
 
+bool GeneralChannelMessage::GetTransportStats(
+    apollo::cyber::transport::ChannelStats* stats) const {
+  return apollo::cyber::transport::ChannelStatsTable::Instance()->GetStats(
+      channel_id_, stats);
+}
+
+bool GeneralChannelMessage::has_message_come(void) const {
+  if (has_message_come_) {
+    return true;
+  }
+  apollo::cyber::transport::ChannelStats stats;
+  return !is_enabled() && GetTransportStats(&stats) && stats.num_messages > 0;
+}
+
 double GeneralChannelMessage::frame_ratio(void) {
-  if (!is_enabled() || !has_message_come()) return 0.0;
+  if (!is_enabled()) {
+    // not subscribed, take the rate the writers on this host measure
+    apollo::cyber::transport::ChannelStats stats;
+    if (!GetTransportStats(&stats)) return 0.0;
+    uint64_t now = apollo::cyber::Time::Now().ToNanosecond();
+    // a writer which stopped keeps its last rate
+    if (now > stats.last_publish_time + 1000000000 &&
+        now - stats.last_publish_time > 2 * stats.mean_interval) {
+      return 0.0;
+    }
+    return stats.rate();
+  }
+  if (!has_message_come()) return 0.0;
+  // the callback only counts messages, the rate is computed at most once a
+  // second over the time since the last computation
   auto time_now = apollo::cyber::Time::MonoTime();
   auto interval = time_now - time_last_calc_;
   if (interval.ToNanosecond() > 1000000000) {
-    int old = frame_counter_;
-    while (!frame_counter_.compare_exchange_strong(old, 0)) {
-    }
-    if (old == 0) {
-      return 0.0;
-    }
-    auto curMsgTime = msg_time_;
-    auto deltaTime = curMsgTime - last_time_;
-    frame_ratio_ = old / deltaTime.ToSecond();
-    last_time_ = curMsgTime;
+    int old = frame_counter_.exchange(0);
+    frame_ratio_ = old / interval.ToSecond();
     time_last_calc_ = time_now;
   }
   return frame_ratio_;
 }
 
+bool GeneralChannelMessage::ParseMessage(
+    const std::shared_ptr<apollo::cyber::message::RawMessage>& rawMsg) {
+  if (rawMsg != parsed_message_) {
+    parsed_message_ = rawMsg;
+    parsed_ok_ = rawMsg != nullptr &&
+                 raw_msg_class_->ParseFromString(rawMsg->message);
+  }
+  return parsed_ok_;
+}
+
 GeneralChannelMessage* GeneralChannelMessage::OpenChannel(
     const std::string& channelName) {
   if (channelName.empty() || node_name_.empty()) {
@@ -148,7 +202,7 @@ void GeneralChannelMessage::Render(const Screen* s, int key) {
 
   s->SetCurrentColor(Screen::WHITE_BLACK);
   s->AddStr(0, lineNo++, "ChannelName: ");
-  s->AddStr(channel_reader_->GetChannelName().c_str());
+  s->AddStr(GetChannelName().c_str());
 
   s->AddStr(0, lineNo++, "MessageType: ");
   s->AddStr(message_type().c_str());
@@ -239,7 +293,7 @@ void GeneralChannelMessage::RenderDebugString(const Screen* s, int key,
         outStr.str("");
         outStr << channelMsg->message.size() << " Bytes";
         s->AddStr(outStr.str().c_str());
-        if (raw_msg_class_->ParseFromString(channelMsg->message)) {
+        if (ParseMessage(channelMsg)) {
           int lcount = lineCount(*raw_msg_class_, s->Width());
           page_item_count_ = s->Height() - lineNo;
           pages_ = lcount / page_item_count_ + 1;
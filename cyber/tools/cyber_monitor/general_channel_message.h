@@ -20,6 +20,7 @@
 #include <atomic>
 
 #include "cyber/message/raw_message.h"
+#include "cyber/transport/shm/channel_stats_table.h"
 #include "general_message_base.h"
 
 class CyberTopologyMessage;
@@ -58,9 +59,7 @@ class GeneralChannelMessage : public GeneralMessageBase {
     }
   }
 
-  std::string GetChannelName(void) const {
-    return channel_reader_->GetChannelName();
-  }
+  const std::string& GetChannelName(void) const { return channel_name_; }
 
   void set_message_type(const std::string& msgTypeName) {
     message_type_ = msgTypeName;
@@ -68,7 +67,7 @@ class GeneralChannelMessage : public GeneralMessageBase {
   const std::string& message_type(void) const { return message_type_; }
 
   bool is_enabled(void) const { return channel_reader_ != nullptr; }
-  bool has_message_come(void) const { return has_message_come_; }
+  bool has_message_come(void) const;
 
   double frame_ratio(void) override;
 
@@ -98,23 +97,9 @@ class GeneralChannelMessage : public GeneralMessageBase {
   }
 
  private:
-  explicit GeneralChannelMessage(const std::string& nodeName,
-                                 RenderableMessage* parent = nullptr)
-      : GeneralMessageBase(parent),
-        current_state_(State::ShowDebugString),
-        has_message_come_(false),
-        message_type_(),
-        frame_counter_(0),
-        last_time_(apollo::cyber::Time::MonoTime()),
-        msg_time_(last_time_.ToNanosecond() + 1),
-        channel_node_(nullptr),
-        node_name_(nodeName),
-        readers_(),
-        writers_(),
-        channel_message_(nullptr),
-        channel_reader_(nullptr),
-        inner_lock_(),
-        raw_msg_class_(nullptr) {}
+  GeneralChannelMessage(const std::string& nodeName,
+                        const std::string& channelName,
+                        RenderableMessage* parent = nullptr);
 
   GeneralChannelMessage(const GeneralChannelMessage&) = delete;
   GeneralChannelMessage& operator=(const GeneralChannelMessage&) = delete;
@@ -141,7 +126,6 @@ class GeneralChannelMessage : public GeneralMessageBase {
   void updateRawMessage(
       const std::shared_ptr<apollo::cyber::message::RawMessage>& rawMsg) {
     set_has_message_come(true);
-    msg_time_ = apollo::cyber::Time::MonoTime();
     ++frame_counter_;
     std::lock_guard<std::mutex> _g(inner_lock_);
     channel_message_.reset();
@@ -159,6 +143,13 @@ class GeneralChannelMessage : public GeneralMessageBase {
 
   GeneralChannelMessage* OpenChannel(const std::string& channelName);
 
+  // parse rawMsg into raw_msg_class_, unless it is the message parsed last
+  bool ParseMessage(
+      const std::shared_ptr<apollo::cyber::message::RawMessage>& rawMsg);
+
+  // the statistics the writers on this host keep in shared memory
+  bool GetTransportStats(apollo::cyber::transport::ChannelStats* stats) const;
+
   void RenderDebugString(const Screen* s, int key, unsigned lineNo);
   void RenderInfo(const Screen* s, int key, unsigned lineNo);
 
@@ -169,13 +160,13 @@ class GeneralChannelMessage : public GeneralMessageBase {
   bool has_message_come_;
   std::string message_type_;
   std::atomic<int> frame_counter_;
-  apollo::cyber::Time last_time_;
-  apollo::cyber::Time msg_time_;
   apollo::cyber::Time time_last_calc_ = apollo::cyber::Time::MonoTime();
 
   std::unique_ptr<apollo::cyber::Node> channel_node_;
 
   std::string node_name_;
+  std::string channel_name_;
+  uint64_t channel_id_;
 
   std::vector<std::string> readers_;
   std::vector<std::string> writers_;
@@ -186,6 +177,8 @@ class GeneralChannelMessage : public GeneralMessageBase {
   mutable std::mutex inner_lock_;
 
   google::protobuf::Message* raw_msg_class_;
+  std::shared_ptr<apollo::cyber::message::RawMessage> parsed_message_;
+  bool parsed_ok_;
 
   friend class CyberTopologyMessage;
   friend class GeneralMessage;
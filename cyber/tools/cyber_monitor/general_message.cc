@@ -59,7 +59,7 @@ void GeneralMessage::Render(const Screen* s, int key) {
     clear();
 
     auto channelMsg = channelMsgPtr->CopyMsgPtr();
-    if (!channelMsgPtr->raw_msg_class_->ParseFromString(channelMsg->message)) {
+    if (!channelMsgPtr->ParseMessage(channelMsg)) {
       s->AddStr(0, lineNo++, "Cannot Parse the message for Real-Time Updating");
       return;
     }
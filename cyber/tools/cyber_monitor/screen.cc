@@ -29,7 +29,9 @@
 #include <thread>
 
 namespace{
-  constexpr double MinHalfFrameRatio = 12.5;
+  // render at a fixed rate rather than the rate of the viewed channel, key
+  // presses are handled at once
+  constexpr int RefreshPeriodMs = 100;
 }
 
 Screen* Screen::Instance(void) {
@@ -61,6 +63,8 @@ const char Screen::InteractiveCmdStr[] =
     "Commands for Topology message:\n"
     "   f | F -- show frame ratio for all channel messages\n"
     "   t | T -- show channel message type\n"
+    "   p | P -- show publish rate, size and failures of the writers on this "
+    "host\n"
     "\n"
     "   Space -- Enable|Disable channel Message\n"
     "\n"
@@ -209,6 +213,7 @@ void Screen::Run() {
   void (Screen::*showFuncs[])(int) = {&Screen::ShowRenderMessage,
                                       &Screen::ShowInteractiveCmd};
 
+  timeout(RefreshPeriodMs);
   do {
     int ch = getch();
 
@@ -220,12 +225,6 @@ void Screen::Run() {
     ch = SwitchState(ch);
 
     (this->*showFuncs[static_cast<int>(current_state_)])(ch);
-
-    double fr = current_render_obj_->frame_ratio();
-    if(fr < MinHalfFrameRatio) fr = MinHalfFrameRatio;
-    int period = static_cast<int>(1000.0 / fr);
-    period >>= 1;
-    std::this_thread::sleep_for(std::chrono::milliseconds(period));
   } while (canRun_);
 }
 
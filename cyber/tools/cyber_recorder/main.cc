@@ -16,9 +16,12 @@
 
 #include <getopt.h>
 #include <stddef.h>
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "cyber/common/file.h"
@@ -33,6 +36,7 @@
 using apollo::cyber::common::GetFileName;
 using apollo::cyber::common::StringToUnixSeconds;
 using apollo::cyber::common::UnixSecondsToString;
+using apollo::cyber::proto::CompressType;
 using apollo::cyber::record::HeaderBuilder;
 using apollo::cyber::record::Info;
 using apollo::cyber::record::Player;
@@ -42,7 +46,7 @@ using apollo::cyber::record::Recoverer;
 using apollo::cyber::record::Spliter;
 
 const char INFO_OPTIONS[] = "h";
-const char RECORD_OPTIONS[] = "o:ac:i:m:h";
+const char RECORD_OPTIONS[] = "o:ac:i:m:z:h";
 const char PLAY_OPTIONS[] = "f:c:lr:b:e:s:d:p:h";
 const char SPLIT_OPTIONS[] = "f:o:c:k:b:e:h";
 const char RECOVER_OPTIONS[] = "f:o:h";
@@ -52,6 +56,20 @@ void DisplayUsage(const std::string& binary, const std::string& command);
 void DisplayUsage(const std::string& binary, const std::string& command,
                   const std::string& options);
 
+// Runs the job of every input file in its own thread, they share nothing.
+bool ProcInParallel(const std::vector<std::function<bool()>>& jobs) {
+  std::vector<char> results(jobs.size(), 0);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    threads.emplace_back([&jobs, &results, i]() { results[i] = jobs[i](); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return std::all_of(results.begin(), results.end(),
+                     [](char result) { return result != 0; });
+}
+
 void DisplayUsage(const std::string& binary) {
   std::cout << "usage: " << binary << " <command> [<args>]\n"
             << "The " << binary << " commands are:\n"
@@ -145,6 +163,10 @@ void DisplayUsage(const std::string& binary, const std::string& command,
         std::cout << "\t-m, --segment-size <MB>\t\t\t" << command
                   << " segmented every n megabyte(s)" << std::endl;
         break;
+      case 'z':
+        std::cout << "\t-z, --compress <none|bz2|lz4|zstd>\t" << command
+                  << " with chunks compressed" << std::endl;
+        break;
       case 'h':
         std::cout << "\t-h, --help\t\t\t\tshow help message" << std::endl;
         break;
@@ -170,7 +192,7 @@ int main(int argc, char** argv) {
   }
 
   int long_index = 0;
-  const std::string short_opts = "f:c:k:o:alr:b:e:s:d:p:i:m:h";
+  const std::string short_opts = "f:c:k:o:alr:b:e:s:d:p:i:m:z:h";
   static const struct option long_opts[] = {
       {"files", required_argument, nullptr, 'f'},
       {"white-channel", required_argument, nullptr, 'c'},
@@ -186,6 +208,7 @@ int main(int argc, char** argv) {
       {"preload", required_argument, nullptr, 'p'},
       {"segment-interval", required_argument, nullptr, 'i'},
       {"segment-size", required_argument, nullptr, 'm'},
+      {"compress", required_argument, nullptr, 'z'},
       {"help", no_argument, nullptr, 'h'}};
 
   std::vector<std::string> opt_file_vec;
@@ -346,6 +369,23 @@ int main(int argc, char** argv) {
           return -1;
         }
         break;
+      case 'z': {
+        const std::string compress(optarg);
+        if (compress == "none") {
+          opt_header.set_compress(CompressType::COMPRESS_NONE);
+        } else if (compress == "bz2") {
+          opt_header.set_compress(CompressType::COMPRESS_BZ2);
+        } else if (compress == "lz4") {
+          opt_header.set_compress(CompressType::COMPRESS_LZ4);
+        } else if (compress == "zstd") {
+          opt_header.set_compress(CompressType::COMPRESS_ZSTD);
+        } else {
+          std::cout << "Invalid argument: -z/--compress " << compress
+                    << std::endl;
+          return -1;
+        }
+        break;
+      }
       case 'h':
         DisplayUsage(binary, command);
         return 0;
@@ -369,17 +409,27 @@ int main(int argc, char** argv) {
       std::cout << "MUST specify file option (-f)." << std::endl;
       return -1;
     }
-    if (opt_file_vec.size() > 1 || opt_output_vec.size() > 1) {
-      std::cout << "TOO many input/output file option (-f/-o)." << std::endl;
+    if (!opt_output_vec.empty() &&
+        opt_output_vec.size() != opt_file_vec.size()) {
+      std::cout << "MUST specify one output file option (-o) per input file "
+                   "option (-f), or none."
+                << std::endl;
       return -1;
     }
     if (opt_output_vec.empty()) {
-      std::string default_output_file = opt_file_vec[0] + ".recover";
-      opt_output_vec.push_back(default_output_file);
+      for (const auto& file : opt_file_vec) {
+        opt_output_vec.push_back(file + ".recover");
+      }
     }
     ::apollo::cyber::Init(argv[0]);
-    Recoverer recoverer(opt_file_vec[0], opt_output_vec[0]);
-    bool recover_result = recoverer.Proc();
+    std::vector<std::function<bool()>> jobs;
+    for (size_t i = 0; i < opt_file_vec.size(); ++i) {
+      jobs.push_back([&opt_file_vec, &opt_output_vec, i]() {
+        Recoverer recoverer(opt_file_vec[i], opt_output_vec[i]);
+        return recoverer.Proc();
+      });
+    }
+    bool recover_result = ProcInParallel(jobs);
     return recover_result ? 0 : -1;
   }
 
@@ -439,18 +489,28 @@ int main(int argc, char** argv) {
       std::cout << "MUST specify file option (-f)." << std::endl;
       return -1;
     }
-    if (opt_file_vec.size() > 1 || opt_output_vec.size() > 1) {
-      std::cout << "TOO many input/output file option (-f/-o)." << std::endl;
+    if (!opt_output_vec.empty() &&
+        opt_output_vec.size() != opt_file_vec.size()) {
+      std::cout << "MUST specify one output file option (-o) per input file "
+                   "option (-f), or none."
+                << std::endl;
       return -1;
     }
     if (opt_output_vec.empty()) {
-      std::string default_output_file = opt_file_vec[0] + ".split";
-      opt_output_vec.push_back(default_output_file);
+      for (const auto& file : opt_file_vec) {
+        opt_output_vec.push_back(file + ".split");
+      }
     }
     ::apollo::cyber::Init(argv[0]);
-    Spliter spliter(opt_file_vec[0], opt_output_vec[0], opt_white_channels,
-                    opt_black_channels, opt_begin, opt_end);
-    bool split_result = spliter.Proc();
+    std::vector<std::function<bool()>> jobs;
+    for (size_t i = 0; i < opt_file_vec.size(); ++i) {
+      jobs.push_back([&, i]() {
+        Spliter spliter(opt_file_vec[i], opt_output_vec[i], opt_white_channels,
+                        opt_black_channels, opt_begin, opt_end);
+        return spliter.Proc();
+      });
+    }
+    bool split_result = ProcInParallel(jobs);
     return split_result ? 0 : -1;
   }
 
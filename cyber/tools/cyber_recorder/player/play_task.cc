@@ -31,6 +31,11 @@ PlayTask::PlayTask(const MessagePtr& msg, const WriterPtr& writer,
       msg_real_time_ns_(msg_real_time_ns),
       msg_play_time_ns_(msg_play_time_ns) {}
 
+const std::string& PlayTask::channel_name() const {
+  static const std::string kNoChannel;
+  return writer_ == nullptr ? kNoChannel : writer_->GetChannelName();
+}
+
 void PlayTask::Play() {
   if (writer_ == nullptr) {
     AERROR << "writer is nullptr, can't write message.";
@@ -20,6 +20,7 @@
 #include <stdint.h>
 #include <atomic>
 #include <memory>
+#include <string>
 
 #include "cyber/message/raw_message.h"
 #include "cyber/node/writer.h"
@@ -41,6 +42,7 @@ class PlayTask {
 
   uint64_t msg_real_time_ns() const { return msg_real_time_ns_; }
   uint64_t msg_play_time_ns() const { return msg_play_time_ns_; }
+  const std::string& channel_name() const;
   static uint64_t played_msg_num() { return played_msg_num_.load(); }
 
  private:
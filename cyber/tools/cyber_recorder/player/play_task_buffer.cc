@@ -22,42 +22,77 @@ namespace apollo {
 namespace cyber {
 namespace record {
 
-PlayTaskBuffer::PlayTaskBuffer() {}
+namespace {
 
-PlayTaskBuffer::~PlayTaskBuffer() { tasks_.clear(); }
+size_t RoundUpToPowerOfTwo(size_t n) {
+  size_t power = 1;
+  while (power < n) {
+    power <<= 1;
+  }
+  return power;
+}
+
+}  // namespace
+
+const size_t PlayTaskBuffer::kDefaultCapacity = 1 << 16;
+
+PlayTaskBuffer::PlayTaskBuffer(size_t capacity)
+    : staged_num_(0),
+      ring_(RoundUpToPowerOfTwo(capacity)),
+      mask_(ring_.size() - 1),
+      head_(0),
+      tail_(0) {}
+
+PlayTaskBuffer::~PlayTaskBuffer() {}
 
 size_t PlayTaskBuffer::Size() const {
-  std::lock_guard<std::mutex> lck(mutex_);
-  return tasks_.size();
+  const uint64_t head = head_.load(std::memory_order_acquire);
+  const uint64_t tail = tail_.load(std::memory_order_acquire);
+  return static_cast<size_t>(tail - head) + staged_num_.load();
 }
 
-bool PlayTaskBuffer::Empty() const {
-  std::lock_guard<std::mutex> lck(mutex_);
-  return tasks_.empty();
-}
+bool PlayTaskBuffer::Empty() const { return Size() == 0; }
 
 void PlayTaskBuffer::Push(const TaskPtr& task) {
   if (task == nullptr) {
     return;
   }
-  std::lock_guard<std::mutex> lck(mutex_);
-  tasks_.insert(std::make_pair(task->msg_play_time_ns(), task));
+  staged_.push({task->msg_play_time_ns(), staged_seq_++, task});
+  staged_num_.fetch_add(1);
+}
+
+bool PlayTaskBuffer::Release(uint64_t play_time_ns) {
+  uint64_t tail = tail_.load(std::memory_order_relaxed);
+  while (!staged_.empty() && staged_.top().play_time_ns <= play_time_ns) {
+    if (tail - head_.load(std::memory_order_acquire) == ring_.size()) {
+      return false;
+    }
+    ring_[tail & mask_] = staged_.top().task;
+    staged_.pop();
+    ++tail;
+    // publish the task before it is no longer counted as staged
+    tail_.store(tail, std::memory_order_release);
+    staged_num_.fetch_sub(1);
+  }
+  return true;
 }
 
 PlayTaskBuffer::TaskPtr PlayTaskBuffer::Front() {
-  std::lock_guard<std::mutex> lck(mutex_);
-  if (tasks_.empty()) {
+  const uint64_t head = head_.load(std::memory_order_relaxed);
+  if (head == tail_.load(std::memory_order_acquire)) {
     return nullptr;
   }
-  auto res = tasks_.begin()->second;
-  return res;
+  return ring_[head & mask_];
 }
 
 void PlayTaskBuffer::PopFront() {
-  std::lock_guard<std::mutex> lck(mutex_);
-  if (!tasks_.empty()) {
-    tasks_.erase(tasks_.begin());
+  const uint64_t head = head_.load(std::memory_order_relaxed);
+  if (head == tail_.load(std::memory_order_acquire)) {
+    return;
   }
+  // drop the message now rather than when the slot is reused
+  ring_[head & mask_].reset();
+  head_.store(head + 1, std::memory_order_release);
 }
 
 }  // namespace record
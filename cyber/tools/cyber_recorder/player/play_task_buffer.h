@@ -18,9 +18,10 @@
 #define CYBER_TOOLS_CYBER_RECORDER_PLAYER_PLAY_TASK_BUFFER_H_
 
 #include <stdint.h>
-#include <map>
+#include <atomic>
 #include <memory>
-#include <mutex>
+#include <queue>
+#include <vector>
 
 #include "cyber/tools/cyber_recorder/player/play_task.h"
 
@@ -28,25 +29,60 @@ namespace apollo {
 namespace cyber {
 namespace record {
 
+/**
+ * @class PlayTaskBuffer
+ * @brief The tasks between the producer and the consumer, in play time order.
+ *
+ * The producer pushes tasks into a heap only it touches, and releases the
+ * ones no later task can precede into a lock-free single producer single
+ * consumer ring the consumer plays from.
+ */
 class PlayTaskBuffer {
  public:
   using TaskPtr = std::shared_ptr<PlayTask>;
-  // if all tasks are in order, we can use other container to replace this
-  using TaskMap = std::multimap<uint64_t, TaskPtr>;
 
-  PlayTaskBuffer();
+  explicit PlayTaskBuffer(size_t capacity = kDefaultCapacity);
   virtual ~PlayTaskBuffer();
 
+  // released and staged tasks, from any thread
   size_t Size() const;
   bool Empty() const;
+  size_t capacity() const { return ring_.size(); }
 
+  // producer only: stages a task
   void Push(const TaskPtr& task);
+  // producer only: moves the staged tasks up to play_time_ns to the ring,
+  // false if the ring filled up first
+  bool Release(uint64_t play_time_ns);
+
+  // consumer only
   TaskPtr Front();
   void PopFront();
 
  private:
-  TaskMap tasks_;
-  mutable std::mutex mutex_;
+  struct StagedTask {
+    uint64_t play_time_ns;
+    uint64_t seq;
+    TaskPtr task;
+  };
+  struct Later {
+    bool operator()(const StagedTask& a, const StagedTask& b) const {
+      return a.play_time_ns > b.play_time_ns ||
+             (a.play_time_ns == b.play_time_ns && a.seq > b.seq);
+    }
+  };
+
+  std::priority_queue<StagedTask, std::vector<StagedTask>, Later> staged_;
+  uint64_t staged_seq_ = 0;
+  std::atomic<size_t> staged_num_;
+
+  std::vector<TaskPtr> ring_;
+  const uint64_t mask_;
+  // written by the consumer and the producer respectively
+  alignas(64) std::atomic<uint64_t> head_;
+  alignas(64) std::atomic<uint64_t> tail_;
+
+  static const size_t kDefaultCapacity;
 };
 
 }  // namespace record
@@ -16,8 +16,10 @@
 
 #include "cyber/tools/cyber_recorder/player/play_task_consumer.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "cyber/common/log.h"
-#include "cyber/time/time.h"
 
 namespace apollo {
 namespace cyber {
@@ -26,6 +28,19 @@ namespace record {
 const uint64_t PlayTaskConsumer::kPauseSleepNanoSec = 100000000UL;
 const uint64_t PlayTaskConsumer::kWaitProduceSleepNanoSec = 5000000UL;
 const uint64_t PlayTaskConsumer::MIN_SLEEP_DURATION_NS = 200000000UL;
+const uint64_t PlayTaskConsumer::kLateThresholdNanoSec = 5000000UL;
+// a sleep may overshoot by tens of microseconds, or more on a loaded host
+const uint64_t PlayTaskConsumer::kSpinNanoSec = 200000UL;
+
+namespace {
+
+uint64_t SteadyNowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
 
 PlayTaskConsumer::PlayTaskConsumer(const TaskBufferPtr& task_buffer,
                                    double play_rate)
@@ -37,7 +52,8 @@ PlayTaskConsumer::PlayTaskConsumer(const TaskBufferPtr& task_buffer,
       is_playonce_(false),
       base_msg_play_time_ns_(0),
       base_msg_real_time_ns_(0),
-      last_played_msg_real_time_ns_(0) {
+      last_played_msg_real_time_ns_(0),
+      late_task_num_(0) {
   if (play_rate_ <= 0) {
     AERROR << "invalid play rate: " << play_rate_
            << " , we will use default value(1.0).";
@@ -65,7 +81,42 @@ void PlayTaskConsumer::Stop() {
   }
 }
 
+std::map<std::string, PlayTaskConsumer::ChannelLateness>
+PlayTaskConsumer::channel_lateness() const {
+  std::lock_guard<std::mutex> lock(lateness_mutex_);
+  return channel_lateness_;
+}
+
+bool PlayTaskConsumer::WaitUntil(uint64_t deadline_ns) {
+  while (!is_stopped_.load()) {
+    const uint64_t now_ns = SteadyNowNs();
+    if (now_ns >= deadline_ns) {
+      return true;
+    }
+    const uint64_t left_ns = deadline_ns - now_ns;
+    if (left_ns > kSpinNanoSec) {
+      std::this_thread::sleep_for(std::chrono::nanoseconds(
+          std::min(left_ns - kSpinNanoSec, MIN_SLEEP_DURATION_NS)));
+    }
+  }
+  return false;
+}
+
+void PlayTaskConsumer::RecordLateness(const std::string& channel_name,
+                                      uint64_t lateness_ns) {
+  std::lock_guard<std::mutex> lock(lateness_mutex_);
+  auto& lateness = channel_lateness_[channel_name];
+  ++lateness.played_num;
+  if (lateness_ns > kLateThresholdNanoSec) {
+    ++lateness.late_num;
+  }
+  lateness.total_lateness_ns += lateness_ns;
+  lateness.max_lateness_ns = std::max(lateness.max_lateness_ns, lateness_ns);
+}
+
 void PlayTaskConsumer::ThreadFunc() {
+  // the steady clock time the first task is due, tasks are due at the same
+  // offsets from it as in play time, scaled by the play rate
   uint64_t base_real_time_ns = 0;
   uint64_t accumulated_pause_time_ns = 0;
 
@@ -77,53 +128,47 @@ void PlayTaskConsumer::ThreadFunc() {
       continue;
     }
 
-    uint64_t sleep_ns = 0;
-
     if (base_msg_play_time_ns_ == 0) {
       base_msg_play_time_ns_ = task->msg_play_time_ns();
       base_msg_real_time_ns_ = task->msg_real_time_ns();
+      base_real_time_ns = SteadyNowNs();
       if (base_msg_play_time_ns_ > begin_time_ns_) {
-        sleep_ns = static_cast<uint64_t>(
+        base_real_time_ns += static_cast<uint64_t>(
             static_cast<double>(base_msg_play_time_ns_ - begin_time_ns_) /
             play_rate_);
-        while (sleep_ns > MIN_SLEEP_DURATION_NS && !is_stopped_.load()) {
-          std::this_thread::sleep_for(
-              std::chrono::nanoseconds(MIN_SLEEP_DURATION_NS));
-          sleep_ns -= MIN_SLEEP_DURATION_NS;
-        }
-
-        if (is_stopped_.load()) {
-          break;
-        }
-
-        std::this_thread::sleep_for(std::chrono::nanoseconds(sleep_ns));
       }
-      base_real_time_ns = Time::Now().ToNanosecond();
       ADEBUG << "base_msg_play_time_ns: " << base_msg_play_time_ns_
              << "base_real_time_ns: " << base_real_time_ns;
     }
 
-    uint64_t task_interval_ns = static_cast<uint64_t>(
+    const uint64_t task_interval_ns = static_cast<uint64_t>(
         static_cast<double>(task->msg_play_time_ns() - base_msg_play_time_ns_) /
         play_rate_);
-    uint64_t real_time_interval_ns = Time::Now().ToNanosecond() -
-                                     base_real_time_ns -
-                                     accumulated_pause_time_ns;
-    if (task_interval_ns > real_time_interval_ns) {
-      sleep_ns = task_interval_ns - real_time_interval_ns;
-      std::this_thread::sleep_for(std::chrono::nanoseconds(sleep_ns));
+    const uint64_t deadline_ns =
+        base_real_time_ns + accumulated_pause_time_ns + task_interval_ns;
+    if (!WaitUntil(deadline_ns)) {
+      break;
+    }
+    const uint64_t lateness_ns = SteadyNowNs() - deadline_ns;
+    if (lateness_ns > kLateThresholdNanoSec) {
+      late_task_num_.fetch_add(1);
     }
 
     task->Play();
+    RecordLateness(task->channel_name(), lateness_ns);
     is_playonce_.exchange(false);
 
     last_played_msg_real_time_ns_ = task->msg_real_time_ns();
-    while (is_paused_.load() && !is_stopped_.load()) {
-      if (is_playonce_.load()) {
-        break;
+    if (is_paused_.load()) {
+      const uint64_t pause_begin_ns = SteadyNowNs();
+      while (is_paused_.load() && !is_stopped_.load()) {
+        if (is_playonce_.load()) {
+          break;
+        }
+        std::this_thread::sleep_for(
+            std::chrono::nanoseconds(kPauseSleepNanoSec));
       }
-      std::this_thread::sleep_for(std::chrono::nanoseconds(kPauseSleepNanoSec));
-      accumulated_pause_time_ns += kPauseSleepNanoSec;
+      accumulated_pause_time_ns += SteadyNowNs() - pause_begin_ns;
     }
     task_buffer_->PopFront();
   }
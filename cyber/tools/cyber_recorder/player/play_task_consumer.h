@@ -19,7 +19,10 @@
 
 #include <stdint.h>
 #include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
 
 #include "cyber/tools/cyber_recorder/player/play_task_buffer.h"
@@ -30,6 +33,14 @@ namespace record {
 
 class PlayTaskConsumer {
  public:
+  // how far behind schedule the messages of a channel were sent
+  struct ChannelLateness {
+    uint64_t played_num = 0;
+    uint64_t late_num = 0;
+    uint64_t total_lateness_ns = 0;
+    uint64_t max_lateness_ns = 0;
+  };
+
   using ThreadPtr = std::unique_ptr<std::thread>;
   using TaskBufferPtr = std::shared_ptr<PlayTaskBuffer>;
 
@@ -48,9 +59,16 @@ class PlayTaskConsumer {
   uint64_t last_played_msg_real_time_ns() const {
     return last_played_msg_real_time_ns_;
   }
+  // tasks sent later than kLateThresholdNanoSec behind schedule
+  uint64_t late_task_num() const { return late_task_num_.load(); }
+  std::map<std::string, ChannelLateness> channel_lateness() const;
 
  private:
   void ThreadFunc();
+  // sleeps until close to the deadline and spins the rest of the way, false
+  // if stopped first
+  bool WaitUntil(uint64_t deadline_ns);
+  void RecordLateness(const std::string& channel_name, uint64_t lateness_ns);
 
   double play_rate_;
   ThreadPtr consume_th_;
@@ -62,9 +80,14 @@ class PlayTaskConsumer {
   uint64_t base_msg_play_time_ns_;
   uint64_t base_msg_real_time_ns_;
   uint64_t last_played_msg_real_time_ns_;
+  std::atomic<uint64_t> late_task_num_;
+  std::map<std::string, ChannelLateness> channel_lateness_;
+  mutable std::mutex lateness_mutex_;
   static const uint64_t kPauseSleepNanoSec;
   static const uint64_t kWaitProduceSleepNanoSec;
   static const uint64_t MIN_SLEEP_DURATION_NS;
+  static const uint64_t kLateThresholdNanoSec;
+  static const uint64_t kSpinNanoSec;
 };
 
 }  // namespace record
@@ -0,0 +1,146 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/tools/cyber_recorder/player/play_task_prefetcher.h"
+
+#include <algorithm>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+const uint32_t PlayTaskPrefetcher::kMaxThreadNum = 4;
+const size_t PlayTaskPrefetcher::kMaxDecodedChunks = 8;
+
+PlayTaskPrefetcher::PlayTaskPrefetcher(
+    const std::vector<RecordReaderPtr>& readers, uint64_t begin_time_ns,
+    uint64_t end_time_ns) {
+  for (auto& reader : readers) {
+    const auto& chunk_index = reader->GetChunkIndex();
+    for (size_t i = 0; i < chunk_index.size(); ++i) {
+      const auto& entry = chunk_index[i];
+      if (entry.end_time < begin_time_ns || entry.begin_time > end_time_ns) {
+        continue;
+      }
+      jobs_.push_back({reader, i, entry.begin_time});
+    }
+  }
+  std::stable_sort(jobs_.begin(), jobs_.end(),
+                   [](const Job& lhs, const Job& rhs) {
+                     return lhs.begin_time < rhs.begin_time;
+                   });
+}
+
+PlayTaskPrefetcher::~PlayTaskPrefetcher() { Stop(); }
+
+void PlayTaskPrefetcher::Start() {
+  Stop();
+  {
+    std::lock_guard<std::mutex> lck(mutex_);
+    chunks_.assign(jobs_.size(), nullptr);
+    decoded_.assign(jobs_.size(), false);
+    next_job_ = 0;
+    next_out_ = 0;
+    ready_num_ = 0;
+    is_stopped_ = false;
+  }
+  uint32_t thread_num = std::max(
+      1u, std::min(kMaxThreadNum, std::thread::hardware_concurrency()));
+  for (uint32_t i = 0; i < thread_num; ++i) {
+    threads_.emplace_back(&PlayTaskPrefetcher::ThreadFunc, this);
+  }
+}
+
+void PlayTaskPrefetcher::Stop() {
+  {
+    std::lock_guard<std::mutex> lck(mutex_);
+    is_stopped_ = true;
+  }
+  job_cv_.notify_all();
+  ready_cv_.notify_all();
+  for (auto& thread : threads_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+  threads_.clear();
+}
+
+PlayTaskPrefetcher::ChunkPtr PlayTaskPrefetcher::Next() {
+  std::unique_lock<std::mutex> lck(mutex_);
+  ready_cv_.wait(lck, [this] {
+    return is_stopped_ || next_out_ >= jobs_.size() || decoded_[next_out_];
+  });
+  if (is_stopped_ || next_out_ >= jobs_.size()) {
+    return nullptr;
+  }
+  ChunkPtr chunk = std::move(chunks_[next_out_]);
+  ++next_out_;
+  --ready_num_;
+  lck.unlock();
+  job_cv_.notify_one();
+  return chunk;
+}
+
+size_t PlayTaskPrefetcher::ready_depth() const {
+  std::lock_guard<std::mutex> lck(mutex_);
+  return ready_num_;
+}
+
+size_t PlayTaskPrefetcher::decoding_depth() const {
+  std::lock_guard<std::mutex> lck(mutex_);
+  return next_job_ - next_out_ - ready_num_;
+}
+
+void PlayTaskPrefetcher::ThreadFunc() {
+  while (true) {
+    size_t index = 0;
+    {
+      std::unique_lock<std::mutex> lck(mutex_);
+      // stay at most kMaxDecodedChunks ahead of the producer
+      job_cv_.wait(lck, [this] {
+        return is_stopped_ || (next_job_ < jobs_.size() &&
+                               next_job_ - next_out_ < kMaxDecodedChunks);
+      });
+      if (is_stopped_) {
+        break;
+      }
+      index = next_job_++;
+    }
+
+    auto chunk = std::make_shared<proto::ChunkBody>();
+    const auto& job = jobs_[index];
+    if (!job.reader->ReadChunk(job.chunk_index, chunk.get())) {
+      AERROR << "read chunk failed, chunk index: " << job.chunk_index;
+      chunk->Clear();
+    }
+
+    {
+      std::lock_guard<std::mutex> lck(mutex_);
+      chunks_[index] = chunk;
+      decoded_[index] = true;
+      ++ready_num_;
+    }
+    ready_cv_.notify_all();
+  }
+}
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,91 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#ifndef CYBER_TOOLS_CYBER_RECORDER_PLAYER_PLAY_TASK_PREFETCHER_H_
+#define CYBER_TOOLS_CYBER_RECORDER_PLAYER_PLAY_TASK_PREFETCHER_H_
+
+#include <stdint.h>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "cyber/proto/record.pb.h"
+#include "cyber/record/record_reader.h"
+
+namespace apollo {
+namespace cyber {
+namespace record {
+
+/**
+ * @class PlayTaskPrefetcher
+ * @brief First stage of the player: decodes the chunks of the play window
+ * ahead of time on a few threads and hands them out in begin time order.
+ */
+class PlayTaskPrefetcher {
+ public:
+  using RecordReaderPtr = std::shared_ptr<RecordReader>;
+  using ChunkPtr = std::shared_ptr<proto::ChunkBody>;
+
+  PlayTaskPrefetcher(const std::vector<RecordReaderPtr>& readers,
+                     uint64_t begin_time_ns, uint64_t end_time_ns);
+  virtual ~PlayTaskPrefetcher();
+
+  // (re)start from the first chunk of the play window
+  void Start();
+  void Stop();
+
+  // blocks until the next chunk is decoded, nullptr once all are handed out
+  ChunkPtr Next();
+
+  size_t chunk_num() const { return jobs_.size(); }
+  // decoded chunks waiting for the producer
+  size_t ready_depth() const;
+  // chunks being decoded right now
+  size_t decoding_depth() const;
+
+ private:
+  struct Job {
+    RecordReaderPtr reader;
+    size_t chunk_index;
+    uint64_t begin_time;
+  };
+
+  void ThreadFunc();
+
+  std::vector<Job> jobs_;
+  std::vector<ChunkPtr> chunks_;
+  std::vector<bool> decoded_;
+  size_t next_job_ = 0;
+  size_t next_out_ = 0;
+  size_t ready_num_ = 0;
+  bool is_stopped_ = true;
+  std::vector<std::thread> threads_;
+  mutable std::mutex mutex_;
+  std::condition_variable job_cv_;
+  std::condition_variable ready_cv_;
+
+  static const uint32_t kMaxThreadNum;
+  static const size_t kMaxDecodedChunks;
+};
+
+}  // namespace record
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TOOLS_CYBER_RECORDER_PLAYER_PLAY_TASK_PREFETCHER_H_
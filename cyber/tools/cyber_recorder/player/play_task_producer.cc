@@ -16,13 +16,12 @@
 
 #include "cyber/tools/cyber_recorder/player/play_task_producer.h"
 
+#include <algorithm>
 #include <iostream>
 
 #include "cyber/common/log.h"
 #include "cyber/common/time_conversion.h"
 #include "cyber/cyber.h"
-#include "cyber/message/protobuf_factory.h"
-#include "cyber/record/record_viewer.h"
 
 namespace apollo {
 namespace cyber {
@@ -67,9 +66,20 @@ bool PlayTaskProducer::Init() {
     return false;
   }
 
+  prefetcher_.reset(new PlayTaskPrefetcher(record_readers_,
+                                           play_param_.begin_time_ns,
+                                           play_param_.end_time_ns));
   return true;
 }
 
+size_t PlayTaskProducer::decoding_chunk_num() const {
+  return prefetcher_ == nullptr ? 0 : prefetcher_->decoding_depth();
+}
+
+size_t PlayTaskProducer::decoded_chunk_num() const {
+  return prefetcher_ == nullptr ? 0 : prefetcher_->ready_depth();
+}
+
 void PlayTaskProducer::Start() {
   if (!is_initialized_.load()) {
     AERROR << "please call Init firstly.";
@@ -100,8 +110,6 @@ bool PlayTaskProducer::ReadRecordInfo() {
     return false;
   }
 
-  auto pb_factory = message::ProtobufFactory::Instance();
-
   // loop each file
   for (auto& file : play_param_.files_to_play) {
     auto record_reader = std::make_shared<RecordReader>(file);
@@ -127,8 +135,9 @@ bool PlayTaskProducer::ReadRecordInfo() {
         total_msg_num_ += item.second.message_number();
       }
 
-      auto& proto_desc = item.second.proto_desc();
-      pb_factory->RegisterMessage(proto_desc);
+      // binds the channel id to an interned prototype, so channels repeated
+      // across files are only registered once.
+      record_reader->GetMessageTypeInfo(channel_name);
     }
 
     auto& header = record_reader->header();
@@ -235,38 +244,59 @@ void PlayTaskProducer::ThreadFunc() {
   if (preload_size < kMinTaskBufferSize) {
     preload_size = kMinTaskBufferSize;
   }
-
-  auto record_viewer = std::make_shared<RecordViewer>(
-      record_readers_, play_param_.begin_time_ns, play_param_.end_time_ns,
-      play_param_.channels_to_play);
+  // leave the ring room for the tasks of a chunk released at once
+  preload_size = std::min<uint32_t>(
+      preload_size, static_cast<uint32_t>(task_buffer_->capacity() / 2));
+
+  // waits for room in the buffer and releases the staged tasks up to
+  // play_time_ns, false once stopped
+  auto release = [this, preload_size,
+                  avg_interval_time_ns](uint64_t play_time_ns) {
+    while (!is_stopped_.load() && (task_buffer_->Size() > preload_size ||
+                                   !task_buffer_->Release(play_time_ns))) {
+      std::this_thread::sleep_for(
+          std::chrono::nanoseconds(avg_interval_time_ns));
+    }
+    return !is_stopped_.load();
+  };
 
   uint32_t loop_num = 0;
   while (!is_stopped_.load()) {
     uint64_t plus_time_ns = loop_num * loop_time_ns;
-    auto itr = record_viewer->begin();
-    auto itr_end = record_viewer->end();
-
-    while (itr != itr_end && !is_stopped_.load()) {
-      while (!is_stopped_.load() && task_buffer_->Size() > preload_size) {
-        std::this_thread::sleep_for(
-            std::chrono::nanoseconds(avg_interval_time_ns));
+    prefetcher_->Start();
+
+    // chunks come in begin time order, so no message of this chunk or a
+    // later one plays before the earliest message of this chunk and the
+    // staged tasks up to it can be released in order.
+    for (auto chunk = prefetcher_->Next(); chunk != nullptr;
+         chunk = prefetcher_->Next()) {
+      uint64_t chunk_begin_time_ns = UINT64_MAX;
+      for (const auto& msg : chunk->messages()) {
+        chunk_begin_time_ns = std::min(chunk_begin_time_ns, msg.time());
       }
-      for (; itr != itr_end && !is_stopped_.load(); ++itr) {
-        if (task_buffer_->Size() > preload_size) {
-          break;
+      if (chunk_begin_time_ns != UINT64_MAX &&
+          !release(chunk_begin_time_ns + plus_time_ns)) {
+        break;
+      }
+      for (const auto& msg : chunk->messages()) {
+        if (msg.time() < play_param_.begin_time_ns ||
+            msg.time() > play_param_.end_time_ns) {
+          continue;
         }
 
-        auto search = writers_.find(itr->channel_name);
+        auto search = writers_.find(msg.channel_name());
         if (search == writers_.end()) {
           continue;
         }
 
-        auto raw_msg = std::make_shared<message::RawMessage>(itr->content);
+        auto raw_msg = std::make_shared<message::RawMessage>(msg.content());
         auto task = std::make_shared<PlayTask>(
-            raw_msg, search->second, itr->time, itr->time + plus_time_ns);
+            raw_msg, search->second, msg.time(), msg.time() + plus_time_ns);
         task_buffer_->Push(task);
       }
     }
+    release(UINT64_MAX);
+    prefetcher_->Stop();
 
     if (!play_param_.is_loop_playback) {
       is_stopped_.exchange(true);
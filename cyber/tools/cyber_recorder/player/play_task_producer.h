@@ -33,6 +33,7 @@
 #include "cyber/record/record_reader.h"
 #include "cyber/tools/cyber_recorder/player/play_param.h"
 #include "cyber/tools/cyber_recorder/player/play_task_buffer.h"
+#include "cyber/tools/cyber_recorder/player/play_task_prefetcher.h"
 
 namespace apollo {
 namespace cyber {
@@ -59,6 +60,10 @@ class PlayTaskProducer {
   const PlayParam& play_param() const { return play_param_; }
   bool is_stopped() const { return is_stopped_.load(); }
 
+  // queue depths of the prefetch stage
+  size_t decoding_chunk_num() const;
+  size_t decoded_chunk_num() const;
+
  private:
   bool ReadRecordInfo();
   bool UpdatePlayParam();
@@ -76,6 +81,7 @@ class PlayTaskProducer {
   WriterMap writers_;
   MessageTypeMap msg_types_;
   std::vector<RecordReaderPtr> record_readers_;
+  std::unique_ptr<PlayTaskPrefetcher> prefetcher_;
 
   uint64_t earliest_begin_time_;
   uint64_t latest_end_time_;
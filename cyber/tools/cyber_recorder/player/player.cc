@@ -18,6 +18,8 @@
 
 #include <termios.h>
 
+#include <iomanip>
+
 #include "cyber/init.h"
 
 namespace apollo {
@@ -153,9 +155,15 @@ bool Player::Start() {
           1e9;
     }
 
+    // decoding/decoded chunks, ready messages and late sends tell which of
+    // the prefetch, produce and publish stages falls behind.
     std::cout << std::setprecision(3) << last_played_msg_real_time_s
               << "    Progress: " << progress_time_s << " / "
-              << total_progress_time_s;
+              << total_progress_time_s
+              << "    Chunks: " << producer_->decoding_chunk_num() << "/"
+              << producer_->decoded_chunk_num()
+              << "  Ready: " << task_buffer_->Size()
+              << "  Late: " << consumer_->late_task_num() << "   ";
     std::cout.flush();
 
     if (producer_->is_stopped() && task_buffer_->Empty()) {
@@ -167,6 +175,24 @@ bool Player::Start() {
   }
 
   std::cout << "\nplay finished." << std::endl;
+
+  // how far behind schedule each channel was sent, to tell whether timing
+  // sensitive results of the playback can be trusted
+  std::cout << std::setprecision(3) << std::left << std::setw(48)
+            << "channel" << std::right << std::setw(10) << "played"
+            << std::setw(10) << "late" << std::setw(12) << "avg(ms)"
+            << std::setw(12) << "max(ms)" << std::endl;
+  for (const auto& item : consumer_->channel_lateness()) {
+    const auto& lateness = item.second;
+    std::cout << std::left << std::setw(48) << item.first << std::right
+              << std::setw(10) << lateness.played_num << std::setw(10)
+              << lateness.late_num << std::setw(12)
+              << static_cast<double>(lateness.total_lateness_ns) /
+                     static_cast<double>(lateness.played_num) / 1e6
+              << std::setw(12)
+              << static_cast<double>(lateness.max_lateness_ns) / 1e6
+              << std::endl;
+  }
   std::cout.flags(before);
   return true;
 }
@@ -16,6 +16,9 @@
 
 #include "cyber/tools/cyber_recorder/recoverer.h"
 
+#include <unordered_map>
+#include <utility>
+
 #include "cyber/base/for_each.h"
 #include "cyber/record/header_builder.h"
 
@@ -35,8 +38,10 @@ bool Recoverer::Proc() {
     return false;
   }
 
-  // open output file
+  // open output file, compressed as the input so that its intact chunk
+  // bodies can be copied without being decoded
   Header new_hdr = HeaderBuilder::GetHeader();
+  new_hdr.set_compress(reader_.GetHeader().compress());
   if (!writer_.Open(output_file_)) {
     AERROR << "open output file failed. file: " << output_file_;
     return false;
@@ -68,6 +73,10 @@ bool Recoverer::Proc() {
   }
 
   // read through record file
+  bool chunk_header_valid(false);
+  ChunkHeader chunk_header;
+  std::string chunk_body;
+  std::unordered_map<std::string, uint64_t> message_numbers;
   reader_.Reset();
   while (!reader_.EndOfFile()) {
     Section section;
@@ -93,13 +102,32 @@ bool Recoverer::Proc() {
         break;
       }
       case SectionType::SECTION_CHUNK_HEADER: {
-        ChunkHeader chdr;
-        if (!reader_.ReadSection<ChunkHeader>(section.size, &chdr)) {
+        chunk_header_valid =
+            reader_.ReadSection<ChunkHeader>(section.size, &chunk_header);
+        if (!chunk_header_valid) {
           AINFO << "one chunk header section broken, skip it.";
         }
         break;
       }
       case SectionType::SECTION_CHUNK_BODY: {
+        // a body whose messages all scan is copied as it is, its header
+        // must be intact to describe it
+        const bool copy_chunk_body = chunk_header_valid;
+        chunk_header_valid = false;
+        if (copy_chunk_body) {
+          message_numbers.clear();
+          if (!reader_.ReadRawSection(section.size, &chunk_body) ||
+              !reader_.CountChunkMessages(chunk_body, &message_numbers)) {
+            AINFO << "one chunk body section broken, skip it";
+            break;
+          }
+          if (!writer_.WriteEncodedChunk(chunk_header, std::move(chunk_body),
+                                         message_numbers)) {
+            AERROR << "copy chunk failed.";
+            return false;
+          }
+          break;
+        }
         ChunkBody cbd;
         if (!reader_.ReadSection<ChunkBody>(section.size, &cbd)) {
           AINFO << "one chunk body section broken, skip it";
@@ -16,6 +16,8 @@
 
 #include "cyber/tools/cyber_recorder/spliter.h"
 
+#include <utility>
+
 namespace apollo {
 namespace cyber {
 namespace record {
@@ -33,6 +35,33 @@ Spliter::Spliter(const std::string& input_file, const std::string& output_file,
 
 Spliter::~Spliter() {}
 
+bool Spliter::IsChannelKept(const std::string& channel_name) const {
+  if (!white_channels_.empty() &&
+      std::find(white_channels_.begin(), white_channels_.end(),
+                channel_name) == white_channels_.end()) {
+    return false;
+  }
+  return std::find(black_channels_.begin(), black_channels_.end(),
+                   channel_name) == black_channels_.end();
+}
+
+bool Spliter::FiltersChannels() {
+  if (white_channels_.empty() && black_channels_.empty()) {
+    return false;
+  }
+  if (!reader_.ReadIndex()) {
+    return true;
+  }
+  const Index index = reader_.GetIndex();
+  for (const auto& single_index : index.indexes()) {
+    if (single_index.type() == SectionType::SECTION_CHANNEL &&
+        !IsChannelKept(single_index.channel_cache().name())) {
+      return true;
+    }
+  }
+  return false;
+}
+
 bool Spliter::Proc() {
   // check params
   if (begin_time_ >= end_time_) {
@@ -63,8 +92,12 @@ bool Spliter::Proc() {
     return false;
   }
 
-  // open output file
+  const bool filters_channels = FiltersChannels();
+
+  // open output file, compressed as the input so that its chunk bodies can
+  // be copied without being decoded
   Header new_hdr = HeaderBuilder::GetHeader();
+  new_hdr.set_compress(header.compress());
   if (!writer_.Open(output_file_)) {
     AERROR << "open output file failed. file: " << output_file_;
     return false;
@@ -76,6 +109,10 @@ bool Spliter::Proc() {
 
   // read through record file
   bool skip_next_chunk_body(false);
+  bool copy_next_chunk_body(false);
+  ChunkHeader chunk_header;
+  std::string chunk_body;
+  std::unordered_map<std::string, uint64_t> message_numbers;
   reader_.Reset();
   while (!reader_.EndOfFile()) {
     Section section;
@@ -93,24 +130,23 @@ bool Spliter::Proc() {
           AERROR << "read channel section fail.";
           return false;
         }
-        if (white_channels_.empty() ||
-            std::find(white_channels_.begin(), white_channels_.end(),
-                      chan.name()) != white_channels_.end()) {
-          if (std::find(black_channels_.begin(), black_channels_.end(),
-                        chan.name()) == black_channels_.end()) {
-            writer_.WriteChannel(chan);
-          }
+        if (IsChannelKept(chan.name())) {
+          writer_.WriteChannel(chan);
         }
         break;
       }
       case SectionType::SECTION_CHUNK_HEADER: {
-        ChunkHeader chdr;
-        if (!reader_.ReadSection<ChunkHeader>(section.size, &chdr)) {
+        if (!reader_.ReadSection<ChunkHeader>(section.size, &chunk_header)) {
           AERROR << "read chunk header section fail.";
           return false;
         }
-        if (begin_time_ > chdr.end_time() || end_time_ < chdr.begin_time()) {
+        if (begin_time_ > chunk_header.end_time() ||
+            end_time_ < chunk_header.begin_time()) {
           skip_next_chunk_body = true;
+        } else if (!filters_channels &&
+                   begin_time_ <= chunk_header.begin_time() &&
+                   end_time_ >= chunk_header.end_time()) {
+          copy_next_chunk_body = true;
         }
         break;
       }
@@ -120,21 +156,28 @@ bool Spliter::Proc() {
           skip_next_chunk_body = false;
           break;
         }
+        if (copy_next_chunk_body) {
+          copy_next_chunk_body = false;
+          message_numbers.clear();
+          if (!reader_.ReadRawSection(section.size, &chunk_body) ||
+              !reader_.CountChunkMessages(chunk_body, &message_numbers)) {
+            AERROR << "read chunk body section fail.";
+            return false;
+          }
+          if (!writer_.WriteEncodedChunk(chunk_header, std::move(chunk_body),
+                                         message_numbers)) {
+            AERROR << "copy chunk failed.";
+            return false;
+          }
+          break;
+        }
         ChunkBody cbd;
         if (!reader_.ReadSection<ChunkBody>(section.size, &cbd)) {
           AERROR << "read chunk body section fail.";
           return false;
         }
         for (int idx = 0; idx < cbd.messages_size(); ++idx) {
-          if (!white_channels_.empty() &&
-              std::find(white_channels_.begin(), white_channels_.end(),
-                        cbd.messages(idx).channel_name()) ==
-                  white_channels_.end()) {
-            continue;
-          }
-          if (std::find(black_channels_.begin(), black_channels_.end(),
-                        cbd.messages(idx).channel_name()) !=
-              black_channels_.end()) {
+          if (!IsChannelKept(cbd.messages(idx).channel_name())) {
             continue;
           }
           if (cbd.messages(idx).time() < begin_time_ ||
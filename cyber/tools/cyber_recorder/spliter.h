@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "cyber/common/log.h"
@@ -47,6 +48,11 @@ class Spliter {
   bool Proc();
 
  private:
+  bool IsChannelKept(const std::string& channel_name) const;
+  // Whether some channel of the input file is filtered out, chunks can only
+  // be copied as they are when none is.
+  bool FiltersChannels();
+
   RecordFileReader reader_;
   RecordFileWriter writer_;
   std::string input_file_;
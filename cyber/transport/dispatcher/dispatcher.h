@@ -25,7 +25,7 @@
 #include <string>
 #include <unordered_map>
 
-#include "cyber/base/atomic_hash_map.h"
+#include "cyber/base/resizable_atomic_hash_map.h"
 #include "cyber/base/atomic_rw_lock.h"
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
@@ -37,7 +37,7 @@ namespace apollo {
 namespace cyber {
 namespace transport {
 
-using apollo::cyber::base::AtomicHashMap;
+using apollo::cyber::base::ResizableAtomicHashMap;
 using apollo::cyber::base::AtomicRWLock;
 using apollo::cyber::base::ReadLockGuard;
 using apollo::cyber::base::WriteLockGuard;
@@ -79,7 +79,7 @@ class Dispatcher {
  protected:
   std::atomic<bool> is_shutdown_;
   // key: channel_id of message
-  AtomicHashMap<uint64_t, ListenerHandlerBasePtr> msg_listeners_;
+  ResizableAtomicHashMap<uint64_t, ListenerHandlerBasePtr> msg_listeners_;
   base::AtomicRWLock rw_lock_;
 };
 
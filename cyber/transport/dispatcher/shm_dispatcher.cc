@@ -60,15 +60,24 @@ void ShmDispatcher::ReadMessage(uint64_t channel_id, uint32_t block_index) {
   ADEBUG << "Reading sharedmem message: "
          << GlobalData::GetChannelById(channel_id)
          << " from block: " << block_index;
-  auto rb = std::make_shared<ReadableBlock>();
-  rb->index = block_index;
-  if (!segments_[channel_id]->AcquireBlockToRead(rb.get())) {
+  auto segment = segments_[channel_id];
+  ReadableBlock acquired;
+  acquired.index = block_index;
+  if (!segment->AcquireBlockToRead(&acquired)) {
     AWARN << "fail to acquire block, channel: "
           << GlobalData::GetChannelById(channel_id)
           << " index: " << block_index;
     return;
   }
 
+  // the read lock is held by whoever still references the block, so that
+  // in-place (loaned) messages stay valid until their last reader drops them.
+  std::shared_ptr<ReadableBlock> rb(
+      new ReadableBlock(acquired), [segment](ReadableBlock* block) {
+        segment->ReleaseReadBlock(*block);
+        delete block;
+      });
+
   MessageInfo msg_info;
   const char* msg_info_addr =
       reinterpret_cast<char*>(rb->buf) + rb->block->msg_size();
@@ -79,7 +88,6 @@ void ShmDispatcher::ReadMessage(uint64_t channel_id, uint32_t block_index) {
     AERROR << "error msg info of channel:"
            << GlobalData::GetChannelById(channel_id);
   }
-  segments_[channel_id]->ReleaseReadBlock(*rb);
 }
 
 void ShmDispatcher::OnMessage(uint64_t channel_id,
@@ -21,12 +21,14 @@
 #include <memory>
 #include <string>
 #include <thread>
+#include <type_traits>
 #include <unordered_map>
 
 #include "cyber/base/atomic_rw_lock.h"
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
+#include "cyber/message/arena_pool.h"
 #include "cyber/message/message_traits.h"
 #include "cyber/transport/dispatcher/dispatcher.h"
 #include "cyber/transport/shm/notifier_factory.h"
@@ -61,6 +63,19 @@ class ShmDispatcher : public Dispatcher {
                    const MessageListener<MessageT>& listener);
 
  private:
+  // Loanable messages are handed to listeners in place: the returned message
+  // aliases the shm block and keeps its read lock until it is released.
+  template <typename MessageT>
+  static typename std::enable_if<message::IsLoanable<MessageT>::value,
+                                 std::shared_ptr<MessageT>>::type
+  Materialize(const std::shared_ptr<ReadableBlock>& rb,
+              const message::ArenaPoolPtr& pool);
+  template <typename MessageT>
+  static typename std::enable_if<!message::IsLoanable<MessageT>::value,
+                                 std::shared_ptr<MessageT>>::type
+  Materialize(const std::shared_ptr<ReadableBlock>& rb,
+              const message::ArenaPoolPtr& pool);
+
   void AddSegment(const RoleAttributes& self_attr);
   void ReadMessage(uint64_t channel_id, uint32_t block_index);
   void OnMessage(uint64_t channel_id, const std::shared_ptr<ReadableBlock>& rb,
@@ -82,11 +97,12 @@ template <typename MessageT>
 void ShmDispatcher::AddListener(const RoleAttributes& self_attr,
                                 const MessageListener<MessageT>& listener) {
   // FIXME: make it more clean
-  auto listener_adapter = [listener](const std::shared_ptr<ReadableBlock>& rb,
-                                     const MessageInfo& msg_info) {
-    auto msg = std::make_shared<MessageT>();
-    RETURN_IF(!message::ParseFromArray(
-        rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
+  message::ArenaPoolPtr pool =
+      self_attr.arena_parse() ? message::ArenaPool::Create() : nullptr;
+  auto listener_adapter = [listener, pool](
+      const std::shared_ptr<ReadableBlock>& rb, const MessageInfo& msg_info) {
+    auto msg = Materialize<MessageT>(rb, pool);
+    RETURN_IF_NULL(msg);
     listener(msg, msg_info);
   };
 
@@ -99,11 +115,12 @@ void ShmDispatcher::AddListener(const RoleAttributes& self_attr,
                                 const RoleAttributes& opposite_attr,
                                 const MessageListener<MessageT>& listener) {
   // FIXME: make it more clean
-  auto listener_adapter = [listener](const std::shared_ptr<ReadableBlock>& rb,
-                                     const MessageInfo& msg_info) {
-    auto msg = std::make_shared<MessageT>();
-    RETURN_IF(!message::ParseFromArray(
-        rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
+  message::ArenaPoolPtr pool =
+      self_attr.arena_parse() ? message::ArenaPool::Create() : nullptr;
+  auto listener_adapter = [listener, pool](
+      const std::shared_ptr<ReadableBlock>& rb, const MessageInfo& msg_info) {
+    auto msg = Materialize<MessageT>(rb, pool);
+    RETURN_IF_NULL(msg);
     listener(msg, msg_info);
   };
 
@@ -112,6 +129,35 @@ void ShmDispatcher::AddListener(const RoleAttributes& self_attr,
   AddSegment(self_attr);
 }
 
+template <typename MessageT>
+typename std::enable_if<message::IsLoanable<MessageT>::value,
+                        std::shared_ptr<MessageT>>::type
+ShmDispatcher::Materialize(const std::shared_ptr<ReadableBlock>& rb,
+                           const message::ArenaPoolPtr& pool) {
+  (void)pool;
+  if (rb->block->msg_size() != sizeof(MessageT)) {
+    AERROR << "loaned message size mismatch: " << rb->block->msg_size()
+           << " vs " << sizeof(MessageT);
+    return nullptr;
+  }
+  return std::shared_ptr<MessageT>(rb, reinterpret_cast<MessageT*>(rb->buf));
+}
+
+template <typename MessageT>
+typename std::enable_if<!message::IsLoanable<MessageT>::value,
+                        std::shared_ptr<MessageT>>::type
+ShmDispatcher::Materialize(const std::shared_ptr<ReadableBlock>& rb,
+                           const message::ArenaPoolPtr& pool) {
+  auto msg = pool == nullptr ? std::make_shared<MessageT>()
+                             : pool->CreateMessage<MessageT>();
+  if (!message::ParseFromArray(
+          rb->buf, static_cast<int>(rb->block->msg_size()), msg.get())) {
+    AWARN << "parse from shm block failed.";
+    return nullptr;
+  }
+  return msg;
+}
+
 }  // namespace transport
 }  // namespace cyber
 }  // namespace apollo
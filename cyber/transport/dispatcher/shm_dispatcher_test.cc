@@ -94,6 +94,66 @@ TEST(ShmDispatcherTest, on_message) {
   EXPECT_EQ(recv_msg->message, send_msg->message);
 }
 
+struct LoanedPoint {
+  double x;
+  double y;
+  uint32_t id;
+};
+
+TEST(ShmDispatcherTest, on_loaned_message) {
+  auto dispatcher = ShmDispatcher::Instance();
+
+  RoleAttributes oppo_attr;
+  oppo_attr.set_host_name(common::GlobalData::Instance()->HostName());
+  oppo_attr.set_host_ip(common::GlobalData::Instance()->HostIp());
+  oppo_attr.set_channel_name("on_loaned_message");
+  oppo_attr.set_channel_id(common::Hash("on_loaned_message"));
+  Identity oppo_id;
+  oppo_attr.set_id(oppo_id.HashValue());
+
+  auto transmitter = Transport::Instance()->CreateTransmitter<LoanedPoint>(
+      oppo_attr, proto::OptionalMode::SHM);
+  EXPECT_TRUE(transmitter != nullptr);
+
+  RoleAttributes self_attr;
+  self_attr.set_channel_name("on_loaned_message");
+  self_attr.set_channel_id(common::Hash("on_loaned_message"));
+  Identity self_id;
+  self_attr.set_id(self_id.HashValue());
+
+  std::shared_ptr<LoanedPoint> recv_msg = nullptr;
+  dispatcher->AddListener<LoanedPoint>(
+      self_attr, [&recv_msg](const std::shared_ptr<LoanedPoint>& msg,
+                             const MessageInfo& msg_info) {
+        (void)msg_info;
+        recv_msg = msg;
+      });
+
+  LoanedMessage<LoanedPoint> loaned;
+  EXPECT_TRUE(transmitter->Loan(&loaned));
+  EXPECT_TRUE(loaned.valid());
+  loaned->x = 1.0;
+  loaned->y = 2.0;
+  loaned->id = 3;
+  EXPECT_TRUE(transmitter->Transmit(&loaned));
+  EXPECT_FALSE(loaned.valid());
+
+  sleep(1);
+  ASSERT_NE(recv_msg, nullptr);
+  EXPECT_EQ(recv_msg->x, 1.0);
+  EXPECT_EQ(recv_msg->y, 2.0);
+  EXPECT_EQ(recv_msg->id, 3u);
+  recv_msg = nullptr;
+
+  // a loan of a serialized message type is refused
+  auto raw_transmitter =
+      Transport::Instance()->CreateTransmitter<message::RawMessage>(
+          oppo_attr, proto::OptionalMode::SHM);
+  LoanedMessage<message::RawMessage> raw_loaned;
+  EXPECT_FALSE(raw_transmitter->Loan(&raw_loaned));
+  EXPECT_FALSE(raw_loaned.valid());
+}
+
 TEST(ShmDispatcherTest, shutdown) {
   auto dispatcher = ShmDispatcher::Instance();
   dispatcher->Shutdown();
@@ -24,21 +24,42 @@ namespace apollo {
 namespace cyber {
 namespace transport {
 
-const std::size_t MessageInfo::kSize = 2 * ID_SIZE + sizeof(uint64_t);
-
-MessageInfo::MessageInfo() : sender_id_(false), seq_num_(0), spare_id_(false) {}
+const std::size_t MessageInfo::kBaseSize = 2 * ID_SIZE + sizeof(uint64_t);
+const std::size_t MessageInfo::kSize =
+    MessageInfo::kBaseSize + 3 * sizeof(uint64_t);
+
+MessageInfo::MessageInfo()
+    : sender_id_(false),
+      seq_num_(0),
+      spare_id_(false),
+      send_time_(0),
+      trace_id_(0),
+      trace_start_time_(0) {}
 
 MessageInfo::MessageInfo(const Identity& sender_id, uint64_t seq_num)
-    : sender_id_(sender_id), seq_num_(seq_num), spare_id_(false) {}
+    : sender_id_(sender_id),
+      seq_num_(seq_num),
+      spare_id_(false),
+      send_time_(0),
+      trace_id_(0),
+      trace_start_time_(0) {}
 
 MessageInfo::MessageInfo(const Identity& sender_id, uint64_t seq_num,
                          const Identity& spare_id)
-    : sender_id_(sender_id), seq_num_(seq_num), spare_id_(spare_id) {}
+    : sender_id_(sender_id),
+      seq_num_(seq_num),
+      spare_id_(spare_id),
+      send_time_(0),
+      trace_id_(0),
+      trace_start_time_(0) {}
 
 MessageInfo::MessageInfo(const MessageInfo& another)
     : sender_id_(another.sender_id_),
       seq_num_(another.seq_num_),
-      spare_id_(another.spare_id_) {}
+      spare_id_(another.spare_id_),
+      send_time_(another.send_time_),
+      trace_id_(another.trace_id_),
+      trace_start_time_(another.trace_start_time_) {}
 
 MessageInfo::~MessageInfo() {}
 
@@ -47,6 +68,9 @@ MessageInfo& MessageInfo::operator=(const MessageInfo& another) {
     sender_id_ = another.sender_id_;
     seq_num_ = another.seq_num_;
     spare_id_ = another.spare_id_;
+    send_time_ = another.send_time_;
+    trace_id_ = another.trace_id_;
+    trace_start_time_ = another.trace_start_time_;
   }
   return *this;
 }
@@ -63,6 +87,11 @@ bool MessageInfo::operator==(const MessageInfo& another) const {
   if (spare_id_ != another.spare_id_) {
     return false;
   }
+
+  if (send_time_ != another.send_time_ || trace_id_ != another.trace_id_ ||
+      trace_start_time_ != another.trace_start_time_) {
+    return false;
+  }
   return true;
 }
 
@@ -73,6 +102,10 @@ bool MessageInfo::SerializeTo(std::string* dst) const {
   dst->append(reinterpret_cast<char*>(const_cast<uint64_t*>(&seq_num_)),
               sizeof(seq_num_));
   dst->append(spare_id_.data(), ID_SIZE);
+  dst->append(reinterpret_cast<const char*>(&send_time_), sizeof(send_time_));
+  dst->append(reinterpret_cast<const char*>(&trace_id_), sizeof(trace_id_));
+  dst->append(reinterpret_cast<const char*>(&trace_start_time_),
+              sizeof(trace_start_time_));
 
   return true;
 }
@@ -90,6 +123,12 @@ bool MessageInfo::SerializeTo(char* dst, std::size_t len) const {
          sizeof(seq_num_));
   ptr += sizeof(seq_num_);
   memcpy(ptr, spare_id_.data(), ID_SIZE);
+  ptr += ID_SIZE;
+  memcpy(ptr, &send_time_, sizeof(send_time_));
+  ptr += sizeof(send_time_);
+  memcpy(ptr, &trace_id_, sizeof(trace_id_));
+  ptr += sizeof(trace_id_);
+  memcpy(ptr, &trace_start_time_, sizeof(trace_start_time_));
 
   return true;
 }
@@ -100,7 +139,7 @@ bool MessageInfo::DeserializeFrom(const std::string& src) {
 
 bool MessageInfo::DeserializeFrom(const char* src, std::size_t len) {
   RETURN_VAL_IF_NULL(src, false);
-  if (len != kSize) {
+  if (len != kSize && len != kBaseSize) {
     AWARN << "src size mismatch, given[" << len << "] target[" << kSize << "]";
     return false;
   }
@@ -111,6 +150,18 @@ bool MessageInfo::DeserializeFrom(const char* src, std::size_t len) {
   memcpy(reinterpret_cast<char*>(&seq_num_), ptr, sizeof(seq_num_));
   ptr += sizeof(seq_num_);
   spare_id_.set_data(ptr);
+  ptr += ID_SIZE;
+
+  send_time_ = 0;
+  trace_id_ = 0;
+  trace_start_time_ = 0;
+  if (len == kSize) {
+    memcpy(&send_time_, ptr, sizeof(send_time_));
+    ptr += sizeof(send_time_);
+    memcpy(&trace_id_, ptr, sizeof(trace_id_));
+    ptr += sizeof(trace_id_);
+    memcpy(&trace_start_time_, ptr, sizeof(trace_start_time_));
+  }
 
   return true;
 }
@@ -54,12 +54,29 @@ class MessageInfo {
   const Identity& spare_id() const { return spare_id_; }
   void set_spare_id(const Identity& spare_id) { spare_id_ = spare_id; }
 
+  // channel tracing, all zero unless the writer had tracing enabled
+  uint64_t send_time() const { return send_time_; }
+  void set_send_time(uint64_t send_time) { send_time_ = send_time; }
+
+  uint64_t trace_id() const { return trace_id_; }
+  void set_trace_id(uint64_t trace_id) { trace_id_ = trace_id; }
+
+  uint64_t trace_start_time() const { return trace_start_time_; }
+  void set_trace_start_time(uint64_t trace_start_time) {
+    trace_start_time_ = trace_start_time;
+  }
+
   static const std::size_t kSize;
+  // size written by peers without the tracing fields
+  static const std::size_t kBaseSize;
 
  private:
   Identity sender_id_;
   uint64_t seq_num_;
   Identity spare_id_;
+  uint64_t send_time_;
+  uint64_t trace_id_;
+  uint64_t trace_start_time_;
 };
 
 }  // namespace transport
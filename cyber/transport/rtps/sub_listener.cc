@@ -18,6 +18,7 @@
 
 #include "cyber/common/log.h"
 #include "cyber/common/util.h"
+#include "cyber/transport/rtps/underlay_batch.h"
 
 namespace apollo {
 namespace cyber {
@@ -57,6 +58,15 @@ void SubListener::onNewDataMessage(eprosima::fastrtps::Subscriber* sub) {
       m_info.related_sample_identity.sequence_number().low;
   msg_info_.set_seq_num(seq_num);
 
+  if (m.datatype() == UnderlayBatch::kDataType) {
+    std::vector<UnderlayBatch::Entry> entries;
+    RETURN_IF(!UnderlayBatch::Unpack(m.data(), &entries));
+    for (auto& entry : entries) {
+      callback_(channel_id, entry.first, entry.second);
+    }
+    return;
+  }
+
   // fetch message string
   std::shared_ptr<std::string> msg_str =
       std::make_shared<std::string>(m.data());
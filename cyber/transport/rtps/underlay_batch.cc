@@ -0,0 +1,88 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/transport/rtps/underlay_batch.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "cyber/common/global_data.h"
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+const char* const UnderlayBatch::kDataType = "apollo.cyber.batch";
+
+void UnderlayBatch::Append(const std::string& msg, const MessageInfo& msg_info,
+                           std::string* batch) {
+  uint32_t size = static_cast<uint32_t>(msg.size());
+  auto offset = batch->size();
+  batch->resize(offset + sizeof(size) + MessageInfo::kSize + msg.size());
+  char* ptr = &(*batch)[offset];
+  std::memcpy(ptr, &size, sizeof(size));
+  ptr += sizeof(size);
+  msg_info.SerializeTo(ptr, MessageInfo::kSize);
+  ptr += MessageInfo::kSize;
+  std::memcpy(ptr, msg.data(), msg.size());
+}
+
+bool UnderlayBatch::Unpack(const std::string& batch,
+                           std::vector<Entry>* entries) {
+  const char* ptr = batch.data();
+  const char* end = ptr + batch.size();
+  while (ptr < end) {
+    uint32_t size = 0;
+    if (end - ptr < static_cast<std::ptrdiff_t>(sizeof(size) +
+                                                MessageInfo::kSize)) {
+      AERROR << "truncated batch entry header.";
+      return false;
+    }
+    std::memcpy(&size, ptr, sizeof(size));
+    ptr += sizeof(size);
+    MessageInfo msg_info;
+    if (!msg_info.DeserializeFrom(ptr, MessageInfo::kSize)) {
+      AERROR << "invalid batch entry message info.";
+      return false;
+    }
+    ptr += MessageInfo::kSize;
+    if (end - ptr < static_cast<std::ptrdiff_t>(size)) {
+      AERROR << "truncated batch entry of " << size << " bytes.";
+      return false;
+    }
+    entries->emplace_back(std::make_shared<std::string>(ptr, size), msg_info);
+    ptr += size;
+  }
+  return true;
+}
+
+bool UnderlayBatch::GetConf(const std::string& channel_name,
+                            proto::RtpsBatchConf* conf) {
+  auto& global_conf = common::GlobalData::Instance()->Config();
+  for (auto& batch_conf : global_conf.transport_conf().rtps_batch_conf()) {
+    if (batch_conf.channel_name() == channel_name) {
+      conf->CopyFrom(batch_conf);
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,60 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#ifndef CYBER_TRANSPORT_RTPS_UNDERLAY_BATCH_H_
+#define CYBER_TRANSPORT_RTPS_UNDERLAY_BATCH_H_
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cyber/proto/transport_conf.pb.h"
+#include "cyber/transport/message/message_info.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+/**
+ * @class UnderlayBatch
+ * @brief Packs several messages of one channel into a single rtps sample.
+ *
+ * A batch sample carries kDataType as datatype and a data field made of
+ * entries laid out as [uint32 size][MessageInfo][serialized message], so every
+ * message keeps its own sender and sequence number.
+ */
+class UnderlayBatch {
+ public:
+  using Entry = std::pair<std::shared_ptr<std::string>, MessageInfo>;
+
+  static const char* const kDataType;
+
+  static void Append(const std::string& msg, const MessageInfo& msg_info,
+                     std::string* batch);
+  static bool Unpack(const std::string& batch, std::vector<Entry>* entries);
+
+  // false if the channel is not configured for batching
+  static bool GetConf(const std::string& channel_name,
+                      proto::RtpsBatchConf* conf);
+};
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_RTPS_UNDERLAY_BATCH_H_
@@ -0,0 +1,74 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/transport/rtps/underlay_batch.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cyber/transport/common/identity.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+TEST(UnderlayBatchTest, append_and_unpack) {
+  Identity sender;
+  Identity spare;
+  std::string batch;
+  UnderlayBatch::Append("first", MessageInfo(sender, 1, spare), &batch);
+  UnderlayBatch::Append("", MessageInfo(sender, 2, spare), &batch);
+  UnderlayBatch::Append(std::string(1000, 'x'), MessageInfo(sender, 3, spare),
+                        &batch);
+
+  std::vector<UnderlayBatch::Entry> entries;
+  EXPECT_TRUE(UnderlayBatch::Unpack(batch, &entries));
+  ASSERT_EQ(3, entries.size());
+  EXPECT_EQ("first", *entries[0].first);
+  EXPECT_EQ("", *entries[1].first);
+  EXPECT_EQ(std::string(1000, 'x'), *entries[2].first);
+  for (uint64_t i = 0; i < entries.size(); ++i) {
+    EXPECT_EQ(i + 1, entries[i].second.seq_num());
+    EXPECT_EQ(sender, entries[i].second.sender_id());
+  }
+}
+
+TEST(UnderlayBatchTest, truncated) {
+  Identity sender;
+  std::string batch;
+  UnderlayBatch::Append("payload", MessageInfo(sender, 1, sender), &batch);
+
+  std::vector<UnderlayBatch::Entry> entries;
+  EXPECT_FALSE(UnderlayBatch::Unpack(batch.substr(0, batch.size() - 1),
+                                     &entries));
+  entries.clear();
+  EXPECT_FALSE(UnderlayBatch::Unpack(batch.substr(0, 3), &entries));
+  entries.clear();
+  EXPECT_TRUE(UnderlayBatch::Unpack("", &entries));
+  EXPECT_TRUE(entries.empty());
+}
+
+TEST(UnderlayBatchTest, get_conf) {
+  proto::RtpsBatchConf conf;
+  EXPECT_FALSE(UnderlayBatch::GetConf("/not/batched", &conf));
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
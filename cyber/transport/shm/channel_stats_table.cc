@@ -0,0 +1,206 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/transport/shm/channel_stats_table.h"
+
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "cyber/common/environment.h"
+#include "cyber/common/global_data.h"
+#include "cyber/common/log.h"
+#include "cyber/time/time.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+using common::GetEnv;
+using common::GlobalData;
+
+// The slots are zeroed when the shared memory is created, and a slot is free
+// until a writer stores its channel id. Every counter is a lock free atomic,
+// which stays atomic across the processes mapping the table.
+class ChannelStatsTable::Slot {
+ public:
+  std::atomic<uint64_t> channel_id;
+  std::atomic<uint64_t> num_messages;
+  std::atomic<uint64_t> num_bytes;
+  std::atomic<uint64_t> last_size;
+  std::atomic<uint64_t> last_seq;
+  std::atomic<uint64_t> num_failed;
+  std::atomic<uint64_t> last_publish_time;
+  std::atomic<uint64_t> mean_interval;
+  // set once channel_name is written
+  std::atomic<uint64_t> name_ready;
+  char channel_name[kMaxChannelNameSize];
+};
+
+constexpr size_t ChannelStatsTable::kNumSlots;
+constexpr size_t ChannelStatsTable::kMaxChannelNameSize;
+
+namespace {
+
+// The weight of the last interval in the mean interval, as a shift.
+constexpr int kIntervalSmoothingShift = 3;
+
+}  // namespace
+
+ChannelStatsTable::ChannelStatsTable() {
+  auto channel_stats = GetEnv("cyber_channel_stats");
+  if (channel_stats != "" && !std::stoi(channel_stats)) {
+    return;
+  }
+  // The layout version is part of the key, so that processes built with
+  // another layout use another table.
+  const key_t key =
+      static_cast<key_t>(GlobalData::GenerateHashId("cyber_channel_stats_1"));
+  const size_t size = sizeof(Slot) * kNumSlots;
+  const int shmid = shmget(key, size, 0644 | IPC_CREAT);
+  if (shmid == -1) {
+    AWARN << "channel stats table is disabled, shmget failed: "
+          << std::strerror(errno);
+    return;
+  }
+  void* shm = shmat(shmid, nullptr, 0);
+  if (shm == reinterpret_cast<void*>(-1)) {
+    AWARN << "channel stats table is disabled, shmat failed: "
+          << std::strerror(errno);
+    return;
+  }
+  slots_ = static_cast<Slot*>(shm);
+}
+
+ChannelStatsTable::~ChannelStatsTable() {
+  if (slots_ != nullptr) {
+    shmdt(slots_);
+    slots_ = nullptr;
+  }
+}
+
+ChannelStatsTable::Slot* ChannelStatsTable::GetSlot(
+    uint64_t channel_id, const std::string& channel_name) {
+  if (slots_ == nullptr || channel_id == 0) {
+    return nullptr;
+  }
+  for (size_t i = 0; i < kNumSlots; ++i) {
+    Slot* slot = &slots_[(channel_id + i) % kNumSlots];
+    uint64_t id = slot->channel_id.load(std::memory_order_acquire);
+    if (id == 0 && slot->channel_id.compare_exchange_strong(
+                       id, channel_id, std::memory_order_acq_rel)) {
+      const size_t name_size =
+          std::min(channel_name.size(), kMaxChannelNameSize - 1);
+      std::memcpy(slot->channel_name, channel_name.data(), name_size);
+      slot->channel_name[name_size] = '\0';
+      slot->name_ready.store(1, std::memory_order_release);
+      return slot;
+    }
+    if (id == channel_id) {
+      return slot;
+    }
+  }
+  AWARN << "channel stats table is full, " << channel_name
+        << " is not tracked.";
+  return nullptr;
+}
+
+void ChannelStatsTable::OnTransmit(Slot* slot, uint64_t seq, uint64_t size,
+                                   bool success) {
+  if (slot == nullptr) {
+    return;
+  }
+  if (!success) {
+    slot->num_failed.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  const uint64_t now = Time::Now().ToNanosecond();
+  const uint64_t last =
+      slot->last_publish_time.exchange(now, std::memory_order_relaxed);
+  if (last != 0 && now > last) {
+    // Concurrent writers may lose an update of the mean, which only makes it
+    // a little less smooth.
+    const int64_t mean = slot->mean_interval.load(std::memory_order_relaxed);
+    const int64_t interval = static_cast<int64_t>(now - last);
+    slot->mean_interval.store(
+        mean == 0 ? interval
+                  : mean + ((interval - mean) >> kIntervalSmoothingShift),
+        std::memory_order_relaxed);
+  }
+  slot->num_messages.fetch_add(1, std::memory_order_relaxed);
+  slot->num_bytes.fetch_add(size, std::memory_order_relaxed);
+  slot->last_size.store(size, std::memory_order_relaxed);
+  slot->last_seq.store(seq, std::memory_order_relaxed);
+}
+
+void ChannelStatsTable::ReadSlot(const Slot& slot, ChannelStats* stats) {
+  stats->channel_id = slot.channel_id.load(std::memory_order_acquire);
+  if (slot.name_ready.load(std::memory_order_acquire)) {
+    stats->channel_name.assign(
+        slot.channel_name, strnlen(slot.channel_name, kMaxChannelNameSize));
+  } else {
+    stats->channel_name.clear();
+  }
+  stats->num_messages = slot.num_messages.load(std::memory_order_relaxed);
+  stats->num_bytes = slot.num_bytes.load(std::memory_order_relaxed);
+  stats->last_size = slot.last_size.load(std::memory_order_relaxed);
+  stats->last_seq = slot.last_seq.load(std::memory_order_relaxed);
+  stats->num_failed = slot.num_failed.load(std::memory_order_relaxed);
+  stats->last_publish_time =
+      slot.last_publish_time.load(std::memory_order_relaxed);
+  stats->mean_interval = slot.mean_interval.load(std::memory_order_relaxed);
+}
+
+bool ChannelStatsTable::GetStats(uint64_t channel_id,
+                                 ChannelStats* stats) const {
+  if (slots_ == nullptr || channel_id == 0) {
+    return false;
+  }
+  for (size_t i = 0; i < kNumSlots; ++i) {
+    const Slot& slot = slots_[(channel_id + i) % kNumSlots];
+    const uint64_t id = slot.channel_id.load(std::memory_order_acquire);
+    if (id == 0) {
+      return false;
+    }
+    if (id == channel_id) {
+      ReadSlot(slot, stats);
+      return true;
+    }
+  }
+  return false;
+}
+
+void ChannelStatsTable::GetAllStats(std::vector<ChannelStats>* stats) const {
+  stats->clear();
+  if (slots_ == nullptr) {
+    return;
+  }
+  for (size_t i = 0; i < kNumSlots; ++i) {
+    if (slots_[i].channel_id.load(std::memory_order_acquire) != 0) {
+      stats->emplace_back();
+      ReadSlot(slots_[i], &stats->back());
+    }
+  }
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#ifndef CYBER_TRANSPORT_SHM_CHANNEL_STATS_TABLE_H_
+#define CYBER_TRANSPORT_SHM_CHANNEL_STATS_TABLE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "cyber/common/macros.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+/**
+ * @brief What the writers of a channel on this host have published, as read
+ * from the ChannelStatsTable.
+ */
+struct ChannelStats {
+  uint64_t channel_id = 0;
+  std::string channel_name;
+  uint64_t num_messages = 0;
+  uint64_t num_bytes = 0;
+  // the serialized size of the last message, 0 when it was not serialized
+  uint64_t last_size = 0;
+  uint64_t last_seq = 0;
+  // the messages whose transmit failed, i.e. the gaps in the sequence
+  // numbers the readers receive
+  uint64_t num_failed = 0;
+  uint64_t last_publish_time = 0;
+  // the smoothed interval between two messages, 0 before the second
+  uint64_t mean_interval = 0;
+
+  double rate() const {
+    return mean_interval == 0 ? 0.0 : 1e9 / static_cast<double>(mean_interval);
+  }
+};
+
+/**
+ * @class ChannelStatsTable
+ * @brief Transport level statistics of every channel written on this host,
+ * kept in one shared memory table by the writers themselves.
+ *
+ * Each transmitter updates the slot of its channel with a few relaxed atomic
+ * stores per message, so a monitor reads the rate, size, delay and failures
+ * of any channel without subscribing to it or parsing its messages. All the
+ * writers of a channel on the host share its slot. The table outlives the
+ * processes, so the slot of a channel whose writers died keeps its last
+ * publish time and shows the channel as delayed.
+ *
+ * Disabled by setting the cyber_channel_stats environment variable to 0.
+ */
+class ChannelStatsTable {
+ public:
+  class Slot;
+
+  static constexpr size_t kNumSlots = 1024;
+  static constexpr size_t kMaxChannelNameSize = 128;
+
+  ~ChannelStatsTable();
+
+  bool enabled() const { return slots_ != nullptr; }
+
+  /**
+   * @brief The slot of a channel, claimed on the first call for the channel.
+   * @return nullptr when the table is disabled or full.
+   */
+  Slot* GetSlot(uint64_t channel_id, const std::string& channel_name);
+
+  static void OnTransmit(Slot* slot, uint64_t seq, uint64_t size,
+                         bool success);
+
+  bool GetStats(uint64_t channel_id, ChannelStats* stats) const;
+  void GetAllStats(std::vector<ChannelStats>* stats) const;
+
+ private:
+  static void ReadSlot(const Slot& slot, ChannelStats* stats);
+
+  Slot* slots_ = nullptr;
+
+  DECLARE_SINGLETON(ChannelStatsTable)
+};
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_SHM_CHANNEL_STATS_TABLE_H_
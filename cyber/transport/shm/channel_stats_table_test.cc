@@ -0,0 +1,91 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/transport/shm/channel_stats_table.h"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+#include "cyber/common/global_data.h"
+#include "cyber/time/time.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+// The table outlives the test, so each run uses channels of its own.
+std::string ChannelName(const std::string& name) {
+  return "channel_stats_table_test/" + name + "/" + std::to_string(getpid()) +
+         "/" + std::to_string(Time::Now().ToNanosecond());
+}
+
+TEST(ChannelStatsTableTest, transmit) {
+  auto table = ChannelStatsTable::Instance();
+  ASSERT_TRUE(table->enabled());
+  const std::string name = ChannelName("transmit");
+  const uint64_t channel_id = common::GlobalData::RegisterChannel(name);
+
+  ChannelStats stats;
+  EXPECT_FALSE(table->GetStats(channel_id, &stats));
+
+  auto slot = table->GetSlot(channel_id, name);
+  ASSERT_NE(slot, nullptr);
+  EXPECT_EQ(slot, table->GetSlot(channel_id, name));
+
+  ChannelStatsTable::OnTransmit(slot, 1, 100, true);
+  ChannelStatsTable::OnTransmit(slot, 2, 0, false);
+  usleep(1000);
+  ChannelStatsTable::OnTransmit(slot, 3, 300, true);
+
+  ASSERT_TRUE(table->GetStats(channel_id, &stats));
+  EXPECT_EQ(stats.channel_id, channel_id);
+  EXPECT_EQ(stats.channel_name, name);
+  EXPECT_EQ(stats.num_messages, 2);
+  EXPECT_EQ(stats.num_bytes, 400);
+  EXPECT_EQ(stats.last_size, 300);
+  EXPECT_EQ(stats.last_seq, 3);
+  EXPECT_EQ(stats.num_failed, 1);
+  EXPECT_GE(stats.mean_interval, 1000000);
+  EXPECT_GT(stats.rate(), 0.0);
+  EXPECT_LE(stats.last_publish_time, Time::Now().ToNanosecond());
+}
+
+TEST(ChannelStatsTableTest, all_stats) {
+  auto table = ChannelStatsTable::Instance();
+  ASSERT_TRUE(table->enabled());
+  const std::string name = ChannelName("all_stats");
+  const uint64_t channel_id = common::GlobalData::RegisterChannel(name);
+  ChannelStatsTable::OnTransmit(table->GetSlot(channel_id, name), 1, 10, true);
+
+  std::vector<ChannelStats> all_stats;
+  table->GetAllStats(&all_stats);
+  int found = 0;
+  for (const auto& stats : all_stats) {
+    if (stats.channel_id == channel_id) {
+      EXPECT_EQ(stats.channel_name, name);
+      EXPECT_EQ(stats.num_messages, 1);
+      ++found;
+    }
+  }
+  EXPECT_EQ(found, 1);
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
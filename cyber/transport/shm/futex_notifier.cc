@@ -0,0 +1,291 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/transport/shm/futex_notifier.h"
+
+#include <linux/futex.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#include <chrono>
+#include <climits>
+#include <thread>
+
+#include "cyber/common/global_data.h"
+#include "cyber/common/log.h"
+#include "cyber/common/util.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+using common::GlobalData;
+using common::Hash;
+
+namespace {
+
+int FutexWait(std::atomic<uint32_t>* addr, uint32_t expected,
+              int timeout_ms) {
+  struct timespec timeout;
+  timeout.tv_sec = timeout_ms / 1000;
+  timeout.tv_nsec = (timeout_ms % 1000) * 1000000L;
+  // not FUTEX_PRIVATE_FLAG: the word lives in shm and is shared by processes
+  return static_cast<int>(syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr),
+                                  FUTEX_WAIT, expected, &timeout, nullptr, 0));
+}
+
+int FutexWakeAll(std::atomic<uint32_t>* addr) {
+  return static_cast<int>(syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr),
+                                  FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0));
+}
+
+}  // namespace
+
+FutexNotifier::FutexNotifier() {
+  key_ = static_cast<key_t>(Hash("/apollo/cyber/transport/shm/futex_notifier"));
+  ADEBUG << "futex notifier key: " << key_;
+  shm_size_ = sizeof(Indicator);
+
+  auto& g_conf = GlobalData::Instance()->Config();
+  if (g_conf.has_transport_conf() && g_conf.transport_conf().has_shm_conf()) {
+    coalesce_wakeups_ = g_conf.transport_conf().shm_conf().coalesce_wakeups();
+  }
+
+  if (!Init()) {
+    AERROR << "fail to init futex notifier.";
+    is_shutdown_.exchange(true);
+  }
+}
+
+FutexNotifier::~FutexNotifier() { Shutdown(); }
+
+void FutexNotifier::Shutdown() {
+  if (is_shutdown_.exchange(true)) {
+    return;
+  }
+
+  // listeners of this process wake up at their next timeout at the latest
+  indicator_->futex_word.fetch_add(1);
+  FutexWakeAll(&indicator_->futex_word);
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  Reset();
+}
+
+bool FutexNotifier::Notify(const ReadableInfo& info) {
+  if (is_shutdown_.load()) {
+    ADEBUG << "notifier is shutdown.";
+    return false;
+  }
+
+  uint64_t seq = indicator_->next_seq.fetch_add(1);
+  Slot& slot = indicator_->slots[seq % kSlotNum];
+  // invalidate the slot first so a lapping listener can't read a torn info
+  slot.seq.store(0, std::memory_order_release);
+  slot.host_id.store(info.host_id(), std::memory_order_relaxed);
+  slot.channel_id.store(info.channel_id(), std::memory_order_relaxed);
+  slot.block_index.store(info.block_index(), std::memory_order_relaxed);
+  slot.seq.store(seq + 1, std::memory_order_release);
+
+  indicator_->futex_word.fetch_add(1);
+  if (indicator_->waiters.load() == 0) {
+    return true;
+  }
+  if (coalesce_wakeups_ && indicator_->wake_pending.exchange(true)) {
+    // the sleepers are already being woken up and will drain this one too
+    return true;
+  }
+  Wake();
+  return true;
+}
+
+bool FutexNotifier::Listen(int timeout_ms, ReadableInfo* info) {
+  if (info == nullptr) {
+    AERROR << "info nullptr.";
+    return false;
+  }
+
+  if (is_shutdown_.load()) {
+    ADEBUG << "notifier is shutdown.";
+    return false;
+  }
+
+  if (TryRead(info)) {
+    return true;
+  }
+
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::milliseconds(timeout_ms);
+  while (!is_shutdown_.load()) {
+    uint32_t futex_word = indicator_->futex_word.load();
+    indicator_->waiters.fetch_add(1);
+    indicator_->wake_pending.store(false);
+    // anything published before futex_word was sampled is visible here,
+    // anything published after it makes FutexWait return immediately
+    if (TryRead(info)) {
+      indicator_->waiters.fetch_sub(1);
+      return true;
+    }
+
+    auto remain = std::chrono::duration_cast<std::chrono::milliseconds>(
+                      deadline - std::chrono::steady_clock::now())
+                      .count();
+    if (remain <= 0) {
+      indicator_->waiters.fetch_sub(1);
+      ADEBUG << "timeout";
+      return false;
+    }
+    FutexWait(&indicator_->futex_word, futex_word, static_cast<int>(remain));
+    indicator_->waiters.fetch_sub(1);
+
+    if (TryRead(info)) {
+      return true;
+    }
+  }
+
+  ADEBUG << "notifier is shutdown.";
+  return false;
+}
+
+bool FutexNotifier::TryRead(ReadableInfo* info) {
+  while (true) {
+    Slot& slot = indicator_->slots[next_listen_seq_ % kSlotNum];
+    uint64_t seq = slot.seq.load(std::memory_order_acquire);
+    if (seq <= next_listen_seq_) {
+      // not published yet
+      return false;
+    }
+
+    info->set_host_id(slot.host_id.load(std::memory_order_relaxed));
+    info->set_channel_id(slot.channel_id.load(std::memory_order_relaxed));
+    info->set_block_index(slot.block_index.load(std::memory_order_relaxed));
+    if (slot.seq.load(std::memory_order_acquire) != seq) {
+      continue;
+    }
+
+    if (seq != next_listen_seq_ + 1) {
+      AWARN << "notifier overrun, skip " << seq - 1 - next_listen_seq_
+            << " infos.";
+    }
+    next_listen_seq_ = seq;
+    return true;
+  }
+}
+
+void FutexNotifier::Wake() {
+  if (FutexWakeAll(&indicator_->futex_word) < 0) {
+    AWARN << "futex wake failed, error code: " << strerror(errno);
+  }
+}
+
+bool FutexNotifier::Init() {
+  if (!OpenOrCreate()) {
+    return false;
+  }
+  // infos published before this process joined are not for us
+  next_listen_seq_ = indicator_->next_seq.load();
+  return true;
+}
+
+bool FutexNotifier::OpenOrCreate() {
+  // create managed_shm_
+  int retry = 0;
+  int shmid = 0;
+  while (retry < 2) {
+    shmid = shmget(key_, shm_size_, 0644 | IPC_CREAT | IPC_EXCL);
+    if (shmid != -1) {
+      break;
+    }
+
+    if (EINVAL == errno) {
+      AINFO << "need larger space, recreate.";
+      Reset();
+      Remove();
+      ++retry;
+    } else if (EEXIST == errno) {
+      ADEBUG << "shm already exist, open only.";
+      return OpenOnly();
+    } else {
+      break;
+    }
+  }
+
+  if (shmid == -1) {
+    AERROR << "create shm failed, error code: " << strerror(errno);
+    return false;
+  }
+
+  // attach managed_shm_
+  managed_shm_ = shmat(shmid, nullptr, 0);
+  if (managed_shm_ == reinterpret_cast<void*>(-1)) {
+    AERROR << "attach shm failed.";
+    shmctl(shmid, IPC_RMID, 0);
+    return false;
+  }
+
+  // create indicator_
+  indicator_ = new (managed_shm_) Indicator();
+
+  ADEBUG << "open or create true.";
+  return true;
+}
+
+bool FutexNotifier::OpenOnly() {
+  // get managed_shm_
+  int shmid = shmget(key_, 0, 0644);
+  if (shmid == -1) {
+    AERROR << "get shm failed.";
+    return false;
+  }
+
+  // attach managed_shm_
+  managed_shm_ = shmat(shmid, nullptr, 0);
+  if (managed_shm_ == reinterpret_cast<void*>(-1)) {
+    AERROR << "attach shm failed.";
+    return false;
+  }
+
+  // get indicator_
+  indicator_ = reinterpret_cast<Indicator*>(managed_shm_);
+
+  ADEBUG << "open true.";
+  return true;
+}
+
+bool FutexNotifier::Remove() {
+  int shmid = shmget(key_, 0, 0644);
+  if (shmid == -1 || shmctl(shmid, IPC_RMID, 0) == -1) {
+    AERROR << "remove shm failed, error code: " << strerror(errno);
+    return false;
+  }
+  ADEBUG << "remove success.";
+
+  return true;
+}
+
+void FutexNotifier::Reset() {
+  indicator_ = nullptr;
+  if (managed_shm_ != nullptr) {
+    shmdt(managed_shm_);
+    managed_shm_ = nullptr;
+  }
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#ifndef CYBER_TRANSPORT_SHM_FUTEX_NOTIFIER_H_
+#define CYBER_TRANSPORT_SHM_FUTEX_NOTIFIER_H_
+
+#include <stdint.h>
+#include <sys/types.h>
+#include <atomic>
+
+#include "cyber/common/macros.h"
+#include "cyber/transport/shm/notifier_base.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+/**
+ * @class FutexNotifier
+ * @brief Shm notifier whose listeners sleep on a process-shared futex.
+ *
+ * Notify only enters the kernel when some listener is actually asleep, and
+ * with wakeup coalescing enabled a burst of messages costs a single wakeup:
+ * listeners drain everything published so far before sleeping again.
+ */
+class FutexNotifier : public NotifierBase {
+  static const uint32_t kSlotNum = 4096;
+
+  struct Slot {
+    std::atomic<uint64_t> seq = {0};
+    std::atomic<uint64_t> host_id = {0};
+    std::atomic<uint64_t> channel_id = {0};
+    std::atomic<uint32_t> block_index = {0};
+  };
+
+  struct Indicator {
+    std::atomic<uint64_t> next_seq = {0};
+    std::atomic<uint32_t> futex_word = {0};
+    std::atomic<uint32_t> waiters = {0};
+    std::atomic<bool> wake_pending = {false};
+    Slot slots[kSlotNum];
+  };
+
+ public:
+  virtual ~FutexNotifier();
+
+  void Shutdown() override;
+  bool Notify(const ReadableInfo& info) override;
+  bool Listen(int timeout_ms, ReadableInfo* info) override;
+
+  static const char* Type() { return "futex"; }
+
+ private:
+  bool Init();
+  bool OpenOrCreate();
+  bool OpenOnly();
+  bool Remove();
+  void Reset();
+
+  bool TryRead(ReadableInfo* info);
+  void Wake();
+
+  key_t key_ = 0;
+  void* managed_shm_ = nullptr;
+  size_t shm_size_ = 0;
+  Indicator* indicator_ = nullptr;
+  uint64_t next_listen_seq_ = 0;
+  bool coalesce_wakeups_ = true;
+  std::atomic<bool> is_shutdown_ = {false};
+
+  DECLARE_SINGLETON(FutexNotifier)
+};
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_SHM_FUTEX_NOTIFIER_H_
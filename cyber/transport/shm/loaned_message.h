@@ -0,0 +1,120 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_SHM_LOANED_MESSAGE_H_
+#define CYBER_TRANSPORT_SHM_LOANED_MESSAGE_H_
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "cyber/message/message_traits.h"
+#include "cyber/transport/shm/segment.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+/**
+ * @class LoanedMessage
+ * @brief A message constructed directly inside a write-locked shm block.
+ *
+ * The block stays write-locked for as long as the loan is alive. Handing the
+ * loan back to the transmitter publishes it in place; dropping it without
+ * publishing returns the block to the segment untouched.
+ */
+template <typename M>
+class LoanedMessage {
+ public:
+  LoanedMessage() : segment_(nullptr), block_(), msg_(nullptr) {}
+  LoanedMessage(const SegmentPtr& segment, const WritableBlock& block)
+      : segment_(segment), block_(block), msg_(nullptr) {
+    static_assert(message::IsLoanable<M>::value,
+                  "only trivially copyable messages can be loaned");
+    msg_ = new (block_.buf) M();
+  }
+
+  LoanedMessage(LoanedMessage&& other) noexcept { MoveFrom(&other); }
+  LoanedMessage& operator=(LoanedMessage&& other) noexcept {
+    if (this != &other) {
+      Return();
+      MoveFrom(&other);
+    }
+    return *this;
+  }
+
+  LoanedMessage(const LoanedMessage&) = delete;
+  LoanedMessage& operator=(const LoanedMessage&) = delete;
+
+  ~LoanedMessage() { Return(); }
+
+  bool valid() const { return msg_ != nullptr; }
+  explicit operator bool() const { return valid(); }
+
+  M* get() { return msg_; }
+  const M* get() const { return msg_; }
+  M* operator->() { return msg_; }
+  const M* operator->() const { return msg_; }
+  M& operator*() { return *msg_; }
+  const M& operator*() const { return *msg_; }
+
+  const WritableBlock& block() const { return block_; }
+
+  /**
+   * @brief Give up ownership of the block without unlocking it. The caller
+   * becomes responsible for `Segment::ReleaseWrittenBlock`.
+   */
+  WritableBlock Detach() {
+    WritableBlock block = block_;
+    segment_ = nullptr;
+    block_ = WritableBlock();
+    msg_ = nullptr;
+    return block;
+  }
+
+ private:
+  void MoveFrom(LoanedMessage* other) {
+    segment_ = std::move(other->segment_);
+    block_ = other->block_;
+    msg_ = other->msg_;
+    other->segment_ = nullptr;
+    other->block_ = WritableBlock();
+    other->msg_ = nullptr;
+  }
+
+  void Return() {
+    if (msg_ == nullptr || segment_ == nullptr) {
+      return;
+    }
+    // an unpublished block must not look readable to a late reader.
+    block_.block->set_msg_size(0);
+    block_.block->set_msg_info_size(0);
+    segment_->ReleaseWrittenBlock(block_);
+    segment_ = nullptr;
+    block_ = WritableBlock();
+    msg_ = nullptr;
+  }
+
+  SegmentPtr segment_;
+  WritableBlock block_;
+  M* msg_;
+};
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_SHM_LOANED_MESSAGE_H_
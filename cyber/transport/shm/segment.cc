@@ -16,9 +16,13 @@
 
 #include "cyber/transport/shm/segment.h"
 
+#include <unistd.h>
+
 #include <algorithm>
 
+#include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
+#include "cyber/common/numa.h"
 #include "cyber/common/util.h"
 #include "cyber/transport/shm/shm_conf.h"
 
@@ -31,11 +35,13 @@ Segment::Segment(uint64_t channel_id, const ReadWriteMode& mode)
       mode_(mode),
       conf_(),
       state_(nullptr),
-      blocks_(nullptr),
-      managed_shm_(nullptr),
-      block_buf_lock_(),
-      block_buf_addrs_() {
+      arenas_lock_(),
+      arena_num_(0),
+      channel_name_(common::GlobalData::GetChannelById(channel_id)),
+      cross_node_accesses_(0) {
   id_ = static_cast<key_t>(channel_id);
+  conf_.LoadChannelConf(channel_name_);
+  conf_.Update(0);
 }
 
 Segment::~Segment() { Destroy(); }
@@ -48,34 +54,29 @@ bool Segment::AcquireBlockToWrite(std::size_t msg_size,
     return false;
   }
 
-  bool result = true;
-  if (state_->need_remap()) {
-    result = Remap();
-  }
-
-  if (msg_size > conf_.ceiling_msg_size()) {
-    conf_.Update(msg_size);
-    result = Recreate();
-  }
-
-  if (!result) {
-    AERROR << "segment update failed.";
-    return false;
+  Arena* arena = FindArenaToWrite(msg_size);
+  if (arena == nullptr) {
+    if (!AppendArena(msg_size)) {
+      AERROR << "segment update failed.";
+      return false;
+    }
+    arena = FindArenaToWrite(msg_size);
+    RETURN_VAL_IF_NULL(arena, false);
   }
 
-  uint32_t index = GetNextWritableBlockIndex();
-  writable_block->index = index;
-  writable_block->block = &blocks_[index];
-  writable_block->buf = block_buf_addrs_[index];
+  CountNodeAccess();
+  uint32_t index = GetNextWritableBlockIndex(arena);
+  writable_block->index = arena->first_index + index;
+  writable_block->block = &arena->blocks[index];
+  writable_block->buf = arena->bufs + index * arena->conf.block_buf_size();
   return true;
 }
 
 void Segment::ReleaseWrittenBlock(const WritableBlock& writable_block) {
-  auto index = writable_block.index;
-  if (index >= conf_.block_num()) {
+  if (writable_block.block == nullptr) {
     return;
   }
-  blocks_[index].ReleaseWriteLock();
+  writable_block.block->ReleaseWriteLock();
 }
 
 bool Segment::AcquireBlockToRead(ReadableBlock* readable_block) {
@@ -85,36 +86,38 @@ bool Segment::AcquireBlockToRead(ReadableBlock* readable_block) {
     AERROR << "init failed, can't read now.";
     return false;
   }
-  auto index = readable_block->index;
-  if (index >= conf_.block_num()) {
-    AERROR << "invalid block_index[" << index << "].";
-    return false;
-  }
 
-  bool result = true;
-  if (state_->need_remap()) {
-    result = Remap();
+  auto index = readable_block->index;
+  Arena* arena = FindArenaOfBlock(index);
+  if (arena == nullptr) {
+    // the block may live in an arena appended since we last looked
+    if (!SyncArenas()) {
+      AERROR << "segment update failed.";
+      return false;
+    }
+    arena = FindArenaOfBlock(index);
   }
-
-  if (!result) {
-    AERROR << "segment update failed.";
+  if (arena == nullptr) {
+    AERROR << "invalid block_index[" << index << "].";
     return false;
   }
 
-  if (!blocks_[index].TryLockForRead()) {
+  uint32_t local_index = index - arena->first_index;
+  if (!arena->blocks[local_index].TryLockForRead()) {
     return false;
   }
-  readable_block->block = blocks_ + index;
-  readable_block->buf = block_buf_addrs_[index];
+  CountNodeAccess();
+  readable_block->block = &arena->blocks[local_index];
+  readable_block->buf =
+      arena->bufs + local_index * arena->conf.block_buf_size();
   return true;
 }
 
 void Segment::ReleaseReadBlock(const ReadableBlock& readable_block) {
-  auto index = readable_block.index;
-  if (index >= conf_.block_num()) {
+  if (readable_block.block == nullptr) {
     return;
   }
-  blocks_[index].ReleaseReadLock();
+  readable_block.block->ReleaseReadLock();
 }
 
 bool Segment::Init() {
@@ -130,11 +133,11 @@ bool Segment::OpenOrCreate() {
     return true;
   }
 
-  // create managed_shm_
+  // create managed_shm of the first arena
   int retry = 0;
   int shmid = 0;
   while (retry < 2) {
-    shmid = shmget(id_, conf_.managed_shm_size(), 0644 | IPC_CREAT | IPC_EXCL);
+    shmid = CreateShm(id_, conf_.managed_shm_size());
     if (shmid != -1) {
       break;
     }
@@ -157,63 +160,36 @@ bool Segment::OpenOrCreate() {
     return false;
   }
 
-  // attach managed_shm_
-  managed_shm_ = shmat(shmid, nullptr, 0);
-  if (managed_shm_ == reinterpret_cast<void*>(-1)) {
+  // attach managed_shm
+  void* managed_shm = shmat(shmid, nullptr, 0);
+  if (managed_shm == reinterpret_cast<void*>(-1)) {
     AERROR << "attach shm failed.";
     shmctl(shmid, IPC_RMID, 0);
     return false;
   }
+  PlaceArena(managed_shm, conf_.managed_shm_size());
+  Prefault(shmid, managed_shm, true);
 
-  // create field state_
-  state_ = new (managed_shm_) State(conf_.ceiling_msg_size());
-  if (state_ == nullptr) {
-    AERROR << "create state failed.";
-    shmdt(managed_shm_);
-    managed_shm_ = nullptr;
-    shmctl(shmid, IPC_RMID, 0);
-    return false;
-  }
-
-  conf_.Update(state_->ceiling_msg_size());
+  // create field state_, it records the geometry of every arena
+  state_ = new (managed_shm)
+      State(conf_.ceiling_msg_size(), conf_.block_num());
+  state_->set_numa_node(conf_.numa_node());
 
-  // create field blocks_
-  blocks_ = new (static_cast<char*>(managed_shm_) + sizeof(State))
-      Block[conf_.block_num()];
-  if (blocks_ == nullptr) {
-    AERROR << "create blocks failed.";
-    state_->~State();
-    state_ = nullptr;
-    shmdt(managed_shm_);
-    managed_shm_ = nullptr;
-    shmctl(shmid, IPC_RMID, 0);
-    return false;
-  }
-
-  // create block buf
-  uint32_t i = 0;
-  for (; i < conf_.block_num(); ++i) {
-    uint8_t* addr =
-        new (static_cast<char*>(managed_shm_) + sizeof(State) +
-             conf_.block_num() * sizeof(Block) + i * conf_.block_buf_size())
-            uint8_t[conf_.block_buf_size()];
-    std::lock_guard<std::mutex> _g(block_buf_lock_);
-    block_buf_addrs_[i] = addr;
-  }
-
-  if (i != conf_.block_num()) {
-    AERROR << "create block buf failed.";
-    state_->~State();
-    state_ = nullptr;
-    blocks_ = nullptr;
-    {
-      std::lock_guard<std::mutex> _g(block_buf_lock_);
-      block_buf_addrs_.clear();
+  {
+    std::lock_guard<std::mutex> _g(arenas_lock_);
+    Arena& arena = arenas_[0];
+    arena.conf = conf_;
+    arena.managed_shm = managed_shm;
+    arena.first_index = 0;
+    arena.next_index = 0;
+    arena.blocks = reinterpret_cast<Block*>(static_cast<char*>(managed_shm) +
+                                            sizeof(State));
+    for (uint32_t i = 0; i < arena.conf.block_num(); ++i) {
+      new (&arena.blocks[i]) Block();
     }
-    shmdt(managed_shm_);
-    managed_shm_ = nullptr;
-    shmctl(shmid, IPC_RMID, 0);
-    return false;
+    arena.bufs = reinterpret_cast<uint8_t*>(arena.blocks) +
+                 arena.conf.block_num() * sizeof(Block);
+    arena_num_.store(1);
   }
 
   state_->IncreaseReferenceCounts();
@@ -227,69 +203,42 @@ bool Segment::OpenOnly() {
     return true;
   }
 
-  // get managed_shm_
+  // get managed_shm of the first arena
   int shmid = shmget(id_, 0, 0644);
   if (shmid == -1) {
     AERROR << "get shm failed.";
     return false;
   }
 
-  // attach managed_shm_
-  managed_shm_ = shmat(shmid, nullptr, 0);
-  if (managed_shm_ == reinterpret_cast<void*>(-1)) {
+  // attach managed_shm
+  void* managed_shm = shmat(shmid, nullptr, 0);
+  if (managed_shm == reinterpret_cast<void*>(-1)) {
     AERROR << "attach shm failed.";
     return false;
   }
+  Prefault(shmid, managed_shm, false);
 
   // get field state_
-  state_ = reinterpret_cast<State*>(managed_shm_);
-  if (state_ == nullptr) {
-    AERROR << "get state failed.";
-    shmdt(managed_shm_);
-    managed_shm_ = nullptr;
-    return false;
-  }
+  state_ = reinterpret_cast<State*>(managed_shm);
+  conf_.Assign(state_->arena_ceiling_msg_size(0), state_->arena_block_num(0));
 
-  conf_.Update(state_->ceiling_msg_size());
-
-  // get field blocks_
-  blocks_ = reinterpret_cast<Block*>(static_cast<char*>(managed_shm_) +
-                                     sizeof(State));
-  if (blocks_ == nullptr) {
-    AERROR << "get blocks failed.";
-    state_ = nullptr;
-    shmdt(managed_shm_);
-    managed_shm_ = nullptr;
-    return false;
-  }
-
-  // get block buf
-  uint32_t i = 0;
-  for (; i < conf_.block_num(); ++i) {
-    uint8_t* addr = reinterpret_cast<uint8_t*>(
-        static_cast<char*>(managed_shm_) + sizeof(State) +
-        conf_.block_num() * sizeof(Block) + i * conf_.block_buf_size());
-
-    if (addr == nullptr) {
-      break;
-    }
-
-    std::lock_guard<std::mutex> _g(block_buf_lock_);
-    block_buf_addrs_[i] = addr;
-  }
-
-  if (i != conf_.block_num()) {
+  {
+    std::lock_guard<std::mutex> _g(arenas_lock_);
+    Arena& arena = arenas_[0];
+    arena.conf = conf_;
+    arena.managed_shm = managed_shm;
+    arena.first_index = 0;
+    arena.next_index = 0;
+    arena.blocks = reinterpret_cast<Block*>(static_cast<char*>(managed_shm) +
+                                            sizeof(State));
+    arena.bufs = reinterpret_cast<uint8_t*>(arena.blocks) +
+                 arena.conf.block_num() * sizeof(Block);
+    arena_num_.store(1);
+  }
+
+  if (!SyncArenas()) {
     AERROR << "open only failed.";
-    state_->~State();
-    state_ = nullptr;
-    blocks_ = nullptr;
-    {
-      std::lock_guard<std::mutex> _g(block_buf_lock_);
-      block_buf_addrs_.clear();
-    }
-    shmdt(managed_shm_);
-    managed_shm_ = nullptr;
-    shmctl(shmid, IPC_RMID, 0);
+    Reset();
     return false;
   }
 
@@ -306,6 +255,14 @@ bool Segment::Remove() {
     return false;
   }
 
+  // appended arenas, missing ones were never created
+  for (uint32_t i = 1; i < State::kMaxArenaNum; ++i) {
+    shmid = shmget(GetArenaKey(i), 0, 0644);
+    if (shmid != -1) {
+      shmctl(shmid, IPC_RMID, 0);
+    }
+  }
+
   ADEBUG << "remove success.";
   return true;
 }
@@ -316,61 +273,195 @@ bool Segment::Destroy() {
   }
   init_ = false;
 
+  bool result = true;
   try {
     state_->DecreaseReferenceCounts();
     uint32_t reference_counts = state_->reference_counts();
+    Reset();
     if (reference_counts == 0) {
-      return Remove();
+      result = Remove();
     }
   } catch (...) {
     AERROR << "exception.";
     return false;
   }
   ADEBUG << "destory.";
-  return true;
+  return result;
 }
 
 void Segment::Reset() {
   state_ = nullptr;
-  blocks_ = nullptr;
-  {
-    std::lock_guard<std::mutex> _g(block_buf_lock_);
-    block_buf_addrs_.clear();
+  std::lock_guard<std::mutex> _g(arenas_lock_);
+  for (uint32_t i = 0; i < arena_num_.load(); ++i) {
+    if (arenas_[i].managed_shm != nullptr) {
+      shmdt(arenas_[i].managed_shm);
+    }
+    arenas_[i] = Arena();
   }
+  arena_num_.store(0);
+}
 
-  if (managed_shm_ != nullptr) {
-    shmdt(managed_shm_);
-    managed_shm_ = nullptr;
+key_t Segment::GetArenaKey(uint32_t arena_index) const {
+  // the first arena keeps the channel key so older readers still find it
+  return static_cast<key_t>(static_cast<uint32_t>(id_) +
+                            arena_index * 0x9E3779B9u);
+}
+
+bool Segment::CreateArena(uint32_t arena_index) {
+  Arena& arena = arenas_[arena_index];
+  key_t key = GetArenaKey(arena_index);
+  int shmid = -1;
+  for (int retry = 0; retry < 2 && shmid == -1; ++retry) {
+    shmid = CreateShm(key, arena.conf.managed_shm_size());
+    if (shmid == -1 && (EEXIST == errno || EINVAL == errno)) {
+      // not published in state yet, so it is a leftover of a dead segment
+      AINFO << "remove stale arena " << arena_index;
+      int stale = shmget(key, 0, 0644);
+      if (stale != -1) {
+        shmctl(stale, IPC_RMID, 0);
+      }
+    }
   }
+  if (shmid == -1) {
+    AERROR << "create arena failed, error code: " << strerror(errno);
+    return false;
+  }
+
+  void* managed_shm = shmat(shmid, nullptr, 0);
+  if (managed_shm == reinterpret_cast<void*>(-1)) {
+    AERROR << "attach arena failed.";
+    shmctl(shmid, IPC_RMID, 0);
+    return false;
+  }
+  PlaceArena(managed_shm, arena.conf.managed_shm_size());
+  Prefault(shmid, managed_shm, true);
+
+  Arena& prev = arenas_[arena_index - 1];
+  arena.managed_shm = managed_shm;
+  arena.first_index = prev.first_index + prev.conf.block_num();
+  arena.next_index = 0;
+  arena.blocks = reinterpret_cast<Block*>(static_cast<char*>(managed_shm) +
+                                          sizeof(State));
+  for (uint32_t i = 0; i < arena.conf.block_num(); ++i) {
+    new (&arena.blocks[i]) Block();
+  }
+  arena.bufs = reinterpret_cast<uint8_t*>(arena.blocks) +
+               arena.conf.block_num() * sizeof(Block);
+  return true;
 }
 
-bool Segment::Remap() {
-  init_ = false;
-  ADEBUG << "before reset.";
-  Reset();
-  ADEBUG << "after reset.";
-  return OpenOnly();
+bool Segment::AttachArena(uint32_t arena_index) {
+  Arena& arena = arenas_[arena_index];
+  arena.conf.Assign(state_->arena_ceiling_msg_size(arena_index),
+                    state_->arena_block_num(arena_index));
+
+  int shmid = shmget(GetArenaKey(arena_index), 0, 0644);
+  if (shmid == -1) {
+    AERROR << "get arena " << arena_index << " failed.";
+    return false;
+  }
+
+  void* managed_shm = shmat(shmid, nullptr, 0);
+  if (managed_shm == reinterpret_cast<void*>(-1)) {
+    AERROR << "attach arena " << arena_index << " failed.";
+    return false;
+  }
+  Prefault(shmid, managed_shm, false);
+
+  Arena& prev = arenas_[arena_index - 1];
+  arena.managed_shm = managed_shm;
+  arena.first_index = prev.first_index + prev.conf.block_num();
+  arena.next_index = 0;
+  arena.blocks = reinterpret_cast<Block*>(static_cast<char*>(managed_shm) +
+                                          sizeof(State));
+  arena.bufs = reinterpret_cast<uint8_t*>(arena.blocks) +
+               arena.conf.block_num() * sizeof(Block);
+  return true;
 }
 
-bool Segment::Recreate() {
-  init_ = false;
-  state_->set_need_remap(true);
-  Reset();
-  Remove();
-  return OpenOrCreate();
+bool Segment::SyncArenas() {
+  std::lock_guard<std::mutex> _g(arenas_lock_);
+  uint32_t published = std::min(state_->arena_num(), State::kMaxArenaNum);
+  for (uint32_t i = arena_num_.load(); i < published; ++i) {
+    if (!AttachArena(i)) {
+      return false;
+    }
+    arena_num_.store(i + 1);
+  }
+  return true;
 }
 
-uint32_t Segment::GetNextWritableBlockIndex() {
-  uint32_t try_idx = state_->wrote_num();
+bool Segment::AppendArena(std::size_t msg_size) {
+  if (!state_->TryLockArenas()) {
+    AWARN << "another writer is growing the segment.";
+    return false;
+  }
 
-  auto max_mod_num = conf_.block_num() - 1;
+  // another writer may already have appended an arena that fits
+  bool result = SyncArenas();
+  if (result && FindArenaToWrite(msg_size) == nullptr) {
+    std::lock_guard<std::mutex> _g(arenas_lock_);
+    uint32_t index = arena_num_.load();
+    if (index >= State::kMaxArenaNum) {
+      AERROR << "too many arenas, msg_size: " << msg_size;
+      result = false;
+    } else {
+      arenas_[index].conf = conf_;
+      arenas_[index].conf.Update(msg_size);
+      result = CreateArena(index) &&
+               state_->AddArena(arenas_[index].conf.ceiling_msg_size(),
+                                arenas_[index].conf.block_num());
+      if (result) {
+        arena_num_.store(index + 1);
+        AINFO << "append arena " << index << ", ceiling_msg_size: "
+              << arenas_[index].conf.ceiling_msg_size();
+      }
+    }
+  }
+
+  state_->UnlockArenas();
+  return result;
+}
+
+Segment::Arena* Segment::FindArenaToWrite(std::size_t msg_size) {
+  Arena* result = nullptr;
+  uint32_t arena_num = arena_num_.load();
+  for (uint32_t i = 0; i < arena_num; ++i) {
+    Arena* arena = &arenas_[i];
+    if (arena->conf.ceiling_msg_size() < msg_size) {
+      continue;
+    }
+    if (result == nullptr ||
+        arena->conf.ceiling_msg_size() < result->conf.ceiling_msg_size()) {
+      result = arena;
+    }
+  }
+  return result;
+}
+
+Segment::Arena* Segment::FindArenaOfBlock(uint32_t block_index) {
+  uint32_t arena_num = arena_num_.load();
+  for (uint32_t i = 0; i < arena_num; ++i) {
+    Arena* arena = &arenas_[i];
+    if (block_index >= arena->first_index &&
+        block_index < arena->first_index + arena->conf.block_num()) {
+      return arena;
+    }
+  }
+  return nullptr;
+}
+
+uint32_t Segment::GetNextWritableBlockIndex(Arena* arena) {
+  const uint32_t block_num = arena->conf.block_num();
+  uint32_t try_idx = arena->next_index;
   while (1) {
-    if (try_idx >= conf_.block_num()) {
-      try_idx &= max_mod_num;
+    if (try_idx >= block_num) {
+      try_idx %= block_num;
     }
 
-    if (blocks_[try_idx].TryLockForWrite()) {
+    if (arena->blocks[try_idx].TryLockForWrite()) {
       state_->IncreaseWroteNum();
+      arena->next_index = try_idx + 1;
       return try_idx;
     }
 
@@ -378,6 +469,68 @@ uint32_t Segment::GetNextWritableBlockIndex() {
   }
 }
 
+int Segment::CreateShm(key_t key, uint64_t size) {
+  const int flags = 0644 | IPC_CREAT | IPC_EXCL;
+  if (conf_.huge_pages()) {
+    int shmid = shmget(key, size, flags | SHM_HUGETLB);
+    if (shmid != -1 || errno == EEXIST) {
+      return shmid;
+    }
+    AWARN << "channel[" << channel_name_ << "] can't use huge pages, "
+          << strerror(errno) << ", fall back to normal pages.";
+  }
+  return shmget(key, size, flags);
+}
+
+void Segment::PlaceArena(void* managed_shm, uint64_t size) {
+  // must run before the arena is touched, pages already faulted in stay
+  // where they are
+  int node = conf_.numa_node();
+  if (node >= 0 && !common::PreferNumaNode(managed_shm, size, node)) {
+    AWARN << "channel[" << channel_name_ << "] can't be placed on numa node "
+          << node;
+  }
+}
+
+void Segment::Prefault(int shmid, void* managed_shm, bool write) {
+  if (!conf_.prefault()) {
+    return;
+  }
+  // the attached size, our conf may round differently than the creator's
+  struct shmid_ds ds;
+  if (shmctl(shmid, IPC_STAT, &ds) == -1) {
+    return;
+  }
+  // a freshly created arena is all zeros, so writing zeros is harmless and
+  // allocates the pages, while readers only need the existing pages mapped
+  const std::size_t page_size = sysconf(_SC_PAGESIZE);
+  auto pages = static_cast<volatile uint8_t*>(managed_shm);
+  for (std::size_t offset = 0; offset < ds.shm_segsz; offset += page_size) {
+    if (write) {
+      pages[offset] = 0;
+    } else {
+      static_cast<void>(pages[offset]);
+    }
+  }
+}
+
+void Segment::CountNodeAccess() {
+  int node = state_->numa_node();
+  if (node < 0) {
+    return;
+  }
+  int current = common::NumaTopology::Instance()->CurrentNode();
+  if (current < 0 || current == node) {
+    return;
+  }
+  uint64_t accesses = cross_node_accesses_.fetch_add(1) + 1;
+  if ((accesses & (accesses - 1)) == 0) {
+    AWARN << "channel[" << channel_name_ << "] on numa node " << node
+          << " accessed from node " << current << ", " << accesses
+          << " cross-node accesses so far.";
+  }
+}
+
 }  // namespace transport
 }  // namespace cyber
 }  // namespace apollo
@@ -21,11 +21,11 @@
 #include <sys/ipc.h>
 #include <sys/shm.h>
 #include <sys/types.h>
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <mutex>
 #include <string>
-#include <unordered_map>
 
 #include "cyber/transport/shm/block.h"
 #include "cyber/transport/shm/shm_conf.h"
@@ -50,6 +50,21 @@ struct WritableBlock {
 };
 using ReadableBlock = WritableBlock;
 
+/**
+ * @class Segment
+ * @brief Per-channel shared memory made of one or more block arenas.
+ *
+ * The first arena also carries the segment State. When a message outgrows
+ * every existing arena the writer appends a new arena sized for it instead
+ * of recreating the segment, so readers never lose blocks they have mapped.
+ * Block indexes are global: arena k owns the range following arena k-1.
+ *
+ * A channel configured with a numa_node gets every arena placed on that
+ * node. Blocks written or read from a cpu of another node are counted as
+ * cross-node accesses. Channels may also ask for huge page backed arenas
+ * and for prefaulting, which moves the page fault cost of big segments
+ * from the first messages to Init.
+ */
 class Segment final {
  public:
   Segment(uint64_t channel_id, const ReadWriteMode& mode);
@@ -61,17 +76,39 @@ class Segment final {
   bool AcquireBlockToRead(ReadableBlock* readable_block);
   void ReleaseReadBlock(const ReadableBlock& readable_block);
 
+  uint64_t cross_node_accesses() const { return cross_node_accesses_.load(); }
+
  private:
+  struct Arena {
+    void* managed_shm = nullptr;
+    Block* blocks = nullptr;
+    uint8_t* bufs = nullptr;
+    uint32_t first_index = 0;
+    uint32_t next_index = 0;
+    ShmConf conf;
+  };
+
   bool Init();
   bool OpenOrCreate();
   bool OpenOnly();
   bool Remove();
   bool Destroy();
   void Reset();
-  bool Remap();
-  bool Recreate();
 
-  uint32_t GetNextWritableBlockIndex();
+  key_t GetArenaKey(uint32_t arena_index) const;
+  bool CreateArena(uint32_t arena_index);
+  bool AttachArena(uint32_t arena_index);
+  bool SyncArenas();
+  bool AppendArena(std::size_t msg_size);
+  Arena* FindArenaToWrite(std::size_t msg_size);
+  Arena* FindArenaOfBlock(uint32_t block_index);
+
+  uint32_t GetNextWritableBlockIndex(Arena* arena);
+
+  int CreateShm(key_t key, uint64_t size);
+  void PlaceArena(void* managed_shm, uint64_t size);
+  void Prefault(int shmid, void* managed_shm, bool write);
+  void CountNodeAccess();
 
   bool init_;
   key_t id_;
@@ -79,10 +116,12 @@ class Segment final {
   ShmConf conf_;
 
   State* state_;
-  Block* blocks_;
-  void* managed_shm_;
-  std::mutex block_buf_lock_;
-  std::unordered_map<uint32_t, uint8_t*> block_buf_addrs_;
+  std::mutex arenas_lock_;
+  std::atomic<uint32_t> arena_num_;
+  Arena arenas_[State::kMaxArenaNum];
+
+  std::string channel_name_;
+  std::atomic<uint64_t> cross_node_accesses_;
 };
 
 }  // namespace transport
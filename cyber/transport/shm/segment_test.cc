@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "cyber/transport/shm/segment.h"
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+
+#include "cyber/common/global_data.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+TEST(SegmentTest, grow_without_recreate) {
+  uint64_t channel_id =
+      common::GlobalData::RegisterChannel("segment_grow_without_recreate");
+  Segment writer(channel_id, WRITE_ONLY);
+  Segment reader(channel_id, READ_ONLY);
+
+  WritableBlock small_wb;
+  EXPECT_TRUE(writer.AcquireBlockToWrite(1024, &small_wb));
+  std::memcpy(small_wb.buf, "small", 6);
+  small_wb.block->set_msg_size(6);
+  writer.ReleaseWrittenBlock(small_wb);
+
+  ReadableBlock small_rb;
+  small_rb.index = small_wb.index;
+  EXPECT_TRUE(reader.AcquireBlockToRead(&small_rb));
+  uint8_t* small_buf = small_rb.buf;
+
+  // a message larger than the first arena lands in a new arena, blocks
+  // already held by the reader stay mapped
+  const std::size_t large_size = 2 * 1024 * 1024;
+  WritableBlock large_wb;
+  EXPECT_TRUE(writer.AcquireBlockToWrite(large_size, &large_wb));
+  EXPECT_NE(large_wb.index, small_wb.index);
+  std::memset(large_wb.buf, 'x', large_size);
+  large_wb.block->set_msg_size(large_size);
+  writer.ReleaseWrittenBlock(large_wb);
+
+  ReadableBlock large_rb;
+  large_rb.index = large_wb.index;
+  EXPECT_TRUE(reader.AcquireBlockToRead(&large_rb));
+  EXPECT_EQ(large_rb.block->msg_size(), large_size);
+  EXPECT_EQ(large_rb.buf[large_size - 1], 'x');
+  reader.ReleaseReadBlock(large_rb);
+
+  EXPECT_EQ(small_rb.buf, small_buf);
+  EXPECT_EQ(std::string(reinterpret_cast<char*>(small_rb.buf)), "small");
+  reader.ReleaseReadBlock(small_rb);
+
+  // small messages keep using the small arena
+  WritableBlock again_wb;
+  EXPECT_TRUE(writer.AcquireBlockToWrite(1024, &again_wb));
+  EXPECT_LT(again_wb.index, large_wb.index);
+  writer.ReleaseWrittenBlock(again_wb);
+}
+
+TEST(SegmentTest, invalid_block_index) {
+  uint64_t channel_id =
+      common::GlobalData::RegisterChannel("segment_invalid_block_index");
+  Segment writer(channel_id, WRITE_ONLY);
+  WritableBlock wb;
+  EXPECT_TRUE(writer.AcquireBlockToWrite(16, &wb));
+  writer.ReleaseWrittenBlock(wb);
+
+  Segment reader(channel_id, READ_ONLY);
+  ReadableBlock rb;
+  rb.index = UINT32_MAX;
+  EXPECT_FALSE(reader.AcquireBlockToRead(&rb));
+  EXPECT_FALSE(reader.AcquireBlockToRead(nullptr));
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
@@ -15,24 +15,102 @@
  *****************************************************************************/
 
 #include "cyber/transport/shm/shm_conf.h"
+
+#include <algorithm>
+#include <fstream>
+
+#include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 
 namespace apollo {
 namespace cyber {
 namespace transport {
 
-ShmConf::ShmConf() { Update(MESSAGE_SIZE_16K); }
+ShmConf::ShmConf()
+    : min_ceiling_msg_size_(0),
+      fixed_block_num_(0),
+      numa_node_(-1),
+      huge_pages_(false),
+      prefault_(false) {
+  Update(MESSAGE_SIZE_16K);
+}
 
-ShmConf::ShmConf(const uint64_t& real_msg_size) { Update(real_msg_size); }
+ShmConf::ShmConf(const uint64_t& real_msg_size)
+    : min_ceiling_msg_size_(0),
+      fixed_block_num_(0),
+      numa_node_(-1),
+      huge_pages_(false),
+      prefault_(false) {
+  Update(real_msg_size);
+}
 
 ShmConf::~ShmConf() {}
 
+void ShmConf::LoadChannelConf(const std::string& channel_name) {
+  auto& g_conf = common::GlobalData::Instance()->Config();
+  if (!g_conf.has_transport_conf() || !g_conf.transport_conf().has_shm_conf()) {
+    return;
+  }
+  for (auto& channel_conf :
+       g_conf.transport_conf().shm_conf().channel_conf()) {
+    if (channel_conf.channel_name() != channel_name) {
+      continue;
+    }
+    min_ceiling_msg_size_ = channel_conf.max_msg_size();
+    fixed_block_num_ = channel_conf.block_num();
+    numa_node_ = channel_conf.numa_node();
+    huge_pages_ = channel_conf.huge_pages();
+    prefault_ = channel_conf.prefault();
+    ADEBUG << "channel[" << channel_name
+           << "] shm override, max_msg_size: " << min_ceiling_msg_size_
+           << " block_num: " << fixed_block_num_
+           << " numa_node: " << numa_node_ << " huge_pages: " << huge_pages_
+           << " prefault: " << prefault_;
+    return;
+  }
+}
+
 void ShmConf::Update(const uint64_t& real_msg_size) {
-  ceiling_msg_size_ = GetCeilingMessageSize(real_msg_size);
+  uint64_t ceiling_msg_size = GetCeilingMessageSize(real_msg_size);
+  uint32_t block_num = GetBlockNum(ceiling_msg_size);
+  if (min_ceiling_msg_size_ > 0 && min_ceiling_msg_size_ >= real_msg_size) {
+    // a configured ceiling is used as is instead of rounding up to a bucket
+    ceiling_msg_size = min_ceiling_msg_size_;
+  }
+  if (fixed_block_num_ > 0) {
+    block_num = fixed_block_num_;
+  }
+  Assign(ceiling_msg_size, block_num);
+}
+
+void ShmConf::Assign(const uint64_t& ceiling_msg_size,
+                     const uint32_t& block_num) {
+  ceiling_msg_size_ = ceiling_msg_size;
   block_buf_size_ = GetBlockBufSize(ceiling_msg_size_);
-  block_num_ = GetBlockNum(ceiling_msg_size_);
+  block_num_ = block_num;
   managed_shm_size_ =
       EXTRA_SIZE + STATE_SIZE + (BLOCK_SIZE + block_buf_size_) * block_num_;
+  if (huge_pages_) {
+    // SHM_HUGETLB segments must be a whole number of huge pages
+    uint64_t huge_page_size = HugePageSize();
+    managed_shm_size_ = (managed_shm_size_ + huge_page_size - 1) /
+                        huge_page_size * huge_page_size;
+  }
+}
+
+uint64_t ShmConf::HugePageSize() {
+  static const uint64_t huge_page_size = [] {
+    std::ifstream fin("/proc/meminfo");
+    std::string key;
+    uint64_t kb = 0;
+    while (fin >> key) {
+      if (key == "Hugepagesize:" && fin >> kb && kb > 0) {
+        return kb * 1024;
+      }
+    }
+    return static_cast<uint64_t>(2 * 1024 * 1024);
+  }();
+  return huge_page_size;
 }
 
 const uint64_t ShmConf::EXTRA_SIZE = 1024 * 4;
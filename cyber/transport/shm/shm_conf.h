@@ -30,12 +30,28 @@ class ShmConf {
   explicit ShmConf(const uint64_t& real_msg_size);
   virtual ~ShmConf();
 
+  /**
+   * @brief Apply the per-channel block overrides of the transport conf, if
+   * any. Must be called before Update to take effect.
+   */
+  void LoadChannelConf(const std::string& channel_name);
+
   void Update(const uint64_t& real_msg_size);
+  // Adopt an arena geometry that was decided by another process.
+  void Assign(const uint64_t& ceiling_msg_size, const uint32_t& block_num);
 
   const uint64_t& ceiling_msg_size() { return ceiling_msg_size_; }
   const uint64_t& block_buf_size() { return block_buf_size_; }
   const uint32_t& block_num() { return block_num_; }
   const uint64_t& managed_shm_size() { return managed_shm_size_; }
+  // NUMA node the segment is placed on, -1 if not placed
+  const int32_t& numa_node() { return numa_node_; }
+  // with huge pages the managed shm size is a multiple of HugePageSize()
+  const bool& huge_pages() { return huge_pages_; }
+  const bool& prefault() { return prefault_; }
+
+  // the default huge page size of the system, Byte
+  static uint64_t HugePageSize();
 
  private:
   uint64_t GetCeilingMessageSize(const uint64_t& real_msg_size);
@@ -47,6 +63,13 @@ class ShmConf {
   uint32_t block_num_;
   uint64_t managed_shm_size_;
 
+  // per-channel overrides, 0 means use the size buckets below
+  uint64_t min_ceiling_msg_size_;
+  uint32_t fixed_block_num_;
+  int32_t numa_node_;
+  bool huge_pages_;
+  bool prefault_;
+
   // Extra size, Bit
   static const uint64_t EXTRA_SIZE;
   // State size, Bit
@@ -20,8 +20,12 @@ namespace apollo {
 namespace cyber {
 namespace transport {
 
-State::State(const uint64_t& ceiling_msg_size)
-    : ceiling_msg_size_(ceiling_msg_size) {}
+constexpr uint32_t State::kMaxArenaNum;
+
+State::State(const uint64_t& ceiling_msg_size, const uint32_t& block_num)
+    : ceiling_msg_size_(ceiling_msg_size) {
+  AddArena(ceiling_msg_size, block_num);
+}
 
 State::~State() {}
 
@@ -28,9 +28,12 @@ namespace transport {
 
 class State {
  public:
-  explicit State(const uint64_t& ceiling_msg_size);
-  virtual ~State();
+  // A segment is made of up to kMaxArenaNum block arenas. Arenas are only
+  // ever appended, so blocks that readers already mapped never move.
+  static constexpr uint32_t kMaxArenaNum = 8;
 
+  State(const uint64_t& ceiling_msg_size, const uint32_t& block_num);
+  virtual ~State();
 
   void IncreaseWroteNum() { wrote_num_.fetch_add(1); }
   void ResetWroteNum() { wrote_num_.store(0); }
@@ -50,6 +53,38 @@ class State {
   void set_need_remap(bool need) { need_remap_.store(need); }
   bool need_remap() { return need_remap_; }
 
+  // Serializes arena appends between writer processes.
+  bool TryLockArenas() {
+    bool unlocked = false;
+    return arena_lock_.compare_exchange_strong(unlocked, true);
+  }
+  void UnlockArenas() { arena_lock_.store(false); }
+
+  // Must be called with the arena lock held. The arena becomes visible to
+  // readers only once its geometry is published.
+  bool AddArena(const uint64_t& ceiling_msg_size, const uint32_t& block_num) {
+    uint32_t index = arena_num_.load();
+    if (index >= kMaxArenaNum) {
+      return false;
+    }
+    arena_ceiling_msg_sizes_[index].store(ceiling_msg_size);
+    arena_block_nums_[index].store(block_num);
+    arena_num_.store(index + 1);
+    return true;
+  }
+
+  // NUMA node the arenas were placed on by their creator, -1 if not placed
+  void set_numa_node(int32_t node) { numa_node_.store(node); }
+  int32_t numa_node() { return numa_node_.load(); }
+
+  uint32_t arena_num() { return arena_num_.load(); }
+  uint64_t arena_ceiling_msg_size(uint32_t index) {
+    return arena_ceiling_msg_sizes_[index].load();
+  }
+  uint32_t arena_block_num(uint32_t index) {
+    return arena_block_nums_[index].load();
+  }
+
   uint64_t ceiling_msg_size() { return ceiling_msg_size_.load(); }
   uint32_t reference_counts() { return reference_count_.load(); }
   uint32_t wrote_num() { return wrote_num_.load(); }
@@ -59,6 +94,12 @@ class State {
   std::atomic<uint32_t> wrote_num_ = {0};
   std::atomic<uint32_t> reference_count_ = {0};
   std::atomic<uint64_t> ceiling_msg_size_;
+  std::atomic<int32_t> numa_node_ = {-1};
+
+  std::atomic<bool> arena_lock_ = {false};
+  std::atomic<uint32_t> arena_num_ = {0};
+  std::atomic<uint64_t> arena_ceiling_msg_sizes_[kMaxArenaNum];
+  std::atomic<uint32_t> arena_block_nums_[kMaxArenaNum];
 };
 
 }  // namespace transport
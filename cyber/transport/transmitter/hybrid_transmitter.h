@@ -71,6 +71,9 @@ class HybridTransmitter : public Transmitter<M> {
 
   bool Transmit(const MessagePtr& msg, const MessageInfo& msg_info) override;
 
+  bool Loan(LoanedMessage<M>* loaned) override;
+  bool Transmit(LoanedMessage<M>* loaned, const MessageInfo& msg_info) override;
+
  private:
   void InitMode();
   void ObtainConfig();
@@ -171,6 +174,50 @@ bool HybridTransmitter<M>::Transmit(const MessagePtr& msg,
   return true;
 }
 
+template <typename M>
+bool HybridTransmitter<M>::Loan(LoanedMessage<M>* loaned) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = transmitters_.find(OptionalMode::SHM);
+  if (it == transmitters_.end()) {
+    return false;
+  }
+  return it->second->Loan(loaned);
+}
+
+template <typename M>
+bool HybridTransmitter<M>::Transmit(LoanedMessage<M>* loaned,
+                                    const MessageInfo& msg_info) {
+  RETURN_VAL_IF_NULL(loaned, false);
+  if (!loaned->valid()) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  // receivers outside shm still get a heap copy; it is made only when
+  // somebody actually needs it.
+  MessagePtr copy = nullptr;
+  if (this->attr_.qos_profile().durability() ==
+      QosDurabilityPolicy::DURABILITY_TRANSIENT_LOCAL) {
+    copy = std::make_shared<M>(*loaned->get());
+    history_->Add(copy, msg_info);
+  }
+  for (auto& item : transmitters_) {
+    if (item.first == OptionalMode::SHM || receivers_[item.first].empty()) {
+      continue;
+    }
+    if (copy == nullptr) {
+      copy = std::make_shared<M>(*loaned->get());
+    }
+    item.second->Transmit(copy, msg_info);
+  }
+
+  auto it = transmitters_.find(OptionalMode::SHM);
+  if (it == transmitters_.end()) {
+    return false;
+  }
+  return it->second->Transmit(loaned, msg_info);
+}
+
 template <typename M>
 void HybridTransmitter<M>::InitMode() {
   mode_ = std::make_shared<proto::CommunicationMode>();
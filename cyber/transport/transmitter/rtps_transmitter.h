@@ -17,13 +17,18 @@
 #ifndef CYBER_TRANSPORT_TRANSMITTER_RTPS_TRANSMITTER_H_
 #define CYBER_TRANSPORT_TRANSMITTER_RTPS_TRANSMITTER_H_
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "cyber/common/log.h"
 #include "cyber/message/message_traits.h"
 #include "cyber/transport/rtps/attributes_filler.h"
 #include "cyber/transport/rtps/participant.h"
+#include "cyber/transport/rtps/underlay_batch.h"
 #include "cyber/transport/transmitter/transmitter.h"
 #include "fastrtps/Domain.h"
 #include "fastrtps/attributes/PublisherAttributes.h"
@@ -50,15 +55,37 @@ class RtpsTransmitter : public Transmitter<M> {
 
  private:
   bool Transmit(const M& msg, const MessageInfo& msg_info);
+  bool Write(UnderlayMessage* m, const MessageInfo& msg_info);
+
+  bool Batch(const std::string& msg, const MessageInfo& msg_info);
+  bool FlushBatch();
+  void RunFlush();
 
   ParticipantPtr participant_;
   eprosima::fastrtps::Publisher* publisher_;
+
+  // batching, only used when the channel has a RtpsBatchConf
+  bool batch_enabled_;
+  proto::RtpsBatchConf batch_conf_;
+  std::mutex batch_mutex_;
+  std::condition_variable batch_cv_;
+  std::string batch_;
+  MessageInfo batch_info_;
+  std::chrono::steady_clock::time_point batch_deadline_;
+  bool flush_running_;
+  std::thread flush_thread_;
 };
 
 template <typename M>
 RtpsTransmitter<M>::RtpsTransmitter(const RoleAttributes& attr,
                                     const ParticipantPtr& participant)
-    : Transmitter<M>(attr), participant_(participant), publisher_(nullptr) {}
+    : Transmitter<M>(attr),
+      participant_(participant),
+      publisher_(nullptr),
+      batch_enabled_(false),
+      flush_running_(false) {
+  batch_enabled_ = UnderlayBatch::GetConf(attr.channel_name(), &batch_conf_);
+}
 
 template <typename M>
 RtpsTransmitter<M>::~RtpsTransmitter() {
@@ -80,11 +107,25 @@ void RtpsTransmitter<M>::Enable() {
       participant_->fastrtps_participant(), pub_attr);
   RETURN_IF_NULL(publisher_);
   this->enabled_ = true;
+
+  if (batch_enabled_) {
+    flush_running_ = true;
+    flush_thread_ = std::thread(&RtpsTransmitter<M>::RunFlush, this);
+  }
 }
 
 template <typename M>
 void RtpsTransmitter<M>::Disable() {
   if (this->enabled_) {
+    if (flush_thread_.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(batch_mutex_);
+        flush_running_ = false;
+      }
+      batch_cv_.notify_one();
+      flush_thread_.join();
+      FlushBatch();
+    }
     publisher_ = nullptr;
     this->enabled_ = false;
   }
@@ -105,7 +146,22 @@ bool RtpsTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
 
   UnderlayMessage m;
   RETURN_VAL_IF(!message::SerializeToString(msg, &m.data()), false);
+  if (batch_enabled_) {
+    return Batch(m.data(), msg_info);
+  }
+  if (msg_info.trace_id() != 0) {
+    // the sample header has no room for the trace, send a batch of one
+    UnderlayMessage traced;
+    traced.datatype(UnderlayBatch::kDataType);
+    UnderlayBatch::Append(m.data(), msg_info, &traced.data());
+    return Write(&traced, msg_info);
+  }
+  return Write(&m, msg_info);
+}
 
+template <typename M>
+bool RtpsTransmitter<M>::Write(UnderlayMessage* m,
+                               const MessageInfo& msg_info) {
   eprosima::fastrtps::rtps::WriteParams wparams;
 
   char* ptr =
@@ -122,7 +178,59 @@ bool RtpsTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
   if (participant_->is_shutdown()) {
     return false;
   }
-  return publisher_->write(reinterpret_cast<void*>(&m), wparams);
+  return publisher_->write(reinterpret_cast<void*>(m), wparams);
+}
+
+template <typename M>
+bool RtpsTransmitter<M>::Batch(const std::string& msg,
+                               const MessageInfo& msg_info) {
+  std::unique_lock<std::mutex> lock(batch_mutex_);
+  if (batch_.empty()) {
+    // the sample header carries the first message's identity
+    batch_info_ = msg_info;
+    batch_deadline_ = std::chrono::steady_clock::now() +
+                      std::chrono::microseconds(batch_conf_.max_delay_us());
+    batch_cv_.notify_one();
+  }
+  UnderlayBatch::Append(msg, msg_info, &batch_);
+  if (batch_.size() < batch_conf_.max_bytes()) {
+    return true;
+  }
+  lock.unlock();
+  return FlushBatch();
+}
+
+template <typename M>
+bool RtpsTransmitter<M>::FlushBatch() {
+  UnderlayMessage m;
+  MessageInfo msg_info;
+  {
+    std::lock_guard<std::mutex> lock(batch_mutex_);
+    if (batch_.empty()) {
+      return true;
+    }
+    m.datatype(UnderlayBatch::kDataType);
+    m.data().swap(batch_);
+    msg_info = batch_info_;
+  }
+  return Write(&m, msg_info);
+}
+
+template <typename M>
+void RtpsTransmitter<M>::RunFlush() {
+  std::unique_lock<std::mutex> lock(batch_mutex_);
+  while (flush_running_) {
+    if (batch_.empty()) {
+      batch_cv_.wait(lock);
+      continue;
+    }
+    if (batch_cv_.wait_until(lock, batch_deadline_) ==
+        std::cv_status::timeout) {
+      lock.unlock();
+      FlushBatch();
+      lock.lock();
+    }
+  }
 }
 
 }  // namespace transport
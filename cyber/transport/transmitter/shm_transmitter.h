@@ -21,11 +21,13 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <type_traits>
 
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/common/util.h"
 #include "cyber/message/message_traits.h"
+#include "cyber/transport/shm/loaned_message.h"
 #include "cyber/transport/shm/notifier_factory.h"
 #include "cyber/transport/shm/readable_info.h"
 #include "cyber/transport/shm/segment.h"
@@ -48,8 +50,19 @@ class ShmTransmitter : public Transmitter<M> {
 
   bool Transmit(const MessagePtr& msg, const MessageInfo& msg_info) override;
 
+  bool Loan(LoanedMessage<M>* loaned) override;
+  bool Transmit(LoanedMessage<M>* loaned, const MessageInfo& msg_info) override;
+
  private:
   bool Transmit(const M& msg, const MessageInfo& msg_info);
+  bool Notify(const WritableBlock& wb, const MessageInfo& msg_info);
+
+  template <typename T = M>
+  typename std::enable_if<message::IsLoanable<T>::value, bool>::type LoanImpl(
+      LoanedMessage<T>* loaned);
+  template <typename T = M>
+  typename std::enable_if<!message::IsLoanable<T>::value, bool>::type
+  LoanImpl(LoanedMessage<T>* loaned);
 
   SegmentPtr segment_;
   uint64_t channel_id_;
@@ -118,8 +131,64 @@ bool ShmTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
     return false;
   }
   wb.block->set_msg_size(msg_size);
+  return Notify(wb, msg_info);
+}
+
+template <typename M>
+bool ShmTransmitter<M>::Loan(LoanedMessage<M>* loaned) {
+  RETURN_VAL_IF_NULL(loaned, false);
+  if (!this->enabled_) {
+    ADEBUG << "not enable.";
+    return false;
+  }
+  return LoanImpl(loaned);
+}
+
+template <typename M>
+template <typename T>
+typename std::enable_if<message::IsLoanable<T>::value, bool>::type
+ShmTransmitter<M>::LoanImpl(LoanedMessage<T>* loaned) {
+  WritableBlock wb;
+  if (!segment_->AcquireBlockToWrite(sizeof(T), &wb)) {
+    AERROR << "acquire block failed.";
+    return false;
+  }
+  *loaned = LoanedMessage<T>(segment_, wb);
+  return true;
+}
+
+template <typename M>
+template <typename T>
+typename std::enable_if<!message::IsLoanable<T>::value, bool>::type
+ShmTransmitter<M>::LoanImpl(LoanedMessage<T>* loaned) {
+  (void)loaned;
+  AERROR << "message type is not loanable.";
+  return false;
+}
+
+template <typename M>
+bool ShmTransmitter<M>::Transmit(LoanedMessage<M>* loaned,
+                                 const MessageInfo& msg_info) {
+  RETURN_VAL_IF_NULL(loaned, false);
+  if (!loaned->valid()) {
+    AERROR << "transmit an invalid loan.";
+    return false;
+  }
+  if (!this->enabled_) {
+    ADEBUG << "not enable.";
+    return false;
+  }
+
+  WritableBlock wb = loaned->Detach();
+  wb.block->set_msg_size(sizeof(M));
+  return Notify(wb, msg_info);
+}
 
-  char* msg_info_addr = reinterpret_cast<char*>(wb.buf) + msg_size;
+template <typename M>
+bool ShmTransmitter<M>::Notify(const WritableBlock& wb,
+                               const MessageInfo& msg_info) {
+  char* msg_info_addr =
+      reinterpret_cast<char*>(wb.buf) + wb.block->msg_size();
   if (!msg_info.SerializeTo(msg_info_addr, MessageInfo::kSize)) {
     AERROR << "serialize message info failed.";
     segment_->ReleaseWrittenBlock(wb);
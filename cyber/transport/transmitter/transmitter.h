@@ -21,14 +21,19 @@
 #include <memory>
 #include <string>
 
+#include "cyber/event/channel_tracer.h"
 #include "cyber/event/perf_event_cache.h"
+#include "cyber/message/message_traits.h"
 #include "cyber/transport/common/endpoint.h"
 #include "cyber/transport/message/message_info.h"
+#include "cyber/transport/shm/channel_stats_table.h"
+#include "cyber/transport/shm/loaned_message.h"
 
 namespace apollo {
 namespace cyber {
 namespace transport {
 
+using apollo::cyber::event::ChannelTracer;
 using apollo::cyber::event::PerfEventCache;
 using apollo::cyber::event::TransPerf;
 
@@ -49,6 +54,12 @@ class Transmitter : public Endpoint {
   virtual bool Transmit(const MessagePtr& msg);
   virtual bool Transmit(const MessagePtr& msg, const MessageInfo& msg_info) = 0;
 
+  // Zero-copy publishing, only supported by shm-backed transmitters for
+  // loanable message types. The defaults refuse every loan.
+  virtual bool Loan(LoanedMessage<M>* loaned);
+  bool Transmit(LoanedMessage<M>* loaned);
+  virtual bool Transmit(LoanedMessage<M>* loaned, const MessageInfo& msg_info);
+
   uint64_t NextSeqNum() { return ++seq_num_; }
 
   uint64_t seq_num() const { return seq_num_; }
@@ -56,11 +67,15 @@ class Transmitter : public Endpoint {
  protected:
   uint64_t seq_num_;
   MessageInfo msg_info_;
+  ChannelStatsTable::Slot* stats_slot_;
 };
 
 template <typename M>
 Transmitter<M>::Transmitter(const RoleAttributes& attr)
-    : Endpoint(attr), seq_num_(0) {
+    : Endpoint(attr),
+      seq_num_(0),
+      stats_slot_(ChannelStatsTable::Instance()->GetSlot(
+          attr.channel_id(), attr.channel_name())) {
   msg_info_.set_sender_id(this->id_);
   msg_info_.set_seq_num(this->seq_num_);
 }
@@ -71,9 +86,43 @@ Transmitter<M>::~Transmitter() {}
 template <typename M>
 bool Transmitter<M>::Transmit(const MessagePtr& msg) {
   msg_info_.set_seq_num(NextSeqNum());
+  ChannelTracer::Instance()->OnTransmit(&msg_info_);
   PerfEventCache::Instance()->AddTransportEvent(
       TransPerf::TRANS_FROM, attr_.channel_id(), msg_info_.seq_num());
-  return Transmit(msg, msg_info_);
+  const bool result = Transmit(msg, msg_info_);
+  if (stats_slot_ != nullptr) {
+    // the serialization of the transmit, if any, has cached the size
+    const int size = message::CachedByteSize(*msg);
+    ChannelStatsTable::OnTransmit(stats_slot_, msg_info_.seq_num(),
+                                  size > 0 ? size : 0, result);
+  }
+  return result;
+}
+
+template <typename M>
+bool Transmitter<M>::Loan(LoanedMessage<M>* loaned) {
+  (void)loaned;
+  return false;
+}
+
+template <typename M>
+bool Transmitter<M>::Transmit(LoanedMessage<M>* loaned) {
+  msg_info_.set_seq_num(NextSeqNum());
+  ChannelTracer::Instance()->OnTransmit(&msg_info_);
+  PerfEventCache::Instance()->AddTransportEvent(
+      TransPerf::TRANS_FROM, attr_.channel_id(), msg_info_.seq_num());
+  const bool result = Transmit(loaned, msg_info_);
+  ChannelStatsTable::OnTransmit(stats_slot_, msg_info_.seq_num(), sizeof(M),
+                                result);
+  return result;
+}
+
+template <typename M>
+bool Transmitter<M>::Transmit(LoanedMessage<M>* loaned,
+                              const MessageInfo& msg_info) {
+  (void)loaned;
+  (void)msg_info;
+  return false;
 }
 
 template <typename M>
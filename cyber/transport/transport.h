@@ -22,6 +22,7 @@
 #include <string>
 
 #include "cyber/common/macros.h"
+#include "cyber/message/message_traits.h"
 #include "cyber/proto/transport_conf.pb.h"
 #include "cyber/transport/dispatcher/intra_dispatcher.h"
 #include "cyber/transport/dispatcher/rtps_dispatcher.h"
@@ -68,6 +69,17 @@ class Transport {
  private:
   void CreateParticipant();
 
+  // Messages without a wire format, e.g. the frames handed over between
+  // the components of one process, can only be passed by pointer, so they
+  // always take the intra process transport whatever the mode.
+  template <typename M>
+  static OptionalMode SupportedMode(const OptionalMode& mode) {
+    if (!message::HasSerializer<M>::value && !message::IsLoanable<M>::value) {
+      return OptionalMode::INTRA;
+    }
+    return mode;
+  }
+
   std::atomic<bool> is_shutdown_;
   ParticipantPtr participant_;
   NotifierPtr notifier_;
@@ -94,7 +106,8 @@ auto Transport::CreateTransmitter(const RoleAttributes& attr,
         QosProfileConf::QOS_PROFILE_DEFAULT);
   }
 
-  switch (mode) {
+  const OptionalMode supported_mode = SupportedMode<M>(mode);
+  switch (supported_mode) {
     case OptionalMode::INTRA:
       transmitter = std::make_shared<IntraTransmitter<M>>(modified_attr);
       break;
@@ -115,7 +128,7 @@ auto Transport::CreateTransmitter(const RoleAttributes& attr,
   }
 
   RETURN_VAL_IF_NULL(transmitter, nullptr);
-  if (mode != OptionalMode::HYBRID) {
+  if (supported_mode != OptionalMode::HYBRID) {
     transmitter->Enable();
   }
   return transmitter;
@@ -138,7 +151,8 @@ auto Transport::CreateReceiver(
         QosProfileConf::QOS_PROFILE_DEFAULT);
   }
 
-  switch (mode) {
+  const OptionalMode supported_mode = SupportedMode<M>(mode);
+  switch (supported_mode) {
     case OptionalMode::INTRA:
       receiver =
           std::make_shared<IntraReceiver<M>>(modified_attr, msg_listener);
@@ -159,7 +173,7 @@ auto Transport::CreateReceiver(
   }
 
   RETURN_VAL_IF_NULL(receiver, nullptr);
-  if (mode != OptionalMode::HYBRID) {
+  if (supported_mode != OptionalMode::HYBRID) {
     receiver->Enable();
   }
   return receiver;
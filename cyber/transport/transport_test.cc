@@ -18,6 +18,7 @@
 
 #include <gtest/gtest.h>
 #include <memory>
+#include <string>
 #include <typeinfo>
 
 #include "cyber/proto/unit_test.pb.h"
@@ -74,6 +75,28 @@ TEST(TransportTest, create_receiver) {
   EXPECT_EQ(typeid(*shm), typeid(ShmReceiver<proto::UnitTest>));
 }
 
+// no wire format, only ever passed by pointer
+struct PointerOnlyMessage {
+  std::shared_ptr<std::string> payload;
+};
+
+TEST(TransportTest, pointer_only_message_is_intra) {
+  RoleAttributes attr;
+  attr.set_channel_name("pointer_only_message");
+  Identity id;
+  attr.set_id(id.HashValue());
+
+  auto transmitter =
+      Transport::Instance()->CreateTransmitter<PointerOnlyMessage>(attr);
+  EXPECT_EQ(typeid(*transmitter), typeid(IntraTransmitter<PointerOnlyMessage>));
+
+  auto listener = [](const std::shared_ptr<PointerOnlyMessage>&,
+                     const MessageInfo&, const RoleAttributes&) {};
+  auto receiver = Transport::Instance()->CreateReceiver<PointerOnlyMessage>(
+      attr, listener, OptionalMode::SHM);
+  EXPECT_EQ(typeid(*receiver), typeid(IntraReceiver<PointerOnlyMessage>));
+}
+
 }  // namespace transport
 }  // namespace cyber
 }  // namespace apollo
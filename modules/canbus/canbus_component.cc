@@ -104,6 +104,12 @@ bool CanbusComponent::Init() {
         << " initialized with canbus conf as : "
         << canbus_conf_.vehicle_parameter().ShortDebugString();
 
+  if (canbus_conf_.realtime_thread().enable()) {
+    realtime_loop_.reset(new common::util::RealtimeLoop(
+        canbus_conf_.realtime_thread(),
+        [this]() { WriteLatestControlCommand(); }));
+  }
+
   cyber::ReaderConfig guardian_cmd_reader_config;
   guardian_cmd_reader_config.channel_name = FLAGS_guardian_topic;
   guardian_cmd_reader_config.pending_queue_size =
@@ -126,7 +132,11 @@ bool CanbusComponent::Init() {
         control_cmd_reader_config,
         [this](const std::shared_ptr<ControlCommand> &cmd) {
           ADEBUG << "Received control data: run canbus callback.";
-          OnControlCommand(*cmd);
+          if (realtime_loop_ != nullptr) {
+            HandOverControlCommand(*cmd);
+          } else {
+            OnControlCommand(*cmd);
+          }
         });
   }
 
@@ -161,11 +171,26 @@ bool CanbusComponent::Init() {
     return false;
   }
 
+  // 5. start writing the commands from the realtime thread
+  if (realtime_loop_ != nullptr) {
+    realtime_loop_->Start();
+    AINFO << "Write commands on a realtime thread: "
+          << canbus_conf_.realtime_thread().ShortDebugString();
+  }
+
   monitor_logger_buffer_.INFO("Canbus is started.");
 
   return true;
 }
 
+void CanbusComponent::Clear() {
+  if (realtime_loop_ != nullptr) {
+    realtime_loop_->Stop();
+    AINFO << "The realtime command writer overran "
+          << realtime_loop_->overruns() << " periods.";
+  }
+}
+
 void CanbusComponent::PublishChassis() {
   Chassis chassis = vehicle_controller_->chassis();
   common::util::FillHeader(node_->Name(), &chassis);
@@ -217,11 +242,27 @@ void CanbusComponent::OnControlCommand(const ControlCommand &control_command) {
 
 void CanbusComponent::OnGuardianCommand(
     const GuardianCommand &guardian_command) {
+  if (realtime_loop_ != nullptr) {
+    HandOverControlCommand(guardian_command.control_command());
+    return;
+  }
   apollo::control::ControlCommand control_command;
   control_command.CopyFrom(guardian_command.control_command());
   OnControlCommand(control_command);
 }
 
+void CanbusComponent::HandOverControlCommand(
+    const ControlCommand &control_command) {
+  latest_control_command_.back()->CopyFrom(control_command);
+  latest_control_command_.Publish();
+}
+
+void CanbusComponent::WriteLatestControlCommand() {
+  if (latest_control_command_.Update()) {
+    OnControlCommand(latest_control_command_.front());
+  }
+}
+
 common::Status CanbusComponent::OnError(const std::string &error_msg) {
   monitor_logger_buffer_.ERROR(error_msg);
   return ::apollo::common::Status(ErrorCode::CANBUS_ERROR, error_msg);
@@ -25,6 +25,7 @@
 #include <utility>
 #include <vector>
 
+#include "cyber/base/triple_buffer.h"
 #include "cyber/common/macros.h"
 #include "cyber/component/timer_component.h"
 #include "cyber/cyber.h"
@@ -37,6 +38,7 @@
 #include "modules/canbus/vehicle/vehicle_controller.h"
 #include "modules/common/monitor_log/monitor_log_buffer.h"
 #include "modules/common/status/status.h"
+#include "modules/common/util/realtime_loop.h"
 #include "modules/control/proto/control_cmd.pb.h"
 #include "modules/drivers/canbus/can_client/can_client.h"
 #include "modules/drivers/canbus/can_comm/can_receiver.h"
@@ -80,11 +82,15 @@ class CanbusComponent final : public apollo::cyber::TimerComponent {
   bool Proc() override;
 
  private:
+  void Clear() override;
   void PublishChassis();
   void PublishChassisDetail();
   void OnControlCommand(const apollo::control::ControlCommand &control_command);
   void OnGuardianCommand(
       const apollo::guardian::GuardianCommand &guardian_command);
+  void HandOverControlCommand(
+      const apollo::control::ControlCommand &control_command);
+  void WriteLatestControlCommand();
   apollo::common::Status OnError(const std::string &error_msg);
   void RegisterCanClients();
 
@@ -103,6 +109,11 @@ class CanbusComponent final : public apollo::cyber::TimerComponent {
   ::apollo::common::monitor::MonitorLogBuffer monitor_logger_buffer_;
   std::shared_ptr<Writer<Chassis>> chassis_writer_;
   std::shared_ptr<Writer<ChassisDetail>> chassis_detail_writer_;
+
+  // with a realtime thread, the callbacks only hand the commands over to it
+  std::unique_ptr<apollo::common::util::RealtimeLoop> realtime_loop_;
+  apollo::cyber::base::TripleBuffer<apollo::control::ControlCommand>
+      latest_control_command_;
 };
 
 CYBER_REGISTER_COMPONENT(CanbusComponent)
@@ -16,14 +16,15 @@
 
 #include "modules/canbus/vehicle/ge3/protocol/scu_1_301.h"
 #include "glog/logging.h"
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace ge3 {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Scu1301::Scu1301() {}
 const int32_t Scu1301::ID = 0x301;
@@ -44,8 +45,8 @@ void Scu1301::Parse(const std::uint8_t* bytes, int32_t length,
 // 'physical_range': '[0|255]', 'bit': 15, 'type': 'int', 'order': 'motorola',
 // 'physical_unit': '-'}
 int Scu1301::vin16(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -58,8 +59,8 @@ int Scu1301::vin16(const std::uint8_t* bytes, int32_t length) const {
 // 'physical_unit': ''}
 Scu_1_301::Scu_stopbutstType Scu1301::scu_stopbutst(const std::uint8_t* bytes,
                                                     int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_1_301::Scu_stopbutstType ret =
       static_cast<Scu_1_301::Scu_stopbutstType>(x);
@@ -73,8 +74,8 @@ Scu_1_301::Scu_stopbutstType Scu1301::scu_stopbutst(const std::uint8_t* bytes,
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Scu_1_301::Scu_drvmodeType Scu1301::scu_drvmode(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 2);
+  using Layout = SignalLayout<SignalPiece<0, 2, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_1_301::Scu_drvmodeType ret = static_cast<Scu_1_301::Scu_drvmodeType>(x);
   return ret;
@@ -87,8 +88,8 @@ Scu_1_301::Scu_drvmodeType Scu1301::scu_drvmode(const std::uint8_t* bytes,
 // 'physical_unit': ''}
 Scu_1_301::Scu_faultstType Scu1301::scu_faultst(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 4);
+  using Layout = SignalLayout<SignalPiece<0, 4, 4>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_1_301::Scu_faultstType ret = static_cast<Scu_1_301::Scu_faultstType>(x);
   return ret;
@@ -16,14 +16,15 @@
 
 #include "modules/canbus/vehicle/ge3/protocol/scu_2_302.h"
 #include "glog/logging.h"
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace ge3 {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Scu2302::Scu2302() {}
 const int32_t Scu2302::ID = 0x302;
@@ -45,8 +46,8 @@ void Scu2302::Parse(const std::uint8_t* bytes, int32_t length,
 // 'physical_range': '[0|255]', 'bit': 63, 'type': 'int', 'order': 'motorola',
 // 'physical_unit': '-'}
 int Scu2302::vin07(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<7, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -57,8 +58,8 @@ int Scu2302::vin07(const std::uint8_t* bytes, int32_t length) const {
 // 'physical_range': '[0|255]', 'bit': 55, 'type': 'int', 'order': 'motorola',
 // 'physical_unit': '-'}
 int Scu2302::vin06(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<6, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -69,8 +70,8 @@ int Scu2302::vin06(const std::uint8_t* bytes, int32_t length) const {
 // 'physical_range': '[0|255]', 'bit': 47, 'type': 'int', 'order': 'motorola',
 // 'physical_unit': '-'}
 int Scu2302::vin05(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<5, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -81,8 +82,8 @@ int Scu2302::vin05(const std::uint8_t* bytes, int32_t length) const {
 // 'physical_range': '[0|255]', 'bit': 39, 'type': 'int', 'order': 'motorola',
 // 'physical_unit': '-'}
 int Scu2302::vin04(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -93,8 +94,8 @@ int Scu2302::vin04(const std::uint8_t* bytes, int32_t length) const {
 // 'physical_range': '[0|255]', 'bit': 31, 'type': 'int', 'order': 'motorola',
 // 'physical_unit': '-'}
 int Scu2302::vin03(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -105,8 +106,8 @@ int Scu2302::vin03(const std::uint8_t* bytes, int32_t length) const {
 // 'physical_range': '[0|255]', 'bit': 23, 'type': 'int', 'order': 'motorola',
 // 'physical_unit': '-'}
 int Scu2302::vin02(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -117,8 +118,8 @@ int Scu2302::vin02(const std::uint8_t* bytes, int32_t length) const {
 // 'physical_range': '[0|255]', 'bit': 15, 'type': 'int', 'order': 'motorola',
 // 'physical_unit': '-'}
 int Scu2302::vin01(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -129,8 +130,8 @@ int Scu2302::vin01(const std::uint8_t* bytes, int32_t length) const {
 // 'physical_range': '[0|255]', 'bit': 7, 'type': 'int', 'order': 'motorola',
 // 'physical_unit': '-'}
 int Scu2302::vin00(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
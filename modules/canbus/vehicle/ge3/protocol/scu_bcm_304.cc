@@ -16,14 +16,15 @@
 
 #include "modules/canbus/vehicle/ge3/protocol/scu_bcm_304.h"
 #include "glog/logging.h"
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace ge3 {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Scubcm304::Scubcm304() {}
 const int32_t Scubcm304::ID = 0x304;
@@ -63,8 +64,8 @@ void Scubcm304::Parse(const std::uint8_t* bytes, int32_t length,
 // 'physical_unit': '-'}
 Scu_bcm_304::Bcm_vehreversestType Scubcm304::bcm_vehreversest(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<1, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcm_304::Bcm_vehreversestType ret =
       static_cast<Scu_bcm_304::Bcm_vehreversestType>(x);
@@ -78,8 +79,8 @@ Scu_bcm_304::Bcm_vehreversestType Scubcm304::bcm_vehreversest(
 // 'order': 'motorola', 'physical_unit': '-'}
 Scu_bcm_304::Bcm_rightturnlampstType Scubcm304::bcm_rightturnlampst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<0, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcm_304::Bcm_rightturnlampstType ret =
       static_cast<Scu_bcm_304::Bcm_rightturnlampstType>(x);
@@ -93,8 +94,8 @@ Scu_bcm_304::Bcm_rightturnlampstType Scubcm304::bcm_rightturnlampst(
 // 'order': 'motorola', 'physical_unit': '-'}
 Scu_bcm_304::Bcm_rearfoglampstType Scubcm304::bcm_rearfoglampst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcm_304::Bcm_rearfoglampstType ret =
       static_cast<Scu_bcm_304::Bcm_rearfoglampstType>(x);
@@ -108,8 +109,8 @@ Scu_bcm_304::Bcm_rearfoglampstType Scubcm304::bcm_rearfoglampst(
 // 'order': 'motorola', 'physical_unit': ''}
 Scu_bcm_304::Bcm_parkinglampstType Scubcm304::bcm_parkinglampst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<1, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcm_304::Bcm_parkinglampstType ret =
       static_cast<Scu_bcm_304::Bcm_parkinglampstType>(x);
@@ -123,8 +124,8 @@ Scu_bcm_304::Bcm_parkinglampstType Scubcm304::bcm_parkinglampst(
 // 'physical_unit': '-'}
 Scu_bcm_304::Bcm_lowbeamstType Scubcm304::bcm_lowbeamst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcm_304::Bcm_lowbeamstType ret =
       static_cast<Scu_bcm_304::Bcm_lowbeamstType>(x);
@@ -138,8 +139,8 @@ Scu_bcm_304::Bcm_lowbeamstType Scubcm304::bcm_lowbeamst(
 // 'order': 'motorola', 'physical_unit': '-'}
 Scu_bcm_304::Bcm_leftturnlampstType Scubcm304::bcm_leftturnlampst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcm_304::Bcm_leftturnlampstType ret =
       static_cast<Scu_bcm_304::Bcm_leftturnlampstType>(x);
@@ -153,8 +154,8 @@ Scu_bcm_304::Bcm_leftturnlampstType Scubcm304::bcm_leftturnlampst(
 // 'physical_unit': '-'}
 Scu_bcm_304::Bcm_keystType Scubcm304::bcm_keyst(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(6, 2);
+  using Layout = SignalLayout<SignalPiece<0, 6, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcm_304::Bcm_keystType ret = static_cast<Scu_bcm_304::Bcm_keystType>(x);
   return ret;
@@ -167,8 +168,8 @@ Scu_bcm_304::Bcm_keystType Scubcm304::bcm_keyst(const std::uint8_t* bytes,
 // 'physical_unit': '-'}
 Scu_bcm_304::Bcm_hornstType Scubcm304::bcm_hornst(const std::uint8_t* bytes,
                                                   int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(7, 1);
+  using Layout = SignalLayout<SignalPiece<1, 7, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcm_304::Bcm_hornstType ret = static_cast<Scu_bcm_304::Bcm_hornstType>(x);
   return ret;
@@ -181,8 +182,8 @@ Scu_bcm_304::Bcm_hornstType Scubcm304::bcm_hornst(const std::uint8_t* bytes,
 // 'physical_unit': '-'}
 Scu_bcm_304::Bcm_highbeamstType Scubcm304::bcm_highbeamst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcm_304::Bcm_highbeamstType ret =
       static_cast<Scu_bcm_304::Bcm_highbeamstType>(x);
@@ -196,8 +197,8 @@ Scu_bcm_304::Bcm_highbeamstType Scubcm304::bcm_highbeamst(
 // 'physical_unit': ''}
 Scu_bcm_304::Bcm_hazardlampstType Scubcm304::bcm_hazardlampst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<1, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcm_304::Bcm_hazardlampstType ret =
       static_cast<Scu_bcm_304::Bcm_hazardlampstType>(x);
@@ -211,8 +212,8 @@ Scu_bcm_304::Bcm_hazardlampstType Scubcm304::bcm_hazardlampst(
 // 'order': 'motorola', 'physical_unit': '-'}
 Scu_bcm_304::Bcm_frontfoglampstType Scubcm304::bcm_frontfoglampst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcm_304::Bcm_frontfoglampstType ret =
       static_cast<Scu_bcm_304::Bcm_frontfoglampstType>(x);
@@ -226,8 +227,8 @@ Scu_bcm_304::Bcm_frontfoglampstType Scubcm304::bcm_frontfoglampst(
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': '-'}
 Scu_bcm_304::Bcm_brakelightswitchstType Scubcm304::bcm_brakelightswitchst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<1, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcm_304::Bcm_brakelightswitchstType ret =
       static_cast<Scu_bcm_304::Bcm_brakelightswitchstType>(x);
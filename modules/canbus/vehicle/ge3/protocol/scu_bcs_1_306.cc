@@ -16,14 +16,15 @@
 
 #include "modules/canbus/vehicle/ge3/protocol/scu_bcs_1_306.h"
 #include "glog/logging.h"
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace ge3 {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Scubcs1306::Scubcs1306() {}
 const int32_t Scubcs1306::ID = 0x306;
@@ -62,8 +63,8 @@ void Scubcs1306::Parse(const std::uint8_t* bytes, int32_t length,
 // 'order': 'motorola', 'physical_unit': ''}
 Scu_bcs_1_306::Bcs_aebavailableType Scubcs1306::bcs_aebavailable(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<2, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_1_306::Bcs_aebavailableType ret =
       static_cast<Scu_bcs_1_306::Bcs_aebavailableType>(x);
@@ -77,8 +78,8 @@ Scu_bcs_1_306::Bcs_aebavailableType Scubcs1306::bcs_aebavailable(
 // 'order': 'motorola', 'physical_unit': ''}
 Scu_bcs_1_306::Bcs_cddavailableType Scubcs1306::bcs_cddavailable(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<2, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_1_306::Bcs_cddavailableType ret =
       static_cast<Scu_bcs_1_306::Bcs_cddavailableType>(x);
@@ -91,13 +92,9 @@ Scu_bcs_1_306::Bcs_cddavailableType Scubcs1306::bcs_cddavailable(
 // 'motorola', 'physical_unit': '%'}
 double Scubcs1306::bcs_brkpedact(const std::uint8_t* bytes,
                                  int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 2);
-  int32_t t = t1.get_byte(6, 2);
-  x <<= 2;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>,
+                              SignalPiece<2, 6, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.100000;
   return ret;
@@ -111,8 +108,8 @@ double Scubcs1306::bcs_brkpedact(const std::uint8_t* bytes,
 // 'motorola', 'physical_unit': ''}
 Scu_bcs_1_306::Bcs_intidxType Scubcs1306::bcs_intidx(const std::uint8_t* bytes,
                                                      int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(3, 3);
+  using Layout = SignalLayout<SignalPiece<2, 3, 3>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_1_306::Bcs_intidxType ret =
       static_cast<Scu_bcs_1_306::Bcs_intidxType>(x);
@@ -126,8 +123,8 @@ Scu_bcs_1_306::Bcs_intidxType Scubcs1306::bcs_intidx(const std::uint8_t* bytes,
 // 'physical_unit': ''}
 Scu_bcs_1_306::Bcs_vdcfaultstType Scubcs1306::bcs_vdcfaultst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_1_306::Bcs_vdcfaultstType ret =
       static_cast<Scu_bcs_1_306::Bcs_vdcfaultstType>(x);
@@ -141,8 +138,8 @@ Scu_bcs_1_306::Bcs_vdcfaultstType Scubcs1306::bcs_vdcfaultst(
 // 'physical_unit': ''}
 Scu_bcs_1_306::Bcs_vdcactivestType Scubcs1306::bcs_vdcactivest(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_1_306::Bcs_vdcactivestType ret =
       static_cast<Scu_bcs_1_306::Bcs_vdcactivestType>(x);
@@ -156,8 +153,8 @@ Scu_bcs_1_306::Bcs_vdcactivestType Scubcs1306::bcs_vdcactivest(
 // 'physical_unit': ''}
 Scu_bcs_1_306::Bcs_absfaultstType Scubcs1306::bcs_absfaultst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_1_306::Bcs_absfaultstType ret =
       static_cast<Scu_bcs_1_306::Bcs_absfaultstType>(x);
@@ -171,8 +168,8 @@ Scu_bcs_1_306::Bcs_absfaultstType Scubcs1306::bcs_absfaultst(
 // 'physical_unit': ''}
 Scu_bcs_1_306::Bcs_absactivestType Scubcs1306::bcs_absactivest(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<0, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_1_306::Bcs_absactivestType ret =
       static_cast<Scu_bcs_1_306::Bcs_absactivestType>(x);
@@ -186,8 +183,8 @@ Scu_bcs_1_306::Bcs_absactivestType Scubcs1306::bcs_absactivest(
 // 'physical_unit': ''}
 Scu_bcs_1_306::Bcs_faultstType Scubcs1306::bcs_faultst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_1_306::Bcs_faultstType ret =
       static_cast<Scu_bcs_1_306::Bcs_faultstType>(x);
@@ -201,8 +198,8 @@ Scu_bcs_1_306::Bcs_faultstType Scubcs1306::bcs_faultst(
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Scu_bcs_1_306::Bcs_drvmodeType Scubcs1306::bcs_drvmode(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(6, 2);
+  using Layout = SignalLayout<SignalPiece<0, 6, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_1_306::Bcs_drvmodeType ret =
       static_cast<Scu_bcs_1_306::Bcs_drvmodeType>(x);
@@ -16,14 +16,15 @@
 
 #include "modules/canbus/vehicle/ge3/protocol/scu_bcs_2_307.h"
 #include "glog/logging.h"
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace ge3 {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Scubcs2307::Scubcs2307() {}
 const int32_t Scubcs2307::ID = 0x307;
@@ -49,8 +50,8 @@ void Scubcs2307::Parse(const std::uint8_t* bytes, int32_t length,
 // 'physical_unit': '-'}
 Scu_bcs_2_307::Bcs_vehspdvdType Scubcs2307::bcs_vehspdvd(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<5, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_2_307::Bcs_vehspdvdType ret =
       static_cast<Scu_bcs_2_307::Bcs_vehspdvdType>(x);
@@ -63,13 +64,9 @@ Scu_bcs_2_307::Bcs_vehspdvdType Scubcs2307::bcs_vehspdvd(
 // 'motorola', 'physical_unit': 'rad/s'}
 double Scubcs2307::bcs_yawrate(const std::uint8_t* bytes,
                                int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 7);
-  int32_t t = t1.get_byte(4, 4);
-  x <<= 4;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<6, 0, 8>,
+                              SignalPiece<7, 4, 4>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.002133 + -2.224300;
   return ret;
@@ -80,13 +77,9 @@ double Scubcs2307::bcs_yawrate(const std::uint8_t* bytes,
 // 'physical_range': '[0|240]', 'bit': 39, 'type': 'double', 'order':
 // 'motorola', 'physical_unit': 'km/h'}
 double Scubcs2307::bcs_vehspd(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(3, 5);
-  x <<= 5;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 3, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.056250 / 3.6;  // modified by 20181211 , change km/h to m/s
   return ret;
@@ -98,13 +91,9 @@ double Scubcs2307::bcs_vehspd(const std::uint8_t* bytes, int32_t length) const {
 // 'type': 'double', 'order': 'motorola', 'physical_unit': 'm/s^2'}
 double Scubcs2307::bcs_vehlongaccel(const std::uint8_t* bytes,
                                     int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(4, 4);
-  x <<= 4;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 4, 4>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.027127 + -21.593000;
   return ret;
@@ -116,13 +105,9 @@ double Scubcs2307::bcs_vehlongaccel(const std::uint8_t* bytes,
 // 'type': 'double', 'order': 'motorola', 'physical_unit': 'm/s^2'}
 double Scubcs2307::bcs_vehlataccel(const std::uint8_t* bytes,
                                    int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(4, 4);
-  x <<= 4;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 4, 4>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.027127 + -21.593000;
   return ret;
@@ -16,14 +16,15 @@
 
 #include "modules/canbus/vehicle/ge3/protocol/scu_bcs_3_308.h"
 #include "glog/logging.h"
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace ge3 {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Scubcs3308::Scubcs3308() {}
 const int32_t Scubcs3308::ID = 0x308;
@@ -71,8 +72,8 @@ void Scubcs3308::Parse(const std::uint8_t* bytes, int32_t length,
 // 'order': 'motorola', 'physical_unit': '-'}
 Scu_bcs_3_308::Bcs_rrwheelspdvdType Scubcs3308::bcs_rrwheelspdvd(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<7, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_3_308::Bcs_rrwheelspdvdType ret =
       static_cast<Scu_bcs_3_308::Bcs_rrwheelspdvdType>(x);
@@ -87,8 +88,8 @@ Scu_bcs_3_308::Bcs_rrwheelspdvdType Scubcs3308::bcs_rrwheelspdvd(
 // 'physical_unit': '-'}
 Scu_bcs_3_308::Bcs_rrwheeldirectionvdType Scubcs3308::bcs_rrwheeldirectionvd(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<7, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_3_308::Bcs_rrwheeldirectionvdType ret =
       static_cast<Scu_bcs_3_308::Bcs_rrwheeldirectionvdType>(x);
@@ -102,8 +103,8 @@ Scu_bcs_3_308::Bcs_rrwheeldirectionvdType Scubcs3308::bcs_rrwheeldirectionvd(
 // 'order': 'motorola', 'physical_unit': '-'}
 Scu_bcs_3_308::Bcs_rlwheelspdvdType Scubcs3308::bcs_rlwheelspdvd(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<5, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_3_308::Bcs_rlwheelspdvdType ret =
       static_cast<Scu_bcs_3_308::Bcs_rlwheelspdvdType>(x);
@@ -118,8 +119,8 @@ Scu_bcs_3_308::Bcs_rlwheelspdvdType Scubcs3308::bcs_rlwheelspdvd(
 // 'physical_unit': '-'}
 Scu_bcs_3_308::Bcs_rlwheeldirectionvdType Scubcs3308::bcs_rlwheeldirectionvd(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<5, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_3_308::Bcs_rlwheeldirectionvdType ret =
       static_cast<Scu_bcs_3_308::Bcs_rlwheeldirectionvdType>(x);
@@ -133,8 +134,8 @@ Scu_bcs_3_308::Bcs_rlwheeldirectionvdType Scubcs3308::bcs_rlwheeldirectionvd(
 // 'order': 'motorola', 'physical_unit': '-'}
 Scu_bcs_3_308::Bcs_frwheelspdvdType Scubcs3308::bcs_frwheelspdvd(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<3, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_3_308::Bcs_frwheelspdvdType ret =
       static_cast<Scu_bcs_3_308::Bcs_frwheelspdvdType>(x);
@@ -149,8 +150,8 @@ Scu_bcs_3_308::Bcs_frwheelspdvdType Scubcs3308::bcs_frwheelspdvd(
 // 'physical_unit': '-'}
 Scu_bcs_3_308::Bcs_frwheeldirectionvdType Scubcs3308::bcs_frwheeldirectionvd(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<3, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_3_308::Bcs_frwheeldirectionvdType ret =
       static_cast<Scu_bcs_3_308::Bcs_frwheeldirectionvdType>(x);
@@ -164,8 +165,8 @@ Scu_bcs_3_308::Bcs_frwheeldirectionvdType Scubcs3308::bcs_frwheeldirectionvd(
 // 'order': 'motorola', 'physical_unit': '-'}
 Scu_bcs_3_308::Bcs_flwheelspdvdType Scubcs3308::bcs_flwheelspdvd(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<1, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_3_308::Bcs_flwheelspdvdType ret =
       static_cast<Scu_bcs_3_308::Bcs_flwheelspdvdType>(x);
@@ -180,8 +181,8 @@ Scu_bcs_3_308::Bcs_flwheelspdvdType Scubcs3308::bcs_flwheelspdvd(
 // 'physical_unit': '-'}
 Scu_bcs_3_308::Bcs_flwheeldirectionvdType Scubcs3308::bcs_flwheeldirectionvd(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<1, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_3_308::Bcs_flwheeldirectionvdType ret =
       static_cast<Scu_bcs_3_308::Bcs_flwheeldirectionvdType>(x);
@@ -194,13 +195,9 @@ Scu_bcs_3_308::Bcs_flwheeldirectionvdType Scubcs3308::bcs_flwheeldirectionvd(
 // 'motorola', 'physical_unit': 'km/h'}
 double Scubcs3308::bcs_rrwheelspd(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 7);
-  int32_t t = t1.get_byte(3, 5);
-  x <<= 5;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<6, 0, 8>,
+                              SignalPiece<7, 3, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.056250;
   return ret;
@@ -213,8 +210,8 @@ double Scubcs3308::bcs_rrwheelspd(const std::uint8_t* bytes,
 // 'order': 'motorola', 'physical_unit': '-'}
 Scu_bcs_3_308::Bcs_rrwheeldirectionType Scubcs3308::bcs_rrwheeldirection(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<7, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_3_308::Bcs_rrwheeldirectionType ret =
       static_cast<Scu_bcs_3_308::Bcs_rrwheeldirectionType>(x);
@@ -227,13 +224,9 @@ Scu_bcs_3_308::Bcs_rrwheeldirectionType Scubcs3308::bcs_rrwheeldirection(
 // 'motorola', 'physical_unit': 'km/h'}
 double Scubcs3308::bcs_rlwheelspd(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(3, 5);
-  x <<= 5;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 3, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.056250;
   return ret;
@@ -246,8 +239,8 @@ double Scubcs3308::bcs_rlwheelspd(const std::uint8_t* bytes,
 // 'order': 'motorola', 'physical_unit': '-'}
 Scu_bcs_3_308::Bcs_rlwheeldirectionType Scubcs3308::bcs_rlwheeldirection(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<5, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_3_308::Bcs_rlwheeldirectionType ret =
       static_cast<Scu_bcs_3_308::Bcs_rlwheeldirectionType>(x);
@@ -260,13 +253,9 @@ Scu_bcs_3_308::Bcs_rlwheeldirectionType Scubcs3308::bcs_rlwheeldirection(
 // 'motorola', 'physical_unit': 'km/h'}
 double Scubcs3308::bcs_frwheelspd(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(3, 5);
-  x <<= 5;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 3, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.056250;
   return ret;
@@ -279,8 +268,8 @@ double Scubcs3308::bcs_frwheelspd(const std::uint8_t* bytes,
 // 'order': 'motorola', 'physical_unit': '-'}
 Scu_bcs_3_308::Bcs_frwheeldirectionType Scubcs3308::bcs_frwheeldirection(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<3, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_3_308::Bcs_frwheeldirectionType ret =
       static_cast<Scu_bcs_3_308::Bcs_frwheeldirectionType>(x);
@@ -293,13 +282,9 @@ Scu_bcs_3_308::Bcs_frwheeldirectionType Scubcs3308::bcs_frwheeldirection(
 // 'motorola', 'physical_unit': 'km/h'}
 double Scubcs3308::bcs_flwheelspd(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(3, 5);
-  x <<= 5;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 3, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.056250;
   return ret;
@@ -312,8 +297,8 @@ double Scubcs3308::bcs_flwheelspd(const std::uint8_t* bytes,
 // 'order': 'motorola', 'physical_unit': '-'}
 Scu_bcs_3_308::Bcs_flwheeldirectionType Scubcs3308::bcs_flwheeldirection(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<1, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_bcs_3_308::Bcs_flwheeldirectionType ret =
       static_cast<Scu_bcs_3_308::Bcs_flwheeldirectionType>(x);
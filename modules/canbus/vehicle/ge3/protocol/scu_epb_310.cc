@@ -16,14 +16,15 @@
 
 #include "modules/canbus/vehicle/ge3/protocol/scu_epb_310.h"
 #include "glog/logging.h"
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace ge3 {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Scuepb310::Scuepb310() {}
 const int32_t Scuepb310::ID = 0x310;
@@ -47,8 +48,8 @@ void Scuepb310::Parse(const std::uint8_t* bytes, int32_t length,
 // 'motorola', 'physical_unit': ''}
 Scu_epb_310::Epb_intidxType Scuepb310::epb_intidx(const std::uint8_t* bytes,
                                                   int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 3);
+  using Layout = SignalLayout<SignalPiece<1, 0, 3>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_epb_310::Epb_intidxType ret = static_cast<Scu_epb_310::Epb_intidxType>(x);
   return ret;
@@ -61,8 +62,8 @@ Scu_epb_310::Epb_intidxType Scuepb310::epb_intidx(const std::uint8_t* bytes,
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Scu_epb_310::Epb_drvmodeType Scuepb310::epb_drvmode(const std::uint8_t* bytes,
                                                     int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 2);
+  using Layout = SignalLayout<SignalPiece<0, 5, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_epb_310::Epb_drvmodeType ret =
       static_cast<Scu_epb_310::Epb_drvmodeType>(x);
@@ -77,8 +78,8 @@ Scu_epb_310::Epb_drvmodeType Scuepb310::epb_drvmode(const std::uint8_t* bytes,
 // 'motorola', 'physical_unit': ''}
 Scu_epb_310::Epb_sysstType Scuepb310::epb_sysst(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 3);
+  using Layout = SignalLayout<SignalPiece<0, 0, 3>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_epb_310::Epb_sysstType ret = static_cast<Scu_epb_310::Epb_sysstType>(x);
   return ret;
@@ -91,8 +92,8 @@ Scu_epb_310::Epb_sysstType Scuepb310::epb_sysst(const std::uint8_t* bytes,
 // 'physical_unit': ''}
 Scu_epb_310::Epb_faultstType Scuepb310::epb_faultst(const std::uint8_t* bytes,
                                                     int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(7, 1);
+  using Layout = SignalLayout<SignalPiece<0, 7, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_epb_310::Epb_faultstType ret =
       static_cast<Scu_epb_310::Epb_faultstType>(x);
@@ -16,14 +16,15 @@
 
 #include "modules/canbus/vehicle/ge3/protocol/scu_eps_311.h"
 #include "glog/logging.h"
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace ge3 {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Scueps311::Scueps311() {}
 const int32_t Scueps311::ID = 0x311;
@@ -52,8 +53,8 @@ void Scueps311::Parse(const std::uint8_t* bytes, int32_t length,
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Scu_eps_311::Eps_intidxType Scueps311::eps_intidx(const std::uint8_t* bytes,
                                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 3);
+  using Layout = SignalLayout<SignalPiece<0, 4, 3>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_eps_311::Eps_intidxType ret = static_cast<Scu_eps_311::Eps_intidxType>(x);
   return ret;
@@ -65,8 +66,8 @@ Scu_eps_311::Eps_intidxType Scueps311::eps_intidx(const std::uint8_t* bytes,
 // 'motorola', 'physical_unit': 'deg/s'}
 double Scueps311::eps_steeranglespd(const std::uint8_t* bytes,
                                     int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 4.000000;
   return ret;
@@ -78,13 +79,9 @@ double Scueps311::eps_steeranglespd(const std::uint8_t* bytes,
 // 'double', 'order': 'motorola', 'physical_unit': 'deg'}
 double Scueps311::eps_steerangle(const std::uint8_t* bytes,
                                  int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.100000 + -780.000000;
   return ret;
@@ -97,8 +94,8 @@ double Scueps311::eps_steerangle(const std::uint8_t* bytes,
 // 'physical_unit': ''}
 Scu_eps_311::Eps_faultstType Scueps311::eps_faultst(const std::uint8_t* bytes,
                                                     int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(7, 1);
+  using Layout = SignalLayout<SignalPiece<0, 7, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_eps_311::Eps_faultstType ret =
       static_cast<Scu_eps_311::Eps_faultstType>(x);
@@ -112,8 +109,8 @@ Scu_eps_311::Eps_faultstType Scueps311::eps_faultst(const std::uint8_t* bytes,
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Scu_eps_311::Eps_drvmodeType Scueps311::eps_drvmode(const std::uint8_t* bytes,
                                                     int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 2);
+  using Layout = SignalLayout<SignalPiece<0, 0, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_eps_311::Eps_drvmodeType ret =
       static_cast<Scu_eps_311::Eps_drvmodeType>(x);
@@ -16,14 +16,15 @@
 
 #include "modules/canbus/vehicle/ge3/protocol/scu_vcu_1_312.h"
 #include "glog/logging.h"
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace ge3 {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Scuvcu1312::Scuvcu1312() {}
 const int32_t Scuvcu1312::ID = 0x312;
@@ -72,8 +73,8 @@ void Scuvcu1312::Parse(const std::uint8_t* bytes, int32_t length,
 // 'physical_unit': ''}
 Scu_vcu_1_312::Vcu_elcsysfaultType Scuvcu1312::vcu_elcsysfault(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<6, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_vcu_1_312::Vcu_elcsysfaultType ret =
       static_cast<Scu_vcu_1_312::Vcu_elcsysfaultType>(x);
@@ -87,8 +88,8 @@ Scu_vcu_1_312::Vcu_elcsysfaultType Scuvcu1312::vcu_elcsysfault(
 // 'physical_unit': ''}
 Scu_vcu_1_312::Vcu_brkpedstType Scuvcu1312::vcu_brkpedst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<6, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_vcu_1_312::Vcu_brkpedstType ret =
       static_cast<Scu_vcu_1_312::Vcu_brkpedstType>(x);
@@ -103,8 +104,8 @@ Scu_vcu_1_312::Vcu_brkpedstType Scuvcu1312::vcu_brkpedst(
 // 'motorola', 'physical_unit': ''}
 Scu_vcu_1_312::Vcu_intidxType Scuvcu1312::vcu_intidx(const std::uint8_t* bytes,
                                                      int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(0, 3);
+  using Layout = SignalLayout<SignalPiece<7, 0, 3>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_vcu_1_312::Vcu_intidxType ret =
       static_cast<Scu_vcu_1_312::Vcu_intidxType>(x);
@@ -118,8 +119,8 @@ Scu_vcu_1_312::Vcu_intidxType Scuvcu1312::vcu_intidx(const std::uint8_t* bytes,
 // '[0|7]', 'bit': 61, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Scu_vcu_1_312::Vcu_gearintidxType Scuvcu1312::vcu_gearintidx(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(3, 3);
+  using Layout = SignalLayout<SignalPiece<7, 3, 3>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_vcu_1_312::Vcu_gearintidxType ret =
       static_cast<Scu_vcu_1_312::Vcu_gearintidxType>(x);
@@ -134,8 +135,8 @@ Scu_vcu_1_312::Vcu_gearintidxType Scuvcu1312::vcu_gearintidx(
 // 'physical_unit': ''}
 Scu_vcu_1_312::Vcu_geardrvmodeType Scuvcu1312::vcu_geardrvmode(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(6, 2);
+  using Layout = SignalLayout<SignalPiece<7, 6, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_vcu_1_312::Vcu_geardrvmodeType ret =
       static_cast<Scu_vcu_1_312::Vcu_geardrvmodeType>(x);
@@ -148,13 +149,9 @@ Scu_vcu_1_312::Vcu_geardrvmodeType Scuvcu1312::vcu_geardrvmode(
 // 'double', 'order': 'motorola', 'physical_unit': '%'}
 double Scuvcu1312::vcu_accpedact(const std::uint8_t* bytes,
                                  int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 6);
-  int32_t t = t1.get_byte(4, 4);
-  x <<= 4;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<5, 0, 8>,
+                              SignalPiece<6, 4, 4>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.050000;
   return ret;
@@ -166,8 +163,8 @@ double Scuvcu1312::vcu_accpedact(const std::uint8_t* bytes,
 // 'motorola', 'physical_unit': '%'}
 double Scuvcu1312::vcu_brkpedpst(const std::uint8_t* bytes,
                                  int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.392000;
   return ret;
@@ -178,13 +175,9 @@ double Scuvcu1312::vcu_brkpedpst(const std::uint8_t* bytes,
 // '[0|1000]', 'bit': 9, 'type': 'int', 'order': 'motorola', 'physical_unit':
 // 'km'}
 int Scuvcu1312::vcu_vehrng(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 2);
-
-  Byte t1(bytes + 2);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<1, 0, 2>,
+                              SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -196,8 +189,8 @@ int Scuvcu1312::vcu_vehrng(const std::uint8_t* bytes, int32_t length) const {
 // 'double', 'order': 'motorola', 'physical_unit': '%'}
 double Scuvcu1312::vcu_accpedpst(const std::uint8_t* bytes,
                                  int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.392000;
   return ret;
@@ -210,8 +203,8 @@ double Scuvcu1312::vcu_accpedpst(const std::uint8_t* bytes,
 // 'physical_unit': ''}
 Scu_vcu_1_312::Vcu_vehrdystType Scuvcu1312::vcu_vehrdyst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_vcu_1_312::Vcu_vehrdystType ret =
       static_cast<Scu_vcu_1_312::Vcu_vehrdystType>(x);
@@ -226,8 +219,8 @@ Scu_vcu_1_312::Vcu_vehrdystType Scuvcu1312::vcu_vehrdyst(
 // 'motorola', 'physical_unit': ''}
 Scu_vcu_1_312::Vcu_faultstType Scuvcu1312::vcu_faultst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 4);
+  using Layout = SignalLayout<SignalPiece<0, 2, 4>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_vcu_1_312::Vcu_faultstType ret =
       static_cast<Scu_vcu_1_312::Vcu_faultstType>(x);
@@ -241,8 +234,8 @@ Scu_vcu_1_312::Vcu_faultstType Scuvcu1312::vcu_faultst(
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Scu_vcu_1_312::Vcu_drvmodeType Scuvcu1312::vcu_drvmode(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(6, 2);
+  using Layout = SignalLayout<SignalPiece<0, 6, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_vcu_1_312::Vcu_drvmodeType ret =
       static_cast<Scu_vcu_1_312::Vcu_drvmodeType>(x);
@@ -257,8 +250,8 @@ Scu_vcu_1_312::Vcu_drvmodeType Scuvcu1312::vcu_drvmode(
 // 'physical_unit': ''}
 Scu_vcu_1_312::Vcu_gearpstType Scuvcu1312::vcu_gearpst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(2, 3);
+  using Layout = SignalLayout<SignalPiece<1, 2, 3>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_vcu_1_312::Vcu_gearpstType ret =
       static_cast<Scu_vcu_1_312::Vcu_gearpstType>(x);
@@ -272,8 +265,8 @@ Scu_vcu_1_312::Vcu_gearpstType Scuvcu1312::vcu_gearpst(
 // 'physical_unit': ''}
 Scu_vcu_1_312::Vcu_gearfaultstType Scuvcu1312::vcu_gearfaultst(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_vcu_1_312::Vcu_gearfaultstType ret =
       static_cast<Scu_vcu_1_312::Vcu_gearfaultstType>(x);
@@ -288,8 +281,8 @@ Scu_vcu_1_312::Vcu_gearfaultstType Scuvcu1312::vcu_gearfaultst(
 // 'physical_unit': ''}
 Scu_vcu_1_312::Vcu_gearactType Scuvcu1312::vcu_gearact(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(5, 3);
+  using Layout = SignalLayout<SignalPiece<1, 5, 3>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Scu_vcu_1_312::Vcu_gearactType ret =
       static_cast<Scu_vcu_1_312::Vcu_gearactType>(x);
@@ -16,14 +16,15 @@
 
 #include "modules/canbus/vehicle/ge3/protocol/scu_vcu_2_313.h"
 #include "glog/logging.h"
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace ge3 {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Scuvcu2313::Scuvcu2313() {}
 const int32_t Scuvcu2313::ID = 0x313;
@@ -46,13 +47,9 @@ void Scuvcu2313::Parse(const std::uint8_t* bytes, int32_t length,
 // 'motorola', 'physical_unit': 'Nm'}
 double Scuvcu2313::vcu_torqposmax(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 7);
-  int32_t t = t1.get_byte(5, 3);
-  x <<= 3;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<6, 0, 8>,
+                              SignalPiece<7, 5, 3>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 1.500000;
   return ret;
@@ -64,13 +61,9 @@ double Scuvcu2313::vcu_torqposmax(const std::uint8_t* bytes,
 // 'motorola', 'physical_unit': 'Nm'}
 double Scuvcu2313::vcu_torqnegmax(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(5, 3);
-  x <<= 3;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 5, 3>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 1.500000 + -3000.000000;
   return ret;
@@ -82,13 +75,9 @@ double Scuvcu2313::vcu_torqnegmax(const std::uint8_t* bytes,
 // 'motorola', 'physical_unit': 'Nm'}
 double Scuvcu2313::vcu_torqact(const std::uint8_t* bytes,
                                int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(4, 4);
-  x <<= 4;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 4, 4>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 1.500000 + -3000.000000;
   return ret;
@@ -99,13 +88,9 @@ double Scuvcu2313::vcu_torqact(const std::uint8_t* bytes,
 // 'physical_range': '[0|65535]', 'bit': 7, 'type': 'int', 'order': 'motorola',
 // 'physical_unit': 'rpm'}
 int Scuvcu2313::vcu_engspd(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
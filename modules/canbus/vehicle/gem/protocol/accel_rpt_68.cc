@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace gem {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Accelrpt68::Accelrpt68() {}
 const int32_t Accelrpt68::ID = 0x68;
@@ -45,13 +46,9 @@ void Accelrpt68::Parse(const std::uint8_t* bytes, int32_t length,
 // 'type': 'double', 'order': 'motorola', 'physical_unit': '%'}
 double Accelrpt68::manual_input(const std::uint8_t* bytes,
                                 int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -62,13 +59,9 @@ double Accelrpt68::manual_input(const std::uint8_t* bytes,
 // 'type': 'double', 'order': 'motorola', 'physical_unit': '%'}
 double Accelrpt68::commanded_value(const std::uint8_t* bytes,
                                    int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -79,13 +72,9 @@ double Accelrpt68::commanded_value(const std::uint8_t* bytes,
 // 'type': 'double', 'order': 'motorola', 'physical_unit': '%'}
 double Accelrpt68::output_value(const std::uint8_t* bytes,
                                 int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.001000;
   return ret;
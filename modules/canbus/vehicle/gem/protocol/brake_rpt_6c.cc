@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace gem {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Brakerpt6c::Brakerpt6c() {}
 const int32_t Brakerpt6c::ID = 0x6C;
@@ -47,13 +48,9 @@ void Brakerpt6c::Parse(const std::uint8_t* bytes, int32_t length,
 // 'type': 'double', 'order': 'motorola', 'physical_unit': '%'}
 double Brakerpt6c::manual_input(const std::uint8_t* bytes,
                                 int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -64,13 +61,9 @@ double Brakerpt6c::manual_input(const std::uint8_t* bytes,
 // 'type': 'double', 'order': 'motorola', 'physical_unit': '%'}
 double Brakerpt6c::commanded_value(const std::uint8_t* bytes,
                                    int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -81,13 +74,9 @@ double Brakerpt6c::commanded_value(const std::uint8_t* bytes,
 // 'type': 'double', 'order': 'motorola', 'physical_unit': '%'}
 double Brakerpt6c::output_value(const std::uint8_t* bytes,
                                 int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -99,8 +88,8 @@ double Brakerpt6c::output_value(const std::uint8_t* bytes,
 // 'motorola', 'physical_unit': ''}
 Brake_rpt_6c::Brake_on_offType Brakerpt6c::brake_on_off(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<6, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Brake_rpt_6c::Brake_on_offType ret =
       static_cast<Brake_rpt_6c::Brake_on_offType>(x);
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace gem {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Globalrpt6a::Globalrpt6a() {}
 const int32_t Globalrpt6a::ID = 0x6A;
@@ -55,8 +56,8 @@ void Globalrpt6a::Parse(const std::uint8_t* bytes, int32_t length,
 // 'physical_unit': ''}
 Global_rpt_6a::Pacmod_statusType Globalrpt6a::pacmod_status(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Global_rpt_6a::Pacmod_statusType ret =
       static_cast<Global_rpt_6a::Pacmod_statusType>(x);
@@ -70,8 +71,8 @@ Global_rpt_6a::Pacmod_statusType Globalrpt6a::pacmod_status(
 // 'physical_unit': ''}
 Global_rpt_6a::Override_statusType Globalrpt6a::override_status(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Global_rpt_6a::Override_statusType ret =
       static_cast<Global_rpt_6a::Override_statusType>(x);
@@ -83,8 +84,8 @@ Global_rpt_6a::Override_statusType Globalrpt6a::override_status(
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Globalrpt6a::veh_can_timeout(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -95,8 +96,8 @@ bool Globalrpt6a::veh_can_timeout(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Globalrpt6a::str_can_timeout(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -109,8 +110,8 @@ bool Globalrpt6a::str_can_timeout(const std::uint8_t* bytes,
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Global_rpt_6a::Brk_can_timeoutType Globalrpt6a::brk_can_timeout(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<0, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Global_rpt_6a::Brk_can_timeoutType ret =
       static_cast<Global_rpt_6a::Brk_can_timeoutType>(x);
@@ -122,8 +123,8 @@ Global_rpt_6a::Brk_can_timeoutType Globalrpt6a::brk_can_timeout(
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Globalrpt6a::usr_can_timeout(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -135,13 +136,9 @@ bool Globalrpt6a::usr_can_timeout(const std::uint8_t* bytes,
 // ''}
 int Globalrpt6a::usr_can_read_errors(const std::uint8_t* bytes,
                                      int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 7);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<6, 0, 8>,
+                              SignalPiece<7, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
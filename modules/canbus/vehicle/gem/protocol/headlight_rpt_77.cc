@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace gem {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Headlightrpt77::Headlightrpt77() {}
 const int32_t Headlightrpt77::ID = 0x77;
@@ -47,8 +48,8 @@ void Headlightrpt77::Parse(const std::uint8_t* bytes, int32_t length,
 // 'order': 'motorola', 'physical_unit': ''}
 Headlight_rpt_77::Output_valueType Headlightrpt77::output_value(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Headlight_rpt_77::Output_valueType ret =
       static_cast<Headlight_rpt_77::Output_valueType>(x);
@@ -62,8 +63,8 @@ Headlight_rpt_77::Output_valueType Headlightrpt77::output_value(
 // 'order': 'motorola', 'physical_unit': ''}
 Headlight_rpt_77::Manual_inputType Headlightrpt77::manual_input(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Headlight_rpt_77::Manual_inputType ret =
       static_cast<Headlight_rpt_77::Manual_inputType>(x);
@@ -77,8 +78,8 @@ Headlight_rpt_77::Manual_inputType Headlightrpt77::manual_input(
 // 'order': 'motorola', 'physical_unit': ''}
 Headlight_rpt_77::Commanded_valueType Headlightrpt77::commanded_value(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Headlight_rpt_77::Commanded_valueType ret =
       static_cast<Headlight_rpt_77::Commanded_valueType>(x);
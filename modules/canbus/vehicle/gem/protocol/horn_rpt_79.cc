@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace gem {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Hornrpt79::Hornrpt79() {}
 const int32_t Hornrpt79::ID = 0x79;
@@ -46,8 +47,8 @@ void Hornrpt79::Parse(const std::uint8_t* bytes, int32_t length,
 // 'motorola', 'physical_unit': ''}
 Horn_rpt_79::Output_valueType Hornrpt79::output_value(const std::uint8_t* bytes,
                                                       int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Horn_rpt_79::Output_valueType ret =
       static_cast<Horn_rpt_79::Output_valueType>(x);
@@ -60,8 +61,8 @@ Horn_rpt_79::Output_valueType Hornrpt79::output_value(const std::uint8_t* bytes,
 // 'motorola', 'physical_unit': ''}
 Horn_rpt_79::Commanded_valueType Hornrpt79::commanded_value(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Horn_rpt_79::Commanded_valueType ret =
       static_cast<Horn_rpt_79::Commanded_valueType>(x);
@@ -74,8 +75,8 @@ Horn_rpt_79::Commanded_valueType Hornrpt79::commanded_value(
 // 'motorola', 'physical_unit': ''}
 Horn_rpt_79::Manual_inputType Hornrpt79::manual_input(const std::uint8_t* bytes,
                                                       int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Horn_rpt_79::Manual_inputType ret =
       static_cast<Horn_rpt_79::Manual_inputType>(x);
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace gem {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Shiftrpt66::Shiftrpt66() {}
 const int32_t Shiftrpt66::ID = 0x66;
@@ -47,8 +48,8 @@ void Shiftrpt66::Parse(const std::uint8_t* bytes, int32_t length,
 // 'motorola', 'physical_unit': ''}
 Shift_rpt_66::Manual_inputType Shiftrpt66::manual_input(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Shift_rpt_66::Manual_inputType ret =
       static_cast<Shift_rpt_66::Manual_inputType>(x);
@@ -63,8 +64,8 @@ Shift_rpt_66::Manual_inputType Shiftrpt66::manual_input(
 // 'motorola', 'physical_unit': ''}
 Shift_rpt_66::Commanded_valueType Shiftrpt66::commanded_value(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Shift_rpt_66::Commanded_valueType ret =
       static_cast<Shift_rpt_66::Commanded_valueType>(x);
@@ -78,8 +79,8 @@ Shift_rpt_66::Commanded_valueType Shiftrpt66::commanded_value(
 // 'motorola', 'physical_unit': ''}
 Shift_rpt_66::Output_valueType Shiftrpt66::output_value(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Shift_rpt_66::Output_valueType ret =
       static_cast<Shift_rpt_66::Output_valueType>(x);
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace gem {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Turnrpt64::Turnrpt64() {}
 const int32_t Turnrpt64::ID = 0x64;
@@ -47,8 +48,8 @@ void Turnrpt64::Parse(const std::uint8_t* bytes, int32_t length,
 // 'physical_unit': ''}
 Turn_rpt_64::Manual_inputType Turnrpt64::manual_input(const std::uint8_t* bytes,
                                                       int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Turn_rpt_64::Manual_inputType ret =
       static_cast<Turn_rpt_64::Manual_inputType>(x);
@@ -62,8 +63,8 @@ Turn_rpt_64::Manual_inputType Turnrpt64::manual_input(const std::uint8_t* bytes,
 // 'bit': 15, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Turn_rpt_64::Commanded_valueType Turnrpt64::commanded_value(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Turn_rpt_64::Commanded_valueType ret =
       static_cast<Turn_rpt_64::Commanded_valueType>(x);
@@ -77,8 +78,8 @@ Turn_rpt_64::Commanded_valueType Turnrpt64::commanded_value(
 // 'physical_unit': ''}
 Turn_rpt_64::Output_valueType Turnrpt64::output_value(const std::uint8_t* bytes,
                                                       int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Turn_rpt_64::Output_valueType ret =
       static_cast<Turn_rpt_64::Output_valueType>(x);
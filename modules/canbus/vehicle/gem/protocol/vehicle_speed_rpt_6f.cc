@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace gem {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Vehiclespeedrpt6f::Vehiclespeedrpt6f() {}
 const int32_t Vehiclespeedrpt6f::ID = 0x6F;
@@ -44,16 +45,9 @@ void Vehiclespeedrpt6f::Parse(const std::uint8_t* bytes, int32_t length,
 // 'bit': 7, 'type': 'double', 'order': 'motorola', 'physical_unit': 'm/s'}
 double Vehiclespeedrpt6f::vehicle_speed(const std::uint8_t* bytes,
                                         int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.010000;
   return ret;
@@ -67,8 +61,8 @@ double Vehiclespeedrpt6f::vehicle_speed(const std::uint8_t* bytes,
 Vehicle_speed_rpt_6f::Vehicle_speed_validType
 Vehiclespeedrpt6f::vehicle_speed_valid(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<2, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Vehicle_speed_rpt_6f::Vehicle_speed_validType ret =
       static_cast<Vehicle_speed_rpt_6f::Vehicle_speed_validType>(x);
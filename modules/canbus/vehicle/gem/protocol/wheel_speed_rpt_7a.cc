@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace gem {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Wheelspeedrpt7a::Wheelspeedrpt7a() {}
 const int32_t Wheelspeedrpt7a::ID = 0x7A;
@@ -51,16 +52,9 @@ void Wheelspeedrpt7a::Parse(const std::uint8_t* bytes, int32_t length,
 // 'physical_unit': 'rad/s'}
 int Wheelspeedrpt7a::wheel_spd_rear_right(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 7);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<6, 0, 8>,
+                              SignalPiece<7, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   int ret = x;
   return ret;
@@ -72,16 +66,9 @@ int Wheelspeedrpt7a::wheel_spd_rear_right(const std::uint8_t* bytes,
 // 'physical_unit': 'rad/s'}
 int Wheelspeedrpt7a::wheel_spd_rear_left(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   int ret = x;
   return ret;
@@ -93,16 +80,9 @@ int Wheelspeedrpt7a::wheel_spd_rear_left(const std::uint8_t* bytes,
 // 'physical_unit': 'rad/s'}
 int Wheelspeedrpt7a::wheel_spd_front_right(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   int ret = x;
   return ret;
@@ -114,16 +94,9 @@ int Wheelspeedrpt7a::wheel_spd_front_right(const std::uint8_t* bytes,
 // 'physical_unit': 'rad/s'}
 int Wheelspeedrpt7a::wheel_spd_front_left(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   int ret = x;
   return ret;
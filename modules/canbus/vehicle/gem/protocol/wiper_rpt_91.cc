@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace gem {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Wiperrpt91::Wiperrpt91() {}
 const int32_t Wiperrpt91::ID = 0x91;
@@ -49,8 +50,8 @@ void Wiperrpt91::Parse(const std::uint8_t* bytes, int32_t length,
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Wiper_rpt_91::Output_valueType Wiperrpt91::output_value(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Wiper_rpt_91::Output_valueType ret =
       static_cast<Wiper_rpt_91::Output_valueType>(x);
@@ -66,8 +67,8 @@ Wiper_rpt_91::Output_valueType Wiperrpt91::output_value(
 // 15, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Wiper_rpt_91::Commanded_valueType Wiperrpt91::commanded_value(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Wiper_rpt_91::Commanded_valueType ret =
       static_cast<Wiper_rpt_91::Commanded_valueType>(x);
@@ -83,8 +84,8 @@ Wiper_rpt_91::Commanded_valueType Wiperrpt91::commanded_value(
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Wiper_rpt_91::Manual_inputType Wiperrpt91::manual_input(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Wiper_rpt_91::Manual_inputType ret =
       static_cast<Wiper_rpt_91::Manual_inputType>(x);
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Accelauxrpt300::Accelauxrpt300() {}
 const int32_t Accelauxrpt300::ID = 0x300;
@@ -54,8 +55,8 @@ void Accelauxrpt300::Parse(const std::uint8_t* bytes, int32_t length,
 // '[0|1]', 'bit': 42, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Accelauxrpt300::user_interaction_is_valid(const std::uint8_t* bytes,
                                                int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<5, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -66,8 +67,8 @@ bool Accelauxrpt300::user_interaction_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Accelauxrpt300::user_interaction(const std::uint8_t* bytes,
                                       int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<4, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -78,8 +79,8 @@ bool Accelauxrpt300::user_interaction(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 41, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Accelauxrpt300::raw_pedal_force_is_valid(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<5, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -90,16 +91,9 @@ bool Accelauxrpt300::raw_pedal_force_is_valid(const std::uint8_t* bytes,
 // 'bit': 23, 'type': 'double', 'order': 'motorola', 'physical_unit': ''}
 double Accelauxrpt300::raw_pedal_force(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -110,8 +104,8 @@ double Accelauxrpt300::raw_pedal_force(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 40, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Accelauxrpt300::raw_pedal_pos_is_valid(const std::uint8_t* bytes,
                                             int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<5, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -122,16 +116,9 @@ bool Accelauxrpt300::raw_pedal_pos_is_valid(const std::uint8_t* bytes,
 // 'bit': 7, 'type': 'double', 'order': 'motorola', 'physical_unit': ''}
 double Accelauxrpt300::raw_pedal_pos(const std::uint8_t* bytes,
                                      int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Brakeauxrpt304::Brakeauxrpt304() {}
 const int32_t Brakeauxrpt304::ID = 0x304;
@@ -65,8 +66,8 @@ void Brakeauxrpt304::Parse(const std::uint8_t* bytes, int32_t length,
 // '[0|1]', 'bit': 60, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Brakeauxrpt304::brake_on_off_is_valid(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<7, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -77,8 +78,8 @@ bool Brakeauxrpt304::brake_on_off_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Brakeauxrpt304::brake_on_off(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<6, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -89,8 +90,8 @@ bool Brakeauxrpt304::brake_on_off(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 59, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Brakeauxrpt304::user_interaction_is_valid(const std::uint8_t* bytes,
                                                int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<7, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -101,8 +102,8 @@ bool Brakeauxrpt304::user_interaction_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Brakeauxrpt304::user_interaction(const std::uint8_t* bytes,
                                       int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<6, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -113,8 +114,8 @@ bool Brakeauxrpt304::user_interaction(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 58, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Brakeauxrpt304::raw_brake_pressure_is_valid(const std::uint8_t* bytes,
                                                  int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<7, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -126,16 +127,9 @@ bool Brakeauxrpt304::raw_brake_pressure_is_valid(const std::uint8_t* bytes,
 // 'physical_unit': ''}
 double Brakeauxrpt304::raw_brake_pressure(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x;
   return ret;
@@ -146,8 +140,8 @@ double Brakeauxrpt304::raw_brake_pressure(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 57, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Brakeauxrpt304::raw_pedal_force_is_valid(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<7, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -158,16 +152,9 @@ bool Brakeauxrpt304::raw_pedal_force_is_valid(const std::uint8_t* bytes,
 // 'bit': 23, 'type': 'double', 'order': 'motorola', 'physical_unit': ''}
 double Brakeauxrpt304::raw_pedal_force(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x;
   return ret;
@@ -178,8 +165,8 @@ double Brakeauxrpt304::raw_pedal_force(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 56, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Brakeauxrpt304::raw_pedal_pos_is_valid(const std::uint8_t* bytes,
                                             int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<7, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -190,16 +177,9 @@ bool Brakeauxrpt304::raw_pedal_pos_is_valid(const std::uint8_t* bytes,
 // 'bit': 7, 'type': 'double', 'order': 'motorola', 'physical_unit': ''}
 double Brakeauxrpt304::raw_pedal_pos(const std::uint8_t* bytes,
                                      int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Componentrpt20::Componentrpt20() {}
 const int32_t Componentrpt20::ID = 0x20;
@@ -51,8 +52,8 @@ void Componentrpt20::Parse(const std::uint8_t* bytes, int32_t length,
 // 'order': 'motorola', 'physical_unit': ''}
 Component_rpt_20::Component_typeType Componentrpt20::component_type(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Component_rpt_20::Component_typeType ret =
       static_cast<Component_rpt_20::Component_typeType>(x);
@@ -68,8 +69,8 @@ Component_rpt_20::Component_typeType Componentrpt20::component_type(
 // 'bit': 15, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Component_rpt_20::Component_funcType Componentrpt20::component_func(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Component_rpt_20::Component_funcType ret =
       static_cast<Component_rpt_20::Component_funcType>(x);
@@ -80,8 +81,8 @@ Component_rpt_20::Component_funcType Componentrpt20::component_func(
 // 'is_signed_var': False, 'physical_range': '[0|15]', 'bit': 19, 'type': 'int',
 // 'order': 'motorola', 'physical_unit': ''}
 int Componentrpt20::counter(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 4);
+  using Layout = SignalLayout<SignalPiece<2, 0, 4>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -92,8 +93,8 @@ int Componentrpt20::counter(const std::uint8_t* bytes, int32_t length) const {
 // 'int', 'order': 'motorola', 'physical_unit': ''}
 int Componentrpt20::complement(const std::uint8_t* bytes,
                                int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(4, 4);
+  using Layout = SignalLayout<SignalPiece<2, 4, 4>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -104,8 +105,8 @@ int Componentrpt20::complement(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Componentrpt20::config_fault(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<3, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
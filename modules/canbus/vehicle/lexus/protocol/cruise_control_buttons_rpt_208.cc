@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Cruisecontrolbuttonsrpt208::Cruisecontrolbuttonsrpt208() {}
 const int32_t Cruisecontrolbuttonsrpt208::ID = 0x208;
@@ -77,8 +78,8 @@ void Cruisecontrolbuttonsrpt208::Parse(const std::uint8_t* bytes,
 Cruise_control_buttons_rpt_208::Output_valueType
 Cruisecontrolbuttonsrpt208::output_value(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Cruise_control_buttons_rpt_208::Output_valueType ret =
       static_cast<Cruise_control_buttons_rpt_208::Output_valueType>(x);
@@ -97,8 +98,8 @@ Cruisecontrolbuttonsrpt208::output_value(const std::uint8_t* bytes,
 Cruise_control_buttons_rpt_208::Manual_inputType
 Cruisecontrolbuttonsrpt208::manual_input(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Cruise_control_buttons_rpt_208::Manual_inputType ret =
       static_cast<Cruise_control_buttons_rpt_208::Manual_inputType>(x);
@@ -118,8 +119,8 @@ Cruisecontrolbuttonsrpt208::manual_input(const std::uint8_t* bytes,
 Cruise_control_buttons_rpt_208::Commanded_valueType
 Cruisecontrolbuttonsrpt208::commanded_value(const std::uint8_t* bytes,
                                             int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Cruise_control_buttons_rpt_208::Commanded_valueType ret =
       static_cast<Cruise_control_buttons_rpt_208::Commanded_valueType>(x);
@@ -131,8 +132,8 @@ Cruisecontrolbuttonsrpt208::commanded_value(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Cruisecontrolbuttonsrpt208::vehicle_fault(const std::uint8_t* bytes,
                                                int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<0, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -143,8 +144,8 @@ bool Cruisecontrolbuttonsrpt208::vehicle_fault(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Cruisecontrolbuttonsrpt208::pacmod_fault(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -155,8 +156,8 @@ bool Cruisecontrolbuttonsrpt208::pacmod_fault(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Cruisecontrolbuttonsrpt208::override_active(const std::uint8_t* bytes,
                                                  int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -167,8 +168,8 @@ bool Cruisecontrolbuttonsrpt208::override_active(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 4, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Cruisecontrolbuttonsrpt208::output_reported_fault(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<0, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -179,8 +180,8 @@ bool Cruisecontrolbuttonsrpt208::output_reported_fault(
 // '[0|1]', 'bit': 3, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Cruisecontrolbuttonsrpt208::input_output_fault(const std::uint8_t* bytes,
                                                     int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -191,8 +192,8 @@ bool Cruisecontrolbuttonsrpt208::input_output_fault(const std::uint8_t* bytes,
 // 'order': 'motorola', 'physical_unit': ''}
 bool Cruisecontrolbuttonsrpt208::enabled(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -203,8 +204,8 @@ bool Cruisecontrolbuttonsrpt208::enabled(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 2, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Cruisecontrolbuttonsrpt208::command_output_fault(const std::uint8_t* bytes,
                                                       int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Dashcontrolsleftcmd10c::Dashcontrolsleftcmd10c() {}
 const int32_t Dashcontrolsleftcmd10c::ID = 0x10C;
@@ -53,8 +54,8 @@ void Dashcontrolsleftcmd10c::Parse(const std::uint8_t* bytes, int32_t length,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Dashcontrolsleftcmd10c::ignore_overrides(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -65,8 +66,8 @@ bool Dashcontrolsleftcmd10c::ignore_overrides(const std::uint8_t* bytes,
 // 'order': 'motorola', 'physical_unit': ''}
 bool Dashcontrolsleftcmd10c::enable(const std::uint8_t* bytes,
                                     int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -77,8 +78,8 @@ bool Dashcontrolsleftcmd10c::enable(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Dashcontrolsleftcmd10c::clear_override(const std::uint8_t* bytes,
                                             int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -89,8 +90,8 @@ bool Dashcontrolsleftcmd10c::clear_override(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Dashcontrolsleftcmd10c::clear_faults(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -108,8 +109,8 @@ bool Dashcontrolsleftcmd10c::clear_faults(const std::uint8_t* bytes,
 Dash_controls_left_cmd_10c::Dash_controls_buttonType
 Dashcontrolsleftcmd10c::dash_controls_button(const std::uint8_t* bytes,
                                              int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Dash_controls_left_cmd_10c::Dash_controls_buttonType ret =
       static_cast<Dash_controls_left_cmd_10c::Dash_controls_buttonType>(x);
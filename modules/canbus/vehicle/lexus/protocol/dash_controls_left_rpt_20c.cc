@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Dashcontrolsleftrpt20c::Dashcontrolsleftrpt20c() {}
 const int32_t Dashcontrolsleftrpt20c::ID = 0x20C;
@@ -73,8 +74,8 @@ void Dashcontrolsleftrpt20c::Parse(const std::uint8_t* bytes, int32_t length,
 Dash_controls_left_rpt_20c::Output_valueType
 Dashcontrolsleftrpt20c::output_value(const std::uint8_t* bytes,
                                      int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Dash_controls_left_rpt_20c::Output_valueType ret =
       static_cast<Dash_controls_left_rpt_20c::Output_valueType>(x);
@@ -91,8 +92,8 @@ Dashcontrolsleftrpt20c::output_value(const std::uint8_t* bytes,
 Dash_controls_left_rpt_20c::Commanded_valueType
 Dashcontrolsleftrpt20c::commanded_value(const std::uint8_t* bytes,
                                         int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Dash_controls_left_rpt_20c::Commanded_valueType ret =
       static_cast<Dash_controls_left_rpt_20c::Commanded_valueType>(x);
@@ -109,8 +110,8 @@ Dashcontrolsleftrpt20c::commanded_value(const std::uint8_t* bytes,
 Dash_controls_left_rpt_20c::Manual_inputType
 Dashcontrolsleftrpt20c::manual_input(const std::uint8_t* bytes,
                                      int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Dash_controls_left_rpt_20c::Manual_inputType ret =
       static_cast<Dash_controls_left_rpt_20c::Manual_inputType>(x);
@@ -122,8 +123,8 @@ Dashcontrolsleftrpt20c::manual_input(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Dashcontrolsleftrpt20c::vehicle_fault(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<0, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -134,8 +135,8 @@ bool Dashcontrolsleftrpt20c::vehicle_fault(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Dashcontrolsleftrpt20c::pacmod_fault(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -146,8 +147,8 @@ bool Dashcontrolsleftrpt20c::pacmod_fault(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Dashcontrolsleftrpt20c::override_active(const std::uint8_t* bytes,
                                              int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -158,8 +159,8 @@ bool Dashcontrolsleftrpt20c::override_active(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 4, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Dashcontrolsleftrpt20c::output_reported_fault(const std::uint8_t* bytes,
                                                    int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<0, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -170,8 +171,8 @@ bool Dashcontrolsleftrpt20c::output_reported_fault(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 3, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Dashcontrolsleftrpt20c::input_output_fault(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -182,8 +183,8 @@ bool Dashcontrolsleftrpt20c::input_output_fault(const std::uint8_t* bytes,
 // 'order': 'motorola', 'physical_unit': ''}
 bool Dashcontrolsleftrpt20c::enabled(const std::uint8_t* bytes,
                                      int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -194,8 +195,8 @@ bool Dashcontrolsleftrpt20c::enabled(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 2, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Dashcontrolsleftrpt20c::command_output_fault(const std::uint8_t* bytes,
                                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Datetimerpt40f::Datetimerpt40f() {}
 const int32_t Datetimerpt40f::ID = 0x40F;
@@ -51,8 +52,8 @@ void Datetimerpt40f::Parse(const std::uint8_t* bytes, int32_t length,
 // 'type': 'int', 'order': 'motorola', 'physical_unit': 'sec'}
 int Datetimerpt40f::time_second(const std::uint8_t* bytes,
                                 int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<5, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = static_cast<int>(x);
   return ret;
@@ -63,8 +64,8 @@ int Datetimerpt40f::time_second(const std::uint8_t* bytes,
 // 'type': 'int', 'order': 'motorola', 'physical_unit': 'min'}
 int Datetimerpt40f::time_minute(const std::uint8_t* bytes,
                                 int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = static_cast<int>(x);
   return ret;
@@ -74,8 +75,8 @@ int Datetimerpt40f::time_minute(const std::uint8_t* bytes,
 // 8, 'is_signed_var': False, 'physical_range': '[0|23]', 'bit': 31, 'type':
 // 'int', 'order': 'motorola', 'physical_unit': 'hr'}
 int Datetimerpt40f::time_hour(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -85,8 +86,8 @@ int Datetimerpt40f::time_hour(const std::uint8_t* bytes, int32_t length) const {
 // 8, 'is_signed_var': False, 'physical_range': '[1|31]', 'bit': 23, 'type':
 // 'int', 'order': 'motorola', 'physical_unit': 'dy'}
 int Datetimerpt40f::date_day(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x + 1;
   return ret;
@@ -97,8 +98,8 @@ int Datetimerpt40f::date_day(const std::uint8_t* bytes, int32_t length) const {
 // 'int', 'order': 'motorola', 'physical_unit': 'mon'}
 int Datetimerpt40f::date_month(const std::uint8_t* bytes,
                                int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x + 1;
   return ret;
@@ -108,8 +109,8 @@ int Datetimerpt40f::date_month(const std::uint8_t* bytes,
 // 'len': 8, 'is_signed_var': False, 'physical_range': '[2000|2255]', 'bit': 7,
 // 'type': 'int', 'order': 'motorola', 'physical_unit': 'yr'}
 int Datetimerpt40f::date_year(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x + 2000;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Doorrpt417::Doorrpt417() {}
 const int32_t Doorrpt417::ID = 0x417;
@@ -72,8 +73,8 @@ void Doorrpt417::Parse(const std::uint8_t* bytes, int32_t length,
 // '[0|1]', 'bit': 14, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::fuel_door_open_is_valid(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<1, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -84,8 +85,8 @@ bool Doorrpt417::fuel_door_open_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 13, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::trunk_open_is_valid(const std::uint8_t* bytes,
                                      int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<1, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -96,8 +97,8 @@ bool Doorrpt417::trunk_open_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 12, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::hood_open_is_valid(const std::uint8_t* bytes,
                                     int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<1, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -108,8 +109,8 @@ bool Doorrpt417::hood_open_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 11, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::rear_pass_door_open_is_valid(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<1, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -120,8 +121,8 @@ bool Doorrpt417::rear_pass_door_open_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 10, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::rear_driver_door_open_is_valid(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<1, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -132,8 +133,8 @@ bool Doorrpt417::rear_driver_door_open_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 9, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::pass_door_open_is_valid(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<1, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -144,8 +145,8 @@ bool Doorrpt417::pass_door_open_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 8, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::driver_door_open_is_valid(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<1, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -156,8 +157,8 @@ bool Doorrpt417::driver_door_open_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::fuel_door_open(const std::uint8_t* bytes,
                                 int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<0, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -167,8 +168,8 @@ bool Doorrpt417::fuel_door_open(const std::uint8_t* bytes,
 // 1, 'is_signed_var': False, 'physical_range': '[0|1]', 'bit': 5, 'type':
 // 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::trunk_open(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -178,8 +179,8 @@ bool Doorrpt417::trunk_open(const std::uint8_t* bytes, int32_t length) const {
 // 1, 'is_signed_var': False, 'physical_range': '[0|1]', 'bit': 4, 'type':
 // 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::hood_open(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<0, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -190,8 +191,8 @@ bool Doorrpt417::hood_open(const std::uint8_t* bytes, int32_t length) const {
 // '[0|1]', 'bit': 3, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::rear_pass_door_open(const std::uint8_t* bytes,
                                      int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -202,8 +203,8 @@ bool Doorrpt417::rear_pass_door_open(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 2, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::rear_driver_door_open(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -214,8 +215,8 @@ bool Doorrpt417::rear_driver_door_open(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::pass_door_open(const std::uint8_t* bytes,
                                 int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -226,8 +227,8 @@ bool Doorrpt417::pass_door_open(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Doorrpt417::driver_door_open(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Globalrpt10::Globalrpt10() {}
 const int32_t Globalrpt10::ID = 0x10;
@@ -64,8 +65,8 @@ void Globalrpt10::Parse(const std::uint8_t* bytes, int32_t length,
 // '[0|1]', 'bit': 15, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Globalrpt10::config_fault_active(const std::uint8_t* bytes,
                                       int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(7, 1);
+  using Layout = SignalLayout<SignalPiece<1, 7, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -76,8 +77,8 @@ bool Globalrpt10::config_fault_active(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 5, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Globalrpt10::pacmod_subsystem_timeout(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -90,8 +91,8 @@ bool Globalrpt10::pacmod_subsystem_timeout(const std::uint8_t* bytes,
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Global_rpt_10::Pacmod_system_enabledType Globalrpt10::pacmod_system_enabled(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Global_rpt_10::Pacmod_system_enabledType ret =
       static_cast<Global_rpt_10::Pacmod_system_enabledType>(x);
@@ -106,8 +107,8 @@ Global_rpt_10::Pacmod_system_enabledType Globalrpt10::pacmod_system_enabled(
 Global_rpt_10::Pacmod_system_override_activeType
 Globalrpt10::pacmod_system_override_active(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Global_rpt_10::Pacmod_system_override_activeType ret =
       static_cast<Global_rpt_10::Pacmod_system_override_activeType>(x);
@@ -119,8 +120,8 @@ Globalrpt10::pacmod_system_override_active(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 7, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Globalrpt10::pacmod_system_fault_active(const std::uint8_t* bytes,
                                              int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(7, 1);
+  using Layout = SignalLayout<SignalPiece<0, 7, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -131,8 +132,8 @@ bool Globalrpt10::pacmod_system_fault_active(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Globalrpt10::veh_can_timeout(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<0, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -143,8 +144,8 @@ bool Globalrpt10::veh_can_timeout(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Globalrpt10::str_can_timeout(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -157,8 +158,8 @@ bool Globalrpt10::str_can_timeout(const std::uint8_t* bytes,
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Global_rpt_10::Brk_can_timeoutType Globalrpt10::brk_can_timeout(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<0, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Global_rpt_10::Brk_can_timeoutType ret =
       static_cast<Global_rpt_10::Brk_can_timeoutType>(x);
@@ -170,8 +171,8 @@ Global_rpt_10::Brk_can_timeoutType Globalrpt10::brk_can_timeout(
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Globalrpt10::usr_can_timeout(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -183,13 +184,9 @@ bool Globalrpt10::usr_can_timeout(const std::uint8_t* bytes,
 // ''}
 int Globalrpt10::usr_can_read_errors(const std::uint8_t* bytes,
                                      int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 7);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<6, 0, 8>,
+                              SignalPiece<7, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Headlightauxrpt318::Headlightauxrpt318() {}
 const int32_t Headlightauxrpt318::ID = 0x318;
@@ -62,8 +63,8 @@ void Headlightauxrpt318::Parse(const std::uint8_t* bytes, int32_t length,
 // '[0|1]', 'bit': 19, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Headlightauxrpt318::headlights_mode_is_valid(const std::uint8_t* bytes,
                                                   int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<2, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -77,8 +78,8 @@ bool Headlightauxrpt318::headlights_mode_is_valid(const std::uint8_t* bytes,
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Headlight_aux_rpt_318::Headlights_modeType Headlightauxrpt318::headlights_mode(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Headlight_aux_rpt_318::Headlights_modeType ret =
       static_cast<Headlight_aux_rpt_318::Headlights_modeType>(x);
@@ -90,8 +91,8 @@ Headlight_aux_rpt_318::Headlights_modeType Headlightauxrpt318::headlights_mode(
 // '[0|1]', 'bit': 18, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Headlightauxrpt318::fog_lights_on_is_valid(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<2, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -102,8 +103,8 @@ bool Headlightauxrpt318::fog_lights_on_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Headlightauxrpt318::fog_lights_on(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -114,8 +115,8 @@ bool Headlightauxrpt318::fog_lights_on(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 17, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Headlightauxrpt318::headlights_on_bright_is_valid(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<2, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -126,8 +127,8 @@ bool Headlightauxrpt318::headlights_on_bright_is_valid(
 // '[0|1]', 'bit': 1, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Headlightauxrpt318::headlights_on_bright(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -138,8 +139,8 @@ bool Headlightauxrpt318::headlights_on_bright(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 16, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Headlightauxrpt318::headlights_on_is_valid(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<2, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -150,8 +151,8 @@ bool Headlightauxrpt318::headlights_on_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Headlightauxrpt318::headlights_on(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Interiorlightsrpt416::Interiorlightsrpt416() {}
 const int32_t Interiorlightsrpt416::ID = 0x416;
@@ -64,8 +65,8 @@ void Interiorlightsrpt416::Parse(const std::uint8_t* bytes, int32_t length,
 // '[0|1]', 'bit': 19, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Interiorlightsrpt416::dim_level_is_valid(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<2, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -76,8 +77,8 @@ bool Interiorlightsrpt416::dim_level_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 18, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Interiorlightsrpt416::mood_lights_on_is_valid(const std::uint8_t* bytes,
                                                    int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<2, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -88,8 +89,8 @@ bool Interiorlightsrpt416::mood_lights_on_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 17, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Interiorlightsrpt416::rear_dome_lights_on_is_valid(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<2, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -100,8 +101,8 @@ bool Interiorlightsrpt416::rear_dome_lights_on_is_valid(
 // '[0|1]', 'bit': 16, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Interiorlightsrpt416::front_dome_lights_on_is_valid(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<2, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -118,8 +119,8 @@ bool Interiorlightsrpt416::front_dome_lights_on_is_valid(
 // 'bit': 15, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Interior_lights_rpt_416::Dim_levelType Interiorlightsrpt416::dim_level(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Interior_lights_rpt_416::Dim_levelType ret =
       static_cast<Interior_lights_rpt_416::Dim_levelType>(x);
@@ -131,8 +132,8 @@ Interior_lights_rpt_416::Dim_levelType Interiorlightsrpt416::dim_level(
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Interiorlightsrpt416::mood_lights_on(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -143,8 +144,8 @@ bool Interiorlightsrpt416::mood_lights_on(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 1, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Interiorlightsrpt416::rear_dome_lights_on(const std::uint8_t* bytes,
                                                int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -155,8 +156,8 @@ bool Interiorlightsrpt416::rear_dome_lights_on(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 0, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Interiorlightsrpt416::front_dome_lights_on(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
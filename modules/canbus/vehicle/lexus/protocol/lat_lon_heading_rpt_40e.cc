@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Latlonheadingrpt40e::Latlonheadingrpt40e() {}
 const int32_t Latlonheadingrpt40e::ID = 0x40E;
@@ -59,16 +60,9 @@ void Latlonheadingrpt40e::Parse(const std::uint8_t* bytes, int32_t length,
 // 'type': 'double', 'order': 'motorola', 'physical_unit': 'deg'}
 double Latlonheadingrpt40e::heading(const std::uint8_t* bytes,
                                     int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 7);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<6, 0, 8>,
+                              SignalPiece<7, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.010000;
   return ret;
@@ -79,11 +73,8 @@ double Latlonheadingrpt40e::heading(const std::uint8_t* bytes,
 // 'type': 'int', 'order': 'motorola', 'physical_unit': 'sec'}
 int Latlonheadingrpt40e::longitude_seconds(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 8);
-
-  x <<= 24;
-  x >>= 24;
+  using Layout = SignalLayout<SignalPiece<5, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   int ret = x;
   return ret;
@@ -94,11 +85,8 @@ int Latlonheadingrpt40e::longitude_seconds(const std::uint8_t* bytes,
 // 'type': 'int', 'order': 'motorola', 'physical_unit': 'min'}
 int Latlonheadingrpt40e::longitude_minutes(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  x <<= 24;
-  x >>= 24;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   int ret = x;
   return ret;
@@ -109,11 +97,8 @@ int Latlonheadingrpt40e::longitude_minutes(const std::uint8_t* bytes,
 // 'type': 'int', 'order': 'motorola', 'physical_unit': 'deg'}
 int Latlonheadingrpt40e::longitude_degrees(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
-
-  x <<= 24;
-  x >>= 24;
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   int ret = x;
   return ret;
@@ -124,11 +109,8 @@ int Latlonheadingrpt40e::longitude_degrees(const std::uint8_t* bytes,
 // 'type': 'int', 'order': 'motorola', 'physical_unit': 'sec'}
 int Latlonheadingrpt40e::latitude_seconds(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  x <<= 24;
-  x >>= 24;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   int ret = x;
   return ret;
@@ -139,11 +121,8 @@ int Latlonheadingrpt40e::latitude_seconds(const std::uint8_t* bytes,
 // 'type': 'int', 'order': 'motorola', 'physical_unit': 'min'}
 int Latlonheadingrpt40e::latitude_minutes(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
-
-  x <<= 24;
-  x >>= 24;
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   int ret = x;
   return ret;
@@ -154,11 +133,8 @@ int Latlonheadingrpt40e::latitude_minutes(const std::uint8_t* bytes,
 // 'type': 'int', 'order': 'motorola', 'physical_unit': 'deg'}
 int Latlonheadingrpt40e::latitude_degrees(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  x <<= 24;
-  x >>= 24;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   int ret = x;
   return ret;
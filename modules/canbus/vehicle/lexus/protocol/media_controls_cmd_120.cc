@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Mediacontrolscmd120::Mediacontrolscmd120() {}
 const int32_t Mediacontrolscmd120::ID = 0x120;
@@ -60,8 +61,8 @@ void Mediacontrolscmd120::Parse(const std::uint8_t* bytes, int32_t length,
 Media_controls_cmd_120::Media_controls_cmdType
 Mediacontrolscmd120::media_controls_cmd(const std::uint8_t* bytes,
                                         int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Media_controls_cmd_120::Media_controls_cmdType ret =
       static_cast<Media_controls_cmd_120::Media_controls_cmdType>(x);
@@ -73,8 +74,8 @@ Mediacontrolscmd120::media_controls_cmd(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Mediacontrolscmd120::ignore_overrides(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -85,8 +86,8 @@ bool Mediacontrolscmd120::ignore_overrides(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Mediacontrolscmd120::clear_override(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -97,8 +98,8 @@ bool Mediacontrolscmd120::clear_override(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Mediacontrolscmd120::clear_faults(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -109,8 +110,8 @@ bool Mediacontrolscmd120::clear_faults(const std::uint8_t* bytes,
 // 'order': 'motorola', 'physical_unit': ''}
 bool Mediacontrolscmd120::enable(const std::uint8_t* bytes,
                                  int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Mediacontrolsrpt220::Mediacontrolsrpt220() {}
 const int32_t Mediacontrolsrpt220::ID = 0x220;
@@ -71,8 +72,8 @@ void Mediacontrolsrpt220::Parse(const std::uint8_t* bytes, int32_t length,
 // 31, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Media_controls_rpt_220::Output_valueType Mediacontrolsrpt220::output_value(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Media_controls_rpt_220::Output_valueType ret =
       static_cast<Media_controls_rpt_220::Output_valueType>(x);
@@ -92,8 +93,8 @@ Media_controls_rpt_220::Output_valueType Mediacontrolsrpt220::output_value(
 Media_controls_rpt_220::Commanded_valueType
 Mediacontrolsrpt220::commanded_value(const std::uint8_t* bytes,
                                      int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Media_controls_rpt_220::Commanded_valueType ret =
       static_cast<Media_controls_rpt_220::Commanded_valueType>(x);
@@ -112,8 +113,8 @@ Mediacontrolsrpt220::commanded_value(const std::uint8_t* bytes,
 // 15, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Media_controls_rpt_220::Manual_inputType Mediacontrolsrpt220::manual_input(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Media_controls_rpt_220::Manual_inputType ret =
       static_cast<Media_controls_rpt_220::Manual_inputType>(x);
@@ -125,8 +126,8 @@ Media_controls_rpt_220::Manual_inputType Mediacontrolsrpt220::manual_input(
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Mediacontrolsrpt220::vehicle_fault(const std::uint8_t* bytes,
                                         int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<0, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -137,8 +138,8 @@ bool Mediacontrolsrpt220::vehicle_fault(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Mediacontrolsrpt220::pacmod_fault(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -149,8 +150,8 @@ bool Mediacontrolsrpt220::pacmod_fault(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Mediacontrolsrpt220::override_active(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -161,8 +162,8 @@ bool Mediacontrolsrpt220::override_active(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 4, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Mediacontrolsrpt220::output_reported_fault(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<0, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -173,8 +174,8 @@ bool Mediacontrolsrpt220::output_reported_fault(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 3, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Mediacontrolsrpt220::input_output_fault(const std::uint8_t* bytes,
                                              int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -185,8 +186,8 @@ bool Mediacontrolsrpt220::input_output_fault(const std::uint8_t* bytes,
 // 'order': 'motorola', 'physical_unit': ''}
 bool Mediacontrolsrpt220::enabled(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -197,8 +198,8 @@ bool Mediacontrolsrpt220::enabled(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 2, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Mediacontrolsrpt220::command_output_fault(const std::uint8_t* bytes,
                                                int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Occupancyrpt415::Occupancyrpt415() {}
 const int32_t Occupancyrpt415::ID = 0x415;
@@ -79,8 +80,8 @@ void Occupancyrpt415::Parse(const std::uint8_t* bytes, int32_t length,
 // '[0|1]', 'bit': 13, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Occupancyrpt415::rear_seatbelt_buckled_is_valid(const std::uint8_t* bytes,
                                                      int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<1, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -91,8 +92,8 @@ bool Occupancyrpt415::rear_seatbelt_buckled_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 12, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Occupancyrpt415::pass_seatbelt_buckled_is_valid(const std::uint8_t* bytes,
                                                      int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<1, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -103,8 +104,8 @@ bool Occupancyrpt415::pass_seatbelt_buckled_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 11, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Occupancyrpt415::driver_seatbelt_buckled_is_valid(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<1, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -115,8 +116,8 @@ bool Occupancyrpt415::driver_seatbelt_buckled_is_valid(
 // '[0|1]', 'bit': 10, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Occupancyrpt415::rear_seat_occupied_is_valid(const std::uint8_t* bytes,
                                                   int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<1, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -127,8 +128,8 @@ bool Occupancyrpt415::rear_seat_occupied_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 9, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Occupancyrpt415::pass_seat_occupied_is_valid(const std::uint8_t* bytes,
                                                   int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<1, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -139,8 +140,8 @@ bool Occupancyrpt415::pass_seat_occupied_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 8, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Occupancyrpt415::driver_seat_occupied_is_valid(const std::uint8_t* bytes,
                                                     int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<1, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -151,8 +152,8 @@ bool Occupancyrpt415::driver_seat_occupied_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 5, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Occupancyrpt415::rear_seatbelt_buckled(const std::uint8_t* bytes,
                                             int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -163,8 +164,8 @@ bool Occupancyrpt415::rear_seatbelt_buckled(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 4, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Occupancyrpt415::pass_seatbelt_buckled(const std::uint8_t* bytes,
                                             int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<0, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -175,8 +176,8 @@ bool Occupancyrpt415::pass_seatbelt_buckled(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 3, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Occupancyrpt415::driver_seatbelt_buckled(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -187,8 +188,8 @@ bool Occupancyrpt415::driver_seatbelt_buckled(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 2, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Occupancyrpt415::rear_seat_occupied(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -199,8 +200,8 @@ bool Occupancyrpt415::rear_seat_occupied(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 1, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Occupancyrpt415::pass_seat_occupied(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -211,8 +212,8 @@ bool Occupancyrpt415::pass_seat_occupied(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 0, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Occupancyrpt415::driver_seat_occupied(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
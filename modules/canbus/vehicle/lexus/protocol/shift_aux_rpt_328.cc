@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Shiftauxrpt328::Shiftauxrpt328() {}
 const int32_t Shiftauxrpt328::ID = 0x328;
@@ -65,8 +66,8 @@ void Shiftauxrpt328::Parse(const std::uint8_t* bytes, int32_t length,
 // '[0|1]', 'bit': 11, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftauxrpt328::speed_interlock_active_is_valid(const std::uint8_t* bytes,
                                                      int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<1, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -77,8 +78,8 @@ bool Shiftauxrpt328::speed_interlock_active_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 3, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftauxrpt328::speed_interlock_active(const std::uint8_t* bytes,
                                             int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -89,8 +90,8 @@ bool Shiftauxrpt328::speed_interlock_active(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 10, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftauxrpt328::brake_interlock_active_is_valid(const std::uint8_t* bytes,
                                                      int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<1, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -101,8 +102,8 @@ bool Shiftauxrpt328::brake_interlock_active_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 2, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftauxrpt328::brake_interlock_active(const std::uint8_t* bytes,
                                             int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -113,8 +114,8 @@ bool Shiftauxrpt328::brake_interlock_active(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 9, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftauxrpt328::stay_in_neutral_mode_is_valid(const std::uint8_t* bytes,
                                                    int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<1, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -125,8 +126,8 @@ bool Shiftauxrpt328::stay_in_neutral_mode_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 1, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftauxrpt328::stay_in_neutral_mode(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -137,8 +138,8 @@ bool Shiftauxrpt328::stay_in_neutral_mode(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 8, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftauxrpt328::between_gears_is_valid(const std::uint8_t* bytes,
                                             int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<1, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -149,8 +150,8 @@ bool Shiftauxrpt328::between_gears_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftauxrpt328::between_gears(const std::uint8_t* bytes,
                                    int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
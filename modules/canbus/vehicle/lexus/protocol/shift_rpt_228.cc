@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Shiftrpt228::Shiftrpt228() {}
 const int32_t Shiftrpt228::ID = 0x228;
@@ -59,8 +60,8 @@ void Shiftrpt228::Parse(const std::uint8_t* bytes, int32_t length,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftrpt228::vehicle_fault(const std::uint8_t* bytes,
                                 int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<0, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -71,8 +72,8 @@ bool Shiftrpt228::vehicle_fault(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftrpt228::pacmod_fault(const std::uint8_t* bytes,
                                int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -83,8 +84,8 @@ bool Shiftrpt228::pacmod_fault(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftrpt228::override_active(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -95,8 +96,8 @@ bool Shiftrpt228::override_active(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 4, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftrpt228::output_reported_fault(const std::uint8_t* bytes,
                                         int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<0, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -107,8 +108,8 @@ bool Shiftrpt228::output_reported_fault(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 3, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftrpt228::input_output_fault(const std::uint8_t* bytes,
                                      int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -118,8 +119,8 @@ bool Shiftrpt228::input_output_fault(const std::uint8_t* bytes,
 // 'is_signed_var': False, 'physical_range': '[0|1]', 'bit': 0, 'type': 'bool',
 // 'order': 'motorola', 'physical_unit': ''}
 bool Shiftrpt228::enabled(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -130,8 +131,8 @@ bool Shiftrpt228::enabled(const std::uint8_t* bytes, int32_t length) const {
 // '[0|1]', 'bit': 2, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Shiftrpt228::command_output_fault(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -146,8 +147,8 @@ bool Shiftrpt228::command_output_fault(const std::uint8_t* bytes,
 // 'motorola', 'physical_unit': ''}
 Shift_rpt_228::Manual_inputType Shiftrpt228::manual_input(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   // TODO(Snehagn) : temporary fix until AS to fix in the firmware
   if (x == 255) {
@@ -167,8 +168,8 @@ Shift_rpt_228::Manual_inputType Shiftrpt228::manual_input(
 // 23, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Shift_rpt_228::Commanded_valueType Shiftrpt228::commanded_value(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Shift_rpt_228::Commanded_valueType ret =
       static_cast<Shift_rpt_228::Commanded_valueType>(x);
@@ -184,8 +185,8 @@ Shift_rpt_228::Commanded_valueType Shiftrpt228::commanded_value(
 // 'motorola', 'physical_unit': ''}
 Shift_rpt_228::Output_valueType Shiftrpt228::output_value(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Shift_rpt_228::Output_valueType ret =
       static_cast<Shift_rpt_228::Output_valueType>(x);
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Steeringauxrpt32c::Steeringauxrpt32c() {}
 const int32_t Steeringauxrpt32c::ID = 0x32C;
@@ -60,8 +61,8 @@ void Steeringauxrpt32c::Parse(const std::uint8_t* bytes, int32_t length,
 // '[0|1]', 'bit': 59, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Steeringauxrpt32c::user_interaction_is_valid(const std::uint8_t* bytes,
                                                   int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<7, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -72,8 +73,8 @@ bool Steeringauxrpt32c::user_interaction_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Steeringauxrpt32c::user_interaction(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<6, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -84,8 +85,8 @@ bool Steeringauxrpt32c::user_interaction(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 58, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Steeringauxrpt32c::rotation_rate_is_valid(const std::uint8_t* bytes,
                                                int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<7, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -96,13 +97,9 @@ bool Steeringauxrpt32c::rotation_rate_is_valid(const std::uint8_t* bytes,
 // 'type': 'double', 'order': 'motorola', 'physical_unit': 'rad/s'}
 double Steeringauxrpt32c::rotation_rate(const std::uint8_t* bytes,
                                         int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -113,8 +110,8 @@ double Steeringauxrpt32c::rotation_rate(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 57, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Steeringauxrpt32c::raw_torque_is_valid(const std::uint8_t* bytes,
                                             int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<7, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -125,16 +122,9 @@ bool Steeringauxrpt32c::raw_torque_is_valid(const std::uint8_t* bytes,
 // 'bit': 23, 'type': 'double', 'order': 'motorola', 'physical_unit': ''}
 double Steeringauxrpt32c::raw_torque(const std::uint8_t* bytes,
                                      int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -145,8 +135,8 @@ double Steeringauxrpt32c::raw_torque(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 56, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Steeringauxrpt32c::raw_position_is_valid(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<7, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -157,16 +147,9 @@ bool Steeringauxrpt32c::raw_position_is_valid(const std::uint8_t* bytes,
 // 'bit': 7, 'type': 'double', 'order': 'motorola', 'physical_unit': ''}
 double Steeringauxrpt32c::raw_position(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.001000;
   return ret;
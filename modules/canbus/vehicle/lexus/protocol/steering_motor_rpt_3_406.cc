@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Steeringmotorrpt3406::Steeringmotorrpt3406() {}
 const int32_t Steeringmotorrpt3406::ID = 0x406;
@@ -46,26 +47,11 @@ void Steeringmotorrpt3406::Parse(const std::uint8_t* bytes, int32_t length,
 // 'motorola', 'physical_unit': 'N-m'}
 double Steeringmotorrpt3406::torque_output(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  Byte t2(bytes + 2);
-  t = t2.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  Byte t3(bytes + 3);
-  t = t3.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 0;
-  x >>= 0;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 0, 8>,
+                              SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -77,26 +63,11 @@ double Steeringmotorrpt3406::torque_output(const std::uint8_t* bytes,
 // 'motorola', 'physical_unit': 'N-m'}
 double Steeringmotorrpt3406::torque_input(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  Byte t2(bytes + 6);
-  t = t2.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  Byte t3(bytes + 7);
-  t = t3.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 0;
-  x >>= 0;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 0, 8>,
+                              SignalPiece<6, 0, 8>,
+                              SignalPiece<7, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.001000;
   return ret;
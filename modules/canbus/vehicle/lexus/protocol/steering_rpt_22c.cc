@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Steeringrpt22c::Steeringrpt22c() {}
 const int32_t Steeringrpt22c::ID = 0x22C;
@@ -61,8 +62,8 @@ void Steeringrpt22c::Parse(const std::uint8_t* bytes, int32_t length,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Steeringrpt22c::vehicle_fault(const std::uint8_t* bytes,
                                    int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<0, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -73,8 +74,8 @@ bool Steeringrpt22c::vehicle_fault(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Steeringrpt22c::pacmod_fault(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -85,8 +86,8 @@ bool Steeringrpt22c::pacmod_fault(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Steeringrpt22c::override_active(const std::uint8_t* bytes,
                                      int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -97,8 +98,8 @@ bool Steeringrpt22c::override_active(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 4, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Steeringrpt22c::output_reported_fault(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<0, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -109,8 +110,8 @@ bool Steeringrpt22c::output_reported_fault(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 3, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Steeringrpt22c::input_output_fault(const std::uint8_t* bytes,
                                         int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -120,8 +121,8 @@ bool Steeringrpt22c::input_output_fault(const std::uint8_t* bytes,
 // 'is_signed_var': False, 'physical_range': '[0|1]', 'bit': 0, 'type': 'bool',
 // 'order': 'motorola', 'physical_unit': ''}
 bool Steeringrpt22c::enabled(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -132,8 +133,8 @@ bool Steeringrpt22c::enabled(const std::uint8_t* bytes, int32_t length) const {
 // '[0|1]', 'bit': 2, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Steeringrpt22c::command_output_fault(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -144,16 +145,9 @@ bool Steeringrpt22c::command_output_fault(const std::uint8_t* bytes,
 // 'bit': 15, 'type': 'double', 'order': 'motorola', 'physical_unit': 'rad'}
 double Steeringrpt22c::manual_input(const std::uint8_t* bytes,
                                     int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 2);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>,
+                              SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -164,16 +158,9 @@ double Steeringrpt22c::manual_input(const std::uint8_t* bytes,
 // 'bit': 31, 'type': 'double', 'order': 'motorola', 'physical_unit': 'rad'}
 double Steeringrpt22c::commanded_value(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 4);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>,
+                              SignalPiece<4, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -184,16 +171,9 @@ double Steeringrpt22c::commanded_value(const std::uint8_t* bytes,
 // 'bit': 47, 'type': 'double', 'order': 'motorola', 'physical_unit': 'rad'}
 double Steeringrpt22c::output_value(const std::uint8_t* bytes,
                                     int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 6);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<5, 0, 8>,
+                              SignalPiece<6, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Turnauxrpt330::Turnauxrpt330() {}
 const int32_t Turnauxrpt330::ID = 0x330;
@@ -53,8 +54,8 @@ void Turnauxrpt330::Parse(const std::uint8_t* bytes, int32_t length,
 // '[0|1]', 'bit': 9, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Turnauxrpt330::pass_blinker_bulb_on_is_valid(const std::uint8_t* bytes,
                                                   int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<1, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -65,8 +66,8 @@ bool Turnauxrpt330::pass_blinker_bulb_on_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 1, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Turnauxrpt330::pass_blinker_bulb_on(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -77,8 +78,8 @@ bool Turnauxrpt330::pass_blinker_bulb_on(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 8, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Turnauxrpt330::driver_blinker_bulb_on_is_valid(const std::uint8_t* bytes,
                                                     int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<1, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -89,8 +90,8 @@ bool Turnauxrpt330::driver_blinker_bulb_on_is_valid(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 0, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Turnauxrpt330::driver_blinker_bulb_on(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
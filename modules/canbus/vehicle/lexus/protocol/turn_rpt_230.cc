@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Turnrpt230::Turnrpt230() {}
 const int32_t Turnrpt230::ID = 0x230;
@@ -59,8 +60,8 @@ void Turnrpt230::Parse(const std::uint8_t* bytes, int32_t length,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Turnrpt230::vehicle_fault(const std::uint8_t* bytes,
                                int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<0, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -70,8 +71,8 @@ bool Turnrpt230::vehicle_fault(const std::uint8_t* bytes,
 // 'len': 1, 'is_signed_var': False, 'physical_range': '[0|1]', 'bit': 5,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Turnrpt230::pacmod_fault(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -82,8 +83,8 @@ bool Turnrpt230::pacmod_fault(const std::uint8_t* bytes, int32_t length) const {
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Turnrpt230::override_active(const std::uint8_t* bytes,
                                  int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -94,8 +95,8 @@ bool Turnrpt230::override_active(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 4, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Turnrpt230::output_reported_fault(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<0, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -106,8 +107,8 @@ bool Turnrpt230::output_reported_fault(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 3, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Turnrpt230::input_output_fault(const std::uint8_t* bytes,
                                     int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -117,8 +118,8 @@ bool Turnrpt230::input_output_fault(const std::uint8_t* bytes,
 // 'is_signed_var': False, 'physical_range': '[0|1]', 'bit': 0, 'type': 'bool',
 // 'order': 'motorola', 'physical_unit': ''}
 bool Turnrpt230::enabled(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -129,8 +130,8 @@ bool Turnrpt230::enabled(const std::uint8_t* bytes, int32_t length) const {
 // '[0|1]', 'bit': 2, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Turnrpt230::command_output_fault(const std::uint8_t* bytes,
                                       int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -143,8 +144,8 @@ bool Turnrpt230::command_output_fault(const std::uint8_t* bytes,
 // 'physical_unit': ''}
 Turn_rpt_230::Manual_inputType Turnrpt230::manual_input(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Turn_rpt_230::Manual_inputType ret =
       static_cast<Turn_rpt_230::Manual_inputType>(x);
@@ -158,8 +159,8 @@ Turn_rpt_230::Manual_inputType Turnrpt230::manual_input(
 // 'bit': 23, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Turn_rpt_230::Commanded_valueType Turnrpt230::commanded_value(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Turn_rpt_230::Commanded_valueType ret =
       static_cast<Turn_rpt_230::Commanded_valueType>(x);
@@ -173,8 +174,8 @@ Turn_rpt_230::Commanded_valueType Turnrpt230::commanded_value(
 // 'physical_unit': ''}
 Turn_rpt_230::Output_valueType Turnrpt230::output_value(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Turn_rpt_230::Output_valueType ret =
       static_cast<Turn_rpt_230::Output_valueType>(x);
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Vehdynamicsrpt413::Vehdynamicsrpt413() {}
 const int32_t Vehdynamicsrpt413::ID = 0x413;
@@ -41,8 +42,8 @@ void Vehdynamicsrpt413::Parse(const std::uint8_t* bytes, int32_t length,
 // 'bit': 7, 'type': 'double', 'order': 'motorola', 'physical_unit': ''}
 double Vehdynamicsrpt413::veh_g_forces(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.001000;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Vehspecificrpt1412::Vehspecificrpt1412() {}
 const int32_t Vehspecificrpt1412::ID = 0x412;
@@ -43,8 +44,8 @@ void Vehspecificrpt1412::Parse(const std::uint8_t* bytes, int32_t length,
 // 'type': 'int', 'order': 'motorola', 'physical_unit': ''}
 int Vehspecificrpt1412::shift_pos_2(const std::uint8_t* bytes,
                                     int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -55,8 +56,8 @@ int Vehspecificrpt1412::shift_pos_2(const std::uint8_t* bytes,
 // 'type': 'int', 'order': 'motorola', 'physical_unit': ''}
 int Vehspecificrpt1412::shift_pos_1(const std::uint8_t* bytes,
                                     int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Vinrpt414::Vinrpt414() {}
 const int32_t Vinrpt414::ID = 0x414;
@@ -44,18 +45,10 @@ void Vinrpt414::Parse(const std::uint8_t* bytes, int32_t length,
 // 24, 'is_signed_var': False, 'physical_range': '[0|0]', 'bit': 39, 'type':
 // 'int', 'order': 'motorola', 'physical_unit': ''}
 int Vinrpt414::veh_serial(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  Byte t2(bytes + 6);
-  t = t2.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 0, 8>,
+                              SignalPiece<6, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -65,8 +58,8 @@ int Vinrpt414::veh_serial(const std::uint8_t* bytes, int32_t length) const {
 // 'len': 8, 'is_signed_var': False, 'physical_range': '[0|0]', 'bit': 31,
 // 'type': 'int', 'order': 'motorola', 'physical_unit': ''}
 int Vinrpt414::veh_my_code(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -76,18 +69,10 @@ int Vinrpt414::veh_my_code(const std::uint8_t* bytes, int32_t length) const {
 // 'len': 24, 'is_signed_var': False, 'physical_range': '[0|0]', 'bit': 7,
 // 'type': 'int', 'order': 'motorola', 'physical_unit': ''}
 int Vinrpt414::veh_mfg_code(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  Byte t2(bytes + 2);
-  t = t2.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 0, 8>,
+                              SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
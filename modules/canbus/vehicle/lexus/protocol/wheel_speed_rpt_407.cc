@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Wheelspeedrpt407::Wheelspeedrpt407() {}
 const int32_t Wheelspeedrpt407::ID = 0x407;
@@ -51,16 +52,9 @@ void Wheelspeedrpt407::Parse(const std::uint8_t* bytes, int32_t length,
 // 'bit': 55, 'type': 'double', 'order': 'motorola', 'physical_unit': 'rad/s'}
 double Wheelspeedrpt407::wheel_spd_rear_right(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 7);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<6, 0, 8>,
+                              SignalPiece<7, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.010000;
   return ret;
@@ -71,16 +65,9 @@ double Wheelspeedrpt407::wheel_spd_rear_right(const std::uint8_t* bytes,
 // 'bit': 39, 'type': 'double', 'order': 'motorola', 'physical_unit': 'rad/s'}
 double Wheelspeedrpt407::wheel_spd_rear_left(const std::uint8_t* bytes,
                                              int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.010000;
   return ret;
@@ -91,16 +78,9 @@ double Wheelspeedrpt407::wheel_spd_rear_left(const std::uint8_t* bytes,
 // 'bit': 23, 'type': 'double', 'order': 'motorola', 'physical_unit': 'rad/s'}
 double Wheelspeedrpt407::wheel_spd_front_right(const std::uint8_t* bytes,
                                                int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.010000;
   return ret;
@@ -112,13 +92,9 @@ double Wheelspeedrpt407::wheel_spd_front_right(const std::uint8_t* bytes,
 // 'physical_unit': 'rad/s'}
 double Wheelspeedrpt407::wheel_spd_front_left(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.010000;
   return ret;
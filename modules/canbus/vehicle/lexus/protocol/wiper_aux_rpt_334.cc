@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace lexus {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Wiperauxrpt334::Wiperauxrpt334() {}
 const int32_t Wiperauxrpt334::ID = 0x334;
@@ -69,8 +70,8 @@ void Wiperauxrpt334::Parse(const std::uint8_t* bytes, int32_t length,
 // '[0|1]', 'bit': 13, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Wiperauxrpt334::spray_empty_is_valid(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<1, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -81,8 +82,8 @@ bool Wiperauxrpt334::spray_empty_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Wiperauxrpt334::spray_empty(const std::uint8_t* bytes,
                                  int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -93,8 +94,8 @@ bool Wiperauxrpt334::spray_empty(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 12, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Wiperauxrpt334::spray_near_empty_is_valid(const std::uint8_t* bytes,
                                                int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<1, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -105,8 +106,8 @@ bool Wiperauxrpt334::spray_near_empty_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Wiperauxrpt334::spray_near_empty(const std::uint8_t* bytes,
                                       int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<0, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -117,8 +118,8 @@ bool Wiperauxrpt334::spray_near_empty(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 11, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Wiperauxrpt334::rear_spraying_is_valid(const std::uint8_t* bytes,
                                             int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<1, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -129,8 +130,8 @@ bool Wiperauxrpt334::rear_spraying_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Wiperauxrpt334::rear_spraying(const std::uint8_t* bytes,
                                    int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -141,8 +142,8 @@ bool Wiperauxrpt334::rear_spraying(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 10, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Wiperauxrpt334::rear_wiping_is_valid(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<1, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -153,8 +154,8 @@ bool Wiperauxrpt334::rear_wiping_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Wiperauxrpt334::rear_wiping(const std::uint8_t* bytes,
                                  int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -165,8 +166,8 @@ bool Wiperauxrpt334::rear_wiping(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 9, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Wiperauxrpt334::front_spraying_is_valid(const std::uint8_t* bytes,
                                              int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<1, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -177,8 +178,8 @@ bool Wiperauxrpt334::front_spraying_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Wiperauxrpt334::front_spraying(const std::uint8_t* bytes,
                                     int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<0, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -189,8 +190,8 @@ bool Wiperauxrpt334::front_spraying(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 8, 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Wiperauxrpt334::front_wiping_is_valid(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<1, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -201,8 +202,8 @@ bool Wiperauxrpt334::front_wiping_is_valid(const std::uint8_t* bytes,
 // 'type': 'bool', 'order': 'motorola', 'physical_unit': ''}
 bool Wiperauxrpt334::front_wiping(const std::uint8_t* bytes,
                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
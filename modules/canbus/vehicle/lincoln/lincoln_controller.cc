@@ -348,12 +348,12 @@ Chassis LincolnController::chassis() {
     chassis_.mutable_chassis_gps()->set_gps_valid(false);
   }
 
-  // vin number will be written into KVDB once.
+  // vin number will be written into KVDB once, off the chassis thread.
   if (chassis_detail.license().has_vin()) {
     chassis_.mutable_license()->set_vin(chassis_detail.license().vin());
     if (!received_vin_) {
       apollo::common::KVDB::Put("apollo:canbus:vin",
-                                chassis_detail.license().vin());
+                                chassis_detail.license().vin(), false);
       received_vin_ = true;
     }
   }
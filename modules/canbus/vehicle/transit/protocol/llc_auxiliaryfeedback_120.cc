@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace transit {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Llcauxiliaryfeedback120::Llcauxiliaryfeedback120() {}
 const int32_t Llcauxiliaryfeedback120::ID = 0x120;
@@ -95,8 +96,8 @@ void Llcauxiliaryfeedback120::Parse(const std::uint8_t* bytes, int32_t length,
 // 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_inverter(const std::uint8_t* bytes,
                                                int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -108,8 +109,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_inverter(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch8(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(7, 1);
+  using Layout = SignalLayout<SignalPiece<1, 7, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -121,8 +122,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch8(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch7(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<1, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -134,8 +135,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch7(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch6(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<1, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -147,8 +148,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch6(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch5(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<1, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -160,8 +161,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch5(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch4(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<1, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -173,8 +174,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch4(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch3(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<1, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -186,8 +187,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch3(const std::uint8_t* bytes,
 // 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch2(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<1, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -199,8 +200,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch2(const std::uint8_t* bytes,
 // 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch1(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<1, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -212,8 +213,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_pdu_ch1(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_hazardlights(const std::uint8_t* bytes,
                                                    int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<3, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -225,8 +226,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_hazardlights(const std::uint8_t* bytes,
 // 'order': 'intel', 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_ledgreenon(const std::uint8_t* bytes,
                                                  int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<2, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -238,8 +239,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_ledgreenon(const std::uint8_t* bytes,
 // 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_horn(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -251,8 +252,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_horn(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_buzzeron(const std::uint8_t* bytes,
                                                int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<2, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -267,8 +268,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_buzzeron(const std::uint8_t* bytes,
 Llc_auxiliaryfeedback_120::Llc_fbk_turnsignalType
 Llcauxiliaryfeedback120::llc_fbk_turnsignal(const std::uint8_t* bytes,
                                             int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 2);
+  using Layout = SignalLayout<SignalPiece<3, 0, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Llc_auxiliaryfeedback_120::Llc_fbk_turnsignalType ret =
       static_cast<Llc_auxiliaryfeedback_120::Llc_fbk_turnsignalType>(x);
@@ -281,8 +282,8 @@ Llcauxiliaryfeedback120::llc_fbk_turnsignal(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_lowbeam(const std::uint8_t* bytes,
                                               int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<3, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -294,8 +295,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_lowbeam(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_highbeam(const std::uint8_t* bytes,
                                                int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<3, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -307,8 +308,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_highbeam(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_ledredon(const std::uint8_t* bytes,
                                                int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<2, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -320,8 +321,8 @@ bool Llcauxiliaryfeedback120::llc_fbk_ledredon(const std::uint8_t* bytes,
 // 'order': 'intel', 'physical_unit': 'T/F'}
 bool Llcauxiliaryfeedback120::llc_fbk_autonomybuttonpressed(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<2, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
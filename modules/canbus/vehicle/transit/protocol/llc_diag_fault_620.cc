@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace transit {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Llcdiagfault620::Llcdiagfault620() {}
 const int32_t Llcdiagfault620::ID = 0x620;
@@ -72,8 +73,8 @@ void Llcdiagfault620::Parse(const std::uint8_t* bytes, int32_t length,
 // '[0|255]', 'bit': 32, 'type': 'int', 'order': 'intel', 'physical_unit': ''}
 int Llcdiagfault620::llc_disengagecounter_brake(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -86,8 +87,8 @@ int Llcdiagfault620::llc_disengagecounter_brake(const std::uint8_t* bytes,
 // '[0|255]', 'bit': 16, 'type': 'int', 'order': 'intel', 'physical_unit': ''}
 int Llcdiagfault620::llc_disengagecounter_steer(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -100,8 +101,8 @@ int Llcdiagfault620::llc_disengagecounter_steer(const std::uint8_t* bytes,
 // 'int', 'order': 'intel', 'physical_unit': ''}
 int Llcdiagfault620::llc_disengagecounter_throttle(const std::uint8_t* bytes,
                                                    int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -113,8 +114,8 @@ int Llcdiagfault620::llc_disengagecounter_throttle(const std::uint8_t* bytes,
 // '[0|255]', 'bit': 0, 'type': 'int', 'order': 'intel', 'physical_unit': ''}
 int Llcdiagfault620::llc_fbk_faultcounter(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -127,8 +128,8 @@ int Llcdiagfault620::llc_fbk_faultcounter(const std::uint8_t* bytes,
 // '[0|255]', 'bit': 8, 'type': 'int', 'order': 'intel', 'physical_unit': ''}
 int Llcdiagfault620::llc_disengagecounter_button(const std::uint8_t* bytes,
                                                  int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -140,8 +141,8 @@ int Llcdiagfault620::llc_disengagecounter_button(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'g'}
 int Llcdiagfault620::llc_fbk_version_year(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 7);
+  using Layout = SignalLayout<SignalPiece<5, 0, 7>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = static_cast<int>(x + 2017.000000);
   return ret;
@@ -153,13 +154,9 @@ int Llcdiagfault620::llc_fbk_version_year(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'Month'}
 int Llcdiagfault620::llc_fbk_version_month(const std::uint8_t* bytes,
                                            int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 3);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(7, 1);
-  x <<= 1;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<6, 0, 3>,
+                              SignalPiece<5, 7, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -171,8 +168,8 @@ int Llcdiagfault620::llc_fbk_version_month(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'Day'}
 int Llcdiagfault620::llc_fbk_version_day(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(3, 5);
+  using Layout = SignalLayout<SignalPiece<6, 3, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -184,8 +181,8 @@ int Llcdiagfault620::llc_fbk_version_day(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'Hour'}
 int Llcdiagfault620::llc_fbk_version_hour(const std::uint8_t* bytes,
                                           int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(0, 5);
+  using Layout = SignalLayout<SignalPiece<7, 0, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
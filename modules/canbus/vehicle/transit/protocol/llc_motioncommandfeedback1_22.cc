@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace transit {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Llcmotioncommandfeedback122::Llcmotioncommandfeedback122() {}
 const int32_t Llcmotioncommandfeedback122::ID = 0x22;
@@ -61,21 +62,10 @@ void Llcmotioncommandfeedback122::Parse(const std::uint8_t* bytes,
 // 'physical_unit': 'deg'}
 double Llcmotioncommandfeedback122::llc_fbk_steeringanglesetpoint(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 5);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  Byte t2(bytes + 2);
-  t = t2.get_byte(5, 3);
-  x <<= 3;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<4, 0, 5>,
+                              SignalPiece<3, 0, 8>,
+                              SignalPiece<2, 5, 3>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.050000;
   return ret;
@@ -88,13 +78,9 @@ double Llcmotioncommandfeedback122::llc_fbk_steeringanglesetpoint(
 // '%'}
 double Llcmotioncommandfeedback122::llc_fbk_throttlesetpoint(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 5);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(3, 5);
-  x <<= 5;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<2, 0, 5>,
+                              SignalPiece<1, 3, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.100000;
   return ret;
@@ -107,13 +93,9 @@ double Llcmotioncommandfeedback122::llc_fbk_throttlesetpoint(
 // 'physical_unit': '%'}
 double Llcmotioncommandfeedback122::llc_fbk_brakepercentsetpoint(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 3);
-
-  Byte t1(bytes + 0);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<1, 0, 3>,
+                              SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.055600;
   return ret;
@@ -125,8 +107,8 @@ double Llcmotioncommandfeedback122::llc_fbk_brakepercentsetpoint(
 // '[0|3]', 'bit': 54, 'type': 'int', 'order': 'intel', 'physical_unit': ''}
 int Llcmotioncommandfeedback122::llc_motioncommandfeedback1_count(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(6, 2);
+  using Layout = SignalLayout<SignalPiece<6, 6, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -138,8 +120,8 @@ int Llcmotioncommandfeedback122::llc_motioncommandfeedback1_count(
 // '[0|255]', 'bit': 56, 'type': 'int', 'order': 'intel', 'physical_unit': ''}
 int Llcmotioncommandfeedback122::llc_motioncommandfeedback1_check(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<7, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
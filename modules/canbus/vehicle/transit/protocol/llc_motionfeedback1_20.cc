@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace transit {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Llcmotionfeedback120::Llcmotionfeedback120() {}
 const int32_t Llcmotionfeedback120::ID = 0x20;
@@ -89,8 +90,8 @@ void Llcmotionfeedback120::Parse(const std::uint8_t* bytes, int32_t length,
 // 'physical_unit': ''}
 Llc_motionfeedback1_20::Llc_fbk_gearType Llcmotionfeedback120::llc_fbk_gear(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(2, 3);
+  using Layout = SignalLayout<SignalPiece<6, 2, 3>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Llc_motionfeedback1_20::Llc_fbk_gearType ret =
       static_cast<Llc_motionfeedback1_20::Llc_fbk_gearType>(x);
@@ -103,8 +104,8 @@ Llc_motionfeedback1_20::Llc_fbk_gearType Llcmotionfeedback120::llc_fbk_gear(
 // 'intel', 'physical_unit': 'T/F'}
 bool Llcmotionfeedback120::llc_fbk_parkingbrake(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<6, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -116,13 +117,9 @@ bool Llcmotionfeedback120::llc_fbk_parkingbrake(const std::uint8_t* bytes,
 // 'double', 'order': 'intel', 'physical_unit': '%'}
 double Llcmotionfeedback120::llc_fbk_throttleposition(const std::uint8_t* bytes,
                                                       int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 4);
-  int32_t t = t1.get_byte(6, 2);
-  x <<= 2;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<5, 0, 8>,
+                              SignalPiece<4, 6, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.100000;
   return ret;
@@ -134,13 +131,9 @@ double Llcmotionfeedback120::llc_fbk_throttleposition(const std::uint8_t* bytes,
 // 'double', 'order': 'intel', 'physical_unit': '%'}
 double Llcmotionfeedback120::llc_fbk_brakepercentrear(const std::uint8_t* bytes,
                                                       int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 6);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(3, 5);
-  x <<= 5;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<4, 0, 6>,
+                              SignalPiece<3, 3, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.055600;
   return ret;
@@ -152,13 +145,9 @@ double Llcmotionfeedback120::llc_fbk_brakepercentrear(const std::uint8_t* bytes,
 // 'double', 'order': 'intel', 'physical_unit': '%'}
 double Llcmotionfeedback120::llc_fbk_brakepercentfront(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 3);
-
-  Byte t1(bytes + 2);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<3, 0, 3>,
+                              SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.055600;
   return ret;
@@ -174,8 +163,8 @@ double Llcmotionfeedback120::llc_fbk_brakepercentfront(
 Llc_motionfeedback1_20::Llc_fbk_steeringcontrolmodeType
 Llcmotionfeedback120::llc_fbk_steeringcontrolmode(const std::uint8_t* bytes,
                                                   int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(6, 2);
+  using Layout = SignalLayout<SignalPiece<0, 6, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Llc_motionfeedback1_20::Llc_fbk_steeringcontrolmodeType ret =
       static_cast<Llc_motionfeedback1_20::Llc_fbk_steeringcontrolmodeType>(x);
@@ -188,8 +177,8 @@ Llcmotionfeedback120::llc_fbk_steeringcontrolmode(const std::uint8_t* bytes,
 // '[0|3]', 'bit': 54, 'type': 'int', 'order': 'intel', 'physical_unit': ''}
 int Llcmotionfeedback120::llc_motionfeedback1_counter(const std::uint8_t* bytes,
                                                       int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(6, 2);
+  using Layout = SignalLayout<SignalPiece<6, 6, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -201,8 +190,8 @@ int Llcmotionfeedback120::llc_motionfeedback1_counter(const std::uint8_t* bytes,
 // 'int', 'order': 'intel', 'physical_unit': ''}
 int Llcmotionfeedback120::llc_motionfeedback1_checksum(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<7, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -214,8 +203,8 @@ int Llcmotionfeedback120::llc_motionfeedback1_checksum(
 // '[0|1]', 'bit': 11, 'type': 'bool', 'order': 'intel', 'physical_unit': 'T/F'}
 bool Llcmotionfeedback120::llc_fbk_commandaligned(const std::uint8_t* bytes,
                                                   int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<1, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -227,8 +216,8 @@ bool Llcmotionfeedback120::llc_fbk_commandaligned(const std::uint8_t* bytes,
 // 'intel', 'physical_unit': 'T/F'}
 bool Llcmotionfeedback120::llc_fbk_estoppressed(const std::uint8_t* bytes,
                                                 int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<1, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -240,8 +229,8 @@ bool Llcmotionfeedback120::llc_fbk_estoppressed(const std::uint8_t* bytes,
 // '[0|1]', 'bit': 9, 'type': 'bool', 'order': 'intel', 'physical_unit': 'T/F'}
 bool Llcmotionfeedback120::llc_fbk_adcrequestautonomy(const std::uint8_t* bytes,
                                                       int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<1, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -253,8 +242,8 @@ bool Llcmotionfeedback120::llc_fbk_adcrequestautonomy(const std::uint8_t* bytes,
 // 'bit': 8, 'type': 'bool', 'order': 'intel', 'physical_unit': 'T/F'}
 bool Llcmotionfeedback120::llc_fbk_allowautonomy(const std::uint8_t* bytes,
                                                  int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<1, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   bool ret = x;
   return ret;
@@ -271,8 +260,8 @@ bool Llcmotionfeedback120::llc_fbk_allowautonomy(const std::uint8_t* bytes,
 Llc_motionfeedback1_20::Llc_fbk_longitudinalcontrolmodeType
 Llcmotionfeedback120::llc_fbk_longitudinalcontrolmode(const std::uint8_t* bytes,
                                                       int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(4, 2);
+  using Layout = SignalLayout<SignalPiece<0, 4, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Llc_motionfeedback1_20::Llc_fbk_longitudinalcontrolmodeType ret =
       static_cast<Llc_motionfeedback1_20::Llc_fbk_longitudinalcontrolmodeType>(
@@ -294,8 +283,8 @@ Llcmotionfeedback120::llc_fbk_longitudinalcontrolmode(const std::uint8_t* bytes,
 // 'physical_unit': ''}
 Llc_motionfeedback1_20::Llc_fbk_stateType Llcmotionfeedback120::llc_fbk_state(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 4);
+  using Layout = SignalLayout<SignalPiece<0, 0, 4>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Llc_motionfeedback1_20::Llc_fbk_stateType ret =
       static_cast<Llc_motionfeedback1_20::Llc_fbk_stateType>(x);
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace transit {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Llcmotionfeedback221::Llcmotionfeedback221() {}
 const int32_t Llcmotionfeedback221::ID = 0x21;
@@ -56,13 +57,9 @@ void Llcmotionfeedback221::Parse(const std::uint8_t* bytes, int32_t length,
 // 'bit': 32, 'type': 'double', 'order': 'intel', 'physical_unit': 'm/s'}
 double Llcmotionfeedback221::llc_fbk_vehiclespeed(const std::uint8_t* bytes,
                                                   int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 4);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<5, 0, 8>,
+                              SignalPiece<4, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.010000;
   return ret;
@@ -74,8 +71,8 @@ double Llcmotionfeedback221::llc_fbk_vehiclespeed(const std::uint8_t* bytes,
 // '[0|3]', 'bit': 54, 'type': 'int', 'order': 'intel', 'physical_unit': ''}
 int Llcmotionfeedback221::llc_motionfeedback2_counter(const std::uint8_t* bytes,
                                                       int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(6, 2);
+  using Layout = SignalLayout<SignalPiece<6, 6, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -87,8 +84,8 @@ int Llcmotionfeedback221::llc_motionfeedback2_counter(const std::uint8_t* bytes,
 // 'int', 'order': 'intel', 'physical_unit': ''}
 int Llcmotionfeedback221::llc_motionfeedback2_checksum(
     const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<7, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -101,16 +98,9 @@ int Llcmotionfeedback221::llc_motionfeedback2_checksum(
 // 'physical_unit': 'deg/s'}
 double Llcmotionfeedback221::llc_fbk_steeringrate(const std::uint8_t* bytes,
                                                   int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 2);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>,
+                              SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.050000;
   return ret;
@@ -122,16 +112,9 @@ double Llcmotionfeedback221::llc_fbk_steeringrate(const std::uint8_t* bytes,
 // 'type': 'double', 'order': 'intel', 'physical_unit': 'deg'}
 double Llcmotionfeedback221::llc_fbk_steeringangle(const std::uint8_t* bytes,
                                                    int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 0);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
-
-  x <<= 16;
-  x >>= 16;
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>,
+                              SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::UnpackSigned(bytes);
 
   double ret = x * 0.050000;
   return ret;
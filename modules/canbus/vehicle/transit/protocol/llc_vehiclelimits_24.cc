@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace transit {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Llcvehiclelimits24::Llcvehiclelimits24() {}
 const int32_t Llcvehiclelimits24::ID = 0x24;
@@ -46,13 +47,9 @@ void Llcvehiclelimits24::Parse(const std::uint8_t* bytes, int32_t length,
 // 'int', 'order': 'intel', 'physical_unit': 'deg'}
 int Llcvehiclelimits24::llc_fbk_maxsteeringangle(const std::uint8_t* bytes,
                                                  int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(4, 4);
-  x <<= 4;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<1, 4, 4>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -64,13 +61,9 @@ int Llcvehiclelimits24::llc_fbk_maxsteeringangle(const std::uint8_t* bytes,
 // 'double', 'order': 'intel', 'physical_unit': '%'}
 double Llcvehiclelimits24::llc_fbk_maxbrakepercent(const std::uint8_t* bytes,
                                                    int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 4);
-
-  Byte t1(bytes + 0);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<1, 0, 4>,
+                              SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace transit {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Llcvehiclestatus25::Llcvehiclestatus25() {}
 const int32_t Llcvehiclestatus25::ID = 0x25;
@@ -43,8 +44,8 @@ void Llcvehiclestatus25::Parse(const std::uint8_t* bytes, int32_t length,
 // 'intel', 'physical_unit': 'Volt'}
 double Llcvehiclestatus25::llc_fbk_12voltage(const std::uint8_t* bytes,
                                              int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.100000;
   return ret;
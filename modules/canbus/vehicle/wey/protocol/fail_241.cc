@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace wey {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Fail241::Fail241() {}
 const int32_t Fail241::ID = 0x241;
@@ -50,8 +51,8 @@ void Fail241::Parse(const std::uint8_t* bytes, int32_t length,
 // 'bit': 7, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Fail_241::EngfailType Fail241::engfail(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(7, 1);
+  using Layout = SignalLayout<SignalPiece<0, 7, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Fail_241::EngfailType ret =  static_cast<Fail_241::EngfailType>(x);
   return ret;
@@ -63,8 +64,8 @@ Fail_241::EngfailType Fail241::engfail(
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Fail_241::EspfailType Fail241::espfail(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<1, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Fail_241::EspfailType ret =  static_cast<Fail_241::EspfailType>(x);
   return ret;
@@ -77,8 +78,8 @@ Fail_241::EspfailType Fail241::espfail(
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Fail_241::EpbfailType Fail241::epbfail(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(2, 2);
+  using Layout = SignalLayout<SignalPiece<4, 2, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Fail_241::EpbfailType ret =  static_cast<Fail_241::EpbfailType>(x);
   return ret;
@@ -94,8 +95,8 @@ Fail_241::EpbfailType Fail241::epbfail(
 // 'physical_unit': ''}
 Fail_241::ShiftfailType Fail241::shiftfail(
                            const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(4, 4);
+  using Layout = SignalLayout<SignalPiece<3, 4, 4>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Fail_241::ShiftfailType ret =  static_cast<Fail_241::ShiftfailType>(x);
   return ret;
@@ -108,8 +109,8 @@ Fail_241::ShiftfailType Fail241::shiftfail(
 // 'physical_unit': ''}
 Fail_241::EpsfailType Fail241::epsfail(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<2, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Fail_241::EpsfailType ret =  static_cast<Fail_241::EpsfailType>(x);
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace wey {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Fbs1243::Fbs1243() {}
 const int32_t Fbs1243::ID = 0x243;
@@ -50,13 +51,9 @@ void Fbs1243::Parse(const std::uint8_t* bytes, int32_t length,
 // 'order': 'motorola', 'physical_unit': 'm/s^2'}
 double Fbs1243::longitudeacce(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.000980 + -21.592000;
   return ret;
@@ -68,13 +65,9 @@ double Fbs1243::longitudeacce(const std::uint8_t* bytes,
 // 'type': 'double', 'order': 'motorola', 'physical_unit': 'm/s^2'}
 double Fbs1243::lateralacce(const std::uint8_t* bytes,
                                        int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.000980 + -21.592000;
   return ret;
@@ -86,13 +79,9 @@ double Fbs1243::lateralacce(const std::uint8_t* bytes,
 // 'order': 'motorola', 'physical_unit': 'rad/s'}
 double Fbs1243::vehdynyawrate(const std::uint8_t* bytes,
                                          int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.000240 + -2.093000;
   return ret;
@@ -103,13 +92,9 @@ double Fbs1243::vehdynyawrate(const std::uint8_t* bytes,
 // False, 'physical_range': '[0|299.98125]', 'bit': 55, 'type': 'double',
 // 'order': 'motorola', 'physical_unit': 'Km/h'}
 double Fbs1243::flwheelspd(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 7);
-  int32_t t = t1.get_byte(3, 5);
-  x <<= 5;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<6, 0, 8>,
+                              SignalPiece<7, 3, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.056250;
   return ret;
@@ -123,8 +108,8 @@ double Fbs1243::flwheelspd(const std::uint8_t* bytes, int32_t length) const {
 // 'order': 'motorola', 'physical_unit': ''}
 Fbs1_243::FrwheeldirectionType Fbs1243::frwheeldirection(
                            const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(0, 2);
+  using Layout = SignalLayout<SignalPiece<7, 0, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Fbs1_243::FrwheeldirectionType ret =
                           static_cast<Fbs1_243::FrwheeldirectionType>(x);
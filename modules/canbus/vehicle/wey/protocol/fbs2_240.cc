@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace wey {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Fbs2240::Fbs2240() {}
 const int32_t Fbs2240::ID = 0x240;
@@ -57,8 +58,8 @@ void Fbs2240::Parse(const std::uint8_t* bytes, int32_t length,
 // 'bit': 57, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Fbs2_240::FlwheeldirectionType Fbs2240::flwheeldirection(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(0, 2);
+  using Layout = SignalLayout<SignalPiece<7, 0, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Fbs2_240::FlwheeldirectionType ret = static_cast<
                                         Fbs2_240::FlwheeldirectionType>(x);
@@ -70,13 +71,9 @@ Fbs2_240::FlwheeldirectionType Fbs2240::flwheeldirection(
 // 'is_signed_var': False, 'physical_range': '[0|299.98125]', 'bit': 7,
 // 'type': 'double', 'order': 'motorola', 'physical_unit': 'Km/h'}
 double Fbs2240::frwheelspd(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(3, 5);
-  x <<= 5;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 3, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.056250;
   return ret;
@@ -90,8 +87,8 @@ double Fbs2240::frwheelspd(const std::uint8_t* bytes, int32_t length) const {
 // 'bit': 9, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Fbs2_240::RlwheeldrivedirectionType Fbs2240::rlwheeldrivedirection(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 2);
+  using Layout = SignalLayout<SignalPiece<1, 0, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Fbs2_240::RlwheeldrivedirectionType ret = static_cast<
                                       Fbs2_240::RlwheeldrivedirectionType>(x);
@@ -103,13 +100,9 @@ Fbs2_240::RlwheeldrivedirectionType Fbs2240::rlwheeldrivedirection(
 // 'physical_range': '[0|299.98125]', 'bit': 23, 'type': 'double',
 // 'order': 'motorola', 'physical_unit': 'Km/h'}
 double Fbs2240::rlwheelspd(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 3);
-  int32_t t = t1.get_byte(3, 5);
-  x <<= 5;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>,
+                              SignalPiece<3, 3, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.056250;
   return ret;
@@ -123,8 +116,8 @@ double Fbs2240::rlwheelspd(const std::uint8_t* bytes, int32_t length) const {
 // 'physical_unit': ''}
 Fbs2_240::RrwheeldirectionType Fbs2240::rrwheeldirection(
                              const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 2);
+  using Layout = SignalLayout<SignalPiece<3, 0, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Fbs2_240::RrwheeldirectionType ret =
                                 static_cast<Fbs2_240::RrwheeldirectionType>(x);
@@ -136,13 +129,9 @@ Fbs2_240::RrwheeldirectionType Fbs2240::rrwheeldirection(
 // 'physical_range': '[0|299.98125]', 'bit': 39, 'type': 'double',
 // 'order': 'motorola', 'physical_unit': 'Km/h'}
 double Fbs2240::rrwheelspd(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(3, 5);
-  x <<= 5;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 3, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.056250;
   return ret;
@@ -153,13 +142,9 @@ double Fbs2240::rrwheelspd(const std::uint8_t* bytes, int32_t length) const {
 // 'is_signed_var': False, 'physical_range': '[0|299.98125]', 'bit': 55,
 // 'type': 'double', 'order': 'motorola', 'physical_unit': 'Km/h'}
 double Fbs2240::vehiclespd(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 7);
-  int32_t t = t1.get_byte(3, 5);
-  x <<= 5;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<6, 0, 8>,
+                              SignalPiece<7, 3, 5>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.056250;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace wey {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Fbs3237::Fbs3237() {}
 const int32_t Fbs3237::ID = 0x237;
@@ -58,13 +59,9 @@ void Fbs3237::Parse(const std::uint8_t* bytes, int32_t length,
 // 'physical_range': '[0|8198.875]', 'bit': 7, 'type': 'double',
 // 'order': 'motorola', 'physical_unit': 'rpm'}
 double Fbs3237::engspd(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 1);
-  int32_t t = t1.get_byte(0, 8);
-  x <<= 8;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>,
+                              SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.125000;
   return ret;
@@ -75,8 +72,8 @@ double Fbs3237::engspd(const std::uint8_t* bytes, int32_t length) const {
 // 'physical_range': '[0|100.3935]', 'bit': 23, 'type': 'double',
 // 'order': 'motorola', 'physical_unit': '%'}
 double Fbs3237::accpedalpos(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.393700;
   return ret;
@@ -90,8 +87,8 @@ double Fbs3237::accpedalpos(const std::uint8_t* bytes, int32_t length) const {
 // 'enum', 'order': 'motorola', 'physical_unit': ''}
 Fbs3_237::EpbswtichpositionType Fbs3237::epbswtichposition(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(6, 2);
+  using Layout = SignalLayout<SignalPiece<3, 6, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Fbs3_237::EpbswtichpositionType ret =
                              static_cast<Fbs3_237::EpbswtichpositionType>(x);
@@ -105,8 +102,8 @@ Fbs3_237::EpbswtichpositionType Fbs3237::epbswtichposition(
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Fbs3_237::CurrentgearType Fbs3237::currentgear(
                          const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(6, 2);
+  using Layout = SignalLayout<SignalPiece<4, 6, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Fbs3_237::CurrentgearType ret =  static_cast<Fbs3_237::CurrentgearType>(x);
   return ret;
@@ -123,8 +120,8 @@ Fbs3_237::CurrentgearType Fbs3237::currentgear(
 // 'order': 'motorola', 'physical_unit': ''}
 Fbs3_237::Eps_streeingmodeType Fbs3237::eps_streeingmode(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 3);
+  using Layout = SignalLayout<SignalPiece<4, 0, 3>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Fbs3_237::Eps_streeingmodeType ret =
                             static_cast<Fbs3_237::Eps_streeingmodeType>(x);
@@ -137,8 +134,8 @@ Fbs3_237::Eps_streeingmodeType Fbs3237::eps_streeingmode(
 // 'type': 'double', 'order': 'motorola', 'physical_unit': 'Nm'}
 double Fbs3237::epsdrvinputtrqvalue(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<5, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.179400 + -22.780000;
   return ret;
@@ -150,8 +147,8 @@ double Fbs3237::epsdrvinputtrqvalue(
 // 'type': 'double', 'order': 'motorola', 'physical_unit': 'A'}
 double Fbs3237::epsconsumedcurrvalue(
                            const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<6, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.500000;
   return ret;
@@ -166,8 +163,8 @@ double Fbs3237::epsconsumedcurrvalue(
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Fbs3_237::EpscurrmodType Fbs3237::epscurrmod(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(3, 3);
+  using Layout = SignalLayout<SignalPiece<7, 3, 3>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Fbs3_237::EpscurrmodType ret =  static_cast<Fbs3_237::EpscurrmodType>(x);
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace wey {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Fbs4235::Fbs4235() {}
 const int32_t Fbs4235::ID = 0x235;
@@ -44,13 +45,9 @@ void Fbs4235::Parse(const std::uint8_t* bytes, int32_t length,
 // 'type': 'double', 'order': 'motorola', 'physical_unit': '\xa1\xe3'}
 double Fbs4235::steerwheelangle(
                         const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 2);
-  int32_t t = t1.get_byte(1, 7);
-  x <<= 7;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>,
+                              SignalPiece<2, 1, 7>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.100000;
   return ret;
@@ -62,13 +59,9 @@ double Fbs4235::steerwheelangle(
 // 'type': 'double', 'order': 'motorola', 'physical_unit': '\xa1\xe3/s'}
 double Fbs4235::steerwheelspd(
                        const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
-
-  Byte t1(bytes + 5);
-  int32_t t = t1.get_byte(1, 7);
-  x <<= 7;
-  x |= t;
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>,
+                              SignalPiece<5, 1, 7>>;
+  int32_t x = Layout::Unpack(bytes);
 
   double ret = x * 0.100000;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace wey {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Status310::Status310() {}
 const int32_t Status310::ID = 0x310;
@@ -114,8 +115,8 @@ void Status310::Parse(const std::uint8_t* bytes, int32_t length,
 // 'order': 'motorola', 'physical_unit': ''}
 Status_310::LongitudeaccvalidType Status310::longitudeaccvalid(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(7, 1);
+  using Layout = SignalLayout<SignalPiece<1, 7, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::LongitudeaccvalidType ret =
                           static_cast<Status_310::LongitudeaccvalidType>(x);
@@ -129,8 +130,8 @@ Status_310::LongitudeaccvalidType Status310::longitudeaccvalid(
 // 'order': 'motorola', 'physical_unit': ''}
 Status_310::LateralaccevalidType Status310::lateralaccevalid(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(7, 1);
+  using Layout = SignalLayout<SignalPiece<0, 7, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::LateralaccevalidType ret =
                               static_cast<Status_310::LateralaccevalidType>(x);
@@ -144,8 +145,8 @@ Status_310::LateralaccevalidType Status310::lateralaccevalid(
 // 'order': 'motorola', 'physical_unit': ''}
 Status_310::VehdynyawratevalidType Status310::vehdynyawratevalid(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<0, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::VehdynyawratevalidType ret =
                             static_cast<Status_310::VehdynyawratevalidType>(x);
@@ -159,8 +160,8 @@ Status_310::VehdynyawratevalidType Status310::vehdynyawratevalid(
 // 'order': 'motorola', 'physical_unit': ''}
 Status_310::FlwheelspdvalidType Status310::flwheelspdvalid(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<0, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::FlwheelspdvalidType ret =
                               static_cast<Status_310::FlwheelspdvalidType>(x);
@@ -174,8 +175,8 @@ Status_310::FlwheelspdvalidType Status310::flwheelspdvalid(
 // 'order': 'motorola', 'physical_unit': ''}
 Status_310::FrwheelspdvalidType Status310::frwheelspdvalid(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<6, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::FrwheelspdvalidType ret =
                             static_cast<Status_310::FrwheelspdvalidType>(x);
@@ -189,8 +190,8 @@ Status_310::FrwheelspdvalidType Status310::frwheelspdvalid(
 // 'physical_unit': ''}
 Status_310::RlwheelspdvalidType Status310::rlwheelspdvalid(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<0, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::RlwheelspdvalidType ret =
                             static_cast<Status_310::RlwheelspdvalidType>(x);
@@ -204,8 +205,8 @@ Status_310::RlwheelspdvalidType Status310::rlwheelspdvalid(
 // 'physical_unit': ''}
 Status_310::RrwheelspdvalidType Status310::rrwheelspdvalid(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<0, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::RrwheelspdvalidType ret =
                             static_cast<Status_310::RrwheelspdvalidType>(x);
@@ -219,8 +220,8 @@ Status_310::RrwheelspdvalidType Status310::rrwheelspdvalid(
 // '[0|1]', 'bit': 0, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Status_310::VehiclespdvalidType Status310::vehiclespdvalid(
                              const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<0, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::VehiclespdvalidType ret =
                              static_cast<Status_310::VehiclespdvalidType>(x);
@@ -238,8 +239,8 @@ Status_310::VehiclespdvalidType Status310::vehiclespdvalid(
 // 'physical_unit': ''}
 Status_310::LongitudedrivingmodeType Status310::longitudedrivingmode(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(5, 2);
+  using Layout = SignalLayout<SignalPiece<1, 5, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::LongitudedrivingmodeType ret =
                           static_cast<Status_310::LongitudedrivingmodeType>(x);
@@ -253,8 +254,8 @@ Status_310::LongitudedrivingmodeType Status310::longitudedrivingmode(
 // 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Status_310::EngspdvalidType Status310::engspdvalid(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(3, 2);
+  using Layout = SignalLayout<SignalPiece<1, 3, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::EngspdvalidType ret =
                           static_cast<Status_310::EngspdvalidType>(x);
@@ -268,8 +269,8 @@ Status_310::EngspdvalidType Status310::engspdvalid(
 // 'order': 'motorola', 'physical_unit': ''}
 Status_310::AccepedaloverrideType Status310::accepedaloverride(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<2, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::AccepedaloverrideType ret =
                           static_cast<Status_310::AccepedaloverrideType>(x);
@@ -285,8 +286,8 @@ Status_310::AccepedaloverrideType Status310::accepedaloverride(
 // 'bit': 9, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Status_310::BrakepedalstatusType Status310::brakepedalstatus(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 2);
+  using Layout = SignalLayout<SignalPiece<1, 0, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::BrakepedalstatusType ret =
                             static_cast<Status_310::BrakepedalstatusType>(x);
@@ -300,8 +301,8 @@ Status_310::BrakepedalstatusType Status310::brakepedalstatus(
 // 'order': 'motorola', 'physical_unit': ''}
 Status_310::EspbrakelightstsType Status310::espbrakelightsts(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<3, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::EspbrakelightstsType ret =
                             static_cast<Status_310::EspbrakelightstsType>(x);
@@ -315,8 +316,8 @@ Status_310::EspbrakelightstsType Status310::espbrakelightsts(
 // 'bit': 20, 'type': 'enum', 'order': 'motorola', 'physical_unit': ''}
 Status_310::EpbswtpositionvalidType Status310::epbswtpositionvalid(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<2, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::EpbswtpositionvalidType ret =
                           static_cast<Status_310::EpbswtpositionvalidType>(x);
@@ -330,8 +331,8 @@ Status_310::EpbswtpositionvalidType Status310::epbswtpositionvalid(
 // 'order': 'motorola', 'physical_unit': ''}
 Status_310::EpbstsType Status310::epbsts(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(1, 2);
+  using Layout = SignalLayout<SignalPiece<2, 1, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::EpbstsType ret =  static_cast<Status_310::EpbstsType>(x);
   return ret;
@@ -344,8 +345,8 @@ Status_310::EpbstsType Status310::epbsts(
 // 'enum', 'order': 'motorola', 'physical_unit': ''}
 Status_310::CurrentgearvalidType Status310::currentgearvalid(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<3, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::CurrentgearvalidType ret =
                             static_cast<Status_310::CurrentgearvalidType>(x);
@@ -359,8 +360,8 @@ Status_310::CurrentgearvalidType Status310::currentgearvalid(
 // 'physical_unit': ''}
 Status_310::EpstrqsnsrstsType Status310::epstrqsnsrsts(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(7, 1);
+  using Layout = SignalLayout<SignalPiece<3, 7, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::EpstrqsnsrstsType ret =
                                 static_cast<Status_310::EpstrqsnsrstsType>(x);
@@ -375,8 +376,8 @@ Status_310::EpstrqsnsrstsType Status310::epstrqsnsrsts(
 // 'physical_unit': ''}
 Status_310::Eps_interferdetdvalidType Status310::eps_interferdetdvalid(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<4, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::Eps_interferdetdvalidType ret =
                          static_cast<Status_310::Eps_interferdetdvalidType>(x);
@@ -391,8 +392,8 @@ Status_310::Eps_interferdetdvalidType Status310::eps_interferdetdvalid(
 // 'physical_unit': ''}
 Status_310::EpshandsdetnstsType Status310::epshandsdetnsts(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<3, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::EpshandsdetnstsType ret =
                             static_cast<Status_310::EpshandsdetnstsType>(x);
@@ -407,8 +408,8 @@ Status_310::EpshandsdetnstsType Status310::epshandsdetnsts(
 // 'physical_unit': ''}
 Status_310::Eps_handsdetnstsvalidType Status310::eps_handsdetnstsvalid(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(2, 1);
+  using Layout = SignalLayout<SignalPiece<4, 2, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::Eps_handsdetnstsvalidType ret =
                          static_cast<Status_310::Eps_handsdetnstsvalidType>(x);
@@ -423,8 +424,8 @@ Status_310::Eps_handsdetnstsvalidType Status310::eps_handsdetnstsvalid(
 // 'physical_unit': ''}
 Status_310::SteerwheelanglesignType Status310::steerwheelanglesign(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<4, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::SteerwheelanglesignType ret =
                           static_cast<Status_310::SteerwheelanglesignType>(x);
@@ -438,8 +439,8 @@ Status_310::SteerwheelanglesignType Status310::steerwheelanglesign(
 // 'order': 'motorola', 'physical_unit': ''}
 Status_310::SteerwheelspdsignType Status310::steerwheelspdsign(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<5, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::SteerwheelspdsignType ret =
                           static_cast<Status_310::SteerwheelspdsignType>(x);
@@ -453,8 +454,8 @@ Status_310::SteerwheelspdsignType Status310::steerwheelspdsign(
 // 'physical_unit': ''}
 Status_310::DriverdoorstsType Status310::driverdoorsts(
                            const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(7, 1);
+  using Layout = SignalLayout<SignalPiece<5, 7, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::DriverdoorstsType ret =
                            static_cast<Status_310::DriverdoorstsType>(x);
@@ -468,8 +469,8 @@ Status_310::DriverdoorstsType Status310::driverdoorsts(
 // 'physical_unit': ''}
 Status_310::RldoorstsType Status310::rldoorsts(
                            const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<6, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::RldoorstsType ret =  static_cast<Status_310::RldoorstsType>(x);
   return ret;
@@ -482,8 +483,8 @@ Status_310::RldoorstsType Status310::rldoorsts(
 // 'physical_unit': ''}
 Status_310::PassengerdoorstsType Status310::passengerdoorsts(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(5, 1);
+  using Layout = SignalLayout<SignalPiece<5, 5, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::PassengerdoorstsType ret =
                             static_cast<Status_310::PassengerdoorstsType>(x);
@@ -496,8 +497,8 @@ Status_310::PassengerdoorstsType Status310::passengerdoorsts(
 // '[0|1]', 'bit': 44, 'type': 'enum', 'order': 'motorola', 'physical_unit':''}
 Status_310::RrdoorstsType Status310::rrdoorsts(
                             const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<5, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::RrdoorstsType ret =  static_cast<Status_310::RrdoorstsType>(x);
   return ret;
@@ -510,8 +511,8 @@ Status_310::RrdoorstsType Status310::rrdoorsts(
 // '[0|3]', 'bit': 43, 'type': 'enum', 'order': 'motorola', 'physical_unit':''}
 Status_310::FrontfoglmpstsType Status310::frontfoglmpsts(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(2, 2);
+  using Layout = SignalLayout<SignalPiece<5, 2, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::FrontfoglmpstsType ret =
                           static_cast<Status_310::FrontfoglmpstsType>(x);
@@ -525,8 +526,8 @@ Status_310::FrontfoglmpstsType Status310::frontfoglmpsts(
 // 'physical_unit': ''}
 Status_310::RearfoglmpstsType Status310::rearfoglmpsts(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(3, 1);
+  using Layout = SignalLayout<SignalPiece<6, 3, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::RearfoglmpstsType ret =
                           static_cast<Status_310::RearfoglmpstsType>(x);
@@ -540,8 +541,8 @@ Status_310::RearfoglmpstsType Status310::rearfoglmpsts(
 // 'physical_unit': ''}
 Status_310::LowbeamstsType Status310::lowbeamsts(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(1, 1);
+  using Layout = SignalLayout<SignalPiece<6, 1, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::LowbeamstsType ret =  static_cast<Status_310::LowbeamstsType>(x);
   return ret;
@@ -554,8 +555,8 @@ Status_310::LowbeamstsType Status310::lowbeamsts(
 // 'physical_unit': ''}
 Status_310::HighbeamstsType Status310::highbeamsts(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(7, 1);
+  using Layout = SignalLayout<SignalPiece<7, 7, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::HighbeamstsType ret = static_cast<Status_310::HighbeamstsType>(x);
   return ret;
@@ -568,8 +569,8 @@ Status_310::HighbeamstsType Status310::highbeamsts(
 // 'physical_unit': ''}
 Status_310::LeftturnlampstsType Status310::leftturnlampsts(
                            const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(6, 1);
+  using Layout = SignalLayout<SignalPiece<7, 6, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::LeftturnlampstsType ret =
                            static_cast<Status_310::LeftturnlampstsType>(x);
@@ -583,8 +584,8 @@ Status_310::LeftturnlampstsType Status310::leftturnlampsts(
 // 'physical_unit': ''}
 Status_310::RightturnlampstsType Status310::rightturnlampsts(
                            const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(4, 1);
+  using Layout = SignalLayout<SignalPiece<7, 4, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::RightturnlampstsType ret =
                           static_cast<Status_310::RightturnlampstsType>(x);
@@ -599,8 +600,8 @@ Status_310::RightturnlampstsType Status310::rightturnlampsts(
 // 'physical_unit': ''}
 Status_310::Bcm_availstsType Status310::bcm_availsts(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(1, 2);
+  using Layout = SignalLayout<SignalPiece<7, 1, 2>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::Bcm_availstsType ret =
                           static_cast<Status_310::Bcm_availstsType>(x);
@@ -614,8 +615,8 @@ Status_310::Bcm_availstsType Status310::bcm_availsts(
 // 'physical_unit': ''}
 Status_310::BrakelmpstsType Status310::brakelmpsts(
                           const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(0, 1);
+  using Layout = SignalLayout<SignalPiece<7, 0, 1>>;
+  int32_t x = Layout::Unpack(bytes);
 
   Status_310::BrakelmpstsType ret = static_cast<Status_310::BrakelmpstsType>(x);
   return ret;
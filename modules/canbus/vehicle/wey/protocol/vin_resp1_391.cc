@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace wey {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Vinresp1391::Vinresp1391() {}
 const int32_t Vinresp1391::ID = 0x391;
@@ -54,8 +55,8 @@ void Vinresp1391::Parse(const std::uint8_t* bytes, int32_t length,
 // 'is_signed_var': False, 'physical_range': '[0|255]', 'bit': 7, 'type':'int',
 // 'order': 'motorola', 'physical_unit': ''}
 int Vinresp1391::vin07(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -65,8 +66,8 @@ int Vinresp1391::vin07(const std::uint8_t* bytes, int32_t length) const {
 // 'is_signed_var': False, 'physical_range': '[0|255]', 'bit': 15,'type':'int',
 // 'order': 'motorola', 'physical_unit': ''}
 int Vinresp1391::vin06(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 1);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<1, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -76,8 +77,8 @@ int Vinresp1391::vin06(const std::uint8_t* bytes, int32_t length) const {
 // 'is_signed_var': False, 'physical_range': '[0|255]', 'bit': 23,'type':'int',
 // 'order': 'motorola', 'physical_unit': ''}
 int Vinresp1391::vin05(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 2);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<2, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -87,8 +88,8 @@ int Vinresp1391::vin05(const std::uint8_t* bytes, int32_t length) const {
 // 'is_signed_var': False, 'physical_range': '[0|255]', 'bit': 31,'type':'int',
 // 'order': 'motorola', 'physical_unit': ''}
 int Vinresp1391::vin04(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 3);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<3, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -98,8 +99,8 @@ int Vinresp1391::vin04(const std::uint8_t* bytes, int32_t length) const {
 // 'is_signed_var': False, 'physical_range': '[0|255]', 'bit': 39,'type':'int',
 // 'order': 'motorola', 'physical_unit': ''}
 int Vinresp1391::vin03(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 4);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<4, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -109,8 +110,8 @@ int Vinresp1391::vin03(const std::uint8_t* bytes, int32_t length) const {
 // 'is_signed_var': False, 'physical_range': '[0|255]', 'bit': 47,'type':'int',
 // 'order': 'motorola', 'physical_unit': ''}
 int Vinresp1391::vin02(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 5);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<5, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -120,8 +121,8 @@ int Vinresp1391::vin02(const std::uint8_t* bytes, int32_t length) const {
 // 'is_signed_var': False, 'physical_range': '[0|255]', 'bit': 63,'type':'int',
 // 'order': 'motorola', 'physical_unit': ''}
 int Vinresp1391::vin00(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 7);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<7, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -131,8 +132,8 @@ int Vinresp1391::vin00(const std::uint8_t* bytes, int32_t length) const {
 // 'is_signed_var': False, 'physical_range': '[0|255]', 'bit': 55,'type':'int',
 // 'order': 'motorola', 'physical_unit': ''}
 int Vinresp1391::vin01(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 6);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<6, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
@@ -18,14 +18,15 @@
 
 #include "glog/logging.h"
 
-#include "modules/drivers/canbus/common/byte.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
+#include "modules/drivers/canbus/common/signal_layout.h"
 
 namespace apollo {
 namespace canbus {
 namespace wey {
 
-using ::apollo::drivers::canbus::Byte;
+using ::apollo::drivers::canbus::SignalLayout;
+using ::apollo::drivers::canbus::SignalPiece;
 
 Vinresp3393::Vinresp3393() {}
 const int32_t Vinresp3393::ID = 0x393;
@@ -40,8 +41,8 @@ void Vinresp3393::Parse(const std::uint8_t* bytes, int32_t length,
 // 'len': 8, 'is_signed_var': False, 'physical_range': '[0|255]',
 // 'bit': 7, 'type': 'int', 'order': 'motorola', 'physical_unit': ''}
 int Vinresp3393::vin16(const std::uint8_t* bytes, int32_t length) const {
-  Byte t0(bytes + 0);
-  int32_t x = t0.get_byte(0, 8);
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>>;
+  int32_t x = Layout::Unpack(bytes);
 
   int ret = x;
   return ret;
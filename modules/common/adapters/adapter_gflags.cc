@@ -83,6 +83,8 @@ DEFINE_string(gnss_status_topic, "/apollo/sensor/gnss/gnss_status",
               "gnss status topic name");
 DEFINE_string(system_status_topic, "/apollo/monitor/system_status",
               "System status topic name");
+DEFINE_string(resource_usage_topic, "/apollo/monitor/resource_usage",
+              "Resource usage topic name");
 DEFINE_string(static_info_topic, "/apollo/monitor/static_info",
               "Static info topic name");
 DEFINE_string(mobileye_topic, "/apollo/sensor/mobileye", "mobileye topic name");
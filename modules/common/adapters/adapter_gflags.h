@@ -50,6 +50,7 @@ DECLARE_string(ins_stat_topic);
 DECLARE_string(ins_status_topic);
 DECLARE_string(gnss_status_topic);
 DECLARE_string(system_status_topic);
+DECLARE_string(resource_usage_topic);
 DECLARE_string(static_info_topic);
 DECLARE_string(mobileye_topic);
 DECLARE_string(delphi_esr_topic);
@@ -34,6 +34,17 @@ DEFINE_string(end_way_point_filename, "default_end_way_point.txt",
 DEFINE_string(speed_control_filename, "speed_control.pb.txt",
               "The speed control region in a map.");
 
+DEFINE_bool(enable_hdmap_query_cache, false,
+            "Cache the results of the lanes, nearest lane and road boundaries "
+            "radius queries of the HD map.");
+DEFINE_int32(hdmap_query_cache_capacity, 4096,
+             "Number of cached results per query type.");
+DEFINE_int32(hdmap_query_cache_shards, 16,
+             "Number of independently locked shards of the query cache.");
+DEFINE_double(hdmap_query_cache_resolution, 0.05,
+              "Queries whose points and radii round to the same multiple of "
+              "this resolution, in meters, share their cached result.");
+
 DEFINE_string(vehicle_config_path,
               "/apollo/modules/common/data/vehicle_param.pb.txt",
               "the file path of vehicle config file");
@@ -30,6 +30,11 @@ DECLARE_string(routing_map_filename);
 DECLARE_string(end_way_point_filename);
 DECLARE_string(speed_control_filename);
 
+DECLARE_bool(enable_hdmap_query_cache);
+DECLARE_int32(hdmap_query_cache_capacity);
+DECLARE_int32(hdmap_query_cache_shards);
+DECLARE_double(hdmap_query_cache_resolution);
+
 DECLARE_double(look_forward_time_sec);
 
 DECLARE_string(vehicle_config_path);
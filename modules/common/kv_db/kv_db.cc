@@ -17,12 +17,14 @@
 
 #include <sqlite3.h>
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 #include "gflags/gflags.h"
 
 #include "cyber/common/log.h"
-#include "modules/common/util/file.h"
-#include "modules/common/util/string_util.h"
-#include "modules/common/util/util.h"
 
 DEFINE_string(kv_db_path, "/apollo/data/kv_db.sqlite",
               "Path to Key-value DB file.");
@@ -30,95 +32,293 @@ DEFINE_string(kv_db_path, "/apollo/data/kv_db.sqlite",
 namespace apollo {
 namespace common {
 namespace {
-using apollo::common::util::StrCat;
 
-// Self-maintained sqlite instance.
-class SqliteWraper {
+// A write of a key, queued or being committed.
+struct PendingWrite {
+  std::string value;
+  bool deleted = false;
+  uint64_t seq = 0;
+};
+
+// Self-maintained sqlite instance, opened once per process.
+class SqliteStore {
  public:
-  static int Callback(void *data, int argc, char **argv, char **col_name) {
-    if (data != nullptr) {
-      std::string *data_str = static_cast<std::string*>(data);
-      *data_str = argc > 0 ? argv[0] : "";
+  static SqliteStore *Instance() {
+    static SqliteStore store;
+    return &store;
+  }
+
+  ~SqliteStore() {
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex_);
+      stop_ = true;
+    }
+    queue_cv_.notify_all();
+    if (writer_.joinable()) {
+      writer_.join();
+    }
+    for (sqlite3_stmt *stmt : {put_stmt_, delete_stmt_, get_stmt_}) {
+      sqlite3_finalize(stmt);
+    }
+    if (db_ != nullptr) {
+      sqlite3_close(db_);
+    }
+  }
+
+  // Writes now, superseding the queued write of the key if any.
+  bool Write(const std::string &key, const PendingWrite &write) {
+    std::lock_guard<std::mutex> db_lock(db_mutex_);
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex_);
+      queued_.erase(key);
+    }
+    return WriteLocked({{key, write}});
+  }
+
+  bool WriteBatch(
+      const std::vector<std::pair<std::string, PendingWrite>> &writes) {
+    std::lock_guard<std::mutex> db_lock(db_mutex_);
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex_);
+      for (const auto &write : writes) {
+        queued_.erase(write.first);
+      }
+    }
+    return WriteLocked(writes);
+  }
+
+  // Queues a write for the background writer.
+  void Enqueue(const std::string &key, PendingWrite write) {
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex_);
+      write.seq = ++seq_;
+      queued_[key] = std::move(write);
+    }
+    queue_cv_.notify_all();
+  }
+
+  bool Flush() {
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    flushed_cv_.wait(lock, [this] { return queued_.empty(); });
+    const bool ok = !async_failed_;
+    async_failed_ = false;
+    return ok;
+  }
+
+  // Whether the key has a value, queued writes included.
+  bool Read(const std::string &key, std::string *value) {
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex_);
+      auto it = queued_.find(key);
+      if (it != queued_.end()) {
+        *value = it->second.value;
+        return !it->second.deleted;
+      }
+    }
+    std::lock_guard<std::mutex> db_lock(db_mutex_);
+    if (get_stmt_ == nullptr) {
+      return false;
+    }
+    sqlite3_bind_text(get_stmt_, 1, key.data(), static_cast<int>(key.size()),
+                      SQLITE_STATIC);
+    const int ret = sqlite3_step(get_stmt_);
+    bool found = false;
+    if (ret == SQLITE_ROW) {
+      const char *text =
+          reinterpret_cast<const char *>(sqlite3_column_text(get_stmt_, 0));
+      value->assign(text == nullptr ? "" : text,
+                    sqlite3_column_bytes(get_stmt_, 0));
+      found = true;
+    } else if (ret != SQLITE_DONE) {
+      AERROR << "Failed to query key " << key << ": " << sqlite3_errmsg(db_);
     }
-    return 0;
+    sqlite3_reset(get_stmt_);
+    sqlite3_clear_bindings(get_stmt_);
+    return found;
   }
 
-  SqliteWraper() {
+ private:
+  SqliteStore() {
     // Open DB.
-    if (sqlite3_open(FLAGS_kv_db_path.c_str(), &db_) != 0) {
+    if (sqlite3_open(FLAGS_kv_db_path.c_str(), &db_) != SQLITE_OK) {
       AERROR << "Can't open Key-Value database: " << sqlite3_errmsg(db_);
-      Release();
+      sqlite3_close(db_);
+      db_ = nullptr;
       return;
     }
+    // Other processes may hold the DB for a moment, and the write ahead log
+    // lets them read while a write is committed.
+    sqlite3_busy_timeout(db_, kBusyTimeoutMs);
+    Exec("PRAGMA journal_mode=WAL;");
+    Exec("PRAGMA synchronous=NORMAL;");
 
     // Create table if it doesn't exist.
     static const char *kCreateTableSql =
         "CREATE TABLE IF NOT EXISTS key_value "
         "(key VARCHAR(128) PRIMARY KEY NOT NULL, value TEXT);";
-    if (!SQL(kCreateTableSql)) {
-      Release();
+    if (!Exec(kCreateTableSql) ||
+        !Prepare("INSERT OR REPLACE INTO key_value (key, value) "
+                 "VALUES (?1, ?2);",
+                 &put_stmt_) ||
+        !Prepare("DELETE FROM key_value WHERE key=?1;", &delete_stmt_) ||
+        !Prepare("SELECT value FROM key_value WHERE key=?1;", &get_stmt_)) {
+      return;
     }
+    writer_ = std::thread(&SqliteStore::WriterLoop, this);
   }
 
-  ~SqliteWraper() { Release(); }
-
-  bool SQL(const std::string &sql, std::string *value = nullptr) {
-    AINFO << "Executing SQL: " << sql;
-    if (db_ == nullptr) {
-      AERROR << "DB is not open properly.";
+  bool Exec(const char *sql) {
+    char *error = nullptr;
+    if (sqlite3_exec(db_, sql, nullptr, nullptr, &error) != SQLITE_OK) {
+      AERROR << "Failed to execute SQL " << sql << ": " << error;
+      sqlite3_free(error);
       return false;
     }
+    return true;
+  }
 
-    char *error = nullptr;
-    if (sqlite3_exec(db_, sql.c_str(), Callback, value, &error) != SQLITE_OK) {
-      AERROR << "Failed to execute SQL: " << error;
-      sqlite3_free(error);
+  bool Prepare(const char *sql, sqlite3_stmt **stmt) {
+    if (sqlite3_prepare_v2(db_, sql, -1, stmt, nullptr) != SQLITE_OK) {
+      AERROR << "Failed to prepare SQL " << sql << ": " << sqlite3_errmsg(db_);
       return false;
     }
     return true;
   }
 
- private:
-  void Release() {
-    if (db_ != nullptr) {
-      sqlite3_close(db_);
-      db_ = nullptr;
+  // Writes in one transaction, with db_mutex_ held.
+  bool WriteLocked(
+      const std::vector<std::pair<std::string, PendingWrite>> &writes) {
+    if (put_stmt_ == nullptr || delete_stmt_ == nullptr) {
+      AERROR << "DB is not open properly.";
+      return false;
+    }
+    const bool transaction = writes.size() > 1;
+    if (transaction && !Exec("BEGIN;")) {
+      return false;
+    }
+    bool ok = true;
+    for (const auto &write : writes) {
+      const std::string &key = write.first;
+      sqlite3_stmt *stmt = write.second.deleted ? delete_stmt_ : put_stmt_;
+      sqlite3_bind_text(stmt, 1, key.data(), static_cast<int>(key.size()),
+                        SQLITE_STATIC);
+      if (!write.second.deleted) {
+        sqlite3_bind_text(stmt, 2, write.second.value.data(),
+                          static_cast<int>(write.second.value.size()),
+                          SQLITE_STATIC);
+      }
+      if (sqlite3_step(stmt) != SQLITE_DONE) {
+        AERROR << "Failed to write key " << key << ": "
+               << sqlite3_errmsg(db_);
+        ok = false;
+      }
+      sqlite3_reset(stmt);
+      sqlite3_clear_bindings(stmt);
+    }
+    if (transaction) {
+      ok = Exec(ok ? "COMMIT;" : "ROLLBACK;") && ok;
+    }
+    return ok;
+  }
+
+  // Commits the queued writes in batches.
+  void WriterLoop() {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        queue_cv_.wait(lock, [this] { return !queued_.empty() || stop_; });
+        if (queued_.empty()) {
+          break;
+        }
+      }
+      std::lock_guard<std::mutex> db_lock(db_mutex_);
+      std::vector<std::pair<std::string, PendingWrite>> batch;
+      {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        batch.assign(queued_.begin(), queued_.end());
+      }
+      const bool ok = WriteLocked(batch);
+      {
+        // keys written again meanwhile stay queued
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        for (const auto &write : batch) {
+          auto it = queued_.find(write.first);
+          if (it != queued_.end() && it->second.seq == write.second.seq) {
+            queued_.erase(it);
+          }
+        }
+        async_failed_ = async_failed_ || !ok;
+      }
+      flushed_cv_.notify_all();
     }
   }
 
+  static constexpr int kBusyTimeoutMs = 1000;
+
+  // db_mutex_ is taken before queue_mutex_ when both are held
+  std::mutex db_mutex_;
   sqlite3 *db_ = nullptr;
+  sqlite3_stmt *put_stmt_ = nullptr;
+  sqlite3_stmt *delete_stmt_ = nullptr;
+  sqlite3_stmt *get_stmt_ = nullptr;
+
+  std::mutex queue_mutex_;
+  std::condition_variable queue_cv_;
+  std::condition_variable flushed_cv_;
+  std::unordered_map<std::string, PendingWrite> queued_;
+  uint64_t seq_ = 0;
+  bool async_failed_ = false;
+  bool stop_ = false;
+  std::thread writer_;
 };
 
 }  // namespace
 
-bool KVDB::Put(const std::string &key, const std::string &value) {
-  SqliteWraper sqlite;
-  return sqlite.SQL(StrCat("INSERT OR REPLACE INTO key_value (key, value) "
-                           "VALUES ('", key, "', '", value, "');"));
+bool KVDB::Put(const std::string &key, const std::string &value,
+               const bool sync) {
+  PendingWrite write;
+  write.value = value;
+  if (!sync) {
+    SqliteStore::Instance()->Enqueue(key, std::move(write));
+    return true;
+  }
+  return SqliteStore::Instance()->Write(key, write);
 }
 
-bool KVDB::Delete(const std::string &key) {
-  SqliteWraper sqlite;
-  return sqlite.SQL(StrCat("DELETE FROM key_value WHERE key='", key, "';"));
+bool KVDB::PutBatch(
+    const std::vector<std::pair<std::string, std::string>> &key_values) {
+  std::vector<std::pair<std::string, PendingWrite>> writes(key_values.size());
+  for (size_t i = 0; i < key_values.size(); ++i) {
+    writes[i].first = key_values[i].first;
+    writes[i].second.value = key_values[i].second;
+  }
+  return SqliteStore::Instance()->WriteBatch(writes);
+}
+
+bool KVDB::Delete(const std::string &key, const bool sync) {
+  PendingWrite write;
+  write.deleted = true;
+  if (!sync) {
+    SqliteStore::Instance()->Enqueue(key, std::move(write));
+    return true;
+  }
+  return SqliteStore::Instance()->Write(key, write);
 }
 
 bool KVDB::Has(const std::string &key) {
-  SqliteWraper sqlite;
   std::string value;
-  const bool ret = sqlite.SQL(
-      StrCat("SELECT value FROM key_value WHERE key='", key, "';"), &value);
   // Take empty field as non-exist.
-  return ret && !value.empty();
+  return SqliteStore::Instance()->Read(key, &value) && !value.empty();
 }
 
 std::string KVDB::Get(const std::string &key,
                       const std::string &default_value) {
-  SqliteWraper sqlite;
   std::string value;
-  const bool ret = sqlite.SQL(
-      StrCat("SELECT value FROM key_value WHERE key='", key, "';"), &value);
+  const bool ret = SqliteStore::Instance()->Read(key, &value);
   return (ret && !value.empty()) ? value : default_value;
 }
 
+bool KVDB::Flush() { return SqliteStore::Instance()->Flush(); }
+
 }  // namespace common
 }  // namespace apollo
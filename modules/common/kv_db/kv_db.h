@@ -17,6 +17,8 @@
 #pragma once
 
 #include <string>
+#include <utility>
+#include <vector>
 
 /**
  * @namespace apollo::common
@@ -30,6 +32,10 @@ namespace common {
  *
  * @brief Lightweight key-value database to store system-wide parameters.
  *        We prefer keys like "apollo:data:commit_id".
+ *
+ * The database is opened once per process and queried with prepared
+ * statements. Writes with sync=false are queued and committed in batches by
+ * a background thread; reads of the same process see them at once.
  */
 class KVDB {
  public:
@@ -38,19 +44,33 @@ class KVDB {
    * @param sync Whether flush right after writing.
    * @return Success or not.
    */
-  static bool Put(const std::string &key, const std::string &value);
+  static bool Put(const std::string &key, const std::string &value,
+                  const bool sync = true);
+
+  /**
+   * @brief Store several {key, value} to DB in one transaction.
+   * @return Success or not.
+   */
+  static bool PutBatch(
+      const std::vector<std::pair<std::string, std::string>> &key_values);
 
   /**
    * @brief Delete a key.
    * @param sync Whether flush right after writing.
    * @return Success or not.
    */
-  static bool Delete(const std::string &key);
+  static bool Delete(const std::string &key, const bool sync = true);
 
   static bool Has(const std::string &key);
 
   static std::string Get(const std::string &key,
                          const std::string &default_value = "");
+
+  /**
+   * @brief Wait until the queued writes are committed.
+   * @return Success or not.
+   */
+  static bool Flush();
 };
 
 }  // namespace common
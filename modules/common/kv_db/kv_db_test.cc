@@ -41,6 +41,35 @@ TEST(KVDBTest, CRUD) {
   EXPECT_FALSE(KVDB::Has("test_key"));
 }
 
+TEST(KVDBTest, AsyncWrites) {
+  EXPECT_TRUE(KVDB::Put("test_key", "val0", false));
+  // Seen before they are committed.
+  EXPECT_EQ("val0", KVDB::Get("test_key"));
+  EXPECT_TRUE(KVDB::Put("test_key", "val1", false));
+  EXPECT_EQ("val1", KVDB::Get("test_key"));
+  EXPECT_TRUE(KVDB::Flush());
+  EXPECT_EQ("val1", KVDB::Get("test_key"));
+
+  // A sync write supersedes a queued one.
+  EXPECT_TRUE(KVDB::Put("test_key", "val2", false));
+  EXPECT_TRUE(KVDB::Put("test_key", "val3"));
+  EXPECT_TRUE(KVDB::Flush());
+  EXPECT_EQ("val3", KVDB::Get("test_key"));
+
+  EXPECT_TRUE(KVDB::Delete("test_key", false));
+  EXPECT_FALSE(KVDB::Has("test_key"));
+  EXPECT_TRUE(KVDB::Flush());
+  EXPECT_FALSE(KVDB::Has("test_key"));
+}
+
+TEST(KVDBTest, PutBatch) {
+  EXPECT_TRUE(KVDB::PutBatch({{"test_key", "val0"}, {"test_key2", "val1"}}));
+  EXPECT_EQ("val0", KVDB::Get("test_key"));
+  EXPECT_EQ("val1", KVDB::Get("test_key2"));
+  EXPECT_TRUE(KVDB::Delete("test_key"));
+  EXPECT_TRUE(KVDB::Delete("test_key2"));
+}
+
 TEST(KVDBTest, GetDefault) {
   EXPECT_EQ("", KVDB::Get("test_key"));
   EXPECT_EQ("default", KVDB::Get("test_key", "default"));
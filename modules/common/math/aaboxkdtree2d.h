@@ -410,6 +410,10 @@ class AABoxKDTree2dNode {
 /**
  * @class AABoxKDTree2d
  * @brief The class of KD-tree of Aligned Axis Bounding Box(AABox).
+ *        It has the same partitions as a tree of AABoxKDTree2dNode, laid out
+ *        in arrays in depth-first order: the nodes in one array, and the
+ *        objects of all the nodes, with their sorted bounds, in shared
+ *        arrays where every subtree owns a contiguous range.
  */
 template <class ObjectType>
 class AABoxKDTree2d {
@@ -424,10 +428,15 @@ class AABoxKDTree2d {
                 const AABoxKDTreeParams &params) {
     if (!objects.empty()) {
       std::vector<ObjectPtr> object_ptrs;
+      object_ptrs.reserve(objects.size());
       for (const auto &object : objects) {
         object_ptrs.push_back(&object);
       }
-      root_.reset(new AABoxKDTree2dNode<ObjectType>(object_ptrs, params, 0));
+      objects_sorted_by_min_.reserve(objects.size());
+      objects_sorted_by_max_.reserve(objects.size());
+      objects_sorted_by_min_bound_.reserve(objects.size());
+      objects_sorted_by_max_bound_.reserve(objects.size());
+      BuildNode(object_ptrs, params, 0);
     }
   }
 
@@ -437,7 +446,39 @@ class AABoxKDTree2d {
    * @return The nearest object to the target point.
    */
   ObjectPtr GetNearestObject(const Vec2d &point) const {
-    return root_ == nullptr ? nullptr : root_->GetNearestObject(point);
+    if (nodes_.empty()) {
+      return nullptr;
+    }
+    ObjectPtr nearest_object = nullptr;
+    double min_distance_sqr = std::numeric_limits<double>::infinity();
+    GetNearestObjectInternal(0, point, &min_distance_sqr, &nearest_object);
+    return nearest_object;
+  }
+
+  /**
+   * @brief Get the nearest objects to a batch of target points. The search
+   *        of a point starts from the nearest object of the previous one,
+   *        which prunes most of the tree when consecutive points are close,
+   *        as the points of a path or a trajectory.
+   * @param points The target points.
+   * @param nearest_objects The nearest object to every target point.
+   */
+  void GetNearestObjects(const std::vector<Vec2d> &points,
+                         std::vector<ObjectPtr> *const nearest_objects) const {
+    nearest_objects->assign(points.size(), nullptr);
+    if (nodes_.empty()) {
+      return;
+    }
+    ObjectPtr nearest_object = nullptr;
+    for (size_t i = 0; i < points.size(); ++i) {
+      double min_distance_sqr = std::numeric_limits<double>::infinity();
+      if (nearest_object != nullptr) {
+        min_distance_sqr = nearest_object->DistanceSquareTo(points[i]);
+      }
+      GetNearestObjectInternal(0, points[i], &min_distance_sqr,
+                               &nearest_object);
+      (*nearest_objects)[i] = nearest_object;
+    }
   }
 
   /**
@@ -448,10 +489,12 @@ class AABoxKDTree2d {
    */
   std::vector<ObjectPtr> GetObjects(const Vec2d &point,
                                     const double distance) const {
-    if (root_ == nullptr) {
-      return {};
+    std::vector<ObjectPtr> result_objects;
+    if (!nodes_.empty()) {
+      GetObjectsInternal(0, point, distance, Square(distance),
+                         &result_objects);
     }
-    return root_->GetObjects(point, distance);
+    return result_objects;
   }
 
   /**
@@ -459,11 +502,314 @@ class AABoxKDTree2d {
    * @return The axis-aligned bounding box of the objects.
    */
   AABox2d GetBoundingBox() const {
-    return root_ == nullptr ? AABox2d() : root_->GetBoundingBox();
+    if (nodes_.empty()) {
+      return AABox2d();
+    }
+    const Node &root = nodes_.front();
+    return AABox2d({root.min_x, root.min_y}, {root.max_x, root.max_y});
   }
 
  private:
-  std::unique_ptr<AABoxKDTree2dNode<ObjectType>> root_ = nullptr;
+  struct Node {
+    // Boundary
+    double min_x = 0.0;
+    double max_x = 0.0;
+    double min_y = 0.0;
+    double max_y = 0.0;
+    double mid_x = 0.0;
+    double mid_y = 0.0;
+
+    bool partition_x = true;
+    double partition_position = 0.0;
+
+    // Indices of the subnodes in nodes_, -1 if none
+    int left_subnode = -1;
+    int right_subnode = -1;
+
+    // Range of the objects of the node, and of its whole subtree
+    int objects_begin = 0;
+    int objects_end = 0;
+    int subtree_objects_end = 0;
+  };
+
+  int BuildNode(const std::vector<ObjectPtr> &objects,
+                const AABoxKDTreeParams &params, const int depth) {
+    CHECK(!objects.empty());
+    const int index = static_cast<int>(nodes_.size());
+    nodes_.emplace_back();
+
+    Node node;
+    ComputeBoundary(objects, &node);
+    ComputePartition(&node);
+
+    std::vector<ObjectPtr> left_subnode_objects;
+    std::vector<ObjectPtr> right_subnode_objects;
+    node.objects_begin = static_cast<int>(objects_sorted_by_min_.size());
+    if (SplitToSubNodes(objects, node, params, depth)) {
+      std::vector<ObjectPtr> other_objects;
+      PartitionObjects(objects, node, &left_subnode_objects,
+                       &right_subnode_objects, &other_objects);
+      AppendObjects(other_objects, node.partition_x);
+    } else {
+      AppendObjects(objects, node.partition_x);
+    }
+    node.objects_end = static_cast<int>(objects_sorted_by_min_.size());
+
+    // Split to sub-nodes.
+    if (!left_subnode_objects.empty()) {
+      node.left_subnode = BuildNode(left_subnode_objects, params, depth + 1);
+    }
+    if (!right_subnode_objects.empty()) {
+      node.right_subnode = BuildNode(right_subnode_objects, params, depth + 1);
+    }
+    node.subtree_objects_end = static_cast<int>(objects_sorted_by_min_.size());
+    nodes_[index] = node;
+    return index;
+  }
+
+  void AppendObjects(const std::vector<ObjectPtr> &objects,
+                     const bool partition_x) {
+    const size_t offset = objects_sorted_by_min_.size();
+    objects_sorted_by_min_.insert(objects_sorted_by_min_.end(),
+                                  objects.begin(), objects.end());
+    objects_sorted_by_max_.insert(objects_sorted_by_max_.end(),
+                                  objects.begin(), objects.end());
+    std::sort(objects_sorted_by_min_.begin() + offset,
+              objects_sorted_by_min_.end(),
+              [&](ObjectPtr obj1, ObjectPtr obj2) {
+                return partition_x
+                           ? obj1->aabox().min_x() < obj2->aabox().min_x()
+                           : obj1->aabox().min_y() < obj2->aabox().min_y();
+              });
+    std::sort(objects_sorted_by_max_.begin() + offset,
+              objects_sorted_by_max_.end(),
+              [&](ObjectPtr obj1, ObjectPtr obj2) {
+                return partition_x
+                           ? obj1->aabox().max_x() > obj2->aabox().max_x()
+                           : obj1->aabox().max_y() > obj2->aabox().max_y();
+              });
+    for (size_t i = offset; i < objects_sorted_by_min_.size(); ++i) {
+      const AABox2d &aabox = objects_sorted_by_min_[i]->aabox();
+      objects_sorted_by_min_bound_.push_back(partition_x ? aabox.min_x()
+                                                         : aabox.min_y());
+    }
+    for (size_t i = offset; i < objects_sorted_by_max_.size(); ++i) {
+      const AABox2d &aabox = objects_sorted_by_max_[i]->aabox();
+      objects_sorted_by_max_bound_.push_back(partition_x ? aabox.max_x()
+                                                         : aabox.max_y());
+    }
+  }
+
+  static bool SplitToSubNodes(const std::vector<ObjectPtr> &objects,
+                              const Node &node,
+                              const AABoxKDTreeParams &params,
+                              const int depth) {
+    if (params.max_depth >= 0 && depth >= params.max_depth) {
+      return false;
+    }
+    if (static_cast<int>(objects.size()) <= std::max(1, params.max_leaf_size)) {
+      return false;
+    }
+    if (params.max_leaf_dimension >= 0.0 &&
+        std::max(node.max_x - node.min_x, node.max_y - node.min_y) <=
+            params.max_leaf_dimension) {
+      return false;
+    }
+    return true;
+  }
+
+  static double LowerDistanceSquareToPoint(const Node &node,
+                                           const Vec2d &point) {
+    double dx = 0.0;
+    if (point.x() < node.min_x) {
+      dx = node.min_x - point.x();
+    } else if (point.x() > node.max_x) {
+      dx = point.x() - node.max_x;
+    }
+    double dy = 0.0;
+    if (point.y() < node.min_y) {
+      dy = node.min_y - point.y();
+    } else if (point.y() > node.max_y) {
+      dy = point.y() - node.max_y;
+    }
+    return dx * dx + dy * dy;
+  }
+
+  static double UpperDistanceSquareToPoint(const Node &node,
+                                           const Vec2d &point) {
+    const double dx = (point.x() > node.mid_x ? (point.x() - node.min_x)
+                                              : (point.x() - node.max_x));
+    const double dy = (point.y() > node.mid_y ? (point.y() - node.min_y)
+                                              : (point.y() - node.max_y));
+    return dx * dx + dy * dy;
+  }
+
+  void GetObjectsInternal(const int node_index, const Vec2d &point,
+                          const double distance, const double distance_sqr,
+                          std::vector<ObjectPtr> *const result_objects) const {
+    const Node &node = nodes_[node_index];
+    if (LowerDistanceSquareToPoint(node, point) > distance_sqr) {
+      return;
+    }
+    if (UpperDistanceSquareToPoint(node, point) <= distance_sqr) {
+      // All the objects of the subtree, in depth-first order.
+      result_objects->insert(
+          result_objects->end(),
+          objects_sorted_by_min_.begin() + node.objects_begin,
+          objects_sorted_by_min_.begin() + node.subtree_objects_end);
+      return;
+    }
+    const double pvalue = (node.partition_x ? point.x() : point.y());
+    if (pvalue < node.partition_position) {
+      const double limit = pvalue + distance;
+      for (int i = node.objects_begin; i < node.objects_end; ++i) {
+        if (objects_sorted_by_min_bound_[i] > limit) {
+          break;
+        }
+        ObjectPtr object = objects_sorted_by_min_[i];
+        if (object->DistanceSquareTo(point) <= distance_sqr) {
+          result_objects->push_back(object);
+        }
+      }
+    } else {
+      const double limit = pvalue - distance;
+      for (int i = node.objects_begin; i < node.objects_end; ++i) {
+        if (objects_sorted_by_max_bound_[i] < limit) {
+          break;
+        }
+        ObjectPtr object = objects_sorted_by_max_[i];
+        if (object->DistanceSquareTo(point) <= distance_sqr) {
+          result_objects->push_back(object);
+        }
+      }
+    }
+    if (node.left_subnode >= 0) {
+      GetObjectsInternal(node.left_subnode, point, distance, distance_sqr,
+                         result_objects);
+    }
+    if (node.right_subnode >= 0) {
+      GetObjectsInternal(node.right_subnode, point, distance, distance_sqr,
+                         result_objects);
+    }
+  }
+
+  void GetNearestObjectInternal(const int node_index, const Vec2d &point,
+                                double *const min_distance_sqr,
+                                ObjectPtr *const nearest_object) const {
+    const Node &node = nodes_[node_index];
+    if (LowerDistanceSquareToPoint(node, point) >=
+        *min_distance_sqr - kMathEpsilon) {
+      return;
+    }
+    const double pvalue = (node.partition_x ? point.x() : point.y());
+    const bool search_left_first = (pvalue < node.partition_position);
+    const int first_subnode =
+        search_left_first ? node.left_subnode : node.right_subnode;
+    const int second_subnode =
+        search_left_first ? node.right_subnode : node.left_subnode;
+    if (first_subnode >= 0) {
+      GetNearestObjectInternal(first_subnode, point, min_distance_sqr,
+                               nearest_object);
+    }
+    if (*min_distance_sqr <= kMathEpsilon) {
+      return;
+    }
+
+    if (search_left_first) {
+      for (int i = node.objects_begin; i < node.objects_end; ++i) {
+        const double bound = objects_sorted_by_min_bound_[i];
+        if (bound > pvalue && Square(bound - pvalue) > *min_distance_sqr) {
+          break;
+        }
+        ObjectPtr object = objects_sorted_by_min_[i];
+        const double distance_sqr = object->DistanceSquareTo(point);
+        if (distance_sqr < *min_distance_sqr) {
+          *min_distance_sqr = distance_sqr;
+          *nearest_object = object;
+        }
+      }
+    } else {
+      for (int i = node.objects_begin; i < node.objects_end; ++i) {
+        const double bound = objects_sorted_by_max_bound_[i];
+        if (bound < pvalue && Square(bound - pvalue) > *min_distance_sqr) {
+          break;
+        }
+        ObjectPtr object = objects_sorted_by_max_[i];
+        const double distance_sqr = object->DistanceSquareTo(point);
+        if (distance_sqr < *min_distance_sqr) {
+          *min_distance_sqr = distance_sqr;
+          *nearest_object = object;
+        }
+      }
+    }
+    if (*min_distance_sqr <= kMathEpsilon) {
+      return;
+    }
+    if (second_subnode >= 0) {
+      GetNearestObjectInternal(second_subnode, point, min_distance_sqr,
+                               nearest_object);
+    }
+  }
+
+  static void ComputeBoundary(const std::vector<ObjectPtr> &objects,
+                              Node *const node) {
+    node->min_x = std::numeric_limits<double>::infinity();
+    node->min_y = std::numeric_limits<double>::infinity();
+    node->max_x = -std::numeric_limits<double>::infinity();
+    node->max_y = -std::numeric_limits<double>::infinity();
+    for (ObjectPtr object : objects) {
+      node->min_x = std::fmin(node->min_x, object->aabox().min_x());
+      node->max_x = std::fmax(node->max_x, object->aabox().max_x());
+      node->min_y = std::fmin(node->min_y, object->aabox().min_y());
+      node->max_y = std::fmax(node->max_y, object->aabox().max_y());
+    }
+    node->mid_x = (node->min_x + node->max_x) / 2.0;
+    node->mid_y = (node->min_y + node->max_y) / 2.0;
+    CHECK(!std::isinf(node->max_x) && !std::isinf(node->max_y) &&
+          !std::isinf(node->min_x) && !std::isinf(node->min_y))
+        << "the provided object box size is infinity";
+  }
+
+  static void ComputePartition(Node *const node) {
+    if (node->max_x - node->min_x >= node->max_y - node->min_y) {
+      node->partition_x = true;
+      node->partition_position = (node->min_x + node->max_x) / 2.0;
+    } else {
+      node->partition_x = false;
+      node->partition_position = (node->min_y + node->max_y) / 2.0;
+    }
+  }
+
+  static void PartitionObjects(
+      const std::vector<ObjectPtr> &objects, const Node &node,
+      std::vector<ObjectPtr> *const left_subnode_objects,
+      std::vector<ObjectPtr> *const right_subnode_objects,
+      std::vector<ObjectPtr> *const other_objects) {
+    for (ObjectPtr object : objects) {
+      const double min_bound =
+          node.partition_x ? object->aabox().min_x() : object->aabox().min_y();
+      const double max_bound =
+          node.partition_x ? object->aabox().max_x() : object->aabox().max_y();
+      if (max_bound <= node.partition_position) {
+        left_subnode_objects->push_back(object);
+      } else if (min_bound >= node.partition_position) {
+        right_subnode_objects->push_back(object);
+      } else {
+        other_objects->push_back(object);
+      }
+    }
+  }
+
+ private:
+  // Nodes in depth-first order, the root first
+  std::vector<Node> nodes_;
+
+  // Objects of the nodes, sorted within every node by their bounds along
+  // the partition axis of the node
+  std::vector<ObjectPtr> objects_sorted_by_min_;
+  std::vector<ObjectPtr> objects_sorted_by_max_;
+  std::vector<double> objects_sorted_by_min_bound_;
+  std::vector<double> objects_sorted_by_max_bound_;
 };
 
 }  // namespace math
@@ -118,6 +118,46 @@ TEST(AABoxKDTree2dNode, OverallTests) {
   }
 }
 
+TEST(AABoxKDTree2d, SameResultsAsNodes) {
+  const double kSize = 100;
+  AABoxKDTreeParams params;
+  params.max_leaf_size = 4;
+  std::vector<Object> objects;
+  for (int i = 0; i < 200; ++i) {
+    // A different seed per draw, RandomDouble() is deterministic.
+    const double cx = RandomDouble(-kSize, kSize, 4 * i + 1);
+    const double cy = RandomDouble(-kSize, kSize, 4 * i + 2);
+    const double dx = RandomDouble(-kSize / 10.0, kSize / 10.0, 4 * i + 3);
+    const double dy = RandomDouble(-kSize / 10.0, kSize / 10.0, 4 * i + 4);
+    objects.emplace_back(cx - dx, cy - dy, cx + dx, cy + dy, i);
+  }
+  std::vector<const Object *> object_ptrs;
+  for (const auto &object : objects) {
+    object_ptrs.push_back(&object);
+  }
+  const AABoxKDTree2d<Object> kdtree(objects, params);
+  const AABoxKDTree2dNode<Object> root(object_ptrs, params, 0);
+
+  std::vector<Vec2d> points;
+  for (int i = 0; i < 500; ++i) {
+    const Vec2d point(RandomDouble(-kSize * 1.5, kSize * 1.5, 3 * i + 1001),
+                      RandomDouble(-kSize * 1.5, kSize * 1.5, 3 * i + 1002));
+    points.push_back(point);
+    EXPECT_EQ(root.GetNearestObject(point), kdtree.GetNearestObject(point));
+    const double distance = RandomDouble(0, kSize, 3 * i + 1003);
+    EXPECT_EQ(root.GetObjects(point, distance),
+              kdtree.GetObjects(point, distance));
+  }
+
+  std::vector<const Object *> nearest_objects;
+  kdtree.GetNearestObjects(points, &nearest_objects);
+  ASSERT_EQ(points.size(), nearest_objects.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_NEAR(kdtree.GetNearestObject(points[i])->DistanceTo(points[i]),
+                nearest_objects[i]->DistanceTo(points[i]), 1e-9);
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -0,0 +1,289 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/common/math/box2d_batch.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace apollo {
+namespace common {
+namespace math {
+
+// The query box of a test, with its frame and corners worked out once.
+struct Box2dBatch::Query {
+  explicit Query(const Box2d &box)
+      : center_x(box.center_x()),
+        center_y(box.center_y()),
+        cos_heading(box.cos_heading()),
+        sin_heading(box.sin_heading()),
+        half_length(box.half_length()),
+        half_width(box.half_width()),
+        dx1(cos_heading * half_length),
+        dy1(sin_heading * half_length),
+        dx2(sin_heading * half_width),
+        dy2(-cos_heading * half_width),
+        min_x(box.min_x()),
+        max_x(box.max_x()),
+        min_y(box.min_y()),
+        max_y(box.max_y()) {}
+
+  // Same as Box2d::DistanceTo(point), without branches.
+  double DistanceTo(const double x, const double y) const {
+    const double x0 = x - center_x;
+    const double y0 = y - center_y;
+    const double dx = std::max(
+        std::abs(x0 * cos_heading + y0 * sin_heading) - half_length, 0.0);
+    const double dy = std::max(
+        std::abs(x0 * sin_heading - y0 * cos_heading) - half_width, 0.0);
+    return std::sqrt(dx * dx + dy * dy);
+  }
+
+  const double center_x;
+  const double center_y;
+  const double cos_heading;
+  const double sin_heading;
+  const double half_length;
+  const double half_width;
+  const double dx1;
+  const double dy1;
+  const double dx2;
+  const double dy2;
+  const double min_x;
+  const double max_x;
+  const double min_y;
+  const double max_y;
+};
+
+void Box2dBatch::Add(const Box2d &box) {
+  center_x_.push_back(box.center_x());
+  center_y_.push_back(box.center_y());
+  cos_heading_.push_back(box.cos_heading());
+  sin_heading_.push_back(box.sin_heading());
+  half_length_.push_back(box.half_length());
+  half_width_.push_back(box.half_width());
+  length_dx_.push_back(box.cos_heading() * box.half_length());
+  length_dy_.push_back(box.sin_heading() * box.half_length());
+  width_dx_.push_back(box.sin_heading() * box.half_width());
+  width_dy_.push_back(-box.cos_heading() * box.half_width());
+  box_min_x_.push_back(box.min_x());
+  box_max_x_.push_back(box.max_x());
+  box_min_y_.push_back(box.min_y());
+  box_max_y_.push_back(box.max_y());
+
+  min_x_ = std::min(min_x_, box.min_x());
+  max_x_ = std::max(max_x_, box.max_x());
+  min_y_ = std::min(min_y_, box.min_y());
+  max_y_ = std::max(max_y_, box.max_y());
+}
+
+void Box2dBatch::Clear() {
+  center_x_.clear();
+  center_y_.clear();
+  cos_heading_.clear();
+  sin_heading_.clear();
+  half_length_.clear();
+  half_width_.clear();
+  length_dx_.clear();
+  length_dy_.clear();
+  width_dx_.clear();
+  width_dy_.clear();
+  box_min_x_.clear();
+  box_max_x_.clear();
+  box_min_y_.clear();
+  box_max_y_.clear();
+
+  min_x_ = std::numeric_limits<double>::max();
+  max_x_ = std::numeric_limits<double>::lowest();
+  min_y_ = std::numeric_limits<double>::max();
+  max_y_ = std::numeric_limits<double>::lowest();
+}
+
+void Box2dBatch::Reserve(const size_t size) {
+  center_x_.reserve(size);
+  center_y_.reserve(size);
+  cos_heading_.reserve(size);
+  sin_heading_.reserve(size);
+  half_length_.reserve(size);
+  half_width_.reserve(size);
+  length_dx_.reserve(size);
+  length_dy_.reserve(size);
+  width_dx_.reserve(size);
+  width_dy_.reserve(size);
+  box_min_x_.reserve(size);
+  box_max_x_.reserve(size);
+  box_min_y_.reserve(size);
+  box_max_y_.reserve(size);
+}
+
+// Same separating axis test as Box2d::HasOverlap, evaluated without
+// short-circuit so that the loops calling it stay branch free.
+inline bool Box2dBatch::OverlapAt(const Query &query,
+                                  const size_t index) const {
+  const double other_cos = cos_heading_[index];
+  const double other_sin = sin_heading_[index];
+  const double shift_x = center_x_[index] - query.center_x;
+  const double shift_y = center_y_[index] - query.center_y;
+  const double dx3 = length_dx_[index];
+  const double dy3 = length_dy_[index];
+  const double dx4 = width_dx_[index];
+  const double dy4 = width_dy_[index];
+
+  const bool aabox_overlap = (box_max_x_[index] >= query.min_x) &
+                             (box_min_x_[index] <= query.max_x) &
+                             (box_max_y_[index] >= query.min_y) &
+                             (box_min_y_[index] <= query.max_y);
+  const double cos_heading = query.cos_heading;
+  const double sin_heading = query.sin_heading;
+  const bool axis1 = std::abs(shift_x * cos_heading +
+                              shift_y * sin_heading) <=
+                     std::abs(dx3 * cos_heading + dy3 * sin_heading) +
+                         std::abs(dx4 * cos_heading + dy4 * sin_heading) +
+                         query.half_length;
+  const bool axis2 = std::abs(shift_x * sin_heading -
+                              shift_y * cos_heading) <=
+                     std::abs(dx3 * sin_heading - dy3 * cos_heading) +
+                         std::abs(dx4 * sin_heading - dy4 * cos_heading) +
+                         query.half_width;
+  const bool axis3 =
+      std::abs(shift_x * other_cos + shift_y * other_sin) <=
+      std::abs(query.dx1 * other_cos + query.dy1 * other_sin) +
+          std::abs(query.dx2 * other_cos + query.dy2 * other_sin) +
+          half_length_[index];
+  const bool axis4 =
+      std::abs(shift_x * other_sin - shift_y * other_cos) <=
+      std::abs(query.dx1 * other_sin - query.dy1 * other_cos) +
+          std::abs(query.dx2 * other_sin - query.dy2 * other_cos) +
+          half_width_[index];
+  return aabox_overlap & axis1 & axis2 & axis3 & axis4;
+}
+
+// Same as Box2d::DistanceTo(point) for one box, without branches.
+inline double Box2dBatch::DistanceAt(const size_t index, const double x,
+                                     const double y) const {
+  const double x0 = x - center_x_[index];
+  const double y0 = y - center_y_[index];
+  const double cos_heading = cos_heading_[index];
+  const double sin_heading = sin_heading_[index];
+  const double dx = std::max(
+      std::abs(x0 * cos_heading + y0 * sin_heading) - half_length_[index],
+      0.0);
+  const double dy = std::max(
+      std::abs(x0 * sin_heading - y0 * cos_heading) - half_width_[index],
+      0.0);
+  return std::sqrt(dx * dx + dy * dy);
+}
+
+bool Box2dBatch::HasOverlap(const Box2d &box) const {
+  if (empty() || box.max_x() < min_x_ || box.min_x() > max_x_ ||
+      box.max_y() < min_y_ || box.min_y() > max_y_) {
+    return false;
+  }
+  const Query query(box);
+  const size_t num_boxes = size();
+  for (size_t i = 0; i < num_boxes; ++i) {
+    if (OverlapAt(query, i)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void Box2dBatch::HasOverlap(const Box2d &box,
+                            std::vector<uint8_t> *overlaps) const {
+  const size_t num_boxes = size();
+  overlaps->assign(num_boxes, 0);
+  if (empty() || box.max_x() < min_x_ || box.min_x() > max_x_ ||
+      box.max_y() < min_y_ || box.min_y() > max_y_) {
+    return;
+  }
+  const Query query(box);
+  uint8_t *result = overlaps->data();
+  // most boxes are far apart, so the vectorized bounds test goes first and
+  // the axes are only tested for the boxes passing it
+  for (size_t i = 0; i < num_boxes; ++i) {
+    result[i] = (box_max_x_[i] >= query.min_x) &
+                (box_min_x_[i] <= query.max_x) &
+                (box_max_y_[i] >= query.min_y) &
+                (box_min_y_[i] <= query.max_y);
+  }
+  for (size_t i = 0; i < num_boxes; ++i) {
+    if (result[i] != 0) {
+      result[i] = OverlapAt(query, i);
+    }
+  }
+}
+
+void Box2dBatch::DistanceTo(const Vec2d &point,
+                            std::vector<double> *distances) const {
+  const size_t num_boxes = size();
+  distances->resize(num_boxes);
+  double *result = distances->data();
+  for (size_t i = 0; i < num_boxes; ++i) {
+    result[i] = DistanceAt(i, point.x(), point.y());
+  }
+}
+
+void Box2dBatch::DistanceTo(const Box2d &box,
+                            std::vector<double> *distances) const {
+  const size_t num_boxes = size();
+  distances->resize(num_boxes);
+  const Query query(box);
+  // in the order of Box2d::GetAllCorners
+  const double corner_x[] = {
+      query.center_x + query.dx1 + query.dx2,
+      query.center_x + query.dx1 - query.dx2,
+      query.center_x - query.dx1 - query.dx2,
+      query.center_x - query.dx1 + query.dx2};
+  const double corner_y[] = {
+      query.center_y + query.dy1 + query.dy2,
+      query.center_y + query.dy1 - query.dy2,
+      query.center_y - query.dy1 - query.dy2,
+      query.center_y - query.dy1 + query.dy2};
+  double *result = distances->data();
+  // Two apart convex polygons are closest at a corner of one of them, so the
+  // distance is the smallest one of a corner to the other box, unless they
+  // overlap.
+  for (size_t i = 0; i < num_boxes; ++i) {
+    double distance = std::numeric_limits<double>::max();
+    for (int k = 0; k < 4; ++k) {
+      distance = std::min(distance, DistanceAt(i, corner_x[k], corner_y[k]));
+    }
+    const double center_x = center_x_[i];
+    const double center_y = center_y_[i];
+    const double dx = length_dx_[i];
+    const double dy = length_dy_[i];
+    const double wx = width_dx_[i];
+    const double wy = width_dy_[i];
+    distance = std::min(distance, query.DistanceTo(center_x + dx + wx,
+                                                   center_y + dy + wy));
+    distance = std::min(distance, query.DistanceTo(center_x + dx - wx,
+                                                   center_y + dy - wy));
+    distance = std::min(distance, query.DistanceTo(center_x - dx - wx,
+                                                   center_y - dy - wy));
+    distance = std::min(distance, query.DistanceTo(center_x - dx + wx,
+                                                   center_y - dy + wy));
+    result[i] = OverlapAt(query, i) ? 0.0 : distance;
+  }
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
@@ -0,0 +1,146 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief A set of Box2d laid out for checking one box against all of them.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "modules/common/math/box2d.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+/**
+ * @class Box2dBatch
+ * @brief Boxes stored as structure of arrays, with their axes-aligned bounds.
+ *
+ * Meant for sets that are built once and queried many times, e.g. predicted
+ * obstacle boxes at one time step checked against every candidate ego box.
+ * The half length and half width vectors of every box are kept, so queries
+ * compute no trigonometry or corners, and the loops over the boxes have no
+ * branches so that the compiler can vectorize them.
+ */
+class Box2dBatch {
+ public:
+  Box2dBatch() = default;
+
+  /**
+   * @brief Appends a box to the batch
+   * @param box The box to append
+   */
+  void Add(const Box2d &box);
+
+  /**
+   * @brief Removes all the boxes
+   */
+  void Clear();
+
+  /**
+   * @brief Reserves room for a number of boxes
+   * @param size The number of boxes
+   */
+  void Reserve(const size_t size);
+
+  /**
+   * @brief Gets the number of boxes
+   * @return The number of boxes
+   */
+  size_t size() const { return center_x_.size(); }
+
+  /**
+   * @brief Tells whether the batch is empty
+   * @return True if there is no box
+   */
+  bool empty() const { return center_x_.empty(); }
+
+  /**
+   * @brief Determines whether a box overlaps any box of the batch. Gives the
+   *        same answer as Box2d::HasOverlap on every box of the batch.
+   * @param box The box to check
+   * @return True if they overlap
+   */
+  bool HasOverlap(const Box2d &box) const;
+
+  /**
+   * @brief Checks a box against every box of the batch.
+   * @param box The box to check
+   * @param overlaps Set to one per box of the batch overlapping the box,
+   *        to zero otherwise
+   */
+  void HasOverlap(const Box2d &box, std::vector<uint8_t> *overlaps) const;
+
+  /**
+   * @brief Computes the distance from a point to every box of the batch,
+   *        as Box2d::DistanceTo does.
+   * @param point The point
+   * @param distances Set to one distance per box of the batch
+   */
+  void DistanceTo(const Vec2d &point, std::vector<double> *distances) const;
+
+  /**
+   * @brief Computes the distance from a box to every box of the batch,
+   *        as Box2d::DistanceTo does.
+   * @param box The box
+   * @param distances Set to one distance per box of the batch
+   */
+  void DistanceTo(const Box2d &box, std::vector<double> *distances) const;
+
+  double min_x() const { return min_x_; }
+  double max_x() const { return max_x_; }
+  double min_y() const { return min_y_; }
+  double max_y() const { return max_y_; }
+
+ private:
+  struct Query;
+
+  bool OverlapAt(const Query &query, const size_t index) const;
+  double DistanceAt(const size_t index, const double x,
+                    const double y) const;
+
+  std::vector<double> center_x_;
+  std::vector<double> center_y_;
+  std::vector<double> cos_heading_;
+  std::vector<double> sin_heading_;
+  std::vector<double> half_length_;
+  std::vector<double> half_width_;
+  // half length and half width vectors, from the center to the corners
+  std::vector<double> length_dx_;
+  std::vector<double> length_dy_;
+  std::vector<double> width_dx_;
+  std::vector<double> width_dy_;
+  std::vector<double> box_min_x_;
+  std::vector<double> box_max_x_;
+  std::vector<double> box_min_y_;
+  std::vector<double> box_max_y_;
+
+  // bounds of the whole batch
+  double min_x_ = std::numeric_limits<double>::max();
+  double max_x_ = std::numeric_limits<double>::lowest();
+  double min_y_ = std::numeric_limits<double>::max();
+  double max_y_ = std::numeric_limits<double>::lowest();
+};
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
@@ -0,0 +1,172 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ * @brief Times Box2dBatch against the same checks done box by box with
+ *        Box2d, for batches of random boxes around a query box.
+ *
+ * Example:
+ *   box2d_batch_benchmark --benchmark_boxes=256
+ **/
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gflags/gflags.h"
+
+#include "modules/common/math/box2d.h"
+#include "modules/common/math/box2d_batch.h"
+
+DEFINE_int32(benchmark_boxes, 256,
+             "boxes of the largest batch, the others have 1/16, 1/4 and "
+             "1/2 of them");
+DEFINE_int32(benchmark_queries, 100, "query boxes checked per batch");
+DEFINE_int32(benchmark_iterations, 200, "runs of every case");
+
+namespace apollo {
+namespace common {
+namespace math {
+namespace {
+
+std::mt19937 random_engine(0);
+
+// boxes of obstacles in the 60m x 60m around the query boxes
+Box2d RandomBox() {
+  std::uniform_real_distribution<double> position(-30.0, 30.0);
+  std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+  std::uniform_real_distribution<double> length(0.5, 6.0);
+  std::uniform_real_distribution<double> width(0.5, 2.5);
+  return Box2d({position(random_engine), position(random_engine)},
+               heading(random_engine), length(random_engine),
+               width(random_engine));
+}
+
+template <typename Func>
+double TimeUs(const Func& func) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < FLAGS_benchmark_iterations; ++i) {
+    func();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() /
+         FLAGS_benchmark_iterations;
+}
+
+void Report(const std::string& name, const int num_boxes,
+            const double box2d_us, const double batch_us, const bool same) {
+  std::cout << std::setw(18) << name << std::setw(8) << num_boxes
+            << std::fixed << std::setprecision(2) << std::setw(12)
+            << box2d_us << std::setw(12) << batch_us << std::setw(10)
+            << box2d_us / batch_us << std::setw(8) << (same ? "yes" : "NO")
+            << std::endl;
+}
+
+void Benchmark(const int num_boxes) {
+  std::vector<Box2d> boxes;
+  Box2dBatch batch;
+  for (int i = 0; i < num_boxes; ++i) {
+    boxes.push_back(RandomBox());
+    batch.Add(boxes.back());
+  }
+  std::vector<Box2d> queries;
+  std::vector<Vec2d> points;
+  for (int i = 0; i < FLAGS_benchmark_queries; ++i) {
+    queries.push_back(RandomBox());
+    points.push_back(queries.back().center());
+  }
+
+  std::vector<uint8_t> box2d_overlaps(num_boxes);
+  std::vector<uint8_t> overlaps;
+  bool same = true;
+  const double box2d_overlap_us = TimeUs([&]() {
+    for (const auto& query : queries) {
+      for (int i = 0; i < num_boxes; ++i) {
+        box2d_overlaps[i] = query.HasOverlap(boxes[i]);
+      }
+    }
+  });
+  const double batch_overlap_us = TimeUs([&]() {
+    for (const auto& query : queries) {
+      batch.HasOverlap(query, &overlaps);
+    }
+  });
+  same = box2d_overlaps == overlaps;
+  Report("HasOverlap", num_boxes, box2d_overlap_us, batch_overlap_us, same);
+
+  std::vector<double> box2d_distances(num_boxes);
+  std::vector<double> distances;
+  const auto near = [&]() {
+    for (int i = 0; i < num_boxes; ++i) {
+      if (std::abs(box2d_distances[i] - distances[i]) > 1e-6) {
+        return false;
+      }
+    }
+    return true;
+  };
+  const double box2d_point_us = TimeUs([&]() {
+    for (const auto& point : points) {
+      for (int i = 0; i < num_boxes; ++i) {
+        box2d_distances[i] = boxes[i].DistanceTo(point);
+      }
+    }
+  });
+  const double batch_point_us = TimeUs([&]() {
+    for (const auto& point : points) {
+      batch.DistanceTo(point, &distances);
+    }
+  });
+  Report("DistanceTo(point)", num_boxes, box2d_point_us, batch_point_us,
+         near());
+
+  const double box2d_box_us = TimeUs([&]() {
+    for (const auto& query : queries) {
+      for (int i = 0; i < num_boxes; ++i) {
+        box2d_distances[i] = query.DistanceTo(boxes[i]);
+      }
+    }
+  });
+  const double batch_box_us = TimeUs([&]() {
+    for (const auto& query : queries) {
+      batch.DistanceTo(query, &distances);
+    }
+  });
+  Report("DistanceTo(box)", num_boxes, box2d_box_us, batch_box_us, near());
+}
+
+}  // namespace
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  std::cout << std::setw(18) << "check" << std::setw(8) << "boxes"
+            << std::setw(12) << "box2d us" << std::setw(12) << "batch us"
+            << std::setw(10) << "speedup" << std::setw(8) << "same"
+            << std::endl;
+  for (const int divisor : {16, 4, 2, 1}) {
+    apollo::common::math::Benchmark(FLAGS_benchmark_boxes / divisor);
+  }
+  return 0;
+}
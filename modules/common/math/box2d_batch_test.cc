@@ -0,0 +1,124 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/math/box2d_batch.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+TEST(Box2dBatchTest, Empty) {
+  Box2dBatch batch;
+  EXPECT_TRUE(batch.empty());
+  EXPECT_FALSE(batch.HasOverlap(Box2d({0, 0}, 0.0, 4.0, 2.0)));
+}
+
+TEST(Box2dBatchTest, Bounds) {
+  Box2dBatch batch;
+  batch.Add(Box2d({0, 0}, 0.0, 4.0, 2.0));
+  batch.Add(Box2d({10, 5}, 0.0, 2.0, 2.0));
+  EXPECT_EQ(2, batch.size());
+  EXPECT_NEAR(-2.0, batch.min_x(), 1e-5);
+  EXPECT_NEAR(11.0, batch.max_x(), 1e-5);
+  EXPECT_NEAR(-1.0, batch.min_y(), 1e-5);
+  EXPECT_NEAR(6.0, batch.max_y(), 1e-5);
+
+  EXPECT_TRUE(batch.HasOverlap(Box2d({1.5, 0.5}, M_PI_4, 1.0, 1.0)));
+  EXPECT_TRUE(batch.HasOverlap(Box2d({10, 5}, M_PI_2, 1.0, 1.0)));
+  EXPECT_FALSE(batch.HasOverlap(Box2d({5, 2.5}, 0.0, 1.0, 1.0)));
+  EXPECT_FALSE(batch.HasOverlap(Box2d({-20, 0}, 0.0, 1.0, 1.0)));
+
+  batch.Clear();
+  EXPECT_TRUE(batch.empty());
+  EXPECT_FALSE(batch.HasOverlap(Box2d({0, 0}, 0.0, 4.0, 2.0)));
+}
+
+TEST(Box2dBatchTest, SameAsBox2d) {
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<double> position(-20.0, 20.0);
+  std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+  std::uniform_real_distribution<double> size(0.5, 6.0);
+  auto random_box = [&]() {
+    return Box2d({position(gen), position(gen)}, heading(gen), size(gen),
+                 size(gen));
+  };
+
+  for (int round = 0; round < 200; ++round) {
+    Box2dBatch batch;
+    std::vector<Box2d> boxes;
+    for (int i = 0; i < 8; ++i) {
+      boxes.push_back(random_box());
+      batch.Add(boxes.back());
+    }
+    const Box2d ego = random_box();
+    bool expected = false;
+    for (const auto &box : boxes) {
+      expected = expected || ego.HasOverlap(box);
+    }
+    EXPECT_EQ(expected, batch.HasOverlap(ego));
+  }
+}
+
+TEST(Box2dBatchTest, OneVersusManySameAsBox2d) {
+  std::mt19937 gen(11);
+  std::uniform_real_distribution<double> position(-20.0, 20.0);
+  std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+  std::uniform_real_distribution<double> size(0.5, 6.0);
+  auto random_box = [&]() {
+    return Box2d({position(gen), position(gen)}, heading(gen), size(gen),
+                 size(gen));
+  };
+
+  Box2dBatch batch;
+  std::vector<Box2d> boxes;
+  for (int i = 0; i < 64; ++i) {
+    boxes.push_back(random_box());
+    batch.Add(boxes.back());
+  }
+  std::vector<uint8_t> overlaps;
+  std::vector<double> distances;
+  for (int round = 0; round < 100; ++round) {
+    const Box2d ego = random_box();
+    batch.HasOverlap(ego, &overlaps);
+    ASSERT_EQ(boxes.size(), overlaps.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      EXPECT_EQ(ego.HasOverlap(boxes[i]), overlaps[i] != 0);
+    }
+
+    batch.DistanceTo(ego, &distances);
+    ASSERT_EQ(boxes.size(), distances.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      EXPECT_NEAR(ego.DistanceTo(boxes[i]), distances[i], 1e-6);
+    }
+
+    const Vec2d point(position(gen), position(gen));
+    batch.DistanceTo(point, &distances);
+    ASSERT_EQ(boxes.size(), distances.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      EXPECT_NEAR(boxes[i].DistanceTo(point), distances[i], 1e-6);
+    }
+  }
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "cyber/common/log.h"
+#include "modules/common/math/fast_trig.h"
 #include "modules/common/math/math_utils.h"
 
 namespace apollo {
@@ -130,6 +131,121 @@ void CartesianFrenetConverter::frenet_to_cartesian(
                (d_condition[1] * delta_theta_prime - kappa_r_d_prime);
 }
 
+void CartesianFrenetConverter::cartesian_to_frenet(
+    const std::vector<PathPoint>& ref_points,
+    const std::vector<TrajectoryPoint>& points,
+    std::vector<std::array<double, 3>>* const ptr_s_conditions,
+    std::vector<std::array<double, 3>>* const ptr_d_conditions) {
+  CHECK_EQ(ref_points.size(), points.size());
+  const size_t num_points = points.size();
+  ptr_s_conditions->resize(num_points);
+  ptr_d_conditions->resize(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    const PathPoint& ref_point = ref_points[i];
+    const PathPoint& path_point = points[i].path_point();
+    auto& s_condition = (*ptr_s_conditions)[i];
+    auto& d_condition = (*ptr_d_conditions)[i];
+    const double rkappa = ref_point.kappa();
+    const double kappa = path_point.kappa();
+
+    const double dx = path_point.x() - ref_point.x();
+    const double dy = path_point.y() - ref_point.y();
+    double sin_theta_r = 0.0;
+    double cos_theta_r = 0.0;
+    FastSinCos(ref_point.theta(), &sin_theta_r, &cos_theta_r);
+    double sin_theta = 0.0;
+    double cos_theta = 0.0;
+    FastSinCos(path_point.theta(), &sin_theta, &cos_theta);
+
+    const double cross_rd_nd = cos_theta_r * dy - sin_theta_r * dx;
+    d_condition[0] = std::copysign(std::sqrt(dx * dx + dy * dy), cross_rd_nd);
+
+    // the angle difference from the sums of angles, instead of tan and cos
+    const double cos_delta_theta =
+        cos_theta * cos_theta_r + sin_theta * sin_theta_r;
+    const double sin_delta_theta =
+        sin_theta * cos_theta_r - cos_theta * sin_theta_r;
+    const double tan_delta_theta = sin_delta_theta / cos_delta_theta;
+
+    const double one_minus_kappa_r_d = 1 - rkappa * d_condition[0];
+    d_condition[1] = one_minus_kappa_r_d * tan_delta_theta;
+
+    const double kappa_r_d_prime =
+        ref_point.dkappa() * d_condition[0] + rkappa * d_condition[1];
+    d_condition[2] =
+        -kappa_r_d_prime * tan_delta_theta +
+        one_minus_kappa_r_d / cos_delta_theta / cos_delta_theta *
+            (kappa * one_minus_kappa_r_d / cos_delta_theta - rkappa);
+
+    s_condition[0] = ref_point.s();
+    s_condition[1] =
+        points[i].v() * cos_delta_theta / one_minus_kappa_r_d;
+    const double delta_theta_prime =
+        one_minus_kappa_r_d / cos_delta_theta * kappa - rkappa;
+    s_condition[2] =
+        (points[i].a() * cos_delta_theta -
+         s_condition[1] * s_condition[1] *
+             (d_condition[1] * delta_theta_prime - kappa_r_d_prime)) /
+        one_minus_kappa_r_d;
+  }
+}
+
+void CartesianFrenetConverter::frenet_to_cartesian(
+    const std::vector<PathPoint>& ref_points,
+    const std::vector<std::array<double, 3>>& s_conditions,
+    const std::vector<std::array<double, 3>>& d_conditions,
+    std::vector<TrajectoryPoint>* const ptr_points) {
+  CHECK_EQ(ref_points.size(), s_conditions.size());
+  CHECK_EQ(ref_points.size(), d_conditions.size());
+  const size_t num_points = ref_points.size();
+  ptr_points->resize(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    const PathPoint& ref_point = ref_points[i];
+    const auto& s_condition = s_conditions[i];
+    const auto& d_condition = d_conditions[i];
+    CHECK(std::abs(ref_point.s() - s_condition[0]) < 1.0e-6)
+        << "The reference point s and s_condition[0] don't match";
+    const double rkappa = ref_point.kappa();
+
+    double sin_theta_r = 0.0;
+    double cos_theta_r = 0.0;
+    FastSinCos(ref_point.theta(), &sin_theta_r, &cos_theta_r);
+    const double one_minus_kappa_r_d = 1 - rkappa * d_condition[0];
+    const double tan_delta_theta = d_condition[1] / one_minus_kappa_r_d;
+    const double delta_theta = FastAtan2(d_condition[1], one_minus_kappa_r_d);
+    // cos(atan2(y, x)) = x / hypot(x, y)
+    const double cos_delta_theta =
+        one_minus_kappa_r_d /
+        std::sqrt(one_minus_kappa_r_d * one_minus_kappa_r_d +
+                  d_condition[1] * d_condition[1]);
+
+    const double kappa_r_d_prime =
+        ref_point.dkappa() * d_condition[0] + rkappa * d_condition[1];
+    const double kappa =
+        (((d_condition[2] + kappa_r_d_prime * tan_delta_theta) *
+          cos_delta_theta * cos_delta_theta) /
+             one_minus_kappa_r_d +
+         rkappa) *
+        cos_delta_theta / one_minus_kappa_r_d;
+    const double d_dot = d_condition[1] * s_condition[1];
+    const double delta_theta_prime =
+        one_minus_kappa_r_d / cos_delta_theta * kappa - rkappa;
+
+    TrajectoryPoint& point = (*ptr_points)[i];
+    PathPoint* path_point = point.mutable_path_point();
+    path_point->set_x(ref_point.x() - sin_theta_r * d_condition[0]);
+    path_point->set_y(ref_point.y() + cos_theta_r * d_condition[0]);
+    path_point->set_theta(NormalizeAngle(delta_theta + ref_point.theta()));
+    path_point->set_kappa(kappa);
+    point.set_v(std::sqrt(one_minus_kappa_r_d * one_minus_kappa_r_d *
+                              s_condition[1] * s_condition[1] +
+                          d_dot * d_dot));
+    point.set_a(s_condition[2] * one_minus_kappa_r_d / cos_delta_theta +
+                s_condition[1] * s_condition[1] / cos_delta_theta *
+                    (d_condition[1] * delta_theta_prime - kappa_r_d_prime));
+  }
+}
+
 double CartesianFrenetConverter::CalculateTheta(const double rtheta,
                                                 const double rkappa,
                                                 const double l,
@@ -21,8 +21,10 @@
 #pragma once
 
 #include <array>
+#include <vector>
 
 #include "modules/common/math/vec2d.h"
+#include "modules/common/proto/pnc_point.pb.h"
 
 namespace apollo {
 namespace common {
@@ -62,6 +64,19 @@ class CartesianFrenetConverter {
                                   const double x, const double y, double* ptr_s,
                                   double* ptr_d);
 
+  /**
+   * Convert a whole trajectory in Cartesian frame to Frenet frame, each
+   * point w.r.t. its reference point, e.g. as matched by
+   * PathMatcher::MatchToPath. Same as the per point version, with the
+   * trigonometry of every point reduced to two FastSinCos calls, within
+   * 1e-7 of the libm functions.
+   */
+  static void cartesian_to_frenet(
+      const std::vector<PathPoint>& ref_points,
+      const std::vector<TrajectoryPoint>& points,
+      std::vector<std::array<double, 3>>* const ptr_s_conditions,
+      std::vector<std::array<double, 3>>* const ptr_d_conditions);
+
   /**
    * Convert a vehicle state in Frenet frame to Cartesian frame.
    * Combine two independent 1d movement w.r.t. reference line to a 2d movement.
@@ -76,6 +91,17 @@ class CartesianFrenetConverter {
                                   double* const ptr_kappa, double* const ptr_v,
                                   double* const ptr_a);
 
+  /**
+   * Convert whole arrays of Frenet states to Cartesian frame, each one
+   * w.r.t. its reference point. Fills the path point, v and a of every
+   * output point, with one FastSinCos and one FastAtan2 per point.
+   */
+  static void frenet_to_cartesian(
+      const std::vector<PathPoint>& ref_points,
+      const std::vector<std::array<double, 3>>& s_conditions,
+      const std::vector<std::array<double, 3>>& d_conditions,
+      std::vector<TrajectoryPoint>* const ptr_points);
+
   // given sl point extract x, y, theta, kappa
   static double CalculateTheta(const double rtheta, const double rkappa,
                                const double l, const double dl);
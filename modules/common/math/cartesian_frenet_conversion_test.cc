@@ -16,8 +16,11 @@
 
 #include "modules/common/math/cartesian_frenet_conversion.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <random>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -65,6 +68,88 @@ TEST(TestCartesianFrenetConversion, cartesian_to_frenet_test) {
   EXPECT_NEAR(a, a_out, 1.0e-6);
 }
 
+TEST(TestCartesianFrenetConversion, batch_same_as_one_by_one) {
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> position(-5.0, 5.0);
+  std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+  std::uniform_real_distribution<double> heading_offset(-1.0, 1.0);
+  std::uniform_real_distribution<double> kappa(-0.05, 0.05);
+  std::uniform_real_distribution<double> speed(0.0, 20.0);
+  // the batch versions use the fast trigonometry, within 1e-7 of libm
+  const double kTolerance = 1.0e-6;
+
+  std::vector<PathPoint> ref_points;
+  std::vector<TrajectoryPoint> points;
+  for (int i = 0; i < 100; ++i) {
+    PathPoint ref_point;
+    ref_point.set_s(i * 0.5);
+    ref_point.set_x(position(gen));
+    ref_point.set_y(position(gen));
+    ref_point.set_theta(heading(gen));
+    ref_point.set_kappa(kappa(gen));
+    ref_point.set_dkappa(kappa(gen) * 0.1);
+    ref_points.push_back(ref_point);
+
+    TrajectoryPoint point;
+    point.mutable_path_point()->set_x(ref_point.x() + position(gen));
+    point.mutable_path_point()->set_y(ref_point.y() + position(gen));
+    point.mutable_path_point()->set_theta(ref_point.theta() +
+                                          heading_offset(gen));
+    point.mutable_path_point()->set_kappa(kappa(gen));
+    point.set_v(speed(gen));
+    point.set_a(position(gen));
+    points.push_back(point);
+  }
+
+  std::vector<std::array<double, 3>> s_conditions;
+  std::vector<std::array<double, 3>> d_conditions;
+  CartesianFrenetConverter::cartesian_to_frenet(ref_points, points,
+                                                &s_conditions, &d_conditions);
+  ASSERT_EQ(points.size(), s_conditions.size());
+  ASSERT_EQ(points.size(), d_conditions.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    const PathPoint& ref = ref_points[i];
+    const PathPoint& path_point = points[i].path_point();
+    std::array<double, 3> s_condition;
+    std::array<double, 3> d_condition;
+    CartesianFrenetConverter::cartesian_to_frenet(
+        ref.s(), ref.x(), ref.y(), ref.theta(), ref.kappa(), ref.dkappa(),
+        path_point.x(), path_point.y(), points[i].v(), points[i].a(),
+        path_point.theta(), path_point.kappa(), &s_condition, &d_condition);
+    for (int k = 0; k < 3; ++k) {
+      EXPECT_NEAR(s_condition[k], s_conditions[i][k],
+                  kTolerance * std::max(1.0, std::abs(s_condition[k])));
+      EXPECT_NEAR(d_condition[k], d_conditions[i][k],
+                  kTolerance * std::max(1.0, std::abs(d_condition[k])));
+    }
+  }
+
+  std::vector<TrajectoryPoint> cartesian_points;
+  CartesianFrenetConverter::frenet_to_cartesian(ref_points, s_conditions,
+                                                d_conditions,
+                                                &cartesian_points);
+  ASSERT_EQ(points.size(), cartesian_points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    const PathPoint& ref = ref_points[i];
+    double x = 0.0;
+    double y = 0.0;
+    double theta = 0.0;
+    double kappa = 0.0;
+    double v = 0.0;
+    double a = 0.0;
+    CartesianFrenetConverter::frenet_to_cartesian(
+        ref.s(), ref.x(), ref.y(), ref.theta(), ref.kappa(), ref.dkappa(),
+        s_conditions[i], d_conditions[i], &x, &y, &theta, &kappa, &v, &a);
+    const TrajectoryPoint& point = cartesian_points[i];
+    EXPECT_NEAR(x, point.path_point().x(), kTolerance);
+    EXPECT_NEAR(y, point.path_point().y(), kTolerance);
+    EXPECT_NEAR(theta, point.path_point().theta(), kTolerance);
+    EXPECT_NEAR(kappa, point.path_point().kappa(), kTolerance);
+    EXPECT_NEAR(v, point.v(), kTolerance * std::max(1.0, v));
+    EXPECT_NEAR(a, point.a(), kTolerance * std::max(1.0, std::abs(a)));
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
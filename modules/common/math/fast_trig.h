@@ -0,0 +1,208 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ * @brief Polynomial sin, cos and atan2 with bounded errors, for hot loops
+ *        where the libm functions dominate.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @namespace apollo::common::math
+ * @brief apollo::common::math
+ */
+namespace apollo {
+namespace common {
+namespace math {
+
+/**
+ * @brief Error bound of the fast trigonometric functions.
+ *
+ * kCoarse: absolute error below 1e-4, e.g. for scoring and rendering.
+ * kFine: absolute error below 1e-7, e.g. for geometry in meters.
+ */
+enum class TrigAccuracy { kCoarse, kFine };
+
+namespace fast_trig_internal {
+
+// pi / 2 split in a head exact in 33 bits and a tail, so that x - k * pi / 2
+// stays accurate for the quadrant counts k of angles below 1e5
+constexpr double kTwoOverPi = 0.636619772367581343076;
+constexpr double kPiOverTwoHead = 1.57079632673412561417;
+constexpr double kPiOverTwoTail = 6.07710050650619224932e-11;
+constexpr double kPiOverTwo = 1.57079632679489661923;
+constexpr double kPiOverFour = 0.785398163397448309616;
+constexpr double kPi = 3.14159265358979323846;
+// tan(pi / 8)
+constexpr double kTanPiOverEight = 0.414213562373095048802;
+// adding and subtracting it rounds a double below 2^51 to an integer
+constexpr double kRoundMagic = 6755399441055744.0;
+
+// x = r + quadrant * pi / 2 with r in [-pi / 4, pi / 4]
+inline int64_t ReduceQuadrant(const double x, double *r) {
+  const double k = (x * kTwoOverPi + kRoundMagic) - kRoundMagic;
+  *r = (x - k * kPiOverTwoHead) - k * kPiOverTwoTail;
+  return static_cast<int64_t>(k);
+}
+
+// Taylor series on [-pi / 4, pi / 4], cut where the next term is below the
+// bound of the accuracy
+template <TrigAccuracy A>
+inline double SinPoly(const double r, const double r2);
+
+template <>
+inline double SinPoly<TrigAccuracy::kCoarse>(const double r,
+                                             const double r2) {
+  return r * (1.0 + r2 * (-1.0 / 6.0 + r2 * (1.0 / 120.0)));
+}
+
+template <>
+inline double SinPoly<TrigAccuracy::kFine>(const double r, const double r2) {
+  return r * (1.0 + r2 * (-1.0 / 6.0 +
+                          r2 * (1.0 / 120.0 +
+                                r2 * (-1.0 / 5040.0 + r2 * (1.0 / 362880.0)))));
+}
+
+template <TrigAccuracy A>
+inline double CosPoly(const double r2);
+
+template <>
+inline double CosPoly<TrigAccuracy::kCoarse>(const double r2) {
+  return 1.0 + r2 * (-0.5 + r2 * (1.0 / 24.0 + r2 * (-1.0 / 720.0)));
+}
+
+template <>
+inline double CosPoly<TrigAccuracy::kFine>(const double r2) {
+  return 1.0 +
+         r2 * (-0.5 +
+               r2 * (1.0 / 24.0 + r2 * (-1.0 / 720.0 + r2 * (1.0 / 40320.0))));
+}
+
+// atan on [0, 1]
+template <TrigAccuracy A>
+inline double AtanUnit(const double a);
+
+template <>
+inline double AtanUnit<TrigAccuracy::kCoarse>(const double a) {
+  // Abramowitz and Stegun 4.4.49, error below 1e-5
+  const double s = a * a;
+  return a * (0.9998660 +
+              s * (-0.3302995 +
+                   s * (0.1801410 + s * (-0.0851330 + s * 0.0208351))));
+}
+
+template <>
+inline double AtanUnit<TrigAccuracy::kFine>(const double a) {
+  // atan(a) = pi / 4 + atan((a - 1) / (a + 1)) brings the argument below
+  // tan(pi / 8), where the series up to t^15 is within 2e-8
+  const bool shift = a > kTanPiOverEight;
+  const double t = shift ? (a - 1.0) / (a + 1.0) : a;
+  const double s = t * t;
+  const double atan_t =
+      t * (1.0 +
+           s * (-1.0 / 3.0 +
+                s * (1.0 / 5.0 +
+                     s * (-1.0 / 7.0 +
+                          s * (1.0 / 9.0 +
+                               s * (-1.0 / 11.0 +
+                                    s * (1.0 / 13.0 + s * (-1.0 / 15.0))))))));
+  return shift ? kPiOverFour + atan_t : atan_t;
+}
+
+}  // namespace fast_trig_internal
+
+/**
+ * @brief Computes the sine and the cosine of an angle together.
+ *        Without branches on the angle, so loops over it vectorize.
+ * @param x the angle in radians, below 1e5 in magnitude.
+ * @param sin_x output sine of the angle.
+ * @param cos_x output cosine of the angle.
+ */
+template <TrigAccuracy A = TrigAccuracy::kFine>
+inline void FastSinCos(const double x, double *sin_x, double *cos_x) {
+  double r = 0.0;
+  const int64_t quadrant = fast_trig_internal::ReduceQuadrant(x, &r);
+  const double r2 = r * r;
+  const double s = fast_trig_internal::SinPoly<A>(r, r2);
+  const double c = fast_trig_internal::CosPoly<A>(r2);
+  // sin(r + q * pi / 2) and cos(r + q * pi / 2) for the quadrant q mod 4
+  const bool swap = (quadrant & 1) != 0;
+  const double sin_r = swap ? c : s;
+  const double cos_r = swap ? s : c;
+  *sin_x = (quadrant & 2) != 0 ? -sin_r : sin_r;
+  *cos_x = ((quadrant + 1) & 2) != 0 ? -cos_r : cos_r;
+}
+
+template <TrigAccuracy A = TrigAccuracy::kFine>
+inline double FastSin(const double x) {
+  double sin_x = 0.0;
+  double cos_x = 0.0;
+  FastSinCos<A>(x, &sin_x, &cos_x);
+  return sin_x;
+}
+
+template <TrigAccuracy A = TrigAccuracy::kFine>
+inline double FastCos(const double x) {
+  double sin_x = 0.0;
+  double cos_x = 0.0;
+  FastSinCos<A>(x, &sin_x, &cos_x);
+  return cos_x;
+}
+
+/**
+ * @brief Computes the sines and the cosines of an array of angles.
+ * @param x the angles in radians, below 1e5 in magnitude.
+ * @param size the number of angles.
+ * @param sin_x output sines, room for size values.
+ * @param cos_x output cosines, room for size values.
+ */
+template <TrigAccuracy A = TrigAccuracy::kFine>
+inline void FastSinCos(const double *x, const size_t size, double *sin_x,
+                       double *cos_x) {
+  for (size_t i = 0; i < size; ++i) {
+    FastSinCos<A>(x[i], sin_x + i, cos_x + i);
+  }
+}
+
+/**
+ * @brief Computes the angle of the vector (x, y) in [-pi, pi], as atan2.
+ * @param y the y coordinate of the vector.
+ * @param x the x coordinate of the vector.
+ * @return the angle of the vector, 0 for the zero vector.
+ */
+template <TrigAccuracy A = TrigAccuracy::kFine>
+inline double FastAtan2(const double y, const double x) {
+  const double abs_x = x < 0.0 ? -x : x;
+  const double abs_y = y < 0.0 ? -y : y;
+  const bool steep = abs_y > abs_x;
+  const double num = steep ? abs_x : abs_y;
+  const double den = steep ? abs_y : abs_x;
+  const double a = den > 0.0 ? num / den : 0.0;
+  double angle = fast_trig_internal::AtanUnit<A>(a);
+  angle = steep ? fast_trig_internal::kPiOverTwo - angle : angle;
+  angle = x < 0.0 ? fast_trig_internal::kPi - angle : angle;
+  return y < 0.0 ? -angle : angle;
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
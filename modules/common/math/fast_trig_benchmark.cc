@@ -0,0 +1,231 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ * @brief Times the fast trigonometry against libm, alone and inside the
+ *        batch Cartesian to Frenet conversions.
+ *
+ * Example:
+ *   fast_trig_benchmark --benchmark_size=4096
+ **/
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gflags/gflags.h"
+
+#include "modules/common/math/cartesian_frenet_conversion.h"
+#include "modules/common/math/fast_trig.h"
+
+DEFINE_int32(benchmark_size, 4096, "angles, or trajectory points, per run");
+DEFINE_int32(benchmark_iterations, 200, "runs of every case");
+
+namespace apollo {
+namespace common {
+namespace math {
+namespace {
+
+template <typename Func>
+double TimeUs(const Func& func) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < FLAGS_benchmark_iterations; ++i) {
+    func();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() /
+         FLAGS_benchmark_iterations;
+}
+
+void Report(const std::string& name, const double libm_us,
+            const double fast_us, const double max_error) {
+  std::cout << std::setw(22) << name << std::fixed << std::setprecision(2)
+            << std::setw(12) << libm_us << std::setw(12) << fast_us
+            << std::setw(10) << libm_us / fast_us << std::scientific
+            << std::setprecision(1) << std::setw(12) << max_error
+            << std::endl;
+}
+
+template <TrigAccuracy A>
+void BenchmarkSinCos(const std::string& name,
+                     const std::vector<double>& angles) {
+  const size_t size = angles.size();
+  std::vector<double> libm_sin(size);
+  std::vector<double> libm_cos(size);
+  std::vector<double> fast_sin(size);
+  std::vector<double> fast_cos(size);
+  const double libm_us = TimeUs([&]() {
+    for (size_t i = 0; i < size; ++i) {
+      libm_sin[i] = std::sin(angles[i]);
+      libm_cos[i] = std::cos(angles[i]);
+    }
+  });
+  const double fast_us = TimeUs([&]() {
+    FastSinCos<A>(angles.data(), size, fast_sin.data(), fast_cos.data());
+  });
+  double max_error = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    max_error = std::max(max_error, std::abs(libm_sin[i] - fast_sin[i]));
+    max_error = std::max(max_error, std::abs(libm_cos[i] - fast_cos[i]));
+  }
+  Report(name, libm_us, fast_us, max_error);
+}
+
+template <TrigAccuracy A>
+void BenchmarkAtan2(const std::string& name, const std::vector<double>& ys,
+                    const std::vector<double>& xs) {
+  const size_t size = ys.size();
+  std::vector<double> libm_angles(size);
+  std::vector<double> fast_angles(size);
+  const double libm_us = TimeUs([&]() {
+    for (size_t i = 0; i < size; ++i) {
+      libm_angles[i] = std::atan2(ys[i], xs[i]);
+    }
+  });
+  const double fast_us = TimeUs([&]() {
+    for (size_t i = 0; i < size; ++i) {
+      fast_angles[i] = FastAtan2<A>(ys[i], xs[i]);
+    }
+  });
+  double max_error = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    max_error =
+        std::max(max_error, std::abs(libm_angles[i] - fast_angles[i]));
+  }
+  Report(name, libm_us, fast_us, max_error);
+}
+
+// the per point conversions use libm, the batch ones the fast trigonometry
+void BenchmarkFrenet(std::mt19937* engine) {
+  std::uniform_real_distribution<double> position(-5.0, 5.0);
+  std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+  std::uniform_real_distribution<double> offset(-1.0, 1.0);
+  std::uniform_real_distribution<double> kappa(-0.05, 0.05);
+  std::vector<PathPoint> ref_points;
+  std::vector<TrajectoryPoint> points;
+  for (int i = 0; i < FLAGS_benchmark_size; ++i) {
+    PathPoint ref_point;
+    ref_point.set_s(i * 0.5);
+    ref_point.set_x(position(*engine));
+    ref_point.set_y(position(*engine));
+    ref_point.set_theta(heading(*engine));
+    ref_point.set_kappa(kappa(*engine));
+    ref_points.push_back(ref_point);
+    TrajectoryPoint point;
+    point.mutable_path_point()->set_x(ref_point.x() + position(*engine));
+    point.mutable_path_point()->set_y(ref_point.y() + position(*engine));
+    point.mutable_path_point()->set_theta(ref_point.theta() +
+                                          offset(*engine));
+    point.mutable_path_point()->set_kappa(kappa(*engine));
+    point.set_v(10.0);
+    point.set_a(offset(*engine));
+    points.push_back(point);
+  }
+
+  const size_t size = points.size();
+  std::vector<std::array<double, 3>> s_conditions(size);
+  std::vector<std::array<double, 3>> d_conditions(size);
+  const double libm_us = TimeUs([&]() {
+    for (size_t i = 0; i < size; ++i) {
+      const PathPoint& ref = ref_points[i];
+      const PathPoint& point = points[i].path_point();
+      CartesianFrenetConverter::cartesian_to_frenet(
+          ref.s(), ref.x(), ref.y(), ref.theta(), ref.kappa(), ref.dkappa(),
+          point.x(), point.y(), points[i].v(), points[i].a(), point.theta(),
+          point.kappa(), &s_conditions[i], &d_conditions[i]);
+    }
+  });
+  std::vector<std::array<double, 3>> batch_s_conditions;
+  std::vector<std::array<double, 3>> batch_d_conditions;
+  const double fast_us = TimeUs([&]() {
+    CartesianFrenetConverter::cartesian_to_frenet(
+        ref_points, points, &batch_s_conditions, &batch_d_conditions);
+  });
+  double max_error = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    max_error = std::max(
+        max_error, std::abs(d_conditions[i][0] - batch_d_conditions[i][0]));
+  }
+  Report("cartesian_to_frenet", libm_us, fast_us, max_error);
+
+  std::vector<TrajectoryPoint> cartesian_points;
+  std::vector<double> xs(size);
+  const double libm_back_us = TimeUs([&]() {
+    for (size_t i = 0; i < size; ++i) {
+      const PathPoint& ref = ref_points[i];
+      double y = 0.0;
+      double theta = 0.0;
+      double kappa = 0.0;
+      double v = 0.0;
+      double a = 0.0;
+      CartesianFrenetConverter::frenet_to_cartesian(
+          ref.s(), ref.x(), ref.y(), ref.theta(), ref.kappa(), ref.dkappa(),
+          s_conditions[i], d_conditions[i], &xs[i], &y, &theta, &kappa, &v,
+          &a);
+    }
+  });
+  const double fast_back_us = TimeUs([&]() {
+    CartesianFrenetConverter::frenet_to_cartesian(
+        ref_points, s_conditions, d_conditions, &cartesian_points);
+  });
+  max_error = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    max_error = std::max(
+        max_error, std::abs(xs[i] - cartesian_points[i].path_point().x()));
+  }
+  Report("frenet_to_cartesian", libm_back_us, fast_back_us, max_error);
+}
+
+void Benchmark() {
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> angle(-10.0, 10.0);
+  std::uniform_real_distribution<double> coordinate(-50.0, 50.0);
+  std::vector<double> angles;
+  std::vector<double> ys;
+  std::vector<double> xs;
+  for (int i = 0; i < FLAGS_benchmark_size; ++i) {
+    angles.push_back(angle(engine));
+    ys.push_back(coordinate(engine));
+    xs.push_back(coordinate(engine));
+  }
+  BenchmarkSinCos<TrigAccuracy::kCoarse>("sincos coarse", angles);
+  BenchmarkSinCos<TrigAccuracy::kFine>("sincos fine", angles);
+  BenchmarkAtan2<TrigAccuracy::kCoarse>("atan2 coarse", ys, xs);
+  BenchmarkAtan2<TrigAccuracy::kFine>("atan2 fine", ys, xs);
+  BenchmarkFrenet(&engine);
+}
+
+}  // namespace
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  std::cout << std::setw(22) << "case" << std::setw(12) << "libm us"
+            << std::setw(12) << "fast us" << std::setw(10) << "speedup"
+            << std::setw(12) << "max error" << std::endl;
+  apollo::common::math::Benchmark();
+  return 0;
+}
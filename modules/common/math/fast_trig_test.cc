@@ -0,0 +1,110 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/common/math/fast_trig.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+namespace {
+
+template <TrigAccuracy A>
+void ExpectSinCosWithin(const double bound) {
+  double max_error = 0.0;
+  for (double x = -100.0; x < 100.0; x += 1.0e-3) {
+    double sin_x = 0.0;
+    double cos_x = 0.0;
+    FastSinCos<A>(x, &sin_x, &cos_x);
+    max_error = std::max(max_error, std::abs(sin_x - std::sin(x)));
+    max_error = std::max(max_error, std::abs(cos_x - std::cos(x)));
+  }
+  EXPECT_LT(max_error, bound);
+}
+
+template <TrigAccuracy A>
+void ExpectAtan2Within(const double bound) {
+  double max_error = 0.0;
+  for (double y = -10.0; y <= 10.0; y += 0.0137) {
+    for (double x = -10.0; x <= 10.0; x += 0.0131) {
+      max_error =
+          std::max(max_error, std::abs(FastAtan2<A>(y, x) - std::atan2(y, x)));
+    }
+  }
+  EXPECT_LT(max_error, bound);
+}
+
+}  // namespace
+
+TEST(FastTrigTest, SinCosCoarse) {
+  ExpectSinCosWithin<TrigAccuracy::kCoarse>(1.0e-4);
+}
+
+TEST(FastTrigTest, SinCosFine) {
+  ExpectSinCosWithin<TrigAccuracy::kFine>(1.0e-7);
+}
+
+TEST(FastTrigTest, SinCosQuadrants) {
+  EXPECT_NEAR(0.0, FastSin(0.0), 1.0e-12);
+  EXPECT_NEAR(1.0, FastCos(0.0), 1.0e-12);
+  EXPECT_NEAR(1.0, FastSin(M_PI_2), 1.0e-12);
+  EXPECT_NEAR(-1.0, FastCos(M_PI), 1.0e-12);
+  EXPECT_NEAR(-1.0, FastSin(-M_PI_2), 1.0e-12);
+  EXPECT_NEAR(-1.0, FastSin(3.0 * M_PI_2), 1.0e-12);
+  EXPECT_NEAR(std::sin(-2.5), FastSin(-2.5), 1.0e-7);
+  EXPECT_NEAR(std::cos(-2.5), FastCos(-2.5), 1.0e-7);
+  EXPECT_NEAR(std::sin(1.0e4 + 0.3), FastSin(1.0e4 + 0.3), 1.0e-7);
+}
+
+TEST(FastTrigTest, SinCosArray) {
+  std::vector<double> x;
+  for (int i = 0; i < 100; ++i) {
+    x.push_back(0.1 * i - 5.0);
+  }
+  std::vector<double> sin_x(x.size());
+  std::vector<double> cos_x(x.size());
+  FastSinCos(x.data(), x.size(), sin_x.data(), cos_x.data());
+  for (size_t i = 0; i < x.size(); ++i) {
+    EXPECT_DOUBLE_EQ(FastSin(x[i]), sin_x[i]);
+    EXPECT_DOUBLE_EQ(FastCos(x[i]), cos_x[i]);
+  }
+}
+
+TEST(FastTrigTest, Atan2Coarse) {
+  ExpectAtan2Within<TrigAccuracy::kCoarse>(1.0e-4);
+}
+
+TEST(FastTrigTest, Atan2Fine) { ExpectAtan2Within<TrigAccuracy::kFine>(1.0e-7); }
+
+TEST(FastTrigTest, Atan2Axes) {
+  EXPECT_DOUBLE_EQ(0.0, FastAtan2(0.0, 0.0));
+  EXPECT_DOUBLE_EQ(0.0, FastAtan2(0.0, 1.0));
+  EXPECT_DOUBLE_EQ(M_PI, FastAtan2(0.0, -1.0));
+  EXPECT_DOUBLE_EQ(M_PI_2, FastAtan2(1.0, 0.0));
+  EXPECT_DOUBLE_EQ(-M_PI_2, FastAtan2(-1.0, 0.0));
+  EXPECT_NEAR(-3.0 * M_PI_4, FastAtan2(-1.0, -1.0), 1.0e-12);
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
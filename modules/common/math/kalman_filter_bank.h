@@ -0,0 +1,236 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ * @brief Defines the templated KalmanFilterBank class.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "Eigen/StdVector"
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+/**
+ * @class KalmanFilterBank
+ *
+ * @brief Many discrete-time Kalman filters sharing one motion and one
+ * observation model, e.g. the tracks of a tracker. The means and the
+ * covariances of all filters are kept in two contiguous arrays so that a
+ * predict or a correct of all of them is a tight loop over fixed-size
+ * matrices, and nothing is allocated once the capacity is reserved.
+ *
+ * @param XN dimension of state
+ * @param ZN dimension of observations
+ */
+template <typename T, unsigned int XN, unsigned int ZN>
+class KalmanFilterBank {
+ public:
+  using State = Eigen::Matrix<T, XN, 1>;
+  using Covariance = Eigen::Matrix<T, XN, XN>;
+  using Observation = Eigen::Matrix<T, ZN, 1>;
+  using ObservationMatrix = Eigen::Matrix<T, ZN, XN>;
+  using ObservationNoise = Eigen::Matrix<T, ZN, ZN>;
+
+  /**
+   * @brief Constructor of an empty bank with the identity transition and
+   * observation matrices and zero noises.
+   */
+  KalmanFilterBank() {
+    F_.setIdentity();
+    Q_.setZero();
+    SetObservationMatrix(ObservationMatrix::Identity());
+    R_.setZero();
+  }
+
+  /**
+   * @brief Reserves room for the given number of filters.
+   *
+   * @param capacity Number of filters
+   */
+  void Reserve(const size_t capacity) {
+    states_.reserve(capacity);
+    covariances_.reserve(capacity);
+  }
+
+  /**
+   * @brief Adds a filter with the given state belief distribution.
+   *
+   * @param x Mean of the state belief distribution
+   * @param P Covariance of the state belief distribution
+   * @return Index of the new filter
+   */
+  size_t Add(const State &x, const Covariance &P) {
+    states_.push_back(x);
+    covariances_.push_back(P);
+    return states_.size() - 1;
+  }
+
+  /**
+   * @brief Removes a filter. The last filter is moved into its index, so
+   * indices of the other filters stay valid.
+   *
+   * @param index Index of the filter to remove
+   */
+  void Remove(const size_t index) {
+    CHECK_LT(index, states_.size());
+    states_[index] = states_.back();
+    covariances_[index] = covariances_.back();
+    states_.pop_back();
+    covariances_.pop_back();
+  }
+
+  void Clear() {
+    states_.clear();
+    covariances_.clear();
+  }
+
+  size_t size() const { return states_.size(); }
+
+  void SetTransitionMatrix(const Covariance &F) { F_ = F; }
+
+  void SetTransitionNoise(const Covariance &Q) { Q_ = Q; }
+
+  void SetObservationMatrix(const ObservationMatrix &H) {
+    H_ = H;
+    Ht_ = H.transpose();
+  }
+
+  void SetObservationNoise(const ObservationNoise &R) { R_ = R; }
+
+  const Covariance &GetTransitionMatrix() const { return F_; }
+
+  const Covariance &GetTransitionNoise() const { return Q_; }
+
+  const ObservationMatrix &GetObservationMatrix() const { return H_; }
+
+  const ObservationNoise &GetObservationNoise() const { return R_; }
+
+  const State &GetStateEstimate(const size_t index) const {
+    return states_[index];
+  }
+
+  const Covariance &GetStateCovariance(const size_t index) const {
+    return covariances_[index];
+  }
+
+  void SetStateEstimate(const size_t index, const State &x,
+                        const Covariance &P) {
+    states_[index] = x;
+    covariances_[index] = P;
+  }
+
+  /**
+   * @brief Updates the state belief distributions of all filters under
+   * zero control.
+   */
+  void Predict();
+
+  /**
+   * @brief Updates the state belief distribution of one filter given an
+   * observation z.
+   *
+   * @param index Index of the filter
+   * @param z Observation
+   */
+  void Correct(const size_t index, const Observation &z);
+
+  /**
+   * @brief Updates the state belief distributions of several filters, the
+   * i-th of them given the i-th observation.
+   *
+   * @param indices Indices of the filters
+   * @param z Observations, as many as indices
+   */
+  void Correct(
+      const std::vector<size_t> &indices,
+      const std::vector<Observation, Eigen::aligned_allocator<Observation>>
+          &z);
+
+ private:
+  std::vector<State, Eigen::aligned_allocator<State>> states_;
+  std::vector<Covariance, Eigen::aligned_allocator<Covariance>> covariances_;
+
+  // State transition matrix under zero control
+  Covariance F_;
+  // Covariance of the state transition noise
+  Covariance Q_;
+  // Observation matrix and its transpose
+  ObservationMatrix H_;
+  Eigen::Matrix<T, XN, ZN> Ht_;
+  // Covariance of observation noise
+  ObservationNoise R_;
+
+  // Scratch, marked as members to prevent memory re-allocation.
+  Covariance FP_;
+  Eigen::Matrix<T, XN, ZN> PHt_;
+  ObservationNoise S_;
+  Eigen::Matrix<T, XN, ZN> K_;
+};
+
+template <typename T, unsigned int XN, unsigned int ZN>
+inline void KalmanFilterBank<T, XN, ZN>::Predict() {
+  const size_t num_filters = states_.size();
+  for (size_t i = 0; i < num_filters; ++i) {
+    states_[i] = F_ * states_[i];
+  }
+  for (size_t i = 0; i < num_filters; ++i) {
+    FP_.noalias() = F_ * covariances_[i];
+    covariances_[i] = Q_;
+    covariances_[i].noalias() += FP_ * F_.transpose();
+  }
+}
+
+template <typename T, unsigned int XN, unsigned int ZN>
+inline void KalmanFilterBank<T, XN, ZN>::Correct(const size_t index,
+                                                 const Observation &z) {
+  DCHECK_LT(index, states_.size());
+  State &x = states_[index];
+  Covariance &P = covariances_[index];
+  PHt_.noalias() = P * Ht_;
+  S_ = R_;
+  S_.noalias() += H_ * PHt_;
+  // the innovation covariance is symmetric positive definite, so the closed
+  // form inverse of the small fixed-size matrix replaces the pseudo inverse
+  K_.noalias() = PHt_ * S_.inverse();
+  x.noalias() += K_ * (z - H_ * x);
+  P.noalias() -= K_ * PHt_.transpose();
+}
+
+template <typename T, unsigned int XN, unsigned int ZN>
+inline void KalmanFilterBank<T, XN, ZN>::Correct(
+    const std::vector<size_t> &indices,
+    const std::vector<Observation, Eigen::aligned_allocator<Observation>>
+        &z) {
+  CHECK_EQ(indices.size(), z.size());
+  for (size_t i = 0; i < indices.size(); ++i) {
+    Correct(indices[i], z[i]);
+  }
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
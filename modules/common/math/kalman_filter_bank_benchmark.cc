@@ -0,0 +1,138 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ * @brief Times KalmanFilterBank against one KalmanFilter per track for a
+ *        constant velocity tracker, every track predicted and corrected
+ *        once per frame.
+ *
+ * Example:
+ *   kalman_filter_bank_benchmark --benchmark_tracks=512
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "gflags/gflags.h"
+
+#include "modules/common/math/kalman_filter.h"
+#include "modules/common/math/kalman_filter_bank.h"
+
+DEFINE_int32(benchmark_tracks, 512,
+             "tracks of the largest bank, the others have 1/16, 1/4 and "
+             "1/2 of them");
+DEFINE_int32(benchmark_iterations, 200, "frames of every case");
+
+namespace apollo {
+namespace common {
+namespace math {
+namespace {
+
+using Filter = KalmanFilter<double, 4, 2, 0>;
+using Bank = KalmanFilterBank<double, 4, 2>;
+using Observations =
+    std::vector<Eigen::Vector2d, Eigen::aligned_allocator<Eigen::Vector2d>>;
+
+template <typename Func>
+double TimeUs(const Func& func) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < FLAGS_benchmark_iterations; ++i) {
+    func();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() /
+         FLAGS_benchmark_iterations;
+}
+
+void Run(const int num_tracks) {
+  Eigen::Matrix4d F = Eigen::Matrix4d::Identity();
+  F(0, 2) = 0.1;
+  F(1, 3) = 0.1;
+  const Eigen::Matrix4d Q = Eigen::Matrix4d::Identity() * 0.01;
+  Eigen::Matrix<double, 2, 4> H = Eigen::Matrix<double, 2, 4>::Zero();
+  H(0, 0) = 1.0;
+  H(1, 1) = 1.0;
+  const Eigen::Matrix2d R = Eigen::Matrix2d::Identity() * 0.25;
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> value(-30.0, 30.0);
+  std::vector<Filter> filters;
+  Bank bank;
+  bank.SetTransitionMatrix(F);
+  bank.SetTransitionNoise(Q);
+  bank.SetObservationMatrix(H);
+  bank.SetObservationNoise(R);
+  bank.Reserve(num_tracks);
+  std::vector<size_t> indices;
+  Observations z;
+  for (int i = 0; i < num_tracks; ++i) {
+    Eigen::Vector4d x;
+    x << value(engine), value(engine), value(engine), value(engine);
+    const Eigen::Matrix4d P = Eigen::Matrix4d::Identity();
+    filters.emplace_back(x, P);
+    filters.back().SetTransitionMatrix(F);
+    filters.back().SetTransitionNoise(Q);
+    filters.back().SetObservationMatrix(H);
+    filters.back().SetObservationNoise(R);
+    bank.Add(x, P);
+    indices.push_back(i);
+    z.emplace_back(x(0), x(1));
+  }
+
+  const double filter_us = TimeUs([&]() {
+    for (int i = 0; i < num_tracks; ++i) {
+      filters[i].Predict();
+      filters[i].Correct(z[i]);
+    }
+  });
+  const double bank_us = TimeUs([&]() {
+    bank.Predict();
+    bank.Correct(indices, z);
+  });
+
+  bool same = true;
+  for (int i = 0; i < num_tracks; ++i) {
+    same = same && bank.GetStateEstimate(i).isApprox(
+                       filters[i].GetStateEstimate(), 1e-6);
+  }
+  std::cout << std::setw(8) << num_tracks << std::fixed
+            << std::setprecision(2) << std::setw(12) << filter_us
+            << std::setw(12) << bank_us << std::setw(10)
+            << filter_us / bank_us << std::setw(8) << (same ? "yes" : "NO")
+            << std::endl;
+}
+
+}  // namespace
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  std::cout << std::setw(8) << "tracks" << std::setw(12) << "filter(us)"
+            << std::setw(12) << "bank(us)" << std::setw(10) << "speedup"
+            << std::setw(8) << "same" << std::endl;
+  for (const int divisor : {16, 4, 2, 1}) {
+    apollo::common::math::Run(std::max(1, FLAGS_benchmark_tracks / divisor));
+  }
+  return 0;
+}
@@ -0,0 +1,136 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/common/math/kalman_filter_bank.h"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "modules/common/math/kalman_filter.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+class KalmanFilterBankTest : public ::testing::Test {
+ public:
+  virtual void SetUp() {
+    // constant velocity in the plane, position observed
+    const double dt = 0.1;
+    F_.setIdentity();
+    F_(0, 2) = dt;
+    F_(1, 3) = dt;
+    Q_.setIdentity();
+    Q_ *= 0.01;
+    H_.setZero();
+    H_(0, 0) = 1.0;
+    H_(1, 1) = 1.0;
+    R_.setIdentity();
+    R_ *= 0.25;
+
+    bank_.SetTransitionMatrix(F_);
+    bank_.SetTransitionNoise(Q_);
+    bank_.SetObservationMatrix(H_);
+    bank_.SetObservationNoise(R_);
+  }
+
+ protected:
+  KalmanFilter<double, 4, 2, 0> MakeFilter(
+      const Eigen::Matrix<double, 4, 1>& x,
+      const Eigen::Matrix<double, 4, 4>& P) const {
+    KalmanFilter<double, 4, 2, 0> kf(x, P);
+    kf.SetTransitionMatrix(F_);
+    kf.SetTransitionNoise(Q_);
+    kf.SetObservationMatrix(H_);
+    kf.SetObservationNoise(R_);
+    return kf;
+  }
+
+  Eigen::Matrix<double, 4, 4> F_;
+  Eigen::Matrix<double, 4, 4> Q_;
+  Eigen::Matrix<double, 2, 4> H_;
+  Eigen::Matrix<double, 2, 2> R_;
+  KalmanFilterBank<double, 4, 2> bank_;
+};
+
+TEST_F(KalmanFilterBankTest, MatchesKalmanFilter) {
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> value(-10.0, 10.0);
+  const size_t num_filters = 20;
+  std::vector<KalmanFilter<double, 4, 2, 0>> filters;
+  bank_.Reserve(num_filters);
+  for (size_t i = 0; i < num_filters; ++i) {
+    Eigen::Matrix<double, 4, 1> x;
+    x << value(engine), value(engine), value(engine), value(engine);
+    const Eigen::Matrix<double, 4, 4> P =
+        Eigen::Matrix<double, 4, 4>::Identity() * (1.0 + 0.1 * i);
+    filters.push_back(MakeFilter(x, P));
+    EXPECT_EQ(i, bank_.Add(x, P));
+  }
+  EXPECT_EQ(num_filters, bank_.size());
+
+  for (int step = 0; step < 30; ++step) {
+    bank_.Predict();
+    std::vector<size_t> indices;
+    std::vector<Eigen::Vector2d, Eigen::aligned_allocator<Eigen::Vector2d>> z;
+    for (size_t i = 0; i < num_filters; ++i) {
+      filters[i].Predict();
+      // every third filter misses its observation
+      if ((i + step) % 3 == 0) {
+        continue;
+      }
+      indices.push_back(i);
+      z.emplace_back(value(engine), value(engine));
+      filters[i].Correct(z.back());
+    }
+    bank_.Correct(indices, z);
+  }
+
+  for (size_t i = 0; i < num_filters; ++i) {
+    EXPECT_TRUE(
+        bank_.GetStateEstimate(i).isApprox(filters[i].GetStateEstimate(),
+                                           1e-9));
+    EXPECT_TRUE(
+        bank_.GetStateCovariance(i).isApprox(filters[i].GetStateCovariance(),
+                                             1e-9));
+  }
+}
+
+TEST_F(KalmanFilterBankTest, RemoveMovesLastFilter) {
+  Eigen::Matrix<double, 4, 4> P = Eigen::Matrix<double, 4, 4>::Identity();
+  for (int i = 0; i < 3; ++i) {
+    bank_.Add(Eigen::Matrix<double, 4, 1>::Constant(i), P);
+  }
+  bank_.Remove(0);
+  EXPECT_EQ(2, bank_.size());
+  EXPECT_DOUBLE_EQ(2.0, bank_.GetStateEstimate(0)(0));
+  EXPECT_DOUBLE_EQ(1.0, bank_.GetStateEstimate(1)(0));
+
+  bank_.Correct(1, Eigen::Vector2d(1.0, 1.0));
+  EXPECT_DOUBLE_EQ(1.0, bank_.GetStateEstimate(1)(0));
+  EXPECT_LT(bank_.GetStateCovariance(1)(0, 0), 1.0);
+  EXPECT_DOUBLE_EQ(1.0, bank_.GetStateCovariance(0)(0, 0));
+
+  bank_.Clear();
+  EXPECT_EQ(0, bank_.size());
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
@@ -21,7 +21,13 @@
 
 #pragma once
 
+#include <cmath>
+#include <limits>
+
 #include "Eigen/Core"
+#include "Eigen/LU"
+
+#include "cyber/common/log.h"
 
 /**
  * @namespace apollo::common::math
@@ -47,6 +53,43 @@ void SolveLQRProblem(const Eigen::MatrixXd &A, const Eigen::MatrixXd &B,
                      const double tolerance, const uint max_num_iteration,
                      Eigen::MatrixXd *ptr_K);
 
+/**
+ * @brief Solver for discrete-time linear quadratic problem of fixed size,
+ *        the same iteration as above without any heap allocation.
+ * @param N The number of states
+ * @param M The number of controls
+ */
+template <int N, int M>
+void SolveLQRProblem(const Eigen::Matrix<double, N, N> &A,
+                     const Eigen::Matrix<double, N, M> &B,
+                     const Eigen::Matrix<double, N, N> &Q,
+                     const Eigen::Matrix<double, M, M> &R,
+                     const double tolerance, const uint max_num_iteration,
+                     Eigen::Matrix<double, M, N> *ptr_K) {
+  const Eigen::Matrix<double, N, N> AT = A.transpose();
+  const Eigen::Matrix<double, M, N> BT = B.transpose();
+
+  Eigen::Matrix<double, N, N> P = Q;
+  uint num_iteration = 0;
+  double diff = std::numeric_limits<double>::max();
+  while (num_iteration++ < max_num_iteration && diff > tolerance) {
+    const Eigen::Matrix<double, N, N> P_next =
+        AT * P * A - AT * P * B * (R + BT * P * B).inverse() * BT * P * A + Q;
+    diff = std::fabs((P_next - P).maxCoeff());
+    P = P_next;
+  }
+
+  if (num_iteration >= max_num_iteration) {
+    AWARN << "LQR solver cannot converge to a solution, "
+             "last consecutive result diff. is:"
+          << diff;
+  } else {
+    ADEBUG << "LQR solver converged at iteration: " << num_iteration
+           << ", max consecutive result diff.: " << diff;
+  }
+  *ptr_K = (R + BT * P * B).inverse() * BT * P * A;
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -0,0 +1,54 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/common/math/linear_quadratic_regulator.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+TEST(LinearQuadraticRegulatorTest, FixedSizeSameAsDynamic) {
+  // discrete lateral error dynamics of a car at 10 m/s, dt = 0.01 s
+  Eigen::Matrix<double, 4, 4> A;
+  A << 1.0, 0.01, 0.0, 0.0, 0.0, 0.93, 1.4, -0.004, 0.0, 0.0, 1.0, 0.01, 0.0,
+      0.003, -0.03, 0.92;
+  Eigen::Matrix<double, 4, 1> B;
+  B << 0.0, 0.27, 0.0, 0.39;
+  Eigen::Matrix<double, 4, 4> Q = Eigen::Matrix<double, 4, 4>::Zero();
+  Q.diagonal() << 0.05, 0.0, 1.0, 0.0;
+  Eigen::Matrix<double, 1, 1> R;
+  R << 1.0;
+
+  Eigen::MatrixXd dynamic_k;
+  SolveLQRProblem(Eigen::MatrixXd(A), Eigen::MatrixXd(B), Eigen::MatrixXd(Q),
+                  Eigen::MatrixXd(R), 0.01, 150, &dynamic_k);
+  Eigen::Matrix<double, 1, 4> fixed_k;
+  SolveLQRProblem<4, 1>(A, B, Q, R, 0.01, 150, &fixed_k);
+
+  ASSERT_EQ(1, dynamic_k.rows());
+  ASSERT_EQ(4, dynamic_k.cols());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_NEAR(dynamic_k(0, i), fixed_k(0, i), 1e-9);
+  }
+  EXPECT_GT(fixed_k(0, 0), 0.0);
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
@@ -53,6 +53,10 @@ double WrapAngle(const double angle) {
 }
 
 double NormalizeAngle(const double angle) {
+  // most angles are already normalized, which spares them the fmod
+  if (angle >= -M_PI && angle < M_PI) {
+    return angle;
+  }
   double a = std::fmod(angle + M_PI, 2.0 * M_PI);
   if (a < 0.0) {
     a += (2.0 * M_PI);
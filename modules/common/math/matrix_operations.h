@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
 #include <vector>
@@ -157,6 +158,85 @@ void DenseToCSCMatrix(const Eigen::Matrix<T, M, N> &dense_matrix,
   indptr->emplace_back(data_count);
 }
 
+/**
+ * @brief Converts two dense matrices stacked on top of each other to CSC
+ * format without building the stacked matrix.
+ */
+template <typename T, int M, int N, typename D>
+void StackedDenseToCSCMatrix(const Eigen::Matrix<T, M, N> &top,
+                             const Eigen::Matrix<T, M, N> &bottom,
+                             std::vector<T> *data, std::vector<D> *indices,
+                             std::vector<D> *indptr) {
+  constexpr double epsilon = 1e-9;
+  const int top_rows = static_cast<int>(top.rows());
+  const int cols = static_cast<int>(top_rows > 0 ? top.cols() : bottom.cols());
+  int data_count = 0;
+  for (int c = 0; c < cols; ++c) {
+    indptr->emplace_back(data_count);
+    for (int r = 0; r < top_rows; ++r) {
+      if (std::fabs(top(r, c)) < epsilon) {
+        continue;
+      }
+      data->emplace_back(top(r, c));
+      ++data_count;
+      indices->emplace_back(r);
+    }
+    for (int r = 0; r < bottom.rows(); ++r) {
+      if (std::fabs(bottom(r, c)) < epsilon) {
+        continue;
+      }
+      data->emplace_back(bottom(r, c));
+      ++data_count;
+      indices->emplace_back(top_rows + r);
+    }
+  }
+  indptr->emplace_back(data_count);
+}
+
+/**
+ * @brief Builds the CSC structure of a size x size block diagonal matrix
+ * with square blocks of block_size, keeping every entry of the blocks, so
+ * that it only depends on the two sizes and can be kept across matrices.
+ */
+template <typename D>
+void BlockDiagonalCSCStructure(const int size, const int block_size,
+                               std::vector<D> *indices,
+                               std::vector<D> *indptr) {
+  indices->clear();
+  indptr->clear();
+  indices->reserve(static_cast<size_t>(size) * block_size);
+  indptr->reserve(size + 1);
+  for (int c = 0; c < size; ++c) {
+    indptr->emplace_back(static_cast<D>(indices->size()));
+    const int block_begin = c / block_size * block_size;
+    const int block_end = std::min(block_begin + block_size, size);
+    for (int r = block_begin; r < block_end; ++r) {
+      indices->emplace_back(r);
+    }
+  }
+  indptr->emplace_back(static_cast<D>(indices->size()));
+}
+
+/**
+ * @brief Reads the values of a block diagonal matrix in the order of the
+ * structure built by BlockDiagonalCSCStructure. Entries outside of the
+ * blocks are ignored.
+ */
+template <typename T, int M, int N>
+void BlockDiagonalCSCData(const Eigen::Matrix<T, M, N> &dense_matrix,
+                          const int block_size, std::vector<T> *data) {
+  const int size = static_cast<int>(dense_matrix.cols());
+  data->clear();
+  data->reserve(static_cast<size_t>(size) * block_size);
+  for (int c = 0; c < size; ++c) {
+    const int block_begin = c / block_size * block_size;
+    const int block_end = std::min(block_begin + block_size, size);
+    for (int r = block_begin; r < block_end; ++r) {
+      data->emplace_back(dense_matrix(r, c));
+    }
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -380,6 +380,55 @@ TEST(DENSE_TO_CSC_MATRIX, patterned_dense_to_csc_matrix_test) {
   std::cout << std::endl;
 }
 
+TEST(DENSE_TO_CSC_MATRIX, stacked_dense_to_csc_matrix_test) {
+  Eigen::MatrixXd top(1, 3);
+  top << 1.2, 0, 2.2;
+  Eigen::MatrixXd bottom(2, 3);
+  bottom << 0, 0, 3.1, 4.8, 5.4, 6.01;
+  Eigen::MatrixXd stacked(3, 3);
+  stacked << top, bottom;
+
+  std::vector<double> data;
+  std::vector<int> indices;
+  std::vector<int> indptr;
+  StackedDenseToCSCMatrix(top, bottom, &data, &indices, &indptr);
+  std::vector<double> data_golden;
+  std::vector<int> indices_golden;
+  std::vector<int> indptr_golden;
+  DenseToCSCMatrix(stacked, &data_golden, &indices_golden, &indptr_golden);
+  EXPECT_EQ(data, data_golden);
+  EXPECT_EQ(indices, indices_golden);
+  EXPECT_EQ(indptr, indptr_golden);
+}
+
+TEST(DENSE_TO_CSC_MATRIX, block_diagonal_csc_matrix_test) {
+  Eigen::MatrixXd dense_matrix(5, 5);
+  // clang-format off
+  dense_matrix << 1, 2, 0, 0, 0,
+                  3, 4, 0, 0, 0,
+                  0, 0, 5, 0, 6,
+                  0, 0, 0, 7, 8,
+                  0, 0, 9, 0, 1;
+  // clang-format on
+  std::vector<double> data;
+  std::vector<int> indices;
+  std::vector<int> indptr;
+  BlockDiagonalCSCStructure(5, 3, &indices, &indptr);
+  BlockDiagonalCSCData(dense_matrix, 3, &data);
+
+  // the blocks are [0, 3) and [3, 5), zeros inside of them are kept
+  // and the 6 and the 9 outside of them are dropped
+  std::vector<double> data_golden = {1, 3, 0, 2, 4, 0, 0, 0, 5, 7, 0, 8, 1};
+  std::vector<int> indices_golden = {0, 1, 2, 0, 1, 2, 0, 1, 2, 3, 4, 3, 4};
+  std::vector<int> indptr_golden = {0, 3, 6, 9, 11, 13};
+  EXPECT_EQ(indices, indices_golden);
+  EXPECT_EQ(indptr, indptr_golden);
+  ASSERT_EQ(data.size(), data_golden.size());
+  for (size_t i = 0; i < data.size(); ++i) {
+    EXPECT_DOUBLE_EQ(data[i], data_golden[i]);
+  }
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
@@ -0,0 +1,284 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/common/math/mpc_osqp_solver.h"
+
+#include <algorithm>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+using Matrix = Eigen::MatrixXd;
+
+MpcOsqpSolver::~MpcOsqpSolver() { Reset(); }
+
+void MpcOsqpSolver::Reset() {
+  if (work_ != nullptr) {
+    osqp_cleanup(work_);
+    work_ = nullptr;
+  }
+}
+
+bool MpcOsqpSolver::Solve(const Matrix& matrix_a, const Matrix& matrix_b,
+                          const Matrix& matrix_c, const Matrix& matrix_q,
+                          const Matrix& matrix_r, const Matrix& matrix_lower,
+                          const Matrix& matrix_upper,
+                          const Matrix& matrix_initial_state,
+                          const std::vector<Matrix>& reference,
+                          const double eps, const int max_iter,
+                          std::vector<Matrix>* control) {
+  const size_t num_states = matrix_a.rows();
+  const size_t num_controls = matrix_b.cols();
+  const size_t horizon = reference.size();
+  if (matrix_a.rows() != matrix_a.cols() ||
+      matrix_b.rows() != matrix_a.rows() ||
+      matrix_lower.rows() != matrix_upper.rows() ||
+      static_cast<size_t>(matrix_lower.rows()) != num_controls ||
+      horizon == 0 || control->size() < horizon) {
+    AERROR << "One or more matrices have incompatible dimensions. Aborting.";
+    return false;
+  }
+
+  if (num_states != num_states_ || num_controls != num_controls_ ||
+      horizon != horizon_) {
+    Reset();
+    num_states_ = num_states;
+    num_controls_ = num_controls;
+    horizon_ = horizon;
+    BuildStructure();
+  }
+  FillKernel(matrix_q, matrix_r, &new_P_data_);
+  FillConstraint(matrix_a, matrix_b, &new_A_data_);
+
+  const size_t state_size = horizon * num_states;
+  for (size_t k = 0; k < horizon; ++k) {
+    const Matrix q = -matrix_q * reference[k];
+    for (size_t i = 0; i < num_states; ++i) {
+      q_[k * num_states + i] = q(i, 0);
+    }
+  }
+  std::fill(q_.begin() + state_size, q_.end(), 0.0);
+
+  // x(1) - B * u(0) = A * x(0) + C, x(k + 1) - A * x(k) - B * u(k) = C
+  const Matrix first_state = matrix_a * matrix_initial_state + matrix_c;
+  for (size_t k = 0; k < horizon; ++k) {
+    const Matrix& bound = k == 0 ? first_state : matrix_c;
+    for (size_t i = 0; i < num_states; ++i) {
+      lower_bounds_[k * num_states + i] = bound(i, 0);
+      upper_bounds_[k * num_states + i] = bound(i, 0);
+    }
+    for (size_t i = 0; i < num_controls; ++i) {
+      lower_bounds_[state_size + k * num_controls + i] = matrix_lower(i, 0);
+      upper_bounds_[state_size + k * num_controls + i] = matrix_upper(i, 0);
+    }
+  }
+
+  if (work_ == nullptr) {
+    P_data_ = new_P_data_;
+    A_data_ = new_A_data_;
+    if (!Setup(eps, max_iter)) {
+      return false;
+    }
+  } else {
+    // the sparsity patterns are fixed, so only the values are replaced and
+    // osqp refactors its kkt system only when they changed
+    if (new_P_data_ != P_data_) {
+      P_data_ = new_P_data_;
+      osqp_update_P(work_, P_data_.data(), OSQP_NULL,
+                    static_cast<c_int>(P_data_.size()));
+    }
+    if (new_A_data_ != A_data_) {
+      A_data_ = new_A_data_;
+      osqp_update_A(work_, A_data_.data(), OSQP_NULL,
+                    static_cast<c_int>(A_data_.size()));
+    }
+    osqp_update_lin_cost(work_, q_.data());
+    osqp_update_bounds(work_, lower_bounds_.data(), upper_bounds_.data());
+    WarmStart();
+  }
+
+  osqp_solve(work_);
+  const c_int status = work_->info->status_val;
+  if (status != OSQP_SOLVED && status != OSQP_SOLVED_INACCURATE) {
+    AERROR << "Linear MPC osqp solver failed, status " << status;
+    return false;
+  }
+
+  const c_float* solution = work_->solution->x + state_size;
+  for (size_t k = 0; k < horizon; ++k) {
+    Matrix& u = (*control)[k];
+    u.resize(num_controls, 1);
+    for (size_t i = 0; i < num_controls; ++i) {
+      u(i, 0) = solution[k * num_controls + i];
+    }
+  }
+  return true;
+}
+
+void MpcOsqpSolver::BuildStructure() {
+  const size_t n = num_states_;
+  const size_t m = num_controls_;
+  const size_t state_size = horizon_ * n;
+  const size_t num_param = horizon_ * (n + m);
+
+  // the dense upper triangles of the diagonal blocks Q and R
+  P_indices_.clear();
+  P_indptr_.clear();
+  for (size_t col = 0; col < num_param; ++col) {
+    P_indptr_.push_back(static_cast<c_int>(P_indices_.size()));
+    const bool is_state = col < state_size;
+    const size_t block_size = is_state ? n : m;
+    const size_t offset = is_state ? 0 : state_size;
+    const size_t block_begin =
+        offset + (col - offset) / block_size * block_size;
+    for (size_t row = block_begin; row <= col; ++row) {
+      P_indices_.push_back(static_cast<c_int>(row));
+    }
+  }
+  P_indptr_.push_back(static_cast<c_int>(P_indices_.size()));
+
+  // column of x(k + 1): the identity in the dynamics of step k and, but for
+  // the last state, the dense -A of step k + 1. Column of u(k): the dense -B
+  // of step k and the identity of its bound.
+  A_indices_.clear();
+  A_indptr_.clear();
+  for (size_t k = 0; k < horizon_; ++k) {
+    for (size_t j = 0; j < n; ++j) {
+      A_indptr_.push_back(static_cast<c_int>(A_indices_.size()));
+      A_indices_.push_back(static_cast<c_int>(k * n + j));
+      if (k + 1 < horizon_) {
+        for (size_t i = 0; i < n; ++i) {
+          A_indices_.push_back(static_cast<c_int>((k + 1) * n + i));
+        }
+      }
+    }
+  }
+  for (size_t k = 0; k < horizon_; ++k) {
+    for (size_t j = 0; j < m; ++j) {
+      A_indptr_.push_back(static_cast<c_int>(A_indices_.size()));
+      for (size_t i = 0; i < n; ++i) {
+        A_indices_.push_back(static_cast<c_int>(k * n + i));
+      }
+      A_indices_.push_back(static_cast<c_int>(state_size + k * m + j));
+    }
+  }
+  A_indptr_.push_back(static_cast<c_int>(A_indices_.size()));
+
+  q_.resize(num_param);
+  lower_bounds_.resize(num_param);
+  upper_bounds_.resize(num_param);
+  warm_start_.resize(num_param);
+}
+
+void MpcOsqpSolver::FillKernel(const Matrix& matrix_q, const Matrix& matrix_r,
+                               std::vector<c_float>* P_data) const {
+  P_data->clear();
+  for (const Matrix* block : {&matrix_q, &matrix_r}) {
+    for (size_t k = 0; k < horizon_; ++k) {
+      for (int j = 0; j < block->cols(); ++j) {
+        for (int i = 0; i <= j; ++i) {
+          P_data->push_back((*block)(i, j));
+        }
+      }
+    }
+  }
+}
+
+void MpcOsqpSolver::FillConstraint(const Matrix& matrix_a,
+                                   const Matrix& matrix_b,
+                                   std::vector<c_float>* A_data) const {
+  A_data->clear();
+  for (size_t k = 0; k < horizon_; ++k) {
+    for (size_t j = 0; j < num_states_; ++j) {
+      A_data->push_back(1.0);
+      if (k + 1 < horizon_) {
+        for (size_t i = 0; i < num_states_; ++i) {
+          A_data->push_back(-matrix_a(i, j));
+        }
+      }
+    }
+  }
+  for (size_t k = 0; k < horizon_; ++k) {
+    for (size_t j = 0; j < num_controls_; ++j) {
+      for (size_t i = 0; i < num_states_; ++i) {
+        A_data->push_back(-matrix_b(i, j));
+      }
+      A_data->push_back(1.0);
+    }
+  }
+}
+
+bool MpcOsqpSolver::Setup(const double eps, const int max_iter) {
+  OSQPSettings settings;
+  osqp_set_default_settings(&settings);
+  if (eps > 0.0) {
+    settings.eps_abs = eps;
+    settings.eps_rel = eps;
+  }
+  if (max_iter > 0) {
+    settings.max_iter = max_iter;
+  }
+  settings.polish = true;
+  settings.verbose = false;
+  settings.warm_start = true;
+
+  // osqp copies the data into the workspace at setup
+  OSQPData data;
+  data.n = static_cast<c_int>(q_.size());
+  data.m = static_cast<c_int>(lower_bounds_.size());
+  data.P = csc_matrix(data.n, data.n, static_cast<c_int>(P_data_.size()),
+                      P_data_.data(), P_indices_.data(), P_indptr_.data());
+  data.A = csc_matrix(data.m, data.n, static_cast<c_int>(A_data_.size()),
+                      A_data_.data(), A_indices_.data(), A_indptr_.data());
+  data.q = q_.data();
+  data.l = lower_bounds_.data();
+  data.u = upper_bounds_.data();
+
+  work_ = osqp_setup(&data, &settings);
+  c_free(data.A);
+  c_free(data.P);
+  ++num_setups_;
+  if (work_ == nullptr) {
+    AERROR << "Failed to set up the mpc osqp workspace.";
+    return false;
+  }
+  return true;
+}
+
+void MpcOsqpSolver::WarmStart() {
+  // the plan of the last cycle, one step later: every state and control
+  // moves one step earlier and the last ones are repeated
+  const c_float* x = work_->solution->x;
+  const size_t state_size = horizon_ * num_states_;
+  const auto shift = [this, x](const size_t offset, const size_t block) {
+    for (size_t k = 0; k < horizon_; ++k) {
+      const size_t from = std::min(k + 1, horizon_ - 1);
+      std::copy(x + offset + from * block, x + offset + (from + 1) * block,
+                warm_start_.begin() + offset + k * block);
+    }
+  };
+  shift(0, num_states_);
+  shift(state_size, num_controls_);
+  osqp_warm_start_x(work_, warm_start_.data());
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
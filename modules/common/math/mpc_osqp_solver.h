@@ -0,0 +1,116 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file mpc_osqp_solver.h
+ * @brief Solve mpc problems as sparse qp with osqp, keeping the workspace
+ *   between control cycles.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "Eigen/Core"
+#include "osqp/include/osqp.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+/**
+ * @class MpcOsqpSolver
+ *
+ * @brief Solver of the same discrete-time linear mpc problem as
+ *   SolveLinearMPC, x(i + 1) = A * x(i) + B * u(i) + C, but with the states
+ *   kept as variables of the qp: its matrices are block sparse and grow
+ *   linearly with the horizon instead of quadratically.
+ *
+ * The osqp workspace is set up once for given state, control and horizon
+ * sizes. The following solves only update the values of the matrices when
+ * they changed, plus the vectors, and are warm started from the last
+ * solution shifted by one step.
+ */
+class MpcOsqpSolver {
+ public:
+  MpcOsqpSolver() = default;
+
+  ~MpcOsqpSolver();
+
+  MpcOsqpSolver(const MpcOsqpSolver&) = delete;
+  MpcOsqpSolver& operator=(const MpcOsqpSolver&) = delete;
+
+  /**
+   * @brief same parameters as SolveLinearMPC, eps and max_iter are the
+   *   tolerance and iteration limit of osqp, only used at setup
+   */
+  bool Solve(const Eigen::MatrixXd& matrix_a, const Eigen::MatrixXd& matrix_b,
+             const Eigen::MatrixXd& matrix_c, const Eigen::MatrixXd& matrix_q,
+             const Eigen::MatrixXd& matrix_r,
+             const Eigen::MatrixXd& matrix_lower,
+             const Eigen::MatrixXd& matrix_upper,
+             const Eigen::MatrixXd& matrix_initial_state,
+             const std::vector<Eigen::MatrixXd>& reference, const double eps,
+             const int max_iter, std::vector<Eigen::MatrixXd>* control);
+
+  /**
+   * @brief drop the workspace, so that the next solve sets up a new one
+   */
+  void Reset();
+
+  size_t num_setups() const { return num_setups_; }
+
+ private:
+  void BuildStructure();
+  void FillKernel(const Eigen::MatrixXd& matrix_q,
+                  const Eigen::MatrixXd& matrix_r,
+                  std::vector<c_float>* P_data) const;
+  void FillConstraint(const Eigen::MatrixXd& matrix_a,
+                      const Eigen::MatrixXd& matrix_b,
+                      std::vector<c_float>* A_data) const;
+  bool Setup(const double eps, const int max_iter);
+  void WarmStart();
+
+  OSQPWorkspace* work_ = nullptr;
+
+  size_t num_states_ = 0;
+  size_t num_controls_ = 0;
+  size_t horizon_ = 0;
+
+  // the variables are the states x(1) .. x(horizon) then the controls
+  // u(0) .. u(horizon - 1), the constraints the dynamics then the bounds of
+  // the controls. Both matrices are in csc format, P upper triangular.
+  std::vector<c_float> P_data_;
+  std::vector<c_int> P_indices_;
+  std::vector<c_int> P_indptr_;
+  std::vector<c_float> A_data_;
+  std::vector<c_int> A_indices_;
+  std::vector<c_int> A_indptr_;
+  std::vector<c_float> q_;
+  std::vector<c_float> lower_bounds_;
+  std::vector<c_float> upper_bounds_;
+
+  std::vector<c_float> new_P_data_;
+  std::vector<c_float> new_A_data_;
+  std::vector<c_float> warm_start_;
+
+  size_t num_setups_ = 0;
+};
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
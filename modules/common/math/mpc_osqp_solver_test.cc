@@ -0,0 +1,119 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/common/math/mpc_osqp_solver.h"
+
+#include "gtest/gtest.h"
+
+#include "modules/common/math/mpc_solver.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+class MpcOsqpSolverTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    matrix_a_ = Eigen::MatrixXd(kStates, kStates);
+    matrix_a_ << 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1;
+    matrix_b_ = Eigen::MatrixXd(kStates, kControls);
+    matrix_b_ << 0, 1, 0, 0, 1, 0, 0, 1;
+    matrix_c_ = Eigen::MatrixXd(kStates, 1);
+    matrix_c_ << 0, 0, 0, 0.1;
+    matrix_q_ = Eigen::MatrixXd::Zero(kStates, kStates);
+    matrix_q_(0, 0) = 1.0;
+    matrix_q_(1, 1) = 1.0;
+    matrix_r_ = Eigen::MatrixXd::Identity(kControls, kControls);
+    initial_state_ = Eigen::MatrixXd::Zero(kStates, 1);
+  }
+
+ protected:
+  static constexpr int kStates = 4;
+  static constexpr int kControls = 2;
+  static constexpr int kHorizon = 10;
+  static constexpr double kEps = 1e-5;
+  static constexpr int kMaxIter = 4000;
+
+  Eigen::MatrixXd matrix_a_;
+  Eigen::MatrixXd matrix_b_;
+  Eigen::MatrixXd matrix_c_;
+  Eigen::MatrixXd matrix_q_;
+  Eigen::MatrixXd matrix_r_;
+  Eigen::MatrixXd initial_state_;
+};
+
+TEST_F(MpcOsqpSolverTest, SaturatedControl) {
+  Eigen::MatrixXd lower_bound(kControls, 1);
+  lower_bound << -10, -10;
+  Eigen::MatrixXd upper_bound(kControls, 1);
+  upper_bound << 10, 10;
+  Eigen::MatrixXd reference_state(kStates, 1);
+  reference_state << 200, 200, 0, 0;
+  const std::vector<Eigen::MatrixXd> reference(kHorizon, reference_state);
+
+  MpcOsqpSolver solver;
+  std::vector<Eigen::MatrixXd> control(kHorizon,
+                                       Eigen::MatrixXd::Zero(kControls, 1));
+  for (int i = 0; i < kHorizon; ++i) {
+    EXPECT_TRUE(solver.Solve(matrix_a_, matrix_b_, matrix_c_, matrix_q_,
+                             matrix_r_, lower_bound, upper_bound,
+                             initial_state_, reference, kEps, kMaxIter,
+                             &control));
+    EXPECT_NEAR(upper_bound(0), control[0](0), 1e-3);
+  }
+  // the workspace is set up once and then only updated
+  EXPECT_EQ(1, solver.num_setups());
+}
+
+TEST_F(MpcOsqpSolverTest, SameAsDenseSolver) {
+  Eigen::MatrixXd lower_bound(kControls, 1);
+  lower_bound << -1000, -1000;
+  Eigen::MatrixXd upper_bound(kControls, 1);
+  upper_bound << 1000, 1000;
+  Eigen::MatrixXd reference_state(kStates, 1);
+  reference_state << 2, -1, 0, 0;
+  const std::vector<Eigen::MatrixXd> reference(kHorizon, reference_state);
+
+  MpcOsqpSolver solver;
+  for (const double weight : {1.0, 5.0}) {
+    // a changed cost and state are updated in the same workspace
+    matrix_q_(0, 0) = weight;
+    initial_state_(2, 0) = weight;
+    std::vector<Eigen::MatrixXd> dense_control(
+        kHorizon, Eigen::MatrixXd::Zero(kControls, 1));
+    ASSERT_TRUE(SolveLinearMPC(matrix_a_, matrix_b_, matrix_c_, matrix_q_,
+                               matrix_r_, lower_bound, upper_bound,
+                               initial_state_, reference, kEps, kMaxIter,
+                               &dense_control));
+    std::vector<Eigen::MatrixXd> control(kHorizon,
+                                         Eigen::MatrixXd::Zero(kControls, 1));
+    ASSERT_TRUE(solver.Solve(matrix_a_, matrix_b_, matrix_c_, matrix_q_,
+                             matrix_r_, lower_bound, upper_bound,
+                             initial_state_, reference, kEps, kMaxIter,
+                             &control));
+    for (int i = 0; i < kHorizon; ++i) {
+      for (int j = 0; j < kControls; ++j) {
+        EXPECT_NEAR(dense_control[i](j, 0), control[i](j, 0), 1e-3);
+      }
+    }
+  }
+  EXPECT_EQ(1, solver.num_setups());
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
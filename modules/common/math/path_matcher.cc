@@ -31,28 +31,85 @@ namespace apollo {
 namespace common {
 namespace math {
 
+namespace {
+
+double DistanceSquare(const PathPoint& point, const double x, const double y) {
+  const double dx = point.x() - x;
+  const double dy = point.y() - y;
+  return dx * dx + dy * dy;
+}
+
+bool SLess(const PathPoint& point, const double s) { return point.s() < s; }
+
+}  // namespace
+
 PathPoint PathMatcher::MatchToPath(const std::vector<PathPoint>& reference_line,
                                    const double x, const double y) {
   CHECK_GT(reference_line.size(), 0);
+  return ProjectAround(reference_line,
+                       FindNearestIndex(reference_line, x, y), x, y);
+}
 
-  auto func_distance_square = [](const PathPoint& point, const double x,
-                                 const double y) {
-    double dx = point.x() - x;
-    double dy = point.y() - y;
-    return dx * dx + dy * dy;
-  };
-
-  double distance_min = func_distance_square(reference_line.front(), x, y);
+std::size_t PathMatcher::FindNearestIndex(
+    const std::vector<PathPoint>& reference_line, const double x,
+    const double y) {
+  double distance_min = DistanceSquare(reference_line.front(), x, y);
   std::size_t index_min = 0;
 
   for (std::size_t i = 1; i < reference_line.size(); ++i) {
-    double distance_temp = func_distance_square(reference_line[i], x, y);
+    double distance_temp = DistanceSquare(reference_line[i], x, y);
     if (distance_temp < distance_min) {
       distance_min = distance_temp;
       index_min = i;
     }
   }
+  return index_min;
+}
 
+std::vector<PathPoint> PathMatcher::MatchToPath(
+    const std::vector<PathPoint>& reference_line,
+    const std::vector<Vec2d>& points) {
+  std::vector<PathPoint> matched_points;
+  if (points.empty()) {
+    return matched_points;
+  }
+  CHECK_GT(reference_line.size(), 0);
+  matched_points.reserve(points.size());
+  std::size_t index_min =
+      FindNearestIndex(reference_line, points[0].x(), points[0].y());
+  matched_points.push_back(
+      ProjectAround(reference_line, index_min, points[0].x(), points[0].y()));
+
+  for (std::size_t k = 1; k < points.size(); ++k) {
+    const double x = points[k].x();
+    const double y = points[k].y();
+    double distance_min = DistanceSquare(reference_line[index_min], x, y);
+    while (index_min + 1 < reference_line.size()) {
+      const double distance =
+          DistanceSquare(reference_line[index_min + 1], x, y);
+      if (distance >= distance_min) {
+        break;
+      }
+      distance_min = distance;
+      ++index_min;
+    }
+    while (index_min > 0) {
+      const double distance =
+          DistanceSquare(reference_line[index_min - 1], x, y);
+      if (distance > distance_min) {
+        break;
+      }
+      distance_min = distance;
+      --index_min;
+    }
+    matched_points.push_back(ProjectAround(reference_line, index_min, x, y));
+  }
+  return matched_points;
+}
+
+PathPoint PathMatcher::ProjectAround(
+    const std::vector<PathPoint>& reference_line, const std::size_t index_min,
+    const double x, const double y) {
   std::size_t index_start = (index_min == 0) ? index_min : index_min - 1;
   std::size_t index_end =
       (index_min + 1 == reference_line.size()) ? index_min : index_min + 1;
@@ -84,12 +141,35 @@ std::pair<double, double> PathMatcher::GetPathFrenetCoordinate(
 
 PathPoint PathMatcher::MatchToPath(const std::vector<PathPoint>& reference_line,
                                    const double s) {
-  auto comp = [](const PathPoint& point, const double s) {
-    return point.s() < s;
-  };
-
   auto it_lower =
-      std::lower_bound(reference_line.begin(), reference_line.end(), s, comp);
+      std::lower_bound(reference_line.begin(), reference_line.end(), s, SLess);
+  return InterpolateBefore(reference_line, it_lower, s);
+}
+
+std::vector<PathPoint> PathMatcher::MatchToPath(
+    const std::vector<PathPoint>& reference_line,
+    const std::vector<double>& s) {
+  std::vector<PathPoint> matched_points;
+  matched_points.reserve(s.size());
+  auto it_lower = reference_line.begin();
+  for (const double point_s : s) {
+    if (it_lower != reference_line.begin() && (it_lower - 1)->s() >= point_s) {
+      // not sorted, search again
+      it_lower = std::lower_bound(reference_line.begin(), reference_line.end(),
+                                  point_s, SLess);
+    }
+    while (it_lower != reference_line.end() && it_lower->s() < point_s) {
+      ++it_lower;
+    }
+    matched_points.push_back(InterpolateBefore(reference_line, it_lower,
+                                               point_s));
+  }
+  return matched_points;
+}
+
+PathPoint PathMatcher::InterpolateBefore(
+    const std::vector<PathPoint>& reference_line,
+    std::vector<PathPoint>::const_iterator it_lower, const double s) {
   if (it_lower == reference_line.begin()) {
     return reference_line.front();
   } else if (it_lower == reference_line.end()) {
@@ -23,6 +23,7 @@
 #include <utility>
 #include <vector>
 
+#include "modules/common/math/vec2d.h"
 #include "modules/common/proto/pnc_point.pb.h"
 
 namespace apollo {
@@ -43,7 +44,39 @@ class PathMatcher {
   static PathPoint MatchToPath(const std::vector<PathPoint>& reference_line,
                                const double s);
 
+  /**
+   * @brief Matches points that follow the reference line, e.g. the points
+   *        of a trajectory. Only the first point scans the whole line, the
+   *        search of every other one starts at the match of the previous
+   *        point and goes down to the nearest point of the line from there.
+   *        So the line must not come back close to itself between two
+   *        consecutive points.
+   */
+  static std::vector<PathPoint> MatchToPath(
+      const std::vector<PathPoint>& reference_line,
+      const std::vector<Vec2d>& points);
+
+  /**
+   * @brief Matches several s, in one pass over the reference line if they
+   *        are sorted.
+   */
+  static std::vector<PathPoint> MatchToPath(
+      const std::vector<PathPoint>& reference_line,
+      const std::vector<double>& s);
+
  private:
+  static std::size_t FindNearestIndex(
+      const std::vector<PathPoint>& reference_line, const double x,
+      const double y);
+
+  static PathPoint ProjectAround(const std::vector<PathPoint>& reference_line,
+                                 const std::size_t index_min, const double x,
+                                 const double y);
+
+  static PathPoint InterpolateBefore(
+      const std::vector<PathPoint>& reference_line,
+      std::vector<PathPoint>::const_iterator it_lower, const double s);
+
   static PathPoint FindProjectionPoint(const PathPoint& p0, const PathPoint& p1,
                                        const double x, const double y);
 };
@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/common/math/path_matcher.h"
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+namespace {
+
+// a quarter of a circle of radius 50 m, one point every meter
+std::vector<PathPoint> MakeReferenceLine() {
+  const double radius = 50.0;
+  std::vector<PathPoint> reference_line;
+  for (int i = 0; i <= 78; ++i) {
+    const double s = static_cast<double>(i);
+    const double angle = s / radius;
+    PathPoint point;
+    point.set_x(radius * std::sin(angle));
+    point.set_y(radius - radius * std::cos(angle));
+    point.set_theta(angle);
+    point.set_kappa(1.0 / radius);
+    point.set_s(s);
+    reference_line.push_back(point);
+  }
+  return reference_line;
+}
+
+void ExpectSamePoint(const PathPoint& expected, const PathPoint& actual) {
+  EXPECT_NEAR(expected.x(), actual.x(), 1e-9);
+  EXPECT_NEAR(expected.y(), actual.y(), 1e-9);
+  EXPECT_NEAR(expected.theta(), actual.theta(), 1e-9);
+  EXPECT_NEAR(expected.s(), actual.s(), 1e-9);
+}
+
+}  // namespace
+
+TEST(PathMatcherTest, MatchPointsSameAsOneByOne) {
+  const auto reference_line = MakeReferenceLine();
+  // a trajectory drifting from the left to the right of the line, and
+  // points before its start and after its end
+  std::vector<Vec2d> points;
+  for (int i = -5; i < 85; ++i) {
+    const double angle = i * 0.9 / 50.0;
+    const double radius = 50.0 - 3.0 + 0.07 * i;
+    points.emplace_back(radius * std::sin(angle),
+                        50.0 - radius * std::cos(angle));
+  }
+  const auto matched_points = PathMatcher::MatchToPath(reference_line, points);
+  ASSERT_EQ(points.size(), matched_points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    ExpectSamePoint(
+        PathMatcher::MatchToPath(reference_line, points[i].x(), points[i].y()),
+        matched_points[i]);
+  }
+  EXPECT_TRUE(
+      PathMatcher::MatchToPath(reference_line, std::vector<Vec2d>()).empty());
+}
+
+TEST(PathMatcherTest, MatchSSameAsOneByOne) {
+  const auto reference_line = MakeReferenceLine();
+  std::vector<double> s = {-1.0, 0.0, 0.5, 3.25, 3.25, 40.1, 77.9, 90.0};
+  // and unsorted ones
+  s.insert(s.end(), {10.3, 2.0, 60.7, 0.2});
+  const auto matched_points = PathMatcher::MatchToPath(reference_line, s);
+  ASSERT_EQ(s.size(), matched_points.size());
+  for (size_t i = 0; i < s.size(); ++i) {
+    ExpectSamePoint(PathMatcher::MatchToPath(reference_line, s[i]),
+                    matched_points[i]);
+  }
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
@@ -148,11 +148,14 @@ class Clock {
                 "microsecond.");
 
   // The clock mode can either be a system clock time, a user mocked time (for
-  // test only) or read from ROS.
+  // test only), read from ROS, or a replayed time which is set like the mock
+  // time but keeps running at the rate of the system clock, so that elapsed
+  // times are still measured while replaying old messages.
   enum ClockMode {
     SYSTEM = 0,
     MOCK = 1,
     CYBER = 2,
+    REPLAY = 3,
   };
 
   /**
@@ -167,6 +170,8 @@ class Clock {
         return Instance()->mock_now_;
       case ClockMode::CYBER:
         return From(cyber::Time::Now().ToSecond());
+      case ClockMode::REPLAY:
+        return SystemNow() + Instance()->replay_offset_;
       default:
         AFATAL << "Unsupported clock mode: " << mode();
     }
@@ -204,17 +209,23 @@ class Clock {
   }
 
   /**
-   * @brief This is for mock clock mode only. It will set the timestamp
-   * for the mock clock with UNIX timestamp in seconds.
+   * @brief This is for mock and replay clock modes only. It will set the
+   * timestamp for the mock clock, or the timestamp the replay clock runs
+   * from, with UNIX timestamp in seconds.
    */
   static void SetNowInSeconds(double seconds) {
     auto clock = Instance();
+    std::chrono::duration<double> duration_sec(seconds);
+    const Timestamp now =
+        Timestamp(std::chrono::duration_cast<Duration>(duration_sec));
+    if (clock->mode_ == ClockMode::REPLAY) {
+      clock->replay_offset_ = now - SystemNow();
+      return;
+    }
     if (clock->mode_ != ClockMode::MOCK) {
       AFATAL << "Cannot set now when clock mode is not MOCK!";
     }
-    std::chrono::duration<double> duration_sec(seconds);
-    clock->mock_now_ =
-        Timestamp(std::chrono::duration_cast<Duration>(duration_sec));
+    clock->mock_now_ = now;
   }
 
  private:
@@ -222,7 +233,8 @@ class Clock {
    * @brief constructs the \class Clock instance
    * @param mode the desired clock mode
    */
-  explicit Clock(ClockMode mode) : mode_(mode), mock_now_(Timestamp()) {}
+  explicit Clock(ClockMode mode)
+      : mode_(mode), mock_now_(Timestamp()), replay_offset_(Duration::zero()) {}
 
   /**
    * @brief Returns the current timestamp based on the system clock.
@@ -245,6 +257,9 @@ class Clock {
   /// queries.
   Timestamp mock_now_;
 
+  /// The offset from the system clock of the replay clock.
+  Duration replay_offset_;
+
   /// Explicitly disable default and move/copy constructors.
   DECLARE_SINGLETON(Clock)
 };
@@ -16,6 +16,9 @@
 
 #include "modules/common/time/time.h"
 
+#include <chrono>
+#include <thread>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -67,6 +70,18 @@ TEST(TimeTest, MockTime) {
   EXPECT_EQ(123.456, Clock::NowInSeconds());
 }
 
+TEST(TimeTest, ReplayTime) {
+  Clock::SetMode(Clock::REPLAY);
+  EXPECT_EQ(Clock::REPLAY, Clock::mode());
+
+  Clock::SetNowInSeconds(123.456);
+  const double start = Clock::NowInSeconds();
+  EXPECT_NEAR(123.456, start, 0.1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_GT(Clock::NowInSeconds(), start);
+  Clock::SetMode(Clock::SYSTEM);
+}
+
 }  // namespace time
 }  // namespace common
 }  // namespace apollo
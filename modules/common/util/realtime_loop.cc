@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/common/util/realtime_loop.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace common {
+namespace util {
+
+namespace {
+
+constexpr int64_t kNanosPerSecond = 1000000000;
+
+void AddNanos(const int64_t nanos, timespec* time) {
+  const int64_t total = time->tv_nsec + nanos;
+  time->tv_sec += total / kNanosPerSecond;
+  time->tv_nsec = total % kNanosPerSecond;
+}
+
+bool Before(const timespec& lhs, const timespec& rhs) {
+  return lhs.tv_sec < rhs.tv_sec ||
+         (lhs.tv_sec == rhs.tv_sec && lhs.tv_nsec < rhs.tv_nsec);
+}
+
+}  // namespace
+
+void RealtimeLoop::Start() {
+  if (running_.exchange(true)) {
+    return;
+  }
+  thread_ = std::thread(&RealtimeLoop::Run, this);
+}
+
+void RealtimeLoop::Stop() {
+  if (!running_.exchange(false)) {
+    return;
+  }
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void RealtimeLoop::SetupThread() const {
+  if (conf_.cpu() >= 0) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(conf_.cpu(), &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+      AWARN << "Failed to pin the realtime thread to cpu " << conf_.cpu();
+    }
+  }
+  if (conf_.priority() > 0) {
+    sched_param param;
+    param.sched_priority = conf_.priority();
+    if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) != 0) {
+      AWARN << "Failed to set SCHED_FIFO priority " << conf_.priority()
+            << " of the realtime thread, is CAP_SYS_NICE missing?";
+    }
+  }
+}
+
+void RealtimeLoop::Run() {
+  SetupThread();
+  const int64_t period = static_cast<int64_t>(conf_.period_us()) * 1000;
+  timespec next;
+  clock_gettime(CLOCK_MONOTONIC, &next);
+  while (running_.load()) {
+    func_();
+    AddNanos(period, &next);
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (Before(next, now)) {
+      // skip the periods already missed rather than catching up on them
+      overruns_.fetch_add(1);
+      next = now;
+      continue;
+    }
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, nullptr);
+  }
+}
+
+}  // namespace util
+}  // namespace common
+}  // namespace apollo
@@ -0,0 +1,64 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <utility>
+
+#include "modules/common/proto/realtime_thread_conf.pb.h"
+
+namespace apollo {
+namespace common {
+namespace util {
+
+/*
+ * Calls a function once every period on a SCHED_FIFO thread pinned to a
+ * reserved core. The periods are kept on the monotonic clock, so a late
+ * call does not delay the following ones.
+ */
+class RealtimeLoop {
+ public:
+  RealtimeLoop(const RealtimeThreadConf& conf, std::function<void()> func)
+      : conf_(conf), func_(std::move(func)) {}
+  ~RealtimeLoop() { Stop(); }
+
+  void Start();
+  void Stop();
+
+  /*
+   * the number of periods func overran
+   */
+  uint64_t overruns() const { return overruns_.load(); }
+
+ private:
+  void Run();
+  void SetupThread() const;
+
+  const RealtimeThreadConf conf_;
+  const std::function<void()> func_;
+  std::atomic<bool> running_ = {false};
+  std::atomic<uint64_t> overruns_ = {0};
+  std::thread thread_;
+};
+
+}  // namespace util
+}  // namespace common
+}  // namespace apollo
@@ -0,0 +1,59 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/common/util/realtime_loop.h"
+
+#include <chrono>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace common {
+namespace util {
+
+TEST(RealtimeLoopTest, Periods) {
+  RealtimeThreadConf conf;
+  conf.set_cpu(0);
+  conf.set_period_us(1000);
+  std::atomic<int> calls = {0};
+  RealtimeLoop loop(conf, [&calls]() { ++calls; });
+  loop.Start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  loop.Stop();
+  const int stopped_calls = calls.load();
+  EXPECT_GT(stopped_calls, 50);
+  EXPECT_LT(stopped_calls, 150);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(stopped_calls, calls.load());
+}
+
+TEST(RealtimeLoopTest, Overruns) {
+  RealtimeThreadConf conf;
+  conf.set_period_us(1000);
+  RealtimeLoop loop(conf, []() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  });
+  loop.Start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  loop.Stop();
+  EXPECT_GT(loop.overruns(), 0);
+}
+
+}  // namespace util
+}  // namespace common
+}  // namespace apollo
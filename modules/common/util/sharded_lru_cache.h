@@ -0,0 +1,109 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "modules/common/util/lru_cache.h"
+
+namespace apollo {
+namespace common {
+namespace util {
+
+/*
+ * Thread safe LRU cache made of independent LRUCache shards, each with its
+ * own mutex, so that concurrent lookups of different keys rarely contend.
+ * The key picks its shard with std::hash<K>.
+ */
+template <class K, class V>
+class ShardedLRUCache {
+ public:
+  ShardedLRUCache(const size_t num_shards, const size_t capacity) {
+    const size_t shards = std::max(num_shards, static_cast<size_t>(1));
+    const size_t shard_capacity =
+        std::max((capacity + shards - 1) / shards, static_cast<size_t>(1));
+    shards_.reserve(shards);
+    for (size_t i = 0; i < shards; ++i) {
+      shards_.emplace_back(new Shard(shard_capacity));
+    }
+  }
+
+  /*
+   * copy the value of a key into val, return false if it is not cached
+   */
+  bool GetCopy(const K& key, V* const val) {
+    Shard* shard = GetShard(key);
+    bool found = false;
+    {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      found = shard->cache.GetCopy(key, val);
+    }
+    (found ? hits_ : misses_).fetch_add(1, std::memory_order_relaxed);
+    return found;
+  }
+
+  /*
+   * for both add & update purposes
+   */
+  template <typename VV>
+  void Put(const K& key, VV&& val) {
+    Shard* shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    shard->cache.Put(key, std::forward<VV>(val));
+  }
+
+  void Clear() {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->cache.Clear();
+    }
+    hits_ = 0;
+    misses_ = 0;
+  }
+
+  size_t num_shards() const { return shards_.size(); }
+
+  uint64_t hits() const { return hits_.load(std::memory_order_relaxed); }
+
+  uint64_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+ private:
+  struct Shard {
+    explicit Shard(const size_t capacity) : cache(capacity) {}
+    std::mutex mutex;
+    LRUCache<K, V> cache;
+  };
+
+  Shard* GetShard(const K& key) {
+    return shards_[std::hash<K>()(key) % shards_.size()].get();
+  }
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+};
+
+}  // namespace util
+}  // namespace common
+}  // namespace apollo
@@ -0,0 +1,81 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/util/sharded_lru_cache.h"
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace common {
+namespace util {
+
+TEST(ShardedLRUCache, General) {
+  ShardedLRUCache<int, int> cache(1, 2);
+  EXPECT_EQ(1, cache.num_shards());
+  int val = 0;
+  EXPECT_FALSE(cache.GetCopy(1, &val));
+  cache.Put(1, 10);
+  cache.Put(2, 20);
+  EXPECT_TRUE(cache.GetCopy(1, &val));
+  EXPECT_EQ(10, val);
+  // 2 is the least recently used key
+  cache.Put(3, 30);
+  EXPECT_FALSE(cache.GetCopy(2, &val));
+  EXPECT_TRUE(cache.GetCopy(3, &val));
+  EXPECT_EQ(30, val);
+  EXPECT_EQ(2, cache.hits());
+  EXPECT_EQ(2, cache.misses());
+
+  cache.Clear();
+  EXPECT_FALSE(cache.GetCopy(1, &val));
+  EXPECT_EQ(0, cache.hits());
+  EXPECT_EQ(1, cache.misses());
+}
+
+TEST(ShardedLRUCache, MultiThread) {
+  const int kNumThreads = 4;
+  const int kNumKeys = 100;
+  ShardedLRUCache<int, int> cache(8, 8 * kNumKeys);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&cache, kNumKeys]() {
+      for (int i = 0; i < kNumKeys; ++i) {
+        int val = 0;
+        if (!cache.GetCopy(i, &val)) {
+          cache.Put(i, 2 * i);
+        } else {
+          EXPECT_EQ(2 * i, val);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(kNumThreads * kNumKeys, cache.hits() + cache.misses());
+  for (int i = 0; i < kNumKeys; ++i) {
+    int val = 0;
+    EXPECT_TRUE(cache.GetCopy(i, &val));
+    EXPECT_EQ(2 * i, val);
+  }
+}
+
+}  // namespace util
+}  // namespace common
+}  // namespace apollo
@@ -0,0 +1,393 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Voxel grid downsampling on a flat hash table of voxel keys.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "cyber/common/log.h"
+#include "cyber/task/task.h"
+
+/**
+ * @namespace apollo::common::util
+ * @brief apollo::common::util
+ */
+namespace apollo {
+namespace common {
+namespace util {
+
+/**
+ * @class VoxelHashTable
+ * @brief Open addressing hash table mapping 64 bit voxel keys to dense
+ * indices. Clearing keeps the memory, so one table can be reused for every
+ * frame without allocations.
+ */
+class VoxelHashTable {
+ public:
+  static constexpr uint64_t kEmptyKey = std::numeric_limits<uint64_t>::max();
+
+  /**
+   * @brief Remove all keys and make room for num_keys keys.
+   */
+  void Clear(size_t num_keys = 0) {
+    size_t capacity = 16;
+    while (capacity < 2 * num_keys) {
+      capacity <<= 1;
+    }
+    if (capacity > keys_.size()) {
+      keys_.resize(capacity);
+      values_.resize(capacity);
+    }
+    std::fill(keys_.begin(), keys_.end(), kEmptyKey);
+    size_ = 0;
+  }
+
+  /**
+   * @brief Find the value of key, insert value for it if it is not present.
+   * @param key The voxel key, must not be kEmptyKey.
+   * @param value The value stored if the key is new.
+   * @param inserted Set to whether the key was new.
+   * @return The value stored for key.
+   */
+  int Insert(uint64_t key, int value, bool *inserted) {
+    if (2 * (size_ + 1) > keys_.size()) {
+      Rehash(keys_.empty() ? 16 : 2 * keys_.size());
+    }
+    const size_t mask = keys_.size() - 1;
+    size_t slot = Hash(key) & mask;
+    while (keys_[slot] != kEmptyKey) {
+      if (keys_[slot] == key) {
+        *inserted = false;
+        return values_[slot];
+      }
+      slot = (slot + 1) & mask;
+    }
+    keys_[slot] = key;
+    values_[slot] = value;
+    ++size_;
+    *inserted = true;
+    return value;
+  }
+
+  /**
+   * @brief Find the value of key.
+   * @return The value, or -1 if key is not present.
+   */
+  int Find(uint64_t key) const {
+    if (keys_.empty()) {
+      return -1;
+    }
+    const size_t mask = keys_.size() - 1;
+    size_t slot = Hash(key) & mask;
+    while (keys_[slot] != kEmptyKey) {
+      if (keys_[slot] == key) {
+        return values_[slot];
+      }
+      slot = (slot + 1) & mask;
+    }
+    return -1;
+  }
+
+  size_t size() const { return size_; }
+
+  static uint64_t Hash(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return key;
+  }
+
+ private:
+  void Rehash(size_t capacity) {
+    std::vector<uint64_t> keys(capacity, kEmptyKey);
+    std::vector<int> values(capacity);
+    const size_t mask = capacity - 1;
+    for (size_t i = 0; i < keys_.size(); ++i) {
+      if (keys_[i] == kEmptyKey) {
+        continue;
+      }
+      size_t slot = Hash(keys_[i]) & mask;
+      while (keys[slot] != kEmptyKey) {
+        slot = (slot + 1) & mask;
+      }
+      keys[slot] = keys_[i];
+      values[slot] = values_[i];
+    }
+    keys_.swap(keys);
+    values_.swap(values);
+  }
+
+  std::vector<uint64_t> keys_;
+  std::vector<int> values_;
+  size_t size_ = 0;
+};
+
+/**
+ * @class VoxelGridDownsampler
+ * @brief Replace the points of every occupied voxel by their centroid.
+ *
+ * The voxels are numbered in the order of their first point, so the result
+ * does not depend on the number of threads. Points with a non finite
+ * coordinate are skipped. Voxel indices are kept in 21 bits per axis, so
+ * the cloud has to span less than 2^20 voxels around the origin.
+ */
+class VoxelGridDownsampler {
+ public:
+  static constexpr uint64_t kInvalidKey = VoxelHashTable::kEmptyKey;
+
+  /**
+   * @brief Set the voxel size along each axis.
+   */
+  void SetLeafSize(float lx, float ly, float lz) {
+    CHECK(lx > 0.0f && ly > 0.0f && lz > 0.0f) << "Leaf size must be > 0.";
+    inverse_leaf_size_[0] = 1.0f / lx;
+    inverse_leaf_size_[1] = 1.0f / ly;
+    inverse_leaf_size_[2] = 1.0f / lz;
+  }
+
+  /**
+   * @brief Set the number of threads used by Compute, 1 runs serially.
+   */
+  void SetNumThreads(int num_threads) {
+    num_threads_ = std::max(num_threads, 1);
+  }
+
+  /**
+   * @brief Assign the points to voxels and compute the voxel centroids.
+   * @param points The points, any type with x, y and z members.
+   * @param num_points The number of points.
+   * @return The number of occupied voxels.
+   */
+  template <typename PointT>
+  size_t Compute(const PointT *points, size_t num_points);
+
+  size_t NumVoxels() const { return counts_.size(); }
+
+  /**
+   * @brief Number of points of each voxel.
+   */
+  const std::vector<int> &VoxelCounts() const { return counts_; }
+
+  /**
+   * @brief Index of the first point of each voxel.
+   */
+  const std::vector<int> &VoxelFirstPoints() const { return first_points_; }
+
+  /**
+   * @brief Voxel of each point, -1 for skipped points.
+   */
+  const std::vector<int> &PointVoxels() const { return point_voxels_; }
+
+  /**
+   * @brief Write the centroids to x, y and z of the points of out.
+   * @param out Any container with resize and operator[], e.g. a std::vector
+   * of points.
+   */
+  template <typename Container>
+  void GetCentroids(Container *out) const {
+    out->resize(NumVoxels());
+    for (size_t i = 0; i < NumVoxels(); ++i) {
+      const double scale = 1.0 / counts_[i];
+      (*out)[i].x = static_cast<float>(sums_[3 * i] * scale);
+      (*out)[i].y = static_cast<float>(sums_[3 * i + 1] * scale);
+      (*out)[i].z = static_cast<float>(sums_[3 * i + 2] * scale);
+    }
+  }
+
+  /**
+   * @brief Key of the voxel with integer coordinates (ix, iy, iz).
+   */
+  static uint64_t VoxelKey(int64_t ix, int64_t iy, int64_t iz) {
+    const uint64_t mask = (1ULL << 21) - 1;
+    const int64_t offset = 1LL << 20;
+    return (static_cast<uint64_t>(ix + offset) & mask) |
+           ((static_cast<uint64_t>(iy + offset) & mask) << 21) |
+           ((static_cast<uint64_t>(iz + offset) & mask) << 42);
+  }
+
+ private:
+  struct Shard {
+    VoxelHashTable table;
+    std::vector<int> first_points;
+    std::vector<int> counts;
+    std::vector<double> sums;
+  };
+
+  template <typename PointT>
+  void ComputeKeys(const PointT *points, size_t begin, size_t end);
+  template <typename PointT>
+  void Accumulate(const PointT *points, size_t num_points, int shard_id,
+                  Shard *shard);
+  void Merge(size_t num_points);
+  int ShardOf(uint64_t key) const {
+    return static_cast<int>((VoxelHashTable::Hash(key) >> 32) %
+                            static_cast<uint64_t>(num_threads_));
+  }
+
+  float inverse_leaf_size_[3] = {1.0f, 1.0f, 1.0f};
+  int num_threads_ = 1;
+  std::vector<uint64_t> keys_;
+  std::vector<Shard> shards_;
+  std::vector<int> point_voxels_;
+  std::vector<int> first_points_;
+  std::vector<int> counts_;
+  std::vector<double> sums_;
+  // voxels of all shards, sorted by their first point
+  std::vector<std::pair<int, int>> merge_order_;
+  std::vector<std::vector<int>> shard_to_voxel_;
+};
+
+template <typename PointT>
+void VoxelGridDownsampler::ComputeKeys(const PointT *points, size_t begin,
+                                       size_t end) {
+  // one pass without data dependent branches, so that it can be vectorized
+  const float ix = inverse_leaf_size_[0];
+  const float iy = inverse_leaf_size_[1];
+  const float iz = inverse_leaf_size_[2];
+  uint64_t *keys = keys_.data();
+  for (size_t i = begin; i < end; ++i) {
+    const PointT &p = points[i];
+    const bool valid = std::isfinite(p.x + p.y + p.z);
+    const uint64_t key =
+        VoxelKey(static_cast<int64_t>(std::floor(p.x * ix)),
+                 static_cast<int64_t>(std::floor(p.y * iy)),
+                 static_cast<int64_t>(std::floor(p.z * iz)));
+    keys[i] = valid ? key : kInvalidKey;
+  }
+}
+
+template <typename PointT>
+void VoxelGridDownsampler::Accumulate(const PointT *points, size_t num_points,
+                                      int shard_id, Shard *shard) {
+  shard->table.Clear(shard->counts.size());
+  shard->first_points.clear();
+  shard->counts.clear();
+  shard->sums.clear();
+  for (size_t i = 0; i < num_points; ++i) {
+    const uint64_t key = keys_[i];
+    if (key == kInvalidKey || (num_threads_ > 1 && ShardOf(key) != shard_id)) {
+      continue;
+    }
+    bool inserted = false;
+    const int voxel = shard->table.Insert(
+        key, static_cast<int>(shard->counts.size()), &inserted);
+    if (inserted) {
+      shard->first_points.push_back(static_cast<int>(i));
+      shard->counts.push_back(0);
+      shard->sums.resize(shard->sums.size() + 3, 0.0);
+    }
+    ++shard->counts[voxel];
+    shard->sums[3 * voxel] += points[i].x;
+    shard->sums[3 * voxel + 1] += points[i].y;
+    shard->sums[3 * voxel + 2] += points[i].z;
+    point_voxels_[i] = voxel;
+  }
+}
+
+template <typename PointT>
+size_t VoxelGridDownsampler::Compute(const PointT *points, size_t num_points) {
+  keys_.resize(num_points);
+  point_voxels_.assign(num_points, -1);
+  shards_.resize(num_threads_);
+  if (num_threads_ == 1) {
+    ComputeKeys(points, 0, num_points);
+    Shard &shard = shards_[0];
+    Accumulate(points, num_points, 0, &shard);
+    first_points_.swap(shard.first_points);
+    counts_.swap(shard.counts);
+    sums_.swap(shard.sums);
+    return counts_.size();
+  }
+
+  // every thread computes a block of keys, then accumulates the voxels of
+  // its shard of the key space over all points
+  std::vector<std::future<void>> futures;
+  futures.reserve(num_threads_ - 1);
+  const size_t block = (num_points + num_threads_ - 1) / num_threads_;
+  for (int t = 1; t < num_threads_; ++t) {
+    const size_t begin = std::min(num_points, t * block);
+    const size_t end = std::min(num_points, begin + block);
+    futures.push_back(cyber::Async(
+        [this, points, begin, end]() { ComputeKeys(points, begin, end); }));
+  }
+  ComputeKeys(points, 0, std::min(num_points, block));
+  for (auto &future : futures) {
+    future.get();
+  }
+  futures.clear();
+  for (int t = 1; t < num_threads_; ++t) {
+    futures.push_back(cyber::Async([this, points, num_points, t]() {
+      Accumulate(points, num_points, t, &shards_[t]);
+    }));
+  }
+  Accumulate(points, num_points, 0, &shards_[0]);
+  for (auto &future : futures) {
+    future.get();
+  }
+  Merge(num_points);
+  return counts_.size();
+}
+
+inline void VoxelGridDownsampler::Merge(size_t num_points) {
+  merge_order_.clear();
+  shard_to_voxel_.resize(num_threads_);
+  for (int t = 0; t < num_threads_; ++t) {
+    const Shard &shard = shards_[t];
+    for (size_t v = 0; v < shard.first_points.size(); ++v) {
+      merge_order_.emplace_back(shard.first_points[v], t);
+    }
+    shard_to_voxel_[t].resize(shard.first_points.size());
+  }
+  std::sort(merge_order_.begin(), merge_order_.end());
+
+  const size_t num_voxels = merge_order_.size();
+  first_points_.resize(num_voxels);
+  counts_.resize(num_voxels);
+  sums_.resize(3 * num_voxels);
+  std::vector<int> next(num_threads_, 0);
+  for (size_t v = 0; v < num_voxels; ++v) {
+    // voxels of one shard are already ordered by their first point
+    const int t = merge_order_[v].second;
+    const int local = next[t]++;
+    const Shard &shard = shards_[t];
+    shard_to_voxel_[t][local] = static_cast<int>(v);
+    first_points_[v] = shard.first_points[local];
+    counts_[v] = shard.counts[local];
+    sums_[3 * v] = shard.sums[3 * local];
+    sums_[3 * v + 1] = shard.sums[3 * local + 1];
+    sums_[3 * v + 2] = shard.sums[3 * local + 2];
+  }
+  for (size_t i = 0; i < num_points; ++i) {
+    if (point_voxels_[i] >= 0) {
+      point_voxels_[i] = shard_to_voxel_[ShardOf(keys_[i])][point_voxels_[i]];
+    }
+  }
+}
+
+}  // namespace util
+}  // namespace common
+}  // namespace apollo
@@ -0,0 +1,143 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/common/util/voxel_grid_downsampler.h"
+
+#include <map>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace common {
+namespace util {
+
+namespace {
+
+struct TestPoint {
+  float x = 0.0f;
+  float y = 0.0f;
+  float z = 0.0f;
+};
+
+std::vector<TestPoint> RandomPoints(size_t num_points) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> dist(-20.0f, 20.0f);
+  std::vector<TestPoint> points(num_points);
+  for (auto &point : points) {
+    point.x = dist(rng);
+    point.y = dist(rng);
+    point.z = dist(rng) * 0.1f;
+  }
+  return points;
+}
+
+}  // namespace
+
+TEST(VoxelHashTableTest, InsertAndFind) {
+  VoxelHashTable table;
+  table.Clear();
+  bool inserted = false;
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(table.Insert(static_cast<uint64_t>(i) * 7919, i, &inserted), i);
+    EXPECT_TRUE(inserted);
+  }
+  EXPECT_EQ(table.size(), 1000);
+  EXPECT_EQ(table.Insert(7919, 5, &inserted), 1);
+  EXPECT_FALSE(inserted);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(table.Find(static_cast<uint64_t>(i) * 7919), i);
+  }
+  EXPECT_EQ(table.Find(3), -1);
+  table.Clear();
+  EXPECT_EQ(table.size(), 0);
+  EXPECT_EQ(table.Find(7919), -1);
+}
+
+TEST(VoxelGridDownsamplerTest, MatchesOrderedMap) {
+  const std::vector<TestPoint> points = RandomPoints(20000);
+  const float leaf = 0.5f;
+
+  // reference: voxels in a std::map, as the previous implementations did
+  std::map<std::tuple<int, int, int>, std::pair<int, TestPoint>> reference;
+  for (const auto &point : points) {
+    auto &voxel = reference[std::make_tuple(
+        static_cast<int>(std::floor(point.x / leaf)),
+        static_cast<int>(std::floor(point.y / leaf)),
+        static_cast<int>(std::floor(point.z / leaf)))];
+    ++voxel.first;
+    voxel.second.x += point.x;
+    voxel.second.y += point.y;
+    voxel.second.z += point.z;
+  }
+
+  VoxelGridDownsampler downsampler;
+  downsampler.SetLeafSize(leaf, leaf, leaf);
+  EXPECT_EQ(downsampler.Compute(points.data(), points.size()),
+            reference.size());
+  std::vector<TestPoint> centroids;
+  downsampler.GetCentroids(&centroids);
+  for (size_t v = 0; v < centroids.size(); ++v) {
+    const TestPoint &first = points[downsampler.VoxelFirstPoints()[v]];
+    const auto &voxel = reference[std::make_tuple(
+        static_cast<int>(std::floor(first.x / leaf)),
+        static_cast<int>(std::floor(first.y / leaf)),
+        static_cast<int>(std::floor(first.z / leaf)))];
+    EXPECT_EQ(downsampler.VoxelCounts()[v], voxel.first);
+    EXPECT_NEAR(centroids[v].x, voxel.second.x / voxel.first, 1e-4);
+    EXPECT_NEAR(centroids[v].y, voxel.second.y / voxel.first, 1e-4);
+    EXPECT_NEAR(centroids[v].z, voxel.second.z / voxel.first, 1e-4);
+  }
+}
+
+TEST(VoxelGridDownsamplerTest, ThreadsGiveSameResult) {
+  std::vector<TestPoint> points = RandomPoints(10000);
+  points[17].x = std::numeric_limits<float>::quiet_NaN();
+
+  VoxelGridDownsampler serial;
+  serial.SetLeafSize(0.3f, 0.3f, 0.3f);
+  serial.Compute(points.data(), points.size());
+  EXPECT_EQ(serial.PointVoxels()[17], -1);
+  std::vector<TestPoint> serial_centroids;
+  serial.GetCentroids(&serial_centroids);
+
+  for (int num_threads : {2, 3, 8}) {
+    VoxelGridDownsampler parallel;
+    parallel.SetLeafSize(0.3f, 0.3f, 0.3f);
+    parallel.SetNumThreads(num_threads);
+    // run twice to also cover the reuse of the buffers
+    for (int i = 0; i < 2; ++i) {
+      EXPECT_EQ(parallel.Compute(points.data(), points.size()),
+                serial.NumVoxels());
+    }
+    EXPECT_EQ(parallel.PointVoxels(), serial.PointVoxels());
+    EXPECT_EQ(parallel.VoxelCounts(), serial.VoxelCounts());
+    EXPECT_EQ(parallel.VoxelFirstPoints(), serial.VoxelFirstPoints());
+    std::vector<TestPoint> centroids;
+    parallel.GetCentroids(&centroids);
+    for (size_t v = 0; v < centroids.size(); ++v) {
+      EXPECT_EQ(centroids[v].x, serial_centroids[v].x);
+      EXPECT_EQ(centroids[v].y, serial_centroids[v].y);
+      EXPECT_EQ(centroids[v].z, serial_centroids[v].z);
+    }
+  }
+}
+
+}  // namespace util
+}  // namespace common
+}  // namespace apollo
@@ -16,6 +16,7 @@
 
 #include "modules/control/common/interpolation_2d.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "cyber/common/log.h"
@@ -34,32 +35,44 @@ bool Interpolation2D::Init(const DataType &xyz) {
     AERROR << "empty input.";
     return false;
   }
+  std::map<double, std::map<double, double>> xyz_map;
   for (const auto &t : xyz) {
-    xyz_[std::get<0>(t)][std::get<1>(t)] = std::get<2>(t);
+    xyz_map[std::get<0>(t)][std::get<1>(t)] = std::get<2>(t);
   }
+  xs_ = Table();
+  yz_tables_.clear();
+  yz_tables_.reserve(xyz_map.size());
+  for (const auto &x_yz : xyz_map) {
+    xs_.keys.push_back(x_yz.first);
+    yz_tables_.emplace_back();
+    auto &yz_table = yz_tables_.back();
+    for (const auto &y_z : x_yz.second) {
+      yz_table.keys.push_back(y_z.first);
+      yz_table.values.push_back(y_z.second);
+    }
+    yz_table.SetStep();
+  }
+  xs_.SetStep();
   return true;
 }
 
 double Interpolation2D::Interpolate(const KeyType &xy) const {
-  double max_x = xyz_.rbegin()->first;
-  double min_x = xyz_.begin()->first;
+  double max_x = xs_.keys.back();
+  double min_x = xs_.keys.front();
   if (xy.first >= max_x - kDoubleEpsilon) {
-    return InterpolateYz(xyz_.rbegin()->second, xy.second);
+    return InterpolateYz(yz_tables_.back(), xy.second);
   }
   if (xy.first <= min_x + kDoubleEpsilon) {
-    return InterpolateYz(xyz_.begin()->second, xy.second);
+    return InterpolateYz(yz_tables_.front(), xy.second);
   }
 
-  auto itr_after = xyz_.lower_bound(xy.first);
-  auto itr_before = itr_after;
-  if (itr_before != xyz_.begin()) {
-    --itr_before;
-  }
+  const size_t index_after = xs_.LowerBound(xy.first);
+  const size_t index_before = index_after > 0 ? index_after - 1 : 0;
 
-  double x_before = itr_before->first;
-  double z_before = InterpolateYz(itr_before->second, xy.second);
-  double x_after = itr_after->first;
-  double z_after = InterpolateYz(itr_after->second, xy.second);
+  double x_before = xs_.keys[index_before];
+  double z_before = InterpolateYz(yz_tables_[index_before], xy.second);
+  double x_after = xs_.keys[index_after];
+  double z_after = InterpolateYz(yz_tables_[index_after], xy.second);
 
   double x_diff_before = std::fabs(xy.first - x_before);
   double x_diff_after = std::fabs(xy.first - x_after);
@@ -67,32 +80,27 @@ double Interpolation2D::Interpolate(const KeyType &xy) const {
   return InterpolateValue(z_before, x_diff_before, z_after, x_diff_after);
 }
 
-double Interpolation2D::InterpolateYz(const std::map<double, double> &yz_table,
-                                      double y) const {
-  if (yz_table.empty()) {
+double Interpolation2D::InterpolateYz(const Table &yz_table, double y) const {
+  if (yz_table.keys.empty()) {
     AERROR << "Unable to interpolateYz because yz_table is empty.";
     return y;
   }
-  double max_y = yz_table.rbegin()->first;
-  double min_y = yz_table.begin()->first;
+  double max_y = yz_table.keys.back();
+  double min_y = yz_table.keys.front();
   if (y >= max_y - kDoubleEpsilon) {
-    return yz_table.rbegin()->second;
+    return yz_table.values.back();
   }
   if (y <= min_y + kDoubleEpsilon) {
-    return yz_table.begin()->second;
+    return yz_table.values.front();
   }
 
-  auto itr_after = yz_table.lower_bound(y);
-  auto itr_before = itr_after;
-
-  if (itr_before != yz_table.begin()) {
-    --itr_before;
-  }
+  const size_t index_after = yz_table.LowerBound(y);
+  const size_t index_before = index_after > 0 ? index_after - 1 : 0;
 
-  double y_before = itr_before->first;
-  double z_before = itr_before->second;
-  double y_after = itr_after->first;
-  double z_after = itr_after->second;
+  double y_before = yz_table.keys[index_before];
+  double z_before = yz_table.values[index_before];
+  double y_after = yz_table.keys[index_after];
+  double z_after = yz_table.values[index_after];
 
   double y_diff_before = std::fabs(y - y_before);
   double y_diff_after = std::fabs(y - y_after);
@@ -100,6 +108,38 @@ double Interpolation2D::InterpolateYz(const std::map<double, double> &yz_table,
   return InterpolateValue(z_before, y_diff_before, z_after, y_diff_after);
 }
 
+void Interpolation2D::Table::SetStep() {
+  step = 0.0;
+  if (keys.size() < 3) {
+    return;
+  }
+  const double even_step =
+      (keys.back() - keys.front()) / static_cast<double>(keys.size() - 1);
+  for (size_t i = 1; i < keys.size(); ++i) {
+    if (std::fabs(keys[i] - keys[i - 1] - even_step) > kDoubleEpsilon) {
+      return;
+    }
+  }
+  step = even_step;
+}
+
+size_t Interpolation2D::Table::LowerBound(const double key) const {
+  if (step <= 0.0) {
+    return std::lower_bound(keys.begin(), keys.end(), key) - keys.begin();
+  }
+  // the guess is off by at most one key from rounding
+  size_t index = std::min(
+      static_cast<size_t>(std::ceil((key - keys.front()) / step)),
+      keys.size() - 1);
+  while (index > 0 && keys[index - 1] >= key) {
+    --index;
+  }
+  while (index + 1 < keys.size() && keys[index] < key) {
+    ++index;
+  }
+  return index;
+}
+
 double Interpolation2D::InterpolateValue(const double value_before,
                                          const double dist_before,
                                          const double value_after,
@@ -36,6 +36,9 @@ namespace control {
  * @class Interpolation2D
  *
  * @brief linear interpolation from key (double, double) to one double value.
+ * The table is built once in Init; a lookup finds the x neighbors in O(1)
+ * when the x keys are evenly spaced, as the speeds of a calibration table,
+ * and by binary search otherwise.
  */
 class Interpolation2D {
  public:
@@ -59,14 +62,30 @@ class Interpolation2D {
   double Interpolate(const KeyType &xy) const;
 
  private:
-  double InterpolateYz(const std::map<double, double> &yz_table,
-                       double y) const;
+  // sorted keys and their values, flattened from a map so that a lookup
+  // does not walk tree nodes
+  struct Table {
+    std::vector<double> keys;
+    std::vector<double> values;
+    // the spacing of the keys if they are evenly spaced, 0 otherwise
+    double step = 0.0;
+
+    void SetStep();
+
+    // index of the first key not less than key, as std::lower_bound, for a
+    // key within (keys.front(), keys.back()]. O(1) with evenly spaced keys.
+    size_t LowerBound(const double key) const;
+  };
+
+  double InterpolateYz(const Table &yz_table, double y) const;
 
   double InterpolateValue(const double value_before, const double dist_before,
                           const double value_after,
                           const double dist_after) const;
 
-  std::map<double, std::map<double, double>> xyz_;
+  // the x keys without values, the yz table of xs_.keys[i] is yz_tables_[i]
+  Table xs_;
+  std::vector<Table> yz_tables_;
 };
 
 }  // namespace control
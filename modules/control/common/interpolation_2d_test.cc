@@ -70,6 +70,31 @@ TEST_F(Interpolation2DTest, normal) {
   EXPECT_DOUBLE_EQ(30.5, estimator.Interpolate(std::make_pair(40, 40)));
 }
 
+TEST_F(Interpolation2DTest, evenly_spaced) {
+  // evenly spaced x keys and uneven y keys, as a calibration table
+  Interpolation2D::DataType xyz;
+  for (int i = 0; i < 11; ++i) {
+    const double x = 0.2 * i;
+    xyz.push_back(std::make_tuple(x, -1.0, -10.0 * x));
+    xyz.push_back(std::make_tuple(x, 0.1 * i, 0.0));
+    xyz.push_back(std::make_tuple(x, 2.0, 10.0 * x));
+  }
+
+  Interpolation2D estimator;
+  EXPECT_TRUE(estimator.Init(xyz));
+
+  for (const auto &elem : xyz) {
+    EXPECT_DOUBLE_EQ(std::get<2>(elem),
+                     estimator.Interpolate(
+                         std::make_pair(std::get<0>(elem), std::get<1>(elem))));
+  }
+  EXPECT_DOUBLE_EQ(5.0, estimator.Interpolate(std::make_pair(0.5, 2.0)));
+  EXPECT_DOUBLE_EQ(-3.0, estimator.Interpolate(std::make_pair(0.3, -1.0)));
+  EXPECT_NEAR(20.0 / 3.0, estimator.Interpolate(std::make_pair(1.0, 1.5)),
+              1e-9);
+  EXPECT_DOUBLE_EQ(20.0, estimator.Interpolate(std::make_pair(3.0, 2.0)));
+}
+
 TEST_F(Interpolation2DTest, calibration_table) {
   const auto &calibration_table =
       control_conf_.lon_controller_conf().calibration_table();
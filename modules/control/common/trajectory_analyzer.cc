@@ -18,12 +18,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <utility>
 
 #include "cyber/common/log.h"
 #include "modules/common/math/linear_interpolation.h"
 #include "modules/common/math/math_utils.h"
-#include "modules/common/math/search.h"
 
 namespace math = apollo::common::math;
 using apollo::common::PathPoint;
@@ -49,6 +49,28 @@ PathPoint TrajectoryPointToPathPoint(const TrajectoryPoint &point) {
   }
 }
 
+// below this many points a linear search is as fast as the spatial index
+constexpr size_t kMinSpatialIndexSize = 16;
+// the cells are at least this wide, in meters, and span about two points
+constexpr double kMinCellSize = 0.5;
+// rings of cells searched around the query before a linear search
+constexpr int64_t kMaxSearchRings = 4;
+
+size_t LinearNearestIndex(const std::vector<TrajectoryPoint> &points,
+                          const double x, const double y) {
+  double d_min = PointDistanceSquare(points.front(), x, y);
+  size_t index_min = 0;
+
+  for (size_t i = 1; i < points.size(); ++i) {
+    double d_temp = PointDistanceSquare(points[i], x, y);
+    if (d_temp < d_min) {
+      d_min = d_temp;
+      index_min = i;
+    }
+  }
+  return index_min;
+}
+
 }  // namespace
 
 TrajectoryAnalyzer::TrajectoryAnalyzer(
@@ -56,27 +78,198 @@ TrajectoryAnalyzer::TrajectoryAnalyzer(
   header_time_ = planning_published_trajectory->header().timestamp_sec();
   seq_num_ = planning_published_trajectory->header().sequence_num();
 
-  for (int i = 0; i < planning_published_trajectory->trajectory_point_size();
-       ++i) {
-    trajectory_points_.push_back(
-        planning_published_trajectory->trajectory_point(i));
+  trajectory_points_.assign(
+      planning_published_trajectory->trajectory_point().begin(),
+      planning_published_trajectory->trajectory_point().end());
+  BuildTimeIndex();
+  BuildSpatialIndex();
+}
+
+bool TrajectoryAnalyzer::IsBuiltFrom(
+    const planning::ADCTrajectory &planning_published_trajectory) const {
+  return !trajectory_points_.empty() &&
+         seq_num_ == planning_published_trajectory.header().sequence_num() &&
+         header_time_ ==
+             planning_published_trajectory.header().timestamp_sec() &&
+         trajectory_points_.size() ==
+             static_cast<size_t>(
+                 planning_published_trajectory.trajectory_point_size());
+}
+
+void TrajectoryAnalyzer::BuildTimeIndex() {
+  time_index_.clear();
+  const size_t size = trajectory_points_.size();
+  if (size < 2) {
+    return;
+  }
+  const double time_begin = trajectory_points_.front().relative_time();
+  const double time_end = trajectory_points_.back().relative_time();
+  if (!(time_end > time_begin)) {
+    return;
+  }
+  time_index_start_ = time_begin;
+  time_index_scale_ = static_cast<double>(size) / (time_end - time_begin);
+  time_index_.resize(size);
+  size_t index = 0;
+  for (size_t bucket = 0; bucket < size; ++bucket) {
+    const double bucket_start =
+        time_begin + static_cast<double>(bucket) / time_index_scale_;
+    while (index < size &&
+           trajectory_points_[index].relative_time() < bucket_start) {
+      ++index;
+    }
+    time_index_[bucket] = index;
   }
 }
 
-PathPoint TrajectoryAnalyzer::QueryMatchedPathPoint(const double x,
-                                                    const double y) const {
-  CHECK_GT(trajectory_points_.size(), 0);
+void TrajectoryAnalyzer::BuildSpatialIndex() {
+  cells_.clear();
+  cell_points_.clear();
+  const size_t size = trajectory_points_.size();
+  if (size < kMinSpatialIndexSize) {
+    return;
+  }
+  double min_x = std::numeric_limits<double>::infinity();
+  double min_y = std::numeric_limits<double>::infinity();
+  double max_x = -std::numeric_limits<double>::infinity();
+  double max_y = -std::numeric_limits<double>::infinity();
+  double length = 0.0;
+  for (size_t i = 0; i < size; ++i) {
+    const PathPoint &point = trajectory_points_[i].path_point();
+    if (!std::isfinite(point.x()) || !std::isfinite(point.y())) {
+      return;
+    }
+    min_x = std::min(min_x, point.x());
+    min_y = std::min(min_y, point.y());
+    max_x = std::max(max_x, point.x());
+    max_y = std::max(max_y, point.y());
+    if (i > 0) {
+      length += std::sqrt(
+          PointDistanceSquare(trajectory_points_[i - 1], point.x(), point.y()));
+    }
+  }
+  cell_size_ = std::max(kMinCellSize, 2.0 * length / (size - 1));
+  cell_origin_x_ = min_x;
+  cell_origin_y_ = min_y;
+  cell_count_x_ = static_cast<int64_t>((max_x - min_x) / cell_size_) + 1;
+  cell_count_y_ = static_cast<int64_t>((max_y - min_y) / cell_size_) + 1;
+
+  // sort the points by cell, then by index within a cell
+  std::vector<std::pair<int64_t, size_t>> keys(size);
+  for (size_t i = 0; i < size; ++i) {
+    const PathPoint &point = trajectory_points_[i].path_point();
+    keys[i].first =
+        CellKey(static_cast<int64_t>((point.x() - min_x) / cell_size_),
+                static_cast<int64_t>((point.y() - min_y) / cell_size_));
+    keys[i].second = i;
+  }
+  std::sort(keys.begin(), keys.end());
+  cell_points_.resize(size);
+  for (size_t i = 0; i < size; ++i) {
+    cell_points_[i] = keys[i].second;
+    if (i == 0 || keys[i].first != keys[i - 1].first) {
+      cells_[keys[i].first] = std::make_pair(i, i + 1);
+    } else {
+      cells_[keys[i].first].second = i + 1;
+    }
+  }
+}
 
-  double d_min = PointDistanceSquare(trajectory_points_.front(), x, y);
-  size_t index_min = 0;
+size_t TrajectoryAnalyzer::LowerBoundByRelativeTime(const double t) const {
+  if (time_index_.empty()) {
+    auto func_comp = [](const TrajectoryPoint &point,
+                        const double relative_time) {
+      return point.relative_time() < relative_time;
+    };
+    return std::lower_bound(trajectory_points_.begin(),
+                            trajectory_points_.end(), t, func_comp) -
+           trajectory_points_.begin();
+  }
+  if (!(t > time_index_start_)) {
+    return 0;
+  }
+  const size_t bucket = static_cast<size_t>(
+      std::min((t - time_index_start_) * time_index_scale_,
+               static_cast<double>(time_index_.size() - 1)));
+  size_t index = time_index_[bucket];
+  // the bucket start may round either way of t, and the bucket may hold
+  // several points
+  while (index > 0 && trajectory_points_[index - 1].relative_time() >= t) {
+    --index;
+  }
+  while (index < trajectory_points_.size() &&
+         trajectory_points_[index].relative_time() < t) {
+    ++index;
+  }
+  return index;
+}
 
-  for (size_t i = 1; i < trajectory_points_.size(); ++i) {
-    double d_temp = PointDistanceSquare(trajectory_points_[i], x, y);
-    if (d_temp < d_min) {
-      d_min = d_temp;
-      index_min = i;
+size_t TrajectoryAnalyzer::NearestIndexByPosition(const double x,
+                                                  const double y) const {
+  if (cells_.empty()) {
+    return LinearNearestIndex(trajectory_points_, x, y);
+  }
+  const double cell_x = std::floor((x - cell_origin_x_) / cell_size_);
+  const double cell_y = std::floor((y - cell_origin_y_) / cell_size_);
+  // no cell of the grid within the searched rings
+  if (!(cell_x >= -kMaxSearchRings &&
+        cell_x < cell_count_x_ + kMaxSearchRings &&
+        cell_y >= -kMaxSearchRings &&
+        cell_y < cell_count_y_ + kMaxSearchRings)) {
+    return LinearNearestIndex(trajectory_points_, x, y);
+  }
+  const int64_t center_x = static_cast<int64_t>(cell_x);
+  const int64_t center_y = static_cast<int64_t>(cell_y);
+
+  const size_t size = trajectory_points_.size();
+  double d_min = std::numeric_limits<double>::infinity();
+  size_t index_min = size;
+  auto visit_cell = [&](const int64_t cx, const int64_t cy) {
+    if (cx < 0 || cx >= cell_count_x_ || cy < 0 || cy >= cell_count_y_) {
+      return;
+    }
+    const auto it = cells_.find(CellKey(cx, cy));
+    if (it == cells_.end()) {
+      return;
+    }
+    for (size_t k = it->second.first; k < it->second.second; ++k) {
+      const size_t i = cell_points_[k];
+      const double d = PointDistanceSquare(trajectory_points_[i], x, y);
+      // ties go to the first point, as with a linear search
+      if (d < d_min || (d == d_min && i < index_min)) {
+        d_min = d;
+        index_min = i;
+      }
+    }
+  };
+
+  for (int64_t r = 0; r <= kMaxSearchRings; ++r) {
+    if (r == 0) {
+      visit_cell(center_x, center_y);
+    } else {
+      for (int64_t d = -r; d <= r; ++d) {
+        visit_cell(center_x + d, center_y - r);
+        visit_cell(center_x + d, center_y + r);
+      }
+      for (int64_t d = -r + 1; d < r; ++d) {
+        visit_cell(center_x - r, center_y + d);
+        visit_cell(center_x + r, center_y + d);
+      }
+    }
+    // the cells beyond ring r are at least r cells away from the query
+    const double reach = static_cast<double>(r) * cell_size_;
+    if (index_min < size && d_min <= reach * reach) {
+      return index_min;
     }
   }
+  return LinearNearestIndex(trajectory_points_, x, y);
+}
+
+PathPoint TrajectoryAnalyzer::QueryMatchedPathPoint(const double x,
+                                                    const double y) const {
+  CHECK_GT(trajectory_points_.size(), 0);
+
+  const size_t index_min = NearestIndexByPosition(x, y);
 
   size_t index_start = index_min == 0 ? index_min : index_min - 1;
   size_t index_end =
@@ -152,13 +345,7 @@ TrajectoryPoint TrajectoryAnalyzer::QueryNearestPointByAbsoluteTime(
 
 TrajectoryPoint TrajectoryAnalyzer::QueryNearestPointByRelativeTime(
     const double t) const {
-  auto func_comp = [](const TrajectoryPoint &point,
-                      const double relative_time) {
-    return point.relative_time() < relative_time;
-  };
-
-  auto it_low = std::lower_bound(trajectory_points_.begin(),
-                                 trajectory_points_.end(), t, func_comp);
+  auto it_low = trajectory_points_.begin() + LowerBoundByRelativeTime(t);
 
   if (it_low == trajectory_points_.begin()) {
     return trajectory_points_.front();
@@ -178,18 +365,7 @@ TrajectoryPoint TrajectoryAnalyzer::QueryNearestPointByRelativeTime(
 TrajectoryPoint TrajectoryAnalyzer::QueryNearestPointByPosition(
     const double x, const double y) const {
   CHECK_GT(trajectory_points_.size(), 0);
-
-  double d_min = PointDistanceSquare(trajectory_points_.front(), x, y);
-  size_t index_min = 0;
-
-  for (size_t i = 1; i < trajectory_points_.size(); ++i) {
-    double d_temp = PointDistanceSquare(trajectory_points_[i], x, y);
-    if (d_temp < d_min) {
-      d_min = d_temp;
-      index_min = i;
-    }
-  }
-  return trajectory_points_[index_min];
+  return trajectory_points_[NearestIndexByPosition(x, y)];
 }
 
 const std::vector<TrajectoryPoint> &TrajectoryAnalyzer::trajectory_points()
@@ -202,30 +378,30 @@ PathPoint TrajectoryAnalyzer::FindMinDistancePoint(const TrajectoryPoint &p0,
                                                    const double x,
                                                    const double y) const {
   // given the fact that the discretized trajectory is dense enough,
-  // we assume linear trajectory between consecutive trajectory points.
-  auto dist_square = [&p0, &p1, &x, &y](const double s) {
-    double px = math::lerp(p0.path_point().x(), p0.path_point().s(),
-                           p1.path_point().x(), p1.path_point().s(), s);
-    double py = math::lerp(p0.path_point().y(), p0.path_point().s(),
-                           p1.path_point().y(), p1.path_point().s(), s);
-    double dx = px - x;
-    double dy = py - y;
-    return dx * dx + dy * dy;
-  };
+  // we assume linear trajectory between consecutive trajectory points,
+  // so the closest point is the projection on the segment.
+  const PathPoint &p0_point = p0.path_point();
+  const PathPoint &p1_point = p1.path_point();
+  const double dx = p1_point.x() - p0_point.x();
+  const double dy = p1_point.y() - p0_point.y();
+  const double length_square = dx * dx + dy * dy;
+  double ratio = 0.0;
+  if (length_square > 0.0) {
+    ratio = ((x - p0_point.x()) * dx + (y - p0_point.y()) * dy) /
+            length_square;
+    ratio = std::max(0.0, std::min(1.0, ratio));
+  }
 
-  PathPoint p = p0.path_point();
-  double s = math::GoldenSectionSearch(dist_square, p0.path_point().s(),
-                                       p1.path_point().s());
+  PathPoint p = p0_point;
+  const double s = p0_point.s() + ratio * (p1_point.s() - p0_point.s());
   p.set_s(s);
-  p.set_x(math::lerp(p0.path_point().x(), p0.path_point().s(),
-                     p1.path_point().x(), p1.path_point().s(), s));
-  p.set_y(math::lerp(p0.path_point().y(), p0.path_point().s(),
-                     p1.path_point().y(), p1.path_point().s(), s));
-  p.set_theta(math::slerp(p0.path_point().theta(), p0.path_point().s(),
-                          p1.path_point().theta(), p1.path_point().s(), s));
+  p.set_x(p0_point.x() + ratio * dx);
+  p.set_y(p0_point.y() + ratio * dy);
+  p.set_theta(math::slerp(p0_point.theta(), p0_point.s(), p1_point.theta(),
+                          p1_point.s(), s));
   // approximate the curvature at the intermediate point
-  p.set_kappa(math::lerp(p0.path_point().kappa(), p0.path_point().s(),
-                         p1.path_point().kappa(), p1.path_point().s(), s));
+  p.set_kappa(p0_point.kappa() +
+              ratio * (p1_point.kappa() - p0_point.kappa()));
   return p;
 }
 
@@ -21,6 +21,9 @@
 
 #pragma once
 
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "modules/planning/proto/planning.pb.h"
@@ -65,6 +68,16 @@ class TrajectoryAnalyzer {
    */
   unsigned int seq_num() { return seq_num_; }
 
+  /**
+   * @brief whether the analyzer holds the given trajectory, judging by its
+   * header and size, so that it does not need to be built again
+   * @param planning_published_trajectory trajectory data generated by
+   * planning module
+   * @return true if the analyzer was built from the trajectory
+   */
+  bool IsBuiltFrom(
+      const planning::ADCTrajectory &planning_published_trajectory) const;
+
   /**
    * @brief query a point of trajectery that its absolute time is closest
    * to the give time.
@@ -130,8 +143,38 @@ class TrajectoryAnalyzer {
                                          const common::TrajectoryPoint &p1,
                                          const double x, const double y) const;
 
+  void BuildTimeIndex();
+
+  void BuildSpatialIndex();
+
+  // index of the first point whose relative time is not less than t
+  size_t LowerBoundByRelativeTime(const double t) const;
+
+  // index of the first of the points closest to (x, y)
+  size_t NearestIndexByPosition(const double x, const double y) const;
+
+  int64_t CellKey(const int64_t cell_x, const int64_t cell_y) const {
+    return cell_x * cell_count_y_ + cell_y;
+  }
+
   std::vector<common::TrajectoryPoint> trajectory_points_;
 
+  // time index: the relative time span of the points is split in buckets of
+  // equal duration, each with the first point not before its start
+  double time_index_start_ = 0.0;
+  double time_index_scale_ = 0.0;
+  std::vector<size_t> time_index_;
+
+  // spatial index: the points are hashed into the square cells of a grid
+  // over their bounding box, each cell holding a range of cell_points_
+  double cell_size_ = 0.0;
+  double cell_origin_x_ = 0.0;
+  double cell_origin_y_ = 0.0;
+  int64_t cell_count_x_ = 0;
+  int64_t cell_count_y_ = 0;
+  std::unordered_map<int64_t, std::pair<size_t, size_t>> cells_;
+  std::vector<size_t> cell_points_;
+
   double header_time_ = 0.0;
   unsigned int seq_num_ = 0;
 };
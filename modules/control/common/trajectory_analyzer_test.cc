@@ -16,6 +16,10 @@
 
 #include "modules/control/common/trajectory_analyzer.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "gtest/gtest.h"
 #include "cyber/common/log.h"
 #include "modules/common/time/time.h"
@@ -168,5 +172,59 @@ TEST_F(TrajectoryAnalyzerTest, QueryNearestPointByAbsoluteTimeInterpolation) {
   EXPECT_NEAR(point_6.path_point().x(), 1.0, 1e-6);
 }
 
+TEST_F(TrajectoryAnalyzerTest, IndexedQueries) {
+  planning::ADCTrajectory adc_trajectory;
+  std::vector<double> xs;
+  std::vector<double> ys;
+  std::vector<double> ts;
+  // a curve with uneven spacing and a pause in time
+  for (int i = 0; i < 200; ++i) {
+    const double s = 0.02 * i * i;
+    xs.push_back(10.0 * std::cos(s / 40.0));
+    ys.push_back(10.0 * std::sin(s / 40.0));
+    ts.push_back(i < 100 ? 0.05 * i : 5.0 + 0.01 * (i / 10));
+  }
+  SetTrajectoryWithTime(xs, ys, ts, &adc_trajectory);
+  adc_trajectory.mutable_header()->set_sequence_num(7);
+  TrajectoryAnalyzer trajectory_analyzer(&adc_trajectory);
+  EXPECT_TRUE(trajectory_analyzer.IsBuiltFrom(adc_trajectory));
+  adc_trajectory.mutable_header()->set_sequence_num(8);
+  EXPECT_FALSE(trajectory_analyzer.IsBuiltFrom(adc_trajectory));
+
+  for (int i = -20; i < 60; ++i) {
+    for (int j = -20; j < 60; ++j) {
+      const double x = -12.0 + 0.4 * i;
+      const double y = -12.0 + 0.4 * j;
+      size_t expected = 0;
+      double d_min = std::numeric_limits<double>::max();
+      for (size_t k = 0; k < xs.size(); ++k) {
+        const double d = std::hypot(xs[k] - x, ys[k] - y);
+        if (d < d_min) {
+          d_min = d;
+          expected = k;
+        }
+      }
+      const TrajectoryPoint point =
+          trajectory_analyzer.QueryNearestPointByPosition(x, y);
+      EXPECT_EQ(point.path_point().x(), xs[expected]);
+      EXPECT_EQ(point.path_point().y(), ys[expected]);
+    }
+  }
+
+  for (int i = -10; i < 700; ++i) {
+    const double t = 0.01 * i;
+    auto it = std::lower_bound(ts.begin(), ts.end(), t);
+    size_t expected = it - ts.begin();
+    if (it == ts.end()) {
+      expected = ts.size() - 1;
+    } else if (it != ts.begin() && *it - t >= t - *(it - 1)) {
+      expected = expected - 1;
+    }
+    const TrajectoryPoint point =
+        trajectory_analyzer.QueryNearestPointByRelativeTime(t);
+    EXPECT_EQ(point.path_point().x(), xs[expected]);
+  }
+}
+
 }  // namespace control
 }  // namespace apollo
@@ -161,6 +161,7 @@ Status ControlComponent::ProduceControlCommand(
     local_view_.localization = latest_localization_;
   }
 
+  const double input_check_start_timestamp = Clock::NowInSeconds();
   Status status = CheckInput(&local_view_);
   // check data
 
@@ -191,6 +192,8 @@ Status ControlComponent::ProduceControlCommand(
           apollo::common::EngageAdvice::READY_TO_ENGAGE);
     }
   }
+  control_command->mutable_latency_stats()->set_input_check_time_ms(
+      (Clock::NowInSeconds() - input_check_start_timestamp) * 1000);
 
   // check estop
   estop_ = control_conf_.enable_persistent_estop()
@@ -267,6 +270,7 @@ bool ControlComponent::Proc() {
   }
 
   OnChassis(chassis_msg);
+  const double chassis_timestamp = chassis_msg->header().timestamp_sec();
 
   trajectory_reader_->Observe();
   const auto &trajectory_msg = trajectory_reader_->GetLatestObserved();
@@ -311,10 +315,27 @@ bool ControlComponent::Proc() {
   }
 
   const double time_diff_ms = (end_timestamp - start_timestamp) * 1000;
-  control_command.mutable_latency_stats()->set_total_time_ms(time_diff_ms);
-  control_command.mutable_latency_stats()->set_total_time_exceeded(
-      time_diff_ms < control_conf_.control_period());
+  const double control_period_ms = control_conf_.control_period() * 1000;
+  auto *latency_stats = control_command.mutable_latency_stats();
+  latency_stats->set_total_time_ms(time_diff_ms);
+  latency_stats->set_total_time_exceeded(time_diff_ms > control_period_ms);
   ADEBUG << "control cycle time is: " << time_diff_ms << " ms.";
+
+  // a late cycle with a short computation points to the scheduler, a late
+  // chassis message to its source
+  latency_stats->set_chassis_age_ms((start_timestamp - chassis_timestamp) *
+                                    1000);
+  if (last_cycle_timestamp_ > 0.0) {
+    const double cycle_interval_ms =
+        (start_timestamp - last_cycle_timestamp_) * 1000;
+    latency_stats->set_cycle_interval_ms(cycle_interval_ms);
+    latency_stats->set_cycle_jitter_ms(cycle_interval_ms - control_period_ms);
+    latency_stats->set_chassis_interval_ms(
+        (chassis_timestamp - last_chassis_timestamp_) * 1000);
+    latency_stats->set_last_publish_time_ms(last_publish_time_ms_);
+  }
+  last_cycle_timestamp_ = start_timestamp;
+  last_chassis_timestamp_ = chassis_timestamp;
   status.Save(control_command.mutable_header()->mutable_status());
 
   // forward estop reason among following control frames.
@@ -338,7 +359,10 @@ bool ControlComponent::Proc() {
     return true;
   }
 
+  const double publish_start_timestamp = Clock::NowInSeconds();
   control_cmd_writer_->Write(std::make_shared<ControlCommand>(control_command));
+  last_publish_time_ms_ =
+      (Clock::NowInSeconds() - publish_start_timestamp) * 1000;
 
   return true;
 }
@@ -89,6 +89,11 @@ class ControlComponent final : public apollo::cyber::TimerComponent {
  private:
   double init_time_ = 0.0;
 
+  // timing of the previous cycle, for the latency stats
+  double last_cycle_timestamp_ = 0.0;
+  double last_chassis_timestamp_ = 0.0;
+  double last_publish_time_ms_ = 0.0;
+
   localization::LocalizationEstimate latest_localization_;
   canbus::Chassis latest_chassis_;
   planning::ADCTrajectory latest_trajectory_;
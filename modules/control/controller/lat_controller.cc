@@ -17,6 +17,7 @@
 #include "modules/control/controller/lat_controller.h"
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <utility>
 #include <vector>
@@ -74,6 +75,16 @@ void WriteHeaders(std::ofstream &file_stream) {
               << "steering_position,"
               << "v" << std::endl;
 }
+
+template <int N>
+void SolveFixedSizeLQR(const Matrix &A, const Matrix &B, const Matrix &Q,
+                       const Matrix &R, const double tolerance,
+                       const uint max_num_iteration, Matrix *ptr_K) {
+  Eigen::Matrix<double, 1, N> K;
+  common::math::SolveLQRProblem<N, 1>(A, B, Q, R, tolerance,
+                                      max_num_iteration, &K);
+  *ptr_K = K;
+}
 }  // namespace
 
 LatController::LatController() : name_("LQR-based Lateral Controller") {
@@ -124,6 +135,9 @@ bool LatController::LoadControlConf(const ControlConf *control_conf) {
 
   lqr_eps_ = control_conf->lat_controller_conf().eps();
   lqr_max_iteration_ = control_conf->lat_controller_conf().max_iteration();
+  lqr_gain_cache_speed_resolution_ =
+      control_conf->lat_controller_conf().lqr_gain_cache_speed_resolution();
+  lqr_gain_cache_.clear();
 
   query_relative_time_ = control_conf->query_relative_time();
 
@@ -278,10 +292,10 @@ Status LatController::ComputeControlCommand(
     ControlCommand *cmd) {
   auto vehicle_state = VehicleStateProvider::Instance();
 
-  auto target_tracking_trajectory = *planning_published_trajectory;
-
+  const double analysis_start_timestamp = Clock::NowInSeconds();
   if (FLAGS_use_navigation_mode &&
       FLAGS_enable_navigation_mode_position_update) {
+    auto target_tracking_trajectory = *planning_published_trajectory;
     auto time_stamp_diff =
         planning_published_trajectory->header().timestamp_sec() -
         current_trajectory_timestamp_;
@@ -343,11 +357,15 @@ Status LatController::ComputeControlCommand(
             p.mutable_path_point()->set_theta(theta_new);
           });
     }
+    trajectory_analyzer_ =
+        std::move(TrajectoryAnalyzer(&target_tracking_trajectory));
+  } else if (!trajectory_analyzer_.IsBuiltFrom(
+                 *planning_published_trajectory)) {
+    // the analyzer and its indexes are built once per planning message
+    trajectory_analyzer_ =
+        std::move(TrajectoryAnalyzer(planning_published_trajectory));
   }
 
-  trajectory_analyzer_ =
-      std::move(TrajectoryAnalyzer(&target_tracking_trajectory));
-
   UpdateDrivingOrientation();
 
   SimpleLateralDebug *debug = cmd->mutable_debug()->mutable_simple_lat_debug();
@@ -356,6 +374,10 @@ Status LatController::ComputeControlCommand(
   // Update state = [Lateral Error, Lateral Error Rate, Heading Error, Heading
   // Error Rate, preview lateral error1 , preview lateral error2, ...]
   UpdateState(debug);
+  auto *latency_stats = cmd->mutable_latency_stats();
+  latency_stats->set_trajectory_analysis_time_ms(
+      latency_stats->trajectory_analysis_time_ms() +
+      (Clock::NowInSeconds() - analysis_start_timestamp) * 1000);
 
   UpdateMatrix();
 
@@ -386,13 +408,9 @@ Status LatController::ComputeControlCommand(
     matrix_q_updated_(2, 2) =
         matrix_q_(2, 2) * heading_err_interpolation_->Interpolate(
                               vehicle_state->linear_velocity());
-    common::math::SolveLQRProblem(matrix_adc_, matrix_bdc_, matrix_q_updated_,
-                                  matrix_r_, lqr_eps_, lqr_max_iteration_,
-                                  &matrix_k_);
+    UpdateGain(matrix_q_updated_);
   } else {
-    common::math::SolveLQRProblem(matrix_adc_, matrix_bdc_, matrix_q_,
-                                  matrix_r_, lqr_eps_, lqr_max_iteration_,
-                                  &matrix_k_);
+    UpdateGain(matrix_q_);
   }
 
   // feedback = - K * state
@@ -542,6 +560,47 @@ void LatController::UpdateMatrixCompound() {
   }
 }
 
+void LatController::UpdateGain(const Matrix &matrix_q) {
+  if (lqr_gain_cache_speed_resolution_ <= 0.0) {
+    SolveLQR(matrix_q);
+    return;
+  }
+  // the matrices only vary with the speed and the gear, so the gain of a
+  // speed bucket is solved once
+  const auto vehicle_state = VehicleStateProvider::Instance();
+  const int64_t bucket = std::llround(vehicle_state->linear_velocity() /
+                                      lqr_gain_cache_speed_resolution_);
+  const bool reverse =
+      vehicle_state->gear() == canbus::Chassis::GEAR_REVERSE;
+  const int64_t key = 2 * bucket + (reverse ? 1 : 0);
+  const auto it = lqr_gain_cache_.find(key);
+  if (it != lqr_gain_cache_.end()) {
+    matrix_k_ = it->second;
+    return;
+  }
+  SolveLQR(matrix_q);
+  lqr_gain_cache_.emplace(key, matrix_k_);
+}
+
+void LatController::SolveLQR(const Matrix &matrix_q) {
+  // the usual state sizes are solved with fixed size matrices on the stack
+  switch (matrix_adc_.rows()) {
+    case 4:
+      SolveFixedSizeLQR<4>(matrix_adc_, matrix_bdc_, matrix_q, matrix_r_,
+                           lqr_eps_, lqr_max_iteration_, &matrix_k_);
+      break;
+    case 6:
+      SolveFixedSizeLQR<6>(matrix_adc_, matrix_bdc_, matrix_q, matrix_r_,
+                           lqr_eps_, lqr_max_iteration_, &matrix_k_);
+      break;
+    default:
+      common::math::SolveLQRProblem(matrix_adc_, matrix_bdc_, matrix_q,
+                                    matrix_r_, lqr_eps_, lqr_max_iteration_,
+                                    &matrix_k_);
+      break;
+  }
+}
+
 double LatController::ComputeFeedForward(double ref_curvature) const {
   const double kv =
       lr_ * mass_ / 2 / cf_ / wheelbase_ - lf_ * mass_ / 2 / cr_ / wheelbase_;
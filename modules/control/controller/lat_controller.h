@@ -21,9 +21,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <fstream>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "Eigen/Core"
 
@@ -110,6 +112,10 @@ class LatController : public Controller {
 
   void UpdateMatrixCompound();
 
+  void UpdateGain(const Eigen::MatrixXd &matrix_q);
+
+  void SolveLQR(const Eigen::MatrixXd &matrix_q);
+
   double ComputeFeedForward(double ref_curvature) const;
 
   void ComputeLateralErrors(const double x, const double y, const double theta,
@@ -193,6 +199,10 @@ class LatController : public Controller {
   int lqr_max_iteration_ = 0;
   // parameters for lqr solver; threshold for computation
   double lqr_eps_ = 0.0;
+  // width of the speed buckets of the gain cache; 0 disables the cache
+  double lqr_gain_cache_speed_resolution_ = 0.0;
+  // lqr gain of the first cycle in each speed bucket and gear
+  std::unordered_map<int64_t, Eigen::MatrixXd> lqr_gain_cache_;
 
   common::DigitalFilter digital_filter_;
 
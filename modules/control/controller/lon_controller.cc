@@ -155,6 +155,7 @@ Status LonController::ComputeControlCommand(
                   "Fail to initialize calibration table.");
   }
 
+  const double analysis_start_timestamp = Clock::NowInSeconds();
   if (trajectory_analyzer_ == nullptr ||
       trajectory_analyzer_->seq_num() !=
           trajectory_message_->header().sequence_num()) {
@@ -178,6 +179,10 @@ Status LonController::ComputeControlCommand(
     return Status(ErrorCode::CONTROL_COMPUTE_ERROR, error_msg);
   }
   ComputeLongitudinalErrors(trajectory_analyzer_.get(), preview_time, debug);
+  auto *latency_stats = cmd->mutable_latency_stats();
+  latency_stats->set_trajectory_analysis_time_ms(
+      latency_stats->trajectory_analysis_time_ms() +
+      (Clock::NowInSeconds() - analysis_start_timestamp) * 1000);
 
   double station_error_limit = lon_controller_conf.station_error_limit();
   double station_error_limited = 0.0;
@@ -107,6 +107,12 @@ bool MPCController::LoadControlConf(const ControlConf *control_conf) {
 
   mpc_eps_ = control_conf->mpc_controller_conf().eps();
   mpc_max_iteration_ = control_conf->mpc_controller_conf().max_iteration();
+  horizon_ = control_conf->mpc_controller_conf().horizon();
+  if (control_conf->mpc_controller_conf().use_osqp_solver()) {
+    mpc_osqp_solver_.reset(new common::math::MpcOsqpSolver());
+  } else {
+    mpc_osqp_solver_.reset();
+  }
   throttle_deadzone_ = control_conf->mpc_controller_conf().throttle_deadzone();
   brake_deadzone_ = control_conf->mpc_controller_conf().brake_deadzone();
 
@@ -279,8 +285,11 @@ Status MPCController::ComputeControlCommand(
     const canbus::Chassis *chassis,
     const planning::ADCTrajectory *planning_published_trajectory,
     ControlCommand *cmd) {
-  trajectory_analyzer_ =
-      std::move(TrajectoryAnalyzer(planning_published_trajectory));
+  const double analysis_start_timestamp = Clock::NowInSeconds();
+  if (!trajectory_analyzer_.IsBuiltFrom(*planning_published_trajectory)) {
+    trajectory_analyzer_ =
+        std::move(TrajectoryAnalyzer(planning_published_trajectory));
+  }
 
   SimpleMPCDebug *debug = cmd->mutable_debug()->mutable_simple_mpc_debug();
   debug->Clear();
@@ -289,6 +298,10 @@ Status MPCController::ComputeControlCommand(
 
   // Update state
   UpdateState(debug);
+  auto *latency_stats = cmd->mutable_latency_stats();
+  latency_stats->set_trajectory_analysis_time_ms(
+      latency_stats->trajectory_analysis_time_ms() +
+      (Clock::NowInSeconds() - analysis_start_timestamp) * 1000);
 
   UpdateMatrix(debug);
 
@@ -345,10 +358,18 @@ Status MPCController::ComputeControlCommand(
   double mpc_start_timestamp = Clock::NowInSeconds();
   double steer_angle_feedback = 0.0;
   double acc_feedback = 0.0;
-  if (common::math::SolveLinearMPC(
-          matrix_ad_, matrix_bd_, matrix_cd_, matrix_q_updated_,
-          matrix_r_updated_, lower_bound, upper_bound, matrix_state_, reference,
-          mpc_eps_, mpc_max_iteration_, &control) != true) {
+  const bool mpc_solved =
+      mpc_osqp_solver_ != nullptr
+          ? mpc_osqp_solver_->Solve(matrix_ad_, matrix_bd_, matrix_cd_,
+                                    matrix_q_updated_, matrix_r_updated_,
+                                    lower_bound, upper_bound, matrix_state_,
+                                    reference, mpc_eps_, mpc_max_iteration_,
+                                    &control)
+          : common::math::SolveLinearMPC(
+                matrix_ad_, matrix_bd_, matrix_cd_, matrix_q_updated_,
+                matrix_r_updated_, lower_bound, upper_bound, matrix_state_,
+                reference, mpc_eps_, mpc_max_iteration_, &control);
+  if (!mpc_solved) {
     AERROR << "MPC solver failed";
   } else {
     ADEBUG << "MPC problem solved! ";
@@ -40,6 +40,16 @@ bool DataComponent::Init() {
     return false;
   }
 
+  if (data_conf_.smart_recorder().enabled()) {
+    smart_recorder_ =
+        std::make_shared<SmartRecorder>(data_conf_.smart_recorder(), node_);
+    if (!smart_recorder_->Start()) {
+      AERROR << "Unable to start the smart recorder";
+      return false;
+    }
+    RecordService::SetSmartRecorder(smart_recorder_);
+  }
+
   return true;
 }
 
@@ -28,6 +28,7 @@
 
 #include "modules/data/proto/data.pb.h"
 #include "modules/data/proto/data_conf.pb.h"
+#include "modules/data/recorder/smart_recorder.h"
 
 /**
  * @namespace apollo::data
@@ -53,6 +54,7 @@ class DataComponent final
     const std::shared_ptr<DataInputCommand> &data_input_cmd);
  private:
   DataConf data_conf_;
+  std::shared_ptr<SmartRecorder> smart_recorder_;
   std::shared_ptr<apollo::cyber::Reader<DataInputCommand>>
     data_input_cmd_reader_;
 };
@@ -0,0 +1,170 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/data/recorder/message_ring.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "cyber/common/log.h"
+#include "cyber/record/file/chunk_compressor.h"
+
+namespace apollo {
+namespace data {
+
+using apollo::cyber::proto::ChunkBody;
+using apollo::cyber::proto::CompressType;
+using apollo::cyber::proto::SingleMessage;
+
+MessageRing::MessageRing(const CompressType compress,
+                         const uint64_t block_duration_ns,
+                         const size_t max_block_bytes)
+    : compress_(compress),
+      block_duration_ns_(block_duration_ns),
+      max_block_bytes_(max_block_bytes) {}
+
+void MessageRing::Add(const std::string& channel_name, const uint64_t time,
+                      const std::string& content) {
+  std::shared_ptr<Block> sealed;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (open_block_ == nullptr) {
+      open_block_ = std::make_shared<ChunkBody>();
+      open_begin_time_ = time;
+      open_end_time_ = time;
+      open_bytes_ = 0;
+    }
+    auto* message = open_block_->add_messages();
+    message->set_channel_name(channel_name);
+    message->set_time(time);
+    message->set_content(content);
+    open_begin_time_ = std::min(open_begin_time_, time);
+    open_end_time_ = std::max(open_end_time_, time);
+    const size_t message_bytes = channel_name.size() + content.size();
+    open_bytes_ += message_bytes;
+    bytes_ += message_bytes;
+
+    if (open_end_time_ - open_begin_time_ >= block_duration_ns_ ||
+        open_bytes_ >= max_block_bytes_) {
+      sealed = std::make_shared<Block>();
+      sealed->begin_time = open_begin_time_;
+      sealed->end_time = open_end_time_;
+      sealed->raw = std::move(open_block_);
+      sealed->bytes = open_bytes_;
+      open_block_ = nullptr;
+      blocks_.push_back(sealed);
+    }
+  }
+  if (sealed != nullptr) {
+    Compress(sealed);
+  }
+}
+
+void MessageRing::Compress(const std::shared_ptr<Block>& block) {
+  std::string raw;
+  block->raw->SerializeToString(&raw);
+  auto compressed = std::make_shared<std::string>();
+  if (!cyber::record::CompressChunk(compress_, raw, compressed.get())) {
+    AWARN << "Failed to compress a block, it is kept raw.";
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (std::find(blocks_.begin(), blocks_.end(), block) == blocks_.end()) {
+    // evicted while being compressed
+    return;
+  }
+  bytes_ = bytes_ - block->bytes + compressed->size();
+  block->bytes = compressed->size();
+  block->compressed = std::move(compressed);
+  block->raw.reset();
+}
+
+void MessageRing::Evict(const uint64_t keep_after, const size_t max_bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  while (!blocks_.empty() && (blocks_.front()->end_time < keep_after ||
+                              bytes_ > max_bytes)) {
+    bytes_ -= blocks_.front()->bytes;
+    blocks_.pop_front();
+  }
+}
+
+void MessageRing::GetMessages(const uint64_t begin, const uint64_t end,
+                              std::vector<SingleMessage>* messages) const {
+  messages->clear();
+  std::vector<std::shared_ptr<const ChunkBody>> raw_blocks;
+  std::vector<std::shared_ptr<const std::string>> compressed_blocks;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& block : blocks_) {
+      if (block->end_time < begin || block->begin_time > end) {
+        continue;
+      }
+      if (block->raw != nullptr) {
+        raw_blocks.push_back(block->raw);
+      } else {
+        compressed_blocks.push_back(block->compressed);
+      }
+    }
+    if (open_block_ != nullptr) {
+      for (const auto& message : open_block_->messages()) {
+        if (message.time() >= begin && message.time() <= end) {
+          messages->push_back(message);
+        }
+      }
+    }
+  }
+
+  ChunkBody chunk;
+  std::string raw;
+  for (const auto& compressed : compressed_blocks) {
+    if (!cyber::record::DecompressChunk(compress_, compressed->data(),
+                                        compressed->size(), &raw) ||
+        !chunk.ParseFromString(raw)) {
+      AERROR << "Failed to decompress a block, its messages are lost.";
+      continue;
+    }
+    raw_blocks.push_back(std::make_shared<ChunkBody>(std::move(chunk)));
+    chunk = ChunkBody();
+  }
+  for (const auto& block : raw_blocks) {
+    for (const auto& message : block->messages()) {
+      if (message.time() >= begin && message.time() <= end) {
+        messages->push_back(message);
+      }
+    }
+  }
+  std::stable_sort(messages->begin(), messages->end(),
+                   [](const SingleMessage& a, const SingleMessage& b) {
+                     return a.time() < b.time();
+                   });
+}
+
+size_t MessageRing::bytes() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bytes_;
+}
+
+uint64_t MessageRing::begin_time() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!blocks_.empty()) {
+    return blocks_.front()->begin_time;
+  }
+  return open_block_ == nullptr ? 0 : open_begin_time_;
+}
+
+}  // namespace data
+}  // namespace apollo
@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cyber/proto/record.pb.h"
+
+/**
+ * @namespace apollo::data
+ * @brief apollo::data
+ */
+namespace apollo {
+namespace data {
+
+/**
+ * @class MessageRing
+ *
+ * @brief The latest messages of a set of channels, kept in memory in
+ * compressed blocks.
+ *
+ * Messages are appended to an open block, which is sealed once it spans
+ * block_duration_ns or holds max_block_bytes, and compressed by the thread
+ * that sealed it outside of the lock. The oldest blocks are dropped by Evict.
+ * Safe to use from several threads.
+ */
+class MessageRing {
+ public:
+  MessageRing(const cyber::proto::CompressType compress,
+              const uint64_t block_duration_ns, const size_t max_block_bytes);
+
+  void Add(const std::string& channel_name, const uint64_t time,
+           const std::string& content);
+
+  /**
+   * @brief Drops the blocks whose messages are all older than keep_after,
+   * and then the oldest blocks while the ring takes more than max_bytes.
+   */
+  void Evict(const uint64_t keep_after, const size_t max_bytes);
+
+  /**
+   * @brief The messages of the ring in [begin, end], in time order.
+   */
+  void GetMessages(const uint64_t begin, const uint64_t end,
+                   std::vector<cyber::proto::SingleMessage>* messages) const;
+
+  // The bytes the ring takes, compressed blocks at their compressed size.
+  size_t bytes() const;
+  // The time of the oldest message, 0 if the ring is empty.
+  uint64_t begin_time() const;
+
+ private:
+  struct Block {
+    uint64_t begin_time = 0;
+    uint64_t end_time = 0;
+    // one of them is set, raw until the block is compressed
+    std::shared_ptr<const cyber::proto::ChunkBody> raw;
+    std::shared_ptr<const std::string> compressed;
+    size_t bytes = 0;
+  };
+
+  // Compresses a sealed block, and replaces its raw messages.
+  void Compress(const std::shared_ptr<Block>& block);
+
+  const cyber::proto::CompressType compress_;
+  const uint64_t block_duration_ns_;
+  const size_t max_block_bytes_;
+
+  mutable std::mutex mutex_;
+  std::deque<std::shared_ptr<Block>> blocks_;
+  std::shared_ptr<cyber::proto::ChunkBody> open_block_;
+  uint64_t open_begin_time_ = 0;
+  uint64_t open_end_time_ = 0;
+  size_t open_bytes_ = 0;
+  size_t bytes_ = 0;
+};
+
+}  // namespace data
+}  // namespace apollo
@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/data/recorder/message_ring.h"
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace data {
+
+using apollo::cyber::proto::COMPRESS_LZ4;
+using apollo::cyber::proto::COMPRESS_NONE;
+using apollo::cyber::proto::SingleMessage;
+
+TEST(MessageRingTest, GetMessagesInTimeOrder) {
+  MessageRing ring(COMPRESS_LZ4, 10, 1 << 20);
+  // out of order across blocks, as from the callbacks of several channels
+  for (uint64_t t : {1, 3, 2, 12, 11, 25, 24, 30}) {
+    ring.Add(t % 2 ? "/odd" : "/even", t, std::string(100, 'a' + t % 26));
+  }
+  std::vector<SingleMessage> messages;
+  ring.GetMessages(2, 24, &messages);
+  ASSERT_EQ(5, messages.size());
+  const std::vector<uint64_t> expected = {2, 3, 11, 12, 24};
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(expected[i], messages[i].time());
+    EXPECT_EQ(std::string(100, 'a' + expected[i] % 26),
+              messages[i].content());
+  }
+  EXPECT_EQ("/even", messages[0].channel_name());
+  EXPECT_EQ("/odd", messages[1].channel_name());
+}
+
+TEST(MessageRingTest, CompressedBlocksAreSmaller) {
+  MessageRing ring(COMPRESS_LZ4, 10, 1 << 20);
+  for (uint64_t t = 0; t < 100; ++t) {
+    ring.Add("/channel", t, std::string(1000, 'x'));
+  }
+  EXPECT_LT(ring.bytes(), 100 * 1000 / 10);
+  std::vector<SingleMessage> messages;
+  ring.GetMessages(0, 100, &messages);
+  EXPECT_EQ(100, messages.size());
+}
+
+TEST(MessageRingTest, Evict) {
+  MessageRing ring(COMPRESS_NONE, 10, 1 << 20);
+  for (uint64_t t = 0; t < 100; ++t) {
+    ring.Add("/channel", t, std::string(100, 'x'));
+  }
+  EXPECT_EQ(0, ring.begin_time());
+
+  ring.Evict(50, 1 << 20);
+  EXPECT_GE(ring.begin_time(), 40);
+  EXPECT_LE(ring.begin_time(), 50);
+  std::vector<SingleMessage> messages;
+  ring.GetMessages(0, 100, &messages);
+  EXPECT_EQ(100 - ring.begin_time(), messages.size());
+
+  // the memory bound drops blocks the time bound would keep
+  const size_t bytes = ring.bytes();
+  ring.Evict(0, bytes / 2);
+  EXPECT_LE(ring.bytes(), bytes / 2);
+  EXPECT_GT(ring.begin_time(), 50);
+}
+
+}  // namespace data
+}  // namespace apollo
@@ -40,10 +40,26 @@ bool RecordService::Init(
   return true;
 }
 
+void RecordService::SetSmartRecorder(
+    const std::shared_ptr<SmartRecorder>& smart_recorder) {
+  Instance()->smart_recorder_ = smart_recorder;
+}
+
 void RecordService::OnRecordRequest(
     const std::shared_ptr<RecordRequest> &request,
     const std::shared_ptr<RecordResponse> &response) {
   ADEBUG << "Received data record request: " << request->DebugString();
+  if (request->record_switch() == RecordRequest::TRIGGER) {
+    auto smart_recorder = Instance()->smart_recorder_;
+    if (smart_recorder == nullptr) {
+      AWARN << "Smart recorder is not enabled";
+      response->set_record_result(RecordResponse::FAIL);
+      return;
+    }
+    smart_recorder->Trigger("REQUEST");
+    response->set_record_result(RecordResponse::PASS);
+    return;
+  }
   // TODO(michael): do recording
   response->set_record_result(RecordResponse::PASS);
 }
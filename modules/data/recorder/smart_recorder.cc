@@ -0,0 +1,326 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/data/recorder/smart_recorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <vector>
+
+#include "cyber/common/file.h"
+#include "cyber/common/log.h"
+#include "cyber/record/header_builder.h"
+#include "cyber/record/record_writer.h"
+#include "cyber/service_discovery/topology_manager.h"
+#include "cyber/time/time.h"
+#include "modules/canbus/proto/chassis.pb.h"
+#include "modules/common/adapters/adapter_gflags.h"
+#include "modules/planning/proto/planning.pb.h"
+
+namespace apollo {
+namespace data {
+
+using apollo::canbus::Chassis;
+using apollo::cyber::Time;
+using apollo::cyber::message::RawMessage;
+using apollo::cyber::proto::ChangeMsg;
+using apollo::cyber::proto::RoleAttributes;
+using apollo::cyber::service_discovery::TopologyManager;
+using apollo::planning::ADCTrajectory;
+
+namespace {
+
+constexpr uint64_t kBlockDurationNs = 1000000000UL;
+constexpr size_t kMaxBlockBytes = 64 << 20;
+constexpr size_t kBytesPerMb = 1 << 20;
+constexpr int kWriterIntervalMs = 100;
+
+uint64_t SecToNs(const double sec) {
+  return static_cast<uint64_t>(std::max(sec, 0.0) * 1e9);
+}
+
+// e.g. 20190101123000_DISENGAGEMENT.record
+std::string RecordFileName(const uint64_t time, const std::string& reason) {
+  const std::time_t sec = static_cast<std::time_t>(time / 1000000000UL);
+  struct tm stm;
+  char buf[32] = {0};
+  if (localtime_r(&sec, &stm) != nullptr) {
+    std::strftime(buf, sizeof(buf), "%Y%m%d%H%M%S", &stm);
+  }
+  return std::string(buf) + "_" + reason + ".record";
+}
+
+}  // namespace
+
+SmartRecorder::SmartRecorder(const SmartRecorderConfig& config,
+                             const std::shared_ptr<cyber::Node>& node)
+    : config_(config),
+      node_(node),
+      ring_(config.compress(), kBlockDurationNs, kMaxBlockBytes) {}
+
+SmartRecorder::~SmartRecorder() { Stop(); }
+
+bool SmartRecorder::Start() {
+  if (!cyber::common::EnsureDirectory(config_.output_dir())) {
+    AERROR << "Unable to create smart recorder output dir "
+           << config_.output_dir();
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(window_mutex_);
+    running_ = true;
+  }
+  writer_thread_ = std::thread(&SmartRecorder::WriterLoop, this);
+
+  auto channel_manager = TopologyManager::Instance()->channel_manager();
+  std::vector<RoleAttributes> role_attrs;
+  channel_manager->GetWriters(&role_attrs);
+  for (const auto& role_attr : role_attrs) {
+    AddChannel(role_attr);
+  }
+  change_conn_ = channel_manager->AddChangeListener(std::bind(
+      &SmartRecorder::OnTopologyChange, this, std::placeholders::_1));
+  if (!change_conn_.IsConnected()) {
+    AERROR << "Unable to listen to the channel topology";
+    return false;
+  }
+  AINFO << "Smart recorder started, writing to " << config_.output_dir();
+  return true;
+}
+
+void SmartRecorder::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(window_mutex_);
+    if (!running_) {
+      return;
+    }
+    running_ = false;
+  }
+  TopologyManager::Instance()->channel_manager()->RemoveChangeListener(
+      change_conn_);
+  window_cv_.notify_all();
+  if (writer_thread_.joinable()) {
+    writer_thread_.join();
+  }
+}
+
+void SmartRecorder::Trigger(const std::string& reason) {
+  TriggerAt(Time::Now().ToNanosecond(), reason);
+}
+
+void SmartRecorder::OnTopologyChange(const ChangeMsg& change_message) {
+  if (change_message.role_type() != cyber::proto::ROLE_WRITER) {
+    return;
+  }
+  AddChannel(change_message.role_attr());
+}
+
+void SmartRecorder::AddChannel(const RoleAttributes& role_attr) {
+  const std::string& channel_name = role_attr.channel_name();
+  if (channel_name.empty() || role_attr.message_type().empty()) {
+    return;
+  }
+  if (config_.channel_size() > 0 &&
+      std::find(config_.channel().begin(), config_.channel().end(),
+                channel_name) == config_.channel().end()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(channel_mutex_);
+  if (readers_.find(channel_name) != readers_.end()) {
+    return;
+  }
+  channels_[channel_name] = {role_attr.message_type(), role_attr.proto_desc()};
+  auto reader = node_->CreateReader<RawMessage>(
+      channel_name,
+      [this, channel_name](const std::shared_ptr<RawMessage>& message) {
+        OnMessage(channel_name, message);
+      });
+  if (reader == nullptr) {
+    AERROR << "Unable to create a smart recorder reader of " << channel_name;
+    return;
+  }
+  readers_[channel_name] = reader;
+}
+
+void SmartRecorder::OnMessage(const std::string& channel_name,
+                              const std::shared_ptr<RawMessage>& message) {
+  if (message == nullptr) {
+    return;
+  }
+  const uint64_t time = Time::Now().ToNanosecond();
+  ring_.Add(channel_name, time, message->message);
+  CheckTriggers(channel_name, message->message, time);
+}
+
+void SmartRecorder::CheckTriggers(const std::string& channel_name,
+                                  const std::string& content,
+                                  const uint64_t time) {
+  const bool is_chassis = channel_name == FLAGS_chassis_topic;
+  const bool is_planning = channel_name == FLAGS_planning_trajectory_topic;
+  Chassis chassis;
+  ADCTrajectory trajectory;
+  bool chassis_parsed = false;
+  bool trajectory_parsed = false;
+
+  for (const auto& trigger : config_.trigger()) {
+    switch (trigger.type()) {
+      case SmartRecorderTrigger::DISENGAGEMENT: {
+        if (!is_chassis) {
+          break;
+        }
+        if (!chassis_parsed) {
+          chassis_parsed = chassis.ParseFromString(content);
+        }
+        const bool auto_driving =
+            chassis.driving_mode() == Chassis::COMPLETE_AUTO_DRIVE;
+        if (auto_driving_ && !auto_driving) {
+          TriggerAt(time, "DISENGAGEMENT");
+        }
+        auto_driving_ = auto_driving;
+        break;
+      }
+      case SmartRecorderTrigger::HARD_BRAKE: {
+        if (!is_chassis) {
+          break;
+        }
+        if (!chassis_parsed) {
+          chassis_parsed = chassis.ParseFromString(content);
+        }
+        const bool hard_braking =
+            chassis.brake_percentage() >= trigger.hard_brake_percentage();
+        if (!hard_braking_ && hard_braking) {
+          TriggerAt(time, "HARD_BRAKE");
+        }
+        hard_braking_ = hard_braking;
+        break;
+      }
+      case SmartRecorderTrigger::PLANNING_FALLBACK: {
+        if (!is_planning) {
+          break;
+        }
+        if (!trajectory_parsed) {
+          trajectory_parsed = trajectory.ParseFromString(content);
+        }
+        const bool fallback =
+            trajectory.trajectory_type() == ADCTrajectory::PATH_FALLBACK ||
+            trajectory.trajectory_type() == ADCTrajectory::SPEED_FALLBACK;
+        if (!planning_fallback_ && fallback) {
+          TriggerAt(time, "PLANNING_FALLBACK");
+        }
+        planning_fallback_ = fallback;
+        break;
+      }
+      case SmartRecorderTrigger::CHANNEL_PATTERN: {
+        if (channel_name == trigger.channel() && !trigger.pattern().empty() &&
+            content.find(trigger.pattern()) != std::string::npos) {
+          TriggerAt(time, "CHANNEL_PATTERN");
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+}
+
+void SmartRecorder::TriggerAt(const uint64_t time, const std::string& reason) {
+  const uint64_t pre = SecToNs(config_.pre_trigger_sec());
+  Window window;
+  window.trigger_time = time;
+  window.begin_time = time > pre ? time - pre : 0;
+  window.end_time = time + SecToNs(config_.post_trigger_sec());
+  window.reason = reason;
+
+  std::lock_guard<std::mutex> lock(window_mutex_);
+  if (!windows_.empty() &&
+      time <= windows_.back().end_time + SecToNs(config_.merge_gap_sec())) {
+    windows_.back().end_time =
+        std::max(windows_.back().end_time, window.end_time);
+    AINFO << "Smart recorder trigger " << reason << " extends a window";
+    return;
+  }
+  AINFO << "Smart recorder trigger " << reason;
+  windows_.push_back(window);
+  window_cv_.notify_all();
+}
+
+void SmartRecorder::WriterLoop() {
+  const uint64_t keep = SecToNs(config_.pre_trigger_sec()) +
+                        SecToNs(config_.ring_extra_sec());
+  const size_t max_bytes = config_.max_memory_mb() * kBytesPerMb;
+  std::unique_lock<std::mutex> lock(window_mutex_);
+  while (true) {
+    window_cv_.wait_for(lock, std::chrono::milliseconds(kWriterIntervalMs));
+    const uint64_t now = Time::Now().ToNanosecond();
+    while (!windows_.empty() &&
+           (!running_ || windows_.front().end_time <= now)) {
+      const Window window = windows_.front();
+      windows_.pop_front();
+      lock.unlock();
+      WriteWindow(window);
+      lock.lock();
+    }
+    if (!running_) {
+      break;
+    }
+    // keep what the pending windows need, unless it breaks the memory bound
+    uint64_t keep_after = now > keep ? now - keep : 0;
+    if (!windows_.empty()) {
+      keep_after = std::min(keep_after, windows_.front().begin_time);
+    }
+    lock.unlock();
+    ring_.Evict(keep_after, max_bytes);
+    lock.lock();
+  }
+}
+
+bool SmartRecorder::WriteWindow(const Window& window) {
+  std::vector<cyber::proto::SingleMessage> messages;
+  ring_.GetMessages(window.begin_time, window.end_time, &messages);
+  if (messages.empty()) {
+    AWARN << "Smart recorder window of " << window.reason << " is empty";
+    return false;
+  }
+  const std::string file =
+      config_.output_dir() + "/" +
+      RecordFileName(window.trigger_time, window.reason);
+  cyber::record::RecordWriter writer(
+      cyber::record::HeaderBuilder::GetHeader());
+  if (!writer.Open(file)) {
+    AERROR << "Unable to open " << file;
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(channel_mutex_);
+    for (const auto& channel : channels_) {
+      writer.WriteChannel(channel.first, channel.second.message_type,
+                          channel.second.proto_desc);
+    }
+  }
+  for (const auto& message : messages) {
+    writer.WriteMessage(message.channel_name(), message.content(),
+                        message.time());
+  }
+  writer.Close();
+  AINFO << "Smart recorder wrote " << messages.size() << " messages of "
+        << window.reason << " to " << file;
+  return true;
+}
+
+}  // namespace data
+}  // namespace apollo
@@ -0,0 +1,114 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "cyber/cyber.h"
+#include "cyber/message/raw_message.h"
+#include "cyber/proto/role_attributes.pb.h"
+#include "cyber/proto/topology_change.pb.h"
+#include "cyber/service_discovery/specific_manager/channel_manager.h"
+#include "modules/data/proto/data_conf.pb.h"
+#include "modules/data/recorder/message_ring.h"
+
+/**
+ * @namespace apollo::data
+ * @brief apollo::data
+ */
+namespace apollo {
+namespace data {
+
+/**
+ * @class SmartRecorder
+ *
+ * @brief Keeps the last seconds of the channels compressed in memory, and
+ * writes a record of [t - pre_trigger_sec, t + post_trigger_sec] around each
+ * trigger t, e.g. a disengagement, instead of recording everything.
+ *
+ * Triggers within merge_gap_sec of the end of a pending window extend it.
+ * The records are written by a background thread once their window ends.
+ */
+class SmartRecorder {
+ public:
+  SmartRecorder(const SmartRecorderConfig& config,
+                const std::shared_ptr<cyber::Node>& node);
+  ~SmartRecorder();
+
+  bool Start();
+  // Stops listening and writes the pending windows with what they hold.
+  void Stop();
+
+  // Writes a window around now, e.g. on an operator request.
+  void Trigger(const std::string& reason);
+
+ private:
+  struct Window {
+    uint64_t trigger_time = 0;
+    uint64_t begin_time = 0;
+    uint64_t end_time = 0;
+    std::string reason;
+  };
+
+  struct ChannelInfo {
+    std::string message_type;
+    std::string proto_desc;
+  };
+
+  void OnTopologyChange(const cyber::proto::ChangeMsg& change_message);
+  void AddChannel(const cyber::proto::RoleAttributes& role_attr);
+  void OnMessage(const std::string& channel_name,
+                 const std::shared_ptr<cyber::message::RawMessage>& message);
+  void CheckTriggers(const std::string& channel_name,
+                     const std::string& content, const uint64_t time);
+  void TriggerAt(const uint64_t time, const std::string& reason);
+
+  void WriterLoop();
+  bool WriteWindow(const Window& window);
+
+  const SmartRecorderConfig config_;
+  std::shared_ptr<cyber::Node> node_;
+  MessageRing ring_;
+
+  std::mutex channel_mutex_;
+  std::unordered_map<std::string, ChannelInfo> channels_;
+  std::unordered_map<std::string, std::shared_ptr<cyber::ReaderBase>>
+      readers_;
+  cyber::service_discovery::ChannelManager::ChangeConnection change_conn_;
+
+  // trigger states, only touched by the callbacks of their channel
+  bool auto_driving_ = false;
+  bool hard_braking_ = false;
+  bool planning_fallback_ = false;
+
+  std::mutex window_mutex_;
+  std::condition_variable window_cv_;
+  std::deque<Window> windows_;
+  bool running_ = false;
+  std::thread writer_thread_;
+};
+
+}  // namespace data
+}  // namespace apollo
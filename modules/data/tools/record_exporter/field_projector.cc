@@ -0,0 +1,253 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/data/tools/record_exporter/field_projector.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/wire_format_lite.h"
+
+#include "cyber/common/log.h"
+#include "modules/common/util/string_util.h"
+
+namespace apollo {
+namespace data {
+
+using google::protobuf::Descriptor;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::internal::WireFormatLite;
+
+namespace {
+
+uint64_t DoubleBits(const double value) {
+  uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+// Reads one scalar of the field type as the bits of its column.
+bool ReadScalar(CodedInputStream* input, const FieldDescriptor::Type type,
+                uint64_t* bits) {
+  uint32_t value32 = 0;
+  uint64_t value64 = 0;
+  switch (type) {
+    case FieldDescriptor::TYPE_DOUBLE:
+    case FieldDescriptor::TYPE_FIXED64:
+    case FieldDescriptor::TYPE_SFIXED64:
+      return input->ReadLittleEndian64(bits);
+    case FieldDescriptor::TYPE_FLOAT: {
+      if (!input->ReadLittleEndian32(&value32)) {
+        return false;
+      }
+      float value = 0.0f;
+      std::memcpy(&value, &value32, sizeof(value));
+      *bits = DoubleBits(value);
+      return true;
+    }
+    case FieldDescriptor::TYPE_FIXED32:
+      if (!input->ReadLittleEndian32(&value32)) {
+        return false;
+      }
+      *bits = value32;
+      return true;
+    case FieldDescriptor::TYPE_SFIXED32:
+      if (!input->ReadLittleEndian32(&value32)) {
+        return false;
+      }
+      *bits = static_cast<uint64_t>(
+          static_cast<int64_t>(static_cast<int32_t>(value32)));
+      return true;
+    case FieldDescriptor::TYPE_SINT32:
+    case FieldDescriptor::TYPE_SINT64:
+      if (!input->ReadVarint64(&value64)) {
+        return false;
+      }
+      *bits = static_cast<uint64_t>(WireFormatLite::ZigZagDecode64(value64));
+      return true;
+    case FieldDescriptor::TYPE_BOOL:
+      if (!input->ReadVarint64(&value64)) {
+        return false;
+      }
+      *bits = value64 != 0;
+      return true;
+    default:
+      // int32 and enum values are sign extended to 64 bits on the wire
+      return input->ReadVarint64(bits);
+  }
+}
+
+bool IsScalar(const FieldDescriptor* field) {
+  return field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE &&
+         field->cpp_type() != FieldDescriptor::CPPTYPE_STRING;
+}
+
+}  // namespace
+
+bool FieldProjector::Init(const Descriptor* descriptor,
+                          const std::vector<std::string>& paths) {
+  paths_.clear();
+  for (const auto& text : paths) {
+    Path path;
+    const Descriptor* message = descriptor;
+    const FieldDescriptor* field = nullptr;
+    std::vector<std::string> tokens;
+    common::util::Split(text, '.', &tokens);
+    for (const auto& token : tokens) {
+      if (message == nullptr) {
+        AERROR << text << ": " << field->name() << " is not a message";
+        return false;
+      }
+      Step step;
+      std::string name = token;
+      const size_t bracket = token.find('[');
+      if (bracket != std::string::npos) {
+        name = token.substr(0, bracket);
+        step.index = std::atoi(token.c_str() + bracket + 1);
+      }
+      field = message->FindFieldByName(name);
+      if (field == nullptr) {
+        AERROR << text << ": " << message->full_name() << " has no field "
+               << name;
+        return false;
+      }
+      if (field->is_repeated() != (step.index >= 0)) {
+        AERROR << text << ": give an index [i] exactly for repeated fields";
+        return false;
+      }
+      step.field_number = field->number();
+      path.steps.push_back(step);
+      message = field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE
+                    ? field->message_type()
+                    : nullptr;
+    }
+    if (field == nullptr || !IsScalar(field)) {
+      AERROR << text << ": not a numeric, bool or enum field";
+      return false;
+    }
+    path.leaf_type = field->type();
+    switch (field->cpp_type()) {
+      case FieldDescriptor::CPPTYPE_DOUBLE:
+      case FieldDescriptor::CPPTYPE_FLOAT:
+        path.column_type = ColumnType::DOUBLE;
+        break;
+      case FieldDescriptor::CPPTYPE_UINT32:
+      case FieldDescriptor::CPPTYPE_UINT64:
+      case FieldDescriptor::CPPTYPE_BOOL:
+        path.column_type = ColumnType::UINT64;
+        break;
+      default:
+        path.column_type = ColumnType::INT64;
+        break;
+    }
+    paths_.push_back(path);
+  }
+  return true;
+}
+
+void FieldProjector::Project(const std::string& message,
+                             std::vector<uint64_t>* values) const {
+  values->resize(paths_.size());
+  const auto* data = reinterpret_cast<const uint8_t*>(message.data());
+  const int size = static_cast<int>(message.size());
+  for (size_t i = 0; i < paths_.size(); ++i) {
+    uint64_t value = 0;
+    if (!Find(data, size, paths_[i], 0, &value)) {
+      value = paths_[i].column_type == ColumnType::DOUBLE
+                  ? DoubleBits(std::numeric_limits<double>::quiet_NaN())
+                  : 0;
+    }
+    (*values)[i] = value;
+  }
+}
+
+bool FieldProjector::Find(const uint8_t* data, const int size,
+                          const Path& path, const size_t depth,
+                          uint64_t* value) {
+  const Step& step = path.steps[depth];
+  const bool is_leaf = depth + 1 == path.steps.size();
+  CodedInputStream input(data, size);
+  int occurrence = 0;
+  bool found = false;
+  uint32_t tag = 0;
+  while ((tag = input.ReadTag()) != 0) {
+    if (WireFormatLite::GetTagFieldNumber(tag) != step.field_number) {
+      if (!WireFormatLite::SkipField(&input, tag)) {
+        return found;
+      }
+      continue;
+    }
+
+    if (WireFormatLite::GetTagWireType(tag) ==
+        WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+      uint32_t length = 0;
+      if (!input.ReadVarint32(&length) ||
+          length > static_cast<uint32_t>(size - input.CurrentPosition())) {
+        return found;
+      }
+      const uint8_t* field_data = data + input.CurrentPosition();
+      if (is_leaf) {
+        // packed repeated scalars
+        CodedInputStream packed(field_data, static_cast<int>(length));
+        uint64_t element = 0;
+        while (packed.CurrentPosition() < static_cast<int>(length) &&
+               ReadScalar(&packed, path.leaf_type, &element)) {
+          if (occurrence++ == step.index) {
+            *value = element;
+            return true;
+          }
+        }
+      } else if (step.index < 0 || occurrence++ == step.index) {
+        // the last occurrence of a singular message wins, as in a merge
+        if (Find(field_data, static_cast<int>(length), path, depth + 1,
+                 value)) {
+          found = true;
+        }
+        if (step.index >= 0) {
+          return found;
+        }
+      }
+      input.Skip(static_cast<int>(length));
+      continue;
+    }
+
+    if (!is_leaf) {
+      if (!WireFormatLite::SkipField(&input, tag)) {
+        return found;
+      }
+      continue;
+    }
+    uint64_t element = 0;
+    if (!ReadScalar(&input, path.leaf_type, &element)) {
+      return found;
+    }
+    if (step.index < 0) {
+      *value = element;
+      found = true;
+    } else if (occurrence++ == step.index) {
+      *value = element;
+      return true;
+    }
+  }
+  return found;
+}
+
+}  // namespace data
+}  // namespace apollo
@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "google/protobuf/descriptor.h"
+
+/**
+ * @namespace apollo::data
+ * @brief apollo::data
+ */
+namespace apollo {
+namespace data {
+
+/**
+ * @class FieldProjector
+ *
+ * @brief Reads a few numeric fields straight out of serialized messages of
+ * one type, by walking their wire format and skipping everything else,
+ * without parsing the messages.
+ */
+class FieldProjector {
+ public:
+  enum class ColumnType { DOUBLE, INT64, UINT64 };
+
+  /**
+   * @brief Resolves dotted field paths like "trajectory_point[0].v".
+   * @return false if a path does not name a numeric, bool or enum field.
+   */
+  bool Init(const google::protobuf::Descriptor* descriptor,
+            const std::vector<std::string>& paths);
+
+  size_t size() const { return paths_.size(); }
+  ColumnType column_type(const size_t i) const {
+    return paths_[i].column_type;
+  }
+
+  /**
+   * @brief The little endian bits of the fields of a serialized message, a
+   * double NaN or an integer 0 where a field is absent.
+   */
+  void Project(const std::string& message, std::vector<uint64_t>* values) const;
+
+ private:
+  struct Step {
+    int field_number = 0;
+    // the element of a repeated field, -1 for a singular field
+    int index = -1;
+  };
+
+  struct Path {
+    std::vector<Step> steps;
+    google::protobuf::FieldDescriptor::Type leaf_type;
+    ColumnType column_type = ColumnType::DOUBLE;
+  };
+
+  static bool Find(const uint8_t* data, const int size, const Path& path,
+                   const size_t depth, uint64_t* value);
+
+  std::vector<Path> paths_;
+};
+
+}  // namespace data
+}  // namespace apollo
@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/data/tools/record_exporter/field_projector.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "modules/planning/proto/planning.pb.h"
+
+namespace apollo {
+namespace data {
+
+using apollo::planning::ADCTrajectory;
+
+namespace {
+
+double AsDouble(const uint64_t bits) {
+  double value = 0.0;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+}  // namespace
+
+TEST(FieldProjectorTest, Project) {
+  FieldProjector projector;
+  ASSERT_TRUE(projector.Init(
+      ADCTrajectory::descriptor(),
+      {"header.timestamp_sec", "trajectory_point[1].v", "trajectory_type",
+       "total_path_length", "header.sequence_num"}));
+  ASSERT_EQ(5, projector.size());
+  EXPECT_EQ(FieldProjector::ColumnType::DOUBLE, projector.column_type(0));
+  EXPECT_EQ(FieldProjector::ColumnType::INT64, projector.column_type(2));
+  EXPECT_EQ(FieldProjector::ColumnType::UINT64, projector.column_type(4));
+
+  ADCTrajectory trajectory;
+  trajectory.mutable_header()->set_timestamp_sec(1.5);
+  trajectory.mutable_header()->set_sequence_num(7);
+  trajectory.add_trajectory_point()->set_v(1.0);
+  trajectory.add_trajectory_point()->set_v(2.0);
+  trajectory.set_trajectory_type(ADCTrajectory::PATH_FALLBACK);
+
+  std::vector<uint64_t> values;
+  projector.Project(trajectory.SerializeAsString(), &values);
+  ASSERT_EQ(5, values.size());
+  EXPECT_DOUBLE_EQ(1.5, AsDouble(values[0]));
+  EXPECT_DOUBLE_EQ(2.0, AsDouble(values[1]));
+  EXPECT_EQ(ADCTrajectory::PATH_FALLBACK, static_cast<int64_t>(values[2]));
+  EXPECT_TRUE(std::isnan(AsDouble(values[3])));
+  EXPECT_EQ(7, values[4]);
+
+  // an index past the end is absent as well
+  trajectory.mutable_trajectory_point()->RemoveLast();
+  projector.Project(trajectory.SerializeAsString(), &values);
+  EXPECT_TRUE(std::isnan(AsDouble(values[1])));
+}
+
+TEST(FieldProjectorTest, InvalidPaths) {
+  FieldProjector projector;
+  EXPECT_FALSE(projector.Init(ADCTrajectory::descriptor(), {"no_such_field"}));
+  EXPECT_FALSE(projector.Init(ADCTrajectory::descriptor(), {"header"}));
+  EXPECT_FALSE(
+      projector.Init(ADCTrajectory::descriptor(), {"header.module_name"}));
+}
+
+}  // namespace data
+}  // namespace apollo
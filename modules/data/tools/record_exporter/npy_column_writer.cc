@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/data/tools/record_exporter/npy_column_writer.h"
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace data {
+
+namespace {
+
+// magic, version 1.0 and the header length, then the header dict padded
+// with spaces to a fixed size so the row count can be rewritten in place
+constexpr char kMagic[] = "\x93NUMPY\x01\x00";
+constexpr size_t kMagicLength = 8;
+constexpr size_t kPreambleLength = 128;
+
+}  // namespace
+
+NpyColumnWriter::~NpyColumnWriter() { Close(); }
+
+bool NpyColumnWriter::Open(const std::string& path, const std::string& dtype) {
+  out_.open(path, std::ios::binary | std::ios::trunc);
+  if (!out_.is_open()) {
+    AERROR << "Unable to open " << path;
+    return false;
+  }
+  dtype_ = dtype;
+  rows_ = 0;
+  WriteHeader();
+  return out_.good();
+}
+
+void NpyColumnWriter::Append(const uint64_t value) {
+  // .npy is little endian as declared by the dtype, like the host
+  out_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  ++rows_;
+}
+
+bool NpyColumnWriter::Close() {
+  if (!out_.is_open()) {
+    return true;
+  }
+  out_.seekp(0);
+  WriteHeader();
+  const bool ok = out_.good();
+  out_.close();
+  return ok;
+}
+
+void NpyColumnWriter::WriteHeader() {
+  std::string dict = "{'descr': '" + dtype_ +
+                     "', 'fortran_order': False, 'shape': (" +
+                     std::to_string(rows_) + ",), }";
+  const size_t header_length = kPreambleLength - kMagicLength - 2;
+  dict.resize(header_length - 1, ' ');
+  dict.push_back('\n');
+  out_.write(kMagic, kMagicLength);
+  const uint16_t length = static_cast<uint16_t>(header_length);
+  out_.write(reinterpret_cast<const char*>(&length), sizeof(length));
+  out_.write(dict.data(), dict.size());
+}
+
+}  // namespace data
+}  // namespace apollo
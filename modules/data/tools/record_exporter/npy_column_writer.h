@@ -0,0 +1,60 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+/**
+ * @namespace apollo::data
+ * @brief apollo::data
+ */
+namespace apollo {
+namespace data {
+
+/**
+ * @class NpyColumnWriter
+ *
+ * @brief Appends 8 byte values to a one dimensional .npy file, which numpy
+ * and pandas load without parsing. The row count in the header is filled in
+ * by Close.
+ */
+class NpyColumnWriter {
+ public:
+  ~NpyColumnWriter();
+
+  /**
+   * @param dtype the numpy type of the values, "<f8", "<i8" or "<u8"
+   */
+  bool Open(const std::string& path, const std::string& dtype);
+  void Append(const uint64_t value);
+  bool Close();
+
+  uint64_t rows() const { return rows_; }
+
+ private:
+  void WriteHeader();
+
+  std::ofstream out_;
+  std::string dtype_;
+  uint64_t rows_ = 0;
+};
+
+}  // namespace data
+}  // namespace apollo
@@ -0,0 +1,223 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ * @brief Writes selected fields of selected channels of a record to one
+ * .npy column per field, e.g. for pandas:
+ *   record_exporter --record_file=x.record --export_conf=conf.pb.txt
+ *                   --output_dir=/tmp/x
+ *   df = pd.DataFrame({f[:-4]: np.load(d + f) for f in os.listdir(d)})
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "gflags/gflags.h"
+
+#include "cyber/common/file.h"
+#include "cyber/common/log.h"
+#include "cyber/message/protobuf_factory.h"
+#include "cyber/record/file/record_file_mmap_reader.h"
+#include "modules/data/proto/record_export_conf.pb.h"
+#include "modules/data/tools/record_exporter/field_projector.h"
+#include "modules/data/tools/record_exporter/npy_column_writer.h"
+
+DEFINE_string(record_file, "", "The record to export.");
+DEFINE_string(export_conf, "", "RecordExportConf of the fields to export.");
+DEFINE_string(output_dir, "", "A directory of columns per channel goes here.");
+DEFINE_int32(export_threads, 4, "Threads decoding chunks.");
+
+using apollo::cyber::message::ProtobufFactory;
+using apollo::cyber::proto::ChunkBody;
+using apollo::cyber::proto::SectionType;
+using apollo::cyber::record::RecordFileMmapReader;
+using apollo::data::FieldProjector;
+using apollo::data::NpyColumnWriter;
+using apollo::data::RecordExportConf;
+
+namespace {
+
+struct ChannelExport {
+  FieldProjector projector;
+  NpyColumnWriter time_column;
+  std::vector<std::unique_ptr<NpyColumnWriter>> columns;
+};
+
+// The rows of one chunk per channel, the record time then the fields.
+using ChunkRows = std::unordered_map<std::string, std::vector<uint64_t>>;
+
+std::string FileName(const std::string& name) {
+  std::string file_name;
+  for (const char c : name) {
+    file_name.push_back(std::isalnum(c) || c == '.' || c == '_' ? c : '_');
+  }
+  return file_name.front() == '_' ? file_name.substr(1) : file_name;
+}
+
+const char* DType(const FieldProjector::ColumnType type) {
+  switch (type) {
+    case FieldProjector::ColumnType::DOUBLE:
+      return "<f8";
+    case FieldProjector::ColumnType::INT64:
+      return "<i8";
+    default:
+      return "<u8";
+  }
+}
+
+void ProjectChunk(
+    const RecordFileMmapReader& reader, const size_t chunk_index,
+    const std::unordered_map<std::string, std::unique_ptr<ChannelExport>>&
+        exports,
+    ChunkRows* rows) {
+  rows->clear();
+  ChunkBody body;
+  if (!reader.ReadChunk(chunk_index, &body)) {
+    AERROR << "Unable to read chunk " << chunk_index << ", it is skipped.";
+    return;
+  }
+  std::vector<uint64_t> values;
+  for (const auto& message : body.messages()) {
+    auto it = exports.find(message.channel_name());
+    if (it == exports.end()) {
+      continue;
+    }
+    it->second->projector.Project(message.content(), &values);
+    auto& channel_rows = (*rows)[message.channel_name()];
+    channel_rows.push_back(message.time());
+    channel_rows.insert(channel_rows.end(), values.begin(), values.end());
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+
+  RecordExportConf conf;
+  if (!apollo::cyber::common::GetProtoFromFile(FLAGS_export_conf, &conf)) {
+    AERROR << "Unable to load export conf " << FLAGS_export_conf;
+    return -1;
+  }
+  RecordFileMmapReader reader;
+  if (!reader.Open(FLAGS_record_file)) {
+    AERROR << "Unable to open record " << FLAGS_record_file;
+    return -1;
+  }
+
+  // channel types and descriptors from the index of the record
+  const auto index = reader.GetIndex();
+  std::unordered_map<std::string, std::unique_ptr<ChannelExport>> exports;
+  for (const auto& channel : conf.channel()) {
+    const apollo::cyber::proto::ChannelCache* cache = nullptr;
+    for (const auto& single_index : index.indexes()) {
+      if (single_index.type() == SectionType::SECTION_CHANNEL &&
+          single_index.channel_cache().name() == channel.channel()) {
+        cache = &single_index.channel_cache();
+      }
+    }
+    if (cache == nullptr) {
+      AWARN << "Channel " << channel.channel() << " is not in the record.";
+      continue;
+    }
+    ProtobufFactory::Instance()->RegisterMessage(cache->proto_desc());
+    const auto* descriptor =
+        ProtobufFactory::Instance()->FindMessageTypeByName(
+            cache->message_type());
+    if (descriptor == nullptr) {
+      AERROR << "Unknown message type " << cache->message_type();
+      return -1;
+    }
+
+    auto channel_export = std::make_unique<ChannelExport>();
+    const std::vector<std::string> fields(channel.field().begin(),
+                                          channel.field().end());
+    if (!channel_export->projector.Init(descriptor, fields)) {
+      return -1;
+    }
+    const std::string dir =
+        FLAGS_output_dir + "/" + FileName(channel.channel());
+    if (!apollo::cyber::common::EnsureDirectory(dir) ||
+        !channel_export->time_column.Open(dir + "/record_time.npy", "<u8")) {
+      AERROR << "Unable to write to " << dir;
+      return -1;
+    }
+    for (size_t i = 0; i < fields.size(); ++i) {
+      channel_export->columns.emplace_back(new NpyColumnWriter());
+      if (!channel_export->columns.back()->Open(
+              dir + "/" + FileName(fields[i]) + ".npy",
+              DType(channel_export->projector.column_type(i)))) {
+        return -1;
+      }
+    }
+    exports[channel.channel()] = std::move(channel_export);
+  }
+
+  // decode windows of chunks on several threads, and write them in order
+  const size_t thread_num =
+      static_cast<size_t>(std::max(1, FLAGS_export_threads));
+  const size_t window = thread_num * 4;
+  const size_t chunk_num = reader.chunks().size();
+  std::vector<ChunkRows> window_rows(window);
+  for (size_t begin = 0; begin < chunk_num; begin += window) {
+    const size_t end = std::min(chunk_num, begin + window);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_num && begin + t < end; ++t) {
+      threads.emplace_back([&, t]() {
+        for (size_t c = begin + t; c < end; c += thread_num) {
+          ProjectChunk(reader, c, exports, &window_rows[c - begin]);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    for (size_t c = begin; c < end; ++c) {
+      for (const auto& channel_rows : window_rows[c - begin]) {
+        auto& channel_export = *exports[channel_rows.first];
+        const size_t width = channel_export.columns.size() + 1;
+        const auto& rows = channel_rows.second;
+        for (size_t row = 0; row < rows.size(); row += width) {
+          channel_export.time_column.Append(rows[row]);
+          for (size_t i = 1; i < width; ++i) {
+            channel_export.columns[i - 1]->Append(rows[row + i]);
+          }
+        }
+      }
+    }
+  }
+
+  for (auto& channel_export : exports) {
+    AINFO << channel_export.first << ": "
+          << channel_export.second->time_column.rows() << " rows";
+    bool ok = channel_export.second->time_column.Close();
+    for (auto& column : channel_export.second->columns) {
+      ok = column->Close() && ok;
+    }
+    if (!ok) {
+      AERROR << "Unable to write the columns of " << channel_export.first;
+      return -1;
+    }
+  }
+  return 0;
+}
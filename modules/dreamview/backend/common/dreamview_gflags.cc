@@ -58,6 +58,10 @@ DEFINE_double(sim_map_radius, 200.0,
               "The radius within which Dreamview will find all the map "
               "elements around the car.");
 
+DEFINE_double(map_tile_size, 200.0,
+              "Size in meters of the square tiles of the map sent to the "
+              "frontend.");
+
 DEFINE_bool(enable_update_size_check, true,
             "True to check if the update byte number is less than threshold");
 
@@ -67,6 +71,10 @@ DEFINE_uint32(max_update_size, 1000000,
 DEFINE_bool(sim_world_with_routing_path, false,
             "Whether the routing_path is included in sim_world proto.");
 
+DEFINE_uint32(sim_world_delta_history_size, 10,
+              "Number of recent SimulationWorld frames kept as the bases of "
+              "the deltas sent to the clients that ask for them.");
+
 DEFINE_string(
     request_timeout_ms, "2000",
     "Timeout for network read and network write operations, in milliseconds.");
@@ -76,6 +84,25 @@ DEFINE_double(voxel_filter_size, 0.3, "VoxelGrid pointcloud filter leaf size");
 DEFINE_double(voxel_filter_height, 0.2,
               "VoxelGrid pointcloud filter leaf height");
 
+DEFINE_double(point_cloud_quantization_resolution, 0.02,
+              "Resolution in meters of the quantized point cloud sent to the "
+              "clients that ask for it.");
+
+DEFINE_string(image_scale_ladder, "1.0,0.5,0.25",
+              "Comma separated scales of the camera image levels sent to the "
+              "clients, from the best level to the cheapest.");
+
+DEFINE_string(image_quality_ladder, "95,80,60",
+              "Comma separated JPEG qualities of the camera image levels, one "
+              "per scale of image_scale_ladder.");
+
+DEFINE_double(image_max_fps, 15.0,
+              "Highest rate of the camera images sent to a client.");
+
+DEFINE_double(image_min_fps, 3.0,
+              "Rate of the camera images below which a slow client is moved "
+              "to a cheaper image level.");
+
 DEFINE_double(system_status_lifetime_seconds, 30,
               "Lifetime of a valid SystemStatus message. It's more like a "
               "replay message if the timestamp is old, where we should ignore "
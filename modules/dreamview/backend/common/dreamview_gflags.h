@@ -38,6 +38,8 @@ DECLARE_string(ssl_certificate);
 
 DECLARE_double(sim_map_radius);
 
+DECLARE_double(map_tile_size);
+
 DECLARE_int32(dreamview_worker_num);
 
 DECLARE_bool(enable_update_size_check);
@@ -46,12 +48,24 @@ DECLARE_uint32(max_update_size);
 
 DECLARE_bool(sim_world_with_routing_path);
 
+DECLARE_uint32(sim_world_delta_history_size);
+
 DECLARE_string(request_timeout_ms);
 
 DECLARE_double(voxel_filter_size);
 
 DECLARE_double(voxel_filter_height);
 
+DECLARE_double(point_cloud_quantization_resolution);
+
+DECLARE_string(image_scale_ladder);
+
+DECLARE_string(image_quality_ladder);
+
+DECLARE_double(image_max_fps);
+
+DECLARE_double(image_min_fps);
+
 DECLARE_double(system_status_lifetime_seconds);
 
 DECLARE_string(lidar_height_yaml);
@@ -15,69 +15,90 @@ limitations under the License.
 
 #include "modules/dreamview/backend/handlers/image_handler.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <thread>
+
 #include "cyber/common/log.h"
 #include "modules/common/adapters/adapter_gflags.h"
 #include "modules/common/configs/config_gflags.h"
+#include "modules/common/util/string_tokenizer.h"
+#include "modules/dreamview/backend/common/dreamview_gflags.h"
 
 #include "opencv2/opencv.hpp"
 
 namespace apollo {
 namespace dreamview {
 
+using apollo::common::util::StringTokenizer;
 using apollo::drivers::CompressedImage;
 using apollo::drivers::Image;
 
 constexpr double ImageHandler::kImageScale;
 
-template <>
-void ImageHandler::OnImage(const std::shared_ptr<Image> &image) {
-  if (requests_ == 0) {
-    return;
-  }
+namespace {
 
-  cv::Mat mat(image->height(), image->width(), CV_8UC3,
-              const_cast<char *>(image->data().data()), image->step());
-  cv::cvtColor(mat, mat, cv::COLOR_RGB2BGR);
-  cv::resize(
-      mat, mat,
-      cv::Size(static_cast<int>(image->width() * ImageHandler::kImageScale),
-               static_cast<int>(image->height() * ImageHandler::kImageScale)),
-      0, 0, CV_INTER_LINEAR);
-
-  std::unique_lock<std::mutex> lock(mutex_);
-  cv::imencode(".jpg", mat, send_buffer_, std::vector<int>() /* params */);
-  cvar_.notify_all();
-}
+// The weight of the last frame in the smoothed time to send a frame.
+constexpr double kWriteTimeSmoothing = 0.3;
+// A client is sent frames at most at half the rate it takes them, leaving the
+// connection room for the other clients.
+constexpr double kIntervalPerWriteTime = 2.0;
+// A client moved to a cheaper level is moved back once it could take frames
+// this many times faster than image_min_fps.
+constexpr double kLevelUpMargin = 4.0;
 
-template <>
-void ImageHandler::OnImage(
-    const std::shared_ptr<CompressedImage> &compressed_image) {
-  std::vector<uint8_t> compressed_raw_data(compressed_image->data().begin(),
-                                           compressed_image->data().end());
-  cv::Mat mat_image = cv::imdecode(compressed_raw_data, CV_LOAD_IMAGE_COLOR);
-
-  std::unique_lock<std::mutex> lock(mutex_);
-  cv::imencode(".jpg", mat_image, send_buffer_,
-               std::vector<int>() /* params */);
-  cvar_.notify_all();
-}
+}  // namespace
+
+struct ImageHandler::DecodedFrame {
+  cv::Mat image;
+  // the scale of the image at the best level
+  double scale = 1.0;
+};
 
 void ImageHandler::OnImageFront(const std::shared_ptr<Image> &image) {
   if (FLAGS_use_navigation_mode) {
     // Navigation mode
-    OnImage(image);
+    std::unique_lock<std::mutex> lock(mutex_);
+    image_ = image;
+    compressed_image_.reset();
+    ++frame_seq_;
+    cvar_.notify_all();
   }
 }
 
 void ImageHandler::OnImageShort(const std::shared_ptr<CompressedImage> &image) {
   if (!FLAGS_use_navigation_mode) {
     // Regular mode
-    OnImage(image);
+    std::unique_lock<std::mutex> lock(mutex_);
+    image_.reset();
+    compressed_image_ = image;
+    ++frame_seq_;
+    cvar_.notify_all();
   }
 }
 
-ImageHandler::ImageHandler()
-    : requests_(0), node_(cyber::CreateNode("image_handler")) {
+ImageHandler::ImageHandler() : node_(cyber::CreateNode("image_handler")) {
+  const auto scales = StringTokenizer::Split(FLAGS_image_scale_ladder, ",");
+  const auto qualities =
+      StringTokenizer::Split(FLAGS_image_quality_ladder, ",");
+  for (size_t i = 0; i < scales.size(); ++i) {
+    Level level;
+    const double scale = std::atof(scales[i].c_str());
+    if (scale > 0.0) {
+      level.scale = scale;
+    }
+    if (i < qualities.size()) {
+      level.quality = std::atoi(qualities[i].c_str());
+    }
+    levels_.push_back(level);
+  }
+  if (levels_.empty()) {
+    levels_.emplace_back();
+  }
+
   node_->CreateReader<Image>(
       FLAGS_image_front_topic,
       [this](const std::shared_ptr<Image> &image) { OnImageFront(image); });
@@ -89,8 +110,66 @@ ImageHandler::ImageHandler()
       });
 }
 
+std::shared_ptr<const std::vector<uint8_t>> ImageHandler::GetEncodedFrame(
+    const size_t level, uint64_t *seq) {
+  std::lock_guard<std::mutex> encode_lock(encode_mutex_);
+  std::shared_ptr<Image> image;
+  std::shared_ptr<CompressedImage> compressed_image;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    *seq = frame_seq_;
+    image = image_;
+    compressed_image = compressed_image_;
+  }
+
+  if (encoded_seq_ != *seq || encoded_.size() != levels_.size()) {
+    encoded_seq_ = *seq;
+    decoded_.reset();
+    encoded_.assign(levels_.size(), nullptr);
+  }
+  if (encoded_[level] != nullptr) {
+    return encoded_[level];
+  }
+
+  if (decoded_ == nullptr) {
+    decoded_ = std::make_shared<DecodedFrame>();
+    if (image != nullptr) {
+      cv::Mat mat(image->height(), image->width(), CV_8UC3,
+                  const_cast<char *>(image->data().data()), image->step());
+      cv::cvtColor(mat, decoded_->image, cv::COLOR_RGB2BGR);
+      decoded_->scale = kImageScale;
+    } else if (compressed_image != nullptr) {
+      std::vector<uint8_t> compressed_raw_data(
+          compressed_image->data().begin(), compressed_image->data().end());
+      decoded_->image = cv::imdecode(compressed_raw_data, CV_LOAD_IMAGE_COLOR);
+    }
+  }
+  if (decoded_->image.empty()) {
+    return nullptr;
+  }
+
+  cv::Mat mat = decoded_->image;
+  const double scale = decoded_->scale * levels_[level].scale;
+  if (scale != 1.0) {
+    cv::resize(decoded_->image, mat,
+               cv::Size(static_cast<int>(decoded_->image.cols * scale),
+                        static_cast<int>(decoded_->image.rows * scale)),
+               0, 0, CV_INTER_LINEAR);
+  }
+  auto encoded = std::make_shared<std::vector<uint8_t>>();
+  cv::imencode(".jpg", mat, *encoded,
+               {cv::IMWRITE_JPEG_QUALITY, levels_[level].quality});
+  encoded_[level] = encoded;
+  return encoded;
+}
+
 bool ImageHandler::handleGet(CivetServer *server, struct mg_connection *conn) {
-  requests_++;
+  size_t requested_level = 0;
+  std::string level_param;
+  if (CivetServer::getParam(conn, "level", level_param)) {
+    requested_level = std::min<size_t>(
+        std::strtoul(level_param.c_str(), nullptr, 10), levels_.size() - 1);
+  }
 
   mg_printf(conn,
             "HTTP/1.1 200 OK\r\n"
@@ -103,34 +182,65 @@ bool ImageHandler::handleGet(CivetServer *server, struct mg_connection *conn) {
             "boundary=--BoundaryString\r\n"
             "\r\n");
 
-  std::vector<uchar> to_send;
+  const double min_interval =
+      FLAGS_image_max_fps > 0.0 ? 1.0 / FLAGS_image_max_fps : 0.0;
+  const double max_interval = FLAGS_image_min_fps > 0.0
+                                  ? 1.0 / FLAGS_image_min_fps
+                                  : std::numeric_limits<double>::max();
+  size_t level = requested_level;
+  // the smoothed time the client takes a frame at the level, in seconds
+  double write_time = -1.0;
+  uint64_t sent_seq = 0;
+  auto next_send_time = std::chrono::steady_clock::now();
   while (true) {
     {
       std::unique_lock<std::mutex> lock(mutex_);
-      to_send = send_buffer_;
+      cvar_.wait(lock, [this, sent_seq] { return frame_seq_ != sent_seq; });
     }
-
-    if (!to_send.empty()) {
-      // Sends the image data
-      mg_printf(conn,
-                "--BoundaryString\r\n"
-                "Content-type: image/jpeg\r\n"
-                "Content-Length: %zu\r\n"
-                "\r\n",
-                to_send.size());
-
-      if (mg_write(conn, &to_send[0], to_send.size()) <= 0) {
-        requests_--;
-        return false;
-      }
-      mg_printf(conn, "\r\n\r\n");
+    // The frames that come before the client is due are skipped.
+    std::this_thread::sleep_until(next_send_time);
+
+    uint64_t seq = 0;
+    const auto to_send = GetEncodedFrame(level, &seq);
+    sent_seq = seq;
+    if (to_send == nullptr || to_send->empty()) {
+      continue;
     }
 
-    std::unique_lock<std::mutex> lock(mutex_);
-    cvar_.wait(lock);
+    // Sends the image data
+    const auto start_time = std::chrono::steady_clock::now();
+    mg_printf(conn,
+              "--BoundaryString\r\n"
+              "Content-type: image/jpeg\r\n"
+              "Content-Length: %zu\r\n"
+              "\r\n",
+              to_send->size());
+    if (mg_write(conn, to_send->data(), to_send->size()) <= 0) {
+      return false;
+    }
+    mg_printf(conn, "\r\n\r\n");
+    const double elapsed = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start_time)
+                               .count();
+    write_time = write_time < 0.0 ? elapsed
+                                  : write_time + kWriteTimeSmoothing *
+                                                     (elapsed - write_time);
+
+    const double interval =
+        std::max(min_interval, kIntervalPerWriteTime * write_time);
+    if (interval > max_interval && level + 1 < levels_.size()) {
+      ++level;
+      write_time = -1.0;
+    } else if (kLevelUpMargin * interval < max_interval &&
+               level > requested_level) {
+      --level;
+      write_time = -1.0;
+    }
+    next_send_time =
+        start_time + std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::duration<double>(interval));
   }
 
-  requests_--;
   return true;
 }
 
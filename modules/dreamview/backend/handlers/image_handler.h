@@ -20,7 +20,10 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "cyber/cyber.h"
@@ -40,6 +43,13 @@ namespace dreamview {
  *
  * @brief The ImageHandler, built on top of CivetHandler, converts the received
  * ROS image message to a image stream, wrapped by MJPEG Streaming Protocol.
+ *
+ * The camera callbacks only keep the latest frame. A frame is encoded at most
+ * once per level of the scale and quality ladders, by the first client that
+ * sends it at that level, and the other clients share the encoded image. Each
+ * client is sent frames no faster than it takes them, and is moved to a
+ * cheaper level when that rate falls under image_min_fps. A client may ask
+ * for a starting level with "/image?level=N".
  */
 class ImageHandler : public CivetHandler {
  public:
@@ -51,19 +61,36 @@ class ImageHandler : public CivetHandler {
   bool handleGet(CivetServer *server, struct mg_connection *conn);
 
  private:
-  template <typename SensorMsgsImage>
-  void OnImage(const std::shared_ptr<SensorMsgsImage> &image);
+  struct DecodedFrame;
+
+  struct Level {
+    double scale = 1.0;
+    int quality = 95;
+  };
 
   void OnImageFront(const std::shared_ptr<apollo::drivers::Image> &image);
   void OnImageShort(
       const std::shared_ptr<apollo::drivers::CompressedImage> &image);
 
-  std::vector<uint8_t> send_buffer_;
-  std::atomic<int> requests_;
+  // Returns the latest frame encoded at the level, and its sequence number.
+  std::shared_ptr<const std::vector<uint8_t>> GetEncodedFrame(
+      const size_t level, uint64_t *seq);
+
+  std::vector<Level> levels_;
 
   // mutex lock and condition variable to protect the received image
   std::mutex mutex_;
   std::condition_variable cvar_;
+  uint64_t frame_seq_ = 0;
+  std::shared_ptr<apollo::drivers::Image> image_;
+  std::shared_ptr<apollo::drivers::CompressedImage> compressed_image_;
+
+  // the encodings of a frame, guarded by encode_mutex_ so that concurrent
+  // clients encode each level once
+  std::mutex encode_mutex_;
+  uint64_t encoded_seq_ = 0;
+  std::shared_ptr<DecodedFrame> decoded_;
+  std::vector<std::shared_ptr<const std::vector<uint8_t>>> encoded_;
 
   std::unique_ptr<cyber::Node> node_;
 };
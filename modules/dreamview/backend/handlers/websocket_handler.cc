@@ -15,6 +15,9 @@ limitations under the License.
 
 #include "modules/dreamview/backend/handlers/websocket_handler.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "cyber/common/log.h"
 #include "modules/common/time/time.h"
 #include "modules/common/util/map_util.h"
@@ -26,10 +29,28 @@ namespace dreamview {
 using apollo::common::util::ContainsKey;
 using apollo::common::util::StrCat;
 
+WebSocketHandler::~WebSocketHandler() {
+  // The writers may be waiting for the global lock, so they are stopped
+  // without holding it.
+  std::vector<std::shared_ptr<ConnectionContext>> contexts;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (auto &kv : connections_) {
+      contexts.push_back(kv.second);
+    }
+  }
+  for (const auto &context : contexts) {
+    StopWriter(context.get());
+  }
+}
+
 void WebSocketHandler::handleReadyState(CivetServer *server, Connection *conn) {
   {
     std::unique_lock<std::mutex> lock(mutex_);
-    connections_.emplace(conn, std::make_shared<std::mutex>());
+    auto context = std::make_shared<ConnectionContext>();
+    context->writer =
+        std::thread(&WebSocketHandler::RunWriter, this, conn, context.get());
+    connections_.emplace(conn, std::move(context));
   }
   AINFO << name_
         << ": Accepted connection. Total connections: " << connections_.size();
@@ -46,15 +67,20 @@ void WebSocketHandler::handleClose(CivetServer *server,
   // so that it won't be reclaimed during map.erase().
   Connection *connection = const_cast<Connection *>(conn);
 
-  std::shared_ptr<std::mutex> connection_lock;
+  std::shared_ptr<ConnectionContext> context;
   {
     std::unique_lock<std::mutex> lock(mutex_);
-    connection_lock = connections_[connection];
+    auto iter = connections_.find(connection);
+    if (iter == connections_.end()) {
+      return;
+    }
+    context = iter->second;
   }
+  StopWriter(context.get());
 
   {
     // Make sure there's no data being sent via the connection
-    std::unique_lock<std::mutex> lock_connection(*connection_lock);
+    std::unique_lock<std::mutex> lock_connection(context->write_mutex);
     std::unique_lock<std::mutex> lock(mutex_);
     connections_.erase(connection);
   }
@@ -63,22 +89,27 @@ void WebSocketHandler::handleClose(CivetServer *server,
         << ": Connection closed. Total connections: " << connections_.size();
 }
 
-bool WebSocketHandler::BroadcastData(const std::string &data, bool skippable) {
-  std::vector<Connection *> connections_to_send;
+bool WebSocketHandler::BroadcastData(const std::string &data, bool skippable,
+                                     const std::string &coalesce_key) {
+  std::vector<std::shared_ptr<ConnectionContext>> contexts;
   {
     std::unique_lock<std::mutex> lock(mutex_);
     if (connections_.empty()) {
       return true;
     }
     for (auto &kv : connections_) {
-      Connection *conn = kv.first;
-      connections_to_send.push_back(conn);
+      contexts.push_back(kv.second);
     }
   }
 
+  // The data is shared by the queues of all the connections.
+  QueuedMessage message;
+  message.data = std::make_shared<const std::string>(data);
+  message.skippable = skippable;
+  message.coalesce_key = coalesce_key;
   bool all_success = true;
-  for (Connection *conn : connections_to_send) {
-    if (!SendData(conn, data, skippable)) {
+  for (const auto &context : contexts) {
+    if (!QueueData(context.get(), message)) {
       all_success = false;
     }
   }
@@ -86,6 +117,76 @@ bool WebSocketHandler::BroadcastData(const std::string &data, bool skippable) {
   return all_success;
 }
 
+bool WebSocketHandler::QueueData(ConnectionContext *context,
+                                 const QueuedMessage &message) {
+  bool dropped = false;
+  {
+    std::unique_lock<std::mutex> lock(context->queue_mutex);
+    if (context->closing) {
+      return false;
+    }
+    if (!message.coalesce_key.empty()) {
+      for (auto &queued : context->queue) {
+        if (queued.coalesce_key == message.coalesce_key) {
+          // Only the latest value is worth sending.
+          queued = message;
+          return true;
+        }
+      }
+    }
+    if (context->queue.size() >= kMaxQueuedMessages) {
+      if (message.skippable) {
+        AWARN << name_ << ": Send queue is full, skip a droppable message!";
+        return false;
+      }
+      // Make room by dropping the oldest skippable message, or the oldest
+      // message if none is skippable.
+      auto iter = std::find_if(
+          context->queue.begin(), context->queue.end(),
+          [](const QueuedMessage &queued) { return queued.skippable; });
+      dropped = iter == context->queue.end();
+      context->queue.erase(dropped ? context->queue.begin() : iter);
+    }
+    context->queue.push_back(message);
+  }
+  context->queue_cv.notify_one();
+  if (dropped) {
+    AWARN << name_ << ": Send queue is full, dropped the oldest message!";
+  }
+  return true;
+}
+
+void WebSocketHandler::RunWriter(Connection *conn,
+                                 ConnectionContext *context) {
+  while (true) {
+    QueuedMessage message;
+    {
+      std::unique_lock<std::mutex> lock(context->queue_mutex);
+      context->queue_cv.wait(lock, [context]() {
+        return context->closing || !context->queue.empty();
+      });
+      if (context->closing) {
+        return;
+      }
+      message = std::move(context->queue.front());
+      context->queue.pop_front();
+    }
+    SendData(conn, *message.data);
+  }
+}
+
+void WebSocketHandler::StopWriter(ConnectionContext *context) {
+  {
+    std::unique_lock<std::mutex> lock(context->queue_mutex);
+    context->closing = true;
+    context->queue.clear();
+  }
+  context->queue_cv.notify_one();
+  if (context->writer.joinable()) {
+    context->writer.join();
+  }
+}
+
 bool WebSocketHandler::SendBinaryData(Connection *conn, const std::string &data,
                                       bool skippable) {
   return SendData(conn, data, skippable, MG_WEBSOCKET_OPCODE_BINARY);
@@ -93,7 +194,7 @@ bool WebSocketHandler::SendBinaryData(Connection *conn, const std::string &data,
 
 bool WebSocketHandler::SendData(Connection *conn, const std::string &data,
                                 bool skippable, int op_code) {
-  std::shared_ptr<std::mutex> connection_lock;
+  std::shared_ptr<ConnectionContext> context;
   {
     std::unique_lock<std::mutex> lock(mutex_);
     if (!ContainsKey(connections_, conn)) {
@@ -101,10 +202,11 @@ bool WebSocketHandler::SendData(Connection *conn, const std::string &data,
              << ": Trying to send to an uncached connection, skipping.";
       return false;
     }
-    // Copy the lock so that it still exists if the connection is closed after
-    // this block.
-    connection_lock = connections_[conn];
+    // Copy the context so that its lock still exists if the connection is
+    // closed after this block.
+    context = connections_[conn];
   }
+  std::mutex *connection_lock = &context->write_mutex;
 
   // Lock the connection while sending.
   if (!connection_lock->try_lock()) {
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -56,6 +58,7 @@ class WebSocketHandler : public CivetWebSocketHandler {
   using ConnectionReadyHandler = std::function<void(Connection *)>;
 
   explicit WebSocketHandler(const std::string &name) : name_(name) {}
+  ~WebSocketHandler();
 
   /**
    * @brief Callback method for when the client intends to establish a websocket
@@ -113,10 +116,18 @@ class WebSocketHandler : public CivetWebSocketHandler {
   void handleClose(CivetServer *server, const Connection *conn) override;
 
   /**
-   * @brief Sends the provided data to all the connected clients.
+   * @brief Queues the provided data to all the connected clients. Each
+   * connection has a bounded send queue and a writer thread of its own, so a
+   * slow client holds up neither the caller nor the other clients.
    * @param data The message string to be sent.
+   * @param skippable whether the data is allowed to be dropped if the send
+   * queue of a connection is full.
+   * @param coalesce_key if not empty, a queued message with the same key that
+   * has not been sent yet is replaced by this one.
+   * @returns false if the data was dropped for some connection.
    */
-  bool BroadcastData(const std::string &data, bool skippable = false);
+  bool BroadcastData(const std::string &data, bool skippable = false,
+                     const std::string &coalesce_key = "");
 
   /**
    * @brief Sends the provided data to a specific connected client.
@@ -150,6 +161,33 @@ class WebSocketHandler : public CivetWebSocketHandler {
   }
 
  private:
+  struct QueuedMessage {
+    std::shared_ptr<const std::string> data;
+    bool skippable = false;
+    std::string coalesce_key;
+  };
+
+  struct ConnectionContext {
+    // Guards against simultaneous write.
+    std::mutex write_mutex;
+
+    // The messages waiting for the writer thread.
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;
+    std::deque<QueuedMessage> queue;
+    bool closing = false;
+    std::thread writer;
+  };
+
+  // The most messages waiting to be sent to a connection.
+  static constexpr size_t kMaxQueuedMessages = 16;
+
+  bool QueueData(ConnectionContext *context, const QueuedMessage &message);
+
+  void RunWriter(Connection *conn, ConnectionContext *context);
+
+  static void StopWriter(ConnectionContext *context);
+
   const std::string name_;
 
   // Message handlers keyed by message type.
@@ -165,8 +203,9 @@ class WebSocketHandler : public CivetWebSocketHandler {
   mutable std::mutex mutex_;
 
   // The pool of all maintained connections. Each connection has a lock to
-  // guard against simultaneous write.
-  std::unordered_map<Connection *, std::shared_ptr<std::mutex>> connections_;
+  // guard against simultaneous write, and a send queue.
+  std::unordered_map<Connection *, std::shared_ptr<ConnectionContext>>
+      connections_;
 };
 
 }  // namespace dreamview
@@ -54,7 +54,8 @@ void HMI::RegisterMessageHandlers() {
           return;
         }
         websocket_->BroadcastData(
-            JsonUtil::ProtoToTypedJson("HMIStatus", *status).dump());
+            JsonUtil::ProtoToTypedJson("HMIStatus", *status).dump(), false,
+            "HMIStatus");
         if (status->current_map().empty()) {
           monitor_log_buffer_.WARN("You haven't selected a map yet!");
         }
@@ -143,7 +144,7 @@ void HMI::SendVehicleParam(WebSocketHandler::Connection* conn) {
   if (conn != nullptr) {
     websocket_->SendData(conn, json_str);
   } else {
-    websocket_->BroadcastData(json_str);
+    websocket_->BroadcastData(json_str, false, "VehicleParam");
   }
 }
 
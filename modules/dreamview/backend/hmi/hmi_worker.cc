@@ -512,7 +512,7 @@ void HMIWorker::ChangeMode(const std::string& mode_name) {
     }
     status_changed_ = true;
   }
-  KVDB::Put(FLAGS_current_mode_db_key, mode_name);
+  KVDB::Put(FLAGS_current_mode_db_key, mode_name, false);
 }
 
 void HMIWorker::StartModule(const std::string& module) const {
@@ -17,10 +17,12 @@
 #include "modules/dreamview/backend/map/map_service.h"
 
 #include <algorithm>
+#include <cmath>
 #include <utility>
 
 #include "modules/common/util/json_util.h"
 #include "modules/common/util/string_util.h"
+#include "modules/dreamview/backend/common/dreamview_gflags.h"
 #include "modules/map/hdmap/hdmap_util.h"
 
 namespace apollo {
@@ -95,6 +97,11 @@ bool MapService::ReloadMap(bool force_reload) {
 
   // Update the x,y-offsets if present.
   UpdateOffsets();
+
+  // The tiles of the previous map are stale.
+  std::lock_guard<std::mutex> tiles_lock(map_tiles_mutex_);
+  map_tiles_.clear();
+  ++map_version_;
   return ret;
 }
 
@@ -515,5 +522,50 @@ size_t MapService::CalculateMapHash(const MapElementIds &ids) const {
   return hash_function(ids.DebugString());
 }
 
+void MapService::GetMapTile(const int x, const int y,
+                            const uint64_t known_version,
+                            std::string *tile) const {
+  const auto key = std::make_pair(x, y);
+  uint64_t version = 0;
+  {
+    std::lock_guard<std::mutex> tiles_lock(map_tiles_mutex_);
+    version = map_version_;
+    if (known_version != version) {
+      auto iter = map_tiles_.find(key);
+      if (iter != map_tiles_.end()) {
+        *tile = iter->second;
+        return;
+      }
+    }
+  }
+
+  MapTile map_tile;
+  map_tile.set_x(x);
+  map_tile.set_y(y);
+  map_tile.set_size(FLAGS_map_tile_size);
+  map_tile.set_version(version);
+  if (known_version == version) {
+    // The client has this tile already.
+    map_tile.SerializeToString(tile);
+    return;
+  }
+
+  // The elements within the circle around the tile, which may also be in
+  // the neighboring tiles.
+  PointENU center;
+  center.set_x((x + 0.5) * FLAGS_map_tile_size);
+  center.set_y((y + 0.5) * FLAGS_map_tile_size);
+  MapElementIds ids;
+  CollectMapElementIds(center, FLAGS_map_tile_size * M_SQRT1_2, &ids);
+  RetrieveMapElements(ids).SerializeToString(map_tile.mutable_map());
+  map_tile.SerializeToString(tile);
+
+  std::lock_guard<std::mutex> tiles_lock(map_tiles_mutex_);
+  // Not cached if the map was reloaded in the meantime.
+  if (map_version_ == version) {
+    map_tiles_.emplace(key, *tile);
+  }
+}
+
 }  // namespace dreamview
 }  // namespace apollo
@@ -20,7 +20,11 @@
 
 #pragma once
 
+#include <cstdint>
+#include <map>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "boost/thread/locks.hpp"
@@ -89,6 +93,18 @@ class MapService {
 
   size_t CalculateMapHash(const MapElementIds &ids) const;
 
+  /**
+   * @brief Gets a tile of the sim map. Each tile is serialized once per
+   * loaded map and kept until the map is reloaded.
+   * @param x the index of the tile along x, see MapTile
+   * @param y the index of the tile along y
+   * @param known_version the version of the tile the client already has, 0
+   * if none
+   * @param tile the MapTile in wire format
+   */
+  void GetMapTile(int x, int y, uint64_t known_version,
+                  std::string *tile) const;
+
  private:
   void UpdateOffsets();
   bool GetNearestLane(const double x, const double y,
@@ -119,6 +135,12 @@ class MapService {
 
   // RW lock to protect map data
   mutable boost::shared_mutex mutex_;
+
+  // The serialized tiles of the loaded map, keyed by their indices, and the
+  // version of the loaded map.
+  mutable std::map<std::pair<int, int>, std::string> map_tiles_;
+  uint64_t map_version_ = 0;
+  mutable std::mutex map_tiles_mutex_;
 };
 
 }  // namespace dreamview
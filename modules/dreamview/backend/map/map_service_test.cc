@@ -16,10 +16,13 @@
 
 #include "modules/dreamview/backend/map/map_service.h"
 
+#include <cmath>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 #include "modules/common/configs/config_gflags.h"
+#include "modules/dreamview/backend/common/dreamview_gflags.h"
 
 using apollo::common::PointENU;
 using apollo::hdmap::Map;
@@ -62,6 +65,47 @@ TEST_F(MapServiceTest, RetrieveMapElements) {
   EXPECT_EQ("l1", map.lane(0).id().id());
 }
 
+TEST_F(MapServiceTest, GetMapTile) {
+  // The tile of the start point of l1.
+  const int x = static_cast<int>(std::floor(-1826.4 / FLAGS_map_tile_size));
+  const int y = static_cast<int>(std::floor(-3027.5 / FLAGS_map_tile_size));
+  std::string tile_string;
+  map_service->GetMapTile(x, y, 0, &tile_string);
+  MapTile tile;
+  ASSERT_TRUE(tile.ParseFromString(tile_string));
+  EXPECT_EQ(x, tile.x());
+  EXPECT_EQ(y, tile.y());
+  EXPECT_GT(tile.version(), 0);
+  Map map;
+  ASSERT_TRUE(map.ParseFromString(tile.map()));
+  ASSERT_EQ(1, map.lane_size());
+  EXPECT_EQ("l1", map.lane(0).id().id());
+
+  // Served from the cache.
+  std::string cached_tile_string;
+  map_service->GetMapTile(x, y, 0, &cached_tile_string);
+  EXPECT_EQ(tile_string, cached_tile_string);
+
+  // Not sent again to a client which has it.
+  map_service->GetMapTile(x, y, tile.version(), &tile_string);
+  ASSERT_TRUE(tile.ParseFromString(tile_string));
+  EXPECT_FALSE(tile.has_map());
+
+  // Far from the map.
+  map_service->GetMapTile(x + 1000, y, 0, &tile_string);
+  ASSERT_TRUE(tile.ParseFromString(tile_string));
+  ASSERT_TRUE(map.ParseFromString(tile.map()));
+  EXPECT_EQ(0, map.lane_size());
+
+  // A reloaded map has a new version.
+  const uint64_t version = tile.version();
+  map_service->ReloadMap(false);
+  map_service->GetMapTile(x, y, version, &tile_string);
+  ASSERT_TRUE(tile.ParseFromString(tile_string));
+  EXPECT_GT(tile.version(), version);
+  EXPECT_TRUE(tile.has_map());
+}
+
 TEST_F(MapServiceTest, GetStartPoint) {
   PointENU start_point;
   EXPECT_TRUE(map_service->GetStartPoint(&start_point));
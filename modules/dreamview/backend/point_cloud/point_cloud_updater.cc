@@ -16,6 +16,9 @@
 
 #include "modules/dreamview/backend/point_cloud/point_cloud_updater.h"
 
+#include <cmath>
+#include <cstdlib>
+#include <limits>
 #include <utility>
 
 #include "cyber/common/file.h"
@@ -34,6 +37,19 @@ namespace dreamview {
 using apollo::localization::LocalizationEstimate;
 using Json = nlohmann::json;
 
+namespace {
+
+size_t ReverseBits(size_t value, const int num_bits) {
+  size_t reversed = 0;
+  for (int i = 0; i < num_bits; ++i) {
+    reversed = (reversed << 1) | (value & 1);
+    value >>= 1;
+  }
+  return reversed;
+}
+
+}  // namespace
+
 float PointCloudUpdater::lidar_height_ = kDefaultLidarHeight;
 boost::shared_mutex PointCloudUpdater::mutex_;
 
@@ -89,8 +105,31 @@ void PointCloudUpdater::RegisterMessageHandlers() {
             std::fabs(last_localization_time_ - last_point_cloud_time_) > 2.0) {
           boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
           point_cloud_str_ = "";
+          points_.clear();
+          std::lock_guard<std::mutex> lock(encoded_clouds_mutex_);
+          encoded_clouds_.clear();
+        }
+        // A client may ask for the quantized points, for at most maxPoints
+        // of them and for those within range meters only.
+        bool quantized = false;
+        uint32_t max_points = 0;
+        uint32_t range = 0;
+        auto iter = json.find("quantized");
+        if (iter != json.end() && iter->is_boolean()) {
+          quantized = *iter;
+        }
+        iter = json.find("maxPoints");
+        if (iter != json.end() && iter->is_number_unsigned()) {
+          max_points = iter->get<uint32_t>();
+        }
+        iter = json.find("range");
+        if (iter != json.end() && iter->is_number() &&
+            iter->get<double>() > 0.0) {
+          range = static_cast<uint32_t>(std::ceil(iter->get<double>()));
         }
-        {
+        if (quantized || max_points > 0 || range > 0) {
+          GetPointCloud(quantized, max_points, range, &to_send);
+        } else {
           boost::shared_lock<boost::shared_mutex> reader_lock(mutex_);
           to_send = point_cloud_str_;
         }
@@ -111,7 +150,8 @@ void PointCloudUpdater::RegisterMessageHandlers() {
             response["type"] = "PointCloudStatus";
             response["enabled"] = enabled_;
             // Sync the point_cloud status across all the clients.
-            websocket_->BroadcastData(response.dump());
+            websocket_->BroadcastData(response.dump(), false,
+                                      "PointCloudStatus");
           }
         }
       });
@@ -193,22 +233,116 @@ void PointCloudUpdater::FilterPointCloud(
     boost::shared_lock<boost::shared_mutex> reader_lock(mutex_);
     z_offset = lidar_height_;
   }
-  apollo::dreamview::PointCloud point_cloud_pb;
+  std::vector<size_t> valid_indices;
+  valid_indices.reserve(pcl_filtered_ptr->size());
   for (size_t idx = 0; idx < pcl_filtered_ptr->size(); ++idx) {
-    pcl::PointXYZ &pt = pcl_filtered_ptr->points[idx];
+    const pcl::PointXYZ &pt = pcl_filtered_ptr->points[idx];
     if (!std::isnan(pt.x) && !std::isnan(pt.y) && !std::isnan(pt.z)) {
-      point_cloud_pb.add_num(pt.x);
-      point_cloud_pb.add_num(pt.y);
-      point_cloud_pb.add_num(pt.z + z_offset);
+      valid_indices.push_back(idx);
     }
   }
+
+  // The voxel grid outputs the points in grid order. Taking them in bit
+  // reversed order spreads every prefix over the whole cloud, so a client
+  // that asks for fewer points gets the first ones.
+  int num_bits = 0;
+  while ((static_cast<size_t>(1) << num_bits) < valid_indices.size()) {
+    ++num_bits;
+  }
+  std::vector<float> points;
+  points.reserve(3 * valid_indices.size());
+  apollo::dreamview::PointCloud point_cloud_pb;
+  for (size_t i = 0; i < (static_cast<size_t>(1) << num_bits); ++i) {
+    const size_t reversed = ReverseBits(i, num_bits);
+    if (reversed >= valid_indices.size()) {
+      continue;
+    }
+    const pcl::PointXYZ &pt = pcl_filtered_ptr->points[valid_indices[reversed]];
+    points.push_back(pt.x);
+    points.push_back(pt.y);
+    points.push_back(pt.z + z_offset);
+    point_cloud_pb.add_num(pt.x);
+    point_cloud_pb.add_num(pt.y);
+    point_cloud_pb.add_num(pt.z + z_offset);
+  }
   {
     boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
     point_cloud_pb.SerializeToString(&point_cloud_str_);
+    points_ = std::move(points);
+    {
+      std::lock_guard<std::mutex> lock(encoded_clouds_mutex_);
+      encoded_clouds_.clear();
+    }
     future_ready_ = true;
   }
 }
 
+void PointCloudUpdater::GetPointCloud(const bool quantized,
+                                      const uint32_t max_points,
+                                      const uint32_t range,
+                                      std::string *to_send) {
+  boost::shared_lock<boost::shared_mutex> reader_lock(mutex_);
+  const auto key = std::make_tuple(quantized, max_points, range);
+  {
+    std::lock_guard<std::mutex> lock(encoded_clouds_mutex_);
+    auto iter = encoded_clouds_.find(key);
+    if (iter != encoded_clouds_.end()) {
+      *to_send = iter->second;
+      return;
+    }
+  }
+  if (points_.empty()) {
+    to_send->clear();
+    return;
+  }
+
+  const double resolution = FLAGS_point_cloud_quantization_resolution;
+  const float range_square = static_cast<float>(range) * range;
+  apollo::dreamview::PointCloud point_cloud_pb;
+  std::string quantized_num;
+  uint32_t num_points = 0;
+  for (size_t i = 0; i + 2 < points_.size(); i += 3) {
+    if (max_points > 0 && num_points >= max_points) {
+      break;
+    }
+    const float *point = &points_[i];
+    if (range > 0 && point[0] * point[0] + point[1] * point[1] > range_square) {
+      continue;
+    }
+    if (quantized) {
+      int64_t steps[3];
+      bool in_bounds = true;
+      for (int j = 0; j < 3; ++j) {
+        steps[j] = std::llround(point[j] / resolution);
+        in_bounds = in_bounds && std::abs(steps[j]) <=
+                                     std::numeric_limits<int16_t>::max();
+      }
+      if (!in_bounds) {
+        continue;
+      }
+      for (const int64_t step : steps) {
+        const uint16_t value =
+            static_cast<uint16_t>(static_cast<int16_t>(step));
+        quantized_num.push_back(static_cast<char>(value & 0xff));
+        quantized_num.push_back(static_cast<char>(value >> 8));
+      }
+    } else {
+      point_cloud_pb.add_num(point[0]);
+      point_cloud_pb.add_num(point[1]);
+      point_cloud_pb.add_num(point[2]);
+    }
+    ++num_points;
+  }
+  if (quantized) {
+    point_cloud_pb.set_resolution(resolution);
+    point_cloud_pb.set_quantized_num(std::move(quantized_num));
+  }
+  point_cloud_pb.SerializeToString(to_send);
+
+  std::lock_guard<std::mutex> lock(encoded_clouds_mutex_);
+  encoded_clouds_.emplace(key, *to_send);
+}
+
 void PointCloudUpdater::UpdateLocalizationTime(
     const std::shared_ptr<LocalizationEstimate> &localization) {
   last_localization_time_ = localization->header().timestamp_sec();
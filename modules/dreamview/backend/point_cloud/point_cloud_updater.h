@@ -20,8 +20,13 @@
 
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include "boost/thread/locks.hpp"
 #include "boost/thread/shared_mutex.hpp"
@@ -80,6 +85,18 @@ class PointCloudUpdater {
 
   void FilterPointCloud(pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr);
 
+  /**
+   * @brief Gets the latest point cloud as a client asked for it, encoding it
+   * only for the first client that asks with the same options.
+   * @param quantized whether to send the quantized points.
+   * @param max_points the most points to send, 0 for all of them.
+   * @param range the range in meters beyond which the points are culled, 0
+   * for no culling.
+   * @param to_send the PointCloud in wire format.
+   */
+  void GetPointCloud(bool quantized, uint32_t max_points, uint32_t range,
+                     std::string *to_send);
+
   void UpdateLocalizationTime(
       const std::shared_ptr<apollo::localization::LocalizationEstimate>
           &localization);
@@ -95,6 +112,15 @@ class PointCloudUpdater {
   // The PointCloud to be pushed to frontend.
   std::string point_cloud_str_;
 
+  // The x, y and z of the filtered points, ordered so that every prefix is
+  // spread over the whole cloud.
+  std::vector<float> points_;
+
+  // The latest point cloud encoded with the options of the clients, keyed
+  // by quantized, max points and range.
+  std::map<std::tuple<bool, uint32_t, uint32_t>, std::string> encoded_clouds_;
+  std::mutex encoded_clouds_mutex_;
+
   std::future<void> async_future_;
   std::atomic<bool> future_ready_;
 
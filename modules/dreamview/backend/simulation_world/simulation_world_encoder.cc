@@ -0,0 +1,162 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/dreamview/backend/simulation_world/simulation_world_encoder.h"
+
+#include <algorithm>
+
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/wire_format_lite.h"
+
+#include "cyber/common/log.h"
+#include "cyber/record/file/chunk_compressor.h"
+
+namespace apollo {
+namespace dreamview {
+
+using apollo::cyber::proto::COMPRESS_ZSTD;
+using apollo::cyber::record::CompressChunk;
+using apollo::cyber::record::DecompressChunk;
+using google::protobuf::internal::WireFormatLite;
+using google::protobuf::io::CodedInputStream;
+
+SimulationWorldEncoder::SimulationWorldEncoder(const size_t history_size)
+    : history_size_(std::max(history_size, static_cast<size_t>(1))) {}
+
+bool SimulationWorldEncoder::SplitFields(const std::string &data,
+                                         Fields *fields) {
+  fields->clear();
+  CodedInputStream input(reinterpret_cast<const uint8_t *>(data.data()),
+                         static_cast<int>(data.size()));
+  while (true) {
+    const int begin = input.CurrentPosition();
+    const uint32_t tag = input.ReadTag();
+    if (tag == 0) {
+      return static_cast<size_t>(begin) == data.size();
+    }
+    if (!WireFormatLite::SkipField(&input, tag)) {
+      return false;
+    }
+    // The records of a repeated or map field are serialized one after the
+    // other, so they are kept together.
+    (*fields)[WireFormatLite::GetTagFieldNumber(tag)].append(
+        data, begin, input.CurrentPosition() - begin);
+  }
+}
+
+bool SimulationWorldEncoder::AddFrame(const uint32_t sequence_num,
+                                      const std::string &frame) {
+  Frame new_frame;
+  new_frame.sequence_num = sequence_num;
+  if (!SplitFields(frame, &new_frame.fields)) {
+    AERROR << "Failed to split the fields of SimulationWorld frame "
+           << sequence_num;
+    return false;
+  }
+  frames_.push_back(std::move(new_frame));
+  while (frames_.size() > history_size_) {
+    frames_.pop_front();
+  }
+  return true;
+}
+
+bool SimulationWorldEncoder::Encode(const uint32_t base_sequence_num,
+                                    const bool compress,
+                                    std::string *delta) const {
+  if (frames_.empty()) {
+    return false;
+  }
+  const Frame &latest = frames_.back();
+  const Frame *base = nullptr;
+  if (base_sequence_num != 0) {
+    for (const Frame &frame : frames_) {
+      if (frame.sequence_num == base_sequence_num) {
+        base = &frame;
+        break;
+      }
+    }
+  }
+
+  SimulationWorldDelta world_delta;
+  world_delta.set_sequence_num(latest.sequence_num);
+  std::string fields;
+  if (base != nullptr) {
+    world_delta.set_base_sequence_num(base->sequence_num);
+  }
+  for (const auto &field : latest.fields) {
+    if (base != nullptr) {
+      const auto it = base->fields.find(field.first);
+      if (it != base->fields.end() && it->second == field.second) {
+        world_delta.add_unchanged_field(field.first);
+        continue;
+      }
+    }
+    fields.append(field.second);
+  }
+
+  if (compress) {
+    if (!CompressChunk(COMPRESS_ZSTD, fields,
+                       world_delta.mutable_fields())) {
+      AERROR << "Failed to compress SimulationWorld frame "
+             << latest.sequence_num;
+      return false;
+    }
+    world_delta.set_compressed(true);
+  } else {
+    world_delta.set_fields(std::move(fields));
+  }
+  return world_delta.SerializeToString(delta);
+}
+
+bool SimulationWorldEncoder::Decode(const SimulationWorldDelta &delta,
+                                    const std::string &base,
+                                    std::string *frame) {
+  std::string data;
+  if (delta.compressed()) {
+    if (!DecompressChunk(COMPRESS_ZSTD, delta.fields().data(),
+                         delta.fields().size(), &data)) {
+      return false;
+    }
+  } else {
+    data = delta.fields();
+  }
+  if (delta.base_sequence_num() == 0) {
+    *frame = std::move(data);
+    return true;
+  }
+
+  Fields fields;
+  Fields base_fields;
+  if (!SplitFields(data, &fields) || !SplitFields(base, &base_fields)) {
+    return false;
+  }
+  for (const uint32_t number : delta.unchanged_field()) {
+    const auto it = base_fields.find(number);
+    if (it == base_fields.end()) {
+      return false;
+    }
+    fields[number] = it->second;
+  }
+  frame->clear();
+  for (const auto &field : fields) {
+    frame->append(field.second);
+  }
+  return true;
+}
+
+}  // namespace dreamview
+}  // namespace apollo
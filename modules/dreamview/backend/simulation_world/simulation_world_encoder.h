@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+
+#include "modules/dreamview/proto/simulation_world.pb.h"
+
+/**
+ * @namespace apollo::dreamview
+ * @brief apollo::dreamview
+ */
+namespace apollo {
+namespace dreamview {
+
+/**
+ * @class SimulationWorldEncoder
+ * @brief Keeps the recent SimulationWorld frames in wire format and encodes
+ * the latest one as a SimulationWorldDelta against the frame a client acked,
+ * so that the top level fields which did not change are not sent again.
+ */
+class SimulationWorldEncoder {
+ public:
+  /**
+   * @brief Constructor.
+   * @param history_size the number of recent frames kept as delta bases.
+   */
+  explicit SimulationWorldEncoder(size_t history_size);
+
+  /**
+   * @brief Adds a new latest frame.
+   * @param sequence_num the sequence number of the frame, larger than 0.
+   * @param frame the SimulationWorld in wire format.
+   * @return False if the frame is not a valid wire format message.
+   */
+  bool AddFrame(uint32_t sequence_num, const std::string &frame);
+
+  /**
+   * @brief Encodes the latest frame against a base frame.
+   * @param base_sequence_num the last frame acked by the client, the frame is
+   * encoded in full if it is 0 or no longer kept.
+   * @param compress whether to compress the fields.
+   * @param delta the SimulationWorldDelta in wire format.
+   * @return False if there is no frame yet or the compression failed.
+   */
+  bool Encode(uint32_t base_sequence_num, bool compress,
+              std::string *delta) const;
+
+  /**
+   * @brief Decodes a SimulationWorldDelta, as a client does.
+   * @param delta the SimulationWorldDelta.
+   * @param base the base frame in wire format, unused for a full frame.
+   * @param frame the decoded SimulationWorld in wire format.
+   * @return False if the delta or the base is malformed.
+   */
+  static bool Decode(const SimulationWorldDelta &delta,
+                     const std::string &base, std::string *frame);
+
+  uint32_t latest_sequence_num() const {
+    return frames_.empty() ? 0 : frames_.back().sequence_num;
+  }
+
+ private:
+  // The bytes of each top level field, keyed by field number.
+  using Fields = std::map<uint32_t, std::string>;
+
+  struct Frame {
+    uint32_t sequence_num = 0;
+    Fields fields;
+  };
+
+  static bool SplitFields(const std::string &data, Fields *fields);
+
+  const size_t history_size_;
+  std::deque<Frame> frames_;
+};
+
+}  // namespace dreamview
+}  // namespace apollo
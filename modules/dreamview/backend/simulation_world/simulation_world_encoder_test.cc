@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/dreamview/backend/simulation_world/simulation_world_encoder.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace dreamview {
+
+class SimulationWorldEncoderTest : public ::testing::Test {
+ protected:
+  static std::string MakeFrame(const uint32_t sequence_num,
+                               const double obstacle_x) {
+    SimulationWorld world;
+    world.set_sequence_num(sequence_num);
+    auto *object = world.add_object();
+    object->set_id("obstacle");
+    object->set_position_x(obstacle_x);
+    world.add_object()->set_id("pedestrian");
+    auto *route_path = world.add_route_path();
+    route_path->add_point()->set_x(1.0);
+    route_path->add_point()->set_x(2.0);
+    world.mutable_map_element_ids()->add_lane("lane_1");
+    (*world.mutable_latency())["planning"].set_total_time_ms(10.0);
+    std::string frame;
+    world.SerializeToString(&frame);
+    return frame;
+  }
+
+  static std::string Decode(const std::string &encoded,
+                            const std::string &base,
+                            SimulationWorldDelta *delta) {
+    EXPECT_TRUE(delta->ParseFromString(encoded));
+    std::string frame;
+    EXPECT_TRUE(SimulationWorldEncoder::Decode(*delta, base, &frame));
+    return frame;
+  }
+};
+
+TEST_F(SimulationWorldEncoderTest, FullFrame) {
+  SimulationWorldEncoder encoder(3);
+  std::string encoded;
+  EXPECT_FALSE(encoder.Encode(0, false, &encoded));
+
+  const std::string frame = MakeFrame(5, 1.0);
+  ASSERT_TRUE(encoder.AddFrame(1, frame));
+  EXPECT_FALSE(encoder.AddFrame(2, "\xff\xff"));
+  EXPECT_EQ(1, encoder.latest_sequence_num());
+  ASSERT_TRUE(encoder.Encode(0, false, &encoded));
+
+  SimulationWorldDelta delta;
+  EXPECT_EQ(frame, Decode(encoded, "", &delta));
+  EXPECT_EQ(1, delta.sequence_num());
+  EXPECT_EQ(0, delta.base_sequence_num());
+  EXPECT_EQ(0, delta.unchanged_field_size());
+}
+
+TEST_F(SimulationWorldEncoderTest, Delta) {
+  SimulationWorldEncoder encoder(2);
+  const std::string frame_1 = MakeFrame(5, 1.0);
+  const std::string frame_2 = MakeFrame(5, 2.0);
+  const std::string frame_3 = MakeFrame(6, 3.0);
+  ASSERT_TRUE(encoder.AddFrame(1, frame_1));
+  ASSERT_TRUE(encoder.AddFrame(2, frame_2));
+
+  std::string encoded;
+  ASSERT_TRUE(encoder.Encode(1, false, &encoded));
+  SimulationWorldDelta delta;
+  EXPECT_EQ(frame_2, Decode(encoded, frame_1, &delta));
+  EXPECT_EQ(2, delta.sequence_num());
+  EXPECT_EQ(1, delta.base_sequence_num());
+  // Only the objects changed.
+  EXPECT_EQ(4, delta.unchanged_field_size());
+  EXPECT_LT(delta.fields().size(), frame_2.size());
+
+  // The first frame is no longer kept once the third is added.
+  ASSERT_TRUE(encoder.AddFrame(3, frame_3));
+  ASSERT_TRUE(encoder.Encode(1, false, &encoded));
+  EXPECT_EQ(frame_3, Decode(encoded, "", &delta));
+  EXPECT_EQ(0, delta.base_sequence_num());
+
+  ASSERT_TRUE(encoder.Encode(2, false, &encoded));
+  EXPECT_EQ(frame_3, Decode(encoded, frame_2, &delta));
+  EXPECT_EQ(3, delta.unchanged_field_size());
+}
+
+}  // namespace dreamview
+}  // namespace apollo
@@ -45,7 +45,9 @@ SimulationWorldUpdater::SimulationWorldUpdater(WebSocketHandler *websocket,
       map_service_(map_service),
       websocket_(websocket),
       map_ws_(map_ws),
-      sim_control_(sim_control) {
+      sim_control_(sim_control),
+      encoder_(FLAGS_sim_world_delta_history_size),
+      encoder_with_planning_data_(FLAGS_sim_world_delta_history_size) {
   RegisterMessageHandlers();
 }
 
@@ -78,6 +80,36 @@ void SimulationWorldUpdater::RegisterMessageHandlers() {
         }
       });
 
+  map_ws_->RegisterMessageHandler(
+      "RetrieveMapTiles",
+      [this](const Json &json, WebSocketHandler::Connection *conn) {
+        // Each tile is {"x": int, "y": int, "version": the version of the
+        // tile the client has, if any}.
+        auto tiles = json.find("tiles");
+        if (tiles == json.end() || !tiles->is_array()) {
+          AERROR << "Cannot retrieve map tiles without a tile list.";
+          return;
+        }
+        for (const auto &tile : *tiles) {
+          auto x = tile.find("x");
+          auto y = tile.find("y");
+          if (x == tile.end() || y == tile.end() || !x->is_number_integer() ||
+              !y->is_number_integer()) {
+            AERROR << "Expect integer tile indices, but was " << tile;
+            continue;
+          }
+          uint64_t known_version = 0;
+          auto version = tile.find("version");
+          if (version != tile.end() && version->is_number_unsigned()) {
+            known_version = version->get<uint64_t>();
+          }
+          std::string to_send;
+          map_service_->GetMapTile(x->get<int>(), y->get<int>(), known_version,
+                                   &to_send);
+          map_ws_->SendBinaryData(conn, to_send);
+        }
+      });
+
   map_ws_->RegisterMessageHandler(
       "RetrieveRelativeMapData",
       [this](const Json &json, WebSocketHandler::Connection *conn) {
@@ -168,13 +200,33 @@ void SimulationWorldUpdater::RegisterMessageHandlers() {
         if (planning != json.end() && planning->is_boolean()) {
           enable_pnc_monitor = json["planning"];
         }
+        // A client that acks the last frame it decoded with deltaBase gets a
+        // SimulationWorldDelta against that frame instead of the full frame.
+        auto delta_base = json.find("deltaBase");
+        const bool send_delta =
+            delta_base != json.end() && delta_base->is_number_unsigned();
+        bool compress = false;
+        auto compress_iter = json.find("compress");
+        if (compress_iter != json.end() && compress_iter->is_boolean()) {
+          compress = *compress_iter;
+        }
         std::string to_send;
         {
           // Pay the price to copy the data instead of sending data over the
           // wire while holding the lock.
           boost::shared_lock<boost::shared_mutex> reader_lock(mutex_);
-          to_send = enable_pnc_monitor ? simulation_world_with_planning_data_
-                                       : simulation_world_;
+          if (send_delta) {
+            const SimulationWorldEncoder &encoder =
+                enable_pnc_monitor ? encoder_with_planning_data_ : encoder_;
+            if (!encoder.Encode(delta_base->get<uint32_t>(), compress,
+                                &to_send)) {
+              return;
+            }
+          } else {
+            to_send = enable_pnc_monitor
+                          ? simulation_world_with_planning_data_
+                          : simulation_world_;
+          }
         }
         if (FLAGS_enable_update_size_check && !enable_pnc_monitor &&
             to_send.size() > FLAGS_max_update_size) {
@@ -378,6 +430,12 @@ void SimulationWorldUpdater::OnTimer() {
     sim_world_service_.GetWireFormatString(
         FLAGS_sim_map_radius, &simulation_world_,
         &simulation_world_with_planning_data_);
+    if (++frame_sequence_num_ == 0) {
+      frame_sequence_num_ = 1;
+    }
+    encoder_.AddFrame(frame_sequence_num_, simulation_world_);
+    encoder_with_planning_data_.AddFrame(frame_sequence_num_,
+                                         simulation_world_with_planning_data_);
     sim_world_service_.GetRelativeMap().SerializeToString(
         &relative_map_string_);
   }
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -33,6 +34,7 @@
 #include "modules/dreamview/backend/handlers/websocket_handler.h"
 #include "modules/dreamview/backend/map/map_service.h"
 #include "modules/dreamview/backend/sim_control/sim_control.h"
+#include "modules/dreamview/backend/simulation_world/simulation_world_encoder.h"
 #include "modules/dreamview/backend/simulation_world/simulation_world_service.h"
 #include "modules/routing/proto/poi.pb.h"
 
@@ -145,6 +147,12 @@ class SimulationWorldUpdater {
   std::string simulation_world_;
   std::string simulation_world_with_planning_data_;
 
+  // The recent frames of both, to send deltas against the frame a client
+  // acked, and the sequence number of the latest frame.
+  SimulationWorldEncoder encoder_;
+  SimulationWorldEncoder encoder_with_planning_data_;
+  uint32_t frame_sequence_num_ = 0;
+
   // Received relative map data in wire format.
   std::string relative_map_string_;
 
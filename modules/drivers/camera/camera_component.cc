@@ -50,12 +50,17 @@ bool CameraComponent::Init() {
     return false;
   }
   raw_image_->is_new = 0;
-  // free memory in this struct desturctor
-  raw_image_->image =
-      reinterpret_cast<char*>(calloc(raw_image_->image_size, sizeof(char)));
-  if (raw_image_->image == nullptr) {
-    AERROR << "system calloc memory error, size:" << raw_image_->image_size;
-    return false;
+  raw_image_->image = nullptr;
+  zero_copy_ = camera_config_->zero_copy();
+  // with zero copy the frame is written into the data of the pb image
+  if (!zero_copy_) {
+    // free memory in this struct desturctor
+    raw_image_->image =
+        reinterpret_cast<char*>(calloc(raw_image_->image_size, sizeof(char)));
+    if (raw_image_->image == nullptr) {
+      AERROR << "system calloc memory error, size:" << raw_image_->image_size;
+      return false;
+    }
   }
 
   for (int i = 0; i < buffer_size_; ++i) {
@@ -63,7 +68,11 @@ bool CameraComponent::Init() {
     pb_image->mutable_header()->set_frame_id(camera_config_->frame_id());
     pb_image->set_width(raw_image_->width);
     pb_image->set_height(raw_image_->height);
-    pb_image->mutable_data()->reserve(raw_image_->image_size);
+    if (zero_copy_) {
+      pb_image->mutable_data()->resize(raw_image_->image_size);
+    } else {
+      pb_image->mutable_data()->reserve(raw_image_->image_size);
+    }
 
     if (camera_config_->output_type() == YUYV) {
       pb_image->set_encoding("yuyv");
@@ -90,20 +99,32 @@ void CameraComponent::run() {
       continue;
     }
 
-    if (!camera_device_->poll(raw_image_)) {
+    if (index_ >= buffer_size_) {
+      index_ = 0;
+    }
+    auto pb_image = pb_image_buffer_.at(index_);
+    if (zero_copy_) {
+      // the device buffer is converted straight into the pb image, which
+      // keeps its size from Init, and the image is not owned by raw_image_
+      raw_image_->image = &(*pb_image->mutable_data())[0];
+    }
+    const bool polled = camera_device_->poll(raw_image_);
+    if (zero_copy_) {
+      raw_image_->image = nullptr;
+    }
+    if (!polled) {
       AERROR << "camera device poll failed";
       continue;
     }
+    ++index_;
 
     cyber::Time image_time(raw_image_->tv_sec, 1000 * raw_image_->tv_usec);
-    if (index_ >= buffer_size_) {
-      index_ = 0;
-    }
-    auto pb_image = pb_image_buffer_.at(index_++);
     pb_image->mutable_header()->set_timestamp_sec(
         cyber::Time::Now().ToSecond());
     pb_image->set_measurement_time(image_time.ToSecond());
-    pb_image->set_data(raw_image_->image, raw_image_->image_size);
+    if (!zero_copy_) {
+      pb_image->set_data(raw_image_->image, raw_image_->image_size);
+    }
     writer_->Write(pb_image);
 
     cyber::SleepFor(std::chrono::microseconds(spin_rate_));
@@ -16,6 +16,7 @@
 
 #include "modules/drivers/camera/compress_component.h"
 
+#include <algorithm>
 #include <exception>
 #include <vector>
 
@@ -44,6 +45,13 @@ bool CompressComponent::Init() {
 
   writer_ = node_->CreateWriter<CompressedImage>(
       config_.compress_conf().output_channel());
+  encoder_ = CreateJpegEncoder(config_.compress_conf().encoder());
+  if (!config_.compress_conf().preview_channel().empty()) {
+    preview_writer_ = node_->CreateWriter<CompressedImage>(
+        config_.compress_conf().preview_channel());
+    // previews are small, the cpu encodes them without a device round trip
+    preview_encoder_.reset(new OpenCVJpegEncoder());
+  }
   return true;
 }
 
@@ -55,30 +63,54 @@ bool CompressComponent::Proc(const std::shared_ptr<Image>& image) {
   compressed_image->set_measurement_time(image->measurement_time());
   compressed_image->set_format(image->encoding() + "; jpeg compressed bgr8");
 
-  std::vector<int> params;
-  params.resize(3, 0);
-  params[0] = CV_IMWRITE_JPEG_QUALITY;
-  params[1] = 95;
-
   try {
-    cv::Mat mat_image(image->height(), image->width(), CV_8UC3,
-                      const_cast<char*>(image->data().data()), image->step());
-    cv::Mat tmp_mat;
-    cv::cvtColor(mat_image, tmp_mat, cv::COLOR_RGB2BGR);
-    std::vector<uint8_t> compress_buffer;
-    if (!cv::imencode(".jpg", tmp_mat, compress_buffer, params)) {
-      AERROR << "cv::imencode (jpeg) failed on input image";
+    if (!encoder_->Encode(
+            reinterpret_cast<const uint8_t*>(image->data().data()),
+            image->width(), image->height(), image->step(),
+            config_.compress_conf().jpeg_quality(), &compress_buffer_)) {
       return false;
     }
-    compressed_image->set_data(compress_buffer.data(), compress_buffer.size());
+    compressed_image->set_data(compress_buffer_.data(),
+                               compress_buffer_.size());
     writer_->Write(compressed_image);
+    if (preview_writer_ != nullptr) {
+      WritePreview(image);
+    }
   } catch(std::exception &e) {
-    AERROR << "cv::imencode (jpeg) exception :" << e.what();
+    AERROR << "jpeg encoding exception :" << e.what();
     return false;
   }
   return true;
 }
 
+void CompressComponent::WritePreview(const std::shared_ptr<Image>& image) {
+  const int width = std::min(
+      static_cast<int>(config_.compress_conf().preview_width()),
+      static_cast<int>(image->width()));
+  if (width <= 0) {
+    return;
+  }
+  const int height = static_cast<int>(
+      static_cast<int64_t>(image->height()) * width / image->width());
+  cv::Mat mat_image(image->height(), image->width(), CV_8UC3,
+                    const_cast<char*>(image->data().data()), image->step());
+  cv::resize(mat_image, preview_, cv::Size(width, height), 0, 0,
+             cv::INTER_AREA);
+  if (!preview_encoder_->Encode(preview_.data, preview_.cols, preview_.rows,
+                                static_cast<int>(preview_.step),
+                                config_.compress_conf().preview_jpeg_quality(),
+                                &compress_buffer_)) {
+    return;
+  }
+  auto preview = std::make_shared<CompressedImage>();
+  preview->mutable_header()->CopyFrom(image->header());
+  preview->set_frame_id(image->frame_id());
+  preview->set_measurement_time(image->measurement_time());
+  preview->set_format(image->encoding() + "; jpeg compressed bgr8");
+  preview->set_data(compress_buffer_.data(), compress_buffer_.size());
+  preview_writer_->Write(preview);
+}
+
 }  // namespace camera
 }  // namespace drivers
 }  // namespace apollo
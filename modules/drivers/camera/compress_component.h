@@ -17,9 +17,13 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+
+#include "opencv2/core/core.hpp"
 
 #include "cyber/base/concurrent_object_pool.h"
 #include "cyber/cyber.h"
+#include "modules/drivers/camera/jpeg_encoder.h"
 #include "modules/drivers/camera/proto/config.pb.h"
 #include "modules/drivers/proto/sensor_image.pb.h"
 
@@ -39,8 +43,15 @@ class CompressComponent : public Component<Image> {
   bool Proc(const std::shared_ptr<Image>& image) override;
 
  private:
+  void WritePreview(const std::shared_ptr<Image>& image);
+
   std::shared_ptr<CCObjectPool<CompressedImage>> image_pool_;
   std::shared_ptr<Writer<CompressedImage>> writer_ = nullptr;
+  std::shared_ptr<Writer<CompressedImage>> preview_writer_ = nullptr;
+  std::unique_ptr<JpegEncoder> encoder_;
+  std::unique_ptr<JpegEncoder> preview_encoder_;
+  std::vector<uint8_t> compress_buffer_;
+  cv::Mat preview_;
   Config config_;
 };
 
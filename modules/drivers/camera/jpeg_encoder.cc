@@ -0,0 +1,63 @@
+/******************************************************************************
+ * Copyright 2017 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/drivers/camera/jpeg_encoder.h"
+
+#include "opencv2/highgui/highgui.hpp"
+#include "opencv2/imgproc/imgproc.hpp"
+
+#include "cyber/common/log.h"
+#if USE_NVJPEG
+#include "modules/drivers/camera/nvjpeg_encoder.h"
+#endif
+
+namespace apollo {
+namespace drivers {
+namespace camera {
+
+using apollo::drivers::camera::config::NVJPEG;
+
+bool OpenCVJpegEncoder::Encode(const uint8_t* rgb, const int width,
+                               const int height, const int step,
+                               const int quality, std::vector<uint8_t>* jpeg) {
+  const std::vector<int> params = {CV_IMWRITE_JPEG_QUALITY, quality};
+  cv::Mat mat_image(height, width, CV_8UC3, const_cast<uint8_t*>(rgb), step);
+  cv::cvtColor(mat_image, bgr_, cv::COLOR_RGB2BGR);
+  if (!cv::imencode(".jpg", bgr_, *jpeg, params)) {
+    AERROR << "cv::imencode (jpeg) failed on input image";
+    return false;
+  }
+  return true;
+}
+
+std::unique_ptr<JpegEncoder> CreateJpegEncoder(const JpegEncoderType type) {
+  if (type == NVJPEG) {
+#if USE_NVJPEG
+    std::unique_ptr<JpegEncoder> encoder(new NvJpegEncoder());
+    if (encoder->Init()) {
+      return encoder;
+    }
+    AWARN << "NVJPEG encoder init failed, fall back to OpenCV";
+#else
+    AWARN << "Built without NVJPEG, fall back to OpenCV";
+#endif
+  }
+  return std::unique_ptr<JpegEncoder>(new OpenCVJpegEncoder());
+}
+
+}  // namespace camera
+}  // namespace drivers
+}  // namespace apollo
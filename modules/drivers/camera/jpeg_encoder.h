@@ -0,0 +1,75 @@
+/******************************************************************************
+ * Copyright 2017 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "opencv2/core/core.hpp"
+
+#include "modules/drivers/camera/proto/config.pb.h"
+
+namespace apollo {
+namespace drivers {
+namespace camera {
+
+using apollo::drivers::camera::config::JpegEncoderType;
+
+/**
+ * @class JpegEncoder
+ *
+ * @brief compresses packed rgb8 frames into jpeg. An encoder keeps its
+ *   buffers between frames and is used by one thread at a time.
+ */
+class JpegEncoder {
+ public:
+  virtual ~JpegEncoder() = default;
+
+  virtual bool Init() { return true; }
+
+  /**
+   * @brief encode a packed rgb8 image of step bytes per row
+   * @param quality the jpeg quality in [1, 100]
+   */
+  virtual bool Encode(const uint8_t* rgb, const int width, const int height,
+                      const int step, const int quality,
+                      std::vector<uint8_t>* jpeg) = 0;
+};
+
+/**
+ * @brief encodes on the cpu with cv::imencode
+ */
+class OpenCVJpegEncoder : public JpegEncoder {
+ public:
+  bool Encode(const uint8_t* rgb, const int width, const int height,
+              const int step, const int quality,
+              std::vector<uint8_t>* jpeg) override;
+
+ private:
+  cv::Mat bgr_;
+};
+
+/**
+ * @brief create and initialize an encoder of the given type, falling back to
+ *   the OpenCV encoder if the type is not built in or fails to initialize
+ */
+std::unique_ptr<JpegEncoder> CreateJpegEncoder(const JpegEncoderType type);
+
+}  // namespace camera
+}  // namespace drivers
+}  // namespace apollo
@@ -0,0 +1,130 @@
+/******************************************************************************
+ * Copyright 2017 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/drivers/camera/nvjpeg_encoder.h"
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace drivers {
+namespace camera {
+
+NvJpegEncoder::~NvJpegEncoder() {
+  if (device_buffer_ != nullptr) {
+    cudaFree(device_buffer_);
+  }
+  if (params_ != nullptr) {
+    nvjpegEncoderParamsDestroy(params_);
+  }
+  if (state_ != nullptr) {
+    nvjpegEncoderStateDestroy(state_);
+  }
+  if (handle_ != nullptr) {
+    nvjpegDestroy(handle_);
+  }
+  if (stream_ != nullptr) {
+    cudaStreamDestroy(stream_);
+  }
+}
+
+bool NvJpegEncoder::Init() {
+  if (cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking) !=
+      cudaSuccess) {
+    AERROR << "cudaStreamCreate failed";
+    return false;
+  }
+  if (nvjpegCreateSimple(&handle_) != NVJPEG_STATUS_SUCCESS ||
+      nvjpegEncoderStateCreate(handle_, &state_, stream_) !=
+          NVJPEG_STATUS_SUCCESS ||
+      nvjpegEncoderParamsCreate(handle_, &params_, stream_) !=
+          NVJPEG_STATUS_SUCCESS ||
+      nvjpegEncoderParamsSetSamplingFactors(params_, NVJPEG_CSS_420,
+                                            stream_) !=
+          NVJPEG_STATUS_SUCCESS) {
+    AERROR << "NVJPEG encoder creation failed";
+    return false;
+  }
+  return true;
+}
+
+bool NvJpegEncoder::ReserveDeviceBuffer(const size_t size) {
+  if (size <= device_buffer_size_) {
+    return true;
+  }
+  if (device_buffer_ != nullptr) {
+    cudaFree(device_buffer_);
+    device_buffer_ = nullptr;
+    device_buffer_size_ = 0;
+  }
+  if (cudaMalloc(reinterpret_cast<void**>(&device_buffer_), size) !=
+      cudaSuccess) {
+    AERROR << "cudaMalloc of " << size << " bytes failed";
+    return false;
+  }
+  device_buffer_size_ = size;
+  return true;
+}
+
+bool NvJpegEncoder::Encode(const uint8_t* rgb, const int width,
+                           const int height, const int step,
+                           const int quality, std::vector<uint8_t>* jpeg) {
+  const size_t pitch = static_cast<size_t>(width) * 3;
+  if (!ReserveDeviceBuffer(pitch * height)) {
+    return false;
+  }
+  if (quality != quality_) {
+    if (nvjpegEncoderParamsSetQuality(params_, quality, stream_) !=
+        NVJPEG_STATUS_SUCCESS) {
+      AERROR << "NVJPEG invalid quality " << quality;
+      return false;
+    }
+    quality_ = quality;
+  }
+  if (cudaMemcpy2DAsync(device_buffer_, pitch, rgb, step, pitch, height,
+                        cudaMemcpyHostToDevice, stream_) != cudaSuccess) {
+    AERROR << "cudaMemcpy2DAsync failed";
+    return false;
+  }
+
+  nvjpegImage_t image = {};
+  image.channel[0] = device_buffer_;
+  image.pitch[0] = pitch;
+  if (nvjpegEncodeImage(handle_, state_, params_, &image, NVJPEG_INPUT_RGBI,
+                        width, height, stream_) != NVJPEG_STATUS_SUCCESS) {
+    AERROR << "nvjpegEncodeImage failed";
+    return false;
+  }
+  size_t length = 0;
+  if (nvjpegEncodeRetrieveBitstream(handle_, state_, nullptr, &length,
+                                    stream_) != NVJPEG_STATUS_SUCCESS ||
+      cudaStreamSynchronize(stream_) != cudaSuccess) {
+    AERROR << "nvjpegEncodeRetrieveBitstream failed";
+    return false;
+  }
+  jpeg->resize(length);
+  if (nvjpegEncodeRetrieveBitstream(handle_, state_, jpeg->data(), &length,
+                                    stream_) != NVJPEG_STATUS_SUCCESS ||
+      cudaStreamSynchronize(stream_) != cudaSuccess) {
+    AERROR << "nvjpegEncodeRetrieveBitstream failed";
+    return false;
+  }
+  jpeg->resize(length);
+  return true;
+}
+
+}  // namespace camera
+}  // namespace drivers
+}  // namespace apollo
@@ -0,0 +1,60 @@
+/******************************************************************************
+ * Copyright 2017 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cuda_runtime_api.h>
+#include <nvjpeg.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "modules/drivers/camera/jpeg_encoder.h"
+
+namespace apollo {
+namespace drivers {
+namespace camera {
+
+/**
+ * @brief encodes on the gpu with NVJPEG. The device frame buffer, the cuda
+ *   stream and the encoder state are created once and reused by every
+ *   frame; the rgb input needs no color conversion.
+ */
+class NvJpegEncoder : public JpegEncoder {
+ public:
+  ~NvJpegEncoder();
+
+  bool Init() override;
+
+  bool Encode(const uint8_t* rgb, const int width, const int height,
+              const int step, const int quality,
+              std::vector<uint8_t>* jpeg) override;
+
+ private:
+  bool ReserveDeviceBuffer(const size_t size);
+
+  nvjpegHandle_t handle_ = nullptr;
+  nvjpegEncoderState_t state_ = nullptr;
+  nvjpegEncoderParams_t params_ = nullptr;
+  cudaStream_t stream_ = nullptr;
+  uint8_t* device_buffer_ = nullptr;
+  size_t device_buffer_size_ = 0;
+  int quality_ = -1;
+};
+
+}  // namespace camera
+}  // namespace drivers
+}  // namespace apollo
@@ -34,6 +34,7 @@
  *
  *********************************************************************/
 
+#include <algorithm>
 #include <cmath>
 #include <string>
 
@@ -193,8 +194,6 @@ void UsbCam::mjpeg2rgb(char* mjpeg_buffer, int len, char* rgb_buffer,
 
 bool UsbCam::poll(const CameraImagePtr& raw_image) {
   raw_image->is_new = 0;
-  // free memory in this struct desturctor
-  memset(raw_image->image, 0, raw_image->image_size * sizeof(char));
 
   fd_set fds;
   struct timeval tv;
@@ -444,7 +443,7 @@ bool UsbCam::init_mmap(void) {
   struct v4l2_requestbuffers req;
   CLEAR(req);
 
-  req.count = 1;
+  req.count = std::max(config_->mmap_buffer_count(), 1u);
   req.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
   req.memory = V4L2_MEMORY_MMAP;
 
@@ -828,6 +827,7 @@ bool UsbCam::read_frame(CameraImagePtr raw_image) {
       if (len < raw_image->width * raw_image->height) {
         AERROR << "Wrong Buffer Len: " << len
                << ", dev: " << config_->camera_dev();
+        memset(raw_image->image, 0, raw_image->image_size * sizeof(char));
       } else {
         process_image(buffers_[buf.index].start, len, raw_image);
       }
@@ -30,6 +30,7 @@
 #include "cyber/common/log.h"
 #include "modules/common/proto/error_code.pb.h"
 #include "modules/drivers/canbus/common/byte.h"
+#include "modules/drivers/canbus/common/canbus_consts.h"
 #include "modules/drivers/canbus/proto/can_card_parameter.pb.h"
 
 /**
@@ -143,6 +144,12 @@ class CanClient {
     return Send(frames, &n);
   }
 
+  /**
+   * @brief Get the largest amount of messages one Send call can take.
+   * @return The amount of messages, 1 unless the client sends in batches.
+   */
+  virtual int32_t MaxSendFrameNum() const { return MAX_CAN_SEND_FRAME_LEN; }
+
   /**
    * @brief Receive messages
    * @param frames The messages to receive.
@@ -95,6 +95,13 @@ ErrorCode SocketCanClientRaw::Start() {
     return ErrorCode::CAN_CLIENT_ERROR_BASE;
   }
 
+  // 3. stamp received frames in the kernel, for the latency statistics.
+  ret = ::setsockopt(dev_handler_, SOL_SOCKET, SO_TIMESTAMP, &enable,
+                     sizeof(enable));
+  if (ret < 0) {
+    AWARN << "enable receive timestamp error code: " << ret;
+  }
+
   std::string can_name("can" + std::to_string(port_));
   std::strncpy(ifr.ifr_name, can_name.c_str(), IFNAMSIZ);
   if (ioctl(dev_handler_, SIOCGIFINDEX, &ifr) < 0) {
@@ -131,7 +138,7 @@ void SocketCanClientRaw::Stop() {
   }
 }
 
-// Synchronous transmission of CAN messages
+// Synchronous transmission of CAN messages, in one sendmmsg call
 ErrorCode SocketCanClientRaw::Send(const std::vector<CanFrame> &frames,
                                    int32_t *const frame_num) {
   CHECK_NOTNULL(frame_num);
@@ -141,7 +148,12 @@ ErrorCode SocketCanClientRaw::Send(const std::vector<CanFrame> &frames,
     AERROR << "Nvidia can client has not been initiated! Please init first!";
     return ErrorCode::CAN_CLIENT_ERROR_SEND_FAILED;
   }
-  for (size_t i = 0; i < frames.size() && i < MAX_CAN_SEND_FRAME_LEN; ++i) {
+  if (frames.size() > static_cast<size_t>(MAX_CAN_SEND_BATCH_LEN)) {
+    AERROR << "send can frame num [" << frames.size()
+           << "] is more than the batch length " << MAX_CAN_SEND_BATCH_LEN;
+    return ErrorCode::CAN_CLIENT_ERROR_FRAME_NUM;
+  }
+  for (size_t i = 0; i < frames.size(); ++i) {
     if (frames[i].len != CANBUS_MESSAGE_LENGTH) {
       AERROR << "frames[" << i << "].len = " << frames[i].len
              << ", which is not equal to can message data length ("
@@ -152,19 +164,30 @@ ErrorCode SocketCanClientRaw::Send(const std::vector<CanFrame> &frames,
     send_frames_[i].can_dlc = frames[i].len;
     std::memcpy(send_frames_[i].data, frames[i].data, frames[i].len);
 
-    // Synchronous transmission of CAN messages
-    int ret = static_cast<int>(
-        write(dev_handler_, &send_frames_[i], sizeof(send_frames_[i])));
+    send_iovecs_[i].iov_base = &send_frames_[i];
+    send_iovecs_[i].iov_len = sizeof(send_frames_[i]);
+    std::memset(&send_msgs_[i], 0, sizeof(send_msgs_[i]));
+    send_msgs_[i].msg_hdr.msg_iov = &send_iovecs_[i];
+    send_msgs_[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  // sendmmsg may stop early, e.g. when the tx queue is full
+  unsigned int sent = 0;
+  while (sent < frames.size()) {
+    int ret = sendmmsg(dev_handler_, &send_msgs_[sent],
+                       static_cast<unsigned int>(frames.size() - sent), 0);
     if (ret <= 0) {
       AERROR << "send message failed, error code: " << ret;
+      *frame_num = static_cast<int32_t>(sent);
       return ErrorCode::CAN_CLIENT_ERROR_BASE;
     }
+    sent += static_cast<unsigned int>(ret);
   }
 
   return ErrorCode::OK;
 }
 
-// buf size must be 8 bytes, every time, we receive only one frame
+// buf size must be 8 bytes, the queued frames come in one recvmmsg call
 ErrorCode SocketCanClientRaw::Receive(std::vector<CanFrame> *const frames,
                                       int32_t *const frame_num) {
   if (!is_started_) {
@@ -179,14 +202,26 @@ ErrorCode SocketCanClientRaw::Receive(std::vector<CanFrame> *const frames,
     return ErrorCode::CAN_CLIENT_ERROR_FRAME_NUM;
   }
 
-  for (int32_t i = 0; i < *frame_num && i < MAX_CAN_RECV_FRAME_LEN; ++i) {
-    CanFrame cf;
-    auto ret = read(dev_handler_, &recv_frames_[i], sizeof(recv_frames_[i]));
+  for (int32_t i = 0; i < *frame_num; ++i) {
+    recv_iovecs_[i].iov_base = &recv_frames_[i];
+    recv_iovecs_[i].iov_len = sizeof(recv_frames_[i]);
+    std::memset(&recv_msgs_[i], 0, sizeof(recv_msgs_[i]));
+    recv_msgs_[i].msg_hdr.msg_iov = &recv_iovecs_[i];
+    recv_msgs_[i].msg_hdr.msg_iovlen = 1;
+    recv_msgs_[i].msg_hdr.msg_control = recv_control_[i];
+    recv_msgs_[i].msg_hdr.msg_controllen = sizeof(recv_control_[i]);
+  }
 
-    if (ret < 0) {
-      AERROR << "receive message failed, error code: " << ret;
-      return ErrorCode::CAN_CLIENT_ERROR_BASE;
-    }
+  // block for the first frame only, then take what is already queued
+  int ret = recvmmsg(dev_handler_, recv_msgs_,
+                     static_cast<unsigned int>(*frame_num), MSG_WAITFORONE,
+                     nullptr);
+  if (ret < 0) {
+    AERROR << "receive message failed, error code: " << ret;
+    return ErrorCode::CAN_CLIENT_ERROR_BASE;
+  }
+
+  for (int32_t i = 0; i < ret; ++i) {
     if (recv_frames_[i].can_dlc != CANBUS_MESSAGE_LENGTH) {
       AERROR << "recv_frames_[" << i
              << "].can_dlc = " << recv_frames_[i].can_dlc
@@ -194,11 +229,20 @@ ErrorCode SocketCanClientRaw::Receive(std::vector<CanFrame> *const frames,
              << CANBUS_MESSAGE_LENGTH << ").";
       return ErrorCode::CAN_CLIENT_ERROR_RECV_FAILED;
     }
+    CanFrame cf;
     cf.id = recv_frames_[i].can_id;
     cf.len = recv_frames_[i].can_dlc;
     std::memcpy(cf.data, recv_frames_[i].data, recv_frames_[i].can_dlc);
+    msghdr *hdr = &recv_msgs_[i].msg_hdr;
+    for (cmsghdr *cmsg = CMSG_FIRSTHDR(hdr); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(hdr, cmsg)) {
+      if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMP) {
+        std::memcpy(&cf.timestamp, CMSG_DATA(cmsg), sizeof(cf.timestamp));
+      }
+    }
     frames->push_back(cf);
   }
+  *frame_num = ret;
   return ErrorCode::OK;
 }
 
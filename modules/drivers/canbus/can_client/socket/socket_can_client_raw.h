@@ -30,6 +30,7 @@
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 
 #include <linux/can.h>
 #include <linux/can/raw.h>
@@ -94,9 +95,18 @@ class SocketCanClientRaw : public CanClient {
                                  int32_t *const frame_num) override;
 
   /**
-   * @brief Receive messages
+   * @brief Get the largest amount of messages one Send call can take, they
+   *        are written with a single sendmmsg.
+   * @return The amount of messages.
+   */
+  int32_t MaxSendFrameNum() const override { return MAX_CAN_SEND_BATCH_LEN; }
+
+  /**
+   * @brief Receive messages, with a single recvmmsg that waits for the first
+   *        message and then takes the ones already queued.
    * @param frames The messages to receive.
-   * @param frame_num The amount of messages to receive.
+   * @param frame_num The amount of messages to receive, set to the amount
+   *        received.
    * @return The status of the receiving action which is defined by
    *         apollo::common::ErrorCode.
    */
@@ -112,8 +122,13 @@ class SocketCanClientRaw : public CanClient {
  private:
   int dev_handler_ = 0;
   CANCardParameter::CANChannelId port_;
-  can_frame send_frames_[MAX_CAN_SEND_FRAME_LEN];
+  can_frame send_frames_[MAX_CAN_SEND_BATCH_LEN];
   can_frame recv_frames_[MAX_CAN_RECV_FRAME_LEN];
+  iovec send_iovecs_[MAX_CAN_SEND_BATCH_LEN];
+  mmsghdr send_msgs_[MAX_CAN_SEND_BATCH_LEN];
+  iovec recv_iovecs_[MAX_CAN_RECV_FRAME_LEN];
+  mmsghdr recv_msgs_[MAX_CAN_RECV_FRAME_LEN];
+  char recv_control_[MAX_CAN_RECV_FRAME_LEN][CMSG_SPACE(sizeof(timeval))];
 };
 
 }  // namespace can
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ * @brief Defines the CanLatencyStats class.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * @namespace apollo::drivers::canbus
+ * @brief apollo::drivers::canbus
+ */
+namespace apollo {
+namespace drivers {
+namespace canbus {
+
+/**
+ * @class CanLatencyStats
+ * @brief Thread safe latency statistics in microseconds per CAN message id.
+ */
+class CanLatencyStats {
+ public:
+  struct Entry {
+    uint64_t count = 0;
+    int64_t last_us = 0;
+    int64_t max_us = 0;
+    int64_t total_us = 0;
+
+    int64_t mean_us() const {
+      return count == 0 ? 0 : total_us / static_cast<int64_t>(count);
+    }
+  };
+
+  /**
+   * @brief Add a latency sample of a message id.
+   * @param message_id The CAN message id.
+   * @param latency_us The latency in microseconds.
+   */
+  void Add(const uint32_t message_id, const int64_t latency_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry &entry = entries_[message_id];
+    ++entry.count;
+    entry.last_us = latency_us;
+    entry.max_us = entry.count == 1 ? latency_us
+                                    : std::max(entry.max_us, latency_us);
+    entry.total_us += latency_us;
+  }
+
+  /**
+   * @brief Get the statistics of a message id.
+   * @param message_id The CAN message id.
+   * @param entry The statistics, untouched if the id has no sample.
+   * @return If the id has samples.
+   */
+  bool Get(const uint32_t message_id, Entry *const entry) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find(message_id);
+    if (iter == entries_.end()) {
+      return false;
+    }
+    *entry = iter->second;
+    return true;
+  }
+
+  /**
+   * @brief Get the statistics of all message ids.
+   * @return A copy of the statistics keyed by message id.
+   */
+  std::unordered_map<uint32_t, Entry> entries() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<uint32_t, Entry> entries_;
+};
+
+}  // namespace canbus
+}  // namespace drivers
+}  // namespace apollo
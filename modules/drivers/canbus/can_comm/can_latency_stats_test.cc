@@ -0,0 +1,47 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/drivers/canbus/can_comm/can_latency_stats.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace drivers {
+namespace canbus {
+
+TEST(CanLatencyStatsTest, AddAndGet) {
+  CanLatencyStats stats;
+  CanLatencyStats::Entry entry;
+  EXPECT_FALSE(stats.Get(0x100, &entry));
+
+  stats.Add(0x100, 300);
+  stats.Add(0x100, -100);
+  stats.Add(0x200, 50);
+  EXPECT_TRUE(stats.Get(0x100, &entry));
+  EXPECT_EQ(2, entry.count);
+  EXPECT_EQ(-100, entry.last_us);
+  EXPECT_EQ(300, entry.max_us);
+  EXPECT_EQ(100, entry.mean_us());
+  EXPECT_EQ(2, stats.entries().size());
+
+  stats.Clear();
+  EXPECT_FALSE(stats.Get(0x200, &entry));
+}
+
+}  // namespace canbus
+}  // namespace drivers
+}  // namespace apollo
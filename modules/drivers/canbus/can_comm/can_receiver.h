@@ -36,6 +36,7 @@
 #include "modules/common/proto/error_code.pb.h"
 
 #include "modules/drivers/canbus/can_client/can_client.h"
+#include "modules/drivers/canbus/can_comm/can_latency_stats.h"
 #include "modules/drivers/canbus/can_comm/message_manager.h"
 #include "modules/drivers/canbus/common/canbus_consts.h"
 
@@ -94,6 +95,13 @@ class CanReceiver {
    */
   void Stop();
 
+  /**
+   * @brief Get the latency from the driver receive time of the messages,
+   *        for clients stamping the frames, to their parsing, per message id.
+   * @return The latency statistics.
+   */
+  const CanLatencyStats &latency_stats() const;
+
  private:
   void RecvThreadFunc();
 
@@ -107,6 +115,7 @@ class CanReceiver {
   bool enable_log_ = false;
   bool is_init_ = false;
   std::future<void> async_result_;
+  CanLatencyStats latency_stats_;
 
   DISALLOW_COPY_AND_ASSIGN(CanReceiver);
 };
@@ -174,6 +183,12 @@ void CanReceiver<SensorType>::RecvThreadFunc() {
       uint32_t uid = frame.id;
       const uint8_t *data = frame.data;
       pt_manager_->Parse(uid, data, len);
+      if (frame.timestamp.tv_sec != 0) {
+        const int64_t now_us =
+            static_cast<int64_t>(cyber::Time::Now().ToNanosecond() / 1000);
+        latency_stats_.Add(uid, now_us - frame.timestamp.tv_sec * 1000000 -
+                                    frame.timestamp.tv_usec);
+      }
       if (enable_log_) {
         ADEBUG << "recv_can_frame#" << frame.CanFrameString();
       }
@@ -199,6 +214,11 @@ template <typename SensorType>
   return ::apollo::common::ErrorCode::OK;
 }
 
+template <typename SensorType>
+const CanLatencyStats &CanReceiver<SensorType>::latency_stats() const {
+  return latency_stats_;
+}
+
 template <typename SensorType>
 void CanReceiver<SensorType>::Stop() {
   if (IsRunning()) {
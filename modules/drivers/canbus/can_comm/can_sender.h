@@ -37,6 +37,7 @@
 #include "modules/common/proto/error_code.pb.h"
 #include "modules/common/time/time.h"
 #include "modules/drivers/canbus/can_client/can_client.h"
+#include "modules/drivers/canbus/can_comm/can_latency_stats.h"
 #include "modules/drivers/canbus/can_comm/protocol_data.h"
 
 /**
@@ -111,12 +112,21 @@ class SenderMessage {
    */
   int32_t curr_period() const;
 
+  /**
+   * @brief Record that the message is sent.
+   * @param send_time The time of the sending in microseconds.
+   * @return How much later than its period the message is sent since the
+   *         last sending, in microseconds. The first sending is never late.
+   */
+  int64_t RecordSend(const int64_t send_time);
+
  private:
   uint32_t message_id_ = 0;
   ProtocolData<SensorType> *protocol_data_ = nullptr;
 
   int32_t period_ = 0;
   int32_t curr_period_ = 0;
+  int64_t last_send_time_ = 0;
 
  private:
   static std::mutex mutex_;
@@ -184,11 +194,21 @@ class CanSender {
   bool IsRunning() const;
   bool enable_log() const;
 
+  /**
+   * @brief Get how late the messages are sent, per message id.
+   * @return The latency statistics.
+   */
+  const CanLatencyStats &latency_stats() const;
+
   FRIEND_TEST(CanSenderTest, OneRunCase);
+  FRIEND_TEST(CanSenderTest, BatchSend);
 
  private:
   void PowerSendThreadFunc();
 
+  // sends the frames due in a cycle in as few Send calls as the client takes
+  void SendFrames(const std::vector<CanFrame> &can_frames);
+
   bool NeedSend(const SenderMessage<SensorType> &msg,
                 const int32_t delta_period);
   bool is_init_ = false;
@@ -198,6 +218,8 @@ class CanSender {
   std::vector<SenderMessage<SensorType>> send_messages_;
   std::unique_ptr<std::thread> thread_;
   bool enable_log_ = false;
+  std::vector<CanFrame> batch_frames_;
+  CanLatencyStats latency_stats_;
 
   DISALLOW_COPY_AND_ASSIGN(CanSender);
 };
@@ -269,6 +291,38 @@ int32_t SenderMessage<SensorType>::curr_period() const {
   return curr_period_;
 }
 
+template <typename SensorType>
+int64_t SenderMessage<SensorType>::RecordSend(const int64_t send_time) {
+  int64_t late = 0;
+  if (last_send_time_ > 0) {
+    late = send_time - last_send_time_ - period_;
+  }
+  last_send_time_ = send_time;
+  return late;
+}
+
+template <typename SensorType>
+void CanSender<SensorType>::SendFrames(
+    const std::vector<CanFrame> &can_frames) {
+  const size_t max_frame_num =
+      static_cast<size_t>(std::max(can_client_->MaxSendFrameNum(), 1));
+  for (size_t begin = 0; begin < can_frames.size(); begin += max_frame_num) {
+    const size_t end = std::min(begin + max_frame_num, can_frames.size());
+    const std::vector<CanFrame> *frames = &can_frames;
+    if (begin > 0 || end < can_frames.size()) {
+      batch_frames_.assign(can_frames.begin() + begin,
+                           can_frames.begin() + end);
+      frames = &batch_frames_;
+    }
+    int32_t frame_num = static_cast<int32_t>(frames->size());
+    if (can_client_->Send(*frames, &frame_num) != common::ErrorCode::OK) {
+      for (const auto &can_frame : *frames) {
+        AERROR << "Send msg failed:" << can_frame.CanFrameString();
+      }
+    }
+  }
+}
+
 template <typename SensorType>
 void CanSender<SensorType>::PowerSendThreadFunc() {
   CHECK_NOTNULL(can_client_);
@@ -286,10 +340,18 @@ void CanSender<SensorType>::PowerSendThreadFunc() {
 
   AINFO << "Can client sender thread starts.";
 
+  // the frames due in a cycle are coalesced and sent together
+  std::vector<CanFrame> can_frames;
+  std::vector<SenderMessage<SensorType> *> sent_messages;
+  can_frames.reserve(send_messages_.size());
+  sent_messages.reserve(send_messages_.size());
+
   while (is_running_) {
     tm_start =
         common::time::AsInt64<common::time::micros>(common::time::Clock::Now());
     new_delta_period = INIT_PERIOD;
+    can_frames.clear();
+    sent_messages.clear();
 
     for (auto &message : send_messages_) {
       bool need_send = NeedSend(message, delta_period);
@@ -299,19 +361,19 @@ void CanSender<SensorType>::PowerSendThreadFunc() {
       if (!need_send) {
         continue;
       }
-      std::vector<CanFrame> can_frames;
-      CanFrame can_frame = message.CanFrame();
-      can_frames.push_back(can_frame);
-      if (can_client_->SendSingleFrame(can_frames) != common::ErrorCode::OK) {
-        AERROR << "Send msg failed:" << can_frame.CanFrameString();
-      }
+      can_frames.push_back(message.CanFrame());
+      sent_messages.push_back(&message);
       if (enable_log()) {
-        ADEBUG << "send_can_frame#" << can_frame.CanFrameString();
+        ADEBUG << "send_can_frame#" << can_frames.back().CanFrameString();
       }
     }
+    SendFrames(can_frames);
     delta_period = new_delta_period;
     tm_end =
         common::time::AsInt64<common::time::micros>(common::time::Clock::Now());
+    for (auto *message : sent_messages) {
+      latency_stats_.Add(message->message_id(), message->RecordSend(tm_end));
+    }
     sleep_interval = delta_period - (tm_end - tm_start);
 
     if (sleep_interval > 0) {
@@ -400,6 +462,11 @@ bool CanSender<SensorType>::enable_log() const {
   return enable_log_;
 }
 
+template <typename SensorType>
+const CanLatencyStats &CanSender<SensorType>::latency_stats() const {
+  return latency_stats_;
+}
+
 template <typename SensorType>
 bool CanSender<SensorType>::NeedSend(const SenderMessage<SensorType> &msg,
                                      const int32_t delta_period) {
@@ -16,6 +16,8 @@
 
 #include "modules/drivers/canbus/can_comm/can_sender.h"
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "modules/canbus/proto/chassis_detail.pb.h"
@@ -51,6 +53,37 @@ TEST(CanSenderTest, OneRunCase) {
   EXPECT_FALSE(sender.IsRunning());
 }
 
+class BatchCanClient : public can::FakeCanClient {
+ public:
+  int32_t MaxSendFrameNum() const override { return 2; }
+
+  common::ErrorCode Send(const std::vector<CanFrame> &frames,
+                         int32_t *const frame_num) override {
+    batch_sizes_.push_back(*frame_num);
+    return can::FakeCanClient::Send(frames, frame_num);
+  }
+
+  std::vector<int32_t> batch_sizes_;
+};
+
+TEST(CanSenderTest, BatchSend) {
+  CanSender<::apollo::canbus::ChassisDetail> sender;
+  BatchCanClient can_client;
+  sender.Init(&can_client, false);
+
+  std::vector<CanFrame> frames(3);
+  for (size_t i = 0; i < frames.size(); ++i) {
+    frames[i].id = static_cast<uint32_t>(i);
+  }
+  sender.SendFrames(frames);
+  EXPECT_EQ(std::vector<int32_t>({2, 1}), can_client.batch_sizes_);
+
+  ProtocolData<::apollo::canbus::ChassisDetail> mpd;
+  SenderMessage<::apollo::canbus::ChassisDetail> msg(1, &mpd);
+  EXPECT_EQ(0, msg.RecordSend(1000));
+  EXPECT_EQ(500, msg.RecordSend(1500 + mpd.GetPeriod()));
+}
+
 }  // namespace canbus
 }  // namespace drivers
 }  // namespace apollo
@@ -20,6 +20,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -58,6 +59,9 @@ struct CheckIdArg {
   int32_t error_count = 0;
 };
 
+/// ids below are dispatched through a flat table, i.e. all 11 bit CAN ids
+const uint32_t kDispatchTableSize = 0x800;
+
 /**
  * @class MessageManager
  *
@@ -98,8 +102,8 @@ class MessageManager {
       const uint32_t message_id);
 
   /**
-   * @brief get chassis detail. used lock_guard in this function to avoid
-   * concurrent read/write issue.
+   * @brief get chassis detail. it copies the latest snapshot published by
+   * Parse, so it never waits for the parsing, only for other readers.
    * @param chassis_detail chassis_detail to be filled.
    */
   common::ErrorCode GetSensorData(SensorType *const sensor_data);
@@ -116,10 +120,19 @@ class MessageManager {
   template <class T, bool need_check>
   void AddSendProtocolData();
 
+  /*
+   * @brief publish sensor_data_ as the snapshot read by GetSensorData, the
+   * caller holds sensor_data_mutex_
+   */
+  void PublishSensorData();
+
   std::vector<std::unique_ptr<ProtocolData<SensorType>>> send_protocol_data_;
   std::vector<std::unique_ptr<ProtocolData<SensorType>>> recv_protocol_data_;
 
+  // protocol data added by Add*ProtocolData, with an id below
+  // kDispatchTableSize also in protocol_data_table_ indexed by id
   std::unordered_map<uint32_t, ProtocolData<SensorType> *> protocol_data_map_;
+  std::vector<ProtocolData<SensorType> *> protocol_data_table_;
   std::unordered_map<uint32_t, CheckIdArg> check_ids_;
   std::set<uint32_t> received_ids_;
 
@@ -128,8 +141,41 @@ class MessageManager {
   bool is_received_on_time_ = false;
 
   std::condition_variable cvar_;
+
+ private:
+  void AddProtocolData(const uint32_t message_id,
+                       ProtocolData<SensorType> *protocol_data);
+
+  // triple buffer of sensor data snapshots: the parser copies into
+  // snapshots_[back_index_], the readers copy out of
+  // snapshots_[front_index_], and the latest published one is in between.
+  static constexpr int kSnapshotIndexMask = 3;
+  static constexpr int kSnapshotFresh = 4;
+  SensorType snapshots_[3];
+  int back_index_ = 0;
+  int front_index_ = 1;
+  std::atomic<int> middle_index_ = {2};
+  std::mutex snapshot_read_mutex_;
 };
 
+template <typename SensorType>
+void MessageManager<SensorType>::AddProtocolData(
+    const uint32_t message_id, ProtocolData<SensorType> *protocol_data) {
+  protocol_data_map_[message_id] = protocol_data;
+  if (message_id < kDispatchTableSize) {
+    if (protocol_data_table_.empty()) {
+      protocol_data_table_.resize(kDispatchTableSize, nullptr);
+    }
+    protocol_data_table_[message_id] = protocol_data;
+  }
+}
+
+template <typename SensorType>
+constexpr int MessageManager<SensorType>::kSnapshotIndexMask;
+
+template <typename SensorType>
+constexpr int MessageManager<SensorType>::kSnapshotFresh;
+
 template <typename SensorType>
 template <class T, bool need_check>
 void MessageManager<SensorType>::AddRecvProtocolData() {
@@ -138,7 +184,7 @@ void MessageManager<SensorType>::AddRecvProtocolData() {
   if (dt == nullptr) {
     return;
   }
-  protocol_data_map_[T::ID] = dt;
+  AddProtocolData(T::ID, dt);
   if (need_check) {
     check_ids_[T::ID].period = dt->GetPeriod();
     check_ids_[T::ID].real_period = 0;
@@ -155,7 +201,7 @@ void MessageManager<SensorType>::AddSendProtocolData() {
   if (dt == nullptr) {
     return;
   }
-  protocol_data_map_[T::ID] = dt;
+  AddProtocolData(T::ID, dt);
   if (need_check) {
     check_ids_[T::ID].period = dt->GetPeriod();
     check_ids_[T::ID].real_period = 0;
@@ -168,12 +214,22 @@ template <typename SensorType>
 ProtocolData<SensorType>
     *MessageManager<SensorType>::GetMutableProtocolDataById(
         const uint32_t message_id) {
-  if (protocol_data_map_.find(message_id) == protocol_data_map_.end()) {
+  ProtocolData<SensorType> *protocol_data = nullptr;
+  if (message_id < kDispatchTableSize) {
+    if (!protocol_data_table_.empty()) {
+      protocol_data = protocol_data_table_[message_id];
+    }
+  } else {
+    const auto it = protocol_data_map_.find(message_id);
+    if (it != protocol_data_map_.end()) {
+      protocol_data = it->second;
+    }
+  }
+  if (protocol_data == nullptr) {
     ADEBUG << "Unable to get protocol data because of invalid message_id:"
            << Byte::byte_to_hex(message_id);
-    return nullptr;
   }
-  return protocol_data_map_[message_id];
+  return protocol_data;
 }
 
 template <typename SensorType>
@@ -187,6 +243,7 @@ void MessageManager<SensorType>::Parse(const uint32_t message_id,
   {
     std::lock_guard<std::mutex> lock(sensor_data_mutex_);
     protocol_data->Parse(data, length, &sensor_data_);
+    PublishSensorData();
   }
   received_ids_.insert(message_id);
   // check if need to check period
@@ -209,6 +266,16 @@ template <typename SensorType>
 void MessageManager<SensorType>::ClearSensorData() {
   std::lock_guard<std::mutex> lock(sensor_data_mutex_);
   sensor_data_.Clear();
+  PublishSensorData();
+}
+
+template <typename SensorType>
+void MessageManager<SensorType>::PublishSensorData() {
+  snapshots_[back_index_].CopyFrom(sensor_data_);
+  back_index_ =
+      middle_index_.exchange(back_index_ | kSnapshotFresh,
+                             std::memory_order_acq_rel) &
+      kSnapshotIndexMask;
 }
 
 template <typename SensorType>
@@ -223,8 +290,13 @@ ErrorCode MessageManager<SensorType>::GetSensorData(
     AERROR << "Failed to get sensor_data due to nullptr.";
     return ErrorCode::CANBUS_ERROR;
   }
-  std::lock_guard<std::mutex> lock(sensor_data_mutex_);
-  sensor_data->CopyFrom(sensor_data_);
+  std::lock_guard<std::mutex> lock(snapshot_read_mutex_);
+  if (middle_index_.load(std::memory_order_acquire) & kSnapshotFresh) {
+    front_index_ =
+        middle_index_.exchange(front_index_, std::memory_order_acq_rel) &
+        kSnapshotIndexMask;
+  }
+  sensor_data->CopyFrom(snapshots_[front_index_]);
   return ErrorCode::OK;
 }
 
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <set>
+#include <thread>
 
 #include "gtest/gtest.h"
 
@@ -36,12 +37,23 @@ class MockProtocolData : public ProtocolData<::apollo::canbus::ChassisDetail> {
   MockProtocolData() {}
 };
 
+class MockSpeedProtocolData
+    : public ProtocolData<::apollo::canbus::ChassisDetail> {
+ public:
+  static const int32_t ID = 0x18FF0101;
+  void Parse(const uint8_t *bytes, int32_t length,
+             ::apollo::canbus::ChassisDetail *chassis_detail) const override {
+    chassis_detail->mutable_vehicle_spd()->set_vehicle_spd(bytes[0]);
+  }
+};
+
 class MockMessageManager
     : public MessageManager<::apollo::canbus::ChassisDetail> {
  public:
   MockMessageManager() {
     AddRecvProtocolData<MockProtocolData, true>();
     AddSendProtocolData<MockProtocolData, true>();
+    AddRecvProtocolData<MockSpeedProtocolData, false>();
   }
 };
 
@@ -59,6 +71,46 @@ TEST(MessageManagerTest, GetMutableProtocolDataById) {
   EXPECT_EQ(manager.GetSensorData(nullptr), ErrorCode::CANBUS_ERROR);
 }
 
+TEST(MessageManagerTest, GetSensorDataSnapshot) {
+  MockMessageManager manager;
+  EXPECT_TRUE(manager.GetMutableProtocolDataById(MockSpeedProtocolData::ID) !=
+              nullptr);
+  EXPECT_TRUE(manager.GetMutableProtocolDataById(0x112) == nullptr);
+  EXPECT_TRUE(manager.GetMutableProtocolDataById(0x18FF0102) == nullptr);
+
+  ::apollo::canbus::ChassisDetail chassis_detail;
+  EXPECT_EQ(manager.GetSensorData(&chassis_detail), ErrorCode::OK);
+  EXPECT_FALSE(chassis_detail.has_vehicle_spd());
+
+  uint8_t speed = 3;
+  manager.Parse(MockSpeedProtocolData::ID, &speed, 8);
+  EXPECT_EQ(manager.GetSensorData(&chassis_detail), ErrorCode::OK);
+  EXPECT_EQ(3, chassis_detail.vehicle_spd().vehicle_spd());
+  // the latest snapshot is read again without a new parse
+  EXPECT_EQ(manager.GetSensorData(&chassis_detail), ErrorCode::OK);
+  EXPECT_EQ(3, chassis_detail.vehicle_spd().vehicle_spd());
+
+  std::thread reader([&manager]() {
+    ::apollo::canbus::ChassisDetail detail;
+    double last_speed = 0.0;
+    for (int i = 0; i < 1000; ++i) {
+      EXPECT_EQ(manager.GetSensorData(&detail), ErrorCode::OK);
+      EXPECT_GE(detail.vehicle_spd().vehicle_spd(), last_speed);
+      last_speed = detail.vehicle_spd().vehicle_spd();
+    }
+  });
+  for (speed = 4; speed < 200; ++speed) {
+    manager.Parse(MockSpeedProtocolData::ID, &speed, 8);
+  }
+  reader.join();
+  EXPECT_EQ(manager.GetSensorData(&chassis_detail), ErrorCode::OK);
+  EXPECT_EQ(199, chassis_detail.vehicle_spd().vehicle_spd());
+
+  manager.ClearSensorData();
+  EXPECT_EQ(manager.GetSensorData(&chassis_detail), ErrorCode::OK);
+  EXPECT_FALSE(chassis_detail.has_vehicle_spd());
+}
+
 }  // namespace canbus
 }  // namespace drivers
 }  // namespace apollo
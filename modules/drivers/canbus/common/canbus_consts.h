@@ -32,6 +32,8 @@ namespace canbus {
 
 const int32_t CAN_FRAME_SIZE = 8;
 const int32_t MAX_CAN_SEND_FRAME_LEN = 1;
+// frames a client sending in batches, e.g. with sendmmsg, takes in one call
+const int32_t MAX_CAN_SEND_BATCH_LEN = 32;
 const int32_t MAX_CAN_RECV_FRAME_LEN = 10;
 
 const int32_t CANBUS_MESSAGE_LENGTH = 8;  // according to ISO-11891-1
@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ * @brief Compile-time layouts of the signals of a CAN frame.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @namespace apollo::drivers::canbus
+ * @brief apollo::drivers::canbus
+ */
+namespace apollo {
+namespace drivers {
+namespace canbus {
+
+/**
+ * @class SignalPiece
+ * @brief The bits of a signal that lie in one byte of the frame: kLength
+ *        bits of byte kByte, starting at bit kStartBit (from the lowest).
+ */
+template <int kByte, int kStartBit, int kLength>
+struct SignalPiece {
+  static_assert(kByte >= 0, "byte index must not be negative");
+  static_assert(kStartBit >= 0 && kLength >= 1 && kStartBit + kLength <= 8,
+                "a piece must fit in one byte");
+
+  static constexpr int length = kLength;
+
+  /**
+   * @brief Get the bits of the piece, in the lowest bits of the result.
+   * @param bytes The frame data.
+   * @return The value of the piece.
+   */
+  static constexpr uint32_t Extract(const uint8_t *bytes) {
+    return (static_cast<uint32_t>(bytes[kByte]) >> kStartBit) &
+           ((1u << kLength) - 1);
+  }
+};
+
+/**
+ * @class SignalLayout
+ * @brief The layout of a signal as its pieces, from the most significant to
+ *        the least, which is the order in which
+ *        modules/tools/gen_vehicle_protocol lists them for both motorola and
+ *        intel byte orders. Unpack inlines to a few shifts and masks.
+ */
+template <typename... Pieces>
+struct SignalLayout;
+
+template <>
+struct SignalLayout<> {
+  static constexpr int length = 0;
+
+  static constexpr uint32_t Unpack(const uint8_t *bytes, uint32_t high = 0) {
+    return high;
+  }
+};
+
+template <typename Piece, typename... Rest>
+struct SignalLayout<Piece, Rest...> {
+  static constexpr int length = Piece::length + SignalLayout<Rest...>::length;
+  static_assert(length <= 32, "signals longer than 32 bits are not supported");
+
+  /**
+   * @brief Get the raw value of the signal.
+   * @param bytes The frame data.
+   * @param high Bits already unpacked from more significant pieces.
+   * @return The raw, unsigned value.
+   */
+  static constexpr uint32_t Unpack(const uint8_t *bytes, uint32_t high = 0) {
+    return SignalLayout<Rest...>::Unpack(
+        bytes, (high << Piece::length) | Piece::Extract(bytes));
+  }
+
+  /**
+   * @brief Get the raw value of a two's complement signal.
+   * @param bytes The frame data.
+   * @return The raw value, sign extended.
+   */
+  static constexpr int32_t UnpackSigned(const uint8_t *bytes) {
+    return static_cast<int32_t>(Unpack(bytes) << (32 - length)) >>
+           (32 - length);
+  }
+};
+
+}  // namespace canbus
+}  // namespace drivers
+}  // namespace apollo
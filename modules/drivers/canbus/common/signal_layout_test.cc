@@ -0,0 +1,87 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/drivers/canbus/common/signal_layout.h"
+
+#include "gtest/gtest.h"
+
+#include "modules/drivers/canbus/common/byte.h"
+
+namespace apollo {
+namespace drivers {
+namespace canbus {
+
+TEST(SignalLayoutTest, OnePiece) {
+  const uint8_t bytes[] = {0x00, 0xB4};
+  using Layout = SignalLayout<SignalPiece<1, 2, 4>>;
+  static_assert(Layout::length == 4, "");
+  EXPECT_EQ(0b1101, Layout::Unpack(bytes));
+  EXPECT_EQ(-3, Layout::UnpackSigned(bytes));
+  using Whole = SignalLayout<SignalPiece<1, 0, 8>>;
+  EXPECT_EQ(0xB4, Whole::Unpack(bytes));
+}
+
+TEST(SignalLayoutTest, MatchesByte) {
+  // a 12 bit motorola signal starting at bit 3 of byte 2 and a 14 bit intel
+  // signal starting at bit 4 of byte 4, as gen_vehicle_protocol lays them out
+  using Motorola = SignalLayout<SignalPiece<2, 0, 4>, SignalPiece<3, 0, 8>>;
+  using Intel = SignalLayout<SignalPiece<6, 0, 2>, SignalPiece<5, 0, 8>,
+                             SignalPiece<4, 4, 4>>;
+  uint8_t bytes[8] = {0};
+  uint32_t seed = 12345;
+  for (int i = 0; i < 1000; ++i) {
+    for (auto& byte : bytes) {
+      seed = seed * 1103515245 + 12345;
+      byte = static_cast<uint8_t>(seed >> 16);
+    }
+
+    Byte t0(bytes + 2);
+    int32_t x = t0.get_byte(0, 4);
+    Byte t1(bytes + 3);
+    int32_t t = t1.get_byte(0, 8);
+    x <<= 8;
+    x |= t;
+    EXPECT_EQ(x, Motorola::Unpack(bytes));
+    x <<= 20;
+    x >>= 20;
+    EXPECT_EQ(x, Motorola::UnpackSigned(bytes));
+
+    Byte t2(bytes + 6);
+    x = t2.get_byte(0, 2);
+    Byte t3(bytes + 5);
+    t = t3.get_byte(0, 8);
+    x <<= 8;
+    x |= t;
+    Byte t4(bytes + 4);
+    t = t4.get_byte(4, 4);
+    x <<= 4;
+    x |= t;
+    EXPECT_EQ(x, Intel::Unpack(bytes));
+  }
+}
+
+TEST(SignalLayoutTest, ThirtyTwoBits) {
+  const uint8_t bytes[] = {0xFF, 0xFE, 0xFD, 0xFC};
+  using Layout = SignalLayout<SignalPiece<0, 0, 8>, SignalPiece<1, 0, 8>,
+                              SignalPiece<2, 0, 8>, SignalPiece<3, 0, 8>>;
+  EXPECT_EQ(0xFFFEFDFCu, Layout::Unpack(bytes));
+  EXPECT_EQ(static_cast<int32_t>(0xFFFEFDFC), Layout::UnpackSigned(bytes));
+}
+
+}  // namespace canbus
+}  // namespace drivers
+}  // namespace apollo
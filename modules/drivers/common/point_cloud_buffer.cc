@@ -0,0 +1,63 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/drivers/common/point_cloud_buffer.h"
+
+namespace apollo {
+namespace drivers {
+
+void PointCloudBuffer::FromPointCloud(const PointCloud& message) {
+  Clear();
+  header.CopyFrom(message.header());
+  frame_id = message.frame_id();
+  is_dense = message.is_dense();
+  measurement_time = message.measurement_time();
+  width = message.width();
+  height = message.height();
+
+  const int num_points = message.point_size();
+  x.resize(num_points);
+  y.resize(num_points);
+  z.resize(num_points);
+  intensity.resize(num_points);
+  timestamp.resize(num_points);
+  for (int i = 0; i < num_points; ++i) {
+    const PointXYZIT& point = message.point(i);
+    x[i] = point.x();
+    y[i] = point.y();
+    z[i] = point.z();
+    intensity[i] = point.intensity();
+    timestamp[i] = point.timestamp();
+  }
+}
+
+void PointCloudBuffer::Clear() {
+  header.Clear();
+  frame_id.clear();
+  is_dense = false;
+  measurement_time = 0.0;
+  width = 0;
+  height = 0;
+  x.clear();
+  y.clear();
+  z.clear();
+  intensity.clear();
+  timestamp.clear();
+}
+
+}  // namespace drivers
+}  // namespace apollo
@@ -0,0 +1,75 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "modules/common/proto/header.pb.h"
+#include "modules/drivers/proto/pointcloud.pb.h"
+
+namespace apollo {
+namespace drivers {
+
+/**
+ * @class PointCloudBuffer
+ *
+ * @brief A lidar point cloud decoded once from its PointCloud message into
+ * contiguous columns. It is written on an intra process channel next to the
+ * message, so that localization and perception read the same shared points
+ * instead of each converting the protobuf into its own cloud.
+ */
+class PointCloudBuffer {
+ public:
+  PointCloudBuffer() { type_name_ = "PointCloudBuffer"; }
+  ~PointCloudBuffer() = default;
+  std::string GetTypeName() { return type_name_; }
+  PointCloudBuffer* New() const { return new PointCloudBuffer; }
+
+  /**
+   * @brief Decode a point cloud message into the buffer, reusing the memory
+   * of the previous points.
+   */
+  void FromPointCloud(const PointCloud& message);
+
+  void Clear();
+
+  size_t size() const { return x.size(); }
+
+ public:
+  common::Header header;
+  std::string frame_id;
+  bool is_dense = false;
+  double measurement_time = 0.0;
+  uint32_t width = 0;
+  uint32_t height = 0;
+
+  // One entry per point of the message, in the same order.
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> z;
+  std::vector<uint32_t> intensity;
+  std::vector<uint64_t> timestamp;
+
+ private:
+  std::string type_name_;
+};
+
+}  // namespace drivers
+}  // namespace apollo
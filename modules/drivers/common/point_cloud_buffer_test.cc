@@ -0,0 +1,65 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/drivers/common/point_cloud_buffer.h"
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace drivers {
+
+TEST(PointCloudBufferTest, FromPointCloud) {
+  PointCloud message;
+  message.mutable_header()->set_sequence_num(7);
+  message.set_frame_id("velodyne128");
+  message.set_measurement_time(1.5);
+  message.set_width(2);
+  message.set_height(1);
+  PointXYZIT* point = message.add_point();
+  point->set_x(1.0f);
+  point->set_y(2.0f);
+  point->set_z(3.0f);
+  point->set_intensity(40);
+  point->set_timestamp(1500000000);
+  // a point without coordinates keeps its nan defaults
+  message.add_point();
+
+  PointCloudBuffer buffer;
+  buffer.FromPointCloud(message);
+  EXPECT_EQ(7, buffer.header.sequence_num());
+  EXPECT_EQ("velodyne128", buffer.frame_id);
+  EXPECT_DOUBLE_EQ(1.5, buffer.measurement_time);
+  EXPECT_EQ(2, buffer.width);
+  EXPECT_EQ(1, buffer.height);
+  ASSERT_EQ(2, buffer.size());
+  EXPECT_FLOAT_EQ(1.0f, buffer.x[0]);
+  EXPECT_FLOAT_EQ(2.0f, buffer.y[0]);
+  EXPECT_FLOAT_EQ(3.0f, buffer.z[0]);
+  EXPECT_EQ(40, buffer.intensity[0]);
+  EXPECT_EQ(1500000000, buffer.timestamp[0]);
+  EXPECT_TRUE(std::isnan(buffer.x[1]));
+
+  message.clear_point();
+  buffer.FromPointCloud(message);
+  EXPECT_EQ(0, buffer.size());
+  EXPECT_EQ("velodyne128", buffer.frame_id);
+}
+
+}  // namespace drivers
+}  // namespace apollo
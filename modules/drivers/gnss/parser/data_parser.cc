@@ -52,6 +52,25 @@ static const boost::array<double, 36> POSE_COVAR = {
     2, 0, 0, 0,    0, 0, 0, 2, 0, 0, 0,    0, 0, 0, 2, 0, 0, 0,
     0, 0, 0, 0.01, 0, 0, 0, 0, 0, 0, 0.01, 0, 0, 0, 0, 0, 0, 0.01};
 
+// Returns a cleared message from the pool if there is one, or a new message.
+template <class T>
+std::shared_ptr<T> NewMessage(const std::unique_ptr<CCObjectPool<T>> &pool) {
+  if (pool != nullptr) {
+    std::shared_ptr<T> message = pool->GetObject();
+    if (message != nullptr) {
+      message->Clear();
+      return message;
+    }
+  }
+  return std::make_shared<T>();
+}
+
+template <class T>
+void CreatePool(const uint32_t size, std::unique_ptr<CCObjectPool<T>> *pool) {
+  pool->reset(new CCObjectPool<T>(size));
+  (*pool)->ConstructAll();
+}
+
 Parser *CreateParser(config::Config config, bool is_base_station = false) {
   switch (config.data().format()) {
     case config::Stream::NOVATEL_BINARY:
@@ -98,6 +117,12 @@ bool DataParser::Init() {
   rawimu_writer_ = node_->CreateWriter<Imu>(FLAGS_raw_imu_topic);
   gps_writer_ = node_->CreateWriter<Gps>(FLAGS_gps_topic);
 
+  if (config_.message_pool_size() > 0) {
+    CreatePool(config_.message_pool_size(), &corrimu_pool_);
+    CreatePool(config_.message_pool_size(), &rawimu_pool_);
+    CreatePool(config_.message_pool_size(), &gps_pool_);
+  }
+
   common::util::FillHeader("gnss", &ins_status_);
   insstatus_writer_->Write(std::make_shared<InsStatus>(ins_status_));
   common::util::FillHeader("gnss", &gnss_status_);
@@ -229,8 +254,9 @@ void DataParser::PublishBestpos(const MessagePtr message) {
 }
 
 void DataParser::PublishImu(const MessagePtr message) {
-  auto raw_imu = std::make_shared<Imu>(*As<Imu>(message));
   Imu *imu = As<Imu>(message);
+  auto raw_imu = NewMessage(rawimu_pool_);
+  raw_imu->CopyFrom(*imu);
 
   raw_imu->mutable_linear_acceleration()->set_x(
       -imu->linear_acceleration().y());
@@ -247,7 +273,7 @@ void DataParser::PublishImu(const MessagePtr message) {
 
 void DataParser::PublishOdometry(const MessagePtr message) {
   Ins *ins = As<Ins>(message);
-  auto gps = std::make_shared<Gps>();
+  auto gps = NewMessage(gps_pool_);
 
   double unix_sec = apollo::drivers::util::gps2unix(ins->measurement_time());
   gps->mutable_header()->set_timestamp_sec(unix_sec);
@@ -291,7 +317,7 @@ void DataParser::PublishOdometry(const MessagePtr message) {
 
 void DataParser::PublishCorrimu(const MessagePtr message) {
   Ins *ins = As<Ins>(message);
-  auto imu = std::make_shared<CorrectedImu>();
+  auto imu = NewMessage(corrimu_pool_);
   double unix_sec = apollo::drivers::util::gps2unix(ins->measurement_time());
   imu->mutable_header()->set_timestamp_sec(unix_sec);
 
@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 
+#include "cyber/base/concurrent_object_pool.h"
 #include "cyber/cyber.h"
 #include "modules/transform/transform_broadcaster.h"
 
@@ -40,6 +41,8 @@ namespace apollo {
 namespace drivers {
 namespace gnss {
 
+using apollo::cyber::base::CCObjectPool;
+
 class DataParser {
  public:
   using MessagePtr = ::google::protobuf::Message *;
@@ -94,6 +97,12 @@ class DataParser {
   std::shared_ptr<apollo::cyber::Writer<EpochObservation>>
       epochobservation_writer_ = nullptr;
   std::shared_ptr<apollo::cyber::Writer<Heading>> heading_writer_ = nullptr;
+
+  // set when config_.message_pool_size() > 0
+  std::unique_ptr<CCObjectPool<apollo::localization::CorrectedImu>>
+      corrimu_pool_;
+  std::unique_ptr<CCObjectPool<Imu>> rawimu_pool_;
+  std::unique_ptr<CCObjectPool<apollo::localization::Gps>> gps_pool_;
 };
 
 }  // namespace gnss
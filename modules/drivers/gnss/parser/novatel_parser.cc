@@ -18,7 +18,9 @@
 // messages must be
 // logged in order for this parser to work properly.
 //
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <memory>
@@ -111,9 +113,17 @@ class NovatelParser : public Parser {
   virtual MessageType GetMessage(MessagePtr* message_ptr);
 
  private:
-  bool check_crc();
+  // Returns the header length given the third sync byte, 0 if invalid.
+  static size_t header_length(uint8_t sync_2);
 
-  Parser::MessageType PrepareMessage(MessagePtr* message_ptr);
+  // Returns the length of a frame whose first length bytes are given, 0 if
+  // its header is not complete yet.
+  static size_t total_length(const uint8_t* frame, size_t length);
+
+  bool check_crc(const uint8_t* frame, size_t length);
+
+  Parser::MessageType PrepareMessage(const uint8_t* frame, size_t length,
+                                     MessagePtr* message_ptr);
 
   // The handle_xxx functions return whether a message is ready.
   bool HandleBestPos(const novatel::BestPos* pos, uint16_t gps_week,
@@ -162,12 +172,9 @@ class NovatelParser : public Parser {
 
   double imu_measurement_time_previous_ = -1.0;
 
+  // The head of a frame split across updates.
   std::vector<uint8_t> buffer_;
 
-  size_t header_length_ = 0;
-
-  size_t total_length_ = 0;
-
   config::ImuType imu_type_ = config::ImuType::ADIS16488;
 
   // -1 is an unused value.
@@ -228,11 +235,36 @@ Parser::MessageType NovatelParser::GetMessage(MessagePtr* message_ptr) {
   }
 
   while (data_ < data_end_) {
-    if (buffer_.size() == 0) {  // Looking for SYNC0
-      if (*data_ == novatel::SYNC_0) {
-        buffer_.push_back(*data_);
+    const size_t available = data_end_ - data_;
+    if (buffer_.empty()) {
+      // Scan for a frame in the data itself, which is parsed in place when it
+      // is complete. Only the head of a frame split across updates is
+      // copied.
+      const uint8_t* sync = reinterpret_cast<const uint8_t*>(
+          std::memchr(data_, novatel::SYNC_0, available));
+      if (sync == nullptr) {
+        data_ = data_end_;
+        break;
+      }
+      data_ = sync;
+      const size_t remaining = data_end_ - data_;
+      if ((remaining > 1 && data_[1] != novatel::SYNC_1) ||
+          (remaining > 2 && header_length(data_[2]) == 0)) {
+        ++data_;
+        continue;
+      }
+      const size_t frame_length =
+          remaining > 2 ? total_length(data_, remaining) : 0;
+      if (frame_length == 0 || remaining < frame_length) {
+        buffer_.assign(data_, data_end_);
+        data_ = data_end_;
+        break;
+      }
+      MessageType type = PrepareMessage(data_, frame_length, message_ptr);
+      data_ += frame_length;
+      if (type != MessageType::NONE) {
+        return type;
       }
-      ++data_;
     } else if (buffer_.size() == 1) {  // Looking for SYNC1
       if (*data_ == novatel::SYNC_1) {
         buffer_.push_back(*data_++);
@@ -240,45 +272,26 @@ Parser::MessageType NovatelParser::GetMessage(MessagePtr* message_ptr) {
         buffer_.clear();
       }
     } else if (buffer_.size() == 2) {  // Looking for SYNC2
-      switch (*data_) {
-        case novatel::SYNC_2_LONG_HEADER:
-          buffer_.push_back(*data_++);
-          header_length_ = sizeof(novatel::LongHeader);
-          break;
-        case novatel::SYNC_2_SHORT_HEADER:
-          buffer_.push_back(*data_++);
-          header_length_ = sizeof(novatel::ShortHeader);
-          break;
-        default:
-          buffer_.clear();
-      }
-    } else if (header_length_ > 0) {  // Working on header.
-      if (buffer_.size() < header_length_) {
+      if (header_length(*data_) > 0) {
         buffer_.push_back(*data_++);
       } else {
-        if (header_length_ == sizeof(novatel::LongHeader)) {
-          total_length_ = header_length_ + novatel::CRC_LENGTH +
-                          reinterpret_cast<novatel::LongHeader*>(buffer_.data())
-                              ->message_length;
-        } else if (header_length_ == sizeof(novatel::ShortHeader)) {
-          total_length_ =
-              header_length_ + novatel::CRC_LENGTH +
-              reinterpret_cast<novatel::ShortHeader*>(buffer_.data())
-                  ->message_length;
-        } else {
-          AERROR << "Incorrect header_length_. Should never reach here.";
-          buffer_.clear();
-        }
-        header_length_ = 0;
+        buffer_.clear();
       }
-    } else if (total_length_ > 0) {
-      if (buffer_.size() < total_length_) {  // Working on body.
-        buffer_.push_back(*data_++);
+    } else {  // Completing the frame of an earlier update.
+      size_t needed = total_length(buffer_.data(), buffer_.size());
+      if (needed == 0) {
+        needed = header_length(buffer_[2]);
+      }
+      const size_t length = std::min(needed - buffer_.size(), available);
+      buffer_.insert(buffer_.end(), data_, data_ + length);
+      data_ += length;
+      if (buffer_.size() < needed ||
+          total_length(buffer_.data(), buffer_.size()) != needed) {
         continue;
       }
-      MessageType type = PrepareMessage(message_ptr);
+      MessageType type =
+          PrepareMessage(buffer_.data(), buffer_.size(), message_ptr);
       buffer_.clear();
-      total_length_ = 0;
       if (type != MessageType::NONE) {
         return type;
       }
@@ -287,33 +300,60 @@ Parser::MessageType NovatelParser::GetMessage(MessagePtr* message_ptr) {
   return MessageType::NONE;
 }
 
-bool NovatelParser::check_crc() {
-  size_t l = buffer_.size() - novatel::CRC_LENGTH;
-  return crc32_block(buffer_.data(), l) ==
-         *reinterpret_cast<uint32_t*>(buffer_.data() + l);
+size_t NovatelParser::header_length(uint8_t sync_2) {
+  switch (sync_2) {
+    case novatel::SYNC_2_LONG_HEADER:
+      return sizeof(novatel::LongHeader);
+    case novatel::SYNC_2_SHORT_HEADER:
+      return sizeof(novatel::ShortHeader);
+    default:
+      return 0;
+  }
+}
+
+size_t NovatelParser::total_length(const uint8_t* frame, size_t length) {
+  const size_t header = header_length(frame[2]);
+  if (length < header) {
+    return 0;
+  }
+  if (header == sizeof(novatel::LongHeader)) {
+    return header + novatel::CRC_LENGTH +
+           reinterpret_cast<const novatel::LongHeader*>(frame)->message_length;
+  }
+  return header + novatel::CRC_LENGTH +
+         reinterpret_cast<const novatel::ShortHeader*>(frame)->message_length;
+}
+
+bool NovatelParser::check_crc(const uint8_t* frame, size_t length) {
+  size_t l = length - novatel::CRC_LENGTH;
+  uint32_t crc = 0;
+  std::memcpy(&crc, frame + l, sizeof(crc));
+  return crc32_block(frame, l) == crc;
 }
 
-Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
-  if (!check_crc()) {
+Parser::MessageType NovatelParser::PrepareMessage(const uint8_t* frame,
+                                                  size_t length,
+                                                  MessagePtr* message_ptr) {
+  if (!check_crc(frame, length)) {
     AERROR << "CRC check failed.";
     return MessageType::NONE;
   }
 
-  uint8_t* message = nullptr;
+  const uint8_t* message = nullptr;
   novatel::MessageId message_id;
   uint16_t message_length;
   uint16_t gps_week;
   uint32_t gps_millisecs;
-  if (buffer_[2] == novatel::SYNC_2_LONG_HEADER) {
-    auto header = reinterpret_cast<const novatel::LongHeader*>(buffer_.data());
-    message = buffer_.data() + sizeof(novatel::LongHeader);
+  if (frame[2] == novatel::SYNC_2_LONG_HEADER) {
+    auto header = reinterpret_cast<const novatel::LongHeader*>(frame);
+    message = frame + sizeof(novatel::LongHeader);
     gps_week = header->gps_week;
     gps_millisecs = header->gps_millisecs;
     message_id = header->message_id;
     message_length = header->message_length;
   } else {
-    auto header = reinterpret_cast<const novatel::ShortHeader*>(buffer_.data());
-    message = buffer_.data() + sizeof(novatel::ShortHeader);
+    auto header = reinterpret_cast<const novatel::ShortHeader*>(frame);
+    message = frame + sizeof(novatel::ShortHeader);
     gps_week = header->gps_week;
     gps_millisecs = header->gps_millisecs;
     message_id = header->message_id;
@@ -325,7 +365,7 @@ Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
         AERROR << "Incorrect message_length";
         break;
       }
-      if (HandleGnssBestpos(reinterpret_cast<novatel::BestPos*>(message),
+      if (HandleGnssBestpos(reinterpret_cast<const novatel::BestPos*>(message),
                             gps_week, gps_millisecs)) {
         *message_ptr = &bestpos_;
         return MessageType::BEST_GNSS_POS;
@@ -338,8 +378,8 @@ Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
         AERROR << "Incorrect message_length";
         break;
       }
-      if (HandleBestPos(reinterpret_cast<novatel::BestPos*>(message), gps_week,
-                        gps_millisecs)) {
+      if (HandleBestPos(reinterpret_cast<const novatel::BestPos*>(message),
+                        gps_week, gps_millisecs)) {
         *message_ptr = &gnss_;
         return MessageType::GNSS;
       }
@@ -352,8 +392,8 @@ Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
         AERROR << "Incorrect message_length";
         break;
       }
-      if (HandleBestVel(reinterpret_cast<novatel::BestVel*>(message), gps_week,
-                        gps_millisecs)) {
+      if (HandleBestVel(reinterpret_cast<const novatel::BestVel*>(message),
+                        gps_week, gps_millisecs)) {
         *message_ptr = &gnss_;
         return MessageType::GNSS;
       }
@@ -366,7 +406,8 @@ Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
         break;
       }
 
-      if (HandleCorrImuData(reinterpret_cast<novatel::CorrImuData*>(message))) {
+      if (HandleCorrImuData(
+              reinterpret_cast<const novatel::CorrImuData*>(message))) {
         *message_ptr = &ins_;
         return MessageType::INS;
       }
@@ -379,7 +420,7 @@ Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
         break;
       }
 
-      if (HandleInsCov(reinterpret_cast<novatel::InsCov*>(message))) {
+      if (HandleInsCov(reinterpret_cast<const novatel::InsCov*>(message))) {
         *message_ptr = &ins_;
         return MessageType::INS;
       }
@@ -392,7 +433,7 @@ Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
         break;
       }
 
-      if (HandleInsPva(reinterpret_cast<novatel::InsPva*>(message))) {
+      if (HandleInsPva(reinterpret_cast<const novatel::InsPva*>(message))) {
         *message_ptr = &ins_;
         return MessageType::INS;
       }
@@ -405,7 +446,7 @@ Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
         break;
       }
 
-      if (HandleRawImuX(reinterpret_cast<novatel::RawImuX*>(message))) {
+      if (HandleRawImuX(reinterpret_cast<const novatel::RawImuX*>(message))) {
         *message_ptr = &imu_;
         return MessageType::IMU;
       }
@@ -418,7 +459,7 @@ Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
         break;
       }
 
-      if (HandleRawImu(reinterpret_cast<novatel::RawImu*>(message))) {
+      if (HandleRawImu(reinterpret_cast<const novatel::RawImu*>(message))) {
         *message_ptr = &imu_;
         return MessageType::IMU;
       }
@@ -430,8 +471,8 @@ Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
         break;
       }
 
-      if (HandleInsPvax(reinterpret_cast<novatel::InsPvaX*>(message), gps_week,
-                        gps_millisecs)) {
+      if (HandleInsPvax(reinterpret_cast<const novatel::InsPvaX*>(message),
+                        gps_week, gps_millisecs)) {
         *message_ptr = &ins_stat_;
         return MessageType::INS_STAT;
       }
@@ -442,7 +483,8 @@ Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
         AERROR << "Incorrect BDSEPHEMERIS message_length";
         break;
       }
-      if (HandleBdsEph(reinterpret_cast<novatel::BDS_Ephemeris*>(message))) {
+      if (HandleBdsEph(
+              reinterpret_cast<const novatel::BDS_Ephemeris*>(message))) {
         *message_ptr = &gnss_ephemeris_;
         return MessageType::BDSEPHEMERIDES;
       }
@@ -453,7 +495,8 @@ Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
         AERROR << "Incorrect GPSEPHEMERIS message_length";
         break;
       }
-      if (HandleGpsEph(reinterpret_cast<novatel::GPS_Ephemeris*>(message))) {
+      if (HandleGpsEph(
+              reinterpret_cast<const novatel::GPS_Ephemeris*>(message))) {
         *message_ptr = &gnss_ephemeris_;
         return MessageType::GPSEPHEMERIDES;
       }
@@ -464,15 +507,15 @@ Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
         AERROR << "Incorrect GLOEPHEMERIS message length";
         break;
       }
-      if (HandleGloEph(reinterpret_cast<novatel::GLO_Ephemeris*>(message))) {
+      if (HandleGloEph(
+              reinterpret_cast<const novatel::GLO_Ephemeris*>(message))) {
         *message_ptr = &gnss_ephemeris_;
         return MessageType::GLOEPHEMERIDES;
       }
       break;
 
     case novatel::RANGE:
-      if (DecodeGnssObservation(buffer_.data(),
-                                buffer_.data() + buffer_.size())) {
+      if (DecodeGnssObservation(frame, frame + length)) {
         *message_ptr = &gnss_observation_;
         return MessageType::OBSERVATION;
       }
@@ -483,8 +526,8 @@ Parser::MessageType NovatelParser::PrepareMessage(MessagePtr* message_ptr) {
         AERROR << "Incorrect message_length";
         break;
       }
-      if (HandleHeading(reinterpret_cast<novatel::Heading*>(message), gps_week,
-                        gps_millisecs)) {
+      if (HandleHeading(reinterpret_cast<const novatel::Heading*>(message),
+                        gps_week, gps_millisecs)) {
         *message_ptr = &heading_;
         return MessageType::HEADING;
       }
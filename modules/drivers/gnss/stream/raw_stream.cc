@@ -284,6 +284,11 @@ bool RawStream::Init() {
       gpsbin_file, std::ios::app | std::ios::out | std::ios::binary));
   stream_writer_ = node_->CreateWriter<StreamStatus>(FLAGS_stream_status_topic);
   raw_writer_ = node_->CreateWriter<RawData>(FLAGS_gnss_raw_data_topic);
+  if (config_.message_pool_size() > 0) {
+    raw_data_pool_.reset(
+        new cyber::base::CCObjectPool<RawData>(config_.message_pool_size()));
+    raw_data_pool_->ConstructAll();
+  }
   rtcm_writer_ = node_->CreateWriter<RawData>(FLAGS_rtcm_data_topic);
   cyber::ReaderConfig reader_config;
   reader_config.channel_name = FLAGS_gnss_raw_data_topic;
@@ -480,7 +485,11 @@ void RawStream::DataSpin() {
   while (cyber::OK()) {
     size_t length = data_stream_->read(buffer_, BUFFER_SIZE);
     if (length > 0) {
-      std::shared_ptr<RawData> msg_pub = std::make_shared<RawData>();
+      std::shared_ptr<RawData> msg_pub =
+          raw_data_pool_ ? raw_data_pool_->GetObject() : nullptr;
+      if (msg_pub == nullptr) {
+        msg_pub = std::make_shared<RawData>();
+      }
       if (!msg_pub) {
         AERROR << "New data sting msg failed.";
         continue;
@@ -21,6 +21,7 @@
 #include <string>
 #include <thread>
 
+#include "cyber/base/concurrent_object_pool.h"
 #include "cyber/cyber.h"
 
 #include "modules/canbus/proto/chassis.pb.h"
@@ -65,7 +66,9 @@ class RawStream {
 
   std::unique_ptr<cyber::Timer> wheel_velocity_timer_ = nullptr;
   std::shared_ptr<apollo::canbus::Chassis> chassis_ptr_ = nullptr;
-  static constexpr size_t BUFFER_SIZE = 2048;
+  // large enough for everything the receiver sends between two reads, the
+  // parser keeps the head of a message split across reads
+  static constexpr size_t BUFFER_SIZE = 8192;
   uint8_t buffer_[BUFFER_SIZE] = {0};
   uint8_t buffer_rtk_[BUFFER_SIZE] = {0};
 
@@ -99,6 +102,8 @@ class RawStream {
   std::shared_ptr<apollo::cyber::Writer<StreamStatus>> stream_writer_ =
       nullptr;
   std::shared_ptr<apollo::cyber::Writer<RawData>> raw_writer_ = nullptr;
+  // set when config_.message_pool_size() > 0
+  std::unique_ptr<apollo::cyber::base::CCObjectPool<RawData>> raw_data_pool_;
   std::shared_ptr<apollo::cyber::Writer<RawData>> rtcm_writer_ = nullptr;
   std::shared_ptr<apollo::cyber::Reader<RawData>> gpsbin_reader_ = nullptr;
   std::shared_ptr<apollo::cyber::Reader<apollo::canbus::Chassis>>
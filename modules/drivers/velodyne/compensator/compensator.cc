@@ -16,9 +16,11 @@
 
 #include "modules/drivers/velodyne/compensator/compensator.h"
 
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace apollo {
 namespace drivers {
@@ -153,6 +155,12 @@ void Compensator::MotionCompensation(
   // 0.0003 rad. So, we consider a rotation "significant" only if the scalar
   // part of quaternion is
   // less than cos(0.0003 / 2) = 1 - 1e-8.
+  if (config_.num_time_buckets() > 0) {
+    BucketMotionCompensation(*msg, msg_compensated.get(), timestamp_min,
+                             timestamp_max, translation, q1,
+                             abs_d < 1.0 - 1.0e-8);
+    return;
+  }
   if (abs_d < 1.0 - 1.0e-8) {
     double theta = acos(abs_d);
     double sin_theta = sin(theta);
@@ -219,6 +227,36 @@ void Compensator::MotionCompensation(
   }
 }
 
+void Compensator::BucketMotionCompensation(
+    const PointCloud& msg, PointCloud* msg_compensated,
+    const uint64_t timestamp_min, const uint64_t timestamp_max,
+    const Eigen::Vector3d& translation, const Eigen::Quaterniond& q1,
+    const bool rotation_significant) {
+  const Eigen::Quaterniond q0(Eigen::Quaterniond::Identity());
+  const double d = q0.dot(q1);
+  const double theta = std::acos(std::abs(d));
+  const double sin_theta = std::sin(theta);
+  const double c1_sign = (d > 0) ? 1 : -1;
+
+  const int num_buckets = static_cast<int>(config_.num_time_buckets());
+  std::vector<PointTransformer::Transform> transforms(num_buckets);
+  for (int i = 0; i < num_buckets; ++i) {
+    // the same interpolation as the per point path, t is the fraction of the
+    // sweep between the middle of the bucket and timestamp_max
+    const double t = 1.0 - (i + 0.5) / num_buckets;
+    Eigen::Affine3d trans(Eigen::Translation3d(t * translation));
+    if (rotation_significant) {
+      const double c0 = std::sin((1 - t) * theta) / sin_theta;
+      const double c1 = std::sin(t * theta) / sin_theta * c1_sign;
+      trans = trans * Eigen::Quaterniond(c0 * q0.coeffs() + c1 * q1.coeffs());
+    }
+    transforms[i] = trans.matrix().topRows<3>().cast<float>();
+  }
+  // like the per point path, only the rotating path keeps the nan points
+  point_transformer_.Append(msg, transforms, timestamp_min, timestamp_max,
+                            rotation_significant, msg_compensated);
+}
+
 }  // namespace velodyne
 }  // namespace drivers
 }  // namespace apollo
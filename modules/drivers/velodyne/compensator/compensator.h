@@ -23,6 +23,7 @@
 #include "modules/transform/buffer.h"
 
 #include "modules/drivers/proto/pointcloud.pb.h"
+#include "modules/drivers/velodyne/compensator/point_transformer.h"
 #include "modules/drivers/velodyne/proto/config.pb.h"
 
 namespace apollo {
@@ -34,7 +35,8 @@ using apollo::drivers::PointCloud;
 
 class Compensator {
  public:
-  explicit Compensator(const CompensatorConfig& config) : config_(config) {}
+  explicit Compensator(const CompensatorConfig& config)
+      : config_(config), point_transformer_(config.num_threads()) {}
   virtual ~Compensator() {}
 
   bool MotionCompensation(const std::shared_ptr<const PointCloud>& msg,
@@ -57,6 +59,18 @@ class Compensator {
                           const uint64_t timestamp_max,
                           const Eigen::Affine3d& pose_min_time,
                           const Eigen::Affine3d& pose_max_time);
+
+  /**
+   * @brief motion compensation with one pose per time bucket, computed at
+   *   the middle of the bucket
+   */
+  void BucketMotionCompensation(const PointCloud& msg,
+                                PointCloud* msg_compensated,
+                                const uint64_t timestamp_min,
+                                const uint64_t timestamp_max,
+                                const Eigen::Vector3d& translation,
+                                const Eigen::Quaterniond& q1,
+                                const bool rotation_significant);
   /**
    * @brief get min timestamp and max timestamp from points in pointcloud2
    */
@@ -68,6 +82,7 @@ class Compensator {
 
   Buffer* tf2_buffer_ptr_ = transform::Buffer::Instance();
   CompensatorConfig config_;
+  PointTransformer point_transformer_;
 };
 
 }  // namespace velodyne
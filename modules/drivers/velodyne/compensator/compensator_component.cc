@@ -43,6 +43,13 @@ bool CompensatorComponent::Init() {
     }
     point_cloud->mutable_point()->Reserve(140000);
   }
+
+  if (!config.buffer_channel().empty()) {
+    buffer_writer_ =
+        node_->CreateWriter<PointCloudBuffer>(config.buffer_channel());
+    buffer_pool_.reset(new CCObjectPool<PointCloudBuffer>(pool_size_));
+    buffer_pool_->ConstructAll();
+  }
   return true;
 }
 
@@ -67,6 +74,14 @@ bool CompensatorComponent::Proc(
           << ";meta:" << point_cloud_compensated->header().lidar_timestamp();
     point_cloud_compensated->mutable_header()->set_sequence_num(seq_);
     writer_->Write(point_cloud_compensated);
+    if (buffer_writer_ != nullptr) {
+      std::shared_ptr<PointCloudBuffer> buffer = buffer_pool_->GetObject();
+      if (buffer == nullptr) {
+        buffer = std::make_shared<PointCloudBuffer>();
+      }
+      buffer->FromPointCloud(*point_cloud_compensated);
+      buffer_writer_->Write(buffer);
+    }
     seq_++;
   }
 
@@ -22,6 +22,7 @@
 #include "cyber/base/concurrent_object_pool.h"
 #include "cyber/cyber.h"
 
+#include "modules/drivers/common/point_cloud_buffer.h"
 #include "modules/drivers/proto/pointcloud.pb.h"
 #include "modules/drivers/velodyne/compensator/compensator.h"
 
@@ -33,6 +34,7 @@ using apollo::cyber::Component;
 using apollo::cyber::Reader;
 using apollo::cyber::Writer;
 using apollo::drivers::PointCloud;
+using apollo::drivers::PointCloudBuffer;
 using apollo::cyber::base::CCObjectPool;
 
 class CompensatorComponent : public Component<PointCloud> {
@@ -46,6 +48,8 @@ class CompensatorComponent : public Component<PointCloud> {
   int seq_ = 0;
   std::shared_ptr<Writer<PointCloud>> writer_ = nullptr;
   std::shared_ptr<CCObjectPool<PointCloud>> compensator_pool_ = nullptr;
+  std::shared_ptr<Writer<PointCloudBuffer>> buffer_writer_ = nullptr;
+  std::shared_ptr<CCObjectPool<PointCloudBuffer>> buffer_pool_ = nullptr;
 };
 
 CYBER_REGISTER_COMPONENT(CompensatorComponent)
@@ -0,0 +1,176 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/drivers/velodyne/compensator/point_transformer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+
+#include "cyber/task/task.h"
+
+namespace apollo {
+namespace drivers {
+namespace velodyne {
+
+namespace {
+
+// below this many points per chunk the Async overhead outweighs the gain
+constexpr size_t kMinPointsPerThread = 8192;
+
+}  // namespace
+
+PointTransformer::PointTransformer(const int num_threads)
+    : num_threads_(std::max(num_threads, 1)) {}
+
+void PointTransformer::Append(const PointCloud& in, const Transform& transform,
+                              const bool keep_nan, PointCloud* out) {
+  Append(in, std::vector<Transform>{transform}, 0, 0, keep_nan, out);
+}
+
+void PointTransformer::Append(const PointCloud& in,
+                              const std::vector<Transform>& transforms,
+                              const uint64_t timestamp_min,
+                              const uint64_t timestamp_max,
+                              const bool keep_nan, PointCloud* out) {
+  if (transforms.empty()) {
+    return;
+  }
+  index_.clear();
+  index_.reserve(in.point_size());
+  for (int i = 0; i < in.point_size(); ++i) {
+    if (keep_nan || !std::isnan(in.point(i).x())) {
+      index_.push_back(i);
+    }
+  }
+  const size_t size = index_.size();
+  x_.resize(size);
+  y_.resize(size);
+  z_.resize(size);
+  bucket_.resize(size);
+
+  const int out_offset = out->point_size();
+  out->mutable_point()->Reserve(out_offset + static_cast<int>(size));
+  for (size_t i = 0; i < size; ++i) {
+    out->add_point();
+  }
+
+  const double bucket_scale =
+      timestamp_max > timestamp_min
+          ? static_cast<double>(transforms.size()) /
+                static_cast<double>(timestamp_max - timestamp_min)
+          : 0.0;
+  Run(in, transforms, timestamp_min, bucket_scale, out_offset, out);
+}
+
+void PointTransformer::Overwrite(const PointCloud& in,
+                                 const Transform& transform,
+                                 const int out_offset, PointCloud* out) {
+  const size_t size = in.point_size();
+  index_.resize(size);
+  for (size_t i = 0; i < size; ++i) {
+    index_[i] = static_cast<int>(i);
+  }
+  x_.resize(size);
+  y_.resize(size);
+  z_.resize(size);
+  bucket_.resize(size);
+  Run(in, std::vector<Transform>{transform}, 0, 0.0, out_offset, out);
+}
+
+void PointTransformer::Run(const PointCloud& in,
+                           const std::vector<Transform>& transforms,
+                           const uint64_t timestamp_min,
+                           const double bucket_scale, const int out_offset,
+                           PointCloud* out) {
+  const size_t size = index_.size();
+  const size_t num_chunks = std::max<size_t>(
+      std::min<size_t>(num_threads_, size / kMinPointsPerThread), 1);
+  if (num_chunks == 1) {
+    AppendRange(&in, &transforms, timestamp_min, bucket_scale, 0, size,
+                out_offset, out);
+    return;
+  }
+  const size_t chunk_size = (size + num_chunks - 1) / num_chunks;
+  std::vector<std::future<void>> futures;
+  for (size_t begin = 0; begin < size; begin += chunk_size) {
+    futures.push_back(cyber::Async(&PointTransformer::AppendRange, this, &in,
+                                   &transforms, timestamp_min, bucket_scale,
+                                   begin, std::min(begin + chunk_size, size),
+                                   out_offset, out));
+  }
+  for (auto& future : futures) {
+    future.get();
+  }
+}
+
+void PointTransformer::AppendRange(const PointCloud* in,
+                                   const std::vector<Transform>* transforms,
+                                   const uint64_t timestamp_min,
+                                   const double bucket_scale,
+                                   const size_t begin, const size_t end,
+                                   const int out_offset, PointCloud* out) {
+  const uint32_t max_bucket = static_cast<uint32_t>(transforms->size() - 1);
+  for (size_t i = begin; i < end; ++i) {
+    const PointXYZIT& point = in->point(index_[i]);
+    x_[i] = point.x();
+    y_[i] = point.y();
+    z_[i] = point.z();
+    const double offset =
+        bucket_scale * static_cast<double>(point.timestamp() - timestamp_min);
+    bucket_[i] = std::min(static_cast<uint32_t>(offset), max_bucket);
+  }
+
+  float* x = x_.data();
+  float* y = y_.data();
+  float* z = z_.data();
+  if (max_bucket == 0) {
+    const Transform& t = transforms->front();
+    for (size_t i = begin; i < end; ++i) {
+      const float px = x[i];
+      const float py = y[i];
+      const float pz = z[i];
+      x[i] = t(0, 0) * px + t(0, 1) * py + t(0, 2) * pz + t(0, 3);
+      y[i] = t(1, 0) * px + t(1, 1) * py + t(1, 2) * pz + t(1, 3);
+      z[i] = t(2, 0) * px + t(2, 1) * py + t(2, 2) * pz + t(2, 3);
+    }
+  } else {
+    for (size_t i = begin; i < end; ++i) {
+      const Transform& t = (*transforms)[bucket_[i]];
+      const float px = x[i];
+      const float py = y[i];
+      const float pz = z[i];
+      x[i] = t(0, 0) * px + t(0, 1) * py + t(0, 2) * pz + t(0, 3);
+      y[i] = t(1, 0) * px + t(1, 1) * py + t(1, 2) * pz + t(1, 3);
+      z[i] = t(2, 0) * px + t(2, 1) * py + t(2, 2) * pz + t(2, 3);
+    }
+  }
+
+  for (size_t i = begin; i < end; ++i) {
+    const PointXYZIT& point = in->point(index_[i]);
+    PointXYZIT* point_new =
+        out->mutable_point(out_offset + static_cast<int>(i));
+    point_new->set_intensity(point.intensity());
+    point_new->set_timestamp(point.timestamp());
+    point_new->set_x(x[i]);
+    point_new->set_y(y[i]);
+    point_new->set_z(z[i]);
+  }
+}
+
+}  // namespace velodyne
+}  // namespace drivers
+}  // namespace apollo
@@ -0,0 +1,90 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Eigen/Core"
+
+#include "modules/drivers/proto/pointcloud.pb.h"
+
+namespace apollo {
+namespace drivers {
+namespace velodyne {
+
+/**
+ * @class PointTransformer
+ *
+ * @brief moves the points of a cloud by rigid transforms. The points are
+ *   copied into flat x/y/z arrays so that the transform is applied by a
+ *   plain loop the compiler vectorizes, and large clouds are split in
+ *   chunks run with cyber::Async.
+ */
+class PointTransformer {
+ public:
+  using Transform = Eigen::Matrix<float, 3, 4>;
+
+  explicit PointTransformer(const int num_threads = 1);
+
+  /**
+   * @brief append the points of in to out, each moved by the transform of
+   *   its time bucket, the transforms split [timestamp_min, timestamp_max]
+   *   into buckets of equal duration
+   * @param keep_nan copy the nan points instead of dropping them
+   */
+  void Append(const PointCloud& in, const std::vector<Transform>& transforms,
+              const uint64_t timestamp_min, const uint64_t timestamp_max,
+              const bool keep_nan, PointCloud* out);
+
+  /**
+   * @brief append the points of in to out, all moved by transform
+   */
+  void Append(const PointCloud& in, const Transform& transform,
+              const bool keep_nan, PointCloud* out);
+
+  /**
+   * @brief overwrite the points of out from out_offset on with the points
+   *   of in, all moved by transform. The nan points are kept, so out must
+   *   already hold out_offset + in.point_size() points. Different ranges of
+   *   out may be written by several transformers at once.
+   */
+  void Overwrite(const PointCloud& in, const Transform& transform,
+                 const int out_offset, PointCloud* out);
+
+ private:
+  void Run(const PointCloud& in, const std::vector<Transform>& transforms,
+           const uint64_t timestamp_min, const double bucket_scale,
+           const int out_offset, PointCloud* out);
+  void AppendRange(const PointCloud* in,
+                   const std::vector<Transform>* transforms,
+                   const uint64_t timestamp_min, const double bucket_scale,
+                   const size_t begin, const size_t end,
+                   const int out_offset, PointCloud* out);
+
+  int num_threads_ = 1;
+  // index in the input cloud and coordinates of the points to transform
+  std::vector<int> index_;
+  std::vector<float> x_;
+  std::vector<float> y_;
+  std::vector<float> z_;
+  std::vector<uint32_t> bucket_;
+};
+
+}  // namespace velodyne
+}  // namespace drivers
+}  // namespace apollo
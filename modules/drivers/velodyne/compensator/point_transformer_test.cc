@@ -0,0 +1,134 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/drivers/velodyne/compensator/point_transformer.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "Eigen/Geometry"
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace drivers {
+namespace velodyne {
+
+namespace {
+
+void AddPoint(const float x, const float y, const float z,
+              const uint64_t timestamp, PointCloud* cloud) {
+  PointXYZIT* point = cloud->add_point();
+  point->set_x(x);
+  point->set_y(y);
+  point->set_z(z);
+  point->set_intensity(7);
+  point->set_timestamp(timestamp);
+}
+
+}  // namespace
+
+TEST(PointTransformerTest, SingleTransform) {
+  PointCloud in;
+  AddPoint(1.0f, 2.0f, 3.0f, 100, &in);
+  AddPoint(std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f, 200, &in);
+  AddPoint(-4.0f, 0.5f, 1.0f, 300, &in);
+
+  const Eigen::Affine3d pose =
+      Eigen::Translation3d(10.0, -5.0, 1.0) *
+      Eigen::AngleAxisd(0.3, Eigen::Vector3d::UnitZ());
+  const PointTransformer::Transform transform =
+      pose.matrix().topRows<3>().cast<float>();
+
+  PointTransformer transformer;
+  PointCloud out;
+  AddPoint(0.0f, 0.0f, 0.0f, 0, &out);
+  transformer.Append(in, transform, false, &out);
+  ASSERT_EQ(3, out.point_size());
+  for (const int i : {0, 2}) {
+    const PointXYZIT& point = in.point(i);
+    const Eigen::Vector3d expected =
+        pose * Eigen::Vector3d(point.x(), point.y(), point.z());
+    const PointXYZIT& moved = out.point(i == 0 ? 1 : 2);
+    EXPECT_NEAR(expected.x(), moved.x(), 1e-5);
+    EXPECT_NEAR(expected.y(), moved.y(), 1e-5);
+    EXPECT_NEAR(expected.z(), moved.z(), 1e-5);
+    EXPECT_EQ(point.timestamp(), moved.timestamp());
+    EXPECT_EQ(7, moved.intensity());
+  }
+
+  out.Clear();
+  transformer.Append(in, transform, true, &out);
+  ASSERT_EQ(3, out.point_size());
+  EXPECT_TRUE(std::isnan(out.point(1).x()));
+  EXPECT_EQ(200, out.point(1).timestamp());
+}
+
+TEST(PointTransformerTest, TimeBuckets) {
+  std::vector<PointTransformer::Transform> transforms;
+  for (int i = 0; i < 4; ++i) {
+    PointTransformer::Transform transform =
+        PointTransformer::Transform::Zero();
+    transform.leftCols<3>().setIdentity();
+    transform(0, 3) = static_cast<float>(i);
+    transforms.push_back(transform);
+  }
+
+  PointCloud in;
+  // the buckets of [1000, 1400] are 100 ns long
+  for (const uint64_t timestamp : {1000, 1099, 1100, 1250, 1399, 1400}) {
+    AddPoint(0.0f, 1.0f, 2.0f, timestamp, &in);
+  }
+  PointTransformer transformer;
+  PointCloud out;
+  transformer.Append(in, transforms, 1000, 1400, false, &out);
+  ASSERT_EQ(6, out.point_size());
+  const std::vector<float> expected_x = {0.0f, 0.0f, 1.0f, 2.0f, 3.0f, 3.0f};
+  for (int i = 0; i < out.point_size(); ++i) {
+    EXPECT_FLOAT_EQ(expected_x[i], out.point(i).x());
+    EXPECT_FLOAT_EQ(1.0f, out.point(i).y());
+    EXPECT_FLOAT_EQ(2.0f, out.point(i).z());
+  }
+}
+
+TEST(PointTransformerTest, Overwrite) {
+  PointCloud in;
+  AddPoint(1.0f, 2.0f, 3.0f, 100, &in);
+  AddPoint(std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f, 200, &in);
+
+  PointTransformer::Transform transform = PointTransformer::Transform::Zero();
+  transform.leftCols<3>().setIdentity();
+  transform(2, 3) = 5.0f;
+
+  PointTransformer transformer;
+  PointCloud out;
+  for (int i = 0; i < 4; ++i) {
+    AddPoint(0.0f, 0.0f, 0.0f, 0, &out);
+  }
+  transformer.Overwrite(in, transform, 1, &out);
+  ASSERT_EQ(4, out.point_size());
+  EXPECT_FLOAT_EQ(0.0f, out.point(0).z());
+  EXPECT_FLOAT_EQ(1.0f, out.point(1).x());
+  EXPECT_FLOAT_EQ(8.0f, out.point(1).z());
+  EXPECT_EQ(100, out.point(1).timestamp());
+  EXPECT_TRUE(std::isnan(out.point(2).x()));
+  EXPECT_EQ(200, out.point(2).timestamp());
+  EXPECT_FLOAT_EQ(0.0f, out.point(3).z());
+}
+
+}  // namespace velodyne
+}  // namespace drivers
+}  // namespace apollo
@@ -46,7 +46,10 @@ void VelodyneDriver::Init() {
 
   // open Velodyne input device
 
-  input_.reset(new SocketInput());
+  SocketInput* input = new SocketInput();
+  input->set_batch_options(config_.recv_batch_size(),
+                           config_.use_hw_timestamp());
+  input_.reset(input);
   positioning_input_.reset(new SocketInput());
   input_->init(config_.firing_data_port());
   positioning_input_->init(config_.positioning_data_port());
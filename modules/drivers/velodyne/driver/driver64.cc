@@ -33,7 +33,10 @@ void Velodyne64Driver::Init() {
   config_.set_npackets(static_cast<int>(ceil(packet_rate_ / frequency)));
   AINFO << "publishing " << config_.npackets() << " packets per scan";
 
-  input_.reset(new SocketInput());
+  SocketInput* input = new SocketInput();
+  input->set_batch_options(config_.recv_batch_size(),
+                           config_.use_hw_timestamp());
+  input_.reset(input);
   input_->init(config_.firing_data_port());
 }
 
@@ -28,11 +28,15 @@
 #include <arpa/inet.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
 #include <poll.h>
 #include <sys/file.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <algorithm>
+
 #include "modules/drivers/velodyne/driver/socket_input.h"
 
 namespace apollo {
@@ -86,11 +90,53 @@ void SocketInput::init(const int &port) {
     return;
   }
 
+  if (use_hw_timestamp_) {
+    // the raw hardware time is only reported once rx timestamping is enabled
+    // on the NIC (SIOCSHWTSTAMP), otherwise the kernel software time is used
+    int flags = SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE |
+                SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+    if (setsockopt(sockfd_, SOL_SOCKET, SO_TIMESTAMPING, &flags,
+                   sizeof(flags)) < 0) {
+      AWARN << "SO_TIMESTAMPING not supported on port " << port_ << ": "
+            << strerror(errno);
+    }
+  }
+
+  received_ = 0;
+  next_ = 0;
+  if (batch_size_ > 1) {
+    const size_t control_size = CMSG_SPACE(sizeof(timespec) * 3);
+    ring_.resize(batch_size_ * FIRING_DATA_PACKET_SIZE);
+    control_.resize(batch_size_ * control_size);
+    iovecs_.resize(batch_size_);
+    msgs_.resize(batch_size_);
+    stamps_.resize(batch_size_);
+    memset(msgs_.data(), 0, msgs_.size() * sizeof(mmsghdr));
+    for (size_t i = 0; i < batch_size_; ++i) {
+      iovecs_[i].iov_base = &ring_[i * FIRING_DATA_PACKET_SIZE];
+      iovecs_[i].iov_len = FIRING_DATA_PACKET_SIZE;
+      msgs_[i].msg_hdr.msg_iov = &iovecs_[i];
+      msgs_[i].msg_hdr.msg_iovlen = 1;
+      if (use_hw_timestamp_) {
+        msgs_[i].msg_hdr.msg_control = &control_[i * control_size];
+      }
+    }
+  }
+
   AINFO << "Velodyne socket fd is " << sockfd_ << ", port " << port_;
 }
 
+void SocketInput::set_batch_options(const size_t batch_size,
+                                    const bool use_hw_timestamp) {
+  batch_size_ = std::max(batch_size, static_cast<size_t>(1));
+  use_hw_timestamp_ = use_hw_timestamp;
+}
+
 /** @brief Get one velodyne packet. */
 int SocketInput::get_firing_data_packet(VelodynePacket *pkt) {
+  if (batch_size_ > 1) {
+    return get_batched_firing_data_packet(pkt);
+  }
   // double time1 = ros::Time::now().toSec();
   double time1 = apollo::cyber::Time().Now().ToSecond();
   while (true) {
@@ -125,6 +171,91 @@ int SocketInput::get_firing_data_packet(VelodynePacket *pkt) {
   return 0;
 }
 
+/** @brief Get one velodyne packet from the ring, refilling it with a single
+ *  recvmmsg once all received packets have been handed out. */
+int SocketInput::get_batched_firing_data_packet(VelodynePacket *pkt) {
+  while (true) {
+    if (next_ >= received_) {
+      int rc = receive_batch();
+      if (rc != 0) {
+        return rc;
+      }
+      continue;
+    }
+
+    const size_t i = next_++;
+    if (msgs_[i].msg_len == FIRING_DATA_PACKET_SIZE) {
+      pkt->set_data(&ring_[i * FIRING_DATA_PACKET_SIZE],
+                    FIRING_DATA_PACKET_SIZE);
+      pkt->set_stamp(stamps_[i]);
+      return 0;
+    }
+
+    AERROR << "Incomplete Velodyne rising data packet read: "
+           << msgs_[i].msg_len << " bytes from port " << port_;
+  }
+}
+
+int SocketInput::receive_batch() {
+  received_ = 0;
+  next_ = 0;
+  double time1 = apollo::cyber::Time().Now().ToSecond();
+  if (!input_available(POLL_TIMEOUT)) {
+    return SOCKET_TIMEOUT;
+  }
+
+  const size_t control_size =
+      use_hw_timestamp_ ? CMSG_SPACE(sizeof(timespec) * 3) : 0;
+  for (auto &msg : msgs_) {
+    // the kernel overwrites the control length with the bytes it used
+    msg.msg_hdr.msg_controllen = control_size;
+    msg.msg_len = 0;
+  }
+  int n = recvmmsg(sockfd_, msgs_.data(),
+                   static_cast<unsigned int>(batch_size_), MSG_DONTWAIT,
+                   nullptr);
+  if (n < 0) {
+    if (errno != EWOULDBLOCK && errno != EINTR) {
+      AERROR << "recvfail from port " << port_;
+      return RECIEVE_FAIL;
+    }
+    return 0;
+  }
+
+  double time2 = apollo::cyber::Time().Now().ToSecond();
+  const uint64_t fallback_stamp =
+      apollo::cyber::Time((time2 + time1) / 2.0).ToNanosecond();
+  received_ = static_cast<size_t>(n);
+  for (size_t i = 0; i < received_; ++i) {
+    stamps_[i] = receive_stamp(&msgs_[i].msg_hdr, fallback_stamp);
+  }
+  return 0;
+}
+
+uint64_t SocketInput::receive_stamp(msghdr *hdr,
+                                    const uint64_t fallback_stamp) const {
+  if (!use_hw_timestamp_) {
+    return fallback_stamp;
+  }
+  for (cmsghdr *cmsg = CMSG_FIRSTHDR(hdr); cmsg != nullptr;
+       cmsg = CMSG_NXTHDR(hdr, cmsg)) {
+    if (cmsg->cmsg_level != SOL_SOCKET ||
+        cmsg->cmsg_type != SCM_TIMESTAMPING) {
+      continue;
+    }
+    // ts[0] is the software receive time, ts[2] the raw hardware time
+    scm_timestamping stamps;
+    memcpy(&stamps, CMSG_DATA(cmsg), sizeof(stamps));
+    for (const timespec &ts : {stamps.ts[2], stamps.ts[0]}) {
+      if (ts.tv_sec != 0 || ts.tv_nsec != 0) {
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL +
+               static_cast<uint64_t>(ts.tv_nsec);
+      }
+    }
+  }
+  return fallback_stamp;
+}
+
 int SocketInput::get_positioning_data_packet(NMEATimePtr nmea_time) {
   while (true) {
     if (!input_available(POLL_TIMEOUT)) {
@@ -17,8 +17,11 @@
 #pragma once
 
 #include <stdio.h>
+#include <sys/socket.h>
 #include <unistd.h>
 
+#include <vector>
+
 #include "modules/drivers/velodyne/driver/input.h"
 
 namespace apollo {
@@ -40,10 +43,33 @@ class SocketInput : public Input {
   int get_firing_data_packet(VelodynePacket* pkt);
   int get_positioning_data_packet(NMEATimePtr nmea_time);
 
+  /** @brief Read firing packets in batches, must be called before init.
+   *
+   * @param batch_size packets read per recvmmsg call, 1 disables batching
+   * @param use_hw_timestamp stamp packets with the kernel receive time
+   */
+  void set_batch_options(const size_t batch_size,
+                         const bool use_hw_timestamp);
+
  private:
   int sockfd_;
   int port_;
   bool input_available(int timeout);
+
+  int get_batched_firing_data_packet(VelodynePacket* pkt);
+  int receive_batch();
+  uint64_t receive_stamp(msghdr* hdr, const uint64_t fallback_stamp) const;
+
+  size_t batch_size_ = 1;
+  bool use_hw_timestamp_ = false;
+  // packet ring filled by one recvmmsg, next_ is the next packet handed out
+  std::vector<uint8_t> ring_;
+  std::vector<char> control_;
+  std::vector<iovec> iovecs_;
+  std::vector<mmsghdr> msgs_;
+  std::vector<uint64_t> stamps_;
+  size_t received_ = 0;
+  size_t next_ = 0;
 };
 
 }  // namespace velodyne
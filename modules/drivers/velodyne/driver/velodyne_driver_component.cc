@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <pthread.h>
+
 #include <memory>
 #include <string>
 #include <thread>
@@ -42,6 +44,9 @@ bool VelodyneDriverComponent::Init() {
   }
   dvr_.reset(driver);
   dvr_->Init();
+  scan_pool_.reset(new CCObjectPool<VelodyneScan>(pool_size_));
+  scan_pool_->ConstructAll();
+  device_thread_cpu_ = velodyne_config.device_thread_cpu();
   // spawn device poll thread
   runing_ = true;
   device_thread_ = std::shared_ptr<std::thread>(
@@ -53,9 +58,24 @@ bool VelodyneDriverComponent::Init() {
 
 /** @brief Device poll thread main loop. */
 void VelodyneDriverComponent::device_poll() {
+  if (device_thread_cpu_ >= 0) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(device_thread_cpu_, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+      AWARN << "Failed to pin velodyne device thread to cpu "
+            << device_thread_cpu_;
+    }
+  }
+
   while (!apollo::cyber::IsShutdown()) {
     // poll device until end of file
-    std::shared_ptr<VelodyneScan> scan = std::make_shared<VelodyneScan>();
+    std::shared_ptr<VelodyneScan> scan = scan_pool_->GetObject();
+    if (scan == nullptr) {
+      scan = std::make_shared<VelodyneScan>();
+    } else {
+      scan->Clear();
+    }
     bool ret = dvr_->Poll(scan);
     if (ret) {
       common::util::FillHeader("velodyne", scan.get());
@@ -19,6 +19,7 @@
 #include <string>
 #include <thread>
 
+#include "cyber/base/concurrent_object_pool.h"
 #include "cyber/cyber.h"
 
 #include "modules/drivers/velodyne/driver/driver.h"
@@ -30,6 +31,7 @@ namespace drivers {
 namespace velodyne {
 
 using apollo::cyber::Component;
+using apollo::cyber::base::CCObjectPool;
 using apollo::cyber::Reader;
 using apollo::cyber::Writer;
 using apollo::drivers::velodyne::VelodyneScan;
@@ -50,6 +52,10 @@ class VelodyneDriverComponent : public Component<> {
   std::shared_ptr<std::thread> device_thread_;
   std::shared_ptr<VelodyneDriver> dvr_;  ///< driver implementation class
   std::shared_ptr<apollo::cyber::Writer<VelodyneScan>> writer_;
+  // scans are reused so that their packets keep the buffers of earlier polls
+  std::shared_ptr<CCObjectPool<VelodyneScan>> scan_pool_ = nullptr;
+  int pool_size_ = 8;
+  int device_thread_cpu_ = -1;
 };
 
 CYBER_REGISTER_COMPONENT(VelodyneDriverComponent)
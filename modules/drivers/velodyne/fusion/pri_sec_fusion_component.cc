@@ -14,10 +14,15 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <algorithm>
+#include <future>
 #include <memory>
+#include <vector>
 
 #include "modules/drivers/velodyne/fusion/pri_sec_fusion_component.h"
 
+#include "cyber/task/task.h"
+
 namespace apollo {
 namespace drivers {
 namespace velodyne {
@@ -30,12 +35,15 @@ bool PriSecFusionComponent::Init() {
     return false;
   }
   buffer_ptr_ = apollo::transform::Buffer::Instance();
+  point_transformer_.reset(new PointTransformer(conf_.num_threads()));
 
   fusion_writer_ = node_->CreateWriter<PointCloud>(conf_.fusion_channel());
 
   for (const auto& channel : conf_.input_channel()) {
     auto reader = node_->CreateReader<PointCloud>(channel);
     readers_.emplace_back(reader);
+    // the sources already run in parallel, so each is moved by one thread
+    source_transformers_.emplace_back(new PointTransformer(1));
   }
   return true;
 }
@@ -43,6 +51,11 @@ bool PriSecFusionComponent::Init() {
 bool PriSecFusionComponent::Proc(
     const std::shared_ptr<PointCloud>& point_cloud) {
   auto target = point_cloud;
+  if (conf_.parallel_fusion()) {
+    ParallelFusion(WaitSources(target), target.get());
+    fusion_writer_->Write(target);
+    return true;
+  }
   auto fusion_readers = readers_;
   auto start_time = Time::Now().ToSecond();
   while ((Time::Now().ToSecond() - start_time) < conf_.wait_time_s() &&
@@ -68,6 +81,89 @@ bool PriSecFusionComponent::Proc(
   return true;
 }
 
+std::vector<std::shared_ptr<PointCloud>> PriSecFusionComponent::WaitSources(
+    const std::shared_ptr<PointCloud>& target) {
+  // the latest usable cloud of each reader, in the order of the readers
+  std::vector<std::shared_ptr<PointCloud>> sources(readers_.size());
+  size_t num_pending = readers_.size();
+  const double deadline = Time::Now().ToSecond() + conf_.wait_time_s();
+  while (num_pending > 0) {
+    for (size_t i = 0; i < readers_.size(); ++i) {
+      if (sources[i] != nullptr) {
+        continue;
+      }
+      readers_[i]->Observe();
+      if (readers_[i]->Empty()) {
+        continue;
+      }
+      auto source = readers_[i]->GetLatestObserved();
+      if (!conf_.drop_expired_data() || !IsExpired(target, source)) {
+        sources[i] = source;
+        --num_pending;
+      }
+    }
+    const double remain_us = (deadline - Time::Now().ToSecond()) * 1e6;
+    if (num_pending == 0 || remain_us <= 0.0) {
+      break;
+    }
+    // never sleep past the deadline
+    usleep(static_cast<useconds_t>(
+        std::min(remain_us, static_cast<double>(USLEEP_INTERVAL))));
+  }
+  return sources;
+}
+
+void PriSecFusionComponent::ParallelFusion(
+    const std::vector<std::shared_ptr<PointCloud>>& sources,
+    PointCloud* target) {
+  std::vector<size_t> indices;
+  std::vector<PointTransformer::Transform> transforms;
+  std::vector<int> offsets;
+  int size = target->point_size();
+  for (size_t i = 0; i < sources.size(); ++i) {
+    if (sources[i] == nullptr) {
+      continue;
+    }
+    Eigen::Affine3d pose;
+    if (!QueryPoseAffine(target->header().frame_id(),
+                         sources[i]->header().frame_id(), &pose)) {
+      continue;
+    }
+    indices.push_back(i);
+    if (std::isnan(pose(0, 0))) {
+      transforms.push_back(PointTransformer::Transform::Identity());
+    } else {
+      transforms.push_back(pose.matrix().topRows<3>().cast<float>());
+    }
+    offsets.push_back(size);
+    size += sources[i]->point_size();
+  }
+  if (indices.empty()) {
+    return;
+  }
+
+  // size the target once, then every source fills its own range of it
+  target->mutable_point()->Reserve(size);
+  while (target->point_size() < size) {
+    target->add_point();
+  }
+  std::vector<std::future<void>> futures;
+  for (size_t k = 1; k < indices.size(); ++k) {
+    const size_t i = indices[k];
+    futures.push_back(cyber::Async(
+        &PointTransformer::Overwrite, source_transformers_[i].get(),
+        std::cref(*sources[i]), std::cref(transforms[k]), offsets[k],
+        target));
+  }
+  source_transformers_[indices[0]]->Overwrite(
+      *sources[indices[0]], transforms[0], offsets[0], target);
+  for (auto& future : futures) {
+    future.get();
+  }
+
+  target->set_width(target->point_size() / target->height());
+}
+
 bool PriSecFusionComponent::IsExpired(
     const std::shared_ptr<PointCloud>& target,
     const std::shared_ptr<PointCloud>& source) {
@@ -118,30 +214,10 @@ void PriSecFusionComponent::AppendPointCloud(
       point_new->set_z(point.z());
     }
   } else {
-    for (auto& point : point_cloud_add->point()) {
-      if (std::isnan(point.x())) {
-        PointXYZIT* point_new = point_cloud->add_point();
-        point_new->set_intensity(point.intensity());
-        point_new->set_timestamp(point.timestamp());
-        point_new->set_x(point.x());
-        point_new->set_y(point.y());
-        point_new->set_z(point.z());
-      } else {
-        PointXYZIT* point_new = point_cloud->add_point();
-        point_new->set_intensity(point.intensity());
-        point_new->set_timestamp(point.timestamp());
-        Eigen::Matrix<float, 3, 1> pt(point.x(), point.y(), point.z());
-        point_new->set_x(static_cast<float>(
-            pose(0, 0) * pt.coeffRef(0) + pose(0, 1) * pt.coeffRef(1) +
-            pose(0, 2) * pt.coeffRef(2) + pose(0, 3)));
-        point_new->set_y(static_cast<float>(
-            pose(1, 0) * pt.coeffRef(0) + pose(1, 1) * pt.coeffRef(1) +
-            pose(1, 2) * pt.coeffRef(2) + pose(1, 3)));
-        point_new->set_z(static_cast<float>(
-            pose(2, 0) * pt.coeffRef(0) + pose(2, 1) * pt.coeffRef(1) +
-            pose(2, 2) * pt.coeffRef(2) + pose(2, 3)));
-      }
-    }
+    // nan points stay nan through the transform
+    point_transformer_->Append(*point_cloud_add,
+                               pose.matrix().topRows<3>().cast<float>(),
+                               true, point_cloud.get());
   }
 
   int new_width = point_cloud->point_size() / point_cloud->height();
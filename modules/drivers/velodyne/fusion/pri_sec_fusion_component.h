@@ -24,6 +24,7 @@
 #include "cyber/cyber.h"
 
 #include "modules/drivers/proto/pointcloud.pb.h"
+#include "modules/drivers/velodyne/compensator/point_transformer.h"
 #include "modules/drivers/velodyne/proto/config.pb.h"
 #include "modules/transform/buffer.h"
 
@@ -45,6 +46,10 @@ class PriSecFusionComponent : public Component<PointCloud> {
  private:
   bool Fusion(std::shared_ptr<PointCloud> target,
               std::shared_ptr<PointCloud> source);
+  std::vector<std::shared_ptr<PointCloud>> WaitSources(
+      const std::shared_ptr<PointCloud>& target);
+  void ParallelFusion(const std::vector<std::shared_ptr<PointCloud>>& sources,
+                      PointCloud* target);
   bool IsExpired(const std::shared_ptr<PointCloud>& target,
                  const std::shared_ptr<PointCloud>& source);
   bool QueryPoseAffine(const std::string& target_frame_id,
@@ -58,6 +63,9 @@ class PriSecFusionComponent : public Component<PointCloud> {
   apollo::transform::Buffer* buffer_ptr_ = nullptr;
   std::shared_ptr<Writer<PointCloud>> fusion_writer_;
   std::vector<std::shared_ptr<Reader<PointCloud>>> readers_;
+  std::unique_ptr<PointTransformer> point_transformer_;
+  // one transformer per input channel for the parallel fusion
+  std::vector<std::unique_ptr<PointTransformer>> source_transformers_;
 };
 
 CYBER_REGISTER_COMPONENT(PriSecFusionComponent)
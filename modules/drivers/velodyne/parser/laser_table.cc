@@ -0,0 +1,122 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/drivers/velodyne/parser/laser_table.h"
+
+#include <algorithm>
+
+namespace apollo {
+namespace drivers {
+namespace velodyne {
+
+constexpr int LaserTable::kBlockSize;
+constexpr int LaserTable::kMaxLasers;
+
+void LaserTable::Build(const Calibration& calibration,
+                       const bool two_pt_correction) {
+  two_pt_correction_ = two_pt_correction;
+  int num_lasers = kMaxLasers;
+  for (const auto& laser : calibration.laser_corrections_) {
+    num_lasers = std::max(num_lasers, laser.first + 1);
+  }
+  // lasers missing from the calibration get zero corrections, as the
+  // default inserted entries of the map did
+  num_lasers = (num_lasers + kBlockSize - 1) / kBlockSize * kBlockSize;
+  corrections_.assign(num_lasers, LaserCorrection());
+  for (const auto& laser : calibration.laser_corrections_) {
+    if (laser.first >= 0) {
+      corrections_[laser.first] = laser.second;
+    }
+  }
+
+  for (Array* array :
+       {&cos_rot_correction_, &sin_rot_correction_, &cos_vert_correction_,
+        &sin_vert_correction_, &dist_correction_, &dist_correction_x_,
+        &dist_correction_y_, &horiz_offset_correction_,
+        &vert_offset_correction_}) {
+    array->resize(num_lasers);
+  }
+  for (int i = 0; i < num_lasers; ++i) {
+    const LaserCorrection& corrections = corrections_[i];
+    cos_rot_correction_[i] = corrections.cos_rot_correction;
+    sin_rot_correction_[i] = corrections.sin_rot_correction;
+    cos_vert_correction_[i] = corrections.cos_vert_correction;
+    sin_vert_correction_[i] = corrections.sin_vert_correction;
+    dist_correction_[i] = corrections.dist_correction;
+    dist_correction_x_[i] = corrections.dist_correction_x;
+    dist_correction_y_[i] = corrections.dist_correction_y;
+    horiz_offset_correction_[i] = corrections.horiz_offset_correction;
+    vert_offset_correction_[i] = corrections.vert_offset_correction;
+  }
+}
+
+void LaserTable::DecodeBlock(const uint8_t* data, const int first_laser,
+                             const float distance_resolution,
+                             const float sin_rot, const float cos_rot,
+                             Block* block) const {
+  for (int j = 0; j < kBlockSize; ++j) {
+    const uint16_t raw = static_cast<uint16_t>(data[3 * j] |
+                                               (data[3 * j + 1] << 8));
+    block->raw_distance[j] = static_cast<float>(raw) * distance_resolution;
+  }
+
+  const auto cos_rot_correction =
+      cos_rot_correction_.segment<kBlockSize>(first_laser);
+  const auto sin_rot_correction =
+      sin_rot_correction_.segment<kBlockSize>(first_laser);
+  const auto cos_vert = cos_vert_correction_.segment<kBlockSize>(first_laser);
+  const auto dist = dist_correction_.segment<kBlockSize>(first_laser);
+  const auto horiz = horiz_offset_correction_.segment<kBlockSize>(first_laser);
+
+  // cos(a-b) = cos(a)*cos(b) + sin(a)*sin(b)
+  // sin(a-b) = sin(a)*cos(b) - cos(a)*sin(b)
+  const BlockArray cos_rot_angle =
+      cos_rot * cos_rot_correction + sin_rot * sin_rot_correction;
+  const BlockArray sin_rot_angle =
+      sin_rot * cos_rot_correction - cos_rot * sin_rot_correction;
+
+  block->distance = block->raw_distance + dist;
+  BlockArray distance_x = block->distance;
+  BlockArray distance_y = block->distance;
+  if (two_pt_correction_) {
+    // linear interpolation of the X and Y distance corrections between the
+    // two calibrated distances, see VelodyneParser::ComputeCoords
+    const BlockArray xy_distance = block->distance * cos_vert;
+    const BlockArray xx =
+        (xy_distance * sin_rot_angle - horiz * cos_rot_angle).abs();
+    const BlockArray yy =
+        (xy_distance * cos_rot_angle + horiz * sin_rot_angle).abs();
+    const auto dist_x = dist_correction_x_.segment<kBlockSize>(first_laser);
+    const auto dist_y = dist_correction_y_.segment<kBlockSize>(first_laser);
+    const BlockArray distance_corr_x =
+        (dist - dist_x) * (xx - 2.4f) / 22.64f + dist_x;
+    const BlockArray distance_corr_y =
+        (dist - dist_y) * (yy - 1.93f) / 23.11f + dist_y;
+    const auto near = block->raw_distance <= 2500.0f;
+    distance_x = near.select(block->raw_distance + distance_corr_x, distance_x);
+    distance_y = near.select(block->raw_distance + distance_corr_y, distance_y);
+  }
+
+  block->x = distance_x * cos_vert * sin_rot_angle - horiz * cos_rot_angle;
+  block->y = distance_y * cos_vert * cos_rot_angle + horiz * sin_rot_angle;
+  block->z = block->distance *
+                 sin_vert_correction_.segment<kBlockSize>(first_laser) +
+             vert_offset_correction_.segment<kBlockSize>(first_laser);
+}
+
+}  // namespace velodyne
+}  // namespace drivers
+}  // namespace apollo
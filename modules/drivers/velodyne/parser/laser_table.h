@@ -0,0 +1,91 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Eigen/Core"
+
+#include "modules/drivers/velodyne/parser/calibration.h"
+
+namespace apollo {
+namespace drivers {
+namespace velodyne {
+
+/**
+ * @brief per laser corrections laid out in flat arrays, so that the 32
+ *   returns of a firing block are decoded together with Eigen's vectorized
+ *   array arithmetic instead of one std::map lookup and scalar pass each.
+ */
+class LaserTable {
+ public:
+  static constexpr int kBlockSize = 32;
+  // the table covers at least the lasers of the largest model, so that any
+  // block of a packet can be decoded whatever the calibration holds
+  static constexpr int kMaxLasers = 128;
+  using BlockArray = Eigen::Array<float, kBlockSize, 1>;
+
+  /** @brief coordinates of the returns of a block, in the velodyne frame */
+  struct Block {
+    BlockArray x;
+    BlockArray y;
+    BlockArray z;
+    // raw distance times the resolution, before any correction
+    BlockArray raw_distance;
+    // raw distance corrected by the laser distance offset
+    BlockArray distance;
+  };
+
+  void Build(const Calibration& calibration, const bool two_pt_correction);
+
+  bool empty() const { return corrections_.empty(); }
+
+  int num_lasers() const { return static_cast<int>(corrections_.size()); }
+
+  const LaserCorrection& correction(const int laser) const {
+    return corrections_[laser];
+  }
+
+  /**
+   * @brief decode the returns of lasers first_laser to
+   *   first_laser + kBlockSize - 1 fired at the same rotation
+   * @param data 3 bytes per return, the little endian distance and intensity
+   */
+  void DecodeBlock(const uint8_t* data, const int first_laser,
+                   const float distance_resolution, const float sin_rot,
+                   const float cos_rot, Block* block) const;
+
+ private:
+  using Array = Eigen::Array<float, Eigen::Dynamic, 1>;
+
+  bool two_pt_correction_ = false;
+  std::vector<LaserCorrection> corrections_;
+  Array cos_rot_correction_;
+  Array sin_rot_correction_;
+  Array cos_vert_correction_;
+  Array sin_vert_correction_;
+  Array dist_correction_;
+  Array dist_correction_x_;
+  Array dist_correction_y_;
+  Array horiz_offset_correction_;
+  Array vert_offset_correction_;
+};
+
+}  // namespace velodyne
+}  // namespace drivers
+}  // namespace apollo
@@ -0,0 +1,147 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/drivers/velodyne/parser/laser_table.h"
+
+#include <cmath>
+#include <random>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace drivers {
+namespace velodyne {
+namespace {
+
+// the scalar computation of VelodyneParser::ComputeCoords
+void ReferenceCoords(const float raw_distance, const LaserCorrection& c,
+                     const double rotation, const bool two_pt_correction,
+                     double* x, double* y, double* z) {
+  const double sin_rot = std::sin(rotation);
+  const double cos_rot = std::cos(rotation);
+  const double distance = raw_distance + c.dist_correction;
+  const double cos_rot_angle =
+      cos_rot * c.cos_rot_correction + sin_rot * c.sin_rot_correction;
+  const double sin_rot_angle =
+      sin_rot * c.cos_rot_correction - cos_rot * c.sin_rot_correction;
+  double xy_distance = distance * c.cos_vert_correction;
+  const double xx = std::fabs(xy_distance * sin_rot_angle -
+                              c.horiz_offset_correction * cos_rot_angle);
+  const double yy = std::fabs(xy_distance * cos_rot_angle +
+                              c.horiz_offset_correction * sin_rot_angle);
+  double distance_corr_x = c.dist_correction;
+  double distance_corr_y = c.dist_correction;
+  if (two_pt_correction && raw_distance <= 2500) {
+    distance_corr_x = (c.dist_correction - c.dist_correction_x) *
+                          (xx - 2.4) / 22.64 +
+                      c.dist_correction_x;
+    distance_corr_y = (c.dist_correction - c.dist_correction_y) *
+                          (yy - 1.93) / 23.11 +
+                      c.dist_correction_y;
+  }
+  xy_distance = (raw_distance + distance_corr_x) * c.cos_vert_correction;
+  *x = xy_distance * sin_rot_angle - c.horiz_offset_correction * cos_rot_angle;
+  xy_distance = (raw_distance + distance_corr_y) * c.cos_vert_correction;
+  *y = xy_distance * cos_rot_angle + c.horiz_offset_correction * sin_rot_angle;
+  *z = distance * c.sin_vert_correction + c.vert_offset_correction;
+}
+
+Calibration RandomCalibration(const int num_lasers) {
+  std::mt19937 gen(7);
+  std::uniform_real_distribution<float> angle(-0.3f, 0.3f);
+  std::uniform_real_distribution<float> offset(-0.2f, 0.2f);
+  Calibration calibration;
+  calibration.num_lasers_ = num_lasers;
+  calibration.initialized_ = true;
+  for (int i = 0; i < num_lasers; ++i) {
+    LaserCorrection& c = calibration.laser_corrections_[i];
+    c.rot_correction = angle(gen);
+    c.vert_correction = angle(gen);
+    c.dist_correction = offset(gen);
+    c.dist_correction_x = offset(gen);
+    c.dist_correction_y = offset(gen);
+    c.vert_offset_correction = offset(gen);
+    c.horiz_offset_correction = offset(gen);
+    c.cos_rot_correction = std::cos(c.rot_correction);
+    c.sin_rot_correction = std::sin(c.rot_correction);
+    c.cos_vert_correction = std::cos(c.vert_correction);
+    c.sin_vert_correction = std::sin(c.vert_correction);
+  }
+  return calibration;
+}
+
+void ExpectSameAsReference(const bool two_pt_correction) {
+  const Calibration calibration = RandomCalibration(64);
+  LaserTable table;
+  table.Build(calibration, two_pt_correction);
+  EXPECT_EQ(LaserTable::kMaxLasers, table.num_lasers());
+
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> byte(0, 255);
+  uint8_t data[3 * LaserTable::kBlockSize];
+  for (uint8_t& value : data) {
+    value = static_cast<uint8_t>(byte(gen));
+  }
+  const float resolution = 0.002f;
+  const double rotation = 1.234;
+  for (const int first_laser : {0, 32}) {
+    LaserTable::Block block;
+    table.DecodeBlock(data, first_laser, resolution,
+                      static_cast<float>(std::sin(rotation)),
+                      static_cast<float>(std::cos(rotation)), &block);
+    for (int j = 0; j < LaserTable::kBlockSize; ++j) {
+      const float raw_distance =
+          static_cast<float>(data[3 * j] | (data[3 * j + 1] << 8)) *
+          resolution;
+      const LaserCorrection& c =
+          calibration.laser_corrections_.at(first_laser + j);
+      double x = 0.0;
+      double y = 0.0;
+      double z = 0.0;
+      ReferenceCoords(raw_distance, c, rotation, two_pt_correction, &x, &y,
+                      &z);
+      EXPECT_FLOAT_EQ(raw_distance, block.raw_distance[j]);
+      EXPECT_NEAR(raw_distance + c.dist_correction, block.distance[j], 1e-4);
+      EXPECT_NEAR(x, block.x[j], 1e-4);
+      EXPECT_NEAR(y, block.y[j], 1e-4);
+      EXPECT_NEAR(z, block.z[j], 1e-4);
+    }
+  }
+}
+
+}  // namespace
+
+TEST(LaserTableTest, DecodeBlock) { ExpectSameAsReference(false); }
+
+TEST(LaserTableTest, DecodeBlockTwoPointCorrection) {
+  ExpectSameAsReference(true);
+}
+
+TEST(LaserTableTest, MissingLasersHaveNoCorrection) {
+  LaserTable table;
+  table.Build(RandomCalibration(32), false);
+  uint8_t data[3 * LaserTable::kBlockSize] = {0};
+  data[0] = 0xe8;  // 1000 * 0.002 = 2 meters
+  data[1] = 0x03;
+  LaserTable::Block block;
+  table.DecodeBlock(data, 96, 0.002f, 0.0f, 1.0f, &block);
+  EXPECT_FLOAT_EQ(2.0f, block.distance[0]);
+  EXPECT_FLOAT_EQ(0.0f, block.z[0]);
+}
+
+}  // namespace velodyne
+}  // namespace drivers
+}  // namespace apollo
@@ -70,51 +70,34 @@ void Velodyne128Parser::Order(std::shared_ptr<PointCloud> cloud) {
 
 void Velodyne128Parser::Unpack(const VelodynePacket& pkt,
                                std::shared_ptr<PointCloud> pc) {
-  float azimuth_diff, azimuth_corrected_f;
-  float last_azimuth_diff = 0.0f;
-  uint16_t azimuth = 0;
-  uint16_t azimuth_next = 0;
-  uint16_t azimuth_corrected = 0;
   const RawPacket* raw = (const RawPacket*)pkt.data().c_str();
   double basetime = raw->gps_timestamp;
 
+  LaserTable::Block decoded;
   for (int block = 0; block < BLOCKS_PER_PACKET; block++) {
-    // Calculate difference between current and next block's azimuth angle.
-    if (block == 0) {
-      azimuth = raw->blocks[block].rotation;
-    } else {
-      azimuth = azimuth_next;
-    }
-    if (block < (BLOCKS_PER_PACKET - 1)) {
-      azimuth_next = raw->blocks[block + 1].rotation;
-      azimuth_diff =
-          static_cast<float>((36000 + azimuth_next - azimuth) % 36000);
-      last_azimuth_diff = azimuth_diff;
-    } else {
-      azimuth_diff = last_azimuth_diff;
-    }
+    const uint16_t azimuth = raw->blocks[block].rotation;
+    // every channel of a block is treated as fired at the block azimuth,
+    // the firing order correction is zero
+    const uint16_t azimuth_corrected = azimuth % 36000;
+    const int first_chan = (block % 4) * 32;
+    laser_table_.DecodeBlock(raw->blocks[block].data, first_chan,
+                             VSL128_DISTANCE_RESOLUTION,
+                             sin_rot_table_[azimuth_corrected],
+                             cos_rot_table_[azimuth_corrected], &decoded);
 
     /*condition added to avoid calculating points which are not
       in the interesting defined area (min_angle < area < max_angle)*/
     for (int j = 0, k = 0; j < SCANS_PER_BLOCK; j++, k += RAW_SCAN_SIZE) {
-      uint8_t group = static_cast<uint8_t>(block % 4);
-      uint8_t chan_id = static_cast<uint8_t>(j + group * 32);
-      uint8_t firing_order = chan_id / 8;
-      firing_order = 0;
-      LaserCorrection& corrections = calibration_.laser_corrections_[chan_id];
+      const LaserCorrection& corrections =
+          laser_table_.correction(first_chan + j);
       // distance extraction
-      // union two_bytes tmp;
       union RawDistance raw_distance;
       raw_distance.bytes[0] = raw->blocks[block].data[k];
       raw_distance.bytes[1] = raw->blocks[block].data[k + 1];
 
-      float real_distance =
-          raw_distance.raw_distance * VSL128_DISTANCE_RESOLUTION;
-      float distance = real_distance + corrections.dist_correction;
-
       uint64_t timestamp = static_cast<uint64_t>(GetTimestamp(
           basetime, (*inner_time_)[block][j], static_cast<uint16_t>(block)));
-      if (!is_scan_valid(azimuth, distance)) {
+      if (!is_scan_valid(azimuth, decoded.distance[j])) {
         // todo orgnized
         if (config_.organized()) {
           apollo::drivers::PointXYZIT* point_new = pc->add_point();
@@ -127,29 +110,22 @@ void Velodyne128Parser::Unpack(const VelodynePacket& pkt,
         continue;
       }
 
-      // if (pointInRange(distance)) {
       int intensity = static_cast<int>(raw->blocks[block].data[k + 2]);
 
-      /** correct for the laser rotation as a function of timing during the
-       * firings **/
-      azimuth_corrected_f =
-          azimuth +
-          (azimuth_diff * (firing_order * CHANNEL_TDURATION) / SEQ_TDURATION);
-      azimuth_corrected =
-          (static_cast<uint16_t>(round(azimuth_corrected_f))) % 36000;
-
       // add new point
       PointXYZIT* point_new = pc->add_point();
 
       // compute time , time offset is zero
       point_new->set_timestamp(timestamp);
-      ComputeCoords(real_distance, corrections, azimuth_corrected, point_new);
+      /** Use standard ROS coordinate system (right-hand rule) */
+      point_new->set_x(decoded.y[j]);
+      point_new->set_y(-decoded.x[j]);
+      point_new->set_z(decoded.z[j]);
 
       intensity = IntensityCompensate(corrections, raw_distance.raw_distance,
                                       intensity);
       point_new->set_intensity(intensity);
     }
-    // }
   }
 }
 
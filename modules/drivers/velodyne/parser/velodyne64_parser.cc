@@ -154,6 +154,7 @@ void Velodyne64Parser::GeneratePointcloud(
       return;
     }
     calibration_ = online_calibration_.calibration();
+    laser_table_.Build(calibration_, need_two_pt_correction_);
     if (config_.organized()) {
       InitOffsets();
     }
@@ -245,6 +246,7 @@ void Velodyne64Parser::Unpack(const VelodynePacket& pkt,
   const RawPacket* raw = (const RawPacket*)pkt.data().c_str();
   double basetime = raw->gps_timestamp;  // usec
 
+  LaserTable::Block decoded;
   for (int i = 0; i < BLOCKS_PER_PACKET; ++i) {  // 12
     if (mode_ != DUAL && !is_s2_ && ((i & 3) >> 1) > 0) {
       // i%4/2  even-numbered block contain duplicate data
@@ -254,14 +256,16 @@ void Velodyne64Parser::Unpack(const VelodynePacket& pkt,
     // upper bank lasers are numbered [0..31], lower bank lasers are [32..63]
     // NOTE: this is a change from the old velodyne_common implementation
     int bank_origin = (raw->blocks[i].laser_block_id == LOWER_BANK) ? 32 : 0;
+    const uint16_t rotation = raw->blocks[i].rotation;
+    laser_table_.DecodeBlock(raw->blocks[i].data, bank_origin,
+                             DISTANCE_RESOLUTION, sin_rot_table_[rotation],
+                             cos_rot_table_[rotation], &decoded);
 
     for (int j = 0, k = 0; j < SCANS_PER_BLOCK;
          ++j, k += RAW_SCAN_SIZE) {  // 32, 3
       // One point
-      uint8_t laser_number =
-          static_cast<uint8_t>(j + bank_origin);  // hardware laser number
-      LaserCorrection& corrections =
-          calibration_.laser_corrections_[laser_number];
+      const LaserCorrection& corrections =
+          laser_table_.correction(j + bank_origin);  // hardware laser number
 
       union RawDistance raw_distance;
       raw_distance.bytes[0] = raw->blocks[i].data[k];
@@ -276,11 +280,8 @@ void Velodyne64Parser::Unpack(const VelodynePacket& pkt,
         pc->set_measurement_time(static_cast<double>(timestamp) / 1e9);
       }
 
-      float real_distance = raw_distance.raw_distance * DISTANCE_RESOLUTION;
-      float distance = real_distance + corrections.dist_correction;
-
       if (raw_distance.raw_distance == 0 ||
-          !is_scan_valid(raw->blocks[i].rotation, distance)) {
+          !is_scan_valid(rotation, decoded.distance[j])) {
         // if organized append a nan point to the cloud
         if (config_.organized()) {
           apollo::drivers::PointXYZIT* point_new = pc->add_point();
@@ -295,8 +296,10 @@ void Velodyne64Parser::Unpack(const VelodynePacket& pkt,
 
       apollo::drivers::PointXYZIT* point = pc->add_point();
       point->set_timestamp(timestamp);
-      // Position Calculation, append this point to the cloud
-      ComputeCoords(real_distance, corrections, raw->blocks[i].rotation, point);
+      // Position in the standard ROS coordinate system (right-hand rule)
+      point->set_x(decoded.y[j]);
+      point->set_y(-decoded.x[j]);
+      point->set_z(decoded.z[j]);
       point->set_intensity(IntensityCompensate(
           corrections, raw_distance.raw_distance, raw->blocks[i].data[k + 2]));
       // append this point to the cloud
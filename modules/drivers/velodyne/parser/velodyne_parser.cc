@@ -97,6 +97,7 @@ void VelodyneParser::setup() {
       AFATAL << "Unable to open calibration file: "
              << config_.calibration_file();
     }
+    laser_table_.Build(calibration_, need_two_pt_correction_);
   }
 
   // setup angle parameters.
@@ -60,6 +60,7 @@
 
 #include "modules/drivers/velodyne/parser/calibration.h"
 #include "modules/drivers/velodyne/parser/const_variables.h"
+#include "modules/drivers/velodyne/parser/laser_table.h"
 #include "modules/drivers/velodyne/parser/online_calibration.h"
 
 #include "modules/drivers/proto/pointcloud.pb.h"
@@ -251,6 +252,8 @@ class VelodyneParser {
   const float (*inner_time_)[12][32];
 
   Calibration calibration_;
+  // flat copy of calibration_, rebuilt whenever the calibration changes
+  LaserTable laser_table_;
   float sin_rot_table_[ROTATION_MAX_UNITS];
   float cos_rot_table_[ROTATION_MAX_UNITS];
   double last_time_stamp_;
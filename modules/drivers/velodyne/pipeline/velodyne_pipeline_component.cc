@@ -0,0 +1,167 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/drivers/velodyne/pipeline/velodyne_pipeline_component.h"
+
+#include <pthread.h>
+
+#include <vector>
+
+#include "modules/common/util/message_util.h"
+
+namespace apollo {
+namespace drivers {
+namespace velodyne {
+
+namespace {
+
+template <typename T>
+std::shared_ptr<T> GetCleared(CCObjectPool<T>* pool) {
+  std::shared_ptr<T> object = pool->GetObject();
+  if (object == nullptr) {
+    return std::make_shared<T>();
+  }
+  object->Clear();
+  return object;
+}
+
+}  // namespace
+
+VelodynePipelineComponent::~VelodynePipelineComponent() {
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+bool VelodynePipelineComponent::Init() {
+  if (!GetProtoConfig(&config_)) {
+    AWARN << "Load config failed, config file" << ConfigFilePath();
+    return false;
+  }
+  const Config& velodyne_config = config_.velodyne();
+  const CompensatorConfig& compensator_config = config_.compensator();
+  if (compensator_config.output_channel().empty() &&
+      compensator_config.buffer_channel().empty()) {
+    AERROR << "Neither output_channel nor buffer_channel is set";
+    return false;
+  }
+
+  VelodyneDriver* driver = VelodyneDriverFactory::CreateDriver(velodyne_config);
+  if (driver == nullptr) {
+    return false;
+  }
+  driver_.reset(driver);
+  driver_->Init();
+  convert_.reset(new Convert());
+  convert_->init(velodyne_config);
+  compensator_.reset(new Compensator(compensator_config));
+
+  scan_pool_.reset(new CCObjectPool<VelodyneScan>(pool_size_));
+  scan_pool_->ConstructAll();
+  point_cloud_pool_.reset(new CCObjectPool<PointCloud>(pool_size_));
+  point_cloud_pool_->ConstructAll();
+  compensator_pool_.reset(new CCObjectPool<PointCloud>(pool_size_));
+  compensator_pool_->ConstructAll();
+  // hold every cloud while reserving so that each of them is reached once
+  std::vector<std::shared_ptr<PointCloud>> point_clouds;
+  for (int i = 0; i < pool_size_; ++i) {
+    point_clouds.push_back(point_cloud_pool_->GetObject());
+    point_clouds.push_back(compensator_pool_->GetObject());
+  }
+  for (auto& point_cloud : point_clouds) {
+    point_cloud->mutable_point()->Reserve(140000);
+  }
+
+  if (config_.scan_publish_interval() > 0) {
+    scan_writer_ =
+        node_->CreateWriter<VelodyneScan>(velodyne_config.scan_channel());
+  }
+  if (!compensator_config.output_channel().empty()) {
+    point_cloud_writer_ =
+        node_->CreateWriter<PointCloud>(compensator_config.output_channel());
+  }
+  if (!compensator_config.buffer_channel().empty()) {
+    buffer_writer_ = node_->CreateWriter<PointCloudBuffer>(
+        compensator_config.buffer_channel());
+    buffer_pool_.reset(new CCObjectPool<PointCloudBuffer>(pool_size_));
+    buffer_pool_->ConstructAll();
+  }
+
+  thread_ = std::thread(&VelodynePipelineComponent::Run, this);
+  return true;
+}
+
+void VelodynePipelineComponent::Run() {
+  const int cpu = config_.velodyne().device_thread_cpu();
+  if (cpu >= 0) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+      AWARN << "Failed to pin velodyne pipeline thread to cpu " << cpu;
+    }
+  }
+
+  while (!apollo::cyber::IsShutdown()) {
+    std::shared_ptr<VelodyneScan> scan = GetCleared(scan_pool_.get());
+    if (!driver_->Poll(scan)) {
+      AWARN << "device poll failed";
+      continue;
+    }
+    common::util::FillHeader("velodyne", scan.get());
+    if (scan_writer_ != nullptr &&
+        scan_count_ % config_.scan_publish_interval() == 0) {
+      scan_writer_->Write(scan);
+    }
+    ++scan_count_;
+    Process(scan);
+  }
+  AINFO << "Velodyne pipeline thread exit";
+}
+
+void VelodynePipelineComponent::Process(
+    const std::shared_ptr<VelodyneScan>& scan) {
+  std::shared_ptr<PointCloud> point_cloud =
+      GetCleared(point_cloud_pool_.get());
+  convert_->ConvertPacketsToPointcloud(scan, point_cloud);
+  if (point_cloud->point_size() == 0) {
+    AWARN << "point_cloud convert is empty.";
+    return;
+  }
+
+  std::shared_ptr<PointCloud> point_cloud_compensated =
+      GetCleared(compensator_pool_.get());
+  if (!compensator_->MotionCompensation(point_cloud,
+                                        point_cloud_compensated)) {
+    return;
+  }
+  point_cloud_compensated->mutable_header()->set_sequence_num(seq_++);
+  if (point_cloud_writer_ != nullptr) {
+    point_cloud_writer_->Write(point_cloud_compensated);
+  }
+  if (buffer_writer_ != nullptr) {
+    std::shared_ptr<PointCloudBuffer> buffer = buffer_pool_->GetObject();
+    if (buffer == nullptr) {
+      buffer = std::make_shared<PointCloudBuffer>();
+    }
+    buffer->FromPointCloud(*point_cloud_compensated);
+    buffer_writer_->Write(buffer);
+  }
+}
+
+}  // namespace velodyne
+}  // namespace drivers
+}  // namespace apollo
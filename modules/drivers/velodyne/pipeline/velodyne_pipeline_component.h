@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <thread>
+
+#include "cyber/base/concurrent_object_pool.h"
+#include "cyber/cyber.h"
+
+#include "modules/drivers/common/point_cloud_buffer.h"
+#include "modules/drivers/proto/pointcloud.pb.h"
+#include "modules/drivers/velodyne/compensator/compensator.h"
+#include "modules/drivers/velodyne/driver/driver.h"
+#include "modules/drivers/velodyne/parser/convert.h"
+#include "modules/drivers/velodyne/proto/config.pb.h"
+#include "modules/drivers/velodyne/proto/velodyne.pb.h"
+
+namespace apollo {
+namespace drivers {
+namespace velodyne {
+
+using apollo::cyber::Component;
+using apollo::cyber::Writer;
+using apollo::cyber::base::CCObjectPool;
+using apollo::drivers::PointCloud;
+using apollo::drivers::PointCloudBuffer;
+
+/**
+ * @brief polls the device, converts and motion compensates every sweep in
+ *   one thread, the way VelodyneDriverComponent, VelodyneConvertComponent
+ *   and CompensatorComponent do in a chain, and only writes the result.
+ */
+class VelodynePipelineComponent : public Component<> {
+ public:
+  ~VelodynePipelineComponent();
+  bool Init() override;
+
+ private:
+  void Run();
+  void Process(const std::shared_ptr<VelodyneScan>& scan);
+
+  PipelineConfig config_;
+  std::unique_ptr<VelodyneDriver> driver_;
+  std::unique_ptr<Convert> convert_;
+  std::unique_ptr<Compensator> compensator_;
+  std::thread thread_;
+
+  int pool_size_ = 8;
+  std::shared_ptr<CCObjectPool<VelodyneScan>> scan_pool_ = nullptr;
+  std::shared_ptr<CCObjectPool<PointCloud>> point_cloud_pool_ = nullptr;
+  std::shared_ptr<CCObjectPool<PointCloud>> compensator_pool_ = nullptr;
+  std::shared_ptr<CCObjectPool<PointCloudBuffer>> buffer_pool_ = nullptr;
+
+  std::shared_ptr<Writer<VelodyneScan>> scan_writer_ = nullptr;
+  std::shared_ptr<Writer<PointCloud>> point_cloud_writer_ = nullptr;
+  std::shared_ptr<Writer<PointCloudBuffer>> buffer_writer_ = nullptr;
+  uint64_t scan_count_ = 0;
+  int seq_ = 0;
+};
+
+CYBER_REGISTER_COMPONENT(VelodynePipelineComponent)
+
+}  // namespace velodyne
+}  // namespace drivers
+}  // namespace apollo
@@ -35,37 +35,63 @@ bool GuardianComponent::Init() {
   chassis_reader_ = node_->CreateReader<Chassis>(
       FLAGS_chassis_topic, [this](const std::shared_ptr<Chassis>& chassis) {
         ADEBUG << "Received chassis data: run chassis callback.";
-        std::lock_guard<std::mutex> lock(mutex_);
-        chassis_.CopyFrom(*chassis);
+        chassis_.back()->CopyFrom(*chassis);
+        chassis_.Publish();
       });
 
   control_cmd_reader_ = node_->CreateReader<ControlCommand>(
       FLAGS_control_command_topic,
       [this](const std::shared_ptr<ControlCommand>& cmd) {
         ADEBUG << "Received control data: run control callback.";
-        std::lock_guard<std::mutex> lock(mutex_);
-        control_cmd_.CopyFrom(*cmd);
+        control_cmd_.back()->CopyFrom(*cmd);
+        control_cmd_.Publish();
       });
 
   system_status_reader_ = node_->CreateReader<SystemStatus>(
       FLAGS_system_status_topic,
       [this](const std::shared_ptr<SystemStatus>& status) {
         ADEBUG << "Received system status data: run system status callback.";
-        std::lock_guard<std::mutex> lock(mutex_);
-        system_status_.CopyFrom(*status);
+        system_status_.back()->CopyFrom(*status);
+        system_status_.Publish();
       });
 
   guardian_writer_ = node_->CreateWriter<GuardianCommand>(FLAGS_guardian_topic);
 
+  if (guardian_conf_.realtime_thread().enable()) {
+    AINFO << "Guard on a realtime thread: "
+          << guardian_conf_.realtime_thread().ShortDebugString();
+    realtime_loop_.reset(new common::util::RealtimeLoop(
+        guardian_conf_.realtime_thread(), [this]() { Guard(); }));
+    realtime_loop_->Start();
+  }
   return true;
 }
 
+void GuardianComponent::Clear() {
+  if (realtime_loop_ != nullptr) {
+    realtime_loop_->Stop();
+    AINFO << "The realtime guardian overran " << realtime_loop_->overruns()
+          << " periods.";
+  }
+}
+
 bool GuardianComponent::Proc() {
-  ADEBUG << "Timer is triggered: publish GuardianComponent result";
+  if (realtime_loop_ == nullptr) {
+    ADEBUG << "Timer is triggered: publish GuardianComponent result";
+    Guard();
+  }
+  return true;
+}
+
+void GuardianComponent::Guard() {
+  chassis_.Update();
+  control_cmd_.Update();
+  system_status_.Update();
+
   bool safety_mode_triggered = false;
   if (guardian_conf_.guardian_enable()) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    safety_mode_triggered = system_status_.has_safety_mode_trigger_time();
+    safety_mode_triggered =
+        system_status_.front().has_safety_mode_trigger_time();
   }
 
   if (safety_mode_triggered) {
@@ -78,30 +104,28 @@ bool GuardianComponent::Proc() {
 
   common::util::FillHeader(node_->Name(), &guardian_cmd_);
   guardian_writer_->Write(std::make_shared<GuardianCommand>(guardian_cmd_));
-  return true;
 }
 
 void GuardianComponent::PassThroughControlCommand() {
-  std::lock_guard<std::mutex> lock(mutex_);
-  guardian_cmd_.mutable_control_command()->CopyFrom(control_cmd_);
+  guardian_cmd_.mutable_control_command()->CopyFrom(control_cmd_.front());
 }
 
 void GuardianComponent::TriggerSafetyMode() {
+  const Chassis& chassis = chassis_.front();
+  const SystemStatus& system_status = system_status_.front();
   AINFO << "Safety state triggered, with system safety mode trigger time : "
-        << system_status_.safety_mode_trigger_time();
-  std::lock_guard<std::mutex> lock(mutex_);
+        << system_status.safety_mode_trigger_time();
   bool sensor_malfunction = false, obstacle_detected = false;
-  if (!chassis_.surround().sonar_enabled() ||
-      chassis_.surround().sonar_fault()) {
+  if (!chassis.surround().sonar_enabled() || chassis.surround().sonar_fault()) {
     AINFO << "Ultrasonic sensor not enabled for faulted, will do emergency "
              "stop!";
     sensor_malfunction = true;
   } else {
     // TODO(QiL) : Load for config
-    for (int i = 0; i < chassis_.surround().sonar_range_size(); ++i) {
-      if ((chassis_.surround().sonar_range(i) > 0.0 &&
-           chassis_.surround().sonar_range(i) < 2.5) ||
-          chassis_.surround().sonar_range(i) > 30) {
+    for (int i = 0; i < chassis.surround().sonar_range_size(); ++i) {
+      if ((chassis.surround().sonar_range(i) > 0.0 &&
+           chassis.surround().sonar_range(i) < 2.5) ||
+          chassis.surround().sonar_range(i) > 30) {
         AINFO << "Object detected or ultrasonic sensor fault output, will do "
                  "emergency stop!";
         obstacle_detected = true;
@@ -120,15 +144,15 @@ void GuardianComponent::TriggerSafetyMode() {
   AINFO << "Temporarily ignore the ultrasonic sensor output during hardware "
            "re-alignment!";
 
-  if (system_status_.require_emergency_stop() || sensor_malfunction ||
+  if (system_status.require_emergency_stop() || sensor_malfunction ||
       obstacle_detected) {
     AINFO << "Emergency stop triggered! with system status from monitor as : "
-          << system_status_.require_emergency_stop();
+          << system_status.require_emergency_stop();
     guardian_cmd_.mutable_control_command()->set_brake(
         guardian_conf_.guardian_cmd_emergency_stop_percentage());
   } else {
     AINFO << "Soft stop triggered! with system status from monitor as : "
-          << system_status_.require_emergency_stop();
+          << system_status.require_emergency_stop();
     guardian_cmd_.mutable_control_command()->set_brake(
         guardian_conf_.guardian_cmd_soft_stop_percentage());
   }
@@ -22,11 +22,13 @@
 
 #include <memory>
 
+#include "cyber/base/triple_buffer.h"
 #include "cyber/common/macros.h"
 #include "cyber/component/timer_component.h"
 #include "cyber/cyber.h"
 
 #include "modules/canbus/proto/chassis.pb.h"
+#include "modules/common/util/realtime_loop.h"
 #include "modules/control/proto/control_cmd.pb.h"
 #include "modules/guardian/proto/guardian.pb.h"
 #include "modules/guardian/proto/guardian_conf.pb.h"
@@ -45,13 +47,18 @@ class GuardianComponent : public apollo::cyber::TimerComponent {
   bool Proc() override;
 
  private:
+  void Clear() override;
+  void Guard();
   void PassThroughControlCommand();
   void TriggerSafetyMode();
 
   apollo::guardian::GuardianConf guardian_conf_;
-  apollo::canbus::Chassis chassis_;
-  apollo::monitor::SystemStatus system_status_;
-  apollo::control::ControlCommand control_cmd_;
+  // the latest inputs, published by the reader callbacks and taken by Guard
+  apollo::cyber::base::TripleBuffer<apollo::canbus::Chassis> chassis_;
+  apollo::cyber::base::TripleBuffer<apollo::monitor::SystemStatus>
+      system_status_;
+  apollo::cyber::base::TripleBuffer<apollo::control::ControlCommand>
+      control_cmd_;
   apollo::guardian::GuardianCommand guardian_cmd_;
 
   std::shared_ptr<apollo::cyber::Reader<apollo::canbus::Chassis>>
@@ -63,7 +70,7 @@ class GuardianComponent : public apollo::cyber::TimerComponent {
   std::shared_ptr<apollo::cyber::Writer<apollo::guardian::GuardianCommand>>
       guardian_writer_;
 
-  std::mutex mutex_;
+  std::unique_ptr<apollo::common::util::RealtimeLoop> realtime_loop_;
 };
 
 CYBER_REGISTER_COMPONENT(GuardianComponent)
@@ -88,6 +88,13 @@ DEFINE_double(lidar_imu_max_delay_time, 0.4,
 DEFINE_double(lidar_map_coverage_theshold, 0.9,
               "Threshold to detect wether vehicle is out of map");
 DEFINE_bool(lidar_debug_log_flag, false, "Lidar Debug switch.");
+DEFINE_double(lidar_map_prefetch_horizon, 0.0,
+              "seconds, preload the map nodes along the predicted path this "
+              "far ahead, 0 to disable");
+DEFINE_int32(lidar_map_prefetch_max_loads, 4,
+             "maximum number of map node loads in flight for prefetching");
+DEFINE_int32(lidar_map_compose_threads, 1,
+             "number of threads composing the map window of every frame");
 DEFINE_int32(point_cloud_step, 2, "Point cloud step");
 DEFINE_bool(if_use_avx, false,
             "if use avx to accelerate lidar localization, "
@@ -131,6 +138,9 @@ DEFINE_bool(enable_lidar_localization, true,
 
 DEFINE_string(lidar_topic, "/apollo/sensor/lidar128/compensator/PointCloud2",
               "lidar pointcloud topic");
+DEFINE_string(lidar_buffer_topic, "",
+              "intra process channel of the decoded lidar pointcloud, read "
+              "instead of lidar_topic if set");
 DEFINE_string(broadcast_tf_frame_id, "world", "world frame id in tf");
 DEFINE_string(broadcast_tf_child_frame_id, "localization",
               "localization frame id in tf");
@@ -191,6 +201,8 @@ DEFINE_double(ndt_line_search_step_size, 0.1,
               "line search step size for ndt matching");
 DEFINE_double(ndt_transformation_epsilon, 0.01,
               "iteration convergence condition on transformation");
+DEFINE_int32(ndt_num_threads, 1,
+             "number of threads accumulating the ndt matching derivatives");
 DEFINE_int32(ndt_filter_size_x, 48, "x size for ndt searching area");
 DEFINE_int32(ndt_filter_size_y, 48, "y size for ndt searching area");
 DEFINE_int32(ndt_bad_score_count_threshold, 10,
@@ -60,6 +60,9 @@ DECLARE_int32(lidar_filter_size);
 DECLARE_double(lidar_imu_max_delay_time);
 DECLARE_double(lidar_map_coverage_theshold);
 DECLARE_bool(lidar_debug_log_flag);
+DECLARE_double(lidar_map_prefetch_horizon);
+DECLARE_int32(lidar_map_prefetch_max_loads);
+DECLARE_int32(lidar_map_compose_threads);
 DECLARE_int32(point_cloud_step);
 DECLARE_bool(if_use_avx);
 
@@ -95,6 +98,7 @@ DECLARE_bool(gnss_only_init);
 DECLARE_bool(enable_lidar_localization);
 
 DECLARE_string(lidar_topic);
+DECLARE_string(lidar_buffer_topic);
 DECLARE_string(broadcast_tf_frame_id);
 DECLARE_string(broadcast_tf_child_frame_id);
 
@@ -135,6 +139,7 @@ DECLARE_int32(ndt_max_iterations);
 DECLARE_double(ndt_target_resolution);
 DECLARE_double(ndt_line_search_step_size);
 DECLARE_double(ndt_transformation_epsilon);
+DECLARE_int32(ndt_num_threads);
 DECLARE_int32(ndt_filter_size_x);
 DECLARE_int32(ndt_filter_size_y);
 DECLARE_int32(ndt_bad_score_count_threshold);
@@ -0,0 +1,438 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Replays a cyber record through one of the localization pipelines
+ *        offline, as fast as the pipeline runs, and reports the latency of
+ *        every stage, the map node cache statistics and the position error
+ *        against a ground truth pose channel of the record.
+ *
+ * Example:
+ *   localization_benchmark \
+ *     --flagfile=/apollo/modules/localization/conf/localization.conf \
+ *     --benchmark_pipeline=msf --benchmark_record=/apollo/data/test.record
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "gflags/gflags.h"
+
+#include "cyber/cyber.h"
+#include "cyber/record/record_reader.h"
+#include "modules/common/adapters/adapter_gflags.h"
+#include "modules/common/util/file.h"
+#include "modules/localization/common/localization_gflags.h"
+#include "modules/localization/msf/msf_localization.h"
+#include "modules/localization/msf/msf_localization_component.h"
+#include "modules/localization/ndt/ndt_localization.h"
+#include "modules/localization/rtk/rtk_localization.h"
+
+DEFINE_string(benchmark_record, "", "cyber record to replay");
+DEFINE_string(benchmark_pipeline, "msf", "rtk, ndt or msf");
+DEFINE_string(benchmark_ground_truth_topic, "/apollo/localization/pose",
+              "channel of the reference poses in the record");
+DEFINE_double(benchmark_ground_truth_max_dt, 0.02,
+              "max time in seconds between an estimate and its reference");
+DEFINE_string(benchmark_rtk_config,
+              "/apollo/modules/localization/conf/rtk_localization.pb.txt",
+              "config of the rtk pipeline");
+
+namespace apollo {
+namespace localization {
+namespace {
+
+struct PoseSample {
+  double time = 0.0;
+  double x = 0.0;
+  double y = 0.0;
+  double z = 0.0;
+};
+
+PoseSample ToPoseSample(const LocalizationEstimate& localization) {
+  PoseSample sample;
+  sample.time = localization.measurement_time();
+  sample.x = localization.pose().position().x();
+  sample.y = localization.pose().position().y();
+  sample.z = localization.pose().position().z();
+  return sample;
+}
+
+double Percentile(std::vector<double> values, const double ratio) {
+  if (values.empty()) {
+    return 0.0;
+  }
+  const size_t index = std::min(
+      static_cast<size_t>(ratio * static_cast<double>(values.size())),
+      values.size() - 1);
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+
+double Mean(const std::vector<double>& values) {
+  if (values.empty()) {
+    return 0.0;
+  }
+  double sum = 0.0;
+  for (const double value : values) {
+    sum += value;
+  }
+  return sum / static_cast<double>(values.size());
+}
+
+// Feeds a localization pipeline with the messages of its channels, timing
+// every callback under the stage it belongs to.
+class Pipeline {
+ public:
+  virtual ~Pipeline() = default;
+
+  virtual bool Init() = 0;
+
+  virtual bool GetMapCacheStats(msf::MapNodeCacheStats* stats) {
+    return false;
+  }
+
+  void OnMessage(const std::string& channel, const std::string& content) {
+    const auto itr = handlers_.find(channel);
+    if (itr != handlers_.end()) {
+      itr->second(content);
+    }
+  }
+
+  const std::map<std::string, std::vector<double>>& stage_latencies_us()
+      const {
+    return stage_latencies_us_;
+  }
+
+  const std::vector<PoseSample>& estimates() const { return estimates_; }
+
+ protected:
+  template <typename T>
+  void Subscribe(const std::string& channel, const std::string& stage,
+                 const std::function<void(const std::shared_ptr<T>&)>& func) {
+    std::vector<double>* latencies_us = &stage_latencies_us_[stage];
+    handlers_[channel] = [func, latencies_us](const std::string& content) {
+      auto message = std::make_shared<T>();
+      if (!message->ParseFromString(content)) {
+        return;
+      }
+      const auto start = std::chrono::steady_clock::now();
+      func(message);
+      const auto end = std::chrono::steady_clock::now();
+      latencies_us->push_back(
+          std::chrono::duration<double, std::micro>(end - start).count());
+    };
+  }
+
+  void AddEstimate(const LocalizationEstimate& localization) {
+    estimates_.push_back(ToPoseSample(localization));
+  }
+
+ private:
+  std::unordered_map<std::string, std::function<void(const std::string&)>>
+      handlers_;
+  std::map<std::string, std::vector<double>> stage_latencies_us_;
+  std::vector<PoseSample> estimates_;
+};
+
+class RTKPipeline : public Pipeline {
+ public:
+  bool Init() override {
+    rtk_config::Config config;
+    if (!common::util::GetProtoFromFile(FLAGS_benchmark_rtk_config, &config)) {
+      AERROR << "Failed to load " << FLAGS_benchmark_rtk_config;
+      return false;
+    }
+    localization_.InitConfig(config);
+    Subscribe<localization::Gps>(
+        config.gps_topic(), "gnss fusion",
+        [this](const std::shared_ptr<localization::Gps>& msg) {
+          localization_.GpsCallback(msg);
+          if (localization_.IsServiceStarted()) {
+            LocalizationEstimate localization;
+            localization_.GetLocalization(&localization);
+            AddEstimate(localization);
+          }
+        });
+    Subscribe<drivers::gnss::InsStat>(
+        config.gps_status_topic(), "gnss status",
+        [this](const std::shared_ptr<drivers::gnss::InsStat>& msg) {
+          localization_.GpsStatusCallback(msg);
+        });
+    Subscribe<localization::CorrectedImu>(
+        config.imu_topic(), "imu",
+        [this](const std::shared_ptr<localization::CorrectedImu>& msg) {
+          localization_.ImuCallback(msg);
+        });
+    return true;
+  }
+
+ private:
+  RTKLocalization localization_;
+};
+
+class NDTPipeline : public Pipeline {
+ public:
+  bool Init() override {
+    localization_.Init();
+    Subscribe<drivers::PointCloud>(
+        FLAGS_lidar_topic, "lidar match",
+        [this](const std::shared_ptr<drivers::PointCloud>& msg) {
+          localization_.LidarCallback(msg);
+        });
+    Subscribe<localization::Gps>(
+        FLAGS_gps_topic, "odometry fusion",
+        [this](const std::shared_ptr<localization::Gps>& msg) {
+          localization_.OdometryCallback(msg);
+          if (localization_.IsServiceStarted()) {
+            LocalizationEstimate localization;
+            localization_.GetLocalization(&localization);
+            AddEstimate(localization);
+          }
+        });
+    Subscribe<drivers::gnss::InsStat>(
+        FLAGS_ins_stat_topic, "odometry status",
+        [this](const std::shared_ptr<drivers::gnss::InsStat>& msg) {
+          localization_.OdometryStatusCallback(msg);
+        });
+    return true;
+  }
+
+  bool GetMapCacheStats(msf::MapNodeCacheStats* stats) override {
+    *stats = localization_.GetMapCacheStats();
+    return true;
+  }
+
+ private:
+  ndt::NDTLocalization localization_;
+};
+
+class MSFPipeline : public Pipeline {
+ public:
+  explicit MSFPipeline(const std::shared_ptr<cyber::Node>& node)
+      : publisher_(new LocalizationMsgPublisher(node)) {}
+
+  bool Init() override {
+    if (!publisher_->InitConfig() || !publisher_->InitIO()) {
+      AERROR << "Failed to init the msf publisher.";
+      return false;
+    }
+    if (!localization_.Init().ok()) {
+      AERROR << "Failed to init the msf localization.";
+      return false;
+    }
+    localization_.SetPublisher(publisher_);
+    Subscribe<drivers::PointCloud>(
+        FLAGS_lidar_topic, "lidar match",
+        [this](const std::shared_ptr<drivers::PointCloud>& msg) {
+          localization_.OnPointCloud(msg);
+        });
+    Subscribe<drivers::gnss::Imu>(
+        FLAGS_raw_imu_topic, "sins",
+        [this](const std::shared_ptr<drivers::gnss::Imu>& msg) {
+          localization_.OnRawImu(msg);
+          const auto& result = localization_.GetLastestIntegLocalization();
+          if (result.state() == msf::LocalizationMeasureState::OK ||
+              result.state() == msf::LocalizationMeasureState::VALID) {
+            AddEstimate(result.localization());
+          }
+        });
+    Subscribe<drivers::gnss::GnssBestPose>(
+        FLAGS_gnss_best_pose_topic, "gnss fusion",
+        [this](const std::shared_ptr<drivers::gnss::GnssBestPose>& msg) {
+          localization_.OnGnssBestPose(msg);
+        });
+    Subscribe<drivers::gnss::Heading>(
+        FLAGS_heading_topic, "gnss heading",
+        [this](const std::shared_ptr<drivers::gnss::Heading>& msg) {
+          localization_.OnGnssHeading(msg);
+        });
+    return true;
+  }
+
+  bool GetMapCacheStats(msf::MapNodeCacheStats* stats) override {
+    *stats = localization_.GetMapCacheStats();
+    return true;
+  }
+
+ private:
+  std::shared_ptr<LocalizationMsgPublisher> publisher_;
+  MSFLocalization localization_;
+};
+
+void ReportLatencies(const Pipeline& pipeline) {
+  std::cout << std::left << std::setw(20) << "stage" << std::right
+            << std::setw(10) << "count" << std::setw(12) << "mean us"
+            << std::setw(12) << "p50 us" << std::setw(12) << "p99 us"
+            << std::setw(12) << "max us" << std::endl;
+  for (const auto& stage : pipeline.stage_latencies_us()) {
+    const std::vector<double>& latencies = stage.second;
+    std::cout << std::left << std::setw(20) << stage.first << std::right
+              << std::setw(10) << latencies.size() << std::fixed
+              << std::setprecision(1) << std::setw(12) << Mean(latencies)
+              << std::setw(12) << Percentile(latencies, 0.5) << std::setw(12)
+              << Percentile(latencies, 0.99) << std::setw(12)
+              << Percentile(latencies, 1.0) << std::endl;
+  }
+}
+
+void ReportMapCache(Pipeline* pipeline) {
+  msf::MapNodeCacheStats stats;
+  if (!pipeline->GetMapCacheStats(&stats)) {
+    return;
+  }
+  const uint64_t needed =
+      stats.l1_hits + stats.l2_hits + stats.late_preloads + stats.misses;
+  const double scale = needed > 0 ? 100.0 / static_cast<double>(needed) : 0.0;
+  std::cout << std::fixed << std::setprecision(2)
+            << "map nodes needed " << needed << ", l1 hits "
+            << scale * stats.l1_hits << "%, l2 hits " << scale * stats.l2_hits
+            << "%, late preloads " << scale * stats.late_preloads
+            << "%, misses " << scale * stats.misses << "%, prefetches "
+            << stats.prefetches << ", dropped prefetches "
+            << stats.dropped_prefetches << std::endl;
+}
+
+void ReportAccuracy(const std::vector<PoseSample>& estimates,
+                    std::vector<PoseSample> ground_truth) {
+  std::sort(ground_truth.begin(), ground_truth.end(),
+            [](const PoseSample& a, const PoseSample& b) {
+              return a.time < b.time;
+            });
+  std::vector<double> horizontal_errors;
+  std::vector<double> vertical_errors;
+  for (const PoseSample& estimate : estimates) {
+    if (ground_truth.empty()) {
+      break;
+    }
+    // the nearest reference in time
+    auto itr = std::lower_bound(
+        ground_truth.begin(), ground_truth.end(), estimate,
+        [](const PoseSample& a, const PoseSample& b) {
+          return a.time < b.time;
+        });
+    if (itr == ground_truth.end() ||
+        (itr != ground_truth.begin() &&
+         estimate.time - (itr - 1)->time < itr->time - estimate.time)) {
+      --itr;
+    }
+    if (std::fabs(itr->time - estimate.time) >
+        FLAGS_benchmark_ground_truth_max_dt) {
+      continue;
+    }
+    horizontal_errors.push_back(
+        std::hypot(estimate.x - itr->x, estimate.y - itr->y));
+    vertical_errors.push_back(std::fabs(estimate.z - itr->z));
+  }
+  std::cout << "estimates " << estimates.size() << ", matched to ground truth "
+            << horizontal_errors.size() << std::endl;
+  if (horizontal_errors.empty()) {
+    return;
+  }
+  std::cout << std::left << std::setw(20) << "error" << std::right
+            << std::setw(12) << "mean m" << std::setw(12) << "p50 m"
+            << std::setw(12) << "p99 m" << std::setw(12) << "max m"
+            << std::endl;
+  for (const auto& errors :
+       {std::make_pair("horizontal", &horizontal_errors),
+        std::make_pair("vertical", &vertical_errors)}) {
+    std::cout << std::left << std::setw(20) << errors.first << std::right
+              << std::fixed << std::setprecision(3) << std::setw(12)
+              << Mean(*errors.second) << std::setw(12)
+              << Percentile(*errors.second, 0.5) << std::setw(12)
+              << Percentile(*errors.second, 0.99) << std::setw(12)
+              << Percentile(*errors.second, 1.0) << std::endl;
+  }
+}
+
+int Run() {
+  std::unique_ptr<Pipeline> pipeline;
+  if (FLAGS_benchmark_pipeline == "rtk") {
+    pipeline.reset(new RTKPipeline());
+  } else if (FLAGS_benchmark_pipeline == "ndt") {
+    pipeline.reset(new NDTPipeline());
+  } else if (FLAGS_benchmark_pipeline == "msf") {
+    pipeline.reset(
+        new MSFPipeline(cyber::CreateNode("localization_benchmark")));
+  } else {
+    AERROR << "Unknown pipeline " << FLAGS_benchmark_pipeline;
+    return -1;
+  }
+  if (!pipeline->Init()) {
+    return -1;
+  }
+
+  cyber::record::RecordReader reader(FLAGS_benchmark_record);
+  if (!reader.IsValid()) {
+    AERROR << "Failed to open " << FLAGS_benchmark_record;
+    return -1;
+  }
+  std::vector<PoseSample> ground_truth;
+  uint64_t first_message_time = 0;
+  uint64_t last_message_time = 0;
+  cyber::record::RecordMessage message;
+  const auto start = std::chrono::steady_clock::now();
+  while (reader.ReadMessage(&message)) {
+    if (first_message_time == 0) {
+      first_message_time = message.time;
+    }
+    last_message_time = message.time;
+    if (message.channel_name == FLAGS_benchmark_ground_truth_topic) {
+      LocalizationEstimate localization;
+      if (localization.ParseFromString(message.content)) {
+        ground_truth.push_back(ToPoseSample(localization));
+      }
+      continue;
+    }
+    pipeline->OnMessage(message.channel_name, message.content);
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  const double replay_sec = std::chrono::duration<double>(end - start).count();
+  const double record_sec =
+      static_cast<double>(last_message_time - first_message_time) * 1e-9;
+  std::cout << std::fixed << std::setprecision(2) << "replayed "
+            << record_sec << " s of record in " << replay_sec << " s, "
+            << record_sec / std::max(replay_sec, 1e-9) << "x real time"
+            << std::endl;
+  ReportLatencies(*pipeline);
+  ReportMapCache(pipeline.get());
+  ReportAccuracy(pipeline->estimates(), std::move(ground_truth));
+  return 0;
+}
+
+}  // namespace
+}  // namespace localization
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  apollo::cyber::Init(argv[0]);
+  const int ret = apollo::localization::Run();
+  apollo::cyber::Clear();
+  return ret;
+}
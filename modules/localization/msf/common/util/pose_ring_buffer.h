@@ -0,0 +1,197 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "Eigen/Core"
+#include "Eigen/Geometry"
+#include "Eigen/StdVector"
+
+namespace apollo {
+namespace localization {
+namespace msf {
+
+/**@brief A bounded ring of poses with increasing timestamps. The pose at a
+ * time between the oldest and the newest one is interpolated between its two
+ * bracketing poses, found by binary search over the timestamps. The fields
+ * are stored in separate arrays so that the interpolation only touches
+ * contiguous memory. */
+class PoseRingBuffer {
+ public:
+  /**@brief The constructor. */
+  explicit PoseRingBuffer(size_t capacity)
+      : capacity_(capacity > 0 ? capacity : 1),
+        timestamps_(capacity_),
+        translations_(capacity_),
+        rotations_(capacity_) {}
+  /**@brief Append a pose newer than the buffered ones, overwriting the
+   * oldest one when full. Return false if the timestamp is not newer. */
+  bool Push(double timestamp, const Eigen::Affine3d& pose);
+  /**@brief Interpolate the pose at a time, return false if the time is not
+   * within the buffered poses. */
+  bool Interpolate(double timestamp, Eigen::Affine3d* pose) const;
+  /**@brief Interpolate the poses at increasing times, e.g. of the points of
+   * a lidar sweep. The bracket of a time is searched forward from the
+   * previous one, so it costs O(1) per time. Return false if a time is not
+   * within the buffered poses. */
+  bool InterpolateSorted(
+      const std::vector<double>& timestamps,
+      std::vector<Eigen::Affine3d, Eigen::aligned_allocator<Eigen::Affine3d>>*
+          poses) const;
+  /**@brief Drop all the poses. */
+  void Clear() {
+    head_ = 0;
+    size_ = 0;
+  }
+  /**@brief The number of buffered poses. */
+  size_t Size() const { return size_; }
+  /**@brief The maximum number of poses. */
+  size_t Capacity() const { return capacity_; }
+  /**@brief The time of the oldest pose, the buffer must not be empty. */
+  double FrontTimestamp() const { return timestamps_[head_]; }
+  /**@brief The time of the newest pose, the buffer must not be empty. */
+  double BackTimestamp() const { return timestamps_[Slot(size_ - 1)]; }
+
+ private:
+  /**@brief The slot of the i-th oldest pose. */
+  size_t Slot(size_t i) const {
+    const size_t slot = head_ + i;
+    return slot < capacity_ ? slot : slot - capacity_;
+  }
+  /**@brief The index of the first pose newer than the time. */
+  size_t UpperBound(double timestamp) const;
+  /**@brief Interpolate between the poses i - 1 and i. */
+  void InterpolateAt(size_t i, double timestamp, Eigen::Affine3d* pose) const;
+
+  size_t capacity_;
+  size_t head_ = 0;
+  size_t size_ = 0;
+  std::vector<double> timestamps_;
+  std::vector<Eigen::Vector3d> translations_;
+  std::vector<Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>>
+      rotations_;
+};
+
+inline bool PoseRingBuffer::Push(double timestamp,
+                                 const Eigen::Affine3d& pose) {
+  if (size_ > 0 && timestamp <= BackTimestamp()) {
+    return false;
+  }
+  size_t slot = 0;
+  if (size_ < capacity_) {
+    slot = Slot(size_);
+    ++size_;
+  } else {
+    slot = head_;
+    head_ = Slot(1);
+  }
+  timestamps_[slot] = timestamp;
+  translations_[slot] = pose.translation();
+  rotations_[slot] = Eigen::Quaterniond(pose.linear()).normalized();
+  return true;
+}
+
+inline size_t PoseRingBuffer::UpperBound(double timestamp) const {
+  size_t first = 0;
+  size_t count = size_;
+  while (count > 0) {
+    const size_t step = count / 2;
+    if (timestamps_[Slot(first + step)] <= timestamp) {
+      first += step + 1;
+      count -= step + 1;
+    } else {
+      count = step;
+    }
+  }
+  return first;
+}
+
+inline void PoseRingBuffer::InterpolateAt(size_t i, double timestamp,
+                                          Eigen::Affine3d* pose) const {
+  const size_t prev = Slot(i - 1);
+  const size_t next = Slot(i);
+  const double ratio = (timestamp - timestamps_[prev]) /
+                       (timestamps_[next] - timestamps_[prev]);
+  // normalized lerp on the shorter arc, as accurate as slerp for the small
+  // rotations between consecutive poses and free of trigonometry
+  const Eigen::Vector4d& q0 = rotations_[prev].coeffs();
+  Eigen::Vector4d q1 = rotations_[next].coeffs();
+  if (q0.dot(q1) < 0.0) {
+    q1 = -q1;
+  }
+  const Eigen::Vector4d q = (q0 + ratio * (q1 - q0)).normalized();
+  pose->linear() = Eigen::Quaterniond(q).toRotationMatrix();
+  pose->translation() =
+      translations_[prev] + ratio * (translations_[next] - translations_[prev]);
+  pose->makeAffine();
+}
+
+inline bool PoseRingBuffer::Interpolate(double timestamp,
+                                        Eigen::Affine3d* pose) const {
+  if (size_ == 0 || timestamp < FrontTimestamp() ||
+      timestamp > BackTimestamp()) {
+    return false;
+  }
+  if (size_ == 1) {
+    pose->linear() = rotations_[head_].toRotationMatrix();
+    pose->translation() = translations_[head_];
+    pose->makeAffine();
+    return true;
+  }
+  // the newest pose brackets its own time with the previous one
+  const size_t i = std::min(std::max(UpperBound(timestamp), size_t(1)),
+                            size_ - 1);
+  InterpolateAt(i, timestamp, pose);
+  return true;
+}
+
+inline bool PoseRingBuffer::InterpolateSorted(
+    const std::vector<double>& timestamps,
+    std::vector<Eigen::Affine3d, Eigen::aligned_allocator<Eigen::Affine3d>>*
+        poses) const {
+  poses->resize(timestamps.size());
+  if (timestamps.empty()) {
+    return true;
+  }
+  if (size_ == 0 || timestamps.front() < FrontTimestamp() ||
+      timestamps.back() > BackTimestamp()) {
+    return false;
+  }
+  if (size_ == 1) {
+    for (size_t k = 0; k < timestamps.size(); ++k) {
+      Interpolate(timestamps[k], &(*poses)[k]);
+    }
+    return true;
+  }
+  size_t i = std::min(std::max(UpperBound(timestamps.front()), size_t(1)),
+                      size_ - 1);
+  for (size_t k = 0; k < timestamps.size(); ++k) {
+    while (i < size_ - 1 && timestamps_[Slot(i)] <= timestamps[k]) {
+      ++i;
+    }
+    InterpolateAt(i, timestamps[k], &(*poses)[k]);
+  }
+  return true;
+}
+
+}  // namespace msf
+}  // namespace localization
+}  // namespace apollo
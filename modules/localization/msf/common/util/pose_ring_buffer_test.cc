@@ -0,0 +1,111 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/localization/msf/common/util/pose_ring_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace apollo {
+namespace localization {
+namespace msf {
+
+namespace {
+
+Eigen::Affine3d MakePose(double x, double yaw) {
+  Eigen::Affine3d pose = Eigen::Affine3d::Identity();
+  pose.translation() = Eigen::Vector3d(x, 2.0 * x, 0.0);
+  pose.linear() =
+      Eigen::AngleAxisd(yaw, Eigen::Vector3d::UnitZ()).toRotationMatrix();
+  return pose;
+}
+
+double Yaw(const Eigen::Affine3d& pose) {
+  return std::atan2(pose.linear()(1, 0), pose.linear()(0, 0));
+}
+
+}  // namespace
+
+TEST(PoseRingBufferTest, PushAndWrap) {
+  PoseRingBuffer buffer(3);
+  EXPECT_EQ(3, buffer.Capacity());
+  Eigen::Affine3d pose;
+  EXPECT_FALSE(buffer.Interpolate(0.0, &pose));
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(buffer.Push(i, MakePose(i, 0.0)));
+  }
+  EXPECT_FALSE(buffer.Push(4.0, MakePose(0.0, 0.0)));
+  EXPECT_EQ(3, buffer.Size());
+  EXPECT_DOUBLE_EQ(2.0, buffer.FrontTimestamp());
+  EXPECT_DOUBLE_EQ(4.0, buffer.BackTimestamp());
+  EXPECT_FALSE(buffer.Interpolate(1.5, &pose));
+  EXPECT_FALSE(buffer.Interpolate(4.5, &pose));
+  EXPECT_TRUE(buffer.Interpolate(2.0, &pose));
+  EXPECT_NEAR(2.0, pose.translation().x(), 1e-9);
+  EXPECT_TRUE(buffer.Interpolate(4.0, &pose));
+  EXPECT_NEAR(4.0, pose.translation().x(), 1e-9);
+  EXPECT_TRUE(buffer.Interpolate(3.25, &pose));
+  EXPECT_NEAR(3.25, pose.translation().x(), 1e-9);
+  EXPECT_NEAR(6.5, pose.translation().y(), 1e-9);
+
+  buffer.Clear();
+  EXPECT_EQ(0, buffer.Size());
+  EXPECT_TRUE(buffer.Push(1.0, MakePose(1.0, 0.0)));
+  EXPECT_TRUE(buffer.Interpolate(1.0, &pose));
+  EXPECT_NEAR(1.0, pose.translation().x(), 1e-9);
+}
+
+TEST(PoseRingBufferTest, InterpolateRotation) {
+  PoseRingBuffer buffer(4);
+  // the yaw crosses +-pi between the poses
+  buffer.Push(0.0, MakePose(0.0, M_PI - 0.1));
+  buffer.Push(1.0, MakePose(1.0, -M_PI + 0.1));
+  Eigen::Affine3d pose;
+  EXPECT_TRUE(buffer.Interpolate(0.5, &pose));
+  EXPECT_NEAR(M_PI, std::fabs(Yaw(pose)), 1e-9);
+  EXPECT_TRUE(buffer.Interpolate(0.25, &pose));
+  EXPECT_NEAR(M_PI - 0.05, Yaw(pose), 1e-3);
+}
+
+TEST(PoseRingBufferTest, InterpolateSorted) {
+  PoseRingBuffer buffer(8);
+  for (int i = 0; i < 12; ++i) {
+    buffer.Push(0.1 * i, MakePose(i, 0.05 * i));
+  }
+  std::vector<double> timestamps;
+  for (double t = 0.4; t <= 1.1; t += 0.013) {
+    timestamps.push_back(t);
+  }
+  timestamps.push_back(1.1);
+  std::vector<Eigen::Affine3d, Eigen::aligned_allocator<Eigen::Affine3d>>
+      poses;
+  EXPECT_TRUE(buffer.InterpolateSorted(timestamps, &poses));
+  ASSERT_EQ(timestamps.size(), poses.size());
+  for (size_t k = 0; k < timestamps.size(); ++k) {
+    Eigen::Affine3d pose;
+    EXPECT_TRUE(buffer.Interpolate(timestamps[k], &pose));
+    EXPECT_TRUE(pose.isApprox(poses[k], 1e-9));
+  }
+  timestamps.push_back(1.2);
+  EXPECT_FALSE(buffer.InterpolateSorted(timestamps, &poses));
+}
+
+}  // namespace msf
+}  // namespace localization
+}  // namespace apollo
@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace apollo {
+namespace localization {
+namespace msf {
+
+/**@brief A bounded lock free queue between a single producer thread and a
+ * single consumer thread. The slots are allocated once, push and pop only
+ * copy the element and publish the new position. */
+template <typename T>
+class SpscRingBuffer {
+ public:
+  /**@brief The constructor. */
+  explicit SpscRingBuffer(size_t capacity)
+      : slots_(capacity > 0 ? capacity : 1), head_(0), tail_(0) {}
+  /**@brief Called by the producer, return false if the buffer is full. */
+  bool TryPush(const T& element);
+  /**@brief Called by the consumer, the oldest element or nullptr if the
+   * buffer is empty. It stays valid until Pop. */
+  const T* Front() const;
+  /**@brief Called by the consumer, drop the oldest element. */
+  void Pop();
+  /**@brief Called by the consumer, move the oldest element to element,
+   * return false if the buffer is empty. */
+  bool TryPop(T* element);
+  /**@brief The number of elements, exact from the consumer thread. */
+  size_t Size() const;
+  /**@brief The maximum number of elements. */
+  size_t Capacity() const { return slots_.size(); }
+
+ private:
+  std::vector<T> slots_;
+  /**@brief The number of elements popped, written by the consumer. */
+  alignas(64) std::atomic<size_t> head_;
+  /**@brief The number of elements pushed, written by the producer. */
+  alignas(64) std::atomic<size_t> tail_;
+};
+
+template <typename T>
+bool SpscRingBuffer<T>::TryPush(const T& element) {
+  const size_t tail = tail_.load(std::memory_order_relaxed);
+  if (tail - head_.load(std::memory_order_acquire) >= slots_.size()) {
+    return false;
+  }
+  slots_[tail % slots_.size()] = element;
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+const T* SpscRingBuffer<T>::Front() const {
+  const size_t head = head_.load(std::memory_order_relaxed);
+  if (head == tail_.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+  return &slots_[head % slots_.size()];
+}
+
+template <typename T>
+void SpscRingBuffer<T>::Pop() {
+  head_.store(head_.load(std::memory_order_relaxed) + 1,
+              std::memory_order_release);
+}
+
+template <typename T>
+bool SpscRingBuffer<T>::TryPop(T* element) {
+  const T* front = Front();
+  if (front == nullptr) {
+    return false;
+  }
+  *element = *front;
+  Pop();
+  return true;
+}
+
+template <typename T>
+size_t SpscRingBuffer<T>::Size() const {
+  return tail_.load(std::memory_order_acquire) -
+         head_.load(std::memory_order_relaxed);
+}
+
+}  // namespace msf
+}  // namespace localization
+}  // namespace apollo
@@ -0,0 +1,78 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/localization/msf/common/util/spsc_ring_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace apollo {
+namespace localization {
+namespace msf {
+
+TEST(SpscRingBufferTest, PushPop) {
+  SpscRingBuffer<int> buffer(3);
+  EXPECT_EQ(3, buffer.Capacity());
+  EXPECT_EQ(nullptr, buffer.Front());
+  EXPECT_TRUE(buffer.TryPush(1));
+  EXPECT_TRUE(buffer.TryPush(2));
+  EXPECT_TRUE(buffer.TryPush(3));
+  EXPECT_FALSE(buffer.TryPush(4));
+  EXPECT_EQ(3, buffer.Size());
+
+  ASSERT_NE(nullptr, buffer.Front());
+  EXPECT_EQ(1, *buffer.Front());
+  buffer.Pop();
+  EXPECT_TRUE(buffer.TryPush(4));
+
+  int element = 0;
+  for (int expected = 2; expected <= 4; ++expected) {
+    EXPECT_TRUE(buffer.TryPop(&element));
+    EXPECT_EQ(expected, element);
+  }
+  EXPECT_FALSE(buffer.TryPop(&element));
+  EXPECT_EQ(0, buffer.Size());
+}
+
+TEST(SpscRingBufferTest, ProducerConsumer) {
+  const int num_elements = 100000;
+  SpscRingBuffer<int> buffer(16);
+  std::thread producer([&buffer]() {
+    for (int i = 0; i < num_elements; ++i) {
+      while (!buffer.TryPush(i)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+  int expected = 0;
+  while (expected < num_elements) {
+    int element = 0;
+    if (buffer.TryPop(&element)) {
+      ASSERT_EQ(expected, element);
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_EQ(0, buffer.Size());
+}
+
+}  // namespace msf
+}  // namespace localization
+}  // namespace apollo
@@ -88,6 +88,38 @@ void LidarMsgTransfer::Transfer(const drivers::PointCloud &msg,
   return;
 }
 
+void LidarMsgTransfer::Transfer(const drivers::PointCloudBuffer &buffer,
+                                LidarFrame *lidar_frame) {
+  CHECK_NOTNULL(lidar_frame);
+
+  // the points of an organized cloud are stored row by row as well
+  const size_t num_points = buffer.size();
+  lidar_frame->pt_xs.reserve(num_points);
+  lidar_frame->pt_ys.reserve(num_points);
+  lidar_frame->pt_zs.reserve(num_points);
+  lidar_frame->intensities.reserve(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    if (std::isnan(buffer.x[i]) || buffer.z[i] > max_height_) {
+      continue;
+    }
+    lidar_frame->pt_xs.push_back(static_cast<double>(buffer.x[i]));
+    lidar_frame->pt_ys.push_back(static_cast<double>(buffer.y[i]));
+    lidar_frame->pt_zs.push_back(static_cast<double>(buffer.z[i]));
+    lidar_frame->intensities.push_back(
+        static_cast<unsigned char>(buffer.intensity[i]));
+  }
+
+  lidar_frame->measurement_time =
+      cyber::Time(buffer.measurement_time).ToSecond();
+  if (FLAGS_lidar_debug_log_flag) {
+    AINFO << std::setprecision(15) << "LocalLidar Debug Log: velodyne buffer. "
+          << "[time:" << lidar_frame->measurement_time
+          << "][height:" << buffer.height << "][width:" << buffer.width
+          << "][point_cnt:" << num_points << "]";
+  }
+  return;
+}
+
 }  // namespace msf
 }  // namespace localization
 }  // namespace apollo
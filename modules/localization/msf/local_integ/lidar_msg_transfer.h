@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include "modules/drivers/common/point_cloud_buffer.h"
 #include "modules/drivers/proto/pointcloud.pb.h"
 #include "modules/localization/msf/local_integ/localization_lidar.h"
 
@@ -39,6 +40,9 @@ class LidarMsgTransfer {
   void Transfer(
       const drivers::PointCloud &message, LidarFrame *lidar_frame);
 
+  void Transfer(
+      const drivers::PointCloudBuffer &buffer, LidarFrame *lidar_frame);
+
  protected:
   double max_height_ = 100.0;
 };
@@ -48,6 +48,14 @@ void LocalizationInteg::PcdProcess(const drivers::PointCloud &message) {
   return;
 }
 
+void LocalizationInteg::PcdProcess(const drivers::PointCloudBuffer &buffer) {
+  LidarFrame lidar_frame;
+  LidarMsgTransfer transfer;
+  transfer.Transfer(buffer, &lidar_frame);
+  localization_integ_impl_->PcdProcess(lidar_frame);
+  return;
+}
+
 void LocalizationInteg::RawImuProcessFlu(const drivers::gnss::Imu &imu_msg) {
   ImuData imu;
   TransferImuFlu(imu_msg, &imu);
@@ -101,6 +109,10 @@ const LocalizationResult& LocalizationInteg::
   return localization_integ_impl_->GetLastestGnssLocalization();
 }
 
+MapNodeCacheStats LocalizationInteg::GetMapCacheStats() {
+  return localization_integ_impl_->GetMapCacheStats();
+}
+
 void LocalizationInteg::TransferImuRfu(const drivers::gnss::Imu &imu_msg,
                                        ImuData *imu_rfu) {
   CHECK_NOTNULL(imu_rfu);
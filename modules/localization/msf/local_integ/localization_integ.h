@@ -24,6 +24,7 @@
 #include "include/gnss_struct.h"
 #include "include/sins_struct.h"
 #include "modules/common/status/status.h"
+#include "modules/drivers/common/point_cloud_buffer.h"
 #include "modules/drivers/gnss/proto/gnss_best_pose.pb.h"
 #include "modules/drivers/gnss/proto/gnss_raw_observation.pb.h"
 #include "modules/drivers/gnss/proto/heading.pb.h"
@@ -58,6 +59,8 @@ class LocalizationInteg {
 
   // Lidar pcd process.
   void PcdProcess(const drivers::PointCloud &message);
+  // Lidar pcd process from the shared decoded pointcloud.
+  void PcdProcess(const drivers::PointCloudBuffer &buffer);
   // Raw Imu process.
   // void CorrectedImuProcess(const Imu& imu_msg);
   void RawImuProcessFlu(const drivers::gnss::Imu &imu_msg);
@@ -75,6 +78,9 @@ class LocalizationInteg {
   const LocalizationResult& GetLastestIntegLocalization() const;
   const LocalizationResult& GetLastestGnssLocalization() const;
 
+  // Statistics of the lidar map node caches.
+  MapNodeCacheStats GetMapCacheStats();
+
  protected:
   void TransferImuFlu(const drivers::gnss::Imu &imu_msg, ImuData *imu_data);
 
@@ -114,7 +114,7 @@ void LocalizationIntegImpl::PcdProcessImpl(const LidarFrame& pcd_data) {
   MeasureData lidar_measure;
   if (state == 2) {  // only state OK republish lidar msg
     republish_process_->LidarLocalProcess(lidar_localization, &lidar_measure);
-    integ_process_->MeasureDataProcess(lidar_measure);
+    integ_process_->MeasureDataProcess(lidar_measure, MeasureSource::LIDAR);
 
     imu_altitude_from_lidar_localization_ =
         lidar_localization.pose().position().z();
@@ -268,7 +268,8 @@ void LocalizationIntegImpl::RawObservationProcessImpl(
   if (state == LocalizationMeasureState::OK ||
       state == LocalizationMeasureState::VALID) {
     republish_process_->GnssLocalProcess(gnss_measure, &measure);
-    integ_process_->MeasureDataProcess(measure);
+    integ_process_->MeasureDataProcess(measure,
+                                       MeasureSource::GNSS_OBSERVATION);
   }
 
   LocalizationEstimate gnss_localization;
@@ -290,7 +291,8 @@ void LocalizationIntegImpl::GnssBestPoseProcessImpl(
   MeasureData measure;
   if (republish_process_->NovatelBestgnssposProcess(bestgnsspos_msg,
                                                     &measure)) {
-    integ_process_->MeasureDataProcess(measure);
+    integ_process_->MeasureDataProcess(measure,
+                                       MeasureSource::GNSS_BESTPOSE);
 
     expert_.AddGnssBestPose(bestgnsspos_msg, measure);
     LocalizationEstimate gnss_localization;
@@ -315,7 +317,8 @@ void LocalizationIntegImpl::GnssHeadingProcessImpl(
   int heading_status = 0;
   if (republish_process_->GnssHeadingProcess(gnssheading_msg, &measure,
                                              &heading_status)) {
-    integ_process_->MeasureDataProcess(measure);
+    integ_process_->MeasureDataProcess(measure,
+                                       MeasureSource::GNSS_HEADING);
   }
 }
 
@@ -384,6 +387,10 @@ const LocalizationResult& LocalizationIntegImpl::
   return lastest_gnss_localization_;
 }
 
+MapNodeCacheStats LocalizationIntegImpl::GetMapCacheStats() {
+  return lidar_process_->GetMapCacheStats();
+}
+
 }  // namespace msf
 }  // namespace localization
 }  // namespace apollo
@@ -77,6 +77,8 @@ class LocalizationIntegImpl {
 
   const LocalizationResult& GetLastestGnssLocalization() const;
 
+  MapNodeCacheStats GetMapCacheStats();
+
  protected:
   void PcdProcessImpl(const LidarFrame& pcd_data);
 
@@ -37,7 +37,12 @@ LocalizationIntegProcess::LocalizationIntegProcess()
       pva_covariance_{0.0},
       keep_running_(false),
       measure_data_queue_size_(150),
-      delay_output_counter_(0) {}
+      delay_output_counter_(0) {
+  for (int i = 0; i < static_cast<int>(MeasureSource::SOURCE_NUM); ++i) {
+    measure_data_queues_.emplace_back(
+        new SpscRingBuffer<MeasureData>(measure_data_queue_size_));
+  }
+}
 
 LocalizationIntegProcess::~LocalizationIntegProcess() {
   StopThreadLoop();
@@ -242,10 +247,12 @@ void LocalizationIntegProcess::GetResult(IntegState *state, InsPva *sins_pva,
 }
 
 void LocalizationIntegProcess::MeasureDataProcess(
-    const MeasureData &measure_msg) {
-  measure_data_queue_mutex_.lock();
-  measure_data_queue_.push(measure_msg);
-  measure_data_queue_mutex_.unlock();
+    const MeasureData &measure_msg, MeasureSource source) {
+  if (!measure_data_queues_[static_cast<int>(source)]->TryPush(measure_msg)) {
+    AWARN << "Measure data queue " << static_cast<int>(source)
+          << " is full, drop the measure at " << std::setprecision(16)
+          << measure_msg.time;
+  }
 }
 
 void LocalizationIntegProcess::StartThreadLoop() {
@@ -263,34 +270,33 @@ void LocalizationIntegProcess::StopThreadLoop() {
 void LocalizationIntegProcess::MeasureDataThreadLoop() {
   AINFO << "Started measure data process thread";
   while (keep_running_.load()) {
-    {
-      std::unique_lock<std::mutex> lock(measure_data_queue_mutex_);
-      int size = static_cast<int>(measure_data_queue_.size());
-      while (size > measure_data_queue_size_) {
-        measure_data_queue_.pop();
-        --size;
-      }
-      if (measure_data_queue_.size() == 0) {
-        lock.unlock();
-        cyber::Yield();
+    // Process the earliest of the measures waiting in the source queues.
+    SpscRingBuffer<MeasureData> *earliest_queue = nullptr;
+    const MeasureData *earliest_measure = nullptr;
+    int waiting_num = 0;
+    for (auto &queue : measure_data_queues_) {
+      const MeasureData *measure = queue->Front();
+      if (measure == nullptr) {
         continue;
       }
+      waiting_num += static_cast<int>(queue->Size());
+      if (earliest_measure == nullptr ||
+          measure->time < earliest_measure->time) {
+        earliest_queue = queue.get();
+        earliest_measure = measure;
+      }
     }
-
-    MeasureData measure;
-    int waiting_num = 0;
-    {
-      std::unique_lock<std::mutex> lock(measure_data_queue_mutex_);
-      measure = measure_data_queue_.front();
-      measure_data_queue_.pop();
-      waiting_num = static_cast<int>(measure_data_queue_.size());
+    if (earliest_measure == nullptr) {
+      cyber::Yield();
+      continue;
     }
 
-    if (waiting_num > measure_data_queue_size_ / 4) {
-      AWARN << waiting_num << " measure are waiting to process.";
+    if (waiting_num - 1 > measure_data_queue_size_ / 4) {
+      AWARN << waiting_num - 1 << " measure are waiting to process.";
     }
 
-    MeasureDataProcessImpl(measure);
+    MeasureDataProcessImpl(*earliest_measure);
+    earliest_queue->Pop();
   }
   AINFO << "Exited measure data process thread";
 }
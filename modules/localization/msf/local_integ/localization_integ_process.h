@@ -16,8 +16,9 @@
 
 #pragma once
 
-#include <queue>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "Eigen/Core"
 #include "Eigen/Geometry"
@@ -25,6 +26,7 @@
 
 #include "include/sins.h"
 #include "modules/common/status/status.h"
+#include "modules/localization/msf/common/util/spsc_ring_buffer.h"
 #include "modules/localization/msf/local_integ/localization_params.h"
 #include "modules/localization/proto/localization.pb.h"
 
@@ -38,6 +40,15 @@ namespace msf {
 
 enum class IntegState { NOT_INIT = 0, NOT_STABLE, OK, VALID };
 
+// The threads handing measure data over, each of them has its own queue.
+enum class MeasureSource {
+  LIDAR = 0,
+  GNSS_OBSERVATION,
+  GNSS_BESTPOSE,
+  GNSS_HEADING,
+  SOURCE_NUM
+};
+
 /**
  * @class LocalizationIntegProcess
  *
@@ -61,8 +72,9 @@ class LocalizationIntegProcess {
   void GetResult(IntegState *state, InsPva *sins_pva,
                  double pva_covariance[9][9]);
 
-  // itegration measure data process
-  void MeasureDataProcess(const MeasureData &measure_msg);
+  // itegration measure data process, called by one thread per source
+  void MeasureDataProcess(const MeasureData &measure_msg,
+                          MeasureSource source);
 
  private:
   bool CheckIntegMeasureData(const MeasureData &measure_data);
@@ -90,9 +102,10 @@ class LocalizationIntegProcess {
   double pva_covariance_[9][9];
 
   std::atomic<bool> keep_running_;
-  std::queue<MeasureData> measure_data_queue_;
   int measure_data_queue_size_ = 150;
-  std::mutex measure_data_queue_mutex_;
+  // lock free queues from the measure sources to the measure data thread
+  std::vector<std::unique_ptr<SpscRingBuffer<MeasureData>>>
+      measure_data_queues_;
 
   int delay_output_counter_ = 0;
 };
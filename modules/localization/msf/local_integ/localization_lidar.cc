@@ -16,6 +16,11 @@
 
 #include "modules/localization/msf/local_integ/localization_lidar.h"
 
+#include <algorithm>
+#include <future>
+
+#include "cyber/task/task.h"
+
 namespace apollo {
 namespace localization {
 namespace msf {
@@ -120,6 +125,19 @@ void LocalizationLidar::SetDeltaPitchRollLimit(double limit) {
   lidar_locator_->SetDeltaPitchRollLimit(limit);
 }
 
+void LocalizationLidar::SetMapPrefetchParams(double horizon,
+                                             int max_pending_loads) {
+  map_.SetPrefetchParams(horizon, max_pending_loads);
+}
+
+void LocalizationLidar::SetMapComposeThreads(int num_threads) {
+  map_compose_threads_ = std::max(num_threads, 1);
+}
+
+MapNodeCacheStats LocalizationLidar::GetMapCacheStats() {
+  return map_.GetCacheStats();
+}
+
 int LocalizationLidar::Update(const unsigned int frame_idx,
                               const Eigen::Affine3d& pose,
                               const Eigen::Vector3d velocity,
@@ -308,64 +326,66 @@ void LocalizationLidar::ComposeMapNode(const Eigen::Vector3d& trans) {
   map_node[0][0]->GetCoordinate(left_top_corner, &coord_x, &coord_y);
   map_left_top_corner_ = map_node[0][0]->GetCoordinate(coord_x, coord_y);
 
-  int coord_xi = coord_x;
-  int coord_yi = coord_y;
-  int range_xs[2][2] = {0};
-  int range_ys[2][2] = {0};
-  range_xs[0][0] = node_size_x_ - coord_xi;
-  range_xs[1][0] = node_size_x_ - coord_xi;
-  range_xs[0][1] = coord_xi;
-  range_xs[1][1] = coord_xi;
-  range_ys[0][0] = node_size_y_ - coord_yi;
-  range_ys[0][1] = node_size_y_ - coord_yi;
-  range_ys[1][0] = coord_yi;
-  range_ys[1][1] = coord_yi;
-
-  int src_xs[2][2] = {0};
-  int src_ys[2][2] = {0};
-  src_xs[0][0] = coord_xi;
-  src_xs[1][0] = coord_xi;
-  src_xs[0][1] = 0;
-  src_xs[1][1] = 0;
-  src_ys[0][0] = coord_yi;
-  src_ys[0][1] = coord_yi;
-  src_ys[1][0] = 0;
-  src_ys[1][1] = 0;
-
-  int dst_xs[2][2] = {0};
-  int dst_ys[2][2] = {0};
-  dst_xs[0][0] = 0;
-  dst_xs[1][0] = 0;
-  dst_xs[0][1] = node_size_x_ - coord_xi;
-  dst_xs[1][1] = node_size_x_ - coord_xi;
-  dst_ys[0][0] = 0;
-  dst_ys[0][1] = 0;
-  dst_ys[1][0] = node_size_y_ - coord_yi;
-  dst_ys[1][1] = node_size_y_ - coord_yi;
-
-  for (int i = 0; i < 2; ++i) {
-    for (int j = 0; j < 2; ++j) {
-      int range_x = range_xs[i][j];
-      int range_y = range_ys[i][j];
-      int src_x = src_xs[i][j];
-      int src_y = src_ys[i][j];
-      int dst_x = dst_xs[i][j];
-      int dst_y = dst_ys[i][j];
-      LossyMapMatrix& map_cells =
-          static_cast<LossyMapMatrix&>(map_node[i][j]->GetMapCellMatrix());
-      for (int y = 0; y < range_y; ++y) {
-        int dst_base_x = (dst_y + y) * node_size_x_ + dst_x;
+  // The window is unchanged until it moves by a cell.
+  if (is_map_node_composed_ && composed_map_node_idx_ == map_node_idx[0][0] &&
+      composed_coord_x_ == coord_x && composed_coord_y_ == coord_y) {
+    return;
+  }
+
+  // Destination rows above split_y come from the top nodes, columns left of
+  // split_x from the left nodes.
+  const int coord_xi = coord_x;
+  const int coord_yi = coord_y;
+  const int split_x = node_size_x_ - coord_xi;
+  const int split_y = node_size_y_ - coord_yi;
+  auto compose_rows = [&](const int begin_row, const int end_row) {
+    for (int dst_y = begin_row; dst_y < end_row; ++dst_y) {
+      const int i = dst_y < split_y ? 0 : 1;
+      const int src_y = i == 0 ? coord_yi + dst_y : dst_y - split_y;
+      const int dst_base = dst_y * node_size_x_;
+      for (int j = 0; j < 2; ++j) {
+        const LossyMapMatrix& map_cells = static_cast<const LossyMapMatrix&>(
+            map_node[i][j]->GetMapCellMatrix());
+        const LossyMapCell* src = map_cells[src_y] + (j == 0 ? coord_xi : 0);
+        const int dst_x = j == 0 ? 0 : split_x;
+        const int range_x = j == 0 ? split_x : coord_xi;
+        float* intensities = lidar_map_node_->intensities + dst_base + dst_x;
+        float* intensities_var =
+            lidar_map_node_->intensities_var + dst_base + dst_x;
+        float* altitudes = lidar_map_node_->altitudes + dst_base + dst_x;
+        unsigned int* count = lidar_map_node_->count + dst_base + dst_x;
         for (int x = 0; x < range_x; ++x) {
-          auto& cell = map_cells[src_y + y][src_x + x];
-          int dst_idx = dst_base_x + x;
-          lidar_map_node_->intensities[dst_idx] = cell.intensity;
-          lidar_map_node_->intensities_var[dst_idx] = cell.intensity_var;
-          lidar_map_node_->altitudes[dst_idx] = cell.altitude;
-          lidar_map_node_->count[dst_idx] = cell.count;
+          intensities[x] = src[x].intensity;
+          intensities_var[x] = src[x].intensity_var;
+          altitudes[x] = src[x].altitude;
+          count[x] = src[x].count;
         }
       }
     }
+  };
+
+  if (map_compose_threads_ <= 1) {
+    compose_rows(0, node_size_y_);
+  } else {
+    const int rows_per_thread =
+        (node_size_y_ + map_compose_threads_ - 1) / map_compose_threads_;
+    std::vector<std::future<void>> futures;
+    for (int begin_row = rows_per_thread; begin_row < node_size_y_;
+         begin_row += rows_per_thread) {
+      futures.push_back(cyber::Async(
+          compose_rows, begin_row,
+          std::min(begin_row + rows_per_thread, node_size_y_)));
+    }
+    compose_rows(0, std::min(rows_per_thread, node_size_y_));
+    for (auto& future : futures) {
+      future.get();
+    }
   }
+
+  is_map_node_composed_ = true;
+  composed_map_node_idx_ = map_node_idx[0][0];
+  composed_coord_x_ = coord_x;
+  composed_coord_y_ = coord_y;
   return;
 }
 
@@ -101,6 +101,13 @@ class LocalizationLidar {
 
   void SetDeltaPitchRollLimit(double limit);
 
+  void SetMapPrefetchParams(double horizon, int max_pending_loads);
+
+  /**@brief Compose the map window of every frame with this many threads. */
+  void SetMapComposeThreads(int num_threads);
+
+  MapNodeCacheStats GetMapCacheStats();
+
   int Update(const unsigned int frame_idx, const Eigen::Affine3d& pose,
              const Eigen::Vector3d velocity, const LidarFrame& lidar_frame,
              bool use_avx = false);
@@ -131,6 +138,12 @@ class LocalizationLidar {
   unsigned int resolution_id_ = 0;
   int zone_id_ = 50;
   bool is_map_loaded_ = false;
+  int map_compose_threads_ = 1;
+  // where the window in lidar_map_node_ was composed from
+  bool is_map_node_composed_ = false;
+  MapNodeIndex composed_map_node_idx_;
+  unsigned int composed_coord_x_ = 0;
+  unsigned int composed_coord_y_ = 0;
 
   double vehicle_lidar_height_ = 1.7;
   double pre_vehicle_ground_height_ = 0.0;
@@ -81,6 +81,9 @@ Status LocalizationLidarProcess::Init(const LocalizationIntegParam& params) {
   yaw_align_mode_ = params.lidar_yaw_align_mode;
   utm_zone_id_ = params.utm_zone_id;
   map_coverage_theshold_ = params.map_coverage_theshold;
+  map_prefetch_horizon_ = params.map_prefetch_horizon;
+  map_prefetch_max_loads_ = params.map_prefetch_max_loads;
+  map_compose_threads_ = params.map_compose_threads;
   imu_lidar_max_delay_time_ = params.imu_lidar_max_delay_time;
 
   lidar_filter_size_ = params.lidar_filter_size;
@@ -137,6 +140,7 @@ Status LocalizationLidarProcess::Init(const LocalizationIntegParam& params) {
   locator_->SetValidThreshold(static_cast<float>(map_coverage_theshold_));
   locator_->SetVehicleHeight(lidar_height_.height);
   locator_->SetDeltaPitchRollLimit(compensate_pitch_roll_limit_);
+  locator_->SetMapComposeThreads(map_compose_threads_);
 
   const double deg_to_rad = 0.017453292519943;
   const double max_gyro_input = 200 * deg_to_rad;  // 200 degree
@@ -196,12 +200,27 @@ void LocalizationLidarProcess::PcdProcess(const LidarFrame& lidar_frame) {
   }
 
   velocity_ = cur_predict_location_.translation() - pre_location_.translation();
+  // velocity_ is the move since pre_location_time_, scale the prefetch
+  // horizon in seconds to it
+  const double delta_time = lidar_frame.measurement_time - pre_location_time_;
+  if (map_prefetch_horizon_ > 0.0 && delta_time > 0.0) {
+    locator_->SetMapPrefetchParams(map_prefetch_horizon_ / delta_time,
+                                   map_prefetch_max_loads_);
+  }
 
   int ret = locator_->Update(pcd_index++, cur_predict_location_, velocity_,
                              lidar_frame, if_use_avx_);
 
   UpdateState(ret, lidar_frame.measurement_time);
 
+  if (map_prefetch_horizon_ > 0.0 && pcd_index % 100 == 0) {
+    const MapNodeCacheStats stats = locator_->GetMapCacheStats();
+    AINFO << "Map node cache: l1 hits " << stats.l1_hits << ", l2 hits "
+          << stats.l2_hits << ", late preloads " << stats.late_preloads
+          << ", misses " << stats.misses << ", prefetches " << stats.prefetches
+          << ", dropped prefetches " << stats.dropped_prefetches;
+  }
+
   timer.End("Lidar process");
 }
 
@@ -274,6 +293,10 @@ void LocalizationLidarProcess::RawImuProcess(const ImuData& imu_msg) {
   return;
 }
 
+MapNodeCacheStats LocalizationLidarProcess::GetMapCacheStats() {
+  return locator_->GetMapCacheStats();
+}
+
 bool LocalizationLidarProcess::GetPredictPose(const double lidar_time,
                                               TransformD* predict_pose,
                                               ForcastState* forcast_state) {
@@ -86,6 +86,8 @@ class LocalizationLidarProcess {
   void IntegPvaProcess(const InsPva &sins_pva_msg);
   // Raw Imu process.
   void RawImuProcess(const ImuData &imu_msg);
+  // Statistics of the map node caches of the locator.
+  MapNodeCacheStats GetMapCacheStats();
 
  private:
   // Sub-functions for process.
@@ -121,6 +123,9 @@ class LocalizationLidarProcess {
   double compensate_pitch_roll_limit_ = 0.035;
   int utm_zone_id_ = 50;
   double map_coverage_theshold_ = 0.8;
+  double map_prefetch_horizon_ = 0.0;
+  int map_prefetch_max_loads_ = 4;
+  int map_compose_threads_ = 1;
   TransformD lidar_extrinsic_;
   LidarHeight lidar_height_;
 
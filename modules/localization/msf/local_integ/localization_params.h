@@ -85,6 +85,9 @@ struct LocalizationIntegParam {
   int lidar_yaw_align_mode = 2;
   int lidar_filter_size = 17;
   double map_coverage_theshold = 0.8;
+  double map_prefetch_horizon = 0.0;
+  int map_prefetch_max_loads = 4;
+  int map_compose_threads = 1;
   double imu_lidar_max_delay_time = 0.4;
   int utm_zone_id = 50;
   bool is_lidar_unstable_reset = true;
@@ -36,7 +36,8 @@ MeasureRepublishProcess::MeasureRepublishProcess()
     : pre_bestgnsspose_(),
       pre_bestgnsspose_valid_(false),
       send_init_bestgnsspose_(false),
-      pva_buffer_size_(150),
+      is_integ_pva_align_(false),
+      integ_pva_count_(0),
       local_utm_zone_id_(50),
       is_trans_gpstime_to_utctime_(true),
       map_height_time_(0.0),
@@ -49,8 +50,6 @@ Status MeasureRepublishProcess::Init(const LocalizationIntegParam& params) {
   is_trans_gpstime_to_utctime_ = params.is_trans_gpstime_to_utctime;
   gnss_mode_ = GnssMode(params.gnss_mode);
 
-  pva_buffer_size_ = 150;
-
   map_height_time_ = 0.0;
 
   novatel_heading_time_ = 0.0;
@@ -320,16 +319,12 @@ void MeasureRepublishProcess::GnssLocalProcess(
 }
 
 void MeasureRepublishProcess::IntegPvaProcess(const InsPva& inspva_msg) {
-  const InsPva& integ_pva = inspva_msg;
-
-  integ_pva_mutex_.lock();
-  if (integ_pva_list_.size() < pva_buffer_size_) {
-    integ_pva_list_.push_back(integ_pva);
-  } else {
-    integ_pva_list_.pop_front();
-    integ_pva_list_.push_back(integ_pva);
+  // The other threads only read the alignment of the latest pva, which is
+  // published without blocking the imu thread.
+  is_integ_pva_align_.store(inspva_msg.init_and_alignment);
+  if (integ_pva_count_.load() < 2) {
+    integ_pva_count_.fetch_add(1);
   }
-  integ_pva_mutex_.unlock();
 
   return;
 }
@@ -399,13 +394,7 @@ bool MeasureRepublishProcess::LidarLocalProcess(
 }
 
 bool MeasureRepublishProcess::IsSinsAlign() {
-  integ_pva_mutex_.lock();
-  bool is_sins_align = false;
-  if (!integ_pva_list_.empty()) {
-    is_sins_align = integ_pva_list_.back().init_and_alignment;
-  }
-  integ_pva_mutex_.unlock();
-  return is_sins_align;
+  return integ_pva_count_.load() > 0 && is_integ_pva_align_.load();
 }
 
 void MeasureRepublishProcess::TransferXYZFromBestgnsspose(
@@ -584,10 +573,8 @@ bool MeasureRepublishProcess::GnssHeadingProcess(
     return false;
   }
 
-  integ_pva_mutex_.lock();
   bool is_sins_align =
-      integ_pva_list_.back().init_and_alignment && (integ_pva_list_.size() > 1);
-  integ_pva_mutex_.unlock();
+      is_integ_pva_align_.load() && integ_pva_count_.load() > 1;
 
   if (is_sins_align) {
     static double pre_publish_time = 0.0;
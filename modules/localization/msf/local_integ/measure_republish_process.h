@@ -21,7 +21,7 @@
 
 #pragma once
 
-#include <list>
+#include <atomic>
 #include <mutex>
 #include <string>
 
@@ -101,9 +101,10 @@ class MeasureRepublishProcess {
   bool pre_bestgnsspose_valid_;
   bool send_init_bestgnsspose_;
 
-  std::list<InsPva> integ_pva_list_;
-  size_t pva_buffer_size_;
-  std::mutex integ_pva_mutex_;
+  // the alignment of the latest integrated pva and the number of pvas
+  // received (up to 2), written by the imu thread without locking
+  std::atomic<bool> is_integ_pva_align_;
+  std::atomic<int> integ_pva_count_;
 
   int local_utm_zone_id_;
   bool is_trans_gpstime_to_utctime_;
@@ -16,6 +16,8 @@
 
 #include "modules/localization/msf/local_map/base_map/base_map.h"
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "cyber/common/log.h"
@@ -120,6 +122,7 @@ void BaseMap::LoadMapNodes(std::set<MapNodeIndex>* map_ids) {
       // std::cout << "LoadMapNodes find in L1 cache" << std::endl;
       boost::unique_lock<boost::recursive_mutex> lock(map_load_mutex_);
       map_node_cache_lvl2_->IsExist(*itr);  // fresh lru list
+      ++cache_stats_.l1_hits;
       lock.unlock();
       itr = map_ids->erase(itr);
     } else {
@@ -136,8 +139,14 @@ void BaseMap::LoadMapNodes(std::set<MapNodeIndex>* map_ids) {
       // std::cout << "LoadMapNodes find in L2 cache" << std::endl;
       node->SetIsReserved(true);
       map_node_cache_lvl1_->Put(*itr, node);
+      ++cache_stats_.l2_hits;
       itr = map_ids->erase(itr);
     } else {
+      if (map_preloading_task_index_.count(*itr) != 0) {
+        ++cache_stats_.late_preloads;
+      } else {
+        ++cache_stats_.misses;
+      }
       ++itr;
     }
   }
@@ -230,6 +239,88 @@ void BaseMap::AttachMapNodePool(BaseMapNodePool* map_node_pool) {
   map_node_pool_ = map_node_pool;
 }
 
+void BaseMap::SetPrefetchParams(double horizon, int max_pending_loads) {
+  boost::unique_lock<boost::recursive_mutex> lock(map_load_mutex_);
+  prefetch_horizon_ = std::max(horizon, 0.0);
+  max_prefetch_loads_ = std::max(max_pending_loads, 1);
+}
+
+MapNodeCacheStats BaseMap::GetCacheStats() {
+  boost::unique_lock<boost::recursive_mutex> lock(map_load_mutex_);
+  return cache_stats_;
+}
+
+void BaseMap::GetMapNodesAlongPath(const Eigen::Vector3d& location,
+                                   const Eigen::Vector3d& trans_diff,
+                                   unsigned int resolution_id,
+                                   unsigned int zone_id,
+                                   const std::set<MapNodeIndex>& exclude_ids,
+                                   std::vector<MapNodeIndex>* map_ids) {
+  map_ids->clear();
+  const double step = std::hypot(trans_diff[0], trans_diff[1]);
+  if (prefetch_horizon_ <= 0.0 || step < 1e-3) {
+    return;
+  }
+  const double map_pixel_resolution =
+      this->map_config_->map_resolutions_[resolution_id];
+  const double node_size_x =
+      this->map_config_->map_node_size_x_ * map_pixel_resolution;
+  const double node_size_y =
+      this->map_config_->map_node_size_y_ * map_pixel_resolution;
+  // sample the path densely enough not to skip a node, and never ask for
+  // more nodes than the L2 cache could keep besides the current area
+  const double spacing = 0.5 * std::min(node_size_x, node_size_y);
+  const double distance = step * prefetch_horizon_;
+  const size_t max_size =
+      static_cast<size_t>(map_node_cache_lvl2_->Capacity()) / 2;
+  for (double d = spacing; d < distance + spacing; d += spacing) {
+    const double s = std::min(d, distance);
+    Eigen::Vector3d pt;
+    pt[0] = location[0] + trans_diff[0] / step * s;
+    pt[1] = location[1] + trans_diff[1] / step * s;
+    pt[2] = 0;
+    // the area LoadMapArea will need when the car gets to pt
+    for (int i = -1; i < 2; ++i) {
+      for (int j = -1; j < 2; ++j) {
+        Eigen::Vector3d corner;
+        corner[0] = pt[0] + 0.5 * i * node_size_x;
+        corner[1] = pt[1] + 0.5 * j * node_size_y;
+        corner[2] = 0;
+        const MapNodeIndex map_id = MapNodeIndex::GetMapNodeIndex(
+            *(this->map_config_), corner, resolution_id, zone_id);
+        if (exclude_ids.count(map_id) == 0 &&
+            std::find(map_ids->begin(), map_ids->end(), map_id) ==
+                map_ids->end()) {
+          map_ids->push_back(map_id);
+          if (map_ids->size() >= max_size) {
+            return;
+          }
+        }
+      }
+    }
+  }
+}
+
+void BaseMap::PrefetchMapNodes(const std::vector<MapNodeIndex>& map_ids) {
+  for (const auto& map_id : map_ids) {
+    boost::unique_lock<boost::recursive_mutex> lock(map_load_mutex_);
+    if (map_node_cache_lvl2_->IsExist(map_id) ||
+        map_preloading_task_index_.count(map_id) != 0) {
+      continue;
+    }
+    if (static_cast<int>(map_preloading_task_index_.size()) >=
+        max_prefetch_loads_) {
+      ++cache_stats_.dropped_prefetches;
+      continue;
+    }
+    AINFO << "Prefetch map node: " << map_id;
+    map_preloading_task_index_.insert(map_id);
+    ++cache_stats_.prefetches;
+    lock.unlock();
+    cyber::Async(&BaseMap::LoadMapNodeThreadSafety, this, map_id, false);
+  }
+}
+
 void BaseMap::LoadMapNodeThreadSafety(MapNodeIndex index, bool is_reserved) {
   BaseMapNode* map_node = nullptr;
   while (map_node == nullptr) {
@@ -399,7 +490,12 @@ void BaseMap::PreloadMapArea(const Eigen::Vector3d& location,
     map_ids.insert(map_id);
   }
 
+  std::vector<MapNodeIndex> prefetch_ids;
+  GetMapNodesAlongPath(location, trans_diff, resolution_id, zone_id, map_ids,
+                       &prefetch_ids);
+
   this->PreloadMapNodes(&map_ids);
+  this->PrefetchMapNodes(prefetch_ids);
   return;
 }
 
@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <list>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "modules/localization/msf/local_map/base_map/base_map_cache.h"
 #include "modules/localization/msf/local_map/base_map/base_map_config.h"
@@ -31,6 +33,22 @@ namespace apollo {
 namespace localization {
 namespace msf {
 
+/**@brief The statistics of the map node caches. */
+struct MapNodeCacheStats {
+  /**@brief Nodes needed by LoadMapArea and found in the L1 cache. */
+  uint64_t l1_hits = 0;
+  /**@brief Nodes needed and found in the L2 cache, preloaded in time. */
+  uint64_t l2_hits = 0;
+  /**@brief Nodes needed while their preloading was still running. */
+  uint64_t late_preloads = 0;
+  /**@brief Nodes needed but never preloaded, loaded synchronously. */
+  uint64_t misses = 0;
+  /**@brief Loads started for the nodes along the predicted path. */
+  uint64_t prefetches = 0;
+  /**@brief Loads along the predicted path skipped as the IO queue was full. */
+  uint64_t dropped_prefetches = 0;
+};
+
 /**@brief The data structure of the base map. */
 class BaseMap {
  public:
@@ -75,6 +93,14 @@ class BaseMap {
   /**@brief Attach map node pointer. */
   void AttachMapNodePool(BaseMapNodePool* p_map_node_pool);
 
+  /**@brief Also preload the nodes along the path predicted from the moving
+   * direction of PreloadMapArea, ahead by horizon times its trans_diff,
+   * keeping at most max_pending_loads node loads in flight. A horizon of
+   * zero disables it. */
+  void SetPrefetchParams(double horizon, int max_pending_loads);
+  /**@brief Get the statistics of the map node caches. */
+  MapNodeCacheStats GetCacheStats();
+
   /**@brief Write all the map nodes to a single binary file stream. It's for
    * binary streaming or packing.
    * @param <buf, buf_size> The buffer and its size.
@@ -100,6 +126,14 @@ class BaseMap {
   void PreloadMapNodes(std::set<MapNodeIndex>* map_ids);
   /**@brief Load map node by index, thread_safety. */
   void LoadMapNodeThreadSafety(MapNodeIndex index, bool is_reserved = false);
+  /**@brief Get the nodes around the predicted path, the nearest first. */
+  void GetMapNodesAlongPath(const Eigen::Vector3d& location,
+                            const Eigen::Vector3d& trans_diff,
+                            unsigned int resolution_id, unsigned int zone_id,
+                            const std::set<MapNodeIndex>& exclude_ids,
+                            std::vector<MapNodeIndex>* map_ids);
+  /**@brief Preload map nodes in order, as long as the IO queue has room. */
+  void PrefetchMapNodes(const std::vector<MapNodeIndex>& map_ids);
 
   /**@brief The map settings. */
   BaseMapConfig* map_config_;
@@ -116,6 +150,12 @@ class BaseMap {
   std::set<MapNodeIndex> map_preloading_task_index_;
   /**@brief The mutex for preload map node. **/
   boost::recursive_mutex map_load_mutex_;
+  /**@brief The prefetch horizon in units of trans_diff, 0 disables it. */
+  double prefetch_horizon_ = 0.0;
+  /**@brief The maximum number of node loads in flight for prefetching. */
+  int max_prefetch_loads_ = 4;
+  /**@brief The statistics of the map node caches. */
+  MapNodeCacheStats cache_stats_;
 };
 
 }  // namespace msf
@@ -117,10 +117,17 @@ bool BaseMapNode::Save() {
 
   AINFO << "Save node: " << path;
 
-  FILE* file = fopen(path.c_str(), "wb");
+  // Write to a temporary file first so that an interrupted save never leaves
+  // a truncated node behind.
+  const std::string tmp_path = path + ".tmp";
+  FILE* file = fopen(tmp_path.c_str(), "wb");
   if (file) {
     CreateBinary(file);
     fclose(file);
+    if (rename(tmp_path.c_str(), path.c_str()) != 0) {
+      AERROR << "Can't write to file: " << path << ".";
+      return false;
+    }
     is_changed_ = false;
     return true;
   } else {
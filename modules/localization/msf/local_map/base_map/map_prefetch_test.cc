@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "modules/localization/msf/local_map/base_map/base_map.h"
+
+namespace apollo {
+namespace localization {
+namespace msf {
+
+class PrefetchBaseMap : public BaseMap {
+ public:
+  explicit PrefetchBaseMap(BaseMapConfig* map_config) : BaseMap(map_config) {}
+  using BaseMap::GetMapNodesAlongPath;
+};
+
+class MapPrefetchTestSuite : public ::testing::Test {
+ protected:
+  MapPrefetchTestSuite() : config_("map"), map_(&config_) {}
+  virtual ~MapPrefetchTestSuite() {}
+  virtual void SetUp() { map_.InitMapNodeCaches(12, 24); }
+  virtual void TearDown() {}
+
+  bool HasNode(const std::vector<MapNodeIndex>& map_ids, int n, int m) {
+    return std::any_of(map_ids.begin(), map_ids.end(),
+                       [n, m](const MapNodeIndex& index) {
+                         return index.n_ == n && index.m_ == m;
+                       });
+  }
+
+  BaseMapConfig config_;
+  PrefetchBaseMap map_;
+};
+
+/**@brief Test the nodes along the predicted path. */
+TEST_F(MapPrefetchTestSuite, NodesAlongPathTest) {
+  // the center of the node (100, 100), the nodes are 128m wide
+  Eigen::Vector3d location(12864.0, 12864.0, 0.0);
+  Eigen::Vector3d east(3.0, 0.0, 0.0);
+  std::set<MapNodeIndex> exclude_ids;
+  std::vector<MapNodeIndex> map_ids;
+
+  // disabled by default
+  map_.GetMapNodesAlongPath(location, east, 0, 50, exclude_ids, &map_ids);
+  ASSERT_TRUE(map_ids.empty());
+
+  // 30 frames of 3m ahead
+  map_.SetPrefetchParams(30.0, 4);
+  map_.GetMapNodesAlongPath(location, east, 0, 50, exclude_ids, &map_ids);
+  ASSERT_FALSE(map_ids.empty());
+  ASSERT_LE(map_ids.size(), 12);
+  ASSERT_TRUE(HasNode(map_ids, 101, 100));
+  for (const auto& index : map_ids) {
+    ASSERT_GE(index.n_, 100);
+  }
+
+  // heading west
+  Eigen::Vector3d west(-3.0, 0.0, 0.0);
+  map_.GetMapNodesAlongPath(location, west, 0, 50, exclude_ids, &map_ids);
+  ASSERT_TRUE(HasNode(map_ids, 99, 100));
+  for (const auto& index : map_ids) {
+    ASSERT_LE(index.n_, 100);
+  }
+
+  // the excluded nodes and a car standing still
+  exclude_ids.insert(map_ids.begin(), map_ids.end());
+  map_.GetMapNodesAlongPath(location, west, 0, 50, exclude_ids, &map_ids);
+  ASSERT_TRUE(map_ids.empty());
+  map_.GetMapNodesAlongPath(location, Eigen::Vector3d::Zero(), 0, 50,
+                            exclude_ids, &map_ids);
+  ASSERT_TRUE(map_ids.empty());
+}
+
+/**@brief Test the statistics start empty. */
+TEST_F(MapPrefetchTestSuite, CacheStatsTest) {
+  const MapNodeCacheStats stats = map_.GetCacheStats();
+  ASSERT_EQ(stats.l1_hits, 0);
+  ASSERT_EQ(stats.l2_hits, 0);
+  ASSERT_EQ(stats.late_preloads, 0);
+  ASSERT_EQ(stats.misses, 0);
+  ASSERT_EQ(stats.prefetches, 0);
+  ASSERT_EQ(stats.dropped_prefetches, 0);
+}
+
+}  // namespace msf
+}  // namespace localization
+}  // namespace apollo
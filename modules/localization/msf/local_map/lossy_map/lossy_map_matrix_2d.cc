@@ -16,10 +16,35 @@
 
 #include "modules/localization/msf/local_map/lossy_map/lossy_map_matrix_2d.h"
 
+#include <sys/mman.h>
+
+#include <cstring>
+
+#include "cyber/common/log.h"
+
 namespace apollo {
 namespace localization {
 namespace msf {
 
+namespace {
+
+// The raw binary begins with a tag, a version, rows, cols and the cell size,
+// then the cells are padded to LossyMapMatrix2D::kRawBinaryAlignment.
+// A zlib stream never begins with the first byte of the tag.
+constexpr unsigned int kRawBinaryTag = 0x574d524c;  // "LRMW"
+constexpr unsigned int kRawBinaryVersion = 1;
+constexpr unsigned int kRawBinaryHeaderSize = 5 * sizeof(unsigned int);
+
+unsigned int GetRawCellsOffset(unsigned int body_offset) {
+  const unsigned int alignment = LossyMapMatrix2D::kRawBinaryAlignment;
+  const unsigned int end = body_offset + kRawBinaryHeaderSize;
+  return (end + alignment - 1) / alignment * alignment;
+}
+
+}  // namespace
+
+constexpr unsigned int LossyMapMatrix2D::kRawBinaryAlignment;
+
 LossyMapCell2D::LossyMapCell2D()
     : count(0),
       intensity(0.0),
@@ -54,9 +79,7 @@ LossyMapMatrix2D::LossyMapMatrix2D() {
 }
 
 LossyMapMatrix2D::~LossyMapMatrix2D() {
-  if (map_cells_) {
-    delete[] map_cells_;
-  }
+  ReleaseCells();
   rows_ = 0;
   cols_ = 0;
 }
@@ -84,7 +107,7 @@ LossyMapMatrix2D& LossyMapMatrix2D::operator=(const LossyMapMatrix2D& matrix) {
 void LossyMapMatrix2D::Init(const BaseMapConfig* config) {
   unsigned int rows = config->map_node_size_y_;
   unsigned int cols = config->map_node_size_x_;
-  if (rows_ == rows && cols_ == cols) {
+  if (rows_ == rows && cols_ == cols && !IsMapped()) {
     return;
   }
   Init(rows, cols);
@@ -92,10 +115,7 @@ void LossyMapMatrix2D::Init(const BaseMapConfig* config) {
 }
 
 void LossyMapMatrix2D::Init(unsigned int rows, unsigned int cols) {
-  if (map_cells_) {
-    delete[] map_cells_;
-    map_cells_ = nullptr;
-  }
+  ReleaseCells();
   map_cells_ = new LossyMapCell2D[rows * cols];
   rows_ = rows;
   cols_ = cols;
@@ -107,6 +127,11 @@ void LossyMapMatrix2D::Reset(const BaseMapConfig* config) {
 }
 
 void LossyMapMatrix2D::Reset(unsigned int rows, unsigned int cols) {
+  if (IsMapped()) {
+    // Do not write the cleared cells into the private pages of the mapping.
+    Init(rows, cols);
+    return;
+  }
   unsigned int length = rows * cols;
   for (unsigned int i = 0; i < length; ++i) {
     map_cells_[i].Reset();
@@ -437,6 +462,79 @@ unsigned int LossyMapMatrix2D::GetBinarySize() const {
   return target_size;
 }
 
+unsigned int LossyMapMatrix2D::GetRawBinarySize(
+    unsigned int body_offset) const {
+  return GetRawCellsOffset(body_offset) - body_offset +
+         static_cast<unsigned int>(rows_ * cols_ * sizeof(LossyMapCell2D));
+}
+
+unsigned int LossyMapMatrix2D::CreateRawBinary(unsigned int body_offset,
+                                               unsigned char* buf,
+                                               unsigned int buf_size) const {
+  unsigned int target_size = GetRawBinarySize(body_offset);
+  if (buf_size >= target_size) {
+    memset(buf, 0, target_size);
+    unsigned int* p = reinterpret_cast<unsigned int*>(buf);
+    *p = kRawBinaryTag;
+    ++p;
+    *p = kRawBinaryVersion;
+    ++p;
+    *p = rows_;
+    ++p;
+    *p = cols_;
+    ++p;
+    *p = static_cast<unsigned int>(sizeof(LossyMapCell2D));
+    unsigned char* pp = buf + GetRawCellsOffset(body_offset) - body_offset;
+    memcpy(pp, map_cells_, rows_ * cols_ * sizeof(LossyMapCell2D));
+  }
+  return target_size;
+}
+
+bool LossyMapMatrix2D::MapRawBinary(void* data, size_t size,
+                                    unsigned int body_offset) {
+  unsigned char* buf = static_cast<unsigned char*>(data) + body_offset;
+  const unsigned int* p = reinterpret_cast<const unsigned int*>(buf);
+  if (size < body_offset + kRawBinaryHeaderSize || !IsRawBinary(buf) ||
+      p[1] != kRawBinaryVersion || p[4] != sizeof(LossyMapCell2D)) {
+    AERROR << "Invalid raw lossy map node binary.";
+    munmap(data, size);
+    return false;
+  }
+  const unsigned int rows = p[2];
+  const unsigned int cols = p[3];
+  const unsigned int cells_offset = GetRawCellsOffset(body_offset);
+  if (size < cells_offset + rows * cols * sizeof(LossyMapCell2D)) {
+    AERROR << "Truncated raw lossy map node binary.";
+    munmap(data, size);
+    return false;
+  }
+  ReleaseCells();
+  rows_ = rows;
+  cols_ = cols;
+  map_cells_ = reinterpret_cast<LossyMapCell2D*>(
+      static_cast<unsigned char*>(data) + cells_offset);
+  mapped_data_ = data;
+  mapped_size_ = size;
+  return true;
+}
+
+bool LossyMapMatrix2D::IsRawBinary(const unsigned char* buf) {
+  unsigned int tag = 0;
+  memcpy(&tag, buf, sizeof(tag));
+  return tag == kRawBinaryTag;
+}
+
+void LossyMapMatrix2D::ReleaseCells() {
+  if (mapped_data_ != nullptr) {
+    munmap(mapped_data_, mapped_size_);
+    mapped_data_ = nullptr;
+    mapped_size_ = 0;
+  } else if (map_cells_) {
+    delete[] map_cells_;
+  }
+  map_cells_ = nullptr;
+}
+
 void LossyMapMatrix2D::GetIntensityImg(cv::Mat* intensity_img) const {
   *intensity_img = cv::Mat(cv::Size(cols_, rows_), CV_8UC1);
 
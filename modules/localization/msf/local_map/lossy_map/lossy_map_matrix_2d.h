@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "modules/localization/msf/local_map/base_map/base_map_matrix.h"
 #include "modules/localization/msf/local_map/base_map/base_map_node.h"
 
@@ -81,6 +83,31 @@ class LossyMapMatrix2D : public BaseMapMatrix {
                                     unsigned int buf_size) const;
   /**@brief Get the binary size of the object. */
   virtual unsigned int GetBinarySize() const;
+  /**@brief Get the size of the raw binary, which keeps the cells as they are
+   * in memory so that they can be mapped from a file without decoding.
+   * @param <body_offset> The offset of the binary in the node file, the cells
+   * are aligned to kRawBinaryAlignment from the beginning of the file.
+   */
+  unsigned int GetRawBinarySize(unsigned int body_offset) const;
+  /**@brief Create the raw binary.
+   * @param <body_offset> The offset of the binary in the node file.
+   * @param <buf, buf_size> The buffer and its size.
+   * @param <return> The required or the used size of is returned.
+   */
+  unsigned int CreateRawBinary(unsigned int body_offset, unsigned char* buf,
+                               unsigned int buf_size) const;
+  /**@brief Use the cells of a mapped node file as the matrix storage. The
+   * matrix takes the ownership of the mapping and unmaps it when the cells
+   * are released.
+   * @param <data, size> The mapping of the whole node file.
+   * @param <body_offset> The offset of the raw binary in the node file.
+   * @param <return> If the raw binary is valid.
+   */
+  bool MapRawBinary(void* data, size_t size, unsigned int body_offset);
+  /**@brief If a binary chunk begins with the raw binary tag. */
+  static bool IsRawBinary(const unsigned char* buf);
+  /**@brief If the cells are stored in a mapped node file. */
+  inline bool IsMapped() const { return mapped_data_ != nullptr; }
   /**@brief get intensity image of node. */
   virtual void GetIntensityImg(cv::Mat* intensity_img) const;
 
@@ -93,13 +120,24 @@ class LossyMapMatrix2D : public BaseMapMatrix {
 
   LossyMapMatrix2D& operator=(const LossyMapMatrix2D& matrix);
 
+  /**@brief The alignment of the cells in a raw node file. */
+  static constexpr unsigned int kRawBinaryAlignment = 64;
+
  protected:
+  /**@brief Free the heap cells or unmap the mapped node file. */
+  void ReleaseCells();
+
+
   /**@brief The number of rows. */
   unsigned int rows_;
   /**@brief The number of columns. */
   unsigned int cols_;
   /**@brief The matrix data structure. */
   LossyMapCell2D* map_cells_;
+  /**@brief The mapped node file which stores the cells, if any. */
+  void* mapped_data_ = nullptr;
+  /**@brief The size of the mapped node file. */
+  size_t mapped_size_ = 0;
 
  protected:
   inline unsigned char EncodeIntensity(const LossyMapCell2D& cell) const;
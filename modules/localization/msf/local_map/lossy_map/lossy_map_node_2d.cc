@@ -0,0 +1,77 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/localization/msf/local_map/lossy_map/lossy_map_node_2d.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <vector>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace localization {
+namespace msf {
+
+unsigned int LossyMapNode2D::LoadBinary(FILE* file) {
+  // Load the header and peek at the beginning of the body.
+  unsigned int header_size = GetHeaderBinarySize();
+  std::vector<unsigned char> buf(header_size + sizeof(unsigned int));
+  size_t read_size = fread(&buf[0], 1, buf.size(), file);
+  if (read_size != buf.size() ||
+      !LossyMapMatrix2D::IsRawBinary(&buf[header_size])) {
+    fseek(file, 0, SEEK_SET);
+    return BaseMapNode::LoadBinary(file);
+  }
+  unsigned int processed_size = LoadHeaderBinary(&buf[0]);
+  CHECK_EQ(processed_size, header_size);
+
+  // Map the whole file, the pages are read in here rather than on the first
+  // access to the cells. Writes to the cells stay private to the process.
+  struct stat file_stat;
+  CHECK_EQ(fstat(fileno(file), &file_stat), 0);
+  const size_t file_size = static_cast<size_t>(file_stat.st_size);
+  void* data = mmap(nullptr, file_size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_POPULATE, fileno(file), 0);
+  CHECK(data != MAP_FAILED) << "Can't map the map node file.";
+  LossyMapMatrix2D* matrix = static_cast<LossyMapMatrix2D*>(map_matrix_);
+  CHECK(matrix->MapRawBinary(data, file_size, header_size));
+  return header_size + file_body_binary_size_;
+}
+
+unsigned int LossyMapNode2D::CreateBinary(FILE* file) const {
+  if (!use_raw_format_) {
+    return BaseMapNode::CreateBinary(file);
+  }
+  const LossyMapMatrix2D* matrix =
+      static_cast<const LossyMapMatrix2D*>(map_matrix_);
+  unsigned int header_size = GetHeaderBinarySize();
+  file_body_binary_size_ = matrix->GetRawBinarySize(header_size);
+  std::vector<unsigned char> buffer(header_size + file_body_binary_size_);
+  unsigned int processed_size =
+      CreateHeaderBinary(&buffer[0], static_cast<unsigned int>(buffer.size()));
+  CHECK_EQ(processed_size, header_size);
+  processed_size += matrix->CreateRawBinary(
+      header_size, &buffer[header_size], file_body_binary_size_);
+  fwrite(&buffer[0], 1, processed_size, file);
+  return processed_size;
+}
+
+}  // namespace msf
+}  // namespace localization
+}  // namespace apollo
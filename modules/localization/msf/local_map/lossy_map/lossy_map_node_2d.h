@@ -27,6 +27,26 @@ class LossyMapNode2D : public BaseMapNode {
  public:
   LossyMapNode2D() : BaseMapNode(new LossyMapMatrix2D(), new ZlibStrategy()) {}
   ~LossyMapNode2D() {}
+
+  /**@brief Save the node in the uncompressed raw format, which is mapped as
+   * the matrix storage when it is loaded instead of being decoded. Both
+   * formats are recognized on load. */
+  inline void SetUseRawFormat(bool use_raw_format) {
+    use_raw_format_ = use_raw_format;
+  }
+
+ protected:
+  /**@brief Load the map node, map the node file if it is in the raw format.
+   * @param <return> The size read (the real size of object).
+   */
+  virtual unsigned int LoadBinary(FILE* file);
+  /**@brief Create the binary in the compressed or the raw format.
+   * @param <return> The the used size of binary is returned.
+   */
+  virtual unsigned int CreateBinary(FILE* file) const;
+
+  /**@brief If the node is saved in the raw format. */
+  bool use_raw_format_ = false;
 };
 
 }  // namespace msf
@@ -0,0 +1,122 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/localization/msf/local_map/lossy_map/lossy_map_node_2d.h"
+
+#include <gtest/gtest.h>
+
+#include "modules/localization/msf/local_map/lossy_map/lossy_map_config_2d.h"
+
+namespace apollo {
+namespace localization {
+namespace msf {
+
+class LossyMapNode2DTestSuite : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    config_.map_folder_path_ = "/tmp/lossy_map_node_2d_test";
+    config_.map_node_size_x_ = 8;
+    config_.map_node_size_y_ = 6;
+    index_.m_ = 3;
+    index_.n_ = 4;
+  }
+
+  void FillNode(LossyMapNode2D* node) {
+    node->Init(&config_, index_);
+    LossyMapMatrix2D& matrix =
+        static_cast<LossyMapMatrix2D&>(node->GetMapCellMatrix());
+    for (unsigned int row = 0; row < config_.map_node_size_y_; ++row) {
+      for (unsigned int col = 0; col < config_.map_node_size_x_; ++col) {
+        LossyMapCell2D& cell = matrix[row][col];
+        cell.count = row + col;
+        cell.intensity = static_cast<float>(row * 10 + col);
+        cell.intensity_var = 1.0f;
+        cell.altitude = static_cast<float>(row) * 0.5f;
+        cell.altitude_ground = static_cast<float>(col) * 0.25f;
+        cell.is_ground_useful = (row + col) % 2 == 0;
+      }
+    }
+    node->SetIsChanged(true);
+  }
+
+  LossyMapConfig2D config_;
+  MapNodeIndex index_;
+};
+
+/**@brief Test the raw format is mapped as the cells on load. */
+TEST_F(LossyMapNode2DTestSuite, RawFormatTest) {
+  LossyMapNode2D node;
+  FillNode(&node);
+  node.SetUseRawFormat(true);
+  ASSERT_TRUE(node.Save());
+
+  LossyMapNode2D loaded_node;
+  loaded_node.Init(&config_, index_);
+  ASSERT_TRUE(loaded_node.Load());
+  const LossyMapMatrix2D& matrix =
+      static_cast<const LossyMapMatrix2D&>(node.GetMapCellMatrix());
+  LossyMapMatrix2D& loaded_matrix =
+      static_cast<LossyMapMatrix2D&>(loaded_node.GetMapCellMatrix());
+  EXPECT_TRUE(loaded_matrix.IsMapped());
+  EXPECT_EQ(loaded_node.GetMapNodeIndex(), index_);
+  for (unsigned int row = 0; row < config_.map_node_size_y_; ++row) {
+    for (unsigned int col = 0; col < config_.map_node_size_x_; ++col) {
+      EXPECT_EQ(loaded_matrix[row][col].count, matrix[row][col].count);
+      EXPECT_FLOAT_EQ(loaded_matrix[row][col].intensity,
+                      matrix[row][col].intensity);
+      EXPECT_FLOAT_EQ(loaded_matrix[row][col].altitude,
+                      matrix[row][col].altitude);
+      EXPECT_FLOAT_EQ(loaded_matrix[row][col].altitude_ground,
+                      matrix[row][col].altitude_ground);
+      EXPECT_EQ(loaded_matrix[row][col].is_ground_useful,
+                matrix[row][col].is_ground_useful);
+    }
+  }
+
+  // Resetting the node releases the mapping.
+  loaded_node.ResetMapNode();
+  EXPECT_FALSE(loaded_matrix.IsMapped());
+  EXPECT_EQ(loaded_matrix[1][2].count, 0);
+}
+
+/**@brief Test the compressed format is still decoded on load. */
+TEST_F(LossyMapNode2DTestSuite, CompressedFormatTest) {
+  LossyMapNode2D node;
+  FillNode(&node);
+  ASSERT_TRUE(node.Save());
+
+  LossyMapNode2D loaded_node;
+  loaded_node.Init(&config_, index_);
+  ASSERT_TRUE(loaded_node.Load());
+  const LossyMapMatrix2D& matrix =
+      static_cast<const LossyMapMatrix2D&>(node.GetMapCellMatrix());
+  const LossyMapMatrix2D& loaded_matrix =
+      static_cast<const LossyMapMatrix2D&>(loaded_node.GetMapCellMatrix());
+  EXPECT_FALSE(loaded_matrix.IsMapped());
+  for (unsigned int row = 0; row < config_.map_node_size_y_; ++row) {
+    for (unsigned int col = 0; col < config_.map_node_size_x_; ++col) {
+      EXPECT_FLOAT_EQ(loaded_matrix[row][col].intensity,
+                      matrix[row][col].intensity);
+      EXPECT_EQ(loaded_matrix[row][col].is_ground_useful,
+                matrix[row][col].is_ground_useful);
+    }
+  }
+}
+
+}  // namespace msf
+}  // namespace localization
+}  // namespace apollo
@@ -335,6 +335,8 @@ NdtMapMatrix::NdtMapMatrix(const NdtMapMatrix& cells) {
       cell = NdtMapCells(src_cell);
     }
   }
+  leaves_ = cells.leaves_;
+  leaf_begin_ = cells.leaf_begin_;
 }
 
 void NdtMapMatrix::Init(const BaseMapConfig* config) {
@@ -354,6 +356,8 @@ void NdtMapMatrix::Init(unsigned int rows, unsigned int cols) {
   map3d_cells_ = new NdtMapCells[rows * cols];
   rows_ = rows;
   cols_ = cols;
+  leaves_.clear();
+  leaf_begin_.clear();
 }
 
 void NdtMapMatrix::Reset(unsigned int rows, unsigned int cols) {
@@ -361,6 +365,8 @@ void NdtMapMatrix::Reset(unsigned int rows, unsigned int cols) {
   for (unsigned int i = 0; i < length; ++i) {
     map3d_cells_[i].Reset();
   }
+  leaves_.clear();
+  leaf_begin_.clear();
 }
 
 unsigned int NdtMapMatrix::LoadBinary(unsigned char* buf) {
@@ -378,9 +384,33 @@ unsigned int NdtMapMatrix::LoadBinary(unsigned char* buf) {
       pp += processed_size;
     }
   }
+  BuildLeaves();
   return GetBinarySize();
 }
 
+void NdtMapMatrix::BuildLeaves() {
+  leaves_.clear();
+  leaf_begin_.clear();
+  leaf_begin_.reserve(rows_ * cols_ + 1);
+  for (unsigned int i = 0; i < rows_ * cols_; ++i) {
+    leaf_begin_.push_back(static_cast<unsigned int>(leaves_.size()));
+    for (const auto& single_cell : map3d_cells_[i].cells_) {
+      const NdtMapSingleCell& cell = single_cell.second;
+      if (cell.count_ < cell.minimum_points_threshold_) {
+        continue;
+      }
+      NdtMapLeaf leaf;
+      leaf.centroid = cell.centroid_;
+      leaf.icov = cell.centroid_icov_;
+      leaf.altitude_index = single_cell.first;
+      leaf.count = cell.count_;
+      leaf.is_icov_available = cell.is_icov_available_;
+      leaves_.push_back(leaf);
+    }
+  }
+  leaf_begin_.push_back(static_cast<unsigned int>(leaves_.size()));
+}
+
 unsigned int NdtMapMatrix::CreateBinary(unsigned char* buf,
                                         unsigned int buf_size) const {
   unsigned int target_size = GetBinarySize();
@@ -132,6 +132,22 @@ class NdtMapCells {
   std::vector<int> road_cell_indices_;
 };
 
+/**@brief A single cell with enough samples for the NDT matching. The single
+ * cells of a loaded matrix are flattened into a contiguous array of them, so
+ * the matching only slices the array. */
+struct NdtMapLeaf {
+  /**@brief The centroid relative to the cell and its altitude. */
+  Eigen::Vector3f centroid;
+  /**@brief The inverse covariance. */
+  Eigen::Matrix3f icov;
+  /**@brief The altitude index of the single cell. */
+  int altitude_index = 0;
+  /**@brief The number of samples. */
+  unsigned int count = 0;
+  /**@brief The inverse covariance avaliable flag. */
+  unsigned char is_icov_available = 0;
+};
+
 /**@brief The data structure of ndt Map matrix. */
 class NdtMapMatrix : public BaseMapMatrix {
  public:
@@ -187,6 +203,22 @@ class NdtMapMatrix : public BaseMapMatrix {
   /**@brief Combine two NdtMapMatrix instances (Reduce). */
   static void Reduce(NdtMapMatrix* cells, const NdtMapMatrix& cells_new);
 
+  /**@brief Flatten the single cells with enough samples into the leaves.
+   * Done by LoadBinary, call it again after the cells are modified. */
+  void BuildLeaves();
+  /**@brief Get the first leaf of a map cell. */
+  inline const NdtMapLeaf* GetLeavesBegin(unsigned int row,
+                                          unsigned int col) const {
+    assert(leaf_begin_.size() == rows_ * cols_ + 1);
+    return leaves_.data() + leaf_begin_[row * cols_ + col];
+  }
+  /**@brief Get the end of the leaves of a map cell. */
+  inline const NdtMapLeaf* GetLeavesEnd(unsigned int row,
+                                        unsigned int col) const {
+    assert(leaf_begin_.size() == rows_ * cols_ + 1);
+    return leaves_.data() + leaf_begin_[row * cols_ + col + 1];
+  }
+
  private:
   /**@brief The number of rows. */
   unsigned int rows_;
@@ -194,6 +226,10 @@ class NdtMapMatrix : public BaseMapMatrix {
   unsigned int cols_;
   /**@brief The matrix data structure. */
   NdtMapCells* map3d_cells_;
+  /**@brief The leaves of all the map cells, row by row. */
+  std::vector<NdtMapLeaf> leaves_;
+  /**@brief The index of the first leaf of every map cell, and the end. */
+  std::vector<unsigned int> leaf_begin_;
 };
 
 inline void NdtMapSingleCell::Reset() {
@@ -128,6 +128,42 @@ TEST_F(MapNdtTestSuite, matrix) {
   }
 }
 
+TEST_F(MapNdtTestSuite, leaves) {
+  NdtMapMatrix matrix;
+  matrix.Init(2, 3);
+  // Only the single cells with at least six samples become leaves.
+  NdtMapCells& cells = matrix.GetMapCell(1, 2);
+  for (int i = 0; i < 6; ++i) {
+    const Eigen::Vector3f centroid(0.1f * static_cast<float>(i),
+                                   0.05f * static_cast<float>(i * i),
+                                   0.2f + 0.1f * static_cast<float>(i % 3));
+    cells.AddSample(10.0f, 0.5f, 1.0f, centroid);
+  }
+  for (int i = 0; i < 3; ++i) {
+    cells.AddSample(10.0f, 2.5f, 1.0f, Eigen::Vector3f(0.5f, 0.5f, 0.5f));
+  }
+
+  std::vector<unsigned char> buf(matrix.GetBinarySize());
+  matrix.CreateBinary(buf.data(), static_cast<unsigned int>(buf.size()));
+  NdtMapMatrix loaded;
+  EXPECT_EQ(buf.size(), loaded.LoadBinary(buf.data()));
+
+  for (unsigned int y = 0; y < 2; ++y) {
+    for (unsigned int x = 0; x < 3; ++x) {
+      const int num_leaves = static_cast<int>(loaded.GetLeavesEnd(y, x) -
+                                              loaded.GetLeavesBegin(y, x));
+      EXPECT_EQ(y == 1 && x == 2 ? 1 : 0, num_leaves);
+    }
+  }
+  const NdtMapLeaf& leaf = *loaded.GetLeavesBegin(1, 2);
+  const NdtMapSingleCell& cell = cells.cells_.at(0);
+  EXPECT_EQ(0, leaf.altitude_index);
+  EXPECT_EQ(6, leaf.count);
+  EXPECT_EQ(cell.is_icov_available_, leaf.is_icov_available);
+  EXPECT_TRUE(leaf.centroid.isApprox(cell.centroid_));
+  EXPECT_TRUE(leaf.icov.isApprox(cell.centroid_icov_));
+}
+
 }  // namespace msf
 }  // namespace localization
 }  // namespace apollo
@@ -14,9 +14,17 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <vector>
+
 #include "boost/filesystem.hpp"
 #include "boost/program_options.hpp"
 
+#include "cyber/task/task.h"
 #include "modules/localization/msf/common/io/velodyne_utility.h"
 #include "modules/localization/msf/common/util/extract_ground_plane.h"
 #include "modules/localization/msf/common/util/system_utility.h"
@@ -28,6 +36,7 @@ const unsigned int CAR_SENSOR_LASER_NUMBER = 64;
 using apollo::localization::msf::FeatureXYPlane;
 using apollo::localization::msf::LosslessMap;
 using apollo::localization::msf::LosslessMapConfig;
+using apollo::localization::msf::LosslessMapNode;
 using apollo::localization::msf::LosslessMapNodePool;
 using apollo::localization::msf::MapNodeIndex;
 typedef apollo::localization::msf::FeatureXYPlane::PointT PclPointT;
@@ -69,7 +78,18 @@ bool ParseCommandLine(int argc, char* argv[],
           "resolution",
           boost::program_options::value<float>()->default_value(0.125),
           "optional: resolution for single resolution generation, default: "
-          "0.125");
+          "0.125")(
+          "num_shards",
+          boost::program_options::value<unsigned int>()->default_value(1),
+          "optional: number of map node shards filled in parallel, each "
+          "with its own node cache, default: 1")(
+          "checkpoint_frames",
+          boost::program_options::value<unsigned int>()->default_value(1000),
+          "optional: frames between saving all map nodes and the progress, "
+          "0 for the end of every pcd folder only, default: 1000")(
+          "resume", boost::program_options::value<bool>()->default_value(false),
+          "optional: continue an interrupted run after its last checkpoint, "
+          "default: false");
   try {
     boost::program_options::store(
         boost::program_options::parse_command_line(argc, argv, desc), *vm);
@@ -89,6 +109,106 @@ bool ParseCommandLine(int argc, char* argv[],
   return true;
 }
 
+// A point of a frame to add to a map node.
+struct NodePoint {
+  MapNodeIndex index;
+  Eigen::Vector3d pt3d;
+  unsigned char intensity;
+  bool is_layer;
+};
+
+// The map nodes of one shard with their own cache and pool, so that the
+// shards are filled in parallel and the memory used is bounded by the
+// number of shards.
+struct MapShard {
+  explicit MapShard(LosslessMapConfig* config)
+      : map(config), node_pool(25, 8) {
+    node_pool.Initial(config);
+    map.InitMapNodeCaches(12, 24);
+    map.AttachMapNodePool(&node_pool);
+  }
+
+  // The pool saves the changed nodes when it is destroyed before the map.
+  LosslessMap map;
+  LosslessMapNodePool node_pool;
+  // The points of the current frame falling into the nodes of the shard.
+  std::vector<NodePoint> points;
+};
+
+unsigned int GetShardId(const MapNodeIndex& index, unsigned int num_shards) {
+  return (index.m_ * 31 + index.n_) % num_shards;
+}
+
+void AddPointToShards(const Eigen::Vector3d& pt3d, unsigned char intensity,
+                      bool is_layer, int zone_id,
+                      std::vector<std::unique_ptr<MapShard>>* shards) {
+  const LosslessMapConfig& config =
+      static_cast<const LosslessMapConfig&>((*shards)[0]->map.GetConfig());
+  for (size_t i = 0; i < config.map_resolutions_.size(); ++i) {
+    NodePoint point;
+    point.index = MapNodeIndex::GetMapNodeIndex(
+        config, pt3d, static_cast<unsigned int>(i), zone_id);
+    point.pt3d = pt3d;
+    point.intensity = intensity;
+    point.is_layer = is_layer;
+    const unsigned int shard_id =
+        GetShardId(point.index, static_cast<unsigned int>(shards->size()));
+    (*shards)[shard_id]->points.push_back(point);
+  }
+}
+
+// Add the points in the order they came, so every node gets the same
+// samples in the same order as without the shards.
+void FillShard(MapShard* shard) {
+  for (const NodePoint& point : shard->points) {
+    LosslessMapNode* node =
+        static_cast<LosslessMapNode*>(shard->map.GetMapNodeSafe(point.index));
+    if (point.is_layer) {
+      node->SetValueLayer(point.pt3d, point.intensity);
+    } else {
+      node->SetValue(point.pt3d, point.intensity);
+    }
+  }
+  shard->points.clear();
+}
+
+void FillShards(std::vector<std::unique_ptr<MapShard>>* shards) {
+  std::vector<std::future<void>> futures;
+  for (size_t i = 1; i < shards->size(); ++i) {
+    futures.push_back(apollo::cyber::Async(&FillShard, (*shards)[i].get()));
+  }
+  FillShard((*shards)[0].get());
+  for (auto& future : futures) {
+    future.get();
+  }
+}
+
+// Recreate the shards, which saves all the changed map nodes.
+void FlushShards(LosslessMapConfig* config,
+                 std::vector<std::unique_ptr<MapShard>>* shards) {
+  for (auto& shard : *shards) {
+    shard.reset(new MapShard(config));
+  }
+}
+
+// The progress is the next frame to process, saved once all the map nodes
+// with the frames before it are on disk.
+bool LoadProgress(const std::string& path, unsigned int* trial,
+                  unsigned int* frame_idx) {
+  std::ifstream fin(path);
+  return static_cast<bool>(fin >> *trial >> *frame_idx);
+}
+
+void SaveProgress(const std::string& path, unsigned int trial,
+                  unsigned int frame_idx) {
+  const std::string tmp_path = path + ".tmp";
+  {
+    std::ofstream fout(tmp_path);
+    fout << trial << " " << frame_idx << std::endl;
+  }
+  std::rename(tmp_path.c_str(), path.c_str());
+}
+
 void VarianceOnline(double* mean, double* var, unsigned int* N, double x) {
   ++(*N);
   double value = (x - (*mean)) / (*N);
@@ -154,6 +274,12 @@ int main(int argc, char** argv) {
               << "4.0, 8.0 or 16.0." << std::endl;
   }
 
+  const unsigned int num_shards =
+      std::max(boost_args["num_shards"].as<unsigned int>(), 1u);
+  const unsigned int checkpoint_frames =
+      boost_args["checkpoint_frames"].as<unsigned int>();
+  const bool resume = boost_args["resume"].as<bool>();
+
   const size_t num_trials = pcd_folder_pathes.size();
 
   // load all poses
@@ -178,8 +304,18 @@ int main(int argc, char** argv) {
     apollo::localization::msf::system::CreateDirectory(map_folder_path);
   }
   map.SetMapFolderPath(map_folder_path);
-  for (size_t i = 0; i < pcd_folder_pathes.size(); ++i) {
-    map.AddDataset(pcd_folder_pathes[i]);
+  // The nodes of an existing map are loaded and extended, so the pcd folders
+  // of a new run are merged into it. A resumed run added its folders before.
+  const std::string progress_path = map_folder_path + "/creation_progress.txt";
+  unsigned int start_trial = 0;
+  unsigned int start_frame_idx = 0;
+  if (resume && LoadProgress(progress_path, &start_trial, &start_frame_idx)) {
+    std::cerr << "Resume from trial " << start_trial << " frame "
+              << start_frame_idx << "." << std::endl;
+  } else {
+    for (size_t i = 0; i < pcd_folder_pathes.size(); ++i) {
+      map.AddDataset(pcd_folder_pathes[i]);
+    }
   }
   if (strcasecmp(map_resolution_type.c_str(), "single") == 0) {
     loss_less_config.SetSingleResolutions(single_resolution_map);
@@ -249,14 +385,17 @@ int main(int argc, char** argv) {
               << "./lossless_map/config.txt" << std::endl;
   }
 
-  LosslessMapNodePool lossless_map_node_pool(25, 8);
-  lossless_map_node_pool.Initial(&loss_less_config);
-  map.InitMapNodeCaches(12, 24);
-  map.AttachMapNodePool(&lossless_map_node_pool);
+  std::vector<std::unique_ptr<MapShard>> shards(num_shards);
+  FlushShards(&loss_less_config, &shards);
 
-  for (unsigned int trial = 0; trial < num_trials; ++trial) {
-    for (unsigned int frame_idx = 0; frame_idx < ieout_poses[trial].size();
-         ++frame_idx) {
+  for (unsigned int trial = start_trial; trial < num_trials; ++trial) {
+    unsigned int frame_idx = trial == start_trial ? start_frame_idx : 0;
+    for (; frame_idx < ieout_poses[trial].size(); ++frame_idx) {
+      if (checkpoint_frames > 0 && frame_idx > 0 &&
+          frame_idx % checkpoint_frames == 0) {
+        FlushShards(&loss_less_config, &shards);
+        SaveProgress(progress_path, trial, frame_idx);
+      }
       unsigned int trial_frame_idx = frame_idx;
       const std::vector<Eigen::Affine3d>& poses = ieout_poses[trial];
       apollo::localization::msf::velodyne::VelodyneFrame velodyne_frame;
@@ -275,7 +414,7 @@ int main(int argc, char** argv) {
         Eigen::Vector3d& pt3d_local = velodyne_frame.pt3ds[i];
         unsigned char intensity = velodyne_frame.intensities[i];
         Eigen::Vector3d pt3d_global = velodyne_frame.pose * pt3d_local;
-        map.SetValue(pt3d_global, zone_id, intensity);
+        AddPointToShards(pt3d_global, intensity, false, zone_id, &shards);
       }
 
       if (use_plane_inliers_only) {
@@ -301,10 +440,14 @@ int main(int argc, char** argv) {
           unsigned char intensity =
               static_cast<unsigned char>(plane_pt.intensity);
           Eigen::Vector3d pt3d_global = velodyne_frame.pose * pt3d_local_double;
-          map.SetValueLayer(pt3d_global, zone_id, intensity);
+          AddPointToShards(pt3d_global, intensity, true, zone_id, &shards);
         }
       }
+
+      FillShards(&shards);
     }
+    FlushShards(&loss_less_config, &shards);
+    SaveProgress(progress_path, trial + 1, 0);
   }
 
   // Compute the ground height offset
@@ -316,18 +459,23 @@ int main(int argc, char** argv) {
       const Eigen::Affine3d& ieout_pose = ieout_poses[trial][i];
       const Eigen::Vector3d& pt3d = ieout_pose.translation();
       unsigned int resolution_id = 0;
+      LosslessMap& shard_map =
+          shards[GetShardId(MapNodeIndex::GetMapNodeIndex(
+                                loss_less_config, pt3d, resolution_id, zone_id),
+                            num_shards)]
+              ->map;
       if (use_plane_inliers_only) {
         // Use the altitudes from layer 0 (layer 1 internally in the Map).
         unsigned int layer_id = 0;
         std::vector<unsigned int> layer_counts;
-        map.GetCountSafe(pt3d, zone_id, resolution_id, &layer_counts);
+        shard_map.GetCountSafe(pt3d, zone_id, resolution_id, &layer_counts);
         if (layer_counts.size() == 0) {
           AERROR << "No ground layer, skip.";
           continue;
         }
         if (layer_counts[layer_id] > 0) {
           std::vector<float> layer_alts;
-          map.GetAltSafe(pt3d, zone_id, resolution_id, &layer_alts);
+          shard_map.GetAltSafe(pt3d, zone_id, resolution_id, &layer_alts);
           if (layer_alts.empty()) {
             AERROR << "No ground points, skip.";
             continue;
@@ -339,9 +487,10 @@ int main(int argc, char** argv) {
         }
       } else {
         // Use the altitudes from all layers
-        unsigned int count = map.GetCountSafe(pt3d, zone_id, resolution_id);
+        unsigned int count =
+            shard_map.GetCountSafe(pt3d, zone_id, resolution_id);
         if (count > 0) {
-          float alt = map.GetAltSafe(pt3d, zone_id, resolution_id);
+          float alt = shard_map.GetAltSafe(pt3d, zone_id, resolution_id);
           double height_diff = pt3d[2] - alt;
           VarianceOnline(&mean_height_diff, &var_height_diff,
                          &count_height_diff, height_diff);
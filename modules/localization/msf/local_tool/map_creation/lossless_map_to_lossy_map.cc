@@ -113,7 +113,8 @@ int main(int argc, char** argv) {
       "srcdir", boost::program_options::value<std::string>(),
       "provide the data base dir")("dstdir",
                                    boost::program_options::value<std::string>(),
-                                   "provide the lossy map destination dir");
+                                   "provide the lossy map destination dir")(
+      "raw", "save the nodes uncompressed so that they are mapped on load");
 
   boost::program_options::variables_map boost_args;
   boost::program_options::store(
@@ -130,6 +131,7 @@ int main(int argc, char** argv) {
   const std::string src_path = boost_args["srcdir"].as<std::string>();
   const std::string dst_path = boost_args["dstdir"].as<std::string>();
   std::string src_map_folder = src_path + "/";
+  const bool use_raw_format = boost_args.count("raw") > 0;
 
   LosslessMapConfig lossless_config("lossless_map");
   LosslessMapNodePool lossless_map_node_pool(25, 8);
@@ -192,6 +194,7 @@ int main(int argc, char** argv) {
 
     LossyMapNode* lossy_node =
         static_cast<LossyMapNode*>(lossy_map.GetMapNodeSafe(*itr));
+    lossy_node->SetUseRawFormat(use_raw_format);
     LossyMapMatrix& lossy_matrix =
         static_cast<LossyMapMatrix&>(lossy_node->GetMapCellMatrix());
 
@@ -71,6 +71,10 @@ void MSFLocalization::InitParams() {
   localization_param_.lidar_yaw_align_mode = FLAGS_lidar_yaw_align_mode;
   localization_param_.lidar_filter_size = FLAGS_lidar_filter_size;
   localization_param_.map_coverage_theshold = FLAGS_lidar_map_coverage_theshold;
+  localization_param_.map_prefetch_horizon = FLAGS_lidar_map_prefetch_horizon;
+  localization_param_.map_prefetch_max_loads =
+      FLAGS_lidar_map_prefetch_max_loads;
+  localization_param_.map_compose_threads = FLAGS_lidar_map_compose_threads;
   localization_param_.imu_lidar_max_delay_time = FLAGS_lidar_imu_max_delay_time;
   localization_param_.if_use_avx = FLAGS_if_use_avx;
 
@@ -196,7 +200,23 @@ void MSFLocalization::OnPointCloud(
   }
 
   localization_integ_.PcdProcess(*message);
+  PublishLidarLocalization();
+  return;
+}
+
+void MSFLocalization::OnPointCloudBuffer(
+    const std::shared_ptr<drivers::PointCloudBuffer> &buffer) {
+  ++pcd_msg_index_;
+  if (pcd_msg_index_ % FLAGS_point_cloud_step != 0) {
+    return;
+  }
+
+  localization_integ_.PcdProcess(*buffer);
+  PublishLidarLocalization();
+  return;
+}
 
+void MSFLocalization::PublishLidarLocalization() {
   const auto &result = localization_integ_.GetLastestLidarLocalization();
 
   if (result.state() == msf::LocalizationMeasureState::OK ||
@@ -204,8 +224,6 @@ void MSFLocalization::OnPointCloud(
     // publish lidar message to debug
     publisher_->PublishLocalizationMsfLidar(result.localization());
   }
-
-  return;
 }
 
 void MSFLocalization::OnRawImu(
@@ -312,6 +330,15 @@ void MSFLocalization::SetPublisher(
   publisher_ = publisher;
 }
 
+const msf::LocalizationResult &MSFLocalization::GetLastestIntegLocalization()
+    const {
+  return localization_integ_.GetLastestIntegLocalization();
+}
+
+msf::MapNodeCacheStats MSFLocalization::GetMapCacheStats() {
+  return localization_integ_.GetMapCacheStats();
+}
+
 void MSFLocalization::CompensateImuVehicleExtrinsic(
     LocalizationEstimate *local_result) {
   CHECK_NOTNULL(local_result);
@@ -29,6 +29,7 @@
 #include "Eigen/Core"
 #include "Eigen/Geometry"
 
+#include "modules/drivers/common/point_cloud_buffer.h"
 #include "modules/drivers/gnss/proto/gnss_best_pose.pb.h"
 #include "modules/drivers/gnss/proto/gnss_raw_observation.pb.h"
 #include "modules/drivers/gnss/proto/imu.pb.h"
@@ -61,6 +62,8 @@ class MSFLocalization {
   apollo::common::Status Init();
   void InitParams();
   void OnPointCloud(const std::shared_ptr<drivers::PointCloud> &message);
+  void OnPointCloudBuffer(
+      const std::shared_ptr<drivers::PointCloudBuffer> &buffer);
   void OnRawImu(const std::shared_ptr<drivers::gnss::Imu> &imu_msg);
   void OnGnssRtkObs(
       const std::shared_ptr<drivers::gnss::EpochObservation> &raw_obs_msg);
@@ -73,6 +76,9 @@ class MSFLocalization {
 
   void SetPublisher(const std::shared_ptr<LocalizationMsgPublisher> &publisher);
 
+  const msf::LocalizationResult &GetLastestIntegLocalization() const;
+  msf::MapNodeCacheStats GetMapCacheStats();
+
  private:
   bool LoadGnssAntennaExtrinsic(const std::string &file_path, double *offset_x,
                                 double *offset_y, double *offset_z,
@@ -83,6 +89,7 @@ class MSFLocalization {
                                double *quat_qw);
   bool LoadZoneIdFromFolder(const std::string &folder_path, int *zone_id);
   void CompensateImuVehicleExtrinsic(LocalizationEstimate *local_result);
+  void PublishLidarLocalization();
 
  private:
   apollo::common::monitor::MonitorLogBuffer monitor_logger_;
@@ -48,6 +48,7 @@ bool MSFLocalizationComponent::Init() {
 
 bool MSFLocalizationComponent::InitConfig() {
   lidar_topic_ = FLAGS_lidar_topic;
+  lidar_buffer_topic_ = FLAGS_lidar_buffer_topic;
   bestgnsspos_topic_ = FLAGS_gnss_best_pose_topic;
   gnss_heading_topic_ = FLAGS_heading_topic;
 
@@ -66,15 +67,26 @@ bool MSFLocalizationComponent::InitConfig() {
 
 bool MSFLocalizationComponent::InitIO() {
   cyber::ReaderConfig reader_config;
-  reader_config.channel_name = lidar_topic_;
   reader_config.pending_queue_size = 1;
 
-  std::function<void(const std::shared_ptr<drivers::PointCloud>&)>
-      lidar_register_call = std::bind(&MSFLocalization::OnPointCloud,
-                                      &localization_, std::placeholders::_1);
-
-  lidar_listener_ = this->node_->CreateReader<drivers::PointCloud>(
-      reader_config, lidar_register_call);
+  if (lidar_buffer_topic_.empty()) {
+    reader_config.channel_name = lidar_topic_;
+    std::function<void(const std::shared_ptr<drivers::PointCloud>&)>
+        lidar_register_call = std::bind(&MSFLocalization::OnPointCloud,
+                                        &localization_, std::placeholders::_1);
+    lidar_listener_ = this->node_->CreateReader<drivers::PointCloud>(
+        reader_config, lidar_register_call);
+  } else {
+    // share the pointcloud decoded by the lidar driver in this process
+    reader_config.channel_name = lidar_buffer_topic_;
+    std::function<void(const std::shared_ptr<drivers::PointCloudBuffer>&)>
+        lidar_buffer_call =
+            std::bind(&MSFLocalization::OnPointCloudBuffer, &localization_,
+                      std::placeholders::_1);
+    lidar_buffer_listener_ =
+        this->node_->CreateReader<drivers::PointCloudBuffer>(
+            reader_config, lidar_buffer_call);
+  }
 
   std::function<void(const std::shared_ptr<drivers::gnss::GnssBestPose>&)>
       bestgnsspos_register_call =
@@ -54,6 +54,10 @@ class MSFLocalizationComponent final
   std::shared_ptr<cyber::Reader<drivers::PointCloud>> lidar_listener_ = nullptr;
   std::string lidar_topic_ = "";
 
+  std::shared_ptr<cyber::Reader<drivers::PointCloudBuffer>>
+      lidar_buffer_listener_ = nullptr;
+  std::string lidar_buffer_topic_ = "";
+
   std::shared_ptr<cyber::Reader<drivers::gnss::GnssBestPose>>
       bestgnsspos_listener_ = nullptr;
   std::string bestgnsspos_topic_ = "";
@@ -84,8 +84,7 @@ void NDTLocalization::Init() {
   lidar_locator_.SetOnlineCloudResolution(
       static_cast<float>(online_resolution_));
 
-  odometry_buffer_.clear();
-  odometry_buffer_size_ = 0;
+  odometry_buffer_.Clear();
 
   is_service_started_ = false;
 }
@@ -124,17 +123,11 @@ void NDTLocalization::OdometryCallback(
     return;
   }
 
-  TimeStampPose timestamp_pose;
-  timestamp_pose.timestamp = odometry_time;
-  timestamp_pose.pose = odometry_pose;
   {
     std::lock_guard<std::mutex> lock(odometry_buffer_mutex_);
-    if (odometry_buffer_size_ < max_odometry_buffer_size_) {
-      odometry_buffer_.push_back(timestamp_pose);
-      odometry_buffer_size_++;
-    } else {
-      odometry_buffer_.pop_front();
-      odometry_buffer_.push_back(timestamp_pose);
+    if (!odometry_buffer_.Push(odometry_time, odometry_pose)) {
+      AWARN << "Odometry time is not increasing: " << std::setprecision(15)
+            << odometry_time;
     }
   }
 
@@ -403,56 +396,21 @@ void NDTLocalization::ComposeLocalizationStatus(
 bool NDTLocalization::QueryPoseFromBuffer(double time, Eigen::Affine3d* pose) {
   CHECK_NOTNULL(pose);
 
-  TimeStampPose pre_pose;
-  TimeStampPose next_pose;
-  {
-    std::lock_guard<std::mutex> lock(odometry_buffer_mutex_);
-    TimeStampPose timestamp_pose = odometry_buffer_.back();
-    // check abnormal timestamp
-    if (time > timestamp_pose.timestamp) {
-      AERROR << "query time is newer than latest odometry time, it doesn't "
-                "make sense!";
-      return false;
-    }
-    // search from reverse direction
-    auto iter = odometry_buffer_.crbegin();
-    for (; iter != odometry_buffer_.crend(); ++iter) {
-      if (iter->timestamp < time) {
-        break;
-      }
-    }
-    if (iter == odometry_buffer_.crend()) {
-      AINFO << "Cannot find matching pose from odometry buffer";
-      return false;
-    }
-    pre_pose = *iter;
-    next_pose = *(--iter);
-  }
-  // interpolation
-  double v1 =
-      (next_pose.timestamp - time) / (next_pose.timestamp - pre_pose.timestamp);
-  double v2 =
-      (time - pre_pose.timestamp) / (next_pose.timestamp - pre_pose.timestamp);
-  pose->translation() =
-      pre_pose.pose.translation() * v1 + next_pose.pose.translation() * v2;
-
-  Eigen::Quaterniond pre_quat(pre_pose.pose.linear());
-
-  common::math::EulerAnglesZXYd pre_euler(pre_quat.w(), pre_quat.x(),
-                                          pre_quat.y(), pre_quat.z());
-
-  Eigen::Quaterniond next_quat(next_pose.pose.linear());
-  common::math::EulerAnglesZXYd next_euler(next_quat.w(), next_quat.x(),
-                                           next_quat.y(), next_quat.z());
-
-  double tmp_euler[3] = {};
-  tmp_euler[0] = pre_euler.pitch() * v1 + next_euler.pitch() * v2;
-  tmp_euler[1] = pre_euler.roll() * v1 + next_euler.roll() * v2;
-  tmp_euler[2] = pre_euler.yaw() * v1 + next_euler.yaw() * v2;
-  common::math::EulerAnglesZXYd euler(tmp_euler[1], tmp_euler[0], tmp_euler[2]);
-  Eigen::Quaterniond quat = euler.ToQuaternion();
-  quat.normalize();
-  pose->linear() = quat.toRotationMatrix();
+  std::lock_guard<std::mutex> lock(odometry_buffer_mutex_);
+  if (odometry_buffer_.Size() == 0) {
+    AINFO << "Cannot find matching pose from empty odometry buffer";
+    return false;
+  }
+  // check abnormal timestamp
+  if (time > odometry_buffer_.BackTimestamp()) {
+    AERROR << "query time is newer than latest odometry time, it doesn't "
+              "make sense!";
+    return false;
+  }
+  if (!odometry_buffer_.Interpolate(time, pose)) {
+    AINFO << "Cannot find matching pose from odometry buffer";
+    return false;
+  }
   return true;
 }
 
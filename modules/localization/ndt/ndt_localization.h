@@ -21,6 +21,7 @@
 #include <string>
 #include "modules/drivers/gnss/proto/ins.pb.h"
 #include "modules/drivers/proto/pointcloud.pb.h"
+#include "modules/localization/msf/common/util/pose_ring_buffer.h"
 #include "modules/localization/ndt/localization_pose_buffer.h"
 #include "modules/localization/ndt/ndt_locator/lidar_locator_ndt.h"
 #include "modules/localization/proto/gps.pb.h"
@@ -37,11 +38,6 @@ struct LidarHeight {
   double height_var;
 };
 
-struct TimeStampPose {
-  double timestamp = 0.0;
-  Eigen::Affine3d pose;
-};
-
 class NDTLocalization {
  public:
   NDTLocalization() {}
@@ -67,6 +63,10 @@ class NDTLocalization {
   inline int GetZoneId() const { return zone_id_; }
   /**@brief get online resolution for ndt localizaiton*/
   inline double GetOnlineResolution() const { return online_resolution_; }
+  /**@brief get the statistics of the map node caches */
+  inline msf::MapNodeCacheStats GetMapCacheStats() {
+    return lidar_locator_.GetMapCacheStats();
+  }
 
  private:
   /**@brief transfer pointcloud message to LidarFrame */
@@ -128,10 +128,8 @@ class NDTLocalization {
   double error_ndt_score_ = 2.0;
   bool is_service_started_ = false;
 
-  std::list<TimeStampPose> odometry_buffer_;
+  msf::PoseRingBuffer odometry_buffer_{100};
   std::mutex odometry_buffer_mutex_;
-  unsigned int odometry_buffer_size_ = 0;
-  const unsigned int max_odometry_buffer_size_ = 100;
 
   LocalizationEstimate localization_result_;
   LocalizationStatus localization_status_;
@@ -84,6 +84,7 @@ void LidarLocatorNdt::Init(const Eigen::Affine3d& init_location,
   reg_.SetResolution(static_cast<float>(ndt_target_resolution_));
   reg_.SetStepSize(ndt_line_search_step_size_);
   reg_.SetTransformationEpsilon(ndt_transformation_epsilon_);
+  reg_.SetNumThreads(FLAGS_ndt_num_threads);
 
   is_initialized_ = true;
 }
@@ -172,10 +173,14 @@ int LidarLocatorNdt::Update(unsigned int frame_idx, const Eigen::Affine3d& pose,
   AINFO << "Online point cloud leaf size: " << proj_reslution_;
   pcl::PointCloud<pcl::PointXYZ>::Ptr online_points_filtered(
       new pcl::PointCloud<pcl::PointXYZ>());
-  pcl::VoxelGrid<pcl::PointXYZ> sor;
-  sor.setInputCloud(online_points);
-  sor.setLeafSize(proj_reslution_, proj_reslution_, proj_reslution_);
-  sor.filter(*online_points_filtered);
+  online_downsampler_.SetLeafSize(proj_reslution_, proj_reslution_,
+                                  proj_reslution_);
+  online_downsampler_.Compute(online_points->points.data(),
+                              online_points->size());
+  online_downsampler_.GetCentroids(&online_points_filtered->points);
+  online_points_filtered->width =
+      static_cast<uint32_t>(online_points_filtered->points.size());
+  online_points_filtered->height = 1;
   AINFO << "Online Pointcloud size: " << online_points->size() << "/"
         << online_points_filtered->size();
   online_filtered_timer.End("online point calc end.");
@@ -461,33 +466,31 @@ void LidarLocatorNdt::ComposeMapCells(
              map_y <= map_nodes_zones[y * 3 + x][3]; ++map_y) {
           for (int map_x = map_nodes_zones[y * 3 + x][0];
                map_x <= map_nodes_zones[y * 3 + x][2]; ++map_x) {
-            const msf::NdtMapCells& cell_ndt =
-                map_cells.GetMapCell(map_y, map_x);
-            if (cell_ndt.cells_.size() > 0) {
-              for (auto it = cell_ndt.cells_.begin();
-                   it != cell_ndt.cells_.end(); ++it) {
-                unsigned int cell_count = it->second.count_;
-                if (cell_count >= 6) {
-                  Leaf leaf;
-                  leaf.nr_points_ = static_cast<int>(cell_count);
-
-                  Eigen::Vector3d eigen_point(Eigen::Vector3d::Zero());
-                  eigen_point(0) = left_top_corner[0] + map_x * resolution +
-                                   it->second.centroid_[0];
-                  eigen_point(1) = left_top_corner[1] + map_y * resolution +
-                                   it->second.centroid_[1];
-                  eigen_point(2) =
-                      resolution_z * it->first + it->second.centroid_[2];
-                  leaf.mean_ = (eigen_point + R_inv_t);
-                  if (it->second.is_icov_available_ == 1) {
-                    leaf.icov_ = it->second.centroid_icov_.cast<double>();
-                  } else {
-                    leaf.nr_points_ = -1;
-                  }
-
-                  cell_map_.push_back(leaf);
-                }
+            // The single cells with enough samples are flattened into
+            // leaves with their inverse covariances when the node is loaded.
+            const msf::NdtMapLeaf* leaf_end =
+                map_cells.GetLeavesEnd(map_y, map_x);
+            for (const msf::NdtMapLeaf* it =
+                     map_cells.GetLeavesBegin(map_y, map_x);
+                 it != leaf_end; ++it) {
+              Leaf leaf;
+              leaf.nr_points_ = static_cast<int>(it->count);
+
+              Eigen::Vector3d eigen_point(Eigen::Vector3d::Zero());
+              eigen_point(0) =
+                  left_top_corner[0] + map_x * resolution + it->centroid[0];
+              eigen_point(1) =
+                  left_top_corner[1] + map_y * resolution + it->centroid[1];
+              eigen_point(2) =
+                  resolution_z * it->altitude_index + it->centroid[2];
+              leaf.mean_ = (eigen_point + R_inv_t);
+              if (it->is_icov_available == 1) {
+                leaf.icov_ = it->icov.cast<double>();
+              } else {
+                leaf.nr_points_ = -1;
               }
+
+              cell_map_.push_back(leaf);
             }
           }
         }
@@ -22,6 +22,7 @@
 #include <Eigen/Geometry>
 #include <string>
 #include <vector>
+#include "modules/common/util/voxel_grid_downsampler.h"
 #include "modules/localization/ndt/ndt_locator/ndt_solver.h"
 #include "modules/localization/msf/local_map/ndt_map/ndt_map.h"
 #include "modules/localization/msf/local_map/ndt_map/ndt_map_matrix.h"
@@ -120,6 +121,10 @@ class LidarLocatorNdt {
   inline bool IsMaploaded() const { return is_map_loaded_; }
   /**@brief Get the locator map. */
   inline const NdtMap& GetMap() const { return map_; }
+  /**@brief Get the statistics of the map node caches. */
+  inline msf::MapNodeCacheStats GetMapCacheStats() {
+    return map_.GetCacheStats();
+  }
   /**@brief Get ndt matching score */
   inline double GetFitnessScore() const { return fitness_score_; }
 
@@ -157,6 +162,8 @@ class LidarLocatorNdt {
   int filter_y_ = 0;
   /**@brief Online pointclouds resoltion. */
   float proj_reslution_ = 1.0;
+  /**@brief Voxel filter of online pointclouds. */
+  apollo::common::util::VoxelGridDownsampler online_downsampler_;
 
   /**@brief The config file of map. */
   NdtMapConfig config_;
@@ -57,6 +57,8 @@
 
 #include <pcl/registration/registration.h>
 #include <unsupported/Eigen/NonLinearOptimization>
+#include <algorithm>
+#include <climits>
 #include <limits>
 #include <vector>
 
@@ -123,7 +125,7 @@ class NormalDistributionsTransform {
     target_ = cloud;
     target_cells_.SetVoxelGridResolution(resolution_, resolution_, resolution_);
     target_cells_.SetInputCloud(cloud);
-    target_cells_.filter(cell_leaf, true);
+    target_cells_.filter(cell_leaf, false);
   }
 
   /**@brief Provide a pointer to the input target. */
@@ -194,6 +196,12 @@ class NormalDistributionsTransform {
     transformation_epsilon_ = epsilon;
   }
 
+  /**@brief Set the number of threads the derivatives of the source points are
+   * accumulated in. */
+  inline void SetNumThreads(int num_threads) {
+    num_threads_ = std::max(num_threads, 1);
+  }
+
   /**@brief Convert 6 element transformation vector to affine transformation. */
   static void ConvertTransform(const Eigen::Matrix<double, 6, 1> &x,
                                Eigen::Affine3f *trans) {
@@ -257,6 +265,8 @@ class NormalDistributionsTransform {
    * probability function w.r.t. the transformation vector. */
   double UpdateDerivatives(Eigen::Matrix<double, 6, 1> *score_gradient,
                            Eigen::Matrix<double, 6, 6> *hessian,
+                           const Eigen::Matrix<double, 3, 6> &point_gradient,
+                           const Eigen::Matrix<double, 18, 6> &point_hessian,
                            const Eigen::Vector3d &x_trans,
                            const Eigen::Matrix3d &c_inv,
                            bool ComputeHessian = true);
@@ -267,6 +277,8 @@ class NormalDistributionsTransform {
 
   /**@brief Compute point derivatives. */
   void ComputePointDerivatives(const Eigen::Vector3d &x,
+                               Eigen::Matrix<double, 3, 6> *point_gradient,
+                               Eigen::Matrix<double, 18, 6> *point_hessian,
                                bool ComputeHessian = true);
 
   /**@brief Compute hessian of probability function w.r.t. the transformation
@@ -278,9 +290,25 @@ class NormalDistributionsTransform {
   /**@brief Compute individual point contirbutions to hessian of probability
    * function. */
   void UpdateHessian(Eigen::Matrix<double, 6, 6> *hessian,
+                     const Eigen::Matrix<double, 3, 6> &point_gradient,
+                     const Eigen::Matrix<double, 18, 6> &point_hessian,
                      const Eigen::Vector3d &x_trans,
                      const Eigen::Matrix3d &c_inv);
 
+  /**@brief Get the target cells within the resolution of a transformed
+   * source point, reusing the candidate cells of the point while it stays in
+   * the same voxel. */
+  void GetNeighborhood(int idx, const PointSource &x_trans_pt,
+                       std::vector<TargetGridLeafConstPtr> *neighborhood);
+
+  /**@brief The number of ranges the source points are split into. */
+  int NumPointRanges() const;
+
+  /**@brief Call func(range, begin, end) for every range of source points,
+   * the ranges after the first one in other threads. */
+  template <typename Func>
+  void ForEachPointRange(const Func &func) const;
+
   /**@brief Compute line search step length and update transform and probability
    * derivatives. */
   double ComputeStepLengthMt(const Eigen::Matrix<double, 6, 1> &x,
@@ -369,6 +397,22 @@ class NormalDistributionsTransform {
    * w.r.t. the transform vector, Equation 6.20 [Magnusson 2009]. */
   Eigen::Matrix<double, 18, 6> point_hessian_;
 
+  /**@brief Score, gradient and hessian summed over a range of points. */
+  struct PartialDerivatives {
+    double score = 0.0;
+    Eigen::Matrix<double, 6, 1> score_gradient =
+        Eigen::Matrix<double, 6, 1>::Zero();
+    Eigen::Matrix<double, 6, 6> hessian = Eigen::Matrix<double, 6, 6>::Zero();
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  };
+
+  /**@brief The number of threads the derivatives are accumulated in. */
+  int num_threads_;
+  /**@brief The voxel of every source point in the last iteration, and the
+   * centroid indices of the target cells around that voxel. */
+  std::vector<Eigen::Vector3i> point_voxels_;
+  std::vector<std::vector<int>> point_centroids_;
+
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
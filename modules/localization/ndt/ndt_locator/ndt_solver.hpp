@@ -55,9 +55,12 @@
  */
 
 #include <algorithm>
+#include <future>
 #include <limits>
 #include <vector>
 
+#include "cyber/task/task.h"
+
 namespace apollo {
 namespace localization {
 namespace ndt {
@@ -97,6 +100,10 @@ void NormalDistributionsTransform<PointSource, PointTarget>::Align(
     output->points[i].data[3] = 1.0;
   }
 
+  // Reset the voxel neighborhoods cached for the points.
+  point_voxels_.assign(input_->size(), Eigen::Vector3i::Constant(INT_MIN));
+  point_centroids_.resize(input_->size());
+
   ComputeTransformation(output, guess);
 }
 
@@ -193,7 +200,8 @@ NormalDistributionsTransform<PointSource,
       h_ang_f2_(),
       h_ang_f3_(),
       point_gradient_(),
-      point_hessian_() {
+      point_hessian_(),
+      num_threads_(1) {
   double gauss_c1, gauss_c2, gauss_d3;
 
   // Initializes the guassian fitting parameters (eq. 6.8) [Magnusson 2009]
@@ -324,57 +332,56 @@ NormalDistributionsTransform<PointSource, PointTarget>::ComputeDerivatives(
     Eigen::Matrix<double, 6, 1> *score_gradient,
     Eigen::Matrix<double, 6, 6> *hessian, PointCloudSourcePtr trans_cloud,
     Eigen::Matrix<double, 6, 1> *p, bool compute_hessian) {
-  // Original Point and Transformed Point
-  PointSource x_pt, x_trans_pt;
-  // Original Point and Transformed Point (for math)
-  Eigen::Vector3d x, x_trans;
-  // Occupied Voxel
-  TargetGridLeafConstPtr cell;
-  // Inverse Covariance of Occupied Voxel
-  Eigen::Matrix3d c_inv;
-
-  score_gradient->setZero();
-  hessian->setZero();
-  double score = 0;
-
   // Precompute Angular Derivatives (eq. 6.19 and 6.21)[Magnusson 2009]
   ComputeAngleDerivatives(*p);
 
-  // Update gradient and hessian for each point, line 17 in Algorithm 2
-  // [Magnusson 2009]
-  for (size_t idx = 0; idx < input_->points.size(); idx++) {
-    x_trans_pt = trans_cloud->points[idx];
-
-    // Find nieghbors (Radius search has been experimentally faster than
-    // direct neighbor checking.
+  // Every range of points is summed up separately, the sums are reduced in
+  // order so that the result does not depend on the thread timing.
+  std::vector<PartialDerivatives, Eigen::aligned_allocator<PartialDerivatives>>
+      partials(NumPointRanges());
+  ForEachPointRange([&](int range, int begin, int end) {
+    PartialDerivatives &partial = partials[range];
+    Eigen::Matrix<double, 3, 6> point_gradient = point_gradient_;
+    Eigen::Matrix<double, 18, 6> point_hessian = point_hessian_;
     std::vector<TargetGridLeafConstPtr> neighborhood;
-    std::vector<float> distances;
-    target_cells_.RadiusSearch(x_trans_pt, resolution_, &neighborhood,
-                               &distances);
-
-    for (typename std::vector<TargetGridLeafConstPtr>::iterator
-             neighborhood_it = neighborhood.begin();
-         neighborhood_it != neighborhood.end(); neighborhood_it++) {
-      cell = *neighborhood_it;
-      x_pt = input_->points[idx];
-      x = Eigen::Vector3d(x_pt.x, x_pt.y, x_pt.z);
-
-      x_trans = Eigen::Vector3d(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z);
 
-      // Denorm point, x_k' in Equations 6.12 and 6.13 [Magnusson 2009]
-      x_trans -= cell->GetMean();
-      // Uses precomputed covariance for speed.
-      c_inv = cell->GetInverseCov();
+    // Update gradient and hessian for each point, line 17 in Algorithm 2
+    // [Magnusson 2009]
+    for (int idx = begin; idx < end; ++idx) {
+      const PointSource &x_trans_pt = trans_cloud->points[idx];
+      GetNeighborhood(idx, x_trans_pt, &neighborhood);
+      if (neighborhood.empty()) {
+        continue;
+      }
 
       // Compute derivative of transform function w.r.t. transform vector,
       // J_E and H_E in Equations 6.18 and 6.20 [Magnusson 2009]
-      ComputePointDerivatives(x);
-      // Update score, gradient and hessian, lines 19-21 in Algorithm 2,
-      // according to Equations 6.10, 6.12 and 6.13, respectively [Magnusson
-      // 2009]
-      score += UpdateDerivatives(score_gradient, hessian, x_trans, c_inv,
-                                 compute_hessian);
+      const PointSource &x_pt = input_->points[idx];
+      ComputePointDerivatives(Eigen::Vector3d(x_pt.x, x_pt.y, x_pt.z),
+                              &point_gradient, &point_hessian);
+
+      for (const TargetGridLeafConstPtr cell : neighborhood) {
+        // Denorm point, x_k' in Equations 6.12 and 6.13 [Magnusson 2009]
+        const Eigen::Vector3d x_trans =
+            Eigen::Vector3d(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z) -
+            cell->GetMean();
+        // Update score, gradient and hessian, lines 19-21 in Algorithm 2,
+        // according to Equations 6.10, 6.12 and 6.13, respectively
+        // [Magnusson 2009]. Uses precomputed covariance for speed.
+        partial.score += UpdateDerivatives(
+            &partial.score_gradient, &partial.hessian, point_gradient,
+            point_hessian, x_trans, cell->GetInverseCov(), compute_hessian);
+      }
     }
+  });
+
+  score_gradient->setZero();
+  hessian->setZero();
+  double score = 0;
+  for (const PartialDerivatives &partial : partials) {
+    score += partial.score;
+    *score_gradient += partial.score_gradient;
+    *hessian += partial.hessian;
   }
   return (score);
 }
@@ -450,20 +457,22 @@ void NormalDistributionsTransform<PointSource, PointTarget>::
 }
 
 template <typename PointSource, typename PointTarget>
-void NormalDistributionsTransform<
-    PointSource, PointTarget>::ComputePointDerivatives(const Eigen::Vector3d &x,
-                                                       bool compute_hessian) {
+void NormalDistributionsTransform<PointSource, PointTarget>::
+    ComputePointDerivatives(const Eigen::Vector3d &x,
+                            Eigen::Matrix<double, 3, 6> *point_gradient,
+                            Eigen::Matrix<double, 18, 6> *point_hessian,
+                            bool compute_hessian) {
   // Calculate first derivative of Transformation Equation 6.17 w.r.t. transform
   // vector p. Derivative w.r.t. ith element of transform vector corresponds to
   // column i, Equation 6.18 and 6.19 [Magnusson 2009]
-  point_gradient_(1, 3) = x.dot(j_ang_a_);
-  point_gradient_(2, 3) = x.dot(j_ang_b_);
-  point_gradient_(0, 4) = x.dot(j_ang_c_);
-  point_gradient_(1, 4) = x.dot(j_ang_d_);
-  point_gradient_(2, 4) = x.dot(j_ang_e_);
-  point_gradient_(0, 5) = x.dot(j_ang_f_);
-  point_gradient_(1, 5) = x.dot(j_ang_g_);
-  point_gradient_(2, 5) = x.dot(j_ang_h_);
+  (*point_gradient)(1, 3) = x.dot(j_ang_a_);
+  (*point_gradient)(2, 3) = x.dot(j_ang_b_);
+  (*point_gradient)(0, 4) = x.dot(j_ang_c_);
+  (*point_gradient)(1, 4) = x.dot(j_ang_d_);
+  (*point_gradient)(2, 4) = x.dot(j_ang_e_);
+  (*point_gradient)(0, 5) = x.dot(j_ang_f_);
+  (*point_gradient)(1, 5) = x.dot(j_ang_g_);
+  (*point_gradient)(2, 5) = x.dot(j_ang_h_);
 
   if (compute_hessian) {
     // Vectors from Equation 6.21 [Magnusson 2009]
@@ -480,15 +489,15 @@ void NormalDistributionsTransform<
     // transform vector p. Derivative w.r.t. ith and jth elements of transform
     // vector corresponds to the 3x1 block matrix starting at (3i,j),
     // Equation 6.20 and 6.21 [Magnusson 2009]
-    point_hessian_.block<3, 1>(9, 3) = a;
-    point_hessian_.block<3, 1>(12, 3) = b;
-    point_hessian_.block<3, 1>(15, 3) = c;
-    point_hessian_.block<3, 1>(9, 4) = b;
-    point_hessian_.block<3, 1>(12, 4) = d;
-    point_hessian_.block<3, 1>(15, 4) = e;
-    point_hessian_.block<3, 1>(9, 5) = c;
-    point_hessian_.block<3, 1>(12, 5) = e;
-    point_hessian_.block<3, 1>(15, 5) = f;
+    point_hessian->block<3, 1>(9, 3) = a;
+    point_hessian->block<3, 1>(12, 3) = b;
+    point_hessian->block<3, 1>(15, 3) = c;
+    point_hessian->block<3, 1>(9, 4) = b;
+    point_hessian->block<3, 1>(12, 4) = d;
+    point_hessian->block<3, 1>(15, 4) = e;
+    point_hessian->block<3, 1>(9, 5) = c;
+    point_hessian->block<3, 1>(12, 5) = e;
+    point_hessian->block<3, 1>(15, 5) = f;
   }
 }
 
@@ -496,8 +505,11 @@ template <typename PointSource, typename PointTarget>
 double
 NormalDistributionsTransform<PointSource, PointTarget>::UpdateDerivatives(
     Eigen::Matrix<double, 6, 1> *score_gradient,
-    Eigen::Matrix<double, 6, 6> *hessian, const Eigen::Vector3d &x_trans,
-    const Eigen::Matrix3d &c_inv, bool compute_hessian) {
+    Eigen::Matrix<double, 6, 6> *hessian,
+    const Eigen::Matrix<double, 3, 6> &point_gradient,
+    const Eigen::Matrix<double, 18, 6> &point_hessian,
+    const Eigen::Vector3d &x_trans, const Eigen::Matrix3d &c_inv,
+    bool compute_hessian) {
   Eigen::Vector3d cov_dxd_pi;
   // e^(-d_2/2 * (x_k - mu_k)^T Sigma_k^-1 (x_k - mu_k)) Equation 6.9 [Magnusson
   // 2009]
@@ -519,7 +531,7 @@ NormalDistributionsTransform<PointSource, PointTarget>::UpdateDerivatives(
   for (int i = 0; i < 6; i++) {
     // Sigma_k^-1 d(T(x,p))/dpi, Reusable portion of Equation 6.12 and 6.13
     // [Magnusson 2009]
-    cov_dxd_pi = c_inv * point_gradient_.col(i);
+    cov_dxd_pi = c_inv * point_gradient.col(i);
 
     // Update gradient, Equation 6.12 [Magnusson 2009]
     (*score_gradient)(i) += x_trans.dot(cov_dxd_pi) * e_x_cov_x;
@@ -530,9 +542,9 @@ NormalDistributionsTransform<PointSource, PointTarget>::UpdateDerivatives(
         (*hessian)(i, j) +=
             e_x_cov_x *
             (-gauss_d2_ * x_trans.dot(cov_dxd_pi) *
-                 x_trans.dot(c_inv * point_gradient_.col(j)) +
-             x_trans.dot(c_inv * point_hessian_.block<3, 1>(3 * i, j)) +
-             point_gradient_.col(j).dot(cov_dxd_pi));
+                 x_trans.dot(c_inv * point_gradient.col(j)) +
+             x_trans.dot(c_inv * point_hessian.block<3, 1>(3 * i, j)) +
+             point_gradient.col(j).dot(cov_dxd_pi));
       }
     }
   }
@@ -544,63 +556,101 @@ template <typename PointSource, typename PointTarget>
 void NormalDistributionsTransform<PointSource, PointTarget>::ComputeHessian(
     Eigen::Matrix<double, 6, 6> *hessian, const PointCloudSource &trans_cloud,
     Eigen::Matrix<double, 6, 1> *p) {
-  // Original Point and Transformed Point
-  PointSource x_pt, x_trans_pt;
-  // Original Point and Transformed Point (for math)
-  Eigen::Vector3d x, x_trans;
-  // Occupied Voxel
-  TargetGridLeafConstPtr cell;
-  // Inverse Covariance of Occupied Voxel
-  Eigen::Matrix3d c_inv;
-
-  hessian->setZero();
-
   // Precompute Angular Derivatives unessisary because only used after regular
   // derivative calculation
 
-  // Update hessian for each point, line 17 in Algorithm 2 [Magnusson 2009]
-  for (size_t idx = 0; idx < input_->points.size(); idx++) {
-    x_trans_pt = trans_cloud.points[idx];
-
-    // Find nieghbors (Radius search has been experimentally faster than
-    // direct neighbor checking.
+  std::vector<PartialDerivatives, Eigen::aligned_allocator<PartialDerivatives>>
+      partials(NumPointRanges());
+  ForEachPointRange([&](int range, int begin, int end) {
+    PartialDerivatives &partial = partials[range];
+    Eigen::Matrix<double, 3, 6> point_gradient = point_gradient_;
+    Eigen::Matrix<double, 18, 6> point_hessian = point_hessian_;
     std::vector<TargetGridLeafConstPtr> neighborhood;
-    std::vector<float> distances;
-    target_cells_.RadiusSearch(x_trans_pt, resolution_, &neighborhood,
-                               &distances);
-
-    for (typename std::vector<TargetGridLeafConstPtr>::iterator
-             neighborhood_it = neighborhood.begin();
-         neighborhood_it != neighborhood.end(); neighborhood_it++) {
-      cell = *neighborhood_it;
-      {
-        x_pt = input_->points[idx];
-        x = Eigen::Vector3d(x_pt.x, x_pt.y, x_pt.z);
-
-        x_trans = Eigen::Vector3d(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z);
-
-        // Denorm point, x_k' in Equations 6.12 and 6.13 [Magnusson
-        // 2009]
-        x_trans -= cell->GetMean();
-        // Uses precomputed covariance for speed.
-        c_inv = cell->GetInverseCov();
-
-        // Compute derivative of transform function w.r.t. transform
-        // vector, J_E and H_E in Equations 6.18 and 6.20 [Magnusson
-        // 2009]
-        ComputePointDerivatives(x);
-        // Update hessian, lines 21 in Algorithm 2, according to
-        // Equations 6.10, 6.12 and 6.13, respectively [Magnusson 2009]
-        UpdateHessian(hessian, x_trans, c_inv);
+
+    // Update hessian for each point, line 17 in Algorithm 2 [Magnusson 2009]
+    for (int idx = begin; idx < end; ++idx) {
+      const PointSource &x_trans_pt = trans_cloud.points[idx];
+      GetNeighborhood(idx, x_trans_pt, &neighborhood);
+      if (neighborhood.empty()) {
+        continue;
+      }
+
+      // Compute derivative of transform function w.r.t. transform vector,
+      // J_E and H_E in Equations 6.18 and 6.20 [Magnusson 2009]
+      const PointSource &x_pt = input_->points[idx];
+      ComputePointDerivatives(Eigen::Vector3d(x_pt.x, x_pt.y, x_pt.z),
+                              &point_gradient, &point_hessian);
+
+      for (const TargetGridLeafConstPtr cell : neighborhood) {
+        // Denorm point, x_k' in Equations 6.12 and 6.13 [Magnusson 2009]
+        const Eigen::Vector3d x_trans =
+            Eigen::Vector3d(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z) -
+            cell->GetMean();
+        // Update hessian, lines 21 in Algorithm 2, according to Equations
+        // 6.10, 6.12 and 6.13, respectively [Magnusson 2009]
+        UpdateHessian(&partial.hessian, point_gradient, point_hessian,
+                      x_trans, cell->GetInverseCov());
       }
     }
+  });
+
+  hessian->setZero();
+  for (const PartialDerivatives &partial : partials) {
+    *hessian += partial.hessian;
+  }
+}
+
+template <typename PointSource, typename PointTarget>
+void NormalDistributionsTransform<PointSource, PointTarget>::GetNeighborhood(
+    int idx, const PointSource &x_trans_pt,
+    std::vector<TargetGridLeafConstPtr> *neighborhood) {
+  // The centroids around the voxel of the point stay the same while the pose
+  // steps keep the point in the voxel.
+  const Eigen::Vector3i voxel =
+      target_cells_.GetVoxelCoord(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z);
+  if (voxel != point_voxels_[idx]) {
+    point_voxels_[idx] = voxel;
+    target_cells_.GetNeighborCentroids(voxel, &point_centroids_[idx]);
+  }
+  // The voxel size of the target cells is resolution_, so the centroids
+  // within resolution_ are all around the voxel of the point.
+  target_cells_.FilterCentroids(
+      Eigen::Vector3f(x_trans_pt.x, x_trans_pt.y, x_trans_pt.z), resolution_,
+      point_centroids_[idx], neighborhood);
+}
+
+template <typename PointSource, typename PointTarget>
+int NormalDistributionsTransform<PointSource, PointTarget>::NumPointRanges()
+    const {
+  return std::max(
+      1, std::min(num_threads_, static_cast<int>(input_->points.size())));
+}
+
+template <typename PointSource, typename PointTarget>
+template <typename Func>
+void NormalDistributionsTransform<PointSource, PointTarget>::ForEachPointRange(
+    const Func &func) const {
+  const int num_points = static_cast<int>(input_->points.size());
+  const int num_ranges = NumPointRanges();
+  const int range_size = (num_points + num_ranges - 1) / num_ranges;
+  std::vector<std::future<void>> futures;
+  for (int range = 1; range < num_ranges; ++range) {
+    futures.push_back(cyber::Async(func, range, range * range_size,
+                                   std::min((range + 1) * range_size,
+                                            num_points)));
+  }
+  func(0, 0, std::min(range_size, num_points));
+  for (auto &future : futures) {
+    future.get();
   }
 }
 
 template <typename PointSource, typename PointTarget>
 void NormalDistributionsTransform<PointSource, PointTarget>::UpdateHessian(
-    Eigen::Matrix<double, 6, 6> *hessian, const Eigen::Vector3d &x_trans,
-    const Eigen::Matrix3d &c_inv) {
+    Eigen::Matrix<double, 6, 6> *hessian,
+    const Eigen::Matrix<double, 3, 6> &point_gradient,
+    const Eigen::Matrix<double, 18, 6> &point_hessian,
+    const Eigen::Vector3d &x_trans, const Eigen::Matrix3d &c_inv) {
   Eigen::Vector3d cov_dxd_pi;
   // e^(-d_2/2 * (x_k - mu_k)^T Sigma_k^-1 (x_k - mu_k)) Equation 6.9
   // [Magnusson 2009]
@@ -618,16 +668,16 @@ void NormalDistributionsTransform<PointSource, PointTarget>::UpdateHessian(
   for (int i = 0; i < 6; i++) {
     // Sigma_k^-1 d(T(x,p))/dpi, Reusable portion of Equation 6.12 and 6.13
     // [Magnusson 2009]
-    cov_dxd_pi = c_inv * point_gradient_.col(i);
+    cov_dxd_pi = c_inv * point_gradient.col(i);
 
     for (int j = 0; j < hessian->cols(); j++) {
       // Update hessian, Equation 6.13 [Magnusson 2009]
       (*hessian)(i, j) +=
           e_x_cov_x *
           (-gauss_d2_ * x_trans.dot(cov_dxd_pi) *
-               x_trans.dot(c_inv * point_gradient_.col(j)) +
-           x_trans.dot(c_inv * point_hessian_.block<3, 1>(3 * i, j)) +
-           point_gradient_.col(j).dot(cov_dxd_pi));
+               x_trans.dot(c_inv * point_gradient.col(j)) +
+           x_trans.dot(c_inv * point_hessian.block<3, 1>(3 * i, j)) +
+           point_gradient.col(j).dot(cov_dxd_pi));
     }
   }
 }
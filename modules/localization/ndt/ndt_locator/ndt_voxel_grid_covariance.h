@@ -57,10 +57,10 @@
 #include <pcl/kdtree/kdtree_flann.h>
 #include <pcl/point_types.h>
 #include <vector>
-#include <map>
 
 #include "cyber/common/log.h"
 #include "modules/common/time/timer.h"
+#include "modules/common/util/voxel_grid_downsampler.h"
 
 namespace apollo {
 namespace localization {
@@ -150,7 +150,9 @@ class VoxelGridCovariance {
                      bool searchable = true) {
     voxel_centroids_ = PointCloudPtr(new PointCloud);
     SetMap(cell_leaf, voxel_centroids_);
-    if (voxel_centroids_->size() > 0) {
+    // The kd-tree only serves RadiusSearch, the neighbor centroids of
+    // GetNeighborCentroids come from the voxel table.
+    if (searchable && voxel_centroids_->size() > 0) {
       kdtree_.setInputCloud(voxel_centroids_);
     }
   }
@@ -159,11 +161,11 @@ class VoxelGridCovariance {
 
   /**@brief Get the voxel containing point p. */
   inline LeafConstPtr GetLeaf(int index) {
-    typename std::map<size_t, Leaf>::iterator leaf_iter = leaves_.find(index);
-    if (leaf_iter == leaves_.end()) {
+    int leaf_pos = leaf_table_.Find(LeafKey(index));
+    if (leaf_pos < 0) {
       return NULL;
     }
-    LeafConstPtr ret(&(leaf_iter->second));
+    LeafConstPtr ret(&leaves_[leaf_pos]);
     return ret;
   }
 
@@ -187,13 +189,7 @@ class VoxelGridCovariance {
     int idx = ijk0 * divb_mul_[0] + ijk1 * divb_mul_[1] + ijk2 * divb_mul_[2];
 
     // Find leaf associated with index
-    typename std::map<size_t, Leaf>::iterator leaf_iter = leaves_.find(idx);
-    if (leaf_iter == leaves_.end()) {
-      return NULL;
-    }
-    // If such a leaf exists return the pointer to the leaf structure
-    LeafConstPtr ret(&(leaf_iter->second));
-    return ret;
+    return GetLeaf(idx);
   }
 
   /**@brief Get the voxel containing point p.* \return const pointer to leaf
@@ -214,17 +210,11 @@ class VoxelGridCovariance {
     int idx = ijk0 * divb_mul_[0] + ijk1 * divb_mul_[1] + ijk2 * divb_mul_[2];
 
     // Find leaf associated with index
-    typename std::map<size_t, Leaf>::iterator leaf_iter = leaves_.find(idx);
-    if (leaf_iter == leaves_.end()) {
-      return NULL;
-    }
-    // If such a leaf exists return the pointer to the leaf structure
-    LeafConstPtr ret(&(leaf_iter->second));
-    return ret;
+    return GetLeaf(idx);
   }
 
-  /**@brief Get the leaf structure map. */
-  inline const std::map<size_t, Leaf> &GetLeaves() { return leaves_; }
+  /**@brief Get the leaf structures. */
+  inline const std::vector<Leaf> &GetLeaves() { return leaves_; }
 
   /**@brief Get a pointcloud containing the voxel centroids. */
   inline PointCloudPtr GetCentroids() { return voxel_centroids_; }
@@ -236,6 +226,32 @@ class VoxelGridCovariance {
                    std::vector<float> *k_sqr_distances,
                    unsigned int max_nn = 0);
 
+  /**@brief Get the voxel grid coordinates of a point, the leaves are indexed
+   * by the coordinates of their means. */
+  inline Eigen::Vector3i GetVoxelCoord(double x, double y, double z) const {
+    return Eigen::Vector3i(
+        static_cast<int>((x - map_left_top_corner_(0)) *
+                         inverse_leaf_size_[0]) - min_b_[0],
+        static_cast<int>((y - map_left_top_corner_(1)) *
+                         inverse_leaf_size_[1]) - min_b_[1],
+        static_cast<int>((z - map_left_top_corner_(2)) *
+                         inverse_leaf_size_[2]) - min_b_[2]);
+  }
+
+  /**@brief Get the indices of the voxel centroids in the 3x3x3 voxels around
+   * the voxel coordinates, which hold every centroid within the leaf size of
+   * any point in the center voxel. The coordinates may be out of the grid. */
+  void GetNeighborCentroids(const Eigen::Vector3i &coord,
+                            std::vector<int> *centroid_indices) const;
+
+  /**@brief Get the leaves of the centroids within radius of the point among
+   * the given centroids, the same leaves RadiusSearch finds when the
+   * centroids come from GetNeighborCentroids and radius is not larger than
+   * the leaf size. */
+  void FilterCentroids(const Eigen::Vector3f &point, double radius,
+                       const std::vector<int> &centroid_indices,
+                       std::vector<LeafConstPtr> *k_leaves) const;
+
   void GetDisplayCloud(pcl::PointCloud<pcl::PointXYZ> *cell_cloud);
 
   inline void SetMapLeftTopCorner(const Eigen::Vector3d &left_top_corner) {
@@ -257,17 +273,31 @@ class VoxelGridCovariance {
    */
   int min_points_per_voxel_;
 
+  /**@brief Key of the leaf with index idx in the hash table. */
+  static uint64_t LeafKey(int idx) {
+    return static_cast<uint64_t>(static_cast<uint32_t>(idx));
+  }
+
   /**@brief Voxel structure containing all leaf nodes (includes voxels with
    * less than a sufficient number of points). */
-  std::map<size_t, Leaf> leaves_;
+  std::vector<Leaf> leaves_;
+
+  /**@brief Position in leaves_ of each leaf index. */
+  apollo::common::util::VoxelHashTable leaf_table_;
 
   /**@brief Point cloud containing centroids of voxels containing atleast
    * minimum number of points. */
   PointCloudPtr voxel_centroids_;
 
-  /**@brief Indices of leaf structurs associated with each point. */
+  /**@brief Positions in leaves_ of the leaf structurs associated with each
+   * point. */
   std::vector<int> voxel_centroids_leaf_indices_;
 
+  /**@brief The voxel centroids of the leaf at position i in leaves_ are
+   * leaf_centroids_[leaf_centroid_begin_[i], leaf_centroid_begin_[i + 1]). */
+  std::vector<int> leaf_centroid_begin_;
+  std::vector<int> leaf_centroids_;
+
   /**@brief KdTree generated using voxel_centroids_ (used for searching). */
   pcl::KdTreeFLANN<PointT> kdtree_;
 
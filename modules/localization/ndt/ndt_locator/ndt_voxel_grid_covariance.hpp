@@ -54,7 +54,6 @@
 #include <pcl/filters/boost.h>
 #include <Eigen/Cholesky>
 #include <Eigen/Dense>
-#include <map>
 #include <vector>
 
 #include "modules/localization/ndt/ndt_locator/ndt_voxel_grid_covariance.h"
@@ -107,9 +106,11 @@ void VoxelGridCovariance<PointT>::SetMap(const std::vector<Leaf>& map_leaves,
 
   // Clear the leaves
   leaves_.clear();
+  leaves_.reserve(map_leaves.size());
+  leaf_table_.Clear(map_leaves.size());
 
   output->points.reserve(map_leaves.size());
-  voxel_centroids_leaf_indices_.reserve(leaves_.size());
+  voxel_centroids_leaf_indices_.reserve(map_leaves.size());
 
   for (unsigned int i = 0; i < map_leaves.size(); ++i) {
     const Leaf& cell_leaf = map_leaves[i];
@@ -124,18 +125,41 @@ void VoxelGridCovariance<PointT>::SetMap(const std::vector<Leaf>& map_leaves,
     // Compute the centroid leaf index
     int idx = ijk0 * divb_mul_[0] + ijk1 * divb_mul_[1] + ijk2 * divb_mul_[2];
 
-    Leaf& leaf = leaves_[idx];
-    leaf = cell_leaf;
+    bool inserted = false;
+    int leaf_pos = leaf_table_.Insert(
+        LeafKey(idx), static_cast<int>(leaves_.size()), &inserted);
+    if (inserted) {
+      leaves_.push_back(cell_leaf);
+    } else {
+      leaves_[leaf_pos] = cell_leaf;
+    }
+    const Leaf& leaf = leaves_[leaf_pos];
 
     if (cell_leaf.nr_points_ >= min_points_per_voxel_) {
       output->push_back(PointT());
       output->points.back().x = static_cast<float>(leaf.mean_[0]);
       output->points.back().y = static_cast<float>(leaf.mean_[1]);
       output->points.back().z = static_cast<float>(leaf.mean_[2]);
-      voxel_centroids_leaf_indices_.push_back(idx);
+      voxel_centroids_leaf_indices_.push_back(leaf_pos);
     }
   }
   output->width = static_cast<uint32_t>(output->points.size());
+
+  // Group the centroids by leaf for the direct neighbor lookups.
+  leaf_centroid_begin_.assign(leaves_.size() + 1, 0);
+  for (const int leaf_pos : voxel_centroids_leaf_indices_) {
+    ++leaf_centroid_begin_[leaf_pos + 1];
+  }
+  for (size_t i = 1; i < leaf_centroid_begin_.size(); ++i) {
+    leaf_centroid_begin_[i] += leaf_centroid_begin_[i - 1];
+  }
+  leaf_centroids_.resize(voxel_centroids_leaf_indices_.size());
+  std::vector<int> next(leaf_centroid_begin_.begin(),
+                        leaf_centroid_begin_.end() - 1);
+  for (size_t i = 0; i < voxel_centroids_leaf_indices_.size(); ++i) {
+    leaf_centroids_[next[voxel_centroids_leaf_indices_[i]]++] =
+        static_cast<int>(i);
+  }
 }
 
 template <typename PointT>
@@ -158,6 +182,50 @@ int VoxelGridCovariance<PointT>::RadiusSearch(
   return k;
 }
 
+template <typename PointT>
+void VoxelGridCovariance<PointT>::GetNeighborCentroids(
+    const Eigen::Vector3i& coord, std::vector<int>* centroid_indices) const {
+  centroid_indices->clear();
+  // Out of range coordinates would alias other voxels.
+  const Eigen::Vector3i begin = (coord.array() - 1).max(0);
+  const Eigen::Vector3i end =
+      (coord.array() + 2).min(div_b_.head<3>().array());
+  for (int ijk2 = begin[2]; ijk2 < end[2]; ++ijk2) {
+    for (int ijk1 = begin[1]; ijk1 < end[1]; ++ijk1) {
+      for (int ijk0 = begin[0]; ijk0 < end[0]; ++ijk0) {
+        int idx =
+            ijk0 * divb_mul_[0] + ijk1 * divb_mul_[1] + ijk2 * divb_mul_[2];
+        int leaf_pos = leaf_table_.Find(LeafKey(idx));
+        if (leaf_pos < 0) {
+          continue;
+        }
+        centroid_indices->insert(
+            centroid_indices->end(),
+            leaf_centroids_.begin() + leaf_centroid_begin_[leaf_pos],
+            leaf_centroids_.begin() + leaf_centroid_begin_[leaf_pos + 1]);
+      }
+    }
+  }
+}
+
+template <typename PointT>
+void VoxelGridCovariance<PointT>::FilterCentroids(
+    const Eigen::Vector3f& point, double radius,
+    const std::vector<int>& centroid_indices,
+    std::vector<LeafConstPtr>* k_leaves) const {
+  k_leaves->clear();
+  const float sqr_radius = static_cast<float>(radius * radius);
+  for (const int i : centroid_indices) {
+    const PointT& centroid = voxel_centroids_->points[i];
+    const float dx = centroid.x - point.x();
+    const float dy = centroid.y - point.y();
+    const float dz = centroid.z - point.z();
+    if (dx * dx + dy * dy + dz * dz <= sqr_radius) {
+      k_leaves->push_back(&leaves_[voxel_centroids_leaf_indices_[i]]);
+    }
+  }
+}
+
 template <typename PointT>
 void VoxelGridCovariance<PointT>::GetDisplayCloud(
     pcl::PointCloud<pcl::PointXYZ>* cell_cloud) {
@@ -176,10 +244,7 @@ void VoxelGridCovariance<PointT>::GetDisplayCloud(
   Eigen::Vector3d dist_point;
 
   // Generate points for each occupied voxel with sufficient points.
-  for (typename std::map<size_t, Leaf>::iterator it = leaves_.begin();
-       it != leaves_.end(); ++it) {
-    Leaf& leaf = it->second;
-
+  for (const Leaf& leaf : leaves_) {
     if (leaf.nr_points_ >= min_points_per_voxel_) {
       cell_mean = leaf.mean_;
       Eigen::Matrix3d cov = leaf.icov_.inverse();
@@ -15,6 +15,9 @@ limitations under the License.
 
 #include "modules/map/hdmap/hdmap.h"
 
+#include <algorithm>
+
+#include "modules/common/configs/config_gflags.h"
 #include "modules/map/hdmap/hdmap_util.h"
 
 namespace apollo {
@@ -22,19 +25,36 @@ namespace hdmap {
 
 int HDMap::LoadMapFromFile(const std::string& map_filename) {
   AINFO << "Loading HDMap: " << map_filename << " ...";
+  ResetQueryCache();
   return impl_.LoadMapFromFile(map_filename);
 }
 
 int HDMap::LoadMapFromProto(const Map& map_proto) {
   ADEBUG << "Loading HDMap with header: "
          << map_proto.header().ShortDebugString();
+  ResetQueryCache();
   return impl_.LoadMapFromProto(map_proto);
 }
 
+void HDMap::ResetQueryCache() {
+  if (!FLAGS_enable_hdmap_query_cache) {
+    query_cache_.reset();
+    return;
+  }
+  query_cache_.reset(new HDMapQueryCache(
+      std::max(FLAGS_hdmap_query_cache_shards, 1),
+      std::max(FLAGS_hdmap_query_cache_capacity, 1),
+      FLAGS_hdmap_query_cache_resolution));
+}
+
 LaneInfoConstPtr HDMap::GetLaneById(const Id& id) const {
   return impl_.GetLaneById(id);
 }
 
+LaneInfoConstPtr HDMap::GetLaneByIndex(const int index) const {
+  return impl_.GetLaneByIndex(index);
+}
+
 JunctionInfoConstPtr HDMap::GetJunctionById(const Id& id) const {
   return impl_.GetJunctionById(id);
 }
@@ -81,7 +101,24 @@ PNCJunctionInfoConstPtr HDMap::GetPNCJunctionById(const Id& id) const {
 
 int HDMap::GetLanes(const apollo::common::PointENU& point, double distance,
                     std::vector<LaneInfoConstPtr>* lanes) const {
-  return impl_.GetLanes(point, distance, lanes);
+  if (query_cache_ == nullptr) {
+    return impl_.GetLanes(point, distance, lanes);
+  }
+  const HDMapQueryKey key = query_cache_->MakeKey(point, distance);
+  HDMapQueryCache::Lanes result;
+  if (!query_cache_->lanes()->GetCopy(key, &result)) {
+    result.status = impl_.GetLanes(point, distance, &result.lanes);
+    query_cache_->lanes()->Put(key, result);
+  }
+  if (result.status == 0) {
+    *lanes = std::move(result.lanes);
+  }
+  return result.status;
+}
+
+int HDMap::GetAllJunctions(
+    std::vector<JunctionInfoConstPtr>* junctions) const {
+  return impl_.GetAllJunctions(junctions);
 }
 
 int HDMap::GetJunctions(const apollo::common::PointENU& point, double distance,
@@ -152,9 +189,30 @@ int HDMap::GetNearestLaneWithHeading(const apollo::common::PointENU& point,
                                      LaneInfoConstPtr* nearest_lane,
                                      double* nearest_s,
                                      double* nearest_l) const {
-  return impl_.GetNearestLaneWithHeading(point, distance, central_heading,
-                                         max_heading_difference, nearest_lane,
-                                         nearest_s, nearest_l);
+  if (query_cache_ == nullptr) {
+    return impl_.GetNearestLaneWithHeading(point, distance, central_heading,
+                                           max_heading_difference,
+                                           nearest_lane, nearest_s, nearest_l);
+  }
+  const HDMapQueryKey key = query_cache_->MakeKey(
+      point, distance, central_heading, max_heading_difference);
+  HDMapQueryCache::NearestLane result;
+  if (query_cache_->nearest_lanes()->GetCopy(key, &result)) {
+    // The cached lane is shared by close points, project the exact one.
+    if (result.status != 0 ||
+        !result.lane->GetProjection({point.x(), point.y()}, nearest_s,
+                                    nearest_l)) {
+      return -1;
+    }
+    *nearest_lane = result.lane;
+    return 0;
+  }
+  result.status = impl_.GetNearestLaneWithHeading(
+      point, distance, central_heading, max_heading_difference, nearest_lane,
+      nearest_s, nearest_l);
+  result.lane = *nearest_lane;
+  query_cache_->nearest_lanes()->Put(key, result);
+  return result.status;
 }
 
 int HDMap::GetLanesWithHeading(const apollo::common::PointENU& point,
@@ -170,14 +228,38 @@ int HDMap::GetRoadBoundaries(
     const apollo::common::PointENU& point, double radius,
     std::vector<RoadROIBoundaryPtr>* road_boundaries,
     std::vector<JunctionBoundaryPtr>* junctions) const {
-  return impl_.GetRoadBoundaries(point, radius, road_boundaries, junctions);
+  if (query_cache_ == nullptr) {
+    return impl_.GetRoadBoundaries(point, radius, road_boundaries, junctions);
+  }
+  const HDMapQueryKey key = query_cache_->MakeKey(point, radius);
+  HDMapQueryCache::RoadBoundaries result;
+  if (!query_cache_->road_boundaries()->GetCopy(key, &result)) {
+    result.status = impl_.GetRoadBoundaries(
+        point, radius, &result.road_boundaries, &result.junctions);
+    query_cache_->road_boundaries()->Put(key, result);
+  }
+  *road_boundaries = std::move(result.road_boundaries);
+  *junctions = std::move(result.junctions);
+  return result.status;
 }
 
 int HDMap::GetRoadBoundaries(
     const apollo::common::PointENU& point, double radius,
     std::vector<RoadRoiPtr>* road_boundaries,
     std::vector<JunctionInfoConstPtr>* junctions) const {
-  return impl_.GetRoadBoundaries(point, radius, road_boundaries, junctions);
+  if (query_cache_ == nullptr) {
+    return impl_.GetRoadBoundaries(point, radius, road_boundaries, junctions);
+  }
+  const HDMapQueryKey key = query_cache_->MakeKey(point, radius);
+  HDMapQueryCache::RoadRois result;
+  if (!query_cache_->road_rois()->GetCopy(key, &result)) {
+    result.status = impl_.GetRoadBoundaries(
+        point, radius, &result.road_boundaries, &result.junctions);
+    query_cache_->road_rois()->Put(key, result);
+  }
+  *road_boundaries = std::move(result.road_boundaries);
+  *junctions = std::move(result.junctions);
+  return result.status;
 }
 
 int HDMap::GetRoi(const apollo::common::PointENU& point, double radius,
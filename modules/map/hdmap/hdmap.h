@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -37,6 +38,7 @@
 
 #include "modules/map/hdmap/hdmap_common.h"
 #include "modules/map/hdmap/hdmap_impl.h"
+#include "modules/map/hdmap/hdmap_query_cache.h"
 
 /**
  * @namespace apollo::hdmap
@@ -67,6 +69,12 @@ class HDMap {
   int LoadMapFromProto(const Map& map_proto);
 
   LaneInfoConstPtr GetLaneById(const Id& id) const;
+  /**
+   * @brief get a lane by its handle, see LaneInfo::index()
+   * @param index the handle of the lane
+   * @return the lane, nullptr if the handle is out of range
+   */
+  LaneInfoConstPtr GetLaneByIndex(const int index) const;
   JunctionInfoConstPtr GetJunctionById(const Id& id) const;
   SignalInfoConstPtr GetSignalById(const Id& id) const;
   CrosswalkInfoConstPtr GetCrosswalkById(const Id& id) const;
@@ -78,6 +86,12 @@ class HDMap {
   RoadInfoConstPtr GetRoadById(const Id& id) const;
   ParkingSpaceInfoConstPtr GetParkingSpaceById(const Id& id) const;
   PNCJunctionInfoConstPtr GetPNCJunctionById(const Id& id) const;
+  /**
+   * @brief get every junction of the map
+   * @param junctions store all junctions of the map
+   * @return 0:success, otherwise failed
+   */
+  int GetAllJunctions(std::vector<JunctionInfoConstPtr>* junctions) const;
 
   /**
    * @brief get all lanes in certain range
@@ -297,8 +311,20 @@ class HDMap {
                 const std::pair<double, double>& range,
                 Map* local_map) const;
 
+  /**
+   * @brief get the cache of the radius queries
+   * @return the cache, nullptr if enable_hdmap_query_cache is false
+   */
+  const HDMapQueryCache* query_cache() const { return query_cache_.get(); }
+
+ private:
+  void ResetQueryCache();
+
  private:
   HDMapImpl impl_;
+  // Results of GetLanes, GetNearestLaneWithHeading and GetRoadBoundaries,
+  // shared by the queries whose quantized point and radius are equal.
+  std::unique_ptr<HDMapQueryCache> query_cache_;
 };
 
 }  // namespace hdmap
@@ -16,6 +16,7 @@ limitations under the License.
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -140,6 +141,9 @@ class LaneInfo {
   explicit LaneInfo(const Lane &lane);
 
   const Id &id() const { return lane_.id(); }
+  // Dense handle of the lane in its map, in [0, number of lanes), or -1
+  // if the lane was not loaded by a map.
+  int index() const { return index_; }
   const Id &road_id() const { return road_id_; }
   const Id &section_id() const { return section_id_; }
   const Lane &lane() const { return lane_; }
@@ -228,12 +232,15 @@ class LaneInfo {
   void UpdateOverlaps(const HDMapImpl &map_instance);
   double GetWidthFromSample(const std::vector<LaneInfo::SampledWidth> &samples,
                             const double s) const;
-  void CreateKDTree();
+  void CreateKDTree() const;
+  const LaneSegmentKDTree &segment_kdtree() const;
   void set_road_id(const Id &road_id) { road_id_ = road_id; }
   void set_section_id(const Id &section_id) { section_id_ = section_id; }
+  void set_index(const int index) { index_ = index; }
 
  private:
   const Lane &lane_;
+  int index_ = -1;
   std::vector<apollo::common::math::Vec2d> points_;
   std::vector<apollo::common::math::Vec2d> unit_directions_;
   std::vector<double> headings_;
@@ -258,8 +265,11 @@ class LaneInfo {
   std::vector<SampledWidth> sampled_left_road_width_;
   std::vector<SampledWidth> sampled_right_road_width_;
 
-  std::vector<LaneSegmentBox> segment_box_list_;
-  std::unique_ptr<LaneSegmentKDTree> lane_segment_kdtree_;
+  // The segment kd-tree is built on the first nearest segment query, only
+  // the lanes queried around the vehicle are indexed.
+  mutable std::once_flag lane_segment_kdtree_flag_;
+  mutable std::vector<LaneSegmentBox> segment_box_list_;
+  mutable std::unique_ptr<LaneSegmentKDTree> lane_segment_kdtree_;
 
   Id road_id_;
   Id section_id_;
@@ -513,5 +523,16 @@ struct JunctionBoundary {
 
 using JunctionBoundaryPtr = std::shared_ptr<JunctionBoundary>;
 
+/**
+ * @brief whether two lanes are the same lane, compares the lane handles
+ *   instead of the id strings when both lanes come from a map
+ */
+inline bool IsSameLane(const LaneInfo &lane1, const LaneInfo &lane2) {
+  if (lane1.index() >= 0 && lane2.index() >= 0) {
+    return lane1.index() == lane2.index();
+  }
+  return lane1.id().id() == lane2.id().id();
+}
+
 }  // namespace hdmap
 }  // namespace apollo
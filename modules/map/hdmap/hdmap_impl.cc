@@ -16,8 +16,10 @@ limitations under the License.
 #include "modules/map/hdmap/hdmap_impl.h"
 
 #include <algorithm>
+#include <future>
 #include <limits>
 #include <set>
+#include <thread>
 #include <unordered_set>
 
 #include "modules/common/util/file.h"
@@ -43,6 +45,34 @@ constexpr double kLanesSearchRange = 10.0;
 // backward search distance in GetForwardNearestSignalsOnLane
 constexpr int kBackwardDistance = 4;
 
+// Calls func(i) for every i in [0, size), the indices being shared among
+// the hardware threads. Returns when all the indices are handled.
+template <typename Func>
+void ParallelFor(const size_t size, const Func& func) {
+  const size_t hardware_threads =
+      std::max(1u, std::thread::hardware_concurrency());
+  const size_t num_threads = std::min(size, hardware_threads);
+  if (num_threads <= 1) {
+    for (size_t i = 0; i < size; ++i) {
+      func(i);
+    }
+    return;
+  }
+  std::vector<std::future<void>> futures;
+  futures.reserve(num_threads);
+  for (size_t t = 0; t < num_threads; ++t) {
+    futures.push_back(std::async(std::launch::async, [&func, size,
+                                                      num_threads, t]() {
+      for (size_t i = t; i < size; i += num_threads) {
+        func(i);
+      }
+    }));
+  }
+  for (auto& future : futures) {
+    future.get();
+  }
+}
+
 }  // namespace
 
 int HDMapImpl::LoadMapFromFile(const std::string& map_filename) {
@@ -65,8 +95,24 @@ int HDMapImpl::LoadMapFromProto(const Map& map_proto) {
     Clear();
     map_ = map_proto;
   }
-  for (const auto& lane : map_.lane()) {
-    lane_table_[lane.id().id()].reset(new LaneInfo(lane));
+  // The lanes, with their segments and kd-trees, are the bulk of the
+  // loading time, they are built in parallel and inserted in map order.
+  std::vector<LaneInfo*> lanes(map_.lane_size(), nullptr);
+  ParallelFor(lanes.size(), [this, &lanes](const size_t i) {
+    lanes[i] = new LaneInfo(map_.lane(static_cast<int>(i)));
+  });
+  for (size_t i = 0; i < lanes.size(); ++i) {
+    lane_table_[lanes[i]->id().id()].reset(lanes[i]);
+  }
+  lanes_by_index_.clear();
+  lanes_by_index_.reserve(lane_table_.size());
+  for (LaneInfo* lane : lanes) {
+    // A lane replaced by a later one with the same id has no handle.
+    const auto& lane_ptr = lane_table_[lane->id().id()];
+    if (lane_ptr.get() == lane) {
+      lane->set_index(static_cast<int>(lanes_by_index_.size()));
+      lanes_by_index_.push_back(lane_ptr);
+    }
   }
   for (const auto& junction : map_.junction()) {
     junction_table_[junction.id().id()].reset(new JunctionInfo(junction));
@@ -122,25 +168,36 @@ int HDMapImpl::LoadMapFromProto(const Map& map_proto) {
       }
     }
   }
+  std::vector<LaneInfo*> lane_infos;
+  lane_infos.reserve(lane_table_.size());
   for (const auto& lane_ptr_pair : lane_table_) {
-    lane_ptr_pair.second->PostProcess(*this);
+    lane_infos.push_back(lane_ptr_pair.second.get());
   }
+  // The tables are complete here, the lanes only read them.
+  ParallelFor(lane_infos.size(), [this, &lane_infos](const size_t i) {
+    lane_infos[i]->PostProcess(*this);
+  });
   for (const auto& junction_ptr_pair : junction_table_) {
     junction_ptr_pair.second->PostProcess(*this);
   }
   for (const auto& stop_sign_ptr_pair : stop_sign_table_) {
     stop_sign_ptr_pair.second->PostProcess(*this);
   }
-  BuildLaneSegmentKDTree();
-  BuildJunctionPolygonKDTree();
-  BuildSignalSegmentKDTree();
-  BuildCrosswalkPolygonKDTree();
-  BuildStopSignSegmentKDTree();
-  BuildYieldSignSegmentKDTree();
-  BuildClearAreaPolygonKDTree();
-  BuildSpeedBumpSegmentKDTree();
-  BuildParkingSpacePolygonKDTree();
-  BuildPNCJunctionPolygonKDTree();
+  // The kd-trees are independent from each other.
+  const std::vector<void (HDMapImpl::*)()> build_kdtrees = {
+      &HDMapImpl::BuildLaneSegmentKDTree,
+      &HDMapImpl::BuildJunctionPolygonKDTree,
+      &HDMapImpl::BuildSignalSegmentKDTree,
+      &HDMapImpl::BuildCrosswalkPolygonKDTree,
+      &HDMapImpl::BuildStopSignSegmentKDTree,
+      &HDMapImpl::BuildYieldSignSegmentKDTree,
+      &HDMapImpl::BuildClearAreaPolygonKDTree,
+      &HDMapImpl::BuildSpeedBumpSegmentKDTree,
+      &HDMapImpl::BuildParkingSpacePolygonKDTree,
+      &HDMapImpl::BuildPNCJunctionPolygonKDTree};
+  ParallelFor(build_kdtrees.size(), [this, &build_kdtrees](const size_t i) {
+    (this->*build_kdtrees[i])();
+  });
   return 0;
 }
 
@@ -149,6 +206,13 @@ LaneInfoConstPtr HDMapImpl::GetLaneById(const Id& id) const {
   return it != lane_table_.end() ? it->second : nullptr;
 }
 
+LaneInfoConstPtr HDMapImpl::GetLaneByIndex(const int index) const {
+  if (index < 0 || index >= static_cast<int>(lanes_by_index_.size())) {
+    return nullptr;
+  }
+  return lanes_by_index_[index];
+}
+
 JunctionInfoConstPtr HDMapImpl::GetJunctionById(const Id& id) const {
   JunctionTable::const_iterator it = junction_table_.find(id.id());
   return it != junction_table_.end() ? it->second : nullptr;
@@ -254,6 +318,19 @@ int HDMapImpl::GetRoads(const Vec2d& point, double distance,
   return 0;
 }
 
+int HDMapImpl::GetAllJunctions(
+    std::vector<JunctionInfoConstPtr>* junctions) const {
+  if (junctions == nullptr) {
+    return -1;
+  }
+  junctions->clear();
+  junctions->reserve(junction_table_.size());
+  for (const auto& junction : junction_table_) {
+    junctions->push_back(junction.second);
+  }
+  return 0;
+}
+
 int HDMapImpl::GetJunctions(
     const PointENU& point, double distance,
     std::vector<JunctionInfoConstPtr>* junctions) const {
@@ -1305,6 +1382,7 @@ int HDMapImpl::SearchObjects(const Vec2d& center, const double radius,
 void HDMapImpl::Clear() {
   map_.Clear();
   lane_table_.clear();
+  lanes_by_index_.clear();
   junction_table_.clear();
   signal_table_.clear();
   crosswalk_table_.clear();
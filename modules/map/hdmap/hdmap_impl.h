@@ -94,6 +94,12 @@ class HDMapImpl {
   int LoadMapFromProto(const Map& map_proto);
 
   LaneInfoConstPtr GetLaneById(const Id& id) const;
+  /**
+   * @brief get a lane by its handle, see LaneInfo::index()
+   * @param index the handle of the lane
+   * @return the lane, nullptr if the handle is out of range
+   */
+  LaneInfoConstPtr GetLaneByIndex(const int index) const;
   JunctionInfoConstPtr GetJunctionById(const Id& id) const;
   SignalInfoConstPtr GetSignalById(const Id& id) const;
   CrosswalkInfoConstPtr GetCrosswalkById(const Id& id) const;
@@ -105,6 +111,12 @@ class HDMapImpl {
   RoadInfoConstPtr GetRoadById(const Id& id) const;
   ParkingSpaceInfoConstPtr GetParkingSpaceById(const Id& id) const;
   PNCJunctionInfoConstPtr GetPNCJunctionById(const Id& id) const;
+  /**
+   * @brief get every junction of the map
+   * @param junctions store all junctions of the map
+   * @return 0:success, otherwise failed
+   */
+  int GetAllJunctions(std::vector<JunctionInfoConstPtr>* junctions) const;
 
   /**
    * @brief get all lanes in certain range
@@ -397,6 +409,8 @@ class HDMapImpl {
  private:
   Map map_;
   LaneTable lane_table_;
+  // The lanes by handle, in map order.
+  std::vector<LaneInfoConstPtr> lanes_by_index_;
   JunctionTable junction_table_;
   CrosswalkTable crosswalk_table_;
   SignalTable signal_table_;
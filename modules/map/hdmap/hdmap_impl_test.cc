@@ -48,6 +48,23 @@ TEST_F(HDMapImplTestSuite, GetLaneById) {
   EXPECT_STREQ(lane_id.id().c_str(), lane_ptr->id().id().c_str());
 }
 
+TEST_F(HDMapImplTestSuite, GetLaneByIndex) {
+  Id lane_id;
+  lane_id.set_id("1272_1_-1");
+  const auto lane = hdmap_impl_.GetLaneById(lane_id);
+  ASSERT_TRUE(nullptr != lane);
+  ASSERT_GE(lane->index(), 0);
+  EXPECT_EQ(lane, hdmap_impl_.GetLaneByIndex(lane->index()));
+  EXPECT_TRUE(nullptr == hdmap_impl_.GetLaneByIndex(-1));
+
+  lane_id.set_id("773_1_-2");
+  const auto other_lane = hdmap_impl_.GetLaneById(lane_id);
+  ASSERT_TRUE(nullptr != other_lane);
+  EXPECT_NE(lane->index(), other_lane->index());
+  EXPECT_FALSE(IsSameLane(*lane, *other_lane));
+  EXPECT_TRUE(IsSameLane(*lane, *hdmap_impl_.GetLaneByIndex(lane->index())));
+}
+
 TEST_F(HDMapImplTestSuite, GetJunctionById) {
   Id junction_id;
   junction_id.set_id("1");
@@ -205,6 +222,18 @@ TEST_F(HDMapImplTestSuite, GetJunctions) {
   EXPECT_EQ("1183", junctions[0]->id().id());
 }
 
+TEST_F(HDMapImplTestSuite, GetAllJunctions) {
+  std::vector<JunctionInfoConstPtr> junctions;
+  EXPECT_EQ(-1, hdmap_impl_.GetAllJunctions(nullptr));
+  EXPECT_EQ(0, hdmap_impl_.GetAllJunctions(&junctions));
+  EXPECT_GT(junctions.size(), 1);
+  bool found = false;
+  for (const auto& junction : junctions) {
+    found = found || junction->id().id() == "1183";
+  }
+  EXPECT_TRUE(found);
+}
+
 TEST_F(HDMapImplTestSuite, GetCrosswalks) {
   std::vector<CrosswalkInfoConstPtr> crosswalks;
   apollo::common::PointENU point;
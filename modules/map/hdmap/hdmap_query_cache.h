@@ -0,0 +1,164 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "modules/common/util/sharded_lru_cache.h"
+#include "modules/map/hdmap/hdmap_common.h"
+
+namespace apollo {
+namespace hdmap {
+
+/**
+ * @brief key of a radius query, the point, radius and heading are
+ *   quantized so that nearly identical queries share their result.
+ */
+struct HDMapQueryKey {
+  int64_t x = 0;
+  int64_t y = 0;
+  int64_t radius = 0;
+  int64_t heading = 0;
+  int64_t heading_range = 0;
+
+  bool operator==(const HDMapQueryKey& other) const {
+    return x == other.x && y == other.y && radius == other.radius &&
+           heading == other.heading && heading_range == other.heading_range;
+  }
+};
+
+}  // namespace hdmap
+}  // namespace apollo
+
+namespace std {
+
+template <>
+struct hash<apollo::hdmap::HDMapQueryKey> {
+  size_t operator()(const apollo::hdmap::HDMapQueryKey& key) const {
+    size_t seed = 0;
+    for (const int64_t value :
+         {key.x, key.y, key.radius, key.heading, key.heading_range}) {
+      seed ^= hash<int64_t>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+  }
+};
+
+}  // namespace std
+
+namespace apollo {
+namespace hdmap {
+
+/**
+ * @class HDMapQueryCache
+ *
+ * @brief results of the recent radius queries of a map, in sharded LRU
+ *   caches safe to use from several threads.
+ */
+class HDMapQueryCache {
+ public:
+  struct Lanes {
+    int status = -1;
+    std::vector<LaneInfoConstPtr> lanes;
+  };
+
+  struct NearestLane {
+    int status = -1;
+    LaneInfoConstPtr lane;
+  };
+
+  struct RoadBoundaries {
+    int status = -1;
+    std::vector<RoadROIBoundaryPtr> road_boundaries;
+    std::vector<JunctionBoundaryPtr> junctions;
+  };
+
+  struct RoadRois {
+    int status = -1;
+    std::vector<RoadRoiPtr> road_boundaries;
+    std::vector<JunctionInfoConstPtr> junctions;
+  };
+
+  /**
+   * @brief constructor
+   * @param num_shards the number of independently locked shards of a cache
+   * @param capacity the number of results kept per query type
+   * @param resolution the quantization of the points and radii in meters
+   */
+  HDMapQueryCache(const size_t num_shards, const size_t capacity,
+                  const double resolution)
+      : resolution_(resolution),
+        lanes_(num_shards, capacity),
+        nearest_lanes_(num_shards, capacity),
+        road_boundaries_(num_shards, capacity),
+        road_rois_(num_shards, capacity) {}
+
+  HDMapQueryKey MakeKey(const apollo::common::PointENU& point,
+                        const double radius, const double heading = 0.0,
+                        const double heading_range = 0.0) const {
+    HDMapQueryKey key;
+    key.x = std::llround(point.x() / resolution_);
+    key.y = std::llround(point.y() / resolution_);
+    key.radius = std::llround(radius / resolution_);
+    key.heading = std::llround(heading / kHeadingResolution);
+    key.heading_range = std::llround(heading_range / kHeadingResolution);
+    return key;
+  }
+
+  common::util::ShardedLRUCache<HDMapQueryKey, Lanes>* lanes() {
+    return &lanes_;
+  }
+
+  common::util::ShardedLRUCache<HDMapQueryKey, NearestLane>* nearest_lanes() {
+    return &nearest_lanes_;
+  }
+
+  common::util::ShardedLRUCache<HDMapQueryKey, RoadBoundaries>*
+  road_boundaries() {
+    return &road_boundaries_;
+  }
+
+  common::util::ShardedLRUCache<HDMapQueryKey, RoadRois>* road_rois() {
+    return &road_rois_;
+  }
+
+  uint64_t hits() const {
+    return lanes_.hits() + nearest_lanes_.hits() + road_boundaries_.hits() +
+           road_rois_.hits();
+  }
+
+  uint64_t misses() const {
+    return lanes_.misses() + nearest_lanes_.misses() +
+           road_boundaries_.misses() + road_rois_.misses();
+  }
+
+ private:
+  static constexpr double kHeadingResolution = 0.01;
+
+  const double resolution_;
+  common::util::ShardedLRUCache<HDMapQueryKey, Lanes> lanes_;
+  common::util::ShardedLRUCache<HDMapQueryKey, NearestLane> nearest_lanes_;
+  common::util::ShardedLRUCache<HDMapQueryKey, RoadBoundaries>
+      road_boundaries_;
+  common::util::ShardedLRUCache<HDMapQueryKey, RoadRois> road_rois_;
+};
+
+}  // namespace hdmap
+}  // namespace apollo
@@ -0,0 +1,72 @@
+/* Copyright 2018 The Apollo Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+=========================================================================*/
+
+#include "gtest/gtest.h"
+#include "modules/common/configs/config_gflags.h"
+#include "modules/map/hdmap/hdmap.h"
+
+namespace {
+
+constexpr char kMapFilename[] = "modules/map/hdmap/test-data/base_map.bin";
+
+}  // namespace
+
+namespace apollo {
+namespace hdmap {
+
+TEST(HDMapQueryCacheTest, SameResults) {
+  FLAGS_enable_hdmap_query_cache = true;
+  HDMap hdmap;
+  EXPECT_EQ(0, hdmap.LoadMapFromFile(kMapFilename));
+  FLAGS_enable_hdmap_query_cache = false;
+  ASSERT_TRUE(hdmap.query_cache() != nullptr);
+
+  apollo::common::PointENU point;
+  point.set_x(586424.09);
+  point.set_y(4140727.02);
+  point.set_z(0.0);
+  for (int i = 0; i < 2; ++i) {
+    std::vector<LaneInfoConstPtr> lanes;
+    EXPECT_EQ(0, hdmap.GetLanes(point, 5, &lanes));
+    ASSERT_EQ(1, lanes.size());
+    EXPECT_EQ("773_1_-2", lanes[0]->id().id());
+
+    LaneInfoConstPtr nearest_lane;
+    double nearest_s = 0.0;
+    double nearest_l = 0.0;
+    EXPECT_EQ(-1, hdmap.GetNearestLaneWithHeading(point, 1e-6, 0.86, 0.2,
+                                                  &nearest_lane, &nearest_s,
+                                                  &nearest_l));
+    EXPECT_EQ(0, hdmap.GetNearestLaneWithHeading(point, 5, -2.35, 1.0,
+                                                 &nearest_lane, &nearest_s,
+                                                 &nearest_l));
+    ASSERT_TRUE(nearest_lane != nullptr);
+    EXPECT_EQ("773_1_-2", nearest_lane->id().id());
+    EXPECT_NEAR(nearest_l, -3.257, 1E-3);
+    EXPECT_NEAR(nearest_s, 25.891, 1E-3);
+  }
+  EXPECT_EQ(3, hdmap.query_cache()->hits());
+  EXPECT_EQ(3, hdmap.query_cache()->misses());
+
+  // A point of the same quantization cell shares the lanes.
+  point.set_x(point.x() + 0.01);
+  std::vector<LaneInfoConstPtr> lanes;
+  EXPECT_EQ(0, hdmap.GetLanes(point, 5, &lanes));
+  EXPECT_EQ(1, lanes.size());
+  EXPECT_EQ(4, hdmap.query_cache()->hits());
+}
+
+}  // namespace hdmap
+}  // namespace apollo
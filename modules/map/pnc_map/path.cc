@@ -47,7 +47,7 @@ bool FindLaneSegment(const MapPathPoint& p1, const MapPathPoint& p2,
                      LaneSegment* const lane_segment) {
   for (const auto& wp1 : p1.lane_waypoints()) {
     for (const auto& wp2 : p2.lane_waypoints()) {
-      if (wp1.lane->id().id() == wp2.lane->id().id() && wp1.s < wp2.s) {
+      if (IsSameLane(*wp1.lane, *wp2.lane) && wp1.s < wp2.s) {
         *lane_segment = LaneSegment(wp1.lane, wp1.s, wp2.s);
         return true;
       }
@@ -589,7 +589,7 @@ MapPathPoint Path::GetSmoothPoint(const InterpolatedIndex& index) const {
       auto ref_lane_waypoint = ref_point.lane_waypoints()[0];
       if (lane_segment.lane != nullptr) {
         for (const auto& lane_waypoint : ref_point.lane_waypoints()) {
-          if (lane_waypoint.lane->id().id() == lane_segment.lane->id().id()) {
+          if (IsSameLane(*lane_waypoint.lane, *lane_segment.lane)) {
             ref_lane_waypoint = lane_waypoint;
             break;
           }
@@ -756,30 +756,8 @@ bool Path::GetProjectionWithHueristicParams(const Vec2d& point,
       *min_distance = distance;
     }
   }
-  *min_distance = std::sqrt(*min_distance);
-  const auto& nearest_seg = segments_[min_index];
-  const auto prod = nearest_seg.ProductOntoUnit(point);
-  const auto proj = nearest_seg.ProjectOntoUnit(point);
-  if (min_index == 0) {
-    *accumulate_s = std::min(proj, nearest_seg.length());
-    if (proj < 0) {
-      *lateral = prod;
-    } else {
-      *lateral = (prod > 0.0 ? 1 : -1) * *min_distance;
-    }
-  } else if (min_index == num_segments_ - 1) {
-    *accumulate_s = accumulated_s_[min_index] + std::max(0.0, proj);
-    if (proj > 0) {
-      *lateral = prod;
-    } else {
-      *lateral = (prod > 0.0 ? 1 : -1) * *min_distance;
-    }
-  } else {
-    *accumulate_s = accumulated_s_[min_index] +
-                    std::max(0.0, std::min(proj, nearest_seg.length()));
-    *lateral = (prod > 0.0 ? 1 : -1) * *min_distance;
-  }
-  return true;
+  return GetProjectionFromSegment(point, min_index, accumulate_s, lateral,
+                                  min_distance);
 }
 
 bool Path::GetProjection(const Vec2d& point, double* accumulate_s,
@@ -805,8 +783,95 @@ bool Path::GetProjection(const Vec2d& point, double* accumulate_s,
       *min_distance = distance;
     }
   }
-  *min_distance = std::sqrt(*min_distance);
+  return GetProjectionFromSegment(point, min_index, accumulate_s, lateral,
+                                  min_distance);
+}
+
+bool Path::GetProjections(const std::vector<Vec2d>& points,
+                          std::vector<double>* accumulate_s,
+                          std::vector<double>* lateral) const {
+  if (segments_.empty() || accumulate_s == nullptr || lateral == nullptr) {
+    return false;
+  }
+  accumulate_s->resize(points.size());
+  lateral->resize(points.size());
+  double distance = 0.0;
+  if (use_path_approximation_ || points.size() < 2) {
+    for (size_t i = 0; i < points.size(); ++i) {
+      if (!GetProjection(points[i], &accumulate_s->at(i), &lateral->at(i),
+                         &distance)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  CHECK_GE(num_points_, 2);
+  // The segments in flat arrays, as LineSegment2d::DistanceSquareTo() reads
+  // them, so that the distances are the same as the ones of GetProjection.
+  std::vector<double> start_x(num_segments_);
+  std::vector<double> start_y(num_segments_);
+  std::vector<double> end_x(num_segments_);
+  std::vector<double> end_y(num_segments_);
+  std::vector<double> unit_x(num_segments_);
+  std::vector<double> unit_y(num_segments_);
+  std::vector<double> length(num_segments_);
+  for (int i = 0; i < num_segments_; ++i) {
+    const LineSegment2d& segment = segments_[i];
+    start_x[i] = segment.start().x();
+    start_y[i] = segment.start().y();
+    end_x[i] = segment.end().x();
+    end_y[i] = segment.end().y();
+    unit_x[i] = segment.unit_direction().x();
+    unit_y[i] = segment.unit_direction().y();
+    length[i] = segment.length();
+  }
+  for (size_t i = 0; i < points.size(); ++i) {
+    const double x = points[i].x();
+    const double y = points[i].y();
+    double min_distance_sqr = std::numeric_limits<double>::infinity();
+    int min_index = 0;
+    for (int j = 0; j < num_segments_; ++j) {
+      // A degenerated segment has a zero unit direction, so proj is 0 and
+      // the distance is the one to its start.
+      const double x0 = x - start_x[j];
+      const double y0 = y - start_y[j];
+      const double proj = x0 * unit_x[j] + y0 * unit_y[j];
+      double distance_sqr = 0.0;
+      if (proj <= 0.0) {
+        distance_sqr = x0 * x0 + y0 * y0;
+      } else if (proj >= length[j]) {
+        const double x1 = x - end_x[j];
+        const double y1 = y - end_y[j];
+        distance_sqr = x1 * x1 + y1 * y1;
+      } else {
+        const double cross = x0 * unit_y[j] - y0 * unit_x[j];
+        distance_sqr = cross * cross;
+      }
+      if (distance_sqr < min_distance_sqr) {
+        min_distance_sqr = distance_sqr;
+        min_index = j;
+      }
+    }
+    if (!GetProjectionFromSegment(points[i], min_index, &accumulate_s->at(i),
+                                  &lateral->at(i), &distance)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool Path::GetProjectionFromSegment(const Vec2d& point, const int min_index,
+                                    double* accumulate_s, double* lateral,
+                                    double* min_distance) const {
+  if (min_index < 0 || min_index >= num_segments_) {
+    return false;
+  }
+  if (accumulate_s == nullptr || lateral == nullptr ||
+      min_distance == nullptr) {
+    return false;
+  }
   const auto& nearest_seg = segments_[min_index];
+  *min_distance = std::sqrt(nearest_seg.DistanceSquareTo(point));
   const auto prod = nearest_seg.ProductOntoUnit(point);
   const auto proj = nearest_seg.ProjectOntoUnit(point);
   if (min_index == 0) {
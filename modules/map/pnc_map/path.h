@@ -260,6 +260,17 @@ class Path {
                      double* lateral) const;
   bool GetProjection(const common::math::Vec2d& point, double* accumulate_s,
                      double* lateral, double* distance) const;
+  // Projects a batch of points as GetProjection does, with the segments
+  // copied once in flat arrays that the nearest segment search of every
+  // point scans.
+  bool GetProjections(const std::vector<common::math::Vec2d>& points,
+                      std::vector<double>* accumulate_s,
+                      std::vector<double>* lateral) const;
+  // Projects the point as GetProjection does, given the index of the segment
+  // nearest to it.
+  bool GetProjectionFromSegment(const common::math::Vec2d& point,
+                                const int min_index, double* accumulate_s,
+                                double* lateral, double* distance) const;
 
   bool GetHeadingAlongPath(const common::math::Vec2d& point,
                            double* heading) const;
@@ -281,6 +292,7 @@ class Path {
     return segments_;
   }
   const PathApproximation* approximation() const { return &approximation_; }
+  bool use_path_approximation() const { return use_path_approximation_; }
   double length() const { return length_; }
 
   const PathOverlap* NextLaneOverlap(double s) const;
@@ -506,6 +506,37 @@ TEST(TestSuite, hdmap_circle_path) {
   }
 }
 
+TEST(TestSuite, hdmap_batched_projection) {
+  const double kRadius = 50.0;
+  const int kNumSegments = 100;
+  std::vector<MapPathPoint> points;
+  for (int i = 0; i <= kNumSegments; ++i) {
+    const double p =
+        M_PI_2 * static_cast<double>(i) / static_cast<double>(kNumSegments);
+    points.push_back(MakeMapPathPoint(kRadius * cos(p), kRadius * sin(p)));
+  }
+  const Path path(points, {});
+  std::vector<common::math::Vec2d> query_points;
+  for (int i = 0; i <= 20; ++i) {
+    for (int j = 0; j <= 20; ++j) {
+      query_points.emplace_back(-kRadius * 0.5 + kRadius * 0.1 * i,
+                                -kRadius * 0.5 + kRadius * 0.1 * j);
+    }
+  }
+  std::vector<double> accumulate_s;
+  std::vector<double> lateral;
+  EXPECT_TRUE(path.GetProjections(query_points, &accumulate_s, &lateral));
+  ASSERT_EQ(query_points.size(), accumulate_s.size());
+  ASSERT_EQ(query_points.size(), lateral.size());
+  for (size_t i = 0; i < query_points.size(); ++i) {
+    double s = 0.0;
+    double l = 0.0;
+    EXPECT_TRUE(path.GetProjection(query_points[i], &s, &l));
+    EXPECT_DOUBLE_EQ(s, accumulate_s[i]);
+    EXPECT_DOUBLE_EQ(l, lateral[i]);
+  }
+}
+
 TEST(TestSuite, hdmap_jerky_path) {
   const int kNumPaths = 100;
   const int kCasesPerPath = 1000;
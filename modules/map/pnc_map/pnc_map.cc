@@ -21,13 +21,16 @@
 #include "modules/map/pnc_map/pnc_map.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
+#include <utility>
 
 #include "google/protobuf/text_format.h"
 
 #include "modules/map/proto/map_id.pb.h"
 
 #include "cyber/common/log.h"
+#include "modules/common/math/math_utils.h"
 #include "modules/common/util/string_util.h"
 #include "modules/common/util/util.h"
 #include "modules/map/hdmap/hdmap_util.h"
@@ -46,6 +49,10 @@ DEFINE_double(
     look_forward_long_distance, 250,
     "look forward this distance when creating reference line from routing");
 
+DEFINE_bool(enable_pnc_map_incremental_tracking, false,
+            "Locate the vehicle on the route lanes it was tracked on before "
+            "querying the map around it.");
+
 namespace apollo {
 namespace hdmap {
 
@@ -174,7 +181,11 @@ bool PncMap::UpdateVehicleState(const VehicleState &vehicle_state) {
   }
 
   adc_state_ = vehicle_state;
-  if (!GetNearestPointFromRouting(vehicle_state, &adc_waypoint_)) {
+  const bool is_tracked =
+      FLAGS_enable_pnc_map_incremental_tracking &&
+      GetNearestPointFromTrackedRoute(vehicle_state, &adc_waypoint_);
+  if (!is_tracked &&
+      !GetNearestPointFromRouting(vehicle_state, &adc_waypoint_)) {
     AERROR << "Failed to get waypoint from routing with point: "
            << "(" << vehicle_state.x() << ", " << vehicle_state.y() << ", "
            << vehicle_state.z() << ")";
@@ -267,7 +278,17 @@ bool PncMap::UpdateRoutingResponse(const routing::RoutingResponse &routing) {
       ++i;
     }
   }
+  // The cached segments point to the passages of routing_.
+  passage_segments_.clear();
   routing_ = routing;
+  for (const auto &road_segment : routing_.road()) {
+    for (const auto &passage : road_segment.passage()) {
+      RouteSegments segments;
+      if (PassageToSegments(passage, &segments)) {
+        passage_segments_.emplace(&passage, std::move(segments));
+      }
+    }
+  }
   adc_waypoint_ = LaneWaypoint();
   stop_for_destination_ = false;
   return true;
@@ -367,6 +388,17 @@ bool PncMap::PassageToSegments(routing::Passage passage,
   return !segments->empty();
 }
 
+bool PncMap::GetPassageSegments(const routing::Passage &passage,
+                                RouteSegments *segments) const {
+  CHECK_NOTNULL(segments);
+  const auto iter = passage_segments_.find(&passage);
+  if (iter == passage_segments_.end()) {
+    return PassageToSegments(passage, segments);
+  }
+  *segments = iter->second;
+  return true;
+}
+
 std::vector<int> PncMap::GetNeighborPassages(const routing::RoadSegment &road,
                                              int start_passage) const {
   CHECK_GE(start_passage, 0);
@@ -381,7 +413,7 @@ std::vector<int> PncMap::GetNeighborPassages(const routing::RoadSegment &road,
     return result;
   }
   RouteSegments source_segments;
-  if (!PassageToSegments(source_passage, &source_segments)) {
+  if (!GetPassageSegments(source_passage, &source_segments)) {
     AERROR << "failed to convert passage to segments";
     return result;
   }
@@ -456,7 +488,7 @@ bool PncMap::GetRouteSegments(const VehicleState &vehicle_state,
   for (const int index : drive_passages) {
     const auto &passage = road.passage(index);
     RouteSegments segments;
-    if (!PassageToSegments(passage, &segments)) {
+    if (!GetPassageSegments(passage, &segments)) {
       ADEBUG << "Failed to convert passage to lane segments.";
       continue;
     }
@@ -578,6 +610,46 @@ bool PncMap::GetNearestPointFromRouting(const VehicleState &state,
   return waypoint->lane != nullptr;
 }
 
+bool PncMap::GetNearestPointFromTrackedRoute(const VehicleState &state,
+                                             LaneWaypoint *waypoint) const {
+  if (adc_route_index_ < 0 || adc_waypoint_.lane == nullptr) {
+    return false;
+  }
+  const common::math::Vec2d point(state.x(), state.y());
+  waypoint->lane = nullptr;
+  double min_distance = std::numeric_limits<double>::infinity();
+  const int end_index = std::min(adc_route_index_ + 2,
+                                 static_cast<int>(route_indices_.size()));
+  for (int i = adc_route_index_; i < end_index; ++i) {
+    const auto &lane = route_indices_[i].segment.lane;
+    if (range_lane_ids_.count(lane->id().id()) == 0 ||
+        !lane->IsOnLane(point)) {
+      continue;
+    }
+    // Same conditions as GetNearestPointFromRouting.
+    double s = 0.0;
+    double l = 0.0;
+    if (!lane->GetProjection(point, &s, &l)) {
+      continue;
+    }
+    constexpr double kEpsilon = 0.5;
+    if (s > (lane->total_length() + kEpsilon) || (s + kEpsilon) < 0.0 ||
+        std::fabs(common::math::AngleDiff(lane->Heading(s),
+                                          state.heading())) > M_PI / 2.0) {
+      continue;
+    }
+    double distance = 0.0;
+    const common::PointENU map_point = lane->GetNearestPoint(point, &distance);
+    if (distance < min_distance &&
+        lane->GetProjection({map_point.x(), map_point.y()}, &s, &l)) {
+      min_distance = distance;
+      waypoint->lane = lane;
+      waypoint->s = s;
+    }
+  }
+  return waypoint->lane != nullptr;
+}
+
 LaneInfoConstPtr PncMap::GetRouteSuccessor(LaneInfoConstPtr lane) const {
   if (lane->lane().successor_id_size() == 0) {
     return nullptr;
@@ -672,8 +744,7 @@ bool PncMap::ExtendSegments(const RouteSegments &segments, double start_s,
         std::min(end_s - router_s + lane_segment.start_s, lane_segment.end_s);
     if (adjusted_start_s < adjusted_end_s) {
       if (!truncated_segments->empty() &&
-          truncated_segments->back().lane->id().id() ==
-              lane_segment.lane->id().id()) {
+          IsSameLane(*truncated_segments->back().lane, *lane_segment.lane)) {
         truncated_segments->back().end_s = adjusted_end_s;
       } else if (unique_lanes.find(lane_segment.lane->id().id()) ==
                  unique_lanes.end()) {
@@ -22,6 +22,7 @@
 
 #include <list>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -38,6 +39,7 @@
 DECLARE_double(look_backward_distance);
 DECLARE_double(look_forward_short_distance);
 DECLARE_double(look_forward_long_distance);
+DECLARE_bool(enable_pnc_map_incremental_tracking);
 
 namespace apollo {
 namespace hdmap {
@@ -95,9 +97,24 @@ class PncMap {
   bool GetNearestPointFromRouting(const common::VehicleState &point,
                                   LaneWaypoint *waypoint) const;
 
+  /**
+   * @brief Find the waypoint of the vehicle on the route lanes of its
+   * previous route index and of the next one, without querying the map.
+   * @return false if the vehicle is not on these lanes.
+   */
+  bool GetNearestPointFromTrackedRoute(const common::VehicleState &state,
+                                       LaneWaypoint *waypoint) const;
+
   bool PassageToSegments(routing::Passage passage,
                          RouteSegments *segments) const;
 
+  /**
+   * @brief Same as PassageToSegments, from the segments converted when the
+   * routing was updated if the passage is one of the routing passages.
+   */
+  bool GetPassageSegments(const routing::Passage &passage,
+                          RouteSegments *segments) const;
+
   bool ProjectToSegments(const common::PointENU &point_enu,
                          const RouteSegments &segments,
                          LaneWaypoint *waypoint) const;
@@ -169,6 +186,12 @@ class PncMap {
   // routing ids in range
   std::unordered_set<std::string> range_lane_ids_;
   std::unordered_set<std::string> all_lane_ids_;
+  /**
+   * The lane segments of the passages of routing_, converted once per
+   * routing instead of on every cycle.
+   */
+  std::unordered_map<const routing::Passage *, RouteSegments>
+      passage_segments_;
 
   /**
    * The routing request waypoints
@@ -217,6 +240,7 @@ class PncMap {
 
   FRIEND_TEST(PncMapTest, UpdateRouting);
   FRIEND_TEST(PncMapTest, GetNearestPointFromRouting);
+  FRIEND_TEST(PncMapTest, GetRouteSegments_IncrementalTracking);
   FRIEND_TEST(PncMapTest, UpdateWaypointIndex);
   FRIEND_TEST(PncMapTest, UpdateNextRoutingWaypointIndex);
   FRIEND_TEST(PncMapTest, GetNeighborPassages);
@@ -120,6 +120,42 @@ TEST_F(PncMapTest, GetRouteSegments_NoChangeLane) {
   EXPECT_FALSE(segments.back().IsOnSegment());
 }
 
+TEST_F(PncMapTest, GetRouteSegments_IncrementalTracking) {
+  auto lane = hdmap_.GetLaneById(hdmap::MakeMapId("9_1_-2"));
+  ASSERT_TRUE(lane);
+  PncMap tracked_pnc_map(&hdmap_);
+  PncMap searched_pnc_map(&hdmap_);
+  ASSERT_TRUE(tracked_pnc_map.UpdateRoutingResponse(routing_));
+  ASSERT_TRUE(searched_pnc_map.UpdateRoutingResponse(routing_));
+  for (const double s : {0.0, 2.0, 4.0}) {
+    auto point = lane->GetSmoothPoint(s);
+    common::VehicleState state;
+    state.set_x(point.x());
+    state.set_y(point.y());
+    state.set_z(point.y());
+    state.set_heading(lane->Heading(s));
+    std::list<RouteSegments> tracked_segments;
+    std::list<RouteSegments> searched_segments;
+    FLAGS_enable_pnc_map_incremental_tracking = true;
+    ASSERT_TRUE(
+        tracked_pnc_map.GetRouteSegments(state, 10, 30, &tracked_segments));
+    FLAGS_enable_pnc_map_incremental_tracking = false;
+    ASSERT_TRUE(
+        searched_pnc_map.GetRouteSegments(state, 10, 30, &searched_segments));
+    EXPECT_EQ(searched_pnc_map.adc_route_index_,
+              tracked_pnc_map.adc_route_index_);
+    EXPECT_NEAR(searched_pnc_map.adc_waypoint_.s,
+                tracked_pnc_map.adc_waypoint_.s, 1e-6);
+    ASSERT_EQ(searched_segments.size(), tracked_segments.size());
+    auto tracked_iter = tracked_segments.begin();
+    for (const auto& searched : searched_segments) {
+      EXPECT_EQ(searched.Id(), tracked_iter->Id());
+      EXPECT_NEAR(RouteLength(searched), RouteLength(*tracked_iter), 1e-6);
+      ++tracked_iter;
+    }
+  }
+}
+
 TEST_F(PncMapTest, UpdateNextRoutingWaypointIndex) {
   pnc_map_->next_routing_waypoint_index_ = 0;
   pnc_map_->adc_waypoint_.s = 0;
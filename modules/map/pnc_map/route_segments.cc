@@ -48,8 +48,7 @@ void RouteSegments::SetStopForDestination(bool stop_for_destination) {
 
 bool RouteSegments::WithinLaneSegment(const LaneSegment &lane_segment,
                                       const LaneWaypoint &waypoint) {
-  return waypoint.lane &&
-         lane_segment.lane->id().id() == waypoint.lane->id().id() &&
+  return waypoint.lane && IsSameLane(*lane_segment.lane, *waypoint.lane) &&
          lane_segment.start_s - kSegmentationEpsilon <= waypoint.s &&
          lane_segment.end_s + kSegmentationEpsilon >= waypoint.s;
 }
@@ -22,8 +22,11 @@
 #include "modules/map/relative_map/navigation_lane.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "modules/map/proto/map_lane.pb.h"
 
@@ -45,6 +48,10 @@ using apollo::common::util::operator+;
 using apollo::common::util::IsFloatEqual;
 
 namespace {
+
+// the number of points of a navigation line in a bounding box of the cache
+constexpr int kCacheBlockSize = 64;
+
 /**
  * @brief Create a single lane map.
  * @param navi_path_tuple A navigation path tuple.
@@ -147,6 +154,7 @@ void NavigationLane::SetConfig(const NavigationLaneConfig &config) {
 void NavigationLane::UpdateNavigationInfo(
     const NavigationInfo &navigation_path) {
   navigation_info_ = navigation_path;
+  UpdateNavigationLineCache();
   last_project_index_map_.clear();
   navigation_path_list_.clear();
   current_navi_path_tuple_ = std::make_tuple(-1, -1.0, -1.0, nullptr);
@@ -188,7 +196,14 @@ bool NavigationLane::GeneratePath() {
     // Don't worry about efficiency because the total number of navigation lines
     // will not exceed 10 at most.
     for (int i = 0; i < navigation_line_num; ++i) {
-      auto current_navi_path = std::make_shared<NavigationPath>();
+      // The path of the last cycle is refilled in place, reusing its points,
+      // unless someone still holds it.
+      auto &current_navi_path = navigation_line_cache_[i].navi_path;
+      if (current_navi_path == nullptr || current_navi_path.use_count() > 1) {
+        current_navi_path = std::make_shared<NavigationPath>();
+      } else {
+        current_navi_path->Clear();
+      }
       auto *path = current_navi_path->mutable_path();
       if (ConvertNavigationLineToPath(i, path)) {
         current_navi_path->set_path_priority(
@@ -462,28 +477,17 @@ bool NavigationLane::ConvertNavigationLineToPath(const int line_index,
     last_project_index_map_[line_index] = proj_index_pair;
   }
 
-  // offset between the current vehicle state and navigation line
+  // The rigid transform from the ENU coordinates of the cached navigation
+  // line to the FLU coordinates of the vehicle.
+  const auto &cache = navigation_line_cache_[line_index];
   const double dx = -original_pose_.position().x();
   const double dy = -original_pose_.position().y();
-  auto enu_to_flu_func = [this, dx, dy](const double enu_x, const double enu_y,
-                                        const double enu_theta, double *flu_x,
-                                        double *flu_y, double *flu_theta) {
-    if (flu_x != nullptr && flu_y != nullptr) {
-      Eigen::Vector2d flu_coordinate = common::math::RotateVector2d(
-          {enu_x + dx, enu_y + dy}, -original_pose_.heading());
-
-      *flu_x = flu_coordinate.x();
-      *flu_y = flu_coordinate.y();
-    }
-
-    if (flu_theta != nullptr) {
-      *flu_theta = common::math::NormalizeAngle(
-          common::math::NormalizeAngle(enu_theta) - original_pose_.heading());
-    }
-  };
+  const double heading = original_pose_.heading();
+  const double cos_heading = std::cos(-heading);
+  const double sin_heading = std::sin(-heading);
 
   auto gen_navi_path_loop_func =
-      [this, &navigation_path, &enu_to_flu_func](
+      [&navigation_path, &cache, dx, dy, heading, cos_heading, sin_heading](
           const int start, const int end, const double ref_s_base,
           const double max_length, common::Path *path) {
         CHECK_NOTNULL(path);
@@ -492,15 +496,12 @@ bool NavigationLane::ConvertNavigationLineToPath(const int line_index,
           auto *point = path->add_path_point();
           point->CopyFrom(navigation_path.path_point(i));
 
-          double flu_x = 0.0;
-          double flu_y = 0.0;
-          double flu_theta = 0.0;
-          enu_to_flu_func(point->x(), point->y(), point->theta(), &flu_x,
-                          &flu_y, &flu_theta);
-
-          point->set_x(flu_x);
-          point->set_y(flu_y);
-          point->set_theta(flu_theta);
+          const double x = cache.x[i] + dx;
+          const double y = cache.y[i] + dy;
+          point->set_x(cos_heading * x - sin_heading * y);
+          point->set_y(sin_heading * x + cos_heading * y);
+          point->set_theta(
+              common::math::NormalizeAngle(cache.theta[i] - heading));
           const double accumulated_s =
               navigation_path.path_point(i).s() - ref_s + ref_s_base;
           point->set_s(accumulated_s);
@@ -612,15 +613,21 @@ ProjIndexPair NavigationLane::UpdateProjectionIndex(const common::Path &path,
   };
 
   int index = 0;
-  for (int i = current_project_index; i + 1 < path_size; ++i) {
-    const double d = DistanceXY(original_pose_.position(), path.path_point(i));
-    if (d < min_d) {
-      min_d = d;
-      index = i;
-    }
-    const double kMaxDistance = 50.0;
-    if (current_project_index != 0 && d > kMaxDistance) {
-      break;
+  if (current_project_index == 0) {
+    // no projection to continue from, so search the whole navigation line
+    index = FindNearestPointIndex(line_index, path_size - 1, &min_d);
+  } else {
+    for (int i = current_project_index; i + 1 < path_size; ++i) {
+      const double d =
+          DistanceXY(original_pose_.position(), path.path_point(i));
+      if (d < min_d) {
+        min_d = d;
+        index = i;
+      }
+      const double kMaxDistance = 50.0;
+      if (d > kMaxDistance) {
+        break;
+      }
     }
   }
 
@@ -650,6 +657,80 @@ ProjIndexPair NavigationLane::UpdateProjectionIndex(const common::Path &path,
   return std::make_pair(-1, std::numeric_limits<double>::max());
 }
 
+void NavigationLane::UpdateNavigationLineCache() {
+  navigation_line_cache_.clear();
+  navigation_line_cache_.resize(navigation_info_.navigation_path_size());
+  for (int i = 0; i < navigation_info_.navigation_path_size(); ++i) {
+    const auto &path = navigation_info_.navigation_path(i).path();
+    auto &cache = navigation_line_cache_[i];
+    const int path_size = path.path_point_size();
+    cache.x.reserve(path_size);
+    cache.y.reserve(path_size);
+    cache.theta.reserve(path_size);
+    for (const auto &point : path.path_point()) {
+      cache.x.push_back(point.x());
+      cache.y.push_back(point.y());
+      cache.theta.push_back(common::math::NormalizeAngle(point.theta()));
+    }
+    for (int begin = 0; begin < path_size; begin += kCacheBlockSize) {
+      NavigationLineCache::Block block;
+      block.begin = begin;
+      block.end = std::min(path_size, begin + kCacheBlockSize);
+      const auto x_range = std::minmax_element(
+          cache.x.begin() + block.begin, cache.x.begin() + block.end);
+      const auto y_range = std::minmax_element(
+          cache.y.begin() + block.begin, cache.y.begin() + block.end);
+      block.min_x = *x_range.first;
+      block.max_x = *x_range.second;
+      block.min_y = *y_range.first;
+      block.max_y = *y_range.second;
+      cache.blocks.push_back(block);
+    }
+  }
+}
+
+int NavigationLane::FindNearestPointIndex(const int line_index, const int end,
+                                          double *const min_d) const {
+  CHECK_NOTNULL(min_d);
+  const auto &cache = navigation_line_cache_[line_index];
+  const double x = original_pose_.position().x();
+  const double y = original_pose_.position().y();
+
+  // the blocks in the order of the distances to their bounding boxes, which
+  // bound the distances to their points from below
+  std::vector<std::pair<double, int>> block_distances;
+  block_distances.reserve(cache.blocks.size());
+  for (size_t i = 0; i < cache.blocks.size(); ++i) {
+    const auto &block = cache.blocks[i];
+    if (block.begin >= end) {
+      break;
+    }
+    const double gap_x = std::max({block.min_x - x, x - block.max_x, 0.0});
+    const double gap_y = std::max({block.min_y - y, y - block.max_y, 0.0});
+    block_distances.emplace_back(std::hypot(gap_x, gap_y), static_cast<int>(i));
+  }
+  std::sort(block_distances.begin(), block_distances.end());
+
+  // the same nearest point as a scan of the whole line, the first of equally
+  // near ones
+  int index = 0;
+  *min_d = std::numeric_limits<double>::max();
+  for (const auto &block_distance : block_distances) {
+    if (block_distance.first > *min_d) {
+      break;
+    }
+    const auto &block = cache.blocks[block_distance.second];
+    for (int i = block.begin; i < std::min(block.end, end); ++i) {
+      const double d = std::hypot(x - cache.x[i], y - cache.y[i]);
+      if (d < *min_d || (d == *min_d && i < index)) {
+        *min_d = d;
+        index = i;
+      }
+    }
+  }
+  return index;
+}
+
 double NavigationLane::GetKappa(const double c1, const double c2,
                                 const double c3, const double x) {
   const double dy = 3 * c3 * x * x + 2 * c2 * x + c1;
@@ -26,6 +26,7 @@
 #include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "modules/common/vehicle_state/proto/vehicle_state.pb.h"
 #include "modules/localization/proto/localization.pb.h"
@@ -251,6 +252,26 @@ class NavigationLane {
   ProjIndexPair UpdateProjectionIndex(const common::Path& path,
                                       const int line_index);
 
+  /**
+   * @brief Cache the points of the navigation lines in plain arrays, with the
+   * bounding boxes of blocks of them, when the navigation lines are updated.
+   * @param
+   * @return None.
+   */
+  void UpdateNavigationLineCache();
+
+  /**
+   * @brief Find the point of a navigation line before `end` nearest to the
+   * vehicle, searching the blocks of points in the order of the distances to
+   * their bounding boxes.
+   * @param line_index The index of the navigation line.
+   * @param end The end of the searched points.
+   * @param min_d The pointer storing the distance to the nearest point.
+   * @return The index of the nearest point.
+   */
+  int FindNearestPointIndex(const int line_index, const int end,
+                            double* const min_d) const;
+
   /**
    * @brief If an entire navigation line is a cyclic/circular
    * route, the closest matching point at the starting and end positions is
@@ -298,6 +319,28 @@ class NavigationLane {
 
   // in world coordination: ENU
   localization::Pose original_pose_;
+
+  // A navigation line in world coordinates with its headings normalized, so
+  // that a cycle only rotates and translates the points it outputs.
+  struct NavigationLineCache {
+    struct Block {
+      int begin = 0;
+      int end = 0;
+      double min_x = 0.0;
+      double max_x = 0.0;
+      double min_y = 0.0;
+      double max_y = 0.0;
+    };
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> theta;
+    std::vector<Block> blocks;
+    // the navigation path generated from the line in the last cycle
+    std::shared_ptr<NavigationPath> navi_path;
+  };
+
+  // indexed by the navigation line index
+  std::vector<NavigationLineCache> navigation_line_cache_;
 };
 
 }  // namespace relative_map
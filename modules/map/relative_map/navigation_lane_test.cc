@@ -223,5 +223,47 @@ TEST_F(NavigationLaneTest, GenerateThreeLaneMap) {
   }
 }
 
+TEST_F(NavigationLaneTest, RegeneratePathAfterMoving) {
+  navigation_line_filenames_.emplace_back(data_file_dir_ + "left.smoothed");
+  navigation_line_filenames_.emplace_back(data_file_dir_ + "middle.smoothed");
+  navigation_line_filenames_.emplace_back(data_file_dir_ + "right.smoothed");
+  EXPECT_TRUE(
+      GenerateNavigationInfo(navigation_line_filenames_, &navigation_info_));
+  navigation_lane_.UpdateNavigationInfo(navigation_info_);
+  EXPECT_TRUE(navigation_lane_.GeneratePath());
+
+  // the paths of the next cycle reuse those of the last one, they are the
+  // same as those of a navigation lane generating them for the first time
+  localization::LocalizationEstimate localization;
+  canbus::Chassis chassis;
+  EXPECT_TRUE(cyber::common::GetProtoFromFile(
+      data_file_dir_ + "localization_info.pb.txt", &localization));
+  EXPECT_TRUE(cyber::common::GetProtoFromFile(
+      data_file_dir_ + "chassis_info.pb.txt", &chassis));
+  auto* position = localization.mutable_pose()->mutable_position();
+  position->set_x(position->x() + 0.5);
+  position->set_y(position->y() + 20.0);
+  VehicleStateProvider::Instance()->Update(localization, chassis);
+  EXPECT_TRUE(navigation_lane_.GeneratePath());
+  MapMsg map_msg;
+  EXPECT_TRUE(navigation_lane_.CreateMap(map_param_, &map_msg));
+
+  RelativeMapConfig config;
+  EXPECT_TRUE(cyber::common::GetProtoFromFile(
+      FLAGS_relative_map_config_filename, &config));
+  NavigationLane navigation_lane(config.navigation_lane());
+  navigation_lane.SetDefaultWidth(map_param_.default_left_width(),
+                                  map_param_.default_right_width());
+  navigation_lane.UpdateNavigationInfo(navigation_info_);
+  EXPECT_TRUE(navigation_lane.GeneratePath());
+  MapMsg expected_map_msg;
+  EXPECT_TRUE(navigation_lane.CreateMap(map_param_, &expected_map_msg));
+
+  EXPECT_EQ(expected_map_msg.hdmap().SerializeAsString(),
+            map_msg.hdmap().SerializeAsString());
+  EXPECT_EQ(navigation_lane.Path().SerializeAsString(),
+            navigation_lane_.Path().SerializeAsString());
+}
+
 }  // namespace relative_map
 }  // namespace apollo
@@ -0,0 +1,331 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/monitor/hardware/process_sampler.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+
+namespace apollo {
+namespace monitor {
+namespace {
+
+// Large enough for /proc/[pid]/status and most command lines, which are
+// truncated otherwise.
+constexpr size_t kBufferSize = 8192;
+constexpr size_t kPathSize = 256;
+
+// Skips the given number of space separated fields.
+const char* SkipFields(const char* p, int num_fields) {
+  for (int i = 0; i < num_fields; ++i) {
+    while (*p == ' ') {
+      ++p;
+    }
+    while (*p != '\0' && *p != ' ') {
+      ++p;
+    }
+  }
+  return p;
+}
+
+// Parses "tid (name) state ppid ... utime stime ..." of a thread stat file,
+// where the name may itself contain spaces and parentheses.
+bool ParseThreadStat(const char* stat, std::string* name,
+                     uint64_t* cpu_ticks) {
+  const char* open = std::strchr(stat, '(');
+  const char* close = std::strrchr(stat, ')');
+  if (open == nullptr || close == nullptr || close < open) {
+    return false;
+  }
+  name->assign(open + 1, close);
+  // The state is field 3, utime field 14 and stime field 15.
+  const char* p = SkipFields(close + 1, 14 - 3);
+  char* end = nullptr;
+  const uint64_t utime = std::strtoull(p, &end, 10);
+  if (end == p) {
+    return false;
+  }
+  const uint64_t stime = std::strtoull(end, nullptr, 10);
+  *cpu_ticks = utime + stime;
+  return true;
+}
+
+// The number after a "key:" line of a status file, 0 if it has none.
+uint64_t StatusValue(const char* status, const char* key) {
+  const char* line = std::strstr(status, key);
+  if (line == nullptr) {
+    return 0;
+  }
+  return std::strtoull(line + std::strlen(key), nullptr, 10);
+}
+
+bool ParsePid(const char* name, pid_t* pid) {
+  char* end = nullptr;
+  const long value = std::strtol(name, &end, 10);  // NOLINT
+  if (end == name || *end != '\0' || value <= 0) {
+    return false;
+  }
+  *pid = static_cast<pid_t>(value);
+  return true;
+}
+
+}  // namespace
+
+ProcessSampler::ProcessSampler(const std::string& proc_root)
+    : proc_root_(proc_root),
+      ticks_per_second_(static_cast<double>(sysconf(_SC_CLK_TCK))),
+      page_size_mb_(static_cast<double>(sysconf(_SC_PAGESIZE)) / (1 << 20)),
+      buffer_(kBufferSize),
+      path_(kPathSize + proc_root.size()) {}
+
+std::string ProcessSampler::ThreadGroup(const std::string& thread_name) {
+  size_t end = thread_name.size();
+  while (end > 0 && std::isdigit(thread_name[end - 1])) {
+    --end;
+  }
+  if (end == 0) {
+    return thread_name;
+  }
+  while (end > 1 && (thread_name[end - 1] == '_' ||
+                     thread_name[end - 1] == '-' ||
+                     thread_name[end - 1] == ' ')) {
+    --end;
+  }
+  return thread_name.substr(0, end);
+}
+
+const char* ProcessSampler::Path(const char* format, ...) {
+  const int offset = std::snprintf(path_.data(), path_.size(), "%s/",
+                                   proc_root_.c_str());
+  va_list args;
+  va_start(args, format);
+  std::vsnprintf(path_.data() + offset, path_.size() - offset, format, args);
+  va_end(args);
+  return path_.data();
+}
+
+int ProcessSampler::ReadFile(const char* path) {
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return -1;
+  }
+  size_t size = 0;
+  while (size + 1 < buffer_.size()) {
+    const ssize_t n =
+        read(fd, buffer_.data() + size, buffer_.size() - 1 - size);
+    if (n <= 0) {
+      break;
+    }
+    size += n;
+  }
+  close(fd);
+  buffer_[size] = '\0';
+  return static_cast<int>(size);
+}
+
+bool ProcessSampler::ReadCommand(pid_t pid) {
+  const int size = ReadFile(Path("%d/cmdline", pid));
+  if (size <= 0) {
+    return false;
+  }
+  // In /proc/<PID>/cmdline, the parts are seperated with \0.
+  std::replace(buffer_.begin(), buffer_.begin() + size, '\0', ' ');
+  return true;
+}
+
+bool ProcessSampler::CommandMatches(
+    const std::vector<std::string>& keywords) const {
+  for (const std::string& keyword : keywords) {
+    if (std::strstr(buffer_.data(), keyword.c_str()) == nullptr) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ProcessSampler::Sample(const double time,
+                            const std::vector<Module>& modules,
+                            ResourceUsage* usage) {
+  // Keep the processes still running their module, and look the others up
+  // in one pass over /proc.
+  std::vector<const Module*> missing;
+  for (const auto& module : modules) {
+    auto& state = processes_[module.first];
+    if (state.pid > 0 &&
+        !(ReadCommand(state.pid) && CommandMatches(module.second))) {
+      state = ProcessState();
+    }
+    if (state.pid <= 0) {
+      missing.push_back(&module);
+    }
+  }
+  if (!missing.empty()) {
+    DIR* dir = opendir(proc_root_.c_str());
+    if (dir != nullptr) {
+      while (!missing.empty()) {
+        const dirent* entry = readdir(dir);
+        if (entry == nullptr) {
+          break;
+        }
+        pid_t pid = 0;
+        if (!ParsePid(entry->d_name, &pid) || !ReadCommand(pid)) {
+          continue;
+        }
+        for (auto iter = missing.begin(); iter != missing.end(); ++iter) {
+          if (CommandMatches((*iter)->second)) {
+            processes_[(*iter)->first].pid = pid;
+            missing.erase(iter);
+            break;
+          }
+        }
+      }
+      closedir(dir);
+    }
+  }
+
+  for (const auto& module : modules) {
+    auto& state = processes_[module.first];
+    if (state.pid <= 0) {
+      continue;
+    }
+    auto* process = usage->add_process();
+    process->set_name(module.first);
+    if (!SampleProcess(time, &state, process)) {
+      // The process exited.
+      usage->mutable_process()->RemoveLast();
+      state = ProcessState();
+    }
+  }
+}
+
+bool ProcessSampler::SampleProcess(const double time, ProcessState* state,
+                                   ProcessResourceUsage* usage) {
+  const pid_t pid = state->pid;
+  usage->set_pid(pid);
+  if (ReadFile(Path("%d/statm", pid)) <= 0) {
+    return false;
+  }
+  // statm: size resident shared ..., in pages
+  const uint64_t resident =
+      std::strtoull(SkipFields(buffer_.data(), 1), nullptr, 10);
+  usage->set_rss_mb(static_cast<double>(resident) * page_size_mb_);
+
+  uint64_t voluntary_context_switches = 0;
+  uint64_t involuntary_context_switches = 0;
+  if (ReadFile(Path("%d/status", pid)) > 0) {
+    voluntary_context_switches =
+        StatusValue(buffer_.data(), "\nvoluntary_ctxt_switches:");
+    involuntary_context_switches =
+        StatusValue(buffer_.data(), "\nnonvoluntary_ctxt_switches:");
+  }
+  const double interval = state->time < 0.0 ? 0.0 : time - state->time;
+  if (interval > 0.0) {
+    usage->set_voluntary_context_switch_rate(
+        static_cast<double>(voluntary_context_switches -
+                            state->voluntary_context_switches) /
+        interval);
+    usage->set_involuntary_context_switch_rate(
+        static_cast<double>(involuntary_context_switches -
+                            state->involuntary_context_switches) /
+        interval);
+  }
+  state->voluntary_context_switches = voluntary_context_switches;
+  state->involuntary_context_switches = involuntary_context_switches;
+  state->time = time;
+
+  DIR* dir = opendir(Path("%d/task", pid));
+  if (dir == nullptr) {
+    return false;
+  }
+  for (auto& thread : state->threads) {
+    thread.second.alive = false;
+  }
+  // ordered by name, so that the groups of a process keep their order
+  std::map<std::string, ThreadGroupUsage*> groups;
+  double cpu_usage = 0.0;
+  double wait_usage = 0.0;
+  std::string name;
+  for (const dirent* entry = readdir(dir); entry != nullptr;
+       entry = readdir(dir)) {
+    pid_t tid = 0;
+    uint64_t cpu_ticks = 0;
+    if (!ParsePid(entry->d_name, &tid) ||
+        ReadFile(Path("%d/task/%d/stat", pid, tid)) <= 0 ||
+        !ParseThreadStat(buffer_.data(), &name, &cpu_ticks)) {
+      continue;
+    }
+    // run time, run queue wait time and time slices, in ns; missing when the
+    // kernel has no schedstats
+    uint64_t wait_ns = 0;
+    if (ReadFile(Path("%d/task/%d/schedstat", pid, tid)) > 0) {
+      wait_ns = std::strtoull(SkipFields(buffer_.data(), 1), nullptr, 10);
+    }
+
+    const auto inserted = state->threads.emplace(tid, ThreadState());
+    ThreadState& thread = inserted.first->second;
+    if (inserted.second || thread.name != name) {
+      thread.name = name;
+      thread.group = ThreadGroup(name);
+    }
+    ThreadGroupUsage*& group = groups[thread.group];
+    if (group == nullptr) {
+      group = usage->add_thread_group();
+      group->set_name(thread.group);
+    }
+    group->set_num_threads(group->num_threads() + 1);
+    if (!inserted.second && interval > 0.0) {
+      const double thread_cpu_usage =
+          static_cast<double>(cpu_ticks - thread.cpu_ticks) /
+          ticks_per_second_ / interval;
+      const double thread_wait_usage =
+          static_cast<double>(wait_ns - thread.wait_ns) * 1e-9 / interval;
+      group->set_cpu_usage(group->cpu_usage() + thread_cpu_usage);
+      group->set_wait_usage(group->wait_usage() + thread_wait_usage);
+      cpu_usage += thread_cpu_usage;
+      wait_usage += thread_wait_usage;
+    }
+    thread.cpu_ticks = cpu_ticks;
+    thread.wait_ns = wait_ns;
+    thread.alive = true;
+  }
+  closedir(dir);
+
+  for (auto iter = state->threads.begin(); iter != state->threads.end();) {
+    if (iter->second.alive) {
+      ++iter;
+    } else {
+      iter = state->threads.erase(iter);
+    }
+  }
+  if (interval > 0.0) {
+    usage->set_cpu_usage(cpu_usage);
+    usage->set_wait_usage(wait_usage);
+  }
+  return true;
+}
+
+}  // namespace monitor
+}  // namespace apollo
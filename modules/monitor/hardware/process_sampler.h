@@ -0,0 +1,100 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#pragma once
+
+#include <sys/types.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "modules/monitor/proto/resource_usage.pb.h"
+
+namespace apollo {
+namespace monitor {
+
+/**
+ * @class ProcessSampler
+ *
+ * @brief Samples the CPU, memory and context switches of the module
+ * processes, and the CPU time and run queue wait of their threads grouped by
+ * thread name, from /proc.
+ *
+ * A sample reads /proc/[pid]/task/[tid]/stat and schedstat of every thread
+ * and /proc/[pid]/statm and status of every process into one reused buffer,
+ * and parses them in place. The process of a module is looked up by its
+ * command line keywords only when the one found before is gone.
+ */
+class ProcessSampler {
+ public:
+  // A module name and the keywords its process command line contains.
+  using Module = std::pair<std::string, std::vector<std::string>>;
+
+  explicit ProcessSampler(const std::string& proc_root = "/proc");
+
+  /**
+   * @brief Samples the running modules. The rates are over the time since
+   * the previous sample of the process, so the first sample of a process only
+   * has its memory.
+   */
+  void Sample(const double time, const std::vector<Module>& modules,
+              ResourceUsage* usage);
+
+  // The name of the group of a thread: its name less a numeric suffix.
+  static std::string ThreadGroup(const std::string& thread_name);
+
+ private:
+  struct ThreadState {
+    std::string name;
+    std::string group;
+    uint64_t cpu_ticks = 0;
+    uint64_t wait_ns = 0;
+    bool alive = false;
+  };
+
+  struct ProcessState {
+    pid_t pid = -1;
+    double time = -1.0;
+    uint64_t voluntary_context_switches = 0;
+    uint64_t involuntary_context_switches = 0;
+    std::unordered_map<pid_t, ThreadState> threads;
+  };
+
+  // Formats a path under proc_root_ into path_.
+  const char* Path(const char* format, ...);
+  // Reads a file into buffer_, returning the number of bytes read or -1.
+  int ReadFile(const char* path);
+  // Reads the command line of a process into buffer_, with its arguments
+  // separated by spaces.
+  bool ReadCommand(pid_t pid);
+  bool CommandMatches(const std::vector<std::string>& keywords) const;
+  bool SampleProcess(const double time, ProcessState* state,
+                     ProcessResourceUsage* usage);
+
+  const std::string proc_root_;
+  const double ticks_per_second_;
+  const double page_size_mb_;
+  std::unordered_map<std::string, ProcessState> processes_;
+  std::vector<char> buffer_;
+  std::vector<char> path_;
+};
+
+}  // namespace monitor
+}  // namespace apollo
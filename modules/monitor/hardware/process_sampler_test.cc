@@ -0,0 +1,137 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/monitor/hardware/process_sampler.h"
+
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "boost/filesystem.hpp"
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace monitor {
+
+class ProcessSamplerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    root_ = boost::filesystem::temp_directory_path() /
+            boost::filesystem::unique_path();
+    boost::filesystem::create_directories(root_ / "100/task/100");
+    boost::filesystem::create_directories(root_ / "100/task/101");
+    boost::filesystem::create_directories(root_ / "200/task/200");
+    Write("100/cmdline", std::string("mainboard\0-d\0planning.dag\0", 27));
+    Write("200/cmdline", std::string("mainboard\0-d\0control.dag\0", 26));
+    Write("100/statm", "1000 256 10 1 0 100 0\n");
+    Write("200/statm", "1000 128 10 1 0 100 0\n");
+    Write("200/task/200/stat", ThreadStat(200, "mainboard", 0, 0));
+  }
+
+  void TearDown() override { boost::filesystem::remove_all(root_); }
+
+  void Write(const std::string& path, const std::string& content) {
+    std::ofstream file((root_ / path).string());
+    file << content;
+  }
+
+  static std::string ThreadStat(int tid, const std::string& name,
+                                int utime, int stime) {
+    return std::to_string(tid) + " (" + name + ") S 1 1 1 0 -1 0 0 0 0 0 " +
+           std::to_string(utime) + " " + std::to_string(stime) +
+           " 0 0 20 0 1 0 0 0 0\n";
+  }
+
+  // Moves the process on by the given ticks and context switches.
+  void Advance(int ticks, int switches) {
+    ticks_ += ticks;
+    switches_ += switches;
+    Write("100/status", "Name:\tmainboard\nvoluntary_ctxt_switches:\t" +
+                            std::to_string(switches_) +
+                            "\nnonvoluntary_ctxt_switches:\t" +
+                            std::to_string(2 * switches_) + "\n");
+    Write("100/task/100/stat", ThreadStat(100, "mainboard", ticks_, 0));
+    Write("100/task/101/stat",
+          ThreadStat(101, "processor_1", ticks_, ticks_));
+    Write("100/task/101/schedstat",
+          std::to_string(ticks_) + " " + std::to_string(ticks_ * 1000000) +
+              " 1\n");
+  }
+
+  boost::filesystem::path root_;
+  int ticks_ = 0;
+  int switches_ = 0;
+};
+
+TEST_F(ProcessSamplerTest, ThreadGroup) {
+  EXPECT_EQ("processor", ProcessSampler::ThreadGroup("processor_12"));
+  EXPECT_EQ("worker", ProcessSampler::ThreadGroup("worker-3"));
+  EXPECT_EQ("mainboard", ProcessSampler::ThreadGroup("mainboard"));
+  EXPECT_EQ("1234", ProcessSampler::ThreadGroup("1234"));
+}
+
+TEST_F(ProcessSamplerTest, Sample) {
+  const double ticks_per_second = static_cast<double>(sysconf(_SC_CLK_TCK));
+  ProcessSampler sampler(root_.string());
+  const std::vector<ProcessSampler::Module> modules = {
+      {"Planning", {"mainboard", "planning.dag"}},
+      {"Control", {"mainboard", "control.dag"}},
+      {"Routing", {"mainboard", "routing.dag"}}};
+
+  Advance(0, 0);
+  ResourceUsage usage;
+  sampler.Sample(10.0, modules, &usage);
+  ASSERT_EQ(2, usage.process_size());
+  EXPECT_EQ("Planning", usage.process(0).name());
+  EXPECT_EQ(100, usage.process(0).pid());
+  EXPECT_FALSE(usage.process(0).has_cpu_usage());
+  EXPECT_EQ("Control", usage.process(1).name());
+  EXPECT_EQ(200, usage.process(1).pid());
+  EXPECT_DOUBLE_EQ(
+      128.0 * static_cast<double>(sysconf(_SC_PAGESIZE)) / (1 << 20),
+      usage.process(1).rss_mb());
+
+  Advance(static_cast<int>(ticks_per_second), 10);
+  usage.Clear();
+  sampler.Sample(12.0, modules, &usage);
+  ASSERT_EQ(2, usage.process_size());
+  const auto& planning = usage.process(0);
+  // one second of mainboard time and two of processor time in two seconds
+  EXPECT_NEAR(1.5, planning.cpu_usage(), 1e-9);
+  EXPECT_NEAR(5.0, planning.voluntary_context_switch_rate(), 1e-9);
+  EXPECT_NEAR(10.0, planning.involuntary_context_switch_rate(), 1e-9);
+  ASSERT_EQ(2, planning.thread_group_size());
+  EXPECT_EQ("mainboard", planning.thread_group(0).name());
+  EXPECT_NEAR(0.5, planning.thread_group(0).cpu_usage(), 1e-9);
+  EXPECT_EQ("processor", planning.thread_group(1).name());
+  EXPECT_EQ(1, planning.thread_group(1).num_threads());
+  EXPECT_NEAR(1.0, planning.thread_group(1).cpu_usage(), 1e-9);
+  EXPECT_NEAR(ticks_per_second * 1e-3 / 2.0,
+              planning.thread_group(1).wait_usage(), 1e-9);
+
+  // A process that exits is looked up again.
+  boost::filesystem::remove_all(root_ / "200");
+  usage.Clear();
+  sampler.Sample(14.0, modules, &usage);
+  ASSERT_EQ(1, usage.process_size());
+  EXPECT_EQ("Planning", usage.process(0).name());
+}
+
+}  // namespace monitor
+}  // namespace apollo
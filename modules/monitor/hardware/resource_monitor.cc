@@ -17,13 +17,16 @@
 #include "modules/monitor/hardware/resource_monitor.h"
 
 #include <string>
+#include <vector>
 
 #include "boost/filesystem.hpp"
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
 #include "gflags/gflags.h"
 
+#include "modules/common/adapters/adapter_gflags.h"
 #include "modules/common/util/map_util.h"
+#include "modules/common/util/message_util.h"
 #include "modules/common/util/string_util.h"
 #include "modules/monitor/common/monitor_manager.h"
 #include "modules/monitor/software/summary_monitor.h"
@@ -34,6 +37,10 @@ DEFINE_string(resource_monitor_name, "ResourceMonitor",
 DEFINE_double(resource_monitor_interval, 5,
               "Topic status checking interval (s).");
 
+DEFINE_bool(resource_monitor_sample_processes, true,
+            "Whether to publish the CPU, memory and context switches of the "
+            "module processes and their threads at every check.");
+
 namespace apollo {
 namespace monitor {
 
@@ -42,6 +49,11 @@ using apollo::common::util::StrCat;
 ResourceMonitor::ResourceMonitor()
     : RecurrentRunner(FLAGS_resource_monitor_name,
                       FLAGS_resource_monitor_interval) {
+  if (FLAGS_resource_monitor_sample_processes) {
+    resource_usage_writer_ =
+        MonitorManager::Instance()->CreateWriter<ResourceUsage>(
+            FLAGS_resource_usage_topic);
+  }
 }
 
 void ResourceMonitor::RunOnce(const double current_time) {
@@ -56,6 +68,32 @@ void ResourceMonitor::RunOnce(const double current_time) {
                    components->at(name).mutable_resource_status());
     }
   }
+
+  if (resource_usage_writer_ != nullptr) {
+    SampleProcesses(current_time);
+  }
+}
+
+void ResourceMonitor::SampleProcesses(const double current_time) {
+  const auto& mode = MonitorManager::Instance()->GetHMIMode();
+  std::vector<ProcessSampler::Module> modules;
+  for (const auto& iter : mode.modules()) {
+    const auto& keywords =
+        iter.second.process_monitor_config().command_keywords();
+    if (!keywords.empty()) {
+      modules.emplace_back(iter.first, std::vector<std::string>(
+                                           keywords.begin(), keywords.end()));
+    }
+  }
+
+  ResourceUsage usage;
+  process_sampler_.Sample(current_time, modules, &usage);
+  if (last_sample_time_ >= 0.0) {
+    usage.set_interval_sec(current_time - last_sample_time_);
+  }
+  last_sample_time_ = current_time;
+  apollo::common::util::FillHeader(FLAGS_resource_monitor_name, &usage);
+  resource_usage_writer_->Write(usage);
 }
 
 void ResourceMonitor::UpdateStatus(
@@ -15,8 +15,13 @@
  *****************************************************************************/
 #pragma once
 
+#include <memory>
+
+#include "cyber/cyber.h"
 #include "modules/dreamview/proto/hmi_mode.pb.h"
 #include "modules/monitor/common/recurrent_runner.h"
+#include "modules/monitor/hardware/process_sampler.h"
+#include "modules/monitor/proto/resource_usage.pb.h"
 #include "modules/monitor/proto/system_status.pb.h"
 
 namespace apollo {
@@ -31,6 +36,13 @@ class ResourceMonitor : public RecurrentRunner {
   static void UpdateStatus(
       const apollo::dreamview::ResourceMonitorConfig& config,
       ComponentStatus* status);
+
+  // Publishes the resources used by the processes of the HMI modules.
+  void SampleProcesses(const double current_time);
+
+  ProcessSampler process_sampler_;
+  double last_sample_time_ = -1.0;
+  std::shared_ptr<cyber::Writer<ResourceUsage>> resource_usage_writer_;
 };
 
 }  // namespace monitor
@@ -16,11 +16,14 @@
 
 #include "modules/monitor/software/channel_monitor.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
+#include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/cyber.h"
+#include "cyber/transport/shm/channel_stats_table.h"
 #include "modules/common/adapters/adapter_gflags.h"
 #include "modules/common/util/map_util.h"
 #include "modules/common/util/string_util.h"
@@ -41,10 +44,19 @@ DEFINE_string(channel_monitor_name, "ChannelMonitor",
 DEFINE_double(channel_monitor_interval, 5,
               "Channel monitor checking interval in seconds.");
 
+DEFINE_bool(channel_monitor_use_stats_table, true,
+            "Whether to read the delay of the channels from the writer "
+            "statistics in shared memory instead of subscribing to them. "
+            "Only channels written on this host are seen this way.");
+
 namespace apollo {
 namespace monitor {
 namespace {
 using apollo::common::util::StrCat;
+using apollo::cyber::Time;
+using apollo::cyber::common::GlobalData;
+using apollo::cyber::transport::ChannelStats;
+using apollo::cyber::transport::ChannelStatsTable;
 
 // We have to specify exact type of each channel. This function is a wrapper for
 // those only need a ReaderBase.
@@ -73,6 +85,25 @@ std::shared_ptr<cyber::ReaderBase> GetReader(const std::string& channel) {
   return nullptr;
 }
 
+// The delay as Reader::GetDelaySec computes it, from the statistics the
+// writers of the channel keep, without receiving its messages.
+double GetDelaySec(const std::string& channel) {
+  const auto* table = ChannelStatsTable::Instance();
+  if (!FLAGS_channel_monitor_use_stats_table || !table->enabled()) {
+    return GetReader(channel)->GetDelaySec();
+  }
+  ChannelStats stats;
+  if (!table->GetStats(GlobalData::RegisterChannel(channel), &stats) ||
+      stats.num_messages == 0) {
+    return -1.0;
+  }
+  const double since_last_publish =
+      Time::Now().ToSecond() -
+      static_cast<double>(stats.last_publish_time) * 1e-9;
+  return std::max(since_last_publish,
+                  static_cast<double>(stats.mean_interval) * 1e-9);
+}
+
 }  // namespace
 
 ChannelMonitor::ChannelMonitor()
@@ -98,7 +129,7 @@ void ChannelMonitor::UpdateStatus(
     const apollo::dreamview::ChannelMonitorConfig& config,
     ComponentStatus* status) {
   status->clear_status();
-  const double delay = GetReader(config.name())->GetDelaySec();
+  const double delay = GetDelaySec(config.name());
   if (delay < 0 || delay > config.delay_fatal()) {
     SummaryMonitor::EscalateStatus(
         ComponentStatus::FATAL,
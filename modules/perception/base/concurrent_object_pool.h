@@ -24,7 +24,11 @@
 
 #include "modules/perception/base/object_pool.h"
 
+// @brief the pools hand out plain heap objects unless the build defines
+// PERCEPTION_BASE_ENABLE_POOL, see the perception_pool config in bazel.rc
+#ifndef PERCEPTION_BASE_ENABLE_POOL
 #define PERCEPTION_BASE_DISABLE_POOL
+#endif
 namespace apollo {
 namespace perception {
 namespace base {
@@ -44,13 +48,17 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
  public:
   // using ObjectTypePtr = typename BaseObjectPool<ObjectType>::ObjectTypePtr;
   using BaseObjectPool<ObjectType>::capacity_;
-  // @brief Only allow accessing from global instance
+  using BaseObjectPool<ObjectType>::get_num_;
+  using BaseObjectPool<ObjectType>::alloc_num_;
+  // @brief Only allow accessing from global instance, it is never destroyed
+  // so that objects released at exit can still be returned to it
   static ConcurrentObjectPool& Instance() {
-    static ConcurrentObjectPool pool(N);
-    return pool;
+    static ConcurrentObjectPool* pool = new ConcurrentObjectPool(N);
+    return *pool;
   }
   // @brief overrided function to get object smart pointer
   std::shared_ptr<ObjectType> Get() override {
+    ++get_num_;
 // TODO(All): remove conditional build
 #ifndef PERCEPTION_BASE_DISABLE_POOL
     ObjectType* ptr = nullptr;
@@ -70,6 +78,7 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
       queue_.push(obj_ptr);
     });
 #else
+    ++alloc_num_;
     return std::shared_ptr<ObjectType>(new ObjectType);
 #endif
   }
@@ -78,6 +87,7 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
   // @params[OUT] data: vector container to store the pointers
   void BatchGet(size_t num,
                 std::vector<std::shared_ptr<ObjectType>>* data) override {
+    get_num_ += num;
 #ifndef PERCEPTION_BASE_DISABLE_POOL
     std::vector<ObjectType*> buffer(num, nullptr);
     {
@@ -101,6 +111,7 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
           }));
     }
 #else
+    alloc_num_ += num;
     for (size_t i = 0; i < num; ++i) {
       data->emplace_back(std::shared_ptr<ObjectType>(new ObjectType));
     }
@@ -112,6 +123,7 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
   // @params[OUT] data: list container to store the pointers
   void BatchGet(size_t num, bool is_front,
                 std::list<std::shared_ptr<ObjectType>>* data) override {
+    get_num_ += num;
 #ifndef PERCEPTION_BASE_DISABLE_POOL
     std::vector<ObjectType*> buffer(num, nullptr);
     {
@@ -142,6 +154,7 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
                 }));
     }
 #else
+    alloc_num_ += num;
     for (size_t i = 0; i < num; ++i) {
       is_front
           ? data->emplace_front(std::shared_ptr<ObjectType>(new ObjectType))
@@ -155,6 +168,7 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
   // @params[OUT] data: deque container to store the pointers
   void BatchGet(size_t num, bool is_front,
                 std::deque<std::shared_ptr<ObjectType>>* data) override {
+    get_num_ += num;
 #ifndef PERCEPTION_BASE_DISABLE_POOL
     std::vector<ObjectType*> buffer(num, nullptr);
     {
@@ -183,6 +197,7 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
                 }));
     }
 #else
+    alloc_num_ += num;
     for (size_t i = 0; i < num; ++i) {
       is_front
           ? data->emplace_front(std::shared_ptr<ObjectType>(new ObjectType))
@@ -217,6 +232,7 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
 // @brief add num objects, should add lock before invoke this function
 #ifndef PERCEPTION_BASE_DISABLE_POOL
   void Add(size_t num) {
+    alloc_num_ += num;
     for (size_t i = 0; i < num; ++i) {
       ObjectType* ptr = new ObjectType;
       extended_cache_.push_back(ptr);
@@ -243,7 +259,7 @@ class ConcurrentObjectPool : public BaseObjectPool<ObjectType> {
   const size_t kDefaultCacheSize;
   // @brief list to store extended memory, not as efficient
   std::list<ObjectType*> extended_cache_;
-  static const Initializer kInitializer;
+  Initializer kInitializer;
 };
 
 }  // namespace base
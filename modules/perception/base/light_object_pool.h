@@ -39,6 +39,8 @@ template <class ObjectType, size_t N = kPoolDefaultSize,
 class LightObjectPool : public BaseObjectPool<ObjectType> {
  public:
   using BaseObjectPool<ObjectType>::capacity_;
+  using BaseObjectPool<ObjectType>::get_num_;
+  using BaseObjectPool<ObjectType>::alloc_num_;
 
   // @brief Only allow accessing from global instance
   static LightObjectPool& Instance(
@@ -56,6 +58,7 @@ class LightObjectPool : public BaseObjectPool<ObjectType> {
 
   // @brief overrided function to get object smart pointer
   std::shared_ptr<ObjectType> Get() override {
+    ++get_num_;
     ObjectType* ptr = nullptr;
     if (queue_.empty()) {
       Add(1 + kPoolDefaultExtendNum);
@@ -72,6 +75,7 @@ class LightObjectPool : public BaseObjectPool<ObjectType> {
   // @params[OUT] data: vector container to store the pointers
   void BatchGet(size_t num,
                 std::vector<std::shared_ptr<ObjectType>>* data) override {
+    get_num_ += num;
     if (queue_.size() < num) {
       Add(num - queue_.size() + kPoolDefaultExtendNum);
     }
@@ -91,6 +95,7 @@ class LightObjectPool : public BaseObjectPool<ObjectType> {
   // @params[OUT] data: list container to store the pointers
   void BatchGet(size_t num, bool is_front,
                 std::list<std::shared_ptr<ObjectType>>* data) override {
+    get_num_ += num;
     std::vector<ObjectType*> buffer(num, nullptr);
     if (queue_.size() < num) {
       Add(num - queue_.size() + kPoolDefaultExtendNum);
@@ -115,6 +120,7 @@ class LightObjectPool : public BaseObjectPool<ObjectType> {
   // @params[OUT] data: deque container to store the pointers
   void BatchGet(size_t num, bool is_front,
                 std::deque<std::shared_ptr<ObjectType>>* data) override {
+    get_num_ += num;
     std::vector<ObjectType*> buffer(num, nullptr);
     if (queue_.size() < num) {
       Add(num - queue_.size() + kPoolDefaultExtendNum);
@@ -157,6 +163,7 @@ class LightObjectPool : public BaseObjectPool<ObjectType> {
  protected:
   // @brief add num objects, should add lock before invoke this function
   void Add(size_t num) {
+    alloc_num_ += num;
     for (size_t i = 0; i < num; ++i) {
       ObjectType* ptr = new ObjectType;
       extended_cache_.push_back(ptr);
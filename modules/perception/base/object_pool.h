@@ -15,6 +15,7 @@
  *****************************************************************************/
 #pragma once
 
+#include <atomic>
 #include <deque>
 #include <list>
 #include <memory>
@@ -59,11 +60,18 @@ class BaseObjectPool {
   size_t get_capacity() { return capacity_; }
   // @brief get remained object number
   virtual size_t RemainedNum() { return 0; }
+  // @brief number of objects handed out since construction
+  size_t get_num() const { return get_num_; }
+  // @brief number of objects allocated after construction, it stops
+  // growing once the pool covers the steady state
+  size_t alloc_num() const { return alloc_num_; }
 
  protected:
   BaseObjectPool(const BaseObjectPool& rhs) = delete;
   BaseObjectPool& operator=(const BaseObjectPool& rhs) = delete;
   size_t capacity_ = 0;
+  std::atomic<size_t> get_num_{0};
+  std::atomic<size_t> alloc_num_{0};
 };  // class BaseObjectPool
 
 // @brief dummy object pool implementation, not managing memory
@@ -110,6 +110,28 @@ TEST(ObjectPoolTest, concurrent_object_pool_get_test) {
 #endif
 }
 
+TEST(ObjectPoolTest, concurrent_object_pool_statistics_test) {
+  typedef ConcurrentObjectPool<Object, 10> TestObjectPool;
+  auto& instance = TestObjectPool::Instance();
+  {
+    std::vector<std::shared_ptr<Object>> objects;
+    instance.BatchGet(5, &objects);
+    objects.push_back(instance.Get());
+  }
+  EXPECT_EQ(instance.get_num(), 6);
+#ifndef PERCEPTION_BASE_DISABLE_POOL
+  // released objects are reused, steady frames do not allocate
+  size_t alloc_num = instance.alloc_num();
+  for (int frame = 0; frame < 3; ++frame) {
+    std::vector<std::shared_ptr<Object>> objects;
+    instance.BatchGet(8, &objects);
+  }
+  EXPECT_EQ(instance.alloc_num(), alloc_num);
+#else
+  EXPECT_EQ(instance.alloc_num(), 6);
+#endif
+}
+
 TEST(ObjectPoolTest, concurrent_object_pool_batch_get_vec_test) {
   typedef ConcurrentObjectPool<Object> TestObjectPool;
   auto& instance = TestObjectPool::Instance();
@@ -0,0 +1,186 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "modules/perception/base/blob.h"
+#include "modules/perception/base/point_cloud.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+// @brief Point cloud storing x, y, z and intensity in separate columns
+// for vectorized traversing. The columns are the rows of one blob of shape
+// {kNumColumns, capacity}, so that gpu kernels can use the same memory
+// without repacking the points.
+template <typename T>
+class SoAPointCloud {
+ public:
+  enum Column { X = 0, Y = 1, Z = 2, INTENSITY = 3 };
+  static constexpr int kNumColumns = 4;
+  // @brief the capacity is a multiple of this number of elements, so that
+  // every column starts at the same alignment as the blob memory
+  static constexpr size_t kColumnAlignment = 64 / sizeof(T);
+
+  // @brief default constructor, the memory is page-locked when
+  // use_cuda_host_malloc is set
+  explicit SoAPointCloud(bool use_cuda_host_malloc = false)
+      : use_cuda_host_malloc_(use_cuda_host_malloc) {}
+  SoAPointCloud(const SoAPointCloud&) = delete;
+  SoAPointCloud& operator=(const SoAPointCloud&) = delete;
+
+  // @brief accessor of point size
+  inline size_t size() const { return size_; }
+  // @brief accessor of the allocated size of each column
+  inline size_t capacity() const { return capacity_; }
+  inline bool empty() const { return size_ == 0; }
+  // @brief reserve memory for size points, keep the current points
+  void reserve(size_t size) {
+    if (size <= capacity_) {
+      return;
+    }
+    const size_t capacity =
+        (size + kColumnAlignment - 1) / kColumnAlignment * kColumnAlignment;
+    std::shared_ptr<Blob<T>> blob(new Blob<T>(
+        {kNumColumns, static_cast<int>(capacity)}, use_cuda_host_malloc_));
+    if (size_ > 0) {
+      for (int c = 0; c < kNumColumns; ++c) {
+        memcpy(blob->mutable_cpu_data() + c * capacity, column(c),
+               size_ * sizeof(T));
+      }
+    }
+    blob_ = blob;
+    capacity_ = capacity;
+  }
+  // @brief resize the columns, new points are zero
+  void resize(size_t size) {
+    reserve(size);
+    if (size > size_) {
+      for (int c = 0; c < kNumColumns; ++c) {
+        std::fill(mutable_column(c) + size_, mutable_column(c) + size, T(0));
+      }
+    }
+    size_ = size;
+  }
+  inline void clear() { size_ = 0; }
+  // @brief append one point
+  template <typename PointT>
+  void push_back(const PointT& point) {
+    if (size_ == capacity_) {
+      reserve(std::max(size_ * 2, kColumnAlignment));
+    }
+    T* data = blob_->mutable_cpu_data();
+    data[X * capacity_ + size_] = static_cast<T>(point.x);
+    data[Y * capacity_ + size_] = static_cast<T>(point.y);
+    data[Z * capacity_ + size_] = static_cast<T>(point.z);
+    data[INTENSITY * capacity_ + size_] = static_cast<T>(point.intensity);
+    ++size_;
+  }
+
+  // @brief column accessors, nullptr before any memory is reserved
+  inline const T* column(int c) const {
+    return blob_ ? blob_->cpu_data() + c * capacity_ : nullptr;
+  }
+  inline T* mutable_column(int c) {
+    return blob_ ? blob_->mutable_cpu_data() + c * capacity_ : nullptr;
+  }
+  inline const T* x() const { return column(X); }
+  inline const T* y() const { return column(Y); }
+  inline const T* z() const { return column(Z); }
+  inline const T* intensity() const { return column(INTENSITY); }
+  inline T* mutable_x() { return mutable_column(X); }
+  inline T* mutable_y() { return mutable_column(Y); }
+  inline T* mutable_z() { return mutable_column(Z); }
+  inline T* mutable_intensity() { return mutable_column(INTENSITY); }
+
+  // @brief the blob holding the columns, its shape is
+  // {kNumColumns, capacity()} and only the first size() elements of each
+  // row are valid. Writing to it through the gpu changes this cloud.
+  inline const std::shared_ptr<Blob<T>>& blob() const { return blob_; }
+
+  // @brief copy the points of an array-of-structures cloud
+  template <typename PointT>
+  void CopyFrom(const PointCloud<PointT>& cloud) {
+    resize(cloud.size());
+    T* xs = mutable_x();
+    T* ys = mutable_y();
+    T* zs = mutable_z();
+    T* is = mutable_intensity();
+    for (size_t i = 0; i < cloud.size(); ++i) {
+      const PointT& point = cloud[i];
+      xs[i] = static_cast<T>(point.x);
+      ys[i] = static_cast<T>(point.y);
+      zs[i] = static_cast<T>(point.z);
+      is[i] = static_cast<T>(point.intensity);
+    }
+  }
+  // @brief copy the points to an array-of-structures cloud, the other
+  // attributes of the output points are left at their defaults
+  template <typename PointT>
+  void CopyTo(PointCloud<PointT>* cloud) const {
+    cloud->resize(size_);
+    const T* xs = x();
+    const T* ys = y();
+    const T* zs = z();
+    const T* is = intensity();
+    for (size_t i = 0; i < size_; ++i) {
+      PointT& point = cloud->at(i);
+      point.x = static_cast<typename PointT::Type>(xs[i]);
+      point.y = static_cast<typename PointT::Type>(ys[i]);
+      point.z = static_cast<typename PointT::Type>(zs[i]);
+      point.intensity = static_cast<typename PointT::Type>(is[i]);
+    }
+  }
+
+  // @brief transform x, y, z of all points in place, the loop is written
+  // so that it can be vectorized over the columns
+  void Transform(const Eigen::Affine3d& pose) {
+    const Eigen::Matrix<T, 3, 4> m = pose.matrix().topRows<3>().cast<T>();
+    T* __restrict__ xs = mutable_x();
+    T* __restrict__ ys = mutable_y();
+    T* __restrict__ zs = mutable_z();
+    for (size_t i = 0; i < size_; ++i) {
+      const T px = xs[i];
+      const T py = ys[i];
+      const T pz = zs[i];
+      xs[i] = m(0, 0) * px + m(0, 1) * py + m(0, 2) * pz + m(0, 3);
+      ys[i] = m(1, 0) * px + m(1, 1) * py + m(1, 2) * pz + m(1, 3);
+      zs[i] = m(2, 0) * px + m(2, 1) * py + m(2, 2) * pz + m(2, 3);
+    }
+  }
+
+ private:
+  std::shared_ptr<Blob<T>> blob_;
+  size_t size_ = 0;
+  size_t capacity_ = 0;
+  bool use_cuda_host_malloc_ = false;
+};
+
+template <typename T>
+constexpr int SoAPointCloud<T>::kNumColumns;
+template <typename T>
+constexpr size_t SoAPointCloud<T>::kColumnAlignment;
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,106 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/perception/base/soa_point_cloud.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+TEST(SoAPointCloudTest, copy_test) {
+  PointCloud<PointF> cloud;
+  for (int i = 0; i < 100; ++i) {
+    PointF point;
+    point.x = static_cast<float>(i);
+    point.y = static_cast<float>(2 * i);
+    point.z = static_cast<float>(3 * i);
+    point.intensity = static_cast<float>(i % 7);
+    cloud.push_back(point);
+  }
+
+  SoAPointCloud<float> soa_cloud;
+  EXPECT_TRUE(soa_cloud.empty());
+  soa_cloud.CopyFrom(cloud);
+  EXPECT_EQ(soa_cloud.size(), 100);
+  EXPECT_EQ(soa_cloud.capacity() % SoAPointCloud<float>::kColumnAlignment, 0);
+  EXPECT_EQ(soa_cloud.blob()->shape(0), SoAPointCloud<float>::kNumColumns);
+  EXPECT_EQ(soa_cloud.blob()->shape(1), soa_cloud.capacity());
+  EXPECT_EQ(soa_cloud.y() - soa_cloud.x(), soa_cloud.capacity());
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(soa_cloud.x()[i], cloud[i].x);
+    EXPECT_EQ(soa_cloud.y()[i], cloud[i].y);
+    EXPECT_EQ(soa_cloud.z()[i], cloud[i].z);
+    EXPECT_EQ(soa_cloud.intensity()[i], cloud[i].intensity);
+  }
+
+  PointCloud<PointD> out_cloud;
+  soa_cloud.CopyTo(&out_cloud);
+  EXPECT_EQ(out_cloud.size(), 100);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(out_cloud[i].x, cloud[i].x);
+    EXPECT_EQ(out_cloud[i].intensity, cloud[i].intensity);
+  }
+}
+
+TEST(SoAPointCloudTest, push_back_test) {
+  SoAPointCloud<float> soa_cloud;
+  PointF point;
+  for (int i = 0; i < 1000; ++i) {
+    point.x = static_cast<float>(i);
+    point.intensity = 1.f;
+    soa_cloud.push_back(point);
+  }
+  EXPECT_EQ(soa_cloud.size(), 1000);
+  EXPECT_GE(soa_cloud.capacity(), 1000);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(soa_cloud.x()[i], static_cast<float>(i));
+    EXPECT_EQ(soa_cloud.intensity()[i], 1.f);
+  }
+
+  soa_cloud.resize(1010);
+  EXPECT_EQ(soa_cloud.x()[999], 999.f);
+  EXPECT_EQ(soa_cloud.x()[1005], 0.f);
+  soa_cloud.clear();
+  EXPECT_TRUE(soa_cloud.empty());
+}
+
+TEST(SoAPointCloudTest, transform_test) {
+  PointCloud<PointF> cloud;
+  PointF point;
+  point.x = 1.f;
+  point.y = 2.f;
+  point.z = 3.f;
+  cloud.push_back(point);
+  Eigen::Affine3d pose = Eigen::Affine3d::Identity();
+  pose.linear() =
+      Eigen::AngleAxisd(M_PI / 2, Eigen::Vector3d::UnitZ()).toRotationMatrix();
+  pose.translation() = Eigen::Vector3d(10.0, 20.0, 30.0);
+
+  SoAPointCloud<float> soa_cloud;
+  soa_cloud.CopyFrom(cloud);
+  soa_cloud.Transform(pose);
+  cloud.set_sensor_to_world_pose(pose);
+  cloud.TransformPointCloud();
+  EXPECT_NEAR(soa_cloud.x()[0], cloud[0].x, 1e-5);
+  EXPECT_NEAR(soa_cloud.y()[0], cloud[0].y, 1e-5);
+  EXPECT_NEAR(soa_cloud.z()[0], cloud[0].z, 1e-5);
+}
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
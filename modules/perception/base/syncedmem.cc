@@ -62,10 +62,113 @@ license and copyright terms herein.
  *****************************************************************************/
 #include "modules/perception/base/syncedmem.h"
 
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 namespace apollo {
 namespace perception {
 namespace base {
 
+#ifndef PERCEPTION_CPU_ONLY
+namespace {
+
+// bytes of freed blocks kept for reuse, beyond them blocks are freed
+constexpr size_t kMaxCachedDeviceBytes = 256 << 20;
+// sizes are rounded up to it, so that blobs of nearly the same size
+// share their blocks
+constexpr size_t kDeviceBlockAlignment = 512;
+
+class DeviceMemoryPool {
+ public:
+  static DeviceMemoryPool* Instance() {
+    static DeviceMemoryPool pool;
+    return &pool;
+  }
+
+  void Malloc(void** ptr, size_t size) {
+    const Key key(CurrentDevice(), RoundUp(size));
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto iter = blocks_.find(key);
+      if (iter != blocks_.end() && !iter->second.empty()) {
+        *ptr = iter->second.back();
+        iter->second.pop_back();
+        cached_bytes_ -= key.second;
+        return;
+      }
+    }
+    BASE_CUDA_CHECK(cudaMalloc(ptr, key.second));
+  }
+
+  void Free(void* ptr, size_t size) {
+    // the block goes back to its own device, not to the current one
+    cudaPointerAttributes attributes;
+    BASE_CUDA_CHECK(cudaPointerGetAttributes(&attributes, ptr));
+    const Key key(attributes.device, RoundUp(size));
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (cached_bytes_ + key.second <= kMaxCachedDeviceBytes) {
+        blocks_[key].push_back(ptr);
+        cached_bytes_ += key.second;
+        return;
+      }
+    }
+    BASE_CUDA_CHECK(cudaFree(ptr));
+  }
+
+  void Release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int current_device = 0;
+    BASE_CUDA_CHECK(cudaGetDevice(&current_device));
+    for (auto& blocks : blocks_) {
+      BASE_CUDA_CHECK(cudaSetDevice(blocks.first.first));
+      for (void* ptr : blocks.second) {
+        BASE_CUDA_CHECK(cudaFree(ptr));
+      }
+    }
+    BASE_CUDA_CHECK(cudaSetDevice(current_device));
+    blocks_.clear();
+    cached_bytes_ = 0;
+  }
+
+ private:
+  // device and rounded size of a block
+  using Key = std::pair<int, size_t>;
+
+  DeviceMemoryPool() = default;
+
+  static int CurrentDevice() {
+    int device = 0;
+    BASE_CUDA_CHECK(cudaGetDevice(&device));
+    return device;
+  }
+
+  static size_t RoundUp(size_t size) {
+    return (size + kDeviceBlockAlignment - 1) / kDeviceBlockAlignment *
+           kDeviceBlockAlignment;
+  }
+
+  std::mutex mutex_;
+  std::map<Key, std::vector<void*>> blocks_;
+  size_t cached_bytes_ = 0;
+};
+
+}  // namespace
+
+void PerceptionMallocDevice(void** ptr, size_t size) {
+  DeviceMemoryPool::Instance()->Malloc(ptr, size);
+}
+
+void PerceptionFreeDevice(void* ptr, size_t size) {
+  DeviceMemoryPool::Instance()->Free(ptr, size);
+}
+
+void PerceptionReleaseDeviceCache() { DeviceMemoryPool::Instance()->Release(); }
+#endif
+
 SyncedMemory::SyncedMemory(bool use_cuda)
     : cpu_ptr_(NULL),
       gpu_ptr_(NULL),
@@ -100,19 +203,33 @@ SyncedMemory::SyncedMemory(size_t size, bool use_cuda)
 
 SyncedMemory::~SyncedMemory() {
   check_device();
+  wait_copy();
   if (cpu_ptr_ && own_cpu_data_) {
     PerceptionFreeHost(cpu_ptr_, cpu_malloc_use_cuda_);
   }
 
 #ifndef PERCEPTION_CPU_ONLY
   if (gpu_ptr_ && own_gpu_data_) {
-    BASE_CUDA_CHECK(cudaFree(gpu_ptr_));
+    PerceptionFreeDevice(gpu_ptr_, size_);
+  }
+  if (copy_event_ != nullptr) {
+    BASE_CUDA_CHECK(cudaEventDestroy(copy_event_));
   }
 #endif  // PERCEPTION_CPU_ONLY
 }
 
+inline void SyncedMemory::wait_copy() {
+#ifndef PERCEPTION_CPU_ONLY
+  if (copy_pending_) {
+    BASE_CUDA_CHECK(cudaEventSynchronize(copy_event_));
+    copy_pending_ = false;
+  }
+#endif
+}
+
 inline void SyncedMemory::to_cpu() {
   check_device();
+  wait_copy();
   switch (head_) {
     case UNINITIALIZED:
       PerceptionMallocHost(&cpu_ptr_, size_, cpu_malloc_use_cuda_);
@@ -141,16 +258,17 @@ inline void SyncedMemory::to_cpu() {
 inline void SyncedMemory::to_gpu() {
   check_device();
 #ifndef PERCEPTION_CPU_ONLY
+  wait_copy();
   switch (head_) {
     case UNINITIALIZED:
-      BASE_CUDA_CHECK(cudaMalloc(&gpu_ptr_, size_));
+      PerceptionMallocDevice(&gpu_ptr_, size_);
       BASE_CUDA_CHECK(cudaMemset(gpu_ptr_, 0, size_));
       head_ = HEAD_AT_GPU;
       own_gpu_data_ = true;
       break;
     case HEAD_AT_CPU:
       if (gpu_ptr_ == nullptr) {
-        BASE_CUDA_CHECK(cudaMalloc(&gpu_ptr_, size_));
+        PerceptionMallocDevice(&gpu_ptr_, size_);
         own_gpu_data_ = true;
       }
       BASE_CUDA_CHECK(cudaMemcpy(gpu_ptr_, cpu_ptr_, size_, cudaMemcpyDefault));
@@ -174,6 +292,7 @@ const void* SyncedMemory::cpu_data() {
 void SyncedMemory::set_cpu_data(void* data) {
   check_device();
   CHECK(data);
+  wait_copy();
   if (own_cpu_data_) {
     PerceptionFreeHost(cpu_ptr_, cpu_malloc_use_cuda_);
   }
@@ -197,8 +316,9 @@ void SyncedMemory::set_gpu_data(void* data) {
   check_device();
 #ifndef PERCEPTION_CPU_ONLY
   CHECK(data);
+  wait_copy();
   if (own_gpu_data_) {
-    BASE_CUDA_CHECK(cudaFree(gpu_ptr_));
+    PerceptionFreeDevice(gpu_ptr_, size_);
   }
   gpu_ptr_ = data;
   head_ = HEAD_AT_GPU;
@@ -231,15 +351,39 @@ void* SyncedMemory::mutable_gpu_data() {
 void SyncedMemory::async_gpu_push(const cudaStream_t& stream) {
   check_device();
   CHECK_EQ(head_, HEAD_AT_CPU);
+  wait_copy();
   if (gpu_ptr_ == nullptr) {
-    BASE_CUDA_CHECK(cudaMalloc(&gpu_ptr_, size_));
+    PerceptionMallocDevice(&gpu_ptr_, size_);
     own_gpu_data_ = true;
   }
   const cudaMemcpyKind put = cudaMemcpyHostToDevice;
   BASE_CUDA_CHECK(cudaMemcpyAsync(gpu_ptr_, cpu_ptr_, size_, put, stream));
-  // Assume caller will synchronize on the stream before use
+  record_copy(stream);
   head_ = SYNCED;
 }
+
+void SyncedMemory::async_cpu_pull(const cudaStream_t& stream) {
+  check_device();
+  CHECK_EQ(head_, HEAD_AT_GPU);
+  wait_copy();
+  if (cpu_ptr_ == nullptr) {
+    PerceptionMallocHost(&cpu_ptr_, size_, cpu_malloc_use_cuda_);
+    own_cpu_data_ = true;
+  }
+  const cudaMemcpyKind get = cudaMemcpyDeviceToHost;
+  BASE_CUDA_CHECK(cudaMemcpyAsync(cpu_ptr_, gpu_ptr_, size_, get, stream));
+  record_copy(stream);
+  head_ = SYNCED;
+}
+
+void SyncedMemory::record_copy(const cudaStream_t& stream) {
+  if (copy_event_ == nullptr) {
+    BASE_CUDA_CHECK(
+        cudaEventCreateWithFlags(&copy_event_, cudaEventDisableTiming));
+  }
+  BASE_CUDA_CHECK(cudaEventRecord(copy_event_, stream));
+  copy_pending_ = true;
+}
 #endif
 
 void SyncedMemory::check_device() {
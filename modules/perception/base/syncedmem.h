@@ -62,6 +62,8 @@ license and copyright terms herein.
  *****************************************************************************/
 #pragma once
 
+#include <cstddef>
+
 #include "cyber/common/log.h"
 #include "modules/perception/base/common.h"
 
@@ -90,6 +92,19 @@ inline void PerceptionFreeHost(void* ptr, bool use_cuda) {
   free(ptr);
 }
 
+#ifndef PERCEPTION_CPU_ONLY
+/**
+ * @brief Device allocations of SyncedMemory. Freed blocks are kept per
+ *        device and size and handed out again, which spares the implicit
+ *        device synchronization of cudaFree and the cost of cudaMalloc
+ *        when blobs are reallocated frame after frame.
+ */
+void PerceptionMallocDevice(void** ptr, size_t size);
+void PerceptionFreeDevice(void* ptr, size_t size);
+// frees the cached blocks of all devices
+void PerceptionReleaseDeviceCache();
+#endif
+
 /**
  * @brief Manages memory allocation and synchronization between the host (CPU)
  *        and device (GPU).
@@ -125,13 +140,28 @@ class SyncedMemory {
   size_t size() { return size_; }
 
 #ifndef PERCEPTION_CPU_ONLY
+  /**
+   * @brief Copies the host data to the device on the stream, without
+   *        waiting for it. The next access of either side waits for the
+   *        copy, and work enqueued on the same stream runs after it.
+   *        Truly asynchronous only for pinned host memory.
+   */
   void async_gpu_push(const cudaStream_t& stream);
+  /**
+   * @brief Copies the device data to the host on the stream, without
+   *        waiting for it, as async_gpu_push.
+   */
+  void async_cpu_pull(const cudaStream_t& stream);
 #endif
 
  private:
   void check_device();
   void to_cpu();
   void to_gpu();
+  void wait_copy();
+#ifndef PERCEPTION_CPU_ONLY
+  void record_copy(const cudaStream_t& stream);
+#endif
 
  private:
   void* cpu_ptr_;
@@ -142,6 +172,11 @@ class SyncedMemory {
   bool cpu_malloc_use_cuda_;
   bool own_gpu_data_;
   int device_;
+#ifndef PERCEPTION_CPU_ONLY
+  // completion of the last async copy, waited for by the next access
+  cudaEvent_t copy_event_ = nullptr;
+  bool copy_pending_ = false;
+#endif
 };  // class SyncedMemory
 
 }  // namespace base
@@ -200,6 +200,38 @@ TEST_F(SyncedMemoryTest, TestGPUWrite) {
   EXPECT_EQ(mem.head(), SyncedMemory::SYNCED);
 }
 
+TEST_F(SyncedMemoryTest, TestAsyncPushPull) {
+  cudaStream_t stream;
+  BASE_CUDA_CHECK(cudaStreamCreate(&stream));
+  SyncedMemory mem(10, true);
+  memset(mem.mutable_cpu_data(), 3, mem.size());
+  mem.async_gpu_push(stream);
+  EXPECT_EQ(mem.head(), SyncedMemory::SYNCED);
+  BASE_CUDA_CHECK(cudaMemsetAsync(mem.mutable_gpu_data(), 4, 5, stream));
+  EXPECT_EQ(mem.head(), SyncedMemory::HEAD_AT_GPU);
+  mem.async_cpu_pull(stream);
+  EXPECT_EQ(mem.head(), SyncedMemory::SYNCED);
+  // the access waits for the copy
+  const char* cpu_data = static_cast<const char*>(mem.cpu_data());
+  for (size_t i = 0; i < mem.size(); ++i) {
+    EXPECT_EQ(cpu_data[i], i < 5 ? 4 : 3);
+  }
+  BASE_CUDA_CHECK(cudaStreamDestroy(stream));
+}
+
+TEST_F(SyncedMemoryTest, TestDeviceBlockReuse) {
+  PerceptionReleaseDeviceCache();
+  void* first = nullptr;
+  PerceptionMallocDevice(&first, 1000);
+  PerceptionFreeDevice(first, 1000);
+  void* second = nullptr;
+  // the same rounded size gets the cached block back
+  PerceptionMallocDevice(&second, 900);
+  EXPECT_EQ(first, second);
+  PerceptionFreeDevice(second, 900);
+  PerceptionReleaseDeviceCache();
+}
+
 #endif
 
 }  // namespace base
@@ -16,6 +16,7 @@
 #include "modules/perception/camera/app/obstacle_camera_perception.h"
 
 #include <utility>
+#include <vector>
 
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
@@ -66,9 +67,19 @@ bool ObstacleCameraPerception::Init(
     name_intrinsic_map_.insert(std::pair<std::string, Eigen::Matrix3f>(
         detector_param.camera_name(), pinhole->get_intrinsic_params()));
     detector_init_options.base_camera_model = model;
-    std::shared_ptr<BaseObstacleDetector> detector_ptr(
-        BaseObstacleDetectorRegisterer::GetInstanceByName(
-            plugin_param.name()));
+    detector_init_options.max_batch_size = options.detector_batch_size;
+    std::shared_ptr<BaseObstacleDetector> detector_ptr =
+        options.detector_batch_size > 1 ? FindSharedDetector(i) : nullptr;
+    if (detector_ptr != nullptr) {
+      AINFO << detector_param.camera_name() << " shares the detector of "
+            << "previous cameras for batched detection";
+      name_detector_map_.insert(
+          std::pair<std::string, std::shared_ptr<BaseObstacleDetector>>(
+              detector_param.camera_name(), detector_ptr));
+      continue;
+    }
+    detector_ptr.reset(BaseObstacleDetectorRegisterer::GetInstanceByName(
+        plugin_param.name()));
     name_detector_map_.insert(std::pair<std::string,
                                         std::shared_ptr<BaseObstacleDetector>>(
         detector_param.camera_name(), detector_ptr));
@@ -297,15 +308,92 @@ bool ObstacleCameraPerception::GetCalibrationService(
   return true;
 }
 
+std::shared_ptr<BaseObstacleDetector>
+ObstacleCameraPerception::FindSharedDetector(int index) const {
+  const app::DetectorParam &detector_param =
+      perception_param_.detector_param(index);
+  auto model = common::SensorManager::Instance()->GetUndistortCameraModel(
+      detector_param.camera_name());
+  for (int i = 0; i < index; ++i) {
+    const app::DetectorParam &other = perception_param_.detector_param(i);
+    auto other_model =
+        common::SensorManager::Instance()->GetUndistortCameraModel(
+            other.camera_name());
+    // the detectors crop and resize by the image size of their camera
+    if (other.plugin_param().name() == detector_param.plugin_param().name() &&
+        other.plugin_param().root_dir() ==
+            detector_param.plugin_param().root_dir() &&
+        other.plugin_param().config_file() ==
+            detector_param.plugin_param().config_file() &&
+        other_model->get_width() == model->get_width() &&
+        other_model->get_height() == model->get_height()) {
+      return name_detector_map_.at(other.camera_name());
+    }
+  }
+  return nullptr;
+}
+
 bool ObstacleCameraPerception::Perception(
     const CameraPerceptionOptions &options, CameraFrame *frame) {
   PERCEPTION_PERF_FUNCTION();
   inference::CudaUtil::set_device_id(perception_param_.gpu_id());
+  if (!PrepareFrame(frame)) {
+    return false;
+  }
+
   ObstacleDetectorOptions detector_options;
-  ObstacleTransformerOptions transformer_options;
-  ObstaclePostprocessorOptions obstacle_postprocessor_options;
-  ObstacleTrackerOptions tracker_options;
-  FeatureExtractorOptions extractor_options;
+  PERCEPTION_PERF_BLOCK_START();
+  std::shared_ptr<BaseObstacleDetector> detector = name_detector_map_.at(
+      frame->data_provider->sensor_name());
+
+  if (!detector->Detect(detector_options, frame)) {
+    AERROR << "Failed to detect.";
+    return false;
+  }
+  PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(
+      frame->data_provider->sensor_name(), "detect");
+
+  return ProcessDetections(frame);
+}
+
+bool ObstacleCameraPerception::Perception(
+    const CameraPerceptionOptions &options,
+    const std::vector<CameraFrame *> &frames) {
+  PERCEPTION_PERF_FUNCTION();
+  inference::CudaUtil::set_device_id(perception_param_.gpu_id());
+  for (auto frame : frames) {
+    if (!PrepareFrame(frame)) {
+      return false;
+    }
+  }
+
+  // cameras sharing one detector are detected in one batch
+  ObstacleDetectorOptions detector_options;
+  PERCEPTION_PERF_BLOCK_START();
+  std::map<BaseObstacleDetector *, std::vector<CameraFrame *>>
+      detector_frames;
+  for (auto frame : frames) {
+    detector_frames[name_detector_map_.at(
+        frame->data_provider->sensor_name()).get()].push_back(frame);
+  }
+  for (auto &pair : detector_frames) {
+    if (!pair.first->DetectBatch(detector_options, pair.second)) {
+      AERROR << "Failed to detect batch of " << pair.second.size()
+             << " frames.";
+      return false;
+    }
+  }
+  PERCEPTION_PERF_BLOCK_END("DetectBatch");
+
+  for (auto frame : frames) {
+    if (!ProcessDetections(frame)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ObstacleCameraPerception::PrepareFrame(CameraFrame *frame) {
   PERCEPTION_PERF_BLOCK_START();
   frame->camera_k_matrix = name_intrinsic_map_.at(
       frame->data_provider->sensor_name());
@@ -366,7 +454,17 @@ bool ObstacleCameraPerception::Perception(
                            frame);
   }
 
-  // obstacle
+  return true;
+}
+
+bool ObstacleCameraPerception::ProcessDetections(CameraFrame *frame) {
+  ObstacleTransformerOptions transformer_options;
+  ObstaclePostprocessorOptions obstacle_postprocessor_options;
+  ObstacleTrackerOptions tracker_options;
+  FeatureExtractorOptions extractor_options;
+  PERCEPTION_PERF_BLOCK_START();
+  // obstacle, the tracker does not affect the detector, so the prediction
+  // can run after the detection of the whole batch
   if (!tracker_->Predict(tracker_options, frame)) {
     AERROR << "Failed to predict.";
     return false;
@@ -374,16 +472,6 @@ bool ObstacleCameraPerception::Perception(
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(
       frame->data_provider->sensor_name(), "Predict");
 
-  std::shared_ptr<BaseObstacleDetector> detector = name_detector_map_.at(
-      frame->data_provider->sensor_name());
-
-  if (!detector->Detect(detector_options, frame)) {
-    AERROR << "Failed to detect.";
-    return false;
-  }
-  PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(
-      frame->data_provider->sensor_name(), "detect");
-
   // save all detections results as kitti format
   WriteDetections(perception_param_.debug_param().has_detection_out_dir(),
                   perception_param_.debug_param().detection_out_dir()
@@ -19,6 +19,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "modules/perception/camera/app/perception.pb.h"
 #include "modules/perception/camera/common/camera_frame.h"
@@ -68,11 +69,24 @@ class ObstacleCameraPerception : public BaseCameraPerception {
   bool GetCalibrationService(BaseCalibrationService** calibration_service);
   bool Perception(const CameraPerceptionOptions &options,
                   CameraFrame *frame) override;
+  // @brief: run the pipeline on frames of different cameras, the frames
+  // of cameras sharing a detector are detected in one batch. frames should
+  // be sorted by timestamp, they are tracked in this order.
+  bool Perception(const CameraPerceptionOptions &options,
+                  const std::vector<CameraFrame *> &frames);
   std::string Name() const override {
     return "ObstacleCameraPerception";
   }
 
  private:
+  // @brief: lane detection and calibration before the obstacle detection
+  bool PrepareFrame(CameraFrame *frame);
+  // @brief: tracking and postprocessing of the detected obstacles
+  bool ProcessDetections(CameraFrame *frame);
+  // @brief: detector of a previous camera with the same config and image
+  // size as the index-th detector param, nullptr if there is none
+  std::shared_ptr<BaseObstacleDetector> FindSharedDetector(int index) const;
+
   std::map<std::string, Eigen::Matrix3f> name_intrinsic_map_;
   std::map<std::string,
     std::shared_ptr<BaseObstacleDetector>> name_detector_map_;
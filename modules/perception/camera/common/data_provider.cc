@@ -15,6 +15,7 @@
 *****************************************************************************/
 #include "modules/perception/camera/common/data_provider.h"
 #include "cyber/common/log.h"
+#include "modules/perception/inference/utils/resize.h"
 
 namespace apollo {
 namespace perception {
@@ -118,6 +119,7 @@ bool DataProvider::FillImageData(int rows, int cols, const uint8_t *data,
   gray_ready_ = false;
   rgb_ready_ = false;
   bgr_ready_ = false;
+  ori_color_ = base::Color::NONE;
 
   bool success = false;
 
@@ -150,40 +152,43 @@ bool DataProvider::FillImageData(int rows, int cols, const uint8_t *data,
   AINFO << "Fill in GPU mode ...";
   if (encoding == "rgb8") {
     if (handler_ != nullptr) {
+      // undistorted on demand, see undistort_image()
       cudaMemcpy(ori_rgb_->mutable_gpu_data(), data,
                  ori_rgb_->rows() * ori_rgb_->width_step(),
                  cudaMemcpyDefault);
-      success = handler_->Handle(*ori_rgb_, rgb_.get());
+      ori_color_ = base::Color::RGB;
     } else {
       cudaMemcpy(rgb_->mutable_gpu_data(), data,
                  rgb_->rows() * rgb_->width_step(), cudaMemcpyDefault);
-      success = true;
+      rgb_ready_ = true;
     }
-    rgb_ready_ = true;
+    success = true;
   } else if (encoding == "bgr8") {
     if (handler_ != nullptr) {
+      // undistorted on demand, see undistort_image()
       cudaMemcpy(ori_bgr_->mutable_gpu_data(), data,
                  ori_bgr_->rows() * ori_bgr_->width_step(),
                  cudaMemcpyDefault);
-      success = handler_->Handle(*ori_bgr_, bgr_.get());
+      ori_color_ = base::Color::BGR;
     } else {
       cudaMemcpy(bgr_->mutable_gpu_data(), data,
           bgr_->rows() * bgr_->width_step(), cudaMemcpyDefault);
-      success = true;
+      bgr_ready_ = true;
     }
-    bgr_ready_ = true;
+    success = true;
   } else if (encoding == "gray" || encoding == "y") {
     if (handler_ != nullptr) {
+      // undistorted on demand, see undistort_image()
       cudaMemcpy(ori_gray_->mutable_gpu_data(), data,
                  ori_gray_->rows() * ori_gray_->width_step(),
                  cudaMemcpyDefault);
-      success = handler_->Handle(*ori_gray_, gray_.get());
+      ori_color_ = base::Color::GRAY;
     } else {
       cudaMemcpy(gray_->mutable_gpu_data(), data,
           gray_->rows() * gray_->width_step(), cudaMemcpyDefault);
-      success = true;
+      gray_ready_ = true;
     }
-    gray_ready_ = true;
+    success = true;
   } else {
     success = false;
     AERROR << "Unrecognized image encoding: " << encoding;
@@ -282,7 +287,91 @@ bool DataProvider::GetImage(const DataProvider::ImageOptions &options,
   return true;
 }
 
+bool DataProvider::GetResizedImageBlob(
+    const DataProvider::ImageOptions &options, int index,
+    std::shared_ptr<base::Blob<float>> blob, float mean_b, float mean_g,
+    float mean_r, float scale) {
+  if (blob == nullptr) {
+    return false;
+  }
+  if (options.target_color != base::Color::RGB &&
+      options.target_color != base::Color::BGR) {
+    AERROR << "Unsupported Color: "
+           << static_cast<int>(options.target_color);
+    return false;
+  }
+  if (cudaSetDevice(device_id_) != cudaSuccess) {
+    AERROR << "Failed to set device to " << device_id_;
+    return false;
+  }
+
+  const base::Image8U *src = nullptr;
+  base::Color src_color = base::Color::NONE;
+  const base::Blob<float> *mapx = nullptr;
+  const base::Blob<float> *mapy = nullptr;
+  if (ori_color_ != base::Color::NONE) {
+    // undistort in the same pass as the resize
+    mapx = &handler_->mapx();
+    mapy = &handler_->mapy();
+    src_color = ori_color_;
+    src = src_color == base::Color::RGB ? ori_rgb_.get()
+        : (src_color == base::Color::BGR ? ori_bgr_.get() : ori_gray_.get());
+  } else if (options.target_color == base::Color::RGB && rgb_ready_) {
+    src = rgb_.get();
+    src_color = base::Color::RGB;
+  } else if (bgr_ready_) {
+    src = bgr_.get();
+    src_color = base::Color::BGR;
+  } else if (rgb_ready_) {
+    src = rgb_.get();
+    src_color = base::Color::RGB;
+  } else if (gray_ready_) {
+    src = gray_.get();
+    src_color = base::Color::GRAY;
+  } else {
+    AWARN << "No image data filled yet, return uninitialized blob!";
+    return false;
+  }
+
+  base::RectI roi(0, 0, src_width_, src_height_);
+  if (options.do_crop) {
+    roi = options.crop_roi;
+  }
+  bool swap_rb = src_color != base::Color::GRAY &&
+                 src_color != options.target_color;
+  return inference::RemapResizeGPU(*src, mapx, mapy, roi, blob, index,
+                                   swap_rb, mean_b, mean_g, mean_r, scale);
+}
+
+bool DataProvider::undistort_image() {
+  if (ori_color_ == base::Color::NONE) {
+    return true;
+  }
+  bool success = false;
+  switch (ori_color_) {
+    case base::Color::RGB:
+      success = handler_->Handle(*ori_rgb_, rgb_.get());
+      rgb_ready_ = success;
+      break;
+    case base::Color::BGR:
+      success = handler_->Handle(*ori_bgr_, bgr_.get());
+      bgr_ready_ = success;
+      break;
+    case base::Color::GRAY:
+      success = handler_->Handle(*ori_gray_, gray_.get());
+      gray_ready_ = success;
+      break;
+    default:
+      break;
+  }
+  ori_color_ = base::Color::NONE;
+  return success;
+}
+
 bool DataProvider::to_gray_image() {
+  if (!undistort_image()) {
+    return false;
+  }
   if (!gray_ready_) {
     NppiSize roi;
     roi.height = src_height_;
@@ -312,6 +401,9 @@ bool DataProvider::to_gray_image() {
 }
 
 bool DataProvider::to_rgb_image() {
+  if (!undistort_image()) {
+    return false;
+  }
   if (!rgb_ready_) {
     NppiSize roi;
     roi.height = src_height_;
@@ -341,6 +433,9 @@ bool DataProvider::to_rgb_image() {
 }
 
 bool DataProvider::to_bgr_image() {
+  if (!undistort_image()) {
+    return false;
+  }
   if (!bgr_ready_) {
     NppiSize roi;
     roi.height = src_height_;
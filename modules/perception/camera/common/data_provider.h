@@ -109,6 +109,17 @@ class DataProvider {
   // image blob with specified size should be filled, required.
   bool GetImage(const ImageOptions &options, base::Image8U *image);
 
+  // @brief: crop, undistort, resize and normalize the image into the
+  // index-th image of a NHWC float blob in one gpu pass. The raw image is
+  // read directly, the undistorted image is not computed for it.
+  // @param [in]: options, target_color should be RGB or BGR
+  // @param [in]: index, batch index in blob
+  // @param [in/out]: NHWC blob (4D), values are (pixel - mean) * scale
+  bool GetResizedImageBlob(const ImageOptions &options, int index,
+                           std::shared_ptr<base::Blob<float>> blob,
+                           float mean_b = 0.f, float mean_g = 0.f,
+                           float mean_r = 0.f, float scale = 1.f);
+
   int src_height() const { return src_height_; }
   int src_width() const { return src_width_; }
   const std::string &sensor_name() const { return sensor_name_; }
@@ -118,6 +129,9 @@ class DataProvider {
   bool to_bgr_image();
 
  protected:
+  // @brief: undistort the raw image if it is not done for this frame yet
+  bool undistort_image();
+
   std::string sensor_name_;
   int src_height_ = 0;
   int src_width_ = 0;
@@ -132,6 +146,8 @@ class DataProvider {
   bool gray_ready_ = false;
   bool rgb_ready_ = false;
   bool bgr_ready_ = false;
+  // color of the raw image waiting for undistortion, NONE if there is none
+  base::Color ori_color_ = base::Color::NONE;
 
   base::Blob<float> temp_float_;
   base::Blob<uint8_t> temp_uint8_;
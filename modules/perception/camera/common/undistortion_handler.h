@@ -53,6 +53,9 @@ class UndistortionHandler {
               base::Image8U *dst_img);
   // @brief: Release the resources
   bool Release(void);
+  // @brief: remap tables giving the distorted position of every pixel
+  const base::Blob<float> &mapx() const { return d_mapx_; }
+  const base::Blob<float> &mapy() const { return d_mapy_; }
 
  private:
   base::Blob<float> d_mapx_;
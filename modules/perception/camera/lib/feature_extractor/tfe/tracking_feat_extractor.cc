@@ -103,7 +103,7 @@ bool TrackingFeatureExtractor::Extract(const FeatureExtractorOptions &options,
     float *rois_data =
         feature_extractor_layer_ptr->rois_blob->mutable_cpu_data();
     for (const auto &obj : frame->detected_objects) {
-      rois_data[0] = 0;
+      rois_data[0] = static_cast<float>(options.batch_id);
       rois_data[1] = obj->camera_supplement.box.xmin *
                      static_cast<float>(feat_width_);
       rois_data[2] = obj->camera_supplement.box.ymin *
@@ -29,6 +29,8 @@ struct CameraPerceptionInitOptions : public BaseInitOptions {
   // TODO(Xun): modified to be configurable
   std::string lane_calibration_working_sensor_name = "front_6mm";
   std::string calibrator_method = "LaneLineCalibrator";
+  // maximum number of frames per detector inference
+  int detector_batch_size = 1;
 };
 
 struct CameraPerceptionOptions {
@@ -42,6 +42,8 @@ struct FeatureExtractorInitOptions : public BaseInitOptions {
 
 struct FeatureExtractorOptions {
   bool normalized = true;
+  // @brief: index of the frame in the batch of the feature blob
+  int batch_id = 0;
 };
 class BaseFeatureExtractor {
  public:
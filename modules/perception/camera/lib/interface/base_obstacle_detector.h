@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "modules/perception/base/camera.h"
 #include "modules/perception/camera/common/camera_frame.h"
@@ -30,6 +31,8 @@ namespace camera {
 struct ObstacleDetectorInitOptions : public BaseInitOptions {
   std::shared_ptr<base::BaseCameraModel> base_camera_model = nullptr;
   Eigen::Matrix3f intrinsics;
+  // @brief: maximum number of frames detected by one inference
+  int max_batch_size = 1;
 };
 
 struct ObstacleDetectorOptions {
@@ -53,6 +56,21 @@ class BaseObstacleDetector {
       const ObstacleDetectorOptions &options,
       CameraFrame *frame) = 0;
 
+  // @brief: detect obstacles from the images of several frames.
+  // @param [in]: options
+  // @param [in/out]: frames
+  // detectors without batched inference handle the frames one by one.
+  virtual bool DetectBatch(
+      const ObstacleDetectorOptions &options,
+      const std::vector<CameraFrame *> &frames) {
+    for (auto frame : frames) {
+      if (!Detect(options, frame)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   virtual std::string Name() const = 0;
 
   BaseObstacleDetector(const BaseObstacleDetector &) = delete;
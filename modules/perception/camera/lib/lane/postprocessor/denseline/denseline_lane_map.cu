@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/camera/lib/lane/postprocessor/denseline/denseline_lane_map.h"
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace perception {
+namespace camera {
+
+__global__ void select_lane_map_points_kernel(const float *output_data,
+                                              int width, int height,
+                                              int rows, float score_thresh,
+                                              float *points, int *point_num) {
+  const int x = blockIdx.x * blockDim.x + threadIdx.x;
+  const int y = blockIdx.y * blockDim.y + threadIdx.y;
+  if (x >= width || y >= rows) {
+    return;
+  }
+  const int out_dim = width * height;
+  const int pixel_pos = y * width + x;
+
+  //  softmax of the 4 lane channels, the maximum is taken before the
+  //  normalization, it does not change the order
+  float score_channel[4];
+  float sum_score = 0.0f;
+  for (int i = 0; i < 4; ++i) {
+    score_channel[i] = expf(output_data[i * out_dim + pixel_pos]);
+    sum_score += score_channel[i];
+  }
+  int max_channel_idx = 0;
+  float max_score = score_channel[0];
+  for (int channel_idx = 1; channel_idx < 4; ++channel_idx) {
+    if (max_score < score_channel[channel_idx]) {
+      max_score = score_channel[channel_idx];
+      max_channel_idx = channel_idx;
+    }
+  }
+  max_score /= sum_score;
+  if (max_channel_idx == 0 || max_score < score_thresh) {
+    return;
+  }
+
+  const int point_idx = atomicAdd(point_num, 1);
+  float *point = points + point_idx * kLaneMapPointDim;
+  point[0] = static_cast<float>(pixel_pos);
+  point[1] = 1.0f / (1.0f + expf(-output_data[5 * out_dim + pixel_pos]));
+  point[2] = 1.0f / (1.0f + expf(-output_data[6 * out_dim + pixel_pos]));
+  point[3] = max_score;
+}
+
+bool SelectLaneMapPointsGPU(const float *output_data, int width, int height,
+                            int omit_bottom_line_num, float score_thresh,
+                            base::Blob<float> *points,
+                            base::Blob<int> *point_num) {
+  points->Reshape({width * height, kLaneMapPointDim});
+  point_num->Reshape({1});
+  int *point_num_data = point_num->mutable_gpu_data();
+  cudaMemset(point_num_data, 0, sizeof(int));
+
+  const int rows = height - omit_bottom_line_num;
+  if (rows <= 0) {
+    return true;
+  }
+  const dim3 block(32, 8);
+  const dim3 grid((width + block.x - 1) / block.x,
+                  (rows + block.y - 1) / block.y);
+  select_lane_map_points_kernel<<<grid, block>>>(
+      output_data, width, height, rows, score_thresh,
+      points->mutable_gpu_data(), point_num_data);
+  const cudaError_t error = cudaGetLastError();
+  if (error != cudaSuccess) {
+    AERROR << "select lane map points failed: " << cudaGetErrorString(error);
+    return false;
+  }
+  return true;
+}
+
+}  // namespace camera
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,43 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include "modules/perception/base/blob.h"
+
+namespace apollo {
+namespace perception {
+namespace camera {
+
+// number of floats of a selected lane map point:
+// 0: pixel position 1: dist-left 2: dist-right 3: score
+static const int kLaneMapPointDim = 4;
+
+// @brief: select the lane map pixels of the denseline network output on the
+// gpu, with the same rule as DenselineLanePostprocessor::CalLaneMap. The
+// selected pixels are compacted into points, one row of kLaneMapPointDim
+// floats per pixel in no particular order, and point_num holds their number,
+// so only the selected pixels have to be copied back to the host.
+// @param [in]: output_data, gpu data of the channels x height x width output
+// @param [out]: points, reshaped to hold height x width points
+// @param [out]: point_num, reshaped to one element
+bool SelectLaneMapPointsGPU(const float *output_data, int width, int height,
+                            int omit_bottom_line_num, float score_thresh,
+                            base::Blob<float> *points,
+                            base::Blob<int> *point_num);
+
+}  // namespace camera
+}  // namespace perception
+}  // namespace apollo
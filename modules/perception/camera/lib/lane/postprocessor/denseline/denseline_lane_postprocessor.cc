@@ -76,6 +76,7 @@ bool DenselineLanePostprocessor::Init(
     lane_postprocessor_param_.cc_valid_pixels_ratio();
   laneline_reject_dist_thresh_ =
     lane_postprocessor_param_.laneline_reject_dist_thresh();
+  use_gpu_lane_map_ = lane_postprocessor_param_.use_gpu_lane_map();
 
   lane_map_dim_ = lane_map_width_ * lane_map_height_;
   lane_pos_blob_.Reshape({4, lane_map_dim_});
@@ -218,6 +219,35 @@ void DenselineLanePostprocessor::CalLaneMap(
   return;
 }
 
+bool DenselineLanePostprocessor::CalLaneMapGPU(
+  const float* output_data,
+  int width, int height,
+  std::vector<unsigned char>* lane_map) {
+  if (!SelectLaneMapPointsGPU(output_data, width, height,
+    omit_bottom_line_num_, laneline_map_score_thresh_,
+    &lane_points_blob_, &lane_point_num_blob_)) {
+    return false;
+  }
+  //  copy back the selected points only, not the whole score map
+  int point_num = lane_point_num_blob_.cpu_data()[0];
+  lane_points_.resize(point_num * kLaneMapPointDim);
+  if (point_num > 0) {
+    cudaMemcpy(lane_points_.data(), lane_points_blob_.gpu_data(),
+      sizeof(float) * lane_points_.size(), cudaMemcpyDeviceToHost);
+  }
+  int out_dim = width * height;
+  for (int i = 0; i < point_num; i++) {
+    const float* point = &lane_points_[i * kLaneMapPointDim];
+    int pixel_pos = static_cast<int>(point[0]);
+    (*lane_map)[pixel_pos] = 1;
+    lane_output_[pixel_pos] = point[1];
+    lane_output_[out_dim + pixel_pos] = point[2];
+    lane_output_[out_dim * 2 + pixel_pos] = point[3];
+  }
+  ADEBUG << "lane map points: " << point_num << "/" << out_dim;
+  return true;
+}
+
 // @brief infer the lane line points using lane center point information
 void DenselineLanePostprocessor::InferPointSetFromLaneCenter(
   const std::vector<ConnectedComponent> &lane_ccs,
@@ -410,7 +440,6 @@ bool DenselineLanePostprocessor::LocateLanelinePointSet(
 
   lane_map_height_ = frame->lane_detected_blob->height();
   lane_map_width_ = frame->lane_detected_blob->width();
-  const float *output_data = frame->lane_detected_blob->cpu_data();
   ADEBUG << "input_size: [" << input_image_width_
       << "," << input_image_height_ << "] "
       << "output_shape: channels=" << channels
@@ -425,8 +454,15 @@ bool DenselineLanePostprocessor::LocateLanelinePointSet(
   lane_output_.clear();
   lane_map_.resize(out_dim, 0);
   lane_output_.resize(out_dim * 3, 0);
-  CalLaneMap(output_data, lane_map_width_, lane_map_height_,
-    &lane_map_);
+  if (use_gpu_lane_map_) {
+    if (!CalLaneMapGPU(frame->lane_detected_blob->gpu_data(),
+      lane_map_width_, lane_map_height_, &lane_map_)) {
+      return false;
+    }
+  } else {
+    CalLaneMap(frame->lane_detected_blob->cpu_data(),
+      lane_map_width_, lane_map_height_, &lane_map_);
+  }
   //  2.group the lane points
   base::RectI roi;
   roi.x = 0;
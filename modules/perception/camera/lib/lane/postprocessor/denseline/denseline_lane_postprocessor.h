@@ -23,6 +23,7 @@
 #include "modules/perception/camera/lib/interface/base_calibration_service.h"
 #include "modules/perception/camera/lib/interface/base_lane_postprocessor.h"
 #include "modules/perception/camera/lib/lane/common/common_functions.h"
+#include "modules/perception/camera/lib/lane/postprocessor/denseline/denseline_lane_map.h"
 #include "modules/perception/camera/lib/lane/postprocessor/denseline/denseline_postprocessor.pb.h"
 #include "modules/perception/lib/registerer/registerer.h"
 
@@ -79,6 +80,12 @@ class DenselineLanePostprocessor : public BaseLanePostprocessor {
     const float* output_data,
     int width, int height,
     std::vector<unsigned char>* lane_map);
+  // @brief: calculate the map on the gpu, only the selected pixels are
+  // copied back to the host
+  bool CalLaneMapGPU(
+    const float* output_data,
+    int width, int height,
+    std::vector<unsigned char>* lane_map);
   // @brief: select lane center ccs
   bool SelectLanecenterCCs(
     const std::vector<ConnectedComponent>& lane_ccs,
@@ -145,6 +152,7 @@ class DenselineLanePostprocessor : public BaseLanePostprocessor {
   int laneline_point_min_num_thresh_ = 2;
   float cc_valid_pixels_ratio_ = 2.0F;
   float laneline_reject_dist_thresh_ = 50.0f;
+  bool use_gpu_lane_map_ = false;
 
   int lane_map_width_ = 192;
   int lane_map_height_ = 64;
@@ -171,6 +179,10 @@ class DenselineLanePostprocessor : public BaseLanePostprocessor {
 
   base::Blob<float> lane_pos_blob_;
   base::Blob<int> lane_hist_blob_;
+  //  selected lane map points of the gpu path
+  base::Blob<float> lane_points_blob_;
+  base::Blob<int> lane_point_num_blob_;
+  std::vector<float> lane_points_;
 };
 
 }  // namespace camera
@@ -425,8 +425,9 @@ void apply_nms(const bool *overlapped,
   }
 }
 
-const float *get_gpu_data(bool flag, const base::Blob<float> &blob) {
-  return flag ? blob.gpu_data() : nullptr;
+const float *get_gpu_data(bool flag, const base::Blob<float> &blob,
+                          int batch_id) {
+  return flag ? blob.gpu_data() + blob.offset(batch_id) : nullptr;
 }
 
 void get_objects_gpu(const YoloBlobs &yolo_blobs,
@@ -438,6 +439,7 @@ void get_objects_gpu(const YoloBlobs &yolo_blobs,
                      float light_swt_conf_threshold,
                      base::Blob<bool> *overlapped,
                      base::Blob<int> *idx_sm,
+                     int batch_id,
                      std::vector<base::ObjectPtr> *objects) {
   int num_classes = types.size();
   int batch = yolo_blobs.obj_blob->shape(0);
@@ -446,35 +448,42 @@ void get_objects_gpu(const YoloBlobs &yolo_blobs,
   int num_anchor = yolo_blobs.anchor_blob->shape(2);
   int num_candidates = height * width * num_anchor;
 
-  CHECK_EQ(batch, 1) << "batch size should be 1!";
-  const float *loc_data = yolo_blobs.loc_blob->gpu_data();
-  const float *obj_data = yolo_blobs.obj_blob->gpu_data();
-  const float *cls_data = yolo_blobs.cls_blob->gpu_data();
+  CHECK_GE(batch_id, 0);
+  CHECK_LT(batch_id, batch) << "batch id out of the batch size!";
+  const float *loc_data = get_gpu_data(true, *yolo_blobs.loc_blob, batch_id);
+  const float *obj_data = get_gpu_data(true, *yolo_blobs.obj_blob, batch_id);
+  const float *cls_data = get_gpu_data(true, *yolo_blobs.cls_blob, batch_id);
 
   const float *ori_data = get_gpu_data(
-          model_param.with_box3d(), *yolo_blobs.ori_blob);
+          model_param.with_box3d(), *yolo_blobs.ori_blob, batch_id);
   const float *dim_data = get_gpu_data(
-          model_param.with_box3d(), *yolo_blobs.dim_blob);
+          model_param.with_box3d(), *yolo_blobs.dim_blob, batch_id);
 
   const float *lof_data = get_gpu_data(
-          model_param.with_frbox(), *yolo_blobs.lof_blob);
+          model_param.with_frbox(), *yolo_blobs.lof_blob, batch_id);
   const float *lor_data = get_gpu_data(
-          model_param.with_frbox(), *yolo_blobs.lor_blob);
+          model_param.with_frbox(), *yolo_blobs.lor_blob, batch_id);
 
   const float *area_id_data = get_gpu_data(
-      model_param.num_areas() > 0, *yolo_blobs.area_id_blob);
+      model_param.num_areas() > 0, *yolo_blobs.area_id_blob, batch_id);
   const float *visible_ratio_data = get_gpu_data(
-      model_param.with_ratios(), *yolo_blobs.visible_ratio_blob);
+      model_param.with_ratios(), *yolo_blobs.visible_ratio_blob, batch_id);
   const float *cut_off_ratio_data = get_gpu_data(
-      model_param.with_ratios(), *yolo_blobs.cut_off_ratio_blob);
+      model_param.with_ratios(), *yolo_blobs.cut_off_ratio_blob, batch_id);
 
   const auto &with_lights = model_param.with_lights();
-  const float *brvis_data = get_gpu_data(with_lights, *yolo_blobs.brvis_blob);
-  const float *brswt_data = get_gpu_data(with_lights, *yolo_blobs.brswt_blob);
-  const float *ltvis_data = get_gpu_data(with_lights, *yolo_blobs.ltvis_blob);
-  const float *ltswt_data = get_gpu_data(with_lights, *yolo_blobs.ltswt_blob);
-  const float *rtvis_data = get_gpu_data(with_lights, *yolo_blobs.rtvis_blob);
-  const float *rtswt_data = get_gpu_data(with_lights, *yolo_blobs.rtswt_blob);
+  const float *brvis_data =
+      get_gpu_data(with_lights, *yolo_blobs.brvis_blob, batch_id);
+  const float *brswt_data =
+      get_gpu_data(with_lights, *yolo_blobs.brswt_blob, batch_id);
+  const float *ltvis_data =
+      get_gpu_data(with_lights, *yolo_blobs.ltvis_blob, batch_id);
+  const float *ltswt_data =
+      get_gpu_data(with_lights, *yolo_blobs.ltswt_blob, batch_id);
+  const float *rtvis_data =
+      get_gpu_data(with_lights, *yolo_blobs.rtvis_blob, batch_id);
+  const float *rtswt_data =
+      get_gpu_data(with_lights, *yolo_blobs.rtswt_blob, batch_id);
 
   yolo_blobs.res_box_blob->Reshape(
       std::vector<int>{1, 1, num_candidates, kBoxBlockSize});
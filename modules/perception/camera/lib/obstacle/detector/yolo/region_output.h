@@ -162,6 +162,7 @@ void get_objects_gpu(const YoloBlobs &yolo_blobs,
                      float light_swt_conf_threshold,
                      base::Blob<bool> *overlapped,
                      base::Blob<int> *idx_sm,
+                     int batch_id,
                      std::vector<base::ObjectPtr> *objects);
 
 void apply_softnms_fast(const std::vector<NormalizedBBox> &bboxes,
@@ -204,7 +205,8 @@ void fill_area_id(bool with_flag, base::ObjectPtr obj, const float *data);
 
 void fill_base(base::ObjectPtr obj, const float *bbox);
 
-const float *get_gpu_data(bool flag, const base::Blob<float> &blob);
+const float *get_gpu_data(bool flag, const base::Blob<float> &blob,
+                          int batch_id = 0);
 
 int get_area_id(float visible_ratios[4]);
 
@@ -15,6 +15,8 @@
 *****************************************************************************/
 #include "modules/perception/camera/lib/obstacle/detector/yolo/yolo_obstacle_detector.h"
 
+#include <algorithm>
+
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
 
@@ -120,7 +122,7 @@ bool YoloObstacleDetector::InitNet(const yolo::YoloParam &yolo_param,
     return false;
   }
   inference_->set_gpu_id(gpu_id_);
-  std::vector<int> shape = {1, height_, width_, 3};
+  std::vector<int> shape = {max_batch_size_, height_, width_, 3};
   std::map<std::string, std::vector<int>> shape_map{
       {net_param.input_blob(), shape}};
 
@@ -158,8 +160,6 @@ void YoloObstacleDetector::InitYoloBlob(const yolo::NetworkParam &net_param) {
   memcpy(anchor_cpu_data, anchors_.data(), anchors_.size() * sizeof(float));
   yolo_blobs_.anchor_blob->gpu_data();
 
-  image_.reset(new base::Image8U(height_, width_, base::Color::RGB));
-
   yolo_blobs_.loc_blob =
       inference_->get_blob(yolo_param_.net_param().loc_blob());
   yolo_blobs_.obj_blob =
@@ -198,6 +198,7 @@ void YoloObstacleDetector::InitYoloBlob(const yolo::NetworkParam &net_param) {
 
 bool YoloObstacleDetector::Init(const ObstacleDetectorInitOptions &options) {
   gpu_id_ = options.gpu_id;
+  max_batch_size_ = std::max(options.max_batch_size, 1);
   BASE_CUDA_CHECK(cudaSetDevice(gpu_id_));
   BASE_CUDA_CHECK(cudaStreamCreate(&stream_));
 
@@ -259,20 +260,8 @@ bool YoloObstacleDetector::InitFeatureExtractor(const std::string &root_dir) {
   return true;
 }
 
-bool YoloObstacleDetector::Detect(const ObstacleDetectorOptions &options,
-                                  CameraFrame *frame) {
-  if (frame == nullptr) {
-    return false;
-  }
-
-  Timer timer;
-  if (cudaSetDevice(gpu_id_) != cudaSuccess) {
-    AERROR << "Failed to set device to " << gpu_id_;
-    return false;
-  }
-
+bool YoloObstacleDetector::FillInput(CameraFrame *frame, int batch_id) {
   auto input_blob = inference_->get_blob(yolo_param_.net_param().input_blob());
-  AINFO << "Start: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
   DataProvider::ImageOptions image_options;
   image_options.target_color = base::Color::BGR;
   image_options.crop_roi =
@@ -280,35 +269,30 @@ bool YoloObstacleDetector::Detect(const ObstacleDetectorOptions &options,
         static_cast<int>(base_camera_model_->get_width()),
         static_cast<int>(base_camera_model_->get_height()) - offset_y_);
   image_options.do_crop = true;
-  frame->data_provider->GetImage(image_options, image_.get());
-  AINFO << "GetImageBlob: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
-  inference::ResizeGPU(*image_,
-                       input_blob, frame->data_provider->src_width(), 0);
-  AINFO << "Resize: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
-
-  /////////////////////////// detection part ///////////////////////////
-  inference_->Infer();
+  return frame->data_provider->GetResizedImageBlob(image_options, batch_id,
+                                                   input_blob);
+}
 
+void YoloObstacleDetector::FillObjects(CameraFrame *frame, int batch_id) {
   get_objects_gpu(yolo_blobs_, stream_, types_, nms_, yolo_param_.model_param(),
                   light_vis_conf_threshold_, light_swt_conf_threshold_,
-                  overlapped_.get(), idx_sm_.get(), &(frame->detected_objects));
+                  overlapped_.get(), idx_sm_.get(), batch_id,
+                  &(frame->detected_objects));
 
-  AINFO << "GetObj: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
   filter_bbox(min_dims_, &(frame->detected_objects));
   FeatureExtractorOptions feat_options;
   feat_options.normalized = true;
-  AINFO << "Post1: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
+  feat_options.batch_id = batch_id;
   feature_extractor_->Extract(feat_options, frame);
-  AINFO << "Extract: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
   recover_bbox(frame->data_provider->src_width(),
                frame->data_provider->src_height() - offset_y_, offset_y_,
                &frame->detected_objects);
 
   // post processing
-  int left_boundary = static_cast<int>(border_ratio_ *
-                                       static_cast<float>(image_->cols()));
-  int right_boundary = static_cast<int>(
-              (1.0f - border_ratio_) * static_cast<float>(image_->cols()));
+  const float image_width =
+      static_cast<float>(base_camera_model_->get_width());
+  int left_boundary = static_cast<int>(border_ratio_ * image_width);
+  int right_boundary = static_cast<int>((1.0f - border_ratio_) * image_width);
   for (auto &obj : frame->detected_objects) {
     // recover alpha
     obj->camera_supplement.alpha /= ori_cycle_;
@@ -326,7 +310,70 @@ bool YoloObstacleDetector::Detect(const ObstacleDetectorOptions &options,
       obj->camera_supplement.cut_off_ratios[3] = 0;
     }
   }
-  AINFO << "Post2: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
+}
+
+bool YoloObstacleDetector::Detect(const ObstacleDetectorOptions &options,
+                                  CameraFrame *frame) {
+  if (frame == nullptr) {
+    return false;
+  }
+
+  Timer timer;
+  if (cudaSetDevice(gpu_id_) != cudaSuccess) {
+    AERROR << "Failed to set device to " << gpu_id_;
+    return false;
+  }
+
+  AINFO << "Start: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
+  if (!FillInput(frame, 0)) {
+    AERROR << "Failed to fill the input image.";
+    return false;
+  }
+  AINFO << "Resize: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
+
+  /////////////////////////// detection part ///////////////////////////
+  inference_->Infer();
+  AINFO << "Infer: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
+
+  FillObjects(frame, 0);
+  AINFO << "Post: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
+
+  return true;
+}
+
+bool YoloObstacleDetector::DetectBatch(
+    const ObstacleDetectorOptions &options,
+    const std::vector<CameraFrame *> &frames) {
+  for (auto frame : frames) {
+    if (frame == nullptr) {
+      return false;
+    }
+  }
+
+  Timer timer;
+  if (cudaSetDevice(gpu_id_) != cudaSuccess) {
+    AERROR << "Failed to set device to " << gpu_id_;
+    return false;
+  }
+
+  const int num_frames = static_cast<int>(frames.size());
+  for (int start = 0; start < num_frames; start += max_batch_size_) {
+    const int end = std::min(start + max_batch_size_, num_frames);
+    for (int i = start; i < end; ++i) {
+      if (!FillInput(frames[i], i - start)) {
+        AERROR << "Failed to fill the input image of frame "
+               << frames[i]->frame_id;
+        return false;
+      }
+    }
+    // the input slots after end keep older images, their outputs are unused
+    inference_->Infer();
+    for (int i = start; i < end; ++i) {
+      FillObjects(frames[i], i - start);
+    }
+  }
+  AINFO << "DetectBatch " << num_frames << " frames: "
+        << static_cast<double>(timer.Toc()) * 0.001 << "ms";
 
   return true;
 }
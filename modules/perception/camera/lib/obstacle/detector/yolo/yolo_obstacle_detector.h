@@ -51,6 +51,9 @@ class YoloObstacleDetector : public BaseObstacleDetector {
 
   bool Detect(const ObstacleDetectorOptions &options,
               CameraFrame *frame) override;
+  // @brief: detect the frames with one inference per max_batch_size frames
+  bool DetectBatch(const ObstacleDetectorOptions &options,
+                   const std::vector<CameraFrame *> &frames) override;
   std::string Name() const override {
     return "YoloObstacleDetector";
   }
@@ -62,6 +65,11 @@ class YoloObstacleDetector : public BaseObstacleDetector {
                const std::string &model_root);
   void InitYoloBlob(const yolo::NetworkParam &net_param);
   bool InitFeatureExtractor(const std::string &root_dir);
+  // @brief: crop, undistort and resize the image of frame into the
+  // batch_id-th input in one pass
+  bool FillInput(CameraFrame *frame, int batch_id);
+  // @brief: decode the batch_id-th outputs into the objects of frame
+  void FillObjects(CameraFrame *frame, int batch_id);
 
  private:
   std::shared_ptr<BaseFeatureExtractor> feature_extractor_;
@@ -79,6 +87,7 @@ class YoloObstacleDetector : public BaseObstacleDetector {
   int width_ = 0;
   int offset_y_ = 0;
   int gpu_id_ = 0;
+  int max_batch_size_ = 1;
   int obj_k_ = kMaxObjSize;
 
   int ori_cycle_ = 1;
@@ -88,7 +97,6 @@ class YoloObstacleDetector : public BaseObstacleDetector {
   MinDims min_dims_;
   YoloBlobs yolo_blobs_;
 
-  std::shared_ptr<base::Image8U> image_ = nullptr;
   std::shared_ptr<base::Blob<bool>> overlapped_ = nullptr;
   std::shared_ptr<base::Blob<int>> idx_sm_ = nullptr;
 
@@ -17,6 +17,7 @@
 
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
+#include "cyber/task/task_group.h"
 #include "modules/perception/camera/common/global_config.h"
 #include "modules/perception/camera/lib/interface/base_calibration_service.h"
 
@@ -26,6 +27,11 @@ namespace apollo {
 namespace perception {
 namespace camera {
 
+namespace {
+// each object takes a few iterations of projections to refine
+constexpr size_t kObjectGrainSize = 2;
+}  // namespace
+
 bool LocationRefinerObstaclePostprocessor::Init(
     const ObstaclePostprocessorInitOptions &options) {
   std::string postprocessor_config = cyber::common::GetAbsolutePath(
@@ -80,11 +86,16 @@ bool LocationRefinerObstaclePostprocessor::Process(
   const int width_image = frame->data_provider->src_width();
   const int height_image = frame->data_provider->src_height();
   postprocessor_->Init(k_mat, width_image, height_image);
-  ObjPostProcessorOptions obj_postprocessor_options;
 
-  int nr_valid_obj = 0;
-  for (auto &obj : frame->detected_objects) {
-    ++nr_valid_obj;
+  // the same for all the objects of the frame
+  const Eigen::Matrix3f camera_k_matrix_inv = camera_k_matrix.inverse();
+  const float h_down = (static_cast<float>(height_image) - k_mat[5])
+      * location_refiner_param_.roi_h2bottom_scale();
+  const Eigen::Affine3d &camera2world_pose = frame->camera2world_pose;
+
+  cyber::ParallelFor(0, frame->detected_objects.size(), kObjectGrainSize,
+                     [&](size_t i) {
+    auto &obj = frame->detected_objects[i];
     float object_center[3] = {obj->camera_supplement.local_center(0),
                               obj->camera_supplement.local_center(1),
                               obj->camera_supplement.local_center(2)};
@@ -95,8 +106,6 @@ bool LocationRefinerObstaclePostprocessor::Process(
         obj->camera_supplement.box.ymax};
 
     float bottom_center[2] = {(bbox2d[0] + bbox2d[2]) / 2, bbox2d[3]};
-    float h_down = (static_cast<float>(height_image) - k_mat[5])
-        * location_refiner_param_.roi_h2bottom_scale();
     bool is_in_rule_roi = is_in_roi(bottom_center,
                                     static_cast<float>(width_image),
                                     static_cast<float>(height_image),
@@ -108,7 +117,7 @@ bool LocationRefinerObstaclePostprocessor::Process(
     if (dist2camera > location_refiner_param_.min_dist_to_camera()
         || !is_in_rule_roi) {
       ADEBUG << "Pass for obstacle postprocessor.";
-      continue;
+      return;
     }
 
     float dimension_hwl[3] = {obj->size(2),
@@ -117,8 +126,7 @@ bool LocationRefinerObstaclePostprocessor::Process(
     float box_cent_x = (bbox2d[0] + bbox2d[2]) / 2;
     Eigen::Vector3f image_point_low_center(box_cent_x, bbox2d[3], 1);
     Eigen::Vector3f point_in_camera =
-      static_cast<Eigen::Matrix<float, 3, 1, 0, 3, 1>>
-      (camera_k_matrix.inverse() * image_point_low_center);
+      camera_k_matrix_inv * image_point_low_center;
     float theta_ray =
           static_cast<float>(atan2(point_in_camera.x(), point_in_camera.z()));
     float rotation_y =
@@ -132,7 +140,8 @@ bool LocationRefinerObstaclePostprocessor::Process(
       rotation_y -= 2 * PI;
     }
 
-    // process
+    // process, with the bottom line segment of this object only
+    ObjPostProcessorOptions obj_postprocessor_options;
     memcpy(obj_postprocessor_options.bbox, bbox2d, sizeof(float) * 4);
     obj_postprocessor_options.check_lowerbound = true;
     camera::LineSegment2D<float> line_seg(bbox2d[0],
@@ -168,11 +177,11 @@ bool LocationRefinerObstaclePostprocessor::Process(
     obj->center(0) = static_cast<double>(object_center[0]);
     obj->center(1) = static_cast<double>(object_center[1]);
     obj->center(2) = static_cast<double>(object_center[2]);
-    obj->center = frame->camera2world_pose * obj->center;
+    obj->center = camera2world_pose * obj->center;
 
     AINFO << "diff on camera z: " << z_diff_camera;
     AINFO << "Obj center from postprocessor: " << obj->center.transpose();
-  }
+  });
   return true;
 }
 
@@ -46,6 +46,37 @@ bool CosineSimilar::Calc(CameraFrame *frame1,
   return true;
 }
 
+bool CosineSimilar::CalcBatch(const std::vector<CameraFrame *> &frames1,
+                              CameraFrame *frame2,
+                              base::Blob<float> *sim) {
+  int rows = 0;
+  for (auto *frame1 : frames1) {
+    rows += static_cast<int>(frame1->detected_objects.size());
+  }
+  auto m = frame2->detected_objects.size();
+  if (rows == 0 || m == 0) {
+    return false;
+  }
+  sim->Reshape({rows, static_cast<int>(m)});
+  float *sim_data = sim->mutable_cpu_data();
+  auto dim = frame2->detected_objects[0]
+      ->camera_supplement.object_feature.size();
+  for (auto *frame1 : frames1) {
+    for (auto &object1 : frame1->detected_objects) {
+      for (auto &object2 : frame2->detected_objects) {
+        float s = 0.0f;
+        for (size_t k = 0; k < dim; ++k) {
+          s += object1->camera_supplement.object_feature[k]
+              * object2->camera_supplement.object_feature[k];
+        }
+        *sim_data = s;
+        ++sim_data;
+      }
+    }
+  }
+  return true;
+}
+
 }  // namespace camera
 }  // namespace perception
 }  // namespace apollo
@@ -59,6 +59,59 @@ bool GPUSimilar::Calc(CameraFrame *frame1,
   return true;
 }
 
+bool GPUSimilar::CalcBatch(const std::vector<CameraFrame *> &frames1,
+                           CameraFrame *frame2,
+                           base::Blob<float> *sim) {
+  int rows = 0;
+  for (auto *frame1 : frames1) {
+    rows += static_cast<int>(frame1->detected_objects.size());
+  }
+  int m = static_cast<int>(frame2->detected_objects.size());
+  if (rows == 0 || m == 0) {
+    return false;
+  }
+  if (frame2->track_feature_blob == nullptr) {
+    AERROR << "No feature blob";
+    return false;
+  }
+  int dim = frame2->track_feature_blob->count(1);
+  sim->Reshape({rows, m});
+  features_.Reshape({rows, dim});
+
+  // device to device copies, which do not wait for the device
+  float *stacked = features_.mutable_gpu_data();
+  for (auto *frame1 : frames1) {
+    int n = static_cast<int>(frame1->detected_objects.size());
+    if (n == 0) {
+      continue;
+    }
+    if (frame1->track_feature_blob == nullptr) {
+      AERROR << "No feature blob";
+      return false;
+    }
+    assert(dim == frame1->track_feature_blob->count(1));
+    BASE_CUDA_CHECK(cudaMemcpy(stacked,
+                               frame1->track_feature_blob->gpu_data(),
+                               n * dim * sizeof(float),
+                               cudaMemcpyDeviceToDevice));
+    stacked += n * dim;
+  }
+
+  float *s = sim->mutable_gpu_data();
+  float const *feature2 = frame2->track_feature_blob->gpu_data();
+  inference::GPUGemmFloat(CblasNoTrans,
+               CblasTrans,
+               rows,
+               m,
+               dim,
+               1.0,
+               features_.gpu_data(),
+               feature2,
+               0.0,
+               s);
+  return true;
+}
+
 }  // namespace camera
 }  // namespace perception
 }  // namespace apollo
@@ -15,6 +15,8 @@
 *****************************************************************************/
 #pragma once
 
+#include <vector>
+
 #include "modules/perception/camera/common/camera_frame.h"
 
 namespace apollo {
@@ -26,6 +28,15 @@ class BaseSimilar {
   virtual bool Calc(CameraFrame *frame1,
                     CameraFrame *frame2,
                     base::Blob<float> *sim) = 0;
+
+  // @brief: similarities of the objects of several frames, stacked in the
+  //         order of the frames, to the objects of one frame, in one pass.
+  // @param [in]: frames1, the frames of the rows
+  // @param [in]: frame2, the frame of the columns
+  // @param [out]: sim, the objects of all frames1 x the objects of frame2
+  virtual bool CalcBatch(const std::vector<CameraFrame *> &frames1,
+                         CameraFrame *frame2,
+                         base::Blob<float> *sim) = 0;
 };
 
 class CosineSimilar : public BaseSimilar {
@@ -35,6 +46,10 @@ class CosineSimilar : public BaseSimilar {
   bool Calc(CameraFrame *frame1,
             CameraFrame *frame2,
             base::Blob<float> *sim) override;
+
+  bool CalcBatch(const std::vector<CameraFrame *> &frames1,
+                 CameraFrame *frame2,
+                 base::Blob<float> *sim) override;
 };
 
 class GPUSimilar : public BaseSimilar {
@@ -42,6 +57,15 @@ class GPUSimilar : public BaseSimilar {
   bool Calc(CameraFrame *frame1,
             CameraFrame *frame2,
             base::Blob<float> *sim) override;
+
+  // one gemm of the stacked features of frames1 against those of frame2
+  bool CalcBatch(const std::vector<CameraFrame *> &frames1,
+                 CameraFrame *frame2,
+                 base::Blob<float> *sim) override;
+
+ private:
+  // the features of frames1, stacked on the device
+  base::Blob<float> features_;
 };
 }  // namespace camera
 }  // namespace perception
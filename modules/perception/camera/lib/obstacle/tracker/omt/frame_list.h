@@ -91,13 +91,46 @@ struct SimilarMap {
     return map_sim[frame1 % dim][frame2 % dim];
   }
 
+  // @brief: keep the similarities of frames1 to frame2 computed in one
+  //         BaseSimilar::CalcBatch, which sim() prefers over the pairs.
+  //         The blob is synced to the host here, so that sim() only reads.
+  void SetBatch(const std::vector<CameraFrame *> &frames1,
+                const CameraFrame *frame2,
+                std::shared_ptr<base::Blob<float>> sim) {
+    batch_sim = sim;
+    batch_data = sim->cpu_data();
+    batch_cols = static_cast<int>(frame2->detected_objects.size());
+    batch_frame2 = frame2->frame_id;
+    batch_frame1.assign(dim, -1);
+    batch_row.assign(dim, 0);
+    int row = 0;
+    for (auto *frame1 : frames1) {
+      batch_frame1[frame1->frame_id % dim] = frame1->frame_id;
+      batch_row[frame1->frame_id % dim] = row;
+      row += static_cast<int>(frame1->detected_objects.size());
+    }
+  }
+
   float sim(const PatchIndicator &p1, const PatchIndicator &p2) const {
+    if (batch_data != nullptr && p2.frame_id == batch_frame2 &&
+        batch_frame1[p1.frame_id % dim] == p1.frame_id) {
+      int row = batch_row[p1.frame_id % dim] + p1.patch_id;
+      return batch_data[row * batch_cols + p2.patch_id];
+    }
     auto blob = get(p1.frame_id, p2.frame_id);
     return *(blob->cpu_data() + blob->offset(p1.patch_id, p2.patch_id));
   }
 
   std::vector<std::vector<std::shared_ptr<base::Blob<float> > > > map_sim;
   int dim;
+
+  // the last batch, rows of the frames in batch_frame1 from batch_row on
+  std::shared_ptr<base::Blob<float> > batch_sim;
+  const float *batch_data = nullptr;
+  int batch_cols = 0;
+  int batch_frame2 = -1;
+  std::vector<int> batch_frame1;
+  std::vector<int> batch_row;
 };
 
 class FrameList {
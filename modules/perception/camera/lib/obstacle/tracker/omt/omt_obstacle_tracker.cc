@@ -19,6 +19,7 @@
 #include <functional>
 
 #include "cyber/common/file.h"
+#include "cyber/task/task_group.h"
 #include "modules/perception/base/point.h"
 #include "modules/perception/camera/common/global_config.h"
 #include "modules/perception/camera/common/math_functions.h"
@@ -31,6 +32,11 @@ namespace camera {
 
 using cyber::common::GetAbsolutePath;
 
+namespace {
+// targets handed to a task worker at a time
+constexpr size_t kTargetGrainSize = 4;
+}  // namespace
+
 bool OMTObstacleTracker::Init(const ObstacleTrackerInitOptions &options) {
   std::string omt_config = GetAbsolutePath(options.root_dir, options.conf_file);
   if (!cyber::common::GetProtoFromFile(omt_config, &omt_param_)) {
@@ -52,6 +58,8 @@ bool OMTObstacleTracker::Init(const ObstacleTrackerInitOptions &options) {
   gpu_id_ = options.gpu_id;
   similar_map_.Init(omt_param_.img_capability(), gpu_id_);
   similar_.reset(new GPUSimilar);
+  // pinned, so that the similarities come back to the host quickly
+  batch_sim_.reset(new base::Blob<float>(true));
   width_ = options.image_width;
   height_ = options.image_height;
   reference_.Init(omt_param_.reference(), width_, height_);
@@ -170,10 +178,12 @@ bool OMTObstacleTracker::CombineDuplicateTargets() {
 }
 
 void OMTObstacleTracker::GenerateHypothesis(const TrackObjectPtrs &objects) {
-  std::vector<Hypothesis> score_list;
-  Hypothesis hypo;
-  for (size_t i = 0; i < targets_.size(); ++i) {
+  // the targets are scored in parallel, each into its own list, and the
+  // lists are joined in the order of the targets to keep the sort stable
+  std::vector<std::vector<Hypothesis>> target_scores(targets_.size());
+  cyber::ParallelFor(0, targets_.size(), kTargetGrainSize, [&](size_t i) {
     ADEBUG << "Target " << targets_[i].id;
+    Hypothesis hypo;
     for (size_t j = 0; j < objects.size(); ++j) {
       hypo.target = static_cast<int>(i);
       hypo.object = static_cast<int>(j);
@@ -207,8 +217,12 @@ void OMTObstacleTracker::GenerateHypothesis(const TrackObjectPtrs &objects) {
       if (sm < 0.045 || hypo.score < omt_param_.target_thresh()) {
         continue;
       }
-      score_list.push_back(hypo);
+      target_scores[i].push_back(hypo);
     }
+  });
+  std::vector<Hypothesis> score_list;
+  for (auto &scores : target_scores) {
+    score_list.insert(score_list.end(), scores.begin(), scores.end());
   }
 
   sort(score_list.begin(),
@@ -307,8 +321,9 @@ void ProjectBox(const base::BBox2DF &box_origin,
 
 bool OMTObstacleTracker::Predict(const ObstacleTrackerOptions &options,
                                  CameraFrame *frame) {
+  cyber::ParallelFor(0, targets_.size(), kTargetGrainSize,
+                     [this, frame](size_t i) { targets_[i].Predict(frame); });
   for (auto &target : targets_) {
-    target.Predict(frame);
     auto obj = target.latest_object;
     frame->proposed_objects.push_back(obj->object);
   }
@@ -364,11 +379,13 @@ bool OMTObstacleTracker::Associate2D(const ObstacleTrackerOptions &options,
                                      CameraFrame *frame) {
   inference::CudaUtil::set_device_id(gpu_id_);
   frame_list_.Add(frame);
+  // the features of all the kept frames against the new one in one gemm
+  std::vector<CameraFrame *> frames1;
   for (int t = 0; t < frame_list_.Size(); t++) {
-    int frame1 = frame_list_[t]->frame_id;
-    int frame2 = frame_list_[-1]->frame_id;
-    similar_->Calc(frame_list_[frame1], frame_list_[frame2],
-                   similar_map_.get(frame1, frame2).get());
+    frames1.push_back(frame_list_[frame_list_[t]->frame_id]);
+  }
+  if (similar_->CalcBatch(frames1, frame, batch_sim_.get())) {
+    similar_map_.SetBatch(frames1, frame, batch_sim_);
   }
 
   for (auto &target : targets_) {
@@ -399,7 +416,9 @@ bool OMTObstacleTracker::Associate2D(const ObstacleTrackerOptions &options,
   int new_count = CreateNewTarget(track_objects);
   AINFO << "Create " << new_count << " new target";
 
-  for (auto &target : targets_) {
+  cyber::ParallelFor(0, targets_.size(), kTargetGrainSize,
+                     [this, frame](size_t i) {
+    Target &target = targets_[i];
     if (target.lost_age > omt_param_.reserve_age()) {
       AINFO << "Target " << target.id << " is lost";
       target.Clear();
@@ -407,7 +426,7 @@ bool OMTObstacleTracker::Associate2D(const ObstacleTrackerOptions &options,
       target.UpdateType(frame);
       target.Update2D(frame);
     }
-  }
+  });
 
   CombineDuplicateTargets();
   ClearTargets();
@@ -480,8 +499,9 @@ bool OMTObstacleTracker::Associate3D(const ObstacleTrackerOptions &options,
     targets_[targets_.size() - j - 1].Update2D(frame);
     targets_[targets_.size() - j - 1].UpdateType(frame);
   }
+  cyber::ParallelFor(0, targets_.size(), kTargetGrainSize,
+                     [this, frame](size_t i) { targets_[i].Update3D(frame); });
   for (Target &target : targets_) {
-    target.Update3D(frame);
     if (!target.isLost()) {
       frame->tracked_objects.push_back(target[-1]->object);
       ADEBUG << "Target " << target.id << " velocity: "
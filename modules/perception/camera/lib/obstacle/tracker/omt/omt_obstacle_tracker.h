@@ -125,6 +125,7 @@ class OMTObstacleTracker : public BaseObstacleTracker {
   omt::OmtParam omt_param_;
   FrameList frame_list_;
   SimilarMap similar_map_;
+  std::shared_ptr<base::Blob<float>> batch_sim_ = nullptr;
   std::shared_ptr<BaseSimilar> similar_ = nullptr;
   std::vector<Target> targets_;
   std::vector<bool> used_;
@@ -15,14 +15,22 @@
 *****************************************************************************/
 #include "modules/perception/camera/lib/obstacle/transformer/multicue/multicue_obstacle_transformer.h"
 
+#include <atomic>
+
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
+#include "cyber/task/task_group.h"
 #include "modules/perception/camera/common/global_config.h"
 
 namespace apollo {
 namespace perception {
 namespace camera {
 
+namespace {
+// each object takes a few hundred projections to solve
+constexpr size_t kObjectGrainSize = 2;
+}  // namespace
+
 bool MultiCueObstacleTransformer::Init(
     const ObstacleTransformerInitOptions &options) {
   std::string transformer_config = cyber::common::GetAbsolutePath(
@@ -43,8 +51,9 @@ bool MultiCueObstacleTransformer::Init(
 }
 
 void MultiCueObstacleTransformer::SetObjMapperOptions(
-     base::ObjectPtr obj, Eigen::Matrix3f camera_k_matrix, int width_image,
-    int height_image, ObjMapperOptions *obj_mapper_options, float *theta_ray) {
+    const base::ObjectPtr &obj, const Eigen::Matrix3f &camera_k_matrix_inv,
+    int width_image, int height_image, ObjMapperOptions *obj_mapper_options,
+    float *theta_ray) const {
   // prepare bbox2d
   float bbox2d[4] = {
       obj->camera_supplement.box.xmin, obj->camera_supplement.box.ymin,
@@ -64,8 +73,7 @@ void MultiCueObstacleTransformer::SetObjMapperOptions(
   float box_cent_x = (bbox2d[0] + bbox2d[2]) / 2;
   Eigen::Vector3f image_point_low_center(box_cent_x, bbox2d[3], 1);
   Eigen::Vector3f point_in_camera =
-      static_cast<Eigen::Matrix<float, 3, 1, 0, 3, 1>>
-      (camera_k_matrix.inverse() * image_point_low_center);
+      camera_k_matrix_inv * image_point_low_center;
   *theta_ray = static_cast<float>(atan2(point_in_camera.x(),
                                   point_in_camera.z()));
   float rotation_y = *theta_ray +
@@ -96,7 +104,7 @@ void MultiCueObstacleTransformer::SetObjMapperOptions(
 }
 
 int MultiCueObstacleTransformer::MatchTemplates(base::ObjectSubType sub_type,
-                                                float *dimension_hwl) {
+                                                float *dimension_hwl) const {
   const TemplateMap &kMinTemplateHWL =
       object_template_manager_->MinTemplateHWL();
   const TemplateMap &kMidTemplateHWL =
@@ -168,7 +176,8 @@ int MultiCueObstacleTransformer::MatchTemplates(base::ObjectSubType sub_type,
 
 void MultiCueObstacleTransformer::FillResults(
     float object_center[3], float dimension_hwl[3], float rotation_y,
-    Eigen::Affine3d camera2world_pose, float theta_ray, base::ObjectPtr obj) {
+    const Eigen::Affine3d &camera2world_pose, float theta_ray,
+    const ObjMapper &mapper, base::ObjectPtr obj) const {
 
   object_center[1] -= dimension_hwl[0] / 2;
   obj->camera_supplement.local_center(0) = object_center[0];
@@ -190,7 +199,7 @@ void MultiCueObstacleTransformer::FillResults(
   obj->size(1) = dimension_hwl[1];
   obj->size(0) = dimension_hwl[2];
 
-  Eigen::Matrix3d pos_var = mapper_->get_position_uncertainty();
+  Eigen::Matrix3d pos_var = mapper.get_position_uncertainty();
   obj->center_uncertainty(0) = static_cast<float>(pos_var(0));
   obj->center_uncertainty(1) = static_cast<float>(pos_var(1));
   obj->center_uncertainty(2) = static_cast<float>(pos_var(2));
@@ -202,7 +211,7 @@ void MultiCueObstacleTransformer::FillResults(
   obj->direction[1] = static_cast<float>(dir[1]);
   obj->direction[2] = static_cast<float>(dir[2]);
   obj->theta = static_cast<float>(atan2(dir[1], dir[0]));
-  obj->theta_variance = static_cast<float>((mapper_->get_orientation_var())(0));
+  obj->theta_variance = static_cast<float>((mapper.get_orientation_var())(0));
 
   obj->camera_supplement.alpha = rotation_y - theta_ray;
 
@@ -236,35 +245,42 @@ bool MultiCueObstacleTransformer::Transform(
   const int width_image = frame->data_provider->src_width();
   const int height_image = frame->data_provider->src_height();
   const auto &camera2world_pose = frame->camera2world_pose;
-  mapper_->Init(k_mat, width_image, height_image);
-
-  ObjMapperOptions obj_mapper_options;
-  float object_center[3] = {0};
-  float dimension_hwl[3] = {0};
-  float rotation_y = 0.0f;
+  // the same for all the objects of the frame
+  const Eigen::Matrix3f camera_k_matrix_inv = camera_k_matrix.inverse();
 
-  int nr_transformed_obj = 0;
-  for (auto &obj : frame->detected_objects) {
+  const size_t nr_obj = frame->detected_objects.size();
+  if (mappers_.size() < nr_obj) {
+    mappers_.resize(nr_obj);
+  }
+  std::atomic<int> nr_transformed_obj(0);
+  cyber::ParallelFor(0, nr_obj, kObjectGrainSize, [&](size_t i) {
+    const auto &obj = frame->detected_objects[i];
     if (obj == nullptr) {
       ADEBUG << "Empty object input to transformer.";
-      continue;
+      return;
     }
+    ObjMapper &mapper = mappers_[i];
+    mapper.Init(k_mat, width_image, height_image);
 
     // set object mapper options
+    ObjMapperOptions obj_mapper_options;
     float theta_ray = 0.0f;
-    SetObjMapperOptions(obj, camera_k_matrix, width_image, height_image,
+    SetObjMapperOptions(obj, camera_k_matrix_inv, width_image, height_image,
                         &obj_mapper_options, &theta_ray);
 
     // process
-    mapper_->Solve3dBbox(obj_mapper_options, object_center, dimension_hwl,
-                         &rotation_y);
+    float object_center[3] = {0};
+    float dimension_hwl[3] = {0};
+    float rotation_y = 0.0f;
+    mapper.Solve3dBbox(obj_mapper_options, object_center, dimension_hwl,
+                       &rotation_y);
 
     // fill back results
     FillResults(object_center, dimension_hwl, rotation_y, camera2world_pose,
-                theta_ray, obj);
+                theta_ray, mapper, obj);
 
     ++nr_transformed_obj;
-  }
+  });
   return nr_transformed_obj > 0;
 }
 
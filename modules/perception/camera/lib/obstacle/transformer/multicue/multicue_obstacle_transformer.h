@@ -31,14 +31,9 @@ namespace camera {
 
 class MultiCueObstacleTransformer : public BaseObstacleTransformer {
  public:
-  MultiCueObstacleTransformer() : BaseObstacleTransformer() {
-    mapper_ = new ObjMapper;
-  }
+  MultiCueObstacleTransformer() : BaseObstacleTransformer() {}
 
-  virtual ~MultiCueObstacleTransformer() {
-    delete mapper_;
-    mapper_ = nullptr;
-  }
+  virtual ~MultiCueObstacleTransformer() = default;
   bool Init(const ObstacleTransformerInitOptions &options =
                 ObstacleTransformerInitOptions()) override;
 
@@ -51,20 +46,23 @@ class MultiCueObstacleTransformer : public BaseObstacleTransformer {
   std::string Name() const override;
 
  private:
-  void SetObjMapperOptions(base::ObjectPtr obj, Eigen::Matrix3f camera_k_matrix,
+  void SetObjMapperOptions(const base::ObjectPtr &obj,
+                           const Eigen::Matrix3f &camera_k_matrix_inv,
                            int width_image, int height_image,
                            ObjMapperOptions *obj_mapper_options,
-                           float *theta_ray);
-  int MatchTemplates(base::ObjectSubType sub_type, float *dimension_hwl);
+                           float *theta_ray) const;
+  int MatchTemplates(base::ObjectSubType sub_type, float *dimension_hwl) const;
   void FillResults(float object_center[3], float dimension_hwl[3],
-                   float rotation_y, Eigen::Affine3d camera2world_pose,
-                   float theta_ray, base::ObjectPtr obj);
+                   float rotation_y, const Eigen::Affine3d &camera2world_pose,
+                   float theta_ray, const ObjMapper &mapper,
+                   base::ObjectPtr obj) const;
 
  private:
   multicue::MulticueParam multicue_param_;
   int image_width_ = 0;
   int image_height_ = 0;
-  ObjMapper *mapper_ = nullptr;
+  // one mapper per object of the frame, the objects are solved in parallel
+  std::vector<ObjMapper> mappers_;
 
  protected:
   ObjectTemplateManager *object_template_manager_ = nullptr;
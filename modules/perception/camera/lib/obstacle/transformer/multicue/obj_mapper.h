@@ -96,9 +96,11 @@ class ObjMapper {
     return ry_score_;
   }
 
-  Eigen::Vector3d get_orientation_var() { return orientation_variance_; }
+  Eigen::Vector3d get_orientation_var() const { return orientation_variance_; }
 
-  Eigen::Matrix3d get_position_uncertainty() { return position_uncertainty_; }
+  Eigen::Matrix3d get_position_uncertainty() const {
+    return position_uncertainty_;
+  }
 
   // main interface, center is the bottom-face center ("center" for short)
   bool Solve3dBbox(const ObjMapperOptions &options, float center[3],
@@ -15,6 +15,7 @@
 *****************************************************************************/
 #include "modules/perception/camera/lib/traffic_light/detector/recognition/classify.h"
 
+#include <algorithm>
 #include <map>
 
 #include "cyber/common/file.h"
@@ -90,10 +91,14 @@ void ClassifyBySimple::Init(
     p[2] = model_config.mean_b();
   }
   scale_ = model_config.scale();
+  max_batch_size_ = std::max(model_config.max_batch_size(), 1);
 
   std::vector<int> shape = {1, resize_height_, resize_width_, 3};
   mean_buffer_.reset(new base::Blob<float>(shape));
 
+  // the net is sized for a full batch, Perform shrinks the input blob to
+  // the number of lights of each call
+  shape[0] = max_batch_size_;
   std::map<std::string, std::vector<int>>
       input_reshape{{net_inputs_[0], shape}};
   AINFO << "input_reshape: "
@@ -119,41 +124,54 @@ ClassifyBySimple::Perform(const CameraFrame* frame,
     AERROR << "Failed to set device to " << gpu_id_;
     return;
   }
-  std::shared_ptr<base::Blob<uint8_t>> rectified_blob;
   auto input_blob_recog = rt_net_->get_blob(net_inputs_[0]);
   auto output_blob_recog = rt_net_->get_blob(net_outputs_[0]);
 
+  std::vector<base::TrafficLightPtr> detected_lights;
+  detected_lights.reserve(lights->size());
   for (base::TrafficLightPtr light : *lights) {
-    if (!light->region.is_detected) {
-      continue;
+    if (light->region.is_detected) {
+      detected_lights.push_back(light);
     }
+  }
+
+  const float* mean = mean_.get()->cpu_data();
+  data_provider_image_option_.do_crop = true;
+  data_provider_image_option_.target_color = base::Color::BGR;
+  for (size_t start = 0; start < detected_lights.size();
+       start += max_batch_size_) {
+    const int batch_num = static_cast<int>(std::min(
+        detected_lights.size() - start, static_cast<size_t>(max_batch_size_)));
+    input_blob_recog->Reshape(batch_num, resize_height_, resize_width_, 3);
+
+    for (int i = 0; i < batch_num; ++i) {
+      const base::TrafficLightPtr &light = detected_lights[start + i];
+      data_provider_image_option_.crop_roi = light->region.detection_roi;
+      frame->data_provider->GetImage(data_provider_image_option_,
+                                     image_.get());
+      inference::ResizeGPU(*image_,
+                input_blob_recog,
+                frame->data_provider->src_width(),
+                i,
+                mean[0],
+                mean[1],
+                mean[2],
+                true,
+                scale_);
+    }
+    AINFO << "resize gpu finish, batch size " << batch_num;
 
-    data_provider_image_option_.crop_roi = light->region.detection_roi;
-    data_provider_image_option_.do_crop = true;
-    data_provider_image_option_.target_color = base::Color::BGR;
-    frame->data_provider->GetImage(data_provider_image_option_, image_.get());
-
-    AINFO << "get img done";
-
-    const float* mean = mean_.get()->cpu_data();
-    inference::ResizeGPU(*image_,
-              input_blob_recog,
-              frame->data_provider->src_width(),
-              0,
-              mean[0],
-              mean[1],
-              mean[2],
-              true,
-              scale_);
-
-    AINFO << "resize gpu finish.";
     cudaDeviceSynchronize();
     rt_net_->Infer();
     cudaDeviceSynchronize();
     AINFO << "infer finish.";
 
-     float *out_put_data = output_blob_recog->mutable_cpu_data();
-     Prob2Color(out_put_data, unknown_threshold_, light);
+    const float *out_put_data = output_blob_recog->cpu_data();
+    const int out_put_step = output_blob_recog->count(1);
+    for (int i = 0; i < batch_num; ++i) {
+      Prob2Color(out_put_data + i * out_put_step, unknown_threshold_,
+                 detected_lights[start + i]);
+    }
   }
 }
 
@@ -39,6 +39,8 @@ class ClassifyBySimple {
             const int gpu_id,
             const std::string work_root);
 
+  // @brief: recognize the detected lights, all crops of a batch go through
+  // a single inference call
   void Perform(const CameraFrame* frame,
                std::vector<base::TrafficLightPtr> *lights);
 
@@ -54,6 +56,7 @@ class ClassifyBySimple {
   std::vector<std::string> net_outputs_;
   int resize_width_;
   int resize_height_;
+  int max_batch_size_ = 1;
   float unknown_threshold_;
   float scale_;
   int gpu_id_ = 0;
@@ -15,6 +15,8 @@
 *****************************************************************************/
 #include "modules/perception/camera/lib/traffic_light/preprocessor/tl_preprocessor.h"
 
+#include <Eigen/Geometry>
+
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
 #include "modules/perception/camera/common/util.h"
@@ -37,6 +39,9 @@ bool TLPreprocessor::Init(const TrafficLightPreprocessorInitOptions& options) {
   lights_on_image_array_.resize(num_cameras_);
   lights_outside_image_array_.resize(num_cameras_);
   sync_interval_seconds_ = options.sync_interval_seconds;
+  projection_cache_max_translation_ = options.projection_cache_max_translation;
+  projection_cache_max_rotation_ = options.projection_cache_max_rotation;
+  projection_caches_.clear();
 
   AINFO << "preprocessor init succeed";
 
@@ -276,10 +281,36 @@ bool TLPreprocessor::ProjectLights(
     return true;
   }
 
+  ProjectionCache *cache = nullptr;
+  Eigen::Matrix4d c2w_pose;
+  if (pose.GetCameraPose(camera_name, &c2w_pose)) {
+    cache = GetProjectionCache(camera_name, c2w_pose);
+  }
+
   for (size_t i = 0; i < lights->size(); ++i) {
     base::TrafficLightPtr light_proj(new base::TrafficLight);
     auto light = lights->at(i);
-    if (!projection_.Project(pose, ProjectOption(camera_name), light.get())) {
+    bool on_image = false;
+    bool cached = false;
+    if (cache != nullptr) {
+      auto iter = cache->rois.find(light->id);
+      if (iter != cache->rois.end()) {
+        cached = true;
+        on_image = iter->second.first;
+        if (on_image) {
+          light->region.projection_roi = iter->second.second;
+        }
+      }
+    }
+    if (!cached) {
+      on_image =
+          projection_.Project(pose, ProjectOption(camera_name), light.get());
+      if (cache != nullptr) {
+        cache->rois[light->id] =
+            std::make_pair(on_image, light->region.projection_roi);
+      }
+    }
+    if (!on_image) {
       light->region.outside_image = true;
       *light_proj = *light;
       lights_outside_image->push_back(light_proj);
@@ -292,6 +323,29 @@ bool TLPreprocessor::ProjectLights(
   return true;
 }
 
+TLPreprocessor::ProjectionCache *TLPreprocessor::GetProjectionCache(
+    const std::string &camera_name, const Eigen::Matrix4d &c2w_pose) {
+  if (projection_cache_max_translation_ <= 0.0 ||
+      projection_cache_max_rotation_ <= 0.0) {
+    return nullptr;
+  }
+  ProjectionCache &cache = projection_caches_[camera_name];
+  const Eigen::Matrix3d rotation = c2w_pose.block<3, 3>(0, 0);
+  const Eigen::Vector3d translation = c2w_pose.block<3, 1>(0, 3);
+  if (cache.valid &&
+      (translation - cache.translation).norm() <=
+          projection_cache_max_translation_ &&
+      Eigen::AngleAxisd(cache.rotation.transpose() * rotation).angle() <=
+          projection_cache_max_rotation_) {
+    return &cache;
+  }
+  cache.valid = true;
+  cache.rotation = rotation;
+  cache.translation = translation;
+  cache.rois.clear();
+  return &cache;
+}
+
 bool TLPreprocessor::ProjectLightsAndSelectCamera(
         const CarPose& pose,
         const TLPreprocessorOption& option,
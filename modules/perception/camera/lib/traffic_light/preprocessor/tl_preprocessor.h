@@ -36,6 +36,10 @@ struct TrafficLightPreprocessorInitOptions : public BaseInitOptions {
   int gpu_id = 0;
   float sync_interval_seconds;
   std::vector<std::string> camera_names;
+  // projections of a camera are reused while its pose moved less than these
+  // since they were computed, 0 disables the cache
+  float projection_cache_max_translation = 0.0f;  // meters
+  float projection_cache_max_rotation = 0.0f;     // radians
 };
 
 struct TLPreprocessorOption {
@@ -93,6 +97,20 @@ class TLPreprocessor {
   std::string GetMinFocalLenWorkingCameraName() const;
   std::string GetMaxFocalLenWorkingCameraName() const;
 
+  // @brief: cached projection results of one camera, keyed by signal id
+  struct ProjectionCache {
+    bool valid = false;
+    // camera to world pose the cached projections were computed with
+    Eigen::Matrix3d rotation = Eigen::Matrix3d::Identity();
+    Eigen::Vector3d translation = Eigen::Vector3d::Zero();
+    // <signal id, <is on image, projection roi>>
+    std::map<std::string, std::pair<bool, base::RectI>> rois;
+  };
+  // @brief: the cache of camera_name, reset if c2w_pose moved too far from
+  // the pose the cached projections were computed with, nullptr if disabled
+  ProjectionCache *GetProjectionCache(const std::string &camera_name,
+                                      const Eigen::Matrix4d &c2w_pose);
+
  private:
   MultiCamerasProjection projection_;
   double last_pub_img_ts_ = 0.0;
@@ -107,6 +125,9 @@ class TLPreprocessor {
   base::TrafficLightPtrs lights_on_image_;
   base::TrafficLightPtrs lights_outside_image_;
   bool projections_outside_all_images_ = false;
+  double projection_cache_max_translation_ = 0.0;
+  double projection_cache_max_rotation_ = 0.0;
+  std::map<std::string, ProjectionCache> projection_caches_;
 };
 
 }  // namespace camera
@@ -16,6 +16,7 @@
 
 #include "modules/perception/camera/common/data_provider.h"
 #include "modules/perception/camera/test/camera_common_io_util.h"
+#include "modules/perception/inference/utils/resize.h"
 
 namespace apollo {
 namespace perception {
@@ -110,6 +111,53 @@ TEST(DataProvider, test_nodistortion) {
   EXPECT_FALSE(data_provider.GetImageBlob(image_options, &blob));
 }
 
+TEST(DataProvider, test_resized_image_blob) {
+  unsetenv("MODULE_PATH");
+  unsetenv("CYBER_PATH");
+  cv::Mat img = cv::imread("/apollo/modules/perception/testdata/"
+    "camera/common/img/test.jpg");
+
+  DataProvider data_provider;
+  DataProvider::InitOptions init_options;
+  init_options.image_height = img.rows;
+  init_options.image_width = img.cols;
+  init_options.device_id = 0;
+  data_provider.Init(init_options);
+
+  std::shared_ptr<base::Blob<float>> blob(
+      new base::Blob<float>(2, 256, 384, 3));
+  DataProvider::ImageOptions image_options;
+  image_options.target_color = base::Color::RGB;
+  EXPECT_FALSE(data_provider.GetResizedImageBlob(image_options, 0, nullptr));
+  EXPECT_FALSE(data_provider.GetResizedImageBlob(image_options, 0, blob));
+
+  EXPECT_TRUE(data_provider.FillImageData(img.rows, img.cols,
+                                          img.data, "bgr8"));
+  image_options.target_color = base::Color::GRAY;
+  EXPECT_FALSE(data_provider.GetResizedImageBlob(image_options, 0, blob));
+
+  // the fused pass matches crop, color conversion and resize in steps
+  image_options.target_color = base::Color::RGB;
+  image_options.do_crop = true;
+  image_options.crop_roi = base::RectI(100, 100, 512, 512);
+  EXPECT_TRUE(data_provider.GetResizedImageBlob(image_options, 1, blob));
+
+  base::Image8U image;
+  EXPECT_TRUE(data_provider.GetImage(image_options, &image));
+  std::shared_ptr<base::Blob<float>> expected(
+      new base::Blob<float>(1, 256, 384, 3));
+  EXPECT_TRUE(inference::ResizeGPU(image, expected, img.cols, 0));
+
+  const float *data = blob->cpu_data() + blob->offset(1);
+  const float *expected_data = expected->cpu_data();
+  for (int i = 0; i < expected->count(); ++i) {
+    EXPECT_NEAR(data[i], expected_data[i], 1e-3);
+  }
+
+  image_options.crop_roi = base::RectI(100, 100, img.cols, 512);
+  EXPECT_FALSE(data_provider.GetResizedImageBlob(image_options, 0, blob));
+}
+
 TEST(DataProvider, test_fill_image_data) {
   unsetenv("MODULE_PATH");
   unsetenv("CYBER_PATH");
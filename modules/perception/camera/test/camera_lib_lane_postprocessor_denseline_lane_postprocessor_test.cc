@@ -172,6 +172,38 @@ TEST(DenselineLanePostprocessor, lane_postprocessor_init_test) {
   EXPECT_FALSE(lane_postprocessor->Init(postprocessor_init_options));
 }
 
+TEST(DenselineLanePostprocessor, lane_map_gpu_test) {
+  const int width = 4;
+  const int height = 3;
+  const int out_dim = width * height;
+  base::Blob<float> output({7, height, width});
+  float *output_data = output.mutable_cpu_data();
+  memset(output_data, 0, sizeof(float) * output.count());
+  // pixel 1: ego lane with a high score
+  output_data[out_dim + 1] = 5.0f;
+  output_data[5 * out_dim + 1] = 1.0f;
+  output_data[6 * out_dim + 1] = -1.0f;
+  // pixel 6: adj-right lane with a low score
+  output_data[3 * out_dim + 6] = 0.5f;
+  // pixel 9: adj-left lane in the omitted bottom line
+  output_data[2 * out_dim + 9] = 5.0f;
+
+  base::Blob<float> points;
+  base::Blob<int> point_num;
+  EXPECT_TRUE(SelectLaneMapPointsGPU(output.gpu_data(), width, height, 1,
+                                     0.6f, &points, &point_num));
+  ASSERT_EQ(point_num.cpu_data()[0], 1);
+  const float *point = points.cpu_data();
+  EXPECT_EQ(static_cast<int>(point[0]), 1);
+  EXPECT_NEAR(point[1], 1.0f / (1.0f + std::exp(-1.0f)), 1e-5);
+  EXPECT_NEAR(point[2], 1.0f / (1.0f + std::exp(1.0f)), 1e-5);
+  EXPECT_NEAR(point[3], std::exp(5.0f) / (std::exp(5.0f) + 3.0f), 1e-5);
+
+  EXPECT_TRUE(SelectLaneMapPointsGPU(output.gpu_data(), width, height, 1,
+                                     0.2f, &points, &point_num));
+  EXPECT_EQ(point_num.cpu_data()[0], 2);
+}
+
 }  // namespace camera
 }  // namespace perception
 }  // namespace apollo
@@ -87,6 +87,41 @@ TEST(SimilarMapTest, SimilarMap_test) {
   EXPECT_FLOAT_EQ(*(sim2 + 3), 0.8);
 }
 
+TEST(SimilarMapTest, SimilarMap_batch_test) {
+  SimilarMap similar_map;
+  ASSERT_TRUE(similar_map.Init(4));
+
+  // frame 11 has one object and frame 12 two, both against frame 13
+  std::vector<CameraFrame> frames(3);
+  for (int i = 0; i < 3; ++i) {
+    frames[i].frame_id = 11 + i;
+  }
+  frames[0].detected_objects.resize(1);
+  frames[1].detected_objects.resize(2);
+  frames[2].detected_objects.resize(2);
+  std::vector<CameraFrame *> frames1 = {&frames[0], &frames[1]};
+
+  std::shared_ptr<base::Blob<float>> batch(new base::Blob<float>({3, 2}));
+  float *batch_data = batch->mutable_cpu_data();
+  for (int i = 0; i < 6; ++i) {
+    batch_data[i] = 0.1f * static_cast<float>(i);
+  }
+  similar_map.SetBatch(frames1, &frames[2], batch);
+  EXPECT_FLOAT_EQ(similar_map.sim(PatchIndicator(11, 0),
+                                  PatchIndicator(13, 1)), 0.1f);
+  EXPECT_FLOAT_EQ(similar_map.sim(PatchIndicator(12, 0),
+                                  PatchIndicator(13, 0)), 0.2f);
+  EXPECT_FLOAT_EQ(similar_map.sim(PatchIndicator(12, 1),
+                                  PatchIndicator(13, 1)), 0.5f);
+
+  // pairs outside of the batch still come from the map
+  auto sim = similar_map.get(10, 13);
+  sim->Reshape({1, 1});
+  *sim->mutable_cpu_data() = 2.0f;
+  EXPECT_FLOAT_EQ(similar_map.sim(PatchIndicator(10, 0),
+                                  PatchIndicator(13, 0)), 2.0f);
+}
+
 TEST(FrameListTest, FrameList_test) {
   // Init object template
   ObjectTemplateManagerInitOptions object_template_init_options;
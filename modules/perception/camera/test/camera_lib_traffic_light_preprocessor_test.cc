@@ -337,6 +337,75 @@ TEST_F(TLPreprocessorTest, test_project_lights) {
   }
 }
 
+TEST_F(TLPreprocessorTest, test_project_lights_cache) {
+  unsetenv("MODULE_PATH");
+  unsetenv("CYBER_PATH");
+  TrafficLightPreprocessorInitOptions init_options;
+  init_options.conf_file = "preprocess.pt";
+  init_options.root_dir = "/apollo/modules/perception/testdata/"
+    "camera/lib/traffic_light/preprocessor/data/";
+  init_options.gpu_id = 0;
+  init_options.sync_interval_seconds = 0.5;
+  init_options.camera_names = camera_names_;
+  init_options.projection_cache_max_translation = 0.05f;
+  init_options.projection_cache_max_rotation = 0.01f;
+  ASSERT_TRUE(preprocessor_->Init(init_options));
+
+  std::string camera_name = "onsemi_traffic";
+  preprocessor_->SetCameraWorkingFlag(camera_name, true);
+
+  CarPose pose;
+  std::vector<base::TrafficLightPtr> lights(1);
+  lights[0].reset(new base::TrafficLight);
+  lights[0]->id = "signal_0";
+  PrepareTestDataLongFocus(&pose, &(lights[0]->region.points));
+
+  base::RectI projection_roi;
+  {
+    base::TrafficLightPtrs lights_on_image;
+    base::TrafficLightPtrs lights_outside_image;
+    ASSERT_TRUE(preprocessor_->ProjectLights(
+            pose,
+            camera_name,
+            &lights,
+            &lights_on_image,
+            &lights_outside_image));
+    ASSERT_EQ(1, lights_on_image.size());
+    projection_roi = lights_on_image[0]->region.projection_roi;
+  }
+
+  // small pose delta, the cached projection is reused
+  {
+    base::TrafficLightPtrs lights_on_image;
+    base::TrafficLightPtrs lights_outside_image;
+    pose.c2w_poses_[camera_name](0, 3) += 0.01;
+    lights[0]->region.projection_roi = base::RectI();
+    ASSERT_TRUE(preprocessor_->ProjectLights(
+            pose,
+            camera_name,
+            &lights,
+            &lights_on_image,
+            &lights_outside_image));
+    ASSERT_EQ(1, lights_on_image.size());
+    EXPECT_EQ(projection_roi, lights_on_image[0]->region.projection_roi);
+  }
+
+  // large pose delta, lights are projected again
+  {
+    base::TrafficLightPtrs lights_on_image;
+    base::TrafficLightPtrs lights_outside_image;
+    pose.c2w_poses_[camera_name](0, 3) += 100000;
+    ASSERT_TRUE(preprocessor_->ProjectLights(
+            pose,
+            camera_name,
+            &lights,
+            &lights_on_image,
+            &lights_outside_image));
+    EXPECT_EQ(0, lights_on_image.size());
+    EXPECT_EQ(1, lights_outside_image.size());
+  }
+}
+
 TEST_F(TLPreprocessorTest, test_select_camera) {
   unsetenv("MODULE_PATH");
   unsetenv("CYBER_PATH");
@@ -118,20 +118,26 @@ void CalculateBBoxSizeCenter2DXY(const PointCloudT &cloud,
   Eigen::Vector3d dird(dir[0], dir[1], 0.0);
   dird.normalize();
   projection << dird[0], dird[1], 0.0, -dird[1], dird[0], 0.0, 0.0, 0.0, 1.0;
-  Eigen::Vector3d min_pt(DBL_MAX, DBL_MAX, DBL_MAX);
-  Eigen::Vector3d max_pt(-DBL_MAX, -DBL_MAX, -DBL_MAX);
-  Eigen::Vector3d loc_pt(0.0, 0.0, 0.0);
-  for (int i = 0; i < cloud.size(); i++) {
-    loc_pt = projection * Eigen::Vector3d(cloud[i].x, cloud[i].y, cloud[i].z);
-
-    min_pt(0) = std::min(min_pt(0), loc_pt(0));
-    min_pt(1) = std::min(min_pt(1), loc_pt(1));
-    min_pt(2) = std::min(min_pt(2), loc_pt(2));
-
-    max_pt(0) = std::max(max_pt(0), loc_pt(0));
-    max_pt(1) = std::max(max_pt(1), loc_pt(1));
-    max_pt(2) = std::max(max_pt(2), loc_pt(2));
+  // reduce into scalars, so that the loop can be vectorized
+  const double cos_dir = dird[0];
+  const double sin_dir = dird[1];
+  double min_x = DBL_MAX, min_y = DBL_MAX, min_z = DBL_MAX;
+  double max_x = -DBL_MAX, max_y = -DBL_MAX, max_z = -DBL_MAX;
+  for (size_t i = 0; i < cloud.size(); ++i) {
+    const double x = cloud[i].x;
+    const double y = cloud[i].y;
+    const double z = cloud[i].z;
+    const double loc_x = cos_dir * x + sin_dir * y;
+    const double loc_y = cos_dir * y - sin_dir * x;
+    min_x = std::min(min_x, loc_x);
+    min_y = std::min(min_y, loc_y);
+    min_z = std::min(min_z, z);
+    max_x = std::max(max_x, loc_x);
+    max_y = std::max(max_y, loc_y);
+    max_z = std::max(max_z, z);
   }
+  const Eigen::Vector3d min_pt(min_x, min_y, min_z);
+  const Eigen::Vector3d max_pt(max_x, max_y, max_z);
   (*size) = (max_pt - min_pt).cast<float>();
   Eigen::Vector3d coeff = (max_pt + min_pt) * 0.5;
   coeff(2) = min_pt(2);
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <numeric>
 #include <vector>
 
 #include "Eigen/Dense"
@@ -18,11 +18,14 @@
 
 #include <algorithm>
 #include <functional>
+#include <future>
 #include <map>
+#include <memory>
 #include <utility>
 #include <vector>
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 
 #include "modules/perception/common/graph/connected_component_analysis.h"
 #include "modules/perception/common/graph/hungarian_optimizer.h"
@@ -52,6 +55,13 @@ class GatedHungarianMatcher {
   const SecureMat<T>& global_costs() const { return global_costs_; }
   SecureMat<T>* mutable_global_costs() { return &global_costs_; }
 
+  /* @brief: connected components which need the hungarian optimizer are
+   * solved in parallel by up to num_threads workers. the assignments are
+   * the same as the ones of the serial matching. */
+  void set_num_threads(int num_threads) {
+    num_threads_ = std::max(num_threads, 1);
+  }
+
   void Match(T cost_thresh, OptimizeFlag opt_flag,
              std::vector<std::pair<size_t, size_t>>* assignments,
              std::vector<size_t>* unassigned_rows,
@@ -76,9 +86,20 @@ class GatedHungarianMatcher {
       std::vector<std::vector<size_t>>* col_components) const;
 
   /* Step 3:
-   * optimize single connected component, which is part of the global one */
-  void OptimizeConnectedComponent(const std::vector<size_t>& row_component,
-                                  const std::vector<size_t>& col_component);
+   * optimize single connected component, which is part of the global one,
+   * the global assignments of the component are appended to assignments */
+  void OptimizeConnectedComponent(
+      const std::vector<size_t>& row_component,
+      const std::vector<size_t>& col_component,
+      HungarianOptimizer<T>* optimizer,
+      std::vector<std::pair<size_t, size_t>>* assignments) const;
+
+  /* optimize the components with the given indices on the workers */
+  void OptimizeComponentsInParallel(
+      const std::vector<std::vector<size_t>>& row_components,
+      const std::vector<std::vector<size_t>>& col_components,
+      const std::vector<size_t>& component_ids,
+      std::vector<std::vector<std::pair<size_t, size_t>>>* assignments);
 
   /* Step 4:
    * generate the set of unassigned row or col index. */
@@ -90,15 +111,21 @@ class GatedHungarianMatcher {
    * optimizer directly
    * @params[IN] row_component: the set of index of rows of sub-graph
    * @params[IN] col_component: the set of index of cols of sub-graph
+   * @params[OUT] optimizer: the optimizer whose costs are written
    * @return: nothing */
   void UpdateGatingLocalCostsMat(const std::vector<size_t>& row_component,
-                                 const std::vector<size_t>& col_component);
+                                 const std::vector<size_t>& col_component,
+                                 HungarianOptimizer<T>* optimizer) const;
 
   void OptimizeAdapter(
-      std::vector<std::pair<size_t, size_t>>* local_assignments);
+      HungarianOptimizer<T>* optimizer,
+      std::vector<std::pair<size_t, size_t>>* local_assignments) const;
 
   /* hungarian optimizer */
   HungarianOptimizer<T> optimizer_;
+  /* optimizers of the parallel workers, created on first use */
+  std::vector<std::unique_ptr<HungarianOptimizer<T>>> worker_optimizers_;
+  int num_threads_ = 1;
 
   /* global costs matrix */
   SecureMat<T> global_costs_;
@@ -156,8 +183,34 @@ void GatedHungarianMatcher<T>::Match(
   /* compute assignments */
   assignments_ptr_->clear();
   assignments_ptr_->reserve(std::max(rows_num_, cols_num_));
+  std::vector<size_t> hungarian_ids;
   for (size_t i = 0; i < row_components.size(); ++i) {
-    this->OptimizeConnectedComponent(row_components[i], col_components[i]);
+    if (row_components[i].size() > 1 || col_components[i].size() > 1) {
+      hungarian_ids.push_back(i);
+    }
+  }
+  if (num_threads_ > 1 && hungarian_ids.size() > 1) {
+    /* components are independent, solve them on the workers and merge the
+     * results in component order to keep the output deterministic */
+    std::vector<std::vector<std::pair<size_t, size_t>>> component_assignments(
+        row_components.size());
+    OptimizeComponentsInParallel(row_components, col_components,
+                                 hungarian_ids, &component_assignments);
+    for (size_t i = 0; i < row_components.size(); ++i) {
+      if (row_components[i].size() > 1 || col_components[i].size() > 1) {
+        assignments_ptr_->insert(assignments_ptr_->end(),
+                                 component_assignments[i].begin(),
+                                 component_assignments[i].end());
+      } else {
+        this->OptimizeConnectedComponent(row_components[i], col_components[i],
+                                         &optimizer_, assignments_ptr_);
+      }
+    }
+  } else {
+    for (size_t i = 0; i < row_components.size(); ++i) {
+      this->OptimizeConnectedComponent(row_components[i], col_components[i],
+                                       &optimizer_, assignments_ptr_);
+    }
   }
 
   this->GenerateUnassignedData(unassigned_rows, unassigned_cols);
@@ -223,7 +276,9 @@ void GatedHungarianMatcher<T>::ComputeConnectedComponents(
 template <typename T>
 void GatedHungarianMatcher<T>::OptimizeConnectedComponent(
     const std::vector<size_t>& row_component,
-    const std::vector<size_t>& col_component) {
+    const std::vector<size_t>& col_component,
+    HungarianOptimizer<T>* optimizer,
+    std::vector<std::pair<size_t, size_t>>* assignments) const {
   size_t local_rows_num = row_component.size();
   size_t local_cols_num = col_component.size();
 
@@ -236,17 +291,17 @@ void GatedHungarianMatcher<T>::OptimizeConnectedComponent(
     size_t idx_r = row_component[0];
     size_t idx_c = col_component[0];
     if (is_valid_cost_(global_costs_(idx_r, idx_c))) {
-      assignments_ptr_->push_back(std::make_pair(idx_r, idx_c));
+      assignments->push_back(std::make_pair(idx_r, idx_c));
     }
     return;
   }
 
   /* update local cost matrix */
-  UpdateGatingLocalCostsMat(row_component, col_component);
+  UpdateGatingLocalCostsMat(row_component, col_component, optimizer);
 
   /* get local assignments */
   std::vector<std::pair<size_t, size_t>> local_assignments;
-  OptimizeAdapter(&local_assignments);
+  OptimizeAdapter(optimizer, &local_assignments);
 
   /* parse local assginments into global ones */
   for (size_t i = 0; i < local_assignments.size(); ++i) {
@@ -256,7 +311,38 @@ void GatedHungarianMatcher<T>::OptimizeConnectedComponent(
     if (!is_valid_cost_(global_costs_(global_row_idx, global_col_idx))) {
       continue;
     }
-    assignments_ptr_->push_back(std::make_pair(global_row_idx, global_col_idx));
+    assignments->push_back(std::make_pair(global_row_idx, global_col_idx));
+  }
+}
+
+template <typename T>
+void GatedHungarianMatcher<T>::OptimizeComponentsInParallel(
+    const std::vector<std::vector<size_t>>& row_components,
+    const std::vector<std::vector<size_t>>& col_components,
+    const std::vector<size_t>& component_ids,
+    std::vector<std::vector<std::pair<size_t, size_t>>>* assignments) {
+  const size_t num_workers =
+      std::min(static_cast<size_t>(num_threads_), component_ids.size());
+  while (worker_optimizers_.size() + 1 < num_workers) {
+    worker_optimizers_.emplace_back(new HungarianOptimizer<T>());
+  }
+  /* worker w handles the components w, w + num_workers, ... */
+  auto worker = [&](size_t w, HungarianOptimizer<T>* optimizer) {
+    for (size_t k = w; k < component_ids.size(); k += num_workers) {
+      const size_t id = component_ids[k];
+      OptimizeConnectedComponent(row_components[id], col_components[id],
+                                 optimizer, &assignments->at(id));
+    }
+  };
+  std::vector<std::future<void>> results;
+  results.reserve(num_workers - 1);
+  for (size_t w = 1; w < num_workers; ++w) {
+    results.push_back(
+        cyber::Async(worker, w, worker_optimizers_[w - 1].get()));
+  }
+  worker(0, &optimizer_);
+  for (auto& result : results) {
+    result.get();
   }
 }
 
@@ -291,13 +377,15 @@ void GatedHungarianMatcher<T>::GenerateUnassignedData(
 template <typename T>
 void GatedHungarianMatcher<T>::UpdateGatingLocalCostsMat(
     const std::vector<size_t>& row_component,
-    const std::vector<size_t>& col_component) {
+    const std::vector<size_t>& col_component,
+    HungarianOptimizer<T>* optimizer) const {
   /* set the invalid cost to bound value */
-  SecureMat<T>* local_costs = optimizer_.costs();
+  SecureMat<T>* local_costs = optimizer->costs();
   local_costs->Resize(row_component.size(), col_component.size());
   for (size_t i = 0; i < row_component.size(); ++i) {
     for (size_t j = 0; j < col_component.size(); ++j) {
-      T& current_cost = global_costs_(row_component[i], col_component[j]);
+      const T& current_cost =
+          global_costs_(row_component[i], col_component[j]);
       if (is_valid_cost_(current_cost)) {
         (*local_costs)(i, j) = current_cost;
       } else {
@@ -310,12 +398,13 @@ void GatedHungarianMatcher<T>::UpdateGatingLocalCostsMat(
 
 template <typename T>
 void GatedHungarianMatcher<T>::OptimizeAdapter(
-    std::vector<std::pair<size_t, size_t>>* local_assignments) {
+    HungarianOptimizer<T>* optimizer,
+    std::vector<std::pair<size_t, size_t>>* local_assignments) const {
   CHECK_NOTNULL(local_assignments);
   if (opt_flag_ == OptimizeFlag::OPTMAX) {
-    optimizer_.Maximize(local_assignments);
+    optimizer->Maximize(local_assignments);
   } else {
-    optimizer_.Minimize(local_assignments);
+    optimizer->Minimize(local_assignments);
   }
 }
 
@@ -551,6 +551,45 @@ TEST_F(GatedHungarianMatcherTest, test_Match_Maximize) {
   EXPECT_EQ(0, unassigned_rows.size());
 }
 
+TEST_F(GatedHungarianMatcherTest, test_Match_Minimize_parallel) {
+  /* block diagonal costs, every block is one connected component */
+  const size_t block = 4;
+  const size_t num_blocks = 8;
+  const size_t size = block * num_blocks;
+  float cost_thresh = 1.0f;
+  float bound_value = 2.0f;
+  GatedHungarianMatcher<float>::OptimizeFlag opt_flag =
+      GatedHungarianMatcher<float>::OptimizeFlag::OPTMIN;
+  SecureMat<float>* global_costs = optimizer_->mutable_global_costs();
+  global_costs->Resize(size, size);
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t j = 0; j < size; ++j) {
+      (*global_costs)(i, j) =
+          i / block == j / block
+              ? static_cast<float>((i * 7 + j * 3) % 10) / 10.0f
+              : bound_value;
+    }
+  }
+  std::vector<std::pair<size_t, size_t>> serial_assignments;
+  std::vector<size_t> serial_unassigned_rows;
+  std::vector<size_t> serial_unassigned_cols;
+  optimizer_->Match(cost_thresh, bound_value, opt_flag, &serial_assignments,
+                    &serial_unassigned_rows, &serial_unassigned_cols);
+  EXPECT_EQ(size, serial_assignments.size());
+
+  GatedHungarianMatcher<float> parallel_matcher(1000);
+  *parallel_matcher.mutable_global_costs() = *global_costs;
+  parallel_matcher.set_num_threads(3);
+  std::vector<std::pair<size_t, size_t>> assignments;
+  std::vector<size_t> unassigned_rows;
+  std::vector<size_t> unassigned_cols;
+  parallel_matcher.Match(cost_thresh, bound_value, opt_flag, &assignments,
+                         &unassigned_rows, &unassigned_cols);
+  EXPECT_EQ(serial_assignments, assignments);
+  EXPECT_EQ(serial_unassigned_rows, unassigned_rows);
+  EXPECT_EQ(serial_unassigned_cols, unassigned_cols);
+}
+
 }  // namespace common
 }  // namespace perception
 }  // namespace apollo
@@ -36,6 +36,35 @@ inline int IRansacTrials(int sample_size, double confidence,
              : std::numeric_limits<int>::max();
 }
 
+// Score a plane hypothesis pi with unit normal on n points stored as
+// consecutive x, y, z triplets. Return the number of points closer than
+// error_tol to the plane, the sum of their distances is written to cost if
+// it is not nullptr. The loops are free of branches so that the compiler
+// can vectorize them.
+template <typename T>
+inline int IRansacScorePlane(const T* pi, const T* x, int n, T error_tol,
+                             T* cost = nullptr) {
+  int nr_inliers = 0;
+  if (cost == nullptr) {
+    for (int i = 0; i < n; ++i) {
+      const T* p = x + 3 * i;
+      const T dist = IAbs(pi[0] * p[0] + pi[1] * p[1] + pi[2] * p[2] + pi[3]);
+      nr_inliers += static_cast<int>(dist < error_tol);
+    }
+    return nr_inliers;
+  }
+  T sum = static_cast<T>(0.0);
+  for (int i = 0; i < n; ++i) {
+    const T* p = x + 3 * i;
+    const T dist = IAbs(pi[0] * p[0] + pi[1] * p[1] + pi[2] * p[2] + pi[3]);
+    const bool is_inlier = dist < error_tol;
+    nr_inliers += static_cast<int>(is_inlier);
+    sum += is_inlier ? dist : static_cast<T>(0.0);
+  }
+  *cost = sum;
+  return nr_inliers;
+}
+
 // Using Ransac to fit a model to data set which contains outliers
 // The function needs 2n entries of scratch space in inliers
 template <
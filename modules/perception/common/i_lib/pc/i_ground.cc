@@ -17,6 +17,10 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <future>
+
+#include "cyber/task/task.h"
+#include "modules/perception/common/i_lib/da/i_ransac.h"
 
 namespace apollo {
 namespace perception {
@@ -44,6 +48,8 @@ void PlaneFitGroundDetectorParam::SetDefault() {
   nr_ransac_iter_threshold = 32;
   candidate_filter_threshold = 1.0f;  // 1 meter
   nr_smooth_iter = 1;
+  nr_fit_threads = 1;
+  use_previous_planes = false;
 }
 
 bool PlaneFitGroundDetectorParam::Validate() const {
@@ -51,6 +57,7 @@ bool PlaneFitGroundDetectorParam::Validate() const {
       nr_grids_coarse > nr_grids_fine || nr_points_max == 0 ||
       nr_samples_min_threshold == 0 || nr_samples_max_threshold == 0 ||
       nr_inliers_min_threshold == 0 || nr_ransac_iter_threshold == 0 ||
+      nr_fit_threads < 1 ||
       roi_region_rad_x <= 0.f || roi_region_rad_y <= 0.f ||
       roi_region_rad_z <= 0.f ||
       planefit_dist_threshold_near > planefit_dist_threshold_far) {
@@ -166,6 +173,7 @@ bool PlaneFitGroundDetector::Init() {
   // Init order lookup table
   order_table_ = IAlloc<std::pair<int, int> >(vg_fine_->NrVoxel());
   InitOrderTable(vg_coarse_, order_table_);
+  InitFitBatches();
 
   // ground plane:
   ground_planes_ =
@@ -178,6 +186,11 @@ bool PlaneFitGroundDetector::Init() {
   if (!ground_planes_sphe_) {
     return false;
   }
+  prev_ground_planes_ =
+      IAlloc2<GroundPlaneLiDAR>(param_.nr_grids_coarse, param_.nr_grids_coarse);
+  if (!prev_ground_planes_) {
+    return false;
+  }
   ground_z_ = IAlloc2<std::pair<float, bool> >(param_.nr_grids_coarse,
                                                param_.nr_grids_coarse);
   if (!ground_z_) {
@@ -207,14 +220,16 @@ bool PlaneFitGroundDetector::Init() {
       local_candis_[r][c].Reserve(capacity);
     }
   }
-  // threeds in ransac, in inhomogeneous coordinates:
-  pf_threeds_ =
-      IAllocAligned<float>(param_.nr_samples_max_threshold * dim_point_, 4);
+  // threeds in ransac, in inhomogeneous coordinates, one block per thread:
+  pf_threeds_ = IAllocAligned<float>(
+      param_.nr_samples_max_threshold * dim_point_ * param_.nr_fit_threads,
+      4);
   if (!pf_threeds_) {
     return false;
   }
   memset(reinterpret_cast<void *>(pf_threeds_), 0,
-         param_.nr_samples_max_threshold * dim_point_ * sizeof(float));
+         param_.nr_samples_max_threshold * dim_point_ *
+             param_.nr_fit_threads * sizeof(float));
   // labels:
   labels_ = IAllocAligned<char>(param_.nr_points_max, 4);
   if (!labels_) {
@@ -269,6 +284,7 @@ void PlaneFitGroundDetector::CleanUp() {
     delete vg_coarse_;
   }
   IFree2<GroundPlaneLiDAR>(&ground_planes_);
+  IFree2<GroundPlaneLiDAR>(&prev_ground_planes_);
   IFree2<GroundPlaneSpherical>(&ground_planes_sphe_);
   IFree2<std::pair<float, bool> >(&ground_z_);
   IFree2<PlaneFitPointCandIndices>(&local_candis_);
@@ -630,7 +646,6 @@ int PlaneFitGroundDetector::FitGrid(const float *point_cloud,
   int nr_inliers = 0;
   int nr_inliers_best = -1;
   int i = 0;
-  int j = 0;
   int rseed = I_DEFAULT_SEED;
   int indices_trial[] = {0, 0, 0};
   int nr_samples = candi->Prune(param_.nr_samples_min_threshold,
@@ -662,17 +677,8 @@ int PlaneFitGroundDetector::FitGrid(const float *point_cloud,
     }
     // iterate samples and check if the point to plane distance is below
     // threshold
-    psrc = pf_threeds_;
-    nr_inliers = 0;
-    fit_cost = 0;
-    for (j = 0; j < nr_samples; ++j) {
-      ptp_dist = IPlaneToPointDistanceWUnitNorm(plane.params, psrc);
-      if (ptp_dist < dist_thre) {
-        nr_inliers++;
-        fit_cost += ptp_dist;
-      }
-      psrc += dim_point_;
-    }
+    nr_inliers = IRansacScorePlane(plane.params, pf_threeds_, nr_samples,
+                                   dist_thre, &fit_cost);
     // Assign number of supports
     plane.SetNrSupport(nr_inliers);
 
@@ -811,7 +817,8 @@ inline float calculate_two_angles(const GroundPlaneLiDAR &p1,
 
 int PlaneFitGroundDetector::FitGridWithNeighbors(
     int r, int c, const float *point_cloud, GroundPlaneLiDAR *groundplane,
-    unsigned int nr_points, unsigned int nr_point_element, float dist_thre) {
+    unsigned int nr_points, unsigned int nr_point_element, float dist_thre,
+    float *threeds) {
   // initialize the best plane
   groundplane->ForceInvalid();
   // not enough samples, failed and return
@@ -827,8 +834,9 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
   }
 
   GroundPlaneLiDAR plane;
+  // the last hypothesis is the plane of the previous frame
   int kNr_iter = param_.nr_ransac_iter_threshold +
-                 static_cast<int>(neighbors.size());
+                 static_cast<int>(neighbors.size()) + 1;
   GroundPlaneLiDAR hypothesis[kNr_iter];
   float ptp_dist = 0.0f;
   int best = -1;
@@ -847,7 +855,7 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
   float samples[9];
   // copy 3D points
   float *psrc = nullptr;
-  float *pdst = pf_threeds_;
+  float *pdst = threeds;
   int r_n = 0;
   int c_n = 0;
   float angle = -1.f;
@@ -856,13 +864,26 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
     ICopy3(point_cloud + (nr_point_element * candi[i]), pdst);
     pdst += dim_point_;
   }
+  // the plane of the previous frame is scored first, the random hypotheses
+  // are skipped if it already has enough inliers
+  GroundPlaneLiDAR &prev_hypothesis = hypothesis[kNr_iter - 1];
+  int nr_ransac_iter = param_.nr_ransac_iter_threshold;
+  if (param_.use_previous_planes && prev_ground_planes_[r][c].IsValid()) {
+    prev_hypothesis = prev_ground_planes_[r][c];
+    nr_inliers = IRansacScorePlane(prev_hypothesis.params, threeds,
+                                   nr_samples, dist_thre);
+    prev_hypothesis.SetNrSupport(nr_inliers);
+    if (nr_inliers > nr_inliers_termi) {
+      nr_ransac_iter = 0;
+    }
+  }
   // generate plane hypothesis and vote
-  for (int i = 0; i < param_.nr_ransac_iter_threshold; ++i) {
+  for (int i = 0; i < nr_ransac_iter; ++i) {
     IRandomSample(indices_trial, 3, nr_samples, &rseed);
     IScale3(indices_trial, dim_point_);
-    ICopy3(pf_threeds_ + indices_trial[0], samples);
-    ICopy3(pf_threeds_ + indices_trial[1], samples + 3);
-    ICopy3(pf_threeds_ + indices_trial[2], samples + 6);
+    ICopy3(threeds + indices_trial[0], samples);
+    ICopy3(threeds + indices_trial[1], samples + 3);
+    ICopy3(threeds + indices_trial[2], samples + 6);
     IPlaneFitDestroyed(samples, hypothesis[i].params);
     // check if the plane hypothesis has valid geometry
     if (hypothesis[i].GetDegreeNormalToZ() > param_.planefit_orien_threshold) {
@@ -870,15 +891,8 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
     }
     // iterate samples and check if the point to plane distance is below
     // threshold
-    psrc = pf_threeds_;
-    nr_inliers = 0;
-    for (int j = 0; j < nr_samples; ++j) {
-      ptp_dist = IPlaneToPointDistanceWUnitNorm(hypothesis[i].params, psrc);
-      if (ptp_dist < dist_thre) {
-        nr_inliers++;
-      }
-      psrc += dim_point_;
-    }
+    nr_inliers = IRansacScorePlane(hypothesis[i].params, threeds,
+                                   nr_samples, dist_thre);
     // Assign number of supports
     hypothesis[i].SetNrSupport(nr_inliers);
 
@@ -893,16 +907,9 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
     if (ground_planes_[r_n][c_n].IsValid()) {
       hypothesis[i + param_.nr_ransac_iter_threshold] =
           ground_planes_[r_n][c_n];
-      psrc = pf_threeds_;
-      nr_inliers = 0;
-      for (int j = 0; j < nr_samples; ++j) {
-        ptp_dist = IPlaneToPointDistanceWUnitNorm(
-            hypothesis[i + param_.nr_ransac_iter_threshold].params, psrc);
-        if (ptp_dist < dist_thre) {
-          nr_inliers++;
-        }
-        psrc += dim_point_;
-      }
+      nr_inliers = IRansacScorePlane(
+          hypothesis[i + param_.nr_ransac_iter_threshold].params, threeds,
+          nr_samples, dist_thre);
       if (nr_inliers < static_cast<int>(param_.nr_inliers_min_threshold)) {
         hypothesis[i + param_.nr_ransac_iter_threshold].ForceInvalid();
         continue;
@@ -932,6 +939,9 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
     }
   }
 
+  if (best < 0) {
+    return (0);
+  }
   *groundplane = hypothesis[best];
 
   // check if meet the inlier number requirement
@@ -946,8 +956,8 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
   // iterate samples and check if the point to plane distance is within
   // threshold
   nr_inliers = 0;
-  psrc = pf_threeds_;
-  pdst = pf_threeds_;
+  psrc = threeds;
+  pdst = threeds;
   for (int i = 0; i < nr_samples; ++i) {
     ptp_dist = IPlaneToPointDistanceWUnitNorm(groundplane->params, psrc);
     if (ptp_dist < dist_thre) {
@@ -959,8 +969,8 @@ int PlaneFitGroundDetector::FitGridWithNeighbors(
   }
   groundplane->SetNrSupport(nr_inliers);
 
-  // note that pf_threeds_ will be destroyed after calling this routine
-  IPlaneFitTotalLeastSquare(pf_threeds_, groundplane->params, nr_inliers);
+  // note that threeds will be destroyed after calling this routine
+  IPlaneFitTotalLeastSquare(threeds, groundplane->params, nr_inliers);
   if (angle_best <= CalculateAngleDist(*groundplane, neighbors)) {
     *groundplane = hypothesis[best];
     groundplane->SetStatus(true);
@@ -1006,32 +1016,91 @@ float PlaneFitGroundDetector::CalculateAngleDist(
   return angle_dist / static_cast<float>(count);
 }
 
+bool PlaneFitGroundDetector::FitGridInOrder(int r, int c, float *threeds) {
+  GroundPlaneLiDAR gp;
+  if (FitGridWithNeighbors(r, c, vg_coarse_->const_data(), &gp,
+                           vg_coarse_->NrPoints(),
+                           vg_coarse_->NrPointElement(), pf_thresholds_[r][c],
+                           threeds) >=
+      static_cast<int>(param_.nr_inliers_min_threshold)) {
+    IPlaneEucliToSpher(gp, &ground_planes_sphe_[r][c]);
+    ground_planes_[r][c] = gp;
+    return true;
+  }
+  ground_planes_sphe_[r][c].ForceInvalid();
+  ground_planes_[r][c].ForceInvalid();
+  return false;
+}
+
+void PlaneFitGroundDetector::InitFitBatches() {
+  fit_batches_.clear();
+  unsigned int nr_voxels = vg_coarse_->NrVoxel();
+  unsigned int begin = 0;
+  fit_batches_.push_back(0);
+  for (unsigned int i = 1; i < nr_voxels; ++i) {
+    int r = order_table_[i].first;
+    int c = order_table_[i].second;
+    for (unsigned int j = begin; j < i; ++j) {
+      if (IAbs(order_table_[j].first - r) <= 1 &&
+          IAbs(order_table_[j].second - c) <= 1) {
+        begin = i;
+        fit_batches_.push_back(static_cast<int>(i));
+        break;
+      }
+    }
+  }
+  fit_batches_.push_back(static_cast<int>(nr_voxels));
+}
+
 int PlaneFitGroundDetector::FitInOrder() {
   int nr_grids = 0;
   unsigned int i = 0;
   unsigned int j = 0;
-  int r = 0;
-  int c = 0;
-  GroundPlaneLiDAR gp;
   for (i = 0; i < param_.nr_grids_coarse; ++i) {
     for (j = 0; j < param_.nr_grids_coarse; ++j) {
       ground_z_[i][j].first = 0.f;
       ground_z_[i][j].second = false;
     }
   }
-  for (i = 0; i < vg_coarse_->NrVoxel(); ++i) {
-    r = order_table_[i].first;
-    c = order_table_[i].second;
-    if (FitGridWithNeighbors(
-            r, c, vg_coarse_->const_data(), &gp, vg_coarse_->NrPoints(),
-            vg_coarse_->NrPointElement(), pf_thresholds_[r][c]) >=
-        static_cast<int>(param_.nr_inliers_min_threshold)) {
-      IPlaneEucliToSpher(gp, &ground_planes_sphe_[r][c]);
-      ground_planes_[r][c] = gp;
-      nr_grids++;
-    } else {
-      ground_planes_sphe_[r][c].ForceInvalid();
-      ground_planes_[r][c].ForceInvalid();
+  if (param_.use_previous_planes) {
+    ICopy(ground_planes_[0], prev_ground_planes_[0],
+          param_.nr_grids_coarse * param_.nr_grids_coarse);
+  }
+  const int nr_threads = param_.nr_fit_threads;
+  const int threeds_size =
+      static_cast<int>(param_.nr_samples_max_threshold * dim_point_);
+  if (nr_threads <= 1) {
+    for (i = 0; i < vg_coarse_->NrVoxel(); ++i) {
+      nr_grids += FitGridInOrder(order_table_[i].first,
+                                 order_table_[i].second, pf_threeds_);
+    }
+    return nr_grids;
+  }
+  // the grids of one batch are fitted by the threads in an interleaved
+  // order, the batches are fitted one after the other
+  auto fit_batch = [&](int begin, int end, int thread_id) {
+    int nr_fitted = 0;
+    float *threeds = pf_threeds_ + thread_id * threeds_size;
+    for (int k = begin + thread_id; k < end; k += nr_threads) {
+      nr_fitted += FitGridInOrder(order_table_[k].first,
+                                  order_table_[k].second, threeds);
+    }
+    return nr_fitted;
+  };
+  std::vector<std::future<int>> futures(nr_threads - 1);
+  for (size_t b = 0; b + 1 < fit_batches_.size(); ++b) {
+    int begin = fit_batches_[b];
+    int end = fit_batches_[b + 1];
+    if (end - begin == 1) {
+      nr_grids += fit_batch(begin, end, 0);
+      continue;
+    }
+    for (int t = 1; t < nr_threads; ++t) {
+      futures[t - 1] = cyber::Async(fit_batch, begin, end, t);
+    }
+    nr_grids += fit_batch(begin, end, 0);
+    for (auto &future : futures) {
+      nr_grids += future.get();
     }
   }
   return nr_grids;
@@ -1250,11 +1319,10 @@ bool PlaneFitGroundDetector::Detect(const float *point_cloud,
   unsigned int r = 0;
   unsigned int c = 0;
   // Filter to generate plane fitting candidates
-  // int nr_candis = Filter();
-  // std::cout << "# of plane candidates: " << nr_candis << std::endl;
+  Filter();
   //  Fit local plane using ransac
   // nr_valid_grid = Fit();
-  // int nr_valid_grid = FitInOrder();
+  FitInOrder();
   // std::cout << "# of valid plane geometry (fitting): " << nr_valid_grid <<
   // std::endl;
   // Smooth plane using neighborhood information:
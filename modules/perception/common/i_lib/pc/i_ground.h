@@ -192,6 +192,10 @@ struct PlaneFitGroundDetectorParam {
   float candidate_filter_threshold;
   int nr_ransac_iter_threshold;
   int nr_smooth_iter;
+  // number of threads fitting the grids in parallel
+  int nr_fit_threads;
+  // try the plane of the previous frame before the random hypotheses
+  bool use_previous_planes;
 };
 
 struct PlaneFitPointCandIndices {
@@ -273,7 +277,12 @@ class PlaneFitGroundDetector : public BaseGroundDetector {
   int FitGridWithNeighbors(int r, int c, const float *point_cloud,
                            GroundPlaneLiDAR *groundplane,
                            unsigned int nr_points,
-                           unsigned int nr_point_element, float dist_thre);
+                           unsigned int nr_point_element, float dist_thre,
+                           float *threeds);
+  // fit grid (r, c) and store its plane, threeds is the sample memory
+  bool FitGridInOrder(int r, int c, float *threeds);
+  // split the fitting order into batches of grids that are not neighbors
+  void InitFitBatches();
   void GetNeighbors(int r, int c, int rows, int cols,
                     std::vector<std::pair<int, int> > *neighbors);
   float CalculateAngleDist(const GroundPlaneLiDAR &plane,
@@ -323,6 +332,13 @@ class PlaneFitGroundDetector : public BaseGroundDetector {
   float *pf_threeds_;
   int *sampled_indices_;
   std::pair<int, int> *order_table_;
+  // planes of the previous frame, used as ransac seeds
+  GroundPlaneLiDAR **prev_ground_planes_ = nullptr;
+  // start of each batch in order_table_, followed by the end of the table.
+  // the grids of a batch are not neighbors of each other, so they see the
+  // same neighbor planes as in the serial order and can be fitted in
+  // parallel
+  std::vector<int> fit_batches_;
 };
 
 }  // namespace common
@@ -34,5 +34,13 @@ DEFINE_string(config_manager_path, "./conf", "The ModelConfig config paths.");
 DEFINE_string(work_root, "",
               "Project work root direcotry.");
 
+// inference
+DEFINE_string(rt_engine_cache_dir, "",
+              "Directory of serialized TensorRT engines, empty to always "
+              "build the engines.");
+DEFINE_bool(rt_use_fp16, false,
+            "Build TensorRT engines in FP16 mode when INT8 is not used and "
+            "the GPU supports fast FP16.");
+
 }  // namespace perception
 }  // namespace apollo
@@ -32,5 +32,9 @@ DECLARE_bool(enable_base_object_pool);
 DECLARE_string(config_manager_path);
 DECLARE_string(work_root);
 
+// inference
+DECLARE_string(rt_engine_cache_dir);
+DECLARE_bool(rt_use_fp16);
+
 }  // namespace perception
 }  // namespace apollo
@@ -22,6 +22,7 @@
 
 #include "cyber/common/log.h"
 
+#include "modules/common/util/voxel_grid_downsampler.h"
 #include "modules/perception/base/point_cloud.h"
 #include "modules/perception/common/geometry/basic.h"
 
@@ -214,6 +215,30 @@ void DownsamplingRectangleNeighbour(
   down_cloud->resize(pt_num);
 }
 
+// @brief: a voxel grid filter, the points of each occupied voxel of size
+//         leaf_size are replaced by their centroid. other attributes are
+//         taken from the first point of the voxel. downsampler keeps its
+//         buffers between calls.
+template <typename PointT>
+void DownsamplingVoxel(
+    float leaf_size,
+    typename std::shared_ptr<const base::PointCloud<PointT>> cloud,
+    typename std::shared_ptr<base::PointCloud<PointT>> down_cloud,
+    apollo::common::util::VoxelGridDownsampler* downsampler) {
+  if (cloud->size() == 0) {
+    down_cloud->clear();
+    return;
+  }
+  downsampler->SetLeafSize(leaf_size, leaf_size, leaf_size);
+  downsampler->Compute(&(cloud->at(0)), cloud->size());
+  const std::vector<int>& first_points = downsampler->VoxelFirstPoints();
+  down_cloud->resize(first_points.size());
+  for (size_t i = 0; i < first_points.size(); ++i) {
+    down_cloud->at(i) = cloud->at(first_points[i]);
+  }
+  downsampler->GetCentroids(down_cloud.get());
+}
+
 }  // namespace common
 }  // namespace perception
 }  // namespace apollo
@@ -340,6 +340,35 @@ TEST(PointCloudProcessingDownsamplingTest, downsampling_rectangle_neighbour2) {
   EXPECT_EQ(pc_out->size(), 349);
 }
 
+TEST(PointCloudProcessingDownsamplingTest, downsampling_voxel) {
+  PointF tmp_pt;
+  std::shared_ptr<PointCloud<PointF>> pc_in =
+      std::shared_ptr<PointCloud<PointF>>(new PointCloud<PointF>);
+  std::shared_ptr<PointCloud<PointF>> pc_out =
+      std::shared_ptr<PointCloud<PointF>>(new PointCloud<PointF>);
+  for (size_t i = 0; i < 10; i++) {
+    for (size_t j = 0; j < 10; j++) {
+      tmp_pt.x = static_cast<float>(i) * 0.5f + 0.1f;
+      tmp_pt.y = static_cast<float>(j) * 0.5f + 0.1f;
+      tmp_pt.z = 0.5f;
+      tmp_pt.intensity = static_cast<float>(i);
+      pc_in->push_back(tmp_pt);
+    }
+  }
+  std::shared_ptr<const PointCloud<PointF>> pc_in_const = pc_in;
+  apollo::common::util::VoxelGridDownsampler downsampler;
+  DownsamplingVoxel(1.f, pc_in_const, pc_out, &downsampler);
+  EXPECT_EQ(pc_out->size(), 25);
+  EXPECT_NEAR(pc_out->at(0).x, 0.35f, 1e-5);
+  EXPECT_NEAR(pc_out->at(0).y, 0.35f, 1e-5);
+  EXPECT_NEAR(pc_out->at(0).z, 0.5f, 1e-5);
+  EXPECT_EQ(pc_out->at(0).intensity, 0.f);
+
+  pc_in->clear();
+  DownsamplingVoxel(1.f, pc_in_const, pc_out, &downsampler);
+  EXPECT_EQ(pc_out->size(), 0);
+}
+
 }  // namespace common
 }  // namespace perception
 }  // namespace apollo
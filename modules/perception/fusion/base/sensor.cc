@@ -29,34 +29,29 @@ void Sensor::QueryLatestFrames(double timestamp,
   CHECK_NOTNULL(frames);
 
   frames->clear();
-  for (size_t i = 0; i < frames_.size(); i++) {
-    if (frames_[i]->GetTimestamp() > latest_query_timestamp_ &&
-        frames_[i]->GetTimestamp() <= timestamp) {
-      frames->push_back(frames_[i]);
-    }
+  const size_t end = frames_.UpperBound(timestamp);
+  for (size_t i = frames_.UpperBound(latest_query_timestamp_); i < end; i++) {
+    frames->push_back(frames_[i].second);
   }
   latest_query_timestamp_ = timestamp;
 }
 
 SensorFramePtr Sensor::QueryLatestFrame(double timestamp) {
-  SensorFramePtr latest_frame = nullptr;
-  for (size_t i = 0; i < frames_.size(); i++) {
-    if (frames_[i]->GetTimestamp() > latest_query_timestamp_ &&
-        frames_[i]->GetTimestamp() <= timestamp) {
-      latest_frame = frames_[i];
-      latest_query_timestamp_ = frames_[i]->GetTimestamp();
-    }
+  const size_t end = frames_.UpperBound(timestamp);
+  if (end == 0 || frames_[end - 1].first <= latest_query_timestamp_) {
+    return nullptr;
   }
-  return latest_frame;
+  latest_query_timestamp_ = frames_[end - 1].first;
+  return frames_[end - 1].second;
 }
 
 bool Sensor::GetPose(double timestamp, Eigen::Affine3d* pose) const {
   CHECK_NOTNULL(pose);
 
-  for (int i = static_cast<int>(frames_.size()) - 1; i >= 0; --i) {
-    double time_diff = timestamp - frames_[i]->GetTimestamp();
-    if (fabs(time_diff) < 1.0e-3) {  // > ?
-      return frames_[i]->GetPose(pose);
+  if (!frames_.empty()) {
+    const auto& frame = frames_[frames_.Nearest(timestamp)];
+    if (fabs(timestamp - frame.first) < 1.0e-3) {
+      return frame.second->GetPose(pose);
     }
   }
 
@@ -65,11 +60,14 @@ bool Sensor::GetPose(double timestamp, Eigen::Affine3d* pose) const {
 }
 
 void Sensor::AddFrame(const base::FrameConstPtr& frame_ptr) {
-  SensorFramePtr frame = std::make_shared<SensorFrame>(frame_ptr);
-  if (frames_.size() == kMaxCachedFrameNum) {
-    frames_.pop_front();
+  AddFrame(std::make_shared<SensorFrame>(frame_ptr));
+}
+
+void Sensor::AddFrame(const SensorFramePtr& frame) {
+  if (frames_.capacity() != kMaxCachedFrameNum) {
+    frames_.set_capacity(kMaxCachedFrameNum);
   }
-  frames_.emplace_back(frame);
+  frames_.push(frame->GetTimestamp(), frame);
 }
 
 }  // namespace fusion
@@ -16,7 +16,6 @@
 
 #pragma once
 
-#include <deque>
 #include <memory>
 #include <string>
 #include <vector>
@@ -26,6 +25,7 @@
 #include "modules/perception/base/sensor_meta.h"
 #include "modules/perception/fusion/base/base_forward_declaration.h"
 #include "modules/perception/fusion/base/sensor_frame.h"
+#include "modules/perception/lib/utils/time_ring_buffer.h"
 
 namespace apollo {
 namespace perception {
@@ -58,6 +58,7 @@ class Sensor {
   inline base::SensorType GetSensorType() const { return sensor_info_.type; }
 
   void AddFrame(const base::FrameConstPtr& frame_ptr);
+  void AddFrame(const SensorFramePtr& frame);
 
   static void SetMaxCachedFrameNumber(size_t number) {
     kMaxCachedFrameNum = number;
@@ -74,7 +75,8 @@ class Sensor {
 
   double latest_query_timestamp_ = 0.0;
 
-  std::deque<SensorFramePtr> frames_;
+  // frames sorted by timestamp
+  lib::TimeRingBuffer<SensorFramePtr> frames_;
 
   static size_t kMaxCachedFrameNum;
 };
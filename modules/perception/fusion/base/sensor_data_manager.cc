@@ -35,6 +35,7 @@ bool SensorDataManager::Init() {
 }
 
 void SensorDataManager::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
   inited_ = false;
   sensor_manager_ = nullptr;
   sensors_.clear();
@@ -42,8 +43,13 @@ void SensorDataManager::Reset() {
 
 void SensorDataManager::AddSensorMeasurements(
     const base::FrameConstPtr& frame_ptr) {
-  const base::SensorInfo sensor_info = frame_ptr->sensor_info;
+  AddSensorMeasurements(std::make_shared<SensorFrame>(frame_ptr));
+}
+
+void SensorDataManager::AddSensorMeasurements(const SensorFramePtr& frame) {
+  const base::SensorInfo& sensor_info = frame->GetHeader()->sensor_info;
   std::string sensor_id = sensor_info.name;
+  std::lock_guard<std::mutex> lock(mutex_);
   const auto& it = sensors_.find(sensor_id);
   SensorPtr sensor_ptr = nullptr;
   if (it == sensors_.end()) {
@@ -59,7 +65,7 @@ void SensorDataManager::AddSensorMeasurements(
     sensor_ptr = it->second;
   }
 
-  sensor_ptr->AddFrame(frame_ptr);
+  sensor_ptr->AddFrame(frame);
 }
 
 bool SensorDataManager::IsLidar(const base::FrameConstPtr& frame_ptr) {
@@ -84,6 +90,7 @@ void SensorDataManager::GetLatestSensorFrames(
     AERROR << "Nullptr error.";
     return;
   }
+  std::lock_guard<std::mutex> lock(mutex_);
   const auto& it = sensors_.find(sensor_id);
   if (it == sensors_.end()) {
     return;
@@ -99,10 +106,13 @@ void SensorDataManager::GetLatestFrames(
   }
 
   frames->clear();
-  for (auto it = sensors_.begin(); it != sensors_.end(); ++it) {
-    SensorFramePtr frame = it->second->QueryLatestFrame(timestamp);
-    if (frame != nullptr) {
-      frames->push_back(frame);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = sensors_.begin(); it != sensors_.end(); ++it) {
+      SensorFramePtr frame = it->second->QueryLatestFrame(timestamp);
+      if (frame != nullptr) {
+        frames->push_back(frame);
+      }
     }
   }
 
@@ -126,6 +136,7 @@ bool SensorDataManager::GetPose(const std::string& sensor_id, double timestamp,
     return false;
   }
 
+  std::lock_guard<std::mutex> lock(mutex_);
   const auto& it = sensors_.find(sensor_id);
   if (it == sensors_.end()) {
     AERROR << "Failed to find sensor " << sensor_id << " for get pose.";
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -40,6 +41,10 @@ class SensorDataManager {
   void Reset();
 
   void AddSensorMeasurements(const base::FrameConstPtr& frame_ptr);
+  // @brief: add a frame already prepared by the caller, the frames are
+  // added from the sensor threads while the fusion queries them, the
+  // frames and poses are guarded by mutex_
+  void AddSensorMeasurements(const SensorFramePtr& frame);
 
   bool IsLidar(const base::FrameConstPtr& frame_ptr);
   bool IsRadar(const base::FrameConstPtr& frame_ptr);
@@ -60,6 +65,7 @@ class SensorDataManager {
 
  private:
   bool inited_ = false;
+  mutable std::mutex mutex_;
   std::unordered_map<std::string, SensorPtr> sensors_;
 
   const common::SensorManager* sensor_manager_ = nullptr;
@@ -33,11 +33,15 @@ struct SensorFrameHeader {
   base::SensorInfo sensor_info;
   double timestamp = 0.0;
   Eigen::Affine3d sensor2world_pose;
+  // computed once when the frame is added, the association and the
+  // camera related fusion project every track into the sensor with it
+  Eigen::Affine3d world2sensor_pose;
 
   SensorFrameHeader() = default;
   SensorFrameHeader(const base::SensorInfo& info,
   double ts, const Eigen::Affine3d& pose): sensor_info(info),
-  timestamp(ts), sensor2world_pose(pose) {
+  timestamp(ts), sensor2world_pose(pose),
+  world2sensor_pose(pose.inverse()) {
   }
 };
 
@@ -61,6 +61,16 @@ bool SensorObject::GetRelatedFramePose(Eigen::Affine3d* pose) const {
   return true;
 }
 
+bool SensorObject::GetRelatedFrameInversePose(Eigen::Affine3d* pose) const {
+  CHECK_NOTNULL(pose);
+  if (frame_header_ == nullptr) {
+    return false;
+  }
+
+  *pose = frame_header_->world2sensor_pose;
+  return true;
+}
+
 std::string SensorObject::GetSensorId() const {
   if (frame_header_ == nullptr) {
     return std::string("");
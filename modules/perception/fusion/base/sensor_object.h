@@ -48,6 +48,7 @@ class SensorObject {
   // @brief get frame timestamp which might be different with object timestamp
   double GetTimestamp() const;
   bool GetRelatedFramePose(Eigen::Affine3d* pose) const;
+  bool GetRelatedFrameInversePose(Eigen::Affine3d* pose) const;
 
   std::string GetSensorId() const;
   base::SensorType GetSensorType() const;
@@ -55,12 +55,15 @@ TEST(SensorObjectTest, test) {
   EXPECT_DOUBLE_EQ(object->GetTimestamp(), 7012);
   EXPECT_TRUE(object->GetRelatedFramePose(&pose));
   EXPECT_EQ((pose.matrix() - sensor2world_pose.matrix()).trace(), 0.0);
+  EXPECT_TRUE(object->GetRelatedFrameInversePose(&pose));
+  EXPECT_EQ((pose.matrix() - sensor2world_pose.matrix()).trace(), 0.0);
   EXPECT_EQ(object->GetSensorId(), "test");
   EXPECT_TRUE(object->GetBaseObject() != nullptr);
 
   object->frame_header_ = nullptr;
   EXPECT_DOUBLE_EQ(object->GetTimestamp(), 0);
   EXPECT_FALSE(object->GetRelatedFramePose(&pose));
+  EXPECT_FALSE(object->GetRelatedFrameInversePose(&pose));
   EXPECT_EQ(object->GetSensorId(), "");
 
   FusedObjectPtr fused_object(new FusedObject());
@@ -80,6 +80,46 @@ TEST(ProjectionCache, test_projection_cache_query_object_2) {
   cache_object_ptr = nullptr;
 }
 
+TEST(ProjectionCache, test_projection_cache_reuse) {
+  ProjectionCache projection_cache;
+  projection_cache.Reset("camera_obstacle", 1.0);
+  ProjectionCacheObject* cache_object = projection_cache.BuildObject(
+      "camera_obstacle", 1.0, "lidar", 0.95, 1);
+  ASSERT_TRUE(cache_object != nullptr);
+  projection_cache.AddPoint(Eigen::Vector2f(2, 3));
+  projection_cache.AddPoint(Eigen::Vector2f(4, 5));
+  cache_object->SetEndInd(projection_cache.GetPoint2dsSize());
+  cache_object = projection_cache.BuildObject(
+      "camera_obstacle", 1.0, "lidar", 0.98, 2);
+  ASSERT_TRUE(cache_object != nullptr);
+  cache_object->SetStartInd(projection_cache.GetPoint2dsSize());
+  projection_cache.AddPoint(Eigen::Vector2f(6, 7));
+  cache_object->SetEndInd(projection_cache.GetPoint2dsSize());
+
+  // the lidar frame at 0.95 is the measurement now, its projection on the
+  // camera frame at 1.0 is reused
+  projection_cache.Reset("lidar", 0.95);
+  EXPECT_TRUE(projection_cache.QueryObject("lidar", 0.95,
+      "camera_obstacle", 1.0, 1) != nullptr);
+  EXPECT_FALSE(projection_cache.QueryObject("lidar", 0.95,
+      "camera_obstacle", 1.1, 1) != nullptr);
+  EXPECT_EQ(projection_cache.GetQueryCount(), 2);
+  EXPECT_EQ(projection_cache.GetHitCount(), 1);
+  EXPECT_NEAR(projection_cache.GetHitRate(), 0.5, 1e-6);
+
+  // outdated frames are dropped, the kept points are compacted
+  projection_cache.SetMaxCacheTime(0.5);
+  projection_cache.Reset("camera_obstacle", 1.45);
+  cache_object = projection_cache.QueryObject("camera_obstacle", 1.0,
+      "lidar", 0.98, 2);
+  ASSERT_TRUE(cache_object != nullptr);
+  EXPECT_EQ(projection_cache.GetPoint2dsSize(), 3);
+  projection_cache.Reset("camera_obstacle", 2.0);
+  EXPECT_FALSE(projection_cache.QueryObject("camera_obstacle", 1.0,
+      "lidar", 0.98, 2) != nullptr);
+  EXPECT_EQ(projection_cache.GetPoint2dsSize(), 0);
+}
+
 TEST(BoundedScalePositiveProbability, test_probability_1) {
   double p = 0.2;
   double max_p = 0.4;
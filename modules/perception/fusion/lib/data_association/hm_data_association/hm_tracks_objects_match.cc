@@ -15,7 +15,9 @@
  *****************************************************************************/
 #include "modules/perception/fusion/lib/data_association/hm_data_association/hm_tracks_objects_match.h"
 
+#include <cmath>
 #include <map>
+#include <unordered_map>
 #include <utility>
 
 #include "modules/perception/common/graph/secure_matrix.h"
@@ -31,6 +33,7 @@ double HMTrackersObjectsAssociation::s_match_distance_bound_ = 100.0;
  * is 2 times of ave error around 200m. */
 double HMTrackersObjectsAssociation::s_association_center_dist_threshold_ =
     30.0;
+int HMTrackersObjectsAssociation::s_num_matching_threads_ = 4;
 
 template <typename T>
 void extract_vector(const std::vector<T>& vec,
@@ -136,6 +139,11 @@ bool HMTrackersObjectsAssociation::Associate(
         << association_result->unassigned_tracks.size()
         << ", unassigned_measuremnets = "
         << association_result->unassigned_measurements.size();
+  const ProjectionCache& projection_cache =
+      track_object_distance_.projection_cache();
+  ADEBUG << "projection cache: queries = " << projection_cache.GetQueryCount()
+         << ", hits = " << projection_cache.GetHitCount()
+         << ", hit_rate = " << projection_cache.GetHitRate();
 
   return state;
 }
@@ -305,32 +313,56 @@ void HMTrackersObjectsAssociation::ComputeAssociationDistanceMat(
   Eigen::Vector3d tmp = Eigen::Vector3d::Zero();
   opt.ref_point = &tmp;
   association_mat->resize(unassigned_tracks.size());
+  for (auto& row : *association_mat) {
+    row.assign(unassigned_measurements.size(), s_match_distance_thresh_);
+  }
+  // hash the measurement centers into a grid whose cell is as large as the
+  // center gate, only measurements of the 3x3 cells around a track can be
+  // inside its gate, all the others keep the match distance threshold
+  const double cell_size = s_association_center_dist_threshold_;
+  auto cell_key = [cell_size](const Eigen::Vector3d& center, int dx,
+                              int dy) {
+    const int64_t cx =
+        static_cast<int64_t>(std::floor(center(0) / cell_size)) + dx;
+    const int64_t cy =
+        static_cast<int64_t>(std::floor(center(1) / cell_size)) + dy;
+    return static_cast<int64_t>((static_cast<uint64_t>(cx) << 32) ^
+                                (static_cast<uint64_t>(cy) & 0xffffffffu));
+  };
+  std::unordered_map<int64_t, std::vector<size_t>> measurement_grid;
+  for (size_t j = 0; j < unassigned_measurements.size(); ++j) {
+    const SensorObjectPtr& sensor_object =
+        sensor_objects[unassigned_measurements[j]];
+    measurement_grid[cell_key(sensor_object->GetBaseObject()->center, 0, 0)]
+        .push_back(j);
+  }
   for (size_t i = 0; i < unassigned_tracks.size(); ++i) {
     int fusion_idx = static_cast<int>(unassigned_tracks[i]);
-    (*association_mat)[i].resize(unassigned_measurements.size());
     const TrackPtr& fusion_track = fusion_tracks[fusion_idx];
-    for (size_t j = 0; j < unassigned_measurements.size(); ++j) {
-      int sensor_idx = static_cast<int>(unassigned_measurements[j]);
-      const SensorObjectPtr& sensor_object = sensor_objects[sensor_idx];
-      double distance = s_match_distance_thresh_;
-      double center_dist =
-          (sensor_object->GetBaseObject()->center -
-           fusion_track->GetFusedObject()->GetBaseObject()->center)
-              .norm();
-      if (center_dist < s_association_center_dist_threshold_) {
-        distance =
-            track_object_distance_.Compute(fusion_track, sensor_object, opt);
-      } else {
-        ADEBUG << "center_distance " << center_dist
-               << " exceeds slack threshold "
-               << s_association_center_dist_threshold_
-               << ", track_id: " << fusion_track->GetTrackId()
-               << ", obs_id: " << sensor_object->GetBaseObject()->track_id;
+    const Eigen::Vector3d& track_center =
+        fusion_track->GetFusedObject()->GetBaseObject()->center;
+    for (int dx = -1; dx <= 1; ++dx) {
+      for (int dy = -1; dy <= 1; ++dy) {
+        auto cell = measurement_grid.find(cell_key(track_center, dx, dy));
+        if (cell == measurement_grid.end()) {
+          continue;
+        }
+        for (size_t j : cell->second) {
+          int sensor_idx = static_cast<int>(unassigned_measurements[j]);
+          const SensorObjectPtr& sensor_object = sensor_objects[sensor_idx];
+          double center_dist =
+              (sensor_object->GetBaseObject()->center - track_center).norm();
+          if (center_dist >= s_association_center_dist_threshold_) {
+            continue;
+          }
+          double distance =
+              track_object_distance_.Compute(fusion_track, sensor_object, opt);
+          (*association_mat)[i][j] = distance;
+          ADEBUG << "track_id: " << fusion_track->GetTrackId()
+                 << ", obs_id: " << sensor_object->GetBaseObject()->track_id
+                 << ", distance: " << distance;
+        }
       }
-      (*association_mat)[i][j] = distance;
-      ADEBUG << "track_id: " << fusion_track->GetTrackId()
-             << ", obs_id: " << sensor_object->GetBaseObject()->track_id
-             << ", distance: " << distance;
     }
   }
 }
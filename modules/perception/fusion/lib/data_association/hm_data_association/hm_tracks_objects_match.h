@@ -37,6 +37,7 @@ class HMTrackersObjectsAssociation : public BaseDataAssociation {
   bool Init() override {
     track_object_distance_.set_distance_thresh(
       static_cast<float>(s_match_distance_thresh_));
+    optimizer_.set_num_threads(s_num_matching_threads_);
     return true;
   }
 
@@ -97,6 +98,7 @@ class HMTrackersObjectsAssociation : public BaseDataAssociation {
   static double s_match_distance_thresh_;
   static double s_match_distance_bound_;
   static double s_association_center_dist_threshold_;
+  static int s_num_matching_threads_;
 };
 
 }  // namespace fusion
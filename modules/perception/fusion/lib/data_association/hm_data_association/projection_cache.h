@@ -15,8 +15,10 @@
  *****************************************************************************/
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Eigen/StdVector"
@@ -63,12 +65,36 @@ class ProjectionCacheFrame {
   ProjectionCacheFrame() : sensor_id_(""), timestamp_(0.0) {}
   ProjectionCacheFrame(std::string sensor_id, double timestamp)
       : sensor_id_(sensor_id), timestamp_(timestamp) {}
+  ProjectionCacheFrame(std::string measurement_sensor_id,
+                       double measurement_timestamp, std::string sensor_id,
+                       double timestamp)
+      : measurement_sensor_id_(measurement_sensor_id),
+        measurement_timestamp_(measurement_timestamp),
+        sensor_id_(sensor_id),
+        timestamp_(timestamp) {}
   bool VerifyKey(std::string sensor_id, double timestamp) {
     if (sensor_id_ != sensor_id || fabs(timestamp_ - timestamp) > DBL_EPSILON) {
       return false;
     }
     return true;
   }
+  // @brief: the projection of a lidar frame on a camera frame does not
+  // depend on which of the two is the measurement, so the frame matches
+  // the pair of keys in both orders
+  bool VerifyKey(const std::string& measurement_sensor_id,
+                 double measurement_timestamp, const std::string& sensor_id,
+                 double timestamp) {
+    if (VerifyKey(sensor_id, timestamp)) {
+      return VerifyMeasurementKey(measurement_sensor_id,
+                                  measurement_timestamp);
+    }
+    return VerifyKey(measurement_sensor_id, measurement_timestamp) &&
+           VerifyMeasurementKey(sensor_id, timestamp);
+  }
+  // @brief: the latest timestamp of the two frames
+  double GetLatestTimestamp() const {
+    return std::max(measurement_timestamp_, timestamp_);
+  }
   ProjectionCacheObject* BuildObject(int lidar_object_id) {
     objects_[lidar_object_id] = ProjectionCacheObject();
     return QueryObject(lidar_object_id);
@@ -81,15 +107,26 @@ class ProjectionCacheFrame {
       return &(it->second);
     }
   }
+  std::map<int, ProjectionCacheObject>* GetObjects() { return &objects_; }
 
  private:
+  bool VerifyMeasurementKey(const std::string& sensor_id, double timestamp) {
+    return measurement_sensor_id_ == sensor_id &&
+           fabs(measurement_timestamp_ - timestamp) <= DBL_EPSILON;
+  }
+
+  // sensor id & timestamp of the measurement the frame was built for
+  std::string measurement_sensor_id_;
+  double measurement_timestamp_ = 0.0;
   // sensor id of cached project frame
   std::string sensor_id_;
   double timestamp_;
   std::map<int, ProjectionCacheObject> objects_;
 };  // class ProjectionCacheFrame
 
-// @brief: project cache
+// @brief: project cache, the frames are kept across measurements until
+// both of their timestamps are older than the cache time of the latest
+// measurement, so that a lidar frame is projected on a camera frame once
 class ProjectionCache {
  public:
   ProjectionCache() : measurement_sensor_id_(""), measurement_timestamp_(0.0) {
@@ -103,12 +140,35 @@ class ProjectionCache {
     // velodyne64
     point2ds_.reserve(300000);
   }
-  // reset projection cache
+  // reset projection cache for a new measurement, drop the outdated frames
   void Reset(std::string sensor_id, double timestamp) {
     measurement_sensor_id_ = sensor_id;
     measurement_timestamp_ = timestamp;
-    point2ds_.clear();
-    frames_.clear();
+    std::vector<ProjectionCacheFrame> frames;
+    frames.reserve(frames_.size());
+    for (auto& frame : frames_) {
+      if (frame.GetLatestTimestamp() >= timestamp - max_cache_time_) {
+        frames.push_back(std::move(frame));
+      }
+    }
+    frames_.swap(frames);
+    CompactPoints();
+  }
+  // set how long the frames are kept, in seconds
+  void SetMaxCacheTime(double max_cache_time) {
+    max_cache_time_ = max_cache_time;
+  }
+  // statistics of object queries
+  size_t GetQueryCount() const { return query_count_; }
+  size_t GetHitCount() const { return hit_count_; }
+  double GetHitRate() const {
+    return query_count_ == 0 ? 0.0
+                             : static_cast<double>(hit_count_) /
+                                   static_cast<double>(query_count_);
+  }
+  void ResetStatistics() {
+    query_count_ = 0;
+    hit_count_ = 0;
   }
   // getters
   Eigen::Vector2d* GetPoint2d(size_t ind) {
@@ -130,10 +190,12 @@ class ProjectionCache {
     if (!VerifyKey(measurement_sensor_id, measurement_timestamp)) {
       return nullptr;
     }
-    ProjectionCacheFrame* frame = QueryFrame(projection_sensor_id,
-        projection_timestamp);
+    ProjectionCacheFrame* frame =
+        QueryFrame(measurement_sensor_id, measurement_timestamp,
+                   projection_sensor_id, projection_timestamp);
     if (frame == nullptr) {
-      frame = BuildFrame(projection_sensor_id, projection_timestamp);
+      frame = BuildFrame(measurement_sensor_id, measurement_timestamp,
+                         projection_sensor_id, projection_timestamp);
     }
     if (frame == nullptr) {
       return nullptr;
@@ -145,15 +207,18 @@ class ProjectionCache {
       const std::string& measurement_sensor_id, double measurement_timestamp,
       const std::string& projection_sensor_id, double projection_timestamp,
       int lidar_object_id) {
-    if (!VerifyKey(measurement_sensor_id, measurement_timestamp)) {
-      return nullptr;
-    }
+    ++query_count_;
     ProjectionCacheFrame* frame =
-        QueryFrame(projection_sensor_id, projection_timestamp);
+        QueryFrame(measurement_sensor_id, measurement_timestamp,
+                   projection_sensor_id, projection_timestamp);
     if (frame == nullptr) {
       return nullptr;
     }
-    return frame->QueryObject(lidar_object_id);
+    ProjectionCacheObject* object = frame->QueryObject(lidar_object_id);
+    if (object != nullptr) {
+      ++hit_count_;
+    }
+    return object;
   }
 
  private:
@@ -164,21 +229,59 @@ class ProjectionCache {
     }
     return true;
   }
-  ProjectionCacheFrame* BuildFrame(const std::string& sensor_id,
+  ProjectionCacheFrame* BuildFrame(const std::string& measurement_sensor_id,
+                                   double measurement_timestamp,
+                                   const std::string& sensor_id,
                                    double timestamp) {
-    frames_.push_back(ProjectionCacheFrame(sensor_id, timestamp));
+    frames_.push_back(ProjectionCacheFrame(
+        measurement_sensor_id, measurement_timestamp, sensor_id, timestamp));
     return &(frames_[frames_.size() - 1]);
   }
-  ProjectionCacheFrame* QueryFrame(const std::string& sensor_id,
+  ProjectionCacheFrame* QueryFrame(const std::string& measurement_sensor_id,
+                                   double measurement_timestamp,
+                                   const std::string& sensor_id,
                                    double timestamp) {
     for (size_t i = 0; i < frames_.size(); ++i) {
-      if (!frames_[i].VerifyKey(sensor_id, timestamp)) {
+      if (!frames_[i].VerifyKey(measurement_sensor_id, measurement_timestamp,
+                                sensor_id, timestamp)) {
         continue;
       }
       return &(frames_[i]);
     }
     return nullptr;
   }
+  // move the points of the kept objects to the front of the memory
+  void CompactPoints() {
+    if (frames_.empty()) {
+      point2ds_.clear();
+      return;
+    }
+    std::vector<std::pair<size_t, ProjectionCacheObject*>> objects;
+    for (auto& frame : frames_) {
+      for (auto& object : *frame.GetObjects()) {
+        objects.emplace_back(object.second.GetStartInd(), &object.second);
+      }
+    }
+    std::sort(objects.begin(), objects.end(),
+              [](const std::pair<size_t, ProjectionCacheObject*>& lhs,
+                 const std::pair<size_t, ProjectionCacheObject*>& rhs) {
+                return lhs.first < rhs.first;
+              });
+    size_t size = 0;
+    for (auto& object : objects) {
+      ProjectionCacheObject* cache_object = object.second;
+      const size_t object_size = cache_object->Size();
+      if (cache_object->GetStartInd() != size) {
+        std::copy(point2ds_.begin() + cache_object->GetStartInd(),
+                  point2ds_.begin() + cache_object->GetEndInd(),
+                  point2ds_.begin() + size);
+      }
+      cache_object->SetStartInd(size);
+      cache_object->SetEndInd(size + object_size);
+      size += object_size;
+    }
+    point2ds_.resize(size);
+  }
 
  private:
   // sensor id & timestamp of measurement, which are the key of project cache
@@ -188,6 +291,11 @@ class ProjectionCache {
   std::vector<Eigen::Vector2d> point2ds_;
   // cache reference on frames
   std::vector<ProjectionCacheFrame> frames_;
+  // frames whose timestamps are both older than this time before the
+  // measurement are dropped
+  double max_cache_time_ = 0.5;
+  size_t query_count_ = 0;
+  size_t hit_count_ = 0;
 };  // class ProjectionCache
 
 typedef ProjectionCache* ProjectionCachePtr;
@@ -75,13 +75,11 @@ base::BaseCameraModelPtr TrackObjectDistance::QueryCameraModel(
 
 bool TrackObjectDistance::QueryWorld2CameraPose(
     const SensorObjectConstPtr& camera, Eigen::Matrix4d* pose) {
-  Eigen::Affine3d camera2world_pose;
-  bool status = SensorDataManager::Instance()->GetPose(
-      camera->GetSensorId(), camera->GetTimestamp(), &camera2world_pose);
-  if (status == false) {
+  Eigen::Affine3d world2camera_pose;
+  if (!camera->GetRelatedFrameInversePose(&world2camera_pose)) {
     return false;
   }
-  (*pose) = camera2world_pose.matrix().inverse();
+  (*pose) = world2camera_pose.matrix();
   return true;
 }
 
@@ -172,19 +170,24 @@ ProjectionCacheObject* TrackObjectDistance::BuildProjectionCacheObject(
       every_n = cloud.size() /
                 s_lidar2camera_projection_downsample_target_pts_num_;
     }
-    for (size_t i = 0; i < cloud.size(); ++i) {
-      if ((every_n > 1) && (i % every_n != 0)) continue;
-      const base::PointF& pt = cloud.at(i);
-      Eigen::Vector4d project_pt =
-          static_cast<Eigen::Matrix<double, 4, 1, 0, 4, 1>>
-          (lidar2camera_pose * Eigen::Vector4d(pt.x + offset(0),
-                                               pt.y + offset(1),
-                                               pt.z + offset(2), 1.0));
-      if (project_pt(2) <= 0) continue;
-      Eigen::Vector2f project_pt2f = camera_model->Project(
-          Eigen::Vector3f(static_cast<float>(project_pt(0)),
-                          static_cast<float>(project_pt(1)),
-                          static_cast<float>(project_pt(2))));
+    // 5.2 transform the sampled points in one batch, the offset is folded
+    // into the translation so that the product is vectorized by eigen
+    const size_t num_pts = (cloud.size() + every_n - 1) / every_n;
+    Eigen::Matrix3Xf pts(3, num_pts);
+    for (size_t i = 0; i < num_pts; ++i) {
+      const base::PointF& pt = cloud.at(i * every_n);
+      pts.col(i) << pt.x, pt.y, pt.z;
+    }
+    const Eigen::Matrix3d rotation = lidar2camera_pose.topLeftCorner<3, 3>();
+    const Eigen::Vector3f translation =
+        (rotation * offset + lidar2camera_pose.topRightCorner<3, 1>())
+            .cast<float>();
+    Eigen::Matrix3Xf project_pts = rotation.cast<float>() * pts;
+    project_pts.colwise() += translation;
+    for (size_t i = 0; i < num_pts; ++i) {
+      if (project_pts(2, i) <= 0) continue;
+      Eigen::Vector2f project_pt2f =
+          camera_model->Project(project_pts.col(i));
       if (!IsPtInFrustum(project_pt2f, width, height)) continue;
       if (project_pt2f.x() < xmin) xmin = project_pt2f.x();
       if (project_pt2f.y() < ymin) ymin = project_pt2f.y();
@@ -52,6 +52,9 @@ class TrackObjectDistance {
   void ResetProjectionCache(std::string sensor_id, double timestamp) {
     projection_cache_.Reset(sensor_id, timestamp);
   }
+  // @brief: the projection cache is kept across measurements, its
+  // statistics tell how often a projection is reused
+  const ProjectionCache& projection_cache() const { return projection_cache_; }
 
   // @brief: compute the distance between input fused track and sensor object
   // @params [in] fused_track: maintained fused track
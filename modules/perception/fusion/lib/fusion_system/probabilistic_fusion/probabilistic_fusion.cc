@@ -113,21 +113,23 @@ bool ProbabilisticFusion::Fuse(const FusionOptions& options,
   CHECK(fused_objects != nullptr) << "fusion error: fused_objects is nullptr";
 
   auto* sensor_data_manager = SensorDataManager::Instance();
-  // 1. save frame data
-  data_mutex_.lock();
   if (sensor_data_manager->IsLidar(sensor_frame) && !params_.use_lidar) {
-    data_mutex_.unlock();
     return true;
   }
   if (sensor_data_manager->IsRadar(sensor_frame) && !params_.use_radar) {
-    data_mutex_.unlock();
     return true;
   }
   if (sensor_data_manager->IsCamera(sensor_frame) && !params_.use_camera) {
-    data_mutex_.unlock();
     return true;
   }
 
+  // 1. prepare the frame on the thread of its sensor, without holding any
+  // lock, so that neither the other sensors nor the fusion of the main
+  // sensor wait for it
+  SensorFramePtr frame = std::make_shared<SensorFrame>(sensor_frame);
+
+  // 2. save frame data
+  data_mutex_.lock();
   bool is_publish_sensor = this->IsPublishSensor(sensor_frame);
   if (is_publish_sensor) {
     started_ = true;
@@ -137,7 +139,7 @@ bool ProbabilisticFusion::Fuse(const FusionOptions& options,
     AINFO << "add sensor measurement: " << sensor_frame->sensor_info.name
              << ", obj_cnt : " << sensor_frame->objects.size() << ", "
              << GLOG_TIMESTAMP(sensor_frame->timestamp);
-    sensor_data_manager->AddSensorMeasurements(sensor_frame);
+    sensor_data_manager->AddSensorMeasurements(frame);
   }
 
   data_mutex_.unlock();
@@ -145,19 +147,19 @@ bool ProbabilisticFusion::Fuse(const FusionOptions& options,
     return true;
   }
 
-  // 2. query related sensor_frames for fusion
+  // 3. query related sensor_frames for fusion
   fuse_mutex_.lock();
   double fusion_time = sensor_frame->timestamp;
   std::vector<SensorFramePtr> frames;
   sensor_data_manager->GetLatestFrames(fusion_time, &frames);
   AINFO << "Get " << frames.size() << " related frames for fusion";
 
-  // 3. peform fusion on related frames
+  // 4. peform fusion on related frames
   for (size_t i = 0; i < frames.size(); ++i) {
     this->FuseFrame(frames[i]);
   }
 
-  // 4. collect fused objects
+  // 5. collect fused objects
   this->CollectFusedObjects(fusion_time, fused_objects);
 
   fuse_mutex_.unlock();
@@ -54,7 +54,9 @@ bool CaffeNet::Init(const std::map<std::string, std::vector<int>> &shapes) {
       continue;
     }
     std::shared_ptr<apollo::perception::base::Blob<float>> blob;
-    blob.reset(new apollo::perception::base::Blob<float>(caffe_blob->shape()));
+    // pinned host memory, for the copies to and from the net
+    blob.reset(
+        new apollo::perception::base::Blob<float>(caffe_blob->shape(), true));
     blobs_.insert(std::make_pair(name, blob));
   }
   for (auto name : input_names_) {
@@ -63,7 +65,9 @@ bool CaffeNet::Init(const std::map<std::string, std::vector<int>> &shapes) {
       continue;
     }
     std::shared_ptr<apollo::perception::base::Blob<float>> blob;
-    blob.reset(new apollo::perception::base::Blob<float>(caffe_blob->shape()));
+    // pinned host memory, for the copies to and from the net
+    blob.reset(
+        new apollo::perception::base::Blob<float>(caffe_blob->shape(), true));
     blobs_.insert(std::make_pair(name, blob));
   }
   return true;
@@ -120,7 +124,9 @@ void CaffeNet::Infer() {
     }
   }
 
+  infer_timer_.Start(0);
   net_->Forward();
+  infer_timer_.End(0, "CaffeNet_Infer");
   for (auto name : output_names_) {
     auto blob = get_blob(name);
     auto caffe_blob = net_->blob_by_name(name);
@@ -25,6 +25,7 @@
 #include "caffe/caffe.hpp"
 
 #include "modules/perception/inference/inference.h"
+#include "modules/perception/inference/utils/cuda_event_timer.h"
 
 namespace apollo {
 namespace perception {
@@ -59,6 +60,7 @@ class CaffeNet : public Inference {
   std::vector<std::string> output_names_;
   std::vector<std::string> input_names_;
   BlobMap blobs_;
+  CudaEventTimer infer_timer_;
 };
 
 }  // namespace inference
@@ -17,12 +17,38 @@
 #include "modules/perception/inference/inference_factory.h"
 
 #include "modules/perception/inference/caffe/caffe_net.h"
+#include "modules/perception/inference/tensorrt/rt_common.h"
 #include "modules/perception/inference/tensorrt/rt_net.h"
+#include "modules/perception/inference/tensorrt/rt_utils.h"
 
 namespace apollo {
 namespace perception {
 namespace inference {
 
+namespace {
+
+// builds the model with TensorRT, which fuses its layers and runs the batch
+// in one engine, unless TensorRT can not build one of its layers
+Inference *CreateAutoInference(const std::string &proto_file,
+                               const std::string &weight_file,
+                               const std::vector<std::string> &outputs,
+                               const std::vector<std::string> &inputs) {
+  NetParameter net_param;
+  std::string unsupported_type;
+  if (!loadNetParams(proto_file, &net_param)) {
+    AWARN << "Failed to read " << proto_file << ", fall back to CaffeNet";
+  } else if (!IsSupportedByRTNet(net_param, &unsupported_type)) {
+    AWARN << "RTNet can not build the " << unsupported_type << " layer of "
+          << proto_file << ", fall back to CaffeNet";
+  } else {
+    AINFO << "Run " << proto_file << " with RTNet";
+    return new RTNet(proto_file, weight_file, outputs, inputs);
+  }
+  return new CaffeNet(proto_file, weight_file, outputs, inputs);
+}
+
+}  // namespace
+
 Inference *CreateInferenceByName(const std::string &name,
                                  const std::string &proto_file,
                                  const std::string &weight_file,
@@ -35,6 +61,8 @@ Inference *CreateInferenceByName(const std::string &name,
     return new RTNet(proto_file, weight_file, outputs, inputs);
   } else if (name == "RTNetInt8") {
     return new RTNet(proto_file, weight_file, outputs, inputs, model_root);
+  } else if (name == "Auto") {
+    return CreateAutoInference(proto_file, weight_file, outputs, inputs);
   }
   return nullptr;
 }
@@ -24,6 +24,12 @@ namespace apollo {
 namespace perception {
 namespace inference {
 
+/**
+ * @brief Creates the inference of a caffe model by the name of its backend:
+ * "CaffeNet", "RTNet", "RTNetInt8" or "Auto". "Auto" picks RTNet if it can
+ * build every layer of the model and CaffeNet otherwise.
+ * @return nullptr for an unknown name
+ */
 Inference *CreateInferenceByName(const std::string &name,
                                  const std::string &proto_file,
                                  const std::string &weight_file,
@@ -27,6 +27,14 @@ namespace inference {
 
 TEST(Inference_Factory, default) {}
 
+TEST(Inference_Factory, unknown_name) {
+  std::vector<std::string> outputs{"prob"};
+  std::vector<std::string> inputs{"data"};
+  EXPECT_EQ(CreateInferenceByName("OnnxNet", "deploy.prototxt",
+                                  "model.caffemodel", outputs, inputs),
+            nullptr);
+}
+
 }  // namespace inference
 }  // namespace perception
 }  // namespace apollo
@@ -44,6 +44,18 @@ class ArgMax1Plugin : public nvinfer1::IPlugin {
     }
   }
 
+  // @brief restore a plugin serialized by serialize(), used when a cached
+  // engine is deserialized
+  ArgMax1Plugin(const void *serial_data, size_t serial_length) {
+    const char *d = reinterpret_cast<const char *>(serial_data), *a = d;
+    ReadFromBuffer(&d, &out_max_val_);
+    ReadFromBuffer(&d, &top_k_);
+    ReadFromBuffer(&d, &axis_);
+    ReadFromBuffer(&d, &input_dims_);
+    ReadFromBuffer(&d, &output_dims_);
+    CHECK_EQ(d, a + serial_length);
+  }
+
   /**
    * \brief get the number of outputs from the layer
    *
@@ -79,10 +91,18 @@ class ArgMax1Plugin : public nvinfer1::IPlugin {
   virtual int enqueue(int batchSize, const void *const *inputs, void **outputs,
                       void *workspace, cudaStream_t stream);
 
-  size_t getSerializationSize() override { return 0; }
+  size_t getSerializationSize() override {
+    return sizeof(out_max_val_) + sizeof(top_k_) + sizeof(axis_) +
+           sizeof(input_dims_) + sizeof(output_dims_);
+  }
 
   void serialize(void *buffer) override {
     char *d = reinterpret_cast<char *>(buffer), *a = d;
+    WriteToBuffer(out_max_val_, &d);
+    WriteToBuffer(top_k_, &d);
+    WriteToBuffer(axis_, &d);
+    WriteToBuffer(input_dims_, &d);
+    WriteToBuffer(output_dims_, &d);
     size_t size = getSerializationSize();
     CHECK_EQ(d, a + size);
   }
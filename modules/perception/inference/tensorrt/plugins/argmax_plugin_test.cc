@@ -16,6 +16,8 @@
 
 #include "modules/perception/inference/tensorrt/plugins/argmax_plugin.h"
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 TEST(ArgmaxPluginsTest, test) {
@@ -31,6 +33,14 @@ TEST(ArgmaxPluginsTest, test) {
                                                             in_dims);
     auto out_dims = arg_plugin.getOutputDimensions(0, &in_dims, 3);
     EXPECT_EQ(out_dims.d[0], 2);
+
+    std::vector<char> buffer(arg_plugin.getSerializationSize());
+    arg_plugin.serialize(buffer.data());
+    apollo::perception::inference::ArgMax1Plugin arg_plugin2(buffer.data(),
+                                                             buffer.size());
+    out_dims = arg_plugin2.getOutputDimensions(0, &in_dims, 3);
+    EXPECT_EQ(out_dims.d[0], 2);
+    EXPECT_EQ(out_dims.d[2], 20);
   }
   {
     apollo::perception::inference::ArgMaxParameter argmax_param;
@@ -50,6 +50,16 @@ class SLICEPlugin : public nvinfer1::IPlugin {
     out_slice_dims_.push_back(input_dims_.d[axis_] -
                               slice_point_[slice_point_.size() - 1]);
   }
+  // @brief restore a plugin serialized by serialize(), used when a cached
+  // engine is deserialized
+  SLICEPlugin(const void *serial_data, size_t serial_length) {
+    const char *d = reinterpret_cast<const char *>(serial_data), *a = d;
+    ReadVector(&d, &slice_point_);
+    ReadVector(&d, &out_slice_dims_);
+    ReadFromBuffer(&d, &axis_);
+    ReadFromBuffer(&d, &input_dims_);
+    CHECK_EQ(d, a + serial_length);
+  }
   SLICEPlugin() {}
   ~SLICEPlugin() {}
   virtual int initialize() { return 0; }
@@ -75,14 +85,37 @@ class SLICEPlugin : public nvinfer1::IPlugin {
   virtual int enqueue(int batchSize, const void *const *inputs, void **outputs,
                       void *workspace, cudaStream_t stream);
 
-  size_t getSerializationSize() override { return 0; }
+  size_t getSerializationSize() override {
+    return sizeof(int) * (2 + slice_point_.size() + out_slice_dims_.size()) +
+           sizeof(axis_) + sizeof(input_dims_);
+  }
 
   void serialize(void *buffer) override {
     char *d = reinterpret_cast<char *>(buffer), *a = d;
+    WriteVector(slice_point_, &d);
+    WriteVector(out_slice_dims_, &d);
+    WriteToBuffer(axis_, &d);
+    WriteToBuffer(input_dims_, &d);
     size_t size = getSerializationSize();
     CHECK_EQ(d, a + size);
   }
 
+ private:
+  static void WriteVector(const std::vector<int> &values, char **buffer) {
+    WriteToBuffer(static_cast<int>(values.size()), buffer);
+    for (int value : values) {
+      WriteToBuffer(value, buffer);
+    }
+  }
+  static void ReadVector(const char **buffer, std::vector<int> *values) {
+    int size = 0;
+    ReadFromBuffer(buffer, &size);
+    values->resize(size);
+    for (int &value : *values) {
+      ReadFromBuffer(buffer, &value);
+    }
+  }
+
  private:
   std::vector<int> slice_point_;
   std::vector<int> out_slice_dims_;
@@ -16,6 +16,8 @@
 
 #include "modules/perception/inference/tensorrt/plugins/slice_plugin.h"
 
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "modules/perception/proto/rt.pb.h"
 
@@ -70,4 +72,14 @@ TEST(SlicePluginsTest, test) {
   EXPECT_EQ(out_dims.d[2], 20);
   EXPECT_EQ(out_dims.d[3], 30);
   EXPECT_EQ(out_dims.d[4], 40);
+
+  std::vector<char> buffer(slice_plugin2.getSerializationSize());
+  slice_plugin2.serialize(buffer.data());
+  apollo::perception::inference::SLICEPlugin slice_plugin3(buffer.data(),
+                                                           buffer.size());
+  EXPECT_EQ(slice_plugin3.getNbOutputs(), 3);
+  out_dims = slice_plugin3.getOutputDimensions(2, &in_dims, 5);
+  EXPECT_EQ(out_dims.d[0], 8);
+  EXPECT_EQ(out_dims.d[1], 5);
+  EXPECT_EQ(out_dims.d[2], 20);
 }
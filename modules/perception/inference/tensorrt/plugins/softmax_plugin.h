@@ -46,6 +46,19 @@ class SoftmaxPlugin : public nvinfer1::IPlugin {
     cudnnCreateTensorDescriptor(&output_desc_);
   }
 
+  // @brief restore a plugin serialized by serialize(), used when a cached
+  // engine is deserialized
+  SoftmaxPlugin(const void *serial_data, size_t serial_length) {
+    const char *d = reinterpret_cast<const char *>(serial_data), *a = d;
+    ReadFromBuffer(&d, &input_dims_);
+    ReadFromBuffer(&d, &axis_);
+    ReadFromBuffer(&d, &inner_num_);
+    ReadFromBuffer(&d, &outer_num_);
+    CHECK_EQ(d, a + serial_length);
+    cudnnCreateTensorDescriptor(&input_desc_);
+    cudnnCreateTensorDescriptor(&output_desc_);
+  }
+
   SoftmaxPlugin() {}
 
   ~SoftmaxPlugin() {
@@ -80,10 +93,17 @@ class SoftmaxPlugin : public nvinfer1::IPlugin {
   int enqueue(int batchSize, const void *const *inputs, void **outputs,
               void *workspace, cudaStream_t stream) override;
 
-  size_t getSerializationSize() override { return 0; }
+  size_t getSerializationSize() override {
+    return sizeof(input_dims_) + sizeof(axis_) + sizeof(inner_num_) +
+           sizeof(outer_num_);
+  }
 
   void serialize(void *buffer) override {
     char *d = reinterpret_cast<char *>(buffer), *a = d;
+    WriteToBuffer(input_dims_, &d);
+    WriteToBuffer(axis_, &d);
+    WriteToBuffer(inner_num_, &d);
+    WriteToBuffer(outer_num_, &d);
     size_t size = getSerializationSize();
     CHECK_EQ(d, a + size);
   }
@@ -16,6 +16,7 @@
 
 #include "modules/perception/inference/tensorrt/rt_common.h"
 
+#include <set>
 #include <utility>
 
 namespace apollo {
@@ -91,6 +92,25 @@ void ParseNetParam(const NetParameter &net_param,
   }
 }
 
+bool IsSupportedByRTNet(const NetParameter &net_param,
+                        std::string *unsupported_type) {
+  // the layer types RTNet::addLayer builds, and the inputs
+  static const std::set<std::string> kSupportedTypes{
+      "ArgMax",  "BatchNorm", "Concat",       "Convolution", "Deconvolution",
+      "Dropout", "Eltwise",   "InnerProduct", "Input",       "Padding",
+      "Permute", "Pooling",   "Power",        "ReLU",        "Reshape",
+      "Scale",   "Sigmoid",   "Slice",        "Softmax",     "TanH"};
+  for (const auto &layer_param : net_param.layer()) {
+    if (kSupportedTypes.count(layer_param.type()) == 0) {
+      if (unsupported_type != nullptr) {
+        *unsupported_type = layer_param.type();
+      }
+      return false;
+    }
+  }
+  return true;
+}
+
 bool ParserConvParam(const ConvolutionParameter &conv, ConvParam *param) {
   if (conv.has_kernel_h() || conv.has_kernel_w()) {
     if (conv.kernel_size_size() != 0) {
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudnn.h>
+#include <cstring>
 #include <map>
 #include <string>
 #include <vector>
@@ -43,6 +44,11 @@ void ParseNetParam(const NetParameter &net_param,
                    std::map<std::string, std::string> *tensor_modify_map,
                    std::vector<LayerParameter> *order);
 
+// @brief checks that RTNet can build every layer of the net, sets the type of
+// the first layer it can not build otherwise
+bool IsSupportedByRTNet(const NetParameter &net_param,
+                        std::string *unsupported_type);
+
 bool modify_pool_param(PoolingParameter *pool_param);
 
 struct ConvParam {
@@ -58,6 +64,21 @@ struct ConvParam {
 
 bool ParserConvParam(const ConvolutionParameter &conv, ConvParam *param);
 
+// @brief write a trivially copyable value to a plugin serialization buffer
+// and move the buffer behind it
+template <typename T>
+void WriteToBuffer(const T &value, char **buffer) {
+  memcpy(*buffer, &value, sizeof(T));
+  *buffer += sizeof(T);
+}
+
+// @brief read a value written by WriteToBuffer and move the buffer behind it
+template <typename T>
+void ReadFromBuffer(const char **buffer, T *value) {
+  memcpy(value, *buffer, sizeof(T));
+  *buffer += sizeof(T);
+}
+
 }  // namespace inference
 }  // namespace perception
 }  // namespace apollo
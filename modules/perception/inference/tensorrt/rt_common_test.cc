@@ -39,6 +39,21 @@ TEST(RTReshapeDimsTest, test) {
   EXPECT_EQ(outdims.d[2], 2);
 }
 
+TEST(RTIsSupportedByRTNetTest, test) {
+  NetParameter net_param;
+  net_param.add_layer()->set_type("Input");
+  net_param.add_layer()->set_type("Convolution");
+  net_param.add_layer()->set_type("ReLU");
+  std::string unsupported_type;
+  EXPECT_TRUE(IsSupportedByRTNet(net_param, &unsupported_type));
+  EXPECT_TRUE(unsupported_type.empty());
+
+  net_param.add_layer()->set_type("ROIPooling");
+  EXPECT_FALSE(IsSupportedByRTNet(net_param, &unsupported_type));
+  EXPECT_EQ(unsupported_type, "ROIPooling");
+  EXPECT_FALSE(IsSupportedByRTNet(net_param, nullptr));
+}
+
 TEST(RTModifyPoolingParamTest, test) {
   {
     PoolingParameter pool_param;
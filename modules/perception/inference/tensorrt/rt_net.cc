@@ -16,10 +16,20 @@
 
 #include "modules/perception/inference/tensorrt/rt_net.h"
 
+#include <unistd.h>
+
 #include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
 #include <utility>
 
+#include "cyber/common/file.h"
 #include "cyber/common/log.h"
+#include "modules/perception/common/perception_gflags.h"
 #include "modules/perception/inference/tensorrt/plugins/argmax_plugin.h"
 #include "modules/perception/inference/tensorrt/plugins/slice_plugin.h"
 #include "modules/perception/inference/tensorrt/plugins/softmax_plugin.h"
@@ -37,6 +47,69 @@ namespace apollo {
 namespace perception {
 namespace inference {
 
+namespace {
+
+// bump when the layout of the cached engines changes
+const char kEngineCacheVersion[] = "rt_engine_v1";
+
+// 64 bit FNV-1a, stable between runs unlike std::hash
+class EngineHash {
+ public:
+  void Update(const char *data, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+      hash_ ^= static_cast<uint8_t>(data[i]);
+      hash_ *= 1099511628211ULL;
+    }
+  }
+  void Update(const std::string &value) {
+    Update(value.data(), value.size());
+    Update(static_cast<int64_t>(value.size()));
+  }
+  void Update(int64_t value) {
+    Update(reinterpret_cast<const char *>(&value), sizeof(value));
+  }
+  uint64_t hash() const { return hash_; }
+
+ private:
+  uint64_t hash_ = 14695981039346656037ULL;
+};
+
+// restores the plugin layers of a cached engine by their caffe layer type
+class RTPluginFactory : public nvinfer1::IPluginFactory {
+ public:
+  explicit RTPluginFactory(const NetParameter &net_param) {
+    for (const auto &layer_param : net_param.layer()) {
+      layer_types_[layer_param.name()] = layer_param.type();
+    }
+  }
+
+  nvinfer1::IPlugin *createPlugin(const char *layer_name,
+                                  const void *serial_data,
+                                  size_t serial_length) override {
+    std::shared_ptr<nvinfer1::IPlugin> plugin;
+    const std::string &type = layer_types_[layer_name];
+    if (type == "ArgMax") {
+      plugin.reset(new ArgMax1Plugin(serial_data, serial_length));
+    } else if (type == "Slice") {
+      plugin.reset(new SLICEPlugin(serial_data, serial_length));
+    } else if (type == "Softmax") {
+      plugin.reset(new SoftmaxPlugin(serial_data, serial_length));
+    } else {
+      AERROR << "unknown plugin layer: " << layer_name;
+      return nullptr;
+    }
+    plugins.push_back(plugin);
+    return plugin.get();
+  }
+
+  std::vector<std::shared_ptr<nvinfer1::IPlugin>> plugins;
+
+ private:
+  std::map<std::string, std::string> layer_types_;
+};
+
+}  // namespace
+
 void RTNet::ConstructMap(const LayerParameter &layer_param,
                          nvinfer1::ILayer *layer, TensorMap *tensor_map,
                          TensorModifyMap *tensor_modify_map) {
@@ -532,7 +605,10 @@ nvinfer1::Weights RTNet::loadLayerWeights(float data, int size) {
 RTNet::RTNet(const std::string &net_file, const std::string &model_file,
              const std::vector<std::string> &outputs,
              const std::vector<std::string> &inputs)
-    : output_names_(outputs), input_names_(inputs) {
+    : output_names_(outputs),
+      input_names_(inputs),
+      net_file_(net_file),
+      model_file_(model_file) {
   loadWeights(model_file, &weight_map_);
   net_param_.reset(new NetParameter);
   loadNetParams(net_file, net_param_.get());
@@ -541,7 +617,10 @@ RTNet::RTNet(const std::string &net_file, const std::string &model_file,
              const std::vector<std::string> &outputs,
              const std::vector<std::string> &inputs,
              nvinfer1::Int8EntropyCalibrator *calibrator)
-    : output_names_(outputs), input_names_(inputs) {
+    : output_names_(outputs),
+      input_names_(inputs),
+      net_file_(net_file),
+      model_file_(model_file) {
   loadWeights(model_file, &weight_map_);
   net_param_.reset(new NetParameter);
   loadNetParams(net_file, net_param_.get());
@@ -552,7 +631,11 @@ RTNet::RTNet(const std::string &net_file, const std::string &model_file,
              const std::vector<std::string> &outputs,
              const std::vector<std::string> &inputs,
              const std::string &model_root)
-    : output_names_(outputs), input_names_(inputs), is_own_calibrator_(true) {
+    : output_names_(outputs),
+      input_names_(inputs),
+      is_own_calibrator_(true),
+      net_file_(net_file),
+      model_file_(model_file) {
   loadWeights(model_file, &weight_map_);
   net_param_.reset(new NetParameter);
   loadNetParams(net_file, net_param_.get());
@@ -597,7 +680,8 @@ void RTNet::init_blob(std::vector<std::string> *names) {
     std::vector<int> shape;
     CHECK(this->shape(name, &shape));
     std::shared_ptr<apollo::perception::base::Blob<float>> blob;
-    blob.reset(new apollo::perception::base::Blob<float>(shape));
+    // pinned host memory, so that the inputs are pushed asynchronously
+    blob.reset(new apollo::perception::base::Blob<float>(shape, true));
     blob->set_gpu_data(reinterpret_cast<float *>(buffers_[bindingIndex]));
     blobs_.insert(std::make_pair(name, blob));
   }
@@ -609,8 +693,9 @@ bool RTNet::Init(const std::map<std::string, std::vector<int>> &shapes) {
     return false;
   }
   BASE_CUDA_CHECK(cudaSetDevice(gpu_id_));
-  // stream will only be destoried for gpu_id_ >= 0
-  cudaStreamCreate(&stream_);
+  // stream will only be destoried for gpu_id_ >= 0, it does not wait for
+  // the default stream, so that the nets of other threads can overlap
+  cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking);
 
   builder_ = nvinfer1::createInferBuilder(rt_gLogger);
   network_ = builder_->createNetwork();
@@ -624,19 +709,150 @@ bool RTNet::Init(const std::map<std::string, std::vector<int>> &shapes) {
   cudaDeviceProp prop;
   cudaGetDeviceProperties(&prop, gpu_id_);
   bool int8_mode = checkInt8(prop.name, calibrator_);
+  bool fp16_mode =
+      !int8_mode && FLAGS_rt_use_fp16 && builder_->platformHasFastFp16();
 
   builder_->setInt8Mode(int8_mode);
   builder_->setInt8Calibrator(calibrator_);
+  builder_->setFp16Mode(fp16_mode);
 
   builder_->setDebugSync(true);
 
-  nvinfer1::ICudaEngine *engine = builder_->buildCudaEngine(*network_);
-  context_ = engine->createExecutionContext();
+  engine_ = getEngine(engineKey(shapes, prop, int8_mode, fp16_mode));
+  if (engine_ == nullptr) {
+    AERROR << "Failed to build engine of " << net_file_;
+    return false;
+  }
+  context_ = engine_->engine->createExecutionContext();
   buffers_.resize(input_names_.size() + output_names_.size());
   init_blob(&input_names_);
   init_blob(&output_names_);
   return true;
 }
+
+std::string RTNet::engineKey(
+    const std::map<std::string, std::vector<int>> &shapes,
+    const cudaDeviceProp &prop, bool int8_mode, bool fp16_mode) {
+  EngineHash hash;
+  hash.Update(kEngineCacheVersion);
+  hash.Update(NV_TENSORRT_MAJOR);
+  hash.Update(NV_TENSORRT_MINOR);
+  hash.Update(NV_TENSORRT_PATCH);
+  std::string content;
+  for (const auto &file : {net_file_, model_file_}) {
+    content.clear();
+    cyber::common::GetContent(file, &content);
+    hash.Update(content);
+  }
+  for (const auto &shape : shapes) {
+    hash.Update(shape.first);
+    for (int dim : shape.second) {
+      hash.Update(dim);
+    }
+  }
+  for (const auto &name : output_names_) {
+    hash.Update(name);
+  }
+  hash.Update(max_batch_size_);
+  hash.Update(workspaceSize_);
+  hash.Update(fp16_mode);
+  hash.Update(int8_mode);
+  if (int8_mode) {
+    // engines calibrated with another table are different
+    size_t length = 0;
+    const void *table = calibrator_->readCalibrationCache(length);
+    hash.Update(reinterpret_cast<const char *>(table), length);
+  }
+
+  std::string gpu_name(prop.name);
+  std::replace_if(gpu_name.begin(), gpu_name.end(),
+                  [](char c) { return !isalnum(c); }, '_');
+  std::ostringstream key;
+  key << gpu_name << "_sm" << prop.major << prop.minor << "_" << std::hex
+      << std::setw(16) << std::setfill('0') << hash.hash();
+  return key.str();
+}
+
+std::shared_ptr<RTEngine> RTNet::getEngine(const std::string &key) {
+  static std::mutex mutex;
+  static std::map<std::string, std::weak_ptr<RTEngine>> engines;
+  // the lock is held while building, so that nets of one model built at
+  // the same time share the engine instead of building it twice
+  std::lock_guard<std::mutex> lock(mutex);
+  const std::string device_key = std::to_string(gpu_id_) + "_" + key;
+  std::shared_ptr<RTEngine> engine = engines[device_key].lock();
+  if (engine != nullptr) {
+    AINFO << "Share engine " << key << " on gpu " << gpu_id_;
+    return engine;
+  }
+  engine = std::make_shared<RTEngine>();
+  if (!loadEngine(key, engine.get())) {
+    engine->engine = builder_->buildCudaEngine(*network_);
+    if (engine->engine == nullptr) {
+      return nullptr;
+    }
+    engine->plugins.insert(engine->plugins.end(), argmax_plugins_.begin(),
+                           argmax_plugins_.end());
+    engine->plugins.insert(engine->plugins.end(), softmax_plugins_.begin(),
+                           softmax_plugins_.end());
+    engine->plugins.insert(engine->plugins.end(), slice_plugins_.begin(),
+                           slice_plugins_.end());
+    saveEngine(key, *engine);
+  }
+  engines[device_key] = engine;
+  return engine;
+}
+
+bool RTNet::loadEngine(const std::string &key, RTEngine *engine) {
+  if (FLAGS_rt_engine_cache_dir.empty()) {
+    return false;
+  }
+  const std::string path = FLAGS_rt_engine_cache_dir + "/" + key + ".engine";
+  std::string data;
+  if (!cyber::common::PathExists(path) ||
+      !cyber::common::GetContent(path, &data)) {
+    AINFO << "No cached engine " << path;
+    return false;
+  }
+  RTPluginFactory plugin_factory(*net_param_);
+  engine->runtime = nvinfer1::createInferRuntime(rt_gLogger);
+  engine->engine = engine->runtime->deserializeCudaEngine(
+      data.data(), data.size(), &plugin_factory);
+  if (engine->engine == nullptr) {
+    AWARN << "Failed to deserialize engine " << path << ", rebuild it.";
+    return false;
+  }
+  engine->plugins.swap(plugin_factory.plugins);
+  AINFO << "Load engine " << path;
+  return true;
+}
+
+void RTNet::saveEngine(const std::string &key, const RTEngine &engine) {
+  if (FLAGS_rt_engine_cache_dir.empty() ||
+      !cyber::common::EnsureDirectory(FLAGS_rt_engine_cache_dir)) {
+    return;
+  }
+  const std::string path = FLAGS_rt_engine_cache_dir + "/" + key + ".engine";
+  nvinfer1::IHostMemory *memory = engine.engine->serialize();
+  if (memory == nullptr) {
+    AWARN << "Failed to serialize engine " << path;
+    return;
+  }
+  // write then rename, so that other processes never read a partial file
+  const std::string tmp_path = path + ".tmp" + std::to_string(getpid());
+  std::ofstream output(tmp_path, std::ios::binary);
+  output.write(reinterpret_cast<const char *>(memory->data()),
+               memory->size());
+  output.close();
+  memory->destroy();
+  if (!output.good() || std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    AWARN << "Failed to save engine " << path;
+    std::remove(tmp_path.c_str());
+    return;
+  }
+  AINFO << "Save engine " << path;
+}
+
 bool RTNet::checkInt8(const std::string &gpu_name,
                       nvinfer1::IInt8Calibrator *calibrator) {
   if (calibrator == nullptr) {
@@ -719,7 +935,9 @@ RTNet::~RTNet() {
     BASE_CUDA_CHECK(cudaStreamDestroy(stream_));
     network_->destroy();
     builder_->destroy();
-    context_->destroy();
+    if (context_ != nullptr) {
+      context_->destroy();
+    }
     for (auto buf : buffers_) {
       cudaFree(buf);
     }
@@ -729,9 +947,16 @@ RTNet::~RTNet() {
 void RTNet::Infer() {
   BASE_CUDA_CHECK(cudaSetDevice(gpu_id_));
   BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
+  // inputs written on the host are copied on the stream of the net, ahead
+  // of the inference and without waiting for the copies
   for (auto name : input_names_) {
     auto blob = get_blob(name);
-    if (blob != nullptr) {
+    if (blob == nullptr) {
+      continue;
+    }
+    if (blob->head() == apollo::perception::base::SyncedMemory::HEAD_AT_CPU) {
+      blob->data()->async_gpu_push(stream_);
+    } else {
       blob->gpu_data();
     }
   }
@@ -747,7 +972,9 @@ void RTNet::Infer() {
       blob->gpu_data();
     }
   }
+  infer_timer_.Start(stream_);
   context_->enqueue(max_batch_size_, &buffers_[0], stream_, nullptr);
+  infer_timer_.End(stream_, "RTNet_Infer");
   BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
 
   for (auto name : output_names_) {
@@ -23,6 +23,7 @@
 
 #include "modules/perception/inference/inference.h"
 #include "modules/perception/inference/tensorrt/entropy_calibrator.h"
+#include "modules/perception/inference/utils/cuda_event_timer.h"
 #include "modules/perception/proto/rt.pb.h"
 
 namespace apollo {
@@ -52,6 +53,24 @@ const std::vector<std::string> _gpu_checklist{
     "Tesla P40",           "GeForce GTX 1070",    "GeForce GTX 1060",
     "Tesla V100-SXM2-16GB"};
 
+// @brief engine shared by the nets built from the same model on the same
+// gpu, each net runs its own execution context on its own stream. The
+// plugins of the engine live as long as the engine.
+struct RTEngine {
+  nvinfer1::IRuntime *runtime = nullptr;
+  nvinfer1::ICudaEngine *engine = nullptr;
+  std::vector<std::shared_ptr<nvinfer1::IPlugin>> plugins;
+
+  ~RTEngine() {
+    if (engine != nullptr) {
+      engine->destroy();
+    }
+    if (runtime != nullptr) {
+      runtime->destroy();
+    }
+  }
+};
+
 class RTNet : public Inference {
  public:
   RTNet(const std::string &net_file, const std::string &model_file,
@@ -174,12 +193,28 @@ class RTNet : public Inference {
   bool loadWeights(const std::string &model_file, WeightMap *weight_map);
   void init_blob(std::vector<std::string> *names);
 
+  // @brief key of the engine built with the current network and builder
+  // settings, the hash of the model, the shapes and the modes plus the gpu
+  std::string engineKey(const std::map<std::string, std::vector<int>> &shapes,
+                        const cudaDeviceProp &prop, bool int8_mode,
+                        bool fp16_mode);
+  // @brief get the engine of key, shared with the living nets of the same
+  // key, else loaded from the engine cache, else built and cached
+  std::shared_ptr<RTEngine> getEngine(const std::string &key);
+  bool loadEngine(const std::string &key, RTEngine *engine);
+  void saveEngine(const std::string &key, const RTEngine &engine);
+
  private:
   nvinfer1::IExecutionContext *context_ = nullptr;
   cudaStream_t stream_ = 0;
+  CudaEventTimer infer_timer_;
   std::vector<std::shared_ptr<ArgMax1Plugin>> argmax_plugins_;
   std::vector<std::shared_ptr<SoftmaxPlugin>> softmax_plugins_;
   std::vector<std::shared_ptr<SLICEPlugin>> slice_plugins_;
+  // released before the plugins above
+  std::shared_ptr<RTEngine> engine_;
+  std::string net_file_;
+  std::string model_file_;
   std::vector<std::string> output_names_;
   std::vector<std::string> input_names_;
   std::map<std::string, std::string> tensor_modify_map_;
@@ -0,0 +1,117 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gflags/gflags.h"
+
+#include "modules/perception/inference/inference.h"
+#include "modules/perception/inference/inference_factory.h"
+
+DEFINE_string(proto_file, "./deploy.prototxt", "path of the caffe net");
+DEFINE_string(weight_file, "./deploy.caffemodel", "path of the weights");
+DEFINE_string(model_root, "./", "dir of the int8 calibration table");
+DEFINE_string(input_blob, "data", "name of the input blob");
+DEFINE_string(input_shape, "1,96,32,3", "comma separated input shape");
+DEFINE_string(output_blobs, "prob", "comma separated output blobs");
+DEFINE_string(backends, "CaffeNet,RTNet,Auto",
+              "comma separated backends to compare");
+DEFINE_int32(warmup_runs, 10, "runs before timing");
+DEFINE_int32(runs, 100, "timed runs of each backend");
+
+namespace {
+
+std::vector<std::string> SplitString(const std::string &str) {
+  std::vector<std::string> tokens;
+  std::stringstream ss(str);
+  std::string token;
+  while (std::getline(ss, token, ',')) {
+    if (!token.empty()) {
+      tokens.push_back(token);
+    }
+  }
+  return tokens;
+}
+
+double TimedInferMs(apollo::perception::inference::Inference *net) {
+  const auto start = std::chrono::steady_clock::now();
+  net->Infer();
+  cudaDeviceSynchronize();
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+}  // namespace
+
+// compares the latency of one caffe model on each backend of
+// CreateInferenceByName
+int main(int argc, char **argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+
+  const std::vector<std::string> inputs{FLAGS_input_blob};
+  const std::vector<std::string> outputs = SplitString(FLAGS_output_blobs);
+  std::vector<int> shape;
+  for (const auto &dim : SplitString(FLAGS_input_shape)) {
+    shape.push_back(std::stoi(dim));
+  }
+  const std::map<std::string, std::vector<int>> shape_map{
+      {FLAGS_input_blob, shape}};
+
+  printf("%-12s %10s %10s %10s %10s\n", "backend", "mean(ms)", "min(ms)",
+         "max(ms)", "init(ms)");
+  for (const auto &backend : SplitString(FLAGS_backends)) {
+    const auto init_start = std::chrono::steady_clock::now();
+    std::unique_ptr<apollo::perception::inference::Inference> net(
+        apollo::perception::inference::CreateInferenceByName(
+            backend, FLAGS_proto_file, FLAGS_weight_file, outputs, inputs,
+            FLAGS_model_root));
+    if (net == nullptr || !net->Init(shape_map)) {
+      printf("%-12s failed to init\n", backend.c_str());
+      continue;
+    }
+    const double init_ms = std::chrono::duration<double, std::milli>(
+                               std::chrono::steady_clock::now() - init_start)
+                               .count();
+
+    auto input = net->get_blob(FLAGS_input_blob);
+    std::fill(input->mutable_cpu_data(),
+              input->mutable_cpu_data() + input->count(), 128.0f);
+    for (int i = 0; i < FLAGS_warmup_runs; ++i) {
+      TimedInferMs(net.get());
+    }
+    double sum_ms = 0.0;
+    double min_ms = 0.0;
+    double max_ms = 0.0;
+    for (int i = 0; i < FLAGS_runs; ++i) {
+      const double time_ms = TimedInferMs(net.get());
+      sum_ms += time_ms;
+      min_ms = i == 0 ? time_ms : std::min(min_ms, time_ms);
+      max_ms = std::max(max_ms, time_ms);
+    }
+    printf("%-12s %10.3f %10.3f %10.3f %10.3f\n", backend.c_str(),
+           sum_ms / std::max(FLAGS_runs, 1), min_ms, max_ms, init_ms);
+  }
+  return 0;
+}
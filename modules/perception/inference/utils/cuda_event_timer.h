@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <cuda_runtime_api.h>
+
+#include <string>
+
+#include "modules/perception/lib/utils/perf_collector.h"
+
+namespace apollo {
+namespace perception {
+namespace inference {
+
+// @brief: times the gpu work issued on a stream between Start and End with
+// cuda events and adds it as a gpu stage of the frame collected by
+// lib::PerfCollector on the calling thread. Does nothing, and does not
+// synchronize, when no frame is collected.
+class CudaEventTimer {
+ public:
+  CudaEventTimer() = default;
+  ~CudaEventTimer() {
+    if (start_event_ != nullptr) {
+      cudaEventDestroy(start_event_);
+      cudaEventDestroy(end_event_);
+    }
+  }
+
+  void Start(cudaStream_t stream) {
+    started_ = lib::PerfCollector::Active();
+    if (!started_) {
+      return;
+    }
+    if (start_event_ == nullptr) {
+      cudaEventCreate(&start_event_);
+      cudaEventCreate(&end_event_);
+    }
+    cudaEventRecord(start_event_, stream);
+  }
+
+  // @brief: waits for the work issued before End on stream
+  void End(cudaStream_t stream, const std::string &name) {
+    if (!started_) {
+      return;
+    }
+    started_ = false;
+    cudaEventRecord(end_event_, stream);
+    cudaEventSynchronize(end_event_);
+    float elapsed_ms = 0.0f;
+    if (cudaEventElapsedTime(&elapsed_ms, start_event_, end_event_) ==
+        cudaSuccess) {
+      lib::PerfCollector::AddStage(name, elapsed_ms, true);
+    }
+  }
+
+  CudaEventTimer(const CudaEventTimer &) = delete;
+  CudaEventTimer &operator=(const CudaEventTimer &) = delete;
+
+ private:
+  cudaEvent_t start_event_ = nullptr;
+  cudaEvent_t end_event_ = nullptr;
+  bool started_ = false;
+};
+
+}  // namespace inference
+}  // namespace perception
+}  // namespace apollo
@@ -65,6 +65,17 @@ cublasHandle_t &CudaUtil::get_handler() {
   return get().cublas_handle_;
 }
 
+bool CudaUtil::get_memory_info(size_t *used, size_t *total) {
+  size_t free_bytes = 0;
+  auto cuda_error = cudaMemGetInfo(&free_bytes, total);
+  if (cuda_error != cudaSuccess) {
+    AERROR << "cudaMemGetInfo failed: " << cudaGetErrorString(cuda_error);
+    return false;
+  }
+  *used = *total - free_bytes;
+  return true;
+}
+
 CudaUtil::~CudaUtil() {
   if (get().cublas_handle_) {
     CUBLAS_CHECK(cublasDestroy(get().cublas_handle_));
@@ -26,6 +26,8 @@ class CudaUtil {
  public:
   static bool set_device_id(int device_id);
   static cublasHandle_t& get_handler();
+  // @brief: used and total memory of the current device in bytes
+  static bool get_memory_info(size_t *used, size_t *total);
   ~CudaUtil();
  private:
   CudaUtil();
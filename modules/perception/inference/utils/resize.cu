@@ -77,6 +77,100 @@ __global__ void resize_linear_kernel(const unsigned char *src,
     }
   }
 }
+__device__ float bilinear_read(const unsigned char *src,
+                               int step,
+                               int channel,
+                               int c,
+                               int x_min,
+                               int y_min,
+                               int x_max,
+                               int y_max,
+                               float src_x,
+                               float src_y) {
+  const int x1 = __float2int_rd(src_x);
+  const int y1 = __float2int_rd(src_y);
+  const float dx = src_x - x1;
+  const float dy = src_y - y1;
+  const int x1_read = min(max(x1, x_min), x_max);
+  const int y1_read = min(max(y1, y_min), y_max);
+  const int x2_read = min(max(x1 + 1, x_min), x_max);
+  const int y2_read = min(max(y1 + 1, y_min), y_max);
+  const unsigned char *row1 = src + y1_read * step;
+  const unsigned char *row2 = src + y2_read * step;
+  float out = (1.f - dx) * (1.f - dy) * row1[x1_read * channel + c] +
+              dx * (1.f - dy) * row1[x2_read * channel + c] +
+              (1.f - dx) * dy * row2[x1_read * channel + c] +
+              dx * dy * row2[x2_read * channel + c];
+  return min(max(out, 0.f), 255.f);
+}
+
+__global__ void remap_resize_kernel(const unsigned char *src,
+                                    int channel,
+                                    int height,
+                                    int width,
+                                    int step,
+                                    const float *mapx,
+                                    const float *mapy,
+                                    int roi_x,
+                                    int roi_y,
+                                    int roi_width,
+                                    int roi_height,
+                                    float fx,
+                                    float fy,
+                                    float *dst,
+                                    int dst_height,
+                                    int dst_width,
+                                    bool swap_rb,
+                                    float mean_b,
+                                    float mean_g,
+                                    float mean_r,
+                                    float scale) {
+  const int dst_x = blockDim.x * blockIdx.x + threadIdx.x;
+  const int dst_y = blockDim.y * blockIdx.y + threadIdx.y;
+  if (dst_x >= dst_width || dst_y >= dst_height) {
+    return;
+  }
+  // position in the roi of the (undistorted) image
+  float x = min(max((dst_x + 0.5f) * fx - 0.5f, 0.f), roi_width - 1.f) + roi_x;
+  float y = min(max((dst_y + 0.5f) * fy - 0.5f, 0.f), roi_height - 1.f)
+            + roi_y;
+  bool valid = true;
+  if (mapx != nullptr) {
+    // interpolate the remap tables instead of undistorting the whole image
+    const int x1 = min(__float2int_rd(x), width - 2);
+    const int y1 = min(__float2int_rd(y), height - 2);
+    const float dx = x - x1;
+    const float dy = y - y1;
+    const int idx = y1 * width + x1;
+    const float src_x = (1.f - dx) * (1.f - dy) * mapx[idx] +
+                        dx * (1.f - dy) * mapx[idx + 1] +
+                        (1.f - dx) * dy * mapx[idx + width] +
+                        dx * dy * mapx[idx + width + 1];
+    const float src_y = (1.f - dx) * (1.f - dy) * mapy[idx] +
+                        dx * (1.f - dy) * mapy[idx + 1] +
+                        (1.f - dx) * dy * mapy[idx + width] +
+                        dx * dy * mapy[idx + width + 1];
+    // pixels mapped outside of the image are black as in nppiRemap
+    valid = src_x >= 0.f && src_y >= 0.f &&
+            src_x <= width - 1.f && src_y <= height - 1.f;
+    x = src_x;
+    y = src_y;
+  }
+  const int x_min = mapx != nullptr ? 0 : roi_x;
+  const int y_min = mapx != nullptr ? 0 : roi_y;
+  const int x_max = mapx != nullptr ? width - 1 : roi_x + roi_width - 1;
+  const int y_max = mapx != nullptr ? height - 1 : roi_y + roi_height - 1;
+  const float mean[3] = {mean_b, mean_g, mean_r};
+  float *dst_pixel = dst + (dst_y * dst_width + dst_x) * 3;
+  for (int c = 0; c < 3; ++c) {
+    const int src_c = channel == 1 ? 0 : (swap_rb ? 2 - c : c);
+    const float out = valid ? bilinear_read(src, step, channel, src_c,
+                                            x_min, y_min, x_max, y_max, x, y)
+                            : 0.f;
+    dst_pixel[c] = (out - mean[c]) * scale;
+  }
+}
+
 int divup(int a, int b) {
   if (a % b) {
     return a / b + 1;
@@ -180,7 +274,7 @@ bool ResizeGPU(const base::Image8U &src,
   const dim3 grid(divup(width, block.x), divup(height, block.y));
 
   resize_linear_kernel << < grid, block >> >
-      (src.gpu_data(), dst->mutable_gpu_data(),
+      (src.gpu_data(), dst->mutable_gpu_data() + dst->offset(start_axis),
           origin_channel, origin_height, origin_width,
           stepwidth, height, width, fx, fy);
   return true;
@@ -277,6 +371,55 @@ bool ResizeGPU(const base::Image8U &src,
   return true;
 }
 
+bool RemapResizeGPU(const base::Image8U &src,
+                    const base::Blob<float> *mapx,
+                    const base::Blob<float> *mapy,
+                    const base::RectI &roi,
+                    std::shared_ptr<apollo::perception::base::Blob<float>> dst,
+                    int start_axis,
+                    bool swap_rb,
+                    float mean_b,
+                    float mean_g,
+                    float mean_r,
+                    float scale) {
+  const int height = dst->shape(1);
+  const int width = dst->shape(2);
+  if (dst->shape(3) != 3) {
+    AERROR << "only 3 channels are supported by remap resize.";
+    return false;
+  }
+  if (src.channels() != 1 && src.channels() != 3) {
+    AERROR << "invalid number of channels: " << src.channels();
+    return false;
+  }
+  if (roi.x < 0 || roi.y < 0 || roi.width <= 0 || roi.height <= 0 ||
+      roi.x + roi.width > src.cols() || roi.y + roi.height > src.rows()) {
+    AERROR << "roi out of the image.";
+    return false;
+  }
+  if ((mapx == nullptr) != (mapy == nullptr) ||
+      (mapx != nullptr && (mapx->count() != src.rows() * src.cols() ||
+                           mapy->count() != src.rows() * src.cols()))) {
+    AERROR << "remap tables should have the size of the image.";
+    return false;
+  }
+
+  const float fx = static_cast<float>(roi.width) / static_cast<float>(width);
+  const float fy = static_cast<float>(roi.height) / static_cast<float>(height);
+  const dim3 block(32, 8);
+  const dim3 grid(divup(width, block.x), divup(height, block.y));
+
+  remap_resize_kernel << < grid, block >> >
+      (src.gpu_data(), src.channels(), src.rows(), src.cols(),
+          src.width_step(),
+          mapx != nullptr ? mapx->gpu_data() : nullptr,
+          mapy != nullptr ? mapy->gpu_data() : nullptr,
+          roi.x, roi.y, roi.width, roi.height, fx, fy,
+          dst->mutable_gpu_data() + dst->offset(start_axis), height, width,
+          swap_rb, mean_b, mean_g, mean_r, scale);
+  return true;
+}
+
 }  // namespace inference
 }  // namespace perception
 }  // namespace apollo
@@ -19,6 +19,7 @@
 #include <memory>
 
 #include "modules/perception/base/blob.h"
+#include "modules/perception/base/box.h"
 #include "modules/perception/base/image.h"
 
 namespace apollo {
@@ -39,6 +40,20 @@ bool ResizeGPU(const base::Image8U &src,
                int stepwidth, int start_axis, float mean_b, float mean_g,
                float mean_r, bool channel_axis, float scale);
 
+// @brief: crop roi of the full image src, undistort it by the remap tables
+// mapx/mapy (full image size, nullptr for no undistortion), resize it to the
+// size of dst and normalize it as (value - mean) * scale, all in one kernel.
+// The result is written into the start_axis-th image of the NHWC blob dst,
+// in the channel order of src, or with channels 0 and 2 swapped by swap_rb.
+// Gray images are expanded to 3 channels.
+bool RemapResizeGPU(const base::Image8U &src,
+                    const base::Blob<float> *mapx,
+                    const base::Blob<float> *mapy,
+                    const base::RectI &roi,
+                    std::shared_ptr<apollo::perception::base::Blob<float>> dst,
+                    int start_axis, bool swap_rb, float mean_b, float mean_g,
+                    float mean_r, float scale);
+
 }  // namespace inference
 }  // namespace perception
 }  // namespace apollo
@@ -0,0 +1,66 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/lib/utils/perf_collector.h"
+
+namespace apollo {
+namespace perception {
+namespace lib {
+
+namespace {
+
+struct ThreadFrame {
+  bool active = false;
+  std::vector<PerfStage> stages;
+};
+
+ThreadFrame &GetThreadFrame() {
+  static thread_local ThreadFrame frame;
+  return frame;
+}
+
+}  // namespace
+
+void PerfCollector::BeginFrame() {
+  ThreadFrame &frame = GetThreadFrame();
+  frame.active = true;
+  frame.stages.clear();
+}
+
+bool PerfCollector::Active() { return GetThreadFrame().active; }
+
+void PerfCollector::AddStage(const std::string &name, double elapsed_ms,
+                             bool gpu) {
+  ThreadFrame &frame = GetThreadFrame();
+  if (!frame.active) {
+    return;
+  }
+  frame.stages.emplace_back();
+  PerfStage &stage = frame.stages.back();
+  stage.name = name;
+  stage.elapsed_ms = elapsed_ms;
+  stage.gpu = gpu;
+}
+
+void PerfCollector::EndFrame(std::vector<PerfStage> *stages) {
+  ThreadFrame &frame = GetThreadFrame();
+  frame.active = false;
+  stages->clear();
+  stages->swap(frame.stages);
+}
+
+}  // namespace lib
+}  // namespace perception
+}  // namespace apollo
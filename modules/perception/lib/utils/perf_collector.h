@@ -0,0 +1,52 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace apollo {
+namespace perception {
+namespace lib {
+
+struct PerfStage {
+  std::string name;
+  double elapsed_ms = 0.0;
+  // measured with cuda events instead of the cpu clock
+  bool gpu = false;
+};
+
+// @brief: collects the stage timings of one frame per thread. A component
+// calls BeginFrame when it starts to process a message and EndFrame when it
+// is done; in between, the perf timers and the inference engines running on
+// the same thread add their stages. Outside of a frame AddStage is a check
+// of a thread local flag, so the instrumentation costs nothing when nobody
+// collects.
+class PerfCollector {
+ public:
+  // @brief: start collecting the stages of a frame on the calling thread
+  static void BeginFrame();
+  // @brief: whether a frame is collected on the calling thread
+  static bool Active();
+  static void AddStage(const std::string &name, double elapsed_ms,
+                       bool gpu = false);
+  // @brief: stop collecting and move the stages of the frame into stages
+  static void EndFrame(std::vector<PerfStage> *stages);
+};
+
+}  // namespace lib
+}  // namespace perception
+}  // namespace apollo
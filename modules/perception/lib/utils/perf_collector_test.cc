@@ -0,0 +1,61 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "modules/perception/lib/utils/perf_collector.h"
+#include "modules/perception/lib/utils/timer.h"
+
+namespace apollo {
+namespace perception {
+namespace lib {
+
+TEST(PerfCollectorTest, Test) {
+  std::vector<PerfStage> stages;
+  // nothing is collected outside of a frame
+  PerfCollector::AddStage("outside", 1.0);
+  EXPECT_FALSE(PerfCollector::Active());
+
+  PerfCollector::BeginFrame();
+  EXPECT_TRUE(PerfCollector::Active());
+  PerfCollector::AddStage("infer", 2.0, true);
+  Timer timer;
+  timer.Start();
+  usleep(10000);
+  timer.End("block");
+  // stages of other threads do not leak into this frame
+  std::thread other([]() { PerfCollector::AddStage("other", 3.0); });
+  other.join();
+  PerfCollector::EndFrame(&stages);
+  EXPECT_FALSE(PerfCollector::Active());
+
+  ASSERT_EQ(stages.size(), 2);
+  EXPECT_EQ(stages[0].name, "infer");
+  EXPECT_DOUBLE_EQ(stages[0].elapsed_ms, 2.0);
+  EXPECT_TRUE(stages[0].gpu);
+  EXPECT_EQ(stages[1].name, "block");
+  EXPECT_GE(stages[1].elapsed_ms, 9.0);
+  EXPECT_FALSE(stages[1].gpu);
+
+  PerfCollector::BeginFrame();
+  PerfCollector::EndFrame(&stages);
+  EXPECT_TRUE(stages.empty());
+}
+
+}  // namespace lib
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,154 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace apollo {
+namespace perception {
+namespace lib {
+
+// @brief: fixed capacity ring buffer of (timestamp, value) pairs sorted by
+// timestamp. Pushing in timestamp order is O(1), a late element is inserted
+// at its place by moving the newer ones. When full, the element with the
+// oldest timestamp is dropped. Lookups are binary searches. The buffer is
+// not thread safe.
+template <class T>
+class TimeRingBuffer {
+ public:
+  typedef std::pair<double, T> Element;
+
+  explicit TimeRingBuffer(size_t capacity = 0) { set_capacity(capacity); }
+
+  // @brief: change the capacity, keep the newest elements
+  void set_capacity(size_t capacity) {
+    std::vector<Element> data(capacity);
+    const size_t size = std::min(size_, capacity);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = std::move(at(size_ - size + i));
+    }
+    data_.swap(data);
+    head_ = 0;
+    size_ = size;
+  }
+  inline size_t capacity() const { return data_.size(); }
+  inline size_t size() const { return size_; }
+  inline bool empty() const { return size_ == 0; }
+  inline bool full() const { return size_ == data_.size(); }
+  void clear() {
+    for (size_t i = 0; i < size_; ++i) {
+      at(i) = Element();
+    }
+    head_ = 0;
+    size_ = 0;
+  }
+
+  // @brief: i-th element in timestamp order
+  inline const Element& operator[](size_t i) const { return at(i); }
+  inline const Element& front() const { return at(0); }
+  inline const Element& back() const { return at(size_ - 1); }
+
+  // @brief: add an element, return false if the buffer has no capacity or
+  // the element is older than all elements of a full buffer
+  bool push(double timestamp, T value) {
+    if (data_.empty()) {
+      return false;
+    }
+    if (full()) {
+      if (timestamp < front().first) {
+        return false;
+      }
+      at(0) = Element();
+      head_ = Index(1);
+      --size_;
+    }
+    size_t i = size_++;
+    while (i > 0 && at(i - 1).first > timestamp) {
+      at(i) = std::move(at(i - 1));
+      --i;
+    }
+    at(i) = Element(timestamp, std::move(value));
+    return true;
+  }
+
+  // @brief: index of the first element with timestamp >= timestamp
+  size_t LowerBound(double timestamp) const {
+    size_t first = 0;
+    size_t count = size_;
+    while (count > 0) {
+      const size_t step = count / 2;
+      if (at(first + step).first < timestamp) {
+        first += step + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+    return first;
+  }
+  // @brief: index of the first element with timestamp > timestamp
+  size_t UpperBound(double timestamp) const {
+    size_t first = 0;
+    size_t count = size_;
+    while (count > 0) {
+      const size_t step = count / 2;
+      if (!(timestamp < at(first + step).first)) {
+        first += step + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+    return first;
+  }
+  // @brief: index of the element nearest to timestamp, the newer one on
+  // ties, size() if the buffer is empty
+  size_t Nearest(double timestamp) const {
+    if (size_ == 0) {
+      return 0;
+    }
+    const size_t upper = LowerBound(timestamp);
+    if (upper == 0) {
+      return 0;
+    }
+    if (upper == size_) {
+      return size_ - 1;
+    }
+    return std::fabs(timestamp - at(upper - 1).first) <
+                   std::fabs(at(upper).first - timestamp)
+               ? upper - 1
+               : upper;
+  }
+
+ private:
+  inline size_t Index(size_t i) const {
+    const size_t index = head_ + i;
+    return index < data_.size() ? index : index - data_.size();
+  }
+  inline Element& at(size_t i) { return data_[Index(i)]; }
+  inline const Element& at(size_t i) const { return data_[Index(i)]; }
+
+  std::vector<Element> data_;
+  size_t head_ = 0;
+  size_t size_ = 0;
+};
+
+}  // namespace lib
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,79 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include <gtest/gtest.h>
+
+#include "modules/perception/lib/utils/time_ring_buffer.h"
+
+namespace apollo {
+namespace perception {
+namespace lib {
+
+TEST(TimeRingBufferTest, TestPush) {
+  TimeRingBuffer<int> buffer(3);
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(buffer.capacity(), 3);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_TRUE(buffer.push(static_cast<double>(i), i));
+  }
+  EXPECT_TRUE(buffer.full());
+  EXPECT_EQ(buffer.front().second, 2);
+  EXPECT_EQ(buffer.back().second, 4);
+
+  // late elements are inserted at their place
+  EXPECT_TRUE(buffer.push(3.5, 35));
+  EXPECT_EQ(buffer.size(), 3);
+  EXPECT_EQ(buffer[0].second, 3);
+  EXPECT_EQ(buffer[1].second, 35);
+  EXPECT_EQ(buffer[2].second, 4);
+  EXPECT_FALSE(buffer.push(1.0, 1));
+
+  buffer.set_capacity(2);
+  EXPECT_EQ(buffer.size(), 2);
+  EXPECT_EQ(buffer[0].second, 35);
+  buffer.set_capacity(4);
+  EXPECT_EQ(buffer.size(), 2);
+  EXPECT_TRUE(buffer.push(5.0, 5));
+  EXPECT_EQ(buffer.back().second, 5);
+
+  buffer.clear();
+  EXPECT_TRUE(buffer.empty());
+  TimeRingBuffer<int> empty_buffer;
+  EXPECT_FALSE(empty_buffer.push(0.0, 0));
+}
+
+TEST(TimeRingBufferTest, TestLookup) {
+  TimeRingBuffer<int> buffer(8);
+  for (int i = 0; i < 12; ++i) {
+    buffer.push(0.5 * i, i);
+  }
+  // elements 4 to 11 are kept
+  EXPECT_EQ(buffer.LowerBound(0.0), 0);
+  EXPECT_EQ(buffer.LowerBound(2.25), 1);
+  EXPECT_EQ(buffer.UpperBound(2.25), 1);
+  EXPECT_EQ(buffer.LowerBound(3.5), 3);
+  EXPECT_EQ(buffer.UpperBound(3.5), 4);
+  EXPECT_EQ(buffer.UpperBound(10.0), 8);
+
+  EXPECT_EQ(buffer[buffer.Nearest(0.0)].second, 4);
+  EXPECT_EQ(buffer[buffer.Nearest(3.1)].second, 6);
+  EXPECT_EQ(buffer[buffer.Nearest(3.4)].second, 7);
+  EXPECT_EQ(buffer[buffer.Nearest(3.25)].second, 7);
+  EXPECT_EQ(buffer[buffer.Nearest(9.0)].second, 11);
+}
+
+}  // namespace lib
+}  // namespace perception
+}  // namespace apollo
@@ -17,6 +17,7 @@
 #include <sys/time.h>
 
 #include "cyber/common/log.h"
+#include "modules/perception/lib/utils/perf_collector.h"
 #include "modules/perception/lib/utils/timer.h"
 
 namespace apollo {
@@ -29,16 +30,18 @@ void Timer::Start() {
   struct timeval tv;
   gettimeofday(&tv, nullptr);
 
-  start_time_ = tv.tv_sec * 1000 + tv.tv_usec / 1000;
+  start_time_ = tv.tv_sec * 1000000 + tv.tv_usec;
 }
 
 uint64_t Timer::End(const string &msg) {
   struct timeval tv;
   gettimeofday(&tv, nullptr);
-  end_time_ = tv.tv_sec * 1000 + tv.tv_usec / 1000;
-  uint64_t elapsed_time = end_time_ - start_time_;
+  end_time_ = tv.tv_sec * 1000000 + tv.tv_usec;
+  uint64_t elapsed_time = (end_time_ - start_time_) / 1000;
 
   ADEBUG << "TIMER " << msg << " elapsed_time: " << elapsed_time << " ms";
+  PerfCollector::AddStage(msg,
+                          static_cast<double>(end_time_ - start_time_) * 1e-3);
 
   // start new timer.
   start_time_ = end_time_;
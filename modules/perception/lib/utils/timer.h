@@ -30,7 +30,8 @@ class Timer {
   void Start();
 
   // return the elapsed time,
-  // also output msg and time in glog.
+  // also output msg and time in glog
+  // and add it as a stage of the frame collected by PerfCollector.
   // automatically start a new timer.
   // no-thread safe.
   uint64_t End(const std::string &msg);
@@ -39,7 +40,7 @@ class Timer {
   Timer &operator=(const Timer &) = delete;
 
  private:
-  // in ms.
+  // in us.
   uint64_t start_time_;
   uint64_t end_time_;
 };
@@ -47,6 +47,7 @@ bool LidarObstacleSegmentation::Init(
   segmentor_name_ = config.segmentor();
   use_map_manager_ = config.use_map_manager();
   use_object_filter_bank_ = config.use_object_filter_bank();
+  builder_num_threads_ = static_cast<int>(config.builder_num_threads());
 
   use_map_manager_ = use_map_manager_ && options.enable_hdmap_input;
 
@@ -73,6 +74,7 @@ bool LidarObstacleSegmentation::Init(
   CHECK(segmentor_->Init(segmentation_init_options));
 
   ObjectBuilderInitOptions builder_init_options;
+  builder_init_options.num_threads = builder_num_threads_;
   CHECK(builder_.Init(builder_init_options));
 
   if (use_object_filter_bank_) {
@@ -119,6 +121,27 @@ LidarProcessResult LidarObstacleSegmentation::Process(
   }
 }
 
+LidarProcessResult LidarObstacleSegmentation::Process(
+    const LidarObstacleSegmentationOptions& options,
+    const apollo::drivers::PointCloudBuffer& buffer, LidarFrame* frame) {
+  const auto& sensor_name = options.sensor_name;
+
+  PERCEPTION_PERF_FUNCTION_WITH_INDICATOR(options.sensor_name);
+
+  PERCEPTION_PERF_BLOCK_START();
+  PointCloudPreprocessorOptions preprocessor_options;
+  preprocessor_options.sensor2novatel_extrinsics =
+    options.sensor2novatel_extrinsics;
+  if (cloud_preprocessor_.Preprocess(preprocessor_options, buffer, frame)) {
+    PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(sensor_name, "preprocess");
+    return ProcessCommon(options, frame);
+  } else {
+    PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(sensor_name, "preprocess");
+    return LidarProcessResult(LidarErrorCode::PointCloudPreprocessorError,
+                              "Failed to preprocess point cloud.");
+  }
+}
+
 LidarProcessResult LidarObstacleSegmentation::ProcessCommon(
     const LidarObstacleSegmentationOptions& options, LidarFrame* frame) {
   const auto& sensor_name = options.sensor_name;
@@ -55,6 +55,10 @@ class LidarObstacleSegmentation {
       const std::shared_ptr<apollo::drivers::PointCloud const>& message,
       LidarFrame* frame);
 
+  LidarProcessResult Process(const LidarObstacleSegmentationOptions& options,
+                             const apollo::drivers::PointCloudBuffer& buffer,
+                             LidarFrame* frame);
+
   LidarProcessResult Process(const LidarObstacleSegmentationOptions& options,
                              LidarFrame* frame);
 
@@ -74,6 +78,7 @@ class LidarObstacleSegmentation {
   std::string segmentor_name_;
   bool use_map_manager_ = true;
   bool use_object_filter_bank_ = true;
+  int builder_num_threads_ = 1;
 };  // class LidarObstacleSegmentation
 
 }  // namespace lidar
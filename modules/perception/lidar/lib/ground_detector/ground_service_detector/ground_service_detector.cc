@@ -60,7 +60,9 @@ bool GroundServiceDetector::Detect(const GroundDetectorOptions& options,
     AERROR << "Frame is nullptr.";
     return false;
   }
-  ground_service_->GetServiceContentCopy(&ground_service_content_);
+  // the shared content is copied only when updated since the last frame
+  ground_service_->GetServiceContentCopy(&ground_service_content_,
+                                         &ground_service_version_);
   if (!ground_service_content_.IsServiceReady()) {
     AERROR << "service is not ready.";
     return false;
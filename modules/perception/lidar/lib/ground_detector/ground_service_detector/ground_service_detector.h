@@ -41,6 +41,7 @@ class GroundServiceDetector : public BaseGroundDetector {
  private:
   GroundServicePtr ground_service_ = nullptr;
   GroundServiceContent ground_service_content_;
+  uint64_t ground_service_version_ = 0;
   double ground_threshold_ = 0.25;
 };
 
@@ -15,6 +15,9 @@
  *****************************************************************************/
 #include "modules/perception/lidar/lib/map_manager/map_manager.h"
 
+#include <cmath>
+#include <limits>
+
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
 
@@ -27,6 +30,18 @@ namespace lidar {
 
 using cyber::common::GetAbsolutePath;
 
+MapManager::~MapManager() {
+  if (fetch_thread_ == nullptr) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(fetch_mutex_);
+    fetch_exit_ = true;
+  }
+  fetch_condition_.notify_one();
+  fetch_thread_->join();
+}
+
 bool MapManager::Init(const MapManagerInitOptions& options) {
   auto config_manager = lib::ConfigManager::Instance();
   const lib::ModelConfig* model_config = nullptr;
@@ -41,11 +56,21 @@ bool MapManager::Init(const MapManagerInitOptions& options) {
   CHECK(cyber::common::GetProtoFromFile(config_file, &config));
   update_pose_ = config.update_pose();
   roi_search_distance_ = config.roi_search_distance();
+  async_hdmap_fetch_ = config.async_hdmap_fetch();
+  prefetch_margin_ = config.prefetch_margin();
   hdmap_input_ = map::HDMapInput::Instance();
   if (!hdmap_input_->Init()) {
     AINFO << "Failed to init hdmap input.";
     return false;
   }
+  if (async_hdmap_fetch_) {
+    std::lock_guard<std::mutex> lock(fetch_mutex_);
+    // drop what was fetched with the previous config
+    fetched_hdmap_struct_ = nullptr;
+    if (fetch_thread_ == nullptr) {
+      fetch_thread_.reset(new std::thread(&MapManager::FetchLoop, this));
+    }
+  }
   return true;
 }
 
@@ -70,6 +95,10 @@ bool MapManager::Update(const MapManagerOptions& options, LidarFrame* frame) {
   point.x = frame->lidar2world_pose.translation()(0);
   point.y = frame->lidar2world_pose.translation()(1);
   point.z = frame->lidar2world_pose.translation()(2);
+  if (async_hdmap_fetch_) {
+    UpdateFromFetched(point, frame);
+    return true;
+  }
   if (!hdmap_input_->GetRoiHDMapStruct(point, roi_search_distance_,
                                        frame->hdmap_struct)) {
     frame->hdmap_struct->road_polygons.clear();
@@ -80,6 +109,71 @@ bool MapManager::Update(const MapManagerOptions& options, LidarFrame* frame) {
   }
   return true;
 }
+
+void MapManager::UpdateFromFetched(const base::PointD& point,
+                                   LidarFrame* frame) {
+  std::shared_ptr<base::HdmapStruct> hdmap_struct = nullptr;
+  bool request = false;
+  {
+    std::lock_guard<std::mutex> lock(fetch_mutex_);
+    double distance = std::numeric_limits<double>::infinity();
+    if (fetched_hdmap_struct_ != nullptr) {
+      distance = std::hypot(point.x - fetched_center_.x,
+                            point.y - fetched_center_.y);
+    }
+    if (distance <= prefetch_margin_) {
+      hdmap_struct = fetched_hdmap_struct_;
+    }
+    // refetch while the current one still covers the next frames
+    if (distance > 0.5 * prefetch_margin_ && !fetch_pending_) {
+      fetch_request_ = point;
+      fetch_pending_ = true;
+      request = true;
+    }
+  }
+  if (request) {
+    fetch_condition_.notify_one();
+  }
+  if (hdmap_struct == nullptr) {
+    // nothing fetched covers the pose yet, e.g. the first frame
+    hdmap_struct.reset(new base::HdmapStruct);
+    if (!hdmap_input_->GetRoiHDMapStruct(point, roi_search_distance_,
+                                         hdmap_struct)) {
+      hdmap_struct.reset(new base::HdmapStruct);
+      AINFO << "Failed to get roi from hdmap.";
+    }
+  }
+  frame->hdmap_struct = hdmap_struct;
+}
+
+void MapManager::FetchLoop() {
+  while (true) {
+    base::PointD center;
+    {
+      std::unique_lock<std::mutex> lock(fetch_mutex_);
+      fetch_condition_.wait(lock,
+                            [this] { return fetch_pending_ || fetch_exit_; });
+      if (fetch_exit_) {
+        return;
+      }
+      center = fetch_request_;
+    }
+    std::shared_ptr<base::HdmapStruct> hdmap_struct(new base::HdmapStruct);
+    bool success = hdmap_input_->GetRoiHDMapStruct(
+        center, roi_search_distance_ + prefetch_margin_, hdmap_struct);
+    {
+      std::lock_guard<std::mutex> lock(fetch_mutex_);
+      if (success) {
+        fetched_hdmap_struct_ = hdmap_struct;
+        fetched_center_ = center;
+      } else {
+        AINFO << "Failed to fetch roi from hdmap.";
+      }
+      fetch_pending_ = false;
+    }
+  }
+}
+
 bool MapManager::QueryPose(Eigen::Affine3d* sensor2world_pose) const {
   // TODO(...): map-based aligment to refine pose
   return false;
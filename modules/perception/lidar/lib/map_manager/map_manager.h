@@ -15,7 +15,11 @@
  *****************************************************************************/
 #pragma once
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "gtest/gtest_prod.h"
 
@@ -35,7 +39,7 @@ class MapManager {
  public:
   MapManager() = default;
 
-  ~MapManager() = default;
+  ~MapManager();
 
   bool Init(const MapManagerInitOptions& options = MapManagerInitOptions());
 
@@ -51,11 +55,30 @@ class MapManager {
   std::string Name() const { return "MapManager"; }
 
  private:
+  // @brief: share the latest fetched map structure with frame, request a
+  // fetch ahead of the vehicle when it gets close to the edge of it
+  void UpdateFromFetched(const base::PointD& point, LidarFrame* frame);
+
+  // @brief: main function of the fetch thread
+  void FetchLoop();
+
   LidarFrame* cached_frame_ = nullptr;
   map::HDMapInput* hdmap_input_ = nullptr;
   // params
   bool update_pose_ = false;
   double roi_search_distance_ = 80.0;
+  bool async_hdmap_fetch_ = false;
+  double prefetch_margin_ = 20.0;
+  // asynchronous fetch, fetched_hdmap_struct_ is never modified once
+  // published since frames share it
+  std::unique_ptr<std::thread> fetch_thread_;
+  std::mutex fetch_mutex_;
+  std::condition_variable fetch_condition_;
+  std::shared_ptr<base::HdmapStruct> fetched_hdmap_struct_;
+  base::PointD fetched_center_;
+  base::PointD fetch_request_;
+  bool fetch_pending_ = false;
+  bool fetch_exit_ = false;
 
   FRIEND_TEST(LidarLibMapManagerTest, lidar_map_manager_test);
 };  // class MapManager
@@ -16,6 +16,9 @@
 #include "modules/perception/lidar/lib/object_builder/object_builder.h"
 
 #include <algorithm>
+#include <future>
+
+#include "cyber/task/task.h"
 
 #include "modules/perception/common/geometry/common.h"
 #include "modules/perception/common/geometry/convex_hull_2d.h"
@@ -33,9 +36,10 @@ using apollo::perception::base::PointF;
 using apollo::perception::base::PointD;
 using ObjectPtr = std::shared_ptr<apollo::perception::base::Object>;
 using PointFCloud = apollo::perception::base::PointCloud<PointF>;
-using PolygonDType = apollo::perception::base::PointCloud<PointD>;
 
 bool ObjectBuilder::Init(const ObjectBuilderInitOptions& options) {
+  num_threads_ = std::max(options.num_threads, 1);
+  hulls_.resize(num_threads_);
   return true;
 }
 
@@ -45,20 +49,36 @@ bool ObjectBuilder::Build(const ObjectBuilderOptions& options,
     return false;
   }
   std::vector<ObjectPtr>* objects = &(frame->segmented_objects);
-  for (size_t i = 0; i < objects->size(); ++i) {
-    if (objects->at(i)) {
-      objects->at(i)->id = static_cast<int>(i);
-      ComputePolygon2D(objects->at(i));
+  const int num_objects = static_cast<int>(objects->size());
+  // objects are independent, thread t builds objects t, t + n, ... so that
+  // large and small objects are spread over the threads
+  auto build_objects = [&](int thread_id) {
+    for (int i = thread_id; i < num_objects; i += num_threads_) {
+      BuildObject(i, &hulls_[thread_id], objects->at(i));
     }
+  };
+  std::vector<std::future<void>> futures;
+  for (int t = 1; t < num_threads_ && t < num_objects; ++t) {
+    futures.push_back(cyber::Async(build_objects, t));
   }
-  for (size_t i = 0; i < objects->size(); ++i) {
-    ComputePolygonSizeCenter(objects->at(i));
-    ComputeOtherObjectInformation(objects->at(i));
+  build_objects(0);
+  for (auto& future : futures) {
+    future.get();
   }
   return true;
 }
 
-void ObjectBuilder::ComputePolygon2D(ObjectPtr object) {
+void ObjectBuilder::BuildObject(int id, ConvexHull* hull, ObjectPtr object) {
+  if (object == nullptr) {
+    return;
+  }
+  object->id = id;
+  ComputePolygon2D(hull, object);
+  ComputePolygonSizeCenter(object);
+  ComputeOtherObjectInformation(object);
+}
+
+void ObjectBuilder::ComputePolygon2D(ConvexHull* hull, ObjectPtr object) {
   Eigen::Vector3f min_pt;
   Eigen::Vector3f max_pt;
   PointFCloud& cloud = object->lidar_supplement.cloud;
@@ -68,8 +88,7 @@ void ObjectBuilder::ComputePolygon2D(ObjectPtr object) {
     return;
   }
   LinePerturbation(&cloud);
-  common::ConvexHull2D<PointFCloud, PolygonDType> hull;
-  hull.GetConvexHull(cloud, &(object->polygon));
+  hull->GetConvexHull(cloud, &(object->polygon));
 }
 
 void ObjectBuilder::ComputeOtherObjectInformation(ObjectPtr object) {
@@ -185,20 +204,23 @@ bool ObjectBuilder::LinePerturbation(PointFCloud* cloud) {
 void ObjectBuilder::GetMinMax3D(const PointFCloud& cloud,
                                 Eigen::Vector3f* min_pt,
                                 Eigen::Vector3f* max_pt) {
-  (*min_pt)[0] = (*min_pt)[1] = (*min_pt)[2] = FLT_MAX;
-  (*max_pt)[0] = (*max_pt)[1] = (*max_pt)[2] = -FLT_MAX;
+  // reduce into scalars without branches, so that the loop can be
+  // vectorized. points with a nan coordinate do not change the bounds.
+  float min_x = FLT_MAX, min_y = FLT_MAX, min_z = FLT_MAX;
+  float max_x = -FLT_MAX, max_y = -FLT_MAX, max_z = -FLT_MAX;
   for (size_t i = 0; i < cloud.size(); ++i) {
-    if (std::isnan(cloud[i].x) || std::isnan(cloud[i].y) ||
-        std::isnan(cloud[i].z)) {
-      continue;
-    }
-    (*min_pt)[0] = std::min((*min_pt)[0], cloud[i].x);
-    (*max_pt)[0] = std::max((*max_pt)[0], cloud[i].x);
-    (*min_pt)[1] = std::min((*min_pt)[1], cloud[i].y);
-    (*max_pt)[1] = std::max((*max_pt)[1], cloud[i].y);
-    (*min_pt)[2] = std::min((*min_pt)[2], cloud[i].z);
-    (*max_pt)[2] = std::max((*max_pt)[2], cloud[i].z);
+    const PointF& pt = cloud[i];
+    const bool valid = !(std::isnan(pt.x) || std::isnan(pt.y) ||
+                         std::isnan(pt.z));
+    min_x = std::min(min_x, valid ? pt.x : FLT_MAX);
+    min_y = std::min(min_y, valid ? pt.y : FLT_MAX);
+    min_z = std::min(min_z, valid ? pt.z : FLT_MAX);
+    max_x = std::max(max_x, valid ? pt.x : -FLT_MAX);
+    max_y = std::max(max_y, valid ? pt.y : -FLT_MAX);
+    max_z = std::max(max_z, valid ? pt.z : -FLT_MAX);
   }
+  *min_pt = Eigen::Vector3f(min_x, min_y, min_z);
+  *max_pt = Eigen::Vector3f(max_x, max_y, max_z);
 }
 
 }  // namespace lidar
@@ -22,6 +22,7 @@
 #include "modules/perception/base/object.h"
 #include "modules/perception/base/point.h"
 #include "modules/perception/base/point_cloud.h"
+#include "modules/perception/common/geometry/convex_hull_2d.h"
 #include "modules/perception/lib/registerer/registerer.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
 
@@ -29,7 +30,10 @@ namespace apollo {
 namespace perception {
 namespace lidar {
 
-struct ObjectBuilderInitOptions {};
+struct ObjectBuilderInitOptions {
+  // number of threads building the objects
+  int num_threads = 1;
+};
 
 struct ObjectBuilderOptions {
   Eigen::Vector3d ref_center = Eigen::Vector3d(0, 0, 0);
@@ -53,10 +57,24 @@ class ObjectBuilder {
   std::string Name() const { return "ObjectBuilder"; }
 
  private:
+  typedef common::ConvexHull2D<
+      apollo::perception::base::PointCloud<apollo::perception::base::PointF>,
+      apollo::perception::base::PointCloud<apollo::perception::base::PointD>>
+      ConvexHull;
+
+  // @brief: fill id, polygon, size, center and other information of one
+  //         object.
+  // @param [in]: object id, convex hull used by the calling thread.
+  // @param [in/out]: ObjectPtr.
+  void BuildObject(int id, ConvexHull* hull,
+                   std::shared_ptr<apollo::perception::base::Object> object);
+
   // @brief: calculate 2d polygon.
   //         and fill the convex hull vertices in object->polygon.
+  // @param [in]: convex hull used by the calling thread.
   // @param [in/out]: ObjectPtr.
   void ComputePolygon2D(
+      ConvexHull* hull,
       std::shared_ptr<apollo::perception::base::Object> object);
 
   // @brief: calculate the size, center of polygon.
@@ -93,6 +111,11 @@ class ObjectBuilder {
           apollo::perception::base::PointF>& cloud,
       Eigen::Vector3f* min_pt,
       Eigen::Vector3f* max_pt);
+
+  // @brief: one convex hull per thread, their buffers are reused by all
+  //         objects built by the thread
+  std::vector<ConvexHull> hulls_ = std::vector<ConvexHull>(1);
+  int num_threads_ = 1;
 };  // class ObjectBuilder
 
 }  // namespace lidar
@@ -80,26 +80,7 @@ bool PointCloudPreprocessor::Preprocess(
     base::PointF point;
     for (int i = 0; i < message->point_size(); ++i) {
       const apollo::drivers::PointXYZIT& pt = message->point(i);
-      if (filter_naninf_points_) {
-        if (std::isnan(pt.x()) || std::isnan(pt.y()) || std::isnan(pt.z())) {
-          continue;
-        }
-        if (fabs(pt.x()) > kPointInfThreshold ||
-            fabs(pt.y()) > kPointInfThreshold ||
-            fabs(pt.z()) > kPointInfThreshold) {
-          continue;
-        }
-      }
-      Eigen::Vector3d vec3d_lidar(pt.x(), pt.y(), pt.z());
-      Eigen::Vector3d vec3d_novatel =
-        options.sensor2novatel_extrinsics * vec3d_lidar;
-      if (filter_nearby_box_points_ && vec3d_novatel[0] < box_forward_x_ &&
-          vec3d_novatel[0] > box_backward_x_ &&
-          vec3d_novatel[1] < box_forward_y_ &&
-          vec3d_novatel[1] > box_backward_y_) {
-        continue;
-      }
-      if (filter_high_z_points_ && pt.z() > z_threshold_) {
+      if (IsFilteredPoint(options, pt.x(), pt.y(), pt.z())) {
         continue;
       }
       point.x = pt.x();
@@ -114,6 +95,39 @@ bool PointCloudPreprocessor::Preprocess(
   return true;
 }
 
+bool PointCloudPreprocessor::Preprocess(
+    const PointCloudPreprocessorOptions& options,
+    const apollo::drivers::PointCloudBuffer& buffer, LidarFrame* frame) const {
+  if (frame == nullptr) {
+    return false;
+  }
+  if (frame->cloud == nullptr) {
+    frame->cloud = base::PointFCloudPool::Instance().Get();
+  }
+  if (frame->world_cloud == nullptr) {
+    frame->world_cloud = base::PointDCloudPool::Instance().Get();
+  }
+  frame->cloud->set_timestamp(buffer.measurement_time);
+  if (buffer.size() > 0) {
+    frame->cloud->reserve(buffer.size());
+    base::PointF point;
+    for (size_t i = 0; i < buffer.size(); ++i) {
+      if (IsFilteredPoint(options, buffer.x[i], buffer.y[i], buffer.z[i])) {
+        continue;
+      }
+      point.x = buffer.x[i];
+      point.y = buffer.y[i];
+      point.z = buffer.z[i];
+      point.intensity = static_cast<float>(buffer.intensity[i]);
+      frame->cloud->push_back(point,
+                              static_cast<double>(buffer.timestamp[i]) * 1e-9,
+                              FLT_MAX, static_cast<int32_t>(i), 0);
+    }
+    TransformCloud(frame->cloud, frame->lidar2world_pose, frame->world_cloud);
+  }
+  return true;
+}
+
 bool PointCloudPreprocessor::Preprocess(
     const PointCloudPreprocessorOptions& options, LidarFrame* frame) const {
   if (frame == nullptr || frame->cloud == nullptr) {
@@ -162,6 +176,34 @@ bool PointCloudPreprocessor::Preprocess(
   return true;
 }
 
+bool PointCloudPreprocessor::IsFilteredPoint(
+    const PointCloudPreprocessorOptions& options, const double x,
+    const double y, const double z) const {
+  if (filter_naninf_points_) {
+    if (std::isnan(x) || std::isnan(y) || std::isnan(z)) {
+      return true;
+    }
+    if (fabs(x) > kPointInfThreshold || fabs(y) > kPointInfThreshold ||
+        fabs(z) > kPointInfThreshold) {
+      return true;
+    }
+  }
+  if (filter_nearby_box_points_) {
+    Eigen::Vector3d vec3d_novatel =
+        options.sensor2novatel_extrinsics * Eigen::Vector3d(x, y, z);
+    if (vec3d_novatel[0] < box_forward_x_ &&
+        vec3d_novatel[0] > box_backward_x_ &&
+        vec3d_novatel[1] < box_forward_y_ &&
+        vec3d_novatel[1] > box_backward_y_) {
+      return true;
+    }
+  }
+  if (filter_high_z_points_ && z > z_threshold_) {
+    return true;
+  }
+  return false;
+}
+
 bool PointCloudPreprocessor::TransformCloud(
     const base::PointFCloudPtr& local_cloud, const Eigen::Affine3d& pose,
     base::PointDCloudPtr world_cloud) const {
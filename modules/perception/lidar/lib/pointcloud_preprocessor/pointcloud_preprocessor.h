@@ -18,6 +18,7 @@
 #include <memory>
 #include <string>
 
+#include "modules/drivers/common/point_cloud_buffer.h"
 #include "modules/drivers/proto/pointcloud.pb.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
 
@@ -52,6 +53,15 @@ class PointCloudPreprocessor {
       const std::shared_ptr<apollo::drivers::PointCloud const>& message,
       LidarFrame* frame) const;
 
+  // @brief: preprocess point cloud decoded by the lidar driver
+  // @param [in]: options
+  // @param [in]: decoded point cloud shared with the other readers
+  // @param [in/out]: frame
+  // cloud should be filled, required,
+  bool Preprocess(const PointCloudPreprocessorOptions& options,
+                  const apollo::drivers::PointCloudBuffer& buffer,
+                  LidarFrame* frame) const;
+
   // @brief: preprocess point cloud
   // @param [in/out]: frame
   // cloud should be filled, required,
@@ -61,6 +71,9 @@ class PointCloudPreprocessor {
   std::string Name() const { return "PointCloudPreprocessor"; }
 
  private:
+  // @brief: whether a point in the lidar frame is filtered out
+  bool IsFilteredPoint(const PointCloudPreprocessorOptions& options,
+                       const double x, const double y, const double z) const;
   bool TransformCloud(const base::PointFCloudPtr& local_cloud,
                       const Eigen::Affine3d& pose,
                       base::PointDCloudPtr world_cloud) const;
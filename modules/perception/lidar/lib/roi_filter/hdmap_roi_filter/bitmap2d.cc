@@ -124,6 +124,34 @@ bool Bitmap2D::Check(const Eigen::Vector2d& p) const {
   return CheckBit(bit_p.z(), bitmap_[idx]);
 }
 
+void Bitmap2D::Check(const float* xs, const float* ys, const size_t size,
+                     uint8_t* is_set) const {
+  const float* majors = dir_major_ == DirectionMajor::XMAJOR ? xs : ys;
+  const float* minors = dir_major_ == DirectionMajor::XMAJOR ? ys : xs;
+  const double min_major = min_range_[dir_major()];
+  const double max_major = max_range_[dir_major()];
+  const double min_minor = min_range_[op_dir_major()];
+  const double max_minor = max_range_[op_dir_major()];
+  const double cell_major = cell_size_[dir_major()];
+  const double cell_minor = cell_size_[op_dir_major()];
+  const size_t row_size = map_size_[1];
+  const uint64_t* bitmap = bitmap_.data();
+  for (size_t i = 0; i < size; ++i) {
+    const double major = majors[i];
+    const double minor = minors[i];
+    const bool exists = major >= min_major && major < max_major &&
+                        minor >= min_minor && minor < max_minor;
+    // points out of the range read the first block and are masked out
+    const size_t major_pix =
+        exists ? static_cast<size_t>((major - min_major) / cell_major) : 0;
+    const size_t minor_pix =
+        exists ? static_cast<size_t>((minor - min_minor) / cell_minor) : 0;
+    const uint64_t block = bitmap[major_pix * row_size + (minor_pix >> 6)];
+    is_set[i] =
+        static_cast<uint8_t>(exists & ((block >> (minor_pix & 63)) & 1));
+  }
+}
+
 // set and reset
 void Bitmap2D::Set(const Eigen::Vector2d& p) {
   const Vec3ui bit_p = RealToBitmap(p);
@@ -55,6 +55,11 @@ class Bitmap2D {
   bool IsExists(const Eigen::Vector2d& p) const;
 
   bool Check(const Eigen::Vector2d& p) const;
+  // checks the points given by the coordinate arrays xs and ys, sets
+  // is_set[i] to 1 if the i-th point exists in the range and its bit is set,
+  // to 0 otherwise. The loop has no branch, so that it can be vectorized.
+  void Check(const float* xs, const float* ys, const size_t size,
+             uint8_t* is_set) const;
   void Set(const Eigen::Vector2d& p);
   void Reset(const Eigen::Vector2d& p);
 
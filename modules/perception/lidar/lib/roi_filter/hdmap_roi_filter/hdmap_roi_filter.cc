@@ -17,6 +17,7 @@
 #include "modules/perception/lidar/lib/roi_filter/hdmap_roi_filter/hdmap_roi_filter.h"
 
 #include <algorithm>
+#include <functional>
 
 #include "cyber/common/file.h"
 #include "modules/perception/lib/config_manager/config_manager.h"
@@ -54,6 +55,7 @@ bool HdmapROIFilter::Init(const ROIFilterInitOptions& options) {
   extend_dist_ = config.extend_dist();
   no_edge_table_ = config.no_edge_table();
   set_roi_service_ = config.set_roi_service();
+  cache_margin_ = std::max(config.cache_margin(), 0.0);
 
   // reserve mem
   const size_t KPolygonMaxNum = 100;
@@ -61,17 +63,20 @@ bool HdmapROIFilter::Init(const ROIFilterInitOptions& options) {
   polygons_local_.reserve(KPolygonMaxNum);
 
   // init bitmap
-  Eigen::Vector2d min_range(-range_, -range_);
-  Eigen::Vector2d max_range(range_, range_);
+  const double bitmap_range = range_ + cache_margin_;
+  Eigen::Vector2d min_range(-bitmap_range, -bitmap_range);
+  Eigen::Vector2d max_range(bitmap_range, bitmap_range);
   Eigen::Vector2d cell_size(cell_size_, cell_size_);
   bitmap_.Init(min_range, max_range, cell_size);
+  bitmap_valid_ = false;
 
   // output input parameters
   AINFO << " HDMap Roi Filter Parameters: "
         << " range: " << range_ << " cell_size: " << cell_size_
         << " extend_dist: " << extend_dist_
         << " no_edge_table: " << no_edge_table_
-        << " set_roi_service: " << set_roi_service_;
+        << " set_roi_service: " << set_roi_service_
+        << " cache_margin: " << cache_margin_;
   return true;
 }
 
@@ -101,13 +106,29 @@ bool HdmapROIFilter::Filter(const ROIFilterOptions& options,
     polygons_world_[i++] = &polygon;
   }
 
+  // rasterize the polygons around the vehicle, unless the bitmap of the
+  // last frame still covers the roi
+  const Eigen::Vector2d location =
+      frame->lidar2world_pose.translation().head<2>();
+  const size_t polygons_signature = PolygonsSignature(polygons_world_);
+  if (!IsBitmapReusable(polygons_signature, location)) {
+    bitmap_anchor_ = location;
+    if (cache_margin_ > 0.0) {
+      // keep the cells aligned in the world, the anchor is a cell corner
+      bitmap_anchor_ = (location / cell_size_).array().round() * cell_size_;
+    }
+    TransformPolygons(polygons_world_, bitmap_anchor_, &polygons_local_);
+    bitmap_valid_ = DrawPolygonsBitmap(polygons_local_);
+    bitmap_polygons_signature_ = polygons_signature;
+    bitmap_published_ = false;
+  }
+
   // transform to local
-  base::PointFCloudPtr cloud_local = base::PointFCloudPool::Instance().Get();
-  TransformFrame(frame->cloud, frame->lidar2world_pose, polygons_world_,
-                 &polygons_local_, &cloud_local);
+  const Eigen::Vector2d offset = location - bitmap_anchor_;
+  TransformCloud(frame->cloud, frame->lidar2world_pose, offset, &cloud_local_);
 
-  bool ret = FilterWithPolygonMask(cloud_local, polygons_local_,
-                                   &(frame->roi_indices));
+  bool ret = Bitmap2dFilter(cloud_local_, offset, bitmap_,
+                            &(frame->roi_indices));
 
   // set roi points label
   if (ret) {
@@ -120,18 +141,21 @@ bool HdmapROIFilter::Filter(const ROIFilterOptions& options,
     */
   }
 
-  // set roi service
-  if (set_roi_service_) {
+  // set roi service, which is shared by the lidar pipelines of the process,
+  // only when the bitmap changed so that readers skip unchanged copies
+  if (set_roi_service_ && !bitmap_published_) {
     auto roi_service = SceneManager::Instance().Service("ROIService");
     if (roi_service != nullptr) {
-      roi_service_content_.range_ = range_;
+      roi_service_content_.range_ = range_ + cache_margin_;
       roi_service_content_.cell_size_ = cell_size_;
       roi_service_content_.map_size_ = bitmap_.map_size();
       roi_service_content_.bitmap_ = bitmap_.bitmap();
       roi_service_content_.major_dir_ =
           static_cast<ROIServiceContent::DirectionMajor>(bitmap_.dir_major());
-      roi_service_content_.transform_ = frame->lidar2world_pose.translation();
+      roi_service_content_.transform_ << bitmap_anchor_,
+          frame->lidar2world_pose.translation().z();
       roi_service->UpdateServiceContent(roi_service_content_);
+      bitmap_published_ = true;
     } else {
       AINFO << "Failed to find roi service and cannot update.";
     }
@@ -139,14 +163,13 @@ bool HdmapROIFilter::Filter(const ROIFilterOptions& options,
   return ret;
 }
 
-bool HdmapROIFilter::FilterWithPolygonMask(
-    const base::PointFCloudPtr& cloud,
-    const std::vector<PolygonDType>& map_polygons,
-    base::PointIndices* roi_indices) {
+bool HdmapROIFilter::DrawPolygonsBitmap(
+    const std::vector<PolygonDType>& map_polygons) {
   std::vector<Polygon<double>> raw_polygons;
   // convert and obtain the major direction
   raw_polygons.resize(map_polygons.size());
-  double min_x = range_;
+  const double bitmap_range = range_ + cache_margin_;
+  double min_x = bitmap_range;
   double max_x = -min_x;
   double min_y = min_x;
   double max_y = max_x;
@@ -164,10 +187,10 @@ bool HdmapROIFilter::FilterWithPolygonMask(
       max_y = std::max(raw_polygon[j].y(), max_y);
     }
   }
-  min_x = std::max(min_x, -range_);
-  max_x = std::min(max_x, range_);
-  min_y = std::max(min_y, -range_);
-  max_y = std::min(max_y, range_);
+  min_x = std::max(min_x, -bitmap_range);
+  max_x = std::min(max_x, bitmap_range);
+  min_y = std::max(min_y, -bitmap_range);
+  max_y = std::min(max_y, bitmap_range);
 
   DirectionMajor major_dir = DirectionMajor::XMAJOR;
   if ((max_y - min_y) < (max_x - min_x)) {
@@ -175,22 +198,39 @@ bool HdmapROIFilter::FilterWithPolygonMask(
   }
   bitmap_.SetUp(major_dir);
 
-  DrawPolygonsMask<double>(raw_polygons, &bitmap_, extend_dist_,
-                           no_edge_table_);
-  return Bitmap2dFilter(cloud, bitmap_, roi_indices);
+  return DrawPolygonsMask<double>(raw_polygons, &bitmap_, extend_dist_,
+                                  no_edge_table_);
 }
 
-void HdmapROIFilter::TransformFrame(
-    const base::PointFCloudPtr& cloud, const Eigen::Affine3d& vel_pose,
-    const std::vector<PolygonDType*>& polygons_world,
-    std::vector<PolygonDType>* polygons_local,
-    base::PointFCloudPtr* cloud_local) {
-  Eigen::Vector3d vel_location = vel_pose.translation();
-  Eigen::Matrix3d vel_rot = vel_pose.linear();
-  Eigen::Vector3d x_axis = vel_rot.row(0);
-  Eigen::Vector3d y_axis = vel_rot.row(1);
+size_t HdmapROIFilter::PolygonsSignature(
+    const std::vector<PolygonDType*>& polygons) {
+  std::hash<double> hash;
+  size_t signature = polygons.size();
+  for (const auto* polygon : polygons) {
+    size_t polygon_hash = polygon->size();
+    for (const auto& pt : *polygon) {
+      polygon_hash = polygon_hash * 31 + hash(pt.x);
+      polygon_hash = polygon_hash * 31 + hash(pt.y);
+    }
+    // the sum does not depend on the order of the polygons
+    signature += polygon_hash;
+  }
+  return signature;
+}
+
+bool HdmapROIFilter::IsBitmapReusable(const size_t polygons_signature,
+                                      const Eigen::Vector2d& location) const {
+  if (!bitmap_valid_ || polygons_signature != bitmap_polygons_signature_) {
+    return false;
+  }
+  const Eigen::Vector2d offset = location - bitmap_anchor_;
+  return std::fabs(offset.x()) <= cache_margin_ &&
+         std::fabs(offset.y()) <= cache_margin_;
+}
 
-  // transform polygons
+void HdmapROIFilter::TransformPolygons(
+    const std::vector<PolygonDType*>& polygons_world,
+    const Eigen::Vector2d& anchor, std::vector<PolygonDType>* polygons_local) {
   polygons_local->clear();
   polygons_local->resize(polygons_world.size());
   for (size_t i = 0; i < polygons_local->size(); ++i) {
@@ -198,39 +238,57 @@ void HdmapROIFilter::TransformFrame(
     auto& polygon_local = (*polygons_local)[i];
     polygon_local.resize(polygon_world.size());
     for (size_t j = 0; j < polygon_local.size(); ++j) {
-      polygon_local[j].x = polygon_world[j].x - vel_location.x();
-      polygon_local[j].y = polygon_world[j].y - vel_location.y();
+      polygon_local[j].x = polygon_world[j].x - anchor.x();
+      polygon_local[j].y = polygon_world[j].y - anchor.y();
     }
   }
+}
 
-  // transform cloud
-  (*cloud_local)->clear();
-  (*cloud_local)->resize(cloud->size());
-  for (size_t i = 0; i < (*cloud_local)->size(); ++i) {
+void HdmapROIFilter::TransformCloud(const base::PointFCloudPtr& cloud,
+                                    const Eigen::Affine3d& vel_pose,
+                                    const Eigen::Vector2d& offset,
+                                    base::SoAPointCloud<float>* cloud_local) {
+  Eigen::Matrix3d vel_rot = vel_pose.linear();
+  Eigen::Vector3d x_axis = vel_rot.row(0);
+  Eigen::Vector3d y_axis = vel_rot.row(1);
+
+  cloud_local->resize(cloud->size());
+  float* xs = cloud_local->mutable_x();
+  float* ys = cloud_local->mutable_y();
+  for (size_t i = 0; i < cloud->size(); ++i) {
     const auto& pt = cloud->at(i);
-    auto& local_pt = (*cloud_local)->at(i);
     Eigen::Vector3d e_pt(pt.x, pt.y, pt.z);
-    local_pt.x = static_cast<float>(x_axis.dot(e_pt));
-    local_pt.y = static_cast<float>(y_axis.dot(e_pt));
+    xs[i] = static_cast<float>(x_axis.dot(e_pt) + offset.x());
+    ys[i] = static_cast<float>(y_axis.dot(e_pt) + offset.y());
   }
 }
 
-bool HdmapROIFilter::Bitmap2dFilter(const base::PointFCloudPtr& in_cloud,
+bool HdmapROIFilter::Bitmap2dFilter(const base::SoAPointCloud<float>& in_cloud,
+                                    const Eigen::Vector2d& offset,
                                     const Bitmap2D& bitmap,
                                     base::PointIndices* roi_indices) {
-  if (!bitmap.Check(Eigen::Vector2d(0.0, 0.0))) {
+  if (!bitmap.Check(offset)) {
     AWARN << " Car is not in roi!!.";
     return false;
   }
+  const size_t size = in_cloud.size();
   roi_indices->indices.clear();
-  roi_indices->indices.reserve(in_cloud->size());
-  for (size_t i = 0; i < in_cloud->size(); ++i) {
-    const auto& pt = in_cloud->at(i);
-    Eigen::Vector2d e_pt(pt.x, pt.y);
-    if (!bitmap.IsExists(e_pt)) {
-      continue;
-    }
-    if (bitmap.Check(e_pt)) {
+  roi_indices->indices.reserve(size);
+  if (size == 0) {
+    return true;
+  }
+  points_in_bitmap_.resize(size);
+  bitmap.Check(in_cloud.x(), in_cloud.y(), size, points_in_bitmap_.data());
+  // the bitmap is larger than the range when it is cached
+  const double min_x = offset.x() - range_;
+  const double max_x = offset.x() + range_;
+  const double min_y = offset.y() - range_;
+  const double max_y = offset.y() + range_;
+  const float* xs = in_cloud.x();
+  const float* ys = in_cloud.y();
+  for (size_t i = 0; i < size; ++i) {
+    if (points_in_bitmap_[i] && xs[i] >= min_x && xs[i] < max_x &&
+        ys[i] >= min_y && ys[i] < max_y) {
       roi_indices->indices.push_back(static_cast<int>(i));
     }
   }
@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "modules/perception/base/point_cloud.h"
+#include "modules/perception/base/soa_point_cloud.h"
 #include "modules/perception/lidar/lib/interface/base_roi_filter.h"
 #include "modules/perception/lidar/lib/roi_filter/hdmap_roi_filter/bitmap2d.h"
 #include "modules/perception/lidar/lib/scene_manager/roi_service/roi_service.h"
@@ -45,19 +46,30 @@ class HdmapROIFilter : public BaseROIFilter {
   bool Filter(const ROIFilterOptions& options, LidarFrame* frame) override;
 
  private:
-  void TransformFrame(const base::PointFCloudPtr& cloud,
+  // order independent hash of the polygons vertices
+  static size_t PolygonsSignature(
+      const std::vector<base::PolygonDType*>& polygons);
+
+  // whether the bitmap of the last frame covers the roi of this frame
+  bool IsBitmapReusable(const size_t polygons_signature,
+                        const Eigen::Vector2d& location) const;
+
+  void TransformPolygons(const std::vector<base::PolygonDType*>& polygons_world,
+                         const Eigen::Vector2d& anchor,
+                         std::vector<base::PolygonDType>* polygons_local);
+
+  // rotates the cloud to the world axes and shifts it by offset
+  void TransformCloud(const base::PointFCloudPtr& cloud,
                       const Eigen::Affine3d& vel_pose,
-                      const std::vector<base::PolygonDType*>& polygons_world,
-                      std::vector<base::PolygonDType>* polygons_local,
-                      base::PointFCloudPtr* cloud_local);
+                      const Eigen::Vector2d& offset,
+                      base::SoAPointCloud<float>* cloud_local);
 
-  bool FilterWithPolygonMask(
-      const base::PointFCloudPtr& cloud,
-      const std::vector<base::PolygonDType>& map_polygons,
-      base::PointIndices* roi_indices);
+  bool DrawPolygonsBitmap(const std::vector<base::PolygonDType>& map_polygons);
 
-  bool Bitmap2dFilter(const base::PointFCloudPtr& in_cloud,
-                      const Bitmap2D& bitmap, base::PointIndices* roi_indices);
+  // keeps the points within range_ of the vehicle at offset
+  bool Bitmap2dFilter(const base::SoAPointCloud<float>& in_cloud,
+                      const Eigen::Vector2d& offset, const Bitmap2D& bitmap,
+                      base::PointIndices* roi_indices);
 
   // parameters for polygons scans convert
   double range_ = 120.0;
@@ -65,9 +77,21 @@ class HdmapROIFilter : public BaseROIFilter {
   double extend_dist_ = 0.0;
   bool no_edge_table_ = false;
   bool set_roi_service_ = false;
+  // the bitmap covers cache_margin_ more than range_ on each side, and is
+  // reused while the vehicle moves less than that and the map polygons do
+  // not change
+  double cache_margin_ = 0.0;
   std::vector<base::PolygonDType*> polygons_world_;
   std::vector<base::PolygonDType> polygons_local_;
   Bitmap2D bitmap_;
+  // world position of the bitmap center
+  Eigen::Vector2d bitmap_anchor_ = Eigen::Vector2d::Zero();
+  size_t bitmap_polygons_signature_ = 0;
+  bool bitmap_valid_ = false;
+  // whether the roi service holds the current bitmap
+  bool bitmap_published_ = false;
+  base::SoAPointCloud<float> cloud_local_;
+  std::vector<uint8_t> points_in_bitmap_;
   ROIServiceContent roi_service_content_;
 
   // unit tests only
@@ -81,6 +81,15 @@ TEST(hdmap_roi_filter_bitmap2d_test, test_bitmap) {
   EXPECT_FALSE(bitmap.IsExists(Eigen::Vector2d(80.0, 80.0)));
   EXPECT_TRUE(bitmap.IsExists(Eigen::Vector2d(1.0, 1.0)));
 
+  // batched check
+  bitmap.Set(Eigen::Vector2d(0.2, 1.2));
+  bitmap.Set(Eigen::Vector2d(65.5, 10.5));
+  const std::vector<float> xs = {0.2f, 65.5f, 1.2f, -1.0f, 80.0f};
+  const std::vector<float> ys = {1.2f, 10.5f, 0.2f, 1.2f, 10.5f};
+  std::vector<uint8_t> is_set(xs.size());
+  bitmap.Check(xs.data(), ys.data(), xs.size(), is_set.data());
+  EXPECT_EQ(is_set, std::vector<uint8_t>({1, 1, 0, 0, 0}));
+
   AINFO << bitmap;
 }
 
@@ -39,7 +39,9 @@ bool ROIServiceFilter::Filter(const ROIFilterOptions& options,
     AERROR << "Frame is nullptr.";
     return false;
   }
-  roi_service_->GetServiceContentCopy(&roi_service_content_);
+  // the shared content is copied only when updated since the last frame
+  roi_service_->GetServiceContentCopy(&roi_service_content_,
+                                      &roi_service_version_);
   if (!roi_service_content_.IsServiceReady()) {
     AERROR << "service is not ready.";
     return false;
@@ -192,6 +192,32 @@ TEST_F(LidarLibSceneManagerTest, lidar_lib_scene_manager_ground_service_test) {
   }
 }
 
+TEST_F(LidarLibSceneManagerTest, lidar_lib_scene_service_version_test) {
+  EXPECT_TRUE(SceneManager::Instance().Init());
+  auto ground_service = SceneManager::Instance().Service("GroundService");
+  ASSERT_NE(ground_service.get(), nullptr);
+
+  // nothing is copied while the reader is up to date
+  uint64_t version = ground_service->GetServiceContentVersion();
+  GroundServiceContent reader_content;
+  EXPECT_FALSE(ground_service->GetServiceContentCopy(&reader_content,
+                                                     &version));
+  EXPECT_EQ(reader_content.rows_, 0);
+
+  GroundServiceContent writer_content;
+  writer_content.Init(120.0, 120.0, 8, 8);
+  ground_service->UpdateServiceContent(writer_content);
+  EXPECT_EQ(ground_service->GetServiceContentVersion(), version + 1);
+
+  EXPECT_TRUE(ground_service->GetServiceContentCopy(&reader_content,
+                                                    &version));
+  EXPECT_EQ(version, ground_service->GetServiceContentVersion());
+  EXPECT_EQ(reader_content.rows_, 8);
+  EXPECT_TRUE(reader_content.IsServiceReady());
+  EXPECT_FALSE(ground_service->GetServiceContentCopy(&reader_content,
+                                                     &version));
+}
+
 void MockData(LidarFrame* frame) {
   std::string pcd =
       "/apollo/modules/perception/testdata/lidar/lib/scene_manager/data/"
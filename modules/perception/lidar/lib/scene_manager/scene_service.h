@@ -15,7 +15,9 @@
  *****************************************************************************/
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "cyber/common/macros.h"
@@ -75,15 +77,38 @@ class SceneService {
     std::lock_guard<std::mutex> lock(mutex_);
     self_content_->GetCopy(content);
   }
+  // @brief: get a copy of service content only if it was updated since the
+  //         given version, so that readers sharing the service across lidar
+  //         pipelines do not copy it every frame
+  // @param [out]: service content, untouched if already up to date
+  // @param [in/out]: version of the content, set to the copied version
+  // @return: whether the content was copied
+  bool GetServiceContentCopy(SceneServiceContent* content, uint64_t* version) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (*version == version_) {
+      return false;
+    }
+    self_content_->GetCopy(content);
+    *version = version_;
+    return true;
+  }
   // @brief: update service content from copy
   // @param [in]: service content
   void UpdateServiceContent(const SceneServiceContent& content) {
     std::lock_guard<std::mutex> lock(mutex_);
     self_content_->SetContent(content);
+    ++version_;
+  }
+  // @brief: get version of service content, bumped by every update
+  // @return: version, 0 before the first update
+  uint64_t GetServiceContentVersion() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return version_;
   }
 
  protected:
   SceneServiceContentPtr self_content_;
+  uint64_t version_ = 0;
   std::mutex mutex_;
 
  private:
@@ -61,8 +61,6 @@ bool CNNSegmentation::Init(const SegmentationInitOptions& options) {
   range_ = feature_param.point_cloud_range();
   width_ = feature_param.width();
   height_ = feature_param.height();
-  min_height_ = feature_param.min_height();
-  max_height_ = feature_param.max_height();
 
   // init inference model
   const NetworkParam& network_param = cnnseg_param_.network_param();
@@ -150,6 +148,7 @@ bool CNNSegmentation::InitClusterAndBackgroundSegmentation() {
   SppParams params;
   params.height_gap = spp_engine_config_.height_gap();
   params.confidence_range = cnnseg_param_.confidence_range();
+  params.num_threads = spp_engine_config_.num_threads();
 
   // init spp data
   auto& spp_data = spp_engine_.GetSppData();
@@ -221,31 +220,6 @@ bool CNNSegmentation::InitClusterAndBackgroundSegmentation() {
   return true;
 }
 
-void CNNSegmentation::MapPointToGrid(
-    const std::shared_ptr<AttributePointCloud<PointF>>& pc_ptr) {
-  float inv_res_x = 0.5f * static_cast<float>(width_) / range_;
-  // float inv_res_y = 0.5 * static_cast<float>(height_) / range_;
-  point2grid_.assign(pc_ptr->size(), -1);
-  int pos_x = -1;
-  int pos_y = -1;
-  for (size_t i = 0; i < pc_ptr->size(); ++i) {
-    const auto& pt = pc_ptr->at(i);
-    if (pt.z <= min_height_ || pt.z >= max_height_) {
-      continue;
-    }
-    // the coordinates of x and y are exchanged here
-    // (row <-> x, column <-> y)
-    // int pos_x = F2I(pt.y, range_, inv_res_x);  // col
-    // int pos_y = F2I(pt.x, range_, inv_res_y);  // row
-    // 2018.6.21, switch to axis rotated projection
-    GroupPc2Pixel(pt.x, pt.y, inv_res_x, range_, &pos_x, &pos_y);
-    if (pos_y < 0 || pos_y >= height_ || pos_x < 0 || pos_x >= width_) {
-      continue;
-    }
-    point2grid_[i] = pos_y * width_ + pos_x;
-  }
-}
-
 bool CNNSegmentation::Segment(const SegmentationOptions& options,
                               LidarFrame* frame) {
   // check input
@@ -280,17 +254,13 @@ bool CNNSegmentation::Segment(const SegmentationOptions& options,
 
   // note we should use origninal cloud here, frame->cloud may be exchanged
   Timer timer;
-  // map 3d points to 2d image grids
-  MapPointToGrid(original_cloud_);
-  mapping_time_ = timer.toc(true);
-
   if (cudaSetDevice(gpu_id_) != cudaSuccess) {
     AERROR << "Failed to set device to " << gpu_id_;
     return false;
   }
 
-  // generate features
-  feature_generator_->Generate(original_cloud_, point2grid_);
+  // map 3d points to 2d image grids and generate features
+  feature_generator_->MapAndGenerate(original_cloud_, &point2grid_);
   feature_time_ = timer.toc(true);
 
   // model inference
@@ -300,8 +270,7 @@ bool CNNSegmentation::Segment(const SegmentationOptions& options,
   // processing clustering
   GetObjectsFromSppEngine(&frame->segmented_objects);
 
-  AINFO << "CNNSEG: mapping: " << mapping_time_ << "\t"
-        << " feature: " << feature_time_ << "\t"
+  AINFO << "CNNSEG: feature: " << feature_time_ << "\t"
         << " infer: " << infer_time_ << "\t"
         << " fg-seg: " << fg_seg_time_ << "\t"
         << " join: " << join_time_ << "\t"
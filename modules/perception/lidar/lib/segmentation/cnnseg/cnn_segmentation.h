@@ -59,9 +59,6 @@ class CNNSegmentation : public BaseSegmentation {
   void GetObjectsFromSppEngine(
       std::vector<std::shared_ptr<base::Object>>* objects);
 
-  void MapPointToGrid(
-      const std::shared_ptr<base::AttributePointCloud<base::PointF>>& pc_ptr);
-
   CNNSegParam cnnseg_param_;
   std::shared_ptr<inference::Inference> inference_;
   std::shared_ptr<FeatureGenerator> feature_generator_;
@@ -80,8 +77,6 @@ class CNNSegmentation : public BaseSegmentation {
   float range_ = 0.f;
   int width_ = 0;
   int height_ = 0;
-  float min_height_ = 0.f;
-  float max_height_ = 0.f;
 
   // 1-d index in feature map of each point
   std::vector<int> point2grid_;
@@ -108,7 +103,6 @@ class CNNSegmentation : public BaseSegmentation {
   int gpu_id_ = -1;
 
   // time statistics
-  double mapping_time_ = 0.0;
   double feature_time_ = 0.0;
   double infer_time_ = 0.0;
   double join_time_ = 0.0;
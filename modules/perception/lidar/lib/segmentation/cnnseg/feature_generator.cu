@@ -157,8 +157,80 @@ __global__ void SetKernel(const int n, const Dtype alpha, Dtype* y) {
   }
 }
 
+// same projection as GroupPc2Pixel
+__global__ void MapPointToGridKernel(const int n, const base::PointF* pc,
+                                     const float range, const float inv_res,
+                                     const float min_height,
+                                     const float max_height, const int width,
+                                     const int height, int* point2grid) {
+  CUDA_KERNEL_LOOP(i, n) {
+    point2grid[i] = -1;
+    float pz = pc[i].z;
+    if (pz <= min_height || pz >= max_height) {
+      continue;
+    }
+    float fx = (range - (0.707107f * (pc[i].x + pc[i].y))) * inv_res;
+    float fy = (range - (0.707107f * (pc[i].x - pc[i].y))) * inv_res;
+    int pos_x = fx < 0 ? -1 : static_cast<int>(fx);
+    int pos_y = fy < 0 ? -1 : static_cast<int>(fy);
+    if (pos_y < 0 || pos_y >= height || pos_x < 0 || pos_x >= width) {
+      continue;
+    }
+    point2grid[i] = pos_y * width + pos_x;
+  }
+}
+
 void FeatureGenerator::GenerateGPU(const base::PointFCloudPtr& pc_ptr,
                        const std::vector<int>& point2grid) {
+  UploadCloudGPU(pc_ptr);
+  BASE_CUDA_CHECK(cudaMemcpy(point2grid_gpu_, point2grid.data(),
+                 sizeof(int) * pc_ptr->size(), cudaMemcpyHostToDevice));
+  ComputeFeaturesGPU(static_cast<int>(pc_ptr->size()));
+}
+
+void FeatureGenerator::MapAndGenerateGPU(const base::PointFCloudPtr& pc_ptr,
+                                         std::vector<int>* point2grid) {
+  int cloud_size = static_cast<int>(pc_ptr->size());
+  point2grid->resize(cloud_size);
+  if (cloud_size == 0) {
+    ComputeFeaturesGPU(0);
+    return;
+  }
+  UploadCloudGPU(pc_ptr);
+  {
+    float inv_res = 0.5f * static_cast<float>(width_) / range_;
+    int block_size = (cloud_size + kGPUThreadSize - 1) / kGPUThreadSize;
+    MapPointToGridKernel<<<block_size, kGPUThreadSize>>>(cloud_size, pc_gpu_,
+          range_, inv_res, min_height_, max_height_, width_, height_,
+          point2grid_gpu_);
+  }
+  ComputeFeaturesGPU(cloud_size);
+  // the only copy back to the host, the clustering reads point2grid
+  BASE_CUDA_CHECK(cudaMemcpy(point2grid->data(), point2grid_gpu_,
+                 sizeof(int) * cloud_size, cudaMemcpyDeviceToHost));
+}
+
+void FeatureGenerator::UploadCloudGPU(const base::PointFCloudPtr& pc_ptr) {
+  size_t cloud_size = pc_ptr->size();
+  if (cloud_size > pc_gpu_size_) {
+    // cloud data
+    BASE_CUDA_CHECK(cudaFree(pc_gpu_));
+    BASE_CUDA_CHECK(cudaMalloc(reinterpret_cast<void **>(&pc_gpu_),
+                    cloud_size * sizeof(base::PointF)));
+    pc_gpu_size_ = cloud_size;
+    // point2grid
+    BASE_CUDA_CHECK(cudaFree(point2grid_gpu_));
+    BASE_CUDA_CHECK(cudaMalloc(reinterpret_cast<void **>(&point2grid_gpu_),
+                    cloud_size * sizeof(int)));
+  }
+  if (cloud_size > 0) {
+    BASE_CUDA_CHECK(cudaMemcpy(pc_gpu_, &(pc_ptr->front()),
+                   sizeof(base::PointF) * cloud_size,
+                   cudaMemcpyHostToDevice));
+  }
+}
+
+void FeatureGenerator::ComputeFeaturesGPU(const int cloud_size) {
   // fill initial value for feature blob
   int map_size = width_ * height_;
   int block_size = (map_size + kGPUThreadSize - 1) / kGPUThreadSize;
@@ -177,29 +249,8 @@ void FeatureGenerator::GenerateGPU(const base::PointFCloudPtr& pc_ptr,
                                sizeof(float) * map_size));
   }
 
-  // copy cloud data and point2grid from CPU to GPU memory
-  size_t cloud_size = pc_ptr->size();
-  if (cloud_size > pc_gpu_size_) {
-    // cloud data
-    BASE_CUDA_CHECK(cudaFree(pc_gpu_));
-    BASE_CUDA_CHECK(cudaMalloc(reinterpret_cast<void **>(&pc_gpu_),
-                    cloud_size * sizeof(base::PointF)));
-    pc_gpu_size_ = cloud_size;
-    // point2grid
-    BASE_CUDA_CHECK(cudaFree(point2grid_gpu_));
-    BASE_CUDA_CHECK(cudaMalloc(reinterpret_cast<void **>(&point2grid_gpu_),
-                    cloud_size * sizeof(int)));
-  }
-  BASE_CUDA_CHECK(cudaMemcpy(pc_gpu_, &(pc_ptr->front()),
-                 sizeof(base::PointF) * cloud_size,
-                 cudaMemcpyHostToDevice));
-  BASE_CUDA_CHECK(cudaMemcpy(point2grid_gpu_, point2grid.data(),
-                 sizeof(int) * cloud_size, cudaMemcpyHostToDevice));
-
   // compute features
-  // float inv_res_x = 0.5 * width_ / range_;
-  // float inv_res_y = 0.5 * height_ / range_;
-  {
+  if (cloud_size > 0) {
     int block_size = (cloud_size + kGPUThreadSize - 1) / kGPUThreadSize;
     MapKernel<float><<<block_size, kGPUThreadSize>>>(cloud_size, pc_gpu_,
           max_height_data_, mean_height_data_, mean_intensity_data_,
@@ -59,14 +59,36 @@ class FeatureGenerator {
 #endif
   }
 
+  // maps the points to the grids of the feature map and generates the
+  // features. point2grid is the grid index of each point, -1 for the points
+  // out of the map or of the height range. With cuda, the cloud is copied
+  // to the device once and only point2grid is copied back.
+  void MapAndGenerate(const base::PointFCloudPtr& pc_ptr,
+                      std::vector<int>* point2grid) {
+#ifndef PERCEPTION_CPU_ONLY
+    MapAndGenerateGPU(pc_ptr, point2grid);
+#else
+    MapPointToGrid(pc_ptr, point2grid);
+    GenerateCPU(pc_ptr, *point2grid);
+#endif
+  }
+
   inline std::string Name() const { return "FeatureGenerator"; }
 
  private:
 #ifndef PERCEPTION_CPU_ONLY
   void GenerateGPU(const base::PointFCloudPtr& pc_ptr,
                    const std::vector<int>& point2grid);
+  void MapAndGenerateGPU(const base::PointFCloudPtr& pc_ptr,
+                         std::vector<int>* point2grid);
+  // copies the cloud to pc_gpu_, growing the device buffers if needed
+  void UploadCloudGPU(const base::PointFCloudPtr& pc_ptr);
+  // computes the features of the cloud in pc_gpu_ with point2grid_gpu_
+  void ComputeFeaturesGPU(const int cloud_size);
   void ReleaseGPUMemory();
 #endif
+  void MapPointToGrid(const base::PointFCloudPtr& pc_ptr,
+                      std::vector<int>* point2grid) const;
   void GenerateCPU(const base::PointFCloudPtr& pc_ptr,
                    const std::vector<int>& point2grid);
 
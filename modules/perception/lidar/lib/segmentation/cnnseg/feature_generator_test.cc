@@ -214,6 +214,19 @@ TEST_F(FeatureGeneratorTest, basic_test) {
     EXPECT_TRUE(generator_->mean_intensity_data_ == nullptr);
     EXPECT_TRUE(generator_->top_intensity_data_ == nullptr);
   }
+  // mapping on gpu matches the mapping on cpu
+  {
+    generator_.reset(new FeatureGenerator);
+    base::Blob<float> feature_blob;
+    param.set_use_intensity_feature(true);
+    feature_blob.Reshape(1, 8, param.height(), param.width());
+    EXPECT_TRUE(generator_->Init(param, &feature_blob));
+    std::vector<int> cpu_point2grid;
+    generator_->MapPointToGrid(pc_ptr, &cpu_point2grid);
+    std::vector<int> gpu_point2grid;
+    generator_->MapAndGenerateGPU(pc_ptr, &gpu_point2grid);
+    EXPECT_EQ(gpu_point2grid, cpu_point2grid);
+  }
 }
 
 }  // namespace lidar
@@ -13,11 +13,15 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  *****************************************************************************/
+#include "modules/perception/lidar/lib/segmentation/cnnseg/spp_engine/spp_engine.h"
+
+#include <algorithm>
+#include <future>
 
+#include "cyber/task/task.h"
 #include "modules/perception/base/object_pool_types.h"
 #include "modules/perception/lidar/common/lidar_log.h"
 #include "modules/perception/lidar/common/lidar_timer.h"
-#include "modules/perception/lidar/lib/segmentation/cnnseg/spp_engine/spp_engine.h"
 
 namespace apollo {
 namespace perception {
@@ -26,6 +30,7 @@ namespace lidar {
 void SppEngine::Init(size_t width, size_t height, float range,
                      const SppParams& param, const std::string& sensor_name) {
   // initialize connect component detector
+  detector_2d_cc_.SetNumThreads(param.num_threads);
   detector_2d_cc_.Init(static_cast<int>(height),
                        static_cast<int>(width));
   detector_2d_cc_.SetData(data_.obs_prob_data_ref, data_.offset_data,
@@ -89,24 +94,16 @@ size_t SppEngine::ProcessConnectedComponentCluster(
   // first sync between cluster list and label image,
   // and they shared the same cluster pointer
   clusters_ = labels_2d_;
-  for (size_t i = 0; i < point_cloud->size(); ++i) {
-    if (mask.size() && mask[static_cast<int>(i)] == 0) {
-      continue;
-    }
-    // out of range
-    const int& id = data_.grid_indices[i];
-    if (id < 0) {
-      continue;
-    }
-    const auto& point = point_cloud->at(i);
-    const uint16_t& label = labels_2d_[0][id];
-    if (!label) {
-      continue;
-    }
-    if (point.z <=
-        labels_2d_.GetCluster(label - 1)->top_z + data_.top_z_threshold) {
-      clusters_.AddPointSample(label - 1, point, point_cloud->points_height(i),
-                               static_cast<uint32_t>(i));
+  if (params_.num_threads > 1) {
+    MapPointsToClustersInBlocks(point_cloud, mask);
+  } else {
+    for (size_t i = 0; i < point_cloud->size(); ++i) {
+      const uint16_t label = GetPointLabel(point_cloud, mask, i);
+      if (label) {
+        clusters_.AddPointSample(label - 1, point_cloud->at(i),
+                                 point_cloud->points_height(i),
+                                 static_cast<uint32_t>(i));
+      }
     }
   }
   double mapping_time = timer.toc(true);
@@ -122,6 +119,95 @@ size_t SppEngine::ProcessConnectedComponentCluster(
   return clusters_.size();
 }
 
+uint16_t SppEngine::GetPointLabel(
+    const base::PointFCloudConstPtr& point_cloud, const CloudMask& mask,
+    size_t id) const {
+  if (mask.size() && mask[static_cast<int>(id)] == 0) {
+    return 0;
+  }
+  // out of range
+  const int& grid_id = data_.grid_indices[id];
+  if (grid_id < 0) {
+    return 0;
+  }
+  const uint16_t& label = labels_2d_[0][grid_id];
+  if (!label) {
+    return 0;
+  }
+  if (point_cloud->at(id).z >
+      labels_2d_.GetCluster(label - 1)->top_z + data_.top_z_threshold) {
+    return 0;
+  }
+  return label;
+}
+
+void SppEngine::MapPointsToClustersInBlocks(
+    const base::PointFCloudConstPtr point_cloud, const CloudMask& mask) {
+  const size_t size = point_cloud->size();
+  const size_t num_clusters = clusters_.size();
+  const size_t num_blocks = std::max<size_t>(
+      std::min(static_cast<size_t>(params_.num_threads), size), 1);
+  point_labels_.resize(size);
+  block_offsets_.resize(num_blocks);
+  // 1. label the points and count them per block and cluster
+  ForEachPointBlock(size, num_blocks,
+                    [&](size_t block, size_t begin, size_t end) {
+    std::vector<size_t>& counts = block_offsets_[block];
+    counts.assign(num_clusters, 0);
+    for (size_t i = begin; i < end; ++i) {
+      point_labels_[i] = GetPointLabel(point_cloud, mask, i);
+      if (point_labels_[i]) {
+        ++counts[point_labels_[i] - 1];
+      }
+    }
+  });
+  // 2. turn the counts into write offsets, each cluster is resized once and
+  // keeps the point order of the serial mapping
+  for (size_t n = 0; n < num_clusters; ++n) {
+    SppCluster* cluster = clusters_[static_cast<int>(n)].get();
+    size_t offset = cluster->points.size();
+    for (size_t block = 0; block < num_blocks; ++block) {
+      const size_t count = block_offsets_[block][n];
+      block_offsets_[block][n] = offset;
+      offset += count;
+    }
+    cluster->points.resize(offset);
+    cluster->point_ids.resize(offset);
+  }
+  // 3. fill the clusters, the blocks write to disjoint ranges
+  ForEachPointBlock(size, num_blocks,
+                    [&](size_t block, size_t begin, size_t end) {
+    std::vector<size_t>& offsets = block_offsets_[block];
+    for (size_t i = begin; i < end; ++i) {
+      const uint16_t label = point_labels_[i];
+      if (!label) {
+        continue;
+      }
+      SppCluster* cluster = clusters_[label - 1].get();
+      const size_t offset = offsets[label - 1]++;
+      cluster->points[offset] =
+          SppPoint(point_cloud->at(i), point_cloud->points_height(i));
+      cluster->point_ids[offset] = static_cast<uint32_t>(i);
+    }
+  });
+}
+
+void SppEngine::ForEachPointBlock(
+    size_t size, size_t num_blocks,
+    const std::function<void(size_t, size_t, size_t)>& func) {
+  const size_t block_size = (size + num_blocks - 1) / num_blocks;
+  std::vector<std::future<void>> results;
+  results.reserve(num_blocks);
+  for (size_t block = 1; block * block_size < size; ++block) {
+    results.push_back(cyber::Async(func, block, block * block_size,
+                                   std::min((block + 1) * block_size, size)));
+  }
+  func(0, 0, std::min(block_size, size));
+  for (auto& result : results) {
+    result.get();
+  }
+}
+
 size_t SppEngine::ProcessForegroundSegmentation(
     const base::PointFCloudConstPtr point_cloud) {
   mask_.clear();
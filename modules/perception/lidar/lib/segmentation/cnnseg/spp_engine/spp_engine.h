@@ -15,7 +15,9 @@
  *****************************************************************************/
 #pragma once
 
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "Eigen/Dense"
 
@@ -72,6 +74,26 @@ class SppEngine {
   // @param [in]: point cloud mask
   size_t ProcessConnectedComponentCluster(
       const base::PointFCloudConstPtr point_cloud, const CloudMask& mask);
+  // @brief: label of a point given the label image
+  // @param [in]: point cloud
+  // @param [in]: point cloud mask
+  // @param [in]: point id
+  // @return: label of the point, zero if it belongs to no cluster
+  uint16_t GetPointLabel(const base::PointFCloudConstPtr& point_cloud,
+                         const CloudMask& mask, size_t id) const;
+  // @brief: add the labeled points to the clusters in point blocks, each
+  // block writes to its own part of the clusters
+  // @param [in]: point cloud
+  // @param [in]: point cloud mask
+  void MapPointsToClustersInBlocks(const base::PointFCloudConstPtr point_cloud,
+                                   const CloudMask& mask);
+  // @brief: run func(block id, begin, end) on the point blocks, one block
+  // in the calling thread and the others in tasks
+  // @param [in]: point number
+  // @param [in]: block number
+  void ForEachPointBlock(
+      size_t size, size_t num_blocks,
+      const std::function<void(size_t, size_t, size_t)>& func);
 
  private:
   // feature size
@@ -93,6 +115,9 @@ class SppEngine {
   SppData data_;
   // thread worker for sync data
   lib::ThreadWorker worker_;
+  // label of each point and write offsets of each point block
+  std::vector<uint16_t> point_labels_;
+  std::vector<std::vector<size_t>> block_offsets_;
 };
 
 }  // namespace lidar
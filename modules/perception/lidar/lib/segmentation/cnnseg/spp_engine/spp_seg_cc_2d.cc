@@ -13,11 +13,15 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  *****************************************************************************/
+#include "modules/perception/lidar/lib/segmentation/cnnseg/spp_engine/spp_seg_cc_2d.h"
+
 #include <algorithm>
+#include <future>
+#include <numeric>
 
+#include "cyber/task/task.h"
 #include "modules/perception/lidar/common/lidar_log.h"
 #include "modules/perception/lidar/common/lidar_timer.h"
-#include "modules/perception/lidar/lib/segmentation/cnnseg/spp_engine/spp_seg_cc_2d.h"
 
 namespace apollo {
 namespace perception {
@@ -73,7 +77,13 @@ size_t SppCCDetector::Detect(SppLabelImage* labels) {
     worker_.Join();  // sync for cleaning nodes
   }
   first_process_ = false;
-  BuildNodes(0, rows_);
+  if (num_threads_ > 1) {
+    ForEachRowBlock([this](int, int start_row_index, int end_row_index) {
+      BuildNodes(start_row_index, end_row_index);
+    });
+  } else {
+    BuildNodes(0, rows_);
+  }
   double init_time = timer.toc(true);
 
   double sync_time = timer.toc(true);
@@ -81,7 +91,11 @@ size_t SppCCDetector::Detect(SppLabelImage* labels) {
   TraverseNodes();
   double traverse_time = timer.toc(true);
 
-  UnionNodes();
+  if (num_threads_ > 1) {
+    UnionNodesInBlocks();
+  } else {
+    UnionNodes();
+  }
   double union_time = timer.toc(true);
 
   size_t num = ToLabelMap(labels);
@@ -146,6 +160,124 @@ void SppCCDetector::UnionNodes() {
   }
 }
 
+void SppCCDetector::ForEachRowBlock(
+    const std::function<void(int, int, int)>& func) {
+  const int num_blocks = std::max(std::min(num_threads_, rows_), 1);
+  const int block_rows = (rows_ + num_blocks - 1) / num_blocks;
+  std::vector<std::future<void>> results;
+  results.reserve(num_blocks);
+  for (int block = 1; block * block_rows < rows_; ++block) {
+    results.push_back(cyber::Async(func, block, block * block_rows,
+                                   std::min((block + 1) * block_rows, rows_)));
+  }
+  func(0, 0, std::min(block_rows, rows_));
+  for (auto& result : results) {
+    result.get();
+  }
+}
+
+void SppCCDetector::UnionNodesInBlocks() {
+  center_roots_.resize(static_cast<size_t>(rows_ * cols_));
+  block_pairs_.resize(num_threads_);
+  // 1. union inside the blocks, the pairs crossing a block are kept
+  ForEachRowBlock([this](int block, int start_row_index, int end_row_index) {
+    block_pairs_[block].clear();
+    UnionBlockNodes(start_row_index, end_row_index, &block_pairs_[block]);
+  });
+  // 2. merge the blocks, there are only a few pairs along the boundaries
+  for (const auto& pairs : block_pairs_) {
+    for (const auto& pair : pairs) {
+      UnionCenterRoots(pair.first, pair.second);
+    }
+  }
+  // 3. point the center nodes to their roots, as UnionNodes would
+  ForEachRowBlock([this](int, int start_row_index, int end_row_index) {
+    const uint32_t end = static_cast<uint32_t>(end_row_index * cols_);
+    for (uint32_t i = static_cast<uint32_t>(start_row_index * cols_); i < end;
+         ++i) {
+      Node* node = nodes_[0] + i;
+      if (!node->is_center()) {
+        continue;
+      }
+      // no path compression, the roots are shared between the blocks
+      uint32_t root = i;
+      while (center_roots_[root] != root) {
+        root = center_roots_[root];
+      }
+      node->parent = root;
+    }
+  });
+}
+
+void SppCCDetector::UnionBlockNodes(
+    int start_row_index, int end_row_index,
+    std::vector<std::pair<uint32_t, uint32_t>>* pairs) {
+  const uint32_t start = static_cast<uint32_t>(start_row_index * cols_);
+  const uint32_t end = static_cast<uint32_t>(end_row_index * cols_);
+  std::iota(center_roots_.begin() + start, center_roots_.begin() + end, start);
+  const uint32_t cols = static_cast<uint32_t>(cols_);
+  for (int row = start_row_index; row < end_row_index; ++row) {
+    for (int col = 0; col < cols_; ++col) {
+      const uint32_t i = static_cast<uint32_t>(row * cols_ + col);
+      Node* node = nodes_[0] + i;
+      if (!node->is_center()) {
+        continue;
+      }
+      // the nodes of a center loop are one object, traversing set their
+      // parent to the same node, which may lie in another block
+      if (node->parent != i) {
+        if (node->parent >= start && node->parent < end) {
+          UnionCenterRoots(i, node->parent);
+        } else {
+          pairs->emplace_back(i, node->parent);
+        }
+      }
+      // left, the right neighbor of UnionNodes
+      if (col > 0 && nodes_[0][i - 1].is_center()) {
+        UnionCenterRoots(i, i - 1);
+      }
+      if (row == 0) {
+        continue;
+      }
+      // up, up left and up right, the down neighbors of UnionNodes
+      const int min_col = std::max(col - 1, 0);
+      const int max_col = std::min(col + 1, cols_ - 1);
+      for (int up_col = min_col; up_col <= max_col; ++up_col) {
+        const uint32_t up = i - cols + up_col - col;
+        if (!nodes_[0][up].is_center()) {
+          continue;
+        }
+        if (row > start_row_index) {
+          UnionCenterRoots(i, up);
+        } else {
+          pairs->emplace_back(i, up);
+        }
+      }
+    }
+  }
+}
+
+uint32_t SppCCDetector::FindCenterRoot(uint32_t x) {
+  while (center_roots_[x] != x) {
+    // path halving
+    center_roots_[x] = center_roots_[center_roots_[x]];
+    x = center_roots_[x];
+  }
+  return x;
+}
+
+void SppCCDetector::UnionCenterRoots(uint32_t x, uint32_t y) {
+  x = FindCenterRoot(x);
+  y = FindCenterRoot(y);
+  // link to the smaller index, so that the roots do not depend on the
+  // order of the unions
+  if (x < y) {
+    center_roots_[y] = x;
+  } else if (y < x) {
+    center_roots_[x] = y;
+  }
+}
+
 size_t SppCCDetector::ToLabelMap(SppLabelImage* labels) {
   uint16_t id = 0;
   uint32_t pixel_id = 0;
@@ -15,6 +15,9 @@
  *****************************************************************************/
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <utility>
 #include <vector>
 
 #include "modules/perception/common/i_lib/core/i_alloc.h"
@@ -48,6 +51,12 @@ class SppCCDetector {
     }
     CleanNodes();
   }
+  // @brief: set the number of row blocks processed in parallel, one keeps
+  // the serial union of center nodes
+  // @param [in]: number of threads
+  void SetNumThreads(int num_threads) {
+    num_threads_ = std::max(num_threads, 1);
+  }
   // @brief: set data for clusterin
   // @param [in]: probability map
   // @param [in]: center offset map
@@ -70,6 +79,26 @@ class SppCCDetector {
   void TraverseNodes();
   // @brief: union adjacent nodes
   void UnionNodes();
+  // @brief: union adjacent center nodes in row blocks in parallel, then
+  // merge the blocks and point every center node to its root
+  void UnionNodesInBlocks();
+  // @brief: union adjacent center nodes given start and end row index,
+  // only the roots of the nodes in these rows are touched
+  // @param [in]: start row index, inclusive
+  // @param [in]: end row index, exclusive
+  // @param [out]: pairs of center nodes left to union across blocks
+  void UnionBlockNodes(int start_row_index, int end_row_index,
+                       std::vector<std::pair<uint32_t, uint32_t>>* pairs);
+  // @brief: run func(block id, start row index, end row index) on the
+  // row blocks, one block in the calling thread and the others in tasks
+  void ForEachRowBlock(const std::function<void(int, int, int)>& func);
+  // @brief: find root of a center node in the block union-find
+  // @param [in]: node index
+  // @return: root node index
+  uint32_t FindCenterRoot(uint32_t x);
+  // @brief: union of two center nodes in the block union-find
+  // @param [in]: node indices
+  void UnionCenterRoots(uint32_t x, uint32_t y);
   // @brief: collect clusters to label map
   size_t ToLabelMap(SppLabelImage* labels);
   // @brief: clean node matrix
@@ -144,6 +173,12 @@ class SppCCDetector {
   lib::ThreadWorker worker_;
   bool first_process_ = true;
 
+  int num_threads_ = 1;
+  // union-find of the center nodes in the parallel union, a root always
+  // lies in the same row block as its nodes before the blocks are merged
+  std::vector<uint32_t> center_roots_;
+  std::vector<std::vector<std::pair<uint32_t, uint32_t>>> block_pairs_;
+
  private:
   static const size_t kDefaultReserveSize = 500;
 };  // class SppCCDetector
@@ -0,0 +1,74 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/lidar/lib/segmentation/cnnseg/spp_engine/spp_seg_cc_2d.h"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace lidar {
+
+TEST(SppCCDetectorTest, parallel_union_test) {
+  const int rows = 97;
+  const int cols = 64;
+  const int size = rows * cols;
+  std::vector<float> prob(size);
+  std::vector<float> offset(2 * size);
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> prob_dist(0.f, 1.f);
+  std::uniform_real_distribution<float> offset_dist(-3.f, 3.f);
+  for (auto& value : prob) {
+    value = prob_dist(rng);
+  }
+  for (auto& value : offset) {
+    value = offset_dist(rng);
+  }
+  const float* prob_map[] = {prob.data()};
+
+  SppCCDetector serial_detector;
+  serial_detector.Init(rows, cols);
+  serial_detector.SetData(prob_map, offset.data(), 1.f, 0.5f);
+  SppLabelImage serial_labels;
+  serial_labels.Init(cols, rows);
+  size_t serial_num = serial_detector.Detect(&serial_labels);
+  EXPECT_GT(serial_num, 0);
+
+  for (int num_threads : {2, 3, 8}) {
+    SppCCDetector detector;
+    detector.SetNumThreads(num_threads);
+    detector.Init(rows, cols);
+    detector.SetData(prob_map, offset.data(), 1.f, 0.5f);
+    SppLabelImage labels;
+    labels.Init(cols, rows);
+    EXPECT_EQ(detector.Detect(&labels), serial_num);
+    for (int row = 0; row < rows; ++row) {
+      for (int col = 0; col < cols; ++col) {
+        EXPECT_EQ(labels[row][col], serial_labels[row][col]);
+      }
+    }
+    for (size_t i = 0; i < serial_num; ++i) {
+      EXPECT_EQ(labels.GetCluster(i)->pixels,
+                serial_labels.GetCluster(i)->pixels);
+    }
+  }
+}
+
+}  // namespace lidar
+}  // namespace perception
+}  // namespace apollo
@@ -58,6 +58,8 @@ struct SppData {
 struct SppParams {
   float height_gap = 0.5f;
   float confidence_range = 58.f;
+  // threads used to label the grid and to fill the clusters
+  int num_threads = 1;
 };
 
 }  // namespace lidar
@@ -113,13 +113,21 @@ bool MlfEngine::Track(const MultiTargetTrackerOptions& options,
   AINFO << "MlfEngine publish objects: " << frame->tracked_objects.size()
         << " sensor_name: " << frame->sensor_info.name
         << " at timestamp: " << std::to_string(frame->timestamp);
+  ADEBUG << "MlfEngine pools, tracked object get/alloc: "
+         << TrackedObjectPool::Instance().get_num() << "/"
+         << TrackedObjectPool::Instance().alloc_num()
+         << " track data get/alloc: " << MlfTrackDataPool::Instance().get_num()
+         << "/" << MlfTrackDataPool::Instance().alloc_num()
+         << " object get/alloc: " << base::ObjectPool::Instance().get_num()
+         << "/" << base::ObjectPool::Instance().alloc_num();
   return true;
 }
 
 void MlfEngine::SplitAndTransformToTrackedObjects(
     const std::vector<base::ObjectPtr>& objects,
     const base::SensorInfo& sensor_info) {
-  std::vector<TrackedObjectPtr> tracked_objects;
+  std::vector<TrackedObjectPtr>& tracked_objects = tracked_objects_buffer_;
+  tracked_objects.clear();
   TrackedObjectPool::Instance().BatchGet(objects.size(), &tracked_objects);
   foreground_objects_.clear();
   background_objects_.clear();
@@ -137,6 +145,7 @@ void MlfEngine::SplitAndTransformToTrackedObjects(
       foreground_objects_.push_back(tracked_objects[i]);
     }
   }
+  tracked_objects.clear();
   AINFO << "MlfEngine: " << sensor_info.name
         << " foreground: " << foreground_objects_.size()
         << " background: " << background_objects_.size();
@@ -146,9 +155,9 @@ void MlfEngine::TrackObjectMatchAndAssign(
     const MlfTrackObjectMatcherOptions& match_options,
     const std::vector<TrackedObjectPtr>& objects, const std::string& name,
     std::vector<MlfTrackDataPtr>* tracks) {
-  std::vector<std::pair<size_t, size_t> > assignments;
-  std::vector<size_t> unassigned_tracks;
-  std::vector<size_t> unassigned_objects;
+  std::vector<std::pair<size_t, size_t>>& assignments = assignments_;
+  std::vector<size_t>& unassigned_tracks = unassigned_tracks_;
+  std::vector<size_t>& unassigned_objects = unassigned_objects_;
   matcher_->Match(match_options, objects, *tracks, &assignments,
                   &unassigned_tracks, &unassigned_objects);
   AINFO << "MlfEngine: " + name + " assignments " << assignments.size()
@@ -171,7 +180,7 @@ void MlfEngine::TrackObjectMatchAndAssign(
 
 void MlfEngine::TrackStateFilter(const std::vector<MlfTrackDataPtr>& tracks,
                                  double frame_timestamp) {
-  std::vector<TrackedObjectPtr> objects;
+  std::vector<TrackedObjectPtr>& objects = cached_objects_buffer_;
   for (auto& track_data : tracks) {
     track_data->GetAndCleanCachedObjectsInTimeInterval(&objects);
     for (auto& obj : objects) {
@@ -181,6 +190,7 @@ void MlfEngine::TrackStateFilter(const std::vector<MlfTrackDataPtr>& tracks,
       tracker_->UpdateTrackDataWithoutObject(frame_timestamp, track_data);
     }
   }
+  objects.clear();
 }
 
 void MlfEngine::CollectTrackedResult(LidarFrame* frame) {
@@ -18,6 +18,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "modules/perception/lidar/lib/interface/base_multi_target_tracker.h"
@@ -92,6 +93,12 @@ class MlfEngine : public BaseMultiTargetTracker {
   // foreground and background tracked objects
   std::vector<TrackedObjectPtr> foreground_objects_;
   std::vector<TrackedObjectPtr> background_objects_;
+  // buffers reused across frames, so that steady frames do not allocate
+  std::vector<TrackedObjectPtr> tracked_objects_buffer_;
+  std::vector<TrackedObjectPtr> cached_objects_buffer_;
+  std::vector<std::pair<size_t, size_t>> assignments_;
+  std::vector<size_t> unassigned_tracks_;
+  std::vector<size_t> unassigned_objects_;
   // tracker
   std::unique_ptr<MlfTracker> tracker_;
   // track object matcher
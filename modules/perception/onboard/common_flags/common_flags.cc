@@ -29,6 +29,10 @@ DEFINE_bool(obs_benchmark_mode, false,
 DEFINE_bool(obs_save_fusion_supplement, false,
             "whether save fusion supplement data, default false");
 DEFINE_bool(start_visualizer, false, "Whether to start visualizer");
+DEFINE_bool(obs_enable_perf_stats, false,
+            "whether to publish the stage timings of each frame");
+DEFINE_string(obs_perf_stats_channel, "/apollo/perception/perf_stats",
+              "channel of the stage timings of each frame");
 
 }  // namespace onboard
 }  // namespace perception
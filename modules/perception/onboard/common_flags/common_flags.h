@@ -27,6 +27,8 @@ DECLARE_string(obs_screen_output_dir);
 DECLARE_bool(obs_benchmark_mode);
 DECLARE_bool(obs_save_fusion_supplement);
 DECLARE_bool(start_visualizer);
+DECLARE_bool(obs_enable_perf_stats);
+DECLARE_string(obs_perf_stats_channel);
 
 }  // namespace onboard
 }  // namespace perception
@@ -15,6 +15,9 @@
  *****************************************************************************/
 #include "modules/perception/onboard/component/fusion_camera_detection_component.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 #include <yaml-cpp/yaml.h>
@@ -181,6 +184,10 @@ bool FusionCameraDetectionComponent::Init() {
   camera_debug_writer_ =
     node_->CreateWriter<apollo::perception::camera::CameraDebug>(
         camera_debug_channel_name_);
+  if (!perf_writer_.Init(node_, "FusionCameraDetectionComponent")) {
+    AERROR << "Init perf writer failed.";
+    return false;
+  }
   if (InitSensorInfo() != cyber::SUCC) {
     AERROR << "InitSensorInfo() failed.";
     return false;
@@ -232,7 +239,130 @@ bool FusionCameraDetectionComponent::Init() {
 void FusionCameraDetectionComponent::OnReceiveImage(
     const std::shared_ptr<apollo::drivers::Image> &message,
     const std::string &camera_name) {
+  if (enable_batch_detection_) {
+    GatherImage(message, camera_name);
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!AcceptImage(message, camera_name)) {
+    return;
+  }
+
+  // protobuf msg
+  std::shared_ptr<apollo::perception::PerceptionObstacles> out_message(
+      new (std::nothrow) apollo::perception::PerceptionObstacles);
+  apollo::common::ErrorCode error_code = apollo::common::OK;
+
+  // prefused msg
+  std::shared_ptr<SensorFrameMessage> prefused_message(new (std::nothrow)
+                                                           SensorFrameMessage);
+
+  perf_writer_.BeginFrame();
+  int ret = InternalProc(message, camera_name, &error_code,
+                         prefused_message.get(), out_message.get());
+  perf_writer_.EndFrame(camera_name, message->measurement_time());
+  WriteOutput(message, camera_name, ret, error_code, prefused_message,
+              out_message);
+}
+
+void FusionCameraDetectionComponent::GatherImage(
+    const std::shared_ptr<apollo::drivers::Image> &message,
+    const std::string &camera_name) {
+  std::vector<ImageTask> tasks;
+  {
+    std::unique_lock<std::mutex> lock(batch_mutex_);
+    // a newer image of the same camera replaces the pending one
+    pending_images_[camera_name] = message;
+    if (batch_leader_waiting_) {
+      batch_cv_.notify_all();
+      return;
+    }
+    // the first image of a batch waits for the images of the other cameras,
+    // but no longer than batch_max_wait_ms_
+    batch_leader_waiting_ = true;
+    batch_cv_.wait_for(
+        lock,
+        std::chrono::microseconds(
+            static_cast<int64_t>(batch_max_wait_ms_ * 1e3)),
+        [this] { return pending_images_.size() >= camera_names_.size(); });
+    for (const auto &pending_image : pending_images_) {
+      ImageTask task;
+      task.camera_name = pending_image.first;
+      task.message = pending_image.second;
+      tasks.push_back(task);
+    }
+    pending_images_.clear();
+    batch_leader_waiting_ = false;
+  }
+  std::sort(tasks.begin(), tasks.end(),
+            [](const ImageTask &lhs, const ImageTask &rhs) {
+              return lhs.message->measurement_time() <
+                     rhs.message->measurement_time();
+            });
+
   std::lock_guard<std::mutex> lock(mutex_);
+  BatchProc(&tasks);
+}
+
+void FusionCameraDetectionComponent::BatchProc(
+    std::vector<ImageTask> *tasks) {
+  perf_writer_.BeginFrame();
+  std::vector<camera::CameraFrame *> frames;
+  for (auto &task : *tasks) {
+    if (!AcceptImage(task.message, task.camera_name)) {
+      task.accepted = false;
+      continue;
+    }
+    task.out_message.reset(
+        new (std::nothrow) apollo::perception::PerceptionObstacles);
+    task.prefused_message.reset(new (std::nothrow) SensorFrameMessage);
+    task.ret = FillCameraFrame(task.message, task.camera_name,
+                               &task.error_code, task.prefused_message.get(),
+                               &task.camera_frame);
+    if (task.ret == cyber::SUCC) {
+      frames.push_back(task.camera_frame);
+    }
+  }
+
+  // one batched detection for the images of all cameras
+  if (!frames.empty() &&
+      !camera_obstacle_pipeline_->Perception(camera_perception_options_,
+                                             frames)) {
+    AERROR << "camera_obstacle_pipeline_->Perception() failed"
+           << " for a batch of " << frames.size() << " images";
+    for (auto &task : *tasks) {
+      if (task.accepted && task.ret == cyber::SUCC) {
+        task.ret = cyber::FAIL;
+        task.error_code = apollo::common::ErrorCode::PERCEPTION_ERROR_PROCESS;
+        task.prefused_message->error_code_ = task.error_code;
+      }
+    }
+  }
+
+  for (auto &task : *tasks) {
+    if (!task.accepted) {
+      continue;
+    }
+    if (task.ret == cyber::SUCC) {
+      task.ret = OutputCameraFrame(task.message, task.camera_name,
+                                   *task.camera_frame, &task.error_code,
+                                   task.prefused_message.get(),
+                                   task.out_message.get());
+    }
+    WriteOutput(task.message, task.camera_name, task.ret, task.error_code,
+                task.prefused_message, task.out_message);
+  }
+  // the stages of a batch are reported once, under the names of its cameras
+  std::string batch_name;
+  for (const auto &task : *tasks) {
+    batch_name += (batch_name.empty() ? "" : ",") + task.camera_name;
+  }
+  perf_writer_.EndFrame(batch_name, tasks->back().message->measurement_time());
+}
+
+bool FusionCameraDetectionComponent::AcceptImage(
+    const std::shared_ptr<apollo::drivers::Image> &message,
+    const std::string &camera_name) {
   const double msg_timestamp = message->measurement_time() + timestamp_offset_;
   AINFO << "Enter FusionCameraDetectionComponent::Proc(), "
         << " camera_name: " << camera_name
@@ -242,7 +372,7 @@ void FusionCameraDetectionComponent::OnReceiveImage(
     AINFO << "Received an old message. Last ts is " << std::setprecision(19)
           << last_timestamp_ << " current ts is " << msg_timestamp
           << " last - current is " << last_timestamp_ - msg_timestamp;
-    return;
+    return false;
   }
   last_timestamp_ = msg_timestamp;
   ++seq_num_;
@@ -256,21 +386,22 @@ void FusionCameraDetectionComponent::OnReceiveImage(
           << GLOG_TIMESTAMP(cur_time) << "]:cur_latency[" << start_latency
           << "]";
   }
+  return true;
+}
 
-  // protobuf msg
-  std::shared_ptr<apollo::perception::PerceptionObstacles> out_message(
-      new (std::nothrow) apollo::perception::PerceptionObstacles);
-  apollo::common::ErrorCode error_code = apollo::common::OK;
-
-  // prefused msg
-  std::shared_ptr<SensorFrameMessage> prefused_message(new (std::nothrow)
-                                                           SensorFrameMessage);
-
-  if (InternalProc(message, camera_name, &error_code, prefused_message.get(),
-                   out_message.get()) != cyber::SUCC) {
+void FusionCameraDetectionComponent::WriteOutput(
+    const std::shared_ptr<apollo::drivers::Image> &message,
+    const std::string &camera_name, int ret,
+    apollo::common::ErrorCode error_code,
+    const std::shared_ptr<SensorFrameMessage> &prefused_message,
+    const std::shared_ptr<apollo::perception::PerceptionObstacles>
+        &out_message) {
+  const double msg_timestamp = message->measurement_time() + timestamp_offset_;
+  if (ret != cyber::SUCC) {
     AERROR << "InternalProc failed, error_code: " << error_code;
-    if (MakeProtobufMsg(msg_timestamp, seq_num_, std::vector<base::ObjectPtr>(),
-                        error_code, out_message.get()) != cyber::SUCC) {
+    if (MakeProtobufMsg(msg_timestamp, prefused_message->seq_num_,
+                        std::vector<base::ObjectPtr>(), error_code,
+                        out_message.get()) != cyber::SUCC) {
       AERROR << "MakeProtobufMsg failed";
       return;
     }
@@ -360,6 +491,13 @@ int FusionCameraDetectionComponent::InitConfig() {
   camera_debug_channel_name_ =
       fusion_camera_detection_param.camera_debug_channel_name();
   ts_diff_ = fusion_camera_detection_param.ts_diff();
+  enable_batch_detection_ =
+      fusion_camera_detection_param.enable_batch_detection();
+  batch_max_wait_ms_ = fusion_camera_detection_param.batch_max_wait_ms();
+  if (enable_batch_detection_) {
+    camera_perception_init_options_.detector_batch_size =
+        static_cast<int>(camera_names_.size());
+  }
   write_visual_img_ = fusion_camera_detection_param.write_visual_img();
 
   std::string format_str = R"(
@@ -377,7 +515,9 @@ int FusionCameraDetectionComponent::InitConfig() {
       visual_camera_:     %s
       output_final_obstacles:    %s
       prefused_channel_name:    %s
-      write_visual_img_:    %s)";
+      write_visual_img_:    %s
+      enable_batch_detection:    %d
+      batch_max_wait_ms:    %f)";
   std::string config_info_str =
       str(boost::format(format_str.c_str()) % camera_names_[0] %
           camera_names_[1] % camera_perception_init_options_.root_dir %
@@ -389,7 +529,9 @@ int FusionCameraDetectionComponent::InitConfig() {
           visual_camera_ %
           output_final_obstacles_ %
           prefused_channel_name_ %
-          write_visual_img_);
+          write_visual_img_ %
+          enable_batch_detection_ %
+          batch_max_wait_ms_);
   AINFO << config_info_str;
 
   return cyber::SUCC;
@@ -566,10 +708,35 @@ int FusionCameraDetectionComponent::InternalProc(
     const std::string &camera_name, apollo::common::ErrorCode *error_code,
     SensorFrameMessage *prefused_message,
     apollo::perception::PerceptionObstacles *out_message) {
+  camera::CameraFrame *camera_frame = nullptr;
+  if (FillCameraFrame(in_message, camera_name, error_code, prefused_message,
+                      &camera_frame) != cyber::SUCC) {
+    return cyber::FAIL;
+  }
+
+  if (!camera_obstacle_pipeline_->Perception(camera_perception_options_,
+                                             camera_frame)) {
+    AERROR << "camera_obstacle_pipeline_->Perception() failed"
+           << " msg_timestamp: " << std::to_string(camera_frame->timestamp);
+    *error_code = apollo::common::ErrorCode::PERCEPTION_ERROR_PROCESS;
+    prefused_message->error_code_ = *error_code;
+    return cyber::FAIL;
+  }
+
+  return OutputCameraFrame(in_message, camera_name, *camera_frame, error_code,
+                           prefused_message, out_message);
+}
+
+int FusionCameraDetectionComponent::FillCameraFrame(
+    const std::shared_ptr<apollo::drivers::Image const> &in_message,
+    const std::string &camera_name, apollo::common::ErrorCode *error_code,
+    SensorFrameMessage *prefused_message,
+    camera::CameraFrame **camera_frame_ptr) {
   const double msg_timestamp =
       in_message->measurement_time() + timestamp_offset_;
   const int frame_size = static_cast<int>(camera_frames_.size());
   camera::CameraFrame &camera_frame = camera_frames_[frame_id_ % frame_size];
+  *camera_frame_ptr = &camera_frame;
 
   prefused_message->timestamp_ = msg_timestamp;
   prefused_message->seq_num_ = seq_num_;
@@ -614,15 +781,17 @@ int FusionCameraDetectionComponent::InternalProc(
   // Run camera perception pipeline
   camera_obstacle_pipeline_->GetCalibrationService(
       &camera_frame.calibration_service);
+  return cyber::SUCC;
+}
 
-  if (!camera_obstacle_pipeline_->Perception(camera_perception_options_,
-                                             &camera_frame)) {
-    AERROR << "camera_obstacle_pipeline_->Perception() failed"
-           << " msg_timestamp: " << std::to_string(msg_timestamp);
-    *error_code = apollo::common::ErrorCode::PERCEPTION_ERROR_PROCESS;
-    prefused_message->error_code_ = *error_code;
-    return cyber::FAIL;
-  }
+int FusionCameraDetectionComponent::OutputCameraFrame(
+    const std::shared_ptr<apollo::drivers::Image const> &in_message,
+    const std::string &camera_name, const camera::CameraFrame &camera_frame,
+    apollo::common::ErrorCode *error_code,
+    SensorFrameMessage *prefused_message,
+    apollo::perception::PerceptionObstacles *out_message) {
+  const double msg_timestamp = camera_frame.timestamp;
+  const Eigen::Affine3d &camera2world_trans = camera_frame.camera2world_pose;
   AINFO << "##" << camera_name << ": pitch "
         << camera_frame.calibration_service->QueryPitchAngle()
         << " | camera_grond_height "
@@ -639,7 +808,8 @@ int FusionCameraDetectionComponent::InternalProc(
 
   // process success, make pb msg
   if (output_final_obstacles_ &&
-      MakeProtobufMsg(msg_timestamp, seq_num_, camera_frame.tracked_objects,
+      MakeProtobufMsg(msg_timestamp, prefused_message->seq_num_,
+                      camera_frame.tracked_objects,
                       *error_code, out_message) != cyber::SUCC) {
     AERROR << "MakeProtobufMsg failed"
            << " ts: " << std::to_string(msg_timestamp);
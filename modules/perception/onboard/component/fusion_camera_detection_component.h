@@ -15,6 +15,7 @@
 *****************************************************************************/
 #pragma once
 
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <string>
@@ -31,6 +32,7 @@
 #include "modules/perception/camera/lib/interface/base_camera_perception.h"
 #include "modules/perception/onboard/component/camera_perception_viz_message.h"
 #include "modules/perception/onboard/inner_component_messages/inner_component_messages.h"
+#include "modules/perception/onboard/perf_writer/perf_writer.h"
 #include "modules/perception/onboard/proto/fusion_camera_detection_component.pb.h"
 #include "modules/perception/onboard/transform_wrapper/transform_wrapper.h"
 #include "modules/perception/proto/perception_obstacle.pb.h"
@@ -55,9 +57,37 @@ class FusionCameraDetectionComponent :
   bool Init() override;
 
  private:
+  // @brief: an image and its output messages in a batch of images
+  struct ImageTask {
+    std::string camera_name;
+    std::shared_ptr<apollo::drivers::Image> message;
+    bool accepted = true;
+    int ret = cyber::SUCC;
+    apollo::common::ErrorCode error_code = apollo::common::OK;
+    camera::CameraFrame *camera_frame = nullptr;
+    std::shared_ptr<SensorFrameMessage> prefused_message;
+    std::shared_ptr<apollo::perception::PerceptionObstacles> out_message;
+  };
+
   void OnReceiveImage(
       const std::shared_ptr<apollo::drivers::Image>& in_message,
       const std::string &camera_name);
+  // @brief: collect the images of all cameras into one batch, waiting for
+  // at most batch_max_wait_ms_ after the first image of the batch
+  void GatherImage(
+      const std::shared_ptr<apollo::drivers::Image>& in_message,
+      const std::string &camera_name);
+  void BatchProc(std::vector<ImageTask> *tasks);
+  bool AcceptImage(
+      const std::shared_ptr<apollo::drivers::Image>& in_message,
+      const std::string &camera_name);
+  void WriteOutput(
+      const std::shared_ptr<apollo::drivers::Image>& in_message,
+      const std::string &camera_name, int ret,
+      apollo::common::ErrorCode error_code,
+      const std::shared_ptr<SensorFrameMessage>& prefused_message,
+      const std::shared_ptr<apollo::perception::PerceptionObstacles>&
+          out_message);
   int InitConfig();
   int InitSensorInfo();
   int InitAlgorithmPlugin();
@@ -74,6 +104,21 @@ class FusionCameraDetectionComponent :
       SensorFrameMessage* prefused_message,
       apollo::perception::PerceptionObstacles* out_message);
 
+  int FillCameraFrame(
+      const std::shared_ptr<apollo::drivers::Image const>& in_message,
+      const std::string &camera_name,
+      apollo::common::ErrorCode *error_code,
+      SensorFrameMessage* prefused_message,
+      camera::CameraFrame **camera_frame);
+
+  int OutputCameraFrame(
+      const std::shared_ptr<apollo::drivers::Image const>& in_message,
+      const std::string &camera_name,
+      const camera::CameraFrame &camera_frame,
+      apollo::common::ErrorCode *error_code,
+      SensorFrameMessage* prefused_message,
+      apollo::perception::PerceptionObstacles* out_message);
+
   int MakeProtobufMsg(double msg_timestamp,
       int seq_num, const std::vector<base::ObjectPtr>& objects,
       const apollo::common::ErrorCode error_code,
@@ -96,6 +141,15 @@ class FusionCameraDetectionComponent :
   std::mutex mutex_;
   uint32_t seq_num_;
 
+  // batched detection of the images of all cameras
+  bool enable_batch_detection_ = false;
+  double batch_max_wait_ms_ = 20.0;
+  std::mutex batch_mutex_;
+  std::condition_variable batch_cv_;
+  bool batch_leader_waiting_ = false;
+  std::map<std::string, std::shared_ptr<apollo::drivers::Image>>
+      pending_images_;
+
   std::vector<std::shared_ptr<cyber::Node> > camera_listener_nodes_;
 
   std::vector<std::string> camera_names_;  // camera sensor names
@@ -179,6 +233,7 @@ class FusionCameraDetectionComponent :
 
   std::shared_ptr<apollo::cyber::Writer<
       apollo::perception::camera::CameraDebug>> camera_debug_writer_;
+  PerfWriter perf_writer_;
 
   camera::Visualizer visualize_;
   bool write_visual_img_;
@@ -47,6 +47,9 @@ bool FusionComponent::Init() {
       comp_config.output_obstacles_channel_name());
   inner_writer_ = node_->CreateWriter<SensorFrameMessage>(
       comp_config.output_viz_fused_content_channel_name());
+  if (!perf_writer_.Init(node_, "FusionComponent")) {
+    return false;
+  }
   return true;
 }
 
@@ -60,7 +63,9 @@ bool FusionComponent::Proc(const std::shared_ptr<SensorFrameMessage>& message) {
                                                    PerceptionObstacles);
   std::shared_ptr<SensorFrameMessage> viz_message(new (std::nothrow)
                                                   SensorFrameMessage);
+  perf_writer_.BeginFrame();
   bool status = InternalProc(message, out_message, viz_message);
+  perf_writer_.EndFrame(message->sensor_id_, message->timestamp_);
   if (status == true) {
     // TODO(conver sensor id)
     if (message->sensor_id_ != fusion_main_sensor_) {
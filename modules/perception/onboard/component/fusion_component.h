@@ -25,6 +25,7 @@
 #include "modules/perception/fusion/lib/interface/base_fusion_system.h"
 #include "modules/perception/map/hdmap/hdmap_input.h"
 #include "modules/perception/onboard/inner_component_messages/inner_component_messages.h"
+#include "modules/perception/onboard/perf_writer/perf_writer.h"
 #include "modules/perception/onboard/proto/fusion_component_config.pb.h"
 
 namespace apollo {
@@ -57,6 +58,7 @@ class FusionComponent : public cyber::Component<SensorFrameMessage> {
   map::HDMapInput* hdmap_input_ = nullptr;
   std::shared_ptr<apollo::cyber::Writer<PerceptionObstacles>> writer_;
   std::shared_ptr<apollo::cyber::Writer<SensorFrameMessage>> inner_writer_;
+  PerfWriter perf_writer_;
 };
 
 CYBER_REGISTER_COMPONENT(FusionComponent);
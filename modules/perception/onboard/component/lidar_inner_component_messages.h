@@ -27,6 +27,15 @@ namespace apollo {
 namespace perception {
 namespace onboard {
 
+/**
+ * @brief A lidar frame handed over from one component to the next. It has
+ * no wire format, so the transport always passes it by pointer within the
+ * process: the frame, and its cloud from the point cloud pool, are never
+ * copied. The writer gives the frame up on Write and the single reader of
+ * the channel owns it from then on. The frames come from the lidar frame
+ * pool, so segmentation fills frame N + 1 while recognition still tracks
+ * frame N.
+ */
 class LidarFrameMessage {
  public:
   LidarFrameMessage() : lidar_frame_(nullptr) {
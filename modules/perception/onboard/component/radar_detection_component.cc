@@ -14,6 +14,7 @@
  * limitations under the License.
  *****************************************************************************/
 #include "modules/perception/onboard/component/radar_detection_component.h"
+#include "modules/perception/base/object_pool_types.h"
 #include "modules/perception/common/sensor_manager/sensor_manager.h"
 #include "modules/perception/lib/utils/perf.h"
 
@@ -46,6 +47,9 @@ bool RadarDetectionComponent::Init() {
 
   writer_ = node_->CreateWriter<SensorFrameMessage>(
     comp_config.output_channel_name());
+  if (!perf_writer_.Init(node_, "RadarDetectionComponent")) {
+    return false;
+  }
 
   // init algorithm plugin
   CHECK(InitAlgorithmPlugin() == true) << "Failed to init algorithm plugin.";
@@ -63,7 +67,9 @@ bool RadarDetectionComponent::Proc(
            << " current timestamp " << lib::TimeUtil::GetCurrentTime();
   std::shared_ptr<SensorFrameMessage> out_message(new (std::nothrow)
                                                   SensorFrameMessage);
+  perf_writer_.BeginFrame();
   int status = InternalProc(message, out_message);
+  perf_writer_.EndFrame(radar_info_.name, message->header().timestamp_sec());
   if (status) {
     writer_->Write(out_message);
     AINFO << "Send radar processing output message.";
@@ -99,7 +105,6 @@ bool RadarDetectionComponent::InternalProc(
     const std::shared_ptr<ContiRadar>& in_message,
     std::shared_ptr<SensorFrameMessage> out_message) {
   PERCEPTION_PERF_FUNCTION_WITH_INDICATOR(radar_info_.name);
-  ContiRadar raw_obstacles = *in_message;
   {
     std::unique_lock<std::mutex> lock(_mutex);
     ++seq_num_;
@@ -114,12 +119,11 @@ bool RadarDetectionComponent::InternalProc(
   PERCEPTION_PERF_BLOCK_START();
   // init preprocessor_options
   radar::PreprocessorOptions preprocessor_options;
-  ContiRadar corrected_obstacles;
-  radar_preprocessor_->Preprocess(raw_obstacles, preprocessor_options,
-                                  &corrected_obstacles);
+  radar_preprocessor_->Preprocess(*in_message, preprocessor_options,
+                                  &corrected_obstacles_);
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(radar_info_.name,
                                            "radar_preprocessor");
-  timestamp = corrected_obstacles.header().timestamp_sec();
+  timestamp = corrected_obstacles_.header().timestamp_sec();
 
   out_message->timestamp_ = timestamp;
   out_message->seq_num_ = seq_num_;
@@ -175,7 +179,8 @@ bool RadarDetectionComponent::InternalProc(
   // init object_builder_options
   std::vector<base::ObjectPtr> radar_objects;
   bool result =
-      radar_perception_->Perceive(corrected_obstacles, options, &radar_objects);
+      radar_perception_->Perceive(corrected_obstacles_, options,
+                                  &radar_objects);
 
   if (!result) {
     out_message->error_code_ =
@@ -183,11 +188,11 @@ bool RadarDetectionComponent::InternalProc(
     AERROR << "RadarDetector Proc failed.";
     return true;
   }
-  out_message->frame_.reset(new base::Frame());
+  out_message->frame_ = base::FramePool::Instance().Get();
   out_message->frame_->sensor_info = radar_info_;
   out_message->frame_->timestamp = timestamp;
   out_message->frame_->sensor2world_pose = radar_trans;
-  out_message->frame_->objects = radar_objects;
+  out_message->frame_->objects.swap(radar_objects);
 
   const double end_timestamp = lib::TimeUtil::GetCurrentTime();
   const double end_latency =
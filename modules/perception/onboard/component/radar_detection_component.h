@@ -27,6 +27,7 @@
 #include "modules/perception/onboard/common_flags/common_flags.h"
 #include "modules/perception/onboard/inner_component_messages/inner_component_messages.h"
 #include "modules/perception/onboard/msg_buffer/msg_buffer.h"
+#include "modules/perception/onboard/perf_writer/perf_writer.h"
 #include "modules/perception/onboard/proto/radar_component_config.pb.h"
 #include "modules/perception/onboard/transform_wrapper/transform_wrapper.h"
 #include "modules/perception/radar/app/radar_obstacle_perception.h"
@@ -85,7 +86,10 @@ class RadarDetectionComponent : public cyber::Component<ContiRadar> {
   std::shared_ptr<radar::BasePreprocessor> radar_preprocessor_;
   std::shared_ptr<radar::BaseRadarObstaclePerception> radar_perception_;
   MsgBuffer<LocalizationEstimate> localization_subscriber_;
+  // reused between messages to keep the allocated obstacles
+  ContiRadar corrected_obstacles_;
   std::shared_ptr<apollo::cyber::Writer<SensorFrameMessage>> writer_;
+  PerfWriter perf_writer_;
 };
 
 CYBER_REGISTER_COMPONENT(RadarDetectionComponent);
@@ -44,16 +44,31 @@ bool SegmentationComponent::Init() {
                              comp_config.lidar_query_tf_offset());
   enable_hdmap_ = comp_config.enable_hdmap();
   writer_ = node_->CreateWriter<LidarFrameMessage>(output_channel_name_);
+  if (!perf_writer_.Init(node_, "SegmentationComponent")) {
+    return false;
+  }
 
   if (InitAlgorithmPlugin() != true) {
     AERROR << "Failed to init segmentation component algorithm plugin.";
     return false;
   }
+
+  if (!comp_config.point_cloud_buffer_channel_name().empty()) {
+    buffer_reader_ = node_->CreateReader<drivers::PointCloudBuffer>(
+        comp_config.point_cloud_buffer_channel_name(),
+        [this](const std::shared_ptr<drivers::PointCloudBuffer>& buffer) {
+          ProcBuffer(buffer);
+        });
+  }
   return true;
 }
 
 bool SegmentationComponent::Proc(
     const std::shared_ptr<drivers::PointCloud>& message) {
+  if (buffer_reader_ != nullptr) {
+    // the frame is processed from its decoded buffer
+    return true;
+  }
   AINFO << "Enter segmentation component, message timestamp: "
         << std::to_string(message->measurement_time()) << " current timestamp "
         << std::to_string(lib::TimeUtil::GetCurrentTime());
@@ -61,7 +76,9 @@ bool SegmentationComponent::Proc(
   std::shared_ptr<LidarFrameMessage> out_message(new (std::nothrow)
                                                  LidarFrameMessage);
 
-  bool status = InternalProc(message, out_message);
+  perf_writer_.BeginFrame();
+  bool status = InternalProc(message, nullptr, out_message);
+  perf_writer_.EndFrame(sensor_name_, message->measurement_time());
   if (status == true) {
     writer_->Write(out_message);
     AINFO << "Send lidar segment output message.";
@@ -69,6 +86,24 @@ bool SegmentationComponent::Proc(
   return status;
 }
 
+void SegmentationComponent::ProcBuffer(
+    const std::shared_ptr<drivers::PointCloudBuffer>& buffer) {
+  AINFO << "Enter segmentation component, buffer timestamp: "
+        << std::to_string(buffer->measurement_time) << " current timestamp "
+        << std::to_string(lib::TimeUtil::GetCurrentTime());
+
+  std::shared_ptr<LidarFrameMessage> out_message(new (std::nothrow)
+                                                 LidarFrameMessage);
+
+  perf_writer_.BeginFrame();
+  bool status = InternalProc(nullptr, buffer, out_message);
+  perf_writer_.EndFrame(sensor_name_, buffer->measurement_time);
+  if (status == true) {
+    writer_->Write(out_message);
+    AINFO << "Send lidar segment output message.";
+  }
+}
+
 bool SegmentationComponent::InitAlgorithmPlugin() {
   CHECK(common::SensorManager::Instance()->GetSensorInfo(sensor_name_,
                                                          &sensor_info_));
@@ -95,13 +130,16 @@ bool SegmentationComponent::InitAlgorithmPlugin() {
 
 bool SegmentationComponent::InternalProc(
     const std::shared_ptr<const drivers::PointCloud>& in_message,
+    const std::shared_ptr<const drivers::PointCloudBuffer>& in_buffer,
     const std::shared_ptr<LidarFrameMessage>& out_message) {
   PERCEPTION_PERF_FUNCTION_WITH_INDICATOR(sensor_name_);
   {
     std::unique_lock<std::mutex> lock(s_mutex_);
     s_seq_num_++;
   }
-  const double timestamp = in_message->measurement_time();
+  const double timestamp = in_buffer != nullptr
+                               ? in_buffer->measurement_time
+                               : in_message->measurement_time();
   const double cur_time = lib::TimeUtil::GetCurrentTime();
   const double start_latency = (cur_time - timestamp) * 1e3;
   AINFO << "FRAME_STATISTICS:Lidar:Start:msg_time[" << std::to_string(timestamp)
@@ -140,7 +178,9 @@ bool SegmentationComponent::InternalProc(
   segment_opts.sensor_name = sensor_name_;
   lidar2world_trans_.GetExtrinsics(&segment_opts.sensor2novatel_extrinsics);
   lidar::LidarProcessResult ret =
-      segmentor_->Process(segment_opts, in_message, frame.get());
+      in_buffer != nullptr
+          ? segmentor_->Process(segment_opts, *in_buffer, frame.get())
+          : segmentor_->Process(segment_opts, in_message, frame.get());
   if (ret.error_code != lidar::LidarErrorCode::Succeed) {
     out_message->error_code_ =
         apollo::common::ErrorCode::PERCEPTION_ERROR_PROCESS;
@@ -19,10 +19,12 @@
 #include <string>
 
 #include "cyber/cyber.h"
+#include "modules/drivers/common/point_cloud_buffer.h"
 #include "modules/drivers/proto/pointcloud.pb.h"
 #include "modules/perception/lidar/app/lidar_obstacle_segmentation.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
 #include "modules/perception/onboard/component/lidar_inner_component_messages.h"
+#include "modules/perception/onboard/perf_writer/perf_writer.h"
 #include "modules/perception/onboard/proto/lidar_component_config.pb.h"
 #include "modules/perception/onboard/transform_wrapper/transform_wrapper.h"
 
@@ -42,8 +44,11 @@ class SegmentationComponent : public cyber::Component<drivers::PointCloud> {
 
  private:
   bool InitAlgorithmPlugin();
+  void ProcBuffer(const std::shared_ptr<drivers::PointCloudBuffer>& buffer);
+  // exactly one of in_message and in_buffer is set
   bool InternalProc(
       const std::shared_ptr<const drivers::PointCloud>& in_message,
+      const std::shared_ptr<const drivers::PointCloudBuffer>& in_buffer,
       const std::shared_ptr<LidarFrameMessage>& out_message);
 
  private:
@@ -58,6 +63,9 @@ class SegmentationComponent : public cyber::Component<drivers::PointCloud> {
   TransformWrapper lidar2world_trans_;
   std::unique_ptr<lidar::LidarObstacleSegmentation> segmentor_;
   std::shared_ptr<apollo::cyber::Writer<LidarFrameMessage>> writer_;
+  std::shared_ptr<apollo::cyber::Reader<drivers::PointCloudBuffer>>
+      buffer_reader_;
+  PerfWriter perf_writer_;
 };
 
 CYBER_REGISTER_COMPONENT(SegmentationComponent);
@@ -141,6 +141,11 @@ int TrafficLightsPerceptionComponent::InitConfig() {
     traffic_light_param.image_sys_ts_diff_threshold();
   preprocessor_init_options_.sync_interval_seconds =
     static_cast<float>(traffic_light_param.sync_interval_seconds());
+  preprocessor_init_options_.projection_cache_max_translation =
+    static_cast<float>(
+        traffic_light_param.projection_cache_max_translation());
+  preprocessor_init_options_.projection_cache_max_rotation =
+    static_cast<float>(traffic_light_param.projection_cache_max_rotation());
   camera_perception_init_options_.root_dir =
     traffic_light_param.camera_traffic_light_perception_conf_dir();
   camera_perception_init_options_.conf_file =
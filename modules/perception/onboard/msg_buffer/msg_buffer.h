@@ -15,15 +15,14 @@
  *****************************************************************************/
 #pragma once
 
-#include <cfloat>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
-#include "boost/circular_buffer.hpp"
 #include "cyber/cyber.h"
 #include "gflags/gflags.h"
+#include "modules/perception/lib/utils/time_ring_buffer.h"
 
 namespace apollo {
 namespace perception {
@@ -65,7 +64,8 @@ class MsgBuffer {
   std::mutex buffer_mutex_;
 
   bool init_ = false;
-  boost::circular_buffer<ObjectPair> buffer_queue_;
+  // messages sorted by timestamp
+  lib::TimeRingBuffer<ConstPtr> buffer_queue_;
 };
 
 template <class T>
@@ -91,7 +91,7 @@ template <class T>
 void MsgBuffer<T>::MsgCallback(const ConstPtr& msg) {
   std::lock_guard<std::mutex> lock(buffer_mutex_);
   double timestamp = msg->measurement_time();
-  buffer_queue_.push_back(std::make_pair(timestamp, msg));
+  buffer_queue_.push(timestamp, msg);
 }
 
 template <class T>
@@ -120,17 +120,7 @@ int MsgBuffer<T>::LookupNearest(double timestamp, ConstPtr* msg) {
     return false;
   }
 
-  // loop to find nearest
-  double distance = DBL_MAX;
-  int idx = static_cast<int>(buffer_queue_.size()) - 1;
-  for (; idx >= 0; --idx) {
-    double temp_distance = fabs(timestamp - buffer_queue_[idx].first);
-    if (temp_distance >= distance) {
-      break;
-    }
-    distance = temp_distance;
-  }
-  *msg = buffer_queue_[idx + 1].second;
+  *msg = buffer_queue_[buffer_queue_.Nearest(timestamp)].second;
 
   return true;
 }
@@ -177,17 +167,10 @@ int MsgBuffer<T>::LookupPeriod(const double timestamp, const double period,
 
   const double lower_timestamp = timestamp - period;
   const double upper_timestamp = timestamp + period;
-  for (size_t idx = 0; idx < buffer_queue_.size(); ++idx) {
-    if (buffer_queue_[idx].first < lower_timestamp) {
-      continue;
-    } else {
-      if (buffer_queue_[idx].first > upper_timestamp) {
-        break;
-      } else {
-        msgs->emplace_back(std::make_pair(buffer_queue_[idx].first,
-                                          buffer_queue_[idx].second));
-      }
-    }
+  const size_t end = buffer_queue_.UpperBound(upper_timestamp);
+  for (size_t idx = buffer_queue_.LowerBound(lower_timestamp); idx < end;
+       ++idx) {
+    msgs->emplace_back(buffer_queue_[idx]);
   }
 
   return true;
@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/onboard/perf_writer/perf_writer.h"
+
+#include "modules/perception/inference/utils/cuda_util.h"
+#include "modules/perception/lib/utils/time_util.h"
+
+namespace apollo {
+namespace perception {
+namespace onboard {
+
+bool PerfWriter::Init(const std::shared_ptr<cyber::Node> &node,
+                      const std::string &component_name) {
+  component_name_ = component_name;
+  if (!FLAGS_obs_enable_perf_stats) {
+    return true;
+  }
+  writer_ = node->CreateWriter<PerceptionPerf>(FLAGS_obs_perf_stats_channel);
+  if (writer_ == nullptr) {
+    AERROR << "Failed to create perf stats writer for " << component_name;
+    return false;
+  }
+  return true;
+}
+
+void PerfWriter::BeginFrame() {
+  if (writer_ == nullptr) {
+    return;
+  }
+  begin_time_ = lib::TimeUtil::GetCurrentTime();
+  lib::PerfCollector::BeginFrame();
+}
+
+void PerfWriter::EndFrame(const std::string &sensor_name,
+                          double frame_timestamp) {
+  if (writer_ == nullptr || !lib::PerfCollector::Active()) {
+    return;
+  }
+  lib::PerfCollector::EndFrame(&stages_);
+  const double end_time = lib::TimeUtil::GetCurrentTime();
+
+  auto message = std::make_shared<PerceptionPerf>();
+  auto *header = message->mutable_header();
+  header->set_timestamp_sec(end_time);
+  header->set_module_name("perception");
+  header->set_sequence_num(seq_num_++);
+  message->set_component_name(component_name_);
+  message->set_sensor_name(sensor_name);
+  message->set_frame_timestamp(frame_timestamp);
+  message->set_total_ms((end_time - begin_time_) * 1e3);
+  for (const auto &stage : stages_) {
+    auto *stage_message = message->add_stages();
+    stage_message->set_name(stage.name);
+    stage_message->set_elapsed_ms(stage.elapsed_ms);
+    stage_message->set_gpu(stage.gpu);
+  }
+  size_t gpu_memory_used = 0;
+  size_t gpu_memory_total = 0;
+  if (inference::CudaUtil::get_memory_info(&gpu_memory_used,
+                                           &gpu_memory_total)) {
+    message->set_gpu_memory_used(gpu_memory_used);
+    message->set_gpu_memory_total(gpu_memory_total);
+  }
+  writer_->Write(message);
+}
+
+}  // namespace onboard
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,59 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cyber/cyber.h"
+#include "modules/perception/lib/utils/perf_collector.h"
+#include "modules/perception/onboard/common_flags/common_flags.h"
+#include "modules/perception/proto/perception_perf.pb.h"
+
+namespace apollo {
+namespace perception {
+namespace onboard {
+
+// @brief: publishes the stages a component collects with lib::PerfCollector
+// for a frame, plus the total time and the gpu memory use, on
+// obs_perf_stats_channel. Does nothing unless obs_enable_perf_stats is set.
+// BeginFrame and EndFrame must be called on the thread processing the frame.
+class PerfWriter {
+ public:
+  PerfWriter() = default;
+  ~PerfWriter() = default;
+
+  bool Init(const std::shared_ptr<cyber::Node> &node,
+            const std::string &component_name);
+
+  void BeginFrame();
+  void EndFrame(const std::string &sensor_name, double frame_timestamp);
+
+  PerfWriter(const PerfWriter &) = delete;
+  PerfWriter &operator=(const PerfWriter &) = delete;
+
+ private:
+  std::shared_ptr<cyber::Writer<PerceptionPerf>> writer_ = nullptr;
+  std::string component_name_;
+  std::vector<lib::PerfStage> stages_;
+  double begin_time_ = 0.0;
+  uint32_t seq_num_ = 0;
+};
+
+}  // namespace onboard
+}  // namespace perception
+}  // namespace apollo
@@ -35,6 +35,60 @@ DEFINE_double(obs_max_local_pose_extrapolation_latency, 0.15,
               "max local pose extrapolation period in second");
 DEFINE_bool(obs_enable_local_pose_extrapolation, true,
             "use local pose extrapolation");
+DEFINE_bool(obs_enable_shared_transform_cache, true,
+            "share tf2 lookups between perception components");
+
+SharedTransformCache::SharedTransformCache() {}
+
+bool SharedTransformCache::Query(const std::string& frame_id,
+                                 const std::string& child_frame_id,
+                                 double timestamp,
+                                 StampedTransform* transform) const {
+  std::shared_ptr<const Snapshot> snapshot = std::atomic_load(&snapshot_);
+  // newest entries are at the back
+  for (auto it = snapshot->rbegin(); it != snapshot->rend(); ++it) {
+    if (it->transform.timestamp == timestamp &&
+        it->child_frame_id == child_frame_id && it->frame_id == frame_id) {
+      *transform = it->transform;
+      return true;
+    }
+  }
+  return false;
+}
+
+void SharedTransformCache::Add(const std::string& frame_id,
+                               const std::string& child_frame_id,
+                               const StampedTransform& transform) {
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  std::shared_ptr<const Snapshot> snapshot = std::atomic_load(&snapshot_);
+  std::shared_ptr<Snapshot> new_snapshot = std::make_shared<Snapshot>();
+  new_snapshot->reserve(kCapacity + 1);
+  // drop the oldest entry when full, static transforms are kept
+  size_t drop = snapshot->size();
+  if (snapshot->size() >= kCapacity) {
+    for (size_t i = 0; i < snapshot->size(); ++i) {
+      if ((*snapshot)[i].transform.timestamp != 0.0) {
+        drop = i;
+        break;
+      }
+    }
+  }
+  for (size_t i = 0; i < snapshot->size(); ++i) {
+    if (i != drop) {
+      new_snapshot->push_back((*snapshot)[i]);
+    }
+  }
+  new_snapshot->push_back({frame_id, child_frame_id, transform});
+  std::atomic_store(&snapshot_,
+                    std::shared_ptr<const Snapshot>(std::move(new_snapshot)));
+}
+
+void SharedTransformCache::Clear() {
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  std::atomic_store(&snapshot_,
+                    std::shared_ptr<const Snapshot>(
+                        std::make_shared<Snapshot>()));
+}
 
 void TransformCache::AddTransform(const StampedTransform& transform) {
   if (transforms_.empty()) {
@@ -218,6 +272,10 @@ bool TransformWrapper::GetTrans(double timestamp, Eigen::Affine3d* trans,
 bool TransformWrapper::QueryTrans(double timestamp, StampedTransform* trans,
                                   const std::string& frame_id,
                                   const std::string& child_frame_id) {
+  if (FLAGS_obs_enable_shared_transform_cache &&
+      shared_cache_->Query(frame_id, child_frame_id, timestamp, trans)) {
+    return true;
+  }
   cyber::Time query_time(timestamp);
   std::string err_string;
   if (!tf2_buffer_->canTransform(frame_id, child_frame_id, query_time,
@@ -248,6 +306,10 @@ bool TransformWrapper::QueryTrans(double timestamp, StampedTransform* trans,
     AERROR << ex.what();
     return false;
   }
+  trans->timestamp = timestamp;
+  if (FLAGS_obs_enable_shared_transform_cache) {
+    shared_cache_->Add(frame_id, child_frame_id, *trans);
+  }
   return true;
 }
 
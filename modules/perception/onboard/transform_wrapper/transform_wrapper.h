@@ -17,11 +17,14 @@
 
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "Eigen/Core"
 #include "Eigen/Dense"
 
+#include "cyber/common/macros.h"
 #include "modules/transform/buffer.h"
 
 namespace apollo {
@@ -58,6 +61,37 @@ class TransformCache {
   double cache_duration_ = 1.0;
 };
 
+// @brief: transforms looked up from tf2, shared by all TransformWrappers of
+// the process. Components processing the same timestamp query the same
+// novatel2world transform, only the first one walks the tf2 tree. Readers
+// take a snapshot without locking, writers replace it.
+class SharedTransformCache {
+ public:
+  // @brief: query the transform at timestamp, static transforms are stored
+  // with timestamp 0
+  bool Query(const std::string& frame_id, const std::string& child_frame_id,
+             double timestamp, StampedTransform* transform) const;
+  void Add(const std::string& frame_id, const std::string& child_frame_id,
+           const StampedTransform& transform);
+  void Clear();
+
+  // number of cached transforms, older ones are replaced
+  static const size_t kCapacity = 64;
+
+ private:
+  struct Entry {
+    std::string frame_id;
+    std::string child_frame_id;
+    StampedTransform transform;
+  };
+  typedef std::vector<Entry> Snapshot;
+
+  std::shared_ptr<const Snapshot> snapshot_ = std::make_shared<Snapshot>();
+  std::mutex write_mutex_;
+
+  DECLARE_SINGLETON(SharedTransformCache)
+};
+
 class TransformWrapper {
  public:
   TransformWrapper() {}
@@ -93,6 +127,7 @@ class TransformWrapper {
   bool inited_ = false;
 
   Buffer* tf2_buffer_ = Buffer::Instance();
+  SharedTransformCache* shared_cache_ = SharedTransformCache::Instance();
 
   std::string sensor2novatel_tf2_frame_id_;
   std::string sensor2novatel_tf2_child_frame_id_;
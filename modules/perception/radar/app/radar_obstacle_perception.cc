@@ -15,6 +15,7 @@
 *****************************************************************************/
 #include "modules/perception/radar/app/radar_obstacle_perception.h"
 
+#include "modules/perception/base/object_pool_types.h"
 #include "modules/perception/lib/config_manager/config_manager.h"
 #include "modules/perception/lib/registerer/registerer.h"
 #include "modules/perception/lib/utils/perf.h"
@@ -72,7 +73,7 @@ bool RadarObstaclePerception::Perceive(
   PERCEPTION_PERF_FUNCTION();
   const std::string& sensor_name = options.sensor_name;
   PERCEPTION_PERF_BLOCK_START();
-  base::FramePtr detect_frame_ptr(new base::Frame());
+  base::FramePtr detect_frame_ptr = base::FramePool::Instance().Get();
   CHECK(detector_->Detect(corrected_obstacles,
                           options.detector_options,
                           detect_frame_ptr)) << "radar detect error";
@@ -86,7 +87,7 @@ bool RadarObstaclePerception::Perceive(
            << detect_frame_ptr->objects.size();
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(sensor_name, "roi_filter");
 
-  base::FramePtr tracker_frame_ptr = std::make_shared<base::Frame>();
+  base::FramePtr tracker_frame_ptr = base::FramePool::Instance().Get();
   CHECK(tracker_->Track(*detect_frame_ptr,
                         options.track_options,
                         tracker_frame_ptr)) << "radar track error";
@@ -94,7 +95,7 @@ bool RadarObstaclePerception::Perceive(
            << tracker_frame_ptr->objects.size();
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(sensor_name, "tracker");
 
-  *objects = tracker_frame_ptr->objects;
+  objects->swap(tracker_frame_ptr->objects);
 
   return true;
 }
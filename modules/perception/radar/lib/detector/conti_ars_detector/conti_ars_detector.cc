@@ -17,6 +17,8 @@
 
 #include <memory>
 
+#include "modules/perception/base/object_pool_types.h"
+
 namespace apollo {
 namespace perception {
 namespace radar {
@@ -59,8 +61,13 @@ void ContiArsDetector::RawObs2Frame(
   ADEBUG << "radar2novatel: " << radar2novatel;
   ADEBUG << "angular_speed: " << angular_speed;
   ADEBUG << "rotation_radar: " << rotation_radar;
-  for (const auto radar_obs : corrected_obstacles.contiobs()) {
-    base::ObjectPtr radar_object = std::make_shared<base::Object>();
+  auto &objects = radar_frame->objects;
+  const size_t first_object = objects.size();
+  base::ObjectPool::Instance().BatchGet(corrected_obstacles.contiobs_size(),
+                                        &objects);
+  for (int i = 0; i < corrected_obstacles.contiobs_size(); ++i) {
+    const auto &radar_obs = corrected_obstacles.contiobs(i);
+    const base::ObjectPtr &radar_object = objects[first_object + i];
     radar_object->id = radar_obs.obstacle_id();
     radar_object->track_id = radar_obs.obstacle_id();
     Eigen::Vector4d local_loc(radar_obs.longitude_dist(),
@@ -161,8 +168,6 @@ void ContiArsDetector::RawObs2Frame(
     radar_object->radar_supplement.range = local_range;
     radar_object->radar_supplement.angle = local_angle;
 
-    radar_frame->objects.push_back(radar_object);
-
     ADEBUG << "obs_id: " << radar_obs.obstacle_id() << ", "
               << "long_dist: " << radar_obs.longitude_dist() << ", "
               << "lateral_dist: " << radar_obs.lateral_dist() << ", "
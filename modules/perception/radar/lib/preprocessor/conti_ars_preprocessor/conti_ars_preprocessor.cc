@@ -50,14 +50,17 @@ std::string ContiArsPreprocessor::Name() const {
 void ContiArsPreprocessor::SkipObjects(
         const drivers::ContiRadar& raw_obstacles,
         drivers::ContiRadar* corrected_obstacles) {
+  // Clear keeps the allocated obstacles of a reused message
+  corrected_obstacles->Clear();
   corrected_obstacles->mutable_header()->CopyFrom(raw_obstacles.header());
+  corrected_obstacles->mutable_contiobs()->Reserve(
+      raw_obstacles.contiobs_size());
   double timestamp = raw_obstacles.header().timestamp_sec() - 1e-6;
   for (const auto& contiobs : raw_obstacles.contiobs()) {
     double object_timestamp = contiobs.header().timestamp_sec();
     if (object_timestamp > timestamp &&
         object_timestamp < timestamp + CONTI_ARS_INTERVAL) {
-        drivers::ContiRadarObs* obs = corrected_obstacles->add_contiobs();
-      *obs = contiobs;
+      corrected_obstacles->add_contiobs()->CopyFrom(contiobs);
     }
   }
   if (raw_obstacles.contiobs_size() > corrected_obstacles->contiobs_size()) {
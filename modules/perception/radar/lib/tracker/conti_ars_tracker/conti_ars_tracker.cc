@@ -15,6 +15,8 @@
 *****************************************************************************/
 #include "modules/perception/radar/lib/tracker/conti_ars_tracker/conti_ars_tracker.h"
 
+#include "modules/perception/base/object_pool_types.h"
+
 namespace apollo {
 namespace perception {
 namespace radar {
@@ -154,7 +156,7 @@ void ContiArsTracker::CollectTrackedFrame(base::FramePtr tracked_frame) {
   const auto &radar_tracks = track_manager_->GetTracks();
   for (size_t i = 0; i < radar_tracks.size(); ++i) {
     if (radar_tracks[i]->ConfirmTrack()) {
-      base::ObjectPtr object = base::ObjectPtr(new base::Object());
+      base::ObjectPtr object = base::ObjectPool::Instance().Get();
       const base::ObjectPtr &track_object = radar_tracks[i]->GetObs();
       *object = *track_object;
       object->tracking_time = radar_tracks[i]->GetTrackingTime();
@@ -0,0 +1,145 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/benchmark/benchmark_stats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include "cyber/common/log.h"
+#include "modules/common/util/string_util.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::util::StrCat;
+
+namespace {
+
+// the nearest rank percentile of sorted values
+double Percentile(const std::vector<double>& sorted_values,
+                  const double percentile) {
+  if (sorted_values.empty()) {
+    return 0.0;
+  }
+  const double rank =
+      std::ceil(percentile * static_cast<double>(sorted_values.size()));
+  const size_t index = static_cast<size_t>(std::max(rank, 1.0)) - 1;
+  return sorted_values[std::min(index, sorted_values.size() - 1)];
+}
+
+double Mean(const std::vector<double>& values) {
+  if (values.empty()) {
+    return 0.0;
+  }
+  double sum = 0.0;
+  for (const double value : values) {
+    sum += value;
+  }
+  return sum / static_cast<double>(values.size());
+}
+
+void CompareValue(const std::string& name, const double baseline,
+                  const double value, const double max_ratio,
+                  const double min_diff,
+                  std::vector<std::string>* regressions) {
+  const double diff = value - baseline;
+  if (diff > min_diff && diff > max_ratio * baseline) {
+    regressions->push_back(StrCat(name, ": ", value, " vs. baseline ",
+                                  baseline, " (+",
+                                  baseline > 0.0 ? 100.0 * diff / baseline
+                                                 : 100.0,
+                                  "%)"));
+  }
+}
+
+}  // namespace
+
+void SummarizeBenchmark(BenchmarkResult* const result) {
+  CHECK_NOTNULL(result);
+  std::vector<double> times;
+  std::vector<double> num_allocations;
+  std::vector<double> allocated_bytes;
+  // keeps the tasks in name order, so that reports are easy to diff
+  std::map<std::string, std::vector<double>> task_times;
+  for (const auto& cycle : result->cycle()) {
+    times.push_back(cycle.time_ms());
+    num_allocations.push_back(static_cast<double>(cycle.num_allocations()));
+    allocated_bytes.push_back(static_cast<double>(cycle.allocated_bytes()));
+    for (const auto& task_stats : cycle.latency_stats().task_stats()) {
+      if (!task_stats.skipped()) {
+        task_times[task_stats.name()].push_back(task_stats.time_ms());
+      }
+    }
+  }
+  std::sort(times.begin(), times.end());
+
+  auto* summary = result->mutable_summary();
+  summary->Clear();
+  summary->set_num_cycles(static_cast<uint32_t>(times.size()));
+  summary->set_mean_time_ms(Mean(times));
+  summary->set_p50_time_ms(Percentile(times, 0.5));
+  summary->set_p95_time_ms(Percentile(times, 0.95));
+  summary->set_p99_time_ms(Percentile(times, 0.99));
+  summary->set_max_time_ms(times.empty() ? 0.0 : times.back());
+  summary->set_mean_num_allocations(Mean(num_allocations));
+  summary->set_mean_allocated_bytes(Mean(allocated_bytes));
+  for (auto& entry : task_times) {
+    auto& values = entry.second;
+    std::sort(values.begin(), values.end());
+    auto* task_summary = summary->add_task_summary();
+    task_summary->set_name(entry.first);
+    task_summary->set_num_runs(static_cast<uint32_t>(values.size()));
+    task_summary->set_mean_time_ms(Mean(values));
+    task_summary->set_p95_time_ms(Percentile(values, 0.95));
+    task_summary->set_max_time_ms(values.back());
+  }
+}
+
+std::vector<std::string> CompareWithBaseline(const BenchmarkSummary& baseline,
+                                             const BenchmarkSummary& summary,
+                                             const double max_ratio,
+                                             const double min_time_ms) {
+  std::vector<std::string> regressions;
+  CompareValue("mean_time_ms", baseline.mean_time_ms(), summary.mean_time_ms(),
+               max_ratio, min_time_ms, &regressions);
+  CompareValue("p95_time_ms", baseline.p95_time_ms(), summary.p95_time_ms(),
+               max_ratio, min_time_ms, &regressions);
+  CompareValue("mean_num_allocations", baseline.mean_num_allocations(),
+               summary.mean_num_allocations(), max_ratio, 0.0, &regressions);
+  std::map<std::string, const BenchmarkTaskSummary*> baseline_tasks;
+  for (const auto& task_summary : baseline.task_summary()) {
+    baseline_tasks[task_summary.name()] = &task_summary;
+  }
+  for (const auto& task_summary : summary.task_summary()) {
+    auto iter = baseline_tasks.find(task_summary.name());
+    if (iter == baseline_tasks.end()) {
+      continue;
+    }
+    CompareValue(StrCat(task_summary.name(), ".mean_time_ms"),
+                 iter->second->mean_time_ms(), task_summary.mean_time_ms(),
+                 max_ratio, min_time_ms, &regressions);
+  }
+  return regressions;
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,48 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "modules/planning/proto/planning_benchmark.pb.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @brief Fills the summary of a benchmark result from its cycles.
+ */
+void SummarizeBenchmark(BenchmarkResult* const result);
+
+/**
+ * @brief Compares a benchmark summary with the one of the baseline.
+ * @return the regressions, one line each: a latency over the baseline by more
+ *         than "max_ratio" of it and more than "min_time_ms", or an
+ *         allocation count over the baseline by more than "max_ratio" of it.
+ */
+std::vector<std::string> CompareWithBaseline(const BenchmarkSummary& baseline,
+                                             const BenchmarkSummary& summary,
+                                             const double max_ratio,
+                                             const double min_time_ms);
+
+}  // namespace planning
+}  // namespace apollo
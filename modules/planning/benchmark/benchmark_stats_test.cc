@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/planning/benchmark/benchmark_stats.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace planning {
+
+namespace {
+
+BenchmarkResult MakeResult(const double time_ms, const double task_time_ms,
+                           const uint64_t num_allocations) {
+  BenchmarkResult result;
+  for (int i = 1; i <= 100; ++i) {
+    auto* cycle = result.add_cycle();
+    cycle->set_time_ms(time_ms * i);
+    cycle->set_num_allocations(num_allocations);
+    auto* task_stats = cycle->mutable_latency_stats()->add_task_stats();
+    task_stats->set_name("DpPolyPathOptimizer");
+    task_stats->set_time_ms(task_time_ms);
+    auto* skipped_task_stats = cycle->mutable_latency_stats()->add_task_stats();
+    skipped_task_stats->set_name("QpSplineStSpeedOptimizer");
+    skipped_task_stats->set_skipped(true);
+  }
+  SummarizeBenchmark(&result);
+  return result;
+}
+
+}  // namespace
+
+TEST(BenchmarkStatsTest, Summarize) {
+  const auto result = MakeResult(1.0, 2.0, 10);
+  const auto& summary = result.summary();
+  EXPECT_EQ(100u, summary.num_cycles());
+  EXPECT_DOUBLE_EQ(50.5, summary.mean_time_ms());
+  EXPECT_DOUBLE_EQ(50.0, summary.p50_time_ms());
+  EXPECT_DOUBLE_EQ(95.0, summary.p95_time_ms());
+  EXPECT_DOUBLE_EQ(99.0, summary.p99_time_ms());
+  EXPECT_DOUBLE_EQ(100.0, summary.max_time_ms());
+  EXPECT_DOUBLE_EQ(10.0, summary.mean_num_allocations());
+  ASSERT_EQ(1, summary.task_summary_size());
+  EXPECT_EQ("DpPolyPathOptimizer", summary.task_summary(0).name());
+  EXPECT_EQ(100u, summary.task_summary(0).num_runs());
+  EXPECT_DOUBLE_EQ(2.0, summary.task_summary(0).mean_time_ms());
+}
+
+TEST(BenchmarkStatsTest, CompareWithBaseline) {
+  const auto baseline = MakeResult(1.0, 2.0, 10).summary();
+  EXPECT_TRUE(CompareWithBaseline(baseline, baseline, 0.1, 1.0).empty());
+  // within the noise
+  EXPECT_TRUE(CompareWithBaseline(
+                  baseline, MakeResult(1.05, 2.5, 10).summary(), 0.1, 1.0)
+                  .empty());
+  EXPECT_EQ(2u, CompareWithBaseline(baseline,
+                                   MakeResult(1.2, 2.0, 10).summary(), 0.1,
+                                   1.0)
+                   .size());
+  EXPECT_EQ(1u, CompareWithBaseline(baseline,
+                                   MakeResult(1.0, 4.0, 10).summary(), 0.1,
+                                   1.0)
+                   .size());
+  EXPECT_EQ(1u, CompareWithBaseline(baseline,
+                                   MakeResult(1.0, 2.0, 12).summary(), 0.1,
+                                   1.0)
+                   .size());
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,317 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ * @brief Drives OnLanePlanning in closed loop with the perfect control model
+ *        of the dreamview SimControl, on a simulated clock, as fast as the
+ *        cycles compute.
+ *
+ * Every step of the simulated clock runs in the same order in one thread:
+ * the vehicle moves along the last trajectory, then planning runs on the
+ * localization, chassis and empty prediction of the step if a planning period
+ * has passed. A drive is therefore deterministic, and takes the time of its
+ * planning cycles rather than the time of the drive.
+ *
+ * Example:
+ *   closed_loop_simulation --flagfile=modules/planning/conf/planning.conf \
+ *       --sim_routing_files=a.pb.txt,b.pb.txt \
+ *       --sim_result_file=/tmp/closed_loop.pb.txt
+ **/
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include "gflags/gflags.h"
+
+#include "cyber/common/file.h"
+#include "cyber/common/log.h"
+#include "cyber/cyber.h"
+#include "modules/canbus/proto/chassis.pb.h"
+#include "modules/common/math/linear_interpolation.h"
+#include "modules/common/math/quaternion.h"
+#include "modules/common/time/time.h"
+#include "modules/common/util/message_util.h"
+#include "modules/common/util/string_tokenizer.h"
+#include "modules/localization/proto/localization.pb.h"
+#include "modules/map/hdmap/hdmap_util.h"
+#include "modules/perception/proto/traffic_light_detection.pb.h"
+#include "modules/planning/benchmark/benchmark_stats.h"
+#include "modules/planning/common/planning_gflags.h"
+#include "modules/planning/on_lane_planning.h"
+#include "modules/planning/proto/planning_benchmark.pb.h"
+#include "modules/prediction/proto/prediction_obstacle.pb.h"
+#include "modules/routing/proto/routing.pb.h"
+
+DEFINE_string(sim_routing_files, "",
+              "the comma separated routing responses to drive, in text format");
+DEFINE_string(sim_result_file, "",
+              "the file to write the results to, in text format");
+DEFINE_double(sim_max_time_sec, 600.0,
+              "the simulated time after which a drive is given up");
+DEFINE_double(sim_control_interval_ms, 10.0,
+              "the simulated time between two moves of the vehicle");
+
+namespace apollo {
+namespace planning {
+
+using apollo::canbus::Chassis;
+using apollo::common::TrajectoryPoint;
+using apollo::common::math::HeadingToQuaternion;
+using apollo::common::math::InterpolateUsingLinearApproximation;
+using apollo::common::time::Clock;
+using apollo::common::util::FillHeader;
+using apollo::hdmap::HDMapUtil;
+using apollo::localization::LocalizationEstimate;
+using apollo::perception::TrafficLightDetection;
+using apollo::prediction::PredictionObstacles;
+using apollo::routing::RoutingResponse;
+
+namespace {
+
+// The point of the trajectory at the given time, as the SimControl perfect
+// control model follows it: the car stops at the end of the trajectory and
+// on an estop.
+TrajectoryPoint FollowTrajectory(const ADCTrajectory& trajectory,
+                                 const TrajectoryPoint& last_point,
+                                 const double time) {
+  TrajectoryPoint point = last_point;
+  if (trajectory.trajectory_point().empty() || trajectory.estop().is_estop()) {
+    point.set_v(0.0);
+    point.set_a(0.0);
+    return point;
+  }
+  const double relative_time = time - trajectory.header().timestamp_sec();
+  const auto& points = trajectory.trajectory_point();
+  int next = 0;
+  while (next < points.size() &&
+         points.Get(next).relative_time() < relative_time) {
+    ++next;
+  }
+  if (next == points.size()) {
+    point = points.Get(next - 1);
+    point.set_v(0.0);
+    point.set_a(0.0);
+  } else if (next == 0) {
+    point = points.Get(0);
+  } else {
+    point = InterpolateUsingLinearApproximation(
+        points.Get(next - 1), points.Get(next), relative_time);
+  }
+  return point;
+}
+
+std::shared_ptr<LocalizationEstimate> MakeLocalization(
+    const TrajectoryPoint& point) {
+  auto localization = std::make_shared<LocalizationEstimate>();
+  FillHeader("SimControl", localization.get());
+  auto* pose = localization->mutable_pose();
+  const double heading = point.path_point().theta();
+  pose->mutable_position()->set_x(point.path_point().x());
+  pose->mutable_position()->set_y(point.path_point().y());
+  pose->mutable_position()->set_z(point.path_point().z());
+  const Eigen::Quaternion<double> orientation =
+      HeadingToQuaternion<double>(heading);
+  pose->mutable_orientation()->set_qw(orientation.w());
+  pose->mutable_orientation()->set_qx(orientation.x());
+  pose->mutable_orientation()->set_qy(orientation.y());
+  pose->mutable_orientation()->set_qz(orientation.z());
+  pose->set_heading(heading);
+  pose->mutable_linear_velocity()->set_x(std::cos(heading) * point.v());
+  pose->mutable_linear_velocity()->set_y(std::sin(heading) * point.v());
+  pose->mutable_linear_velocity()->set_z(0.0);
+  pose->mutable_linear_acceleration()->set_x(std::cos(heading) * point.a());
+  pose->mutable_linear_acceleration()->set_y(std::sin(heading) * point.a());
+  pose->mutable_linear_acceleration()->set_z(0.0);
+  pose->mutable_angular_velocity()->set_z(point.v() *
+                                          point.path_point().kappa());
+  return localization;
+}
+
+std::shared_ptr<Chassis> MakeChassis(const TrajectoryPoint& point,
+                                     const Chassis::GearPosition gear) {
+  auto chassis = std::make_shared<Chassis>();
+  FillHeader("SimControl", chassis.get());
+  chassis->set_engine_started(true);
+  chassis->set_driving_mode(Chassis::COMPLETE_AUTO_DRIVE);
+  chassis->set_gear_location(gear);
+  chassis->set_speed_mps(static_cast<float>(
+      gear == Chassis::GEAR_REVERSE ? -point.v() : point.v()));
+  chassis->set_throttle_percentage(0.0);
+  chassis->set_brake_percentage(0.0);
+  return chassis;
+}
+
+bool StartPoint(const RoutingResponse& routing, TrajectoryPoint* point) {
+  if (routing.routing_request().waypoint_size() < 2) {
+    AERROR << "The routing has less than two waypoints.";
+    return false;
+  }
+  const auto& waypoint = routing.routing_request().waypoint(0);
+  point->mutable_path_point()->set_x(waypoint.pose().x());
+  point->mutable_path_point()->set_y(waypoint.pose().y());
+  hdmap::Id lane_id;
+  lane_id.set_id(waypoint.id());
+  const auto lane = HDMapUtil::BaseMap().GetLaneById(lane_id);
+  if (lane == nullptr) {
+    AERROR << "The start lane " << waypoint.id() << " is not on the map.";
+    return false;
+  }
+  point->mutable_path_point()->set_theta(lane->Heading(waypoint.s()));
+  point->set_v(0.0);
+  point->set_a(0.0);
+  return true;
+}
+
+bool Drive(const std::string& routing_file, const PlanningConfig& config,
+           ClosedLoopResult* const result) {
+  result->set_routing_file(routing_file);
+  auto routing = std::make_shared<RoutingResponse>();
+  if (!cyber::common::GetProtoFromFile(routing_file, routing.get())) {
+    AERROR << "Failed to load routing " << routing_file;
+    return false;
+  }
+  // Every drive starts at the time of its routing.
+  double time = routing->header().timestamp_sec();
+  Clock::SetNowInSeconds(time);
+
+  OnLanePlanning planning;
+  const auto status = planning.Init(config);
+  if (!status.ok()) {
+    AERROR << "Failed to init planning: " << status.ToString();
+    return false;
+  }
+  TrajectoryPoint point;
+  if (!StartPoint(*routing, &point)) {
+    return false;
+  }
+
+  LocalView local_view;
+  local_view.routing = routing;
+  local_view.is_new_routing = true;
+  local_view.traffic_light = std::make_shared<TrafficLightDetection>();
+  ADCTrajectory trajectory;
+  const double planning_period = 1.0 / FLAGS_planning_loop_rate;
+  const double control_period = FLAGS_sim_control_interval_ms / 1000.0;
+  const double start_time = time;
+  double next_planning_time = time;
+  double distance = 0.0;
+  const auto wall_start_time = std::chrono::steady_clock::now();
+  while (time - start_time < FLAGS_sim_max_time_sec) {
+    const TrajectoryPoint last_point = point;
+    point = FollowTrajectory(trajectory, last_point, time);
+    distance += std::hypot(
+        point.path_point().x() - last_point.path_point().x(),
+        point.path_point().y() - last_point.path_point().y());
+
+    if (time >= next_planning_time) {
+      local_view.localization_estimate = MakeLocalization(point);
+      const auto gear =
+          trajectory.has_gear() ? trajectory.gear() : Chassis::GEAR_DRIVE;
+      local_view.chassis = MakeChassis(point, gear);
+      local_view.prediction_obstacles = std::make_shared<PredictionObstacles>();
+      FillHeader("SimPrediction", local_view.prediction_obstacles.get());
+
+      BenchmarkCycle* cycle = result->add_cycle();
+      const auto cycle_start_time = std::chrono::steady_clock::now();
+      trajectory.Clear();
+      planning.RunOnce(local_view, &trajectory);
+      cycle->set_time_ms(std::chrono::duration<double, std::milli>(
+                             std::chrono::steady_clock::now() -
+                             cycle_start_time)
+                             .count());
+      cycle->set_timestamp_sec(time);
+      cycle->mutable_latency_stats()->CopyFrom(trajectory.latency_stats());
+      local_view.is_new_routing = false;
+      next_planning_time += planning_period;
+
+      if (trajectory.decision().main_decision().has_mission_complete()) {
+        result->set_mission_complete(true);
+        break;
+      }
+    }
+
+    time += control_period;
+    Clock::SetNowInSeconds(time);
+  }
+
+  result->set_simulated_time_sec(time - start_time);
+  result->set_wall_time_sec(std::chrono::duration<double>(
+                                std::chrono::steady_clock::now() -
+                                wall_start_time)
+                                .count());
+  result->set_distance_m(distance);
+
+  // The cycle summary is shared with the planning benchmark.
+  BenchmarkResult benchmark;
+  benchmark.mutable_cycle()->Swap(result->mutable_cycle());
+  SummarizeBenchmark(&benchmark);
+  result->mutable_summary()->Swap(benchmark.mutable_summary());
+  result->mutable_cycle()->Swap(benchmark.mutable_cycle());
+
+  AINFO << routing_file << ": "
+        << (result->mission_complete() ? "completed" : "did not complete")
+        << " " << result->distance_m() << " m in "
+        << result->simulated_time_sec() << " simulated s, "
+        << result->wall_time_sec() << " wall s";
+  return true;
+}
+
+int Run() {
+  PlanningConfig config;
+  if (!cyber::common::GetProtoFromFile(FLAGS_planning_config_file, &config)) {
+    AERROR << "Failed to load planning config " << FLAGS_planning_config_file;
+    return EXIT_FAILURE;
+  }
+
+  // The simulated clock only moves between the steps, and the reference line
+  // is built in the planning thread so that each cycle sees its own.
+  Clock::SetMode(Clock::MOCK);
+  FLAGS_enable_reference_line_provider_thread = false;
+
+  int num_incomplete = 0;
+  ClosedLoopReport report;
+  for (const auto& routing_file : common::util::StringTokenizer::Split(
+           FLAGS_sim_routing_files, ",")) {
+    ClosedLoopResult* result = report.add_result();
+    if (!Drive(routing_file, config, result)) {
+      return EXIT_FAILURE;
+    }
+    if (!result->mission_complete()) {
+      ++num_incomplete;
+    }
+  }
+  if (!FLAGS_sim_result_file.empty() &&
+      !cyber::common::SetProtoToASCIIFile(report, FLAGS_sim_result_file)) {
+    AERROR << "Failed to write " << FLAGS_sim_result_file;
+    return EXIT_FAILURE;
+  }
+  return num_incomplete == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+}  // namespace
+}  // namespace planning
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  apollo::cyber::Init(argv[0]);
+  return apollo::planning::Run();
+}
@@ -0,0 +1,267 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Replays the planning inputs of cyber records through OnLanePlanning
+ *        and reports the latency and the allocations of every cycle.
+ *
+ * Example:
+ *   planning_benchmark --flagfile=modules/planning/conf/planning.conf \
+ *       --benchmark_record_files=a.record,b.record \
+ *       --benchmark_result_file=/tmp/result.pb.txt \
+ *       --benchmark_baseline_file=/tmp/baseline.pb.txt
+ **/
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "gflags/gflags.h"
+
+#include "cyber/common/file.h"
+#include "cyber/common/log.h"
+#include "cyber/cyber.h"
+#include "cyber/record/record_reader.h"
+#include "modules/canbus/proto/chassis.pb.h"
+#include "modules/common/adapters/adapter_gflags.h"
+#include "modules/common/time/time.h"
+#include "modules/common/util/string_tokenizer.h"
+#include "modules/localization/proto/localization.pb.h"
+#include "modules/map/pnc_map/pnc_map.h"
+#include "modules/perception/proto/traffic_light_detection.pb.h"
+#include "modules/planning/benchmark/benchmark_stats.h"
+#include "modules/planning/common/planning_gflags.h"
+#include "modules/planning/on_lane_planning.h"
+#include "modules/planning/proto/planning_benchmark.pb.h"
+#include "modules/prediction/proto/prediction_obstacle.pb.h"
+#include "modules/routing/proto/routing.pb.h"
+
+DEFINE_string(benchmark_record_files, "",
+              "the comma separated cyber records to replay");
+DEFINE_string(benchmark_result_file, "",
+              "the file to write the benchmark report to, in text format");
+DEFINE_string(benchmark_baseline_file, "",
+              "the benchmark report to compare the results with");
+DEFINE_bool(benchmark_keep_cycles, true,
+            "whether to keep the stats of every cycle in the report");
+DEFINE_int32(benchmark_warmup_cycles, 5,
+             "the cycles of every record left out of the results");
+DEFINE_double(benchmark_max_regression_ratio, 0.1,
+              "the ratio over the baseline reported as a regression");
+DEFINE_double(benchmark_min_regression_ms, 1.0,
+              "the latency over the baseline below which is taken as noise");
+
+namespace {
+
+std::atomic<uint64_t> num_allocations(0);
+std::atomic<uint64_t> allocated_bytes(0);
+
+}  // namespace
+
+// Counts the heap allocations of the whole process. The array and sized
+// forms of the operators fall back to these.
+void* operator new(std::size_t size) {
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  void* ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+namespace apollo {
+namespace planning {
+
+using apollo::canbus::Chassis;
+using apollo::common::time::Clock;
+using apollo::cyber::record::RecordMessage;
+using apollo::cyber::record::RecordReader;
+using apollo::localization::LocalizationEstimate;
+using apollo::perception::TrafficLightDetection;
+using apollo::prediction::PredictionObstacles;
+using apollo::routing::RoutingResponse;
+
+namespace {
+
+template <typename T>
+std::shared_ptr<T> ParseMessage(const RecordMessage& message) {
+  auto proto = std::make_shared<T>();
+  if (!proto->ParseFromString(message.content)) {
+    AERROR << "Failed to parse a message of " << message.channel_name;
+    return nullptr;
+  }
+  return proto;
+}
+
+void RunCycle(const LocalView& local_view, OnLanePlanning* planning,
+              BenchmarkCycle* cycle) {
+  const double timestamp =
+      local_view.localization_estimate->header().timestamp_sec();
+  Clock::SetNowInSeconds(timestamp);
+
+  ADCTrajectory trajectory;
+  const uint64_t start_num_allocations = num_allocations.load();
+  const uint64_t start_allocated_bytes = allocated_bytes.load();
+  const auto start_time = std::chrono::steady_clock::now();
+  planning->RunOnce(local_view, &trajectory);
+  const auto end_time = std::chrono::steady_clock::now();
+
+  cycle->set_timestamp_sec(timestamp);
+  cycle->set_time_ms(
+      std::chrono::duration<double, std::milli>(end_time - start_time)
+          .count());
+  cycle->set_num_allocations(num_allocations.load() - start_num_allocations);
+  cycle->set_allocated_bytes(allocated_bytes.load() - start_allocated_bytes);
+  cycle->mutable_latency_stats()->CopyFrom(trajectory.latency_stats());
+}
+
+// Feeds the record to a new OnLanePlanning the way PlanningComponent does:
+// a cycle runs on every prediction message, with the last received messages
+// of the other channels.
+bool ReplayRecord(const std::string& record_file, const PlanningConfig& config,
+                  BenchmarkResult* const result) {
+  RecordReader reader(record_file);
+  if (!reader.IsValid()) {
+    AERROR << "Failed to open record " << record_file;
+    return false;
+  }
+  OnLanePlanning planning;
+  const auto status = planning.Init(config);
+  if (!status.ok()) {
+    AERROR << "Failed to init planning: " << status.ToString();
+    return false;
+  }
+  result->set_record_file(record_file);
+
+  LocalView local_view;
+  local_view.traffic_light = std::make_shared<TrafficLightDetection>();
+  int num_cycles = 0;
+  RecordMessage message;
+  while (reader.ReadMessage(&message)) {
+    if (message.channel_name == FLAGS_localization_topic) {
+      local_view.localization_estimate =
+          ParseMessage<LocalizationEstimate>(message);
+    } else if (message.channel_name == FLAGS_chassis_topic) {
+      local_view.chassis = ParseMessage<Chassis>(message);
+    } else if (message.channel_name == FLAGS_traffic_light_detection_topic) {
+      auto traffic_light = ParseMessage<TrafficLightDetection>(message);
+      if (traffic_light != nullptr) {
+        local_view.traffic_light = traffic_light;
+      }
+    } else if (message.channel_name == FLAGS_routing_response_topic) {
+      auto routing = ParseMessage<RoutingResponse>(message);
+      if (routing != nullptr &&
+          (local_view.routing == nullptr ||
+           hdmap::PncMap::IsNewRouting(*local_view.routing, *routing))) {
+        local_view.routing = routing;
+        local_view.is_new_routing = true;
+      }
+    } else if (message.channel_name == FLAGS_prediction_topic) {
+      local_view.prediction_obstacles =
+          ParseMessage<PredictionObstacles>(message);
+      if (local_view.prediction_obstacles == nullptr ||
+          local_view.localization_estimate == nullptr ||
+          local_view.chassis == nullptr || local_view.routing == nullptr) {
+        continue;
+      }
+      BenchmarkCycle cycle;
+      RunCycle(local_view, &planning, &cycle);
+      local_view.is_new_routing = false;
+      if (++num_cycles > FLAGS_benchmark_warmup_cycles) {
+        result->add_cycle()->Swap(&cycle);
+      }
+    }
+  }
+  SummarizeBenchmark(result);
+  if (!FLAGS_benchmark_keep_cycles) {
+    result->clear_cycle();
+  }
+  AINFO << record_file << ": " << result->summary().DebugString();
+  return true;
+}
+
+int Run() {
+  PlanningConfig config;
+  if (!cyber::common::GetProtoFromFile(FLAGS_planning_config_file, &config)) {
+    AERROR << "Failed to load planning config " << FLAGS_planning_config_file;
+    return EXIT_FAILURE;
+  }
+  BenchmarkReport baseline;
+  if (!FLAGS_benchmark_baseline_file.empty() &&
+      !cyber::common::GetProtoFromFile(FLAGS_benchmark_baseline_file,
+                                       &baseline)) {
+    AERROR << "Failed to load baseline " << FLAGS_benchmark_baseline_file;
+    return EXIT_FAILURE;
+  }
+
+  // The replay clock starts from the record time of every cycle, and still
+  // runs to time the tasks. The reference line is built in the planning
+  // thread, so that its time is part of every cycle.
+  Clock::SetMode(Clock::REPLAY);
+  FLAGS_enable_reference_line_provider_thread = false;
+
+  BenchmarkReport report;
+  const auto record_files = common::util::StringTokenizer::Split(
+      FLAGS_benchmark_record_files, ",");
+  for (const auto& record_file : record_files) {
+    if (!ReplayRecord(record_file, config, report.add_result())) {
+      return EXIT_FAILURE;
+    }
+  }
+  if (!FLAGS_benchmark_result_file.empty() &&
+      !cyber::common::SetProtoToASCIIFile(report,
+                                          FLAGS_benchmark_result_file)) {
+    AERROR << "Failed to write " << FLAGS_benchmark_result_file;
+    return EXIT_FAILURE;
+  }
+
+  int num_regressions = 0;
+  for (const auto& result : report.result()) {
+    for (const auto& baseline_result : baseline.result()) {
+      if (baseline_result.record_file() != result.record_file()) {
+        continue;
+      }
+      for (const auto& regression : CompareWithBaseline(
+               baseline_result.summary(), result.summary(),
+               FLAGS_benchmark_max_regression_ratio,
+               FLAGS_benchmark_min_regression_ms)) {
+        AERROR << result.record_file() << ": " << regression;
+        ++num_regressions;
+      }
+    }
+  }
+  AINFO << "Replayed " << record_files.size() << " records with "
+        << num_regressions << " regressions.";
+  return num_regressions == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+}  // namespace
+}  // namespace planning
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  apollo::cyber::Init(argv[0]);
+  return apollo::planning::Run();
+}
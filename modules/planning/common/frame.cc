@@ -320,6 +320,7 @@ const Obstacle *Frame::CreateStaticObstacle(
 
 const Obstacle *Frame::CreateStaticVirtualObstacle(const std::string &id,
                                                    const Box2d &box) {
+  std::lock_guard<std::mutex> lock(virtual_obstacle_mutex_);
   const auto *object = obstacles_.Find(id);
   if (object) {
     AWARN << "obstacle " << id << " already exist.";
@@ -373,13 +374,14 @@ Status Frame::InitFrameData() {
   //}
 
   if (FLAGS_align_prediction_time) {
-    auto prediction = *(local_view_.prediction_obstacles);
-    AlignPredictionTime(vehicle_state_.timestamp(), &prediction);
-    local_view_.prediction_obstacles->CopyFrom(prediction);
+    AlignPredictionTime(vehicle_state_.timestamp(),
+                        local_view_.prediction_obstacles.get());
   }
-  for (auto &ptr :
-       Obstacle::CreateObstacles(*local_view_.prediction_obstacles)) {
-    AddObstacle(*ptr);
+  // the obstacles are moved in, as their prediction trajectories are large
+  auto obstacles = Obstacle::CreateObstacles(*local_view_.prediction_obstacles);
+  obstacles_.Reserve(obstacles.size());
+  for (auto &ptr : obstacles) {
+    AddObstacle(std::move(*ptr));
   }
   if (FLAGS_enable_collision_detection && planning_start_point_.v() < 1e-3) {
     const auto *collision_obstacle = FindCollisionObstacle();
@@ -477,8 +479,8 @@ void Frame::AlignPredictionTime(const double planning_start_time,
 
 Obstacle *Frame::Find(const std::string &id) { return obstacles_.Find(id); }
 
-void Frame::AddObstacle(const Obstacle &obstacle) {
-  obstacles_.Add(obstacle.Id(), obstacle);
+void Frame::AddObstacle(Obstacle &&obstacle) {
+  obstacles_.Add(obstacle.Id(), std::move(obstacle));
 }
 
 const ReferenceLineInfo *Frame::FindDriveReferenceLineInfo() {
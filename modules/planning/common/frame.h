@@ -22,6 +22,7 @@
 
 #include <list>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -82,6 +83,8 @@ class Frame {
 
   uint32_t SequenceNum() const;
 
+  double start_time() const { return start_time_; }
+
   std::string DebugString() const;
 
   const PublishableTrajectory &ComputedTrajectory() const;
@@ -179,7 +182,7 @@ class Frame {
   const Obstacle *CreateStaticVirtualObstacle(const std::string &id,
                                               const common::math::Box2d &box);
 
-  void AddObstacle(const Obstacle &obstacle);
+  void AddObstacle(Obstacle &&obstacle);
 
  private:
   uint32_t sequence_num_ = 0;
@@ -199,6 +202,9 @@ class Frame {
   const ReferenceLineInfo *drive_reference_line_info_ = nullptr;
 
   ThreadSafeIndexedObstacles obstacles_;
+  // makes the check and creation of a virtual obstacle atomic, as reference
+  // lines may be planned in parallel.
+  std::mutex virtual_obstacle_mutex_;
   ChangeLaneDecider change_lane_decider_;
   ADCTrajectory trajectory_;  // last published trajectory
 
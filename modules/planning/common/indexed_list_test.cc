@@ -50,6 +50,19 @@ TEST(IndexedList, Add_ConstRef) {
   }
 }
 
+TEST(IndexedList, Add_Move) {
+  StringIndexedList object;
+  object.Reserve(2);
+  std::string one = "one";
+  ASSERT_NE(nullptr, object.Add(1, std::move(one)));
+  std::string one_again = "one_again";
+  ASSERT_NE(nullptr, object.Add(1, std::move(one_again)));
+  const auto& items = object.Items();
+  ASSERT_EQ(1, items.size());
+  ASSERT_EQ("one_again", *items[0]);
+  ASSERT_EQ("one_again", *object.Find(1));
+}
+
 TEST(IndexedList, Find) {
   StringIndexedList object;
   object.Add(1, "one");
@@ -23,6 +23,7 @@ namespace planning {
 
 PlanningStatus PlanningContext::planning_status_;
 PlanningContext::ScenarioInfo PlanningContext::scenario_info_;
+std::mutex PlanningContext::mutex_;
 
 PlanningContext::PlanningContext() {}
 
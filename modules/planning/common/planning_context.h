@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -70,9 +71,16 @@ class PlanningContext {
 
   static ScenarioInfo* GetScenarioInfo() { return &scenario_info_; }
 
+  /**
+   * @brief The mutex to hold while changing the context from a task, as
+   * reference lines may be planned in parallel.
+   */
+  static std::mutex& Mutex() { return mutex_; }
+
  private:
   static PlanningStatus planning_status_;
   static ScenarioInfo scenario_info_;
+  static std::mutex mutex_;
 
   // this is a singleton class
   DECLARE_SINGLETON(PlanningContext)
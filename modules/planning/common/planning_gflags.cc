@@ -106,6 +106,12 @@ DEFINE_double(reference_line_stitch_overlap_distance, 20,
 DEFINE_double(reference_line_lateral_buffer, 0.5,
               "When creating reference line, the minimum distance with road "
               "curb for a vehicle driving on this line.");
+DEFINE_bool(enable_reference_line_projection_index, false,
+            "Build a spatial index on each reference line of a frame, so that "
+            "projections onto it do not scan every segment.");
+DEFINE_bool(enable_reference_line_smoothing_cache, false,
+            "Keep the last smoothed reference lines, so that a route segment "
+            "seen again is reused or stitched to instead of smoothed again.");
 
 DEFINE_bool(enable_smooth_reference_line, true,
             "enable smooth the map reference line");
@@ -113,6 +119,9 @@ DEFINE_bool(enable_smooth_reference_line, true,
 DEFINE_bool(prioritize_change_lane, false,
             "change lane strategy has higher priority, always use a valid "
             "change lane path if such path exists");
+DEFINE_bool(enable_parallel_reference_line_planning, false,
+            "Plan the drivable reference lines at the same time on the task "
+            "pool, each with its own tasks.");
 DEFINE_bool(reckless_change_lane, false,
             "Always allow the vehicle change lane. The vehicle may continue "
             "changing lane. This is mainly test purpose");
@@ -302,6 +311,9 @@ DEFINE_bool(use_multi_thread_to_add_obstacles, false,
 DEFINE_bool(
     enable_multi_thread_in_dp_poly_path, false,
     "Enable multiple thread to calculation curve cost in dp_poly_path.");
+DEFINE_bool(enable_dp_road_graph_reuse, false,
+            "Reuse the edge costs of the last frame in dp_poly_path when the "
+            "static obstacles around an edge did not change.");
 DEFINE_bool(enable_multi_thread_in_dp_st_graph, false,
             "Enable multiple thread to calculation curve cost in dp_st_graph.");
 
@@ -321,6 +333,12 @@ DEFINE_bool(enable_backup_trajectory, true,
             "If generate backup trajectory when planning fail");
 DEFINE_double(backup_trajectory_cost, 1000.0,
               "Default cost of backup trajectory");
+DEFINE_bool(enable_parallel_lattice_evaluation, false,
+            "Score lattice trajectory pairs on the task pool, pruning pairs "
+            "by their lon. cost bound, and check the best ones in parallel.");
+DEFINE_int32(lattice_speculative_check_num, 8,
+             "Number of best lattice trajectory pairs checked for constraints "
+             "and collision at once in parallel lattice evaluation.");
 DEFINE_double(min_velocity_sample_gap, 1.0,
               "Minimal sampling gap for velocity");
 DEFINE_double(lon_collision_buffer, 2.0,
@@ -445,6 +463,10 @@ DEFINE_bool(use_osqp_optimizer_for_reference_line, true,
             "Use OSQP optimizer for reference line optimization.");
 DEFINE_bool(enable_osqp_debug, false,
             "True to turn on OSQP verbose debug output in log.");
+DEFINE_bool(enable_osqp_workspace_reuse, true,
+            "True to update the OSQP workspace of the last solve in place, "
+            "and warm start from its solution, when the problem structure "
+            "did not change.");
 
 DEFINE_bool(export_chart, false, "export chart in planning");
 DEFINE_bool(enable_record_debug, true,
@@ -51,10 +51,13 @@ DECLARE_bool(enable_reference_line_stitching);
 DECLARE_double(look_forward_extend_distance);
 DECLARE_double(reference_line_stitch_overlap_distance);
 DECLARE_double(reference_line_lateral_buffer);
+DECLARE_bool(enable_reference_line_projection_index);
+DECLARE_bool(enable_reference_line_smoothing_cache);
 
 DECLARE_bool(enable_smooth_reference_line);
 
 DECLARE_bool(prioritize_change_lane);
+DECLARE_bool(enable_parallel_reference_line_planning);
 DECLARE_bool(reckless_change_lane);
 DECLARE_double(change_lane_fail_freeze_time);
 DECLARE_double(change_lane_success_freeze_time);
@@ -153,6 +156,7 @@ DECLARE_bool(enable_sqp_solver);
 DECLARE_uint32(max_planning_thread_pool_size);
 DECLARE_bool(use_multi_thread_to_add_obstacles);
 DECLARE_bool(enable_multi_thread_in_dp_poly_path);
+DECLARE_bool(enable_dp_road_graph_reuse);
 DECLARE_bool(enable_multi_thread_in_dp_st_graph);
 
 // lattice planner
@@ -167,6 +171,8 @@ DECLARE_double(decision_horizon);
 DECLARE_uint32(num_velocity_sample);
 DECLARE_bool(enable_backup_trajectory);
 DECLARE_double(backup_trajectory_cost);
+DECLARE_bool(enable_parallel_lattice_evaluation);
+DECLARE_int32(lattice_speculative_check_num);
 DECLARE_double(min_velocity_sample_gap);
 DECLARE_double(lon_collision_buffer);
 DECLARE_double(lat_collision_buffer);
@@ -231,6 +237,7 @@ DECLARE_bool(use_gear_shift_trajectory);
 DECLARE_bool(use_osqp_optimizer_for_qp_st);
 DECLARE_bool(use_osqp_optimizer_for_reference_line);
 DECLARE_bool(enable_osqp_debug);
+DECLARE_bool(enable_osqp_workspace_reuse);
 DECLARE_bool(export_chart);
 DECLARE_bool(enable_record_debug);
 
@@ -21,6 +21,7 @@
 #include "modules/planning/common/reference_line_info.h"
 
 #include <algorithm>
+#include <functional>
 
 #include "cyber/task/task.h"
 #include "modules/planning/proto/sl_boundary.pb.h"
@@ -51,7 +52,11 @@ ReferenceLineInfo::ReferenceLineInfo(const common::VehicleState& vehicle_state,
     : vehicle_state_(vehicle_state),
       adc_planning_point_(adc_planning_point),
       reference_line_(reference_line),
-      lanes_(segments) {}
+      lanes_(segments) {
+  if (FLAGS_enable_reference_line_projection_index) {
+    reference_line_.BuildProjectionIndex();
+  }
+}
 
 bool ReferenceLineInfo::Init(const std::vector<const Obstacle*>& obstacles) {
   const auto& param = VehicleConfigHelper::GetConfig().vehicle_param();
@@ -360,32 +365,49 @@ Obstacle* ReferenceLineInfo::AddObstacle(const Obstacle* obstacle) {
   return mutable_obstacle;
 }
 
-bool ReferenceLineInfo::AddObstacles(
-    const std::vector<const Obstacle*>& obstacles) {
-  if (FLAGS_use_multi_thread_to_add_obstacles) {
-    std::vector<std::future<Obstacle*>> results;
-    for (const auto* obstacle : obstacles) {
-      results.push_back(
-          cyber::Async(&ReferenceLineInfo::AddObstacle, this, obstacle));
-    }
-    for (auto& result : results) {
-      if (!result.get()) {
-        AERROR << "Fail to add obstacles.";
-        return false;
-      }
-    }
-  } else {
-    for (const auto* obstacle : obstacles) {
-      if (!AddObstacle(obstacle)) {
-        AERROR << "Failed to add obstacle " << obstacle->Id();
-        return false;
-      }
+bool ReferenceLineInfo::AddObstacleRange(
+    const std::vector<const Obstacle*>& obstacles, const size_t begin,
+    const size_t end) {
+  for (size_t i = begin; i < end; ++i) {
+    if (!AddObstacle(obstacles[i])) {
+      AERROR << "Failed to add obstacle "
+             << (obstacles[i] ? obstacles[i]->Id() : "");
+      return false;
     }
   }
-
   return true;
 }
 
+bool ReferenceLineInfo::AddObstacles(
+    const std::vector<const Obstacle*>& obstacles) {
+  if (!FLAGS_use_multi_thread_to_add_obstacles || obstacles.size() < 2) {
+    return AddObstacleRange(obstacles, 0, obstacles.size());
+  }
+
+  // one task per block of obstacles rather than per obstacle, so that the
+  // tasks stay within the thread pool in scenes with hundreds of obstacles.
+  const size_t num_tasks = std::min<size_t>(
+      obstacles.size(), std::max(FLAGS_max_planning_thread_pool_size, 1u));
+  const size_t block_size = (obstacles.size() + num_tasks - 1) / num_tasks;
+  std::vector<std::future<bool>> results;
+  results.reserve(num_tasks);
+  for (size_t begin = 0; begin < obstacles.size(); begin += block_size) {
+    results.push_back(
+        cyber::Async(&ReferenceLineInfo::AddObstacleRange, this,
+                     std::cref(obstacles), begin,
+                     std::min(begin + block_size, obstacles.size())));
+  }
+  // waits for all the tasks, which use this reference line info
+  bool is_ok = true;
+  for (auto& result : results) {
+    is_ok = result.get() && is_ok;
+  }
+  if (!is_ok) {
+    AERROR << "Fail to add obstacles.";
+  }
+  return is_ok;
+}
+
 bool ReferenceLineInfo::IsUnrelaventObstacle(const Obstacle* obstacle) {
   // if adc is on the road, and obstacle behind adc, ignore
   if (obstacle->PerceptionSLBoundary().end_s() > reference_line_.Length()) {
@@ -204,6 +204,10 @@ class ReferenceLineInfo {
 
   bool AddObstacleHelper(const std::shared_ptr<Obstacle>& obstacle);
 
+  // adds obstacles[begin, end)
+  bool AddObstacleRange(const std::vector<const Obstacle*>& obstacles,
+                        const size_t begin, const size_t end);
+
   bool GetFirstOverlap(const std::vector<hdmap::PathOverlap>& path_overlaps,
                        hdmap::PathOverlap* path_overlap);
 
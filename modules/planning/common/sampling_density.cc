@@ -0,0 +1,86 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/common/sampling_density.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "modules/common/time/time.h"
+#include "modules/planning/common/planning_gflags.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::time::Clock;
+
+double SamplingDensity::Scale(const size_t num_nearby_obstacles,
+                              const double remaining_time_ms) const {
+  if (!config_.enabled()) {
+    return 1.0;
+  }
+  const double min_scale = std::min(config_.min_density_scale(), 1.0);
+  if (remaining_time_ms < config_.min_remaining_time_ms()) {
+    return min_scale;
+  }
+  const double full = std::max(config_.obstacles_for_full_density(), 1u);
+  const double ratio = static_cast<double>(num_nearby_obstacles) / full;
+  if (ratio <= 1.0) {
+    return min_scale + (1.0 - min_scale) * ratio;
+  }
+  const double max_scale = std::max(config_.max_density_scale(), 1.0);
+  return 1.0 + (max_scale - 1.0) * std::min(ratio - 1.0, 1.0);
+}
+
+size_t SamplingDensity::CountNearbyObstacles(
+    const std::vector<const Obstacle*>& obstacles,
+    const SLBoundary& adc_sl_boundary) const {
+  const double start_s =
+      adc_sl_boundary.start_s() - config_.obstacle_distance();
+  const double end_s = adc_sl_boundary.end_s() + config_.obstacle_distance();
+  size_t num_obstacles = 0;
+  for (const auto* obstacle : obstacles) {
+    if (obstacle->IsVirtual()) {
+      continue;
+    }
+    const auto& sl_boundary = obstacle->PerceptionSLBoundary();
+    if (sl_boundary.end_s() < start_s || sl_boundary.start_s() > end_s) {
+      continue;
+    }
+    ++num_obstacles;
+  }
+  return num_obstacles;
+}
+
+uint32_t SamplingDensity::ScaleCount(const uint32_t count, const double scale,
+                                     const uint32_t min_count) {
+  const auto scaled_count =
+      static_cast<uint32_t>(std::lround(static_cast<double>(count) * scale));
+  return std::max(scaled_count, std::min(count, min_count));
+}
+
+double SamplingDensity::RemainingCycleTimeMs(const double start_time) {
+  const double cycle_time_ms = 1000.0 / FLAGS_planning_loop_rate;
+  return cycle_time_ms - (Clock::NowInSeconds() - start_time) * 1000.0;
+}
+
+}  // namespace planning
+}  // namespace apollo
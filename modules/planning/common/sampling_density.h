@@ -0,0 +1,80 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ **/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "modules/planning/proto/adaptive_sampling_config.pb.h"
+#include "modules/planning/proto/sl_boundary.pb.h"
+
+#include "modules/planning/common/obstacle.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class SamplingDensity
+ * @brief Picks the sampling density of a dp optimizer for one planning cycle.
+ *
+ * Few obstacles around the adc, as on a highway, need fewer samples than
+ * dense traffic, and a cycle which is already late should not spend its
+ * remaining time on a fine grid. The scale never goes below the configured
+ * min scale, which bounds the loss of resolution.
+ */
+class SamplingDensity {
+ public:
+  explicit SamplingDensity(const AdaptiveSamplingConfig& config)
+      : config_(config) {}
+
+  /**
+   * @brief Gets the scale of the configured sample counts, 1.0 if disabled.
+   * @param num_nearby_obstacles the obstacles counted by CountNearbyObstacles
+   * @param remaining_time_ms the time left in the planning cycle
+   */
+  double Scale(const size_t num_nearby_obstacles,
+               const double remaining_time_ms) const;
+
+  /**
+   * @brief Counts the non virtual obstacles within the configured distance
+   *        in s of the adc.
+   */
+  size_t CountNearbyObstacles(const std::vector<const Obstacle*>& obstacles,
+                              const SLBoundary& adc_sl_boundary) const;
+
+  /**
+   * @brief Scales a sample count, keeping at least min_count samples.
+   */
+  static uint32_t ScaleCount(const uint32_t count, const double scale,
+                             const uint32_t min_count);
+
+  /**
+   * @brief Gets the time left in the planning cycle started at start_time.
+   */
+  static double RemainingCycleTimeMs(const double start_time);
+
+ private:
+  const AdaptiveSamplingConfig& config_;
+};
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,62 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/common/sampling_density.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace planning {
+
+TEST(SamplingDensityTest, disabled) {
+  AdaptiveSamplingConfig config;
+  SamplingDensity density(config);
+  EXPECT_DOUBLE_EQ(1.0, density.Scale(0, 100.0));
+  EXPECT_DOUBLE_EQ(1.0, density.Scale(10, 0.0));
+}
+
+TEST(SamplingDensityTest, scale) {
+  AdaptiveSamplingConfig config;
+  config.set_enabled(true);
+  config.set_obstacles_for_full_density(4);
+  config.set_min_density_scale(0.5);
+  config.set_max_density_scale(1.5);
+  config.set_min_remaining_time_ms(30.0);
+  SamplingDensity density(config);
+  EXPECT_DOUBLE_EQ(0.5, density.Scale(0, 100.0));
+  EXPECT_DOUBLE_EQ(0.75, density.Scale(2, 100.0));
+  EXPECT_DOUBLE_EQ(1.0, density.Scale(4, 100.0));
+  EXPECT_DOUBLE_EQ(1.25, density.Scale(6, 100.0));
+  EXPECT_DOUBLE_EQ(1.5, density.Scale(20, 100.0));
+  // a late cycle always uses the min density
+  EXPECT_DOUBLE_EQ(0.5, density.Scale(20, 10.0));
+}
+
+TEST(SamplingDensityTest, scale_count) {
+  EXPECT_EQ(9, SamplingDensity::ScaleCount(9, 1.0, 3));
+  EXPECT_EQ(5, SamplingDensity::ScaleCount(9, 0.5, 3));
+  EXPECT_EQ(3, SamplingDensity::ScaleCount(9, 0.1, 3));
+  EXPECT_EQ(2, SamplingDensity::ScaleCount(2, 0.1, 3));
+  EXPECT_EQ(150, SamplingDensity::ScaleCount(100, 1.5, 3));
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -20,6 +20,8 @@
 
 #include "modules/planning/common/trajectory/discretized_trajectory.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 #include "cyber/common/log.h"
@@ -43,13 +45,52 @@ DiscretizedTrajectory::DiscretizedTrajectory(const ADCTrajectory& trajectory) {
          trajectory.trajectory_point().end());
 }
 
-TrajectoryPoint DiscretizedTrajectory::Evaluate(
+size_t DiscretizedTrajectory::LowerBoundIndex(
     const double relative_time) const {
+  const size_t num_points = size();
+  auto is_lower_bound = [&](const size_t i) {
+    return (i == num_points || data()[i].relative_time() >= relative_time) &&
+           (i == 0 || data()[i - 1].relative_time() < relative_time);
+  };
+
+  // Planning publishes trajectories sampled at a fixed time step, so the
+  // index is guessed from the time first, and searched only if the guess is
+  // off.
+  if (num_points >= 2) {
+    const double start_time = front().relative_time();
+    const double time_step = (back().relative_time() - start_time) /
+                             static_cast<double>(num_points - 1);
+    if (time_step > 0.0) {
+      const double guess =
+          std::ceil((relative_time - start_time) / time_step);
+      // also takes nan to the front
+      const size_t i =
+          !(guess > 0.0) ? 0
+                         : guess >= static_cast<double>(num_points)
+                               ? num_points
+                               : static_cast<size_t>(guess);
+      if (is_lower_bound(i)) {
+        return i;
+      }
+      if (i < num_points && is_lower_bound(i + 1)) {
+        return i + 1;
+      }
+      if (i > 0 && is_lower_bound(i - 1)) {
+        return i - 1;
+      }
+    }
+  }
+
   auto comp = [](const TrajectoryPoint& p, const double relative_time) {
     return p.relative_time() < relative_time;
   };
+  return std::distance(begin(),
+                       std::lower_bound(begin(), end(), relative_time, comp));
+}
 
-  auto it_lower = std::lower_bound(begin(), end(), relative_time, comp);
+TrajectoryPoint DiscretizedTrajectory::Evaluate(
+    const double relative_time) const {
+  auto it_lower = begin() + LowerBoundIndex(relative_time);
 
   if (it_lower == begin()) {
     return front();
@@ -69,11 +110,7 @@ size_t DiscretizedTrajectory::QueryLowerBoundPoint(
   if (relative_time >= back().relative_time()) {
     return size() - 1;
   }
-  auto func = [](const TrajectoryPoint& tp, const double relative_time) {
-    return tp.relative_time() < relative_time;
-  };
-  auto it_lower = std::lower_bound(begin(), end(), relative_time, func);
-  return std::distance(begin(), it_lower);
+  return LowerBoundIndex(relative_time);
 }
 
 size_t DiscretizedTrajectory::QueryNearestPoint(
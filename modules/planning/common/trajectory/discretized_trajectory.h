@@ -78,6 +78,14 @@ class DiscretizedTrajectory : public std::vector<common::TrajectoryPoint> {
   size_t NumOfPoints() const;
 
   virtual void Clear();
+
+ protected:
+  /**
+   * @brief The index of the first point not earlier than "relative_time", or
+   *        the number of points if there is none. It takes O(1) on uniformly
+   *        sampled trajectories.
+   */
+  size_t LowerBoundIndex(const double relative_time) const;
 };
 
 inline size_t DiscretizedTrajectory::NumOfPoints() const { return size(); }
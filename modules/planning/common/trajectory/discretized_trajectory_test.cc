@@ -20,6 +20,8 @@
 
 #include "modules/planning/common/trajectory/discretized_trajectory.h"
 
+#include <algorithm>
+
 #include "cyber/common/file.h"
 #include "gtest/gtest.h"
 
@@ -52,5 +54,39 @@ TEST(basic_test, DiscretizedTrajectory) {
   EXPECT_EQ(discretized_trajectory.NumOfPoints(), 121);
 }
 
+TEST(basic_test, QueryLowerBoundPoint) {
+  // uniformly sampled, and with an uneven gap
+  for (const double gap : {0.1, 0.35}) {
+    DiscretizedTrajectory discretized_trajectory;
+    for (int i = 0; i < 50; ++i) {
+      common::TrajectoryPoint point;
+      point.set_relative_time(-1.0 + i * 0.1 + (i >= 20 ? gap - 0.1 : 0.0));
+      point.mutable_path_point()->set_s(i * 0.5);
+      discretized_trajectory.AppendTrajectoryPoint(point);
+    }
+    auto comp = [](const common::TrajectoryPoint& p, const double t) {
+      return p.relative_time() < t;
+    };
+    for (double t = -1.5; t < 5.0; t += 0.01) {
+      const auto expected = std::lower_bound(discretized_trajectory.begin(),
+                                             discretized_trajectory.end(), t,
+                                             comp);
+      const size_t index = discretized_trajectory.QueryLowerBoundPoint(t);
+      if (expected == discretized_trajectory.end()) {
+        EXPECT_EQ(discretized_trajectory.NumOfPoints() - 1, index);
+      } else {
+        EXPECT_EQ(
+            static_cast<size_t>(expected - discretized_trajectory.begin()),
+            index);
+      }
+    }
+    // on the points
+    for (size_t i = 0; i < discretized_trajectory.NumOfPoints(); ++i) {
+      EXPECT_EQ(i, discretized_trajectory.QueryLowerBoundPoint(
+                       discretized_trajectory[i].relative_time()));
+    }
+  }
+}
+
 }  // namespace planning
 }  // namespace apollo
@@ -140,8 +140,8 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
     return ComputeReinitStitchingTrajectory(vehicle_state);
   }
 
-  auto time_matched_point = prev_trajectory->TrajectoryPointAt(
-      static_cast<uint32_t>(time_matched_index));
+  const auto& time_matched_point =
+      prev_trajectory->TrajectoryPointAt(time_matched_index);
 
   if (!time_matched_point.has_path_point()) {
     *replan_reason = "replan for previous trajectory missed path point";
@@ -183,10 +183,7 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
   }
 
   double forward_rel_time =
-      prev_trajectory
-          ->TrajectoryPointAt(static_cast<uint32_t>(time_matched_index))
-          .relative_time() +
-      planning_cycle_time;
+      time_matched_point.relative_time() + planning_cycle_time;
 
   size_t forward_time_index =
       prev_trajectory->QueryLowerBoundPoint(forward_rel_time);
@@ -197,22 +194,32 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
   auto matched_index = std::min(time_matched_index, position_matched_index);
 
   constexpr size_t kNumPreCyclePoint = 20;
-  std::vector<TrajectoryPoint> stitching_trajectory(
-      prev_trajectory->begin() +
-          std::max(0, static_cast<int>(matched_index - kNumPreCyclePoint)),
-      prev_trajectory->begin() + forward_time_index + 1);
-  ADEBUG << "stitching_trajectory size: " << stitching_trajectory.size();
-
-  const double zero_s = stitching_trajectory.back().path_point().s();
-  for (auto& tp : stitching_trajectory) {
-    if (!tp.has_path_point()) {
+  const size_t stitching_start_index =
+      matched_index > kNumPreCyclePoint ? matched_index - kNumPreCyclePoint
+                                        : 0;
+  const size_t stitching_end_index = forward_time_index + 1;
+
+  // checks the points in the previous trajectory before copying any
+  for (size_t i = stitching_start_index; i < stitching_end_index; ++i) {
+    if (!prev_trajectory->TrajectoryPointAt(i).has_path_point()) {
       *replan_reason = "replan for previous trajectory missed path point";
       return ComputeReinitStitchingTrajectory(vehicle_state);
     }
+  }
+
+  const double zero_s = prev_trajectory->TrajectoryPointAt(forward_time_index)
+                            .path_point()
+                            .s();
+  std::vector<TrajectoryPoint> stitching_trajectory;
+  stitching_trajectory.reserve(stitching_end_index - stitching_start_index);
+  for (size_t i = stitching_start_index; i < stitching_end_index; ++i) {
+    stitching_trajectory.push_back(prev_trajectory->TrajectoryPointAt(i));
+    auto& tp = stitching_trajectory.back();
     tp.set_relative_time(tp.relative_time() + prev_trajectory->header_time() -
                          current_timestamp);
     tp.mutable_path_point()->set_s(tp.path_point().s() - zero_s);
   }
+  ADEBUG << "stitching_trajectory size: " << stitching_trajectory.size();
   return stitching_trajectory;
 }
 
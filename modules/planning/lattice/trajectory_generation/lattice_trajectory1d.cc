@@ -28,22 +28,25 @@ namespace planning {
 LatticeTrajectory1d::LatticeTrajectory1d(
     std::shared_ptr<Curve1d> ptr_trajectory1d) {
   ptr_trajectory1d_ = ptr_trajectory1d;
+  param_length_ = ptr_trajectory1d_->ParamLength();
+  for (std::uint32_t order = 0; order < end_state_.size(); ++order) {
+    end_state_[order] = ptr_trajectory1d_->Evaluate(order, param_length_);
+  }
 }
 
 double LatticeTrajectory1d::Evaluate(const std::uint32_t order,
                                      const double param) const {
-  double param_length = ptr_trajectory1d_->ParamLength();
-  if (param < param_length) {
+  if (param < param_length_) {
     return ptr_trajectory1d_->Evaluate(order, param);
   }
 
   // do constant acceleration extrapolation;
   // to align all the trajectories with time.
-  double p = ptr_trajectory1d_->Evaluate(0, param_length);
-  double v = ptr_trajectory1d_->Evaluate(1, param_length);
-  double a = ptr_trajectory1d_->Evaluate(2, param_length);
+  const double p = end_state_[0];
+  const double v = end_state_[1];
+  const double a = end_state_[2];
 
-  double t = param - param_length;
+  double t = param - param_length_;
 
   switch (order) {
     case 0:
@@ -57,9 +60,7 @@ double LatticeTrajectory1d::Evaluate(const std::uint32_t order,
   }
 }
 
-double LatticeTrajectory1d::ParamLength() const {
-  return ptr_trajectory1d_->ParamLength();
-}
+double LatticeTrajectory1d::ParamLength() const { return param_length_; }
 
 std::string LatticeTrajectory1d::ToString() const {
   return ptr_trajectory1d_->ToString();
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <string>
 
@@ -61,6 +62,12 @@ class LatticeTrajectory1d : public Curve1d {
  private:
   std::shared_ptr<Curve1d> ptr_trajectory1d_;
 
+  double param_length_ = 0.0;
+
+  // position, velocity and acceleration at the end of the curve, used for
+  // the extrapolation beyond it.
+  std::array<double, 3> end_state_{{0.0, 0.0, 0.0}};
+
   double target_position_ = 0.0;
 
   double target_velocity_ = 0.0;
@@ -96,12 +96,15 @@ inline void Trajectory1dGenerator::GenerateTrajectory1DBundle<4>(
   CHECK_NOTNULL(ptr_trajectory_bundle);
   CHECK(!end_conditions.empty());
 
-  ptr_trajectory_bundle->reserve(end_conditions.size());
+  ptr_trajectory_bundle->reserve(ptr_trajectory_bundle->size() +
+                                 end_conditions.size());
   for (const auto& end_condition : end_conditions) {
     auto ptr_trajectory1d = std::make_shared<LatticeTrajectory1d>(
-        std::shared_ptr<Curve1d>(new QuarticPolynomialCurve1d(
-            init_state, {end_condition.first[1], end_condition.first[2]},
-            end_condition.second)));
+        std::make_shared<QuarticPolynomialCurve1d>(
+            init_state,
+            std::array<double, 2>{
+                {end_condition.first[1], end_condition.first[2]}},
+            end_condition.second));
 
     ptr_trajectory1d->set_target_velocity(end_condition.first[1]);
     ptr_trajectory1d->set_target_time(end_condition.second);
@@ -117,11 +120,12 @@ inline void Trajectory1dGenerator::GenerateTrajectory1DBundle<5>(
   CHECK_NOTNULL(ptr_trajectory_bundle);
   CHECK(!end_conditions.empty());
 
-  ptr_trajectory_bundle->reserve(end_conditions.size());
+  ptr_trajectory_bundle->reserve(ptr_trajectory_bundle->size() +
+                                 end_conditions.size());
   for (const auto& end_condition : end_conditions) {
     auto ptr_trajectory1d = std::make_shared<LatticeTrajectory1d>(
-        std::shared_ptr<Curve1d>(new QuinticPolynomialCurve1d(
-            init_state, end_condition.first, end_condition.second)));
+        std::make_shared<QuinticPolynomialCurve1d>(
+            init_state, end_condition.first, end_condition.second));
 
     ptr_trajectory1d->set_target_position(end_condition.first[0]);
     ptr_trajectory1d->set_target_velocity(end_condition.first[1]);
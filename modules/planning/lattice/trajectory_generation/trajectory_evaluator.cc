@@ -21,9 +21,12 @@
 #include "modules/planning/lattice/trajectory_generation/trajectory_evaluator.h"
 
 #include <algorithm>
+#include <functional>
+#include <future>
 #include <limits>
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/common/math/path_matcher.h"
 #include "modules/planning/common/planning_gflags.h"
 #include "modules/planning/constraint_checker/constraint_checker1d.h"
@@ -74,6 +77,10 @@ TrajectoryEvaluator::TrajectoryEvaluator(
     if (!ConstraintChecker1d::IsValidLongitudinalTrajectory(*lon_trajectory)) {
       continue;
     }
+    if (FLAGS_enable_parallel_lattice_evaluation) {
+      lon_candidates_.emplace_back(lon_trajectory, 0.0);
+      continue;
+    }
     for (const auto& lat_trajectory : lat_trajectories) {
       /**
        * The validity of the code needs to be verified.
@@ -87,7 +94,28 @@ TrajectoryEvaluator::TrajectoryEvaluator(
                           cost);
     }
   }
-  ADEBUG << "Number of valid 1d trajectory pairs: " << cost_queue_.size();
+
+  if (FLAGS_enable_parallel_lattice_evaluation) {
+    lat_candidates_ = lat_trajectories;
+    std::vector<std::future<double>> results;
+    for (const auto& candidate : lon_candidates_) {
+      results.push_back(cyber::Async(&TrajectoryEvaluator::LonCost, this,
+                                     std::cref(planning_target),
+                                     candidate.first));
+    }
+    for (size_t i = 0; i < results.size(); ++i) {
+      lon_candidates_[i].second = results[i].get();
+    }
+    // stable, so equal bounds keep the generation order on every replay.
+    std::stable_sort(lon_candidates_.begin(), lon_candidates_.end(),
+                     [](const std::pair<PtrTrajectory1d, double>& left,
+                        const std::pair<PtrTrajectory1d, double>& right) {
+                       return left.second < right.second;
+                     });
+    ExpandTrajectoryPairs();
+  }
+  ADEBUG << "Number of valid 1d trajectory pairs: "
+         << num_of_trajectory_pairs();
 }
 
 bool TrajectoryEvaluator::has_more_trajectory_pairs() const {
@@ -95,7 +123,9 @@ bool TrajectoryEvaluator::has_more_trajectory_pairs() const {
 }
 
 size_t TrajectoryEvaluator::num_of_trajectory_pairs() const {
-  return cost_queue_.size();
+  return cost_queue_.size() +
+         (lon_candidates_.size() - next_lon_candidate_) *
+             lat_candidates_.size();
 }
 
 std::pair<PtrTrajectory1d, PtrTrajectory1d>
@@ -103,6 +133,9 @@ TrajectoryEvaluator::next_top_trajectory_pair() {
   CHECK(has_more_trajectory_pairs() == true);
   auto top = cost_queue_.top();
   cost_queue_.pop();
+  if (FLAGS_enable_parallel_lattice_evaluation) {
+    ExpandTrajectoryPairs();
+  }
   return top.first;
 }
 
@@ -132,15 +165,7 @@ double TrajectoryEvaluator::Evaluate(
 
   double centripetal_acc_cost = CentripetalAccelerationCost(lon_trajectory);
 
-  // decides the longitudinal evaluation horizon for lateral trajectories.
-  double evaluation_horizon =
-      std::min(FLAGS_decision_horizon,
-               lon_trajectory->Evaluate(0, lon_trajectory->ParamLength()));
-  std::vector<double> s_values;
-  for (double s = 0.0; s < evaluation_horizon;
-       s += FLAGS_trajectory_space_resolution) {
-    s_values.emplace_back(s);
-  }
+  std::vector<double> s_values = EvaluationSValues(lon_trajectory);
 
   // Lateral costs
   double lat_offset_cost = LatOffsetCost(lat_trajectory, s_values);
@@ -162,6 +187,90 @@ double TrajectoryEvaluator::Evaluate(
          lat_comfort_cost * FLAGS_weight_lat_comfort;
 }
 
+double TrajectoryEvaluator::LonCost(
+    const PlanningTarget& planning_target,
+    const PtrTrajectory1d& lon_trajectory) const {
+  return LonObjectiveCost(lon_trajectory, planning_target, reference_s_dot_) *
+             FLAGS_weight_lon_objective +
+         LonComfortCost(lon_trajectory) * FLAGS_weight_lon_jerk +
+         LonCollisionCost(lon_trajectory) * FLAGS_weight_lon_collision +
+         CentripetalAccelerationCost(lon_trajectory) *
+             FLAGS_weight_centripetal_acceleration;
+}
+
+double TrajectoryEvaluator::EvaluatePair(
+    const double lon_cost, const PtrTrajectory1d& lon_trajectory,
+    const PtrTrajectory1d& lat_trajectory) const {
+  std::vector<double> s_values = EvaluationSValues(lon_trajectory);
+  return lon_cost +
+         LatOffsetCost(lat_trajectory, s_values) * FLAGS_weight_lat_offset +
+         LatComfortCost(lon_trajectory, lat_trajectory) *
+             FLAGS_weight_lat_comfort;
+}
+
+void TrajectoryEvaluator::ExpandTrajectoryPairs() {
+  static constexpr size_t kPairsPerTask = 16;
+  const size_t num_lat = lat_candidates_.size();
+  while (next_lon_candidate_ < lon_candidates_.size()) {
+    // with nothing scored yet, the best bound has to be opened anyway.
+    size_t end = next_lon_candidate_;
+    if (cost_queue_.empty()) {
+      ++end;
+    } else {
+      const double best_cost = cost_queue_.top().second;
+      while (end < lon_candidates_.size() &&
+             lon_candidates_[end].second < best_cost) {
+        ++end;
+      }
+    }
+    if (end == next_lon_candidate_) {
+      return;
+    }
+
+    // every task writes its own slots, and results are queued in index
+    // order, so the queue does not depend on task scheduling.
+    const size_t first = next_lon_candidate_;
+    const size_t num_pairs = (end - first) * num_lat;
+    std::vector<double> costs(num_pairs);
+    std::vector<std::future<void>> results;
+    for (size_t begin = 0; begin < num_pairs; begin += kPairsPerTask) {
+      results.push_back(cyber::Async([this, &costs, first, begin, num_pairs,
+                                      num_lat]() {
+        const size_t task_end = std::min(begin + kPairsPerTask, num_pairs);
+        for (size_t k = begin; k < task_end; ++k) {
+          const auto& lon = lon_candidates_[first + k / num_lat];
+          costs[k] =
+              EvaluatePair(lon.second, lon.first, lat_candidates_[k % num_lat]);
+        }
+      }));
+    }
+    for (auto& result : results) {
+      result.get();
+    }
+    for (size_t k = 0; k < num_pairs; ++k) {
+      cost_queue_.emplace(
+          Trajectory1dPair(lon_candidates_[first + k / num_lat].first,
+                           lat_candidates_[k % num_lat]),
+          costs[k]);
+    }
+    next_lon_candidate_ = end;
+  }
+}
+
+std::vector<double> TrajectoryEvaluator::EvaluationSValues(
+    const PtrTrajectory1d& lon_trajectory) const {
+  // decides the longitudinal evaluation horizon for lateral trajectories.
+  double evaluation_horizon =
+      std::min(FLAGS_decision_horizon,
+               lon_trajectory->Evaluate(0, lon_trajectory->ParamLength()));
+  std::vector<double> s_values;
+  for (double s = 0.0; s < evaluation_horizon;
+       s += FLAGS_trajectory_space_resolution) {
+    s_values.emplace_back(s);
+  }
+  return s_values;
+}
+
 double TrajectoryEvaluator::LatOffsetCost(
     const PtrTrajectory1d& lat_trajectory,
     const std::vector<double>& s_values) const {
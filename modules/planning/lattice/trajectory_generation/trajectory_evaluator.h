@@ -74,6 +74,24 @@ class TrajectoryEvaluator {
                   const std::shared_ptr<Curve1d>& lat_trajectory,
                   std::vector<double>* cost_components = nullptr) const;
 
+  // Lon. part of Evaluate(). Lat. costs are non-negative, so this is also a
+  // lower bound of the cost of every pair built on lon_trajectory.
+  double LonCost(const PlanningTarget& planning_target,
+                 const std::shared_ptr<Curve1d>& lon_trajectory) const;
+
+  // Same result as Evaluate(), given the LonCost() of lon_trajectory.
+  double EvaluatePair(const double lon_cost,
+                      const std::shared_ptr<Curve1d>& lon_trajectory,
+                      const std::shared_ptr<Curve1d>& lat_trajectory) const;
+
+  // Scores, on the cyber task pool, the pairs of the lon. trajectories whose
+  // lower bound is below the current best pair, so that the queue top is
+  // always the true next best pair.
+  void ExpandTrajectoryPairs();
+
+  std::vector<double> EvaluationSValues(
+      const std::shared_ptr<Curve1d>& lon_trajectory) const;
+
   double LatOffsetCost(const std::shared_ptr<Curve1d>& lat_trajectory,
                        const std::vector<double>& s_values) const;
 
@@ -117,6 +135,12 @@ class TrajectoryEvaluator {
   std::array<double, 3> init_s_;
 
   std::vector<double> reference_s_dot_;
+
+  // parallel evaluation: lon. trajectories sorted by LonCost(), and the
+  // first of them whose pairs are not scored yet.
+  std::vector<std::pair<std::shared_ptr<Curve1d>, double>> lon_candidates_;
+  std::vector<std::shared_ptr<Curve1d>> lat_candidates_;
+  size_t next_lon_candidate_ = 0;
 };
 
 }  // namespace planning
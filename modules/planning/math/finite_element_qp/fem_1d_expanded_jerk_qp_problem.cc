@@ -61,15 +61,11 @@ bool Fem1dExpandedJerkQpProblem::Optimize() {
   x_derivative_.resize(num_var_);
   x_second_order_derivative_.resize(num_var_);
 
-  OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-  OSQPSettings* settings =
-      reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  OSQPWorkspace* work = nullptr;
-
   const size_t kNumParam = 4 * num_var_;
-  OptimizeWithOsqp(kNumParam, lower_bounds.size(), P_data, P_indices, P_indptr,
-                   A_data, A_indices, A_indptr, lower_bounds, upper_bounds, q,
-                   data, &work, settings);
+  OSQPWorkspace* work =
+      OptimizeWithOsqp(kNumParam, lower_bounds.size(), P_data, P_indices,
+                       P_indptr, A_data, A_indices, A_indptr, lower_bounds,
+                       upper_bounds, q);
 
   if (work == nullptr || work->solution == nullptr) {
     AERROR << "Failed to find QP solution.";
@@ -91,12 +87,6 @@ bool Fem1dExpandedJerkQpProblem::Optimize() {
   x_second_order_derivative_.back() = 0.0;
   x_third_order_derivative_.back() = 0.0;
 
-  // Cleanup
-  osqp_cleanup(work);
-  c_free(data->A);
-  c_free(data->P);
-  c_free(data);
-  c_free(settings);
   auto end_time4 = std::chrono::system_clock::now();
   diff = end_time4 - end_time3;
   ADEBUG << "Run OptimizeWithOsqp used time: " << diff.count() * 1000 << " ms.";
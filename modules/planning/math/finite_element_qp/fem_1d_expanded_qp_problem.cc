@@ -47,15 +47,15 @@ bool Fem1dExpandedQpProblem::Optimize() {
   x_derivative_.resize(num_var_);
   x_second_order_derivative_.resize(num_var_);
 
-  OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-  OSQPSettings* settings =
-      reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  OSQPWorkspace* work = nullptr;
-
   const size_t kNumVariable = 3 * num_var_;
-  OptimizeWithOsqp(kNumVariable, lower_bounds.size(), P_data, P_indices,
-                   P_indptr, A_data, A_indices, A_indptr, lower_bounds,
-                   upper_bounds, q, data, &work, settings);
+  OSQPWorkspace* work =
+      OptimizeWithOsqp(kNumVariable, lower_bounds.size(), P_data, P_indices,
+                       P_indptr, A_data, A_indices, A_indptr, lower_bounds,
+                       upper_bounds, q);
+  if (work == nullptr || work->solution == nullptr) {
+    AERROR << "Failed to find QP solution.";
+    return false;
+  }
 
   // extract primal results
   x_.resize(num_var_);
@@ -69,13 +69,6 @@ bool Fem1dExpandedQpProblem::Optimize() {
   x_derivative_.back() = 0.0;
   x_second_order_derivative_.back() = 0.0;
 
-  // Cleanup
-  osqp_cleanup(work);
-  c_free(data->A);
-  c_free(data->P);
-  c_free(data);
-  c_free(settings);
-
   return true;
 }
 
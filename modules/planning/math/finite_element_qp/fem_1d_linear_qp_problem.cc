@@ -50,15 +50,14 @@ bool Fem1dLinearQpProblem::Optimize() {
   diff = end_time3 - end_time2;
   ADEBUG << "CalculateOffset used time: " << diff.count() * 1000 << " ms.";
 
-  // Problem settings
-  OSQPSettings* settings =
-      reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-  OSQPWorkspace* work = nullptr;
-
-  OptimizeWithOsqp(num_var_, lower_bounds.size(), P_data, P_indices, P_indptr,
-                   A_data, A_indices, A_indptr, lower_bounds, upper_bounds, q,
-                   data, &work, settings);
+  OSQPWorkspace* work =
+      OptimizeWithOsqp(num_var_, lower_bounds.size(), P_data, P_indices,
+                       P_indptr, A_data, A_indices, A_indptr, lower_bounds,
+                       upper_bounds, q);
+  if (work == nullptr || work->solution == nullptr) {
+    AERROR << "Failed to find QP solution.";
+    return false;
+  }
 
   x_.resize(num_var_ + 1);
   x_derivative_.resize(num_var_ + 1);
@@ -73,13 +72,6 @@ bool Fem1dLinearQpProblem::Optimize() {
     // TODO(All): extract x_derivative_ and x_second_order_derivative_
   }
 
-  // Cleanup
-  osqp_cleanup(work);
-  c_free(data->A);
-  c_free(data->P);
-  c_free(data);
-  c_free(settings);
-
   auto end_time4 = std::chrono::system_clock::now();
   diff = end_time4 - end_time3;
   ADEBUG << "Run OptimizeWithOsqp used time: " << diff.count() * 1000 << " ms.";
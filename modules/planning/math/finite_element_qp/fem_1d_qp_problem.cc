@@ -56,52 +56,42 @@ bool Fem1dQpProblem::Init(const size_t num_var,
   delta_s_penta_ = delta_s_sq_ * delta_s_tri_;
   delta_s_hex_ = delta_s_tri_ * delta_s_tri_;
 
-  x_bounds_.resize(num_var_,
+  // the problem may be initialized again for the next frame, so the bounds of
+  // the last one are dropped.
+  x_bounds_.assign(num_var_,
                    std::make_pair(-kMaxVariableRange, kMaxVariableRange));
-  dx_bounds_.resize(num_var_,
+  dx_bounds_.assign(num_var_,
                     std::make_pair(-kMaxVariableRange, kMaxVariableRange));
-  ddx_bounds_.resize(num_var_,
+  ddx_bounds_.assign(num_var_,
                      std::make_pair(-kMaxVariableRange, kMaxVariableRange));
 
   is_init_ = true;
   return true;
 }
 
-bool Fem1dQpProblem::OptimizeWithOsqp(
+OSQPWorkspace* Fem1dQpProblem::OptimizeWithOsqp(
     const size_t kernel_dim, const size_t num_affine_constraint,
-    std::vector<c_float>& P_data, std::vector<c_int>& P_indices,    // NOLINT
-    std::vector<c_int>& P_indptr, std::vector<c_float>& A_data,     // NOLINT
-    std::vector<c_int>& A_indices, std::vector<c_int>& A_indptr,    // NOLINT
-    std::vector<c_float>& lower_bounds,                             // NOLINT
-    std::vector<c_float>& upper_bounds,                             // NOLINT
-    std::vector<c_float>& q, OSQPData* data, OSQPWorkspace** work,  // NOLINT
-    OSQPSettings* settings) {
+    const std::vector<c_float>& P_data, const std::vector<c_int>& P_indices,
+    const std::vector<c_int>& P_indptr, const std::vector<c_float>& A_data,
+    const std::vector<c_int>& A_indices, const std::vector<c_int>& A_indptr,
+    const std::vector<c_float>& lower_bounds,
+    const std::vector<c_float>& upper_bounds, const std::vector<c_float>& q) {
   // Define Solver settings as default
-  osqp_set_default_settings(settings);
-  settings->alpha = 1.0;  // Change alpha parameter
-  settings->eps_abs = 1.0e-05;
-  settings->eps_rel = 1.0e-05;
-  settings->max_iter = 5000;
-  settings->polish = true;
-  settings->verbose = FLAGS_enable_osqp_debug;
-
-  data->n = kernel_dim;
-  data->m = num_affine_constraint;
-  data->P = csc_matrix(data->n, data->n, P_data.size(), P_data.data(),
-                       P_indices.data(), P_indptr.data());
-  data->q = q.data();
-  data->A = csc_matrix(data->m, data->n, A_data.size(), A_data.data(),
-                       A_indices.data(), A_indptr.data());
-  data->l = lower_bounds.data();
-  data->u = upper_bounds.data();
+  OSQPSettings settings;
+  osqp_set_default_settings(&settings);
+  settings.alpha = 1.0;  // Change alpha parameter
+  settings.eps_abs = 1.0e-05;
+  settings.eps_rel = 1.0e-05;
+  settings.max_iter = 5000;
+  settings.polish = true;
+  settings.verbose = FLAGS_enable_osqp_debug;
+  settings.warm_start = true;
 
   CHECK_EQ(upper_bounds.size(), lower_bounds.size());
 
-  *work = osqp_setup(data, settings);
-
-  // Solve Problem
-  osqp_solve(*work);
-  return true;
+  return osqp_workspace_.Solve(settings, kernel_dim, num_affine_constraint,
+                               P_data, P_indices, P_indptr, A_data, A_indices,
+                               A_indptr, q, lower_bounds, upper_bounds);
 }
 
 void Fem1dQpProblem::ProcessBound(
@@ -0,0 +1,121 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/math/persistent_osqp_workspace.h"
+
+#include "cyber/common/log.h"
+
+#include "modules/planning/common/planning_gflags.h"
+
+namespace apollo {
+namespace planning {
+
+PersistentOsqpWorkspace::~PersistentOsqpWorkspace() { Reset(); }
+
+void PersistentOsqpWorkspace::Reset() {
+  if (work_ != nullptr) {
+    osqp_cleanup(work_);
+    work_ = nullptr;
+  }
+}
+
+bool PersistentOsqpWorkspace::Update(
+    const size_t num_param, const size_t num_constraint,
+    const std::vector<c_float>& P_data, const std::vector<c_int>& P_indices,
+    const std::vector<c_int>& P_indptr, const std::vector<c_float>& A_data,
+    const std::vector<c_int>& A_indices, const std::vector<c_int>& A_indptr,
+    const std::vector<c_float>& q, const std::vector<c_float>& lower_bounds,
+    const std::vector<c_float>& upper_bounds) {
+  // osqp may keep P in another form than the one it was given, so it is only
+  // reused as it is.
+  if (work_ == nullptr || num_param != num_param_ ||
+      num_constraint != num_constraint_ || P_data != P_data_ ||
+      P_indices != P_indices_ || P_indptr != P_indptr_ ||
+      A_indices != A_indices_ || A_indptr != A_indptr_) {
+    return false;
+  }
+  if (A_data != A_data_) {
+    if (osqp_update_A(work_, A_data.data(), OSQP_NULL,
+                      static_cast<c_int>(A_data.size())) != 0) {
+      return false;
+    }
+    A_data_ = A_data;
+  }
+  return osqp_update_lin_cost(work_, q.data()) == 0 &&
+         osqp_update_bounds(work_, lower_bounds.data(),
+                            upper_bounds.data()) == 0;
+}
+
+OSQPWorkspace* PersistentOsqpWorkspace::Solve(
+    const OSQPSettings& settings, const size_t num_param,
+    const size_t num_constraint, const std::vector<c_float>& P_data,
+    const std::vector<c_int>& P_indices, const std::vector<c_int>& P_indptr,
+    const std::vector<c_float>& A_data, const std::vector<c_int>& A_indices,
+    const std::vector<c_int>& A_indptr, const std::vector<c_float>& q,
+    const std::vector<c_float>& lower_bounds,
+    const std::vector<c_float>& upper_bounds) {
+  CHECK_EQ(q.size(), num_param);
+  CHECK_EQ(lower_bounds.size(), num_constraint);
+  CHECK_EQ(upper_bounds.size(), num_constraint);
+
+  if (FLAGS_enable_osqp_workspace_reuse &&
+      Update(num_param, num_constraint, P_data, P_indices, P_indptr, A_data,
+             A_indices, A_indptr, q, lower_bounds, upper_bounds)) {
+    ++num_updates_;
+  } else {
+    Reset();
+    num_param_ = num_param;
+    num_constraint_ = num_constraint;
+    P_data_ = P_data;
+    P_indices_ = P_indices;
+    P_indptr_ = P_indptr;
+    A_data_ = A_data;
+    A_indices_ = A_indices;
+    A_indptr_ = A_indptr;
+
+    // osqp copies the data into the workspace at setup
+    OSQPData data;
+    data.n = static_cast<c_int>(num_param);
+    data.m = static_cast<c_int>(num_constraint);
+    data.P = csc_matrix(data.n, data.n, static_cast<c_int>(P_data_.size()),
+                        P_data_.data(), P_indices_.data(), P_indptr_.data());
+    data.A = csc_matrix(data.m, data.n, static_cast<c_int>(A_data_.size()),
+                        A_data_.data(), A_indices_.data(), A_indptr_.data());
+    data.q = const_cast<c_float*>(q.data());
+    data.l = const_cast<c_float*>(lower_bounds.data());
+    data.u = const_cast<c_float*>(upper_bounds.data());
+
+    OSQPSettings setup_settings = settings;
+    work_ = osqp_setup(&data, &setup_settings);
+    c_free(data.A);
+    c_free(data.P);
+    ++num_setups_;
+    if (work_ == nullptr) {
+      AERROR << "Failed to set up osqp workspace.";
+      return nullptr;
+    }
+  }
+
+  osqp_solve(work_);
+  return work_;
+}
+
+}  // namespace planning
+}  // namespace apollo
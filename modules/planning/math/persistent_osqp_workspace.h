@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#pragma once
+
+#include <vector>
+
+#include "osqp/include/osqp.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class PersistentOsqpWorkspace
+ * @brief An osqp workspace kept across solves of problems with the same
+ *        structure, e.g. the same optimizer in consecutive planning cycles.
+ *
+ * When the kernel P is unchanged and the affine constraint A keeps its
+ * sparsity pattern, the last workspace is updated in place instead of being
+ * set up again: only the values of A, q, l and u are replaced, so the
+ * factorization is kept when A did not change either, and the solve is warm
+ * started from the last solution.
+ */
+class PersistentOsqpWorkspace {
+ public:
+  PersistentOsqpWorkspace() = default;
+
+  ~PersistentOsqpWorkspace();
+
+  PersistentOsqpWorkspace(const PersistentOsqpWorkspace&) = delete;
+  PersistentOsqpWorkspace& operator=(const PersistentOsqpWorkspace&) = delete;
+
+  /**
+   * @brief Solves min 0.5 * x'Px + q'x, s.t. l <= Ax <= u, with P and A in
+   *        csc format. The settings are only used when a new workspace is
+   *        set up.
+   * @return The workspace holding the solution, owned by this object and
+   *         valid until the next solve; nullptr if osqp failed to set up.
+   */
+  OSQPWorkspace* Solve(const OSQPSettings& settings, const size_t num_param,
+                       const size_t num_constraint,
+                       const std::vector<c_float>& P_data,
+                       const std::vector<c_int>& P_indices,
+                       const std::vector<c_int>& P_indptr,
+                       const std::vector<c_float>& A_data,
+                       const std::vector<c_int>& A_indices,
+                       const std::vector<c_int>& A_indptr,
+                       const std::vector<c_float>& q,
+                       const std::vector<c_float>& lower_bounds,
+                       const std::vector<c_float>& upper_bounds);
+
+  /**
+   * @brief Drops the workspace, so that the next solve sets up a new one.
+   */
+  void Reset();
+
+  size_t num_setups() const { return num_setups_; }
+
+  size_t num_updates() const { return num_updates_; }
+
+ private:
+  bool Update(const size_t num_param, const size_t num_constraint,
+              const std::vector<c_float>& P_data,
+              const std::vector<c_int>& P_indices,
+              const std::vector<c_int>& P_indptr,
+              const std::vector<c_float>& A_data,
+              const std::vector<c_int>& A_indices,
+              const std::vector<c_int>& A_indptr,
+              const std::vector<c_float>& q,
+              const std::vector<c_float>& lower_bounds,
+              const std::vector<c_float>& upper_bounds);
+
+  OSQPWorkspace* work_ = nullptr;
+
+  // the structure of the problem in the workspace
+  size_t num_param_ = 0;
+  size_t num_constraint_ = 0;
+  std::vector<c_float> P_data_;
+  std::vector<c_int> P_indices_;
+  std::vector<c_int> P_indptr_;
+  std::vector<c_float> A_data_;
+  std::vector<c_int> A_indices_;
+  std::vector<c_int> A_indptr_;
+
+  size_t num_setups_ = 0;
+  size_t num_updates_ = 0;
+};
+
+}  // namespace planning
+}  // namespace apollo
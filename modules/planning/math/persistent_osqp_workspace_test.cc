@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/planning/math/persistent_osqp_workspace.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace planning {
+
+namespace {
+
+OSQPSettings DefaultSettings() {
+  OSQPSettings settings;
+  osqp_set_default_settings(&settings);
+  settings.eps_abs = 1.0e-06;
+  settings.eps_rel = 1.0e-06;
+  settings.polish = true;
+  settings.verbose = false;
+  return settings;
+}
+
+}  // namespace
+
+// min 0.5 * (x0^2 + x1^2) + q'x, s.t. l <= x0 + x1 <= u, -1 <= x0 <= 1
+TEST(PersistentOsqpWorkspaceTest, ReuseWorkspace) {
+  const std::vector<c_float> P_data = {1.0, 1.0};
+  const std::vector<c_int> P_indices = {0, 1};
+  const std::vector<c_int> P_indptr = {0, 1, 2};
+  std::vector<c_float> A_data = {1.0, 1.0, 1.0};
+  const std::vector<c_int> A_indices = {0, 1, 0};
+  const std::vector<c_int> A_indptr = {0, 2, 3};
+
+  PersistentOsqpWorkspace workspace;
+  const OSQPSettings settings = DefaultSettings();
+  OSQPWorkspace* work =
+      workspace.Solve(settings, 2, 2, P_data, P_indices, P_indptr, A_data,
+                      A_indices, A_indptr, {-2.0, -2.0}, {-10.0, -1.0},
+                      {10.0, 1.0});
+  ASSERT_NE(nullptr, work);
+  EXPECT_NEAR(1.0, work->solution->x[0], 1e-4);
+  EXPECT_NEAR(2.0, work->solution->x[1], 1e-4);
+  EXPECT_EQ(1u, workspace.num_setups());
+  EXPECT_EQ(0u, workspace.num_updates());
+
+  // new offset and bounds
+  work = workspace.Solve(settings, 2, 2, P_data, P_indices, P_indptr, A_data,
+                         A_indices, A_indptr, {-2.0, -2.0}, {-10.0, -1.0},
+                         {2.0, 1.0});
+  ASSERT_NE(nullptr, work);
+  EXPECT_NEAR(1.0, work->solution->x[0], 1e-4);
+  EXPECT_NEAR(1.0, work->solution->x[1], 1e-4);
+  EXPECT_EQ(1u, workspace.num_setups());
+  EXPECT_EQ(1u, workspace.num_updates());
+
+  // new values of A with the same pattern, the second row is now 2 * x0
+  A_data = {1.0, 2.0, 1.0};
+  work = workspace.Solve(settings, 2, 2, P_data, P_indices, P_indptr, A_data,
+                         A_indices, A_indptr, {-2.0, -2.0}, {-10.0, -1.0},
+                         {10.0, 1.0});
+  ASSERT_NE(nullptr, work);
+  EXPECT_NEAR(0.5, work->solution->x[0], 1e-4);
+  EXPECT_NEAR(2.0, work->solution->x[1], 1e-4);
+  EXPECT_EQ(1u, workspace.num_setups());
+  EXPECT_EQ(2u, workspace.num_updates());
+
+  // a new kernel needs a new workspace
+  const std::vector<c_float> new_P_data = {2.0, 2.0};
+  work = workspace.Solve(settings, 2, 2, new_P_data, P_indices, P_indptr,
+                         A_data, A_indices, A_indptr, {-4.0, -4.0},
+                         {-10.0, -1.0}, {10.0, 1.0});
+  ASSERT_NE(nullptr, work);
+  EXPECT_NEAR(0.5, work->solution->x[0], 1e-4);
+  EXPECT_NEAR(2.0, work->solution->x[1], 1e-4);
+  EXPECT_EQ(2u, workspace.num_setups());
+  EXPECT_EQ(2u, workspace.num_updates());
+}
+
+}  // namespace planning
+}  // namespace apollo
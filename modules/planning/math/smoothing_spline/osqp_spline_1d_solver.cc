@@ -30,48 +30,28 @@ namespace apollo {
 namespace planning {
 
 using Eigen::MatrixXd;
+using apollo::common::math::BlockDiagonalCSCData;
+using apollo::common::math::BlockDiagonalCSCStructure;
 using apollo::common::math::DenseToCSCMatrix;
+using apollo::common::math::StackedDenseToCSCMatrix;
 
 OsqpSpline1dSolver::OsqpSpline1dSolver(const std::vector<double>& x_knots,
                                        const uint32_t order)
     : Spline1dSolver(x_knots, order) {
-  // Problem settings
-  settings_ = reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-
   // Define Solver settings as default
-  osqp_set_default_settings(settings_);
-  settings_->alpha = 1.0;  // Change alpha parameter
-  settings_->eps_abs = 1.0e-03;
-  settings_->eps_rel = 1.0e-03;
-  settings_->max_iter = 5000;
-  // settings_->polish = true;
-  settings_->verbose = FLAGS_enable_osqp_debug;
-  settings_->warm_start = true;
-
-  // Populate data
-  data_ = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+  osqp_set_default_settings(&settings_);
+  settings_.alpha = 1.0;  // Change alpha parameter
+  settings_.eps_abs = 1.0e-03;
+  settings_.eps_rel = 1.0e-03;
+  settings_.max_iter = 5000;
+  // settings_.polish = true;
+  settings_.verbose = FLAGS_enable_osqp_debug;
+  settings_.warm_start = true;
 }
 
-OsqpSpline1dSolver::~OsqpSpline1dSolver() { CleanUp(); }
-
-void OsqpSpline1dSolver::CleanUp() {
-  osqp_cleanup(work_);
-  if (data_ != nullptr) {
-    c_free(data_->A);
-    c_free(data_->P);
-    c_free(data_);
-  }
-  if (settings_ != nullptr) {
-    c_free(settings_);
-  }
-}
+void OsqpSpline1dSolver::CleanUp() { osqp_workspace_.Reset(); }
 
-void OsqpSpline1dSolver::ResetOsqp() {
-  // Problem settings
-  settings_ = reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  // Populate data
-  data_ = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-}
+void OsqpSpline1dSolver::ResetOsqp() { osqp_workspace_.Reset(); }
 
 bool OsqpSpline1dSolver::Solve() {
   // Namings here are following osqp convention.
@@ -84,33 +64,47 @@ bool OsqpSpline1dSolver::Solve() {
     return false;
   }
 
+  // the structure of a block diagonal kernel only depends on the knot count
+  // and the order, so it is kept across solves and only the values are read
   std::vector<c_float> P_data;
-  std::vector<c_int> P_indices;
-  std::vector<c_int> P_indptr;
-  DenseToCSCMatrix(P, &P_data, &P_indices, &P_indptr);
+  if (kernel_.IsBlockDiagonal()) {
+    const int block_size = static_cast<int>(spline_.spline_order()) + 1;
+    if (P_indptr_.size() != static_cast<size_t>(P.cols()) + 1 ||
+        P_block_size_ != block_size) {
+      BlockDiagonalCSCStructure(static_cast<int>(P.cols()), block_size,
+                                &P_indices_, &P_indptr_);
+      P_block_size_ = block_size;
+    }
+    BlockDiagonalCSCData(P, block_size, &P_data);
+  } else {
+    P_indices_.clear();
+    P_indptr_.clear();
+    P_block_size_ = 0;
+    DenseToCSCMatrix(P, &P_data, &P_indices_, &P_indptr_);
+  }
 
-  // change A to csc format
+  // change A to csc format, straight from the two constraint blocks
   const MatrixXd& inequality_constraint_matrix =
       constraint_.inequality_constraint().constraint_matrix();
   const MatrixXd& equality_constraint_matrix =
       constraint_.equality_constraint().constraint_matrix();
-  MatrixXd A(
-      inequality_constraint_matrix.rows() + equality_constraint_matrix.rows(),
-      inequality_constraint_matrix.cols());
-  A << inequality_constraint_matrix, equality_constraint_matrix;
-  ADEBUG << "A: " << A.rows() << ", " << A.cols();
-  if (A.rows() == 0) {
+  const auto A_rows =
+      inequality_constraint_matrix.rows() + equality_constraint_matrix.rows();
+  ADEBUG << "A: " << A_rows << ", " << inequality_constraint_matrix.cols();
+  if (A_rows == 0) {
     return false;
   }
 
   std::vector<c_float> A_data;
   std::vector<c_int> A_indices;
   std::vector<c_int> A_indptr;
-  DenseToCSCMatrix(A, &A_data, &A_indices, &A_indptr);
+  StackedDenseToCSCMatrix(inequality_constraint_matrix,
+                          equality_constraint_matrix, &A_data, &A_indices,
+                          &A_indptr);
 
   // set q, l, u: l < A < u
   const MatrixXd& q_eigen = kernel_.offset();
-  c_float q[q_eigen.rows()];  // NOLINT
+  std::vector<c_float> q(q_eigen.rows());
   for (int i = 0; i < q_eigen.size(); ++i) {
     q[i] = q_eigen(i);
   }
@@ -125,8 +119,8 @@ bool OsqpSpline1dSolver::Solve() {
 
   constexpr double kEpsilon = 1e-9;
   constexpr float kUpperLimit = 1e9;
-  c_float l[constraint_num];  // NOLINT
-  c_float u[constraint_num];  // NOLINT
+  std::vector<c_float> l(constraint_num);
+  std::vector<c_float> u(constraint_num);
   for (int i = 0; i < constraint_num; ++i) {
     if (i < inequality_constraint_boundary.rows()) {
       l[i] = inequality_constraint_boundary(i, 0);
@@ -139,24 +133,19 @@ bool OsqpSpline1dSolver::Solve() {
     }
   }
 
-  data_->n = P.rows();
-  data_->m = constraint_num;
-  data_->P = csc_matrix(data_->n, data_->n, P_data.size(), P_data.data(),
-                        P_indices.data(), P_indptr.data());
-  data_->q = q;
-  data_->A = csc_matrix(data_->m, data_->n, A_data.size(), A_data.data(),
-                        A_indices.data(), A_indptr.data());
-  data_->l = l;
-  data_->u = u;
-
-  work_ = osqp_setup(data_, settings_);
-
-  // Solve Problem
-  osqp_solve(work_);
+  // Solve Problem, reusing the workspace of the last frame when possible
+  OSQPWorkspace* work = osqp_workspace_.Solve(
+      settings_, static_cast<size_t>(P.rows()),
+      static_cast<size_t>(constraint_num), P_data, P_indices_, P_indptr_,
+      A_data, A_indices, A_indptr, q, l, u);
+  if (work == nullptr || work->solution == nullptr) {
+    AERROR << "Failed to find QP solution.";
+    return false;
+  }
 
   MatrixXd solved_params = MatrixXd::Zero(P.rows(), 1);
   for (int i = 0; i < P.rows(); ++i) {
-    solved_params(i, 0) = work_->solution->x[i];
+    solved_params(i, 0) = work->solution->x[i];
   }
 
   last_num_param_ = static_cast<int>(P.rows());
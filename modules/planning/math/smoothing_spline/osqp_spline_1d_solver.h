@@ -25,6 +25,7 @@
 #include "osqp/include/osqp.h"
 
 #include "modules/common/math/qp_solver/qp_solver.h"
+#include "modules/planning/math/persistent_osqp_workspace.h"
 #include "modules/planning/math/smoothing_spline/spline_1d_solver.h"
 
 namespace apollo {
@@ -33,18 +34,23 @@ namespace planning {
 class OsqpSpline1dSolver : public Spline1dSolver {
  public:
   OsqpSpline1dSolver(const std::vector<double>& x_knots, const uint32_t order);
-  virtual ~OsqpSpline1dSolver();
+  virtual ~OsqpSpline1dSolver() = default;
 
   bool Solve() override;
 
+  // drops the osqp workspace kept from the last solve
   void CleanUp();
 
   void ResetOsqp();
 
  private:
-  OSQPSettings* settings_ = nullptr;
-  OSQPWorkspace* work_ = nullptr;  // Workspace
-  OSQPData* data_ = nullptr;       // OSQPData
+  OSQPSettings settings_;
+  PersistentOsqpWorkspace osqp_workspace_;
+  // csc structure of the kernel, kept while it stays block diagonal with
+  // blocks of P_block_size_
+  std::vector<c_int> P_indices_;
+  std::vector<c_int> P_indptr_;
+  int P_block_size_ = 0;
 };
 
 }  // namespace planning
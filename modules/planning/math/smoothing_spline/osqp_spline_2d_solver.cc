@@ -33,12 +33,25 @@ namespace {
 constexpr double kRoadBound = 1e10;
 }
 
+using apollo::common::math::BlockDiagonalCSCData;
+using apollo::common::math::BlockDiagonalCSCStructure;
 using apollo::common::math::DenseToCSCMatrix;
+using apollo::common::math::StackedDenseToCSCMatrix;
 using Eigen::MatrixXd;
 
 OsqpSpline2dSolver::OsqpSpline2dSolver(const std::vector<double>& t_knots,
                                        const uint32_t order)
-    : Spline2dSolver(t_knots, order) {}
+    : Spline2dSolver(t_knots, order) {
+  // Define Solver settings as default
+  osqp_set_default_settings(&osqp_settings_);
+  osqp_settings_.alpha = 1.0;  // Change alpha parameter
+  osqp_settings_.eps_abs = 1.0e-05;
+  osqp_settings_.eps_rel = 1.0e-05;
+  osqp_settings_.max_iter = 5000;
+  osqp_settings_.polish = true;
+  osqp_settings_.verbose = FLAGS_enable_osqp_debug;
+  osqp_settings_.warm_start = true;
+}
 
 void OsqpSpline2dSolver::Reset(const std::vector<double>& t_knots,
                                const uint32_t order) {
@@ -67,33 +80,47 @@ bool OsqpSpline2dSolver::Solve() {
     return false;
   }
 
+  // the structure of a block diagonal kernel only depends on the knot count
+  // and the order, so it is kept across solves and only the values are read
   std::vector<c_float> P_data;
-  std::vector<c_int> P_indices;
-  std::vector<c_int> P_indptr;
-  DenseToCSCMatrix(P, &P_data, &P_indices, &P_indptr);
+  if (kernel_.IsBlockDiagonal()) {
+    const int block_size = static_cast<int>(spline_.spline_order()) + 1;
+    if (P_indptr_.size() != static_cast<size_t>(P.cols()) + 1 ||
+        P_block_size_ != block_size) {
+      BlockDiagonalCSCStructure(static_cast<int>(P.cols()), block_size,
+                                &P_indices_, &P_indptr_);
+      P_block_size_ = block_size;
+    }
+    BlockDiagonalCSCData(P, block_size, &P_data);
+  } else {
+    P_indices_.clear();
+    P_indptr_.clear();
+    P_block_size_ = 0;
+    DenseToCSCMatrix(P, &P_data, &P_indices_, &P_indptr_);
+  }
 
-  // change A to csc format
+  // change A to csc format, straight from the two constraint blocks
   const MatrixXd& inequality_constraint_matrix =
       constraint_.inequality_constraint().constraint_matrix();
   const MatrixXd& equality_constraint_matrix =
       constraint_.equality_constraint().constraint_matrix();
-  MatrixXd A(
-      inequality_constraint_matrix.rows() + equality_constraint_matrix.rows(),
-      inequality_constraint_matrix.cols());
-  A << inequality_constraint_matrix, equality_constraint_matrix;
-  ADEBUG << "A: " << A.rows() << ", " << A.cols();
-  if (A.rows() == 0) {
+  const auto A_rows =
+      inequality_constraint_matrix.rows() + equality_constraint_matrix.rows();
+  ADEBUG << "A: " << A_rows << ", " << inequality_constraint_matrix.cols();
+  if (A_rows == 0) {
     return false;
   }
 
   std::vector<c_float> A_data;
   std::vector<c_int> A_indices;
   std::vector<c_int> A_indptr;
-  DenseToCSCMatrix(A, &A_data, &A_indices, &A_indptr);
+  StackedDenseToCSCMatrix(inequality_constraint_matrix,
+                          equality_constraint_matrix, &A_data, &A_indices,
+                          &A_indptr);
 
   // set q, l, u: l < A < u
   const MatrixXd& q_eigen = kernel_.offset();
-  c_float q[q_eigen.rows()];  // NOLINT
+  std::vector<c_float> q(q_eigen.rows());
   for (int i = 0; i < q_eigen.size(); ++i) {
     q[i] = q_eigen(i);
   }
@@ -108,8 +135,8 @@ bool OsqpSpline2dSolver::Solve() {
 
   constexpr float kEpsilon = 1e-9f;
   constexpr float kUpperLimit = 1e9f;
-  c_float l[constraint_num];  // NOLINT
-  c_float u[constraint_num];  // NOLINT
+  std::vector<c_float> l(constraint_num);
+  std::vector<c_float> u(constraint_num);
   for (int i = 0; i < constraint_num; ++i) {
     if (i < inequality_constraint_boundary.rows()) {
       l[i] = inequality_constraint_boundary(i, 0);
@@ -121,36 +148,15 @@ bool OsqpSpline2dSolver::Solve() {
     }
   }
 
-  // Problem settings
-  OSQPSettings* settings =
-      reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-
-  // Populate data
-  OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-  data->n = P.rows();
-  data->m = constraint_num;
-  data->P = csc_matrix(data->n, data->n, P_data.size(), P_data.data(),
-                       P_indices.data(), P_indptr.data());
-  data->q = q;
-  data->A = csc_matrix(data->m, data->n, A_data.size(), A_data.data(),
-                       A_indices.data(), A_indptr.data());
-  data->l = l;
-  data->u = u;
-
-  // Define Solver settings as default
-  osqp_set_default_settings(settings);
-  settings->alpha = 1.0;  // Change alpha parameter
-  settings->eps_abs = 1.0e-05;
-  settings->eps_rel = 1.0e-05;
-  settings->max_iter = 5000;
-  settings->polish = true;
-  settings->verbose = FLAGS_enable_osqp_debug;
-
-  // Setup workspace
-  OSQPWorkspace* work = osqp_setup(data, settings);
-
-  // Solve Problem
-  osqp_solve(work);
+  // Solve Problem, reusing the workspace of the last frame when possible
+  OSQPWorkspace* work = osqp_workspace_.Solve(
+      osqp_settings_, static_cast<size_t>(P.rows()),
+      static_cast<size_t>(constraint_num), P_data, P_indices_, P_indptr_,
+      A_data, A_indices, A_indptr, q, l, u);
+  if (work == nullptr || work->solution == nullptr) {
+    AERROR << "Failed to find QP solution.";
+    return false;
+  }
 
   MatrixXd solved_params = MatrixXd::Zero(P.rows(), 1);
   for (int i = 0; i < P.rows(); ++i) {
@@ -160,13 +166,6 @@ bool OsqpSpline2dSolver::Solve() {
   last_num_param_ = static_cast<int>(P.rows());
   last_num_constraint_ = static_cast<int>(constraint_num);
 
-  // Cleanup
-  osqp_cleanup(work);
-  c_free(data->A);
-  c_free(data->P);
-  c_free(data);
-  c_free(settings);
-
   return spline_.set_splines(solved_params, spline_.spline_order());
 }
 
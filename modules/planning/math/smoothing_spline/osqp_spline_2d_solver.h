@@ -25,6 +25,7 @@
 #include "gtest/gtest_prod.h"
 #include "osqp/include/osqp.h"
 
+#include "modules/planning/math/persistent_osqp_workspace.h"
 #include "modules/planning/math/smoothing_spline/spline_2d.h"
 #include "modules/planning/math/smoothing_spline/spline_2d_solver.h"
 
@@ -52,9 +53,15 @@ class OsqpSpline2dSolver final : public Spline2dSolver {
   FRIEND_TEST(OSQPSolverTest, basic_test);
 
  private:
-  OSQPSettings* osqp_settings_ = nullptr;
-  OSQPWorkspace* work_ = nullptr;  // Workspace
-  OSQPData* data_ = nullptr;       // OSQPData
+  OSQPSettings osqp_settings_;
+  // kept across Reset(), the knots of consecutive frames usually give the
+  // same problem structure.
+  PersistentOsqpWorkspace osqp_workspace_;
+  // csc structure of the kernel, kept while it stays block diagonal with
+  // blocks of P_block_size_
+  std::vector<c_int> P_indices_;
+  std::vector<c_int> P_indptr_;
+  int P_block_size_ = 0;
 
   int last_num_constraint_ = 0;
   int last_num_param_ = 0;
@@ -43,12 +43,19 @@ class Spline1dKernel {
                  const double weight);
   bool AddKernel(const Eigen::MatrixXd& kernel, const double weight);
 
+  // changes through mutable_kernel_matrix() are expected to stay in the
+  // diagonal blocks of the segments
   Eigen::MatrixXd* mutable_kernel_matrix();
   Eigen::MatrixXd* mutable_offset();
 
   const Eigen::MatrixXd& kernel_matrix() const;
   const Eigen::MatrixXd& offset() const;
 
+  // whether the kernel only has entries in the square diagonal blocks of the
+  // spline_order + 1 parameters of a segment, which holds unless a full
+  // kernel is added with AddKernel
+  bool IsBlockDiagonal() const { return block_diagonal_; }
+
   // build-in kernel methods
   void AddDerivativeKernelMatrix(const double weight);
   void AddSecondOrderDerivativeMatrix(const double weight);
@@ -80,6 +87,7 @@ class Spline1dKernel {
  private:
   Eigen::MatrixXd kernel_matrix_;
   Eigen::MatrixXd offset_;
+  bool block_diagonal_ = true;
   std::vector<double> x_knots_;
   uint32_t spline_order_;
   uint32_t total_params_;
@@ -710,5 +710,30 @@ TEST(Spline1dKernel,
     }
   }
 }
+TEST(Spline1dKernel, block_diagonal) {
+  std::vector<double> x_knots = {0.0, 1.0, 2.0, 3.0};
+  const uint32_t spline_order = 5;
+  Spline1dKernel kernel(x_knots, spline_order);
+  kernel.AddRegularization(0.1);
+  kernel.AddDerivativeKernelMatrix(1.0);
+  kernel.AddSecondOrderDerivativeMatrix(1.0);
+  kernel.AddThirdOrderDerivativeMatrix(1.0);
+  kernel.AddReferenceLineKernelMatrix({0.5, 1.5, 2.5}, {1.0, 2.0, 3.0}, 1.0);
+  EXPECT_TRUE(kernel.IsBlockDiagonal());
+
+  const int num_params = static_cast<int>(spline_order) + 1;
+  const Eigen::MatrixXd& matrix = kernel.kernel_matrix();
+  for (int i = 0; i < matrix.rows(); ++i) {
+    for (int j = 0; j < matrix.cols(); ++j) {
+      if (i / num_params != j / num_params) {
+        EXPECT_DOUBLE_EQ(matrix(i, j), 0.0);
+      }
+    }
+  }
+
+  kernel.AddKernel(Eigen::MatrixXd::Ones(matrix.rows(), matrix.cols()), 1.0);
+  EXPECT_FALSE(kernel.IsBlockDiagonal());
+}
+
 }  // namespace planning
 }  // namespace apollo
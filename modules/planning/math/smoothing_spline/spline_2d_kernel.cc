@@ -41,9 +41,7 @@ Spline2dKernel::Spline2dKernel(const std::vector<double>& t_knots,
 
 // customized input output
 void Spline2dKernel::AddRegularization(const double regularization_param) {
-  Eigen::MatrixXd id_matrix =
-      Eigen::MatrixXd::Identity(kernel_matrix_.rows(), kernel_matrix_.cols());
-  kernel_matrix_ += id_matrix * regularization_param;
+  kernel_matrix_.diagonal().array() += regularization_param;
 }
 
 bool Spline2dKernel::AddKernel(const Eigen::MatrixXd& kernel,
@@ -56,6 +54,7 @@ bool Spline2dKernel::AddKernel(const Eigen::MatrixXd& kernel,
   }
   kernel_matrix_ += kernel * weight;
   offset_ += offset * weight;
+  block_diagonal_ = false;
   return true;
 }
 
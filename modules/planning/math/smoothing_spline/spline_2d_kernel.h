@@ -41,12 +41,19 @@ class Spline2dKernel {
                  const double weight);
   bool AddKernel(const Eigen::MatrixXd& kernel, const double weight);
 
+  // changes through mutable_kernel_matrix() are expected to stay in the
+  // diagonal blocks of the segments
   Eigen::MatrixXd* mutable_kernel_matrix();
   Eigen::MatrixXd* mutable_offset();
 
   const Eigen::MatrixXd kernel_matrix() const;
   const Eigen::MatrixXd offset() const;
 
+  // whether the kernel only has entries in the square diagonal blocks of the
+  // spline_order + 1 parameters of each coordinate of a segment, which holds
+  // unless a full kernel is added with AddKernel
+  bool IsBlockDiagonal() const { return block_diagonal_; }
+
   // build-in kernel methods
   void AddDerivativeKernelMatrix(const double weight);
   void AddSecondOrderDerivativeMatrix(const double weight);
@@ -64,6 +71,7 @@ class Spline2dKernel {
  private:
   Eigen::MatrixXd kernel_matrix_;
   Eigen::MatrixXd offset_;
+  bool block_diagonal_ = true;
   std::vector<double> t_knots_;
   uint32_t spline_order_;
   size_t total_params_;
@@ -73,6 +73,7 @@ Status NaviPlanning::Init(const PlanningConfig& config) {
       FLAGS_traffic_rule_config_filename, &traffic_rule_configs_))
       << "Failed to load traffic rule config file "
       << FLAGS_traffic_rule_config_filename;
+  traffic_decider_.Init(traffic_rule_configs_);
 
   // clear planning status
   PlanningContext::MutablePlanningStatus()->Clear();
@@ -248,9 +249,8 @@ void NaviPlanning::RunOnce(const LocalView& local_view,
   }
 
   for (auto& ref_line_info : *frame_->mutable_reference_line_info()) {
-    TrafficDecider traffic_decider;
-    traffic_decider.Init(traffic_rule_configs_);
-    auto traffic_status = traffic_decider.Execute(frame_.get(), &ref_line_info);
+    auto traffic_status =
+        traffic_decider_.Execute(frame_.get(), &ref_line_info);
     if (!traffic_status.ok() || !ref_line_info.IsDrivable()) {
       ref_line_info.SetDrivable(false);
       AWARN << "Reference line " << ref_line_info.Lanes().Id()
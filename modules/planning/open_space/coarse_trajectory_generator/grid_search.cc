@@ -20,6 +20,10 @@
 
 #include "modules/planning/open_space/coarse_trajectory_generator/grid_search.h"
 
+#include <cmath>
+#include <cstdint>
+#include <functional>
+
 namespace apollo {
 namespace planning {
 GridSearch::GridSearch(const PlannerOpenSpaceConfig& open_space_conf) {
@@ -37,17 +41,45 @@ bool GridSearch::CheckConstraints(std::shared_ptr<Node2d> node) {
   if (obstacles_linesegments_vec_.size() == 0) {
     return true;
   }
-  double node_grid_x = node->GetGridX();
-  double node_grid_y = node->GetGridY();
-  if (node_grid_x > max_grid_x_ || node_grid_x < 0 ||
-      node_grid_y > max_grid_y_ || node_grid_y < 0) {
+  return CheckConstraints(node->GetGridX(), node->GetGridY());
+}
+
+bool GridSearch::CheckConstraints(const double grid_x, const double grid_y) {
+  if (grid_x > max_grid_x_ || grid_x < 0 || grid_y > max_grid_y_ ||
+      grid_y < 0) {
     return false;
   }
   for (const auto& obstacle_linesegments : obstacles_linesegments_vec_) {
     for (const common::math::LineSegment2d& linesegment :
          obstacle_linesegments) {
-      if (linesegment.DistanceTo({node->GetGridX(), node->GetGridY()}) <
-          node_radius_) {
+      if (linesegment.DistanceTo({grid_x, grid_y}) < node_radius_) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool GridSearch::IsSameDpMapRequest(
+    const double end_grid_x, const double end_grid_y,
+    const std::vector<double>& XYbounds,
+    const std::vector<std::vector<common::math::LineSegment2d>>&
+        obstacles_linesegments_vec) const {
+  if (!has_dp_map_ || end_grid_x != dp_map_end_grid_x_ ||
+      end_grid_y != dp_map_end_grid_y_ || XYbounds != XYbounds_ ||
+      obstacles_linesegments_vec.size() !=
+          obstacles_linesegments_vec_.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < obstacles_linesegments_vec.size(); ++i) {
+    const auto& linesegments = obstacles_linesegments_vec[i];
+    const auto& cached_linesegments = obstacles_linesegments_vec_[i];
+    if (linesegments.size() != cached_linesegments.size()) {
+      return false;
+    }
+    for (size_t j = 0; j < linesegments.size(); ++j) {
+      if (!(linesegments[j].start() == cached_linesegments[j].start()) ||
+          !(linesegments[j].end() == cached_linesegments[j].end())) {
         return false;
       }
     }
@@ -109,6 +141,8 @@ bool GridSearch::GenerateAStarPath(
       open_pq;
   std::unordered_map<double, std::shared_ptr<Node2d>> open_set;
   std::unordered_map<double, std::shared_ptr<Node2d>> close_set;
+  // the bounds and the obstacles of the dp map are replaced below
+  has_dp_map_ = false;
   XYbounds_ = XYbounds;
   std::shared_ptr<Node2d> start_node =
       std::make_shared<Node2d>(sx, sy, xy_grid_resolution_, XYbounds_);
@@ -166,62 +200,105 @@ bool GridSearch::GenerateDpMap(
     const double& ex, const double& ey, const std::vector<double>& XYbounds,
     const std::vector<std::vector<common::math::LineSegment2d>>&
         obstacles_linesegments_vec) {
-  std::priority_queue<std::pair<double, double>,
-                      std::vector<std::pair<double, double>>, cmp>
-      open_pq;
-  std::unordered_map<double, std::shared_ptr<Node2d>> open_set;
-  dp_map_ = decltype(dp_map_)();
-  XYbounds_ = XYbounds;
   // XYbounds with xmin, xmax, ymin, ymax
+  const double end_grid_x =
+      std::round((ex - XYbounds[0]) / xy_grid_resolution_);
+  const double end_grid_y =
+      std::round((ey - XYbounds[2]) / xy_grid_resolution_);
+  if (IsSameDpMapRequest(end_grid_x, end_grid_y, XYbounds,
+                         obstacles_linesegments_vec)) {
+    ADEBUG << "reuse the dp map of the last request";
+    return true;
+  }
+  has_dp_map_ = false;
+  XYbounds_ = XYbounds;
   max_grid_y_ = std::round((XYbounds_[3] - XYbounds_[2]) / xy_grid_resolution_);
   max_grid_x_ = std::round((XYbounds_[1] - XYbounds_[0]) / xy_grid_resolution_);
-  std::shared_ptr<Node2d> end_node =
-      std::make_shared<Node2d>(ex, ey, xy_grid_resolution_, XYbounds_);
   obstacles_linesegments_vec_ = obstacles_linesegments_vec;
-  open_set.insert(std::make_pair(end_node->GetIndex(), end_node));
-  open_pq.push(std::make_pair(end_node->GetIndex(), end_node->GetCost()));
+  const int num_grid_x = static_cast<int>(max_grid_x_) + 1;
+  const int num_grid_y = static_cast<int>(max_grid_y_) + 1;
+  dp_map_.assign(num_grid_x * num_grid_y,
+                 std::numeric_limits<double>::infinity());
+  if (end_grid_x < 0 || end_grid_x > max_grid_x_ || end_grid_y < 0 ||
+      end_grid_y > max_grid_y_) {
+    AERROR << "end point out of the XYbounds";
+    return false;
+  }
 
-  // Grid a star begins
+  // the constraints of a grid are checked once, as each grid is reached from
+  // up to eight neighbors.
+  enum GridState : uint8_t { UNCHECKED = 0, FREE = 1, BLOCKED = 2 };
+  std::vector<uint8_t> grid_states(dp_map_.size(), UNCHECKED);
+  constexpr int kNumNeighbors = 8;
+  const int kNeighborDx[kNumNeighbors] = {0, 1, 1, 1, 0, -1, -1, -1};
+  const int kNeighborDy[kNumNeighbors] = {1, 1, 0, -1, -1, -1, 0, 1};
+  const double diagonal_distance = std::sqrt(2.0);
+
+  // Dijkstra from the end grid, with the outdated queue entries skipped
+  std::priority_queue<std::pair<double, int>,
+                      std::vector<std::pair<double, int>>,
+                      std::greater<std::pair<double, int>>>
+      open_pq;
+  const int end_index = static_cast<int>(end_grid_x) * num_grid_y +
+                        static_cast<int>(end_grid_y);
+  dp_map_[end_index] = 0.0;
+  open_pq.push(std::make_pair(0.0, end_index));
   size_t explored_node_num = 0;
   while (!open_pq.empty()) {
-    double current_id = open_pq.top().first;
+    const double current_cost = open_pq.top().first;
+    const int current_index = open_pq.top().second;
     open_pq.pop();
-    std::shared_ptr<Node2d> current_node = open_set[current_id];
-    dp_map_.insert(std::make_pair(current_node->GetIndex(), current_node));
-    std::vector<std::shared_ptr<Node2d>> next_nodes =
-        std::move(GenerateNextNodes(current_node));
-    for (auto& next_node : next_nodes) {
-      if (!CheckConstraints(next_node)) {
+    if (current_cost > dp_map_[current_index]) {
+      continue;
+    }
+    const int current_x = current_index / num_grid_y;
+    const int current_y = current_index % num_grid_y;
+    for (int i = 0; i < kNumNeighbors; ++i) {
+      const int next_x = current_x + kNeighborDx[i];
+      const int next_y = current_y + kNeighborDy[i];
+      if (next_x < 0 || next_x >= num_grid_x || next_y < 0 ||
+          next_y >= num_grid_y) {
         continue;
       }
-      if (dp_map_.find(next_node->GetIndex()) != dp_map_.end()) {
+      const int next_index = next_x * num_grid_y + next_y;
+      if (grid_states[next_index] == UNCHECKED) {
+        grid_states[next_index] =
+            CheckConstraints(next_x, next_y) ? FREE : BLOCKED;
+      }
+      if (grid_states[next_index] == BLOCKED) {
         continue;
       }
-      if (open_set.find(next_node->GetIndex()) == open_set.end()) {
-        ++explored_node_num;
-        next_node->SetPreNode(current_node);
-        open_set.insert(std::make_pair(next_node->GetIndex(), next_node));
-        open_pq.push(
-            std::make_pair(next_node->GetIndex(), next_node->GetCost()));
-      } else {
-        if (open_set[next_node->GetIndex()]->GetCost() > next_node->GetCost()) {
-          open_set[next_node->GetIndex()]->SetCost(next_node->GetCost());
-          open_set[next_node->GetIndex()]->SetPreNode(current_node);
+      const double next_cost =
+          current_cost +
+          (kNeighborDx[i] != 0 && kNeighborDy[i] != 0 ? diagonal_distance
+                                                      : 1.0);
+      if (next_cost < dp_map_[next_index]) {
+        if (std::isinf(dp_map_[next_index])) {
+          ++explored_node_num;
         }
+        dp_map_[next_index] = next_cost;
+        open_pq.push(std::make_pair(next_cost, next_index));
       }
     }
   }
+  has_dp_map_ = true;
+  dp_map_end_grid_x_ = end_grid_x;
+  dp_map_end_grid_y_ = end_grid_y;
   ADEBUG << "explored node num is " << explored_node_num;
   return true;
 }
 
 double GridSearch::CheckDpMap(const double& sx, const double& sy) {
-  double index = Node2d::CalcIndex(sx, sy, xy_grid_resolution_, XYbounds_);
-  if (dp_map_.find(index) != dp_map_.end()) {
-    return dp_map_[index]->GetCost() * xy_grid_resolution_;
-  } else {
+  const double grid_x = std::round((sx - XYbounds_[0]) / xy_grid_resolution_);
+  const double grid_y = std::round((sy - XYbounds_[2]) / xy_grid_resolution_);
+  if (!has_dp_map_ || grid_x < 0 || grid_x > max_grid_x_ || grid_y < 0 ||
+      grid_y > max_grid_y_) {
     return std::numeric_limits<double>::infinity();
   }
+  const int index = static_cast<int>(grid_x) *
+                        (static_cast<int>(max_grid_y_) + 1) +
+                    static_cast<int>(grid_y);
+  return dp_map_[index] * xy_grid_resolution_;
 }
 
 void GridSearch::LoadGridAStarResult(GridAStartResult* result) {
@@ -105,6 +105,11 @@ class GridSearch {
       const std::vector<std::vector<common::math::LineSegment2d>>&
           obstacles_linesegments_vec,
       GridAStartResult* result);
+  /**
+   * @brief Generates the costs from every grid to the end point. The map of
+   * the last call is kept when the end grid, the bounds and the obstacles
+   * are the same, as they usually are over the cycles of one parking.
+   */
   bool GenerateDpMap(
       const double& ex, const double& ey, const std::vector<double>& XYbounds,
       const std::vector<std::vector<common::math::LineSegment2d>>&
@@ -117,6 +122,13 @@ class GridSearch {
   std::vector<std::shared_ptr<Node2d>> GenerateNextNodes(
       std::shared_ptr<Node2d> node);
   bool CheckConstraints(std::shared_ptr<Node2d> node);
+  // checks the bounds and the obstacles of a grid
+  bool CheckConstraints(const double grid_x, const double grid_y);
+  bool IsSameDpMapRequest(
+      const double end_grid_x, const double end_grid_y,
+      const std::vector<double>& XYbounds,
+      const std::vector<std::vector<common::math::LineSegment2d>>&
+          obstacles_linesegments_vec) const;
   void LoadGridAStarResult(GridAStartResult* result);
 
  private:
@@ -137,7 +149,12 @@ class GridSearch {
       return left.second >= right.second;
     }
   };
-  std::unordered_map<double, std::shared_ptr<Node2d>> dp_map_;
+  // the path costs in grids, indexed by grid_x * (max_grid_y_ + 1) + grid_y,
+  // and infinity for the grids that cannot reach the end.
+  std::vector<double> dp_map_;
+  bool has_dp_map_ = false;
+  double dp_map_end_grid_x_ = 0.0;
+  double dp_map_end_grid_y_ = 0.0;
 };
 }  // namespace planning
 }  // namespace apollo
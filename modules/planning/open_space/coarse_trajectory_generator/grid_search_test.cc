@@ -0,0 +1,73 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/*
+ * @file
+ */
+#include "modules/planning/open_space/coarse_trajectory_generator/grid_search.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace planning {
+
+class GridSearchTest : public ::testing::Test {
+ public:
+  virtual void SetUp() {
+    PlannerOpenSpaceConfig planner_open_space_config;
+    planner_open_space_config.mutable_warm_start_config()
+        ->set_grid_a_star_xy_resolution(0.5);
+    grid_search_.reset(new GridSearch(planner_open_space_config));
+  }
+
+ protected:
+  std::unique_ptr<GridSearch> grid_search_;
+  std::vector<double> XYbounds_ = {-5.0, 5.0, -5.0, 5.0};
+  std::vector<std::vector<common::math::LineSegment2d>> obstacles_;
+};
+
+TEST_F(GridSearchTest, GenerateDpMap) {
+  ASSERT_TRUE(grid_search_->GenerateDpMap(0.0, 0.0, XYbounds_, obstacles_));
+  EXPECT_DOUBLE_EQ(0.0, grid_search_->CheckDpMap(0.0, 0.0));
+  EXPECT_DOUBLE_EQ(2.0, grid_search_->CheckDpMap(2.0, 0.0));
+  EXPECT_DOUBLE_EQ(2.0, grid_search_->CheckDpMap(0.0, -2.0));
+  EXPECT_DOUBLE_EQ(std::sqrt(2.0), grid_search_->CheckDpMap(1.0, 1.0));
+  EXPECT_DOUBLE_EQ(std::sqrt(2.0) + 0.5, grid_search_->CheckDpMap(1.5, 1.0));
+  EXPECT_EQ(std::numeric_limits<double>::infinity(),
+            grid_search_->CheckDpMap(10.0, 0.0));
+}
+
+TEST_F(GridSearchTest, ReuseDpMap) {
+  ASSERT_TRUE(grid_search_->GenerateDpMap(0.0, 0.0, XYbounds_, obstacles_));
+  ASSERT_TRUE(grid_search_->GenerateDpMap(0.1, 0.0, XYbounds_, obstacles_));
+  EXPECT_DOUBLE_EQ(2.0, grid_search_->CheckDpMap(2.0, 0.0));
+
+  // a new end point
+  ASSERT_TRUE(grid_search_->GenerateDpMap(2.0, 0.0, XYbounds_, obstacles_));
+  EXPECT_DOUBLE_EQ(0.0, grid_search_->CheckDpMap(2.0, 0.0));
+  EXPECT_DOUBLE_EQ(2.0, grid_search_->CheckDpMap(0.0, 0.0));
+
+  EXPECT_FALSE(grid_search_->GenerateDpMap(6.0, 0.0, XYbounds_, obstacles_));
+  EXPECT_EQ(std::numeric_limits<double>::infinity(),
+            grid_search_->CheckDpMap(2.0, 0.0));
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -129,10 +129,25 @@ std::shared_ptr<Node3d> HybridAStar::LoadRSPinCS(
       reeds_shepp_to_end->x, reeds_shepp_to_end->y, reeds_shepp_to_end->phi,
       XYbounds_, planner_open_space_config_));
   end_node->SetPre(current_node);
-  close_set_.insert(std::make_pair(end_node->GetIndex(), end_node));
+  AddToCloseSet(end_node->GetIndex());
   return end_node;
 }
 
+bool HybridAStar::IsInCloseSet(const size_t index) const {
+  if (index < close_set_.size()) {
+    return close_set_[index];
+  }
+  return close_set_overflow_.count(index) > 0;
+}
+
+void HybridAStar::AddToCloseSet(const size_t index) {
+  if (index < close_set_.size()) {
+    close_set_[index] = true;
+  } else {
+    close_set_overflow_.insert(index);
+  }
+}
+
 std::shared_ptr<Node3d> HybridAStar::Next_node_generator(
     std::shared_ptr<Node3d> current_node, size_t next_node_index) {
   double steering = 0.0;
@@ -323,9 +338,20 @@ bool HybridAStar::Plan(
     HybridAStartResult* result) {
   // clear containers
   open_set_.clear();
-  close_set_.clear();
   open_pq_ = decltype(open_pq_)();
   final_node_ = nullptr;
+  // the largest index of Node3d with a phi in [-pi, pi] inside XYbounds
+  const double x_range = XYbounds[1] - XYbounds[0];
+  const double y_range = XYbounds[3] - XYbounds[2];
+  const double max_grid_x = std::floor(x_range / xy_grid_resolution_);
+  const double max_grid_y = std::floor(y_range / xy_grid_resolution_);
+  const double max_grid_phi =
+      std::floor(2.0 * M_PI / planner_open_space_config_.warm_start_config()
+                                  .phi_grid_resolution());
+  const size_t max_index = static_cast<size_t>(
+      max_grid_phi * x_range * y_range + max_grid_y * x_range + max_grid_x);
+  close_set_.assign(max_index + 1, false);
+  close_set_overflow_.clear();
 
   std::vector<std::vector<common::math::LineSegment2d>>
       obstacles_linesegments_vec;
@@ -385,7 +411,7 @@ bool HybridAStar::Plan(
     }
     end_time = Clock::NowInSeconds();
     rs_time += end_time - start_time;
-    close_set_.insert(std::make_pair(current_node->GetIndex(), current_node));
+    AddToCloseSet(current_node->GetIndex());
     for (size_t i = 0; i < next_node_num_; ++i) {
       std::shared_ptr<Node3d> next_node = Next_node_generator(current_node, i);
       // boundary check failure handle
@@ -393,7 +419,7 @@ bool HybridAStar::Plan(
         continue;
       }
       // check if the node is already in the close set
-      if (close_set_.find(next_node->GetIndex()) != close_set_.end()) {
+      if (IsInCloseSet(next_node->GetIndex())) {
         continue;
       }
       // collision check
@@ -34,6 +34,7 @@
 #include <memory>
 #include <queue>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -94,6 +95,8 @@ class HybridAStar {
                   std::shared_ptr<Node3d> next_node);
   double HoloObstacleHeuristic(std::shared_ptr<Node3d> next_node);
   bool GetResult(HybridAStartResult* result);
+  bool IsInCloseSet(const size_t index) const;
+  void AddToCloseSet(const size_t index);
   bool GenerateSpeedAcceleration(HybridAStartResult* result);
 
  private:
@@ -132,7 +135,10 @@ class HybridAStar {
                       std::vector<std::pair<size_t, double>>, cmp>
       open_pq_;
   std::unordered_map<size_t, std::shared_ptr<Node3d>> open_set_;
-  std::unordered_map<size_t, std::shared_ptr<Node3d>> close_set_;
+  // indexed by the node index for the nodes with a normalized phi inside the
+  // XYbounds, and a hash set for any other node.
+  std::vector<bool> close_set_;
+  std::unordered_set<size_t> close_set_overflow_;
   std::unique_ptr<ReedShepp> reed_shepp_generator_;
   std::unique_ptr<GridSearch> grid_a_star_heuristic_generator_;
 };
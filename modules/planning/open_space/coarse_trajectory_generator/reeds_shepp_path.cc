@@ -20,6 +20,8 @@
 
 #include "modules/planning/open_space/coarse_trajectory_generator/reeds_shepp_path.h"
 
+#include <algorithm>
+
 namespace apollo {
 namespace planning {
 
@@ -59,90 +61,68 @@ std::pair<double, double> ReedShepp::calc_tau_omega(const double& u,
 bool ReedShepp::ShortestRSP(const std::shared_ptr<Node3d> start_node,
                             const std::shared_ptr<Node3d> end_node,
                             std::shared_ptr<ReedSheppPath> optimal_path) {
-  std::vector<ReedSheppPath> all_possible_paths;
-  if (!GenerateRSPs(start_node, end_node, &all_possible_paths)) {
-    AERROR << "Fail to generate different combination of Reed Shepp "
-              "paths";
-    return false;
-  }
+  ReedSheppPath shortest_path;
+  if (FLAGS_enable_parallel_hybrid_a) {
+    std::vector<ReedSheppPath> all_possible_paths;
+    if (!GenerateRSPPar(start_node, end_node, &all_possible_paths)) {
+      AERROR << "Fail to generate different combination of Reed Shepp "
+                "paths";
+      return false;
+    }
 
-  double optimal_path_length = std::numeric_limits<double>::infinity();
-  size_t optimal_path_index = 0;
-  size_t paths_size = all_possible_paths.size();
-  for (size_t i = 0; i < paths_size; ++i) {
-    if (all_possible_paths.at(i).total_length > 0 &&
-        all_possible_paths.at(i).total_length < optimal_path_length) {
-      optimal_path_index = i;
-      optimal_path_length = all_possible_paths.at(i).total_length;
+    double optimal_path_length = std::numeric_limits<double>::infinity();
+    size_t optimal_path_index = 0;
+    size_t paths_size = all_possible_paths.size();
+    for (size_t i = 0; i < paths_size; ++i) {
+      if (all_possible_paths.at(i).total_length > 0 &&
+          all_possible_paths.at(i).total_length < optimal_path_length) {
+        optimal_path_index = i;
+        optimal_path_length = all_possible_paths.at(i).total_length;
+      }
     }
+    shortest_path = std::move(all_possible_paths[optimal_path_index]);
+  } else {
+    // only the lengths are compared, and the shortest path is interpolated
+    RSPCandidate shortest_candidate;
+    if (!GenerateRSP(start_node, end_node, &shortest_candidate)) {
+      AERROR << "Fail to generate different combination of Reed Shepp "
+                "paths";
+      return false;
+    }
+    shortest_path.segs_lengths.assign(
+        shortest_candidate.lengths,
+        shortest_candidate.lengths + shortest_candidate.size);
+    shortest_path.segs_types.assign(
+        shortest_candidate.types,
+        shortest_candidate.types + shortest_candidate.size);
+    shortest_path.total_length = shortest_candidate.total_length;
   }
 
-  if (!GenerateLocalConfigurations(start_node, end_node,
-                                   &(all_possible_paths[optimal_path_index]))) {
+  if (!GenerateLocalConfigurations(start_node, end_node, &shortest_path)) {
     AERROR << "Fail to generate local configurations(x, y, phi) in SetRSP";
     return false;
   }
 
-  if (std::abs(all_possible_paths[optimal_path_index].x.back() -
-               end_node->GetX()) > 1e-3 ||
-      std::abs(all_possible_paths[optimal_path_index].y.back() -
-               end_node->GetY()) > 1e-3 ||
-      std::abs(all_possible_paths[optimal_path_index].phi.back() -
-               end_node->GetPhi()) > 1e-3) {
+  if (std::abs(shortest_path.x.back() - end_node->GetX()) > 1e-3 ||
+      std::abs(shortest_path.y.back() - end_node->GetY()) > 1e-3 ||
+      std::abs(shortest_path.phi.back() - end_node->GetPhi()) > 1e-3) {
     AERROR << "RSP end position not right";
-    for (size_t i = 0;
-         i < all_possible_paths[optimal_path_index].segs_types.size(); ++i) {
-      AERROR << "types are "
-             << all_possible_paths[optimal_path_index].segs_types[i];
+    for (size_t i = 0; i < shortest_path.segs_types.size(); ++i) {
+      AERROR << "types are " << shortest_path.segs_types[i];
     }
-    AERROR << "x, y, phi are: "
-        << all_possible_paths[optimal_path_index].x.back()
-        << ", "
-        << all_possible_paths[optimal_path_index].y.back()
-        << ", "
-        << all_possible_paths[optimal_path_index].phi.back();
-    AERROR << "end x, y, phi are: "
-        << end_node->GetX()
-        << ", "
-        << end_node->GetY()
-        << ", "
-        << end_node->GetPhi();
+    AERROR << "x, y, phi are: " << shortest_path.x.back() << ", "
+           << shortest_path.y.back() << ", " << shortest_path.phi.back();
+    AERROR << "end x, y, phi are: " << end_node->GetX() << ", "
+           << end_node->GetY() << ", " << end_node->GetPhi();
     return false;
   }
-  (*optimal_path).x = all_possible_paths[optimal_path_index].x;
-  (*optimal_path).y = all_possible_paths[optimal_path_index].y;
-  (*optimal_path).phi = all_possible_paths[optimal_path_index].phi;
-  (*optimal_path).gear = all_possible_paths[optimal_path_index].gear;
-  (*optimal_path).total_length =
-      all_possible_paths[optimal_path_index].total_length;
-  (*optimal_path).segs_types =
-      all_possible_paths[optimal_path_index].segs_types;
-  (*optimal_path).segs_lengths =
-      all_possible_paths[optimal_path_index].segs_lengths;
-  return true;
-}
-
-bool ReedShepp::GenerateRSPs(const std::shared_ptr<Node3d> start_node,
-                             const std::shared_ptr<Node3d> end_node,
-                             std::vector<ReedSheppPath>* all_possible_paths) {
-  if (FLAGS_enable_parallel_hybrid_a) {
-    // AINFO << "parallel hybrid a*";
-    if (!GenerateRSPPar(start_node, end_node, all_possible_paths)) {
-      AERROR << "Fail to generate general profile of different RSPs";
-      return false;
-    }
-  } else {
-    if (!GenerateRSP(start_node, end_node, all_possible_paths)) {
-      AERROR << "Fail to generate general profile of different RSPs";
-      return false;
-    }
-  }
+  *optimal_path = std::move(shortest_path);
   return true;
 }
 
 bool ReedShepp::GenerateRSP(const std::shared_ptr<Node3d> start_node,
                             const std::shared_ptr<Node3d> end_node,
-                            std::vector<ReedSheppPath>* all_possible_paths) {
+                            RSPCandidate* shortest_candidate) {
   double dx = end_node->GetX() - start_node->GetX();
   double dy = end_node->GetY() - start_node->GetY();
   double dphi = end_node->GetPhi() - start_node->GetPhi();
@@ -151,25 +131,25 @@ bool ReedShepp::GenerateRSP(const std::shared_ptr<Node3d> start_node,
   // normalize the initial point to (0,0,0)
   double x = (c * dx + s * dy) * max_kappa_;
   double y = (-s * dx + c * dy) * max_kappa_;
-  if (!SCS(x, y, dphi, all_possible_paths)) {
+  if (!SCS(x, y, dphi, shortest_candidate)) {
     AERROR << "Fail at SCS";
   }
-  if (!CSC(x, y, dphi, all_possible_paths)) {
+  if (!CSC(x, y, dphi, shortest_candidate)) {
     AERROR << "Fail at CSC";
   }
-  if (!CCC(x, y, dphi, all_possible_paths)) {
+  if (!CCC(x, y, dphi, shortest_candidate)) {
     AERROR << "Fail at CCC";
   }
-  if (!CCCC(x, y, dphi, all_possible_paths)) {
+  if (!CCCC(x, y, dphi, shortest_candidate)) {
     AERROR << "Fail at CCCC";
   }
-  if (!CCSC(x, y, dphi, all_possible_paths)) {
+  if (!CCSC(x, y, dphi, shortest_candidate)) {
     AERROR << "Fail at CCSC";
   }
-  if (!CCSCC(x, y, dphi, all_possible_paths)) {
+  if (!CCSCC(x, y, dphi, shortest_candidate)) {
     AERROR << "Fail at CCSCC";
   }
-  if (all_possible_paths->size() == 0) {
+  if (shortest_candidate->size == 0) {
     AERROR << "No path generated by certain two configurations";
     return false;
   }
@@ -177,13 +157,13 @@ bool ReedShepp::GenerateRSP(const std::shared_ptr<Node3d> start_node,
 }
 
 bool ReedShepp::SCS(const double& x, const double& y, const double& phi,
-                    std::vector<ReedSheppPath>* all_possible_paths) {
+                    RSPCandidate* shortest_candidate) {
   RSPParam SLS_param;
   SLS(x, y, phi, &SLS_param);
   double SLS_lengths[3] = {SLS_param.t, SLS_param.u, SLS_param.v};
   char SLS_types[] = "SLS";
   if (SLS_param.flag &&
-      !SetRSP(3, SLS_lengths, SLS_types, all_possible_paths)) {
+      !SetRSP(3, SLS_lengths, SLS_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with SLS_param";
     return false;
   }
@@ -193,7 +173,7 @@ bool ReedShepp::SCS(const double& x, const double& y, const double& phi,
   double SRS_lengths[3] = {SRS_param.t, SRS_param.u, SRS_param.v};
   char SRS_types[] = "SRS";
   if (SRS_param.flag &&
-      !SetRSP(3, SRS_lengths, SRS_types, all_possible_paths)) {
+      !SetRSP(3, SRS_lengths, SRS_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with SRS_param";
     return false;
   }
@@ -201,13 +181,13 @@ bool ReedShepp::SCS(const double& x, const double& y, const double& phi,
 }
 
 bool ReedShepp::CSC(const double& x, const double& y, const double& phi,
-                    std::vector<ReedSheppPath>* all_possible_paths) {
+                    RSPCandidate* shortest_candidate) {
   RSPParam LSL1_param;
   LSL(x, y, phi, &LSL1_param);
   double LSL1_lengths[3] = {LSL1_param.t, LSL1_param.u, LSL1_param.v};
   char LSL1_types[] = "LSL";
   if (LSL1_param.flag &&
-      !SetRSP(3, LSL1_lengths, LSL1_types, all_possible_paths)) {
+      !SetRSP(3, LSL1_lengths, LSL1_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LSL_param";
     return false;
   }
@@ -217,7 +197,7 @@ bool ReedShepp::CSC(const double& x, const double& y, const double& phi,
   double LSL2_lengths[3] = {-LSL2_param.t, -LSL2_param.u, -LSL2_param.v};
   char LSL2_types[] = "LSL";
   if (LSL2_param.flag &&
-      !SetRSP(3, LSL2_lengths, LSL2_types, all_possible_paths)) {
+      !SetRSP(3, LSL2_lengths, LSL2_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LSL2_param";
     return false;
   }
@@ -227,7 +207,7 @@ bool ReedShepp::CSC(const double& x, const double& y, const double& phi,
   double LSL3_lengths[3] = {LSL3_param.t, LSL3_param.u, LSL3_param.v};
   char LSL3_types[] = "RSR";
   if (LSL3_param.flag &&
-      !SetRSP(3, LSL3_lengths, LSL3_types, all_possible_paths)) {
+      !SetRSP(3, LSL3_lengths, LSL3_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LSL3_param";
     return false;
   }
@@ -237,7 +217,7 @@ bool ReedShepp::CSC(const double& x, const double& y, const double& phi,
   double LSL4_lengths[3] = {-LSL4_param.t, -LSL4_param.u, -LSL4_param.v};
   char LSL4_types[] = "RSR";
   if (LSL4_param.flag &&
-      !SetRSP(3, LSL4_lengths, LSL4_types, all_possible_paths)) {
+      !SetRSP(3, LSL4_lengths, LSL4_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LSL4_param";
     return false;
   }
@@ -247,7 +227,7 @@ bool ReedShepp::CSC(const double& x, const double& y, const double& phi,
   double LSR1_lengths[3] = {LSR1_param.t, LSR1_param.u, LSR1_param.v};
   char LSR1_types[] = "LSR";
   if (LSR1_param.flag &&
-      !SetRSP(3, LSR1_lengths, LSR1_types, all_possible_paths)) {
+      !SetRSP(3, LSR1_lengths, LSR1_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LSR1_param";
     return false;
   }
@@ -257,7 +237,7 @@ bool ReedShepp::CSC(const double& x, const double& y, const double& phi,
   double LSR2_lengths[3] = {-LSR2_param.t, -LSR2_param.u, -LSR2_param.v};
   char LSR2_types[] = "LSR";
   if (LSR2_param.flag &&
-      !SetRSP(3, LSR2_lengths, LSR2_types, all_possible_paths)) {
+      !SetRSP(3, LSR2_lengths, LSR2_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LSR2_param";
     return false;
   }
@@ -267,7 +247,7 @@ bool ReedShepp::CSC(const double& x, const double& y, const double& phi,
   double LSR3_lengths[3] = {LSR3_param.t, LSR3_param.u, LSR3_param.v};
   char LSR3_types[] = "RSL";
   if (LSR3_param.flag &&
-      !SetRSP(3, LSR3_lengths, LSR3_types, all_possible_paths)) {
+      !SetRSP(3, LSR3_lengths, LSR3_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LSR3_param";
     return false;
   }
@@ -277,7 +257,7 @@ bool ReedShepp::CSC(const double& x, const double& y, const double& phi,
   double LSR4_lengths[3] = {-LSR4_param.t, -LSR4_param.u, -LSR4_param.v};
   char LSR4_types[] = "RSL";
   if (LSR4_param.flag &&
-      !SetRSP(3, LSR4_lengths, LSR4_types, all_possible_paths)) {
+      !SetRSP(3, LSR4_lengths, LSR4_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LSR4_param";
     return false;
   }
@@ -285,13 +265,13 @@ bool ReedShepp::CSC(const double& x, const double& y, const double& phi,
 }
 
 bool ReedShepp::CCC(const double& x, const double& y, const double& phi,
-                    std::vector<ReedSheppPath>* all_possible_paths) {
+                    RSPCandidate* shortest_candidate) {
   RSPParam LRL1_param;
   LRL(x, y, phi, &LRL1_param);
   double LRL1_lengths[3] = {LRL1_param.t, LRL1_param.u, LRL1_param.v};
   char LRL1_types[] = "LRL";
   if (LRL1_param.flag &&
-      !SetRSP(3, LRL1_lengths, LRL1_types, all_possible_paths)) {
+      !SetRSP(3, LRL1_lengths, LRL1_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRL_param";
     return false;
   }
@@ -301,7 +281,7 @@ bool ReedShepp::CCC(const double& x, const double& y, const double& phi,
   double LRL2_lengths[3] = {-LRL2_param.t, -LRL2_param.u, -LRL2_param.v};
   char LRL2_types[] = "LRL";
   if (LRL2_param.flag &&
-      !SetRSP(3, LRL2_lengths, LRL2_types, all_possible_paths)) {
+      !SetRSP(3, LRL2_lengths, LRL2_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRL2_param";
     return false;
   }
@@ -311,7 +291,7 @@ bool ReedShepp::CCC(const double& x, const double& y, const double& phi,
   double LRL3_lengths[3] = {LRL3_param.t, LRL3_param.u, LRL3_param.v};
   char LRL3_types[] = "RLR";
   if (LRL3_param.flag &&
-      !SetRSP(3, LRL3_lengths, LRL3_types, all_possible_paths)) {
+      !SetRSP(3, LRL3_lengths, LRL3_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRL3_param";
     return false;
   }
@@ -321,7 +301,7 @@ bool ReedShepp::CCC(const double& x, const double& y, const double& phi,
   double LRL4_lengths[3] = {-LRL4_param.t, -LRL4_param.u, -LRL4_param.v};
   char LRL4_types[] = "RLR";
   if (LRL4_param.flag &&
-      !SetRSP(3, LRL4_lengths, LRL4_types, all_possible_paths)) {
+      !SetRSP(3, LRL4_lengths, LRL4_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRL4_param";
     return false;
   }
@@ -335,7 +315,7 @@ bool ReedShepp::CCC(const double& x, const double& y, const double& phi,
   double LRL5_lengths[3] = {LRL5_param.v, LRL5_param.u, LRL5_param.t};
   char LRL5_types[] = "LRL";
   if (LRL5_param.flag &&
-      !SetRSP(3, LRL5_lengths, LRL5_types, all_possible_paths)) {
+      !SetRSP(3, LRL5_lengths, LRL5_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRL5_param";
     return false;
   }
@@ -345,7 +325,7 @@ bool ReedShepp::CCC(const double& x, const double& y, const double& phi,
   double LRL6_lengths[3] = {-LRL6_param.v, -LRL6_param.u, -LRL6_param.t};
   char LRL6_types[] = "LRL";
   if (LRL6_param.flag &&
-      !SetRSP(3, LRL6_lengths, LRL6_types, all_possible_paths)) {
+      !SetRSP(3, LRL6_lengths, LRL6_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRL6_param";
     return false;
   }
@@ -355,7 +335,7 @@ bool ReedShepp::CCC(const double& x, const double& y, const double& phi,
   double LRL7_lengths[3] = {LRL7_param.v, LRL7_param.u, LRL7_param.t};
   char LRL7_types[] = "RLR";
   if (LRL7_param.flag &&
-      !SetRSP(3, LRL7_lengths, LRL7_types, all_possible_paths)) {
+      !SetRSP(3, LRL7_lengths, LRL7_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRL7_param";
     return false;
   }
@@ -365,7 +345,7 @@ bool ReedShepp::CCC(const double& x, const double& y, const double& phi,
   double LRL8_lengths[3] = {-LRL8_param.v, -LRL8_param.u, -LRL8_param.t};
   char LRL8_types[] = "RLR";
   if (LRL8_param.flag &&
-      !SetRSP(3, LRL8_lengths, LRL8_types, all_possible_paths)) {
+      !SetRSP(3, LRL8_lengths, LRL8_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRL8_param";
     return false;
   }
@@ -373,14 +353,14 @@ bool ReedShepp::CCC(const double& x, const double& y, const double& phi,
 }
 
 bool ReedShepp::CCCC(const double& x, const double& y, const double& phi,
-                     std::vector<ReedSheppPath>* all_possible_paths) {
+                     RSPCandidate* shortest_candidate) {
   RSPParam LRLRn1_param;
   LRLRn(x, y, phi, &LRLRn1_param);
   double LRLRn1_lengths[4] = {LRLRn1_param.t, LRLRn1_param.u, -LRLRn1_param.u,
                               LRLRn1_param.v};
   char LRLRn1_types[] = "LRLR";
   if (LRLRn1_param.flag &&
-      !SetRSP(4, LRLRn1_lengths, LRLRn1_types, all_possible_paths)) {
+      !SetRSP(4, LRLRn1_lengths, LRLRn1_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRLRn_param";
     return false;
   }
@@ -391,7 +371,7 @@ bool ReedShepp::CCCC(const double& x, const double& y, const double& phi,
                               -LRLRn2_param.v};
   char LRLRn2_types[] = "LRLR";
   if (LRLRn2_param.flag &&
-      !SetRSP(4, LRLRn2_lengths, LRLRn2_types, all_possible_paths)) {
+      !SetRSP(4, LRLRn2_lengths, LRLRn2_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRLRn2_param";
     return false;
   }
@@ -402,7 +382,7 @@ bool ReedShepp::CCCC(const double& x, const double& y, const double& phi,
                               LRLRn3_param.v};
   char LRLRn3_types[] = "RLRL";
   if (LRLRn3_param.flag &&
-      !SetRSP(4, LRLRn3_lengths, LRLRn3_types, all_possible_paths)) {
+      !SetRSP(4, LRLRn3_lengths, LRLRn3_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRLRn3_param";
     return false;
   }
@@ -413,7 +393,7 @@ bool ReedShepp::CCCC(const double& x, const double& y, const double& phi,
                               -LRLRn4_param.v};
   char LRLRn4_types[] = "RLRL";
   if (LRLRn4_param.flag &&
-      !SetRSP(4, LRLRn4_lengths, LRLRn4_types, all_possible_paths)) {
+      !SetRSP(4, LRLRn4_lengths, LRLRn4_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRLRn4_param";
     return false;
   }
@@ -424,7 +404,7 @@ bool ReedShepp::CCCC(const double& x, const double& y, const double& phi,
                               LRLRp1_param.v};
   char LRLRp1_types[] = "LRLR";
   if (LRLRp1_param.flag &&
-      !SetRSP(4, LRLRp1_lengths, LRLRp1_types, all_possible_paths)) {
+      !SetRSP(4, LRLRp1_lengths, LRLRp1_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRLRp1_param";
     return false;
   }
@@ -435,7 +415,7 @@ bool ReedShepp::CCCC(const double& x, const double& y, const double& phi,
                               -LRLRp2_param.v};
   char LRLRp2_types[] = "LRLR";
   if (LRLRp2_param.flag &&
-      !SetRSP(4, LRLRp2_lengths, LRLRp2_types, all_possible_paths)) {
+      !SetRSP(4, LRLRp2_lengths, LRLRp2_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRLRp2_param";
     return false;
   }
@@ -446,7 +426,7 @@ bool ReedShepp::CCCC(const double& x, const double& y, const double& phi,
                               LRLRp3_param.v};
   char LRLRp3_types[] = "RLRL";
   if (LRLRp3_param.flag &&
-      !SetRSP(4, LRLRp3_lengths, LRLRp3_types, all_possible_paths)) {
+      !SetRSP(4, LRLRp3_lengths, LRLRp3_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRLRp3_param";
     return false;
   }
@@ -457,7 +437,7 @@ bool ReedShepp::CCCC(const double& x, const double& y, const double& phi,
                               -LRLRp4_param.v};
   char LRLRp4_types[] = "RLRL";
   if (LRLRp4_param.flag &&
-      !SetRSP(4, LRLRp4_lengths, LRLRp4_types, all_possible_paths)) {
+      !SetRSP(4, LRLRp4_lengths, LRLRp4_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRLRp4_param";
     return false;
   }
@@ -465,14 +445,14 @@ bool ReedShepp::CCCC(const double& x, const double& y, const double& phi,
 }
 
 bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
-                     std::vector<ReedSheppPath>* all_possible_paths) {
+                     RSPCandidate* shortest_candidate) {
   RSPParam LRSL1_param;
   LRLRn(x, y, phi, &LRSL1_param);
   double LRSL1_lengths[4] = {LRSL1_param.t, -0.5 * M_PI, -LRSL1_param.u,
                              LRSL1_param.v};
   char LRSL1_types[] = "LRSL";
   if (LRSL1_param.flag &&
-      !SetRSP(4, LRSL1_lengths, LRSL1_types, all_possible_paths)) {
+      !SetRSP(4, LRSL1_lengths, LRSL1_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSL1_param";
     return false;
   }
@@ -483,7 +463,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              -LRSL2_param.v};
   char LRSL2_types[] = "LRSL";
   if (LRSL2_param.flag &&
-      !SetRSP(4, LRSL2_lengths, LRSL2_types, all_possible_paths)) {
+      !SetRSP(4, LRSL2_lengths, LRSL2_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSL2_param";
     return false;
   }
@@ -494,7 +474,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              LRSL3_param.v};
   char LRSL3_types[] = "RLSR";
   if (LRSL3_param.flag &&
-      !SetRSP(4, LRSL3_lengths, LRSL3_types, all_possible_paths)) {
+      !SetRSP(4, LRSL3_lengths, LRSL3_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSL3_param";
     return false;
   }
@@ -505,7 +485,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              -LRSL4_param.v};
   char LRSL4_types[] = "RLSR";
   if (LRSL4_param.flag &&
-      !SetRSP(4, LRSL4_lengths, LRSL4_types, all_possible_paths)) {
+      !SetRSP(4, LRSL4_lengths, LRSL4_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSL4_param";
     return false;
   }
@@ -516,7 +496,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              LRSR1_param.v};
   char LRSR1_types[] = "LRSR";
   if (LRSR1_param.flag &&
-      !SetRSP(4, LRSR1_lengths, LRSR1_types, all_possible_paths)) {
+      !SetRSP(4, LRSR1_lengths, LRSR1_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSR1_param";
     return false;
   }
@@ -527,7 +507,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              -LRSR2_param.v};
   char LRSR2_types[] = "LRSR";
   if (LRSR2_param.flag &&
-      !SetRSP(4, LRSR2_lengths, LRSR2_types, all_possible_paths)) {
+      !SetRSP(4, LRSR2_lengths, LRSR2_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSR2_param";
     return false;
   }
@@ -538,7 +518,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              LRSR3_param.v};
   char LRSR3_types[] = "RLSL";
   if (LRSR3_param.flag &&
-      !SetRSP(4, LRSR3_lengths, LRSR3_types, all_possible_paths)) {
+      !SetRSP(4, LRSR3_lengths, LRSR3_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSR3_param";
     return false;
   }
@@ -549,7 +529,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              -LRSR4_param.v};
   char LRSR4_types[] = "RLSL";
   if (LRSR4_param.flag &&
-      !SetRSP(4, LRSR4_lengths, LRSR4_types, all_possible_paths)) {
+      !SetRSP(4, LRSR4_lengths, LRSR4_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSR4_param";
     return false;
   }
@@ -564,7 +544,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              LRSL5_param.t};
   char LRSL5_types[] = "LSRL";
   if (LRSL5_param.flag &&
-      !SetRSP(4, LRSL5_lengths, LRSL5_types, all_possible_paths)) {
+      !SetRSP(4, LRSL5_lengths, LRSL5_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRLRn_param";
     return false;
   }
@@ -575,7 +555,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              -LRSL6_param.t};
   char LRSL6_types[] = "LSRL";
   if (LRSL6_param.flag &&
-      !SetRSP(4, LRSL6_lengths, LRSL6_types, all_possible_paths)) {
+      !SetRSP(4, LRSL6_lengths, LRSL6_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSL6_param";
     return false;
   }
@@ -586,7 +566,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              LRSL7_param.t};
   char LRSL7_types[] = "RSLR";
   if (LRSL7_param.flag &&
-      !SetRSP(4, LRSL7_lengths, LRSL7_types, all_possible_paths)) {
+      !SetRSP(4, LRSL7_lengths, LRSL7_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSL7_param";
     return false;
   }
@@ -597,7 +577,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              -LRSL8_param.t};
   char LRSL8_types[] = "RSLR";
   if (LRSL8_param.flag &&
-      !SetRSP(4, LRSL8_lengths, LRSL8_types, all_possible_paths)) {
+      !SetRSP(4, LRSL8_lengths, LRSL8_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSL8_param";
     return false;
   }
@@ -608,7 +588,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              LRSR5_param.t};
   char LRSR5_types[] = "RSRL";
   if (LRSR5_param.flag &&
-      !SetRSP(4, LRSR5_lengths, LRSR5_types, all_possible_paths)) {
+      !SetRSP(4, LRSR5_lengths, LRSR5_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSR5_param";
     return false;
   }
@@ -619,7 +599,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              -LRSR6_param.t};
   char LRSR6_types[] = "RSRL";
   if (LRSR6_param.flag &&
-      !SetRSP(4, LRSR6_lengths, LRSR6_types, all_possible_paths)) {
+      !SetRSP(4, LRSR6_lengths, LRSR6_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSR6_param";
     return false;
   }
@@ -630,7 +610,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              LRSR7_param.t};
   char LRSR7_types[] = "LSLR";
   if (LRSR7_param.flag &&
-      !SetRSP(4, LRSR7_lengths, LRSR7_types, all_possible_paths)) {
+      !SetRSP(4, LRSR7_lengths, LRSR7_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSR7_param";
     return false;
   }
@@ -641,7 +621,7 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
                              -LRSR8_param.t};
   char LRSR8_types[] = "LSLR";
   if (LRSR8_param.flag &&
-      !SetRSP(4, LRSR8_lengths, LRSR8_types, all_possible_paths)) {
+      !SetRSP(4, LRSR8_lengths, LRSR8_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSR8_param";
     return false;
   }
@@ -649,14 +629,14 @@ bool ReedShepp::CCSC(const double& x, const double& y, const double& phi,
 }
 
 bool ReedShepp::CCSCC(const double& x, const double& y, const double& phi,
-                      std::vector<ReedSheppPath>* all_possible_paths) {
+                      RSPCandidate* shortest_candidate) {
   RSPParam LRSLR1_param;
   LRSLR(x, y, phi, &LRSLR1_param);
   double LRSLR1_lengths[5] = {LRSLR1_param.t, -0.5 * M_PI, LRSLR1_param.u,
                               -0.5 * M_PI, LRSLR1_param.v};
   char LRSLR1_types[] = "LRSLR";
   if (LRSLR1_param.flag &&
-      !SetRSP(5, LRSLR1_lengths, LRSLR1_types, all_possible_paths)) {
+      !SetRSP(5, LRSLR1_lengths, LRSLR1_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSLR1_param";
     return false;
   }
@@ -667,7 +647,7 @@ bool ReedShepp::CCSCC(const double& x, const double& y, const double& phi,
                               0.5 * M_PI, -LRSLR2_param.v};
   char LRSLR2_types[] = "LRSLR";
   if (LRSLR2_param.flag &&
-      !SetRSP(5, LRSLR2_lengths, LRSLR2_types, all_possible_paths)) {
+      !SetRSP(5, LRSLR2_lengths, LRSLR2_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSLR2_param";
     return false;
   }
@@ -678,7 +658,7 @@ bool ReedShepp::CCSCC(const double& x, const double& y, const double& phi,
                               -0.5 * M_PI, LRSLR3_param.v};
   char LRSLR3_types[] = "RLSRL";
   if (LRSLR3_param.flag &&
-      !SetRSP(5, LRSLR3_lengths, LRSLR3_types, all_possible_paths)) {
+      !SetRSP(5, LRSLR3_lengths, LRSLR3_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSLR3_param";
     return false;
   }
@@ -689,7 +669,7 @@ bool ReedShepp::CCSCC(const double& x, const double& y, const double& phi,
                               0.5 * M_PI, -LRSLR4_param.v};
   char LRSLR4_types[] = "RLSRL";
   if (LRSLR4_param.flag &&
-      !SetRSP(5, LRSLR4_lengths, LRSLR4_types, all_possible_paths)) {
+      !SetRSP(5, LRSLR4_lengths, LRSLR4_types, shortest_candidate)) {
     AERROR << "Fail at SetRSP with LRSLR4_param";
     return false;
   }
@@ -905,23 +885,22 @@ void ReedShepp::LRSLR(const double& x, const double& y, const double& phi,
 }
 
 bool ReedShepp::SetRSP(const int& size, const double* lengths,
-                       const char* types,
-                       std::vector<ReedSheppPath>* all_possible_paths) {
-  ReedSheppPath path;
-  std::vector<double> length_vec(lengths, lengths + size);
-  std::vector<char> type_vec(types, types + size);
-  path.segs_lengths = length_vec;
-  path.segs_types = type_vec;
+                       const char* types, RSPCandidate* shortest_candidate) {
   double sum = 0.0;
   for (int i = 0; i < size; ++i) {
     sum += std::abs(lengths[i]);
   }
-  path.total_length = sum;
-  if (path.total_length <= 0.0) {
+  if (sum <= 0.0) {
     AERROR << "total length smaller than 0";
     return false;
   }
-  all_possible_paths->emplace_back(path);
+  // the first of the ties is kept
+  if (sum < shortest_candidate->total_length) {
+    shortest_candidate->size = size;
+    std::copy(lengths, lengths + size, shortest_candidate->lengths);
+    std::copy(types, types + size, shortest_candidate->types);
+    shortest_candidate->total_length = sum;
+  }
   return true;
 }
 
@@ -989,6 +968,9 @@ bool ReedShepp::GenerateLocalConfigurations(
     pphi.pop_back();
     pgear.pop_back();
   }
+  shortest_path->x.reserve(px.size());
+  shortest_path->y.reserve(px.size());
+  shortest_path->phi.reserve(px.size());
   for (size_t i = 0; i < px.size(); ++i) {
     shortest_path->x.push_back(std::cos(-start_node->GetPhi()) * px.at(i) +
                                std::sin(-start_node->GetPhi()) * py.at(i) +
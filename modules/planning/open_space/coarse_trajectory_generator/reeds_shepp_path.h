@@ -50,6 +50,16 @@ struct ReedSheppPath {
   std::vector<bool> gear;
 };
 
+// The segments of the shortest Reeds Shepp path found so far. It has no
+// heap storage, so that all the combinations of motion primitives are
+// compared by length before only the shortest one is interpolated.
+struct RSPCandidate {
+  int size = 0;
+  double lengths[5] = {0.0, 0.0, 0.0, 0.0, 0.0};
+  char types[5] = {0, 0, 0, 0, 0};
+  double total_length = std::numeric_limits<double>::infinity();
+};
+
 struct RSPParam {
   bool flag = false;
   double t = 0.0;
@@ -69,15 +79,10 @@ class ReedShepp {
                    std::shared_ptr<ReedSheppPath> optimal_path);
 
  protected:
-  // Generate all possible combination of movement primitives by Reed Shepp and
-  // interpolate them
-  bool GenerateRSPs(const std::shared_ptr<Node3d> start_node,
-                    const std::shared_ptr<Node3d> end_node,
-                    std::vector<ReedSheppPath>* all_possible_paths);
-  // Set the general profile of the movement primitives
+  // Set the general profile of the movement primitives and keep the shortest
   bool GenerateRSP(const std::shared_ptr<Node3d> start_node,
                    const std::shared_ptr<Node3d> end_node,
-                   std::vector<ReedSheppPath>* all_possible_paths);
+                   RSPCandidate* shortest_candidate);
   // Set the general profile of the movement primitives, parallel implementation
   bool GenerateRSPPar(const std::shared_ptr<Node3d> start_node,
                    const std::shared_ptr<Node3d> end_node,
@@ -91,9 +96,10 @@ class ReedShepp {
                      const double& ox, const double& oy, const double& ophi,
                      std::vector<double>* px, std::vector<double>* py,
                      std::vector<double>* pphi, std::vector<bool>* pgear);
-  // motion primitives combination setup function
+  // motion primitives combination setup function, which keeps the
+  // combination if it is shorter than shortest_candidate
   bool SetRSP(const int& size, const double* lengths, const char* types,
-              std::vector<ReedSheppPath>* all_possible_paths);
+              RSPCandidate* shortest_candidate);
   // setRSP parallel version
   bool SetRSPPar(const int& size, const double* lengths,
                  const std::string& types,
@@ -102,17 +108,17 @@ class ReedShepp {
   // Six different combination of motion primitive in Reed Shepp path used in
   // GenerateRSP()
   bool SCS(const double& x, const double& y, const double& phi,
-           std::vector<ReedSheppPath>* all_possible_paths);
+           RSPCandidate* shortest_candidate);
   bool CSC(const double& x, const double& y, const double& phi,
-           std::vector<ReedSheppPath>* all_possible_paths);
+           RSPCandidate* shortest_candidate);
   bool CCC(const double& x, const double& y, const double& phi,
-           std::vector<ReedSheppPath>* all_possible_paths);
+           RSPCandidate* shortest_candidate);
   bool CCCC(const double& x, const double& y, const double& phi,
-            std::vector<ReedSheppPath>* all_possible_paths);
+            RSPCandidate* shortest_candidate);
   bool CCSC(const double& x, const double& y, const double& phi,
-            std::vector<ReedSheppPath>* all_possible_paths);
+            RSPCandidate* shortest_candidate);
   bool CCSCC(const double& x, const double& y, const double& phi,
-             std::vector<ReedSheppPath>* all_possible_paths);
+             RSPCandidate* shortest_candidate);
   // different options for different combination of motion primitives
   void LSL(const double& x, const double& y, const double& phi,
            RSPParam* param);
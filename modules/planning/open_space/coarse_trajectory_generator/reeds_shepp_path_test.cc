@@ -20,6 +20,8 @@
 
 #include "modules/planning/open_space/coarse_trajectory_generator/reeds_shepp_path.h"
 
+#include <chrono>
+
 #include "cyber/common/file.h"
 #include "gtest/gtest.h"
 #include "modules/common/configs/proto/vehicle_config.pb.h"
@@ -137,5 +139,23 @@ TEST_F(reeds_shepp, test_set_5) {
   }
   check(start_node, end_node, optimal_path);
 }
+TEST_F(reeds_shepp, benchmark) {
+  std::shared_ptr<Node3d> start_node = std::shared_ptr<Node3d>(new Node3d(
+      0.0, 10.0, -10.0 * M_PI / 180.0, XYbounds_, planner_open_space_config_));
+  std::shared_ptr<Node3d> end_node = std::shared_ptr<Node3d>(new Node3d(
+      -7.0, -8.0, 150.0 * M_PI / 180.0, XYbounds_, planner_open_space_config_));
+  std::shared_ptr<ReedSheppPath> optimal_path =
+      std::shared_ptr<ReedSheppPath>(new ReedSheppPath());
+  constexpr int kNumRuns = 1000;
+  auto start_time = std::chrono::system_clock::now();
+  for (int i = 0; i < kNumRuns; ++i) {
+    reedshepp_test->ShortestRSP(start_node, end_node, optimal_path);
+  }
+  auto end_time = std::chrono::system_clock::now();
+  std::chrono::duration<double> diff = end_time - start_time;
+  AINFO << "ShortestRSP used time: " << diff.count() * 1000 / kNumRuns
+        << " ms per run.";
+  check(start_node, end_node, optimal_path);
+}
 }  // namespace planning
 }  // namespace apollo
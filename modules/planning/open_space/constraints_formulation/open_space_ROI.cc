@@ -41,29 +41,70 @@ OpenSpaceROI::OpenSpaceROI(
 }
 
 bool OpenSpaceROI::GenerateRegionOfInterest(Frame *frame) {
-  // TODO(Jinyun) only run GetOpenSpaceROI() at the first frame of
-  // open space planner to save computation effort
   vehicle_state_ = frame->vehicle_state();
   obstacles_by_frame_ = frame->GetObstacleList();
+  std::string parking_spot_id;
   if (frame->local_view().routing->routing_request().has_parking_space() &&
       frame->local_view().routing->routing_request().parking_space().has_id()) {
-    target_parking_spot_id_ = frame->local_view()
-                                  .routing->routing_request()
-                                  .parking_space()
-                                  .id()
-                                  .id();
+    parking_spot_id = frame->local_view()
+                          .routing->routing_request()
+                          .parking_space()
+                          .id()
+                          .id();
   } else {
     AERROR << "Failed to get parking space id from routing";
     return false;
   }
 
-  if (!(GetOpenSpaceROI() && GetOpenSpaceInfo())) {
+  if (!(UpdateStaticROI(parking_spot_id) && CheckVehicleInROI() &&
+        GetOpenSpaceInfo())) {
     AERROR << "Fail to get open space roi";
     return false;
   }
   return true;
 }
 
+bool OpenSpaceROI::UpdateStaticROI(const std::string &parking_spot_id) {
+  if (static_ROI_ready_ && parking_spot_id == target_parking_spot_id_) {
+    return true;
+  }
+  static_ROI_ready_ = false;
+  target_parking_spot_id_ = parking_spot_id;
+  if (!GetOpenSpaceROI()) {
+    return false;
+  }
+  if (ROI_parking_boundary_.size() != 4) {
+    AERROR << "parking boundary obstacles size not right";
+    return false;
+  }
+  parking_boundaries_edges_num_.resize(4, 1);
+  // the order is decided by the ROI()
+  parking_boundaries_edges_num_ << 2, 1, 2, 1;
+  if (!ObsHRep(ROI_parking_boundary_.size(), parking_boundaries_edges_num_,
+               ROI_parking_boundary_, &parking_boundaries_A_,
+               &parking_boundaries_b_)) {
+    AERROR << "Fail to present parking boundaries in hyperplane";
+    return false;
+  }
+  static_ROI_ready_ = true;
+  return true;
+}
+
+bool OpenSpaceROI::CheckVehicleInROI() {
+  Vec2d vehicle_xy = Vec2d(vehicle_state_.x(), vehicle_state_.y());
+  vehicle_xy -= origin_point_;
+  vehicle_xy.SelfRotate(-1.0 * origin_heading_);
+  if (vehicle_xy.x() > ROI_xy_boundary_[1] ||
+      vehicle_xy.x() < ROI_xy_boundary_[0] ||
+      vehicle_xy.y() > ROI_xy_boundary_[3] ||
+      vehicle_xy.y() < ROI_xy_boundary_[2]) {
+    std::string msg("vehicle pose outside of xy boundary of parking ROI");
+    AERROR << msg;
+    return false;
+  }
+  return true;
+}
+
 bool OpenSpaceROI::VPresentationObstacle() {
   size_t parking_boundaries_num = ROI_parking_boundary_.size();
   if (parking_boundaries_num != 4) {
@@ -71,6 +112,7 @@ bool OpenSpaceROI::VPresentationObstacle() {
     return false;
   }
 
+  obstacles_vertices_vec_.clear();
   if (FLAGS_enable_perception_obstacles) {
     size_t perception_obstacles_num = obstacles_by_frame_->Items().size();
     obstacles_num_ = perception_obstacles_num + parking_boundaries_num;
@@ -80,15 +122,12 @@ bool OpenSpaceROI::VPresentationObstacle() {
     // load vertice vector for distance approach
     Eigen::MatrixXi perception_obstacles_edges_num_ =
         4 * Eigen::MatrixXi::Ones(perception_obstacles_num, 1);
-    Eigen::MatrixXi parking_boundaries_obstacles_edges_num(4, 1);
-    // the order is decided by the ROI()
-    parking_boundaries_obstacles_edges_num << 2, 1, 2, 1;
     obstacles_edges_num_.resize(
         perception_obstacles_edges_num_.rows() +
-            parking_boundaries_obstacles_edges_num.rows(),
+            parking_boundaries_edges_num_.rows(),
         1);
     obstacles_edges_num_ << perception_obstacles_edges_num_,
-        parking_boundaries_obstacles_edges_num;
+        parking_boundaries_edges_num_;
     // load vertices for perception obstacles(repeat the first vertice at the
     // last to form closed convex hull)
     for (const auto &obstacle : obstacles_by_frame_->Items()) {
@@ -110,12 +149,7 @@ bool OpenSpaceROI::VPresentationObstacle() {
   } else {
     obstacles_num_ = parking_boundaries_num;
     // load vertice vector for distance approach
-    Eigen::MatrixXi parking_boundaries_obstacles_edges_num(4, 1);
-    // the order is decided by the ROI()
-    parking_boundaries_obstacles_edges_num << 2, 1, 2, 1;
-    obstacles_edges_num_.resize(parking_boundaries_obstacles_edges_num.rows(),
-                                1);
-    obstacles_edges_num_ << parking_boundaries_obstacles_edges_num;
+    obstacles_edges_num_ = parking_boundaries_edges_num_;
   }
 
   // load vertices for parking boundary (not need to repeat the first vertice to
@@ -129,14 +163,29 @@ bool OpenSpaceROI::VPresentationObstacle() {
 }
 
 bool OpenSpaceROI::HPresentationObstacle() {
-  obstacles_A_ = Eigen::MatrixXd::Zero(obstacles_edges_num_.sum(), 2);
-  obstacles_b_ = Eigen::MatrixXd::Zero(obstacles_edges_num_.sum(), 1);
-  // vertices using H-represetntation
-  if (!ObsHRep(obstacles_num_, obstacles_edges_num_, obstacles_vertices_vec_,
-               &obstacles_A_, &obstacles_b_)) {
+  const size_t perception_obstacles_num =
+      obstacles_num_ - ROI_parking_boundary_.size();
+  const std::vector<std::vector<Vec2d>> perception_obstacles_vertices_vec(
+      obstacles_vertices_vec_.begin(),
+      obstacles_vertices_vec_.begin() + perception_obstacles_num);
+  Eigen::MatrixXd perception_obstacles_A;
+  Eigen::MatrixXd perception_obstacles_b;
+  // vertices using H-represetntation, the parking boundaries are cached
+  if (!ObsHRep(perception_obstacles_num,
+               obstacles_edges_num_.topRows(perception_obstacles_num),
+               perception_obstacles_vertices_vec, &perception_obstacles_A,
+               &perception_obstacles_b)) {
     AERROR << "Fail to present obstacle in hyperplane";
     return false;
   }
+  const Eigen::Index perception_rows = perception_obstacles_A.rows();
+  const Eigen::Index parking_rows = parking_boundaries_A_.rows();
+  obstacles_A_.resize(perception_rows + parking_rows, 2);
+  obstacles_b_.resize(perception_rows + parking_rows, 1);
+  obstacles_A_.topRows(perception_rows) = perception_obstacles_A;
+  obstacles_b_.topRows(perception_rows) = perception_obstacles_b;
+  obstacles_A_.bottomRows(parking_rows) = parking_boundaries_A_;
+  obstacles_b_.bottomRows(parking_rows) = parking_boundaries_b_;
   return true;
 }
 
@@ -299,6 +348,7 @@ bool OpenSpaceROI::GetOpenSpaceROI() {
   end_left.SelfRotate(-1.0 * origin_heading_);
 
   // get end_pose of the parking spot
+  open_space_end_pose_.clear();
   parking_spot_heading_ = (left_down - left_top).Angle();
   double end_x = (left_top.x() + right_top.x()) / 2;
   double end_y = 0.0;
@@ -334,21 +384,12 @@ bool OpenSpaceROI::GetOpenSpaceROI() {
   double x_max = std::max({end_left.x(), end_right.x()});
   double y_min = std::min({left_down.y(), start_right.y(), start_left.y()});
   double y_max = std::max({left_down.y(), start_right.y(), start_left.y()});
+  ROI_xy_boundary_.clear();
   ROI_xy_boundary_.emplace_back(x_min);
   ROI_xy_boundary_.emplace_back(x_max);
   ROI_xy_boundary_.emplace_back(y_min);
   ROI_xy_boundary_.emplace_back(y_max);
 
-  // check if vehicle in range of xy_boundary
-  Vec2d vehicle_xy = Vec2d(vehicle_state_.x(), vehicle_state_.y());
-  vehicle_xy -= origin_point_;
-  vehicle_xy.SelfRotate(-1.0 * origin_heading_);
-  if (vehicle_xy.x() > x_max || vehicle_xy.x() < x_min ||
-      vehicle_xy.y() > y_max || vehicle_xy.y() < y_min) {
-    std::string msg("vehicle pose outside of xy boundary of parking ROI");
-    AERROR << msg;
-    return false;
-  }
   // If smaller than zero, the parking spot is on the right of the lane
   // Left, right, down or up of the boundary is decided when viewing the
   // parking spot upward
@@ -400,6 +441,7 @@ bool OpenSpaceROI::GetOpenSpaceROI() {
     up_boundary.push_back(start_right);
     up_boundary.push_back(end_right);
   }
+  ROI_parking_boundary_.clear();
   ROI_parking_boundary_.emplace_back(left_boundary);
   ROI_parking_boundary_.emplace_back(down_boundary);
   ROI_parking_boundary_.emplace_back(right_boundary);
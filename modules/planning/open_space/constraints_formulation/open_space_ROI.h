@@ -98,13 +98,22 @@ class OpenSpaceROI {
   // ROI_xy_boundary_ and ROI_parking_boundary_
   bool GetOpenSpaceROI();
 
+  // @brief the part of the ROI computed from the map only depends on the
+  // target parking spot, so it is computed once per parking spot together
+  // with the H representation of the parking boundaries
+  bool UpdateStaticROI(const std::string &parking_spot_id);
+
+  // @brief if vehicle is not in ROI_xy_boundary_, return false
+  bool CheckVehicleInROI();
+
   // @brief Represent the obstacles in vertices and load it into
   // obstacles_vertices_vec_ in clock wise order. Take different approach
   // towards warm start and distance approach
   bool VPresentationObstacle();
 
   // @brief Transform the vertice presentation of the obstacles into linear
-  // inequality as Ax>b
+  // inequality as Ax>b, only the perception obstacles are transformed and the
+  // cached parking boundaries are appended
   bool HPresentationObstacle();
 
   // @brief Helper function for HPresentationObstacle()
@@ -173,6 +182,14 @@ class OpenSpaceROI {
   // @brief parking_spot_id from routing
   std::string target_parking_spot_id_ = "";
 
+  // @brief whether the static ROI of target_parking_spot_id_ is computed
+  bool static_ROI_ready_ = false;
+
+  // @brief Linear inequality representation of ROI_parking_boundary_ Ax>b
+  Eigen::MatrixXi parking_boundaries_edges_num_;
+  Eigen::MatrixXd parking_boundaries_A_;
+  Eigen::MatrixXd parking_boundaries_b_;
+
   apollo::planning::PlannerOpenSpaceConfig planner_open_space_config_;
 
   apollo::common::VehicleParam vehicle_params_;
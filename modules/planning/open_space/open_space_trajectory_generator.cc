@@ -65,7 +65,8 @@ apollo::common::Status OpenSpaceTrajectoryGenerator::Plan(
     const Eigen::MatrixXi& obstacles_edges_num,
     const Eigen::MatrixXd& obstacles_A, const Eigen::MatrixXd& obstacles_b,
     const std::vector<std::vector<common::math::Vec2d>>&
-        obstacles_vertices_vec) {
+        obstacles_vertices_vec,
+    const std::function<void()>& on_trajectory_updated) {
   if (!vehicle_state.has_x() || XYbounds.size() == 0 || end_pose.size() == 0 ||
       obstacles_edges_num.cols() == 0 || obstacles_A.cols() == 0 ||
       obstacles_b.cols() == 0) {
@@ -84,8 +85,11 @@ apollo::common::Status OpenSpaceTrajectoryGenerator::Plan(
   }
 
   // initial state
-  stitching_trajectory_ = stitching_trajectory;
-  planning_init_point_ = stitching_trajectory_.back();
+  {
+    std::lock_guard<std::mutex> lock(trajectory_mutex_);
+    stitching_trajectory_ = stitching_trajectory;
+  }
+  planning_init_point_ = stitching_trajectory.back();
   init_state_ = planning_init_point_.path_point();
   init_x_ = init_state_.x();
   init_y_ = init_state_.y();
@@ -157,6 +161,18 @@ apollo::common::Status OpenSpaceTrajectoryGenerator::Plan(
   uWS.row(0) = steer;
   uWS.row(1) = a;
 
+  // the warm start is kinematically feasible at the nominal sampling time,
+  // and is used until the smoothed trajectory is ready
+  if (on_trajectory_updated) {
+    Eigen::MatrixXd state_warm_start = xWS;
+    TransformToWorldFrame(rotate_angle, translate_origin, &state_warm_start);
+    Eigen::MatrixXd control_warm_start = Eigen::MatrixXd::Zero(2, horizon_ + 1);
+    control_warm_start.leftCols(horizon_) = uWS;
+    LoadTrajectory(state_warm_start, control_warm_start,
+                   Eigen::MatrixXd::Constant(1, horizon_ + 1, ts_));
+    on_trajectory_updated();
+  }
+
   // Step 8 : Formulate distance approach problem
   // solution from distance approach
   ADEBUG << "Start forming state warm start problem with configs setting : "
@@ -211,31 +227,38 @@ apollo::common::Status OpenSpaceTrajectoryGenerator::Plan(
 
   // record debug info
   if (FLAGS_enable_record_debug) {
+    std::lock_guard<std::mutex> lock(trajectory_mutex_);
     open_space_debug_.Clear();
     RecordDebugInfo(xWS, uWS, l_warm_up, n_warm_up, dual_l_result_ds,
                     dual_n_result_ds, state_result_ds, control_result_ds,
                     time_result_ds, XYbounds_, obstacles_vertices_vec);
   }
-  // rescale the states to the world frame
-  for (size_t i = 0; i < horizon_ + 1; ++i) {
-    double tmp_x = state_result_ds(0, i);
-    state_result_ds(0, i) = state_result_ds(0, i) * std::cos(rotate_angle) -
-                            state_result_ds(1, i) * std::sin(rotate_angle);
-    state_result_ds(1, i) = tmp_x * std::sin(rotate_angle) +
-                            state_result_ds(1, i) * std::cos(rotate_angle);
-    state_result_ds(0, i) += translate_origin.x();
-    state_result_ds(1, i) += translate_origin.y();
-    state_result_ds(2, i) =
-        common::math::NormalizeAngle(state_result_ds(2, i) + rotate_angle);
-  }
+  TransformToWorldFrame(rotate_angle, translate_origin, &state_result_ds);
 
   LoadTrajectory(state_result_ds, control_result_ds, time_result_ds);
 
   return Status::OK();
 }
 
+void OpenSpaceTrajectoryGenerator::TransformToWorldFrame(
+    const double rotate_angle, const Vec2d& translate_origin,
+    Eigen::MatrixXd* state) const {
+  for (size_t i = 0; i < horizon_ + 1; ++i) {
+    double tmp_x = (*state)(0, i);
+    (*state)(0, i) = (*state)(0, i) * std::cos(rotate_angle) -
+                     (*state)(1, i) * std::sin(rotate_angle);
+    (*state)(1, i) = tmp_x * std::sin(rotate_angle) +
+                     (*state)(1, i) * std::cos(rotate_angle);
+    (*state)(0, i) += translate_origin.x();
+    (*state)(1, i) += translate_origin.y();
+    (*state)(2, i) =
+        common::math::NormalizeAngle((*state)(2, i) + rotate_angle);
+  }
+}
+
 void OpenSpaceTrajectoryGenerator::UpdateTrajectory(
     apollo::common::Trajectory* trajectory_to_end) {
+  std::lock_guard<std::mutex> lock(trajectory_mutex_);
   trajectory_to_end->Clear();
   trajectory_to_end->mutable_trajectory_point()->CopyFrom(
       *(trajectory_to_end_.mutable_trajectory_point()));
@@ -243,12 +266,14 @@ void OpenSpaceTrajectoryGenerator::UpdateTrajectory(
 
 void OpenSpaceTrajectoryGenerator::UpdateDebugInfo(
     planning_internal::OpenSpaceDebug* open_space_debug) {
+  std::lock_guard<std::mutex> lock(trajectory_mutex_);
   open_space_debug->Clear();
   open_space_debug->CopyFrom(open_space_debug_);
 }
 
 void OpenSpaceTrajectoryGenerator::GetStitchingTrajectory(
     std::vector<common::TrajectoryPoint>* stitching_trajectory) {
+  std::lock_guard<std::mutex> lock(trajectory_mutex_);
   stitching_trajectory->clear();
   *stitching_trajectory = stitching_trajectory_;
 }
@@ -367,10 +392,10 @@ void OpenSpaceTrajectoryGenerator::LoadTrajectory(
     const Eigen::MatrixXd& state_result_ds,
     const Eigen::MatrixXd& control_result_ds,
     const Eigen::MatrixXd& time_result_ds) {
-  trajectory_to_end_.Clear();
+  apollo::common::Trajectory trajectory_to_end;
   double relative_time = 0.0;
   for (size_t i = 0; i < horizon_ + 1; ++i) {
-    auto* point = trajectory_to_end_.add_trajectory_point();
+    auto* point = trajectory_to_end.add_trajectory_point();
     point->mutable_path_point()->set_x(state_result_ds(0, i));
     point->mutable_path_point()->set_y(state_result_ds(1, i));
     point->mutable_path_point()->set_theta(state_result_ds(2, i));
@@ -380,6 +405,8 @@ void OpenSpaceTrajectoryGenerator::LoadTrajectory(
     point->set_steer(control_result_ds(0, i));
     point->set_a(control_result_ds(1, i));
   }
+  std::lock_guard<std::mutex> lock(trajectory_mutex_);
+  trajectory_to_end_.Swap(&trajectory_to_end);
 }
 
 bool OpenSpaceTrajectoryGenerator::IsInitPointNearDestination(
@@ -20,7 +20,9 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "Eigen/Eigen"
@@ -71,7 +73,10 @@ class OpenSpaceTrajectoryGenerator {
       const PlannerOpenSpaceConfig& planner_open_space_config);
 
   /**
-   * @brief plan for open space trajectory generators.
+   * @brief plan for open space trajectory generators. When
+   *        "on_trajectory_updated" is set, the hybrid a star trajectory is
+   *        loaded and reported through it before the smoothing starts, so that
+   *        it can be used until the smoothed trajectory replaces it.
    */
   apollo::common::Status Plan(
       const std::vector<common::TrajectoryPoint>& stitching_trajectory,
@@ -82,7 +87,8 @@ class OpenSpaceTrajectoryGenerator {
       const Eigen::MatrixXi& obstacles_edges_num,
       const Eigen::MatrixXd& obstacles_A, const Eigen::MatrixXd& obstacles_b,
       const std::vector<std::vector<common::math::Vec2d>>&
-          obstacles_vertices_vec);
+          obstacles_vertices_vec,
+      const std::function<void()>& on_trajectory_updated = nullptr);
 
   bool IsCollisionFreeTrajectory(const ADCTrajectory& adc_trajectory);
 
@@ -120,6 +126,10 @@ class OpenSpaceTrajectoryGenerator {
       const std::vector<double>& end_pose, const double& rotate_angle,
       const Vec2d& translate_origin);
 
+  void TransformToWorldFrame(const double rotate_angle,
+                             const Vec2d& translate_origin,
+                             Eigen::MatrixXd* state) const;
+
   std::unique_ptr<::apollo::planning::HybridAStar> warm_start_;
   std::unique_ptr<::apollo::planning::DistanceApproachProblem>
       distance_approach_;
@@ -141,6 +151,9 @@ class OpenSpaceTrajectoryGenerator {
   double ts_ = 0.0;
   Eigen::MatrixXd ego_;
   std::vector<double> XYbounds_;
+  // guards the trajectory, its stitching trajectory and the debug info, which
+  // are read while the next trajectory is planned
+  std::mutex trajectory_mutex_;
   apollo::common::Trajectory trajectory_to_end_;
   apollo::planning_internal::OpenSpaceDebug open_space_debug_;
 };
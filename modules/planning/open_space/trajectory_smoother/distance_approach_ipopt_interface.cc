@@ -22,6 +22,46 @@
 namespace apollo {
 namespace planning {
 
+namespace {
+
+// Writes the entries of the lower triangle of the hessian, in the order they
+// are added, as the structure, the values or only their count.
+class HessianEntries {
+ public:
+  HessianEntries(int* iRow, int* jCol, double* values)
+      : iRow_(iRow), jCol_(jCol), values_(values) {}
+
+  void Add(const int row, const int col, const double value) {
+    if (values_ != nullptr) {
+      values_[size_] = value;
+    } else if (iRow_ != nullptr) {
+      iRow_[size_] = std::max(row, col);
+      jCol_[size_] = std::min(row, col);
+    }
+    ++size_;
+  }
+
+  // adds the lower triangle of a dense block of the variables "index"
+  void AddBlock(const int (&index)[5],
+                const Eigen::Matrix<double, 5, 5>& block) {
+    for (int i = 0; i < 5; ++i) {
+      for (int j = 0; j <= i; ++j) {
+        Add(index[i], index[j], block(i, j));
+      }
+    }
+  }
+
+  int size() const { return size_; }
+
+ private:
+  int* iRow_ = nullptr;
+  int* jCol_ = nullptr;
+  double* values_ = nullptr;
+  int size_ = 0;
+};
+
+}  // namespace
+
 DistanceApproachIPOPTInterface::DistanceApproachIPOPTInterface(
     size_t horizon, double ts, Eigen::MatrixXd ego, const Eigen::MatrixXd& xWS,
     const Eigen::MatrixXd& uWS, const Eigen::MatrixXd& l_warm_up,
@@ -2284,6 +2324,19 @@ bool DistanceApproachIPOPTInterface::eval_h(int n, const double* x, bool new_x,
                                             bool new_lambda, int nele_hess,
                                             int* iRow, int* jCol,
                                             double* values) {
+  if (distance_approach_config_.enable_hand_hessian()) {
+    CHECK_EQ(nele_hess, nnz_h_hand_);
+    if (values == nullptr) {
+      eval_h_hand(nullptr, 0.0, nullptr, iRow, jCol, nullptr);
+    } else {
+      eval_h_hand(x, obj_factor, lambda, nullptr, nullptr, values);
+      if (distance_approach_config_.enable_derivative_check()) {
+        check_h_hand(n, x, obj_factor, m, lambda);
+      }
+    }
+    return true;
+  }
+
   if (values == NULL) {
     // return the structure. This is a symmetric matrix, fill the lower left
     // triangle only.
@@ -2311,6 +2364,266 @@ bool DistanceApproachIPOPTInterface::eval_h(int n, const double* x, bool new_x,
   return true;
 }
 
+int DistanceApproachIPOPTInterface::eval_h_hand(const double* x,
+                                                double obj_factor,
+                                                const double* lambda,
+                                                int* iRow, int* jCol,
+                                                double* values) {
+  // The structure does not depend on the values, so it is walked at a
+  // feasible point of ones.
+  std::vector<double> ones;
+  if (values == nullptr) {
+    ones.assign(std::max(num_of_variables_, num_of_constraints_), 1.0);
+    x = ones.data();
+    lambda = ones.data();
+    obj_factor = 1.0;
+  }
+  HessianEntries entries(iRow, jCol, values);
+
+  // 1. objective, state and control regularization
+  for (int i = 0; i < horizon_ + 1; ++i) {
+    const int state_index = state_start_index_ + 4 * i;
+    entries.Add(state_index, state_index,
+                2.0 * obj_factor * weight_state_x_);
+    entries.Add(state_index + 1, state_index + 1,
+                2.0 * obj_factor * weight_state_y_);
+    entries.Add(state_index + 2, state_index + 2,
+                2.0 * obj_factor * weight_state_phi_);
+    entries.Add(state_index + 3, state_index + 3,
+                2.0 * obj_factor * weight_state_v_);
+  }
+  for (int i = 0; i < horizon_; ++i) {
+    const int control_index = control_start_index_ + 2 * i;
+    entries.Add(control_index, control_index,
+                2.0 * obj_factor * weight_input_steer_);
+    entries.Add(control_index + 1, control_index + 1,
+                2.0 * obj_factor * weight_input_a_);
+  }
+
+  // 2. objective, input rates as w * (u - u_prev)^2 / (ts * t)^2
+  auto add_rate_cost = [&](const int u_index, const int u_prev_index,
+                           const double u_prev, const int time_index,
+                           const double weight) {
+    const double k = obj_factor * weight / (ts_ * ts_);
+    const double t = x[time_index];
+    const double d = x[u_index] - u_prev;
+    const double t2 = t * t;
+    entries.Add(u_index, u_index, 2.0 * k / t2);
+    entries.Add(u_index, time_index, -4.0 * k * d / (t2 * t));
+    entries.Add(time_index, time_index, 6.0 * k * d * d / (t2 * t2));
+    if (u_prev_index >= 0) {
+      entries.Add(u_prev_index, u_prev_index, 2.0 * k / t2);
+      entries.Add(u_index, u_prev_index, -2.0 * k / t2);
+      entries.Add(u_prev_index, time_index, 4.0 * k * d / (t2 * t));
+    }
+  };
+  add_rate_cost(control_start_index_, -1, last_time_u_(0, 0),
+                time_start_index_, weight_stitching_steer_);
+  add_rate_cost(control_start_index_ + 1, -1, last_time_u_(1, 0),
+                time_start_index_, weight_stitching_a_);
+  for (int i = 0; i < horizon_ - 1; ++i) {
+    const int control_index = control_start_index_ + 2 * i;
+    const int time_index = time_start_index_ + i + 1;
+    add_rate_cost(control_index + 2, control_index, x[control_index],
+                  time_index, weight_rate_steer_);
+    add_rate_cost(control_index + 3, control_index + 1, x[control_index + 1],
+                  time_index, weight_rate_a_);
+  }
+
+  // 3. objective, time
+  for (int i = 0; i < horizon_ + 1; ++i) {
+    const int time_index = time_start_index_ + i;
+    entries.Add(time_index, time_index,
+                2.0 * obj_factor * weight_second_order_time_);
+  }
+
+  // 4. dynamics constraints over the variables phi, v, steer, a and t. With
+  // p = ts * t * (v + 0.5 * ts * t * a) and
+  // theta = phi + 0.5 * ts * t * v * tan(steer) / wheelbase, the
+  // constraints are x' - x - p * cos(theta), y' - y - p * sin(theta),
+  // phi' - phi - p * tan(steer) / wheelbase and v' - v - ts * t * a.
+  int constraint_index = 0;
+  for (int i = 0; i < horizon_; ++i) {
+    const int state_index = state_start_index_ + 4 * i;
+    const int control_index = control_start_index_ + 2 * i;
+    const int time_index = time_start_index_ + i;
+    const int index[5] = {state_index + 2, state_index + 3, control_index,
+                          control_index + 1, time_index};
+    const double phi = x[state_index + 2];
+    const double v = x[state_index + 3];
+    const double a = x[control_index + 1];
+    const double t = x[time_index];
+    const double tan_steer = std::tan(x[control_index]);
+    const double sec2_steer = 1.0 + tan_steer * tan_steer;
+
+    const double p = ts_ * t * v + 0.5 * ts_ * ts_ * t * t * a;
+    Eigen::Matrix<double, 5, 1> p_grad;
+    p_grad << 0.0, ts_ * t, 0.0, 0.5 * ts_ * ts_ * t * t,
+        ts_ * v + ts_ * ts_ * t * a;
+    Eigen::Matrix<double, 5, 5> p_hess = Eigen::Matrix<double, 5, 5>::Zero();
+    p_hess(1, 4) = p_hess(4, 1) = ts_;
+    p_hess(3, 4) = p_hess(4, 3) = ts_ * ts_ * t;
+    p_hess(4, 4) = ts_ * ts_ * a;
+
+    const double theta = phi + 0.5 * ts_ * t * v * tan_steer / wheelbase_;
+    Eigen::Matrix<double, 5, 1> theta_grad;
+    theta_grad << 1.0, 0.5 * ts_ * t * tan_steer / wheelbase_,
+        0.5 * ts_ * t * v * sec2_steer / wheelbase_, 0.0,
+        0.5 * ts_ * v * tan_steer / wheelbase_;
+    Eigen::Matrix<double, 5, 5> theta_hess =
+        Eigen::Matrix<double, 5, 5>::Zero();
+    theta_hess(1, 2) = theta_hess(2, 1) =
+        0.5 * ts_ * t * sec2_steer / wheelbase_;
+    theta_hess(1, 4) = theta_hess(4, 1) = 0.5 * ts_ * tan_steer / wheelbase_;
+    theta_hess(2, 2) = ts_ * t * v * sec2_steer * tan_steer / wheelbase_;
+    theta_hess(2, 4) = theta_hess(4, 2) =
+        0.5 * ts_ * v * sec2_steer / wheelbase_;
+
+    const Eigen::Matrix<double, 5, 5> p_theta =
+        p_grad * theta_grad.transpose() + theta_grad * p_grad.transpose();
+    const Eigen::Matrix<double, 5, 5> theta_theta =
+        theta_grad * theta_grad.transpose();
+    const double cos_theta = std::cos(theta);
+    const double sin_theta = std::sin(theta);
+    // hessians of p * cos(theta) and p * sin(theta)
+    const Eigen::Matrix<double, 5, 5> x_hess =
+        cos_theta * p_hess - sin_theta * p_theta -
+        p * (cos_theta * theta_theta + sin_theta * theta_hess);
+    const Eigen::Matrix<double, 5, 5> y_hess =
+        sin_theta * p_hess + cos_theta * p_theta +
+        p * (-sin_theta * theta_theta + cos_theta * theta_hess);
+
+    // hessian of p * tan(steer)
+    Eigen::Matrix<double, 5, 1> tan_grad = Eigen::Matrix<double, 5, 1>::Zero();
+    tan_grad(2) = sec2_steer;
+    Eigen::Matrix<double, 5, 5> phi_hess =
+        tan_steer * p_hess + p_grad * tan_grad.transpose() +
+        tan_grad * p_grad.transpose();
+    phi_hess(2, 2) += p * 2.0 * sec2_steer * tan_steer;
+
+    Eigen::Matrix<double, 5, 5> block =
+        -lambda[constraint_index] * x_hess -
+        lambda[constraint_index + 1] * y_hess -
+        lambda[constraint_index + 2] / wheelbase_ * phi_hess;
+    block(3, 4) -= lambda[constraint_index + 3] * ts_;
+    block(4, 3) -= lambda[constraint_index + 3] * ts_;
+    entries.AddBlock(index, block);
+    constraint_index += 4;
+  }
+
+  // 5. steering rate constraints as (u - u_prev) / (ts * t)
+  auto add_rate_constraint = [&](const int u_index, const int u_prev_index,
+                                 const double u_prev, const int time_index,
+                                 const double multiplier) {
+    const double t = x[time_index];
+    const double d = x[u_index] - u_prev;
+    entries.Add(u_index, time_index, -multiplier / (ts_ * t * t));
+    entries.Add(time_index, time_index,
+                2.0 * multiplier * d / (ts_ * t * t * t));
+    if (u_prev_index >= 0) {
+      entries.Add(u_prev_index, time_index, multiplier / (ts_ * t * t));
+    }
+  };
+  add_rate_constraint(control_start_index_, -1, last_time_u_(0, 0),
+                      time_start_index_, lambda[constraint_index]);
+  ++constraint_index;
+  for (int i = 1; i < horizon_; ++i) {
+    const int control_index = control_start_index_ + 2 * i;
+    add_rate_constraint(control_index, control_index - 2,
+                        x[control_index - 2], time_start_index_ + i,
+                        lambda[constraint_index]);
+    ++constraint_index;
+  }
+
+  // 6. time constraints are linear
+  constraint_index += horizon_;
+
+  // 7. obstacle constraints over x, y, phi and the lambda of the obstacle
+  int l_index = l_start_index_;
+  for (int i = 0; i < horizon_ + 1; ++i) {
+    const int state_index = state_start_index_ + 4 * i;
+    const double cos_phi = std::cos(x[state_index + 2]);
+    const double sin_phi = std::sin(x[state_index + 2]);
+    int edges_counter = 0;
+    for (int j = 0; j < obstacles_num_; ++j) {
+      const int current_edges_num = obstacles_edges_num_(j, 0);
+      double tmp1 = 0.0;
+      double tmp2 = 0.0;
+      for (int k = 0; k < current_edges_num; ++k) {
+        tmp1 += obstacles_A_(edges_counter + k, 0) * x[l_index + k];
+        tmp2 += obstacles_A_(edges_counter + k, 1) * x[l_index + k];
+      }
+      const double norm_multiplier = lambda[constraint_index];
+      const double rotation_x_multiplier = lambda[constraint_index + 1];
+      const double rotation_y_multiplier = lambda[constraint_index + 2];
+      const double distance_multiplier = lambda[constraint_index + 3];
+
+      entries.Add(state_index + 2, state_index + 2,
+                  rotation_x_multiplier * (-cos_phi * tmp1 - sin_phi * tmp2) +
+                      rotation_y_multiplier *
+                          (sin_phi * tmp1 - cos_phi * tmp2) +
+                      distance_multiplier * offset_ *
+                          (-cos_phi * tmp1 - sin_phi * tmp2));
+      for (int k = 0; k < current_edges_num; ++k) {
+        const double a_k0 = obstacles_A_(edges_counter + k, 0);
+        const double a_k1 = obstacles_A_(edges_counter + k, 1);
+        entries.Add(l_index + k, state_index, distance_multiplier * a_k0);
+        entries.Add(l_index + k, state_index + 1, distance_multiplier * a_k1);
+        entries.Add(l_index + k, state_index + 2,
+                    rotation_x_multiplier * (-sin_phi * a_k0 + cos_phi * a_k1) +
+                        rotation_y_multiplier *
+                            (-cos_phi * a_k0 - sin_phi * a_k1) +
+                        distance_multiplier * offset_ *
+                            (-sin_phi * a_k0 + cos_phi * a_k1));
+        for (int l = 0; l <= k; ++l) {
+          const double a_l0 = obstacles_A_(edges_counter + l, 0);
+          const double a_l1 = obstacles_A_(edges_counter + l, 1);
+          entries.Add(l_index + k, l_index + l,
+                      2.0 * norm_multiplier * (a_k0 * a_l0 + a_k1 * a_l1));
+        }
+      }
+      edges_counter += current_edges_num;
+      l_index += current_edges_num;
+      constraint_index += 4;
+    }
+  }
+  // 8. the variable bounds are linear
+  return entries.size();
+}
+
+void DistanceApproachIPOPTInterface::check_h_hand(int n, const double* x,
+                                                  double obj_factor, int m,
+                                                  const double* lambda) {
+  std::vector<int> hand_rows(nnz_h_hand_);
+  std::vector<int> hand_cols(nnz_h_hand_);
+  std::vector<double> hand_values(nnz_h_hand_);
+  eval_h_hand(nullptr, 0.0, nullptr, hand_rows.data(), hand_cols.data(),
+              nullptr);
+  eval_h_hand(x, obj_factor, lambda, nullptr, nullptr, hand_values.data());
+  std::map<std::pair<int, int>, double> hessian;
+  for (int i = 0; i < nnz_h_hand_; ++i) {
+    hessian[std::make_pair(hand_rows[i], hand_cols[i])] += hand_values[i];
+  }
+
+  obj_lam[0] = obj_factor;
+  for (int idx = 0; idx < m; idx++) obj_lam[1 + idx] = lambda[idx];
+  set_param_vec(tag_L, m + 1, obj_lam);
+  sparse_hess(tag_L, n, 1, const_cast<double*>(x), &nnz_L, &rind_L, &cind_L,
+              &hessval, options_L);
+  for (int idx = 0; idx < nnz_L; idx++) {
+    hessian[std::make_pair(static_cast<int>(rind_L[idx]),
+                           static_cast<int>(cind_L[idx]))] -= hessval[idx];
+  }
+
+  constexpr double kDeltaV = 1e-6;
+  for (const auto& entry : hessian) {
+    if (std::abs(entry.second) > kDeltaV) {
+      AERROR << "hessian not match at: (" << entry.first.first << ", "
+             << entry.first.second << "), hand minus adolc: " << entry.second;
+    }
+  }
+}
+
 void DistanceApproachIPOPTInterface::finalize_solution(
     Ipopt::SolverReturn status, int n, const double* x, const double* z_L,
     const double* z_U, int m, const double* g, const double* lambda,
@@ -2857,33 +3170,46 @@ void DistanceApproachIPOPTInterface::generate_tapes(int n, int m,
 
   trace_off();
 
-  trace_on(tag_L);
+  rind_L = NULL;
+  cind_L = NULL;
 
-  for (int idx = 0; idx < n; idx++) xa[idx] <<= xp[idx];
-  for (int idx = 0; idx < m; idx++) lam[idx] = 1.0;
-  sig = 1.0;
+  hessval = NULL;
 
-  eval_obj(n, xa, &obj_value);
+  // the lagrangian tape is only needed by the adolc hessian, or to check the
+  // hand derived one against it
+  const bool enable_hand_hessian =
+      distance_approach_config_.enable_hand_hessian();
+  if (!enable_hand_hessian ||
+      distance_approach_config_.enable_derivative_check()) {
+    trace_on(tag_L);
 
-  obj_value *= mkparam(sig);
-  eval_constraints(n, xa, m, g);
+    for (int idx = 0; idx < n; idx++) xa[idx] <<= xp[idx];
+    for (int idx = 0; idx < m; idx++) lam[idx] = 1.0;
+    sig = 1.0;
 
-  for (int idx = 0; idx < m; idx++) obj_value += g[idx] * mkparam(lam[idx]);
+    eval_obj(n, xa, &obj_value);
 
-  obj_value >>= dummy;
+    obj_value *= mkparam(sig);
+    eval_constraints(n, xa, m, g);
 
-  trace_off();
+    for (int idx = 0; idx < m; idx++) obj_value += g[idx] * mkparam(lam[idx]);
 
-  rind_L = NULL;
-  cind_L = NULL;
+    obj_value >>= dummy;
 
-  hessval = NULL;
+    trace_off();
+
+    options_L[0] = 0;
+    options_L[1] = 1;
 
-  options_L[0] = 0;
-  options_L[1] = 1;
+    sparse_hess(tag_L, n, 0, xp, &nnz_L, &rind_L, &cind_L, &hessval, options_L);
+  }
 
-  sparse_hess(tag_L, n, 0, xp, &nnz_L, &rind_L, &cind_L, &hessval, options_L);
-  *nnz_h_lag = nnz_L;
+  if (enable_hand_hessian) {
+    nnz_h_hand_ = eval_h_hand(nullptr, 0.0, nullptr, nullptr, nullptr, nullptr);
+    *nnz_h_lag = nnz_h_hand_;
+  } else {
+    *nnz_h_lag = nnz_L;
+  }
 
   delete[] lam;
   delete[] g;
@@ -21,6 +21,8 @@
 #pragma once
 #include <omp.h>
 #include <limits>
+#include <map>
+#include <utility>
 #include <vector>
 #include <algorithm>
 #include "Eigen/Dense"
@@ -112,6 +114,15 @@ class DistanceApproachIPOPTInterface : public Ipopt::TNLP {
   bool eval_h(int n, const double* x, bool new_x, double obj_factor, int m,
               const double* lambda, bool new_lambda, int nele_hess, int* iRow,
               int* jCol, double* values) override;
+  // eval_h by hand. The entries are walked in a fixed order, so that the
+  // structure is filled when "values" is nullptr (and only counted when
+  // "iRow" is also nullptr), and the values otherwise. Some positions appear
+  // more than once, and Ipopt adds them up. Returns the number of entries.
+  int eval_h_hand(const double* x, double obj_factor, const double* lambda,
+                  int* iRow, int* jCol, double* values);
+  // compares the hand derived hessian with the one of ADOL-C
+  void check_h_hand(int n, const double* x, double obj_factor, int m,
+                    const double* lambda);
 
   /** @name Solution Methods */
   /** This method is called when the algorithm is complete so the TNLP can
@@ -251,6 +262,8 @@ class DistanceApproachIPOPTInterface : public Ipopt::TNLP {
   unsigned int* cind_L; /* column indices */
   double* hessval;      /* values */
   int nnz_L = 0;
+  // the number of entries of the hand derived hessian
+  int nnz_h_hand_ = 0;
   int options_L[4];
   //***************    end   ADOL-C part ***********************************
 };
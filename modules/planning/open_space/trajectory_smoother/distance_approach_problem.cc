@@ -88,6 +88,13 @@ bool DistanceApproachProblem::Solve(
   app->Options()->SetNumericValue("mu_init",
       planner_open_space_config_.distance_approach_config().\
         ipopt_config().ipopt_mu_init());
+  if (planner_open_space_config_.distance_approach_config()
+          .ipopt_config()
+          .has_ipopt_max_cpu_time()) {
+    app->Options()->SetNumericValue("max_cpu_time",
+        planner_open_space_config_.distance_approach_config().\
+          ipopt_config().ipopt_max_cpu_time());
+  }
 
   Ipopt::ApplicationReturnStatus status = app->Initialize();
   if (status != Ipopt::Solve_Succeeded) {
@@ -20,6 +20,9 @@
 
 #include "modules/planning/planner/lattice/lattice_planner.h"
 
+#include <algorithm>
+#include <deque>
+#include <future>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -27,6 +30,7 @@
 
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
+#include "cyber/task/task.h"
 #include "modules/common/math/cartesian_frenet_conversion.h"
 #include "modules/common/math/path_matcher.h"
 #include "modules/common/time/time.h"
@@ -54,6 +58,15 @@ using apollo::common::time::Clock;
 
 namespace {
 
+struct CheckedTrajectoryPair {
+  std::pair<std::shared_ptr<Curve1d>, std::shared_ptr<Curve1d>>
+      trajectory_pair;
+  double cost = 0.0;
+  DiscretizedTrajectory combined_trajectory;
+  ConstraintChecker::Result result = ConstraintChecker::Result::VALID;
+  bool in_collision = false;
+};
+
 std::vector<PathPoint> ToDiscretizedReferenceLine(
     const std::vector<ReferencePoint>& ref_points) {
   double s = 0.0;
@@ -231,19 +244,62 @@ Status LatticePlanner::PlanOnReferenceLine(
 
   size_t num_lattice_traj = 0;
 
-  while (trajectory_evaluator.has_more_trajectory_pairs()) {
-    double trajectory_pair_cost =
-        trajectory_evaluator.top_trajectory_pair_cost();
-    auto trajectory_pair = trajectory_evaluator.next_top_trajectory_pair();
-
-    // combine two 1d trajectories to one 2d trajectory
-    auto combined_trajectory = TrajectoryCombiner::Combine(
-        *ptr_reference_line, *trajectory_pair.first, *trajectory_pair.second,
+  // combine two 1d trajectories to one 2d trajectory, check longitudinal and
+  // lateral acceleration considering trajectory curvatures, then check
+  // collision with other obstacles.
+  auto check_candidate = [&](CheckedTrajectoryPair* candidate) {
+    candidate->combined_trajectory = TrajectoryCombiner::Combine(
+        *ptr_reference_line, *candidate->trajectory_pair.first,
+        *candidate->trajectory_pair.second,
         planning_init_point.relative_time());
+    candidate->result =
+        ConstraintChecker::ValidTrajectory(candidate->combined_trajectory);
+    if (candidate->result == ConstraintChecker::Result::VALID) {
+      candidate->in_collision =
+          collision_checker.InCollision(candidate->combined_trajectory);
+    }
+  };
+  // In parallel evaluation the best pairs are checked speculatively as a
+  // batch, and still consumed in cost order below, so the chosen pair is the
+  // same one the serial loop picks.
+  const size_t batch_size =
+      FLAGS_enable_parallel_lattice_evaluation
+          ? static_cast<size_t>(
+                std::max(FLAGS_lattice_speculative_check_num, 1))
+          : 1;
+  std::deque<CheckedTrajectoryPair> candidates;
+
+  while (!candidates.empty() ||
+         trajectory_evaluator.has_more_trajectory_pairs()) {
+    if (candidates.empty()) {
+      while (candidates.size() < batch_size &&
+             trajectory_evaluator.has_more_trajectory_pairs()) {
+        candidates.emplace_back();
+        candidates.back().cost =
+            trajectory_evaluator.top_trajectory_pair_cost();
+        candidates.back().trajectory_pair =
+            trajectory_evaluator.next_top_trajectory_pair();
+      }
+      if (candidates.size() == 1) {
+        check_candidate(&candidates.front());
+      } else {
+        std::vector<std::future<void>> results;
+        for (auto& candidate : candidates) {
+          results.push_back(cyber::Async(check_candidate, &candidate));
+        }
+        for (auto& result : results) {
+          result.get();
+        }
+      }
+    }
+
+    CheckedTrajectoryPair candidate = std::move(candidates.front());
+    candidates.pop_front();
+    double trajectory_pair_cost = candidate.cost;
+    auto& trajectory_pair = candidate.trajectory_pair;
+    auto& combined_trajectory = candidate.combined_trajectory;
 
-    // check longitudinal and lateral acceleration
-    // considering trajectory curvatures
-    auto result = ConstraintChecker::ValidTrajectory(combined_trajectory);
+    auto result = candidate.result;
     if (result != ConstraintChecker::Result::VALID) {
       ++combined_constraint_failure_count;
 
@@ -275,7 +331,7 @@ Status LatticePlanner::PlanOnReferenceLine(
     }
 
     // check collision with other obstacles
-    if (collision_checker.InCollision(combined_trajectory)) {
+    if (candidate.in_collision) {
       ++collision_failure_count;
       continue;
     }
@@ -45,6 +45,11 @@ Status OpenSpacePlanner::Init(const PlanningConfig& planning_confgs) {
 
   open_space_trajectory_generator_->Init(planner_open_space_config_);
 
+  // the ROI generator is kept across cycles to reuse the ROI of the target
+  // parking spot
+  open_space_roi_generator_.reset(
+      new OpenSpaceROI(planner_open_space_config_));
+
   if (FLAGS_enable_open_space_planner_thread) {
     task_future_ =
         cyber::Async(&OpenSpacePlanner::GenerateTrajectoryThread, this);
@@ -59,8 +64,6 @@ apollo::common::Status OpenSpacePlanner::Plan(
     ADEBUG << "Open space plan in multi-threads mode";
 
     // Update Vehicle information and obstacles information from frame.
-    open_space_roi_generator_.reset(
-        new OpenSpaceROI(planner_open_space_config_));
     if (!open_space_roi_generator_->GenerateRegionOfInterest(frame)) {
       return Status(ErrorCode::PLANNING_ERROR,
                     "Generate Open Space ROI failed");
@@ -108,8 +111,6 @@ apollo::common::Status OpenSpacePlanner::Plan(
 
   } else {
     // Single thread logic
-    open_space_roi_generator_.reset(
-        new OpenSpaceROI(planner_open_space_config_));
     if (!open_space_roi_generator_->GenerateRegionOfInterest(frame)) {
       return Status(ErrorCode::PLANNING_ERROR,
                     "Generate Open Space ROI failed");
@@ -154,6 +155,11 @@ apollo::common::Status OpenSpacePlanner::Plan(
 }
 
 void OpenSpacePlanner::GenerateTrajectoryThread() {
+  // publishes the warm start trajectory while it is smoothed
+  std::function<void()> on_trajectory_updated = nullptr;
+  if (planner_open_space_config_.enable_anytime_trajectory()) {
+    on_trajectory_updated = [this]() { trajectory_updated_.store(true); };
+  }
   while (!is_stop_) {
     OpenSpaceThreadData thread_data;
     {
@@ -166,7 +172,8 @@ void OpenSpacePlanner::GenerateTrajectoryThread() {
           thread_data.XYbounds, thread_data.rotate_angle,
           thread_data.translate_origin, thread_data.end_pose,
           thread_data.obstacles_edges_num, thread_data.obstacles_A,
-          thread_data.obstacles_b, thread_data_.obstacles_vertices_vec);
+          thread_data.obstacles_b, thread_data_.obstacles_vertices_vec,
+          on_trajectory_updated);
       if (status == Status::OK()) {
         trajectory_updated_.store(true);
       } else {
@@ -38,6 +38,7 @@
 #include "modules/planning/common/trajectory/publishable_trajectory.h"
 #include "modules/planning/planner/planner.h"
 #include "modules/planning/planner/planner_dispatcher.h"
+#include "modules/planning/traffic_rules/traffic_decider.h"
 
 /**
  * @namespace apollo::planning
@@ -86,6 +87,7 @@ class PlanningBase {
 
   PlanningConfig config_;
   TrafficRuleConfigs traffic_rule_configs_;
+  TrafficDecider traffic_decider_;
   std::unique_ptr<Planner> planner_;
   std::unique_ptr<PublishableTrajectory> last_publishable_trajectory_;
   std::unique_ptr<PlannerDispatcher> planner_dispatcher_;
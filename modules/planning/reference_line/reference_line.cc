@@ -119,11 +119,16 @@ bool ReferenceLine::Stitch(const ReferenceLine& other) {
   }
   map_path_ = MapPath(std::move(std::vector<hdmap::MapPathPoint>(
       reference_points_.begin(), reference_points_.end())));
+  projection_index_.reset();
   return true;
 }
 
 ReferencePoint ReferenceLine::GetNearestReferencePoint(
     const common::math::Vec2d& xy) const {
+  if (projection_index_ != nullptr) {
+    const int index = projection_index_->GetNearestPointIndex(map_path_, xy);
+    return reference_points_[index];
+  }
   double min_dist = std::numeric_limits<double>::max();
   size_t min_index = 0;
   for (size_t i = 0; i < reference_points_.size(); ++i) {
@@ -173,6 +178,7 @@ bool ReferenceLine::Shrink(const double s, double look_backward,
   }
   map_path_ = MapPath(std::move(std::vector<hdmap::MapPathPoint>(
       reference_points_.begin(), reference_points_.end())));
+  projection_index_.reset();
   return true;
 }
 
@@ -219,12 +225,10 @@ ReferencePoint ReferenceLine::GetNearestReferencePoint(const double s) const {
           << accumulated_s.back();
     return reference_points_.back();
   }
-  auto it_lower =
-      std::lower_bound(accumulated_s.begin(), accumulated_s.end(), s);
-  if (it_lower == accumulated_s.begin()) {
+  const size_t index = LowerBoundIndexFromS(s);
+  if (index == 0) {
     return reference_points_.front();
   } else {
-    auto index = std::distance(accumulated_s.begin(), it_lower);
     if (std::fabs(accumulated_s[index - 1] - s) <
         std::fabs(accumulated_s[index] - s)) {
       return reference_points_[index - 1];
@@ -245,6 +249,14 @@ size_t ReferenceLine::GetNearestReferenceIndex(const double s) const {
           << accumulated_s.back();
     return reference_points_.size() - 1;
   }
+  return LowerBoundIndexFromS(s);
+}
+
+size_t ReferenceLine::LowerBoundIndexFromS(const double s) const {
+  if (projection_index_ != nullptr) {
+    return projection_index_->LowerBoundIndexFromS(map_path_, s);
+  }
+  const auto& accumulated_s = map_path_.accumulated_s();
   auto it_lower =
       std::lower_bound(accumulated_s.begin(), accumulated_s.end(), s);
   return std::distance(accumulated_s.begin(), it_lower);
@@ -323,14 +335,18 @@ ReferencePoint ReferenceLine::GetReferencePoint(const double x,
     return dx * dx + dy * dy;
   };
 
-  double d_min = func_distance_square(reference_points_.front(), x, y);
   size_t index_min = 0;
-
-  for (size_t i = 1; i < reference_points_.size(); ++i) {
-    double d_temp = func_distance_square(reference_points_[i], x, y);
-    if (d_temp < d_min) {
-      d_min = d_temp;
-      index_min = i;
+  if (projection_index_ != nullptr) {
+    index_min = projection_index_->GetNearestPointIndex(
+        map_path_, common::math::Vec2d(x, y));
+  } else {
+    double d_min = func_distance_square(reference_points_.front(), x, y);
+    for (size_t i = 1; i < reference_points_.size(); ++i) {
+      double d_temp = func_distance_square(reference_points_[i], x, y);
+      if (d_temp < d_min) {
+        d_min = d_temp;
+        index_min = i;
+      }
     }
   }
 
@@ -373,7 +389,16 @@ bool ReferenceLine::XYToSL(const common::math::Vec2d& xy_point,
   DCHECK_NOTNULL(sl_point);
   double s = 0.0;
   double l = 0.0;
-  if (!map_path_.GetProjection(xy_point, &s, &l)) {
+  if (projection_index_ != nullptr) {
+    double distance = 0.0;
+    const int segment_index =
+        projection_index_->GetNearestSegmentIndex(map_path_, xy_point);
+    if (!map_path_.GetProjectionFromSegment(xy_point, segment_index, &s, &l,
+                                            &distance)) {
+      AERROR << "Can't get nearest point from path.";
+      return false;
+    }
+  } else if (!map_path_.GetProjection(xy_point, &s, &l)) {
     AERROR << "Can't get nearest point from path.";
     return false;
   }
@@ -382,6 +407,42 @@ bool ReferenceLine::XYToSL(const common::math::Vec2d& xy_point,
   return true;
 }
 
+bool ReferenceLine::XYToSL(const std::vector<common::math::Vec2d>& xy_points,
+                           std::vector<SLPoint>* const sl_points) const {
+  CHECK_NOTNULL(sl_points);
+  sl_points->resize(xy_points.size());
+  if (projection_index_ == nullptr) {
+    std::vector<double> s;
+    std::vector<double> l;
+    if (!map_path_.GetProjections(xy_points, &s, &l)) {
+      AERROR << "Can't get nearest point from path.";
+      return false;
+    }
+    for (size_t i = 0; i < xy_points.size(); ++i) {
+      sl_points->at(i).set_s(s[i]);
+      sl_points->at(i).set_l(l[i]);
+    }
+    return true;
+  }
+  for (size_t i = 0; i < xy_points.size(); ++i) {
+    if (!XYToSL(xy_points[i], &sl_points->at(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ReferenceLine::BuildProjectionIndex() {
+  // the index reproduces the full scan of the segments, not the
+  // approximation of the path.
+  if (map_path_.num_points() < 2 || map_path_.use_path_approximation()) {
+    projection_index_.reset();
+    return;
+  }
+  projection_index_ =
+      std::make_shared<const ReferenceLineProjectionIndex>(map_path_);
+}
+
 ReferencePoint ReferenceLine::InterpolateWithMatchedIndex(
     const ReferencePoint& p0, const double s0, const ReferencePoint& p1,
     const double s1, const InterpolatedIndex& index) const {
@@ -423,7 +484,7 @@ ReferencePoint ReferenceLine::Interpolate(const ReferencePoint& p0,
       waypoints.emplace_back(p0_waypoint.lane, lane_s);
     }
     const auto& p1_waypoint = p1.lane_waypoints()[0];
-    if (p1_waypoint.lane->id().id() != p0_waypoint.lane->id().id() &&
+    if (!hdmap::IsSameLane(*p1_waypoint.lane, *p0_waypoint.lane) &&
         p1_waypoint.s - (s1 - s) >= 0) {
       const double lane_s = p1_waypoint.s - (s1 - s);
       waypoints.emplace_back(p1_waypoint.lane, lane_s);
@@ -606,13 +667,13 @@ bool ReferenceLine::GetSLBoundary(const common::math::Box2d& box,
   double end_l(std::numeric_limits<double>::lowest());
   std::vector<common::math::Vec2d> corners;
   box.GetAllCorners(&corners);
-  for (const auto& point : corners) {
-    SLPoint sl_point;
-    if (!XYToSL(point, &sl_point)) {
-      AERROR << "failed to get projection for point: " << point.DebugString()
-             << " on reference line.";
-      return false;
-    }
+  std::vector<SLPoint> sl_points;
+  if (!XYToSL(corners, &sl_points)) {
+    AERROR << "failed to get projection for box: " << box.DebugString()
+           << " on reference line.";
+    return false;
+  }
+  for (const auto& sl_point : sl_points) {
     start_s = std::fmin(start_s, sl_point.s());
     end_s = std::fmax(end_s, sl_point.s());
     start_l = std::fmin(start_l, sl_point.l());
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -31,6 +32,7 @@
 
 #include "modules/common/math/vec2d.h"
 #include "modules/map/pnc_map/path.h"
+#include "modules/planning/reference_line/reference_line_projection_index.h"
 #include "modules/planning/reference_line/reference_point.h"
 
 namespace apollo {
@@ -113,6 +115,15 @@ class ReferenceLine {
   bool XYToSL(const XYPoint& xy, common::SLPoint* const sl_point) const {
     return XYToSL(common::math::Vec2d(xy.x(), xy.y()), sl_point);
   }
+  bool XYToSL(const std::vector<common::math::Vec2d>& xy_points,
+              std::vector<common::SLPoint>* const sl_points) const;
+
+  /**
+   * @brief Builds a spatial index on this reference line, which is used by
+   * the projections of points onto it until the line is changed again.
+   */
+  void BuildProjectionIndex();
+  bool HasProjectionIndex() const { return projection_index_ != nullptr; }
 
   bool GetLaneWidth(const double s, double* const lane_left_width,
                     double* const lane_right_width) const;
@@ -199,6 +210,9 @@ class ReferenceLine {
       const ReferencePoint& p0, const double s0, const ReferencePoint& p1,
       const double s1, const hdmap::InterpolatedIndex& index) const;
 
+  // Gets the index of the first reference point whose s is not less than s.
+  size_t LowerBoundIndexFromS(const double s) const;
+
   static double FindMinDistancePoint(const ReferencePoint& p0, const double s0,
                                      const ReferencePoint& p1, const double s1,
                                      const double x, const double y);
@@ -218,6 +232,8 @@ class ReferenceLine {
   std::vector<SpeedLimit> speed_limit_;
   std::vector<ReferencePoint> reference_points_;
   hdmap::Path map_path_;
+  // shared by the copies of this line, as it only depends on map_path_
+  std::shared_ptr<const ReferenceLineProjectionIndex> projection_index_;
   uint32_t priority_ = 0;
 };
 
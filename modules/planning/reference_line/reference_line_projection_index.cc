@@ -0,0 +1,269 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/reference_line/reference_line_projection_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "cyber/common/log.h"
+#include "modules/common/math/math_utils.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::math::Vec2d;
+
+namespace {
+
+constexpr double kMinCellSize = 2.0;
+// the number of cells is kept around the number of points, so that even a
+// query far away from the path costs no more than a full scan.
+constexpr double kMaxCellsPerPoint = 2.0;
+constexpr double kSGridResolution = 0.5;
+// keeps the search going a little longer than needed, for the rounding of
+// the cell bounds.
+constexpr double kDistanceBuffer = 1e-6;
+
+}  // namespace
+
+ReferenceLineProjectionIndex::ReferenceLineProjectionIndex(
+    const hdmap::Path& path) {
+  CHECK_GE(path.num_points(), 2);
+  InitGrid(path);
+  InitSGrid(path);
+}
+
+void ReferenceLineProjectionIndex::InitGrid(const hdmap::Path& path) {
+  const auto& points = path.path_points();
+  min_x_ = std::numeric_limits<double>::infinity();
+  min_y_ = std::numeric_limits<double>::infinity();
+  double max_x = -std::numeric_limits<double>::infinity();
+  double max_y = -std::numeric_limits<double>::infinity();
+  for (const auto& point : points) {
+    min_x_ = std::min(min_x_, point.x());
+    min_y_ = std::min(min_y_, point.y());
+    max_x = std::max(max_x, point.x());
+    max_y = std::max(max_y, point.y());
+  }
+  const double area = (max_x - min_x_ + kMinCellSize) *
+                      (max_y - min_y_ + kMinCellSize);
+  const double num_points = static_cast<double>(points.size());
+  cell_size_ = std::max(kMinCellSize,
+                        std::sqrt(area / (kMaxCellsPerPoint * num_points)));
+  num_cells_x_ = static_cast<int>((max_x - min_x_) / cell_size_) + 1;
+  num_cells_y_ = static_cast<int>((max_y - min_y_) / cell_size_) + 1;
+  const int num_cells = num_cells_x_ * num_cells_y_;
+
+  // The cells are kept in compressed rows: objects are counted per cell
+  // first, and then written at their offsets.
+  const auto& segments = path.segments();
+  std::vector<Cell> segment_min_cells(segments.size());
+  std::vector<Cell> segment_max_cells(segments.size());
+  cell_segment_start_.assign(num_cells + 1, 0);
+  for (size_t i = 0; i < segments.size(); ++i) {
+    const auto& start = segments[i].start();
+    const auto& end = segments[i].end();
+    segment_min_cells[i] = GetCell(
+        Vec2d(std::min(start.x(), end.x()), std::min(start.y(), end.y())));
+    segment_max_cells[i] = GetCell(
+        Vec2d(std::max(start.x(), end.x()), std::max(start.y(), end.y())));
+    for (int y = segment_min_cells[i].y; y <= segment_max_cells[i].y; ++y) {
+      for (int x = segment_min_cells[i].x; x <= segment_max_cells[i].x; ++x) {
+        ++cell_segment_start_[y * num_cells_x_ + x + 1];
+      }
+    }
+  }
+  for (int i = 0; i < num_cells; ++i) {
+    cell_segment_start_[i + 1] += cell_segment_start_[i];
+  }
+  cell_segments_.resize(cell_segment_start_.back());
+  std::vector<int> offsets(cell_segment_start_.begin(),
+                           cell_segment_start_.end() - 1);
+  for (size_t i = 0; i < segments.size(); ++i) {
+    for (int y = segment_min_cells[i].y; y <= segment_max_cells[i].y; ++y) {
+      for (int x = segment_min_cells[i].x; x <= segment_max_cells[i].x; ++x) {
+        cell_segments_[offsets[y * num_cells_x_ + x]++] = static_cast<int>(i);
+      }
+    }
+  }
+
+  std::vector<int> point_cells(points.size());
+  cell_point_start_.assign(num_cells + 1, 0);
+  for (size_t i = 0; i < points.size(); ++i) {
+    const Cell cell = GetCell(points[i]);
+    point_cells[i] = cell.y * num_cells_x_ + cell.x;
+    ++cell_point_start_[point_cells[i] + 1];
+  }
+  for (int i = 0; i < num_cells; ++i) {
+    cell_point_start_[i + 1] += cell_point_start_[i];
+  }
+  cell_points_.resize(points.size());
+  offsets.assign(cell_point_start_.begin(), cell_point_start_.end() - 1);
+  for (size_t i = 0; i < points.size(); ++i) {
+    cell_points_[offsets[point_cells[i]]++] = static_cast<int>(i);
+  }
+}
+
+void ReferenceLineProjectionIndex::InitSGrid(const hdmap::Path& path) {
+  const auto& accumulated_s = path.accumulated_s();
+  s_grid_resolution_ = kSGridResolution;
+  const int num_samples =
+      static_cast<int>(accumulated_s.back() / s_grid_resolution_) + 1;
+  s_grid_index_.resize(num_samples);
+  size_t index = 0;
+  for (int i = 0; i < num_samples; ++i) {
+    const double s = i * s_grid_resolution_;
+    while (index < accumulated_s.size() && accumulated_s[index] < s) {
+      ++index;
+    }
+    s_grid_index_[i] = index;
+  }
+}
+
+ReferenceLineProjectionIndex::Cell ReferenceLineProjectionIndex::GetCell(
+    const Vec2d& point) const {
+  double x = std::floor((point.x() - min_x_) / cell_size_);
+  double y = std::floor((point.y() - min_y_) / cell_size_);
+  // also clamps nan to the first cell
+  x = std::min(x > 0.0 ? x : 0.0, num_cells_x_ - 1.0);
+  y = std::min(y > 0.0 ? y : 0.0, num_cells_y_ - 1.0);
+  Cell cell;
+  cell.x = static_cast<int>(x);
+  cell.y = static_cast<int>(y);
+  return cell;
+}
+
+template <typename DistanceSquare>
+int ReferenceLineProjectionIndex::GetNearestIndex(
+    const Vec2d& point, const std::vector<int>& cell_start,
+    const std::vector<int>& cell_objects,
+    const DistanceSquare& distance_square) const {
+  int nearest_index = -1;
+  double min_distance_square = std::numeric_limits<double>::infinity();
+  auto search_cell = [&](const int x, const int y) {
+    const int cell = y * num_cells_x_ + x;
+    for (int k = cell_start[cell]; k < cell_start[cell + 1]; ++k) {
+      const int index = cell_objects[k];
+      const double distance = distance_square(index);
+      if (distance < min_distance_square ||
+          (distance == min_distance_square && index < nearest_index)) {
+        nearest_index = index;
+        min_distance_square = distance;
+      }
+    }
+  };
+
+  const Cell center = GetCell(point);
+  const int max_radius = std::max(num_cells_x_, num_cells_y_);
+  for (int r = 0; r <= max_radius; ++r) {
+    const int x_begin = center.x - r;
+    const int x_end = center.x + r;
+    const int y_begin = center.y - r;
+    const int y_end = center.y + r;
+    for (int y = std::max(y_begin, 0); y <= std::min(y_end, num_cells_y_ - 1);
+         ++y) {
+      if (y == y_begin || y == y_end) {
+        for (int x = std::max(x_begin, 0);
+             x <= std::min(x_end, num_cells_x_ - 1); ++x) {
+          search_cell(x, y);
+        }
+      } else {
+        if (x_begin >= 0) {
+          search_cell(x_begin, y);
+        }
+        if (x_end < num_cells_x_) {
+          search_cell(x_end, y);
+        }
+      }
+    }
+
+    // the distance from the point to the cells out of the searched square
+    double bound = std::numeric_limits<double>::infinity();
+    if (x_begin > 0) {
+      bound = std::min(bound, point.x() - (min_x_ + x_begin * cell_size_));
+    }
+    if (x_end < num_cells_x_ - 1) {
+      bound = std::min(bound, min_x_ + (x_end + 1) * cell_size_ - point.x());
+    }
+    if (y_begin > 0) {
+      bound = std::min(bound, point.y() - (min_y_ + y_begin * cell_size_));
+    }
+    if (y_end < num_cells_y_ - 1) {
+      bound = std::min(bound, min_y_ + (y_end + 1) * cell_size_ - point.y());
+    }
+    if (std::isinf(bound)) {
+      break;
+    }
+    if (nearest_index >= 0 && bound > kDistanceBuffer &&
+        common::math::Square(bound - kDistanceBuffer) > min_distance_square) {
+      break;
+    }
+  }
+  return nearest_index;
+}
+
+int ReferenceLineProjectionIndex::GetNearestSegmentIndex(
+    const hdmap::Path& path, const Vec2d& point) const {
+  const auto& segments = path.segments();
+  const int index = GetNearestIndex(
+      point, cell_segment_start_, cell_segments_,
+      [&](const int i) { return segments[i].DistanceSquareTo(point); });
+  return std::max(index, 0);
+}
+
+int ReferenceLineProjectionIndex::GetNearestPointIndex(
+    const hdmap::Path& path, const Vec2d& point) const {
+  const auto& points = path.path_points();
+  DCHECK_EQ(cell_points_.size(), points.size());
+  const int index = GetNearestIndex(
+      point, cell_point_start_, cell_points_, [&](const int i) {
+        const double dx = points[i].x() - point.x();
+        const double dy = points[i].y() - point.y();
+        return dx * dx + dy * dy;
+      });
+  return std::max(index, 0);
+}
+
+size_t ReferenceLineProjectionIndex::LowerBoundIndexFromS(
+    const hdmap::Path& path, const double s) const {
+  const auto& accumulated_s = path.accumulated_s();
+  // "!(s > ...)" also takes nan to the front, as std::lower_bound does.
+  if (accumulated_s.empty() || !(s > accumulated_s.front())) {
+    return 0;
+  }
+  if (s > accumulated_s.back()) {
+    return accumulated_s.size();
+  }
+  int i = std::min(static_cast<int>(s / s_grid_resolution_),
+                   static_cast<int>(s_grid_index_.size()) - 1);
+  while (i > 0 && s < i * s_grid_resolution_) {
+    --i;
+  }
+  size_t index = s_grid_index_[i];
+  while (accumulated_s[index] < s) {
+    ++index;
+  }
+  return index;
+}
+
+}  // namespace planning
+}  // namespace apollo
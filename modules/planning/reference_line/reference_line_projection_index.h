@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#pragma once
+
+#include <vector>
+
+#include "modules/common/math/vec2d.h"
+#include "modules/map/pnc_map/path.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class ReferenceLineProjectionIndex
+ * @brief A spatial index on the points and segments of a path, which answers
+ *        the nearest point, nearest segment and s lookups of a reference line
+ *        without scanning the whole path.
+ *
+ * The plane is split into a uniform grid of cells, each of which keeps the
+ * segments whose bounding box touches it and the points inside it. A query
+ * searches rings of cells around the point until no unsearched cell can be
+ * closer than the best match. Ties are broken by the smallest index, so the
+ * results are the same as the ones of a full scan. The index only keeps
+ * indices, and every query takes the path it was built on.
+ */
+class ReferenceLineProjectionIndex {
+ public:
+  explicit ReferenceLineProjectionIndex(const hdmap::Path& path);
+
+  /**
+   * @brief Gets the index of the segment nearest to the point, the first one
+   *        if several are as near.
+   */
+  int GetNearestSegmentIndex(const hdmap::Path& path,
+                             const common::math::Vec2d& point) const;
+
+  /**
+   * @brief Gets the index of the path point nearest to the point, the first
+   *        one if several are as near.
+   */
+  int GetNearestPointIndex(const hdmap::Path& path,
+                           const common::math::Vec2d& point) const;
+
+  /**
+   * @brief Gets the index of the first path point whose accumulated s is not
+   *        less than s, i.e. std::lower_bound on the accumulated s.
+   */
+  size_t LowerBoundIndexFromS(const hdmap::Path& path, const double s) const;
+
+ private:
+  struct Cell {
+    int x = 0;
+    int y = 0;
+  };
+
+  Cell GetCell(const common::math::Vec2d& point) const;
+
+  // Searches the rings of cells around the point. "distance_square" gives
+  // the square distance to the object of an index, and "cell_start" and
+  // "cell_objects" are the objects of each cell.
+  template <typename DistanceSquare>
+  int GetNearestIndex(const common::math::Vec2d& point,
+                      const std::vector<int>& cell_start,
+                      const std::vector<int>& cell_objects,
+                      const DistanceSquare& distance_square) const;
+
+  void InitGrid(const hdmap::Path& path);
+  void InitSGrid(const hdmap::Path& path);
+
+ private:
+  double min_x_ = 0.0;
+  double min_y_ = 0.0;
+  double cell_size_ = 1.0;
+  int num_cells_x_ = 1;
+  int num_cells_y_ = 1;
+
+  // the objects of cell i are cell_xxx_[cell_xxx_start_[i], ...[i + 1])
+  std::vector<int> cell_segment_start_;
+  std::vector<int> cell_segments_;
+  std::vector<int> cell_point_start_;
+  std::vector<int> cell_points_;
+
+  // s_grid_index_[i] is the lower bound index of s = i * s_grid_resolution_
+  double s_grid_resolution_ = 1.0;
+  std::vector<size_t> s_grid_index_;
+};
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,117 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/planning/reference_line/reference_line_projection_index.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "modules/planning/reference_line/reference_line.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::SLPoint;
+using apollo::common::math::Vec2d;
+using apollo::hdmap::MapPathPoint;
+
+namespace {
+
+// an s-shaped line with a u-turn, so that far apart parts of the line are
+// close on the plane.
+std::vector<ReferencePoint> MakeReferencePoints() {
+  std::vector<ReferencePoint> ref_points;
+  for (int i = 0; i < 100; ++i) {
+    ref_points.emplace_back(MapPathPoint(Vec2d(i * 0.5, 0.0), 0.0), 0.0, 0.0);
+  }
+  // a repeated point
+  ref_points.push_back(ref_points.back());
+  for (int i = 0; i <= 60; ++i) {
+    const double theta = M_PI * i / 60.0 - M_PI_2;
+    ref_points.emplace_back(
+        MapPathPoint(Vec2d(50.0 + 5.0 * std::cos(theta),
+                           5.0 + 5.0 * std::sin(theta)),
+                     theta + M_PI_2),
+        0.0, 0.0);
+  }
+  for (int i = 1; i < 100; ++i) {
+    ref_points.emplace_back(MapPathPoint(Vec2d(50.0 - i * 0.5, 10.0), M_PI),
+                            0.0, 0.0);
+  }
+  return ref_points;
+}
+
+}  // namespace
+
+TEST(ReferenceLineProjectionIndexTest, SameAsFullScan) {
+  const ReferenceLine reference_line(MakeReferencePoints());
+  ReferenceLine indexed_reference_line(reference_line);
+  indexed_reference_line.BuildProjectionIndex();
+  ASSERT_FALSE(reference_line.HasProjectionIndex());
+  ASSERT_TRUE(indexed_reference_line.HasProjectionIndex());
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> x_distribution(-30.0, 80.0);
+  std::uniform_real_distribution<double> y_distribution(-30.0, 40.0);
+  std::vector<Vec2d> points;
+  for (int i = 0; i < 2000; ++i) {
+    points.emplace_back(x_distribution(generator), y_distribution(generator));
+  }
+  // on the points and in the middle of the segments
+  for (const auto& point : reference_line.reference_points()) {
+    points.emplace_back(point.x(), point.y());
+    points.emplace_back(point.x() + 0.25, point.y());
+  }
+
+  std::vector<SLPoint> sl_points;
+  ASSERT_TRUE(indexed_reference_line.XYToSL(points, &sl_points));
+  ASSERT_EQ(points.size(), sl_points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    SLPoint expected;
+    ASSERT_TRUE(reference_line.XYToSL(points[i], &expected));
+    EXPECT_EQ(expected.s(), sl_points[i].s());
+    EXPECT_EQ(expected.l(), sl_points[i].l());
+
+    const auto expected_point =
+        reference_line.GetReferencePoint(points[i].x(), points[i].y());
+    const auto point =
+        indexed_reference_line.GetReferencePoint(points[i].x(), points[i].y());
+    EXPECT_EQ(expected_point.x(), point.x());
+    EXPECT_EQ(expected_point.y(), point.y());
+  }
+
+  for (double s = -1.0; s < reference_line.Length() + 1.0; s += 0.13) {
+    EXPECT_EQ(reference_line.GetNearestReferenceIndex(s),
+              indexed_reference_line.GetNearestReferenceIndex(s));
+  }
+  for (const double s : reference_line.map_path().accumulated_s()) {
+    EXPECT_EQ(reference_line.GetNearestReferenceIndex(s),
+              indexed_reference_line.GetNearestReferenceIndex(s));
+  }
+}
+
+TEST(ReferenceLineProjectionIndexTest, DroppedOnShrink) {
+  ReferenceLine reference_line(MakeReferencePoints());
+  reference_line.BuildProjectionIndex();
+  ASSERT_TRUE(reference_line.Shrink(30.0, 10.0, 10.0));
+  EXPECT_FALSE(reference_line.HasProjectionIndex());
+}
+
+}  // namespace planning
+}  // namespace apollo
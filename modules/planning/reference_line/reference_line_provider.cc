@@ -141,20 +141,31 @@ void ReferenceLineProvider::UpdateReferenceLine(
            << ") are different";
     return;
   }
-  std::lock_guard<std::mutex> lock(reference_lines_mutex_);
+  // Only this function changes the reference lines, so the new ones are
+  // merged into a back buffer without the lock, and swapped in under it.
+  std::list<ReferenceLine> back_reference_lines;
+  std::list<hdmap::RouteSegments> back_route_segments;
   if (reference_lines_.size() != reference_lines.size()) {
-    reference_lines_ = reference_lines;
-    route_segments_ = route_segments;
-
+    back_reference_lines = reference_lines;
+    back_route_segments = route_segments;
+    if (FLAGS_enable_reference_line_smoothing_cache) {
+      auto segment_iter = route_segments.begin();
+      for (const auto &reference_line : reference_lines) {
+        smoothing_cache_.Insert(*segment_iter, reference_line);
+        ++segment_iter;
+      }
+    }
   } else {
+    back_reference_lines = reference_lines_;
+    back_route_segments = route_segments_;
     auto segment_iter = route_segments.begin();
-    auto internal_iter = reference_lines_.begin();
-    auto internal_segment_iter = route_segments_.begin();
+    auto internal_iter = back_reference_lines.begin();
+    auto internal_segment_iter = back_route_segments.begin();
     for (auto iter = reference_lines.begin();
          iter != reference_lines.end() &&
          segment_iter != route_segments.end() &&
-         internal_iter != reference_lines_.end() &&
-         internal_segment_iter != route_segments_.end();
+         internal_iter != back_reference_lines.end() &&
+         internal_segment_iter != back_route_segments.end();
          ++iter, ++segment_iter, ++internal_iter, ++internal_segment_iter) {
       if (iter->reference_points().empty()) {
         *internal_iter = *iter;
@@ -172,11 +183,20 @@ void ReferenceLineProvider::UpdateReferenceLine(
       }
       *internal_iter = *iter;
       *internal_segment_iter = *segment_iter;
+      if (FLAGS_enable_reference_line_smoothing_cache) {
+        smoothing_cache_.Insert(*segment_iter, *iter);
+      }
     }
   }
+  std::list<ReferenceLine> history_reference_lines(back_reference_lines);
+  std::list<hdmap::RouteSegments> history_route_segments(back_route_segments);
+
+  std::lock_guard<std::mutex> lock(reference_lines_mutex_);
+  reference_lines_.swap(back_reference_lines);
+  route_segments_.swap(back_route_segments);
   // update history
-  reference_line_history_.push(reference_lines_);
-  route_segments_history_.push(route_segments_);
+  reference_line_history_.push(std::move(history_reference_lines));
+  route_segments_history_.push(std::move(history_route_segments));
   constexpr int kMaxHistoryNum = 3;
   if (reference_line_history_.size() > kMaxHistoryNum) {
     reference_line_history_.pop();
@@ -605,16 +625,30 @@ bool ReferenceLineProvider::ExtendReferenceLine(const VehicleState &state,
                                                 ReferenceLine *reference_line) {
   RouteSegments segment_properties;
   segment_properties.SetProperties(*segments);
-  auto prev_segment = route_segments_.begin();
-  auto prev_ref = reference_lines_.begin();
-  while (prev_segment != route_segments_.end()) {
-    if (prev_segment->IsConnectedSegment(*segments)) {
+  const RouteSegments *prev_segment = nullptr;
+  const ReferenceLine *prev_ref = nullptr;
+  auto prev_segment_iter = route_segments_.begin();
+  auto prev_ref_iter = reference_lines_.begin();
+  while (prev_segment_iter != route_segments_.end()) {
+    if (prev_segment_iter->IsConnectedSegment(*segments)) {
+      prev_segment = &(*prev_segment_iter);
+      prev_ref = &(*prev_ref_iter);
       break;
     }
-    ++prev_segment;
-    ++prev_ref;
-  }
-  if (prev_segment == route_segments_.end()) {
+    ++prev_segment_iter;
+    ++prev_ref_iter;
+  }
+  // a route segment which was dropped for a while can still be stitched to
+  RouteSegments cached_segment;
+  ReferenceLine cached_ref;
+  if (prev_segment == nullptr && FLAGS_enable_reference_line_smoothing_cache &&
+      smoothing_cache_.FindConnected(*segments, &cached_segment,
+                                     &cached_ref)) {
+    ADEBUG << "Stitch to the cached reference line of " << cached_segment.Id();
+    prev_segment = &cached_segment;
+    prev_ref = &cached_ref;
+  }
+  if (prev_segment == nullptr) {
     if (!route_segments_.empty() && segments->IsOnSegment()) {
       AWARN << "Current route segment is not connected with previous route "
                "segment";
@@ -843,8 +877,19 @@ void ReferenceLineProvider::GetAnchorPoints(
 
 bool ReferenceLineProvider::SmoothRouteSegment(const RouteSegments &segments,
                                                ReferenceLine *reference_line) {
+  if (FLAGS_enable_reference_line_smoothing_cache &&
+      smoothing_cache_.Lookup(segments, reference_line)) {
+    ADEBUG << "Reuse the smoothed reference line of " << segments.Id();
+    return true;
+  }
   hdmap::Path path(segments);
-  return SmoothReferenceLine(ReferenceLine(path), reference_line);
+  if (!SmoothReferenceLine(ReferenceLine(path), reference_line)) {
+    return false;
+  }
+  if (FLAGS_enable_reference_line_smoothing_cache) {
+    smoothing_cache_.Insert(segments, *reference_line);
+  }
+  return true;
 }
 
 bool ReferenceLineProvider::SmoothPrefixedReferenceLine(
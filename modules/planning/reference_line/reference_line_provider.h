@@ -43,6 +43,7 @@
 #include "modules/planning/reference_line/cos_theta_reference_line_smoother.h"
 #include "modules/planning/reference_line/qp_spline_reference_line_smoother.h"
 #include "modules/planning/reference_line/reference_line.h"
+#include "modules/planning/reference_line/reference_line_smoothing_cache.h"
 #include "modules/planning/reference_line/spiral_reference_line_smoother.h"
 
 /**
@@ -180,6 +181,9 @@ class ReferenceLineProvider {
   std::queue<std::list<ReferenceLine>> reference_line_history_;
   std::queue<std::list<hdmap::RouteSegments>> route_segments_history_;
 
+  // only used by the thread creating the reference lines
+  ReferenceLineSmoothingCache smoothing_cache_;
+
   std::future<void> task_future_;
 };
 
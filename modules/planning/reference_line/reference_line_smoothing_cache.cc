@@ -0,0 +1,113 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/reference_line/reference_line_smoothing_cache.h"
+
+#include <cmath>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::hdmap::RouteSegments;
+
+namespace {
+
+// route segments are taken as the same when their s ranges are this close
+constexpr double kSEpsilon = 1e-3;
+
+bool IsSameRouteSegments(const RouteSegments& a, const RouteSegments& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].lane == nullptr || b[i].lane == nullptr ||
+        a[i].lane->id().id() != b[i].lane->id().id() ||
+        std::fabs(a[i].start_s - b[i].start_s) > kSEpsilon ||
+        std::fabs(a[i].end_s - b[i].end_s) > kSEpsilon) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+ReferenceLineSmoothingCache::ReferenceLineSmoothingCache(const size_t capacity)
+    : capacity_(capacity) {
+  CHECK_GT(capacity_, 0);
+}
+
+std::list<ReferenceLineSmoothingCache::Entry>::iterator
+ReferenceLineSmoothingCache::Find(const RouteSegments& segments) {
+  for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+    if (IsSameRouteSegments(iter->segments, segments)) {
+      return iter;
+    }
+  }
+  return entries_.end();
+}
+
+bool ReferenceLineSmoothingCache::Lookup(const RouteSegments& segments,
+                                         ReferenceLine* const reference_line) {
+  CHECK_NOTNULL(reference_line);
+  auto iter = Find(segments);
+  if (iter == entries_.end()) {
+    return false;
+  }
+  entries_.splice(entries_.begin(), entries_, iter);
+  *reference_line = entries_.front().reference_line;
+  return true;
+}
+
+bool ReferenceLineSmoothingCache::FindConnected(
+    const RouteSegments& segments, RouteSegments* const cached_segments,
+    ReferenceLine* const cached_reference_line) {
+  CHECK_NOTNULL(cached_segments);
+  CHECK_NOTNULL(cached_reference_line);
+  for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+    if (iter->segments.IsConnectedSegment(segments)) {
+      entries_.splice(entries_.begin(), entries_, iter);
+      *cached_segments = entries_.front().segments;
+      *cached_reference_line = entries_.front().reference_line;
+      return true;
+    }
+  }
+  return false;
+}
+
+void ReferenceLineSmoothingCache::Insert(const RouteSegments& segments,
+                                         const ReferenceLine& reference_line) {
+  auto iter = Find(segments);
+  if (iter != entries_.end()) {
+    entries_.splice(entries_.begin(), entries_, iter);
+  } else {
+    entries_.emplace_front();
+    if (entries_.size() > capacity_) {
+      entries_.pop_back();
+    }
+  }
+  entries_.front().segments = segments;
+  entries_.front().reference_line = reference_line;
+}
+
+}  // namespace planning
+}  // namespace apollo
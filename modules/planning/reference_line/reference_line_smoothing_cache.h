@@ -0,0 +1,86 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#pragma once
+
+#include <list>
+
+#include "modules/map/pnc_map/route_segments.h"
+#include "modules/planning/reference_line/reference_line.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class ReferenceLineSmoothingCache
+ * @brief Keeps the last smoothed reference lines with the route segments they
+ *        were built on, so that a route segment seen again is not smoothed
+ *        from scratch.
+ *
+ * An entry is used as it is when the lanes and s ranges of the route segments
+ * match, and as the prefix to stitch to when the route segments are only
+ * connected. The least recently used entry is dropped when the cache is full.
+ * The cache is not thread safe.
+ */
+class ReferenceLineSmoothingCache {
+ public:
+  explicit ReferenceLineSmoothingCache(const size_t capacity = 8);
+
+  /**
+   * @brief Gets the reference line smoothed on route segments with the same
+   *        lanes and s ranges as "segments".
+   */
+  bool Lookup(const hdmap::RouteSegments& segments,
+              ReferenceLine* const reference_line);
+
+  /**
+   * @brief Gets the most recently used entry whose route segments are
+   *        connected with "segments".
+   */
+  bool FindConnected(const hdmap::RouteSegments& segments,
+                     hdmap::RouteSegments* const cached_segments,
+                     ReferenceLine* const cached_reference_line);
+
+  /**
+   * @brief Adds a smoothed reference line, which replaces the entry of the
+   *        same route segments if there is one.
+   */
+  void Insert(const hdmap::RouteSegments& segments,
+              const ReferenceLine& reference_line);
+
+  void Clear() { entries_.clear(); }
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    hdmap::RouteSegments segments;
+    ReferenceLine reference_line;
+  };
+
+  std::list<Entry>::iterator Find(const hdmap::RouteSegments& segments);
+
+  size_t capacity_ = 0;
+  // the most recently used entry first
+  std::list<Entry> entries_;
+};
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/planning/reference_line/reference_line_smoothing_cache.h"
+
+#include "gtest/gtest.h"
+
+#include "modules/map/hdmap/hdmap.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::hdmap::RouteSegments;
+
+class ReferenceLineSmoothingCacheTest : public ::testing::Test {
+ public:
+  static void SetUpTestCase() {
+    CHECK_EQ(0, hdmap_.LoadMapFromFile(
+                    "modules/map/data/sunnyvale_loop/base_map_test.bin"));
+  }
+
+  static RouteSegments MakeRouteSegments(const double start_s,
+                                         const double end_s) {
+    RouteSegments segments;
+    segments.emplace_back(
+        hdmap_.GetLaneById(hdmap::MakeMapId("9_1_-1")), start_s, end_s);
+    return segments;
+  }
+
+ protected:
+  static hdmap::HDMap hdmap_;
+};
+
+hdmap::HDMap ReferenceLineSmoothingCacheTest::hdmap_;
+
+TEST_F(ReferenceLineSmoothingCacheTest, Lookup) {
+  ReferenceLineSmoothingCache cache;
+  const RouteSegments segments = MakeRouteSegments(2.0, 12.0);
+  ReferenceLine reference_line;
+  EXPECT_FALSE(cache.Lookup(segments, &reference_line));
+
+  cache.Insert(segments, ReferenceLine(hdmap::Path(segments)));
+  EXPECT_TRUE(cache.Lookup(segments, &reference_line));
+  EXPECT_NEAR(10.0, reference_line.Length(), 1e-3);
+  EXPECT_FALSE(cache.Lookup(MakeRouteSegments(2.5, 12.0), &reference_line));
+
+  // the same segments replace the entry
+  cache.Insert(segments, ReferenceLine(hdmap::Path(segments)));
+  EXPECT_EQ(1u, cache.size());
+}
+
+TEST_F(ReferenceLineSmoothingCacheTest, FindConnected) {
+  ReferenceLineSmoothingCache cache;
+  const RouteSegments segments = MakeRouteSegments(0.0, 8.0);
+  cache.Insert(segments, ReferenceLine(hdmap::Path(segments)));
+
+  RouteSegments cached_segments;
+  ReferenceLine cached_reference_line;
+  EXPECT_TRUE(cache.FindConnected(MakeRouteSegments(5.0, 14.0),
+                                  &cached_segments, &cached_reference_line));
+  EXPECT_NEAR(8.0, RouteSegments::Length(cached_segments), 1e-3);
+  EXPECT_FALSE(cache.FindConnected(MakeRouteSegments(10.0, 14.0),
+                                   &cached_segments, &cached_reference_line));
+}
+
+TEST_F(ReferenceLineSmoothingCacheTest, DropLeastRecentlyUsed) {
+  ReferenceLineSmoothingCache cache(2);
+  const RouteSegments first = MakeRouteSegments(0.0, 4.0);
+  const RouteSegments second = MakeRouteSegments(4.0, 8.0);
+  const RouteSegments third = MakeRouteSegments(8.0, 12.0);
+  cache.Insert(first, ReferenceLine(hdmap::Path(first)));
+  cache.Insert(second, ReferenceLine(hdmap::Path(second)));
+
+  ReferenceLine reference_line;
+  EXPECT_TRUE(cache.Lookup(first, &reference_line));
+  cache.Insert(third, ReferenceLine(hdmap::Path(third)));
+  EXPECT_EQ(2u, cache.size());
+  EXPECT_TRUE(cache.Lookup(first, &reference_line));
+  EXPECT_FALSE(cache.Lookup(second, &reference_line));
+  EXPECT_TRUE(cache.Lookup(third, &reference_line));
+}
+
+}  // namespace planning
+}  // namespace apollo
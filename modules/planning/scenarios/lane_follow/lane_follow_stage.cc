@@ -20,11 +20,12 @@
 
 #include "modules/planning/scenarios/lane_follow/lane_follow_stage.h"
 
+#include <future>
 #include <utility>
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/common/math/math_utils.h"
-#include "modules/common/time/time.h"
 #include "modules/common/util/string_tokenizer.h"
 #include "modules/common/util/string_util.h"
 #include "modules/common/vehicle_state/vehicle_state_provider.h"
@@ -51,7 +52,6 @@ using common::ErrorCode;
 using common::SLPoint;
 using common::Status;
 using common::TrajectoryPoint;
-using common::time::Clock;
 
 namespace {
 constexpr double kPathOptimizationFallbackCost = 2e4;
@@ -91,8 +91,7 @@ void LaneFollowStage::RecordObstacleDebugInfo(
 }
 
 void LaneFollowStage::RecordDebugInfo(ReferenceLineInfo* reference_line_info,
-                                      const std::string& name,
-                                      const double time_diff_ms) {
+                                      const TaskStats& task_stats) {
   if (!FLAGS_enable_record_debug) {
     ADEBUG << "Skip record debug info";
     return;
@@ -104,13 +103,15 @@ void LaneFollowStage::RecordDebugInfo(ReferenceLineInfo* reference_line_info,
 
   auto ptr_latency_stats = reference_line_info->mutable_latency_stats();
 
-  auto ptr_stats = ptr_latency_stats->add_task_stats();
-  ptr_stats->set_name(name);
-  ptr_stats->set_time_ms(time_diff_ms);
+  ptr_latency_stats->add_task_stats()->CopyFrom(task_stats);
 }
 
 Stage::StageStatus LaneFollowStage::Process(
     const TrajectoryPoint& planning_start_point, Frame* frame) {
+  if (FLAGS_enable_parallel_reference_line_planning &&
+      frame->mutable_reference_line_info()->size() > 1) {
+    return ProcessInParallel(planning_start_point, frame);
+  }
   bool has_drivable_reference_line = false;
   bool disable_low_priority_path = false;
   for (auto& reference_line_info : *frame->mutable_reference_line_info()) {
@@ -137,9 +138,72 @@ Stage::StageStatus LaneFollowStage::Process(
                                      : StageStatus::ERROR;
 }
 
+Stage::StageStatus LaneFollowStage::ProcessInParallel(
+    const TrajectoryPoint& planning_start_point, Frame* frame) {
+  std::vector<ReferenceLineInfo*> reference_line_infos;
+  std::vector<const std::vector<Task*>*> task_lists;
+  for (auto& reference_line_info : *frame->mutable_reference_line_info()) {
+    if (!reference_line_info.IsDrivable()) {
+      continue;
+    }
+    task_lists.push_back(&TaskListOfReferenceLine(reference_line_infos.size()));
+    reference_line_infos.push_back(&reference_line_info);
+  }
+
+  // The first reference line is planned on this thread, so that it never
+  // waits for a free thread of the pool.
+  std::vector<Status> statuses(reference_line_infos.size());
+  std::vector<std::future<void>> results;
+  for (size_t i = 1; i < reference_line_infos.size(); ++i) {
+    results.push_back(cyber::Async([&, i]() {
+      statuses[i] = PlanOnReferenceLine(planning_start_point, frame,
+                                        reference_line_infos[i],
+                                        *task_lists[i]);
+    }));
+  }
+  if (!reference_line_infos.empty()) {
+    statuses[0] = PlanOnReferenceLine(planning_start_point, frame,
+                                      reference_line_infos[0], *task_lists[0]);
+  }
+  for (auto& result : results) {
+    result.get();
+  }
+
+  // The lines after a cheap change lane path would not have been planned.
+  bool has_drivable_reference_line = false;
+  bool disable_low_priority_path = false;
+  for (size_t i = 0; i < reference_line_infos.size(); ++i) {
+    auto* reference_line_info = reference_line_infos[i];
+    if (disable_low_priority_path) {
+      reference_line_info->SetDrivable(false);
+      continue;
+    }
+    if (statuses[i].ok() && reference_line_info->IsDrivable()) {
+      has_drivable_reference_line = true;
+      if (FLAGS_prioritize_change_lane &&
+          reference_line_info->IsChangeLanePath() &&
+          reference_line_info->Cost() < kStraightForwardLineCost) {
+        disable_low_priority_path = true;
+      }
+    } else {
+      reference_line_info->SetDrivable(false);
+    }
+  }
+  return has_drivable_reference_line ? StageStatus::RUNNING
+                                     : StageStatus::ERROR;
+}
+
 Status LaneFollowStage::PlanOnReferenceLine(
     const TrajectoryPoint& planning_start_point, Frame* frame,
     ReferenceLineInfo* reference_line_info) {
+  return PlanOnReferenceLine(planning_start_point, frame, reference_line_info,
+                             task_list_);
+}
+
+Status LaneFollowStage::PlanOnReferenceLine(
+    const TrajectoryPoint& planning_start_point, Frame* frame,
+    ReferenceLineInfo* reference_line_info,
+    const std::vector<Task*>& task_list) {
   if (!reference_line_info->IsChangeLanePath()) {
     reference_line_info->AddCost(kStraightForwardLineCost);
   }
@@ -156,22 +220,22 @@ Status LaneFollowStage::PlanOnReferenceLine(
 
   auto ret = Status::OK();
 
-  for (auto* optimizer : task_list_) {
-    const double start_timestamp = Clock::NowInSeconds();
-    ret = optimizer->Execute(frame, reference_line_info);
+  for (auto* optimizer : task_list) {
+    TaskStats task_stats;
+    ret = optimizer->ExecuteWithinBudget(frame, reference_line_info,
+                                         &task_stats);
     if (!ret.ok()) {
       AERROR << "Failed to run tasks[" << optimizer->Name()
              << "], Error message: " << ret.error_message();
       break;
     }
-    const double end_timestamp = Clock::NowInSeconds();
-    const double time_diff_ms = (end_timestamp - start_timestamp) * 1000;
 
     ADEBUG << "after optimizer " << optimizer->Name() << ":"
            << reference_line_info->PathSpeedDebugString() << std::endl;
-    ADEBUG << optimizer->Name() << " time spend: " << time_diff_ms << " ms.";
+    ADEBUG << optimizer->Name() << " time spend: " << task_stats.time_ms()
+           << " ms.";
 
-    RecordDebugInfo(reference_line_info, optimizer->Name(), time_diff_ms);
+    RecordDebugInfo(reference_line_info, task_stats);
   }
 
   RecordObstacleDebugInfo(reference_line_info);
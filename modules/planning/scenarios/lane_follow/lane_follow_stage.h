@@ -53,6 +53,11 @@ class LaneFollowStage : public Stage {
       const common::TrajectoryPoint& planning_start_point, Frame* frame,
       ReferenceLineInfo* reference_line_info);
 
+  common::Status PlanOnReferenceLine(
+      const common::TrajectoryPoint& planning_start_point, Frame* frame,
+      ReferenceLineInfo* reference_line_info,
+      const std::vector<Task*>& task_list);
+
   void GenerateFallbackPathProfile(const ReferenceLineInfo* reference_line_info,
                                    PathData* path_data);
 
@@ -62,9 +67,16 @@ class LaneFollowStage : public Stage {
   void RecordObstacleDebugInfo(ReferenceLineInfo* reference_line_info);
 
   void RecordDebugInfo(ReferenceLineInfo* reference_line_info,
-                       const std::string& name, const double time_diff_ms);
+                       const TaskStats& task_stats);
 
  private:
+  /**
+   * @brief Plans the drivable reference lines at the same time, each with
+   * its own tasks, and then compares them as the sequential planning does.
+   */
+  StageStatus ProcessInParallel(
+      const common::TrajectoryPoint& planning_start_point, Frame* frame);
+
   ScenarioConfig config_;
   std::unique_ptr<Stage> stage_;
 };
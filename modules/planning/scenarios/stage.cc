@@ -23,6 +23,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "modules/planning/common/planning_gflags.h"
 #include "modules/planning/common/speed_profile_generator.h"
 #include "modules/planning/tasks/task_factory.h"
 
@@ -68,6 +69,27 @@ Task* Stage::FindTask(TaskConfig::TaskType task_type) const {
   }
 }
 
+const std::vector<Task*>& Stage::TaskListOfReferenceLine(const size_t index) {
+  if (index == 0) {
+    return task_list_;
+  }
+  while (reference_line_task_lists_.size() < index) {
+    std::unordered_map<TaskConfig::TaskType, const TaskConfig*, std::hash<int>>
+        config_map;
+    for (const auto& task_config : config_.task_config()) {
+      config_map[task_config.task_type()] = &task_config;
+    }
+    reference_line_tasks_.emplace_back();
+    reference_line_task_lists_.emplace_back();
+    for (int i = 0; i < config_.task_type_size(); ++i) {
+      auto ptr = TaskFactory::CreateTask(*config_map[config_.task_type(i)]);
+      reference_line_task_lists_.back().push_back(ptr.get());
+      reference_line_tasks_.back().push_back(std::move(ptr));
+    }
+  }
+  return reference_line_task_lists_[index - 1];
+}
+
 bool Stage::ExecuteTaskOnReferenceLine(
     const common::TrajectoryPoint& planning_start_point, Frame* frame) {
   for (auto& reference_line_info : *frame->mutable_reference_line_info()) {
@@ -78,12 +100,19 @@ bool Stage::ExecuteTaskOnReferenceLine(
 
     auto ret = common::Status::OK();
     for (auto* task : task_list_) {
-      ret = task->Execute(frame, &reference_line_info);
+      TaskStats task_stats;
+      ret = task->ExecuteWithinBudget(frame, &reference_line_info,
+                                      &task_stats);
       if (!ret.ok()) {
         AERROR << "Failed to run tasks[" << task->Name()
                << "], Error message: " << ret.error_message();
         break;
       }
+      if (FLAGS_enable_record_debug) {
+        reference_line_info.mutable_latency_stats()
+            ->add_task_stats()
+            ->CopyFrom(task_stats);
+      }
     }
 
     if (reference_line_info.speed_data().empty()) {
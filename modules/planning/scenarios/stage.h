@@ -82,6 +82,14 @@ class Stage {
   bool ExecuteTaskOnReferenceLine(
       const common::TrajectoryPoint& planning_start_point, Frame* frame);
 
+  /**
+   * @brief Gets the tasks to run on the index-th reference line when
+   * reference lines are planned in parallel. The first reference line runs
+   * the task list of the stage, and each other one gets tasks of its own, as
+   * tasks keep state across runs. This function is not thread safe.
+   */
+  const std::vector<Task*>& TaskListOfReferenceLine(const size_t index);
+
   virtual Stage::StageStatus FinishScenario();
 
   bool CheckStopSignDone(
@@ -95,6 +103,9 @@ class Stage {
  protected:
   std::map<TaskConfig::TaskType, std::unique_ptr<Task>> tasks_;
   std::vector<Task*> task_list_;
+  // the tasks of the reference lines after the first one
+  std::vector<std::vector<std::unique_ptr<Task>>> reference_line_tasks_;
+  std::vector<std::vector<Task*>> reference_line_task_lists_;
   ScenarioConfig::StageConfig config_;
   ScenarioConfig::StageType next_stage_;
   void* context_;
@@ -0,0 +1,77 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/tasks/deciders/obstacle_s_sweep.h"
+
+#include <algorithm>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace planning {
+
+ObstacleSSweep::ObstacleSSweep(
+    const IndexedList<std::string, Obstacle>& indexed_obstacles,
+    const double s_buffer) {
+  for (const auto* obstacle : indexed_obstacles.Items()) {
+    if (obstacle->IsVirtual() || !obstacle->IsStatic()) {
+      continue;
+    }
+    const auto& obs_sl = obstacle->PerceptionSLBoundary();
+    SRange s_range;
+    s_range.start_s = obs_sl.start_s() - s_buffer;
+    s_range.end_s = obs_sl.end_s() + s_buffer;
+    s_range.index = obstacles_.size();
+    s_ranges_.push_back(s_range);
+    obstacles_.push_back(obstacle);
+  }
+  std::sort(s_ranges_.begin(), s_ranges_.end(),
+            [](const SRange& a, const SRange& b) {
+              return a.start_s < b.start_s;
+            });
+}
+
+const std::vector<const Obstacle*>& ObstacleSSweep::Advance(const double s) {
+  DCHECK_GE(s, last_s_);
+  last_s_ = s;
+  bool is_changed = false;
+  while (next_s_range_ < s_ranges_.size() &&
+         s_ranges_[next_s_range_].start_s <= s) {
+    const auto& s_range = s_ranges_[next_s_range_++];
+    active_ends_.emplace(s_range.end_s, s_range.index);
+    active_[s_range.index] = obstacles_[s_range.index];
+    is_changed = true;
+  }
+  while (!active_ends_.empty() && active_ends_.top().first < s) {
+    active_.erase(active_ends_.top().second);
+    active_ends_.pop();
+    is_changed = true;
+  }
+  if (is_changed) {
+    active_obstacles_.clear();
+    for (const auto& entry : active_) {
+      active_obstacles_.push_back(entry.second);
+    }
+  }
+  return active_obstacles_;
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <map>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "modules/planning/common/indexed_list.h"
+#include "modules/planning/common/obstacle.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class ObstacleSSweep
+ * @brief Sweeps increasing s over the s ranges of the static obstacles, and
+ *        keeps the obstacles whose s range, extended by a buffer, contains the
+ *        current s.
+ *
+ * The s ranges are sorted once, so sweeping the whole path costs
+ * O(n log n) plus the size of the outputs, instead of a scan of all the
+ * obstacles at every s. The active obstacles are given in the order of the
+ * indexed list, so that the bounds updated by them one after another do not
+ * change.
+ */
+class ObstacleSSweep {
+ public:
+  ObstacleSSweep(const IndexedList<std::string, Obstacle>& indexed_obstacles,
+                 const double s_buffer);
+
+  /**
+   * @brief Moves the sweep to "s", which must not be less than the s of the
+   *        last call, and gets the active obstacles.
+   */
+  const std::vector<const Obstacle*>& Advance(const double s);
+
+ private:
+  struct SRange {
+    double start_s = 0.0;
+    double end_s = 0.0;
+    size_t index = 0;
+  };
+
+  std::vector<const Obstacle*> obstacles_;
+  // sorted by start_s
+  std::vector<SRange> s_ranges_;
+  size_t next_s_range_ = 0;
+  // the end_s and index of the active obstacles, the earliest end first
+  std::priority_queue<std::pair<double, size_t>,
+                      std::vector<std::pair<double, size_t>>,
+                      std::greater<std::pair<double, size_t>>>
+      active_ends_;
+  std::map<size_t, const Obstacle*> active_;
+  std::vector<const Obstacle*> active_obstacles_;
+  double last_s_ = -std::numeric_limits<double>::infinity();
+};
+
+}  // namespace planning
+}  // namespace apollo
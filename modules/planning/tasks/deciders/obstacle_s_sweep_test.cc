@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#include "modules/planning/tasks/deciders/obstacle_s_sweep.h"
+
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace planning {
+
+namespace {
+
+Obstacle MakeObstacle(const int id, const double start_s, const double end_s,
+                      const bool is_static) {
+  perception::PerceptionObstacle perception_obstacle;
+  perception_obstacle.set_id(id);
+  perception_obstacle.set_length(1.0);
+  perception_obstacle.set_width(1.0);
+  Obstacle obstacle(std::to_string(id), perception_obstacle,
+                    prediction::ObstaclePriority::NORMAL, is_static);
+  SLBoundary sl_boundary;
+  sl_boundary.set_start_s(start_s);
+  sl_boundary.set_end_s(end_s);
+  obstacle.SetPerceptionSlBoundary(sl_boundary);
+  return obstacle;
+}
+
+}  // namespace
+
+TEST(ObstacleSSweepTest, SameAsFullScan) {
+  constexpr double kSBuffer = 0.5;
+  IndexedList<std::string, Obstacle> indexed_obstacles;
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<double> s_distribution(0.0, 100.0);
+  std::uniform_real_distribution<double> length_distribution(0.0, 5.0);
+  for (int i = 0; i < 200; ++i) {
+    const double start_s = s_distribution(generator);
+    indexed_obstacles.Add(
+        std::to_string(i),
+        MakeObstacle(i, start_s, start_s + length_distribution(generator),
+                     i % 7 != 0));
+  }
+  // a virtual obstacle
+  indexed_obstacles.Add("-1", MakeObstacle(-1, 10.0, 20.0, true));
+
+  ObstacleSSweep sweep(indexed_obstacles, kSBuffer);
+  for (double s = -1.0; s < 110.0; s += 0.3) {
+    std::vector<const Obstacle*> expected;
+    for (const auto* obstacle : indexed_obstacles.Items()) {
+      const auto& obs_sl = obstacle->PerceptionSLBoundary();
+      if (obstacle->IsVirtual() || !obstacle->IsStatic() ||
+          s < obs_sl.start_s() - kSBuffer || s > obs_sl.end_s() + kSBuffer) {
+        continue;
+      }
+      expected.push_back(obstacle);
+    }
+    EXPECT_EQ(expected, sweep.Advance(s));
+  }
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -30,6 +30,7 @@
 #include "modules/map/hdmap/hdmap_util.h"
 #include "modules/planning/common/frame.h"
 #include "modules/planning/common/planning_gflags.h"
+#include "modules/planning/tasks/deciders/obstacle_s_sweep.h"
 
 namespace apollo {
 namespace planning {
@@ -56,7 +57,10 @@ void SidePassPathDecider::InitSolver() {
       config.side_pass_path_decider_config().dddl_weight(),
       config.side_pass_path_decider_config().guiding_line_weight(),
   };
-  fem_qp_.reset(new Fem1dExpandedJerkQpProblem());
+  // keep the problem across frames so that its osqp workspace is reused
+  if (fem_qp_ == nullptr) {
+    fem_qp_.reset(new Fem1dExpandedJerkQpProblem());
+  }
   CHECK(fem_qp_->Init(n, l_init, delta_s_, w,
                       config.side_pass_path_decider_config().max_dddl()));
 }
@@ -261,6 +265,8 @@ SidePassPathDecider::GetPathBoundaries(
 
   constexpr double kLargeBoundary = 10.0;
   std::unordered_map<std::string, SidePassDirection> obs_id_to_side_pass_dir;
+  ObstacleSSweep obstacle_sweep(indexed_obstacles,
+                                FLAGS_side_pass_obstacle_s_buffer);
   for (double curr_s = adc_frenet_frame_point_.s();
        curr_s < std::min(adc_frenet_frame_point_.s() + total_path_length_,
                          reference_line.Length());
@@ -393,19 +399,12 @@ SidePassPathDecider::GetPathBoundaries(
            << std::get<1>(lateral_bound) << ", " << std::get<2>(lateral_bound)
            << ".";
 
-    // Update lateral_bound based on obstacles:
-    for (const auto *obstacle : indexed_obstacles.Items()) {
-      if (obstacle->IsVirtual() || !obstacle->IsStatic()) {
-        continue;
-      }
-      const auto obs_sl = obstacle->PerceptionSLBoundary();
+    // Update lateral_bound based on the static obstacles overlapping with
+    // curr_s:
+    for (const auto *obstacle : obstacle_sweep.Advance(curr_s)) {
+      const auto &obs_sl = obstacle->PerceptionSLBoundary();
       // ADEBUG << obs_sl.ShortDebugString();
       // ADEBUG << "Offset = " << adc_frenet_frame_point_.s();
-      // not overlap with obstacle
-      if (curr_s < obs_sl.start_s() - FLAGS_side_pass_obstacle_s_buffer ||
-          curr_s > obs_sl.end_s() + FLAGS_side_pass_obstacle_s_buffer) {
-        continue;
-      }
       // not within lateral range
       if (obs_sl.start_l() > std::get<2>(lateral_bound) +
                                  FLAGS_side_pass_obstacle_l_buffer +
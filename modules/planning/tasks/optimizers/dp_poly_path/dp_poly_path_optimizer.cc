@@ -20,7 +20,9 @@
 
 #include "modules/planning/tasks/optimizers/dp_poly_path/dp_poly_path_optimizer.h"
 
+#include "modules/common/time/time.h"
 #include "modules/planning/common/planning_gflags.h"
+#include "modules/planning/common/sampling_density.h"
 #include "modules/planning/tasks/optimizers/road_graph/dp_road_graph.h"
 #include "modules/planning/tasks/optimizers/road_graph/waypoint_sampler.h"
 
@@ -29,6 +31,7 @@ namespace planning {
 
 using apollo::common::ErrorCode;
 using apollo::common::Status;
+using apollo::common::time::Clock;
 
 DpPolyPathOptimizer::DpPolyPathOptimizer(const TaskConfig &config)
     : PathOptimizer(config) {
@@ -45,19 +48,54 @@ Status DpPolyPathOptimizer::Process(const SpeedData &speed_data,
   DpRoadGraph dp_road_graph(dp_poly_path_config, *reference_line_info_,
                             speed_data);
   dp_road_graph.SetDebugLogger(reference_line_info_->mutable_debug());
-  dp_road_graph.SetWaypointSampler(
-      new WaypointSampler(dp_poly_path_config.waypoint_sampler_config()));
+  const auto &sampler_config = dp_poly_path_config.waypoint_sampler_config();
+  const auto &obstacles =
+      reference_line_info_->path_decision()->obstacles().Items();
+  SamplingDensity sampling_density(sampler_config.adaptive_sampling());
+  const double density_scale = sampling_density.Scale(
+      sampling_density.CountNearbyObstacles(
+          obstacles, reference_line_info_->AdcSlBoundary()),
+      SamplingDensity::RemainingCycleTimeMs(frame_->start_time()));
+  auto *waypoint_sampler = new WaypointSampler(sampler_config);
+  waypoint_sampler->SetDensityScale(density_scale);
+  dp_road_graph.SetWaypointSampler(waypoint_sampler);
+  if (FLAGS_enable_dp_road_graph_reuse) {
+    dp_road_graph.SetRoadGraphCache(GetRoadGraphCache());
+  }
 
-  if (!dp_road_graph.FindPathTunnel(
-          init_point,
-          reference_line_info_->path_decision()->obstacles().Items(),
-          path_data)) {
+  const double start_timestamp = Clock::NowInSeconds();
+  if (!dp_road_graph.FindPathTunnel(init_point, obstacles, path_data)) {
     AERROR << "Failed to find tunnel in road graph";
     return Status(ErrorCode::PLANNING_ERROR, "dp_road_graph path generation");
   }
+  if (density_scale < 1.0) {
+    // the edges between two levels grow with the square of the samples
+    const double time_ms = (Clock::NowInSeconds() - start_timestamp) * 1000.0;
+    ADEBUG << "dp_road_graph sampled with density scale " << density_scale
+           << " in " << time_ms << " ms, about "
+           << time_ms * (1.0 / (density_scale * density_scale) - 1.0)
+           << " ms saved.";
+  }
 
   return Status::OK();
 }
 
+DpRoadGraphCache *DpPolyPathOptimizer::GetRoadGraphCache() {
+  const uint32_t sequence_num = frame_->SequenceNum();
+  // drop the reference lines which were not planned on in the last frame
+  for (auto iter = road_graph_caches_.begin();
+       iter != road_graph_caches_.end();) {
+    if (iter->second.sequence_num() + 1 < sequence_num) {
+      iter = road_graph_caches_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+  auto *road_graph_cache =
+      &road_graph_caches_[reference_line_info_->Lanes().Id()];
+  road_graph_cache->set_sequence_num(sequence_num);
+  return road_graph_cache;
+}
+
 }  // namespace planning
 }  // namespace apollo
@@ -20,9 +20,13 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+
 #include "modules/planning/proto/dp_poly_path_config.pb.h"
 #include "modules/planning/proto/planning_config.pb.h"
 #include "modules/planning/tasks/optimizers/path_optimizer.h"
+#include "modules/planning/tasks/optimizers/road_graph/dp_road_graph_cache.h"
 
 namespace apollo {
 namespace planning {
@@ -41,6 +45,11 @@ class DpPolyPathOptimizer : public PathOptimizer {
                                  const ReferenceLine &reference_line,
                                  const common::TrajectoryPoint &init_point,
                                  PathData *const path_data) override;
+
+  DpRoadGraphCache *GetRoadGraphCache();
+
+  // edge costs of the last frame, by the lanes of the reference line
+  std::unordered_map<std::string, DpRoadGraphCache> road_graph_caches_;
 };
 
 }  // namespace planning
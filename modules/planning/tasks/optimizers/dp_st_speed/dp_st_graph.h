@@ -20,13 +20,13 @@
 
 #pragma once
 
-#include <memory>
 #include <vector>
 
 #include "modules/common/configs/proto/vehicle_config.pb.h"
 #include "modules/planning/proto/dp_st_speed_config.pb.h"
 #include "modules/planning/proto/planning_config.pb.h"
 
+#include "cyber/task/task_group.h"
 #include "modules/common/configs/vehicle_config_helper.h"
 #include "modules/common/status/status.h"
 #include "modules/planning/common/frame.h"
@@ -57,13 +57,16 @@ class DpStGraph {
 
   apollo::common::Status CalculateTotalCost();
 
-  // defined for cyber task
-  struct StGraphMessage {
-    StGraphMessage(const uint32_t c_, const int32_t r_) : c(c_), r(r_) {}
-    uint32_t c;
-    uint32_t r;
-  };
-  void CalculateCostAt(const std::shared_ptr<StGraphMessage>& msg);
+  // calculates the total costs of the rows [lowest_row, highest_row] of
+  // column c, whose obstacle costs are set
+  void CalculateCostsAt(const uint32_t c, const uint32_t lowest_row,
+                        const uint32_t highest_row);
+
+  void CalculateCostAt(const uint32_t c, const uint32_t r);
+
+  StGraphPoint& CostAt(const uint32_t c, const uint32_t r) {
+    return cost_table_[c * dim_s_ + r];
+  }
 
   double CalculateEdgeCost(const STPoint& first, const STPoint& second,
                           const STPoint& third, const STPoint& forth,
@@ -101,9 +104,15 @@ class DpStGraph {
   double unit_s_ = 0.0;
   double unit_t_ = 0.0;
 
-  // cost_table_[t][s]
+  uint32_t dim_s_ = 0;
+  uint32_t dim_t_ = 0;
+
+  // cost_table_[t * dim_s_ + s], the rows of a column are contiguous
   // row: s, col: t --- NOTICE: Please do NOT change.
-  std::vector<std::vector<StGraphPoint>> cost_table_;
+  std::vector<StGraphPoint> cost_table_;
+
+  // the tasks of the column being calculated, reused for all the columns
+  cyber::TaskGroup column_tasks_;
 };
 
 }  // namespace planning
@@ -25,8 +25,10 @@
 #include "modules/planning/proto/planning_internal.pb.h"
 
 #include "modules/common/configs/vehicle_config_helper.h"
+#include "modules/common/time/time.h"
 #include "modules/common/vehicle_state/vehicle_state_provider.h"
 #include "modules/planning/common/planning_gflags.h"
+#include "modules/planning/common/sampling_density.h"
 #include "modules/planning/tasks/optimizers/dp_st_speed/dp_st_graph.h"
 #include "modules/planning/tasks/optimizers/st_graph/st_graph_data.h"
 
@@ -36,6 +38,7 @@ namespace planning {
 using apollo::common::ErrorCode;
 using apollo::common::Status;
 using apollo::common::TrajectoryPoint;
+using apollo::common::time::Clock;
 using apollo::planning_internal::STGraphDebug;
 
 DpStSpeedOptimizer::DpStSpeedOptimizer(const TaskConfig& config)
@@ -77,15 +80,35 @@ bool DpStSpeedOptimizer::SearchStGraph(
   const double path_length = path_data.discretized_path().Length();
   StGraphData st_graph_data(boundaries, init_point_, speed_limit, path_length);
 
-  DpStGraph st_graph(st_graph_data, dp_st_speed_config_,
-                     reference_line_info_->path_decision()->obstacles().Items(),
-                     init_point_, adc_sl_boundary_);
+  const auto& obstacles =
+      reference_line_info_->path_decision()->obstacles().Items();
+  SamplingDensity sampling_density(dp_st_speed_config_.adaptive_sampling());
+  const double density_scale = sampling_density.Scale(
+      sampling_density.CountNearbyObstacles(obstacles, adc_sl_boundary_),
+      SamplingDensity::RemainingCycleTimeMs(frame_->start_time()));
+  DpStSpeedConfig dp_st_speed_config = dp_st_speed_config_;
+  constexpr uint32_t kMinMatrixDimensionS = 10;
+  dp_st_speed_config.set_matrix_dimension_s(SamplingDensity::ScaleCount(
+      dp_st_speed_config_.matrix_dimension_s(), density_scale,
+      kMinMatrixDimensionS));
+
+  const double start_timestamp = Clock::NowInSeconds();
+  DpStGraph st_graph(st_graph_data, dp_st_speed_config, obstacles, init_point_,
+                     adc_sl_boundary_);
 
   if (!st_graph.Search(speed_data).ok()) {
     AERROR << "failed to search graph with dynamic programming.";
     RecordSTGraphDebug(st_graph_data, st_graph_debug);
     return false;
   }
+  if (density_scale < 1.0) {
+    // both the rows and the reachable rows of a column scale with dim s
+    const double time_ms = (Clock::NowInSeconds() - start_timestamp) * 1000.0;
+    ADEBUG << "dp_st_graph sampled " << dp_st_speed_config.matrix_dimension_s()
+           << " s rows in " << time_ms << " ms, about "
+           << time_ms * (1.0 / (density_scale * density_scale) - 1.0)
+           << " ms saved.";
+  }
   RecordSTGraphDebug(st_graph_data, st_graph_debug);
   return true;
 }
@@ -236,7 +236,10 @@ Status QpPiecewiseJerkPathOptimizer::Process(
       qp_config.guiding_line_weight(),
   };
 
-  fem_1d_qp_.reset(new Fem1dExpandedJerkQpProblem());
+  // keep the problem across frames so that its osqp workspace is reused
+  if (fem_1d_qp_ == nullptr) {
+    fem_1d_qp_.reset(new Fem1dExpandedJerkQpProblem());
+  }
   constexpr double kMaxLThirdOrderDerivative = 2.0;
 
   if (!fem_1d_qp_->Init(n, init_lateral_state, qp_delta_s, w,
@@ -22,7 +22,7 @@
 
 #include <utility>
 
-#include "cyber/task/task.h"
+#include "cyber/task/task_group.h"
 
 #include "modules/common/proto/error_code.pb.h"
 #include "modules/planning/proto/planning_internal.pb.h"
@@ -129,6 +129,13 @@ bool DpRoadGraph::GenerateMinCostPath(
       obstacles, vehicle_config.vehicle_param(), speed_data_, init_sl_point_,
       reference_line_info_.AdcSlBoundary());
 
+  if (road_graph_cache_ != nullptr) {
+    road_graph_cache_->BeginFrame(
+        reference_line_,
+        {init_point_.path_point().x(), init_point_.path_point().y()},
+        init_sl_point_, trajectory_cost.static_obstacle_sl_boundaries());
+  }
+
   std::list<std::list<DpRoadGraphNode>> graph_nodes;
 
   // find one point from first row
@@ -145,13 +152,13 @@ bool DpRoadGraph::GenerateMinCostPath(
                                   ComparableCost());
   auto &front = graph_nodes.front().front();
   size_t total_level = path_waypoints.size();
+  cyber::TaskGroup level_tasks;
 
   for (size_t level = 1; level < path_waypoints.size(); ++level) {
     const auto &prev_dp_nodes = graph_nodes.back();
     const auto &level_points = path_waypoints[level];
 
     graph_nodes.emplace_back();
-    std::vector<std::future<void>> results;
 
     for (size_t i = 0; i < level_points.size(); ++i) {
       const auto &cur_point = level_points[i];
@@ -163,16 +170,20 @@ bool DpRoadGraph::GenerateMinCostPath(
           &(graph_nodes.back().back()));
 
       if (FLAGS_enable_multi_thread_in_dp_poly_path) {
-        results.emplace_back(cyber::Async(&DpRoadGraph::UpdateNode, this, msg));
+        level_tasks.Spawn([this, msg]() { UpdateNode(msg); });
       } else {
         UpdateNode(msg);
       }
     }
-    if (FLAGS_enable_multi_thread_in_dp_poly_path) {
-      for (auto &result : results) {
-        result.get();
-      }
-    }
+    level_tasks.Wait();
+  }
+
+  if (road_graph_cache_ != nullptr) {
+    const double hit_ratio = road_graph_cache_->HitRatio();
+    ADEBUG << "road graph edge cost hit ratio: " << hit_ratio;
+    planning_debug_->mutable_planning_data()
+        ->mutable_dp_poly_graph()
+        ->set_edge_cost_hit_ratio(hit_ratio);
   }
 
   // find best path
@@ -225,8 +236,8 @@ void DpRoadGraph::UpdateNode(const std::shared_ptr<RoadGraphMessage> &msg) {
       continue;
     }
     const auto cost =
-        msg->trajectory_cost->Calculate(curve, prev_sl_point.s(), cur_point.s(),
-                                        msg->level, msg->total_level) +
+        CalculateEdgeCost(msg->trajectory_cost, curve, prev_sl_point, cur_point,
+                          msg->level, msg->total_level) +
         prev_dp_node.min_cost;
 
     msg->cur_node->UpdateCost(&prev_dp_node, curve, cost);
@@ -260,6 +271,26 @@ bool DpRoadGraph::IsValidCurve(const QuinticPolynomialCurve1d &curve) const {
   return true;
 }
 
+ComparableCost DpRoadGraph::CalculateEdgeCost(
+    TrajectoryCost *trajectory_cost, const QuinticPolynomialCurve1d &curve,
+    const common::SLPoint &start, const common::SLPoint &end,
+    const uint32_t curr_level, const uint32_t total_level) {
+  // the edges of the first level start from the init point, which moves
+  // every frame, so they are never reused.
+  if (road_graph_cache_ == nullptr || curr_level < 2) {
+    return trajectory_cost->Calculate(curve, start.s(), end.s(), curr_level,
+                                      total_level);
+  }
+  ComparableCost cost;
+  if (!road_graph_cache_->Lookup(start, end, &cost)) {
+    cost = trajectory_cost->CalculateStaticCost(curve, start.s(), end.s());
+    road_graph_cache_->Insert(start, end, cost);
+  }
+  cost += trajectory_cost->CalculateFrameCost(curve, start.s(), end.s(),
+                                              curr_level, total_level);
+  return cost;
+}
+
 void DpRoadGraph::GetCurveCost(TrajectoryCost trajectory_cost,
                                const QuinticPolynomialCurve1d &curve,
                                const double start_s, const double end_s,
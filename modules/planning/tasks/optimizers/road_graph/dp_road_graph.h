@@ -37,6 +37,7 @@
 #include "modules/planning/common/trajectory/discretized_trajectory.h"
 #include "modules/planning/math/curve1d/quintic_polynomial_curve1d.h"
 #include "modules/planning/reference_line/reference_point.h"
+#include "modules/planning/tasks/optimizers/road_graph/dp_road_graph_cache.h"
 #include "modules/planning/tasks/optimizers/road_graph/trajectory_cost.h"
 #include "modules/planning/tasks/optimizers/road_graph/waypoint_sampler.h"
 
@@ -63,6 +64,14 @@ class DpRoadGraph {
     waypoint_sampler_.reset(waypoint_sampler);
   }
 
+  /**
+   * @brief Reuses the edge costs of the last frame kept in the cache, and
+   *        keeps the ones of this frame in it. Not owned.
+   */
+  void SetRoadGraphCache(DpRoadGraphCache *road_graph_cache) {
+    road_graph_cache_ = road_graph_cache;
+  }
+
  private:
   /**
    * an private inner struct for the dp algorithm
@@ -102,6 +111,13 @@ class DpRoadGraph {
 
   bool IsValidCurve(const QuinticPolynomialCurve1d &curve) const;
 
+  ComparableCost CalculateEdgeCost(TrajectoryCost *trajectory_cost,
+                                   const QuinticPolynomialCurve1d &curve,
+                                   const common::SLPoint &start,
+                                   const common::SLPoint &end,
+                                   const uint32_t curr_level,
+                                   const uint32_t total_level);
+
   void GetCurveCost(TrajectoryCost trajectory_cost,
                     const QuinticPolynomialCurve1d &curve, const double start_s,
                     const double end_s, const uint32_t curr_level,
@@ -140,6 +156,8 @@ class DpRoadGraph {
   ObjectSidePass sidepass_;
 
   std::unique_ptr<WaypointSampler> waypoint_sampler_;
+
+  DpRoadGraphCache *road_graph_cache_ = nullptr;
 };
 
 }  // namespace planning
@@ -0,0 +1,171 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file dp_road_graph_cache.cc
+ **/
+
+#include "modules/planning/tasks/optimizers/road_graph/dp_road_graph_cache.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "modules/common/configs/vehicle_config_helper.h"
+#include "modules/planning/tasks/optimizers/road_graph/trajectory_cost.h"
+
+namespace apollo {
+namespace planning {
+
+namespace {
+
+constexpr double kEpsilon = 1e-3;
+// the last init point must project onto the new reference line this close
+// to where it was, otherwise the reference line geometry has changed.
+constexpr double kMaxAnchorLateralShift = 0.05;
+
+bool IsSamePoint(const common::SLPoint &a, const common::SLPoint &b) {
+  return std::fabs(a.s() - b.s()) < kEpsilon &&
+         std::fabs(a.l() - b.l()) < kEpsilon;
+}
+
+bool IsSameBoundary(const SLBoundary &a, const SLBoundary &b,
+                    const double s_shift) {
+  return std::fabs(a.start_s() - b.start_s() - s_shift) < kEpsilon &&
+         std::fabs(a.end_s() - b.end_s() - s_shift) < kEpsilon &&
+         std::fabs(a.start_l() - b.start_l()) < kEpsilon &&
+         std::fabs(a.end_l() - b.end_l()) < kEpsilon;
+}
+
+// Gets the largest end_s of the boundaries in "boundaries" which have no
+// match in "others".
+double MaxUnmatchedEndS(const std::vector<SLBoundary> &boundaries,
+                        const std::vector<SLBoundary> &others,
+                        const double s_shift) {
+  double max_end_s = -std::numeric_limits<double>::infinity();
+  for (const auto &boundary : boundaries) {
+    const bool matched = std::any_of(
+        others.begin(), others.end(), [&](const SLBoundary &other) {
+          return IsSameBoundary(boundary, other, s_shift);
+        });
+    if (!matched) {
+      max_end_s = std::max(max_end_s, boundary.end_s());
+    }
+  }
+  return max_end_s;
+}
+
+}  // namespace
+
+void DpRoadGraphCache::BeginFrame(
+    const ReferenceLine &reference_line, const common::math::Vec2d &init_xy,
+    const common::SLPoint &init_sl_point,
+    const std::vector<SLBoundary> &static_obstacle_sl_boundaries) {
+  {
+    std::lock_guard<std::mutex> lock(curr_edges_mutex_);
+    prev_edges_ = std::move(curr_edges_);
+    curr_edges_.clear();
+  }
+  num_lookups_ = 0;
+  num_hits_ = 0;
+  frame_reusable_ = false;
+
+  common::SLPoint prev_anchor;
+  if (has_prev_frame_ && !prev_edges_.empty() &&
+      std::fabs(init_sl_point.l() - prev_init_sl_point_.l()) < kEpsilon &&
+      reference_line.XYToSL(prev_init_xy_, &prev_anchor) &&
+      std::fabs(prev_anchor.l() - prev_init_sl_point_.l()) <
+          kMaxAnchorLateralShift) {
+    // s of the last frame + s_shift = s of this frame
+    const double s_shift = prev_anchor.s() - prev_init_sl_point_.s();
+    for (auto &edge : prev_edges_) {
+      edge.start.set_s(edge.start.s() + s_shift);
+      edge.end.set_s(edge.end.s() + s_shift);
+    }
+
+    // Both init points have to be behind the edge by the off road ignore
+    // distance, which also keeps the edges leaving the init point out.
+    const double max_init_s = std::max(init_sl_point.s(), prev_anchor.s());
+    min_reusable_start_s_ = max_init_s + TrajectoryCost::kOffRoadIgnoreDistance;
+
+    // A static obstacle no longer affects the cost once the rear edge of the
+    // ADC has passed it, so only the edges starting beyond every changed
+    // obstacle are reused.
+    const double max_changed_end_s = std::max(
+        MaxUnmatchedEndS(static_obstacle_sl_boundaries,
+                         prev_static_obstacle_sl_boundaries_, s_shift),
+        MaxUnmatchedEndS(prev_static_obstacle_sl_boundaries_,
+                         static_obstacle_sl_boundaries, -s_shift) +
+            s_shift);
+    const auto &vehicle_param =
+        common::VehicleConfigHelper::GetConfig().vehicle_param();
+    min_reusable_start_s_ =
+        std::max(min_reusable_start_s_,
+                 max_changed_end_s + vehicle_param.back_edge_to_center());
+    frame_reusable_ = true;
+  }
+
+  has_prev_frame_ = true;
+  prev_init_xy_ = init_xy;
+  prev_init_sl_point_ = init_sl_point;
+  prev_static_obstacle_sl_boundaries_ = static_obstacle_sl_boundaries;
+}
+
+bool DpRoadGraphCache::IsReusable(const common::SLPoint &start) const {
+  return frame_reusable_ && start.s() > min_reusable_start_s_;
+}
+
+bool DpRoadGraphCache::Lookup(const common::SLPoint &start,
+                              const common::SLPoint &end,
+                              ComparableCost *const cost) {
+  ++num_lookups_;
+  if (!IsReusable(start)) {
+    return false;
+  }
+  // There are only a few hundred edges in a road graph, and a lookup is far
+  // cheaper than a cost evaluation.
+  for (const auto &edge : prev_edges_) {
+    if (IsSamePoint(edge.start, start) && IsSamePoint(edge.end, end)) {
+      *cost = edge.cost;
+      ++num_hits_;
+      // carry the edge over as it was first computed, so that small shifts
+      // cannot add up over frames.
+      std::lock_guard<std::mutex> lock(curr_edges_mutex_);
+      curr_edges_.push_back(edge);
+      return true;
+    }
+  }
+  return false;
+}
+
+void DpRoadGraphCache::Insert(const common::SLPoint &start,
+                              const common::SLPoint &end,
+                              const ComparableCost &cost) {
+  std::lock_guard<std::mutex> lock(curr_edges_mutex_);
+  curr_edges_.push_back({start, end, cost});
+}
+
+double DpRoadGraphCache::HitRatio() const {
+  const uint32_t num_lookups = num_lookups_;
+  if (num_lookups == 0) {
+    return 0.0;
+  }
+  return static_cast<double>(num_hits_) / static_cast<double>(num_lookups);
+}
+
+}  // namespace planning
+}  // namespace apollo
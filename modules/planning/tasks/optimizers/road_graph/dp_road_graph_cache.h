@@ -0,0 +1,121 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file dp_road_graph_cache.h
+ **/
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "modules/common/proto/pnc_point.pb.h"
+#include "modules/planning/proto/sl_boundary.pb.h"
+
+#include "modules/common/math/vec2d.h"
+#include "modules/planning/reference_line/reference_line.h"
+#include "modules/planning/tasks/optimizers/road_graph/comparable_cost.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class DpRoadGraphCache
+ * @brief Keeps the static edge costs of the last DpRoadGraph of one reference
+ *        line, so that the next frame only recomputes the edges whose
+ *        obstacle neighborhood changed.
+ *
+ * The edges of the last frame are re-anchored by the s shift of the
+ * reference line between the two frames. An edge is reused when its end
+ * points match, the init point did not change its off road check, and none
+ * of the static obstacles which may contribute to its cost appeared,
+ * disappeared or moved.
+ */
+class DpRoadGraphCache {
+ public:
+  DpRoadGraphCache() = default;
+
+  /**
+   * @brief Starts a new frame. The edges inserted during the last frame become
+   *        the ones looked up in this frame.
+   * @param reference_line The reference line of this frame
+   * @param init_xy The init point of this frame
+   * @param init_sl_point The init point of this frame on the reference line
+   * @param static_obstacle_sl_boundaries The static obstacles of this frame
+   *        taken into account by TrajectoryCost
+   */
+  void BeginFrame(const ReferenceLine &reference_line,
+                  const common::math::Vec2d &init_xy,
+                  const common::SLPoint &init_sl_point,
+                  const std::vector<SLBoundary> &static_obstacle_sl_boundaries);
+
+  /**
+   * @brief Looks up the static cost of an edge computed in the last frame.
+   *        A hit is kept for the next frame as well. Thread safe.
+   * @return True if the cost can be reused
+   */
+  bool Lookup(const common::SLPoint &start, const common::SLPoint &end,
+              ComparableCost *const cost);
+
+  /**
+   * @brief Stores the static cost of an edge of this frame which missed the
+   *        cache. Thread safe.
+   */
+  void Insert(const common::SLPoint &start, const common::SLPoint &end,
+              const ComparableCost &cost);
+
+  /**
+   * @brief Gets the ratio of the lookups of this frame which hit the cache
+   */
+  double HitRatio() const;
+
+  uint32_t sequence_num() const { return sequence_num_; }
+  void set_sequence_num(const uint32_t sequence_num) {
+    sequence_num_ = sequence_num;
+  }
+
+ private:
+  struct Edge {
+    common::SLPoint start;
+    common::SLPoint end;
+    ComparableCost cost;
+  };
+
+  bool IsReusable(const common::SLPoint &start) const;
+
+  std::vector<Edge> prev_edges_;
+  std::vector<Edge> curr_edges_;
+  std::mutex curr_edges_mutex_;
+
+  // the init point of the last frame
+  bool has_prev_frame_ = false;
+  common::math::Vec2d prev_init_xy_;
+  common::SLPoint prev_init_sl_point_;
+  std::vector<SLBoundary> prev_static_obstacle_sl_boundaries_;
+
+  // where the edges of the last frame are valid in this frame
+  bool frame_reusable_ = false;
+  double min_reusable_start_s_ = 0.0;
+
+  std::atomic<uint32_t> num_lookups_{0};
+  std::atomic<uint32_t> num_hits_{0};
+  uint32_t sequence_num_ = 0;
+};
+
+}  // namespace planning
+}  // namespace apollo
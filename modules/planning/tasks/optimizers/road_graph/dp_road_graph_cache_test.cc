@@ -0,0 +1,136 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/planning/tasks/optimizers/road_graph/dp_road_graph_cache.h"
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "modules/common/configs/vehicle_config_helper.h"
+#include "modules/common/util/util.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::math::Vec2d;
+using apollo::common::util::MakeSLPoint;
+using apollo::hdmap::MapPathPoint;
+
+class DpRoadGraphCacheTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    common::VehicleConfig vehicle_config;
+    vehicle_config.mutable_vehicle_param()->set_back_edge_to_center(1.0);
+    common::VehicleConfigHelper::Init(vehicle_config);
+
+    // a straight line along x, starting at x = -10
+    std::vector<ReferencePoint> ref_points;
+    for (int i = 0; i <= 100; ++i) {
+      ref_points.emplace_back(MapPathPoint(Vec2d(i - 10.0, 0.0), 0.0), 0.0, 0.0);
+    }
+    reference_line_.reset(new ReferenceLine(ref_points));
+
+    SLBoundary obstacle;
+    obstacle.set_start_s(30.0);
+    obstacle.set_end_s(32.0);
+    obstacle.set_start_l(1.0);
+    obstacle.set_end_l(2.0);
+    obstacles_.push_back(obstacle);
+
+    cost_.safety_cost = 1.0;
+    cost_.smoothness_cost = 2.0;
+  }
+
+ protected:
+  std::unique_ptr<ReferenceLine> reference_line_;
+  std::vector<SLBoundary> obstacles_;
+  ComparableCost cost_;
+};
+
+TEST_F(DpRoadGraphCacheTest, ReuseAfterReferenceLineShift) {
+  DpRoadGraphCache cache;
+  ComparableCost cost;
+  cache.BeginFrame(*reference_line_, {0.0, 0.0}, MakeSLPoint(10.0, 0.0),
+                   obstacles_);
+  EXPECT_FALSE(
+      cache.Lookup(MakeSLPoint(20.0, 0.5), MakeSLPoint(40.0, 0.0), &cost));
+  cache.Insert(MakeSLPoint(20.0, 0.5), MakeSLPoint(40.0, 0.0), cost_);
+  EXPECT_DOUBLE_EQ(0.0, cache.HitRatio());
+
+  // the same ADC position, but the reference line now starts 10m earlier, so
+  // every s grows by 10.
+  std::vector<SLBoundary> shifted_obstacles = obstacles_;
+  shifted_obstacles[0].set_start_s(40.0);
+  shifted_obstacles[0].set_end_s(42.0);
+  std::vector<ReferencePoint> ref_points;
+  for (int i = 0; i <= 100; ++i) {
+    ref_points.emplace_back(MapPathPoint(Vec2d(i - 20.0, 0.0), 0.0), 0.0, 0.0);
+  }
+  ReferenceLine shifted_reference_line(ref_points);
+  cache.BeginFrame(shifted_reference_line, {0.0, 0.0}, MakeSLPoint(20.0, 0.0),
+                   shifted_obstacles);
+  EXPECT_FALSE(
+      cache.Lookup(MakeSLPoint(20.0, 0.5), MakeSLPoint(40.0, 0.0), &cost));
+  EXPECT_TRUE(
+      cache.Lookup(MakeSLPoint(30.0, 0.5), MakeSLPoint(50.0, 0.0), &cost));
+  EXPECT_DOUBLE_EQ(cost_.safety_cost, cost.safety_cost);
+  EXPECT_DOUBLE_EQ(cost_.smoothness_cost, cost.smoothness_cost);
+  EXPECT_DOUBLE_EQ(0.5, cache.HitRatio());
+
+  // a hit is kept for the frame after
+  cache.BeginFrame(shifted_reference_line, {0.0, 0.0}, MakeSLPoint(20.0, 0.0),
+                   shifted_obstacles);
+  EXPECT_TRUE(
+      cache.Lookup(MakeSLPoint(30.0, 0.5), MakeSLPoint(50.0, 0.0), &cost));
+}
+
+TEST_F(DpRoadGraphCacheTest, ChangedObstacle) {
+  DpRoadGraphCache cache;
+  ComparableCost cost;
+  cache.BeginFrame(*reference_line_, {0.0, 0.0}, MakeSLPoint(10.0, 0.0),
+                   obstacles_);
+  cache.Insert(MakeSLPoint(20.0, 0.5), MakeSLPoint(40.0, 0.0), cost_);
+  cache.Insert(MakeSLPoint(40.0, 0.5), MakeSLPoint(60.0, 0.0), cost_);
+
+  // the obstacle moved, so only the edges beyond it are reused
+  std::vector<SLBoundary> moved_obstacles = obstacles_;
+  moved_obstacles[0].set_start_l(0.5);
+  cache.BeginFrame(*reference_line_, {0.0, 0.0}, MakeSLPoint(10.0, 0.0),
+                   moved_obstacles);
+  EXPECT_FALSE(
+      cache.Lookup(MakeSLPoint(20.0, 0.5), MakeSLPoint(40.0, 0.0), &cost));
+  EXPECT_TRUE(
+      cache.Lookup(MakeSLPoint(40.0, 0.5), MakeSLPoint(60.0, 0.0), &cost));
+}
+
+TEST_F(DpRoadGraphCacheTest, ChangedInitPoint) {
+  DpRoadGraphCache cache;
+  ComparableCost cost;
+  cache.BeginFrame(*reference_line_, {0.0, 0.0}, MakeSLPoint(10.0, 0.0),
+                   obstacles_);
+  cache.Insert(MakeSLPoint(40.0, 0.5), MakeSLPoint(60.0, 0.0), cost_);
+
+  // the off road check depends on the l of the init point
+  cache.BeginFrame(*reference_line_, {0.0, 0.3}, MakeSLPoint(10.0, 0.3),
+                   obstacles_);
+  EXPECT_FALSE(
+      cache.Lookup(MakeSLPoint(40.0, 0.5), MakeSLPoint(60.0, 0.0), &cost));
+}
+
+}  // namespace planning
+}  // namespace apollo
@@ -106,9 +106,11 @@ TrajectoryCost::TrajectoryCost(const DpPolyPathConfig &config,
   }
 }
 
+constexpr double TrajectoryCost::kOffRoadIgnoreDistance;
+
 ComparableCost TrajectoryCost::CalculatePathCost(
     const QuinticPolynomialCurve1d &curve, const double start_s,
-    const double end_s, const uint32_t curr_level, const uint32_t total_level) {
+    const double end_s) {
   ComparableCost cost;
   double path_cost = 0.0;
   std::function<double(const double)> quasi_softmax = [this](const double x) {
@@ -135,21 +137,27 @@ ComparableCost TrajectoryCost::CalculatePathCost(
     path_cost += ddl * ddl * config_.path_ddl_cost();
   }
   path_cost *= config_.path_resolution();
+  cost.smoothness_cost = path_cost;
+  return cost;
+}
 
+ComparableCost TrajectoryCost::CalculatePathEndCost(
+    const QuinticPolynomialCurve1d &curve, const double start_s,
+    const double end_s, const uint32_t curr_level,
+    const uint32_t total_level) const {
+  ComparableCost cost;
   if (curr_level == total_level) {
     const double end_l = curve.Evaluate(0, end_s - start_s);
-    path_cost +=
+    cost.smoothness_cost =
         std::sqrt(end_l - init_sl_point_.l() / 2.0) * config_.path_end_l_cost();
   }
-  cost.smoothness_cost = path_cost;
   return cost;
 }
 
 bool TrajectoryCost::IsOffRoad(const double ref_s, const double l,
                                const double dl,
                                const bool is_change_lane_path) {
-  constexpr double kIgnoreDistance = 5.0;
-  if (ref_s - init_sl_point_.s() < kIgnoreDistance) {
+  if (ref_s - init_sl_point_.s() < kOffRoadIgnoreDistance) {
     return false;
   }
   Vec2d rear_center(0.0, l);
@@ -331,17 +339,34 @@ ComparableCost TrajectoryCost::Calculate(const QuinticPolynomialCurve1d &curve,
                                          const double end_s,
                                          const uint32_t curr_level,
                                          const uint32_t total_level) {
-  ComparableCost total_cost;
-  // path cost
+  ComparableCost total_cost = CalculateStaticCost(curve, start_s, end_s);
   total_cost +=
-      CalculatePathCost(curve, start_s, end_s, curr_level, total_level);
+      CalculateFrameCost(curve, start_s, end_s, curr_level, total_level);
+  return total_cost;
+}
+
+ComparableCost TrajectoryCost::CalculateStaticCost(
+    const QuinticPolynomialCurve1d &curve, const double start_s,
+    const double end_s) {
+  ComparableCost static_cost;
+  // path cost
+  static_cost += CalculatePathCost(curve, start_s, end_s);
 
   // static obstacle cost
-  total_cost += CalculateStaticObstacleCost(curve, start_s, end_s);
+  static_cost += CalculateStaticObstacleCost(curve, start_s, end_s);
+  return static_cost;
+}
+
+ComparableCost TrajectoryCost::CalculateFrameCost(
+    const QuinticPolynomialCurve1d &curve, const double start_s,
+    const double end_s, const uint32_t curr_level,
+    const uint32_t total_level) const {
+  ComparableCost frame_cost =
+      CalculatePathEndCost(curve, start_s, end_s, curr_level, total_level);
 
   // dynamic obstacle cost
-  total_cost += CalculateDynamicObstacleCost(curve, start_s, end_s);
-  return total_cost;
+  frame_cost += CalculateDynamicObstacleCost(curve, start_s, end_s);
+  return frame_cost;
 }
 
 }  // namespace planning
@@ -52,11 +52,37 @@ class TrajectoryCost {
                            const uint32_t curr_level,
                            const uint32_t total_level);
 
+  /**
+   * @brief The part of Calculate() that only depends on the curve, the lane
+   *        geometry and the static obstacles, so it can be reused across
+   *        frames as long as those did not change.
+   */
+  ComparableCost CalculateStaticCost(const QuinticPolynomialCurve1d &curve,
+                                     const double start_s, const double end_s);
+
+  /**
+   * @brief The rest of Calculate(), which depends on the init point and the
+   *        predicted obstacles of the current frame.
+   */
+  ComparableCost CalculateFrameCost(const QuinticPolynomialCurve1d &curve,
+                                    const double start_s, const double end_s,
+                                    const uint32_t curr_level,
+                                    const uint32_t total_level) const;
+
+  const std::vector<SLBoundary> &static_obstacle_sl_boundaries() const {
+    return static_obstacle_sl_boundaries_;
+  }
+
+  // off road check is skipped this close ahead of the init point
+  static constexpr double kOffRoadIgnoreDistance = 5.0;
+
  private:
   ComparableCost CalculatePathCost(const QuinticPolynomialCurve1d &curve,
-                                   const double start_s, const double end_s,
-                                   const uint32_t curr_level,
-                                   const uint32_t total_level);
+                                   const double start_s, const double end_s);
+  ComparableCost CalculatePathEndCost(const QuinticPolynomialCurve1d &curve,
+                                      const double start_s, const double end_s,
+                                      const uint32_t curr_level,
+                                      const uint32_t total_level) const;
   ComparableCost CalculateStaticObstacleCost(
       const QuinticPolynomialCurve1d &curve, const double start_s,
       const double end_s);
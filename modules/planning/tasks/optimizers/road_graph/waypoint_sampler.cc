@@ -20,6 +20,7 @@
 
 #include "modules/planning/tasks/optimizers/road_graph/waypoint_sampler.h"
 
+#include <mutex>
 #include <utility>
 
 #include "cyber/common/log.h"
@@ -31,6 +32,7 @@
 #include "modules/planning/common/path/frenet_frame_path.h"
 #include "modules/planning/common/planning_context.h"
 #include "modules/planning/common/planning_gflags.h"
+#include "modules/planning/common/sampling_density.h"
 
 namespace apollo {
 namespace planning {
@@ -60,9 +62,12 @@ bool WaypointSampler::SamplePathWaypoints(
   const auto &vehicle_config =
       common::VehicleConfigHelper::Instance()->GetConfig();
   const double half_adc_width = vehicle_config.vehicle_param().width() / 2.0;
-  const double num_sample_per_level =
+  // at least three samples keep both sides and the middle of the lane
+  constexpr uint32_t kMinSampleNumEachLevel = 3;
+  const double num_sample_per_level = SamplingDensity::ScaleCount(
       FLAGS_use_navigation_mode ? config_.navigator_sample_num_each_level()
-                                : config_.sample_points_num_each_level();
+                                : config_.sample_points_num_each_level(),
+      density_scale_, kMinSampleNumEachLevel);
 
   constexpr double kSamplePointLookForwardTime = 4.0;
   const double level_distance =
@@ -72,6 +77,7 @@ bool WaypointSampler::SamplePathWaypoints(
   double accumulated_s = init_sl_point_.s();
   double prev_s = accumulated_s;
 
+  std::unique_lock<std::mutex> context_lock(PlanningContext::Mutex());
   auto *status = PlanningContext::MutablePlanningStatus();
   if (!status->has_pull_over() && status->pull_over().in_pull_over()) {
     status->mutable_pull_over()->set_status(PullOverStatus::IN_OPERATION);
@@ -96,6 +102,7 @@ bool WaypointSampler::SamplePathWaypoints(
       return true;
     }
   }
+  context_lock.unlock();
 
   constexpr size_t kNumLevel = 3;
   for (size_t i = 0; i < kNumLevel && accumulated_s < total_length; ++i) {
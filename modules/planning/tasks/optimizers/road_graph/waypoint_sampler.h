@@ -52,6 +52,13 @@ class WaypointSampler {
     planning_debug_ = debug;
   }
 
+  /**
+   * @brief Sets the scale of the configured samples of each level.
+   */
+  void SetDensityScale(const double density_scale) {
+    density_scale_ = density_scale;
+  }
+
   virtual bool SamplePathWaypoints(
       const common::TrajectoryPoint &init_point,
       std::vector<std::vector<common::SLPoint>> *const points);
@@ -62,6 +69,7 @@ class WaypointSampler {
   common::SLPoint init_sl_point_;
   common::FrenetFramePoint init_frenet_frame_point_;
   apollo::planning_internal::Debug *planning_debug_ = nullptr;
+  double density_scale_ = 1.0;
 
   ObjectSidePass sidepass_;
 };
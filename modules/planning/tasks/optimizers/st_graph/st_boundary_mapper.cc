@@ -51,6 +51,11 @@ using apollo::common::util::StrCat;
 namespace {
 constexpr double boundary_t_buffer = 0.1;
 constexpr double boundary_s_buffer = 1.0;
+// the number of path corridor samples bounded together
+constexpr size_t kCorridorChunkSize = 8;
+// the path is down sampled to about this number of points for the predicted
+// obstacles
+constexpr int kDefaultNumPoint = 50;
 }  // namespace
 
 StBoundaryMapper::StBoundaryMapper(const SLBoundary& adc_sl_boundary,
@@ -67,7 +72,87 @@ StBoundaryMapper::StBoundaryMapper(const SLBoundary& adc_sl_boundary,
       vehicle_param_(common::VehicleConfigHelper::GetConfig().vehicle_param()),
       planning_distance_(planning_distance),
       planning_time_(planning_time),
-      is_change_lane_(is_change_lane) {}
+      is_change_lane_(is_change_lane) {
+  BuildPathCorridor();
+}
+
+void StBoundaryMapper::BuildPathCorridor() {
+  const auto& path_points = path_data_.discretized_path();
+  if (path_points.empty()) {
+    return;
+  }
+  if (path_points.size() > 2 * kDefaultNumPoint) {
+    const auto ratio = path_points.size() / kDefaultNumPoint;
+    std::vector<PathPoint> sampled_path_points;
+    for (size_t i = 0; i < path_points.size(); ++i) {
+      if (i % ratio == 0) {
+        sampled_path_points.push_back(path_points[i]);
+      }
+    }
+    corridor_path_ = DiscretizedPath(sampled_path_points);
+  } else {
+    corridor_path_ = DiscretizedPath(path_points);
+  }
+
+  const double step_length = vehicle_param_.front_edge_to_center();
+  const double path_len =
+      std::min(FLAGS_max_trajectory_len, corridor_path_.Length());
+  for (double path_s = 0.0; path_s < path_len; path_s += step_length) {
+    corridor_s_.push_back(path_s);
+    corridor_adc_boxes_.push_back(
+        GetAdcBox(corridor_path_.Evaluate(path_s + corridor_path_.front().s()),
+                  st_boundary_config_.boundary_buffer()));
+  }
+
+  for (size_t i = 0; i < corridor_adc_boxes_.size(); i += kCorridorChunkSize) {
+    double min_x = std::numeric_limits<double>::infinity();
+    double max_x = -std::numeric_limits<double>::infinity();
+    double min_y = std::numeric_limits<double>::infinity();
+    double max_y = -std::numeric_limits<double>::infinity();
+    const size_t end =
+        std::min(i + kCorridorChunkSize, corridor_adc_boxes_.size());
+    for (size_t j = i; j < end; ++j) {
+      min_x = std::min(min_x, corridor_adc_boxes_[j].min_x());
+      max_x = std::max(max_x, corridor_adc_boxes_[j].max_x());
+      min_y = std::min(min_y, corridor_adc_boxes_[j].min_y());
+      max_y = std::max(max_y, corridor_adc_boxes_[j].max_y());
+    }
+    corridor_chunk_min_x_.push_back(min_x);
+    corridor_chunk_max_x_.push_back(max_x);
+    corridor_chunk_min_y_.push_back(min_y);
+    corridor_chunk_max_y_.push_back(max_y);
+  }
+}
+
+int StBoundaryMapper::GetFirstOverlapIndex(const Box2d& obs_box) const {
+  // tests all the chunk bounds in a branch free loop first
+  const size_t num_chunks = corridor_chunk_min_x_.size();
+  std::vector<char> is_chunk_reachable(num_chunks);
+  const double obs_min_x = obs_box.min_x();
+  const double obs_max_x = obs_box.max_x();
+  const double obs_min_y = obs_box.min_y();
+  const double obs_max_y = obs_box.max_y();
+  for (size_t i = 0; i < num_chunks; ++i) {
+    is_chunk_reachable[i] = (corridor_chunk_min_x_[i] <= obs_max_x) &
+                            (corridor_chunk_max_x_[i] >= obs_min_x) &
+                            (corridor_chunk_min_y_[i] <= obs_max_y) &
+                            (corridor_chunk_max_y_[i] >= obs_min_y);
+  }
+  for (size_t i = 0; i < num_chunks; ++i) {
+    if (!is_chunk_reachable[i]) {
+      continue;
+    }
+    const size_t begin = i * kCorridorChunkSize;
+    const size_t end =
+        std::min(begin + kCorridorChunkSize, corridor_adc_boxes_.size());
+    for (size_t j = begin; j < end; ++j) {
+      if (obs_box.HasOverlap(corridor_adc_boxes_[j])) {
+        return static_cast<int>(j);
+      }
+    }
+  }
+  return -1;
+}
 
 Status StBoundaryMapper::CreateStBoundary(PathDecision* path_decision) const {
   const auto& obstacles = path_decision->obstacles();
@@ -311,8 +396,7 @@ Status StBoundaryMapper::MapWithoutDecision(Obstacle* obstacle) const {
   std::vector<STPoint> lower_points;
   std::vector<STPoint> upper_points;
 
-  if (!GetOverlapBoundaryPoints(path_data_.discretized_path(), *obstacle,
-                                &upper_points, &lower_points)) {
+  if (!GetOverlapBoundaryPoints(*obstacle, &upper_points, &lower_points)) {
     return Status::OK();
   }
 
@@ -333,9 +417,9 @@ Status StBoundaryMapper::MapWithoutDecision(Obstacle* obstacle) const {
 }
 
 bool StBoundaryMapper::GetOverlapBoundaryPoints(
-    const std::vector<PathPoint>& path_points, const Obstacle& obstacle,
-    std::vector<STPoint>* upper_points,
+    const Obstacle& obstacle, std::vector<STPoint>* upper_points,
     std::vector<STPoint>* lower_points) const {
+  const auto& path_points = path_data_.discretized_path();
   DCHECK_NOTNULL(upper_points);
   DCHECK_NOTNULL(lower_points);
   DCHECK(upper_points->empty());
@@ -378,23 +462,9 @@ bool StBoundaryMapper::GetOverlapBoundaryPoints(
       }
     }
   } else {
-    const int default_num_point = 50;
-    DiscretizedPath discretized_path;
-    if (path_points.size() > 2 * default_num_point) {
-      const auto ratio = path_points.size() / default_num_point;
-      std::vector<PathPoint> sampled_path_points;
-      for (size_t i = 0; i < path_points.size(); ++i) {
-        if (i % ratio == 0) {
-          sampled_path_points.push_back(path_points[i]);
-        }
-      }
-      discretized_path = DiscretizedPath(sampled_path_points);
-    } else {
-      discretized_path = DiscretizedPath(path_points);
-    }
+    const DiscretizedPath& discretized_path = corridor_path_;
     for (int i = 0; i < trajectory.trajectory_point_size(); ++i) {
       const auto& trajectory_point = trajectory.trajectory_point(i);
-      const Box2d obs_box = obstacle.GetBoundingBox(trajectory_point);
 
       double trajectory_point_time = trajectory_point.relative_time();
       constexpr double kNegtiveTimeThreshold = -1.0;
@@ -402,65 +472,61 @@ bool StBoundaryMapper::GetOverlapBoundaryPoints(
         continue;
       }
 
+      const Box2d obs_box = obstacle.GetBoundingBox(trajectory_point);
+      const int overlap_index = GetFirstOverlapIndex(obs_box);
+      if (overlap_index < 0) {
+        continue;
+      }
+      // found overlap, start searching with higher resolution
+      const double path_s = corridor_s_[overlap_index];
       const double step_length = vehicle_param_.front_edge_to_center();
-      auto path_len =
-          std::min(FLAGS_max_trajectory_len, discretized_path.Length());
-      for (double path_s = 0.0; path_s < path_len; path_s += step_length) {
-        const auto curr_adc_path_point =
-            discretized_path.Evaluate(path_s + discretized_path.front().s());
-        if (CheckOverlap(curr_adc_path_point, obs_box,
-                         st_boundary_config_.boundary_buffer())) {
-          // found overlap, start searching with higher resolution
-          const double backward_distance = -step_length;
-          const double forward_distance = vehicle_param_.length() +
-                                          vehicle_param_.width() +
-                                          obs_box.length() + obs_box.width();
-          const double default_min_step = 0.1;  // in meters
-          const double fine_tuning_step_length = std::fmin(
-              default_min_step, discretized_path.Length() / default_num_point);
-
-          bool find_low = false;
-          bool find_high = false;
-          double low_s = std::fmax(0.0, path_s + backward_distance);
-          double high_s =
-              std::fmin(discretized_path.Length(), path_s + forward_distance);
-
-          while (low_s < high_s) {
-            if (find_low && find_high) {
-              break;
-            }
-            if (!find_low) {
-              const auto& point_low = discretized_path.Evaluate(
-                  low_s + discretized_path.front().s());
-              if (!CheckOverlap(point_low, obs_box,
-                                st_boundary_config_.boundary_buffer())) {
-                low_s += fine_tuning_step_length;
-              } else {
-                find_low = true;
-              }
-            }
-            if (!find_high) {
-              const auto& point_high = discretized_path.Evaluate(
-                  high_s + discretized_path.front().s());
-              if (!CheckOverlap(point_high, obs_box,
-                                st_boundary_config_.boundary_buffer())) {
-                high_s -= fine_tuning_step_length;
-              } else {
-                find_high = true;
-              }
-            }
+      const double backward_distance = -step_length;
+      const double forward_distance = vehicle_param_.length() +
+                                      vehicle_param_.width() +
+                                      obs_box.length() + obs_box.width();
+      const double default_min_step = 0.1;  // in meters
+      const double fine_tuning_step_length = std::fmin(
+          default_min_step, discretized_path.Length() / kDefaultNumPoint);
+
+      bool find_low = false;
+      bool find_high = false;
+      double low_s = std::fmax(0.0, path_s + backward_distance);
+      double high_s =
+          std::fmin(discretized_path.Length(), path_s + forward_distance);
+
+      while (low_s < high_s) {
+        if (find_low && find_high) {
+          break;
+        }
+        if (!find_low) {
+          const auto& point_low =
+              discretized_path.Evaluate(low_s + discretized_path.front().s());
+          if (!CheckOverlap(point_low, obs_box,
+                            st_boundary_config_.boundary_buffer())) {
+            low_s += fine_tuning_step_length;
+          } else {
+            find_low = true;
           }
-          if (find_high && find_low) {
-            lower_points->emplace_back(
-                low_s - st_boundary_config_.point_extension(),
-                trajectory_point_time);
-            upper_points->emplace_back(
-                high_s + st_boundary_config_.point_extension(),
-                trajectory_point_time);
+        }
+        if (!find_high) {
+          const auto& point_high =
+              discretized_path.Evaluate(high_s + discretized_path.front().s());
+          if (!CheckOverlap(point_high, obs_box,
+                            st_boundary_config_.boundary_buffer())) {
+            high_s -= fine_tuning_step_length;
+          } else {
+            find_high = true;
           }
-          break;
         }
       }
+      if (find_high && find_low) {
+        lower_points->emplace_back(
+            low_s - st_boundary_config_.point_extension(),
+            trajectory_point_time);
+        upper_points->emplace_back(
+            high_s + st_boundary_config_.point_extension(),
+            trajectory_point_time);
+      }
     }
   }
   DCHECK_EQ(lower_points->size(), upper_points->size());
@@ -477,8 +543,7 @@ Status StBoundaryMapper::MapWithDecision(
   std::vector<STPoint> lower_points;
   std::vector<STPoint> upper_points;
 
-  if (!GetOverlapBoundaryPoints(path_data_.discretized_path(), *obstacle,
-                                &upper_points, &lower_points)) {
+  if (!GetOverlapBoundaryPoints(*obstacle, &upper_points, &lower_points)) {
     return Status::OK();
   }
 
@@ -528,6 +593,11 @@ Status StBoundaryMapper::MapWithDecision(
 bool StBoundaryMapper::CheckOverlap(const PathPoint& path_point,
                                     const Box2d& obs_box,
                                     const double buffer) const {
+  return obs_box.HasOverlap(GetAdcBox(path_point, buffer));
+}
+
+Box2d StBoundaryMapper::GetAdcBox(const PathPoint& path_point,
+                                  const double buffer) const {
   double left_delta_l = 0.0;
   double right_delta_l = 0.0;
   if (is_change_lane_) {
@@ -549,10 +619,8 @@ bool StBoundaryMapper::CheckOverlap(const PathPoint& path_point,
           .rotate(path_point.theta());
   Vec2d center = Vec2d(path_point.x(), path_point.y()) + vec_to_center;
 
-  const Box2d adc_box =
-      Box2d(center, path_point.theta(), vehicle_param_.length() + 2 * buffer,
-            vehicle_param_.width() + 2 * buffer);
-  return obs_box.HasOverlap(adc_box);
+  return Box2d(center, path_point.theta(), vehicle_param_.length() + 2 * buffer,
+               vehicle_param_.width() + 2 * buffer);
 }
 
 }  // namespace planning
@@ -26,7 +26,9 @@
 #include "modules/common/configs/proto/vehicle_config.pb.h"
 #include "modules/planning/proto/st_boundary_config.pb.h"
 
+#include "modules/common/math/box2d.h"
 #include "modules/common/status/status.h"
+#include "modules/planning/common/path/discretized_path.h"
 #include "modules/planning/common/path/path_data.h"
 #include "modules/planning/common/path_decision.h"
 #include "modules/planning/common/speed/st_boundary.h"
@@ -61,15 +63,30 @@ class StBoundaryMapper {
                     const apollo::common::math::Box2d& obs_box,
                     const double buffer) const;
 
+  apollo::common::math::Box2d GetAdcBox(
+      const apollo::common::PathPoint& path_point, const double buffer) const;
+
+  /**
+   * Samples the path checked against the predicted obstacles, and precomputes
+   * the adc boxes along it.
+   */
+  void BuildPathCorridor();
+
   /**
-   * Creates valid st boundary upper_points and lower_points
+   * Gets the index of the first sample of the path corridor whose adc box
+   * overlaps "obs_box", or -1 if there is none.
+   */
+  int GetFirstOverlapIndex(const apollo::common::math::Box2d& obs_box) const;
+
+  /**
+   * Creates valid st boundary upper_points and lower_points of the obstacle
+   * on the discretized path of path_data_.
    * If return true, upper_points.size() > 1 and
    * upper_points.size() = lower_points.size()
    */
-  bool GetOverlapBoundaryPoints(
-      const std::vector<apollo::common::PathPoint>& path_points,
-      const Obstacle& obstacle, std::vector<STPoint>* upper_points,
-      std::vector<STPoint>* lower_points) const;
+  bool GetOverlapBoundaryPoints(const Obstacle& obstacle,
+                                std::vector<STPoint>* upper_points,
+                                std::vector<STPoint>* lower_points) const;
 
   apollo::common::Status MapWithoutDecision(Obstacle* obstacle) const;
 
@@ -88,6 +105,18 @@ class StBoundaryMapper {
   const double planning_distance_;
   const double planning_time_;
   bool is_change_lane_ = false;
+
+  // The discretized path down sampled for the predicted obstacles, and its
+  // samples every front_edge_to_center with their adc boxes. The axis aligned
+  // bounds of every kCorridorChunkSize samples are kept in flat arrays, so
+  // that the chunks out of reach of an obstacle box are skipped in one pass.
+  DiscretizedPath corridor_path_;
+  std::vector<double> corridor_s_;
+  std::vector<apollo::common::math::Box2d> corridor_adc_boxes_;
+  std::vector<double> corridor_chunk_min_x_;
+  std::vector<double> corridor_chunk_max_x_;
+  std::vector<double> corridor_chunk_min_y_;
+  std::vector<double> corridor_chunk_max_y_;
 };
 
 }  // namespace planning
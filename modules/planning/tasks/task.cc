@@ -22,10 +22,18 @@
 
 #include "modules/planning/proto/planning_config.pb.h"
 
+#include "cyber/common/log.h"
+#include "modules/common/monitor_log/monitor_log_buffer.h"
+#include "modules/common/time/time.h"
+#include "modules/common/util/string_util.h"
+
 namespace apollo {
 namespace planning {
 
 using apollo::common::Status;
+using apollo::common::monitor::MonitorLogBuffer;
+using apollo::common::monitor::MonitorMessageItem;
+using apollo::common::time::Clock;
 
 Task::Task(const TaskConfig& config) : config_(config) {
   name_ = TaskConfig::TaskType_Name(config_.task_type());
@@ -39,5 +47,39 @@ Status Task::Execute(Frame* frame, ReferenceLineInfo* reference_line_info) {
   return Status::OK();
 }
 
+Status Task::ExecuteWithinBudget(Frame* frame,
+                                 ReferenceLineInfo* reference_line_info,
+                                 TaskStats* task_stats) {
+  CHECK_NOTNULL(task_stats);
+  task_stats->set_name(name_);
+  if (skip_next_run_) {
+    skip_next_run_ = false;
+    ADEBUG << "Skip task[" << name_ << "] after a run over budget.";
+    task_stats->set_time_ms(0.0);
+    task_stats->set_skipped(true);
+    task_stats->set_num_over_budget(num_over_budget_);
+    return Status::OK();
+  }
+
+  const double start_timestamp = Clock::NowInSeconds();
+  const auto ret = Execute(frame, reference_line_info);
+  const double time_ms = (Clock::NowInSeconds() - start_timestamp) * 1000.0;
+  task_stats->set_time_ms(time_ms);
+
+  if (config_.has_latency_budget_ms() &&
+      time_ms > config_.latency_budget_ms()) {
+    ++num_over_budget_;
+    task_stats->set_over_budget(true);
+    skip_next_run_ = config_.latency_fallback() == TaskConfig::SKIP_NEXT_RUN;
+    const std::string msg = common::util::StrCat(
+        "Task ", name_, " took ", time_ms, " ms, over its budget of ",
+        config_.latency_budget_ms(), " ms, ", num_over_budget_, " times.");
+    AWARN << msg;
+    MonitorLogBuffer(MonitorMessageItem::PLANNING).WARN(msg);
+  }
+  task_stats->set_num_over_budget(num_over_budget_);
+  return ret;
+}
+
 }  // namespace planning
 }  // namespace apollo
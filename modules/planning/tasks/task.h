@@ -22,6 +22,7 @@
 
 #include <string>
 
+#include "modules/planning/proto/planning.pb.h"
 #include "modules/planning/proto/planning_config.pb.h"
 
 #include "modules/common/status/status.h"
@@ -46,12 +47,26 @@ class Task {
   virtual apollo::common::Status Execute(
       Frame* frame, ReferenceLineInfo* reference_line_info);
 
+  /**
+   * @brief Runs Execute and checks the run time against the latency budget
+   * of the task config. A run over the budget is counted and reported to the
+   * monitor, and the next run is skipped if the config asks for it.
+   * @param task_stats the time and the budget state of this run.
+   */
+  apollo::common::Status ExecuteWithinBudget(
+      Frame* frame, ReferenceLineInfo* reference_line_info,
+      TaskStats* task_stats);
+
  protected:
   Frame* frame_ = nullptr;
   ReferenceLineInfo* reference_line_info_ = nullptr;
 
   TaskConfig config_;
   std::string name_;
+
+ private:
+  uint32_t num_over_budget_ = 0;
+  bool skip_next_run_ = false;
 };
 
 }  // namespace planning
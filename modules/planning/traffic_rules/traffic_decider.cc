@@ -87,6 +87,19 @@ bool TrafficDecider::Init(const TrafficRuleConfigs &config) {
     RegisterRules();
   }
   rule_configs_ = config;
+  rules_.clear();
+  for (const auto &rule_config : rule_configs_.config()) {
+    if (!rule_config.enabled()) {
+      ADEBUG << "Rule " << rule_config.rule_id() << " not enabled";
+      continue;
+    }
+    auto rule = s_rule_factory.CreateObject(rule_config.rule_id(), rule_config);
+    if (!rule) {
+      AERROR << "Could not find rule " << rule_config.DebugString();
+      continue;
+    }
+    rules_.push_back(std::move(rule));
+  }
   return true;
 }
 
@@ -136,19 +149,9 @@ Status TrafficDecider::Execute(Frame *frame,
   CHECK_NOTNULL(frame);
   CHECK_NOTNULL(reference_line_info);
 
-  for (const auto &rule_config : rule_configs_.config()) {
-    if (!rule_config.enabled()) {
-      ADEBUG << "Rule " << rule_config.rule_id() << " not enabled";
-      continue;
-    }
-    auto rule = s_rule_factory.CreateObject(rule_config.rule_id(), rule_config);
-    if (!rule) {
-      AERROR << "Could not find rule " << rule_config.DebugString();
-      continue;
-    }
+  for (const auto &rule : rules_) {
     rule->ApplyRule(frame, reference_line_info);
-    ADEBUG << "Applied rule "
-           << TrafficRuleConfig::RuleId_Name(rule_config.rule_id());
+    ADEBUG << "Applied rule " << TrafficRuleConfig::RuleId_Name(rule->Id());
   }
 
   BuildPlanningTarget(reference_line_info);
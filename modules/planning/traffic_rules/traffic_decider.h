@@ -20,6 +20,9 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "modules/common/proto/pnc_point.pb.h"
 #include "modules/planning/proto/traffic_rule_config.pb.h"
 
@@ -44,6 +47,10 @@ namespace planning {
 class TrafficDecider {
  public:
   TrafficDecider() = default;
+  /**
+   * @brief creates the enabled rules once, so that a decider kept across
+   * planning cycles reuses them for every frame and reference line.
+   */
   bool Init(const TrafficRuleConfigs &config);
   virtual ~TrafficDecider() = default;
   apollo::common::Status Execute(Frame *frame,
@@ -59,6 +66,7 @@ class TrafficDecider {
   void BuildPlanningTarget(ReferenceLineInfo *reference_line_info);
 
   TrafficRuleConfigs rule_configs_;
+  std::vector<std::unique_ptr<TrafficRule>> rules_;
 };
 
 }  // namespace planning
@@ -24,6 +24,7 @@
 namespace apollo {
 namespace prediction {
 
+std::string FeatureOutput::file_tag_;
 Features FeatureOutput::features_;
 ListDataForLearning FeatureOutput::list_data_for_learning_;
 ListPredictionResult FeatureOutput::list_prediction_result_;
@@ -59,6 +60,17 @@ bool FeatureOutput::Ready() {
   return true;
 }
 
+void FeatureOutput::SetFileTag(const std::string& tag) { file_tag_ = tag; }
+
+std::string FeatureOutput::FileName(const std::string& prefix,
+                                    const std::size_t idx) {
+  std::string file_name = FLAGS_prediction_data_dir + "/" + prefix + ".";
+  if (!file_tag_.empty()) {
+    file_name += file_tag_ + ".";
+  }
+  return file_name + std::to_string(idx) + ".bin";
+}
+
 void FeatureOutput::InsertFeatureProto(const Feature& feature) {
   features_.add_feature()->CopyFrom(feature);
 }
@@ -94,9 +106,7 @@ void FeatureOutput::WriteFeatureProto() {
   if (features_.feature_size() <= 0) {
     ADEBUG << "Skip writing empty feature.";
   } else {
-    const std::string file_name =
-        FLAGS_prediction_data_dir + "/feature." +
-        std::to_string(idx_feature_) + ".bin";
+    const std::string file_name = FileName("feature", idx_feature_);
     cyber::common::SetProtoToBinaryFile(features_, file_name);
     features_.Clear();
     ++idx_feature_;
@@ -107,9 +117,7 @@ void FeatureOutput::WriteDataForLearning() {
   if (list_data_for_learning_.data_for_learning_size() <= 0) {
     ADEBUG << "Skip writing empty data_for_learning.";
   } else {
-    const std::string file_name =
-        FLAGS_prediction_data_dir + "/datalearn." +
-        std::to_string(idx_learning_) + ".bin";
+    const std::string file_name = FileName("datalearn", idx_learning_);
     cyber::common::SetProtoToBinaryFile(list_data_for_learning_, file_name);
     list_data_for_learning_.Clear();
     ++idx_learning_;
@@ -121,8 +129,7 @@ void FeatureOutput::WritePredictionResult() {
     ADEBUG << "Skip writing empty prediction_result.";
   } else {
     const std::string file_name =
-        FLAGS_prediction_data_dir + "/prediction_result." +
-        std::to_string(idx_prediction_result_) + ".bin";
+        FileName("prediction_result", idx_prediction_result_);
     cyber::common::SetProtoToBinaryFile(list_prediction_result_, file_name);
     list_prediction_result_.Clear();
     ++idx_prediction_result_;
@@ -47,6 +47,14 @@ class FeatureOutput {
    */
   static bool Ready();
 
+  /**
+   * @brief Set a tag inserted in the names of the written files, so that
+   *        the outputs of different records or processes do not overwrite
+   *        each other, as in feature.<tag>.0.bin
+   * @param The tag, empty for feature.0.bin
+   */
+  static void SetFileTag(const std::string& tag);
+
   /**
    * @brief Insert a feature
    * @param A feature in proto
@@ -104,6 +112,10 @@ class FeatureOutput {
   static int SizeOfPredictionResult();
 
  private:
+  static std::string FileName(const std::string& prefix, const std::size_t idx);
+
+ private:
+  static std::string file_tag_;
   static Features features_;
   static std::size_t idx_feature_;
   static ListDataForLearning list_data_for_learning_;
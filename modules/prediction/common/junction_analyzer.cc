@@ -31,33 +31,109 @@ using apollo::hdmap::LaneInfo;
 using apollo::hdmap::JunctionInfo;
 using ConstLaneInfoPtr = std::shared_ptr<const LaneInfo>;
 
-std::shared_ptr<const JunctionInfo>
-    JunctionAnalyzer::junction_info_ptr_;
-std::unordered_map<std::string, JunctionExit>
-    JunctionAnalyzer::junction_exits_;
-std::unordered_map<std::string, JunctionFeature>
-    JunctionAnalyzer::junction_features_;
+namespace {
+
+double ComputeRange(const JunctionInfo& junction_info) {
+  if (!junction_info.junction().has_polygon() ||
+      junction_info.junction().polygon().point_size() < 3) {
+    AERROR << "Junction [" << junction_info.id().id()
+           << "] has not enough polygon points to compute range";
+    return FLAGS_defualt_junction_range;
+  }
+  double x_min = std::numeric_limits<double>::infinity();
+  double x_max = -std::numeric_limits<double>::infinity();
+  double y_min = std::numeric_limits<double>::infinity();
+  double y_max = -std::numeric_limits<double>::infinity();
+  for (const auto& point : junction_info.junction().polygon().point()) {
+    x_min = std::min(x_min, point.x());
+    x_max = std::max(x_max, point.x());
+    y_min = std::min(y_min, point.y());
+    y_max = std::max(y_max, point.y());
+  }
+  double dx = std::abs(x_max - x_min);
+  double dy = std::abs(y_max - y_min);
+  double range = std::sqrt(dx * dx + dy * dy);
+  return range;
+}
+
+}  // namespace
+
+std::unordered_map<std::string, JunctionAnalyzer::JunctionCache>
+    JunctionAnalyzer::junction_caches_;
+JunctionAnalyzer::JunctionCache* JunctionAnalyzer::junction_cache_ = nullptr;
 
 void JunctionAnalyzer::Init(const std::string& junction_id) {
-  if (junction_info_ptr_ != nullptr &&
-      junction_info_ptr_->id().id() == junction_id) {
+  if (junction_cache_ != nullptr &&
+      junction_cache_->junction_info_ptr->id().id() == junction_id) {
     return;
   }
-  Clear();
-  junction_info_ptr_ = PredictionMap::JunctionById(junction_id);
-  SetAllJunctionExits();
+  junction_cache_ = GetJunctionCache(junction_id);
+}
+
+void JunctionAnalyzer::PrecomputeAllJunctions() {
+  for (const auto& junction_info_ptr : PredictionMap::AllJunctions()) {
+    JunctionCache* junction_cache =
+        GetJunctionCache(junction_info_ptr->id().id());
+    if (junction_cache == nullptr) {
+      continue;
+    }
+    // Obstacles in a junction start from the lanes overlapping it or from
+    // the lanes leading into them
+    std::unordered_set<std::string> start_lane_ids;
+    for (const auto& overlap_id : junction_info_ptr->junction().overlap_id()) {
+      auto overlap_info_ptr = PredictionMap::OverlapById(overlap_id.id());
+      if (overlap_info_ptr == nullptr) {
+        continue;
+      }
+      for (const auto& object : overlap_info_ptr->overlap().object()) {
+        if (!object.has_lane_overlap_info()) {
+          continue;
+        }
+        auto lane_info_ptr = PredictionMap::LaneById(object.id().id());
+        if (lane_info_ptr == nullptr) {
+          continue;
+        }
+        start_lane_ids.insert(object.id().id());
+        for (const auto& pred_lane_id :
+             lane_info_ptr->lane().predecessor_id()) {
+          start_lane_ids.insert(pred_lane_id.id());
+        }
+      }
+    }
+    for (const std::string& start_lane_id : start_lane_ids) {
+      GetJunctionFeature(junction_cache, start_lane_id);
+    }
+  }
+  ADEBUG << "Precomputed " << junction_caches_.size() << " junctions.";
 }
 
 void JunctionAnalyzer::Clear() {
   // Clear all data
-  junction_info_ptr_ = nullptr;
-  junction_exits_.clear();
-  junction_features_.clear();
+  junction_cache_ = nullptr;
+  junction_caches_.clear();
+}
+
+JunctionAnalyzer::JunctionCache* JunctionAnalyzer::GetJunctionCache(
+    const std::string& junction_id) {
+  auto iter = junction_caches_.find(junction_id);
+  if (iter != junction_caches_.end()) {
+    return &iter->second;
+  }
+  auto junction_info_ptr = PredictionMap::JunctionById(junction_id);
+  if (junction_info_ptr == nullptr) {
+    AERROR << "Junction [" << junction_id << "] is not in the map";
+    return nullptr;
+  }
+  JunctionCache* junction_cache = &junction_caches_[junction_id];
+  junction_cache->junction_info_ptr = junction_info_ptr;
+  junction_cache->junction_range = ComputeRange(*junction_info_ptr);
+  SetAllJunctionExits(junction_cache);
+  return junction_cache;
 }
 
-void JunctionAnalyzer::SetAllJunctionExits() {
-  CHECK_NOTNULL(junction_info_ptr_);
-  for (const auto &overlap_id : junction_info_ptr_->junction().overlap_id()) {
+void JunctionAnalyzer::SetAllJunctionExits(JunctionCache* junction_cache) {
+  const auto& junction_info_ptr = junction_cache->junction_info_ptr;
+  for (const auto &overlap_id : junction_info_ptr->junction().overlap_id()) {
     auto overlap_info_ptr = PredictionMap::OverlapById(overlap_id.id());
     if (overlap_info_ptr == nullptr) {
       continue;
@@ -77,7 +153,7 @@ void JunctionAnalyzer::SetAllJunctionExits() {
           junction_exit.set_exit_heading(lane_info_ptr->Heading(s));
           junction_exit.set_exit_width(lane_info_ptr->GetWidth(s));
           // add junction_exit to hashtable
-          junction_exits_[lane_id] = junction_exit;
+          junction_cache->junction_exits[lane_id] = junction_exit;
         }
       }
     }
@@ -85,23 +161,25 @@ void JunctionAnalyzer::SetAllJunctionExits() {
 }
 
 std::vector<JunctionExit> JunctionAnalyzer::GetJunctionExits(
-    const std::string& start_lane_id) {
+    const JunctionCache& junction_cache, const std::string& start_lane_id) {
   // TODO(hongyi) make this a gflag
   int max_search_level = 5;
 
   std::vector<JunctionExit> junction_exits;
   std::queue<std::pair<ConstLaneInfoPtr, int>> lane_info_queue;
-  lane_info_queue.emplace(PredictionMap::LaneById(start_lane_id), 0);
+  ConstLaneInfoPtr start_lane_ptr = PredictionMap::LaneById(start_lane_id);
+  if (start_lane_ptr == nullptr) {
+    return junction_exits;
+  }
+  lane_info_queue.emplace(start_lane_ptr, 0);
   while (!lane_info_queue.empty()) {
     ConstLaneInfoPtr curr_lane = lane_info_queue.front().first;
     int level = lane_info_queue.front().second;
     lane_info_queue.pop();
     const std::string& curr_lane_id = curr_lane->id().id();
-    std::unordered_set<std::string> visited_exit_lanes;
-    if (IsExitLane(curr_lane_id) &&
-        visited_exit_lanes.find(curr_lane_id) == visited_exit_lanes.end()) {
-      junction_exits.push_back(junction_exits_[curr_lane_id]);
-      visited_exit_lanes.insert(curr_lane_id);
+    auto exit_iter = junction_cache.junction_exits.find(curr_lane_id);
+    if (exit_iter != junction_cache.junction_exits.end()) {
+      junction_exits.push_back(exit_iter->second);
       continue;
     }
     if (level >= max_search_level) {
@@ -110,7 +188,9 @@ std::vector<JunctionExit> JunctionAnalyzer::GetJunctionExits(
     for (const auto& succ_lane_id : curr_lane->lane().successor_id()) {
       ConstLaneInfoPtr succ_lane_ptr =
           PredictionMap::LaneById(succ_lane_id.id());
-      lane_info_queue.emplace(succ_lane_ptr, level + 1);
+      if (succ_lane_ptr != nullptr) {
+        lane_info_queue.emplace(succ_lane_ptr, level + 1);
+      }
     }
   }
   return junction_exits;
@@ -118,21 +198,30 @@ std::vector<JunctionExit> JunctionAnalyzer::GetJunctionExits(
 
 const JunctionFeature& JunctionAnalyzer::GetJunctionFeature(
     const std::string& start_lane_id) {
-  if (junction_features_.find(start_lane_id) != junction_features_.end()) {
-    return junction_features_[start_lane_id];
+  CHECK_NOTNULL(junction_cache_);
+  return GetJunctionFeature(junction_cache_, start_lane_id);
+}
+
+const JunctionFeature& JunctionAnalyzer::GetJunctionFeature(
+    JunctionCache* junction_cache, const std::string& start_lane_id) {
+  auto iter = junction_cache->junction_features.find(start_lane_id);
+  if (iter != junction_cache->junction_features.end()) {
+    return iter->second;
   }
-  JunctionFeature junction_feature;
-  junction_feature.set_junction_id(GetJunctionId());
-  junction_feature.set_junction_range(ComputeJunctionRange());
-  std::vector<JunctionExit> junction_exits = GetJunctionExits(start_lane_id);
+  JunctionFeature& junction_feature =
+      junction_cache->junction_features[start_lane_id];
+  junction_feature.set_junction_id(
+      junction_cache->junction_info_ptr->id().id());
+  junction_feature.set_junction_range(junction_cache->junction_range);
+  std::vector<JunctionExit> junction_exits =
+      GetJunctionExits(*junction_cache, start_lane_id);
 
   for (const auto& junction_exit : junction_exits) {
     junction_feature.add_junction_exit()->CopyFrom(junction_exit);
   }
   junction_feature.mutable_enter_lane()->set_lane_id(start_lane_id);
   junction_feature.add_start_lane_id(start_lane_id);
-  junction_features_[start_lane_id] = junction_feature;
-  return junction_features_[start_lane_id];
+  return junction_feature;
 }
 
 JunctionFeature JunctionAnalyzer::GetJunctionFeature(
@@ -141,7 +230,8 @@ JunctionFeature JunctionAnalyzer::GetJunctionFeature(
   bool initialized = false;
   std::unordered_map<std::string, JunctionExit> junction_exits_map;
   for (const std::string& start_lane_id : start_lane_ids) {
-    JunctionFeature junction_feature = GetJunctionFeature(start_lane_id);
+    const JunctionFeature& junction_feature =
+        GetJunctionFeature(start_lane_id);
     if (!initialized) {
       merged_junction_feature.set_junction_id(
           junction_feature.junction_id());
@@ -163,37 +253,14 @@ JunctionFeature JunctionAnalyzer::GetJunctionFeature(
   return merged_junction_feature;
 }
 
-bool JunctionAnalyzer::IsExitLane(const std::string& lane_id) {
-  return junction_exits_.find(lane_id) != junction_exits_.end();
-}
-
 const std::string& JunctionAnalyzer::GetJunctionId() {
-  CHECK_NOTNULL(junction_info_ptr_);
-  return junction_info_ptr_->id().id();
+  CHECK_NOTNULL(junction_cache_);
+  return junction_cache_->junction_info_ptr->id().id();
 }
 
 double JunctionAnalyzer::ComputeJunctionRange() {
-  CHECK_NOTNULL(junction_info_ptr_);
-  if (!junction_info_ptr_->junction().has_polygon() ||
-      junction_info_ptr_->junction().polygon().point_size() < 3) {
-    AERROR << "Junction [" << GetJunctionId()
-           << "] has not enough polygon points to compute range";
-    return FLAGS_defualt_junction_range;
-  }
-  double x_min = std::numeric_limits<double>::infinity();
-  double x_max = -std::numeric_limits<double>::infinity();
-  double y_min = std::numeric_limits<double>::infinity();
-  double y_max = -std::numeric_limits<double>::infinity();
-  for (const auto& point : junction_info_ptr_->junction().polygon().point()) {
-    x_min = std::min(x_min, point.x());
-    x_max = std::max(x_max, point.x());
-    y_min = std::min(y_min, point.y());
-    y_max = std::max(y_max, point.y());
-  }
-  double dx = std::abs(x_max - x_min);
-  double dy = std::abs(y_max - y_min);
-  double range = std::sqrt(dx * dx + dy * dy);
-  return range;
+  CHECK_NOTNULL(junction_cache_);
+  return junction_cache_->junction_range;
 }
 
 }  // namespace prediction
@@ -35,6 +35,13 @@ class JunctionAnalyzer {
    */
   static void Init(const std::string& junction_id);
 
+  /**
+   * @brief Precompute the exits, range and junction features of every
+   *        junction in the map so that Init and GetJunctionFeature only
+   *        look them up
+   */
+  static void PrecomputeAllJunctions();
+
   /**
    * @brief Clear all stored data
    */
@@ -69,33 +76,52 @@ class JunctionAnalyzer {
       const std::vector<std::string>& start_lane_ids);
 
  private:
+  // Exits and junction features of one junction, which only depend on the map
+  struct JunctionCache {
+    std::shared_ptr<const apollo::hdmap::JunctionInfo> junction_info_ptr;
+    double junction_range = 0.0;
+    // Hashtable: exit_lane_id -> junction_exit
+    std::unordered_map<std::string, JunctionExit> junction_exits;
+    // Hashtable: start_lane_id -> junction_feature
+    std::unordered_map<std::string, JunctionFeature> junction_features;
+  };
+
   /**
-   * @brief Set all junction exits in the hashtable junction_exits_
+   * @brief Get the cache of a junction, building its exits on first use
+   * @param junction ID
+   * @return Junction cache, nullptr if the junction is not in the map
    */
-  static void SetAllJunctionExits();
+  static JunctionCache* GetJunctionCache(const std::string& junction_id);
+
+  /**
+   * @brief Set all junction exits in the hashtable junction_exits
+   * @param junction cache
+   */
+  static void SetAllJunctionExits(JunctionCache* junction_cache);
 
   /**
    * @brief Get all filtered junction exits associated to start lane ID
+   * @param junction cache
    * @param start lane ID
    * @return Filtered junction exits
    */
-  static std::vector<JunctionExit>
-  GetJunctionExits(const std::string& start_lane_id);
+  static std::vector<JunctionExit> GetJunctionExits(
+      const JunctionCache& junction_cache, const std::string& start_lane_id);
 
   /**
-   * @brief Determine if a lane with lane_id is an exit lane of this junction
-   * @param lane ID
-   * @return If a lane with lane_id is an exit lane of this junction
+   * @brief Get junction feature of a junction starting from start_lane_id
+   * @param junction cache
+   * @param start lane ID
+   * @return junction
    */
-  static bool IsExitLane(const std::string& lane_id);
+  static const JunctionFeature& GetJunctionFeature(
+      JunctionCache* junction_cache, const std::string& start_lane_id);
 
  private:
-  // junction_info pointer associated to the input junction_id
-  static std::shared_ptr<const apollo::hdmap::JunctionInfo> junction_info_ptr_;
-  // Hashtable: exit_lane_id -> junction_exit
-  static std::unordered_map<std::string, JunctionExit> junction_exits_;
-  // Hashtable: start_lane_id -> junction_feature
-  static std::unordered_map<std::string, JunctionFeature> junction_features_;
+  // Hashtable: junction_id -> junction_cache, kept until Clear
+  static std::unordered_map<std::string, JunctionCache> junction_caches_;
+  // cache of the junction set by the latest Init
+  static JunctionCache* junction_cache_;
 };
 
 }  // namespace prediction
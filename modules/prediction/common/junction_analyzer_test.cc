@@ -34,6 +34,18 @@ TEST_F(JunctionAnalyzerTest, SingleLane) {
   JunctionAnalyzer::Clear();
 }
 
+TEST_F(JunctionAnalyzerTest, Precompute) {
+  JunctionAnalyzer::PrecomputeAllJunctions();
+  JunctionAnalyzer::Init("j2");
+  EXPECT_EQ(JunctionAnalyzer::GetJunctionId(), "j2");
+  EXPECT_NEAR(JunctionAnalyzer::ComputeJunctionRange(), 74.0306, 0.001);
+  const JunctionFeature& junction_feature =
+      JunctionAnalyzer::GetJunctionFeature("l61");
+  EXPECT_EQ(&junction_feature, &JunctionAnalyzer::GetJunctionFeature("l61"));
+  EXPECT_GT(junction_feature.junction_exit_size(), 0);
+  JunctionAnalyzer::Clear();
+}
+
 TEST_F(JunctionAnalyzerTest, MultiLane) {
   JunctionAnalyzer::Init("j2");
   const JunctionFeature& merged_junction_feature =
@@ -31,6 +31,7 @@
 #include "modules/prediction/evaluator/evaluator_manager.h"
 #include "modules/prediction/predictor/predictor_manager.h"
 #include "modules/prediction/proto/offline_features.pb.h"
+#include "modules/prediction/scenario/prioritization/obstacles_prioritizer.h"
 #include "modules/prediction/scenario/scenario_manager.h"
 #include "modules/prediction/util/data_extraction.h"
 
@@ -76,6 +77,9 @@ bool MessageProcess::Init() {
     AERROR << "Map cannot be loaded.";
     return false;
   }
+  if (!FLAGS_use_navigation_mode && FLAGS_enable_junction_feature) {
+    JunctionAnalyzer::PrecomputeAllJunctions();
+  }
 
   return true;
 }
@@ -175,6 +179,10 @@ void MessageProcess::OnPerception(
   diff = end_time8 - end_time7;
   ADEBUG << "Time to predict: "
         << diff.count() * 1000 << " msec.";
+  if (FLAGS_enable_evaluation_budget) {
+    diff = end_time8 - end_time1;
+    ObstaclesPrioritizer::UpdateEvaluationBudget(diff.count() * 1000);
+  }
 
   // Get predicted obstacles
   *prediction_obstacles =
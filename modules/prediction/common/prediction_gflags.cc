@@ -31,6 +31,27 @@ DEFINE_bool(enable_trajectory_validation_check, false,
             "If check the validity of prediction trajectory.");
 DEFINE_bool(enable_tracking_adaptation, false,
             "If enable prediction tracking adaptation");
+DEFINE_bool(enable_multi_thread, false,
+            "If enabled, the obstacles of a frame are inserted, evaluated "
+            "and predicted in parallel on the task pool");
+DEFINE_int32(max_thread_num, 8,
+             "Maximal number of threads sharing the obstacles of a frame");
+DEFINE_double(lane_graph_cache_s_resolution, 1.0,
+              "Resolution of the start s of the cached lane graphs");
+DEFINE_double(lane_graph_cache_length_resolution, 10.0,
+              "Resolution of the length of the cached lane graphs");
+DEFINE_int32(max_num_cached_lane_graphs, 2000,
+             "Maximal number of cached lane graphs, the cache is emptied "
+             "when it is full");
+DEFINE_double(lane_cache_cell_size, 2.0,
+              "Size of the grid cells around which the lanes are cached for "
+              "the nearby lane queries of the map");
+DEFINE_int32(max_num_cached_lane_cells, 50000,
+             "Maximal number of cached grid cells of nearby lanes, the cache "
+             "is emptied when it is full");
+DEFINE_bool(enable_scenario_feature_cache, true,
+            "Reuse the ego lane and the front junction of the scenario "
+            "features while the ego vehicle stays on the same lane");
 
 DEFINE_double(vehicle_max_linear_acc, 4.0,
               "Upper bound of vehicle linear acceleration");
@@ -62,6 +83,23 @@ DEFINE_bool(enable_junction_feature, true,
             "If to enable building junction feature for obstacles");
 DEFINE_bool(enable_all_junction, false,
            "If consider all junction with junction_mlp_model.");
+DEFINE_bool(enable_evaluation_budget, false,
+            "If to spend the evaluation of a frame by obstacle priority: "
+            "caution obstacles get the configured evaluators, the others a "
+            "cheaper one, and the far ones free move");
+DEFINE_double(caution_obstacle_distance, 30.0,
+              "Distance to the ego vehicle within which an obstacle to "
+              "consider is a caution one");
+DEFINE_double(evaluation_budget_distance, 80.0,
+              "Distance to the ego vehicle beyond which an obstacle is "
+              "predicted by free move");
+DEFINE_string(normal_priority_vehicle_on_lane_evaluator, "COST_EVALUATOR",
+              "Evaluator of the normal priority vehicles on lane");
+DEFINE_double(prediction_latency_target_ms, 50.0,
+              "Target of the processing time of a perception frame, the "
+              "budget distances shrink when it is exceeded");
+DEFINE_double(min_evaluation_budget_scale, 0.25,
+              "Smallest scale of the budget distances under heavy traffic");
 
 // Obstacle features
 DEFINE_double(scan_length, 80.0, "The length of the obstacles scan area");
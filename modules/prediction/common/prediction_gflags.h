@@ -26,6 +26,14 @@ DECLARE_double(prediction_trajectory_time_resolution);
 DECLARE_double(min_prediction_trajectory_spatial_length);
 DECLARE_bool(enable_trajectory_validation_check);
 DECLARE_bool(enable_tracking_adaptation);
+DECLARE_bool(enable_multi_thread);
+DECLARE_int32(max_thread_num);
+DECLARE_double(lane_graph_cache_s_resolution);
+DECLARE_double(lane_graph_cache_length_resolution);
+DECLARE_int32(max_num_cached_lane_graphs);
+DECLARE_double(lane_cache_cell_size);
+DECLARE_int32(max_num_cached_lane_cells);
+DECLARE_bool(enable_scenario_feature_cache);
 
 DECLARE_double(vehicle_max_linear_acc);
 DECLARE_double(vehicle_min_linear_acc);
@@ -46,6 +54,12 @@ DECLARE_double(junction_distance_threshold);
 DECLARE_bool(enable_prioritize_obstacles);
 DECLARE_bool(enable_junction_feature);
 DECLARE_bool(enable_all_junction);
+DECLARE_bool(enable_evaluation_budget);
+DECLARE_double(caution_obstacle_distance);
+DECLARE_double(evaluation_budget_distance);
+DECLARE_string(normal_priority_vehicle_on_lane_evaluator);
+DECLARE_double(prediction_latency_target_ms);
+DECLARE_double(min_evaluation_budget_scale);
 
 // Obstacle features
 DECLARE_double(scan_length);
@@ -17,10 +17,14 @@
 #include "modules/prediction/common/prediction_map.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
+#include "modules/common/math/math_utils.h"
 #include "modules/prediction/common/prediction_gflags.h"
 
 namespace apollo {
@@ -35,6 +39,220 @@ using apollo::hdmap::PNCJunctionInfo;
 using apollo::hdmap::OverlapInfo;
 using apollo::hdmap::MapPathPoint;
 
+namespace {
+
+// The lanes of the map interned as integers, and the lanes around the cells
+// of a grid over the map by cell and search radius, so that the many nearby
+// lane queries of the obstacles of a frame do not search the kd-tree of the
+// map and look up lanes by string id every time. Both are kept over frames,
+// as the map does not change, and dropped when another map is loaded. Not
+// used in navigation mode, where the relative map changes every frame.
+class LaneCache {
+ public:
+  struct Candidate {
+    std::shared_ptr<const LaneInfo> lane;
+    int index = 0;
+    // distance from the lane to the center of the cell
+    double distance_to_center = 0.0;
+  };
+
+  static LaneCache* Instance() {
+    static LaneCache* lane_cache = new LaneCache();
+    return lane_cache;
+  }
+
+  // Gets the lanes within radius of point, and their interned indices if
+  // indices is not nullptr, in no particular order as the map does.
+  bool GetLanes(const Vec2d& point, const double radius,
+                std::vector<std::shared_ptr<const LaneInfo>>* lanes,
+                std::vector<int>* indices) {
+    const double cell_size = FLAGS_lane_cache_cell_size;
+    const CellKey key{static_cast<int64_t>(std::floor(point.x() / cell_size)),
+                      static_cast<int64_t>(std::floor(point.y() / cell_size)),
+                      radius};
+    const Vec2d center((static_cast<double>(key.x) + 0.5) * cell_size,
+                       (static_cast<double>(key.y) + 0.5) * cell_size);
+    std::shared_ptr<const std::vector<Candidate>> candidates =
+        GetCandidates(key, center, cell_size);
+    if (candidates == nullptr) {
+      return false;
+    }
+    // every lane within radius of the point is within radius plus the
+    // distance to the center from the center
+    const double distance_to_center = point.DistanceTo(center);
+    for (const Candidate& candidate : *candidates) {
+      if (candidate.distance_to_center - distance_to_center > radius) {
+        continue;
+      }
+      if (candidate.distance_to_center + distance_to_center > radius &&
+          candidate.lane->DistanceTo(point) > radius) {
+        continue;
+      }
+      lanes->push_back(candidate.lane);
+      if (indices != nullptr) {
+        indices->push_back(candidate.index);
+      }
+    }
+    return true;
+  }
+
+  // Gets the interned indices of a lane and of its successors and its left
+  // and right forward neighbors.
+  std::vector<int> RelatedLaneIndices(
+      const std::shared_ptr<const LaneInfo>& lane) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const int index = Intern(lane);
+    if (!related_computed_[index]) {
+      std::vector<int>& related = related_[index];
+      related.push_back(index);
+      const hdmap::Lane& map_lane = lane->lane();
+      for (const auto* ids : {&map_lane.successor_id(),
+                              &map_lane.left_neighbor_forward_lane_id(),
+                              &map_lane.right_neighbor_forward_lane_id()}) {
+        for (const auto& id : *ids) {
+          auto related_lane = map_->GetLaneById(id);
+          if (related_lane != nullptr) {
+            related.push_back(Intern(related_lane));
+          }
+        }
+      }
+      related_computed_[index] = true;
+    }
+    return related_[index];
+  }
+
+ private:
+  struct CellKey {
+    int64_t x;
+    int64_t y;
+    double radius;
+    bool operator==(const CellKey& other) const {
+      return x == other.x && y == other.y && radius == other.radius;
+    }
+  };
+
+  struct CellKeyHash {
+    size_t operator()(const CellKey& key) const {
+      return std::hash<int64_t>()(key.x * 73856093 ^ key.y * 19349663) ^
+             std::hash<double>()(key.radius);
+    }
+  };
+
+  std::shared_ptr<const std::vector<Candidate>> GetCandidates(
+      const CellKey& key, const Vec2d& center, const double cell_size) {
+    const hdmap::HDMap* map = HDMapUtil::BaseMapPtr();
+    if (map == nullptr) {
+      return nullptr;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (map != map_) {
+        Clear();
+        map_ = map;
+      }
+      auto it = cells_.find(key);
+      if (it != cells_.end()) {
+        return it->second;
+      }
+    }
+    // Search the map without holding the lock.
+    std::vector<std::shared_ptr<const LaneInfo>> lanes;
+    common::PointENU hdmap_point;
+    hdmap_point.set_x(center.x());
+    hdmap_point.set_y(center.y());
+    if (map->GetLanes(hdmap_point, key.radius + cell_size * M_SQRT1_2,
+                      &lanes) != 0) {
+      return nullptr;
+    }
+    auto candidates = std::make_shared<std::vector<Candidate>>(lanes.size());
+    for (size_t i = 0; i < lanes.size(); ++i) {
+      (*candidates)[i].lane = lanes[i];
+      (*candidates)[i].distance_to_center = lanes[i]->DistanceTo(center);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (map != map_) {
+      return nullptr;
+    }
+    for (Candidate& candidate : *candidates) {
+      candidate.index = Intern(candidate.lane);
+    }
+    if (cells_.size() >= static_cast<size_t>(FLAGS_max_num_cached_lane_cells)) {
+      cells_.clear();
+    }
+    return cells_.emplace(key, std::move(candidates)).first->second;
+  }
+
+  int Intern(const std::shared_ptr<const LaneInfo>& lane) {
+    auto it = lane_indices_.find(lane.get());
+    if (it != lane_indices_.end()) {
+      return it->second;
+    }
+    const int index = static_cast<int>(lanes_.size());
+    lane_indices_.emplace(lane.get(), index);
+    lanes_.push_back(lane);
+    related_.emplace_back();
+    related_computed_.push_back(false);
+    return index;
+  }
+
+  void Clear() {
+    cells_.clear();
+    lane_indices_.clear();
+    lanes_.clear();
+    related_.clear();
+    related_computed_.clear();
+  }
+
+  std::mutex mutex_;
+  const hdmap::HDMap* map_ = nullptr;
+  std::unordered_map<CellKey, std::shared_ptr<const std::vector<Candidate>>,
+                     CellKeyHash>
+      cells_;
+  std::unordered_map<const LaneInfo*, int> lane_indices_;
+  std::vector<std::shared_ptr<const LaneInfo>> lanes_;
+  std::vector<std::vector<int>> related_;
+  std::vector<bool> related_computed_;
+};
+
+// Gets the lanes within radius of a point from the lane cache, or from the
+// map in navigation mode. Returns if the lanes come from the cache, only
+// then indices is filled.
+bool GetNearbyLanesOfPoint(const Vec2d& point, const double radius,
+                           std::vector<std::shared_ptr<const LaneInfo>>* lanes,
+                           std::vector<int>* indices = nullptr) {
+  lanes->clear();
+  if (!FLAGS_use_navigation_mode &&
+      LaneCache::Instance()->GetLanes(point, radius, lanes, indices)) {
+    return true;
+  }
+  lanes->clear();
+  if (indices != nullptr) {
+    indices->clear();
+  }
+  common::PointENU hdmap_point;
+  hdmap_point.set_x(point.x());
+  hdmap_point.set_y(point.y());
+  HDMapUtil::BaseMap().GetLanes(hdmap_point, radius, lanes);
+  return false;
+}
+
+// Checks the heading of a lane at its point nearest to point, as
+// HDMap::GetLanesWithHeading does.
+bool IsLaneHeadingWithin(const std::shared_ptr<const LaneInfo>& lane,
+                         const Vec2d& point, const double heading,
+                         const double max_heading_diff) {
+  Vec2d proj_pt(0.0, 0.0);
+  double s_offset = 0.0;
+  int s_offset_index = 0;
+  lane->DistanceTo(point, &proj_pt, &s_offset, &s_offset_index);
+  const double heading_diff =
+      std::fabs(lane->headings()[s_offset_index] - heading);
+  return std::fabs(common::math::NormalizeAngle(heading_diff)) <=
+         max_heading_diff;
+}
+
+}  // namespace
+
 bool PredictionMap::Ready() { return HDMapUtil::BaseMapPtr() != nullptr; }
 
 Eigen::Vector2d PredictionMap::PositionOnLane(
@@ -72,6 +290,13 @@ std::shared_ptr<const JunctionInfo> PredictionMap::JunctionById(
   return HDMapUtil::BaseMap().GetJunctionById(hdmap::MakeMapId(str_id));
 }
 
+std::vector<std::shared_ptr<const JunctionInfo>>
+PredictionMap::AllJunctions() {
+  std::vector<std::shared_ptr<const JunctionInfo>> junctions;
+  HDMapUtil::BaseMap().GetAllJunctions(&junctions);
+  return junctions;
+}
+
 std::shared_ptr<const OverlapInfo> PredictionMap::OverlapById(
     const std::string& str_id) {
   return HDMapUtil::BaseMap().GetOverlapById(hdmap::MakeMapId(str_id));
@@ -89,11 +314,8 @@ bool PredictionMap::GetProjection(
 
 bool PredictionMap::HasNearbyLane(const double x, const double y,
                                   const double radius) {
-  common::PointENU point_enu;
-  point_enu.set_x(x);
-  point_enu.set_y(y);
   std::vector<std::shared_ptr<const LaneInfo>> lanes;
-  HDMapUtil::BaseMap().GetLanes(point_enu, radius, &lanes);
+  GetNearbyLanesOfPoint({x, y}, radius, &lanes);
   return (!lanes.empty());
 }
 
@@ -130,10 +352,7 @@ bool PredictionMap::IsVirtualLane(const std::string& lane_id) {
 bool PredictionMap::OnVirtualLane(const Eigen::Vector2d& point,
                                   const double radius) {
   std::vector<std::shared_ptr<const LaneInfo>> lanes;
-  common::PointENU hdmap_point;
-  hdmap_point.set_x(point[0]);
-  hdmap_point.set_y(point[1]);
-  HDMapUtil::BaseMap().GetLanes(hdmap_point, radius, &lanes);
+  GetNearbyLanesOfPoint({point[0], point[1]}, radius, &lanes);
   for (const auto& lane : lanes) {
     if (IsVirtualLane(lane->id().id())) {
       return true;
@@ -149,31 +368,53 @@ void PredictionMap::OnLane(
     const double max_lane_angle_diff,
     std::vector<std::shared_ptr<const LaneInfo>>* lanes) {
   std::vector<std::shared_ptr<const LaneInfo>> candidate_lanes;
-
-  common::PointENU hdmap_point;
-  hdmap_point.set_x(point.x());
-  hdmap_point.set_y(point.y());
-  if (HDMapUtil::BaseMap().GetLanesWithHeading(hdmap_point, radius, heading,
-                                               max_lane_angle_diff,
-                                               &candidate_lanes) != 0) {
-    return;
+  std::vector<int> candidate_indices;
+  const Vec2d vec_point(point.x(), point.y());
+  const bool indexed = GetNearbyLanesOfPoint(vec_point, radius,
+                                             &candidate_lanes,
+                                             &candidate_indices);
+
+  // With interned lanes, the candidates are checked against the indices of
+  // the previous lanes, their successors and their neighbors.
+  bool check_related_lanes = !FLAGS_use_navigation_mode && !prev_lanes.empty();
+  std::vector<int> related_indices;
+  for (const auto& prev_lane : prev_lanes) {
+    if (prev_lane == nullptr) {
+      check_related_lanes = false;
+    } else if (indexed) {
+      const std::vector<int> indices =
+          LaneCache::Instance()->RelatedLaneIndices(prev_lane);
+      related_indices.insert(related_indices.end(), indices.begin(),
+                             indices.end());
+    }
   }
 
   std::vector<std::pair<std::shared_ptr<const LaneInfo>, double>> lane_pairs;
-  for (const auto& candidate_lane : candidate_lanes) {
+  for (size_t i = 0; i < candidate_lanes.size(); ++i) {
+    const auto& candidate_lane = candidate_lanes[i];
     if (candidate_lane == nullptr) {
       continue;
     }
-    if (on_lane && !candidate_lane->IsOnLane({point.x(), point.y()})) {
+    if (!IsLaneHeadingWithin(candidate_lane, vec_point, heading,
+                             max_lane_angle_diff)) {
       continue;
     }
-    if (!FLAGS_use_navigation_mode &&
-        !IsIdenticalLane(candidate_lane, prev_lanes) &&
-        !IsSuccessorLane(candidate_lane, prev_lanes) &&
-        !IsLeftNeighborLane(candidate_lane, prev_lanes) &&
-        !IsRightNeighborLane(candidate_lane, prev_lanes)) {
+    if (on_lane && !candidate_lane->IsOnLane(vec_point)) {
       continue;
     }
+    if (check_related_lanes) {
+      if (indexed) {
+        if (std::find(related_indices.begin(), related_indices.end(),
+                      candidate_indices[i]) == related_indices.end()) {
+          continue;
+        }
+      } else if (!IsIdenticalLane(candidate_lane, prev_lanes) &&
+                 !IsSuccessorLane(candidate_lane, prev_lanes) &&
+                 !IsLeftNeighborLane(candidate_lane, prev_lanes) &&
+                 !IsRightNeighborLane(candidate_lane, prev_lanes)) {
+        continue;
+      }
+    }
     double distance = 0.0;
     common::PointENU nearest_point =
         candidate_lane->GetNearestPoint({point.x(), point.y()}, &distance);
@@ -207,15 +448,16 @@ std::shared_ptr<const LaneInfo> PredictionMap::GetMostLikelyCurrentLane(
     const common::PointENU& position, const double radius,
     const double heading, const double angle_diff_threshold) {
   std::vector<std::shared_ptr<const LaneInfo>> candidate_lanes;
-  if (HDMapUtil::BaseMap().GetLanesWithHeading(position, radius, heading,
-                                               angle_diff_threshold,
-                                               &candidate_lanes) != 0) {
-    return nullptr;
-  }
+  const Vec2d vec_position(position.x(), position.y());
+  GetNearbyLanesOfPoint(vec_position, radius, &candidate_lanes);
   double min_angle_diff = 2.0 * M_PI;
   std::shared_ptr<const LaneInfo> curr_lane_ptr = nullptr;
   for (auto candidate_lane : candidate_lanes) {
-    if (!candidate_lane->IsOnLane({position.x(), position.y()})) {
+    if (!IsLaneHeadingWithin(candidate_lane, vec_position, heading,
+                             angle_diff_threshold)) {
+      continue;
+    }
+    if (!candidate_lane->IsOnLane(vec_position)) {
       continue;
     }
     double distance = 0.0;
@@ -488,10 +730,7 @@ std::vector<std::string> PredictionMap::NearbyLaneIds(
     const Eigen::Vector2d& point, const double radius) {
   std::vector<std::string> lane_ids;
   std::vector<std::shared_ptr<const LaneInfo>> lanes;
-  common::PointENU hdmap_point;
-  hdmap_point.set_x(point[0]);
-  hdmap_point.set_y(point[1]);
-  HDMapUtil::BaseMap().GetLanes(hdmap_point, radius, &lanes);
+  GetNearbyLanesOfPoint({point[0], point[1]}, radius, &lanes);
   for (const auto& lane : lanes) {
     lane_ids.push_back(lane->id().id());
   }
@@ -659,8 +898,8 @@ std::vector<std::shared_ptr<const LaneInfo>> PredictionMap::GetNearbyLanes(
   CHECK(nearby_radius > 0.0);
 
   std::vector<std::shared_ptr<const LaneInfo>> nearby_lanes;
-
-  HDMapUtil::BaseMap().GetLanes(position, nearby_radius, &nearby_lanes);
+  GetNearbyLanesOfPoint({position.x(), position.y()}, nearby_radius,
+                        &nearby_lanes);
   return nearby_lanes;
 }
 
@@ -83,6 +83,13 @@ class PredictionMap {
   static std::shared_ptr<const hdmap::JunctionInfo>
   JunctionById(const std::string& id);
 
+  /**
+   * @brief Get all junctions of the map.
+   * @return Shared pointers to all junctions of the map.
+   */
+  static std::vector<std::shared_ptr<const hdmap::JunctionInfo>>
+  AllJunctions();
+
   /**
    * @brief Get a shared pointer to a overlap by overlap ID.
    * @param id The ID of the target overlap ID in the form of string.
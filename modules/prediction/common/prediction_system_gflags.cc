@@ -52,6 +52,15 @@ DEFINE_int32(prediction_offline_mode, 0,
              "1: dump feature proto to feature.x.bin"
              "2: dump data for learning to datalearn.x.bin"
              "3: dump predicted trajectory to predict_result.x.bin");
+DEFINE_int32(prediction_offline_num_shards, 1,
+             "Number of processes sharing the offline records, each one "
+             "processes a contiguous range of the sorted records");
+DEFINE_int32(prediction_offline_shard_index, 0,
+             "Index in [0, prediction_offline_num_shards) of the range of "
+             "records processed by this process");
+DEFINE_string(prediction_offline_checkpoint_file, "",
+              "File listing the offline records already processed, which are "
+              "skipped when the processing is resumed. Empty to disable");
 
 // Bag replay timestamp gap
 DEFINE_double(replay_timestamp_gap, 10.0,
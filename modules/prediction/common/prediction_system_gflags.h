@@ -32,6 +32,9 @@ DECLARE_double(prediction_test_duration);
 
 DECLARE_string(prediction_offline_bags);
 DECLARE_int32(prediction_offline_mode);
+DECLARE_int32(prediction_offline_num_shards);
+DECLARE_int32(prediction_offline_shard_index);
+DECLARE_string(prediction_offline_checkpoint_file);
 
 // Bag replay timestamp gap
 DECLARE_double(replay_timestamp_gap);
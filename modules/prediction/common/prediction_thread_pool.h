@@ -0,0 +1,87 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Share the obstacles of a frame among the threads of the task pool
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <future>
+#include <vector>
+
+#include "cyber/task/task.h"
+#include "modules/prediction/common/prediction_gflags.h"
+#include "modules/prediction/common/prediction_system_gflags.h"
+
+namespace apollo {
+namespace prediction {
+
+class PredictionThreadPool {
+ public:
+  /**
+   * @brief Get the number of threads sharing the obstacles of a frame,
+   *        1 if multi thread is disabled or in offline mode, as the
+   *        offline feature output is not thread safe.
+   * @return The number of threads
+   */
+  static int NumThreads() {
+    if (!FLAGS_enable_multi_thread || FLAGS_prediction_offline_mode != 0) {
+      return 1;
+    }
+    return std::max(1, FLAGS_max_thread_num);
+  }
+
+  /**
+   * @brief Call func(index, thread_index) for every index in [0, size).
+   *        Thread thread_index in [0, NumThreads()) handles a contiguous
+   *        chunk of the indices in order, the first chunk runs on the
+   *        calling thread. Returns when all the indices are handled.
+   * @param Number of indices
+   * @param Function to call
+   */
+  template <typename Func>
+  static void ForEach(const int size, const Func& func) {
+    const int num_threads = std::min(NumThreads(), size);
+    if (num_threads <= 1) {
+      for (int i = 0; i < size; ++i) {
+        func(i, 0);
+      }
+      return;
+    }
+    const int chunk_size = (size + num_threads - 1) / num_threads;
+    auto run_chunk = [&func, size, chunk_size](const int thread_index) {
+      const int end = std::min(size, (thread_index + 1) * chunk_size);
+      for (int i = thread_index * chunk_size; i < end; ++i) {
+        func(i, thread_index);
+      }
+    };
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_threads - 1);
+    for (int t = 1; t < num_threads; ++t) {
+      futures.push_back(cyber::Async(run_chunk, t));
+    }
+    run_chunk(0);
+    for (auto& future : futures) {
+      future.get();
+    }
+  }
+};
+
+}  // namespace prediction
+}  // namespace apollo
@@ -0,0 +1,74 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/prediction/common/prediction_thread_pool.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "cyber/init.h"
+
+namespace apollo {
+namespace prediction {
+
+TEST(PredictionThreadPoolTest, single_thread) {
+  FLAGS_enable_multi_thread = false;
+  EXPECT_EQ(PredictionThreadPool::NumThreads(), 1);
+  std::vector<int> thread_indices(10, -1);
+  PredictionThreadPool::ForEach(10, [&](const int i, const int thread_index) {
+    thread_indices[i] = thread_index;
+  });
+  for (const int thread_index : thread_indices) {
+    EXPECT_EQ(thread_index, 0);
+  }
+}
+
+TEST(PredictionThreadPoolTest, multi_thread) {
+  FLAGS_enable_multi_thread = true;
+  FLAGS_max_thread_num = 4;
+  EXPECT_EQ(PredictionThreadPool::NumThreads(), 4);
+  std::vector<int> counts(10, 0);
+  std::vector<int> thread_indices(10, -1);
+  PredictionThreadPool::ForEach(10, [&](const int i, const int thread_index) {
+    ++counts[i];
+    thread_indices[i] = thread_index;
+  });
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(counts[i], 1);
+    // chunks of 3 indices
+    EXPECT_EQ(thread_indices[i], i / 3);
+  }
+
+  // fewer indices than threads
+  counts.assign(2, 0);
+  PredictionThreadPool::ForEach(2, [&](const int i, const int thread_index) {
+    ++counts[i];
+    EXPECT_EQ(thread_index, i);
+  });
+  EXPECT_EQ(counts[0], 1);
+  EXPECT_EQ(counts[1], 1);
+  FLAGS_enable_multi_thread = false;
+}
+
+}  // namespace prediction
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  apollo::cyber::Init(argv[0]);
+  return RUN_ALL_TESTS();
+}
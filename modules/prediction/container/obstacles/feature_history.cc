@@ -0,0 +1,59 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/prediction/container/obstacles/feature_history.h"
+
+#include <algorithm>
+
+namespace apollo {
+namespace prediction {
+
+FeatureHistory::FeatureHistory(const size_t capacity)
+    : slots_(std::max(capacity, static_cast<size_t>(1))) {}
+
+void FeatureHistory::PushFront(Feature* feature) {
+  Feature* slot = NewFrontSlot();
+  slot->Swap(feature);
+  feature->Clear();
+}
+
+void FeatureHistory::PushFront(const Feature& feature) {
+  NewFrontSlot()->CopyFrom(feature);
+}
+
+void FeatureHistory::PopBack() {
+  if (size_ > 0) {
+    --size_;
+  }
+}
+
+Feature* FeatureHistory::NewFrontSlot() {
+  if (size_ == slots_.size()) {
+    // Move the features in order to the beginning of a larger ring.
+    std::vector<Feature> slots(2 * slots_.size());
+    for (size_t i = 0; i < size_; ++i) {
+      slots[i].Swap(&slots_[Slot(i)]);
+    }
+    slots_.swap(slots);
+    head_ = 0;
+  }
+  head_ = (head_ + slots_.size() - 1) % slots_.size();
+  ++size_;
+  return &slots_[head_];
+}
+
+}  // namespace prediction
+}  // namespace apollo
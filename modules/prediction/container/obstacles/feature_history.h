@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Feature history of an obstacle
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "modules/prediction/proto/feature.pb.h"
+
+namespace apollo {
+namespace prediction {
+
+/**
+ * @class FeatureHistory
+ * @brief Ring of the features of an obstacle, the latest one first.
+ *        The slots are reused: a feature dropped from the history keeps
+ *        its allocated fields for the next inserted feature, so once the
+ *        ring has reached its capacity inserting a frame does not allocate.
+ */
+class FeatureHistory {
+ public:
+  /**
+   * @brief Constructor
+   * @param Initial number of slots, doubled when the history is full
+   */
+  explicit FeatureHistory(const size_t capacity = 16);
+
+  size_t size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief Get the i-th latest feature
+   * @param Index, 0 for the latest feature
+   * @return The feature
+   */
+  const Feature& operator[](const size_t i) const { return slots_[Slot(i)]; }
+
+  Feature& operator[](const size_t i) { return slots_[Slot(i)]; }
+
+  const Feature& front() const { return (*this)[0]; }
+
+  Feature& front() { return (*this)[0]; }
+
+  const Feature& back() const { return (*this)[size_ - 1]; }
+
+  Feature& back() { return (*this)[size_ - 1]; }
+
+  /**
+   * @brief Insert a feature as the latest one by swapping it with a free
+   *        slot. The feature is left cleared, with the allocations of the
+   *        slot, so that it can be filled again.
+   * @param Feature to insert
+   */
+  void PushFront(Feature* feature);
+
+  /**
+   * @brief Insert a copy of a feature as the latest one
+   * @param Feature to insert
+   */
+  void PushFront(const Feature& feature);
+
+  /**
+   * @brief Drop the oldest feature
+   */
+  void PopBack();
+
+ private:
+  size_t Slot(const size_t i) const { return (head_ + i) % slots_.size(); }
+
+  Feature* NewFrontSlot();
+
+ private:
+  std::vector<Feature> slots_;
+  size_t head_ = 0;
+  size_t size_ = 0;
+};
+
+}  // namespace prediction
+}  // namespace apollo
@@ -0,0 +1,60 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/prediction/container/obstacles/feature_history.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace prediction {
+
+TEST(FeatureHistoryTest, PushAndPop) {
+  FeatureHistory history(2);
+  EXPECT_TRUE(history.empty());
+
+  Feature feature;
+  for (int i = 0; i < 5; ++i) {
+    feature.set_id(i);
+    feature.set_timestamp(0.1 * i);
+    history.PushFront(&feature);
+    EXPECT_FALSE(feature.has_id());
+  }
+  // the ring grows and keeps the latest feature first
+  ASSERT_EQ(5, history.size());
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(4 - i, history[i].id());
+  }
+  EXPECT_EQ(4, history.front().id());
+  EXPECT_EQ(0, history.back().id());
+
+  history.PopBack();
+  history.PopBack();
+  EXPECT_EQ(3, history.size());
+  EXPECT_EQ(2, history.back().id());
+
+  // a freed slot is reused for the next feature
+  Feature copied_feature;
+  copied_feature.set_id(5);
+  history.PushFront(copied_feature);
+  EXPECT_EQ(4, history.size());
+  EXPECT_EQ(5, history.front().id());
+  EXPECT_EQ(4, history[1].id());
+  EXPECT_EQ(2, history.back().id());
+  EXPECT_EQ(5, copied_feature.id());
+}
+
+}  // namespace prediction
+}  // namespace apollo
@@ -118,6 +118,21 @@ bool Obstacle::ToIgnore() {
   return latest_feature().priority().priority() == ObstaclePriority::IGNORE;
 }
 
+bool Obstacle::IsCaution() const {
+  if (feature_history_.empty()) {
+    return false;
+  }
+  return latest_feature().priority().priority() == ObstaclePriority::CAUTION;
+}
+
+void Obstacle::SetBeyondEvaluationBudget(const bool beyond_evaluation_budget) {
+  beyond_evaluation_budget_ = beyond_evaluation_budget;
+}
+
+bool Obstacle::IsBeyondEvaluationBudget() const {
+  return beyond_evaluation_budget_;
+}
+
 bool Obstacle::IsNearJunction() {
   if (feature_history_.empty()) {
     return false;
@@ -146,7 +161,8 @@ bool Obstacle::Insert(const PerceptionObstacle& perception_obstacle,
   }
 
   // Set ID, Type, and Status of the feature.
-  Feature feature;
+  Feature& feature = next_feature_;
+  feature.Clear();
   if (!SetId(perception_obstacle, &feature, prediction_obstacle_id)) {
     return false;
   }
@@ -186,7 +202,7 @@ bool Obstacle::Insert(const PerceptionObstacle& perception_obstacle,
   }
 
   // Insert obstacle feature to history
-  InsertFeatureToHistory(feature);
+  InsertFeatureToHistory(&feature);
 
   // Set obstacle motion status
   if (FLAGS_use_navigation_mode) {
@@ -201,7 +217,7 @@ bool Obstacle::Insert(const PerceptionObstacle& perception_obstacle,
 }
 
 bool Obstacle::InsertFeature(const Feature& feature) {
-  InsertFeatureToHistory(feature);
+  feature_history_.PushFront(feature);
   type_ = feature.type();
   id_ = feature.id();
   return true;
@@ -1041,16 +1057,21 @@ void Obstacle::BuildLaneGraph() {
   for (auto& lane : feature->lane().current_lane_feature()) {
     std::shared_ptr<const LaneInfo> lane_info =
         PredictionMap::LaneById(lane.lane_id());
-    const LaneGraph& lane_graph = ObstacleClusters::GetLaneGraph(
-        lane.lane_s(), road_graph_search_distance, lane_info);
-    if (lane_graph.lane_sequence_size() > 0) {
+    std::shared_ptr<const LaneGraph> lane_graph =
+        ObstacleClusters::GetLaneGraph(lane.lane_s(),
+                                       road_graph_search_distance, lane_info);
+    if (lane_graph->lane_sequence_size() > 0) {
       ++curr_lane_count;
     }
-    for (const auto& lane_seq : lane_graph.lane_sequence()) {
+    for (const auto& lane_seq : lane_graph->lane_sequence()) {
       LaneSequence* lane_seq_ptr = feature->mutable_lane()
           ->mutable_lane_graph()
           ->add_lane_sequence();
       lane_seq_ptr->CopyFrom(lane_seq);
+      // the shared lane graph starts at the beginning of the s bucket
+      if (lane_seq_ptr->lane_segment_size() > 0) {
+        lane_seq_ptr->mutable_lane_segment(0)->set_start_s(lane.lane_s());
+      }
       lane_seq_ptr->set_lane_sequence_id(seq_id++);
       lane_seq_ptr->set_lane_s(lane.lane_s());
       lane_seq_ptr->set_lane_l(lane.lane_l());
@@ -1069,16 +1090,21 @@ void Obstacle::BuildLaneGraph() {
   for (auto& lane : feature->lane().nearby_lane_feature()) {
     std::shared_ptr<const LaneInfo> lane_info =
         PredictionMap::LaneById(lane.lane_id());
-    const LaneGraph& lane_graph = ObstacleClusters::GetLaneGraph(
-        lane.lane_s(), road_graph_search_distance, lane_info);
-    if (lane_graph.lane_sequence_size() > 0) {
+    std::shared_ptr<const LaneGraph> lane_graph =
+        ObstacleClusters::GetLaneGraph(lane.lane_s(),
+                                       road_graph_search_distance, lane_info);
+    if (lane_graph->lane_sequence_size() > 0) {
       ++nearby_lane_count;
     }
-    for (const auto& lane_seq : lane_graph.lane_sequence()) {
+    for (const auto& lane_seq : lane_graph->lane_sequence()) {
       LaneSequence* lane_seq_ptr = feature->mutable_lane()
           ->mutable_lane_graph()
           ->add_lane_sequence();
       lane_seq_ptr->CopyFrom(lane_seq);
+      // the shared lane graph starts at the beginning of the s bucket
+      if (lane_seq_ptr->lane_segment_size() > 0) {
+        lane_seq_ptr->mutable_lane_segment(0)->set_start_s(lane.lane_s());
+      }
       lane_seq_ptr->set_lane_sequence_id(seq_id++);
       lane_seq_ptr->set_lane_s(lane.lane_s());
       lane_seq_ptr->set_lane_l(lane.lane_l());
@@ -1404,14 +1430,13 @@ void Obstacle::SetMotionStatus() {
   len = std::max(len, FLAGS_min_still_obstacle_history_length);
   CHECK_GT(len, 1);
 
-  auto feature_riter = feature_history_.rbegin();
-  start_x = feature_riter->position().x();
-  start_y = feature_riter->position().y();
-  ++feature_riter;
-  while (feature_riter != feature_history_.rend()) {
-    avg_drift_x += (feature_riter->position().x() - start_x) / (len - 1);
-    avg_drift_y += (feature_riter->position().y() - start_y) / (len - 1);
-    ++feature_riter;
+  const Feature& oldest_feature = feature_history_.back();
+  start_x = oldest_feature.position().x();
+  start_y = oldest_feature.position().y();
+  for (size_t i = feature_history_.size() - 1; i > 0; --i) {
+    const Feature& feature = feature_history_[i - 1];
+    avg_drift_x += (feature.position().x() - start_x) / (len - 1);
+    avg_drift_y += (feature.position().y() - start_y) / (len - 1);
   }
 
   double delta_ts = feature_history_.front().timestamp() -
@@ -1462,8 +1487,8 @@ void Obstacle::SetMotionStatusBySpeed() {
   }
 }
 
-void Obstacle::InsertFeatureToHistory(const Feature& feature) {
-  feature_history_.emplace_front(feature);
+void Obstacle::InsertFeatureToHistory(Feature* feature) {
+  feature_history_.PushFront(feature);
   ADEBUG << "Obstacle [" << id_ << "] inserted a frame into the history.";
 }
 
@@ -1479,7 +1504,7 @@ std::unique_ptr<Obstacle> Obstacle::Create(
 
 std::unique_ptr<Obstacle> Obstacle::Create(const Feature& feature) {
   std::unique_ptr<Obstacle> ptr_obstacle(new Obstacle());
-  ptr_obstacle->InsertFeatureToHistory(feature);
+  ptr_obstacle->feature_history_.PushFront(feature);
   return ptr_obstacle;
 }
 
@@ -1496,7 +1521,7 @@ void Obstacle::DiscardOutdatedHistory() {
   const double latest_ts = feature_history_.front().timestamp();
   while (latest_ts - feature_history_.back().timestamp() >=
              FLAGS_max_history_time) {
-    feature_history_.pop_back();
+    feature_history_.PopBack();
   }
   auto num_of_discarded_frames = num_of_frames - feature_history_.size();
   if (num_of_discarded_frames > 0) {
@@ -21,7 +21,6 @@
 
 #pragma once
 
-#include <deque>
 #include <memory>
 #include <string>
 #include <vector>
@@ -29,6 +28,7 @@
 #include "modules/common/filters/digital_filter.h"
 #include "modules/common/math/kalman_filter.h"
 #include "modules/map/hdmap/hdmap_common.h"
+#include "modules/prediction/container/obstacles/feature_history.h"
 #include "modules/prediction/proto/feature.pb.h"
 
 /**
@@ -161,6 +161,25 @@ class Obstacle {
    */
   bool ToIgnore();
 
+  /**
+   * @brief Check if the obstacle is a caution one.
+   * @return If the obstacle is a caution one.
+   */
+  bool IsCaution() const;
+
+  /**
+   * @brief Set if the obstacle is beyond the evaluation budget of the
+   *        frame, it is then predicted by free move without lane graph.
+   * @param If the obstacle is beyond the evaluation budget.
+   */
+  void SetBeyondEvaluationBudget(const bool beyond_evaluation_budget);
+
+  /**
+   * @brief Check if the obstacle is beyond the evaluation budget.
+   * @return If the obstacle is beyond the evaluation budget.
+   */
+  bool IsBeyondEvaluationBudget() const;
+
   /**
    * @brief Check if the obstacle is near a junction.
    * @return If the obstacle is near a junction.
@@ -298,7 +317,7 @@ class Obstacle {
 
   void SetMotionStatusBySpeed();
 
-  void InsertFeatureToHistory(const Feature& feature);
+  void InsertFeatureToHistory(Feature* feature);
 
   void SetJunctionFeatureWithEnterLane(
       const std::string& enter_lane_id, Feature* const feature_ptr);
@@ -313,7 +332,11 @@ class Obstacle {
   perception::PerceptionObstacle::Type type_ =
       perception::PerceptionObstacle::UNKNOWN_UNMOVABLE;
 
-  std::deque<Feature> feature_history_;
+  FeatureHistory feature_history_;
+
+  // Feature being built for the next frame, it reuses the allocations of
+  // the feature last dropped from the history.
+  Feature next_feature_;
 
   common::math::KalmanFilter<double, 6, 2, 0> kf_motion_tracker_;
 
@@ -324,6 +347,8 @@ class Obstacle {
   std::vector<Eigen::MatrixXf> rnn_states_;
 
   bool rnn_enabled_ = false;
+
+  bool beyond_evaluation_budget_ = false;
 };
 
 }  // namespace prediction
@@ -17,8 +17,11 @@
 #include "modules/prediction/container/obstacles/obstacle_clusters.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 
+#include "modules/common/configs/config_gflags.h"
+#include "modules/prediction/common/prediction_gflags.h"
 #include "modules/prediction/common/road_graph.h"
 
 namespace apollo {
@@ -26,49 +29,61 @@ namespace prediction {
 
 using ::apollo::hdmap::LaneInfo;
 
-std::unordered_map<std::string, LaneGraph> ObstacleClusters::lane_graphs_;
+std::unordered_map<std::string, std::shared_ptr<const LaneGraph>>
+    ObstacleClusters::lane_graphs_;
 std::unordered_map<std::string, std::vector<LaneObstacle>>
     ObstacleClusters::lane_obstacles_;
 std::unordered_map<std::string, StopSign>
     ObstacleClusters::lane_id_stop_sign_map_;
+std::mutex ObstacleClusters::mutex_;
 
 void ObstacleClusters::Clear() {
-  lane_graphs_.clear();
+  std::lock_guard<std::mutex> lock(mutex_);
+  // the lane graphs stay valid over frames, unless the map is the
+  // relative map of the navigation mode
+  if (FLAGS_use_navigation_mode) {
+    lane_graphs_.clear();
+  }
   lane_obstacles_.clear();
   lane_id_stop_sign_map_.clear();
 }
 
 void ObstacleClusters::Init() { Clear(); }
 
-const LaneGraph& ObstacleClusters::GetLaneGraph(
+std::shared_ptr<const LaneGraph> ObstacleClusters::GetLaneGraph(
     const double start_s, const double length,
     std::shared_ptr<const LaneInfo> lane_info_ptr) {
-  std::string lane_id = lane_info_ptr->id().id();
-  if (lane_graphs_.find(lane_id) != lane_graphs_.end()) {
-    // If this lane_segment has been used for constructing LaneGraph,
-    // fetch the previously saved LaneGraph, modify its start_s,
-    // then return this (save the time to construct the entire LaneGraph).
-    LaneGraph* lane_graph = &lane_graphs_[lane_id];
-    for (int i = 0; i < lane_graph->lane_sequence_size(); ++i) {
-      LaneSequence* lane_seq_ptr = lane_graph->mutable_lane_sequence(i);
-      if (lane_seq_ptr->lane_segment_size() == 0) {
-        continue;
-      }
-      LaneSegment* first_lane_seg_ptr = lane_seq_ptr->mutable_lane_segment(0);
-      if (first_lane_seg_ptr->lane_id() != lane_id) {
-        continue;
-      }
-      first_lane_seg_ptr->set_start_s(start_s);
+  // Lane graphs are kept over frames and shared by the obstacles on the
+  // same lane. A lane graph starts at the beginning of the bucket of
+  // start_s and is long enough for every start_s in the bucket.
+  const int s_index = static_cast<int>(
+      std::floor(start_s / FLAGS_lane_graph_cache_s_resolution));
+  const int length_index = static_cast<int>(
+      std::ceil(length / FLAGS_lane_graph_cache_length_resolution));
+  const std::string key = lane_info_ptr->id().id() + "_" +
+                          std::to_string(s_index) + "_" +
+                          std::to_string(length_index);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = lane_graphs_.find(key);
+    if (it != lane_graphs_.end()) {
+      return it->second;
     }
-  } else {
-    // If this lane_segment has not been used for constructing LaneGraph,
-    // construct the LaneGraph and return.
-    RoadGraph road_graph(start_s, length, lane_info_ptr);
-    LaneGraph lane_graph;
-    road_graph.BuildLaneGraph(&lane_graph);
-    lane_graphs_[lane_id] = std::move(lane_graph);
   }
-  return lane_graphs_[lane_id];
+  // Construct the LaneGraph without holding the lock.
+  const double graph_start_s = s_index * FLAGS_lane_graph_cache_s_resolution;
+  const double graph_length =
+      length_index * FLAGS_lane_graph_cache_length_resolution +
+      FLAGS_lane_graph_cache_s_resolution;
+  RoadGraph road_graph(graph_start_s, graph_length, lane_info_ptr);
+  auto lane_graph = std::make_shared<LaneGraph>();
+  road_graph.BuildLaneGraph(lane_graph.get());
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (lane_graphs_.size() >=
+      static_cast<size_t>(FLAGS_max_num_cached_lane_graphs)) {
+    lane_graphs_.clear();
+  }
+  return lane_graphs_.emplace(key, std::move(lane_graph)).first->second;
 }
 
 LaneGraph ObstacleClusters::GetLaneGraphWithoutMemorizing(
@@ -90,6 +105,7 @@ void ObstacleClusters::AddObstacle(
   lane_obstacle.set_lane_id(lane_id);
   lane_obstacle.set_lane_s(lane_s);
   lane_obstacle.set_lane_l(lane_l);
+  std::lock_guard<std::mutex> lock(mutex_);
   lane_obstacles_[lane_id].push_back(std::move(lane_obstacle));
 }
 
@@ -98,7 +114,10 @@ void ObstacleClusters::SortObstacles() {
        iter != lane_obstacles_.end(); ++iter) {
     std::sort(iter->second.begin(), iter->second.end(),
       [](const LaneObstacle& obs0, const LaneObstacle& obs1) -> bool {
-        return obs0.lane_s() < obs1.lane_s();
+        if (obs0.lane_s() != obs1.lane_s()) {
+          return obs0.lane_s() < obs1.lane_s();
+        }
+        return obs0.obstacle_id() < obs1.obstacle_id();
       });
   }
 }
@@ -202,8 +221,12 @@ bool ObstacleClusters::BackwardNearbyObstacle(
 StopSign ObstacleClusters::QueryStopSignByLaneId(const std::string& lane_id) {
   StopSign stop_sign;
   // Find the stop_sign by lane_id in the hashtable
-  if (lane_id_stop_sign_map_.find(lane_id) != lane_id_stop_sign_map_.end()) {
-    return lane_id_stop_sign_map_[lane_id];
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = lane_id_stop_sign_map_.find(lane_id);
+    if (it != lane_id_stop_sign_map_.end()) {
+      return it->second;
+    }
   }
   std::shared_ptr<const LaneInfo> lane_info_ptr =
       PredictionMap::LaneById(lane_id);
@@ -224,14 +247,16 @@ StopSign ObstacleClusters::QueryStopSignByLaneId(const std::string& lane_id) {
               stop_sign.set_stop_sign_id(object.id().id());
               stop_sign.set_lane_id(lane_id);
               stop_sign.set_lane_s(obj.lane_overlap_info().start_s());
-              lane_id_stop_sign_map_[lane_id] = stop_sign;
             }
           }
         }
       }
     }
   }
-  return lane_id_stop_sign_map_[lane_id];
+  // lanes without a stop sign are memorized with an empty one
+  std::lock_guard<std::mutex> lock(mutex_);
+  lane_id_stop_sign_map_[lane_id] = stop_sign;
+  return stop_sign;
 }
 
 }  // namespace prediction
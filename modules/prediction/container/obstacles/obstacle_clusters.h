@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -32,18 +33,21 @@ namespace prediction {
 class ObstacleClusters {
  public:
   /**
-   * @brief Remove all lane graphs
+   * @brief Remove the obstacles of the last frame
    */
   static void Init();
 
   /**
-   * @brief Obtain a lane graph given a lane info and s
+   * @brief Obtain a lane graph given a lane info and s, thread safe.
+   *        The lane graph is cached by lane, bucket of start s and bucket
+   *        of length, and shared by all its users. Its first lane segments
+   *        start at the beginning of the bucket of start s.
    * @param lane start s
    * @param lane total length
    * @param lane info
-   * @return a corresponding lane graph
+   * @return the corresponding immutable lane graph
    */
-  static const LaneGraph& GetLaneGraph(
+  static std::shared_ptr<const LaneGraph> GetLaneGraph(
       const double start_s, const double length,
       std::shared_ptr<const apollo::hdmap::LaneInfo> lane_info_ptr);
 
@@ -71,7 +75,7 @@ class ObstacleClusters {
       LaneObstacle* const lane_obstacle);
 
   /**
-   * @brief Add an obstacle into clusters
+   * @brief Add an obstacle into clusters, thread safe
    * @param obstacle id
    * @param lane id
    * @param lane s
@@ -84,7 +88,8 @@ class ObstacleClusters {
       const double lane_l);
 
   /**
-   * @brief Sort lane obstacles by lane s
+   * @brief Sort lane obstacles by lane s, then by id, so that the order
+   *        does not depend on the order the obstacles were added in
    */
   static void SortObstacles();
 
@@ -117,7 +122,7 @@ class ObstacleClusters {
     NearbyObstacle* const nearby_obstacle_ptr);
 
   /**
-   * @brief Query stop sign by lane ID
+   * @brief Query stop sign by lane ID, thread safe
    * @param lane ID
    * @return the stop sign
    */
@@ -129,10 +134,15 @@ class ObstacleClusters {
   static void Clear();
 
  private:
-  static std::unordered_map<std::string, LaneGraph> lane_graphs_;
+  // (lane id, start s bucket, length bucket) -> lane graph
+  static std::unordered_map<std::string, std::shared_ptr<const LaneGraph>>
+      lane_graphs_;
   static std::unordered_map<std::string,
                             std::vector<LaneObstacle>> lane_obstacles_;
   static std::unordered_map<std::string, StopSign> lane_id_stop_sign_map_;
+  // guards the maps, as the obstacles of a frame may be processed in
+  // parallel
+  static std::mutex mutex_;
 };
 
 }  // namespace prediction
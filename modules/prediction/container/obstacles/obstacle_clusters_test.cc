@@ -29,22 +29,31 @@ TEST_F(ObstacleClustersTest, ObstacleClusters) {
   double start_s = 99.0;
   double length = 100.0;
 
-  const LaneGraph &lane_graph =
+  std::shared_ptr<const LaneGraph> lane_graph =
       ObstacleClusters::GetLaneGraph(start_s, length, lane);
-  EXPECT_EQ(1, lane_graph.lane_sequence_size());
-  EXPECT_EQ(3, lane_graph.lane_sequence(0).lane_segment_size());
-  EXPECT_EQ("l9", lane_graph.lane_sequence(0).lane_segment(0).lane_id());
-  EXPECT_EQ("l18", lane_graph.lane_sequence(0).lane_segment(1).lane_id());
-  EXPECT_EQ("l21", lane_graph.lane_sequence(0).lane_segment(2).lane_id());
-
-  double length_2 = 50.0;
-  const LaneGraph &lane_graph_2 =
-      ObstacleClusters::GetLaneGraph(start_s, length_2, lane);
-  EXPECT_EQ(1, lane_graph_2.lane_sequence_size());
-  EXPECT_EQ(3, lane_graph_2.lane_sequence(0).lane_segment_size());
-  EXPECT_EQ("l9", lane_graph_2.lane_sequence(0).lane_segment(0).lane_id());
-  EXPECT_EQ("l18", lane_graph_2.lane_sequence(0).lane_segment(1).lane_id());
-  EXPECT_EQ("l21", lane_graph_2.lane_sequence(0).lane_segment(2).lane_id());
+  EXPECT_EQ(1, lane_graph->lane_sequence_size());
+  EXPECT_EQ(3, lane_graph->lane_sequence(0).lane_segment_size());
+  EXPECT_EQ("l9", lane_graph->lane_sequence(0).lane_segment(0).lane_id());
+  EXPECT_EQ("l18", lane_graph->lane_sequence(0).lane_segment(1).lane_id());
+  EXPECT_EQ("l21", lane_graph->lane_sequence(0).lane_segment(2).lane_id());
+
+  // obstacles in the same buckets of start s and length share a lane graph
+  std::shared_ptr<const LaneGraph> lane_graph_2 =
+      ObstacleClusters::GetLaneGraph(start_s + 0.5, length - 1.0, lane);
+  EXPECT_EQ(lane_graph.get(), lane_graph_2.get());
+
+  // which is kept over frames
+  ObstacleClusters::Init();
+  std::shared_ptr<const LaneGraph> lane_graph_3 =
+      ObstacleClusters::GetLaneGraph(start_s, length, lane);
+  EXPECT_EQ(lane_graph.get(), lane_graph_3.get());
+
+  double length_4 = 50.0;
+  std::shared_ptr<const LaneGraph> lane_graph_4 =
+      ObstacleClusters::GetLaneGraph(start_s, length_4, lane);
+  EXPECT_NE(lane_graph.get(), lane_graph_4.get());
+  EXPECT_EQ(1, lane_graph_4->lane_sequence_size());
+  EXPECT_EQ("l9", lane_graph_4->lane_sequence(0).lane_segment(0).lane_id());
 }
 
 }  // namespace prediction
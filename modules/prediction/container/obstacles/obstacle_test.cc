@@ -194,5 +194,18 @@ TEST_F(ObstacleTest, Priority) {
   EXPECT_FALSE(obstacle_ptr->ToIgnore());
 }
 
+TEST_F(ObstacleTest, EvaluationBudget) {
+  Obstacle* obstacle_ptr = container_.GetObstacle(101);
+  EXPECT_FALSE(obstacle_ptr->IsCaution());
+  EXPECT_FALSE(obstacle_ptr->IsBeyondEvaluationBudget());
+  obstacle_ptr->mutable_latest_feature()->mutable_priority()->set_priority(
+      ObstaclePriority::CAUTION);
+  EXPECT_TRUE(obstacle_ptr->IsCaution());
+  obstacle_ptr->SetBeyondEvaluationBudget(true);
+  EXPECT_TRUE(obstacle_ptr->IsBeyondEvaluationBudget());
+  obstacle_ptr->SetBeyondEvaluationBudget(false);
+  EXPECT_FALSE(obstacle_ptr->IsBeyondEvaluationBudget());
+}
+
 }  // namespace prediction
 }  // namespace apollo
@@ -19,6 +19,8 @@
 #include <utility>
 #include <unordered_set>
 
+#include "modules/prediction/common/prediction_thread_pool.h"
+
 #include "modules/prediction/common/feature_output.h"
 #include "modules/prediction/common/junction_analyzer.h"
 #include "modules/prediction/common/prediction_gflags.h"
@@ -102,14 +104,18 @@ void ObstaclesContainer::Insert(const ::google::protobuf::Message& message) {
   // 1. Initialize ObstacleClusters
   ObstacleClusters::Init();
 
-  // 2. Insert the Obstacles one by one
-  for (const PerceptionObstacle& perception_obstacle :
-       perception_obstacles.perception_obstacle()) {
-    ADEBUG << "Perception obstacle [" << perception_obstacle.id() << "] "
-           << "was detected";
-    InsertPerceptionObstacle(perception_obstacle, timestamp_);
-    ADEBUG << "Perception obstacle [" << perception_obstacle.id() << "] "
-           << "was inserted";
+  // 2. Insert the Obstacles
+  if (PredictionThreadPool::NumThreads() > 1) {
+    InsertPerceptionObstaclesInParallel(perception_obstacles);
+  } else {
+    for (const PerceptionObstacle& perception_obstacle :
+         perception_obstacles.perception_obstacle()) {
+      ADEBUG << "Perception obstacle [" << perception_obstacle.id() << "] "
+             << "was detected";
+      InsertPerceptionObstacle(perception_obstacle, timestamp_);
+      ADEBUG << "Perception obstacle [" << perception_obstacle.id() << "] "
+             << "was inserted";
+    }
   }
   // 3. Sort the Obstacles
   ObstacleClusters::SortObstacles();
@@ -173,24 +179,101 @@ std::vector<int> ObstaclesContainer::curr_frame_obstacle_ids() {
 
 void ObstaclesContainer::InsertPerceptionObstacle(
     const PerceptionObstacle& perception_obstacle, const double timestamp) {
+  int id = 0;
+  if (RegisterPerceptionObstacle(perception_obstacle, &id)) {
+    InsertPredictableObstacle(perception_obstacle, timestamp, id);
+  }
+}
+
+void ObstaclesContainer::InsertPerceptionObstaclesInParallel(
+    const PerceptionObstacles& perception_obstacles) {
+  // Only the features of the obstacles are computed in parallel. The
+  // bookkeeping of the container runs in the perception order before and
+  // after, so the ids and the LRU order are the same as with one thread.
+  const int num_obstacles = perception_obstacles.perception_obstacle_size();
+  std::vector<int> ids(num_obstacles, 0);
+  std::vector<bool> to_insert(num_obstacles, false);
+  // an obstacle seen earlier in the frame is inserted sequentially after
+  std::vector<bool> deferred(num_obstacles, false);
+  std::vector<Obstacle*> obstacles(num_obstacles, nullptr);
+  std::vector<std::unique_ptr<Obstacle>> new_obstacles(num_obstacles);
+  std::unordered_set<int> seen_ids;
+  for (int i = 0; i < num_obstacles; ++i) {
+    const PerceptionObstacle& perception_obstacle =
+        perception_obstacles.perception_obstacle(i);
+    if (!RegisterPerceptionObstacle(perception_obstacle, &ids[i])) {
+      continue;
+    }
+    to_insert[i] = true;
+    deferred[i] = !seen_ids.insert(ids[i]).second;
+    obstacles[i] = GetObstacle(ids[i]);
+  }
+
+  PredictionThreadPool::ForEach(num_obstacles, [&](const int i, const int) {
+    if (!to_insert[i] || deferred[i]) {
+      return;
+    }
+    const PerceptionObstacle& perception_obstacle =
+        perception_obstacles.perception_obstacle(i);
+    if (obstacles[i] != nullptr) {
+      obstacles[i]->Insert(perception_obstacle, timestamp_, ids[i]);
+    } else {
+      new_obstacles[i] = Obstacle::Create(perception_obstacle, timestamp_,
+                                          ids[i]);
+    }
+  });
+
+  for (int i = 0; i < num_obstacles; ++i) {
+    if (!to_insert[i]) {
+      continue;
+    }
+    const int id = ids[i];
+    if (deferred[i] ||
+        (obstacles[i] != nullptr && GetObstacleWithLRUUpdate(id) == nullptr)) {
+      // inserted twice in the frame, or evicted by a new obstacle before
+      InsertPredictableObstacle(perception_obstacles.perception_obstacle(i),
+                                timestamp_, id);
+      continue;
+    }
+    if (obstacles[i] == nullptr) {
+      if (new_obstacles[i] == nullptr) {
+        AERROR << "Failed to insert obstacle into container";
+        continue;
+      }
+      ptr_obstacles_.Put(id, std::move(new_obstacles[i]));
+      ADEBUG << "Insert obstacle [" << id << "]";
+    }
+    if (id != -1) {
+      curr_frame_predictable_obstacle_ids_.push_back(id);
+    }
+  }
+}
+
+bool ObstaclesContainer::RegisterPerceptionObstacle(
+    const PerceptionObstacle& perception_obstacle, int* id) {
   // Sanity checks.
-  int id = PerceptionIdToPredictionId(perception_obstacle.id());
-  if (id != perception_obstacle.id()) {
+  *id = PerceptionIdToPredictionId(perception_obstacle.id());
+  if (*id != perception_obstacle.id()) {
     ADEBUG << "Obstacle have got AdaptTracking, with perception id: "
-           << perception_obstacle.id() << ", and prediction id: " << id;
+           << perception_obstacle.id() << ", and prediction id: " << *id;
   }
-  curr_frame_id_perception_obstacle_map_[id] = perception_obstacle;
-  if (id < -1) {
-    AERROR << "Invalid ID [" << id << "]";
-    return;
+  curr_frame_id_perception_obstacle_map_[*id] = perception_obstacle;
+  if (*id < -1) {
+    AERROR << "Invalid ID [" << *id << "]";
+    return false;
   }
   if (!IsPredictable(perception_obstacle)) {
     ADEBUG << "Perception obstacle [" << perception_obstacle.id()
            << "] is not predictable.";
-    curr_frame_non_predictable_obstacle_ids_.push_back(id);
-    return;
+    curr_frame_non_predictable_obstacle_ids_.push_back(*id);
+    return false;
   }
+  return true;
+}
 
+void ObstaclesContainer::InsertPredictableObstacle(
+    const PerceptionObstacle& perception_obstacle, const double timestamp,
+    const int id) {
   // Insert the obstacle and also update the LRUCache.
   auto obstacle_ptr = GetObstacleWithLRUUpdate(id);
   if (obstacle_ptr != nullptr) {
@@ -305,6 +388,8 @@ int ObstaclesContainer::PerceptionIdToPredictionId(const int perception_id) {
 void ObstaclesContainer::BuildLaneGraph() {
   // Go through every obstacle in the current frame, after some
   // sanity checks, build lane graph for non-junction cases.
+  std::vector<Obstacle*> obstacles;
+  obstacles.reserve(curr_frame_predictable_obstacle_ids_.size());
   for (const int id : curr_frame_predictable_obstacle_ids_) {
     Obstacle* obstacle_ptr = GetObstacle(id);
     if (obstacle_ptr == nullptr) {
@@ -315,11 +400,20 @@ void ObstaclesContainer::BuildLaneGraph() {
       ADEBUG << "Ignore obstacle [" << obstacle_ptr->id() << "]";
       continue;
     }
+    if (obstacle_ptr->IsBeyondEvaluationBudget()) {
+      ADEBUG << "Obstacle [" << obstacle_ptr->id() << "] is beyond the "
+             << "evaluation budget, no lane graph is built";
+      continue;
+    }
+    obstacles.push_back(obstacle_ptr);
+  }
+  PredictionThreadPool::ForEach(static_cast<int>(obstacles.size()),
+                                [&obstacles](const int i, const int) {
     ADEBUG << "Building Lane Graph.";
-    obstacle_ptr->BuildLaneGraph();
+    obstacles[i]->BuildLaneGraph();
     ADEBUG << "Building ordered Lane Graph.";
-    obstacle_ptr->BuildLaneGraphFromLeftToRight();
-  }
+    obstacles[i]->BuildLaneGraphFromLeftToRight();
+  });
 }
 
 void ObstaclesContainer::BuildJunctionFeature() {
@@ -119,6 +119,34 @@ class ObstaclesContainer : public Container {
 
  private:
   Obstacle* GetObstacleWithLRUUpdate(const int obstacle_id);
+
+  /**
+   * @brief Insert the perception obstacles of a frame, computing their
+   *        features on the thread pool
+   * @param Perception obstacles
+   */
+  void InsertPerceptionObstaclesInParallel(
+      const perception::PerceptionObstacles& perception_obstacles);
+
+  /**
+   * @brief Record a perception obstacle of the current frame
+   * @param Perception obstacle
+   * @param Prediction id of the obstacle
+   * @return If the obstacle is to be inserted as a predictable one
+   */
+  bool RegisterPerceptionObstacle(
+      const perception::PerceptionObstacle& perception_obstacle, int* id);
+
+  /**
+   * @brief Insert a registered predictable obstacle
+   * @param Perception obstacle
+   * @param Timestamp
+   * @param Prediction id of the obstacle
+   */
+  void InsertPredictableObstacle(
+      const perception::PerceptionObstacle& perception_obstacle,
+      const double timestamp, const int id);
+
   /**
    * @brief Check if a perception_obstacle is an old existed obstacle
    * @param A PerceptionObstacle
@@ -65,6 +65,17 @@ class Evaluator {
     Evaluate(obstacle);
   }
 
+  /**
+    * @brief Evaluate a batch of obstacles. Evaluators running a network
+    *        override it to run the network once for the whole batch.
+    * @param vector of the Obstacles to evaluate
+    */
+  virtual void BatchEvaluate(const std::vector<Obstacle*>& obstacles) {
+    for (Obstacle* obstacle : obstacles) {
+      Evaluate(obstacle);
+    }
+  }
+
   /**
     * @brief Get the name of evaluator
     */
@@ -16,8 +16,11 @@
 
 #include "modules/prediction/evaluator/evaluator_manager.h"
 
+#include <utility>
 #include <vector>
 
+#include "modules/prediction/common/prediction_gflags.h"
+#include "modules/prediction/common/prediction_thread_pool.h"
 #include "modules/prediction/container/container_manager.h"
 #include "modules/prediction/container/obstacles/obstacles_container.h"
 #include "modules/prediction/evaluator/vehicle/cost_evaluator.h"
@@ -92,6 +95,15 @@ void EvaluatorManager::Init(const PredictionConf& config) {
     }
   }
 
+  if (!ObstacleConf::EvaluatorType_Parse(
+          FLAGS_normal_priority_vehicle_on_lane_evaluator,
+          &normal_vehicle_on_lane_evaluator_)) {
+    AERROR << "Unknown evaluator ["
+           << FLAGS_normal_priority_vehicle_on_lane_evaluator
+           << "] for normal priority vehicles on lane.";
+    normal_vehicle_on_lane_evaluator_ = vehicle_on_lane_evaluator_;
+  }
+
   AINFO << "Defined vehicle on lane obstacle evaluator ["
         << vehicle_on_lane_evaluator_ << "]";
   AINFO << "Defined cyclist on lane obstacle evaluator ["
@@ -113,6 +125,9 @@ void EvaluatorManager::Run() {
   CHECK_NOTNULL(obstacles_container);
 
   std::vector<Obstacle*> dynamic_env;
+  // the obstacles of every evaluator are gathered first, so that the
+  // evaluators running a network evaluate all of them in one batch
+  std::vector<std::pair<Evaluator*, std::vector<Obstacle*>>> batches;
   for (int id : obstacles_container->curr_frame_predictable_obstacle_ids()) {
     if (id < 0) {
       ADEBUG << "The obstacle has invalid id [" << id << "].";
@@ -127,13 +142,43 @@ void EvaluatorManager::Run() {
       ADEBUG << "Ignore obstacle [" << id << "] in evaluator_manager";
       continue;
     }
+    if (obstacle->IsBeyondEvaluationBudget()) {
+      ADEBUG << "Obstacle [" << id << "] is beyond the evaluation budget";
+      continue;
+    }
 
-    EvaluateObstacle(obstacle, dynamic_env);
+    Evaluator* evaluator = SelectEvaluator(obstacle);
+    if (evaluator == nullptr) {
+      continue;
+    }
+    size_t batch_index = 0;
+    while (batch_index < batches.size() &&
+           batches[batch_index].first != evaluator) {
+      ++batch_index;
+    }
+    if (batch_index == batches.size()) {
+      batches.emplace_back(evaluator, std::vector<Obstacle*>());
+    }
+    batches[batch_index].second.push_back(obstacle);
   }
+
+  // every evaluator runs on a single thread, the evaluators of different
+  // batches run in parallel
+  PredictionThreadPool::ForEach(static_cast<int>(batches.size()),
+                                [&](const int i, const int) {
+    Evaluator* evaluator = batches[i].first;
+    if (evaluator->GetName() == "LANE_SCANNING_EVALUATOR") {
+      // For evaluators that need surrounding obstacles' info.
+      for (Obstacle* obstacle : batches[i].second) {
+        evaluator->Evaluate(obstacle, dynamic_env);
+      }
+    } else {
+      evaluator->BatchEvaluate(batches[i].second);
+    }
+  });
 }
 
-void EvaluatorManager::EvaluateObstacle(
-    Obstacle* obstacle, std::vector<Obstacle*> dynamic_env) {
+Evaluator* EvaluatorManager::SelectEvaluator(Obstacle* obstacle) {
   Evaluator* evaluator = nullptr;
   // Select different evaluators depending on the obstacle's type.
   switch (obstacle->type()) {
@@ -143,7 +188,13 @@ void EvaluatorManager::EvaluateObstacle(
         evaluator = GetEvaluator(vehicle_in_junction_evaluator_);
         CHECK_NOTNULL(evaluator);
       } else if (obstacle->IsOnLane()) {
-        evaluator = GetEvaluator(vehicle_on_lane_evaluator_);
+        // Only the caution vehicles get the configured evaluator when the
+        // evaluation is budgeted.
+        if (FLAGS_enable_evaluation_budget && !obstacle->IsCaution()) {
+          evaluator = GetEvaluator(normal_vehicle_on_lane_evaluator_);
+        } else {
+          evaluator = GetEvaluator(vehicle_on_lane_evaluator_);
+        }
         CHECK_NOTNULL(evaluator);
       } else {
         ADEBUG << "Obstacle: " << obstacle->id() << " is neither "
@@ -169,6 +220,12 @@ void EvaluatorManager::EvaluateObstacle(
       break;
     }
   }
+  return evaluator;
+}
+
+void EvaluatorManager::EvaluateObstacle(
+    Obstacle* obstacle, std::vector<Obstacle*> dynamic_env) {
+  Evaluator* evaluator = SelectEvaluator(obstacle);
 
   // Evaluate using the selected evaluator.
   if (evaluator != nullptr) {
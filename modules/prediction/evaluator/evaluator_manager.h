@@ -72,6 +72,8 @@ class EvaluatorManager {
    */
   void RegisterEvaluator(const ObstacleConf::EvaluatorType& type);
 
+  Evaluator* SelectEvaluator(Obstacle* obstacle);
+
   /**
    * @brief Create an evaluator by type
    * @param Evaluator type
@@ -100,6 +102,10 @@ class EvaluatorManager {
   ObstacleConf::EvaluatorType default_on_lane_evaluator_ =
       ObstacleConf::MLP_EVALUATOR;
 
+  // used for the normal priority vehicles on lane with an evaluation budget
+  ObstacleConf::EvaluatorType normal_vehicle_on_lane_evaluator_ =
+      ObstacleConf::COST_EVALUATOR;
+
   DECLARE_SINGLETON(EvaluatorManager)
 };
 
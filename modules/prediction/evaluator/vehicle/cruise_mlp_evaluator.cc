@@ -54,25 +54,11 @@ void CruiseMLPEvaluator::Evaluate(Obstacle* obstacle_ptr) {
   // Sanity checks.
   Clear();
   CHECK_NOTNULL(obstacle_ptr);
-  int id = obstacle_ptr->id();
-  if (!obstacle_ptr->latest_feature().IsInitialized()) {
-    AERROR << "Obstacle [" << id << "] has no latest feature.";
+  LaneGraph* lane_graph_ptr = GetLaneGraph(obstacle_ptr);
+  if (lane_graph_ptr == nullptr) {
     return;
   }
   Feature* latest_feature_ptr = obstacle_ptr->mutable_latest_feature();
-  CHECK_NOTNULL(latest_feature_ptr);
-  if (!latest_feature_ptr->has_lane() ||
-      !latest_feature_ptr->lane().has_lane_graph()) {
-    ADEBUG << "Obstacle [" << id << "] has no lane graph.";
-    return;
-  }
-  LaneGraph* lane_graph_ptr =
-      latest_feature_ptr->mutable_lane()->mutable_lane_graph();
-  CHECK_NOTNULL(lane_graph_ptr);
-  if (lane_graph_ptr->lane_sequence_size() == 0) {
-    AERROR << "Obstacle [" << id << "] has no lane sequences.";
-    return;
-  }
 
   ADEBUG << "There are " << lane_graph_ptr->lane_sequence_size()
          << " lane sequences with probabilities:";
@@ -120,6 +106,93 @@ void CruiseMLPEvaluator::Evaluate(Obstacle* obstacle_ptr) {
   }
 }
 
+void CruiseMLPEvaluator::BatchEvaluate(
+    const std::vector<Obstacle*>& obstacles) {
+  // the offline mode saves the features instead of computing probabilities
+  if (FLAGS_prediction_offline_mode == 2) {
+    Evaluator::BatchEvaluate(obstacles);
+    return;
+  }
+  Clear();
+  // the lane sequences the obstacle is on go through the go model, the
+  // others through the cutin model
+  ModelBatch go_batch;
+  ModelBatch cutin_batch;
+  for (Obstacle* obstacle_ptr : obstacles) {
+    CHECK_NOTNULL(obstacle_ptr);
+    LaneGraph* lane_graph_ptr = GetLaneGraph(obstacle_ptr);
+    if (lane_graph_ptr == nullptr) {
+      continue;
+    }
+    for (int i = 0; i < lane_graph_ptr->lane_sequence_size(); ++i) {
+      LaneSequence* lane_sequence_ptr =
+          lane_graph_ptr->mutable_lane_sequence(i);
+      CHECK_NOTNULL(lane_sequence_ptr);
+      std::vector<double> feature_values;
+      ExtractFeatureValues(obstacle_ptr, lane_sequence_ptr, &feature_values);
+      if (feature_values.size() !=
+          OBSTACLE_FEATURE_SIZE + INTERACTION_FEATURE_SIZE +
+              SINGLE_LANE_FEATURE_SIZE * LANE_POINTS_SIZE) {
+        lane_sequence_ptr->set_probability(0.0);
+        ADEBUG << "Skip lane sequence due to incorrect feature size";
+        continue;
+      }
+      ModelBatch* batch =
+          lane_sequence_ptr->vehicle_on_lane() ? &go_batch : &cutin_batch;
+      batch->lane_sequences.push_back(lane_sequence_ptr);
+      batch->lane_features.push_back(VectorToMatrixXf(feature_values,
+          OBSTACLE_FEATURE_SIZE + INTERACTION_FEATURE_SIZE,
+          static_cast<int>(feature_values.size()), SINGLE_LANE_FEATURE_SIZE,
+          LANE_POINTS_SIZE));
+      batch->obs_feature_values.insert(
+          batch->obs_feature_values.end(), feature_values.begin(),
+          feature_values.begin() + OBSTACLE_FEATURE_SIZE);
+    }
+  }
+  BatchRunModel(*go_model_ptr_, go_batch);
+  BatchRunModel(*cutin_model_ptr_, cutin_batch);
+}
+
+void CruiseMLPEvaluator::BatchRunModel(const network::CruiseModel& model,
+                                       const ModelBatch& batch) {
+  if (batch.lane_sequences.empty()) {
+    return;
+  }
+  const Eigen::MatrixXf obs_feature_mat = Eigen::Map<const Eigen::Matrix<
+      float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(
+      batch.obs_feature_values.data(), batch.lane_sequences.size(),
+      OBSTACLE_FEATURE_SIZE);
+  Eigen::MatrixXf model_output;
+  model.BatchRun(batch.lane_features, obs_feature_mat, &model_output);
+  for (size_t i = 0; i < batch.lane_sequences.size(); ++i) {
+    batch.lane_sequences[i]->set_probability(model_output(i, 0));
+    batch.lane_sequences[i]->set_time_to_lane_center(model_output(i, 1));
+  }
+}
+
+LaneGraph* CruiseMLPEvaluator::GetLaneGraph(Obstacle* obstacle_ptr) {
+  int id = obstacle_ptr->id();
+  if (!obstacle_ptr->latest_feature().IsInitialized()) {
+    AERROR << "Obstacle [" << id << "] has no latest feature.";
+    return nullptr;
+  }
+  Feature* latest_feature_ptr = obstacle_ptr->mutable_latest_feature();
+  CHECK_NOTNULL(latest_feature_ptr);
+  if (!latest_feature_ptr->has_lane() ||
+      !latest_feature_ptr->lane().has_lane_graph()) {
+    ADEBUG << "Obstacle [" << id << "] has no lane graph.";
+    return nullptr;
+  }
+  LaneGraph* lane_graph_ptr =
+      latest_feature_ptr->mutable_lane()->mutable_lane_graph();
+  CHECK_NOTNULL(lane_graph_ptr);
+  if (lane_graph_ptr->lane_sequence_size() == 0) {
+    AERROR << "Obstacle [" << id << "] has no lane sequences.";
+    return nullptr;
+  }
+  return lane_graph_ptr;
+}
+
 void CruiseMLPEvaluator::ExtractFeatureValues
     (Obstacle* obstacle_ptr,
      LaneSequence* lane_sequence_ptr,
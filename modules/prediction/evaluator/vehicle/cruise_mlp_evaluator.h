@@ -44,6 +44,13 @@ class CruiseMLPEvaluator : public Evaluator {
    */
   void Evaluate(Obstacle* obstacle_ptr) override;
 
+  /**
+   * @brief Override BatchEvaluate, the lane sequences of all the obstacles
+   *        go through the go and cutin models at once
+   * @param Obstacle pointers
+   */
+  void BatchEvaluate(const std::vector<Obstacle*>& obstacles) override;
+
   /**
    * @brief Extract feature vector
    * @param Obstacle pointer
@@ -89,6 +96,28 @@ class CruiseMLPEvaluator : public Evaluator {
                             const LaneSequence* lane_sequence_ptr,
                             std::vector<double>* feature_values);
 
+  /**
+   * @brief Get the lane graph of an obstacle to evaluate
+   * @param Obstacle pointer
+   * @return Lane graph pointer, nullptr if the obstacle has no lane sequence
+   */
+  LaneGraph* GetLaneGraph(Obstacle* obstacle_ptr);
+
+  struct ModelBatch {
+    std::vector<LaneSequence*> lane_sequences;
+    std::vector<Eigen::MatrixXf> lane_features;
+    // obstacle feature values of the lane sequences, concatenated
+    std::vector<float> obs_feature_values;
+  };
+
+  /**
+   * @brief Run a model on a batch of lane sequences
+   * @param Model
+   *        Batch of lane sequences and their features
+   */
+  void BatchRunModel(const network::CruiseModel& model,
+                     const ModelBatch& batch);
+
   /**
    * @brief Load mode files
    * @param Go model file name
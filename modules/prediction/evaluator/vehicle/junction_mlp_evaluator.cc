@@ -61,20 +61,10 @@ void JunctionMLPEvaluator::Evaluate(Obstacle* obstacle_ptr) {
   // Sanity checks.
   Clear();
   CHECK_NOTNULL(obstacle_ptr);
-  int id = obstacle_ptr->id();
-  if (!obstacle_ptr->latest_feature().IsInitialized()) {
-    AERROR << "Obstacle [" << id << "] has no latest feature.";
+  if (!HasJunctionExits(obstacle_ptr)) {
     return;
   }
   Feature* latest_feature_ptr = obstacle_ptr->mutable_latest_feature();
-  CHECK_NOTNULL(latest_feature_ptr);
-
-  // Assume obstacle is NOT closed to any junction exit
-  if (!latest_feature_ptr->has_junction_feature() ||
-      latest_feature_ptr->junction_feature().junction_exit_size() < 1) {
-    ADEBUG << "Obstacle [" << id << "] has no junction_exit.";
-    return;
-  }
 
   std::vector<double> feature_values;
   ExtractFeatureValues(obstacle_ptr, &feature_values);
@@ -94,6 +84,91 @@ void JunctionMLPEvaluator::Evaluate(Obstacle* obstacle_ptr) {
       probability.push_back(feature_values[3 + 6 * i]);
     }
   }
+  SetProbability(obstacle_ptr, probability);
+}
+
+void JunctionMLPEvaluator::BatchEvaluate(
+    const std::vector<Obstacle*>& obstacles) {
+  // the offline mode saves the features instead of computing probabilities
+  if (FLAGS_prediction_offline_mode == 2 || !batch_model_loaded_) {
+    Evaluator::BatchEvaluate(obstacles);
+    return;
+  }
+  Clear();
+  const size_t dim_input = static_cast<size_t>(batch_model_.dim_input());
+  std::vector<Obstacle*> model_obstacles;
+  std::vector<double> batch_feature_values;
+  for (Obstacle* obstacle_ptr : obstacles) {
+    CHECK_NOTNULL(obstacle_ptr);
+    if (!HasJunctionExits(obstacle_ptr)) {
+      continue;
+    }
+    std::vector<double> feature_values;
+    ExtractFeatureValues(obstacle_ptr, &feature_values);
+    if (obstacle_ptr->latest_feature().junction_feature()
+            .junction_exit_size() == 1) {
+      std::vector<double> probability;
+      for (int i = 0; i < 12; ++i) {
+        probability.push_back(feature_values[3 + 6 * i]);
+      }
+      SetProbability(obstacle_ptr, probability);
+      continue;
+    }
+    if (feature_values.size() != dim_input) {
+      ADEBUG << "Model feature size not consistent with model proto "
+             << "definition. model input dim = " << dim_input
+             << "; feature value size = " << feature_values.size();
+      continue;
+    }
+    model_obstacles.push_back(obstacle_ptr);
+    batch_feature_values.insert(batch_feature_values.end(),
+                                feature_values.begin(), feature_values.end());
+  }
+  if (model_obstacles.empty()) {
+    return;
+  }
+
+  const Eigen::MatrixXd inputs = Eigen::Map<const Eigen::Matrix<
+      double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(
+      batch_feature_values.data(), model_obstacles.size(), dim_input);
+  Eigen::MatrixXd outputs;
+  batch_model_.Run(inputs, &outputs);
+  if (outputs.cols() != 12) {
+    AERROR << "Model output layer has incorrect # outputs: "
+           << outputs.cols();
+    return;
+  }
+  for (size_t i = 0; i < model_obstacles.size(); ++i) {
+    std::vector<double> probability(outputs.cols());
+    for (int j = 0; j < outputs.cols(); ++j) {
+      probability[j] = outputs(i, j);
+    }
+    SetProbability(model_obstacles[i], probability);
+  }
+}
+
+bool JunctionMLPEvaluator::HasJunctionExits(Obstacle* obstacle_ptr) {
+  int id = obstacle_ptr->id();
+  if (!obstacle_ptr->latest_feature().IsInitialized()) {
+    AERROR << "Obstacle [" << id << "] has no latest feature.";
+    return false;
+  }
+  const Feature& latest_feature = obstacle_ptr->latest_feature();
+
+  // Assume obstacle is NOT closed to any junction exit
+  if (!latest_feature.has_junction_feature() ||
+      latest_feature.junction_feature().junction_exit_size() < 1) {
+    ADEBUG << "Obstacle [" << id << "] has no junction_exit.";
+    return false;
+  }
+  return true;
+}
+
+void JunctionMLPEvaluator::SetProbability(
+    Obstacle* obstacle_ptr, const std::vector<double>& probability) {
+  int id = obstacle_ptr->id();
+  Feature* latest_feature_ptr = obstacle_ptr->mutable_latest_feature();
+  CHECK_NOTNULL(latest_feature_ptr);
   for (double prob : probability) {
     latest_feature_ptr->mutable_junction_feature()
                       ->add_junction_mlp_probability(prob);
@@ -310,6 +385,10 @@ void JunctionMLPEvaluator::LoadModel(const std::string& model_file) {
   CHECK(model_ptr_ != nullptr);
   CHECK(common::util::GetProtoFromFile(model_file, model_ptr_.get()))
       << "Unable to load model file: " << model_file << ".";
+  batch_model_loaded_ = batch_model_.LoadModel(*model_ptr_, false);
+  if (!batch_model_loaded_) {
+    AWARN << "Model of " << model_file << " can not be evaluated in batch.";
+  }
 
   AINFO << "Succeeded in loading the model file: " << model_file << ".";
 }
@@ -323,8 +402,7 @@ std::vector<double> JunctionMLPEvaluator::ComputeProbability(
            << "; feature value size = " << feature_values.size();
     return {};
   }
-  std::vector<double> layer_input;
-  layer_input.reserve(model_ptr_->dim_input());
+  std::vector<double> layer_input = feature_values;
   std::vector<double> layer_output;
   for (int i = 0; i < model_ptr_->num_layer(); ++i) {
     if (i > 0) {
@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "modules/prediction/evaluator/evaluator.h"
+#include "modules/prediction/network/fnn_model.h"
 #include "modules/prediction/proto/fnn_vehicle_model.pb.h"
 
 namespace apollo {
@@ -49,6 +50,13 @@ class JunctionMLPEvaluator : public Evaluator {
    */
   void Evaluate(Obstacle* obstacle_ptr) override;
 
+  /**
+   * @brief Override BatchEvaluate, the obstacles with several junction
+   *        exits go through the model at once
+   * @param Obstacle pointers
+   */
+  void BatchEvaluate(const std::vector<Obstacle*>& obstacles) override;
+
   /**
    * @brief Extract feature vector
    * @param Obstacle pointer
@@ -87,6 +95,20 @@ class JunctionMLPEvaluator : public Evaluator {
   void SetJunctionFeatureValues(Obstacle* obstacle_ptr,
                                 std::vector<double>* const feature_values);
 
+  /**
+   * @brief Check whether an obstacle has junction exits to evaluate
+   * @param Obstacle pointer
+   */
+  bool HasJunctionExits(Obstacle* obstacle_ptr);
+
+  /**
+   * @brief Set the junction exit and lane sequence probabilities
+   * @param Obstacle pointer
+   *        Probabilities of the 12 junction sectors
+   */
+  void SetProbability(Obstacle* obstacle_ptr,
+                      const std::vector<double>& probability);
+
   /**
    * @brief Load mode file
    * @param Model file name
@@ -105,6 +127,8 @@ class JunctionMLPEvaluator : public Evaluator {
   static const size_t JUNCTION_FEATURE_SIZE = 72;
 
   std::unique_ptr<FnnVehicleModel> model_ptr_;
+  network::FnnModel batch_model_;
+  bool batch_model_loaded_ = false;
 };
 
 }  // namespace prediction
@@ -49,32 +49,13 @@ void MLPEvaluator::Clear() { obstacle_feature_values_map_.clear(); }
 void MLPEvaluator::Evaluate(Obstacle* obstacle_ptr) {
   Clear();
   CHECK_NOTNULL(obstacle_ptr);
-  CHECK_LE(LANE_FEATURE_SIZE, 4 * FLAGS_max_num_lane_point);
-
-  int id = obstacle_ptr->id();
-  if (!obstacle_ptr->latest_feature().IsInitialized()) {
-    AERROR << "Obstacle [" << id << "] has no latest feature.";
+  LaneGraph* lane_graph_ptr = GetLaneGraph(obstacle_ptr);
+  if (lane_graph_ptr == nullptr) {
     return;
   }
-
   Feature* latest_feature_ptr = obstacle_ptr->mutable_latest_feature();
-  CHECK_NOTNULL(latest_feature_ptr);
-  if (!latest_feature_ptr->has_lane() ||
-      !latest_feature_ptr->lane().has_lane_graph()) {
-    ADEBUG << "Obstacle [" << id << "] has no lane graph.";
-    return;
-  }
-
   double speed = latest_feature_ptr->speed();
 
-  LaneGraph* lane_graph_ptr =
-      latest_feature_ptr->mutable_lane()->mutable_lane_graph();
-  CHECK_NOTNULL(lane_graph_ptr);
-  if (lane_graph_ptr->lane_sequence_size() == 0) {
-    AERROR << "Obstacle [" << id << "] has no lane sequences.";
-    return;
-  }
-
   for (int i = 0; i < lane_graph_ptr->lane_sequence_size(); ++i) {
     LaneSequence* lane_sequence_ptr = lane_graph_ptr->mutable_lane_sequence(i);
     CHECK(lane_sequence_ptr != nullptr);
@@ -98,6 +79,94 @@ void MLPEvaluator::Evaluate(Obstacle* obstacle_ptr) {
   }
 }
 
+void MLPEvaluator::BatchEvaluate(const std::vector<Obstacle*>& obstacles) {
+  // the offline mode saves the features instead of computing probabilities
+  if (FLAGS_prediction_offline_mode == 2 || !batch_model_loaded_) {
+    Evaluator::BatchEvaluate(obstacles);
+    return;
+  }
+  Clear();
+  const size_t dim_input = static_cast<size_t>(batch_model_.dim_input());
+  std::vector<LaneSequence*> lane_sequences;
+  std::vector<double> speeds;
+  std::vector<double> batch_feature_values;
+  for (Obstacle* obstacle_ptr : obstacles) {
+    CHECK_NOTNULL(obstacle_ptr);
+    LaneGraph* lane_graph_ptr = GetLaneGraph(obstacle_ptr);
+    if (lane_graph_ptr == nullptr) {
+      continue;
+    }
+    double speed = obstacle_ptr->latest_feature().speed();
+    for (int i = 0; i < lane_graph_ptr->lane_sequence_size(); ++i) {
+      LaneSequence* lane_sequence_ptr =
+          lane_graph_ptr->mutable_lane_sequence(i);
+      CHECK(lane_sequence_ptr != nullptr);
+      std::vector<double> feature_values;
+      ExtractFeatureValues(obstacle_ptr, lane_sequence_ptr, &feature_values);
+      if (feature_values.size() != dim_input) {
+        ADEBUG << "Model feature size not consistent with model proto "
+               << "definition. model input dim = " << dim_input
+               << "; feature value size = " << feature_values.size();
+        lane_sequence_ptr->set_probability(0.0);
+        continue;
+      }
+      lane_sequences.push_back(lane_sequence_ptr);
+      speeds.push_back(speed);
+      batch_feature_values.insert(batch_feature_values.end(),
+                                  feature_values.begin(),
+                                  feature_values.end());
+    }
+  }
+  if (lane_sequences.empty()) {
+    return;
+  }
+
+  const Eigen::MatrixXd inputs = Eigen::Map<const Eigen::Matrix<
+      double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>(
+      batch_feature_values.data(), lane_sequences.size(), dim_input);
+  Eigen::MatrixXd outputs;
+  batch_model_.Run(inputs, &outputs);
+  if (outputs.cols() != 1) {
+    AERROR << "Model output layer has incorrect # outputs: "
+           << outputs.cols();
+  }
+  for (size_t i = 0; i < lane_sequences.size(); ++i) {
+    double probability = outputs.cols() == 1 ? outputs(i, 0) : 0.0;
+    double centripetal_acc_probability =
+        ValidationChecker::ProbabilityByCentripetalAcceleration(
+            *lane_sequences[i], speeds[i]);
+    lane_sequences[i]->set_probability(probability *
+                                       centripetal_acc_probability);
+  }
+}
+
+LaneGraph* MLPEvaluator::GetLaneGraph(Obstacle* obstacle_ptr) {
+  CHECK_LE(LANE_FEATURE_SIZE, 4 * FLAGS_max_num_lane_point);
+
+  int id = obstacle_ptr->id();
+  if (!obstacle_ptr->latest_feature().IsInitialized()) {
+    AERROR << "Obstacle [" << id << "] has no latest feature.";
+    return nullptr;
+  }
+
+  Feature* latest_feature_ptr = obstacle_ptr->mutable_latest_feature();
+  CHECK_NOTNULL(latest_feature_ptr);
+  if (!latest_feature_ptr->has_lane() ||
+      !latest_feature_ptr->lane().has_lane_graph()) {
+    ADEBUG << "Obstacle [" << id << "] has no lane graph.";
+    return nullptr;
+  }
+
+  LaneGraph* lane_graph_ptr =
+      latest_feature_ptr->mutable_lane()->mutable_lane_graph();
+  CHECK_NOTNULL(lane_graph_ptr);
+  if (lane_graph_ptr->lane_sequence_size() == 0) {
+    AERROR << "Obstacle [" << id << "] has no lane sequences.";
+    return nullptr;
+  }
+  return lane_graph_ptr;
+}
+
 void MLPEvaluator::ExtractFeatureValues(Obstacle* obstacle_ptr,
                                         LaneSequence* lane_sequence_ptr,
                                         std::vector<double>* feature_values) {
@@ -335,6 +404,10 @@ void MLPEvaluator::LoadModel(const std::string& model_file) {
   CHECK(model_ptr_ != nullptr);
   CHECK(cyber::common::GetProtoFromFile(model_file, model_ptr_.get()))
       << "Unable to load model file: " << model_file << ".";
+  batch_model_loaded_ = batch_model_.LoadModel(*model_ptr_, true);
+  if (!batch_model_loaded_) {
+    AWARN << "Model of " << model_file << " can not be evaluated in batch.";
+  }
 
   AINFO << "Succeeded in loading the model file: " << model_file << ".";
 }
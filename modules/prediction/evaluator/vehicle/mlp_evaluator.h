@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "modules/prediction/evaluator/evaluator.h"
+#include "modules/prediction/network/fnn_model.h"
 #include "modules/prediction/proto/fnn_vehicle_model.pb.h"
 
 namespace apollo {
@@ -45,6 +46,13 @@ class MLPEvaluator : public Evaluator {
    */
   void Evaluate(Obstacle* obstacle_ptr) override;
 
+  /**
+   * @brief Override BatchEvaluate, the lane sequences of all the obstacles
+   *        go through the model at once
+   * @param Obstacle pointers
+   */
+  void BatchEvaluate(const std::vector<Obstacle*>& obstacles) override;
+
   /**
    * @brief Extract feature vector
    * @param Obstacle pointer
@@ -83,6 +91,13 @@ class MLPEvaluator : public Evaluator {
                             LaneSequence* lane_sequence_ptr,
                             std::vector<double>* feature_values);
 
+  /**
+   * @brief Get the lane graph of an obstacle to evaluate
+   * @param Obstacle pointer
+   * @return Lane graph pointer, nullptr if the obstacle has no lane sequence
+   */
+  LaneGraph* GetLaneGraph(Obstacle* obstacle_ptr);
+
   /**
    * @brief Load mode file
    * @param Model file name
@@ -108,6 +123,8 @@ class MLPEvaluator : public Evaluator {
   static const size_t LANE_FEATURE_SIZE = 40;
 
   std::unique_ptr<FnnVehicleModel> model_ptr_;
+  network::FnnModel batch_model_;
+  bool batch_model_loaded_ = false;
 };
 
 }  // namespace prediction
@@ -22,115 +22,120 @@ namespace apollo {
 namespace prediction {
 namespace network {
 
+namespace {
+
+struct Workspace {
+  Eigen::MatrixXf lane_conv1d_0;
+  Eigen::MatrixXf lane_conv1d_2;
+  Eigen::MatrixXf lane_maxpool1d;
+  Eigen::MatrixXf lane_avgpool1d;
+  Eigen::MatrixXf lane_feature;
+  Eigen::MatrixXf obs_linear_0;
+  Eigen::MatrixXf obs_feature;
+  Eigen::MatrixXf feature_values;
+  Eigen::MatrixXf classify_linear_9;
+  Eigen::MatrixXf regress_input;
+  // outputs of the hidden layers, used in turn
+  Eigen::MatrixXf layer_0;
+  Eigen::MatrixXf layer_1;
+};
+
+}  // namespace
+
 void CruiseModel::Run(const std::vector<Eigen::MatrixXf>& inputs,
                       Eigen::MatrixXf* output) const {
   // inputs = {lane_feature, obs_feature}
   CHECK_EQ(inputs.size(), 2);
-  output->resize(1, 2);
-
-  // Step 1: Run lane feature conv 1d
-  Eigen::MatrixXf lane_conv1d_0_output;
-  lane_conv1d_0_->Run({inputs[0]}, &lane_conv1d_0_output);
-  Eigen::MatrixXf lane_activation_1_output;
-  lane_activation_1_->Run({lane_conv1d_0_output}, &lane_activation_1_output);
-  Eigen::MatrixXf lane_conv1d_2_output;
-  lane_conv1d_2_->Run({lane_activation_1_output}, &lane_conv1d_2_output);
-
-  // Step 2: Run lane feature max pool 1d
-  Eigen::MatrixXf lane_maxpool1d_output;
-  lane_maxpool1d_->Run({lane_conv1d_2_output}, &lane_maxpool1d_output);
-  Eigen::MatrixXf lane_maxpool1d_flat = FlattenMatrix(lane_maxpool1d_output);
-
-  // Step 3: Run lane feature avg pool 1d
-  Eigen::MatrixXf lane_avgpool1d_output;
-  lane_avgpool1d_->Run({lane_conv1d_2_output}, &lane_avgpool1d_output);
-  Eigen::MatrixXf lane_avgpool1d_flat = FlattenMatrix(lane_avgpool1d_output);
+  BatchRun({inputs[0]}, inputs[1], output);
+}
 
-  Eigen::MatrixXf lane_feature;
-  concatenate_->Run({lane_maxpool1d_flat, lane_avgpool1d_flat}, &lane_feature);
+void CruiseModel::BatchRun(const std::vector<Eigen::MatrixXf>& lane_features,
+                           const Eigen::MatrixXf& obs_features,
+                           Eigen::MatrixXf* output) const {
+  const int batch_size = static_cast<int>(lane_features.size());
+  CHECK_GT(batch_size, 0);
+  CHECK_EQ(obs_features.rows(), batch_size);
+  output->resize(batch_size, 2);
+
+  // The intermediate outputs live in a workspace of the calling thread and
+  // keep their storage from one run to the next. The activations run in
+  // place on the outputs of the layers before them.
+  static thread_local Workspace workspace;
+  Workspace* ws = &workspace;
+
+  // Step 1-3: Run lane feature conv 1d, max pool 1d and avg pool 1d,
+  // a row of lane feature per sample
+  for (int i = 0; i < batch_size; ++i) {
+    lane_conv1d_0_->RunSingleInput(lane_features[i], &ws->lane_conv1d_0);
+    lane_activation_1_->Apply(&ws->lane_conv1d_0);
+    lane_conv1d_2_->RunSingleInput(ws->lane_conv1d_0, &ws->lane_conv1d_2);
+    lane_maxpool1d_->RunSingleInput(ws->lane_conv1d_2, &ws->lane_maxpool1d);
+    lane_avgpool1d_->RunSingleInput(ws->lane_conv1d_2, &ws->lane_avgpool1d);
+
+    // concatenation of the flattened max pool and avg pool outputs
+    const int maxpool_size = static_cast<int>(ws->lane_maxpool1d.size());
+    const int avgpool_size = static_cast<int>(ws->lane_avgpool1d.size());
+    if (i == 0) {
+      ws->lane_feature.resize(batch_size, maxpool_size + avgpool_size);
+    }
+    FlattenMatrix(ws->lane_maxpool1d, i, 0, &ws->lane_feature);
+    FlattenMatrix(ws->lane_avgpool1d, i, maxpool_size, &ws->lane_feature);
+  }
 
   // Step 4: Run obstacle feature fully connected
-  Eigen::MatrixXf obs_linear_0_output;
-  obs_linear_0_->Run({inputs[1]}, &obs_linear_0_output);
-  Eigen::MatrixXf obs_activation_1_output;
-  obs_activation_1_->Run({obs_linear_0_output}, &obs_activation_1_output);
-  Eigen::MatrixXf obs_linear_3_output;
-  obs_linear_3_->Run({obs_activation_1_output}, &obs_linear_3_output);
-  Eigen::MatrixXf obs_feature;
-  obs_activation_4_->Run({obs_linear_3_output}, &obs_feature);
+  obs_linear_0_->RunSingleInput(obs_features, &ws->obs_linear_0);
+  obs_activation_1_->Apply(&ws->obs_linear_0);
+  obs_linear_3_->RunSingleInput(ws->obs_linear_0, &ws->obs_feature);
+  obs_activation_4_->Apply(&ws->obs_feature);
 
   // Step 5: Concatenate [lane_feature, obstacle_feature]
-  Eigen::MatrixXf feature_values;
-  concatenate_->Run({lane_feature, obs_feature}, &feature_values);
+  concatenate_->Run(ws->lane_feature, ws->obs_feature, &ws->feature_values);
 
   // Step 6: Get classification result
-  Eigen::MatrixXf classify_linear_0_output;
-  classify_linear_0_->Run({feature_values}, &classify_linear_0_output);
-  Eigen::MatrixXf classify_activation_1_output;
-  classify_activation_1_->Run({classify_linear_0_output},
-                              &classify_activation_1_output);
-  Eigen::MatrixXf classify_linear_3_output;
-  classify_linear_3_->Run({classify_activation_1_output},
-                          &classify_linear_3_output);
-  Eigen::MatrixXf classify_activation_4_output;
-  classify_activation_4_->Run({classify_linear_3_output},
-                              &classify_activation_4_output);
-  Eigen::MatrixXf classify_linear_6_output;
-  classify_linear_6_->Run({classify_activation_4_output},
-                          &classify_linear_6_output);
-  Eigen::MatrixXf classify_activation_7_output;
-  classify_activation_7_->Run({classify_linear_6_output},
-                              &classify_activation_7_output);
-  Eigen::MatrixXf classify_linear_9_output;
-  classify_linear_9_->Run({classify_activation_7_output},
-                          &classify_linear_9_output);
-  Eigen::MatrixXf classify_activation_10_output;
-  classify_activation_10_->Run({classify_linear_9_output},
-                               &classify_activation_10_output);
-
-  CHECK_EQ(classify_activation_10_output.cols(), 1);
-  float probability = classify_activation_10_output(0, 0);
-  (*output)(0, 0) = probability;
-
-  // Step 7: Get regression result
-  if (probability < FLAGS_lane_sequence_threshold_cruise ||
-      !FLAGS_enable_cruise_regression) {
-    (*output)(0, 1) = static_cast<float>(FLAGS_time_to_center_if_not_reach);
+  classify_linear_0_->RunSingleInput(ws->feature_values, &ws->layer_0);
+  classify_activation_1_->Apply(&ws->layer_0);
+  classify_linear_3_->RunSingleInput(ws->layer_0, &ws->layer_1);
+  classify_activation_4_->Apply(&ws->layer_1);
+  classify_linear_6_->RunSingleInput(ws->layer_1, &ws->layer_0);
+  classify_activation_7_->Apply(&ws->layer_0);
+  // the output of linear 9 before activation is a regression input
+  classify_linear_9_->RunSingleInput(ws->layer_0, &ws->classify_linear_9);
+  classify_activation_10_->RunSingleInput(ws->classify_linear_9,
+                                          &ws->layer_1);
+
+  CHECK_EQ(ws->layer_1.cols(), 1);
+  bool need_regression = false;
+  for (int i = 0; i < batch_size; ++i) {
+    float probability = ws->layer_1(i, 0);
+    (*output)(i, 0) = probability;
+    (*output)(i, 1) = static_cast<float>(FLAGS_time_to_center_if_not_reach);
+    if (probability >= FLAGS_lane_sequence_threshold_cruise) {
+      need_regression = true;
+    }
+  }
+  if (!need_regression || !FLAGS_enable_cruise_regression) {
     return;
   }
 
-  Eigen::MatrixXf feature_values_regress;
-  concatenate_->Run({feature_values, classify_linear_9_output},
-                    &feature_values_regress);
-
-  Eigen::MatrixXf regress_linear_0_output;
-  regress_linear_0_->Run({feature_values_regress}, &regress_linear_0_output);
-
-  Eigen::MatrixXf regress_activation_1_output;
-  regress_activation_1_->Run({regress_linear_0_output},
-                             &regress_activation_1_output);
-  Eigen::MatrixXf regress_linear_3_output;
-  regress_linear_3_->Run({regress_activation_1_output},
-                          &regress_linear_3_output);
-  Eigen::MatrixXf regress_activation_4_output;
-  regress_activation_4_->Run({regress_linear_3_output},
-                             &regress_activation_4_output);
-  Eigen::MatrixXf regress_linear_6_output;
-  regress_linear_6_->Run({regress_activation_4_output},
-                         &regress_linear_6_output);
-  Eigen::MatrixXf regress_activation_7_output;
-  regress_activation_7_->Run({regress_linear_6_output},
-                             &regress_activation_7_output);
-  Eigen::MatrixXf regress_linear_9_output;
-  regress_linear_9_->Run({regress_activation_7_output},
-                         &regress_linear_9_output);
-  Eigen::MatrixXf regress_activation_10_output;
-  regress_activation_10_->Run({regress_linear_9_output},
-                              &regress_activation_10_output);
-
-  CHECK_EQ(classify_activation_10_output.cols(), 1);
-  float time_to_lane_center = regress_activation_10_output(0, 0);
-  (*output)(0, 1) = time_to_lane_center;
+  // Step 7: Get regression result
+  concatenate_->Run(ws->feature_values, ws->classify_linear_9,
+                    &ws->regress_input);
+  regress_linear_0_->RunSingleInput(ws->regress_input, &ws->layer_0);
+  regress_activation_1_->Apply(&ws->layer_0);
+  regress_linear_3_->RunSingleInput(ws->layer_0, &ws->layer_1);
+  regress_activation_4_->Apply(&ws->layer_1);
+  regress_linear_6_->RunSingleInput(ws->layer_1, &ws->layer_0);
+  regress_activation_7_->Apply(&ws->layer_0);
+  regress_linear_9_->RunSingleInput(ws->layer_0, &ws->layer_1);
+  regress_activation_10_->Apply(&ws->layer_1);
+
+  CHECK_EQ(ws->layer_1.cols(), 1);
+  // the regression only applies to the samples likely to reach the lane
+  for (int i = 0; i < batch_size; ++i) {
+    if ((*output)(i, 0) >= FLAGS_lane_sequence_threshold_cruise) {
+      (*output)(i, 1) = ws->layer_1(i, 0);
+    }
+  }
 }
 
 bool CruiseModel::LoadModel(
@@ -45,6 +45,18 @@ class CruiseModel : public NetModel {
   void Run(const std::vector<Eigen::MatrixXf>& inputs,
            Eigen::MatrixXf* output) const override;
 
+  /**
+   * @brief Compute the model outputs of a batch of samples. The lane
+   *        features are convolved sample by sample, the fully connected
+   *        layers run once for the whole batch.
+   * @param Lane feature matrices, one per sample
+   * @param Obstacle features, a row per sample
+   * @param Output, a row of probability and time to lane center per sample
+   */
+  void BatchRun(const std::vector<Eigen::MatrixXf>& lane_features,
+                const Eigen::MatrixXf& obs_features,
+                Eigen::MatrixXf* output) const;
+
  private:
   // LaneFeatureConvParameter
   std::unique_ptr<Conv1d> lane_conv1d_0_ =
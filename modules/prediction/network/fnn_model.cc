@@ -0,0 +1,129 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/prediction/network/fnn_model.h"
+
+#include <utility>
+
+#include "cyber/common/log.h"
+
+namespace apollo {
+namespace prediction {
+namespace network {
+
+bool FnnModel::LoadModel(const FnnVehicleModel& model_parameter,
+                         bool normalize_input) {
+  dim_input_ = model_parameter.dim_input();
+  normalize_input_ = normalize_input;
+  if (normalize_input_) {
+    if (model_parameter.samples_mean().columns_size() != dim_input_ ||
+        model_parameter.samples_std().columns_size() != dim_input_) {
+      AERROR << "Samples mean or std does not match the input dim "
+             << dim_input_;
+      return false;
+    }
+    samples_mean_.resize(dim_input_);
+    samples_std_.resize(dim_input_);
+    for (int i = 0; i < dim_input_; ++i) {
+      samples_mean_(i) = model_parameter.samples_mean().columns(i);
+      // same epsilon as math_util::Normalize
+      samples_std_(i) = model_parameter.samples_std().columns(i) + 1e-10;
+    }
+  }
+
+  layers_.clear();
+  layers_.reserve(model_parameter.layer_size());
+  int dim = dim_input_;
+  for (const Layer& layer : model_parameter.layer()) {
+    const Matrix& weights = layer.layer_input_weight();
+    if (weights.rows_size() != dim || weights.rows_size() == 0) {
+      AERROR << "Layer input dim " << weights.rows_size()
+             << " does not match the previous output dim " << dim;
+      return false;
+    }
+    const int output_dim = weights.rows(0).columns_size();
+    if (layer.layer_bias().columns_size() != output_dim) {
+      AERROR << "Layer bias size " << layer.layer_bias().columns_size()
+             << " does not match the output dim " << output_dim;
+      return false;
+    }
+    FnnLayer fnn_layer;
+    fnn_layer.weights.resize(dim, output_dim);
+    for (int row = 0; row < dim; ++row) {
+      if (weights.rows(row).columns_size() != output_dim) {
+        AERROR << "Inconsistent layer weight row " << row;
+        return false;
+      }
+      for (int col = 0; col < output_dim; ++col) {
+        fnn_layer.weights(row, col) = weights.rows(row).columns(col);
+      }
+    }
+    fnn_layer.bias.resize(output_dim);
+    for (int col = 0; col < output_dim; ++col) {
+      fnn_layer.bias(col) = layer.layer_bias().columns(col);
+    }
+    fnn_layer.activation = layer.layer_activation_func();
+    layers_.push_back(std::move(fnn_layer));
+    dim = output_dim;
+  }
+  return true;
+}
+
+void FnnModel::Run(const Eigen::MatrixXd& inputs,
+                   Eigen::MatrixXd* outputs) const {
+  CHECK_NOTNULL(outputs);
+  CHECK_EQ(inputs.cols(), dim_input_);
+  Eigen::MatrixXd layer_output = inputs;
+  if (normalize_input_) {
+    layer_output = ((layer_output.rowwise() - samples_mean_).array().rowwise() /
+                    samples_std_.array())
+                       .matrix();
+  }
+  for (const FnnLayer& layer : layers_) {
+    Eigen::MatrixXd layer_input;
+    layer_input.swap(layer_output);
+    layer_output.noalias() = layer_input * layer.weights;
+    layer_output.rowwise() += layer.bias;
+    switch (layer.activation) {
+      case Layer::RELU:
+        layer_output = layer_output.cwiseMax(0.0);
+        break;
+      case Layer::TANH:
+        layer_output = layer_output.array().tanh().matrix();
+        break;
+      case Layer::SIGMOID:
+        layer_output =
+            (1.0 / (1.0 + (-layer_output.array()).exp())).matrix();
+        break;
+      case Layer::SOFTMAX: {
+        // same as math_util::Softmax without exp
+        layer_output = layer_output.cwiseMax(0.001);
+        const Eigen::VectorXd sums = layer_output.rowwise().sum();
+        for (int i = 0; i < layer_output.rows(); ++i) {
+          layer_output.row(i) /= sums(i);
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+  *outputs = std::move(layer_output);
+}
+
+}  // namespace network
+}  // namespace prediction
+}  // namespace apollo
@@ -0,0 +1,83 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Batched evaluation of a fully connected vehicle model
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include "modules/prediction/proto/fnn_vehicle_model.pb.h"
+
+/**
+ * @namespace apollo::prediction::network
+ * @brief apollo::prediction::network
+ */
+namespace apollo {
+namespace prediction {
+namespace network {
+
+/**
+ * @class FnnModel
+ * @brief A FnnVehicleModel whose layers are unpacked into eigen matrices
+ *        once, so that a batch of feature vectors, one per row, goes
+ *        through every layer with a single matrix product.
+ */
+class FnnModel {
+ public:
+  /**
+   * @brief Unpack the layers of a model
+   * @param Model parameters
+   * @param Whether the inputs are normalized by the samples mean and std
+   * @return True if the dimensions of the layers are consistent
+   */
+  bool LoadModel(const FnnVehicleModel& model_parameter,
+                 bool normalize_input);
+
+  /**
+   * @brief Compute the outputs of a batch of samples
+   * @param Inputs, a row of dim_input feature values per sample
+   * @param Outputs, a row of output values per sample
+   */
+  void Run(const Eigen::MatrixXd& inputs, Eigen::MatrixXd* outputs) const;
+
+  /**
+   * @brief Get the dimension of the input feature values
+   */
+  int dim_input() const { return dim_input_; }
+
+ private:
+  struct FnnLayer {
+    Eigen::MatrixXd weights;
+    Eigen::RowVectorXd bias;
+    apollo::prediction::Layer::ActivationFunc activation;
+  };
+
+  int dim_input_ = 0;
+  bool normalize_input_ = false;
+  Eigen::RowVectorXd samples_mean_;
+  Eigen::RowVectorXd samples_std_;
+  std::vector<FnnLayer> layers_;
+};
+
+}  // namespace network
+}  // namespace prediction
+}  // namespace apollo
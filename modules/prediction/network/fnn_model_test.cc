@@ -0,0 +1,113 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/prediction/network/fnn_model.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace prediction {
+namespace network {
+
+namespace {
+
+void SetLayer(const std::vector<std::vector<double>>& weights,
+              const std::vector<double>& bias,
+              Layer::ActivationFunc activation, Layer* layer) {
+  layer->set_layer_input_dim(static_cast<int>(weights.size()));
+  layer->set_layer_output_dim(static_cast<int>(bias.size()));
+  for (const auto& row : weights) {
+    Vector* row_pb = layer->mutable_layer_input_weight()->add_rows();
+    for (double value : row) {
+      row_pb->add_columns(value);
+    }
+  }
+  for (double value : bias) {
+    layer->mutable_layer_bias()->add_columns(value);
+  }
+  layer->set_layer_activation_func(activation);
+}
+
+}  // namespace
+
+TEST(FnnModelTest, batch_matches_single_samples) {
+  FnnVehicleModel model_parameter;
+  model_parameter.set_dim_input(2);
+  model_parameter.set_num_layer(2);
+  model_parameter.mutable_samples_mean()->add_columns(1.0);
+  model_parameter.mutable_samples_mean()->add_columns(-1.0);
+  model_parameter.mutable_samples_std()->add_columns(2.0);
+  model_parameter.mutable_samples_std()->add_columns(0.5);
+  SetLayer({{1.0, -1.0, 0.5}, {0.5, 2.0, -1.0}}, {0.1, -0.2, 0.0},
+           Layer::RELU, model_parameter.add_layer());
+  SetLayer({{1.0}, {-0.5}, {2.0}}, {0.3}, Layer::SIGMOID,
+           model_parameter.add_layer());
+
+  FnnModel model;
+  EXPECT_TRUE(model.LoadModel(model_parameter, true));
+  EXPECT_EQ(model.dim_input(), 2);
+
+  Eigen::MatrixXd inputs(3, 2);
+  inputs << 1.0, -1.0, 3.0, 0.0, -2.0, 1.5;
+  Eigen::MatrixXd outputs;
+  model.Run(inputs, &outputs);
+  ASSERT_EQ(outputs.rows(), 3);
+  ASSERT_EQ(outputs.cols(), 1);
+  for (int i = 0; i < inputs.rows(); ++i) {
+    Eigen::MatrixXd single_output;
+    model.Run(inputs.row(i), &single_output);
+    EXPECT_DOUBLE_EQ(single_output(0, 0), outputs(i, 0));
+  }
+
+  // the first sample is at the mean, only the biases remain
+  const double hidden = 0.1 * 1.0 + 0.0 * 2.0;
+  EXPECT_NEAR(outputs(0, 0), 1.0 / (1.0 + std::exp(-(hidden + 0.3))), 1e-9);
+}
+
+TEST(FnnModelTest, softmax) {
+  FnnVehicleModel model_parameter;
+  model_parameter.set_dim_input(2);
+  model_parameter.set_num_layer(1);
+  SetLayer({{1.0, 0.0, -1.0}, {0.0, 1.0, 0.0}}, {0.0, 0.0, 0.0},
+           Layer::SOFTMAX, model_parameter.add_layer());
+
+  FnnModel model;
+  EXPECT_TRUE(model.LoadModel(model_parameter, false));
+  Eigen::MatrixXd inputs(2, 2);
+  inputs << 1.0, 3.0, 2.0, 2.0;
+  Eigen::MatrixXd outputs;
+  model.Run(inputs, &outputs);
+  ASSERT_EQ(outputs.rows(), 2);
+  ASSERT_EQ(outputs.cols(), 3);
+  const double sum = 1.0 + 3.0 + 0.001;
+  EXPECT_NEAR(outputs(0, 0), 1.0 / sum, 1e-9);
+  EXPECT_NEAR(outputs(0, 1), 3.0 / sum, 1e-9);
+  EXPECT_NEAR(outputs(0, 2), 0.001 / sum, 1e-9);
+  EXPECT_NEAR(outputs.row(1).sum(), 1.0, 1e-9);
+}
+
+TEST(FnnModelTest, inconsistent_layers) {
+  FnnVehicleModel model_parameter;
+  model_parameter.set_dim_input(3);
+  SetLayer({{1.0}, {2.0}}, {0.0}, Layer::RELU, model_parameter.add_layer());
+  FnnModel model;
+  EXPECT_FALSE(model.LoadModel(model_parameter, false));
+  EXPECT_FALSE(model.LoadModel(model_parameter, true));
+}
+
+}  // namespace network
+}  // namespace prediction
+}  // namespace apollo
@@ -72,8 +72,10 @@ bool Dense::Load(const DenseParameter& dense_pb) {
   if (!dense_pb.has_activation()) {
     ADEBUG << "Set activation as linear function";
     kactivation_ = serialize_to_function("linear");
+    activation_type_ = ActivationType::LINEAR;
   } else {
     kactivation_ = serialize_to_function(dense_pb.activation());
+    activation_type_ = serialize_to_activation_type(dense_pb.activation());
   }
   units_ = dense_pb.units();
   return true;
@@ -82,12 +84,17 @@ bool Dense::Load(const DenseParameter& dense_pb) {
 void Dense::Run(const std::vector<Eigen::MatrixXf>& inputs,
                 Eigen::MatrixXf* output) {
   CHECK_EQ(inputs.size(), 1);
-  Eigen::MatrixXf prod = static_cast<Eigen::MatrixXf>(inputs[0] * weights_);
+  RunSingleInput(inputs[0], output);
+}
+
+void Dense::RunSingleInput(const Eigen::MatrixXf& input,
+                           Eigen::MatrixXf* output) {
+  // product, bias and activation are computed in the output
+  output->noalias() = input * weights_;
   if (use_bias_) {
-    Eigen::MatrixXf sum = prod.rowwise() + bias_.transpose();
-    prod = sum;
+    output->rowwise() += bias_.transpose();
   }
-  *output = prod.unaryExpr(kactivation_);
+  ApplyActivation(activation_type_, kactivation_, *output);
   CHECK_EQ(output->cols(), units_);
 }
 
@@ -129,24 +136,23 @@ bool Conv1d::Load(const Conv1dParameter& conv1d_pb) {
 void Conv1d::Run(const std::vector<Eigen::MatrixXf>& inputs,
                  Eigen::MatrixXf* output) {
   CHECK_EQ(inputs.size(), 1);
+  RunSingleInput(inputs[0], output);
+}
+
+void Conv1d::RunSingleInput(const Eigen::MatrixXf& input,
+                            Eigen::MatrixXf* output) {
   CHECK_GT(kernel_.size(), 0);
-  CHECK_EQ(kernel_[0].rows(), inputs[0].rows());
+  CHECK_EQ(kernel_[0].rows(), input.rows());
   int kernel_size = static_cast<int>(kernel_[0].cols());
   int output_num_col =
-      static_cast<int>((inputs[0].cols() - kernel_size) / stride_) + 1;
+      static_cast<int>((input.cols() - kernel_size) / stride_) + 1;
   int output_num_row = static_cast<int>(kernel_.size());
   output->resize(output_num_row, output_num_col);
-  for (int i = 0; i < output_num_row; ++i) {
-    for (int j = 0; j < output_num_col; ++j) {
-      float output_i_j_unbiased = 0.0f;
-      for (int p = 0; p < inputs[0].rows(); ++p) {
-        for (int q = j * stride_; q < j * stride_ + kernel_size; ++q) {
-          output_i_j_unbiased +=
-              inputs[0](p, q) * kernel_[i](p, q - j * stride_);
-        }
-      }
-
-      (*output)(i, j) = output_i_j_unbiased + bias_(i);
+  for (int j = 0; j < output_num_col; ++j) {
+    const auto window =
+        input.block(0, j * stride_, input.rows(), kernel_size);
+    for (int i = 0; i < output_num_row; ++i) {
+      (*output)(i, j) = window.cwiseProduct(kernel_[i]).sum() + bias_(i);
     }
   }
 }
@@ -177,20 +183,21 @@ bool MaxPool1d::Load(const MaxPool1dParameter& maxpool1d_pb) {
 void MaxPool1d::Run(const std::vector<Eigen::MatrixXf>& inputs,
                     Eigen::MatrixXf* output) {
   CHECK_EQ(inputs.size(), 1);
+  RunSingleInput(inputs[0], output);
+}
+
+void MaxPool1d::RunSingleInput(const Eigen::MatrixXf& input,
+                               Eigen::MatrixXf* output) {
   int output_num_col =
-      static_cast<int>((inputs[0].cols() - kernel_size_) / stride_) + 1;
-  int output_num_row = static_cast<int>(inputs[0].rows());
+      static_cast<int>((input.cols() - kernel_size_) / stride_) + 1;
+  int output_num_row = static_cast<int>(input.rows());
   output->resize(output_num_row, output_num_col);
   int input_index = 0;
   for (int j = 0; j < output_num_col; ++j) {
-    CHECK_LE(input_index + kernel_size_, inputs[0].cols());
-    for (int i = 0; i < output_num_row; ++i) {
-      float output_i_j = -std::numeric_limits<float>::infinity();
-      for (int k = input_index; k < input_index + kernel_size_; ++k) {
-        output_i_j = std::max(output_i_j, inputs[0](i, k));
-      }
-      (*output)(i, j) = output_i_j;
-    }
+    CHECK_LE(input_index + kernel_size_, input.cols());
+    output->col(j) = input.middleCols(input_index, kernel_size_)
+                         .rowwise()
+                         .maxCoeff();
     input_index += stride_;
   }
 }
@@ -221,20 +228,21 @@ bool AvgPool1d::Load(const AvgPool1dParameter& avgpool1d_pb) {
 void AvgPool1d::Run(const std::vector<Eigen::MatrixXf>& inputs,
                     Eigen::MatrixXf* output) {
   CHECK_EQ(inputs.size(), 1);
+  RunSingleInput(inputs[0], output);
+}
+
+void AvgPool1d::RunSingleInput(const Eigen::MatrixXf& input,
+                               Eigen::MatrixXf* output) {
   int output_num_col =
-      static_cast<int>((inputs[0].cols() - kernel_size_) / stride_) + 1;
-  int output_num_row = static_cast<int>(inputs[0].rows());
+      static_cast<int>((input.cols() - kernel_size_) / stride_) + 1;
+  int output_num_row = static_cast<int>(input.rows());
   output->resize(output_num_row, output_num_col);
   int input_index = 0;
   for (int j = 0; j < output_num_col; ++j) {
-    CHECK_LE(input_index + kernel_size_, inputs[0].cols());
-    for (int i = 0; i < output_num_row; ++i) {
-      float output_i_j_sum = 0.0f;
-      for (int k = input_index; k < input_index + kernel_size_; ++k) {
-        output_i_j_sum += inputs[0](i, k);
-      }
-      (*output)(i, j) = output_i_j_sum / static_cast<float>(kernel_size_);
-    }
+    CHECK_LE(input_index + kernel_size_, input.cols());
+    output->col(j) =
+        input.middleCols(input_index, kernel_size_).rowwise().sum() /
+        static_cast<float>(kernel_size_);
     input_index += stride_;
   }
 }
@@ -246,9 +254,12 @@ bool Activation::Load(const LayerParameter& layer_pb) {
   }
   if (!layer_pb.has_activation()) {
     kactivation_ = serialize_to_function("linear");
+    activation_type_ = ActivationType::LINEAR;
   } else {
     ActivationParameter activation_pb = layer_pb.activation();
     kactivation_ = serialize_to_function(activation_pb.activation());
+    activation_type_ =
+        serialize_to_activation_type(activation_pb.activation());
   }
   return true;
 }
@@ -256,8 +267,11 @@ bool Activation::Load(const LayerParameter& layer_pb) {
 bool Activation::Load(const ActivationParameter& activation_pb) {
   if (!activation_pb.has_activation()) {
     kactivation_ = serialize_to_function("linear");
+    activation_type_ = ActivationType::LINEAR;
   } else {
     kactivation_ = serialize_to_function(activation_pb.activation());
+    activation_type_ =
+        serialize_to_activation_type(activation_pb.activation());
   }
   return true;
 }
@@ -265,7 +279,17 @@ bool Activation::Load(const ActivationParameter& activation_pb) {
 void Activation::Run(const std::vector<Eigen::MatrixXf>& inputs,
                      Eigen::MatrixXf* output) {
   CHECK_EQ(inputs.size(), 1);
-  *output = inputs[0].unaryExpr(kactivation_);
+  RunSingleInput(inputs[0], output);
+}
+
+void Activation::RunSingleInput(const Eigen::MatrixXf& input,
+                                Eigen::MatrixXf* output) {
+  *output = input;
+  Apply(output);
+}
+
+void Activation::Apply(Eigen::MatrixXf* matrix) const {
+  ApplyActivation(activation_type_, kactivation_, *matrix);
 }
 
 bool BatchNormalization::Load(const LayerParameter& layer_pb) {
@@ -300,22 +324,30 @@ bool BatchNormalization::Load(const LayerParameter& layer_pb) {
       return false;
     }
   }
+  scale_factor_ =
+      (sigma_.array().sqrt() + epsilon_).inverse().matrix().transpose();
+  if (scale_) {
+    scale_factor_.array() *= gamma_.transpose().array();
+  }
+  shift_ = -(mu_.transpose().array() * scale_factor_.array()).matrix();
+  if (center_) {
+    shift_ += beta_.transpose();
+  }
   return true;
 }
 
 void BatchNormalization::Run(const std::vector<Eigen::MatrixXf>& inputs,
                              Eigen::MatrixXf* output) {
   CHECK_EQ(inputs.size(), 1);
-  Eigen::MatrixXf temp = (inputs[0].rowwise() - mu_.transpose());
-  Eigen::MatrixXf norm =
-      temp.array().rowwise() / (sigma_.array().sqrt() + epsilon_).transpose();
-  if (scale_) {
-    norm = norm.array().rowwise() * gamma_.transpose().array();
-  }
-  if (center_) {
-    norm = norm.rowwise() + beta_.transpose();
-  }
-  *output = norm;
+  RunSingleInput(inputs[0], output);
+}
+
+void BatchNormalization::RunSingleInput(const Eigen::MatrixXf& input,
+                                        Eigen::MatrixXf* output) {
+  output->resize(input.rows(), input.cols());
+  output->array() =
+      (input.array().rowwise() * scale_factor_.array()).rowwise() +
+      shift_.array();
 }
 
 bool LSTM::Load(const LayerParameter& layer_pb) {
@@ -345,15 +377,20 @@ bool LSTM::Load(const LayerParameter& layer_pb) {
   if (!lstm_pb.has_activation()) {
     ADEBUG << "Set activation function as tanh.";
     kactivation_ = serialize_to_function("tanh");
+    activation_type_ = ActivationType::TANH;
   } else {
     kactivation_ = serialize_to_function(lstm_pb.activation());
+    activation_type_ = serialize_to_activation_type(lstm_pb.activation());
   }
   if (!lstm_pb.has_recurrent_activation()) {
     ADEBUG << "Set recurrent_activation function as hard_tanh.";
     krecurrent_activation_ = serialize_to_function("hard_tanh");
+    recurrent_activation_type_ = ActivationType::OTHER;
   } else {
     krecurrent_activation_ =
         serialize_to_function(lstm_pb.recurrent_activation());
+    recurrent_activation_type_ =
+        serialize_to_activation_type(lstm_pb.recurrent_activation());
   }
   if (!lstm_pb.has_use_bias()) {
     ADEBUG << "Set use_bias as true.";
@@ -423,43 +460,56 @@ bool LSTM::Load(const LayerParameter& layer_pb) {
     AERROR << "Fail to Load reccurent output weights!";
     return false;
   }
+  w_.resize(wi_.rows(), 4 * units_);
+  w_ << wi_, wf_, wc_, wo_;
+  r_w_.resize(r_wi_.rows(), 4 * units_);
+  r_w_ << r_wi_, r_wf_, r_wc_, r_wo_;
+  b_.resize(4 * units_);
+  b_ << bi_.transpose(), bf_.transpose(), bc_.transpose(), bo_.transpose();
   ResetState();
   return true;
 }
 
-void LSTM::Step(const Eigen::MatrixXf& input, Eigen::MatrixXf* output,
-                Eigen::MatrixXf* ht_1, Eigen::MatrixXf* ct_1) {
-  Eigen::MatrixXf x_i = input * wi_ + bi_.transpose();
-  Eigen::MatrixXf x_f = input * wf_ + bf_.transpose();
-  Eigen::MatrixXf x_c = input * wc_ + bc_.transpose();
-  Eigen::MatrixXf x_o = input * wo_ + bo_.transpose();
-
-  Eigen::MatrixXf i = (x_i + (*ht_1) * r_wi_).unaryExpr(krecurrent_activation_);
-  Eigen::MatrixXf f = (x_f + (*ht_1) * r_wf_).unaryExpr(krecurrent_activation_);
-  Eigen::MatrixXf c =
-      f.array() * ct_1->array() +
-      i.array() * ((x_c + (*ht_1) * r_wc_).unaryExpr(kactivation_)).array();
-  Eigen::MatrixXf o = (x_o + (*ht_1) * r_wo_).unaryExpr(krecurrent_activation_);
-  Eigen::MatrixXf h = o.array() * (c.unaryExpr(kactivation_)).array();
-
-  *ht_1 = h;
-  *ct_1 = c;
-  *output = h;
+void LSTM::Step(
+    const Eigen::Ref<const Eigen::RowVectorXf, 0, Eigen::InnerStride<>>&
+        input_gates,
+    Eigen::MatrixXf* ht_1, Eigen::MatrixXf* ct_1) {
+  // gates_ = [i, f, c, o] before activation
+  gates_ = input_gates;
+  gates_.noalias() += (*ht_1) * r_w_;
+  auto i = gates_.leftCols(units_);
+  auto f = gates_.middleCols(units_, units_);
+  auto c = gates_.middleCols(2 * units_, units_);
+  auto o = gates_.rightCols(units_);
+  ApplyActivation(recurrent_activation_type_, krecurrent_activation_, i);
+  ApplyActivation(recurrent_activation_type_, krecurrent_activation_, f);
+  ApplyActivation(activation_type_, kactivation_, c);
+  ApplyActivation(recurrent_activation_type_, krecurrent_activation_, o);
+
+  ct_1->array() = f.array() * ct_1->array() + i.array() * c.array();
+  *ht_1 = *ct_1;
+  ApplyActivation(activation_type_, kactivation_, *ht_1);
+  ht_1->array() *= o.array();
 }
 
 void LSTM::Run(const std::vector<Eigen::MatrixXf>& inputs,
                Eigen::MatrixXf* output) {
   CHECK_EQ(inputs.size(), 1);
-  Eigen::MatrixXf sequences(inputs[0].rows(), units_);
-  Eigen::MatrixXf temp;
-  for (int i = 0; i < inputs[0].rows(); ++i) {
-    Step(inputs[0].row(i), &temp, &ht_1_, &ct_1_);
-    sequences.row(i) = temp.row(0);
-  }
+  const Eigen::MatrixXf& input = inputs[0];
   if (return_sequences_) {
-    *output = sequences;
-  } else {
-    *output = temp.row(0);
+    output->resize(input.rows(), units_);
+  }
+  // the input parts of the gates of all the steps in one product
+  input_gates_.noalias() = input * w_;
+  input_gates_.rowwise() += b_;
+  for (int i = 0; i < input.rows(); ++i) {
+    Step(input_gates_.row(i), &ht_1_, &ct_1_);
+    if (return_sequences_) {
+      output->row(i) = ht_1_.row(0);
+    }
+  }
+  if (!return_sequences_) {
+    *output = ht_1_;
   }
 }
 
@@ -557,9 +607,15 @@ bool Concatenate::Load(const LayerParameter& layer_pb) {
 void Concatenate::Run(const std::vector<Eigen::MatrixXf>& inputs,
                       Eigen::MatrixXf* output) {
   CHECK_EQ(inputs.size(), 2);
-  CHECK_EQ(inputs[0].rows(), inputs[1].rows());
-  output->resize(inputs[0].rows(), inputs[0].cols() + inputs[1].cols());
-  *output << inputs[0], inputs[1];
+  Run(inputs[0], inputs[1], output);
+}
+
+void Concatenate::Run(const Eigen::MatrixXf& input_0,
+                      const Eigen::MatrixXf& input_1,
+                      Eigen::MatrixXf* output) {
+  CHECK_EQ(input_0.rows(), input_1.rows());
+  output->resize(input_0.rows(), input_0.cols() + input_1.cols());
+  *output << input_0, input_1;
 }
 
 }  // namespace network
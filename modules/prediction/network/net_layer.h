@@ -79,6 +79,18 @@ class Layer {
   virtual void Run(const std::vector<Eigen::MatrixXf>& inputs,
                    Eigen::MatrixXf* output) = 0;
 
+  /**
+   * @brief Compute the layer output from a single input without copying it
+   *        into a vector of inputs. The output keeps its storage when it
+   *        already has the right size.
+   * @param Input to a network layer
+   * @param Output of a network layer will be returned
+   */
+  virtual void RunSingleInput(const Eigen::MatrixXf& input,
+                              Eigen::MatrixXf* output) {
+    Run(std::vector<Eigen::MatrixXf>{input}, output);
+  }
+
   /**
    * @brief Name of a layer
    * @return Name of a layer
@@ -129,12 +141,21 @@ class Dense : public Layer {
   void Run(const std::vector<Eigen::MatrixXf>& inputs,
            Eigen::MatrixXf* output) override;
 
+  /**
+   * @brief Compute the layer output from a single input
+   * @param Input to a network layer
+   * @param Output of a network layer will be returned
+   */
+  void RunSingleInput(const Eigen::MatrixXf& input,
+                      Eigen::MatrixXf* output) override;
+
  private:
   int units_;
   bool use_bias_;
   Eigen::MatrixXf weights_;
   Eigen::VectorXf bias_;
   std::function<float(float)> kactivation_;
+  ActivationType activation_type_ = ActivationType::LINEAR;
 };
 
 /**
@@ -170,6 +191,14 @@ class Conv1d : public Layer {
   void Run(const std::vector<Eigen::MatrixXf>& inputs,
            Eigen::MatrixXf* output) override;
 
+  /**
+   * @brief Compute the layer output from a single input
+   * @param Input to a network layer
+   * @param Output of a network layer will be returned
+   */
+  void RunSingleInput(const Eigen::MatrixXf& input,
+                      Eigen::MatrixXf* output) override;
+
  private:
   std::vector<int> shape_;
   bool use_bias_;
@@ -206,6 +235,14 @@ class MaxPool1d : public Layer {
   void Run(const std::vector<Eigen::MatrixXf>& inputs,
            Eigen::MatrixXf* output) override;
 
+  /**
+   * @brief Compute the layer output from a single input
+   * @param Input to a network layer
+   * @param Output of a network layer will be returned
+   */
+  void RunSingleInput(const Eigen::MatrixXf& input,
+                      Eigen::MatrixXf* output) override;
+
  private:
   int kernel_size_;
   int stride_;
@@ -239,6 +276,14 @@ class AvgPool1d : public Layer {
   void Run(const std::vector<Eigen::MatrixXf>& inputs,
            Eigen::MatrixXf* output) override;
 
+  /**
+   * @brief Compute the layer output from a single input
+   * @param Input to a network layer
+   * @param Output of a network layer will be returned
+   */
+  void RunSingleInput(const Eigen::MatrixXf& input,
+                      Eigen::MatrixXf* output) override;
+
  private:
   int kernel_size_;
   int stride_;
@@ -276,8 +321,24 @@ class Activation : public Layer {
   void Run(const std::vector<Eigen::MatrixXf>& inputs,
            Eigen::MatrixXf* output) override;
 
+  /**
+   * @brief Compute the layer output from a single input
+   * @param Input to a network layer
+   * @param Output of a network layer will be returned
+   */
+  void RunSingleInput(const Eigen::MatrixXf& input,
+                      Eigen::MatrixXf* output) override;
+
+  /**
+   * @brief Activate a matrix in place, e.g. the output of the previous
+   *        dense layer, without a copy
+   * @param Matrix to activate
+   */
+  void Apply(Eigen::MatrixXf* matrix) const;
+
  private:
   std::function<float(float)> kactivation_;
+  ActivationType activation_type_ = ActivationType::LINEAR;
 };
 
 /**
@@ -302,6 +363,14 @@ class BatchNormalization : public Layer {
   void Run(const std::vector<Eigen::MatrixXf>& inputs,
            Eigen::MatrixXf* output) override;
 
+  /**
+   * @brief Compute the layer output from a single input
+   * @param Input to a network layer
+   * @param Output of a network layer will be returned
+   */
+  void RunSingleInput(const Eigen::MatrixXf& input,
+                      Eigen::MatrixXf* output) override;
+
  private:
   Eigen::VectorXf mu_;
   Eigen::VectorXf sigma_;
@@ -312,6 +381,9 @@ class BatchNormalization : public Layer {
   int axis_ = 0;
   bool center_ = false;
   bool scale_ = false;
+  // y = x * scale_factor_ + shift_, folded from the parameters above
+  Eigen::RowVectorXf scale_factor_;
+  Eigen::RowVectorXf shift_;
 };
 
 /**
@@ -356,12 +428,13 @@ class LSTM : public Layer {
  private:
   /**
    * @brief Compute the output of LSTM step by step
-   * @param Input of current step
-   * @param Output of current step
-   * @param Hidden state of previous step and return current hidden state
+   * @param Input of current step times the input weights, plus the bias
+   * @param Hidden state of previous step and return current hidden state,
+   *        which is the output of current step
    * @param Cell state of previous step and return current cell state
    */
-  void Step(const Eigen::MatrixXf& input, Eigen::MatrixXf* output,
+  void Step(const Eigen::Ref<const Eigen::RowVectorXf, 0,
+                             Eigen::InnerStride<>>& input_gates,
             Eigen::MatrixXf* ht_1, Eigen::MatrixXf* ct_1);
 
   Eigen::MatrixXf wi_;
@@ -378,10 +451,22 @@ class LSTM : public Layer {
   Eigen::MatrixXf r_wc_;
   Eigen::MatrixXf r_wo_;
 
+  // Weights and bias of the input, forget, cell and output gates side by
+  // side. The input parts of the gates of a sequence are computed in one
+  // product into input_gates_, then a step adds the product of the hidden
+  // state into the gates_ workspace.
+  Eigen::MatrixXf w_;
+  Eigen::MatrixXf r_w_;
+  Eigen::RowVectorXf b_;
+  Eigen::MatrixXf input_gates_;
+  Eigen::MatrixXf gates_;
+
   Eigen::MatrixXf ht_1_;
   Eigen::MatrixXf ct_1_;
   std::function<float(float)> kactivation_;
   std::function<float(float)> krecurrent_activation_;
+  ActivationType activation_type_ = ActivationType::OTHER;
+  ActivationType recurrent_activation_type_ = ActivationType::OTHER;
   int units_ = 0;
   bool return_sequences_ = false;
   bool stateful_ = false;
@@ -458,6 +543,15 @@ class Concatenate : public Layer {
   void Run(const std::vector<Eigen::MatrixXf>& inputs,
            Eigen::MatrixXf* output) override;
 
+  /**
+   * @brief Concatenate two inputs without copying them into a vector
+   * @param First input, on the left
+   * @param Second input, on the right
+   * @param Output of a network layer will be returned
+   */
+  void Run(const Eigen::MatrixXf& input_0, const Eigen::MatrixXf& input_1,
+           Eigen::MatrixXf* output);
+
  private:
   int axis_ = 0;
 };
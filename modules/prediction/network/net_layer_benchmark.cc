@@ -0,0 +1,251 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Compares the network layers with the reference kernels they
+ *        replaced, computed element by element through std::function and
+ *        into new matrices on every run, on random weights.
+ *
+ * Example:
+ *   net_layer_benchmark --benchmark_batch_size=20 --benchmark_units=64
+ **/
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gflags/gflags.h"
+
+#include "modules/prediction/network/net_layer.h"
+
+DEFINE_int32(benchmark_batch_size, 20, "rows of the dense layer inputs");
+DEFINE_int32(benchmark_units, 64, "units of the dense and lstm layers");
+DEFINE_int32(benchmark_dense_layers, 4, "number of dense + relu layers");
+DEFINE_int32(benchmark_lstm_steps, 10, "steps of the lstm sequence");
+DEFINE_int32(benchmark_iterations, 2000, "runs of every case");
+
+namespace apollo {
+namespace prediction {
+namespace network {
+namespace {
+
+std::mt19937 random_engine(0);
+
+void SetRandomTensor(const std::vector<int>& shape,
+                     TensorParameter* tensor_pb) {
+  std::uniform_real_distribution<float> distribution(-0.5f, 0.5f);
+  int size = 1;
+  for (const int dim : shape) {
+    tensor_pb->add_shape(dim);
+    size *= dim;
+  }
+  for (int i = 0; i < size; ++i) {
+    tensor_pb->add_data(distribution(random_engine));
+  }
+}
+
+Eigen::MatrixXf RandomMatrix(const int rows, const int cols) {
+  std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+  return Eigen::MatrixXf::NullaryExpr(
+      rows, cols, [&distribution]() { return distribution(random_engine); });
+}
+
+template <typename Func>
+double TimeUs(const Func& func) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < FLAGS_benchmark_iterations; ++i) {
+    func();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() /
+         FLAGS_benchmark_iterations;
+}
+
+void Report(const std::string& name, const double reference_us,
+            const double layer_us, const Eigen::MatrixXf& reference_output,
+            const Eigen::MatrixXf& layer_output) {
+  const float max_diff =
+      (reference_output - layer_output).cwiseAbs().maxCoeff();
+  std::cout << std::left << std::setw(20) << name << std::right
+            << std::fixed << std::setprecision(2) << std::setw(12)
+            << reference_us << std::setw(12) << layer_us << std::setw(10)
+            << reference_us / layer_us << std::scientific
+            << std::setprecision(2) << std::setw(12) << max_diff << std::endl;
+}
+
+// The dense, activation and lstm kernels before the layers were optimized.
+struct ReferenceDense {
+  Eigen::MatrixXf weights;
+  Eigen::VectorXf bias;
+
+  void Run(const std::vector<Eigen::MatrixXf>& inputs,
+           Eigen::MatrixXf* output) const {
+    Eigen::MatrixXf prod = static_cast<Eigen::MatrixXf>(inputs[0] * weights);
+    Eigen::MatrixXf sum = prod.rowwise() + bias.transpose();
+    *output = sum.unaryExpr(std::function<float(float)>(linear));
+  }
+};
+
+void ReferenceActivation(const std::vector<Eigen::MatrixXf>& inputs,
+                         const std::function<float(float)>& func,
+                         Eigen::MatrixXf* output) {
+  *output = inputs[0].unaryExpr(func);
+}
+
+struct ReferenceLSTM {
+  Eigen::MatrixXf wi, wf, wc, wo, r_wi, r_wf, r_wc, r_wo;
+  Eigen::VectorXf bi, bf, bc, bo;
+  std::function<float(float)> act = sigmoid;
+  std::function<float(float)> rec_act = hard_sigmoid;
+
+  void Step(const Eigen::MatrixXf& input, Eigen::MatrixXf* output,
+            Eigen::MatrixXf* ht_1, Eigen::MatrixXf* ct_1) const {
+    Eigen::MatrixXf x_i = input * wi + bi.transpose();
+    Eigen::MatrixXf x_f = input * wf + bf.transpose();
+    Eigen::MatrixXf x_c = input * wc + bc.transpose();
+    Eigen::MatrixXf x_o = input * wo + bo.transpose();
+    Eigen::MatrixXf i = (x_i + (*ht_1) * r_wi).unaryExpr(rec_act);
+    Eigen::MatrixXf f = (x_f + (*ht_1) * r_wf).unaryExpr(rec_act);
+    Eigen::MatrixXf c =
+        f.array() * ct_1->array() +
+        i.array() * ((x_c + (*ht_1) * r_wc).unaryExpr(act)).array();
+    Eigen::MatrixXf o = (x_o + (*ht_1) * r_wo).unaryExpr(rec_act);
+    Eigen::MatrixXf h = o.array() * (c.unaryExpr(act)).array();
+    *ht_1 = h;
+    *ct_1 = c;
+    *output = h;
+  }
+};
+
+void BenchmarkDense() {
+  const int units = FLAGS_benchmark_units;
+  std::vector<Dense> layers(FLAGS_benchmark_dense_layers);
+  std::vector<ReferenceDense> reference_layers(layers.size());
+  Activation relu_layer;
+  ActivationParameter relu_pb;
+  relu_pb.set_activation("relu");
+  relu_layer.Load(relu_pb);
+  for (size_t i = 0; i < layers.size(); ++i) {
+    DenseParameter dense_pb;
+    dense_pb.set_units(units);
+    dense_pb.set_use_bias(true);
+    SetRandomTensor({units, units}, dense_pb.mutable_weights());
+    SetRandomTensor({units}, dense_pb.mutable_bias());
+    layers[i].Load(dense_pb);
+    LoadTensor(dense_pb.weights(), &reference_layers[i].weights);
+    LoadTensor(dense_pb.bias(), &reference_layers[i].bias);
+  }
+  const Eigen::MatrixXf input = RandomMatrix(FLAGS_benchmark_batch_size, units);
+
+  Eigen::MatrixXf reference_output;
+  const double reference_us = TimeUs([&]() {
+    Eigen::MatrixXf values = input;
+    for (const auto& layer : reference_layers) {
+      Eigen::MatrixXf dense_output;
+      layer.Run({values}, &dense_output);
+      ReferenceActivation({dense_output}, relu, &values);
+    }
+    reference_output = values;
+  });
+
+  Eigen::MatrixXf buffers[2];
+  const double layer_us = TimeUs([&]() {
+    const Eigen::MatrixXf* values = &input;
+    for (size_t i = 0; i < layers.size(); ++i) {
+      Eigen::MatrixXf* output = &buffers[i % 2];
+      layers[i].RunSingleInput(*values, output);
+      relu_layer.Apply(output);
+      values = output;
+    }
+  });
+  Report("dense + relu", reference_us, layer_us, reference_output,
+         buffers[(layers.size() - 1) % 2]);
+}
+
+void BenchmarkLSTM() {
+  const int units = FLAGS_benchmark_units;
+  LayerParameter layer_pb;
+  LSTMParameter* lstm_pb = layer_pb.mutable_lstm();
+  lstm_pb->set_units(units);
+  lstm_pb->set_return_sequences(false);
+  lstm_pb->set_activation("sigmoid");
+  lstm_pb->set_recurrent_activation("hard_sigmoid");
+  ReferenceLSTM reference;
+  const std::vector<std::pair<TensorParameter*, Eigen::MatrixXf*>> weights = {
+      {lstm_pb->mutable_weights_input(), &reference.wi},
+      {lstm_pb->mutable_weights_forget(), &reference.wf},
+      {lstm_pb->mutable_weights_cell(), &reference.wc},
+      {lstm_pb->mutable_weights_output(), &reference.wo},
+      {lstm_pb->mutable_recurrent_weights_input(), &reference.r_wi},
+      {lstm_pb->mutable_recurrent_weights_forget(), &reference.r_wf},
+      {lstm_pb->mutable_recurrent_weights_cell(), &reference.r_wc},
+      {lstm_pb->mutable_recurrent_weights_output(), &reference.r_wo}};
+  for (const auto& weight : weights) {
+    SetRandomTensor({units, units}, weight.first);
+    LoadTensor(*weight.first, weight.second);
+  }
+  const std::vector<std::pair<TensorParameter*, Eigen::VectorXf*>> biases = {
+      {lstm_pb->mutable_bias_input(), &reference.bi},
+      {lstm_pb->mutable_bias_forget(), &reference.bf},
+      {lstm_pb->mutable_bias_cell(), &reference.bc},
+      {lstm_pb->mutable_bias_output(), &reference.bo}};
+  for (const auto& bias : biases) {
+    SetRandomTensor({units}, bias.first);
+    LoadTensor(*bias.first, bias.second);
+  }
+  LSTM lstm;
+  lstm.Load(layer_pb);
+  const Eigen::MatrixXf input = RandomMatrix(FLAGS_benchmark_lstm_steps, units);
+
+  Eigen::MatrixXf reference_output;
+  const double reference_us = TimeUs([&]() {
+    Eigen::MatrixXf ht_1 = Eigen::MatrixXf::Zero(1, units);
+    Eigen::MatrixXf ct_1 = Eigen::MatrixXf::Zero(1, units);
+    for (int i = 0; i < input.rows(); ++i) {
+      reference.Step(input.row(i), &reference_output, &ht_1, &ct_1);
+    }
+  });
+
+  Eigen::MatrixXf output;
+  const double layer_us = TimeUs([&]() {
+    lstm.ResetState();
+    lstm.Run({input}, &output);
+  });
+  Report("lstm", reference_us, layer_us, reference_output, output);
+}
+
+}  // namespace
+}  // namespace network
+}  // namespace prediction
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  std::cout << std::left << std::setw(20) << "case" << std::right
+            << std::setw(12) << "ref us" << std::setw(12) << "layer us"
+            << std::setw(10) << "speedup" << std::setw(12) << "max diff"
+            << std::endl;
+  apollo::prediction::network::BenchmarkDense();
+  apollo::prediction::network::BenchmarkLSTM();
+  return 0;
+}
@@ -161,6 +161,21 @@ TEST(LayerTest, lstm_test) {
   EXPECT_EQ(state.size(), 2);
   EXPECT_EQ(state[0](0, 0), 1);
   EXPECT_EQ(state[1](0, 0), 2);
+
+  // all the gates see 1 * 1 + 1 * 1 + 1 = 3
+  Eigen::MatrixXf output;
+  Eigen::MatrixXf input(1, 1);
+  input(0, 0) = 1.0;
+  lstm.Run({input}, &output);
+  const float c =
+      hard_sigmoid(3.0f) * 2.0f + hard_sigmoid(3.0f) * sigmoid(3.0f);
+  const float h = hard_sigmoid(3.0f) * sigmoid(c);
+  ASSERT_EQ(output.rows(), 1);
+  ASSERT_EQ(output.cols(), 1);
+  EXPECT_FLOAT_EQ(output(0, 0), h);
+  lstm.State(&state);
+  EXPECT_FLOAT_EQ(state[0](0, 0), h);
+  EXPECT_FLOAT_EQ(state[1](0, 0), c);
 }
 
 TEST(LayerTest, flatten_test) {
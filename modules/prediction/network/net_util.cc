@@ -53,6 +53,19 @@ Eigen::MatrixXf FlattenMatrix(const Eigen::MatrixXf& matrix) {
   return output_matrix;
 }
 
+void FlattenMatrix(const Eigen::MatrixXf& matrix, const int row,
+                   const int col_offset, Eigen::MatrixXf* output) {
+  CHECK_LT(row, output->rows());
+  CHECK_LE(col_offset + matrix.size(), output->cols());
+  int output_index = col_offset;
+  for (int i = 0; i < matrix.rows(); ++i) {
+    for (int j = 0; j < matrix.cols(); ++j) {
+      (*output)(row, output_index) = matrix(i, j);
+      ++output_index;
+    }
+  }
+}
+
 std::function<float(float)> serialize_to_function(const std::string& str) {
   static const std::unordered_map<std::string, std::function<float(float)>>
       func_map({{"linear", linear},
@@ -63,6 +76,44 @@ std::function<float(float)> serialize_to_function(const std::string& str) {
   return func_map.at(str);
 }
 
+ActivationType serialize_to_activation_type(const std::string& str) {
+  static const std::unordered_map<std::string, ActivationType> type_map(
+      {{"linear", ActivationType::LINEAR},
+       {"tanh", ActivationType::TANH},
+       {"sigmoid", ActivationType::SIGMOID},
+       {"hard_sigmoid", ActivationType::HARD_SIGMOID},
+       {"relu", ActivationType::RELU}});
+  auto it = type_map.find(str);
+  return it == type_map.end() ? ActivationType::OTHER : it->second;
+}
+
+void ApplyActivation(
+    const ActivationType type, const std::function<float(float)>& func,
+    Eigen::Ref<Eigen::MatrixXf, 0, Eigen::OuterStride<>> matrix) {
+  switch (type) {
+    case ActivationType::LINEAR:
+      break;
+    case ActivationType::TANH:
+      matrix = matrix.array().tanh().matrix();
+      break;
+    case ActivationType::SIGMOID:
+      matrix = ((-matrix.array()).exp() + 1.0f).inverse().matrix();
+      break;
+    case ActivationType::HARD_SIGMOID:
+      matrix = (matrix.array() * 0.2f + 0.5f)
+                   .max(0.0f)
+                   .min(1.0f)
+                   .matrix();
+      break;
+    case ActivationType::RELU:
+      matrix = matrix.array().max(0.0f).matrix();
+      break;
+    default:
+      matrix = matrix.unaryExpr(func);
+      break;
+  }
+}
+
 bool LoadTensor(const TensorParameter& tensor_pb, Eigen::MatrixXf* matrix) {
   if (tensor_pb.data_size() == 0 || tensor_pb.shape_size() == 0) {
     AERROR << "Fail to load the necessary fields!";
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -70,6 +71,36 @@ float hard_sigmoid(const float x);
  */
 float relu(const float x);
 
+/**
+ * @brief activation functions with a vectorized kernel
+ */
+enum class ActivationType {
+  LINEAR,
+  TANH,
+  SIGMOID,
+  HARD_SIGMOID,
+  RELU,
+  OTHER,
+};
+
+/**
+ * @brief translate a string into the type of an activation function
+ * @param string
+ * @return activation type, OTHER if it has no vectorized kernel
+ */
+ActivationType serialize_to_activation_type(const std::string& str);
+
+/**
+ * @brief apply an activation function to a matrix in place, with the
+ *        vectorized kernel of its type or element by element for OTHER
+ * @param activation type
+ * @param activation function, used for OTHER
+ * @param matrix, or block of a matrix, to activate
+ */
+void ApplyActivation(
+    const ActivationType type, const std::function<float(float)>& func,
+    Eigen::Ref<Eigen::MatrixXf, 0, Eigen::OuterStride<>> matrix);
+
 /**
  * @brief flatten a matrix to a row vector
  * @param Input matrix
@@ -77,6 +108,16 @@ float relu(const float x);
  */
 Eigen::MatrixXf FlattenMatrix(const Eigen::MatrixXf& matrix);
 
+/**
+ * @brief flatten a matrix into a row of another matrix, without allocation
+ * @param Input matrix
+ * @param Row of the output matrix
+ * @param Column of the output matrix where the flattened matrix starts
+ * @param Output matrix, large enough
+ */
+void FlattenMatrix(const Eigen::MatrixXf& matrix, const int row,
+                   const int col_offset, Eigen::MatrixXf* output);
+
 /**
  * @brief translate a string into a network activation function
  * @param string
@@ -49,6 +49,33 @@ TEST(NetworkUtil, serialize_to_function_test) {
   EXPECT_FLOAT_EQ(relu_func(3.0), 3.0);
 }
 
+TEST(NetworkUtil, ApplyActivation_test) {
+  Eigen::MatrixXf input(2, 8);
+  input << -6.0, -3.0, -2.0, -0.5, 0.0, 0.5, 2.0, 3.0,
+            6.0, 3.0, 2.5, 1.0, -1.0, -2.5, -0.1, 0.1;
+  for (const std::string name :
+       {"linear", "tanh", "sigmoid", "hard_sigmoid", "relu"}) {
+    const std::function<float(float)> func = serialize_to_function(name);
+    const ActivationType type = serialize_to_activation_type(name);
+    EXPECT_NE(type, ActivationType::OTHER);
+    Eigen::MatrixXf output = input;
+    ApplyActivation(type, func, output);
+    for (int i = 0; i < input.rows(); ++i) {
+      for (int j = 0; j < input.cols(); ++j) {
+        EXPECT_NEAR(output(i, j), func(input(i, j)), 1e-6) << name;
+      }
+    }
+  }
+  EXPECT_EQ(serialize_to_activation_type("unknown"), ActivationType::OTHER);
+
+  // only the block is activated
+  Eigen::MatrixXf output = input;
+  ApplyActivation(ActivationType::RELU, relu, output.rightCols(4));
+  EXPECT_FLOAT_EQ(output(0, 0), -6.0);
+  EXPECT_FLOAT_EQ(output(1, 4), 0.0);
+  EXPECT_FLOAT_EQ(output(1, 7), 0.1);
+}
+
 TEST(NetworkUtil, LoadTensor_test) {
   TensorParameter tensor_pb;
   Eigen::MatrixXf mat;
@@ -14,6 +14,12 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 #include "cyber/common/file.h"
 
 #include "modules/common/util/string_util.h"
@@ -26,6 +32,34 @@
 namespace apollo {
 namespace prediction {
 
+namespace {
+
+std::unordered_set<std::string> LoadProcessedRecords() {
+  std::unordered_set<std::string> processed_records;
+  if (FLAGS_prediction_offline_checkpoint_file.empty()) {
+    return processed_records;
+  }
+  std::ifstream checkpoint(FLAGS_prediction_offline_checkpoint_file);
+  std::string record;
+  while (std::getline(checkpoint, record)) {
+    if (!record.empty()) {
+      processed_records.insert(record);
+    }
+  }
+  return processed_records;
+}
+
+void MarkRecordProcessed(const std::string& record) {
+  if (FLAGS_prediction_offline_checkpoint_file.empty()) {
+    return;
+  }
+  std::ofstream checkpoint(FLAGS_prediction_offline_checkpoint_file,
+                           std::ios::app);
+  checkpoint << record << std::endl;
+}
+
+}  // namespace
+
 void GenerateDataForLearning() {
   apollo::hdmap::HDMapUtil::ReloadMaps();
   if (!FeatureOutput::Ready()) {
@@ -38,18 +72,49 @@ void GenerateDataForLearning() {
   if (!MessageProcess::Init()) {
     return;
   }
+  const int num_shards = FLAGS_prediction_offline_num_shards;
+  const int shard_index = FLAGS_prediction_offline_shard_index;
+  if (num_shards < 1 || shard_index < 0 || shard_index >= num_shards) {
+    AERROR << "Invalid shard " << shard_index << " of " << num_shards;
+    return;
+  }
   std::vector<std::string> inputs;
   common::util::Split(FLAGS_prediction_offline_bags, ':', &inputs);
+  std::vector<std::string> offline_bags;
   for (const auto& input : inputs) {
-    std::vector<std::string> offline_bags;
-    GetRecordFileNames(boost::filesystem::path(input), &offline_bags);
-    std::sort(offline_bags.begin(), offline_bags.end());
-    AINFO << "For input " << input << ", found " << offline_bags.size()
+    std::vector<std::string> input_bags;
+    GetRecordFileNames(boost::filesystem::path(input), &input_bags);
+    std::sort(input_bags.begin(), input_bags.end());
+    AINFO << "For input " << input << ", found " << input_bags.size()
           << "  rosbags to process";
-    for (std::size_t i = 0; i < offline_bags.size(); ++i) {
-      AINFO << "\tProcessing: [ " << i << " / " << offline_bags.size()
-            << " ]: " << offline_bags[i];
-      MessageProcess::ProcessOfflineData(offline_bags[i]);
+    offline_bags.insert(offline_bags.end(), input_bags.begin(),
+                        input_bags.end());
+  }
+
+  // The shards take contiguous ranges of the records, so that the obstacle
+  // histories only restart at the boundaries between the shards.
+  const std::size_t begin = offline_bags.size() * shard_index / num_shards;
+  const std::size_t end = offline_bags.size() * (shard_index + 1) / num_shards;
+  // Once sharded or resumable, every record is written to its own files,
+  // tagged with its index, as soon as it is processed.
+  const bool output_per_record =
+      num_shards > 1 || !FLAGS_prediction_offline_checkpoint_file.empty();
+  const std::unordered_set<std::string> processed_bags =
+      LoadProcessedRecords();
+  for (std::size_t i = begin; i < end; ++i) {
+    if (processed_bags.count(offline_bags[i]) > 0) {
+      AINFO << "\tSkipping processed: " << offline_bags[i];
+      continue;
+    }
+    AINFO << "\tProcessing: [ " << i << " / " << offline_bags.size()
+          << " ]: " << offline_bags[i];
+    if (output_per_record) {
+      FeatureOutput::SetFileTag(std::to_string(i));
+    }
+    MessageProcess::ProcessOfflineData(offline_bags[i]);
+    if (output_per_record) {
+      FeatureOutput::Close();
+      MarkRecordProcessed(offline_bags[i]);
     }
   }
   FeatureOutput::Close();
@@ -26,7 +26,6 @@
 namespace apollo {
 namespace prediction {
 
-using common::PathPoint;
 using common::TrajectoryPoint;
 using hdmap::LaneInfo;
 
@@ -121,13 +120,14 @@ void LaneSequencePredictor::DrawLaneSequenceTrajectoryPoints(
   Eigen::Vector2d position(feature.position().x(), feature.position().y());
   double speed = feature.speed();
 
-  int lane_segment_index = 0;
-  std::string lane_id =
-      lane_sequence.lane_segment(lane_segment_index).lane_id();
-  std::shared_ptr<const LaneInfo> lane_info = PredictionMap::LaneById(lane_id);
+  std::vector<std::shared_ptr<const LaneInfo>> lanes;
+  if (!GetLanes(lane_sequence, &lanes)) {
+    return;
+  }
+  int lane_index = 0;
   double lane_s = 0.0;
   double lane_l = 0.0;
-  if (!PredictionMap::GetProjection(position, lane_info, &lane_s, &lane_l)) {
+  if (!PredictionMap::GetProjection(position, lanes[0], &lane_s, &lane_l)) {
     AERROR << "Failed in getting lane s and lane l";
     return;
   }
@@ -136,40 +136,20 @@ void LaneSequencePredictor::DrawLaneSequenceTrajectoryPoints(
     approach_rate = FLAGS_cutin_approach_rate;
   }
   size_t total_num = static_cast<size_t>(total_time / period);
+  std::vector<LaneTrajectoryPoint> lane_points(total_num);
   for (size_t i = 0; i < total_num; ++i) {
-    double relative_time = static_cast<double>(i) * period;
-    Eigen::Vector2d point;
-    double theta = M_PI;
-    if (!PredictionMap::SmoothPointFromLane(lane_id, lane_s, lane_l, &point,
-                                            &theta)) {
-      AERROR << "Unable to get smooth point from lane [" << lane_id
-             << "] with s [" << lane_s << "] and l [" << lane_l << "]";
-      break;
-    }
-    TrajectoryPoint trajectory_point;
-    PathPoint path_point;
-    path_point.set_x(point.x());
-    path_point.set_y(point.y());
-    path_point.set_z(0.0);
-    path_point.set_theta(theta);
-    path_point.set_lane_id(lane_id);
-    trajectory_point.mutable_path_point()->CopyFrom(path_point);
-    trajectory_point.set_v(speed);
-    trajectory_point.set_a(0.0);
-    trajectory_point.set_relative_time(relative_time);
-    points->emplace_back(std::move(trajectory_point));
+    LaneTrajectoryPoint& lane_point = lane_points[i];
+    lane_point.lane_index = lane_index;
+    lane_point.lane_s = lane_s;
+    lane_point.lane_l = lane_l;
+    lane_point.v = speed;
+    lane_point.relative_time = static_cast<double>(i) * period;
 
     lane_s += speed * period;
-
-    while (lane_s > PredictionMap::LaneById(lane_id)->total_length() &&
-           lane_segment_index + 1 < lane_sequence.lane_segment_size()) {
-      lane_segment_index += 1;
-      lane_s = lane_s - PredictionMap::LaneById(lane_id)->total_length();
-      lane_id = lane_sequence.lane_segment(lane_segment_index).lane_id();
-    }
-
+    MoveToNextLanes(lanes, &lane_index, &lane_s);
     lane_l *= approach_rate;
   }
+  LanePointsToTrajectoryPoints(lanes, lane_points, points);
 }
 
 }  // namespace prediction
@@ -202,25 +202,26 @@ bool MoveSequencePredictor::
   // within the total time of prediction.
 
   // Get lane's initial conditions.
-  int lane_segment_index = 0;
-  std::string lane_id = lane_sequence.lane_segment(0).lane_id();
-  std::shared_ptr<const LaneInfo> lane_info =
-      PredictionMap::LaneById(lane_id);
+  std::vector<std::shared_ptr<const LaneInfo>> lanes;
+  if (!GetLanes(lane_sequence, &lanes)) {
+    return false;
+  }
+  int lane_index = 0;
   double lane_s = 0.0;
   double lane_l = 0.0;
-  if (!PredictionMap::GetProjection(position, lane_info, &lane_s, &lane_l)) {
+  if (!PredictionMap::GetProjection(position, lanes[0], &lane_s, &lane_l)) {
     AERROR << "Failed in getting lane s and lane l";
     return false;
   }
   double prev_s = 0.0;
   size_t total_num = static_cast<size_t>(total_time / period);
-  std::vector<apollo::common::TrajectoryPoint> curr_points;
+  std::vector<LaneTrajectoryPoint> lane_points(total_num);
 
-  // Draw trajectory points.
+  // Evaluate the polynomials over the time grid in lane coordinates,
+  // the trajectory points are placed on the lanes at the end.
   for (size_t i = 0; i < total_num; ++i) {
+    LaneTrajectoryPoint& lane_point = lane_points[i];
     double relative_time = static_cast<double>(i) * period;
-    Eigen::Vector2d point;
-    double theta = M_PI;
 
     // Evaluate the new s.
     double curr_s = EvaluateQuarticPolynomial(best_longitudinal_coeffs,
@@ -235,47 +236,25 @@ bool MoveSequencePredictor::
                                          best_candidate_time, 0.0);
       prev_s = curr_s;
     }
-
-    // Get the universal point and theta info.
-    if (!PredictionMap::SmoothPointFromLane(lane_id, lane_s, lane_l, &point,
-                                            &theta)) {
-      AERROR << "Unable to get smooth point from lane [" << lane_id
-             << "] with s [" << lane_s << "] and l [" << lane_l << "]";
-      break;
-    }
-    PathPoint path_point;
-    path_point.set_x(point.x());
-    path_point.set_y(point.y());
-    path_point.set_z(0.0);
-    path_point.set_theta(theta);
-    path_point.set_lane_id(lane_id);
+    lane_point.lane_index = lane_index;
+    lane_point.lane_s = lane_s;
+    lane_point.lane_l = lane_l;
 
     // Get the speed and acceleration info along the lane.
-    double lane_speed =
+    lane_point.v =
         EvaluateQuarticPolynomial(best_longitudinal_coeffs, relative_time, 1,
                                   best_candidate_time, best_ds1);
-    double lane_acc =
+    lane_point.a =
         EvaluateQuarticPolynomial(best_longitudinal_coeffs, relative_time, 2,
                                   best_candidate_time, best_ds1);
-    TrajectoryPoint trajectory_point;
-    trajectory_point.mutable_path_point()->CopyFrom(path_point);
-    trajectory_point.set_v(lane_speed);
-    trajectory_point.set_a(lane_acc);
-    trajectory_point.set_relative_time(relative_time);
-    curr_points.emplace_back(std::move(trajectory_point));
+    lane_point.relative_time = relative_time;
 
     // If the obstacle gets into the next lane_segment,
     // update the lane_segment accordingly.
-    while (lane_s > PredictionMap::LaneById(lane_id)->total_length() &&
-           lane_segment_index + 1 < lane_sequence.lane_segment_size()) {
-      lane_segment_index += 1;
-      lane_s = lane_s - PredictionMap::LaneById(lane_id)->total_length();
-      lane_id = lane_sequence.lane_segment(lane_segment_index).lane_id();
-    }
+    MoveToNextLanes(lanes, &lane_index, &lane_s);
   }
 
-  // Update the trajectory points and return.
-  *points = curr_points;
+  LanePointsToTrajectoryPoints(lanes, lane_points, points);
   return true;
 }
 
@@ -328,73 +307,55 @@ bool MoveSequencePredictor::DrawMoveSequenceTrajectoryPoints(
 
   // Get ready for the for-loop:
   // project the obstacle's position onto the lane's Frenet coordinates.
-  int lane_segment_index = 0;
-  std::string lane_id =
-      lane_sequence.lane_segment(lane_segment_index).lane_id();
-  std::shared_ptr<const LaneInfo> lane_info = PredictionMap::LaneById(lane_id);
+  std::vector<std::shared_ptr<const LaneInfo>> lanes;
+  if (!GetLanes(lane_sequence, &lanes)) {
+    return false;
+  }
+  int lane_index = 0;
   double lane_s = 0.0;
   double lane_l = 0.0;
-  if (!PredictionMap::GetProjection(position, lane_info, &lane_s, &lane_l)) {
+  if (!PredictionMap::GetProjection(position, lanes[0], &lane_s, &lane_l)) {
     AERROR << "Failed in getting lane s and lane l";
     return false;
   }
   double prev_lane_l = lane_l;
+  double prev_s = 0.0;
 
-  // Draw each trajectory point within the total time of prediction
+  // Evaluate the polynomials over the time grid in lane coordinates,
+  // the trajectory points are placed on the lanes at the end.
   size_t total_num = static_cast<size_t>(total_time / period);
+  std::vector<LaneTrajectoryPoint> lane_points(total_num);
   for (size_t i = 0; i < total_num; ++i) {
+    LaneTrajectoryPoint& lane_point = lane_points[i];
     double relative_time = static_cast<double>(i) * period;
-    Eigen::Vector2d point;
-    double theta = M_PI;
 
     lane_l = EvaluateQuinticPolynomial(lateral_coeffs, relative_time, 0,
                                        time_to_lat_end_state, 0.0);
     double curr_s =
         EvaluateQuarticPolynomial(longitudinal_coeffs, relative_time, 0,
                                   lon_end_vt.second, lon_end_vt.first);
-    double prev_s = (i > 0) ? EvaluateQuarticPolynomial(
-                                  longitudinal_coeffs, relative_time - period,
-                                  0, lon_end_vt.second, lon_end_vt.first)
-                            : 0.0;
     lane_s += std::max(0.0, (curr_s - prev_s));
     if (curr_s + FLAGS_double_precision < prev_s) {
       lane_l = prev_lane_l;
     }
-    if (!PredictionMap::SmoothPointFromLane(lane_id, lane_s, lane_l, &point,
-                                            &theta)) {
-      AERROR << "Unable to get smooth point from lane [" << lane_id
-             << "] with s [" << lane_s << "] and l [" << lane_l << "]";
-      break;
-    }
-
+    prev_s = curr_s;
     prev_lane_l = lane_l;
-    double lane_speed =
+
+    lane_point.lane_index = lane_index;
+    lane_point.lane_s = lane_s;
+    lane_point.lane_l = lane_l;
+    lane_point.v =
         EvaluateQuarticPolynomial(longitudinal_coeffs, relative_time, 1,
                                   lon_end_vt.second, lon_end_vt.first);
-    double lane_acc =
+    lane_point.a =
         EvaluateQuarticPolynomial(longitudinal_coeffs, relative_time, 2,
                                   lon_end_vt.second, lon_end_vt.first);
+    lane_point.relative_time = relative_time;
 
-    TrajectoryPoint trajectory_point;
-    PathPoint path_point;
-    path_point.set_x(point.x());
-    path_point.set_y(point.y());
-    path_point.set_z(0.0);
-    path_point.set_theta(theta);
-    path_point.set_lane_id(lane_id);
-    trajectory_point.mutable_path_point()->CopyFrom(path_point);
-    trajectory_point.set_v(lane_speed);
-    trajectory_point.set_a(lane_acc);
-    trajectory_point.set_relative_time(relative_time);
-    points->emplace_back(std::move(trajectory_point));
-
-    while (lane_s > PredictionMap::LaneById(lane_id)->total_length() &&
-           lane_segment_index + 1 < lane_sequence.lane_segment_size()) {
-      lane_segment_index += 1;
-      lane_s = lane_s - PredictionMap::LaneById(lane_id)->total_length();
-      lane_id = lane_sequence.lane_segment(lane_segment_index).lane_id();
-    }
+    MoveToNextLanes(lanes, &lane_index, &lane_s);
   }
+
+  LanePointsToTrajectoryPoints(lanes, lane_points, points);
   return true;
 }
 
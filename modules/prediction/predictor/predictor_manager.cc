@@ -16,8 +16,11 @@
 
 #include "modules/prediction/predictor/predictor_manager.h"
 
+#include <utility>
+
 #include "modules/prediction/common/prediction_gflags.h"
 #include "modules/prediction/common/prediction_system_gflags.h"
+#include "modules/prediction/common/prediction_thread_pool.h"
 #include "modules/prediction/common/feature_output.h"
 #include "modules/prediction/container/container_manager.h"
 #include "modules/prediction/container/obstacles/obstacles_container.h"
@@ -127,6 +130,16 @@ Predictor* PredictorManager::GetPredictor(
   return it != predictors_.end() ? it->second.get() : nullptr;
 }
 
+Predictor* PredictorManager::GetPredictor(
+    const ObstacleConf::PredictorType& type, const int thread_index) {
+  if (thread_index == 0) {
+    return GetPredictor(type);
+  }
+  auto& predictors = thread_predictors_[thread_index - 1];
+  auto it = predictors.find(type);
+  return it != predictors.end() ? it->second.get() : nullptr;
+}
+
 void PredictorManager::Run() {
   prediction_obstacles_.Clear();
   auto obstacles_container = ContainerManager::Instance()->GetContainer<
@@ -136,83 +149,115 @@ void PredictorManager::Run() {
       ADCTrajectoryContainer>(AdapterConfig::PLANNING_TRAJECTORY);
 
   CHECK_NOTNULL(obstacles_container);
+  std::vector<Obstacle*> obstacles;
+  std::vector<const PerceptionObstacle*> perception_obstacles;
   for (const int id : obstacles_container->curr_frame_obstacle_ids()) {
     if (id < 0) {
       ADEBUG << "The obstacle has invalid id [" << id << "].";
       continue;
     }
+    obstacles.push_back(obstacles_container->GetObstacle(id));
+    perception_obstacles.push_back(
+        &obstacles_container->GetPerceptionObstacle(id));
+  }
 
-    PredictionObstacle prediction_obstacle;
-    Obstacle* obstacle = obstacles_container->GetObstacle(id);
+  const int num_threads = PredictionThreadPool::NumThreads();
+  while (static_cast<int>(thread_predictors_.size()) < num_threads - 1) {
+    thread_predictors_.emplace_back();
+    for (const auto& predictor : predictors_) {
+      thread_predictors_.back()[predictor.first] =
+          CreatePredictor(predictor.first);
+    }
+  }
 
-    PerceptionObstacle perception_obstacle =
-        obstacles_container->GetPerceptionObstacle(id);
+  // the obstacles are predicted in parallel, and added in the order of
+  // their ids in the container
+  std::vector<PredictionObstacle> prediction_obstacles(obstacles.size());
+  PredictionThreadPool::ForEach(static_cast<int>(obstacles.size()),
+      [&](const int i, const int thread_index) {
+    PredictionObstacle* prediction_obstacle = &prediction_obstacles[i];
+    const PerceptionObstacle& perception_obstacle = *perception_obstacles[i];
     // if obstacle == nullptr, that means obstacle is not predictable
     // Checkout the logic of non-predictable in obstacle.cc
-    if (obstacle != nullptr) {
-      PredictObstacle(obstacle, &prediction_obstacle, adc_trajectory_container);
+    if (obstacles[i] != nullptr) {
+      PredictObstacle(obstacles[i], prediction_obstacle,
+                      adc_trajectory_container, thread_index);
     } else {  // obstacle == nullptr
-      prediction_obstacle.set_timestamp(perception_obstacle.timestamp());
-      prediction_obstacle.set_is_static(true);
+      prediction_obstacle->set_timestamp(perception_obstacle.timestamp());
+      prediction_obstacle->set_is_static(true);
     }
 
-    prediction_obstacle.set_predicted_period(
+    prediction_obstacle->set_predicted_period(
         FLAGS_prediction_trajectory_time_length);
-    prediction_obstacle.mutable_perception_obstacle()->CopyFrom(
+    prediction_obstacle->mutable_perception_obstacle()->CopyFrom(
         perception_obstacle);
+  });
 
-    prediction_obstacles_.add_prediction_obstacle()->CopyFrom(
-        prediction_obstacle);
+  for (PredictionObstacle& prediction_obstacle : prediction_obstacles) {
+    prediction_obstacles_.add_prediction_obstacle()->Swap(
+        &prediction_obstacle);
   }
 }
 
 void PredictorManager::PredictObstacle(
     Obstacle* obstacle, PredictionObstacle* const prediction_obstacle,
     ADCTrajectoryContainer* adc_trajectory_container) {
+  PredictObstacle(obstacle, prediction_obstacle, adc_trajectory_container, 0);
+}
+
+void PredictorManager::PredictObstacle(
+    Obstacle* obstacle, PredictionObstacle* const prediction_obstacle,
+    ADCTrajectoryContainer* adc_trajectory_container,
+    const int thread_index) {
   CHECK_NOTNULL(obstacle);
   Predictor* predictor = nullptr;
   prediction_obstacle->set_timestamp(obstacle->timestamp());
   if (obstacle->ToIgnore()) {
     ADEBUG << "Ignore obstacle [" << obstacle->id() << "]";
-    predictor = GetPredictor(ObstacleConf::EMPTY_PREDICTOR);
+    predictor = GetPredictor(ObstacleConf::EMPTY_PREDICTOR, thread_index);
     prediction_obstacle->mutable_priority()
         ->set_priority(ObstaclePriority::IGNORE);
   } else if (obstacle->IsStill()) {
     ADEBUG << "Still obstacle [" << obstacle->id() << "]";
-    predictor = GetPredictor(ObstacleConf::EMPTY_PREDICTOR);
+    predictor = GetPredictor(ObstacleConf::EMPTY_PREDICTOR, thread_index);
+  } else if (obstacle->IsBeyondEvaluationBudget()) {
+    ADEBUG << "Obstacle [" << obstacle->id() << "] is beyond the evaluation "
+           << "budget, predicted by free move";
+    predictor = GetPredictor(ObstacleConf::FREE_MOVE_PREDICTOR, thread_index);
   } else {
     switch (obstacle->type()) {
       case PerceptionObstacle::VEHICLE: {
         if (obstacle->HasJunctionFeatureWithExits() &&
             !obstacle->IsCloseToJunctionExit()) {
-          predictor = GetPredictor(vehicle_in_junction_predictor_);
+          predictor =
+              GetPredictor(vehicle_in_junction_predictor_, thread_index);
           CHECK_NOTNULL(predictor);
         } else if (obstacle->IsOnLane()) {
-          predictor = GetPredictor(vehicle_on_lane_predictor_);
+          predictor = GetPredictor(vehicle_on_lane_predictor_, thread_index);
           CHECK_NOTNULL(predictor);
         } else {
-          predictor = GetPredictor(vehicle_off_lane_predictor_);
+          predictor = GetPredictor(vehicle_off_lane_predictor_, thread_index);
           CHECK_NOTNULL(predictor);
         }
         break;
       }
       case PerceptionObstacle::PEDESTRIAN: {
-        predictor = GetPredictor(pedestrian_predictor_);
+        predictor = GetPredictor(pedestrian_predictor_, thread_index);
         break;
       }
       case PerceptionObstacle::BICYCLE: {
         if (obstacle->IsOnLane() && !obstacle->IsNearJunction()) {
-          predictor = GetPredictor(cyclist_on_lane_predictor_);
+          predictor = GetPredictor(cyclist_on_lane_predictor_, thread_index);
         } else {
-          predictor = GetPredictor(cyclist_off_lane_predictor_);
+          predictor = GetPredictor(cyclist_off_lane_predictor_, thread_index);
         }
         break;
       }
       default: {
         if (obstacle->IsOnLane()) {
-          predictor = GetPredictor(default_on_lane_predictor_);
+          predictor = GetPredictor(default_on_lane_predictor_, thread_index);
         } else {
-          predictor = GetPredictor(default_off_lane_predictor_);
+          predictor = GetPredictor(default_off_lane_predictor_, thread_index);
         }
         break;
       }
@@ -23,6 +23,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "modules/prediction/predictor/predictor.h"
 #include "modules/prediction/proto/prediction_conf.pb.h"
@@ -75,6 +76,27 @@ class PredictorManager {
   const PredictionObstacles& prediction_obstacles();
 
  private:
+  /**
+   * @brief Predict a single obstacle with the predictors of a thread
+   * @param A pointer to the specific obstacle
+   * @param A pointer to prediction_obstacle
+   * @param A pointer to adc_trajectory_container
+   * @param Index of the thread
+   */
+  void PredictObstacle(Obstacle* obstacle,
+      PredictionObstacle* const prediction_obstacle,
+      ADCTrajectoryContainer* adc_trajectory_container,
+      const int thread_index);
+
+  /**
+   * @brief Get the predictor of a thread
+   * @param Predictor type
+   * @param Index of the thread
+   * @return Pointer to the predictor
+   */
+  Predictor* GetPredictor(const ObstacleConf::PredictorType& type,
+                          const int thread_index);
+
   /**
    * @brief Register a predictor by type
    * @param Predictor type
@@ -97,6 +119,12 @@ class PredictorManager {
  private:
   std::map<ObstacleConf::PredictorType, std::unique_ptr<Predictor>> predictors_;
 
+  // predictors keep the trajectories of the obstacle they predict, so every
+  // thread but the first has its own instances
+  std::vector<
+      std::map<ObstacleConf::PredictorType, std::unique_ptr<Predictor>>>
+      thread_predictors_;
+
   ObstacleConf::PredictorType vehicle_on_lane_predictor_ =
       ObstacleConf::LANE_SEQUENCE_PREDICTOR;
 
@@ -16,10 +16,13 @@
 
 #include "modules/prediction/predictor/sequence/sequence_predictor.h"
 
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <utility>
 
+#include "modules/common/math/linear_interpolation.h"
+#include "modules/common/math/math_utils.h"
 #include "modules/prediction/common/prediction_gflags.h"
 #include "modules/prediction/container/container_manager.h"
 #include "modules/prediction/container/pose/pose_container.h"
@@ -30,6 +33,7 @@ namespace prediction {
 using apollo::common::PathPoint;
 using apollo::common::TrajectoryPoint;
 using apollo::common::adapter::AdapterConfig;
+using apollo::common::math::Vec2d;
 using apollo::hdmap::LaneInfo;
 
 void SequencePredictor::Predict(Obstacle* obstacle) {
@@ -269,39 +273,26 @@ void SequencePredictor::DrawConstantAccelerationTrajectory(
   Eigen::Vector2d position(feature.position().x(), feature.position().y());
   double speed = feature.speed();
 
-  int lane_segment_index = 0;
-  std::string lane_id =
-      lane_sequence.lane_segment(lane_segment_index).lane_id();
-  std::shared_ptr<const LaneInfo> lane_info = PredictionMap::LaneById(lane_id);
+  std::vector<std::shared_ptr<const LaneInfo>> lanes;
+  if (!GetLanes(lane_sequence, &lanes)) {
+    return;
+  }
+  int lane_index = 0;
   double lane_s = 0.0;
   double lane_l = 0.0;
-  if (!PredictionMap::GetProjection(position, lane_info, &lane_s, &lane_l)) {
+  if (!PredictionMap::GetProjection(position, lanes[0], &lane_s, &lane_l)) {
     AERROR << "Failed in getting lane s and lane l";
     return;
   }
   size_t total_num = static_cast<size_t>(total_time / period);
+  std::vector<LaneTrajectoryPoint> lane_points(total_num);
   for (size_t i = 0; i < total_num; ++i) {
-    double relative_time = static_cast<double>(i) * period;
-    Eigen::Vector2d point;
-    double theta = M_PI;
-    if (!PredictionMap::SmoothPointFromLane(lane_id, lane_s, lane_l, &point,
-                                            &theta)) {
-      AERROR << "Unable to get smooth point from lane [" << lane_id
-             << "] with s [" << lane_s << "] and l [" << lane_l << "]";
-      break;
-    }
-    TrajectoryPoint trajectory_point;
-    PathPoint path_point;
-    path_point.set_x(point.x());
-    path_point.set_y(point.y());
-    path_point.set_z(0.0);
-    path_point.set_theta(theta);
-    path_point.set_lane_id(lane_id);
-    trajectory_point.mutable_path_point()->CopyFrom(path_point);
-    trajectory_point.set_v(speed);
-    trajectory_point.set_a(0.0);
-    trajectory_point.set_relative_time(relative_time);
-    points->emplace_back(std::move(trajectory_point));
+    LaneTrajectoryPoint& lane_point = lane_points[i];
+    lane_point.lane_index = lane_index;
+    lane_point.lane_s = lane_s;
+    lane_point.lane_l = lane_l;
+    lane_point.v = speed;
+    lane_point.relative_time = static_cast<double>(i) * period;
 
     if (speed < FLAGS_double_precision) {
       continue;
@@ -309,15 +300,92 @@ void SequencePredictor::DrawConstantAccelerationTrajectory(
 
     lane_s += speed * period + 0.5 * acceleration * period * period;
     speed += acceleration * period;
+    MoveToNextLanes(lanes, &lane_index, &lane_s);
+    lane_l *= FLAGS_go_approach_rate;
+  }
+  LanePointsToTrajectoryPoints(lanes, lane_points, points);
+}
 
-    while (lane_s > PredictionMap::LaneById(lane_id)->total_length() &&
-           lane_segment_index + 1 < lane_sequence.lane_segment_size()) {
-      lane_segment_index += 1;
-      lane_s = lane_s - PredictionMap::LaneById(lane_id)->total_length();
-      lane_id = lane_sequence.lane_segment(lane_segment_index).lane_id();
+bool SequencePredictor::GetLanes(
+    const LaneSequence& lane_sequence,
+    std::vector<std::shared_ptr<const LaneInfo>>* lanes) {
+  lanes->clear();
+  for (const LaneSegment& lane_segment : lane_sequence.lane_segment()) {
+    std::shared_ptr<const LaneInfo> lane =
+        PredictionMap::LaneById(lane_segment.lane_id());
+    if (lane == nullptr) {
+      AERROR << "Unable to find lane [" << lane_segment.lane_id() << "]";
+      return false;
     }
+    lanes->push_back(std::move(lane));
+  }
+  return !lanes->empty();
+}
 
-    lane_l *= FLAGS_go_approach_rate;
+void SequencePredictor::MoveToNextLanes(
+    const std::vector<std::shared_ptr<const LaneInfo>>& lanes,
+    int* lane_index, double* lane_s) {
+  while (*lane_s > lanes[*lane_index]->total_length() &&
+         *lane_index + 1 < static_cast<int>(lanes.size())) {
+    *lane_s -= lanes[*lane_index]->total_length();
+    ++(*lane_index);
+  }
+}
+
+void SequencePredictor::LanePointsToTrajectoryPoints(
+    const std::vector<std::shared_ptr<const LaneInfo>>& lanes,
+    const std::vector<LaneTrajectoryPoint>& lane_points,
+    std::vector<TrajectoryPoint>* points) {
+  points->reserve(points->size() + lane_points.size());
+  int lane_index = -1;
+  // index of the first lane point at or after the lane s
+  size_t index = 0;
+  for (const LaneTrajectoryPoint& lane_point : lane_points) {
+    const LaneInfo& lane = *lanes[lane_point.lane_index];
+    const std::vector<Vec2d>& lane_points_xy = lane.points();
+    const std::vector<double>& accumulated_s = lane.accumulate_s();
+    if (lane_points_xy.size() < 2) {
+      AERROR << "Unable to get smooth point from lane [" << lane.id().id()
+             << "] with s [" << lane_point.lane_s << "]";
+      break;
+    }
+    if (lane_point.lane_index != lane_index) {
+      lane_index = lane_point.lane_index;
+      index = 0;
+    }
+
+    // Same smooth point and heading as LaneInfo::GetSmoothPoint and
+    // LaneInfo::Heading, without a binary search.
+    const double s =
+        common::math::Clamp(lane_point.lane_s, 0.0, lane.total_length());
+    while (index + 1 < accumulated_s.size() && accumulated_s[index] < s) {
+      ++index;
+    }
+    while (index > 0 && accumulated_s[index - 1] >= s) {
+      --index;
+    }
+    Vec2d lane_xy = lane_points_xy[index];
+    double theta = lane.headings()[index];
+    const double delta_s = accumulated_s[index] - s;
+    if (index > 0 && delta_s >= common::math::kMathEpsilon) {
+      lane_xy -= lane.unit_directions()[index - 1] * delta_s;
+      theta = common::math::slerp(lane.headings()[index - 1],
+                                  accumulated_s[index - 1],
+                                  lane.headings()[index],
+                                  accumulated_s[index], s);
+    }
+
+    TrajectoryPoint trajectory_point;
+    PathPoint* path_point = trajectory_point.mutable_path_point();
+    path_point->set_x(lane_xy.x() - std::sin(theta) * lane_point.lane_l);
+    path_point->set_y(lane_xy.y() + std::cos(theta) * lane_point.lane_l);
+    path_point->set_z(0.0);
+    path_point->set_theta(theta);
+    path_point->set_lane_id(lane.id().id());
+    trajectory_point.set_v(lane_point.v);
+    trajectory_point.set_a(lane_point.a);
+    trajectory_point.set_relative_time(lane_point.relative_time);
+    points->push_back(std::move(trajectory_point));
   }
 }
 
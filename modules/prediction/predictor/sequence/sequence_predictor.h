@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -61,6 +62,52 @@ class SequencePredictor : public Predictor {
   FRIEND_TEST(SequencePredictorTest, General);
 
  protected:
+  /**
+   * @brief A trajectory point in the lane coordinates of a lane sequence
+   */
+  struct LaneTrajectoryPoint {
+    int lane_index = 0;
+    double lane_s = 0.0;
+    double lane_l = 0.0;
+    double v = 0.0;
+    double a = 0.0;
+    double relative_time = 0.0;
+  };
+
+  /**
+   * @brief Get the lanes of a lane sequence
+   * @param Lane sequence
+   * @param Lanes, one per lane segment
+   * @return False if a lane is not in the map
+   */
+  static bool GetLanes(
+      const LaneSequence& lane_sequence,
+      std::vector<std::shared_ptr<const hdmap::LaneInfo>>* lanes);
+
+  /**
+   * @brief Move a lane s beyond the end of its lane onto the next lanes
+   * @param Lanes of the lane sequence
+   * @param Index of the lane, updated
+   * @param Lane s, updated
+   */
+  static void MoveToNextLanes(
+      const std::vector<std::shared_ptr<const hdmap::LaneInfo>>& lanes,
+      int* lane_index, double* lane_s);
+
+  /**
+   * @brief Convert the lane points of a trajectory into trajectory points.
+   *        The points are placed by a single walk along the lane points,
+   *        from where the previous point was found, and the protobuf points
+   *        are only filled here.
+   * @param Lanes of the lane sequence
+   * @param Lane points, in time order
+   * @param Trajectory points to append to
+   */
+  static void LanePointsToTrajectoryPoints(
+      const std::vector<std::shared_ptr<const hdmap::LaneInfo>>& lanes,
+      const std::vector<LaneTrajectoryPoint>& lane_points,
+      std::vector<apollo::common::TrajectoryPoint>* points);
+
   /**
    * @brief Filter lane sequences
    * @param Lane graph
@@ -16,6 +16,9 @@
 
 #include "modules/prediction/scenario/feature_extractor/feature_extractor.h"
 
+#include <cmath>
+
+#include "modules/common/math/math_utils.h"
 #include "modules/prediction/common/prediction_gflags.h"
 
 namespace apollo {
@@ -28,6 +31,8 @@ using hdmap::JunctionInfo;
 using LaneInfoPtr = std::shared_ptr<const LaneInfo>;
 using JunctionInfoPtr = std::shared_ptr<const JunctionInfo>;
 
+FeatureExtractor::Cache FeatureExtractor::cache_;
+
 EnvironmentFeatures FeatureExtractor::ExtractEnvironmentFeatures() {
   EnvironmentFeatures environment_features;
 
@@ -63,6 +68,20 @@ EnvironmentFeatures FeatureExtractor::ExtractEnvironmentFeatures() {
     return environment_features;
   }
 
+  // The ego lane is searched again when the pose goes back in time, as on
+  // a replay, or when the ego vehicle heads to another junction.
+  auto ego_trajectory_container = ContainerManager::Instance()->GetContainer<
+      ADCTrajectoryContainer>(AdapterConfig::PLANNING_TRAJECTORY);
+  JunctionInfoPtr adc_junction = ego_trajectory_container == nullptr
+                                     ? nullptr
+                                     : ego_trajectory_container->ADCJunction();
+  double timestamp = ego_state_container->GetTimestamp();
+  if (timestamp < cache_.timestamp || adc_junction != cache_.adc_junction) {
+    cache_.ego_lane = nullptr;
+  }
+  cache_.timestamp = timestamp;
+  cache_.adc_junction = adc_junction;
+
   Vec2d ego_position(ptr_ego_state->position().x(),
       ptr_ego_state->position().y());
 
@@ -168,6 +187,18 @@ void FeatureExtractor::ExtractFrontJunctionFeatures(
   if (junction == nullptr) {
     return;
   }
+  if (NeedConsiderJunction(junction)) {
+    ptr_environment_features->SetFrontJunction(junction->id().id(),
+          ego_trajectory_container->ADCDistanceToJunction());
+  }
+}
+
+bool FeatureExtractor::NeedConsiderJunction(const JunctionInfoPtr& junction) {
+  bool use_cache =
+      FLAGS_enable_scenario_feature_cache && !FLAGS_use_navigation_mode;
+  if (use_cache && cache_.junction_id == junction->id().id()) {
+    return cache_.need_consider_junction;
+  }
   // Only consider junction have overlap with signal or stop_sign
   bool need_consider = FLAGS_enable_all_junction;
   for (const auto &overlap_id : junction->junction().overlap_id()) {
@@ -181,23 +212,55 @@ void FeatureExtractor::ExtractFrontJunctionFeatures(
       }
     }
   }
-  if (need_consider) {
-    ptr_environment_features->SetFrontJunction(junction->id().id(),
-          ego_trajectory_container->ADCDistanceToJunction());
+  if (use_cache) {
+    cache_.junction_id = junction->id().id();
+    cache_.need_consider_junction = need_consider;
   }
+  return need_consider;
 }
 
 LaneInfoPtr FeatureExtractor::GetEgoLane(const common::Point3D& position,
     const double heading) {
+  if (IsCachedEgoLaneValid(position, heading)) {
+    return cache_.ego_lane;
+  }
+
   common::PointENU position_enu;
   position_enu.set_x(position.x());
   position_enu.set_y(position.y());
   position_enu.set_z(position.z());
 
-  return PredictionMap::GetMostLikelyCurrentLane(position_enu,
+  LaneInfoPtr ego_lane = PredictionMap::GetMostLikelyCurrentLane(position_enu,
       FLAGS_lane_distance_threshold, heading,
       FLAGS_lane_angle_difference_threshold);
+  if (FLAGS_enable_scenario_feature_cache && !FLAGS_use_navigation_mode) {
+    cache_.ego_lane = ego_lane;
+  }
+  return ego_lane;
 }
 
+bool FeatureExtractor::IsCachedEgoLaneValid(const common::Point3D& position,
+    const double heading) {
+  // The relative map of the navigation mode changes every frame.
+  if (!FLAGS_enable_scenario_feature_cache || FLAGS_use_navigation_mode ||
+      cache_.ego_lane == nullptr) {
+    return false;
+  }
+  // The ego vehicle is still within the lane it was found on and follows it,
+  // it has neither changed lane nor left the lane to its successor.
+  const Vec2d point(position.x(), position.y());
+  if (!cache_.ego_lane->IsOnLane(point)) {
+    return false;
+  }
+  double s = 0.0;
+  double l = 0.0;
+  cache_.ego_lane->GetProjection(point, &s, &l);
+  double angle_diff =
+      common::math::AngleDiff(heading, cache_.ego_lane->Heading(s));
+  return std::fabs(angle_diff) <= FLAGS_lane_angle_difference_threshold;
+}
+
+void FeatureExtractor::ClearCache() { cache_ = Cache(); }
+
 }  // namespace prediction
 }  // namespace apollo
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "modules/prediction/common/environment_features.h"
 #include "modules/prediction/container/adc_trajectory/adc_trajectory_container.h"
@@ -43,7 +44,13 @@ class FeatureExtractor {
    */
   static EnvironmentFeatures ExtractEnvironmentFeatures();
 
+  /**
+   * @brief Drop the ego lane and junction reused across frames
+   */
+  static void ClearCache();
+
   FRIEND_TEST(FeatureExtractorTest, junction);
+  FRIEND_TEST(FeatureExtractorTest, ego_lane_cache);
 
  private:
   static void ExtractEgoLaneFeatures(
@@ -62,6 +69,27 @@ class FeatureExtractor {
   static std::shared_ptr<const hdmap::LaneInfo> GetEgoLane(
       const common::Point3D& position,
       const double heading);
+
+  static bool IsCachedEgoLaneValid(const common::Point3D& position,
+                                   const double heading);
+
+  static bool NeedConsiderJunction(
+      const std::shared_ptr<const hdmap::JunctionInfo>& junction);
+
+ private:
+  // Scenario features which only change on a lane change or a junction
+  // entry, reused as long as the pose of the ego vehicle agrees with them.
+  struct Cache {
+    // timestamp of the pose the ego lane was searched with
+    double timestamp = 0.0;
+    // ADC junction when the ego lane was searched
+    std::shared_ptr<const hdmap::JunctionInfo> adc_junction = nullptr;
+    std::shared_ptr<const hdmap::LaneInfo> ego_lane = nullptr;
+    std::string junction_id;
+    bool need_consider_junction = false;
+  };
+
+  static Cache cache_;
 };
 
 }  // namespace prediction
@@ -39,5 +39,30 @@ TEST_F(FeatureExtractorTest, junction) {
   EXPECT_TRUE(!environment_features.has_front_junction());
 }
 
+TEST_F(FeatureExtractorTest, ego_lane_cache) {
+  FeatureExtractor::ClearCache();
+  common::Point3D position;
+  position.set_x(124.85930930657942);
+  position.set_y(348.52732962417451);
+  const double heading = -0.066794953844859783;
+  EXPECT_FALSE(FeatureExtractor::IsCachedEgoLaneValid(position, heading));
+
+  FeatureExtractor::cache_.ego_lane = PredictionMap::LaneById("l20");
+  EXPECT_TRUE(FeatureExtractor::IsCachedEgoLaneValid(position, heading));
+  EXPECT_EQ("l20",
+            FeatureExtractor::GetEgoLane(position, heading)->id().id());
+
+  // heading backwards
+  EXPECT_FALSE(
+      FeatureExtractor::IsCachedEgoLaneValid(position, heading + M_PI));
+
+  // off the lane
+  position.set_y(358.52732962417451);
+  EXPECT_FALSE(FeatureExtractor::IsCachedEgoLaneValid(position, heading));
+
+  FeatureExtractor::ClearCache();
+  EXPECT_TRUE(FeatureExtractor::cache_.ego_lane == nullptr);
+}
+
 }  // namespace prediction
 }  // namespace apollo
@@ -31,12 +31,23 @@ using common::math::Vec2d;
 using common::math::Box2d;
 using apollo::perception::PerceptionObstacle;
 
+double ObstaclesPrioritizer::evaluation_budget_scale_ = 1.0;
+
 void ObstaclesPrioritizer::PrioritizeObstacles(
     const EnvironmentFeatures& environment_features,
     const std::shared_ptr<ScenarioFeatures> scenario_features) {
   AssignIgnoreLevel(environment_features, scenario_features);
 }
 
+void ObstaclesPrioritizer::UpdateEvaluationBudget(const double latency_ms) {
+  if (latency_ms > FLAGS_prediction_latency_target_ms) {
+    evaluation_budget_scale_ = std::max(FLAGS_min_evaluation_budget_scale,
+                                        0.8 * evaluation_budget_scale_);
+  } else if (latency_ms < 0.8 * FLAGS_prediction_latency_target_ms) {
+    evaluation_budget_scale_ = std::min(1.0, 1.05 * evaluation_budget_scale_);
+  }
+}
+
 void ObstaclesPrioritizer::AssignIgnoreLevel(
     const EnvironmentFeatures& environment_features,
     const std::shared_ptr<ScenarioFeatures> ptr_scenario_features) {
@@ -110,9 +121,21 @@ void ObstaclesPrioritizer::AssignIgnoreLevel(
     bool need_consider = is_in_scan_area || is_on_lane || is_near_junction ||
                          is_pedestrian_like_in_front_near_lanes;
 
+    // With an evaluation budget, the obstacles close to the ego vehicle are
+    // the caution ones and the far ones are only predicted by free move.
+    double distance = ego_to_obstacle_vec.Length();
+    bool is_caution = FLAGS_enable_evaluation_budget &&
+        distance <= FLAGS_caution_obstacle_distance * evaluation_budget_scale_;
+    bool is_beyond_budget = FLAGS_enable_evaluation_budget && need_consider &&
+        distance > FLAGS_evaluation_budget_distance * evaluation_budget_scale_;
+    obstacle_ptr->SetBeyondEvaluationBudget(is_beyond_budget);
+
     if (!need_consider) {
       latest_feature_ptr->mutable_priority()->set_priority(
             ObstaclePriority::IGNORE);
+    } else if (is_caution) {
+      latest_feature_ptr->mutable_priority()->set_priority(
+            ObstaclePriority::CAUTION);
     } else {
       latest_feature_ptr->mutable_priority()->set_priority(
             ObstaclePriority::NORMAL);
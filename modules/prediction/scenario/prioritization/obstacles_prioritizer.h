@@ -31,6 +31,20 @@ class ObstaclesPrioritizer {
       const EnvironmentFeatures& environment_features,
       const std::shared_ptr<ScenarioFeatures> scenario_features);
 
+  /**
+   * @brief Adapt the budget distances of the evaluation to the processing
+   *        time of the last perception frame: they shrink when the latency
+   *        target is exceeded and grow back when there is time left.
+   * @param Processing time of the last perception frame in milliseconds
+   */
+  static void UpdateEvaluationBudget(const double latency_ms);
+
+  /**
+   * @brief Get the scale of the budget distances
+   * @return The scale in [min_evaluation_budget_scale, 1]
+   */
+  static double evaluation_budget_scale() { return evaluation_budget_scale_; }
+
  private:
   static void AssignIgnoreLevel(
       const EnvironmentFeatures& environment_features,
@@ -40,6 +54,9 @@ class ObstaclesPrioritizer {
       const EnvironmentFeatures& environment_features,
       const std::shared_ptr<CruiseScenarioFeatures> scenario_features,
       ObstaclesContainer* ptr_obstacle_contrainer);
+
+ private:
+  static double evaluation_budget_scale_;
 };
 
 }  // namespace prediction
@@ -32,3 +32,13 @@ DEFINE_bool(enable_change_lane_in_result, true,
 
 DEFINE_uint32(routing_response_history_interval_ms, 1000,
               "ms, emit routing resposne for this time interval");
+
+DEFINE_bool(enable_routing_response_cache, false,
+            "reuse the response of a recent request with the same waypoints "
+            "and black lists");
+DEFINE_uint32(routing_response_cache_capacity, 64,
+              "number of routing responses kept in the cache");
+DEFINE_double(routing_response_cache_s_resolution, 0.1,
+              "meters, waypoints of a lane closer than this share responses");
+DEFINE_bool(enable_routing_async_process, false,
+            "search the routing requests concurrently on the task pool");
@@ -115,18 +115,17 @@ Navigator::~Navigator() {}
 
 bool Navigator::IsReady() const { return is_ready_; }
 
-void Navigator::Clear() { topo_range_manager_.Clear(); }
-
 bool Navigator::Init(const RoutingRequest& request, const TopoGraph* graph,
                      std::vector<const TopoNode*>* const way_nodes,
-                     std::vector<double>* const way_s) {
-  Clear();
+                     std::vector<double>* const way_s,
+                     TopoRangeManager* const range_manager) const {
+  range_manager->Clear();
   if (!GetWayNodes(request, graph_.get(), way_nodes, way_s)) {
     AERROR << "Failed to find search terminal point in graph!";
     return false;
   }
   black_list_generator_->GenerateBlackMapFromRequest(request, graph_.get(),
-                                                     &topo_range_manager_);
+                                                     range_manager);
   return true;
 }
 
@@ -151,7 +150,7 @@ bool Navigator::MergeRoute(
 
 bool Navigator::SearchRouteByStrategy(
     const TopoGraph* graph, const std::vector<const TopoNode*>& way_nodes,
-    const std::vector<double>& way_s,
+    const std::vector<double>& way_s, const TopoRangeManager& range_manager,
     std::vector<NodeWithRange>* const result_nodes) const {
   std::unique_ptr<Strategy> strategy_ptr;
   strategy_ptr.reset(new AStarStrategy(FLAGS_enable_change_lane_in_result));
@@ -164,7 +163,7 @@ bool Navigator::SearchRouteByStrategy(
     double way_start_s = way_s[i - 1];
     double way_end_s = way_s[i];
 
-    TopoRangeManager full_range_manager = topo_range_manager_;
+    TopoRangeManager full_range_manager = range_manager;
     black_list_generator_->AddBlackMapFromTerminal(
         way_start, way_end, way_start_s, way_end_s, &full_range_manager);
 
@@ -202,7 +201,7 @@ bool Navigator::SearchRouteByStrategy(
 }
 
 bool Navigator::SearchRoute(const RoutingRequest& request,
-                            RoutingResponse* const response) {
+                            RoutingResponse* const response) const {
   if (!ShowRequestInfo(request, graph_.get())) {
     SetErrorCode(ErrorCode::ROUTING_ERROR_REQUEST,
                  "Error encountered when reading request point!",
@@ -217,14 +216,16 @@ bool Navigator::SearchRoute(const RoutingRequest& request,
   }
   std::vector<const TopoNode*> way_nodes;
   std::vector<double> way_s;
-  if (!Init(request, graph_.get(), &way_nodes, &way_s)) {
+  TopoRangeManager range_manager;
+  if (!Init(request, graph_.get(), &way_nodes, &way_s, &range_manager)) {
     SetErrorCode(ErrorCode::ROUTING_ERROR_NOT_READY,
                  "Failed to initialize navigator!", response->mutable_status());
     return false;
   }
 
   std::vector<NodeWithRange> result_nodes;
-  if (!SearchRouteByStrategy(graph_.get(), way_nodes, way_s, &result_nodes)) {
+  if (!SearchRouteByStrategy(graph_.get(), way_nodes, way_s, range_manager,
+                             &result_nodes)) {
     SetErrorCode(ErrorCode::ROUTING_ERROR_RESPONSE,
                  "Failed to find route with request!",
                  response->mutable_status());
@@ -239,7 +240,7 @@ bool Navigator::SearchRoute(const RoutingRequest& request,
   result_nodes.back().SetEndS(request.waypoint().rbegin()->s());
 
   if (!result_generator_->GeneratePassageRegion(
-          graph_->MapVersion(), request, result_nodes, topo_range_manager_,
+          graph_->MapVersion(), request, result_nodes, range_manager,
           response)) {
     SetErrorCode(ErrorCode::ROUTING_ERROR_RESPONSE,
                  "Failed to generate passage regions based on result lanes",
@@ -33,19 +33,20 @@ class Navigator {
 
   bool IsReady() const;
 
+  // Only reads the graph, so that several requests may be searched
+  // concurrently.
   bool SearchRoute(const RoutingRequest& request,
-                   RoutingResponse* const response);
+                   RoutingResponse* const response) const;
 
  private:
   bool Init(const RoutingRequest& request, const TopoGraph* graph,
             std::vector<const TopoNode*>* const way_nodes,
-            std::vector<double>* const way_s);
-
-  void Clear();
+            std::vector<double>* const way_s,
+            TopoRangeManager* const range_manager) const;
 
   bool SearchRouteByStrategy(
       const TopoGraph* graph, const std::vector<const TopoNode*>& way_nodes,
-      const std::vector<double>& way_s,
+      const std::vector<double>& way_s, const TopoRangeManager& range_manager,
       std::vector<NodeWithRange>* const result_nodes) const;
 
   bool MergeRoute(const std::vector<NodeWithRange>& node_vec,
@@ -55,8 +56,6 @@ class Navigator {
   bool is_ready_ = false;
   std::unique_ptr<TopoGraph> graph_;
 
-  TopoRangeManager topo_range_manager_;
-
   std::unique_ptr<BlackListRangeGenerator> black_list_generator_;
   std::unique_ptr<ResultGenerator> result_generator_;
 };
@@ -16,7 +16,8 @@
 
 #include "modules/routing/graph/topo_graph.h"
 
-#include <utility>
+#include <algorithm>
+#include <cmath>
 
 namespace apollo {
 namespace routing {
@@ -25,6 +26,10 @@ void TopoGraph::Clear() {
   topo_nodes_.clear();
   topo_edges_.clear();
   node_index_map_.clear();
+  road_node_map_.clear();
+  node_pointer_index_map_.clear();
+  landmark_cost_from_.clear();
+  landmark_cost_to_.clear();
 }
 
 bool TopoGraph::LoadNodes(const Graph& graph) {
@@ -32,12 +37,14 @@ bool TopoGraph::LoadNodes(const Graph& graph) {
     AERROR << "No nodes found in topology graph.";
     return false;
   }
+  topo_nodes_.reserve(graph.node_size());
   for (const auto& node : graph.node()) {
-    node_index_map_[node.lane_id()] = static_cast<int>(topo_nodes_.size());
-    std::shared_ptr<TopoNode> topo_node;
-    topo_node.reset(new TopoNode(node));
-    road_node_map_[node.road_id()].insert(topo_node.get());
-    topo_nodes_.push_back(std::move(topo_node));
+    const int index = static_cast<int>(topo_nodes_.size());
+    node_index_map_[node.lane_id()] = index;
+    topo_nodes_.emplace_back(node);
+    const TopoNode* topo_node = &topo_nodes_.back();
+    road_node_map_[node.road_id()].insert(topo_node);
+    node_pointer_index_map_[topo_node] = index;
   }
   return true;
 }
@@ -48,6 +55,7 @@ bool TopoGraph::LoadEdges(const Graph& graph) {
     AINFO << "0 edges found in topology graph, but it's fine";
     return true;
   }
+  topo_edges_.reserve(graph.edge_size());
   for (const auto& edge : graph.edge()) {
     const std::string& from_lane_id = edge.from_lane_id();
     const std::string& to_lane_id = edge.to_lane_id();
@@ -55,17 +63,43 @@ bool TopoGraph::LoadEdges(const Graph& graph) {
         node_index_map_.count(to_lane_id) != 1) {
       return false;
     }
-    std::shared_ptr<TopoEdge> topo_edge;
-    TopoNode* from_node = topo_nodes_[node_index_map_[from_lane_id]].get();
-    TopoNode* to_node = topo_nodes_[node_index_map_[to_lane_id]].get();
-    topo_edge.reset(new TopoEdge(edge, from_node, to_node));
-    from_node->AddOutEdge(topo_edge.get());
-    to_node->AddInEdge(topo_edge.get());
-    topo_edges_.push_back(std::move(topo_edge));
+    TopoNode* from_node = &topo_nodes_[node_index_map_[from_lane_id]];
+    TopoNode* to_node = &topo_nodes_[node_index_map_[to_lane_id]];
+    topo_edges_.emplace_back(edge, from_node, to_node);
+    const TopoEdge* topo_edge = &topo_edges_.back();
+    from_node->AddOutEdge(topo_edge);
+    to_node->AddInEdge(topo_edge);
   }
   return true;
 }
 
+bool TopoGraph::LoadLandmarks(const Graph& graph) {
+  const int num_nodes = graph.node_size();
+  for (const auto& landmark : graph.landmark()) {
+    if (landmark.cost_from_size() != num_nodes ||
+        landmark.cost_to_size() != num_nodes) {
+      AERROR << "Landmark " << landmark.lane_id()
+             << " does not match the nodes of topology graph.";
+      return false;
+    }
+  }
+  if (graph.landmark_size() == 0) {
+    return true;
+  }
+  landmark_cost_from_.assign(num_nodes, std::vector<double>());
+  landmark_cost_to_.assign(num_nodes, std::vector<double>());
+  for (int i = 0; i < num_nodes; ++i) {
+    landmark_cost_from_[i].reserve(graph.landmark_size());
+    landmark_cost_to_[i].reserve(graph.landmark_size());
+    for (const auto& landmark : graph.landmark()) {
+      landmark_cost_from_[i].push_back(landmark.cost_from(i));
+      landmark_cost_to_[i].push_back(landmark.cost_to(i));
+    }
+  }
+  AINFO << "Number of landmarks: " << graph.landmark_size();
+  return true;
+}
+
 bool TopoGraph::LoadGraph(const Graph& graph) {
   Clear();
 
@@ -80,6 +114,10 @@ bool TopoGraph::LoadGraph(const Graph& graph) {
     AERROR << "Failed to load edges from topology graph.";
     return false;
   }
+  if (!LoadLandmarks(graph)) {
+    AERROR << "Failed to load landmarks from topology graph.";
+    return false;
+  }
   AINFO << "Load Topo data succesful.";
   return true;
 }
@@ -93,7 +131,7 @@ const TopoNode* TopoGraph::GetNode(const std::string& id) const {
   if (iter == node_index_map_.end()) {
     return nullptr;
   }
-  return topo_nodes_[iter->second].get();
+  return &topo_nodes_[iter->second];
 }
 
 void TopoGraph::GetNodesByRoadId(
@@ -105,5 +143,39 @@ void TopoGraph::GetNodesByRoadId(
   }
 }
 
+bool TopoGraph::HasLandmarks() const { return !landmark_cost_from_.empty(); }
+
+double TopoGraph::LandmarkHeuristic(const TopoNode* src_node,
+                                    const TopoNode* dest_node) const {
+  if (!HasLandmarks()) {
+    return 0.0;
+  }
+  const auto src_iter = node_pointer_index_map_.find(src_node->OriginNode());
+  const auto dest_iter = node_pointer_index_map_.find(dest_node->OriginNode());
+  if (src_iter == node_pointer_index_map_.end() ||
+      dest_iter == node_pointer_index_map_.end() ||
+      src_iter->second == dest_iter->second) {
+    return 0.0;
+  }
+  const auto& src_from = landmark_cost_from_[src_iter->second];
+  const auto& src_to = landmark_cost_to_[src_iter->second];
+  const auto& dest_from = landmark_cost_from_[dest_iter->second];
+  const auto& dest_to = landmark_cost_to_[dest_iter->second];
+  double bound = 0.0;
+  for (size_t i = 0; i < src_from.size(); ++i) {
+    // triangle inequalities through the landmark, skipped when a cost is
+    // infinite as the landmark tells nothing then
+    if (!std::isinf(src_to[i]) && !std::isinf(dest_to[i])) {
+      bound = std::max(bound, src_to[i] - dest_to[i]);
+    }
+    if (!std::isinf(src_from[i]) && !std::isinf(dest_from[i])) {
+      bound = std::max(bound, dest_from[i] - src_from[i]);
+    }
+  }
+  // the bounds count the whole destination lane, the route may end on a
+  // part of it only
+  return std::max(0.0, bound - dest_node->OriginNode()->Cost());
+}
+
 }  // namespace routing
 }  // namespace apollo
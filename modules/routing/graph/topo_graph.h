@@ -16,7 +16,6 @@
 
 #pragma once
 
-#include <memory>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -42,17 +41,30 @@ class TopoGraph {
       const std::string& road_id,
       std::unordered_set<const TopoNode*>* const node_in_road) const;
 
+  bool HasLandmarks() const;
+  // Lower bound of the cost from src_node to dest_node given by the
+  // landmarks of the graph, sub nodes are bounded by their origin nodes.
+  double LandmarkHeuristic(const TopoNode* src_node,
+                           const TopoNode* dest_node) const;
+
  private:
   void Clear();
   bool LoadNodes(const Graph& graph);
   bool LoadEdges(const Graph& graph);
+  bool LoadLandmarks(const Graph& graph);
 
  private:
   std::string map_version_;
   std::string map_district_;
-  std::vector<std::shared_ptr<TopoNode> > topo_nodes_;
-  std::vector<std::shared_ptr<TopoEdge> > topo_edges_;
+  // nodes and edges are stored contiguously, the vectors are reserved
+  // before loading and never grow after, so the pointers to them stay valid
+  std::vector<TopoNode> topo_nodes_;
+  std::vector<TopoEdge> topo_edges_;
   std::unordered_map<std::string, int> node_index_map_;
+  std::unordered_map<const TopoNode*, int> node_pointer_index_map_;
+  // costs from and to every landmark, indexed by node then by landmark
+  std::vector<std::vector<double> > landmark_cost_from_;
+  std::vector<std::vector<double> > landmark_cost_to_;
   std::unordered_map<std::string, std::unordered_set<const TopoNode*> >
       road_node_map_;
 };
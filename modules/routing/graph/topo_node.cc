@@ -20,7 +20,6 @@
 #include <utility>
 
 #include "cyber/common/log.h"
-#include "modules/common/util/map_util.h"
 #include "modules/routing/graph/range_utils.h"
 
 namespace apollo {
@@ -32,7 +31,6 @@ const double MIN_INTERNAL_FOR_NODE = 0.01;  // in meter
 const double kLenghtEpsilon = 1e-6;         // in meter
 
 using ::google::protobuf::RepeatedPtrField;
-using apollo::common::util::FindPtrOrNull;
 
 void ConvertOutRange(const RepeatedPtrField<CurveRange>& range_vec,
                      double start_s, double end_s,
@@ -176,54 +174,66 @@ const std::vector<NodeSRange>& TopoNode::RightOutRange() const {
   return right_out_sorted_range_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::InFromAllEdge() const {
-  return in_from_all_edge_set_;
+const std::vector<const TopoEdge*>& TopoNode::InFromAllEdge() const {
+  return in_from_all_edge_vec_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::InFromLeftEdge() const {
-  return in_from_left_edge_set_;
+const std::vector<const TopoEdge*>& TopoNode::InFromLeftEdge() const {
+  return in_from_left_edge_vec_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::InFromRightEdge() const {
-  return in_from_right_edge_set_;
+const std::vector<const TopoEdge*>& TopoNode::InFromRightEdge() const {
+  return in_from_right_edge_vec_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::InFromLeftOrRightEdge()
+const std::vector<const TopoEdge*>& TopoNode::InFromLeftOrRightEdge()
     const {
-  return in_from_left_or_right_edge_set_;
+  return in_from_left_or_right_edge_vec_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::InFromPreEdge() const {
-  return in_from_pre_edge_set_;
+const std::vector<const TopoEdge*>& TopoNode::InFromPreEdge() const {
+  return in_from_pre_edge_vec_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::OutToAllEdge() const {
-  return out_to_all_edge_set_;
+const std::vector<const TopoEdge*>& TopoNode::OutToAllEdge() const {
+  return out_to_all_edge_vec_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::OutToLeftEdge() const {
-  return out_to_left_edge_set_;
+const std::vector<const TopoEdge*>& TopoNode::OutToLeftEdge() const {
+  return out_to_left_edge_vec_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::OutToRightEdge() const {
-  return out_to_right_edge_set_;
+const std::vector<const TopoEdge*>& TopoNode::OutToRightEdge() const {
+  return out_to_right_edge_vec_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::OutToLeftOrRightEdge()
+const std::vector<const TopoEdge*>& TopoNode::OutToLeftOrRightEdge()
     const {
-  return out_to_left_or_right_edge_set_;
+  return out_to_left_or_right_edge_vec_;
 }
 
-const std::unordered_set<const TopoEdge*>& TopoNode::OutToSucEdge() const {
-  return out_to_suc_edge_set_;
+const std::vector<const TopoEdge*>& TopoNode::OutToSucEdge() const {
+  return out_to_suc_edge_vec_;
 }
 
+// a lane has a handful of neighbors, a scan of the contiguous edges beats
+// a hash lookup
 const TopoEdge* TopoNode::GetInEdgeFrom(const TopoNode* from_node) const {
-  return FindPtrOrNull(in_edge_map_, from_node);
+  for (const auto* edge : in_from_all_edge_vec_) {
+    if (edge->FromNode() == from_node) {
+      return edge;
+    }
+  }
+  return nullptr;
 }
 
 const TopoEdge* TopoNode::GetOutEdgeTo(const TopoNode* to_node) const {
-  return FindPtrOrNull(out_edge_map_, to_node);
+  for (const auto* edge : out_to_all_edge_vec_) {
+    if (edge->ToNode() == to_node) {
+      return edge;
+    }
+  }
+  return nullptr;
 }
 
 const TopoNode* TopoNode::OriginNode() const { return origin_node_; }
@@ -256,48 +266,46 @@ void TopoNode::AddInEdge(const TopoEdge* edge) {
   if (edge->ToNode() != this) {
     return;
   }
-  if (in_edge_map_.count(edge->FromNode()) != 0) {
+  if (GetInEdgeFrom(edge->FromNode()) != nullptr) {
     return;
   }
   switch (edge->Type()) {
     case TET_LEFT:
-      in_from_right_edge_set_.insert(edge);
-      in_from_left_or_right_edge_set_.insert(edge);
+      in_from_right_edge_vec_.push_back(edge);
+      in_from_left_or_right_edge_vec_.push_back(edge);
       break;
     case TET_RIGHT:
-      in_from_left_edge_set_.insert(edge);
-      in_from_left_or_right_edge_set_.insert(edge);
+      in_from_left_edge_vec_.push_back(edge);
+      in_from_left_or_right_edge_vec_.push_back(edge);
       break;
     default:
-      in_from_pre_edge_set_.insert(edge);
+      in_from_pre_edge_vec_.push_back(edge);
       break;
   }
-  in_from_all_edge_set_.insert(edge);
-  in_edge_map_[edge->FromNode()] = edge;
+  in_from_all_edge_vec_.push_back(edge);
 }
 
 void TopoNode::AddOutEdge(const TopoEdge* edge) {
   if (edge->FromNode() != this) {
     return;
   }
-  if (out_edge_map_.count(edge->ToNode()) != 0) {
+  if (GetOutEdgeTo(edge->ToNode()) != nullptr) {
     return;
   }
   switch (edge->Type()) {
     case TET_LEFT:
-      out_to_left_edge_set_.insert(edge);
-      out_to_left_or_right_edge_set_.insert(edge);
+      out_to_left_edge_vec_.push_back(edge);
+      out_to_left_or_right_edge_vec_.push_back(edge);
       break;
     case TET_RIGHT:
-      out_to_right_edge_set_.insert(edge);
-      out_to_left_or_right_edge_set_.insert(edge);
+      out_to_right_edge_vec_.push_back(edge);
+      out_to_left_or_right_edge_vec_.push_back(edge);
       break;
     default:
-      out_to_suc_edge_set_.insert(edge);
+      out_to_suc_edge_vec_.push_back(edge);
       break;
   }
-  out_to_all_edge_set_.insert(edge);
-  out_edge_map_[edge->ToNode()] = edge;
+  out_to_all_edge_vec_.push_back(edge);
 }
 
 bool TopoNode::IsInFromPreEdgeValid() const {
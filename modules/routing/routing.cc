@@ -16,6 +16,8 @@
 
 #include "modules/routing/routing.h"
 
+#include <cmath>
+
 #include "modules/common/util/util.h"
 #include "modules/routing/common/routing_gflags.h"
 
@@ -24,6 +26,36 @@ namespace routing {
 
 using apollo::common::ErrorCode;
 
+namespace {
+
+constexpr size_t kResponseCacheShards = 4;
+
+std::string QuantizedS(const double s) {
+  return std::to_string(
+      std::llround(s / FLAGS_routing_response_cache_s_resolution));
+}
+
+// Requests with the same key get the same route: the waypoints, with their s
+// quantized, and the black lists.
+std::string ResponseCacheKey(const RoutingRequest& request) {
+  std::string key;
+  for (const auto& waypoint : request.waypoint()) {
+    key += waypoint.id() + "@" + QuantizedS(waypoint.s()) + ";";
+  }
+  key += "|";
+  for (const auto& lane : request.blacklisted_lane()) {
+    key += lane.id() + "@" + QuantizedS(lane.start_s()) + "," +
+           QuantizedS(lane.end_s()) + ";";
+  }
+  key += "|";
+  for (const auto& road : request.blacklisted_road()) {
+    key += road + ";";
+  }
+  return key;
+}
+
+}  // namespace
+
 std::string Routing::Name() const { return FLAGS_routing_node_name; }
 
 Routing::Routing()
@@ -42,6 +74,12 @@ apollo::common::Status Routing::Init() {
   hdmap_ = apollo::hdmap::HDMapUtil::BaseMapPtr();
   CHECK(hdmap_) << "Failed to load map file:" << apollo::hdmap::BaseMapFile();
 
+  if (FLAGS_enable_routing_response_cache) {
+    response_cache_.reset(
+        new common::util::ShardedLRUCache<std::string, RoutingResponse>(
+            kResponseCacheShards, FLAGS_routing_response_cache_capacity));
+  }
+
   return apollo::common::Status::OK();
 }
 
@@ -92,13 +130,29 @@ bool Routing::Process(
   CHECK_NOTNULL(routing_response);
   AINFO << "Get new routing request:" << routing_request->DebugString();
   const auto& fixed_request = FillLaneInfoIfMissing(*routing_request);
+  std::string cache_key;
+  if (response_cache_ != nullptr) {
+    cache_key = ResponseCacheKey(fixed_request);
+    if (response_cache_->GetCopy(cache_key, routing_response)) {
+      ADEBUG << "Use cached routing response.";
+      routing_response->mutable_routing_request()->CopyFrom(fixed_request);
+      std::lock_guard<std::mutex> lock(monitor_mutex_);
+      monitor_logger_buffer_.INFO("Routing success!");
+      return true;
+    }
+  }
   if (!navigator_ptr_->SearchRoute(fixed_request, routing_response)) {
     AERROR << "Failed to search route with navigator.";
 
+    std::lock_guard<std::mutex> lock(monitor_mutex_);
     monitor_logger_buffer_.WARN("Routing failed! " +
                                 routing_response->status().msg());
     return false;
   }
+  if (response_cache_ != nullptr) {
+    response_cache_->Put(cache_key, *routing_response);
+  }
+  std::lock_guard<std::mutex> lock(monitor_mutex_);
   monitor_logger_buffer_.INFO("Routing success!");
   return true;
 }
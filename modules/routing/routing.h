@@ -17,10 +17,12 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "modules/common/monitor_log/monitor_log_buffer.h"
 #include "modules/common/status/status.h"
+#include "modules/common/util/sharded_lru_cache.h"
 #include "modules/map/hdmap/hdmap_util.h"
 #include "modules/routing/core/navigator.h"
 #include "modules/routing/proto/routing_config.pb.h"
@@ -55,6 +57,9 @@ class Routing {
    */
   virtual ~Routing() = default;
 
+  /**
+   * @brief search the route of a request, safe to call from several threads
+   */
   bool Process(const std::shared_ptr<RoutingRequest> &routing_request,
                         RoutingResponse* const routing_response);
 
@@ -62,7 +67,10 @@ class Routing {
   RoutingRequest FillLaneInfoIfMissing(const RoutingRequest &routing_request);
 
   std::unique_ptr<Navigator> navigator_ptr_;
+  std::mutex monitor_mutex_;
   common::monitor::MonitorLogBuffer monitor_logger_buffer_;
+  std::unique_ptr<common::util::ShardedLRUCache<std::string, RoutingResponse>>
+      response_cache_;
 
   RoutingConfig routing_conf_;
   const hdmap::HDMap *hdmap_ = nullptr;
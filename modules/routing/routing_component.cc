@@ -18,6 +18,7 @@
 
 #include <utility>
 
+#include "cyber/task/task.h"
 #include "modules/common/adapters/adapter_gflags.h"
 #include "modules/routing/common/routing_gflags.h"
 
@@ -72,16 +73,37 @@ bool RoutingComponent::Init() {
 }
 
 bool RoutingComponent::Proc(const std::shared_ptr<RoutingRequest>& request) {
+  const uint64_t sequence = ++request_sequence_;
+  if (!FLAGS_enable_routing_async_process) {
+    return ProcessRequest(request, sequence);
+  }
+  std::weak_ptr<RoutingComponent> self =
+      std::dynamic_pointer_cast<RoutingComponent>(shared_from_this());
+  cyber::Async([self, request, sequence]() {
+    auto ptr = self.lock();
+    if (ptr) {
+      ptr->ProcessRequest(request, sequence);
+    }
+  });
+  return true;
+}
+
+bool RoutingComponent::ProcessRequest(
+    const std::shared_ptr<RoutingRequest>& request, const uint64_t sequence) {
   auto response = std::make_shared<RoutingResponse>();
   if (!routing_.Process(request, response.get())) {
     return false;
   }
   common::util::FillHeader(node_->Name(), response.get());
-  response_writer_->Write(response);
-  {
-    std::lock_guard<std::mutex> guard(mutex_);
-    response_ = std::move(response);
+  std::lock_guard<std::mutex> guard(mutex_);
+  if (sequence < response_sequence_) {
+    AWARN << "Drop the routing response to request " << sequence
+          << ", a newer request was answered first.";
+    return false;
   }
+  response_writer_->Write(response);
+  response_sequence_ = sequence;
+  response_ = std::move(response);
   return true;
 }
 
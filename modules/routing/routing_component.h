@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include "modules/routing/routing.h"
@@ -32,12 +33,19 @@ class RoutingComponent final
   bool Init() override;
   bool Proc(const std::shared_ptr<RoutingRequest>& request) override;
  private:
+  bool ProcessRequest(const std::shared_ptr<RoutingRequest>& request,
+                      const uint64_t sequence);
+
   std::shared_ptr<::apollo::cyber::Writer<RoutingResponse>>
       response_writer_ = nullptr;
   std::shared_ptr<::apollo::cyber::Writer<RoutingResponse>>
       response_history_writer_ = nullptr;
   Routing routing_;
   std::shared_ptr<RoutingResponse> response_ = nullptr;
+  // requests are numbered on arrival, so that a request searched
+  // concurrently never publishes over the response to a newer one
+  std::atomic<uint64_t> request_sequence_{0};
+  uint64_t response_sequence_ = 0;
   std::unique_ptr<::apollo::cyber::Timer> timer_;
   std::mutex mutex_;
 };
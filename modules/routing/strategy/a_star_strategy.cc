@@ -213,6 +213,10 @@ void AStarStrategy::Clear() {
 
 double AStarStrategy::HeuristicCost(const TopoNode* src_node,
                                     const TopoNode* dest_node) {
+  // landmarks precomputed by topo creator bound the cost on the lane graph
+  if (graph_ != nullptr && graph_->HasLandmarks()) {
+    return graph_->LandmarkHeuristic(src_node, dest_node);
+  }
   const auto& src_point = src_node->AnchorPoint();
   const auto& dest_point = dest_node->AnchorPoint();
   double distance = fabs(src_point.x() - dest_point.x()) +
@@ -225,6 +229,7 @@ bool AStarStrategy::Search(const TopoGraph* graph,
                            const TopoNode* src_node, const TopoNode* dest_node,
                            std::vector<NodeWithRange>* const result_nodes) {
   Clear();
+  graph_ = graph;
   AINFO << "Start A* search algorithm.";
 
   std::priority_queue<SearchNode> open_set_detail;
@@ -42,6 +42,7 @@ class AStarStrategy : public Strategy {
 
  private:
   bool change_lane_enabled_;
+  const TopoGraph* graph_ = nullptr;
   std::unordered_set<const TopoNode*> open_set_;
   std::unordered_set<const TopoNode*> closed_set_;
   std::unordered_map<const TopoNode*, const TopoNode*> came_from_;
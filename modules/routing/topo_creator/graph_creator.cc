@@ -25,6 +25,7 @@
 #include "modules/map/hdmap/adapter/opendrive_adapter.h"
 #include "modules/routing/common/routing_gflags.h"
 #include "modules/routing/topo_creator/edge_creator.h"
+#include "modules/routing/topo_creator/landmark_creator.h"
 #include "modules/routing/topo_creator/node_creator.h"
 
 namespace apollo {
@@ -142,6 +143,12 @@ bool GraphCreator::Create() {
     }
   }
 
+  if (routing_conf_.num_landmarks() > 0) {
+    landmark_creator::CreateLandmarks(
+        static_cast<int>(routing_conf_.num_landmarks()), &graph_);
+    AINFO << "Number of landmarks: " << graph_.landmark_size();
+  }
+
   if (!EndWith(dump_topo_file_path_, ".bin") &&
       !EndWith(dump_topo_file_path_, ".txt")) {
     AERROR << "Failed to dump topo data into file, incorrect file type "
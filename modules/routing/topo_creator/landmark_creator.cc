@@ -0,0 +1,139 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/routing/topo_creator/landmark_creator.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace apollo {
+namespace routing {
+namespace landmark_creator {
+namespace {
+
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+struct Arc {
+  int to = 0;
+  double cost = 0.0;
+};
+
+using Adjacency = std::vector<std::vector<Arc>>;
+
+// Same cost as the A* search: the edge plus the node it enters, with half
+// of both node costs refunded on a lane change.
+double ArcCost(const Edge& edge, const Node& from, const Node& to) {
+  if (edge.direction_type() == Edge::FORWARD) {
+    return edge.cost() + to.cost();
+  }
+  return std::max(0.0, edge.cost() + (to.cost() - from.cost()) / 2.0);
+}
+
+void Dijkstra(const Adjacency& adjacency, const int source,
+              std::vector<double>* const costs) {
+  costs->assign(adjacency.size(), kInfinity);
+  using Entry = std::pair<double, int>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+  (*costs)[source] = 0.0;
+  queue.emplace(0.0, source);
+  while (!queue.empty()) {
+    const Entry top = queue.top();
+    queue.pop();
+    if (top.first > (*costs)[top.second]) {
+      continue;
+    }
+    for (const Arc& arc : adjacency[top.second]) {
+      const double cost = top.first + arc.cost;
+      if (cost < (*costs)[arc.to]) {
+        (*costs)[arc.to] = cost;
+        queue.emplace(cost, arc.to);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+void CreateLandmarks(const int num_landmarks, Graph* const graph) {
+  graph->clear_landmark();
+  const int num_nodes = graph->node_size();
+  if (num_landmarks <= 0 || num_nodes == 0) {
+    return;
+  }
+  std::unordered_map<std::string, int> node_index_map;
+  for (int i = 0; i < num_nodes; ++i) {
+    node_index_map[graph->node(i).lane_id()] = i;
+  }
+  Adjacency forward(num_nodes);
+  Adjacency backward(num_nodes);
+  for (const auto& edge : graph->edge()) {
+    const auto from_iter = node_index_map.find(edge.from_lane_id());
+    const auto to_iter = node_index_map.find(edge.to_lane_id());
+    if (from_iter == node_index_map.end() || to_iter == node_index_map.end()) {
+      continue;
+    }
+    const int from = from_iter->second;
+    const int to = to_iter->second;
+    const double cost = ArcCost(edge, graph->node(from), graph->node(to));
+    forward[from].push_back({to, cost});
+    backward[to].push_back({from, cost});
+  }
+
+  // the first landmark is the node farthest from an arbitrary one, every
+  // next one the node farthest from all the landmarks chosen so far
+  std::vector<double> separation(num_nodes, kInfinity);
+  std::vector<double> cost_from;
+  std::vector<double> cost_to;
+  Dijkstra(forward, 0, &cost_from);
+  for (int i = 0; i < num_nodes; ++i) {
+    separation[i] = cost_from[i] == kInfinity ? 0.0 : cost_from[i];
+  }
+  for (int k = 0; k < std::min(num_landmarks, num_nodes); ++k) {
+    const int landmark = static_cast<int>(
+        std::max_element(separation.begin(), separation.end()) -
+        separation.begin());
+    if (k > 0 && separation[landmark] <= 0.0) {
+      break;
+    }
+    Dijkstra(forward, landmark, &cost_from);
+    Dijkstra(backward, landmark, &cost_to);
+    auto* landmark_pb = graph->add_landmark();
+    landmark_pb->set_lane_id(graph->node(landmark).lane_id());
+    for (int i = 0; i < num_nodes; ++i) {
+      landmark_pb->add_cost_from(cost_from[i]);
+      landmark_pb->add_cost_to(cost_to[i]);
+      double distance = 0.0;
+      if (cost_from[i] != kInfinity) {
+        distance += cost_from[i];
+      }
+      if (cost_to[i] != kInfinity) {
+        distance += cost_to[i];
+      }
+      separation[i] = k == 0 ? distance : std::min(separation[i], distance);
+    }
+    separation[landmark] = 0.0;
+  }
+}
+
+}  // namespace landmark_creator
+}  // namespace routing
+}  // namespace apollo
@@ -0,0 +1,33 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include "modules/routing/proto/topo_graph.pb.h"
+
+namespace apollo {
+namespace routing {
+namespace landmark_creator {
+
+// Picks up to num_landmarks nodes of the graph by farthest selection and
+// stores the lower bound costs between them and every node into the graph.
+// The bounds only assume a lane change never costs less than zero, so that
+// they stay admissible for the A* search on any sub graph.
+void CreateLandmarks(const int num_landmarks, Graph* const graph);
+
+}  // namespace landmark_creator
+}  // namespace routing
+}  // namespace apollo
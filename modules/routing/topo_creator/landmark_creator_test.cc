@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/routing/topo_creator/landmark_creator.h"
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "modules/routing/graph/topo_graph.h"
+#include "modules/routing/graph/topo_test_utils.h"
+
+namespace apollo {
+namespace routing {
+
+TEST(LandmarkCreatorTest, CreateLandmarks) {
+  Graph graph;
+  GetGraph2ForTest(&graph);
+  landmark_creator::CreateLandmarks(0, &graph);
+  EXPECT_EQ(0, graph.landmark_size());
+
+  landmark_creator::CreateLandmarks(2, &graph);
+  ASSERT_EQ(2, graph.landmark_size());
+  // L6 is the farthest from L1, then L1 the farthest from L6
+  const auto& first = graph.landmark(0);
+  EXPECT_EQ(TEST_L6, first.lane_id());
+  ASSERT_EQ(graph.node_size(), first.cost_from_size());
+  ASSERT_EQ(graph.node_size(), first.cost_to_size());
+  const double forward_cost = TEST_EDGE_COST + TEST_LANE_COST;
+  const double change_cost = TEST_EDGE_COST;
+  EXPECT_DOUBLE_EQ(2.0 * forward_cost + 2.0 * change_cost, first.cost_to(0));
+  EXPECT_DOUBLE_EQ(0.0, first.cost_to(5));
+  EXPECT_TRUE(std::isinf(first.cost_from(0)));
+  EXPECT_DOUBLE_EQ(0.0, first.cost_from(5));
+
+  const auto& second = graph.landmark(1);
+  EXPECT_EQ(TEST_L1, second.lane_id());
+  EXPECT_DOUBLE_EQ(change_cost, second.cost_from(1));
+  EXPECT_DOUBLE_EQ(forward_cost, second.cost_from(2));
+  EXPECT_DOUBLE_EQ(change_cost, second.cost_to(1));
+}
+
+TEST(LandmarkCreatorTest, LandmarkHeuristic) {
+  Graph graph;
+  GetGraph2ForTest(&graph);
+  TopoGraph topo_graph;
+  ASSERT_TRUE(topo_graph.LoadGraph(graph));
+  EXPECT_FALSE(topo_graph.HasLandmarks());
+
+  landmark_creator::CreateLandmarks(2, &graph);
+  ASSERT_TRUE(topo_graph.LoadGraph(graph));
+  ASSERT_TRUE(topo_graph.HasLandmarks());
+  const TopoNode* node_1 = topo_graph.GetNode(TEST_L1);
+  const TopoNode* node_4 = topo_graph.GetNode(TEST_L4);
+  const TopoNode* node_6 = topo_graph.GetNode(TEST_L6);
+  const double forward_cost = TEST_EDGE_COST + TEST_LANE_COST;
+  const double change_cost = TEST_EDGE_COST;
+  // the bound is exact along the only route, less the destination lane
+  EXPECT_DOUBLE_EQ(2.0 * forward_cost + 2.0 * change_cost - TEST_LANE_COST,
+                   topo_graph.LandmarkHeuristic(node_1, node_6));
+  EXPECT_DOUBLE_EQ(forward_cost + change_cost - TEST_LANE_COST,
+                   topo_graph.LandmarkHeuristic(node_4, node_6));
+  // L1 can not be reached from L6
+  EXPECT_DOUBLE_EQ(0.0, topo_graph.LandmarkHeuristic(node_6, node_1));
+  EXPECT_DOUBLE_EQ(0.0, topo_graph.LandmarkHeuristic(node_6, node_6));
+
+  graph.mutable_landmark(0)->clear_cost_to();
+  EXPECT_FALSE(topo_graph.LoadGraph(graph));
+}
+
+}  // namespace routing
+}  // namespace apollo
@@ -14,12 +14,18 @@
  * limitations under the License.
  *****************************************************************************/
 
+
 /**
  * @file
  */
 
 #include "modules/third_party_perception/fusion.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "modules/common/math/polygon2d.h"
@@ -32,58 +38,121 @@ namespace apollo {
 namespace third_party_perception {
 namespace fusion {
 
+using apollo::common::math::Polygon2d;
 using apollo::common::math::Vec2d;
 using apollo::perception::PerceptionObstacle;
 using apollo::perception::PerceptionObstacles;
 
-std::vector<Vec2d> PerceptionObstacleToVectorVec2d(
-    const PerceptionObstacle& obstacle) {
-  std::vector<Vec2d> result;
+namespace {
+
+constexpr double kMinCellSize = 1.0;
+
+bool ToPolygon(const PerceptionObstacle& obstacle, Polygon2d* polygon) {
+  if (obstacle.polygon_point_size() < 3) {
+    return false;
+  }
+  std::vector<Vec2d> points;
+  points.reserve(obstacle.polygon_point_size());
   for (const auto& vertex : obstacle.polygon_point()) {
-    result.emplace_back(vertex.x(), vertex.y());
+    points.emplace_back(vertex.x(), vertex.y());
   }
-  return result;
+  *polygon = Polygon2d(std::move(points));
+  return true;
 }
 
-bool HasOverlap(const PerceptionObstacle& obstacle_1,
-                const PerceptionObstacle& obstacle_2) {
-  common::math::Polygon2d polygon_1(
-      PerceptionObstacleToVectorVec2d(obstacle_1));
-  common::math::Polygon2d polygon_2(
-      PerceptionObstacleToVectorVec2d(obstacle_2));
-  return polygon_1.HasOverlap(polygon_2);
+int64_t CellKey(const int64_t x, const int64_t y) {
+  return (x << 32) ^ (y & 0xffffffff);
 }
 
-bool HasOverlap(const PerceptionObstacle& obstacle,
-                const PerceptionObstacles& obstacles) {
-  for (const auto& current_obstacle : obstacles.perception_obstacle()) {
-    if (HasOverlap(obstacle, current_obstacle)) {
-      return true;
+// Calls func with the key of every cell the bounding box of the polygon,
+// padded by the overlap tolerance, touches.
+template <typename Func>
+void ForEachCell(const Polygon2d& polygon, const double cell_size,
+                 const Func& func) {
+  const double padding = common::math::kMathEpsilon;
+  const auto cell = [cell_size](const double value) {
+    return static_cast<int64_t>(std::floor(value / cell_size));
+  };
+  const int64_t max_x = cell(polygon.max_x() + padding);
+  const int64_t max_y = cell(polygon.max_y() + padding);
+  for (int64_t x = cell(polygon.min_x() - padding); x <= max_x; ++x) {
+    for (int64_t y = cell(polygon.min_y() - padding); y <= max_y; ++y) {
+      func(CellKey(x, y));
     }
   }
-  return false;
 }
 
+}  // namespace
+
 PerceptionObstacles MobileyeRadarFusion(
     const PerceptionObstacles& mobileye_obstacles,
     const PerceptionObstacles& radar_obstacles) {
   PerceptionObstacles mobileye_obstacles_fusion = mobileye_obstacles;
-  PerceptionObstacles radar_obstacles_fusion = radar_obstacles;
-
-  for (auto& mobileye_obstacle :
-       *(mobileye_obstacles_fusion.mutable_perception_obstacle())) {
-    for (auto& radar_obstacle :
-         *(radar_obstacles_fusion.mutable_perception_obstacle())) {
-      if (HasOverlap(mobileye_obstacle, radar_obstacle)) {
-        mobileye_obstacle.set_confidence(0.99);
-        mobileye_obstacle.mutable_velocity()->CopyFrom(
-            radar_obstacle.velocity());
-      }
+  MobileyeRadarFusion(radar_obstacles, &mobileye_obstacles_fusion);
+  return mobileye_obstacles_fusion;
+}
+
+void MobileyeRadarFusion(const PerceptionObstacles& radar_obstacles,
+                         PerceptionObstacles* mobileye_obstacles) {
+  const int num_radars = radar_obstacles.perception_obstacle_size();
+  if (num_radars == 0) {
+    return;
+  }
+
+  // the radar footprints in square cells as large as the largest of them,
+  // so that each is in at most four cells
+  std::vector<Polygon2d> radar_polygons(num_radars);
+  std::vector<bool> has_polygon(num_radars, false);
+  double cell_size = kMinCellSize;
+  for (int i = 0; i < num_radars; ++i) {
+    if (ToPolygon(radar_obstacles.perception_obstacle(i),
+                  &radar_polygons[i])) {
+      const Polygon2d& footprint = radar_polygons[i];
+      has_polygon[i] = true;
+      cell_size = std::max({cell_size, footprint.max_x() - footprint.min_x(),
+                            footprint.max_y() - footprint.min_y()});
+    }
+  }
+  std::unordered_map<int64_t, std::vector<int>> cells;
+  for (int i = 0; i < num_radars; ++i) {
+    if (has_polygon[i]) {
+      ForEachCell(radar_polygons[i], cell_size,
+                  [&cells, i](const int64_t key) { cells[key].push_back(i); });
     }
   }
 
-  // mobileye_obstacles_fusion.MergeFrom(radar_obstacles_fusion);
-  return mobileye_obstacles_fusion;
+  // a mobileye obstacle checks the radar obstacles sharing a cell with it,
+  // each once, and keeps the last one it overlaps
+  std::vector<int> checked_by(num_radars, -1);
+  Polygon2d polygon;
+  for (int i = 0; i < mobileye_obstacles->perception_obstacle_size(); ++i) {
+    PerceptionObstacle* mobileye_obstacle =
+        mobileye_obstacles->mutable_perception_obstacle(i);
+    if (!ToPolygon(*mobileye_obstacle, &polygon)) {
+      continue;
+    }
+    int matched = -1;
+    ForEachCell(polygon, cell_size, [&](const int64_t key) {
+      const auto it = cells.find(key);
+      if (it == cells.end()) {
+        return;
+      }
+      for (const int j : it->second) {
+        if (j <= matched || checked_by[j] == i) {
+          continue;
+        }
+        checked_by[j] = i;
+        if (polygon.HasOverlap(radar_polygons[j])) {
+          matched = j;
+        }
+      }
+    });
+    if (matched >= 0) {
+      mobileye_obstacle->set_confidence(0.99);
+      mobileye_obstacle->mutable_velocity()->CopyFrom(
+          radar_obstacles.perception_obstacle(matched).velocity());
+    }
+  }
 }
 
 }  // namespace fusion
@@ -34,6 +34,16 @@ apollo::perception::PerceptionObstacles MobileyeRadarFusion(
     const apollo::perception::PerceptionObstacles& mobileye_obstacles,
     const apollo::perception::PerceptionObstacles& radar_obstacles);
 
+/**
+ * @brief Fuses the radar obstacles into the mobileye obstacles in place. A
+ *   mobileye obstacle overlapping radar obstacles takes the velocity of the
+ *   last of them and a confidence of 0.99. The candidate pairs come from a
+ *   spatial hash of the radar obstacles rather than from every pair.
+ */
+void MobileyeRadarFusion(
+    const apollo::perception::PerceptionObstacles& radar_obstacles,
+    apollo::perception::PerceptionObstacles* mobileye_obstacles);
+
 }  // namespace fusion
 }  // namespace third_party_perception
 }  // namespace apollo
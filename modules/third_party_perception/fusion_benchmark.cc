@@ -0,0 +1,184 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+/**
+ * @file
+ * @brief Compares the spatial hash fusion with the reference one it
+ *        replaced, which rebuilt the polygons of every mobileye and radar
+ *        obstacle pair and copied both obstacle lists, on random scenes.
+ *
+ * Example:
+ *   fusion_benchmark --benchmark_radar_obstacles=400
+ **/
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "gflags/gflags.h"
+#include "google/protobuf/util/message_differencer.h"
+
+#include "modules/common/math/box2d.h"
+#include "modules/common/math/polygon2d.h"
+#include "modules/third_party_perception/fusion.h"
+
+DEFINE_int32(benchmark_mobileye_obstacles, 20, "mobileye obstacles");
+DEFINE_int32(benchmark_radar_obstacles, 400,
+             "radar obstacles of the largest scene, the others have 1/8, "
+             "1/4 and 1/2 of them");
+DEFINE_int32(benchmark_iterations, 200, "runs of every case");
+
+namespace apollo {
+namespace third_party_perception {
+namespace fusion {
+namespace {
+
+using apollo::common::math::Box2d;
+using apollo::common::math::Polygon2d;
+using apollo::common::math::Vec2d;
+using apollo::perception::PerceptionObstacle;
+using apollo::perception::PerceptionObstacles;
+
+std::mt19937 random_engine(0);
+
+// obstacles in the 120m x 30m ahead of the car, like the radars report them
+void AddRandomObstacles(const int num_obstacles,
+                        PerceptionObstacles* obstacles) {
+  std::uniform_real_distribution<double> x(0.0, 120.0);
+  std::uniform_real_distribution<double> y(-15.0, 15.0);
+  std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+  std::uniform_real_distribution<double> length(0.5, 5.0);
+  std::uniform_real_distribution<double> width(0.5, 2.5);
+  std::uniform_real_distribution<double> speed(-10.0, 10.0);
+  for (int i = 0; i < num_obstacles; ++i) {
+    PerceptionObstacle* obstacle = obstacles->add_perception_obstacle();
+    obstacle->set_id(i);
+    const Box2d box({x(random_engine), y(random_engine)},
+                    heading(random_engine), length(random_engine),
+                    width(random_engine));
+    obstacle->mutable_position()->set_x(box.center_x());
+    obstacle->mutable_position()->set_y(box.center_y());
+    obstacle->set_theta(box.heading());
+    obstacle->set_length(box.length());
+    obstacle->set_width(box.width());
+    for (const Vec2d& corner : box.GetAllCorners()) {
+      auto* point = obstacle->add_polygon_point();
+      point->set_x(corner.x());
+      point->set_y(corner.y());
+    }
+    obstacle->mutable_velocity()->set_x(speed(random_engine));
+    obstacle->mutable_velocity()->set_y(speed(random_engine));
+    obstacle->set_confidence(0.5);
+  }
+}
+
+// The fusion before the spatial hash.
+bool ReferenceHasOverlap(const PerceptionObstacle& obstacle_1,
+                         const PerceptionObstacle& obstacle_2) {
+  const auto to_points = [](const PerceptionObstacle& obstacle) {
+    std::vector<Vec2d> result;
+    for (const auto& vertex : obstacle.polygon_point()) {
+      result.emplace_back(vertex.x(), vertex.y());
+    }
+    return result;
+  };
+  Polygon2d polygon_1(to_points(obstacle_1));
+  Polygon2d polygon_2(to_points(obstacle_2));
+  return polygon_1.HasOverlap(polygon_2);
+}
+
+PerceptionObstacles ReferenceFusion(
+    const PerceptionObstacles& mobileye_obstacles,
+    const PerceptionObstacles& radar_obstacles) {
+  PerceptionObstacles mobileye_obstacles_fusion = mobileye_obstacles;
+  PerceptionObstacles radar_obstacles_fusion = radar_obstacles;
+  for (auto& mobileye_obstacle :
+       *(mobileye_obstacles_fusion.mutable_perception_obstacle())) {
+    for (auto& radar_obstacle :
+         *(radar_obstacles_fusion.mutable_perception_obstacle())) {
+      if (ReferenceHasOverlap(mobileye_obstacle, radar_obstacle)) {
+        mobileye_obstacle.set_confidence(0.99);
+        mobileye_obstacle.mutable_velocity()->CopyFrom(
+            radar_obstacle.velocity());
+      }
+    }
+  }
+  return mobileye_obstacles_fusion;
+}
+
+template <typename Func>
+double TimeUs(const Func& func) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < FLAGS_benchmark_iterations; ++i) {
+    func();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() /
+         FLAGS_benchmark_iterations;
+}
+
+void Benchmark(const int num_radar_obstacles) {
+  PerceptionObstacles mobileye_obstacles;
+  PerceptionObstacles radar_obstacles;
+  AddRandomObstacles(FLAGS_benchmark_mobileye_obstacles, &mobileye_obstacles);
+  AddRandomObstacles(num_radar_obstacles, &radar_obstacles);
+
+  PerceptionObstacles reference_output;
+  const double reference_us = TimeUs([&]() {
+    reference_output = ReferenceFusion(mobileye_obstacles, radar_obstacles);
+  });
+
+  // the fusion works in place, so the copy of its input is timed as well
+  PerceptionObstacles output;
+  const double fusion_us = TimeUs([&]() {
+    output = mobileye_obstacles;
+    MobileyeRadarFusion(radar_obstacles, &output);
+  });
+
+  int fused = 0;
+  for (const auto& obstacle : output.perception_obstacle()) {
+    fused += obstacle.confidence() > 0.9 ? 1 : 0;
+  }
+  const bool same = google::protobuf::util::MessageDifferencer::Equals(
+      reference_output, output);
+  std::cout << std::setw(8) << num_radar_obstacles << std::setw(8) << fused
+            << std::fixed << std::setprecision(2) << std::setw(14)
+            << reference_us << std::setw(12) << fusion_us << std::setw(10)
+            << reference_us / fusion_us << std::setw(8)
+            << (same ? "yes" : "NO") << std::endl;
+}
+
+}  // namespace
+}  // namespace fusion
+}  // namespace third_party_perception
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  std::cout << std::setw(8) << "radar" << std::setw(8) << "fused"
+            << std::setw(14) << "reference us" << std::setw(12) << "fusion us"
+            << std::setw(10) << "speedup" << std::setw(8) << "same"
+            << std::endl;
+  for (const int divisor : {8, 4, 2, 1}) {
+    apollo::third_party_perception::fusion::Benchmark(
+        FLAGS_benchmark_radar_obstacles / divisor);
+  }
+  return 0;
+}
@@ -0,0 +1,88 @@
+/******************************************************************************
+ * Copyright 2018 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#include "modules/third_party_perception/fusion.h"
+
+#include <utility>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace third_party_perception {
+namespace fusion {
+
+using apollo::perception::PerceptionObstacle;
+using apollo::perception::PerceptionObstacles;
+
+namespace {
+
+void AddSquare(const double x, const double y, const double size,
+               const double velocity_x, PerceptionObstacles* obstacles) {
+  PerceptionObstacle* obstacle = obstacles->add_perception_obstacle();
+  obstacle->set_confidence(0.5);
+  obstacle->mutable_velocity()->set_x(velocity_x);
+  for (const auto& corner : {std::make_pair(x, y), std::make_pair(x + size, y),
+                             std::make_pair(x + size, y + size),
+                             std::make_pair(x, y + size)}) {
+    auto* point = obstacle->add_polygon_point();
+    point->set_x(corner.first);
+    point->set_y(corner.second);
+  }
+}
+
+}  // namespace
+
+TEST(FusionTest, MobileyeRadarFusion) {
+  PerceptionObstacles mobileye_obstacles;
+  AddSquare(0.0, 0.0, 2.0, 0.0, &mobileye_obstacles);
+  AddSquare(50.0, 50.0, 2.0, 0.0, &mobileye_obstacles);
+  AddSquare(100.0, 0.0, 4.0, 0.0, &mobileye_obstacles);
+
+  PerceptionObstacles radar_obstacles;
+  // the first and the last radar obstacles overlap the first mobileye one
+  AddSquare(1.0, 1.0, 2.0, 1.0, &radar_obstacles);
+  AddSquare(20.0, 0.0, 2.0, 2.0, &radar_obstacles);
+  AddSquare(103.5, 3.5, 0.5, 3.0, &radar_obstacles);
+  AddSquare(-1.0, -1.0, 1.0, 4.0, &radar_obstacles);
+  // a large radar obstacle grows the cells
+  AddSquare(200.0, 200.0, 30.0, 5.0, &radar_obstacles);
+
+  MobileyeRadarFusion(radar_obstacles, &mobileye_obstacles);
+  const auto& fused = mobileye_obstacles.perception_obstacle();
+  EXPECT_DOUBLE_EQ(0.99, fused.Get(0).confidence());
+  EXPECT_DOUBLE_EQ(4.0, fused.Get(0).velocity().x());
+  EXPECT_DOUBLE_EQ(0.5, fused.Get(1).confidence());
+  EXPECT_DOUBLE_EQ(0.0, fused.Get(1).velocity().x());
+  EXPECT_DOUBLE_EQ(0.99, fused.Get(2).confidence());
+  EXPECT_DOUBLE_EQ(3.0, fused.Get(2).velocity().x());
+}
+
+TEST(FusionTest, NoPolygon) {
+  PerceptionObstacles mobileye_obstacles;
+  mobileye_obstacles.add_perception_obstacle()->set_confidence(0.5);
+  PerceptionObstacles radar_obstacles;
+  AddSquare(0.0, 0.0, 2.0, 1.0, &radar_obstacles);
+  radar_obstacles.add_perception_obstacle();
+
+  const PerceptionObstacles fused =
+      MobileyeRadarFusion(mobileye_obstacles, radar_obstacles);
+  EXPECT_DOUBLE_EQ(0.5, fused.perception_obstacle(0).confidence());
+}
+
+}  // namespace fusion
+}  // namespace third_party_perception
+}  // namespace apollo
@@ -97,8 +97,8 @@ bool ThirdPartyPerception::Process(PerceptionObstacles* const response) {
 
   std::lock_guard<std::mutex> lock(third_party_perception_mutex_);
 
-  *response =
-      fusion::MobileyeRadarFusion(mobileye_obstacles_, radar_obstacles_);
+  fusion::MobileyeRadarFusion(radar_obstacles_, &mobileye_obstacles_);
+  response->Swap(&mobileye_obstacles_);
 
   common::util::FillHeader(FLAGS_third_party_perception_node_name, response);
 
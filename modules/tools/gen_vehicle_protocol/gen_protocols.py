@@ -105,12 +105,6 @@ def gen_report_value_offset_precision(var, p):
         doc string:
     """
     impl = ""
-    if var["is_signed_var"]:
-        fmt = "\n  x <<= %d;\n  x >>= %d;\n"
-        # x is a int32_t var
-        shift_bit = 32 - var["len"]
-        impl = impl + fmt % (shift_bit, shift_bit)
-
     returntype = var["type"]
     if var["type"] == "enum":
         returntype = p["name"].capitalize() + "::" + var["name"].capitalize(
@@ -131,24 +125,19 @@ def gen_report_value_offset_precision(var, p):
 
 def gen_parse_value_impl(var, byte_info):
     """
-        doc string:
+        doc string: the signal layout is a compile time constant, so the
+        unpack inlines to a few shifts and masks
     """
-    impl = ""
-    fmt = "\n  Byte t%d(bytes + %d);\n"
-    shift_bit = 0
-    for i in range(0, len(byte_info)):
-        info = byte_info[i]
-        impl = impl + fmt % (i, info["byte"])
-        if i == 0:
-            impl = impl + "  int32_t x = t%d.get_byte(%d, %d);\n" %\
-                (i, info["start_bit"], info["len"])
-        elif i == 1:
-            impl = impl + "  int32_t t = t%d.get_byte(%d, %d);\n  x <<= %d;\n  x |= t;\n" %\
-                (i, info["start_bit"], info["len"], info["len"])
-        else:
-            impl = impl + "  t = t%d.get_byte(%d, %d);\n  x <<= %d;\n  x |= t;\n" %\
-                (i, info["start_bit"], info["len"], info["len"])
-        shift_bit = shift_bit + info["len"]
+    pieces = ["SignalPiece<%d, %d, %d>" %
+              (info["byte"], info["start_bit"], info["len"])
+              for info in byte_info]
+    impl = "\n  using Layout = SignalLayout<"
+    impl = impl + (",\n" + " " * len("  using Layout = SignalLayout<")).join(
+        pieces) + ">;\n"
+    if var["is_signed_var"]:
+        impl = impl + "  int32_t x = Layout::UnpackSigned(bytes);\n"
+    else:
+        impl = impl + "  int32_t x = Layout::Unpack(bytes);\n"
     return impl
 
 
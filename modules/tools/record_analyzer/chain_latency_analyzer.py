@@ -0,0 +1,125 @@
+#!/usr/bin/env python
+
+###############################################################################
+# Copyright 2018 The Apollo Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+###############################################################################
+
+from common.statistical_analyzer import PrintColors
+
+
+def percentile(sorted_data, p):
+    """linearly interpolated percentile of sorted data"""
+    if len(sorted_data) == 0:
+        return 0.0
+    pos = (len(sorted_data) - 1) * p / 100.0
+    lower = int(pos)
+    upper = min(lower + 1, len(sorted_data) - 1)
+    return sorted_data[lower] + \
+        (sorted_data[upper] - sorted_data[lower]) * (pos - lower)
+
+
+def distribution(data):
+    """summary of a latency distribution"""
+    sorted_data = sorted(data)
+    if len(sorted_data) == 0:
+        return {"count": 0}
+    return {"count": len(sorted_data),
+            "mean": sum(sorted_data) / len(sorted_data),
+            "p50": percentile(sorted_data, 50),
+            "p95": percentile(sorted_data, 95),
+            "p99": percentile(sorted_data, 99),
+            "max": sorted_data[-1]}
+
+
+class ChainLatencyAnalyzer:
+    """latency along a chain of modules, e.g. lidar to control
+
+    The messages of one sensor frame are matched through the lidar timestamp
+    each module copies from its input into its header. The latency of a hop
+    is the time between the publishing of its input and its output, the
+    transport latency is the time between the publishing of a message and
+    its reception by the recorder.
+    """
+
+    def __init__(self, hops):
+        """hops is a list of (name, channel) in the order of the chain"""
+        self.hops = hops
+        self.hop_index = {}
+        for index, (_, channel) in enumerate(hops):
+            self.hop_index[channel] = index
+        # lidar timestamp -> publish time of the first message of each hop
+        self.frames = {}
+        self.hop_latency = [[] for _ in hops]
+        self.transport_latency = [[] for _ in hops]
+        self.endtoend_latency = []
+
+    def put(self, channel, header, receive_time):
+        """put the header of a message and its receive time in ns"""
+        index = self.hop_index.get(channel)
+        if index is None or header.lidar_timestamp == 0:
+            return
+        publish_time = header.timestamp_sec
+        self.transport_latency[index].append(
+            (receive_time * 1.0e-9 - publish_time) * 1000.0)
+        frame = self.frames.setdefault(header.lidar_timestamp,
+                                       [None] * len(self.hops))
+        if frame[index] is not None:
+            # e.g. control runs again on the same planning trajectory
+            return
+        frame[index] = publish_time
+        if index > 0 and frame[index - 1] is not None:
+            self.hop_latency[index].append(
+                (publish_time - frame[index - 1]) * 1000.0)
+        if index == len(self.hops) - 1 and frame[0] is not None:
+            self.endtoend_latency.append((publish_time - frame[0]) * 1000.0)
+
+    def missed_frames(self):
+        """the frames of the first hop which never reached the last one"""
+        return sum(1 for frame in self.frames.values()
+                   if frame[0] is not None and frame[-1] is None)
+
+    def results(self):
+        """latency distributions in ms"""
+        hops = {}
+        transport = {}
+        for index, (name, _) in enumerate(self.hops):
+            if index > 0:
+                hops[name] = distribution(self.hop_latency[index])
+            transport[name] = distribution(self.transport_latency[index])
+        return {"hop": hops,
+                "transport": transport,
+                "endtoend": distribution(self.endtoend_latency),
+                "missed_frames": self.missed_frames()}
+
+    def print_results(self):
+        """print latency distributions"""
+        results = self.results()
+        print PrintColors.HEADER + "* Chain Latency (ms)" + PrintColors.ENDC
+        row = "  {0:<24}{1:>8}{2:>10}{3:>10}{4:>10}{5:>10}{6:>10}"
+        print row.format("", "count", "mean", "p50", "p95", "p99", "max")
+        lines = [("hop " + name, results["hop"].get(name))
+                 for name, _ in self.hops[1:]]
+        lines += [("transport " + name, results["transport"][name])
+                  for name, _ in self.hops]
+        lines.append(("endtoend", results["endtoend"]))
+        for name, dist in lines:
+            if dist["count"] == 0:
+                print row.format(name, 0, "-", "-", "-", "-", "-")
+                continue
+            print row.format(name, dist["count"],
+                             *["{0:.2f}".format(dist[key]) for key in
+                               ("mean", "p50", "p95", "p99", "max")])
+        print PrintColors.FAIL + "  - MISS # OF FRAMES: " + \
+            str(results["missed_frames"]) + PrintColors.ENDC
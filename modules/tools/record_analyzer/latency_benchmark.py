@@ -0,0 +1,250 @@
+#!/usr/bin/env python
+
+###############################################################################
+# Copyright 2018 The Apollo Authors. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+###############################################################################
+"""
+Replay a record through mainboard with the production DAGs and measure the
+latency of the lidar to control chain, the CPU usage and the memory high
+water mark of every DAG. Fails when they regress against a stored baseline.
+
+usage: python latency_benchmark.py -f record_file -o output_dir \
+           [-b baseline.json [--update_baseline]]
+"""
+
+import argparse
+import json
+import os
+import signal
+import subprocess
+import sys
+import time
+
+from cyber_py.record import RecordReader
+from modules.control.proto import control_cmd_pb2
+from modules.drivers.proto import pointcloud_pb2
+from modules.perception.proto import perception_obstacle_pb2
+from modules.planning.proto import planning_pb2
+from modules.prediction.proto import prediction_obstacle_pb2
+from chain_latency_analyzer import ChainLatencyAnalyzer
+from common.statistical_analyzer import PrintColors
+
+DAGS = [
+    "/apollo/modules/drivers/velodyne/dag/velodyne.dag",
+    "/apollo/modules/perception/production/dag/dag_streaming_perception.dag",
+    "/apollo/modules/prediction/dag/prediction.dag",
+    "/apollo/modules/planning/dag/planning.dag",
+    "/apollo/modules/control/dag/control.dag",
+]
+
+# (name, channel, message class) in the order of the chain
+HOPS = [
+    ("convert", "/apollo/sensor/lidar128/PointCloud2",
+     pointcloud_pb2.PointCloud),
+    ("compensator", "/apollo/sensor/lidar128/compensator/PointCloud2",
+     pointcloud_pb2.PointCloud),
+    ("perception", "/apollo/perception/obstacles",
+     perception_obstacle_pb2.PerceptionObstacles),
+    ("prediction", "/apollo/prediction",
+     prediction_obstacle_pb2.PredictionObstacles),
+    ("planning", "/apollo/planning", planning_pb2.ADCTrajectory),
+    ("control", "/apollo/control", control_cmd_pb2.ControlCommand),
+]
+
+# published by the modules under test, so not replayed from the record
+PRODUCED_CHANNELS = [hop[1] for hop in HOPS] + [
+    "/perception/inner/SegmentationObjects",
+    "/perception/inner/PrefusedObjects",
+]
+
+CLOCK_TICKS = os.sysconf("SC_CLK_TCK")
+
+
+def cpu_seconds(pid):
+    """user and system time of a process"""
+    with open("/proc/%d/stat" % pid) as stat:
+        # the command name in parentheses may contain spaces
+        fields = stat.read().rsplit(")", 1)[1].split()
+    return (int(fields[11]) + int(fields[12])) / float(CLOCK_TICKS)
+
+
+def memory_high_water_mark(pid):
+    """peak resident set size of a process in MB"""
+    with open("/proc/%d/status" % pid) as status:
+        for line in status:
+            if line.startswith("VmHWM:"):
+                return int(line.split()[1]) / 1024.0
+    return 0.0
+
+
+def stop(process, timeout=10.0):
+    """interrupt a process, kill it if it does not exit in time"""
+    if process.poll() is not None:
+        return
+    process.send_signal(signal.SIGINT)
+    deadline = time.time() + timeout
+    while process.poll() is None and time.time() < deadline:
+        time.sleep(0.1)
+    if process.poll() is None:
+        process.kill()
+        process.wait()
+
+
+def run(args):
+    """replay the record and return the usage of every dag"""
+    output_record = os.path.join(args.output, "latency_benchmark.record")
+    modules = []
+    recorder = None
+    try:
+        for dag in args.dag:
+            name = os.path.splitext(os.path.basename(dag))[0]
+            log = open(os.path.join(args.output, name + ".log"), "w")
+            modules.append((name, subprocess.Popen(
+                ["mainboard", "-d", dag], stdout=log, stderr=log)))
+        time.sleep(args.warmup)
+        for name, process in modules:
+            if process.poll() is not None:
+                sys.exit("mainboard of %s exited during warmup" % name)
+
+        record_cmd = ["cyber_recorder", "record", "-o", output_record]
+        for hop in HOPS:
+            record_cmd += ["-c", hop[1]]
+        recorder = subprocess.Popen(record_cmd)
+        time.sleep(1.0)
+
+        play_cmd = ["cyber_recorder", "play", "-f", args.file]
+        for channel in PRODUCED_CHANNELS:
+            play_cmd += ["-k", channel]
+        start_time = time.time()
+        start_cpu = dict((name, cpu_seconds(process.pid))
+                         for name, process in modules)
+        subprocess.call(play_cmd)
+        # let the last frames go through the chain
+        time.sleep(args.drain)
+        duration = time.time() - start_time
+
+        usage = {}
+        for name, process in modules:
+            usage[name] = {
+                "cpu": (cpu_seconds(process.pid) - start_cpu[name]) /
+                duration * 100.0,
+                "memory": memory_high_water_mark(process.pid)}
+    finally:
+        if recorder is not None:
+            stop(recorder)
+        for _, process in modules:
+            stop(process)
+    return output_record, usage
+
+
+def analyze(record_file):
+    """latency of the chain in the recorded output"""
+    analyzer = ChainLatencyAnalyzer([(hop[0], hop[1]) for hop in HOPS])
+    message_classes = dict((hop[1], hop[2]) for hop in HOPS)
+    reader = RecordReader(record_file)
+    for msg in reader.read_messages():
+        message_class = message_classes.get(msg.topic)
+        if message_class is None:
+            continue
+        message = message_class()
+        message.ParseFromString(msg.message)
+        analyzer.put(msg.topic, message.header, msg.timestamp)
+    analyzer.print_results()
+    return analyzer.results()
+
+
+def metrics(report):
+    """the values compared against the baseline, larger is worse"""
+    values = {"endtoend.p95": report["latency"]["endtoend"].get("p95", 0.0)}
+    for name, dist in report["latency"]["hop"].items():
+        values["hop." + name + ".p95"] = dist.get("p95", 0.0)
+    for name, usage in report["usage"].items():
+        values["cpu." + name] = usage["cpu"]
+        values["memory." + name] = usage["memory"]
+    return values
+
+
+def check_regression(report, baseline, tolerance):
+    """names of the metrics worse than the baseline by more than tolerance"""
+    current = metrics(report)
+    regressions = []
+    for name, base in sorted(metrics(baseline).items()):
+        value = current.get(name)
+        if value is None or base <= 0.0:
+            continue
+        if value > base * (1.0 + tolerance):
+            regressions.append(name)
+            print PrintColors.FAIL + "  - REGRESSION %s: %.2f > %.2f" % \
+                (name, value, base) + PrintColors.ENDC
+    return regressions
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Lidar to control latency benchmark.",
+        prog="latency_benchmark.py")
+    parser.add_argument(
+        "-f", "--file", action="store", type=str, required=True,
+        help="Specify the record file to replay.")
+    parser.add_argument(
+        "-o", "--output", action="store", type=str, required=True,
+        help="Specify the directory for the output record, logs and report.")
+    parser.add_argument(
+        "-d", "--dag", action="append", type=str,
+        help="Specify a dag to launch, the production dags by default.")
+    parser.add_argument(
+        "-b", "--baseline", action="store", type=str,
+        help="Specify the baseline report to compare against.")
+    parser.add_argument(
+        "-u", "--update_baseline", action="store_const", const=True,
+        help="Store the report as the baseline instead of comparing.")
+    parser.add_argument(
+        "-t", "--tolerance", action="store", type=float, default=0.1,
+        help="Allowed relative regression against the baseline.")
+    parser.add_argument(
+        "--warmup", action="store", type=float, default=20.0,
+        help="Seconds to wait for the modules to initialize.")
+    parser.add_argument(
+        "--drain", action="store", type=float, default=3.0,
+        help="Seconds to wait for the last frames after the replay.")
+    args = parser.parse_args()
+    if not args.dag:
+        args.dag = DAGS
+    if not os.path.isdir(args.output):
+        os.makedirs(args.output)
+
+    output_record, usage = run(args)
+    report = {"latency": analyze(output_record), "usage": usage}
+    print PrintColors.HEADER + "* CPU (%) and Memory High Water Mark (MB)" + \
+        PrintColors.ENDC
+    for name, value in sorted(usage.items()):
+        print "  {0:<32}{1:>8.1f}{2:>10.1f}".format(
+            name, value["cpu"], value["memory"])
+    with open(os.path.join(args.output, "latency_report.json"), "w") as out:
+        json.dump(report, out, indent=2, sort_keys=True)
+
+    if report["latency"]["endtoend"]["count"] == 0:
+        sys.exit("no frame went through the whole chain")
+    if args.baseline is None:
+        sys.exit(0)
+    if args.update_baseline:
+        with open(args.baseline, "w") as out:
+            json.dump(report, out, indent=2, sort_keys=True)
+        sys.exit(0)
+    with open(args.baseline) as baseline_file:
+        baseline = json.load(baseline_file)
+    if check_regression(report, baseline, args.tolerance):
+        sys.exit(1)
+    print PrintColors.OKGREEN + "  - NO REGRESSION" + PrintColors.ENDC